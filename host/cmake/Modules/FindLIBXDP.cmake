@@ -0,0 +1,43 @@
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# - Find libxdp
+# Find the libxdp includes and libraries, which provide the AF_XDP socket API
+# (xdp/xsk.h). libxdp itself depends on libbpf.
+# This module defines
+#  LIBXDP_INCLUDE_DIRS, where to find xdp/xsk.h
+#  LIBXDP_LIBRARIES, the libraries needed to use AF_XDP sockets
+#  LIBXDP_FOUND, If false, do not try to use libxdp.
+# Override LIBXDP_INCLUDE_DIRS and LIBXDP_LIBRARIES to manually set
+
+find_package(PkgConfig QUIET)
+pkg_check_modules(PC_LIBXDP QUIET libxdp)
+pkg_check_modules(PC_LIBBPF QUIET libbpf)
+
+find_path(LIBXDP_INCLUDE_DIRS
+    NAMES xdp/xsk.h
+    HINTS ${PC_LIBXDP_INCLUDEDIR}
+    PATHS /usr/local/include /usr/include
+)
+
+find_library(LIBXDP_LIBRARY
+    NAMES xdp
+    HINTS ${PC_LIBXDP_LIBDIR}
+    PATHS /usr/local/lib /usr/lib
+)
+
+find_library(LIBBPF_LIBRARY
+    NAMES bpf
+    HINTS ${PC_LIBBPF_LIBDIR}
+    PATHS /usr/local/lib /usr/lib
+)
+
+if(NOT LIBXDP_LIBRARIES AND LIBXDP_LIBRARY AND LIBBPF_LIBRARY)
+    set(LIBXDP_LIBRARIES ${LIBXDP_LIBRARY} ${LIBBPF_LIBRARY})
+endif()
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(LIBXDP DEFAULT_MSG LIBXDP_LIBRARIES LIBXDP_INCLUDE_DIRS)
+mark_as_advanced(LIBXDP_INCLUDE_DIRS LIBXDP_LIBRARIES LIBXDP_LIBRARY LIBBPF_LIBRARY)
@@ -13,12 +13,20 @@
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
 #include <boost/thread/thread.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <complex>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
+#ifdef __linux__
+#    include <pthread.h>
+#    include <time.h>
+#endif
 
 namespace po = boost::program_options;
 using namespace std::chrono_literals;
@@ -43,6 +51,422 @@ std::atomic_ullong num_late_commands{0};
 std::atomic_ullong num_timeouts_rx{0};
 std::atomic_ullong num_timeouts_tx{0};
 
+/***********************************************************************
+ * Time series of the test results
+ **********************************************************************/
+struct counters_t
+{
+    unsigned long long received_samps;
+    unsigned long long dropped_samps;
+    unsigned long long overruns;
+    unsigned long long transmitted_samps;
+    unsigned long long tx_seq_errs;
+    unsigned long long rx_seq_errs;
+    unsigned long long underruns;
+    unsigned long long late_cmds;
+    unsigned long long tx_timeouts;
+    unsigned long long rx_timeouts;
+};
+
+counters_t get_counters()
+{
+    return {num_rx_samps,
+        num_dropped_samps,
+        num_overruns,
+        num_tx_samps,
+        num_seq_errors,
+        num_seqrx_errors,
+        num_underruns,
+        num_late_commands,
+        num_timeouts_tx,
+        num_timeouts_rx};
+}
+
+void reset_counters()
+{
+    num_overruns      = 0;
+    num_underruns     = 0;
+    num_rx_samps      = 0;
+    num_tx_samps      = 0;
+    num_dropped_samps = 0;
+    num_seq_errors    = 0;
+    num_seqrx_errors  = 0;
+    num_late_commands = 0;
+    num_timeouts_rx   = 0;
+    num_timeouts_tx   = 0;
+}
+
+counters_t operator+(const counters_t& lhs, const counters_t& rhs)
+{
+    return {lhs.received_samps + rhs.received_samps,
+        lhs.dropped_samps + rhs.dropped_samps,
+        lhs.overruns + rhs.overruns,
+        lhs.transmitted_samps + rhs.transmitted_samps,
+        lhs.tx_seq_errs + rhs.tx_seq_errs,
+        lhs.rx_seq_errs + rhs.rx_seq_errs,
+        lhs.underruns + rhs.underruns,
+        lhs.late_cmds + rhs.late_cmds,
+        lhs.tx_timeouts + rhs.tx_timeouts,
+        lhs.rx_timeouts + rhs.rx_timeouts};
+}
+
+counters_t operator-(const counters_t& lhs, const counters_t& rhs)
+{
+    return {lhs.received_samps - rhs.received_samps,
+        lhs.dropped_samps - rhs.dropped_samps,
+        lhs.overruns - rhs.overruns,
+        lhs.transmitted_samps - rhs.transmitted_samps,
+        lhs.tx_seq_errs - rhs.tx_seq_errs,
+        lhs.rx_seq_errs - rhs.rx_seq_errs,
+        lhs.underruns - rhs.underruns,
+        lhs.late_cmds - rhs.late_cmds,
+        lhs.tx_timeouts - rhs.tx_timeouts,
+        lhs.rx_timeouts - rhs.rx_timeouts};
+}
+
+std::string counters_to_json(const counters_t& counters)
+{
+    return str(boost::format("\"received_samps\": %u, \"dropped_samps\": %u, "
+                             "\"overruns\": %u, \"transmitted_samps\": %u, "
+                             "\"tx_seq_errs\": %u, \"rx_seq_errs\": %u, "
+                             "\"underruns\": %u, \"late_cmds\": %u, "
+                             "\"tx_timeouts\": %u, \"rx_timeouts\": %u")
+               % counters.received_samps % counters.dropped_samps % counters.overruns
+               % counters.transmitted_samps % counters.tx_seq_errs % counters.rx_seq_errs
+               % counters.underruns % counters.late_cmds % counters.tx_timeouts
+               % counters.rx_timeouts);
+}
+
+// Returns the CPU time a thread has used so far in seconds, or a negative
+// value if it is unknown
+double get_thread_cpu_time(boost::thread* thread)
+{
+#ifdef __linux__
+    clockid_t clock_id;
+    struct timespec cpu_time;
+    if (pthread_getcpuclockid(thread->native_handle(), &clock_id) == 0
+        and clock_gettime(clock_id, &cpu_time) == 0) {
+        return double(cpu_time.tv_sec) + double(cpu_time.tv_nsec) * 1e-9;
+    }
+#else
+    (void)thread;
+#endif
+    return -1.0;
+}
+
+// The changes of the counters during an interval of the test, and the load the
+// streaming threads put on the CPU (as a fraction of one core)
+struct interval_t
+{
+    double time;
+    double duration;
+    counters_t counters;
+    std::vector<double> cpu_loads;
+};
+
+std::string cpu_load_to_json(const double load)
+{
+    return load < 0.0 ? std::string("null") : str(boost::format("%.4f") % load);
+}
+
+std::string cpu_load_to_str(const double load)
+{
+    return load < 0.0 ? std::string("n/a") : str(boost::format("%.2f") % load);
+}
+
+// The names of the streaming threads of a run of the benchmark, and the time
+// series of its counters
+struct benchmark_result_t
+{
+    double duration = 0.0;
+    std::vector<std::string> thread_names;
+    std::vector<interval_t> intervals;
+};
+
+/***********************************************************************
+ * Scaling matrix
+ **********************************************************************/
+// The channels and streamers of a run of the benchmark
+struct benchmark_layout_t
+{
+    std::vector<size_t> rx_channels;
+    std::vector<size_t> tx_channels;
+    bool multi_streamer = false;
+    uhd::device_addr_t rx_stream_args;
+    uhd::device_addr_t tx_stream_args;
+    // The settings of the scaling matrix, which the stream args include
+    size_t num_channels    = 0;
+    size_t convert_threads = 0;
+    std::string scaling_args;
+};
+
+// The results of a run of the scaling matrix
+struct scaling_run_t
+{
+    benchmark_layout_t layout;
+    std::vector<std::string> thread_names;
+    // The intervals after the first one, which includes the start of streaming
+    interval_t steady_state;
+    counters_t totals;
+    double rx_rate;
+    double tx_rate;
+};
+
+// A run keeps up if it streams at least this share of the requested samples
+constexpr double MIN_EFFICIENCY = 0.99;
+
+std::vector<size_t> parse_list(const std::string& list)
+{
+    std::vector<std::string> strings;
+    boost::split(strings, list, boost::is_any_of("\"',"));
+    std::vector<size_t> values;
+    for (const auto& value : strings) {
+        values.push_back(std::stoul(value));
+    }
+    return values;
+}
+
+// Returns the layouts of the scaling matrix: Every channel count, with every
+// streamer layout, number of convert threads, and set of stream args
+std::vector<benchmark_layout_t> get_scaling_layouts(
+    const std::vector<size_t>& rx_channels,
+    const std::vector<size_t>& tx_channels,
+    const std::vector<size_t>& channel_counts,
+    const std::string& streamers,
+    const std::vector<size_t>& convert_threads,
+    const std::string& scaling_stream_args,
+    const std::string& rx_stream_args,
+    const std::string& tx_stream_args)
+{
+    std::vector<std::string> streamer_layouts, arg_sets;
+    boost::split(streamer_layouts, streamers, boost::is_any_of(","));
+    boost::split(arg_sets, scaling_stream_args, boost::is_any_of(";"));
+    for (const auto& streamer_layout : streamer_layouts) {
+        if (streamer_layout != "single" and streamer_layout != "multi") {
+            throw std::runtime_error("Invalid streamer layout: " + streamer_layout);
+        }
+    }
+    // The channels of a run are the first ones of the RX and TX channels
+    auto get_channels = [](const std::vector<size_t>& channels, const size_t num) {
+        if (channels.empty()) {
+            return channels;
+        }
+        if (num == 0 or num > channels.size()) {
+            throw std::runtime_error(
+                "Invalid scaling channel count: " + std::to_string(num));
+        }
+        return std::vector<size_t>(channels.begin(), channels.begin() + num);
+    };
+
+    std::vector<benchmark_layout_t> layouts;
+    for (const size_t num_channels : channel_counts) {
+        for (const auto& streamer_layout : streamer_layouts) {
+            const bool multi_streamer = (streamer_layout == "multi");
+            // With one channel, both streamer layouts are the same
+            if (multi_streamer and num_channels == 1 and streamer_layouts.size() > 1) {
+                continue;
+            }
+            // A streamer uses at most one convert thread per channel after the
+            // first one, so skip the thread counts which it would reduce to the
+            // same number
+            const size_t max_threads = multi_streamer ? 0 : num_channels - 1;
+            std::vector<size_t> thread_counts;
+            for (const size_t num_threads : convert_threads) {
+                const size_t count = std::min(num_threads, max_threads);
+                if (std::find(thread_counts.begin(), thread_counts.end(), count)
+                    == thread_counts.end()) {
+                    thread_counts.push_back(count);
+                }
+            }
+            for (const size_t num_threads : thread_counts) {
+                for (const auto& args : arg_sets) {
+                    benchmark_layout_t layout;
+                    layout.rx_channels     = get_channels(rx_channels, num_channels);
+                    layout.tx_channels     = get_channels(tx_channels, num_channels);
+                    layout.multi_streamer  = multi_streamer;
+                    layout.rx_stream_args  = uhd::device_addr_t(rx_stream_args);
+                    layout.tx_stream_args  = uhd::device_addr_t(tx_stream_args);
+                    layout.num_channels    = num_channels;
+                    layout.convert_threads = num_threads;
+                    layout.scaling_args    = args;
+                    const uhd::device_addr_t scaling_args(args);
+                    for (auto* stream_args :
+                        {&layout.rx_stream_args, &layout.tx_stream_args}) {
+                        (*stream_args)["convert_threads"] = std::to_string(num_threads);
+                        for (const auto& key : scaling_args.keys()) {
+                            (*stream_args)[key] = scaling_args.get(key);
+                        }
+                    }
+                    layouts.push_back(layout);
+                }
+            }
+        }
+    }
+    return layouts;
+}
+
+std::string get_layout_str(const benchmark_layout_t& layout)
+{
+    return str(boost::format("%u channel(s), %s, %u convert thread(s)%s")
+               % layout.num_channels
+               % (layout.multi_streamer ? "one streamer per channel" : "one streamer")
+               % layout.convert_threads
+               % (layout.scaling_args.empty() ? "" : ", " + layout.scaling_args));
+}
+
+// Returns the sum of the intervals after the first one, with the mean CPU loads
+// of the threads
+interval_t get_steady_state(const std::vector<interval_t>& intervals)
+{
+    const size_t first = intervals.size() > 1 ? 1 : 0;
+    interval_t steady_state{0.0, 0.0, {}, {}};
+    for (size_t i = first; i < intervals.size(); i++) {
+        const interval_t& interval = intervals[i];
+        steady_state.duration += interval.duration;
+        steady_state.counters = steady_state.counters + interval.counters;
+        steady_state.cpu_loads.resize(interval.cpu_loads.size(), 0.0);
+        for (size_t j = 0; j < interval.cpu_loads.size(); j++) {
+            // Once a load is unknown, so is its mean
+            if (interval.cpu_loads[j] < 0.0 or steady_state.cpu_loads[j] < 0.0) {
+                steady_state.cpu_loads[j] = -1.0;
+            } else {
+                steady_state.cpu_loads[j] += interval.cpu_loads[j] * interval.duration;
+            }
+        }
+    }
+    for (auto& load : steady_state.cpu_loads) {
+        if (load > 0.0) {
+            load /= steady_state.duration;
+        }
+    }
+    if (first < intervals.size()) {
+        steady_state.time = intervals[first].time - intervals[first].duration;
+    }
+    return steady_state;
+}
+
+double get_msps(const unsigned long long num_samps, const double duration)
+{
+    return duration > 0.0 ? num_samps / duration / 1e6 : 0.0;
+}
+
+// Returns the share of the requested samples which a run streamed
+double get_efficiency(const scaling_run_t& run)
+{
+    const double requested = (run.rx_rate * run.layout.rx_channels.size()
+                                 + run.tx_rate * run.layout.tx_channels.size())
+                             * run.steady_state.duration;
+    const double streamed = double(run.steady_state.counters.received_samps)
+                            + double(run.steady_state.counters.transmitted_samps);
+    return requested > 0.0 ? streamed / requested : 0.0;
+}
+
+unsigned long long get_num_errors(const counters_t& counters)
+{
+    return counters.overruns + counters.tx_seq_errs + counters.rx_seq_errs
+           + counters.underruns + counters.late_cmds + counters.tx_timeouts
+           + counters.rx_timeouts;
+}
+
+void print_scaling_summary(const std::vector<scaling_run_t>& runs)
+{
+    std::cout << std::endl
+              << "Scaling summary (rates and CPU loads without the first interval):\n"
+              << boost::format("  %3s %5s %-9s %4s %-28s %9s %9s %6s %6s %6s %6s\n")
+                     % "Run" % "Chans" % "Streamers" % "Conv" % "Stream args"
+                     % "RX Msps" % "TX Msps" % "Eff" % "Errors" % "CPU" % "Max";
+    bool all_kept_up = true;
+    for (size_t i = 0; i < runs.size(); i++) {
+        const scaling_run_t& run = runs[i];
+        const double efficiency  = get_efficiency(run);
+        const auto num_errors    = get_num_errors(run.totals);
+        const bool kept_up       = efficiency >= MIN_EFFICIENCY and num_errors == 0;
+        all_kept_up              = all_kept_up and kept_up;
+        // The total and the largest load of the threads, if all are known
+        double total_load = 0.0, max_load = 0.0;
+        for (const double load : run.steady_state.cpu_loads) {
+            total_load = (load < 0.0 or total_load < 0.0) ? -1.0 : total_load + load;
+            max_load   = (load < 0.0 or max_load < 0.0) ? -1.0 : std::max(max_load, load);
+        }
+        std::cout << boost::format(
+                         "  %3u %5u %-9s %4u %-28s %9.2f %9.2f %5.1f%% %6u %6s %6s%s\n")
+                         % (i + 1) % run.layout.num_channels
+                         % (run.layout.multi_streamer ? "multi" : "single")
+                         % run.layout.convert_threads % run.layout.scaling_args
+                         % get_msps(run.steady_state.counters.received_samps,
+                             run.steady_state.duration)
+                         % get_msps(run.steady_state.counters.transmitted_samps,
+                             run.steady_state.duration)
+                         % (efficiency * 100) % num_errors % cpu_load_to_str(total_load)
+                         % cpu_load_to_str(max_load) % (kept_up ? "" : " *");
+    }
+    std::cout << std::endl
+              << "CPU load of the streaming threads (as a fraction of one core):\n";
+    for (size_t i = 0; i < runs.size(); i++) {
+        std::cout << boost::format("  %3u:") % (i + 1);
+        for (size_t j = 0; j < runs[i].thread_names.size(); j++) {
+            std::cout << " " << runs[i].thread_names[j] << "="
+                      << cpu_load_to_str(runs[i].steady_state.cpu_loads[j]);
+        }
+        std::cout << std::endl;
+    }
+    if (not all_kept_up) {
+        std::cout << std::endl
+                  << "* The run streamed less than "
+                  << boost::format("%.0f%%") % (MIN_EFFICIENCY * 100)
+                  << " of the requested samples, or had errors. Host scaling stops at "
+                     "the first such layout."
+                  << std::endl;
+    }
+}
+
+void write_scaling_json(const std::string& json_file,
+    const std::vector<scaling_run_t>& runs,
+    const double duration,
+    const double stats_interval)
+{
+    std::ofstream json(json_file);
+    json << "{\n"
+         << boost::format("  \"duration\": %f, \"stats_interval\": %f,\n") % duration
+                % stats_interval
+         << "  \"runs\": [";
+    for (size_t i = 0; i < runs.size(); i++) {
+        const scaling_run_t& run = runs[i];
+        json << (i ? ",\n" : "\n")
+             << boost::format(
+                    "    {\"num_channels\": %u, \"multi_streamer\": %s, "
+                    "\"convert_threads\": %u, \"stream_args\": \"%s\",\n"
+                    "     \"rx_rate\": %f, \"num_rx_channels\": %u, "
+                    "\"tx_rate\": %f, \"num_tx_channels\": %u,\n"
+                    "     \"steady_state_duration\": %f, \"rx_msps\": %f, "
+                    "\"tx_msps\": %f, \"efficiency\": %f,\n"
+                    "     \"summary\": {%s},\n")
+                    % run.layout.num_channels
+                    % (run.layout.multi_streamer ? "true" : "false")
+                    % run.layout.convert_threads % run.layout.scaling_args % run.rx_rate
+                    % run.layout.rx_channels.size() % run.tx_rate
+                    % run.layout.tx_channels.size() % run.steady_state.duration
+                    % get_msps(run.steady_state.counters.received_samps,
+                        run.steady_state.duration)
+                    % get_msps(run.steady_state.counters.transmitted_samps,
+                        run.steady_state.duration)
+                    % get_efficiency(run) % counters_to_json(run.totals)
+             << "     \"threads\": [";
+        for (size_t j = 0; j < run.thread_names.size(); j++) {
+            json << (j ? ", " : "") << "\"" << run.thread_names[j] << "\"";
+        }
+        json << "], \"cpu_loads\": [";
+        for (size_t j = 0; j < run.steady_state.cpu_loads.size(); j++) {
+            json << (j ? ", " : "") << cpu_load_to_json(run.steady_state.cpu_loads[j]);
+        }
+        json << "]}";
+    }
+    json << "\n  ]\n}\n";
+    if (!json) {
+        std::cerr << "Failed to write " << json_file << std::endl;
+    }
+}
+
 inline auto time_delta(const start_time_type& ref_time)
 {
     return std::chrono::steady_clock::now() - ref_time;
@@ -352,6 +776,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     double tx_delay, rx_delay;
     std::string priority;
     bool elevate_priority = false;
+    std::string json_file;
+    double stats_interval;
+    std::string scaling_channels, scaling_streamers, scaling_convert_threads;
+    std::string scaling_stream_args;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -393,6 +821,12 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("rx_delay", po::value<double>(&rx_delay)->default_value(0.0), "delay before starting RX in seconds")
         ("priority", po::value<std::string>(&priority)->default_value("normal"), "thread priority (normal, high)")
         ("multi_streamer", "Create a separate streamer per channel")
+        ("json", po::value<std::string>(&json_file), "write the results, including a time series of the counters and the CPU load of the streaming threads, to this JSON file")
+        ("stats_interval", po::value<double>(&stats_interval)->default_value(1.0), "length of the intervals of the time series in seconds")
+        ("scaling_channels", po::value<std::string>(&scaling_channels), "run the test once for every layout of a scaling matrix, with these numbers of channels from the front of the channel list (specify \"1,2,4\", etc), and report the aggregate rate and the CPU load of the streaming threads of each layout")
+        ("scaling_streamers", po::value<std::string>(&scaling_streamers)->default_value("single,multi"), "streamer layouts of the scaling matrix (single: one streamer for all channels, multi: one streamer per channel)")
+        ("scaling_convert_threads", po::value<std::string>(&scaling_convert_threads)->default_value("0"), "values of the convert_threads stream arg of the scaling matrix (specify \"0,1,3\", etc)")
+        ("scaling_stream_args", po::value<std::string>(&scaling_stream_args)->default_value(""), "sets of stream args of the scaling matrix, e.g. offload settings, separated by semicolons (specify \"recv_offload=0;recv_offload=1\", etc)")
     ;
     // clang-format on
     po::variables_map vm;
@@ -405,10 +839,16 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         std::cout << "    Specify --rx_rate for a receive-only test.\n"
                      "    Specify --tx_rate for a transmit-only test.\n"
                      "    Specify both options for a full-duplex test.\n"
+                     "    Specify --scaling_channels to run the test for a matrix of\n"
+                     "    channel counts and streamer layouts.\n"
                   << std::endl;
         return ~0;
     }
 
+    if (stats_interval <= 0.0) {
+        throw std::runtime_error("The stats interval must be positive.");
+    }
+
     if (priority == "high") {
         uhd::set_thread_priority_safe();
         elevate_priority = true;
@@ -446,8 +886,6 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     std::cout << boost::format("Using Device: %s") % usrp->get_pp_string() << std::endl;
     int num_mboards = usrp->get_num_mboards();
 
-    boost::thread_group thread_group;
-
     if (vm.count("ref")) {
         if (ref == "mimo") {
             if (num_mboards != 2) {
@@ -548,26 +986,60 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         usrp->set_time_now(0.0);
     }
 
-    // spawn the receive test thread
-    if (vm.count("rx_rate")) {
-        usrp->set_rx_rate(rx_rate);
+    // Runs the benchmark once, with the channels and streamers of the layout
+    auto run_benchmark = [&](const benchmark_layout_t& layout) {
+        reset_counters();
+        burst_timer_elapsed = false;
+        boost::thread_group thread_group;
+        benchmark_result_t result;
+        std::vector<boost::thread*> threads;
+        auto name_thread = [&result, &threads](
+                               boost::thread* thread, const std::string& name) {
+            uhd::set_thread_name(thread, name);
+            result.thread_names.push_back(name);
+            threads.push_back(thread);
+        };
 
-        size_t spb = 0;
-        if (vm.count("rx_spp")) {
-            std::cout << boost::format("Setting RX spp to %u\n") % rx_spp;
-            usrp->set_rx_spp(rx_spp);
-            spb = rx_spp;
-        }
-        if (vm.count("rx_spb")) {
-            spb = rx_spb;
-        }
-        if (vm.count("multi_streamer")) {
-            for (size_t count = 0; count < rx_channel_nums.size(); count++) {
-                std::vector<size_t> this_streamer_channels{rx_channel_nums[count]};
-                 // create a receive streamer
+        // spawn the receive test thread
+        if (vm.count("rx_rate")) {
+            usrp->set_rx_rate(rx_rate);
+
+            size_t spb = 0;
+            if (vm.count("rx_spp")) {
+                std::cout << boost::format("Setting RX spp to %u\n") % rx_spp;
+                usrp->set_rx_spp(rx_spp);
+                spb = rx_spp;
+            }
+            if (vm.count("rx_spb")) {
+                spb = rx_spb;
+            }
+            if (layout.multi_streamer) {
+                for (size_t count = 0; count < layout.rx_channels.size(); count++) {
+                    std::vector<size_t> this_streamer_channels{layout.rx_channels[count]};
+                    // create a receive streamer
+                    uhd::stream_args_t stream_args(rx_cpu, rx_otw);
+                    stream_args.channels             = this_streamer_channels;
+                    stream_args.args                 = layout.rx_stream_args;
+                    uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
+                    auto rx_thread =
+                        thread_group.create_thread([=, &burst_timer_elapsed]() {
+                            benchmark_rx_rate(usrp,
+                                rx_cpu,
+                                rx_stream,
+                                spb,
+                                random_nsamps,
+                                start_time,
+                                burst_timer_elapsed,
+                                elevate_priority,
+                                rx_delay);
+                        });
+                    name_thread(rx_thread, "bmark_rx_strm" + std::to_string(count));
+                }
+            } else {
+                // create a receive streamer
                 uhd::stream_args_t stream_args(rx_cpu, rx_otw);
-                stream_args.channels             = this_streamer_channels;
-                stream_args.args                 = uhd::device_addr_t(rx_stream_args);
+                stream_args.channels             = layout.rx_channels;
+                stream_args.args                 = layout.rx_stream_args;
                 uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
                 auto rx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
                     benchmark_rx_rate(usrp,
@@ -580,123 +1052,184 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                         elevate_priority,
                         rx_delay);
                 });
-                uhd::set_thread_name(rx_thread, "bmark_rx_strm" + std::to_string(count));
+                name_thread(rx_thread, "bmark_rx_stream");
             }
         }
-        else {
-            // create a receive streamer
-            uhd::stream_args_t stream_args(rx_cpu, rx_otw);
-            stream_args.channels             = rx_channel_nums;
-            stream_args.args                 = uhd::device_addr_t(rx_stream_args);
-            uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
-            auto rx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_rx_rate(usrp,
-                    rx_cpu,
-                    rx_stream,
-                    spb,
-                    random_nsamps,
-                    start_time,
-                    burst_timer_elapsed,
-                    elevate_priority,
-                    rx_delay);
-            });
-            uhd::set_thread_name(rx_thread, "bmark_rx_stream");
-        }
-    }
-
-    // spawn the transmit test thread
-    if (vm.count("tx_rate")) {
-        usrp->set_tx_rate(tx_rate);
-
-        if (vm.count("multi_streamer")) {
-                for (size_t count = 0; count < tx_channel_nums.size(); count++) {
-                    std::vector<size_t> this_streamer_channels{tx_channel_nums[count]};
-
-            // create a transmit streamer
-            uhd::stream_args_t stream_args(tx_cpu, tx_otw);
-            stream_args.channels             = this_streamer_channels;
-            stream_args.args                 = uhd::device_addr_t(tx_stream_args);
-            uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
-            const size_t max_spp             = tx_stream->get_max_num_samps();
-            size_t spp                       = max_spp;
-            if (vm.count("tx_spp")) {
-                spp = std::min(spp, tx_spp);
-            }
-            size_t spb                       = spp;
-            if (vm.count("tx_spb")) {
-                spb = tx_spb;
-            }
-            std::cout << boost::format("Setting TX spb to %u\n") % spb;
-            auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_tx_rate(usrp,
-                tx_cpu,
-                tx_stream,
-                burst_timer_elapsed,
-                start_time,
-                spb,
-                elevate_priority,
-                tx_delay,
-                random_nsamps);
-            });
-            uhd::set_thread_name(tx_thread, "bmark_tx_strm" + std::to_string(count));
-            auto tx_async_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_tx_rate_async_helper(tx_stream, start_time, burst_timer_elapsed);
-            });
-            uhd::set_thread_name(tx_async_thread, "bmark_tx_hlpr" + std::to_string(count));
+
+        // spawn the transmit test thread
+        if (vm.count("tx_rate")) {
+            usrp->set_tx_rate(tx_rate);
+
+            if (layout.multi_streamer) {
+                for (size_t count = 0; count < layout.tx_channels.size(); count++) {
+                    std::vector<size_t> this_streamer_channels{layout.tx_channels[count]};
+
+                    // create a transmit streamer
+                    uhd::stream_args_t stream_args(tx_cpu, tx_otw);
+                    stream_args.channels             = this_streamer_channels;
+                    stream_args.args                 = layout.tx_stream_args;
+                    uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
+                    const size_t max_spp             = tx_stream->get_max_num_samps();
+                    size_t spp                       = max_spp;
+                    if (vm.count("tx_spp")) {
+                        spp = std::min(spp, tx_spp);
+                    }
+                    size_t spb = spp;
+                    if (vm.count("tx_spb")) {
+                        spb = tx_spb;
+                    }
+                    std::cout << boost::format("Setting TX spb to %u\n") % spb;
+                    auto tx_thread =
+                        thread_group.create_thread([=, &burst_timer_elapsed]() {
+                            benchmark_tx_rate(usrp,
+                                tx_cpu,
+                                tx_stream,
+                                burst_timer_elapsed,
+                                start_time,
+                                spb,
+                                elevate_priority,
+                                tx_delay,
+                                random_nsamps);
+                        });
+                    name_thread(tx_thread, "bmark_tx_strm" + std::to_string(count));
+                    auto tx_async_thread =
+                        thread_group.create_thread([=, &burst_timer_elapsed]() {
+                            benchmark_tx_rate_async_helper(
+                                tx_stream, start_time, burst_timer_elapsed);
+                        });
+                    name_thread(tx_async_thread, "bmark_tx_hlpr" + std::to_string(count));
+                }
+            } else {
+                // create a transmit streamer
+                uhd::stream_args_t stream_args(tx_cpu, tx_otw);
+                stream_args.channels             = layout.tx_channels;
+                stream_args.args                 = layout.tx_stream_args;
+                uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
+                const size_t max_spp             = tx_stream->get_max_num_samps();
+                size_t spp                       = max_spp;
+                if (vm.count("tx_spp")) {
+                    spp = std::min(spp, tx_spp);
+                }
+                size_t spb = spp;
+                if (vm.count("tx_spb")) {
+                    spb = tx_spb;
+                }
+                std::cout << boost::format("Setting TX spp to %u\n") % spp;
+                auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
+                    benchmark_tx_rate(usrp,
+                        tx_cpu,
+                        tx_stream,
+                        burst_timer_elapsed,
+                        start_time,
+                        spb,
+                        elevate_priority,
+                        tx_delay,
+                        random_nsamps);
+                });
+                name_thread(tx_thread, "bmark_tx_stream");
+                auto tx_async_thread =
+                    thread_group.create_thread([=, &burst_timer_elapsed]() {
+                        benchmark_tx_rate_async_helper(
+                            tx_stream, start_time, burst_timer_elapsed);
+                    });
+                name_thread(tx_async_thread, "bmark_tx_helper");
             }
+        }
+
+        // sleep for the required duration (add any initial delay)
+        result.duration = duration;
+        if (vm.count("rx_rate") and vm.count("tx_rate")) {
+            result.duration += std::max(rx_delay, tx_delay);
+        } else if (vm.count("rx_rate")) {
+            result.duration += rx_delay;
         } else {
-            // create a transmit streamer
-            uhd::stream_args_t stream_args(tx_cpu, tx_otw);
-            stream_args.channels             = tx_channel_nums;
-            stream_args.args                 = uhd::device_addr_t(tx_stream_args);
-            uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
-            const size_t max_spp             = tx_stream->get_max_num_samps();
-            size_t spp                       = max_spp;
-            if (vm.count("tx_spp")) {
-                spp = std::min(spp, tx_spp);
-            }
-            size_t spb                       = spp;
-            if (vm.count("tx_spb")) {
-                spb = tx_spb;
+            result.duration += tx_delay;
+        }
+        const int64_t secs         = int64_t(result.duration);
+        const int64_t usecs        = int64_t((result.duration - secs) * 1e6);
+        const auto test_start_time = std::chrono::steady_clock::now();
+        const auto test_end_time   = test_start_time + std::chrono::seconds(secs)
+                                   + std::chrono::microseconds(usecs);
+
+        // sample the counters and the CPU time of the threads in every interval
+        auto last_time         = test_start_time;
+        counters_t last_counts = get_counters();
+        std::vector<double> last_cpu_times;
+        for (auto* thread : threads) {
+            last_cpu_times.push_back(get_thread_cpu_time(thread));
+        }
+        const auto interval = std::chrono::microseconds(int64_t(stats_interval * 1e6));
+        while (last_time < test_end_time) {
+            std::this_thread::sleep_until(std::min(last_time + interval, test_end_time));
+            const auto now          = std::chrono::steady_clock::now();
+            const counters_t counts = get_counters();
+            interval_t this_interval;
+            this_interval.time =
+                std::chrono::duration<double>(now - test_start_time).count();
+            this_interval.duration =
+                std::chrono::duration<double>(now - last_time).count();
+            this_interval.counters = counts - last_counts;
+            for (size_t i = 0; i < threads.size(); i++) {
+                const double cpu_time = get_thread_cpu_time(threads[i]);
+                this_interval.cpu_loads.push_back(
+                    (cpu_time < 0.0 or last_cpu_times[i] < 0.0)
+                        ? -1.0
+                        : (cpu_time - last_cpu_times[i]) / this_interval.duration);
+                last_cpu_times[i] = cpu_time;
             }
-            std::cout << boost::format("Setting TX spp to %u\n") % spp;
-            auto tx_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_tx_rate(usrp,
-                tx_cpu,
-                tx_stream,
-                burst_timer_elapsed,
-                start_time,
-                spb,
-                elevate_priority,
-                tx_delay,
-                random_nsamps);
-            });
-            uhd::set_thread_name(tx_thread, "bmark_tx_stream");
-            auto tx_async_thread = thread_group.create_thread([=, &burst_timer_elapsed]() {
-                benchmark_tx_rate_async_helper(tx_stream, start_time, burst_timer_elapsed);
-            });
-            uhd::set_thread_name(tx_async_thread, "bmark_tx_helper");
-        }
-    }
-
-    // sleep for the required duration (add any initial delay)
-    if (vm.count("rx_rate") and vm.count("tx_rate")) {
-        duration += std::max(rx_delay, tx_delay);
-    } else if (vm.count("rx_rate")) {
-        duration += rx_delay;
-    } else {
-        duration += tx_delay;
-    }
-    const int64_t secs  = int64_t(duration);
-    const int64_t usecs = int64_t((duration - secs) * 1e6);
-    std::this_thread::sleep_for(
-        std::chrono::seconds(secs) + std::chrono::microseconds(usecs));
+            result.intervals.push_back(this_interval);
+            last_time   = now;
+            last_counts = counts;
+        }
 
-    // interrupt and join the threads
-    burst_timer_elapsed = true;
-    thread_group.join_all();
+        // interrupt and join the threads
+        burst_timer_elapsed = true;
+        thread_group.join_all();
+
+        std::cout << "[" << NOW() << "] Benchmark complete." << std::endl << std::endl;
+        return result;
+    };
+
+    if (vm.count("scaling_channels")) {
+        const auto layouts = get_scaling_layouts(rx_channel_nums,
+            tx_channel_nums,
+            parse_list(scaling_channels),
+            scaling_streamers,
+            parse_list(scaling_convert_threads),
+            scaling_stream_args,
+            rx_stream_args,
+            tx_stream_args);
+        std::vector<scaling_run_t> runs;
+        for (const auto& layout : layouts) {
+            std::cout << boost::format("[%s] Scaling run %u/%u: %s\n") % NOW()
+                             % (runs.size() + 1) % layouts.size()
+                             % get_layout_str(layout)
+                      << std::endl;
+            const benchmark_result_t result = run_benchmark(layout);
+            scaling_run_t run;
+            run.layout       = layout;
+            run.thread_names = result.thread_names;
+            run.steady_state = get_steady_state(result.intervals);
+            run.totals       = get_counters();
+            run.rx_rate      = vm.count("rx_rate") ? usrp->get_rx_rate() : 0.0;
+            run.tx_rate      = vm.count("tx_rate") ? usrp->get_tx_rate() : 0.0;
+            runs.push_back(run);
+        }
+        print_scaling_summary(runs);
+        if (vm.count("json")) {
+            write_scaling_json(json_file, runs, duration, stats_interval);
+        }
+        std::cout << std::endl << "Done!" << std::endl << std::endl;
+        return EXIT_SUCCESS;
+    }
 
-    std::cout << "[" << NOW() << "] Benchmark complete." << std::endl << std::endl;
+    benchmark_layout_t layout;
+    layout.rx_channels              = rx_channel_nums;
+    layout.tx_channels              = tx_channel_nums;
+    layout.multi_streamer           = vm.count("multi_streamer") > 0;
+    layout.rx_stream_args           = uhd::device_addr_t(rx_stream_args);
+    layout.tx_stream_args           = uhd::device_addr_t(tx_stream_args);
+    const benchmark_result_t result = run_benchmark(layout);
 
     // print summary
     const std::string threshold_err(" ERROR: Exceeds threshold!");
@@ -724,6 +1257,48 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                      % num_seq_errors % num_seqrx_errors % num_underruns
                      % num_late_commands % num_timeouts_tx % num_timeouts_rx
               << std::endl;
+
+    if (vm.count("json")) {
+        std::ofstream json(json_file);
+        json << "{\n"
+             << boost::format("  \"rx_rate\": %f, \"num_rx_channels\": %u,\n"
+                              "  \"tx_rate\": %f, \"num_tx_channels\": %u,\n"
+                              "  \"duration\": %f, \"stats_interval\": %f,\n")
+                    % (vm.count("rx_rate") ? usrp->get_rx_rate() : 0.0)
+                    % rx_channel_nums.size()
+                    % (vm.count("tx_rate") ? usrp->get_tx_rate() : 0.0)
+                    % tx_channel_nums.size() % result.duration % stats_interval
+             << "  \"threads\": [";
+        for (size_t i = 0; i < result.thread_names.size(); i++) {
+            json << (i ? ", " : "") << "\"" << result.thread_names[i] << "\"";
+        }
+        json << "],\n"
+             << "  \"intervals\": [";
+        for (size_t i = 0; i < result.intervals.size(); i++) {
+            json << (i ? ",\n" : "\n")
+                 << boost::format("    {\"time\": %f, \"duration\": %f, %s, ")
+                        % result.intervals[i].time % result.intervals[i].duration
+                        % counters_to_json(result.intervals[i].counters)
+                 << "\"cpu_loads\": [";
+            for (size_t j = 0; j < result.intervals[i].cpu_loads.size(); j++) {
+                json << (j ? ", " : "")
+                     << cpu_load_to_json(result.intervals[i].cpu_loads[j]);
+            }
+            json << "]}";
+        }
+        json << "\n  ],\n"
+             << "  \"summary\": {" << counters_to_json(get_counters())
+             << boost::format(", \"thresholds_exceeded\": %s}\n")
+                    % ((overrun_threshold_err || underrun_threshold_err
+                           || drop_threshold_err || seq_threshold_err)
+                              ? "true"
+                              : "false")
+             << "}\n";
+        if (!json) {
+            std::cerr << "Failed to write " << json_file << std::endl;
+        }
+    }
+
     // finished
     std::cout << std::endl << "Done!" << std::endl << std::endl;
 
@@ -8,13 +8,113 @@
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
 #include <complex>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <vector>
 
 namespace po = boost::program_options;
 
+/*!
+ * Histogram of latencies, in the style of an HDR histogram
+ *
+ * Values below 2^SUB_BUCKET_BITS are counted exactly. Above that, every power
+ * of two is split into 2^(SUB_BUCKET_BITS-1) equally sized buckets, so the
+ * relative error of any reported value is below 2^-(SUB_BUCKET_BITS-1), while
+ * the whole 64-bit range fits into a few thousand counters.
+ */
+class latency_histogram
+{
+public:
+    latency_histogram() : _counts((64 - SUB_BUCKET_BITS + 2) * HALF_SUB_BUCKETS, 0) {}
+
+    void record(const uint64_t value_ns)
+    {
+        _counts[_get_index(value_ns)]++;
+        _total++;
+        _max = std::max(_max, value_ns);
+    }
+
+    uint64_t get_count() const
+    {
+        return _total;
+    }
+
+    uint64_t get_max() const
+    {
+        return _max;
+    }
+
+    //! Return the smallest value which \p percentile percent of values don't exceed
+    uint64_t get_percentile(const double percentile) const
+    {
+        const uint64_t rank = std::max<uint64_t>(
+            1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * _total)));
+        uint64_t seen = 0;
+        for (size_t idx = 0; idx < _counts.size(); idx++) {
+            seen += _counts[idx];
+            if (seen >= rank) {
+                return std::min(_get_upper_bound(idx), _max);
+            }
+        }
+        return _max;
+    }
+
+    /*!
+     * Write the cumulative distribution to a file
+     *
+     * Every line is "<latency in us> <fraction of values not exceeding it>",
+     * which is the format utils/latency/graph.py reads.
+     */
+    void write_cdf(std::ostream& out) const
+    {
+        uint64_t seen = 0;
+        for (size_t idx = 0; idx < _counts.size() && seen < _total; idx++) {
+            if (_counts[idx] == 0) {
+                continue;
+            }
+            seen += _counts[idx];
+            out << (std::min(_get_upper_bound(idx), _max) / 1e3) << " "
+                << (double(seen) / _total) << std::endl;
+        }
+    }
+
+private:
+    static constexpr size_t SUB_BUCKET_BITS  = 8;
+    static constexpr size_t HALF_SUB_BUCKETS = 1 << (SUB_BUCKET_BITS - 1);
+
+    static size_t _get_index(const uint64_t value)
+    {
+        // Bucket 0 holds the values < 2^SUB_BUCKET_BITS, bucket b the values
+        // whose most significant bit is bit SUB_BUCKET_BITS - 1 + b
+        size_t bucket = 0;
+        while ((value >> bucket) >= (uint64_t(1) << SUB_BUCKET_BITS)) {
+            bucket++;
+        }
+        return bucket * HALF_SUB_BUCKETS + static_cast<size_t>(value >> bucket);
+    }
+
+    static uint64_t _get_upper_bound(const size_t idx)
+    {
+        if (idx < 2 * HALF_SUB_BUCKETS) {
+            return idx;
+        }
+        const size_t bucket    = idx / HALF_SUB_BUCKETS - 1;
+        const uint64_t sub_idx = idx - bucket * HALF_SUB_BUCKETS;
+        return ((sub_idx + 1) << bucket) - 1;
+    }
+
+    std::vector<uint64_t> _counts;
+    uint64_t _total = 0;
+    uint64_t _max   = 0;
+};
+
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
@@ -23,6 +123,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     double rate;
     double rtt;
     size_t nruns;
+    std::string stats_file;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -36,6 +137,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("rate",   po::value<double>(&rate)->default_value(100e6/4), "sample rate for receive and transmit (sps)")
         ("from-eob", "specify to define rtt to not include the time to clock out the RX samples (removes dependence on nsamps and rate)")
         ("verbose", "specify to enable inner-loop verbose")
+        ("benchmark", "record the host turnaround time of every run in a histogram and print its percentiles")
+        ("stats-file", po::value<std::string>(&stats_file)->default_value(""), "in benchmark mode, write the turnaround distribution to this file (empty: auto-generate name)")
     ;
     // clang-format on
     po::variables_map vm;
@@ -55,13 +158,21 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                "    arrive too late at the device indicate an error.\n"
                "    The smallest value of rtt that does not indicate an error is an\n"
                "    approximation for the time it takes for a sample packet to\n"
-               "    go to UHD and back to the device."
+               "    go to UHD and back to the device.\n"
+               "\n"
+               "    In benchmark mode, the time from recv() returning to send()\n"
+               "    returning is measured on the host for every run. Its percentiles\n"
+               "    are printed, and its cumulative distribution is written to a\n"
+               "    statistics file that utils/latency/graph.py can plot. Files\n"
+               "    from different UHD versions can be compared to find latency\n"
+               "    regressions."
             << std::endl;
         return EXIT_SUCCESS;
     }
 
     bool verbose  = vm.count("verbose") != 0;
     bool from_eob = vm.count("from-eob") != 0;
+    bool benchmark = vm.count("benchmark") != 0;
 
     // create a usrp device
     std::cout << std::endl;
@@ -105,6 +216,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     int underflow  = 0;
     int other      = 0;
 
+    latency_histogram turnaround_hist;
+
     for (size_t nrun = 0; nrun < nruns; nrun++) {
         /***************************************************************
          * Issue a stream command some time in the near future
@@ -120,6 +233,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
          **************************************************************/
         uhd::rx_metadata_t rx_md;
         size_t num_rx_samps = rx_stream->recv(&buffer.front(), buffer.size(), rx_md);
+        const auto rx_done  = std::chrono::steady_clock::now();
 
         if (verbose) {
             std::cout << boost::format(
@@ -143,6 +257,11 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
             tx_md.time_spec += uhd::time_spec_t(rx_time);
         }
         size_t num_tx_samps = tx_stream->send(&buffer.front(), buffer.size(), tx_md);
+        if (benchmark) {
+            const auto turnaround = std::chrono::steady_clock::now() - rx_done;
+            turnaround_hist.record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(turnaround).count());
+        }
         if (verbose) {
             std::cout << boost::format("Sent %d samples") % num_tx_samps << std::endl;
         }
@@ -222,5 +341,36 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
               << "Late packets:     " << time_error << std::endl
               << "Other errors:     " << other << std::endl
               << std::endl;
+
+    if (benchmark && turnaround_hist.get_count() > 0) {
+        std::cout << "Host turnaround (recv() to send())\n"
+                  << "================\n";
+        for (const double percentile : {50.0, 90.0, 99.0, 99.9}) {
+            std::cout << boost::format("p%-5g %10.3f us")
+                             % percentile
+                             % (turnaround_hist.get_percentile(percentile) / 1e3)
+                      << std::endl;
+        }
+        std::cout << boost::format("max    %10.3f us") % (turnaround_hist.get_max() / 1e3)
+                  << std::endl
+                  << std::endl;
+
+        if (stats_file.empty()) {
+            // Same naming scheme as the latency responder, so graph.py can
+            // sort the results
+            std::string id = usrp->get_mboard_name();
+            boost::replace_all(id, " ", "_");
+            stats_file = str(boost::format("latency-stats.id_%s-rate_%i-spb_%i-spp_%i.txt")
+                             % id % int(actual_rx_rate) % nsamps
+                             % std::min(nsamps, rx_stream->get_max_num_samps()));
+        }
+        std::ofstream stats(stats_file.c_str());
+        turnaround_hist.write_cdf(stats);
+        if (stats) {
+            std::cout << "Statistics written to: " << stats_file << std::endl;
+        } else {
+            std::cerr << "Failed to write statistics to: " << stats_file << std::endl;
+        }
+    }
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,355 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Benchmark the links between the host and the device, using null blocks.
+//
+// The null source produces packets as fast as the link and the host can take
+// them, and the null sink consumes them as fast as they arrive. Streaming from
+// and to them therefore measures the ceiling of the host and of the link, with
+// no radio involved. This tool sweeps the samples per packet, the number of
+// channels, and the I/O service mode, and prints the throughput and the CPU
+// load of every combination.
+//
+// The CHDR width is a property of the FPGA image. It is printed along with the
+// results, so comparing CHDR widths means running this tool once per image.
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/null_block_control.hpp>
+#include <uhd/rfnoc_graph.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <csignal>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace po = boost::program_options;
+using uhd::rfnoc::null_block_control;
+
+namespace {
+
+constexpr size_t BYTES_PER_SAMPLE = 4; // sc16
+
+//! Device arguments which select the I/O service modes
+const std::map<std::string, std::string> IO_MODES{
+    {"inline", ""},
+    {"offload", "recv_offload=1,send_offload=1"},
+    {"dpdk", "use_dpdk=1"},
+};
+
+std::atomic<bool> stop_signal_called{false};
+void sig_int_handler(int)
+{
+    stop_signal_called = true;
+}
+
+struct result_t
+{
+    std::string mode;
+    std::string direction;
+    size_t chdr_w;
+    size_t num_chans;
+    size_t spp;
+    //! Total number of samples streamed by the host
+    uint64_t num_samps;
+    //! Total number of packets counted by the null blocks
+    uint64_t num_fpga_pkts;
+    //! Number of errors (overflows, underflows, timeouts)
+    size_t num_errors;
+    double duration;
+    //! CPU time of the process, in percent of one core
+    double cpu_load;
+};
+
+std::vector<size_t> parse_list(const std::string& list)
+{
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","));
+    std::vector<size_t> values;
+    for (const auto& token : tokens) {
+        if (!token.empty()) {
+            values.push_back(std::stoul(token));
+        }
+    }
+    return values;
+}
+
+void recv_samps(uhd::rx_streamer::sptr rx_stream,
+    const double duration,
+    std::atomic<uint64_t>& num_samps,
+    std::atomic<size_t>& num_errors)
+{
+    std::vector<std::complex<short>> buff(rx_stream->get_max_num_samps() * 16);
+    uhd::rx_metadata_t md;
+    uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+    stream_cmd.stream_now = true;
+    rx_stream->issue_stream_cmd(stream_cmd);
+
+    const auto stop_time = std::chrono::steady_clock::now()
+                           + std::chrono::duration<double>(duration);
+    while (!stop_signal_called && std::chrono::steady_clock::now() < stop_time) {
+        num_samps += rx_stream->recv(&buff.front(), buff.size(), md, 1.0);
+        if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+            num_errors++;
+        }
+    }
+
+    stream_cmd.stream_mode = uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS;
+    rx_stream->issue_stream_cmd(stream_cmd);
+    // Drain the packets which are still in flight
+    while (rx_stream->recv(&buff.front(), buff.size(), md, 0.1)) {
+    }
+}
+
+void send_samps(uhd::tx_streamer::sptr tx_stream,
+    const double duration,
+    std::atomic<uint64_t>& num_samps,
+    std::atomic<size_t>& num_errors)
+{
+    const std::vector<std::complex<short>> buff(tx_stream->get_max_num_samps() * 16);
+    uhd::tx_metadata_t md;
+    md.start_of_burst = true;
+
+    const auto stop_time = std::chrono::steady_clock::now()
+                           + std::chrono::duration<double>(duration);
+    while (!stop_signal_called && std::chrono::steady_clock::now() < stop_time) {
+        const size_t num_sent = tx_stream->send(&buff.front(), buff.size(), md, 1.0);
+        if (num_sent < buff.size()) {
+            num_errors++;
+        }
+        num_samps += num_sent;
+        md.start_of_burst = false;
+    }
+    md.end_of_burst = true;
+    tx_stream->send("", 0, md);
+}
+
+//! Stream from or to the first num_chans null blocks at once, one thread each
+result_t run_benchmark(uhd::rfnoc::rfnoc_graph::sptr graph,
+    const std::vector<null_block_control::sptr>& null_blocks,
+    const std::string& mode,
+    const std::string& direction,
+    const size_t num_chans,
+    const size_t spp,
+    const double duration)
+{
+    const size_t chdr_w = null_blocks[0]->get_item_width() * null_blocks[0]->get_nipc();
+    uhd::stream_args_t stream_args("sc16", "sc16");
+    stream_args.args["spp"] = std::to_string(spp);
+
+    std::vector<uhd::rx_streamer::sptr> rx_streams;
+    std::vector<uhd::tx_streamer::sptr> tx_streams;
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        auto null_block = null_blocks[chan];
+        if (direction == "rx") {
+            // The packet size of the null source includes the header, which
+            // takes up one CHDR line
+            null_block->set_bytes_per_packet(
+                uint32_t(chdr_w / 8 + spp * BYTES_PER_SAMPLE));
+            null_block->set_throttle_cycles(0);
+            rx_streams.push_back(graph->create_rx_streamer(1, stream_args));
+            graph->connect(null_block->get_block_id(), 0, rx_streams.back(), 0);
+        } else {
+            tx_streams.push_back(graph->create_tx_streamer(1, stream_args));
+            graph->connect(tx_streams.back(), 0, null_block->get_block_id(), 0);
+        }
+    }
+    graph->commit();
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        null_blocks[chan]->reset_counters();
+    }
+
+    std::atomic<uint64_t> num_samps{0};
+    std::atomic<size_t> num_errors{0};
+    const std::clock_t start_cpu = std::clock();
+    const auto start_time        = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        if (direction == "rx") {
+            threads.emplace_back(recv_samps,
+                rx_streams[chan],
+                duration,
+                std::ref(num_samps),
+                std::ref(num_errors));
+        } else {
+            threads.emplace_back(send_samps,
+                tx_streams[chan],
+                duration,
+                std::ref(num_samps),
+                std::ref(num_errors));
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const double wall_time =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+    const double cpu_time = double(std::clock() - start_cpu) / CLOCKS_PER_SEC;
+
+    uint64_t num_fpga_pkts = 0;
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        num_fpga_pkts += null_blocks[chan]->get_count(
+            direction == "rx" ? null_block_control::SOURCE : null_block_control::SINK,
+            null_block_control::PACKETS);
+    }
+    // Destroying the streamers disconnects them again
+    rx_streams.clear();
+    tx_streams.clear();
+
+    return {mode,
+        direction,
+        chdr_w,
+        num_chans,
+        spp,
+        num_samps,
+        num_fpga_pkts,
+        num_errors,
+        wall_time,
+        100.0 * cpu_time / wall_time};
+}
+
+void print_result(std::ostream& out, const result_t& result, const bool csv)
+{
+    const double msps  = result.num_samps / result.duration / 1e6;
+    const double mbyps = msps * BYTES_PER_SAMPLE;
+    if (csv) {
+        out << boost::format("%s,%s,%d,%d,%d,%.3f,%.3f,%.1f,%d,%d,%d\n") % result.mode
+                   % result.direction % result.chdr_w % result.num_chans % result.spp
+                   % msps % mbyps % result.cpu_load % result.num_samps
+                   % result.num_fpga_pkts % result.num_errors;
+    } else {
+        out << boost::format("%-8s %-3s %5d %5d %6d %12.3f %10.3f %7.1f %10d %7d\n")
+                   % result.mode % result.direction % result.chdr_w % result.num_chans
+                   % result.spp % msps % mbyps % result.cpu_load % result.num_fpga_pkts
+                   % result.num_errors;
+    }
+}
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string args, modes, directions, chans_list, spp_list, csv_file;
+    double duration;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("args", po::value<std::string>(&args)->default_value(""), "device address args")
+        ("modes", po::value<std::string>(&modes)->default_value("inline,offload"), "comma-separated I/O service modes to test (inline, offload, dpdk)")
+        ("directions", po::value<std::string>(&directions)->default_value("rx,tx"), "comma-separated directions to test (rx, tx)")
+        ("chans", po::value<std::string>(&chans_list)->default_value(""), "comma-separated numbers of channels (null blocks) to stream at once. Defaults to powers of two up to the number of null blocks.")
+        ("spp", po::value<std::string>(&spp_list)->default_value("256,512,1024,1996"), "comma-separated samples per packet to test")
+        ("duration", po::value<double>(&duration)->default_value(2.0), "seconds to stream per measurement")
+        ("csv", po::value<std::string>(&csv_file), "also write the results to this CSV file")
+    ;
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << "[RFNOC] Measure the link and host throughput using null blocks"
+                  << std::endl
+                  << desc << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<std::string> mode_names, direction_names;
+    boost::split(mode_names, modes, boost::is_any_of(","));
+    boost::split(direction_names, directions, boost::is_any_of(","));
+    for (const auto& mode : mode_names) {
+        if (!IO_MODES.count(mode)) {
+            std::cerr << "Unknown I/O service mode: " << mode << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    for (const auto& direction : direction_names) {
+        if (direction != "rx" && direction != "tx") {
+            std::cerr << "Unknown direction: " << direction << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    const std::vector<size_t> spps = parse_list(spp_list);
+
+    std::signal(SIGINT, &sig_int_handler);
+
+    std::ofstream csv;
+    if (!csv_file.empty()) {
+        csv.open(csv_file);
+        csv << "mode,direction,chdr_w,num_chans,spp,msps,mbytes_per_s,cpu_percent,"
+               "num_samps,num_fpga_pkts,num_errors\n";
+    }
+
+    std::vector<result_t> results;
+    for (const auto& mode : mode_names) {
+        std::string mode_args = args;
+        if (!IO_MODES.at(mode).empty()) {
+            mode_args += (mode_args.empty() ? "" : ",") + IO_MODES.at(mode);
+        }
+        std::cout << "Creating the RFNoC graph with args: " << mode_args << std::endl;
+        auto graph = uhd::rfnoc::rfnoc_graph::make(mode_args);
+
+        std::vector<null_block_control::sptr> null_blocks;
+        for (const auto& block_id : graph->find_blocks<null_block_control>("")) {
+            null_blocks.push_back(graph->get_block<null_block_control>(block_id));
+        }
+        if (null_blocks.empty()) {
+            std::cerr << "Error: Device has no null blocks." << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::vector<size_t> num_chans_list = parse_list(chans_list);
+        if (num_chans_list.empty()) {
+            for (size_t num_chans = 1; num_chans <= null_blocks.size(); num_chans *= 2) {
+                num_chans_list.push_back(num_chans);
+            }
+        }
+
+        for (const auto& direction : direction_names) {
+            for (const size_t num_chans : num_chans_list) {
+                if (num_chans == 0 || num_chans > null_blocks.size()) {
+                    std::cerr << "Skipping " << num_chans << " channels, the device has "
+                              << null_blocks.size() << " null blocks" << std::endl;
+                    continue;
+                }
+                for (const size_t spp : spps) {
+                    if (stop_signal_called) {
+                        break;
+                    }
+                    results.push_back(run_benchmark(
+                        graph, null_blocks, mode, direction, num_chans, spp, duration));
+                    print_result(std::cout, results.back(), false);
+                    if (csv.is_open()) {
+                        print_result(csv, results.back(), true);
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << std::endl
+              << boost::format("%-8s %-3s %5s %5s %6s %12s %10s %7s %10s %7s\n")
+                     % "mode" % "dir" % "chdr" % "chans" % "spp" % "total Msps"
+                     % "MB/s" % "CPU %" % "FPGA pkts" % "errors";
+    for (const auto& result : results) {
+        print_result(std::cout, result, false);
+    }
+    std::cout << std::endl
+              << "CPU % is the CPU time of all streaming threads, in percent of one "
+                 "core."
+              << std::endl;
+    return EXIT_SUCCESS;
+}
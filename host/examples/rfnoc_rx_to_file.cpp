@@ -15,12 +15,14 @@
 #include <uhd/types/tune_request.hpp>
 #include <uhd/utils/graph_utils.hpp>
 #include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_recorder.hpp>
 #include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <chrono>
 #include <complex>
 #include <csignal>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <thread>
@@ -38,6 +40,7 @@ void sig_int_handler(int)
 template <typename samp_type>
 void recv_to_file(uhd::rx_streamer::sptr rx_stream,
     const std::string& file,
+    const uhd::sample_recorder::config_t& recorder_config,
     const size_t samps_per_buff,
     const double rx_rate,
     const unsigned long long num_requested_samples,
@@ -51,9 +54,12 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
 
     uhd::rx_metadata_t md;
     std::vector<samp_type> buff(samps_per_buff);
-    std::ofstream outfile;
+    std::vector<void*> buffs(1, &buff.front());
+    // The recorder writes the file on separate threads, so the disk does not
+    // hold up this one. The samples are received into its buffers.
+    uhd::sample_recorder::sptr recorder;
     if (not file.empty()) {
-        outfile.open(file.c_str(), std::ofstream::binary);
+        recorder = uhd::sample_recorder::make(file, 1, recorder_config);
     }
     bool overflow_message = true;
 
@@ -85,8 +91,18 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
            and (time_requested == 0.0 or std::chrono::steady_clock::now() <= stop_time)) {
         const auto now = std::chrono::steady_clock::now();
 
+        size_t max_rx_samps = buff.size();
+        if (recorder) {
+            const size_t num_bytes = recorder->get_write_buffs(buffs, 3.0);
+            if (num_bytes == 0) {
+                std::cout << "Timeout while writing to file" << std::endl;
+                break;
+            }
+            max_rx_samps = std::min(max_rx_samps, num_bytes / sizeof(samp_type));
+        }
+
         size_t num_rx_samps =
-            rx_stream->recv(&buff.front(), buff.size(), md, 3.0, enable_size_map);
+            rx_stream->recv(buffs, max_rx_samps, md, 3.0, enable_size_map);
 
         if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
             std::cout << "Timeout while streaming" << std::endl;
@@ -124,8 +140,8 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
 
         num_total_samps += num_rx_samps;
 
-        if (outfile.is_open()) {
-            outfile.write((const char*)&buff.front(), num_rx_samps * sizeof(samp_type));
+        if (recorder) {
+            recorder->commit(num_rx_samps * sizeof(samp_type));
         }
 
         if (bw_summary) {
@@ -153,8 +169,9 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
         num_post_samps = rx_stream->recv(&buff.front(), buff.size(), md, 3.0);
     } while (num_post_samps and md.error_code == uhd::rx_metadata_t::ERROR_CODE_NONE);
 
-    if (outfile.is_open())
-        outfile.close();
+    if (recorder) {
+        recorder->close();
+    }
 
     if (stats) {
         std::cout << std::endl;
@@ -166,6 +183,10 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
                   << actual_duration_seconds << " seconds" << std::endl;
         const double rate = (double)num_total_samps / actual_duration_seconds;
         std::cout << (rate / 1e6) << " MSps" << std::endl;
+        if (recorder) {
+            std::cout << "Waited " << recorder->get_num_stalls() << " times for the disk"
+                      << std::endl;
+        }
 
         if (enable_size_map) {
             std::cout << std::endl;
@@ -224,8 +245,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
     std::string args, file, format, ant, subdev, ref, wirefmt, streamargs, block_id,
-        block_props;
-    size_t total_num_samps, spb, spp, radio_id, radio_chan, block_port;
+        block_props, stripe_dirs;
+    size_t total_num_samps, spb, spp, radio_id, radio_chan, block_port, num_buffers;
     double rate, freq, gain, bw, total_time, setup_time;
 
     // setup the program options
@@ -244,6 +265,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("stats", "show average bandwidth on exit")
         ("sizemap", "track packet size and display breakdown on exit")
         ("null", "run without writing to file")
+        ("buffers", po::value<size_t>(&num_buffers)->default_value(16), "number of 4 MiB buffers which may wait for the disk")
+        ("stripe-dirs", po::value<std::string>(&stripe_dirs), "comma-separated directories (e.g., one per drive) to stripe the file across, reassemble it with join_stripes")
+        ("no-direct-io", "write the file through the page cache")
         ("continue", "don't abort on a bad packet")
 
         ("args", po::value<std::string>(&args)->default_value(""), "USRP device address args")
@@ -297,6 +321,13 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+    uhd::sample_recorder::config_t recorder_config;
+    recorder_config.num_buffers = num_buffers;
+    recorder_config.direct_io   = vm.count("no-direct-io") == 0;
+    if (vm.count("stripe-dirs")) {
+        boost::split(recorder_config.stripe_dirs, stripe_dirs, boost::is_any_of(","));
+    }
+
     /************************************************************************
      * Create device and block controls
      ***********************************************************************/
@@ -497,6 +528,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
 #define recv_to_file_args() \
     (rx_stream,             \
         file,               \
+        recorder_config,    \
         spb,                \
         rate,               \
         total_num_samps,    \
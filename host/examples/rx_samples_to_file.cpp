@@ -9,6 +9,7 @@
 #include <uhd/types/tune_request.hpp>
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_recorder.hpp>
 #include <uhd/utils/thread.hpp>
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
@@ -16,7 +17,6 @@
 #include <chrono>
 #include <complex>
 #include <csignal>
-#include <fstream>
 #include <iostream>
 #include <thread>
 
@@ -34,6 +34,7 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     const std::string& wire_format,
     const size_t& channel,
     const std::string& file,
+    const uhd::sample_recorder::config_t& recorder_config,
     size_t samps_per_buff,
     unsigned long long num_requested_samples,
     double time_requested       = 0.0,
@@ -53,9 +54,12 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
 
     uhd::rx_metadata_t md;
     std::vector<samp_type> buff(samps_per_buff);
-    std::ofstream outfile;
+    std::vector<void*> buffs(1, &buff.front());
+    // The recorder writes the file on a separate thread, so the disk does not
+    // hold up this one. The samples are received into its buffers.
+    uhd::sample_recorder::sptr recorder;
     if (not null)
-        outfile.open(file.c_str(), std::ofstream::binary);
+        recorder = uhd::sample_recorder::make(file, 1, recorder_config);
     bool overflow_message = true;
 
     // setup streaming
@@ -84,8 +88,18 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
            and (time_requested == 0.0 or std::chrono::steady_clock::now() <= stop_time)) {
         const auto now = std::chrono::steady_clock::now();
 
+        size_t max_rx_samps = buff.size();
+        if (recorder) {
+            const size_t num_bytes = recorder->get_write_buffs(buffs, 3.0);
+            if (num_bytes == 0) {
+                std::cout << boost::format("Timeout while writing to file") << std::endl;
+                break;
+            }
+            max_rx_samps = std::min(max_rx_samps, num_bytes / sizeof(samp_type));
+        }
+
         size_t num_rx_samps =
-            rx_stream->recv(&buff.front(), buff.size(), md, 3.0, enable_size_map);
+            rx_stream->recv(buffs, max_rx_samps, md, 3.0, enable_size_map);
 
         if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
             std::cout << boost::format("Timeout while streaming") << std::endl;
@@ -123,8 +137,8 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
 
         num_total_samps += num_rx_samps;
 
-        if (outfile.is_open()) {
-            outfile.write((const char*)&buff.front(), num_rx_samps * sizeof(samp_type));
+        if (recorder) {
+            recorder->commit(num_rx_samps * sizeof(samp_type));
         }
 
         if (bw_summary) {
@@ -145,8 +159,8 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     stream_cmd.stream_mode = uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS;
     rx_stream->issue_stream_cmd(stream_cmd);
 
-    if (outfile.is_open()) {
-        outfile.close();
+    if (recorder) {
+        recorder->close();
     }
 
     if (stats) {
@@ -159,6 +173,11 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
                   << std::endl;
         const double rate = (double)num_total_samps / actual_duration_seconds;
         std::cout << (rate / 1e6) << " Msps" << std::endl;
+        if (recorder) {
+            std::cout << boost::format("Waited %d times for the disk")
+                             % recorder->get_num_stalls()
+                      << std::endl;
+        }
 
         if (enable_size_map) {
             std::cout << std::endl;
@@ -217,7 +236,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
     std::string args, file, type, ant, subdev, ref, wirefmt;
-    size_t channel, total_num_samps, spb;
+    size_t channel, total_num_samps, spb, num_buffers;
+    double split_size;
     double rate, freq, gain, bw, total_time, setup_time, lo_offset;
 
     // setup the program options
@@ -247,6 +267,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("stats", "show average bandwidth on exit")
         ("sizemap", "track packet size and display breakdown on exit")
         ("null", "run without writing to file")
+        ("buffers", po::value<size_t>(&num_buffers)->default_value(16), "number of 4 MiB buffers which may wait for the disk")
+        ("split", po::value<double>(&split_size)->default_value(0), "start a new file after this many MB (0 for a single file)")
+        ("no-direct-io", "write the file through the page cache")
+        ("compress", "compress the samples losslessly (sc16 only), restore them with iq_decompress")
         ("continue", "don't abort on a bad packet")
         ("skip-lo", "skip checking LO lock status")
         ("int-n", "tune USRP with integer-N tuning")
@@ -272,6 +296,16 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     bool enable_size_map        = vm.count("sizemap") > 0;
     bool continue_on_bad_packet = vm.count("continue") > 0;
 
+    uhd::sample_recorder::config_t recorder_config;
+    recorder_config.num_buffers   = num_buffers;
+    recorder_config.max_file_size = uint64_t(split_size * 1e6);
+    recorder_config.direct_io     = vm.count("no-direct-io") == 0;
+    recorder_config.compress      = vm.count("compress") > 0;
+    if (recorder_config.compress and type != "short") {
+        std::cerr << "Compression requires --type short" << std::endl;
+        return ~0;
+    }
+
     if (enable_size_map)
         std::cout << "Packet size tracking enabled - will only recv one packet at a time!"
                   << std::endl;
@@ -385,6 +419,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         wirefmt,                  \
         channel,                  \
         file,                     \
+        recorder_config,          \
         spb,                      \
         total_num_samps,          \
         total_time,               \
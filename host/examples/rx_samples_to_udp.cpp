@@ -11,15 +11,138 @@
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/asio.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
+#include <array>
 #include <chrono>
 #include <complex>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <thread>
+#include <vector>
+#ifdef __linux__
+#    include <sys/socket.h>
+#endif
 
 namespace po = boost::program_options;
 
+namespace {
+
+/*! Header in front of the samples of every forwarded packet
+ *
+ * All fields are in network byte order. The samples follow as sc16, in the
+ * byte order of the host.
+ */
+struct forward_header_t
+{
+    //! Number of the packet, counting from zero for every channel
+    uint32_t seq;
+    //! Channel of the samples
+    uint16_t chan;
+    //! Bit 0: time_ns is valid, bit 1: start of burst, bit 2: end of burst
+    uint16_t flags;
+    //! Device time of the first sample in nanoseconds
+    uint64_t time_ns;
+};
+static_assert(sizeof(forward_header_t) == 16, "Unexpected forward header size");
+
+/*! Sends the samples of every packet to a list of destinations
+ *
+ * The samples are sent straight from the frame buffers of the streamer, behind
+ * a forward_header_t. On Linux, the datagrams of all channels and
+ * destinations of a packet are sent with a single sendmmsg() call. The
+ * destinations may be multicast addresses.
+ */
+class packet_forwarder
+{
+public:
+    packet_forwarder(const std::vector<std::string>& addrs,
+        const std::string& port,
+        const int ttl,
+        const size_t num_channels)
+        : _socket(_io_service), _headers(num_channels)
+    {
+        using boost::asio::ip::udp;
+        udp::resolver resolver(_io_service);
+        for (const auto& addr : addrs) {
+            _dests.push_back(
+                *resolver.resolve(udp::resolver::query(udp::v4(), addr, port)));
+        }
+        _socket.open(udp::v4());
+        _socket.set_option(boost::asio::ip::multicast::hops(ttl));
+    }
+
+    void send(const uhd::rx_streamer::recv_buffs_type& buffs,
+        const size_t num_bytes,
+        const uhd::rx_metadata_t& md)
+    {
+        const uint16_t flags = (md.has_time_spec ? 0x1 : 0)
+                               | (md.start_of_burst ? 0x2 : 0)
+                               | (md.end_of_burst ? 0x4 : 0);
+        for (size_t chan = 0; chan < _headers.size(); chan++) {
+            auto& header   = _headers[chan];
+            header.seq     = boost::endian::native_to_big(_seq);
+            header.chan    = boost::endian::native_to_big(uint16_t(chan));
+            header.flags   = boost::endian::native_to_big(flags);
+            header.time_ns = boost::endian::native_to_big(
+                uint64_t(md.time_spec.to_ticks(1e9)));
+        }
+        _seq++;
+
+#ifdef __linux__
+        // One message per channel and destination, all in one system call
+        const size_t num_msgs = _headers.size() * _dests.size();
+        _iovecs.resize(2 * num_msgs);
+        _msgs.assign(num_msgs, mmsghdr{});
+        for (size_t i = 0; i < num_msgs; i++) {
+            const size_t chan = i / _dests.size();
+            auto& dest        = _dests[i % _dests.size()];
+            _iovecs[2 * i]     = {&_headers[chan], sizeof(forward_header_t)};
+            _iovecs[2 * i + 1] = {const_cast<void*>(buffs[chan]), num_bytes};
+            _msgs[i].msg_hdr.msg_name    = dest.data();
+            _msgs[i].msg_hdr.msg_namelen = dest.size();
+            _msgs[i].msg_hdr.msg_iov     = &_iovecs[2 * i];
+            _msgs[i].msg_hdr.msg_iovlen  = 2;
+        }
+        size_t num_sent = 0;
+        while (num_sent < num_msgs) {
+            const int ret = ::sendmmsg(
+                _socket.native_handle(), &_msgs[num_sent], num_msgs - num_sent, 0);
+            if (ret < 0) {
+                throw uhd::io_error("sendmmsg() failed");
+            }
+            num_sent += ret;
+        }
+#else
+        for (size_t chan = 0; chan < _headers.size(); chan++) {
+            const std::array<boost::asio::const_buffer, 2> datagram = {
+                boost::asio::buffer(&_headers[chan], sizeof(forward_header_t)),
+                boost::asio::buffer(buffs[chan], num_bytes)};
+            for (const auto& dest : _dests) {
+                _socket.send_to(datagram, dest);
+            }
+        }
+#endif
+    }
+
+private:
+    boost::asio::io_service _io_service;
+    boost::asio::ip::udp::socket _socket;
+    std::vector<boost::asio::ip::udp::endpoint> _dests;
+    std::vector<forward_header_t> _headers;
+    uint32_t _seq = 0;
+#ifdef __linux__
+    std::vector<iovec> _iovecs;
+    std::vector<mmsghdr> _msgs;
+#endif
+};
+
+} // namespace
+
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     // variables to be set by po
@@ -27,6 +150,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     size_t total_num_samps;
     double rate, freq, gain, bw;
     std::string addr, port;
+    int ttl;
 
     // setup the program options
     po::options_description desc("Allowed options");
@@ -42,7 +166,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("subdev", po::value<std::string>(&subdev), "subdevice specification")
         ("bw", po::value<double>(&bw), "analog frontend filter bandwidth in Hz")
         ("port", po::value<std::string>(&port)->default_value("7124"), "server udp port")
-        ("addr", po::value<std::string>(&addr)->default_value("192.168.1.10"), "resolvable server address")
+        ("addr", po::value<std::string>(&addr)->default_value("192.168.1.10"), "resolvable server address, or a comma-separated list of them with --forward")
+        ("forward", "forward the sc16 samples of every packet without conversion, behind a 16 byte header (sequence number, channel, flags, time)")
+        ("ttl", po::value<int>(&ttl)->default_value(1), "time to live of multicast packets with --forward")
         ("ref", po::value<std::string>(&ref)->default_value("internal"), "reference source (internal, external, mimo)")
         ("int-n", "tune USRP with integer-N tuning")
     ;
@@ -143,8 +269,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         UHD_ASSERT_THROW(ref_locked.to_bool());
     }
 
-    // create a receive streamer
-    uhd::stream_args_t stream_args("fc32"); // complex floats
+    // create a receive streamer. Forwarding needs the samples in the format
+    // they arrive in, so they can be sent right from the frame buffers.
+    const bool forward = vm.count("forward") > 0;
+    uhd::stream_args_t stream_args(forward ? "sc16" : "fc32", "sc16");
     uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
 
     // setup streaming
@@ -157,11 +285,22 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     size_t num_acc_samps = 0; // number of accumulated samples
     uhd::rx_metadata_t md;
     std::vector<std::complex<float>> buff(rx_stream->get_max_num_samps());
-    uhd::transport::udp_simple::sptr udp_xport =
-        uhd::transport::udp_simple::make_connected(addr, port);
+    uhd::rx_streamer::recv_buffs_type frame_buffs;
+    uhd::transport::udp_simple::sptr udp_xport;
+    std::unique_ptr<packet_forwarder> forwarder;
+    if (forward) {
+        std::vector<std::string> addrs;
+        boost::split(addrs, addr, boost::is_any_of(","));
+        forwarder = std::make_unique<packet_forwarder>(
+            addrs, port, ttl, rx_stream->get_num_channels());
+    } else {
+        udp_xport = uhd::transport::udp_simple::make_connected(addr, port);
+    }
 
     while (num_acc_samps < total_num_samps) {
-        size_t num_rx_samps = rx_stream->recv(&buff.front(), buff.size(), md);
+        size_t num_rx_samps = forward
+                                  ? rx_stream->get_recv_buffs(frame_buffs, md)
+                                  : rx_stream->recv(&buff.front(), buff.size(), md);
 
         // handle the error codes
         switch (md.error_code) {
@@ -183,8 +322,15 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                 goto done_loop;
         }
 
-        // send complex single precision floating point samples over udp
-        udp_xport->send(boost::asio::buffer(buff, num_rx_samps * sizeof(buff.front())));
+        if (forward) {
+            forwarder->send(
+                frame_buffs, num_rx_samps * sizeof(std::complex<int16_t>), md);
+            rx_stream->release_recv_buffs();
+        } else {
+            // send complex single precision floating point samples over udp
+            udp_xport->send(
+                boost::asio::buffer(buff, num_rx_samps * sizeof(buff.front())));
+        }
 
         num_acc_samps += num_rx_samps;
     }
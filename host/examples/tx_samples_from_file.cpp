@@ -8,13 +8,13 @@
 #include <uhd/types/tune_request.hpp>
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_player.hpp>
 #include <uhd/utils/thread.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
 #include <complex>
 #include <csignal>
-#include <fstream>
 #include <iostream>
 #include <thread>
 
@@ -26,34 +26,38 @@ void sig_int_handler(int)
     stop_signal_called = true;
 }
 
-template <typename samp_type>
 void send_from_file(
-    uhd::tx_streamer::sptr tx_stream, const std::string& file, size_t samps_per_buff)
+    uhd::tx_streamer::sptr tx_stream, uhd::sample_player& player, size_t samps_per_buff)
 {
     uhd::tx_metadata_t md;
     md.start_of_burst = false;
     md.end_of_burst   = false;
-    std::vector<samp_type> buff(samps_per_buff);
-    std::ifstream infile(file.c_str(), std::ifstream::binary);
-
-    // loop until the entire file has been read
 
+    // loop until the entire file has been sent (forever, if the player loops).
+    // The samples are sent straight from the file, which is mapped into memory.
+    player.seek(0);
     while (not md.end_of_burst and not stop_signal_called) {
-        infile.read((char*)&buff.front(), buff.size() * sizeof(samp_type));
-        size_t num_tx_samps = size_t(infile.gcount() / sizeof(samp_type));
+        const void* buff;
+        const size_t num_tx_samps = player.get_read_buff(buff, samps_per_buff);
 
-        md.end_of_burst = infile.eof();
+        md.end_of_burst = not player.get_loop()
+                          and num_tx_samps == player.get_samps_left();
 
-        const size_t samples_sent = tx_stream->send(&buff.front(), num_tx_samps, md);
+        const size_t samples_sent = tx_stream->send(buff, num_tx_samps, md);
         if (samples_sent != num_tx_samps) {
             UHD_LOG_ERROR("TX-STREAM",
                 "The tx_stream timed out sending " << num_tx_samps << " samples ("
                                                    << samples_sent << " sent).");
             return;
         }
+        player.consume(num_tx_samps);
     }
 
-    infile.close();
+    // end the burst if Ctrl+C interrupted it
+    if (not md.end_of_burst) {
+        md.end_of_burst = true;
+        tx_stream->send("", 0, md);
+    }
 }
 
 int UHD_SAFE_MAIN(int argc, char* argv[])
@@ -84,7 +88,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("wirefmt", po::value<std::string>(&wirefmt)->default_value("sc16"), "wire format (sc8 or sc16)")
         ("delay", po::value<double>(&delay)->default_value(0.0), "specify a delay between repeated transmission of file (in seconds)")
         ("channel", po::value<std::string>(&channel)->default_value("0"), "which channel to use")
-        ("repeat", "repeatedly transmit file")
+        ("repeat", "repeatedly transmit file (seamlessly, unless a delay is given)")
         ("int-n", "tune USRP with integer-n tuning")
     ;
     // clang-format on
@@ -208,28 +212,36 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
 
     // create a transmit streamer
     std::string cpu_format;
+    size_t item_size;
     std::vector<size_t> channel_nums;
-    if (type == "double")
+    if (type == "double") {
         cpu_format = "fc64";
-    else if (type == "float")
+        item_size  = sizeof(std::complex<double>);
+    } else if (type == "float") {
         cpu_format = "fc32";
-    else if (type == "short")
+        item_size  = sizeof(std::complex<float>);
+    } else if (type == "short") {
         cpu_format = "sc16";
+        item_size  = sizeof(std::complex<short>);
+    } else {
+        throw std::runtime_error("Unknown type " + type);
+    }
     uhd::stream_args_t stream_args(cpu_format, wirefmt);
     channel_nums.push_back(boost::lexical_cast<size_t>(channel));
     stream_args.channels             = channel_nums;
     uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
 
+    // open the file once, repetitions do not read it again
+    auto player = uhd::sample_player::make(file, item_size);
+    if (player->get_num_samps() == 0) {
+        throw std::runtime_error("No samples in " + file);
+    }
+    // without a delay, the file is repeated as one burst
+    player->set_loop(repeat and delay == 0.0);
+
     // send from file
     do {
-        if (type == "double")
-            send_from_file<std::complex<double>>(tx_stream, file, spb);
-        else if (type == "float")
-            send_from_file<std::complex<float>>(tx_stream, file, spb);
-        else if (type == "short")
-            send_from_file<std::complex<short>>(tx_stream, file, spb);
-        else
-            throw std::runtime_error("Unknown type " + type);
+        send_from_file(tx_stream, *player, spb);
 
         if (repeat and delay > 0.0) {
             std::this_thread::sleep_for(std::chrono::milliseconds(int64_t(delay * 1000)));
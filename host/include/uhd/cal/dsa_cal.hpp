@@ -58,6 +58,13 @@ public:
      * Use NUM_DSA and NUM_GAIN_STAGES to find values in the list.
      */
     virtual std::vector<uint32_t> get_band_settings(double freq, uint8_t dsa) const = 0;
+
+    /*! Return the upper (inclusive) frequency limits of all bands
+     *
+     * The limits are in ascending order, i.e., the n-th limit belongs to the
+     * n-th band in the order of get_band_settings() lookups.
+     */
+    virtual std::vector<double> get_band_max_freqs() const = 0;
     
     /*!
      * Clear all stored values
@@ -112,6 +119,13 @@ public:
      */
     virtual std::vector<uint32_t> get_band_settings(double freq, uint8_t dsa) const = 0;
 
+    /*! Return the upper (inclusive) frequency limits of all bands
+     *
+     * The limits are in ascending order, i.e., the n-th limit belongs to the
+     * n-th band in the order of get_band_settings() lookups.
+     */
+    virtual std::vector<double> get_band_max_freqs() const = 0;
+
     /*! 
      * Clear all stored values
      */
@@ -10,9 +10,11 @@
 #include <uhd/config.hpp>
 #include <uhd/types/ref_vector.hpp>
 #include <boost/operators.hpp>
+#include <complex>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uhd { namespace convert {
 
@@ -29,6 +31,26 @@ public:
     //! Set the scale factor (used in floating point conversions)
     virtual void set_scalar(const double) = 0;
 
+    /*! Set an IQ-balance and DC-offset correction
+     *
+     * Converters which support this apply the correction in the same pass as
+     * the conversion and the scaling, so the samples are only touched once.
+     * With y = scalar * x + dc_offset, the corrected sample is
+     *
+     *     I = y.real() + iq_balance.real() * y.real()
+     *     Q = y.imag() + iq_balance.imag() * y.real()
+     *
+     * which matches the IQ-balance correction of the FPGA front-end cores.
+     * Setting both values to zero disables the correction.
+     *
+     * \param iq_balance Magnitude (real) and phase (imag) correction
+     * \param dc_offset Offset to add to the scaled samples
+     * \return true if the converter applies the correction, false if it does
+     *         not support corrections (the default)
+     */
+    virtual bool set_correction(
+        const std::complex<double>& iq_balance, const std::complex<double>& dc_offset);
+
     //! The public conversion method to convert inputs -> outputs
     UHD_INLINE void conv(const input_type& in, const output_type& out, const size_t num)
     {
@@ -89,6 +111,17 @@ UHD_API void register_converter(
  */
 UHD_API function_type get_converter(const id_type& id, const priority_type prio = -1);
 
+//! Return the IDs of all registered conversions
+UHD_API std::vector<id_type> get_converter_ids(void);
+
+/*!
+ * Get the priorities of all registered implementations of a conversion.
+ * \param id identify the conversion
+ * \return the priorities in ascending order
+ * \throws uhd::key_error if no converter is registered for \p id
+ */
+UHD_API std::vector<priority_type> get_converter_priorities(const id_type& id);
+
 /*!
  * Register the size of a particular item.
  * \param format the item format
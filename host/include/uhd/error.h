@@ -139,6 +139,37 @@ UHD_API void set_c_global_error_string(const std::string &msg);
     set_c_global_error_string("None"); \
     return UHD_ERROR_NONE;
 
+/*!
+ * Like UHD_SAFE_C_SAVE_ERROR(), but the error strings are only written when
+ * an exception is thrown. On success, the error strings of the last failed
+ * call are left as they are. This is for functions which are called in the
+ * streaming loop, where copying strings and locking the global error string
+ * on every call adds up.
+ */
+#define UHD_SAFE_C_SAVE_ERROR_ON_EXCEPT(h, ...) \
+    try{ __VA_ARGS__ } \
+    catch (const uhd::exception &e) { \
+        set_c_global_error_string(e.what()); \
+        h->last_error = e.what(); \
+        return error_from_uhd_exception(&e); \
+    } \
+    catch (const boost::exception &e) { \
+        set_c_global_error_string(boost::diagnostic_information(e)); \
+        h->last_error = boost::diagnostic_information(e); \
+        return UHD_ERROR_BOOSTEXCEPT; \
+    } \
+    catch (const std::exception &e) { \
+        set_c_global_error_string(e.what()); \
+        h->last_error = e.what(); \
+        return UHD_ERROR_STDEXCEPT; \
+    } \
+    catch (...) { \
+        set_c_global_error_string("Unrecognized exception caught."); \
+        h->last_error = "Unrecognized exception caught."; \
+        return UHD_ERROR_UNKNOWN; \
+    } \
+    return UHD_ERROR_NONE;
+
 extern "C" {
 #endif
 
@@ -10,8 +10,11 @@
 #include <uhd/config.hpp>
 #include <uhd/experts/expert_nodes.hpp>
 #include <uhd/utils/noncopyable.hpp>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 namespace uhd { namespace experts {
 
@@ -50,6 +53,19 @@ public: // Methods
      */
     virtual void resolve_all(bool force = false) = 0;
 
+    //! Timing statistics of a worker node (see get_worker_stats())
+    struct worker_stats_t
+    {
+        //! Name of the worker
+        std::string name;
+        //! Number of times the worker was resolved
+        size_t num_resolves;
+        //! Total time spent resolving the worker, in seconds
+        double total_time;
+        //! Longest time a single resolve of the worker took, in seconds
+        double max_time;
+    };
+
     /*!
      * Resolves all the nodes that depend on the specified node.
      *
@@ -109,6 +125,42 @@ public: // Methods
      */
     virtual void debug_audit() const = 0;
 
+    /*!
+     * Returns how often each worker was resolved, and how long that took
+     *
+     * This shows which workers dominate the time it takes to resolve the
+     * graph, e.g., when tuning. The statistics cover all resolves since the
+     * container was created.
+     *
+     */
+    virtual std::vector<worker_stats_t> get_worker_stats() const = 0;
+
+    /*!
+     * Resolve independent workers concurrently
+     *
+     * By default, the workers are resolved one after the other. With this
+     * enabled, the graph is resolved by depth instead: Workers at the same
+     * depth don't depend on each other, so they are resolved in parallel, on
+     * the resolving thread and on \p num_threads additional threads. Workers
+     * which write the same data node are grouped, and resolved one after the
+     * other on the same thread.
+     *
+     * Only enable this if the workers of this container may run concurrently,
+     * i.e., if the drivers they call are thread-safe.
+     *
+     * \param num_threads Number of additional threads. Zero switches back to
+     *                    resolving the workers one after the other.
+     * \param begin_group If set, this is called before each group of workers
+     *                    is resolved, on the thread which resolves it, e.g., to
+     *                    batch the register I/O of the workers.
+     * \param end_group If set, this is called after each group of workers was
+     *                  resolved, even if one of the workers failed.
+     *
+     */
+    virtual void set_parallel_resolve(const size_t num_threads,
+        std::function<void()> begin_group = nullptr,
+        std::function<void()> end_group   = nullptr) = 0;
+
 private:
     /*!
      * Lookup a node with the specified name in the contained graph
@@ -41,6 +41,20 @@ public:
     //  signal chain, use the rx_codec/<n>/calibration_frozen property on the
     //  motherboard's property tree.
     virtual void run(const size_t chan) = 0;
+
+    //! Restores the results of a previous calibration of the specified channel
+    //
+    //  run() stores its results in the calibration database, separately for
+    //  every sample rate and temperature range. Restoring them takes a few
+    //  milliseconds, compared to a few seconds for run(). The restored
+    //  coefficients stay in place until the next call to run().
+    //
+    //  \return true if stored results were found and applied. If not, the
+    //          ADCs remain untouched.
+    virtual bool restore(const size_t /*chan*/)
+    {
+        return false;
+    }
 };
 
 }} // namespace uhd::features
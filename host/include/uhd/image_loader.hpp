@@ -33,6 +33,9 @@ public:
         uhd::dict<std::string, std::string> metadata;
         bool delay_reload = false;
         bool just_reload  = false;
+        //! Skip devices which report that the FPGA image is loaded already.
+        // Only loaders which know the hash of the loaded image support this.
+        bool skip_if_loaded = false;
     };
 
     //! Signature of an image loading function
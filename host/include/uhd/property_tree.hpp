@@ -24,6 +24,18 @@ namespace uhd {
 class UHD_API property_iface {
 public:
     virtual ~property_iface() = default;
+
+    /*!
+     * Return a new property which holds the current value of this one.
+     * The copy has no publisher, coercer or subscribers.
+     *
+     * \return the copy, or nullptr if the property is empty or its value
+     *         can't be read
+     */
+    virtual std::shared_ptr<property_iface> snapshot(void) const
+    {
+        return nullptr;
+    }
 };
 
 /*!
@@ -248,10 +260,64 @@ public:
     template <typename T>
     property<T>& access(const fs_path& path);
 
+    /*!
+     * Get a shared pointer to a property in the tree
+     *
+     * This looks up the path only once. Code which accesses the same property
+     * over and over can hold on to the pointer instead of calling access()
+     * every time. The pointer remains valid if the property is removed from
+     * the tree, but no longer refers to the property in the tree then.
+     */
+    template <typename T>
+    std::shared_ptr<property<T>> access_ptr(const fs_path& path);
+
     //! Pop a property off the tree, and returns the property
     template <typename T>
     std::shared_ptr<property<T>> pop(const fs_path& path);
 
+    /*!
+     * A function which reads the values of many properties at once, see
+     * add_prefetcher(). It gets the part of a snapshot below the path it was
+     * registered at.
+     */
+    typedef std::function<void(property_tree& snapshot)> prefetcher_type;
+
+    /*!
+     * Register a function which reads the values below a path in bulk
+     *
+     * When a snapshot() includes the path, the prefetcher is called before
+     * the properties are read one by one. It should read as many values as it
+     * can in one go, for example with a single RPC call, and create() and
+     * set() them in the snapshot. The properties it creates are not read
+     * again. If the prefetcher throws, all properties are read one by one.
+     *
+     * \param path the path of an existing directory or property
+     * \param prefetcher the function which fills in the snapshot
+     * \throws uhd::lookup_error if the path does not exist
+     */
+    virtual void add_prefetcher(
+        const fs_path& path, const prefetcher_type& prefetcher) = 0;
+
+    /*!
+     * Get a copy of the values of all properties below a path
+     *
+     * The copy is a new tree with its root at the given path. Its properties
+     * hold the values which get() returned when the snapshot was taken. They
+     * have no publishers, so reading them does not access the device.
+     * Properties whose values could not be read exist in the snapshot, but
+     * are uninitialized.
+     *
+     * Use this instead of calling get() on many properties, e.g., to print
+     * them: the values are read with the prefetchers of the tree where
+     * possible, which is much faster for devices that need a request per
+     * value.
+     *
+     * \param path the root of the copy
+     * \return the new tree
+     * \throws uhd::lookup_error if the path does not exist
+     */
+    virtual sptr snapshot(const fs_path& path = fs_path("/")) const = 0;
+
 private:
     //! Internal pop function
     virtual std::shared_ptr<property_iface> _pop(const fs_path& path) = 0;
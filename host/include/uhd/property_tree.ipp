@@ -138,6 +138,23 @@ public:
         return !bool(_publisher) and _value.get() == NULL;
     }
 
+    std::shared_ptr<property_iface> snapshot(void) const
+    {
+        if (empty()) {
+            return nullptr;
+        }
+        // The copy is manually coerced, so it returns the value it was given
+        auto copy = std::make_shared<property_impl<T>>(property_tree::MANUAL_COERCE);
+        try {
+            copy->_coerced_value.reset(new T(get()));
+        } catch (const std::exception&) {
+            return nullptr;
+        }
+        copy->_value.reset(new T(
+            _value.get() != NULL ? *_value : get_value_ref(copy->_coerced_value)));
+        return copy;
+    }
+
 private:
     static T DEFAULT_COERCER(const T& value)
     {
@@ -185,12 +202,18 @@ property<T>& property_tree::create(const fs_path& path, coerce_mode_t coerce_mod
 
 template <typename T>
 property<T>& property_tree::access(const fs_path& path)
+{
+    return *this->access_ptr<T>(path);
+}
+
+template <typename T>
+std::shared_ptr<property<T>> property_tree::access_ptr(const fs_path& path)
 {
     auto ptr = std::dynamic_pointer_cast<property<T>>(this->_access(path));
     if (!ptr) {
         throw uhd::type_error("Property " + path + " exists, but was accessed with wrong type");
     }
-    return *ptr;
+    return ptr;
 }
 
 template <typename T>
@@ -10,6 +10,7 @@
 #include <uhd/rfnoc/noc_block_base.hpp>
 #include <uhd/types/ranges.hpp>
 #include <boost/optional.hpp>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -73,6 +74,26 @@ public:
         const size_t chan,
         const boost::optional<uhd::time_spec_t> time = boost::none) = 0;
 
+    /*! Set the frequencies of multiple channels at once
+     *
+     * This is equivalent to calling set_freq() for every channel, but it
+     * only triggers one property resolution for all channels, and all new
+     * frequencies share the same command time. This makes retuning many
+     * channels (e.g., of a channelizer) much faster, and lets them all switch
+     * to their new frequency at the same time.
+     *
+     * \param freqs The frequency shifts in Hz, one per entry of \p chans
+     * \param chans The channels to which these changes shall be applied
+     * \param time When to apply the new frequencies
+     * \returns The coerced, actual current frequencies, one per entry of
+     *          \p chans
+     * \throws uhd::value_error if \p freqs and \p chans are not of the same
+     *         length, or if a channel is out of range
+     */
+    virtual std::vector<double> set_freqs(const std::vector<double>& freqs,
+        const std::vector<size_t>& chans,
+        const boost::optional<uhd::time_spec_t> time = boost::none) = 0;
+
     /*! Return the current DDS frequency
      *
      * \returns The current frequency of the DDS
@@ -0,0 +1,117 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/rfnoc/fft_block_control.hpp>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace uhd { namespace rfnoc {
+
+/*! An FFT which runs on the host, for devices without an FFT block
+ *
+ * This class has the same settings as uhd::rfnoc::fft_block_control, and
+ * produces the same output, except that it works on fc32 samples. That way,
+ * applications can switch between the FPGA and the host implementation
+ * without changing how they interpret the output:
+ * - With fft_magnitude::MAGNITUDE or MAGNITUDE_SQUARED, the real part of each
+ *   output bin holds the (squared) magnitude, and the imaginary part is zero.
+ * - The output is scaled by the scaling schedule, like the FFT IP does it:
+ *   Every FFT stage (which is radix 4, possibly except for the last one) is
+ *   scaled down by 2 to the power of its 2-bit field of the schedule, starting
+ *   at the LSBs. The default schedule scales by 1/N.
+ *
+ * The plan (twiddle factors and bit reversal table) is computed whenever the
+ * length or the direction changes, so transforming frames does not compute
+ * any sines or cosines. On CPUs with AVX2, the butterflies process four
+ * samples at a time.
+ *
+ * Setting the host_fft_length stream arg of an RX streamer (see \ref
+ * config_stream_args_args) runs this FFT on the received samples right after
+ * they are converted, while they are still in the cache.
+ *
+ * The settings are not thread-safe, i.e., they must not be changed while
+ * process() runs.
+ */
+class UHD_API host_fft
+{
+public:
+    using sptr = std::shared_ptr<host_fft>;
+
+    static constexpr size_t MIN_LENGTH        = 2;
+    static constexpr size_t MAX_LENGTH        = 65536;
+    static constexpr uint16_t DEFAULT_SCALING = 1706;
+
+    virtual ~host_fft() = default;
+
+    //! Set the FFT direction (see fft_block_control::set_direction())
+    virtual void set_direction(const fft_direction direction) = 0;
+
+    //! Return the FFT direction
+    virtual fft_direction get_direction() const = 0;
+
+    //! Set the format of the output (see fft_block_control::set_magnitude())
+    virtual void set_magnitude(const fft_magnitude magnitude) = 0;
+
+    //! Return the format of the output
+    virtual fft_magnitude get_magnitude() const = 0;
+
+    //! Set the order of the output bins (see fft_block_control::set_shift_config())
+    virtual void set_shift_config(const fft_shift shift) = 0;
+
+    //! Return the order of the output bins
+    virtual fft_shift get_shift_config() const = 0;
+
+    /*! Set the scaling schedule (see fft_block_control::set_scaling())
+     *
+     * \throws uhd::value_error if \p scaling has more than 12 bits
+     */
+    virtual void set_scaling(const uint16_t scaling) = 0;
+
+    //! Return the scaling schedule
+    virtual uint16_t get_scaling() const = 0;
+
+    /*! Set the length of the FFT
+     *
+     * Like for the FFT block, the length is coerced to the closest smaller
+     * power of two.
+     *
+     * \throws uhd::value_error if \p length is not in [MIN_LENGTH, MAX_LENGTH]
+     */
+    virtual void set_length(const size_t length) = 0;
+
+    //! Return the length of the FFT
+    virtual size_t get_length() const = 0;
+
+    /*! Transform consecutive frames of get_length() samples each
+     *
+     * \p input and \p output may be the same buffer, i.e., the frames can be
+     * transformed in place. Otherwise, they must not overlap. If the FFT was
+     * made with worker threads, the frames are spread across them and the
+     * calling thread.
+     *
+     * \param input The frames to transform
+     * \param output Receives the transformed frames
+     * \param num_frames The number of frames
+     */
+    virtual void process(const std::complex<float>* input,
+        std::complex<float>* output,
+        const size_t num_frames) = 0;
+
+    /*! Create a host FFT with the default settings of the FFT block
+     *
+     * \param length The length of the FFT (see set_length())
+     * \param num_threads The number of worker threads for process(), in
+     *                    addition to the calling thread
+     */
+    static sptr make(const size_t length = 256, const size_t num_threads = 0);
+};
+
+}} // namespace uhd::rfnoc
@@ -0,0 +1,91 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace uhd { namespace rfnoc {
+
+/*! A moving average which runs on the host, for devices without the block
+ *
+ * This class has the same settings as
+ * uhd::rfnoc::moving_average_block_control, and computes the same output on
+ * fc32 samples: Every output sample is the sum of the last sum_len input
+ * samples, divided by the divisor. Like for the block, the samples before the
+ * first one are zeros.
+ *
+ * The sums are updated by the sample which enters the window and the one
+ * which leaves it, and computed from scratch for every chunk of samples, so
+ * no rounding errors accumulate. On CPUs with AVX2, the updates of four
+ * consecutive sums are computed in parallel.
+ *
+ * Setting the host_moving_average_sum_len stream arg of an RX streamer (see
+ * \ref config_stream_args_args) runs this average on the received samples
+ * right after they are converted.
+ *
+ * The settings are not thread-safe, i.e., they must not be changed while
+ * process() runs.
+ */
+class UHD_API host_moving_average
+{
+public:
+    using sptr = std::shared_ptr<host_moving_average>;
+
+    static constexpr uint32_t MAX_DIVISOR = (1 << 24) - 1;
+
+    virtual ~host_moving_average() = default;
+
+    /*! Set the number of samples to sum
+     *
+     * Like for the block, this clears the history.
+     *
+     * \throws uhd::value_error if \p sum_len is zero
+     */
+    virtual void set_sum_len(const uint8_t sum_len) = 0;
+
+    //! Return the number of samples to sum
+    virtual uint8_t get_sum_len() const = 0;
+
+    /*! Set the amount to divide the sum by
+     *
+     * \throws uhd::value_error if \p divisor is not in [1, MAX_DIVISOR]
+     */
+    virtual void set_divisor(const uint32_t divisor) = 0;
+
+    //! Return the amount to divide the sum by
+    virtual uint32_t get_divisor() const = 0;
+
+    //! Clear the history
+    virtual void reset() = 0;
+
+    /*! Average consecutive samples
+     *
+     * The history carries over from one call to the next. \p input and
+     * \p output may be the same buffer, i.e., the samples can be averaged in
+     * place. Otherwise, they must not overlap.
+     *
+     * \param input The samples to average
+     * \param output Receives the averages
+     * \param num_samps The number of samples
+     */
+    virtual void process(const std::complex<float>* input,
+        std::complex<float>* output,
+        const size_t num_samps) = 0;
+
+    /*! Create a host moving average with the default settings of the block
+     *
+     * \param sum_len The number of samples to sum (see set_sum_len())
+     * \param divisor The amount to divide the sum by (see set_divisor())
+     */
+    static sptr make(const uint8_t sum_len = 10, const uint32_t divisor = 10);
+};
+
+}} // namespace uhd::rfnoc
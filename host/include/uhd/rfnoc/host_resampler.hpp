@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <complex>
+#include <cstddef>
+#include <memory>
+
+namespace uhd { namespace rfnoc {
+
+/*! A polyphase rational resampler which runs on the host
+ *
+ * Changes the sample rate of fc32 samples by interp / decim, for rates which
+ * the master clock rate of a device does not divide down to. The samples are
+ * interpolated by interp, low-pass filtered, and decimated by decim, which the
+ * polyphase structure does in one pass: Every output sample is the dot product
+ * of taps_per_phase input samples with one of interp phases of a Kaiser
+ * windowed sinc filter. The cutoff of the filter is the lower of the two
+ * Nyquist frequencies, minus a tenth for the transition band, and its stopband
+ * attenuation is about 80 dB. On CPUs with AVX2, eight taps are multiplied per
+ * instruction.
+ *
+ * The filter is centered on its output samples, so output sample k has the
+ * time of input sample k * decim / interp, and a stream of N input samples
+ * has ceil(N * interp / decim) output samples. The samples before the first
+ * and after the last one are zeros, i.e., flush() has to be called at the end
+ * of a stream to get its last outputs.
+ *
+ * Setting the host_resample_interp and host_resample_decim stream args of an
+ * RX or TX streamer (see \ref config_stream_args_args) resamples the samples
+ * of every channel with this class.
+ *
+ * This class is not thread-safe.
+ */
+class UHD_API host_resampler
+{
+public:
+    using sptr = std::shared_ptr<host_resampler>;
+
+    static constexpr size_t DEFAULT_TAPS_PER_PHASE = 32;
+
+    //! The largest interpolation or decimation factor
+    static constexpr size_t MAX_FACTOR = 1024;
+    //! The largest number of taps per phase which make() accepts
+    static constexpr size_t MAX_TAPS_PER_PHASE = 256;
+
+    virtual ~host_resampler() = default;
+
+    //! Return the interpolation factor, reduced by the common divisor
+    virtual size_t get_interp() const = 0;
+
+    //! Return the decimation factor, reduced by the common divisor
+    virtual size_t get_decim() const = 0;
+
+    //! Return the number of taps of every phase of the filter, after rounding
+    virtual size_t get_taps_per_phase() const = 0;
+
+    /*! Return the largest number of output samples of \p num_samps input
+     *  samples, including those of flush()
+     */
+    virtual size_t get_max_num_outputs(const size_t num_samps) const = 0;
+
+    //! Start a new stream, clearing the history
+    virtual void reset() = 0;
+
+    /*! Resample consecutive samples of a stream
+     *
+     * The history carries over from one call to the next. The outputs lag the
+     * inputs by half the length of the filter, so the first calls of a stream
+     * may return no outputs.
+     *
+     * \param input The samples to resample
+     * \param num_samps The number of samples
+     * \param output Receives the resampled samples. It must hold
+     *               get_max_num_outputs(num_samps) samples, and must not
+     *               overlap \p input.
+     * \returns The number of output samples
+     */
+    virtual size_t process(const std::complex<float>* input,
+        const size_t num_samps,
+        std::complex<float>* output) = 0;
+
+    /*! End the stream, and return its last outputs
+     *
+     * Afterwards, the next call to process() starts a new stream, as after
+     * reset().
+     *
+     * \param output Receives the last output samples. It must hold
+     *               get_max_num_outputs(0) samples.
+     * \returns The number of output samples
+     */
+    virtual size_t flush(std::complex<float>* output) = 0;
+
+    /*! Create a host resampler
+     *
+     * \param interp The interpolation factor, in [1, MAX_FACTOR]
+     * \param decim The decimation factor, in [1, MAX_FACTOR]
+     * \param taps_per_phase The length of every phase of the filter, in
+     *                       [1, MAX_TAPS_PER_PHASE]. When decimating, the
+     *                       phases are longer by decim / interp, so the filter
+     *                       spans as many samples of the output rate. The
+     *                       length is rounded up to a multiple of four. Longer
+     *                       filters have a steeper transition band.
+     * \throws uhd::value_error if a factor or taps_per_phase is out of range
+     */
+    static sptr make(const size_t interp,
+        const size_t decim,
+        const size_t taps_per_phase = DEFAULT_TAPS_PER_PHASE);
+};
+
+}} // namespace uhd::rfnoc
@@ -0,0 +1,110 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace uhd { namespace rfnoc {
+
+/*! A vector IIR filter which runs on the host, for devices without the block
+ *
+ * This class has the same settings as uhd::rfnoc::vector_iir_block_control,
+ * and implements the same transfer function on fc32 samples:
+ *
+ *                    beta
+ *    H(z) = ------------------------
+ *            1 - alpha * z ^ -delay
+ *
+ * With the delay set to the length of an FFT, it averages every bin over
+ * consecutive frames, which is what the block is mostly used for.
+ *
+ * Within a delay line, the outputs do not depend on each other, so the filter
+ * processes up to a whole delay line at a time, and on CPUs with AVX2, four
+ * samples per instruction.
+ *
+ * Setting the host_vector_iir_delay stream arg of an RX streamer (see \ref
+ * config_stream_args_args) runs this filter on the received samples right
+ * after they are converted.
+ *
+ * The settings are not thread-safe, i.e., they must not be changed while
+ * process() runs.
+ */
+class UHD_API host_vector_iir
+{
+public:
+    using sptr = std::shared_ptr<host_vector_iir>;
+
+    static constexpr uint16_t MIN_DELAY = 5;
+    static constexpr uint16_t MAX_DELAY = 65535;
+
+    virtual ~host_vector_iir() = default;
+
+    /*! Set the feedback tap value
+     *
+     * \throws uhd::value_error if \p alpha is not in [0.0, 1.0]
+     */
+    virtual void set_alpha(const double alpha) = 0;
+
+    //! Return the feedback tap value
+    virtual double get_alpha() const = 0;
+
+    /*! Set the feedforward tap value
+     *
+     * \throws uhd::value_error if \p beta is not in [0.0, 1.0]
+     */
+    virtual void set_beta(const double beta) = 0;
+
+    //! Return the feedforward tap value
+    virtual double get_beta() const = 0;
+
+    /*! Set the feedback tap delay in samples
+     *
+     * This clears the delay line, i.e., the filter starts over from zeros.
+     *
+     * \throws uhd::value_error if \p delay is not in [MIN_DELAY,
+     *         get_max_delay()]
+     */
+    virtual void set_delay(const uint16_t delay) = 0;
+
+    //! Return the feedback tap delay in samples
+    virtual uint16_t get_delay() const = 0;
+
+    //! Return the maximum feedback tap delay in samples
+    virtual uint16_t get_max_delay() const = 0;
+
+    //! Clear the delay line
+    virtual void reset() = 0;
+
+    /*! Filter consecutive samples
+     *
+     * The state of the filter carries over from one call to the next.
+     * \p input and \p output may be the same buffer, i.e., the samples can be
+     * filtered in place. Otherwise, they must not overlap.
+     *
+     * \param input The samples to filter
+     * \param output Receives the filtered samples
+     * \param num_samps The number of samples
+     */
+    virtual void process(const std::complex<float>* input,
+        std::complex<float>* output,
+        const size_t num_samps) = 0;
+
+    /*! Create a host vector IIR filter
+     *
+     * \param delay The feedback tap delay (see set_delay())
+     * \param alpha The feedback tap value (see set_alpha())
+     * \param beta The feedforward tap value (see set_beta())
+     */
+    static sptr make(
+        const uint16_t delay, const double alpha = 0.9, const double beta = 0.9);
+};
+
+}} // namespace uhd::rfnoc
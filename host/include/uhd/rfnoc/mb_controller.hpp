@@ -18,7 +18,11 @@
 #include <memory>
 #include <vector>
 
-namespace uhd { namespace rfnoc {
+namespace uhd {
+
+class time_estimator;
+
+namespace rfnoc {
 
 /*! A default block controller for blocks that can't be found in the registry
  */
@@ -67,6 +71,24 @@ public:
          */
         uhd::time_spec_t get_time_now(void);
 
+        /*! Return an estimate of the current time
+         *
+         * Unlike get_time_now(), this reads the time from the hardware only
+         * about once a second, and extrapolates it with the host clock
+         * otherwise. This suits applications which query the time often to
+         * schedule timed commands. The error is at most half of a register
+         * readback round trip, plus the drift of the host clock against the
+         * device clock over one second (e.g., 50 us at 50 ppm).
+         *
+         * The estimate starts over when the time is set through
+         * set_time_now() or set_time_next_pps(). After setting the ticks
+         * directly with set_ticks_now() or set_ticks_next_pps(), it may be
+         * off for up to a second.
+         *
+         * eturns the estimated current time
+         */
+        uhd::time_spec_t get_time_now_estimate(void);
+
         /*! Return the current time as a tick count
          *
          * See also get_time_now().
@@ -133,6 +155,8 @@ public:
     private:
         //! Ticks/Second
         double _tick_rate = 1.0;
+
+        std::shared_ptr<uhd::time_estimator> _time_estimator;
     };
 
     //! Returns the number of timekeepers, which equals the number of timebases
@@ -345,6 +369,17 @@ public:
      */
     virtual std::vector<std::string> get_sensor_names() = 0;
 
+    /*! Get the values of all motherboard sensors
+     *
+     * The default implementation calls get_sensor() for every name returned by
+     * get_sensor_names(). Devices may override this to read out all sensors at
+     * once, e.g., with a single RPC call. Their values may then be up to a few
+     * seconds old (see the device manual).
+     *
+     * \return a vector of sensor value objects
+     */
+    virtual std::vector<uhd::sensor_value_t> get_all_sensors();
+
     /*! Return the motherboard EEPROM data
      */
     virtual uhd::usrp::mboard_eeprom_t get_eeprom() = 0;
@@ -126,6 +126,42 @@ public:
         _reg_iface_holder.regs().multi_poke32(abs_addrs, data, time, ack);
     }
 
+    /*! Write multiple 32-bit registers, and check every write for errors.
+     *
+     * See register_iface::multi_poke32_acked() for details.
+     *
+     * \param addrs The byte addresses of the registers to write to
+     *              (each truncated to 20 bits).
+     * \param data New values of these registers. The lengths of data and addr
+     *             must match.
+     * \param instance The index of the block of registers to which the writes apply.
+     * \param time The time at which the first transaction should be executed.
+     * \param max_outstanding The maximum number of writes that may be waiting
+     *                        for their ACK.
+     *
+     * \throws uhd::value_error if lengths of data and addr don't match, or if
+     *         max_outstanding is zero
+     * \throws op_failed if a transaction fails
+     * \throws op_timeout if no response is received
+     * \throws op_seqerr if a sequence error occurs
+     * \throws op_timeerr if a time error occurs (late command)
+     */
+    inline void multi_poke32_acked(const std::vector<uint32_t>& addrs,
+        const std::vector<uint32_t>& data,
+        const size_t instance        = 0,
+        uhd::time_spec_t time        = uhd::time_spec_t::ASAP,
+        const size_t max_outstanding = 16)
+    {
+        std::vector<uint32_t> abs_addrs(addrs.size());
+        std::transform(addrs.begin(),
+            addrs.end(),
+            abs_addrs.begin(),
+            [this, instance](
+                uint32_t addr) -> uint32_t { return _get_addr(addr, instance); });
+        _reg_iface_holder.regs().multi_poke32_acked(
+            abs_addrs, data, time, max_outstanding);
+    }
+
     /*! Write multiple consecutive 32-bit registers implemented in the NoC block.
      *
      * This function will only allow writes to adjacent registers, in increasing
@@ -174,6 +210,23 @@ public:
         return _reg_iface_holder.regs().peek32(_get_addr(addr, instance), time);
     }
 
+    /*! Read a 32-bit register implemented in the NoC block, without waiting for
+     * the result.
+     *
+     * See register_iface::peek32_async() for details.
+     *
+     * \param addr The byte address of the register to read from (truncated to 20 bits).
+     * \param instance The index of the block of registers to which the read applies.
+     * \param time The time at which the transaction should be executed.
+     * \return a future for the register value
+     */
+    inline std::future<uint32_t> peek32_async(uint32_t addr,
+        const size_t instance = 0,
+        time_spec_t time      = uhd::time_spec_t::ASAP)
+    {
+        return _reg_iface_holder.regs().peek32_async(_get_addr(addr, instance), time);
+    }
+
     /*! Read two consecutive 32-bit registers implemented in the NoC block
      * and return them as one 64-bit value.
      *
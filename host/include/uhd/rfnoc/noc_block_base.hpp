@@ -177,8 +177,10 @@ public:
         const res_source_info& edge, const bool account_for_ts = true);
 
     /*! Return the arguments that were passed into this block from the framework
+     *
+     * The reference stays valid for the lifetime of the block.
      */
-    uhd::device_addr_t get_block_args() const
+    const uhd::device_addr_t& get_block_args() const
     {
         return _block_args;
     }
@@ -17,6 +17,7 @@
 #include <unordered_set>
 #include <boost/graph/adjacency_list.hpp>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -162,6 +163,24 @@ public:
      */
     void set_properties(const uhd::device_addr_t& props, const size_t instance = 0);
 
+    /*! Set a property on multiple instances at once
+     *
+     * This is equivalent to calling set_property() for every instance/value
+     * pair of \p vals, except that property resolution only happens once,
+     * after all properties have been updated. This makes changing the same
+     * property on many channels (e.g., retuning all channels of a block) much
+     * cheaper.
+     *
+     * \tparam prop_data_t The data type of the property
+     * \param id The identifier of the property to write
+     * \param vals Maps instance numbers to the new values of the property
+     * \throws uhd::lookup_error if the property can't be found on one of the
+     *         instances
+     */
+    template <typename prop_data_t>
+    void set_properties(
+        const std::string& id, const std::map<size_t, prop_data_t>& vals);
+
     /*! Get the value of a specific block argument. \p The type of an argument
      *  must be known at compile time.
      *
@@ -682,6 +701,10 @@ private:
         std::hash<size_t>>
         _props;
 
+    //! All registered properties by property ID, so properties can be found
+    // without comparing the IDs of all properties
+    std::unordered_map<std::string, prop_ptrs_t> _props_by_id;
+
     //! Stores a clean callback for some properties
     std::unordered_map<property_base_t*, resolve_callback_t> _clean_cb_registry;
 
@@ -689,6 +712,10 @@ private:
     //! Stores the list of property resolvers
     std::vector<property_resolver_t> _prop_resolvers;
 
+    //! The indices into _prop_resolvers of the resolvers which take a property
+    // as an input, in the order in which they were added
+    std::unordered_map<property_base_t*, std::vector<size_t>> _prop_resolvers_by_input;
+
     //! A callback that the graph sets when the node is connected to graph.
     // This will return a global mutex to the graph. It is required to propagate
     // properties on multithread applications.
@@ -71,6 +71,33 @@ void node_t::set_property(
     }
 }
 
+template <typename prop_data_t>
+void node_t::set_properties(
+    const std::string& id, const std::map<size_t, prop_data_t>& vals)
+{
+    auto set_all = [&]() {
+        for (const auto& instance_val : vals) {
+            RFNOC_LOG_TRACE(
+                "Setting property " << id << "@" << instance_val.first);
+            auto prop_ptr = _assert_prop<prop_data_t>(
+                _find_property({res_source_info::USER, instance_val.first}, id),
+                get_unique_id(),
+                id);
+            auto prop_access = _request_property_access(prop_ptr, property_base_t::RW);
+            prop_ptr->set(instance_val.second);
+        }
+        // Only now trigger a property resolution, for all properties at once
+        resolve_all();
+    };
+    if (_graph_mutex_cb) {
+        // Node connected to graph. Must lock graph first.
+        std::lock_guard<std::recursive_mutex> l(_graph_mutex_cb());
+        set_all();
+    } else {
+        set_all();
+    }
+}
+
 template <typename prop_data_t>
 const prop_data_t& node_t::get_property(
     const std::string& id, const res_source_info& src_info)
@@ -272,6 +272,30 @@ public:
     virtual void issue_stream_cmd(
         const uhd::stream_cmd_t& stream_cmd, const size_t port) = 0;
 
+    /*! Capture a burst of samples periodically
+     *
+     * The radio captures \p stream_cmd.num_samps samples at the time of the
+     * stream command, and then again every \p period. This only needs to be
+     * called once, unlike a timed stream command per burst. The radio
+     * control queues the windows in the command FIFO of the radio ahead of
+     * time from a background thread, so applications which only read the
+     * samples don't need to issue a stream command per burst.
+     *
+     * The capture continues until issue_stream_cmd() is called for the same
+     * port. Windows which were already queued are still captured unless that
+     * is a stop command.
+     *
+     * \param stream_cmd The first window. It must be a timed
+     *        STREAM_MODE_NUM_SAMPS_AND_DONE stream command.
+     * \param period The time between the starts of two windows
+     * \param port The port for which the stream command is meant
+     * \throws uhd::value_error if the stream command isn't a timed finite
+     *         acquisition, or if the period is shorter than a window
+     */
+    virtual void issue_periodic_stream_cmd(const uhd::stream_cmd_t& stream_cmd,
+        const uhd::time_spec_t& period,
+        const size_t port) = 0;
+
     /*! Enable or disable the setting of timestamps on Rx.
      */
     virtual void enable_rx_timestamps(const bool enable, const size_t chan) = 0;
@@ -6,11 +6,17 @@
 
 #pragma once
 
+#include <uhd/exception.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/time_spec.hpp>
+#include <uhd/utils/histogram.hpp>
 #include <cstdint>
 #include <functional>
+#include <future>
+#include <limits>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace uhd { namespace rfnoc {
@@ -55,6 +61,27 @@ public:
     using async_msg_callback_t = std::function<void(
         uint32_t addr, const std::vector<uint32_t>& data, boost::optional<uint64_t>)>;
 
+    //! Latency statistics of the transactions with one opcode
+    struct transaction_stats_t
+    {
+        /*! The time from sending a request to receiving its ACK, in seconds
+         *
+         * This covers the link in both directions, and the time the request
+         * spent in the command FIFO of the block, e.g. waiting for the time of
+         * a timed command.
+         */
+        uhd::metrics::histogram::snapshot_t round_trip;
+        /*! The time the caller was blocked waiting for the ACK, in seconds
+         *
+         * This starts once the request was sent. If it is much longer than the
+         * round trip, the thread waiting for the ACK didn't get to run.
+         */
+        uhd::metrics::histogram::snapshot_t ack_wait;
+        //! The number of requests which timed out, either waiting for room in
+        // the command FIFO, or waiting for their ACK
+        uint64_t timeouts = 0;
+    };
+
     /*! Write a 32-bit register implemented in the NoC block.
      *
      * \param addr The byte address of the register to write to (truncated to 20 bits).
@@ -72,6 +99,55 @@ public:
         uhd::time_spec_t time = uhd::time_spec_t::ASAP,
         bool ack              = false) = 0;
 
+    /*! Write a 32-bit register, unless the command FIFO of the block is full.
+     *
+     * poke32() blocks until there is room for the request in the command FIFO
+     * of the block. When the FIFO is taken up by timed commands, this can take
+     * until these commands have been executed. This call returns false
+     * instead, without sending anything. Use get_cmd_fifo_free_slots() to
+     * find out ahead of time how many writes can be sent.
+     *
+     * If the write was sent and an ACK is requested, this still waits for the
+     * ACK, like poke32().
+     *
+     * The default implementation always calls poke32().
+     *
+     * \param addr The byte address of the register to write to (truncated to 20 bits).
+     * \param data New value of this register.
+     * \param time The time at which the transaction should be executed.
+     * \param ack Should transaction completion be acknowledged?
+     * \return true if the write was sent, false if the command FIFO was full
+     *
+     * \throws the same exceptions as poke32() if the write was sent
+     */
+    virtual bool try_poke32(uint32_t addr,
+        uint32_t data,
+        uhd::time_spec_t time = uhd::time_spec_t::ASAP,
+        bool ack              = false)
+    {
+        poke32(addr, data, time, ack);
+        return true;
+    }
+
+    /*! Return how many register writes fit into the command FIFO of the block
+     *
+     * The command FIFO holds the requests which the block has not responded
+     * to yet, including timed commands that are waiting for their time. This
+     * is the number of poke32() calls which can be made right now without
+     * blocking (unless there are other users of this register interface).
+     *
+     * The default implementation does not track the FIFO, and returns the
+     * largest possible value.
+     *
+     * \param timed If true, count timed writes, which take up more room in the
+     *              FIFO than writes which are executed right away.
+     */
+    virtual size_t get_cmd_fifo_free_slots(const bool timed = false) const
+    {
+        (void)timed;
+        return std::numeric_limits<size_t>::max();
+    }
+
     /*! Write two consecutive 32-bit registers implemented in the NoC block from
      * one 64-bit value.
      *
@@ -148,6 +224,49 @@ public:
         uhd::time_spec_t time = uhd::time_spec_t::ASAP,
         bool ack              = false) = 0;
 
+    /*! Write multiple 32-bit registers, and check every write for errors.
+     *
+     * Like multi_poke32(), but every transaction is acknowledged, not just the
+     * last one. Up to \p max_outstanding writes may be in flight at any time.
+     * Their ACKs are collected as they come in, so a long batch of writes is
+     * limited by the link bandwidth rather than by one round trip per write.
+     *
+     * If a write fails, the writes that were already sent are not undone.
+     *
+     * The default implementation waits for the ACK of every write before
+     * sending the next one.
+     *
+     * \param addrs The byte addresses of the registers to write to
+     *              (each truncated to 20 bits).
+     * \param data New values of these registers. The lengths of data and addr
+     *             must match.
+     * \param time The time at which the first transaction should be executed.
+     * \param max_outstanding The maximum number of writes that may be waiting
+     *                        for their ACK.
+     *
+     * \throws uhd::value_error if lengths of data and addr don't match, or if
+     *         max_outstanding is zero
+     * \throws op_failed if a transaction fails
+     * \throws op_timeout if no response is received
+     * \throws op_seqerr if a sequence error occurs
+     * \throws op_timeerr if a time error occurs (late command)
+     */
+    virtual void multi_poke32_acked(const std::vector<uint32_t>& addrs,
+        const std::vector<uint32_t>& data,
+        uhd::time_spec_t time        = uhd::time_spec_t::ASAP,
+        const size_t max_outstanding = 16)
+    {
+        if (addrs.size() != data.size()) {
+            throw uhd::value_error("addrs and data vectors must be of the same length");
+        }
+        if (max_outstanding == 0) {
+            throw uhd::value_error("max_outstanding must be at least 1");
+        }
+        for (size_t i = 0; i < data.size(); i++) {
+            poke32(addrs[i], data[i], (i == 0) ? time : uhd::time_spec_t::ASAP, true);
+        }
+    }
+
     /*! Read a 32-bit register implemented in the NoC block.
      *
      * \param addr The byte address of the register to read from (truncated to 20 bits).
@@ -159,6 +278,44 @@ public:
      */
     virtual uint32_t peek32(uint32_t addr, time_spec_t time = uhd::time_spec_t::ASAP) = 0;
 
+    /*! Read a 32-bit register implemented in the NoC block, without waiting for
+     * the result.
+     *
+     * The read request is sent right away, and the value can be retrieved from
+     * the returned future. This allows many reads to be in flight at the same
+     * time:
+     * \code{.cpp}
+     * auto status = regs.peek32_async(STATUS_ADDR);
+     * auto temp   = regs.peek32_async(TEMP_ADDR);
+     * process(status.get(), temp.get());
+     * \endcode
+     *
+     * The timeout for the read starts when get() (or wait()) is called on the
+     * future. Errors are also reported by get(). The future must not outlive
+     * this register interface.
+     *
+     * The default implementation reads the register before returning.
+     *
+     * \param addr The byte address of the register to read from (truncated to 20 bits).
+     * \param time The time at which the transaction should be executed.
+     * \return a future for the register value
+     *
+     * \throws op_failed if the transaction fails
+     * \throws op_timeout if no response is received
+     * \throws op_seqerr if a sequence error occurs
+     */
+    virtual std::future<uint32_t> peek32_async(
+        uint32_t addr, time_spec_t time = uhd::time_spec_t::ASAP)
+    {
+        std::promise<uint32_t> value;
+        try {
+            value.set_value(peek32(addr, time));
+        } catch (...) {
+            value.set_exception(std::current_exception());
+        }
+        return value.get_future();
+    }
+
     /*! Read two consecutive 32-bit registers implemented in the NoC block
      * and return them as one 64-bit value.
      *
@@ -294,6 +451,12 @@ public:
      *  Policies can be used to make tradeoffs between performance, resilience, latency,
      *  etc.
      *
+     * The "default" policy of RFNoC blocks accepts these arguments:
+     * - timeout: The time to wait for an ACK, in seconds
+     * - priority: "realtime", "normal" (the default) or "background". When the
+     *   blocks of a device compete for its control transport, requests of more
+     *   urgent classes are sent first. Timed commands are always realtime.
+     *
      * \param name The name of the policy to apply
      * \param args Additional arguments to pass to the policy governor
      */
@@ -313,6 +476,20 @@ public:
      */
     virtual uint16_t get_port_num() const = 0;
 
+    /*! Return the latency statistics of the transactions, by opcode
+     *
+     * The keys are the opcodes, e.g. "write", "read" or "sleep". Only
+     * transactions which waited for an ACK are counted, and only opcodes which
+     * were used show up.
+     *
+     * The default implementation does not track transactions, and returns an
+     * empty map.
+     */
+    virtual std::map<std::string, transaction_stats_t> get_transaction_stats() const
+    {
+        return {};
+    }
+
 }; // class register_iface
 
 }} /* namespace uhd::rfnoc */
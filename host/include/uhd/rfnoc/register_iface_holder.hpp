@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <uhd/config.hpp>
 #include <uhd/rfnoc/register_iface.hpp>
+#include <uhd/utils/scope_exit.hpp>
+#include <memory>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -15,7 +19,7 @@ namespace uhd { namespace rfnoc {
  * Classes derived from this class have access to a uhd::rfnoc::register_iface
  * object.
  */
-class register_iface_holder
+class UHD_API register_iface_holder
 {
 public:
     register_iface_holder(register_iface::sptr reg) : _reg(reg){};
@@ -30,11 +34,53 @@ public:
         return *(_reg.get());
     };
 
+    /*! Suppress redundant writes to a set of registers
+     *
+     * After this call, regs() keeps a shadow copy of the registers at
+     * \p addrs. A poke32() to one of these registers which is not timed and
+     * does not request an ACK is not sent when it writes the value which the
+     * register already has. Within coalesce_writes(), such pokes are also held
+     * back while they write to the same register, so that a series of field
+     * updates to one register results in only one write.
+     *
+     * The shadow copies are only updated through regs(), so only list
+     * registers which nothing else writes to, and which have no side effects
+     * when written (e.g., no strobes or FIFOs). The first write to each
+     * register is always sent. Calling this again replaces the set of
+     * registers.
+     *
+     * \param addrs The byte addresses of the registers
+     */
+    void enable_write_coalescing(const std::vector<uint32_t>& addrs);
+
+    /*! Merge consecutive writes to the same register until the return value
+     * is destroyed
+     *
+     * While the returned object exists, a write to one of the registers set
+     * up with enable_write_coalescing() is held back until a different
+     * register is accessed, or until the object is destroyed. Calls may be
+     * nested. Without enable_write_coalescing(), this has no effect.
+     *
+     * Example:
+     * \code{.cpp}
+     * {
+     *     auto batch = coalesce_writes();
+     *     regs().poke32(REG_GAIN, gain_bits);
+     *     regs().poke32(REG_GAIN, gain_bits | atten_bits);
+     * } // REG_GAIN is written once, here
+     * \endcode
+     */
+    uhd::utils::scope_exit::uptr coalesce_writes();
+
 protected:
     void update_reg_iface(register_iface::sptr new_iface = nullptr);
 
 private:
+    class write_coalescer;
+
     register_iface::sptr _reg;
+    //! The shadow layer, if write coalescing is enabled. Also in _reg.
+    std::shared_ptr<write_coalescer> _coalescer;
 };
 
 }} /* namespace uhd::rfnoc */
@@ -78,6 +78,12 @@ namespace uhd { namespace rfnoc {
  * reset the write-pointer and buffer size to the same values as before, it is
  * sufficient to call record_restart().
  *
+ * To load a file from the host into the memory, uhd::rfnoc::replay_load_file()
+ * (see uhd/utils/graph_utils.hpp) streams it through several input ports in
+ * parallel, and can verify the result by playing it back.
+ * uhd::rfnoc::replay_capture_to_file() goes the other way: It uses the memory
+ * as a double buffer to capture a stream (e.g., from a radio) into a file.
+ *
  * \section rfnoc_block_replay_playback Playing back Data
  *
  * To playback data from a given port, there are two options with basically the
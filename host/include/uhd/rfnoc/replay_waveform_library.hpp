@@ -0,0 +1,134 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/rfnoc/replay_block_control.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace rfnoc {
+
+/*! A catalog of named waveforms in the memory of a Replay block
+ *
+ * The Replay block itself only knows about memory offsets and sizes. This
+ * class keeps track of which waveform is stored where, and finds a place in
+ * memory for new waveforms, so applications don't need to manage the memory
+ * layout themselves. It only manages the layout, and does not move any data:
+ *
+ * \code{.cpp}
+ * auto library = replay_waveform_library::make(replay);
+ * auto waveform = library->add("chirp", chirp_size);
+ * replay_load_file(graph, replay, "chirp.dat", waveform.offset);
+ * // ...
+ * waveform = library->get("chirp");
+ * replay->play(waveform.offset, waveform.size, port);
+ * \endcode
+ *
+ * New waveforms are placed into the smallest free region they fit into (best
+ * fit), which keeps large regions free for large waveforms. If there is no
+ * such region, the least recently used waveforms are evicted until there is
+ * one. Waveforms count as used when they are added or returned by get(), and
+ * pinned waveforms are never evicted.
+ *
+ * All sizes and offsets are in bytes, and waveforms are aligned to the memory
+ * word size of the Replay block. This class is thread-safe.
+ */
+class UHD_API replay_waveform_library
+{
+public:
+    using sptr = std::shared_ptr<replay_waveform_library>;
+
+    //! A waveform in the memory of the Replay block
+    struct waveform_t
+    {
+        std::string name;
+        //! Memory offset of the waveform
+        uint64_t offset;
+        //! Size of the waveform, as requested in add()
+        uint64_t size;
+        //! Pinned waveforms are never evicted
+        bool pinned;
+    };
+
+    //! Called for every waveform which add() evicts from the memory
+    using evict_callback_t = std::function<void(const waveform_t&)>;
+
+    virtual ~replay_waveform_library() = default;
+
+    /*! Reserve memory for a new waveform
+     *
+     * This only finds a location for the waveform. The caller still needs to
+     * record the data to the returned offset.
+     *
+     * \param name A unique name for the waveform
+     * \param size The size of the waveform in bytes
+     * \param pinned If true, the waveform is never evicted
+     * \returns the location of the waveform
+     * \throws uhd::key_error if there already is a waveform with this name
+     * \throws uhd::value_error if the size is zero or larger than the memory
+     * \throws uhd::runtime_error if there is no room for the waveform, even
+     *         after evicting all waveforms which are not pinned
+     */
+    virtual waveform_t add(
+        const std::string& name, const uint64_t size, const bool pinned = false) = 0;
+
+    /*! Return the location of a waveform, and mark it as recently used
+     *
+     * \throws uhd::key_error if there is no waveform with this name
+     */
+    virtual waveform_t get(const std::string& name) = 0;
+
+    //! Return true if there is a waveform with this name
+    virtual bool has_waveform(const std::string& name) const = 0;
+
+    /*! Free the memory of a waveform
+     *
+     * \throws uhd::key_error if there is no waveform with this name
+     */
+    virtual void remove(const std::string& name) = 0;
+
+    /*! Pin or unpin a waveform
+     *
+     * Pin waveforms while they are being played back, so they don't get
+     * overwritten.
+     *
+     * \throws uhd::key_error if there is no waveform with this name
+     */
+    virtual void set_pinned(const std::string& name, const bool pinned) = 0;
+
+    //! Return all waveforms, ordered by their memory offset
+    virtual std::vector<waveform_t> get_waveforms() const = 0;
+
+    //! Return the total size of all free memory regions
+    virtual uint64_t get_free_size() const = 0;
+
+    //! Return the size of the largest waveform which fits without evicting any
+    virtual uint64_t get_largest_free_size() const = 0;
+
+    //! Register a function which is called for every evicted waveform
+    virtual void set_evict_callback(evict_callback_t callback) = 0;
+
+    /*! Create a library for a region of memory
+     *
+     * \param mem_size The size of the memory region which the library manages
+     * \param word_size The alignment of the waveforms
+     * \param mem_offset The start of the memory region. Must be a multiple of
+     *                   \p word_size.
+     * \throws uhd::value_error if the parameters are inconsistent
+     */
+    static sptr make(
+        const uint64_t mem_size, const uint64_t word_size, const uint64_t mem_offset = 0);
+
+    //! Create a library which manages the entire memory of a Replay block
+    static sptr make(replay_block_control::sptr replay);
+};
+
+}} // namespace uhd::rfnoc
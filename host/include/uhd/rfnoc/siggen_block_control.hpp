@@ -8,13 +8,28 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/types/time_spec.hpp>
 #include <uhd/utils/math.hpp>
 #include <complex>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
 enum class siggen_waveform { CONSTANT, SINE_WAVE, NOISE };
 
+//! One step of a sequence, see siggen_block_control::run_sequence()
+struct siggen_step_t
+{
+    //! When to apply the step, relative to the start of the sequence
+    uhd::time_spec_t time = uhd::time_spec_t(0.0);
+    //! The waveform type, see siggen_block_control::set_waveform()
+    siggen_waveform waveform = siggen_waveform::SINE_WAVE;
+    //! The amplitude, see siggen_block_control::set_amplitude()
+    double amplitude = 1.0;
+    //! The phase increment, see siggen_block_control::set_sine_phase_increment()
+    double phase_inc = 0.0;
+};
+
 /*! Siggen Control Class
  *
  * \ingroup rfnoc_blocks
@@ -179,6 +194,28 @@ public:
      */
     virtual size_t get_samples_per_packet(const size_t port) const = 0;
 
+    /*! Run a sequence of waveform settings, e.g., for a calibration sweep
+     *
+     * All steps are range checked and converted to register values before the
+     * first one is applied, so an invalid step leaves the block untouched.
+     * Every step then only writes the registers which differ from the
+     * previous step, as one batch of posted writes, so there are no round
+     * trips to the device between the steps.
+     *
+     * The siggen block applies register writes as soon as they arrive (it
+     * ignores command times), so the steps are paced by the host: Each step
+     * is written once its time has passed on the host clock, counted from the
+     * start of this call, which returns after the last step. Afterwards, the
+     * getters return the settings of the last step.
+     *
+     * \param steps The steps, in the order of their times
+     * \param port The port on the block to run the sequence on
+     * \throws uhd::value_error if a step is out of range, or the times of the
+     *         steps decrease
+     */
+    virtual void run_sequence(
+        const std::vector<siggen_step_t>& steps, const size_t port) = 0;
+
     /*! Configure the sinusoidal waveform generator given frequency and rate
      *
      * Convenience function to configure the current phase increment between
@@ -0,0 +1,173 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/rfnoc/block_id.hpp>
+#include <uhd/rfnoc_graph.hpp>
+#include <uhd/types/metadata.hpp>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace rfnoc {
+
+//! Settings of the blocks of a spectrum_monitor chain
+struct spectrum_monitor_config_t
+{
+    //! Length of the FFT, i.e., the number of bins of a frame
+    size_t fft_length = 1024;
+    //! Number of neighbouring bins the Moving Average block averages
+    uint8_t smoothing_len = 1;
+    //! Feedback tap of the Vector IIR block. The closer to 1, the longer a bin
+    // is averaged.
+    double iir_alpha = 0.875;
+    //! The Keep One in N block only passes one frame out of this many
+    size_t keep_one_in = 1;
+};
+
+/*! Computes spectra on the FPGA, and receives them as waterfall frames
+ *
+ * This class sets up a chain of RFNoC blocks which turns a stream of samples
+ * into a stream of spectra (frames), and receives the frames on the host.
+ * Every frame takes one packet, which is handed to the application without
+ * copying it (see uhd::rx_streamer::get_recv_buffs()). Since averaging and
+ * decimation happen on the FPGA, the host only sees the reduced frame rate:
+ *
+ * \code{.cpp}
+ * spectrum_monitor::config_t config;
+ * config.fft_length  = 1024;
+ * config.keep_one_in = 100;
+ * auto monitor = spectrum_monitor::make(graph,
+ *     {"0/DDC#0", "0/FFT#0", "0/LogPwr#0", "0/VectorIIR#0", "0/KeepOneInN#0"},
+ *     0,
+ *     config);
+ * monitor->start();
+ * std::vector<float> power_db(monitor->get_fft_length());
+ * spectrum_monitor::frame_t frame;
+ * while (monitor->recv_frame(frame)) {
+ *     monitor->get_power_db(frame, power_db.data());
+ *     monitor->release_frame();
+ *     // Draw the line of the waterfall
+ * }
+ * \endcode
+ *
+ * The chain starts with the block which produces the samples (e.g., a DDC or a
+ * radio), followed by an FFT block. These blocks may follow the FFT block, in
+ * this order, and each of them is optional:
+ * - A Log Power block, which turns the spectrum into log power values. Without
+ *   it, the FFT block outputs complex values, and get_power_db() computes the
+ *   power on the host.
+ * - A Moving Average block, which smooths each frame across
+ *   config_t::smoothing_len neighbouring bins.
+ * - A Vector IIR block, which averages every bin across frames.
+ * - A Keep One in N block, which only passes one frame out of
+ *   config_t::keep_one_in on to the host.
+ *
+ * The settings in config_t of blocks which are not in the chain are ignored.
+ * All blocks use the same port. The blocks are connected in the given order,
+ * the last one to a streamer, and the graph is committed. The connections are
+ * removed again when this object is destroyed. Stream commands are forwarded
+ * upstream to the first block of the chain.
+ */
+class UHD_API spectrum_monitor
+{
+public:
+    using sptr = std::shared_ptr<spectrum_monitor>;
+
+    //! Settings of the blocks of the chain
+    using config_t = spectrum_monitor_config_t;
+
+    //! A frame received from the FPGA
+    struct frame_t
+    {
+        /*! The bins of the frame, which are borrowed from the streamer
+         *
+         * With a Log Power block, the real part of each bin holds its log power
+         * value. Otherwise, a bin holds the complex output of the FFT. Use
+         * get_power_db() to convert either to dB.
+         */
+        const std::complex<int16_t>* bins = nullptr;
+        //! The number of bins (the FFT length, unless there was an error)
+        size_t num_bins = 0;
+        //! The metadata of the packet which carried the frame
+        uhd::rx_metadata_t metadata;
+    };
+
+    virtual ~spectrum_monitor() = default;
+
+    //! Return the length of the FFT, which may have been coerced
+    virtual size_t get_fft_length() const = 0;
+
+    //! Return true if the frames hold log power values (see frame_t::bins)
+    virtual bool has_log_power() const = 0;
+
+    /*! Start producing frames
+     *
+     * \param time_spec If given, the time at which the source starts streaming
+     */
+    virtual void start(const uhd::time_spec_t& time_spec = uhd::time_spec_t(0.0)) = 0;
+
+    //! Stop producing frames
+    virtual void stop() = 0;
+
+    /*! Receive the next frame without copying it
+     *
+     * The bins of the frame are valid until release_frame() is called, which
+     * must happen before the next call to this function.
+     *
+     * \param[out] frame The frame
+     * \param timeout The timeout in seconds to wait for a frame
+     * \returns true if a frame was received. On false, frame.metadata holds
+     *          the reason, and no frame needs to be released.
+     */
+    virtual bool recv_frame(frame_t& frame, const double timeout = 0.1) = 0;
+
+    //! Return the bins of the last frame to the streamer
+    virtual void release_frame() = 0;
+
+    /*! Convert the bins of a frame to power values in dB (full scale)
+     *
+     * \param frame The frame to convert
+     * \param power_db Receives frame.num_bins values
+     */
+    virtual void get_power_db(const frame_t& frame, float* power_db) const = 0;
+
+    //! Return the streamer which receives the frames (e.g., to read its counters)
+    virtual uhd::rx_streamer::sptr get_streamer() const = 0;
+
+    /*! Set up a chain of blocks, and a streamer which receives its frames
+     *
+     * \param graph The graph which contains the blocks
+     * \param chain The source block, the FFT block, and any of the optional
+     *              blocks, in this order (see above)
+     * \param port The port of the blocks to use
+     * \param config The settings of the blocks
+     * \throws uhd::lookup_error if a block does not exist
+     * \throws uhd::value_error if the chain does not match the description
+     *         above, or the settings are out of range
+     */
+    static sptr make(rfnoc_graph::sptr graph,
+        const std::vector<block_id_t>& chain,
+        const size_t port      = 0,
+        const config_t& config = config_t());
+
+    /*! Convert bins to power values in dB (full scale)
+     *
+     * \param bins The bins, as described for frame_t::bins
+     * \param num_bins The number of bins
+     * \param log_power True if the bins hold log power values
+     * \param power_db Receives num_bins values
+     */
+    static void convert_to_db(const std::complex<int16_t>* bins,
+        const size_t num_bins,
+        const bool log_power,
+        float* power_db);
+};
+
+}} // namespace uhd::rfnoc
@@ -8,6 +8,9 @@
 
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <utility>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -24,6 +27,20 @@ namespace uhd { namespace rfnoc {
  *
  * NOTE: This block is not intended to switch during the transmission of packets.
  *       Data on disconnected inputs will stall.
+ *
+ * \section switchboard_routes Precomputed Routes
+ *
+ * connect() resolves the properties of the graph every time it is called. To
+ * switch between a few configurations quickly (e.g., between antenna
+ * processing chains), validate them once with set_routes(), and then switch
+ * with select_route(). That writes the precomputed register values in a single
+ * (optionally timed) command, and updates the forwarding of properties and
+ * actions without resolving any properties.
+ *
+ * Because the properties are not resolved again, the routes must connect ports
+ * which carry the same properties (e.g., the same sample rate). The
+ * \p input_select and \p output_select properties keep the values of the last
+ * connect() call.
  */
 class UHD_API switchboard_block_control : public noc_block_base
 {
@@ -45,6 +62,34 @@ public:
      * \param output Index of the output port.
      */
     virtual void connect(const size_t input, const size_t output) = 0;
+
+    //! A routing configuration: Pairs of connected (input, output) ports
+    using route_t = std::vector<std::pair<size_t, size_t>>;
+
+    /*! Validates routing configurations and precomputes their register writes
+     *
+     * Replaces the routes of earlier calls. Each route lists the inputs which
+     * select_route() connects to outputs; the connections of other ports stay
+     * as they are.
+     *
+     * \param routes The routing configurations, which select_route() refers to
+     *               by index
+     * \throws uhd::value_error if a port index is out of bounds, or if a route
+     *         uses an input or an output more than once
+     */
+    virtual void set_routes(const std::vector<route_t>& routes) = 0;
+
+    //! Returns the number of routes passed to set_routes()
+    virtual size_t get_num_routes() const = 0;
+
+    /*! Switches to one of the routes passed to set_routes()
+     *
+     * \param route The index of the route
+     * \param time The time at which to switch, or ASAP
+     * \throws uhd::index_error if \p route is out of bounds
+     */
+    virtual void select_route(
+        const size_t route, const uhd::time_spec_t& time = uhd::time_spec_t::ASAP) = 0;
 };
 
 }} // namespace uhd::rfnoc
@@ -0,0 +1,123 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/rfnoc/graph_edge.hpp>
+#include <uhd/rfnoc_graph.hpp>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace rfnoc {
+
+//! One reading of the traffic counters of a block (see uhd::rfnoc::traffic_counter)
+struct traffic_counter_values_t
+{
+    uint64_t bus_clock_ticks          = 0;
+    uint64_t xbar_to_shell_xfer_count = 0;
+    uint64_t xbar_to_shell_pkt_count  = 0;
+    uint64_t shell_to_xbar_xfer_count = 0;
+    uint64_t shell_to_xbar_pkt_count  = 0;
+    uint64_t shell_to_ce_xfer_count   = 0;
+    uint64_t shell_to_ce_pkt_count    = 0;
+    uint64_t ce_to_shell_xfer_count   = 0;
+    uint64_t ce_to_shell_pkt_count    = 0;
+};
+
+//! The traffic on an edge of the graph, between two readings of the counters
+struct traffic_edge_stats_t
+{
+    //! The edge
+    graph_edge_t edge;
+    //! The block whose counters measured the edge: the source block, if it has
+    // traffic counters, or else the destination block
+    std::string counter_block;
+    //! Bus transfers per second
+    double xfers_per_sec = 0.0;
+    //! Packets per second
+    double pkts_per_sec = 0.0;
+    //! The fraction of bus clock cycles which moved data, from 0 to 1
+    double utilization = 0.0;
+};
+
+/*! Samples the traffic counters of the blocks of a graph in the background
+ *
+ * Blocks which have traffic counters (see uhd::rfnoc::traffic_counter) get
+ * them enabled, and a thread reads them at a fixed interval. After every
+ * reading, it turns the counter increments into the traffic on each active
+ * edge of the graph which starts or ends at such a block:
+ *
+ * \code{.cpp}
+ * auto monitor = traffic_monitor::make(graph, 0.5);
+ * monitor->set_callback([](const std::vector<traffic_edge_stats_t>& stats) {
+ *     for (const auto& edge_stats : stats) {
+ *         std::cout << edge_stats.edge.to_string() << ": "
+ *                   << edge_stats.utilization * 100 << "%" << std::endl;
+ *     }
+ * });
+ * \endcode
+ *
+ * The counters don't tell apart cycles where a block had no data from cycles
+ * where it was held back. However, backpressure shows as a chain of edges
+ * whose packet rates drop to that of the slowest block, while the edges into
+ * that block run at a high utilization. Counters cover all ports of a block,
+ * so edges from different ports of the same block report the same traffic.
+ *
+ * The counters are disabled again when this object is destroyed.
+ */
+class UHD_API traffic_monitor
+{
+public:
+    using sptr       = std::shared_ptr<traffic_monitor>;
+    using callback_t = std::function<void(const std::vector<traffic_edge_stats_t>&)>;
+
+    virtual ~traffic_monitor() = default;
+
+    //! Return the IDs of the blocks which have traffic counters
+    virtual std::vector<std::string> get_counter_blocks() const = 0;
+
+    /*! Return the traffic on the edges, from the two latest readings
+     *
+     * This is empty until the counters were read twice.
+     */
+    virtual std::vector<traffic_edge_stats_t> get_edge_stats() const = 0;
+
+    /*! Call \p callback after every reading, with the traffic on the edges
+     *
+     * The callback runs on the sampling thread, and must return quickly.
+     */
+    virtual void set_callback(callback_t callback) = 0;
+
+    /*! Start sampling the traffic counters of the blocks of \p graph
+     *
+     * \param graph The graph
+     * \param interval The time between two readings, in seconds
+     * \throws uhd::value_error if \p interval is not positive
+     */
+    static sptr make(rfnoc_graph::sptr graph, const double interval = 1.0);
+
+    /*! Compute the traffic on edges from two readings of the counters
+     *
+     * Edges none of whose blocks are in both \p prev and \p cur are skipped.
+     *
+     * \param edges The edges of the graph
+     * \param prev The earlier reading of each block, by block ID
+     * \param cur The later reading of each block, by block ID
+     * \param elapsed The time between the two readings, in seconds
+     */
+    static std::vector<traffic_edge_stats_t> compute_edge_stats(
+        const std::vector<graph_edge_t>& edges,
+        const std::map<std::string, traffic_counter_values_t>& prev,
+        const std::map<std::string, traffic_counter_values_t>& cur,
+        const double elapsed);
+};
+
+}} // namespace uhd::rfnoc
@@ -9,6 +9,8 @@
 #include <uhd/config.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
 #include <uhd/types/ranges.hpp>
+#include <string>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -70,6 +72,62 @@ public:
      * \returns The vector of current window coefficients
      */
     virtual std::vector<int16_t> get_coefficients(const size_t chan) const = 0;
+
+    /*! Store a named set of window coefficients
+     *
+     * Coefficient sets make it cheap to switch between window types (e.g.,
+     * for different analysis modes): They are validated once, when they are
+     * added, and load_coefficient_set() skips channels which already use the
+     * requested set. Adding a set under an existing name replaces it.
+     *
+     * \param name The name of the set
+     * \param coeffs A vector of integer coefficients for the window. It can't
+     *               be longer than the maximum number of coefficients of any
+     *               channel.
+     * \throws uhd::value_error if there are no or too many coefficients
+     */
+    virtual void add_coefficient_set(
+        const std::string& name, const std::vector<int16_t>& coeffs) = 0;
+
+    //! Return true if a coefficient set with this name was added
+    virtual bool has_coefficient_set(const std::string& name) const = 0;
+
+    /*! Remove a coefficient set
+     *
+     * Channels which use the set keep their coefficients.
+     *
+     * \throws uhd::key_error if there is no set with this name
+     */
+    virtual void remove_coefficient_set(const std::string& name) = 0;
+
+    //! Return the names of all coefficient sets
+    virtual std::vector<std::string> get_coefficient_sets() const = 0;
+
+    /*! Load a coefficient set into a channel
+     *
+     * This is equivalent to calling set_coefficients() with the coefficients
+     * of the set, except that nothing is written if the channel already uses
+     * the set.
+     *
+     * Note that the window block has a single coefficient memory, which it
+     * reloads while it is streaming, and it ignores command times. Samples
+     * which pass through the block while the coefficients are loaded may
+     * therefore be multiplied by a mix of the old and the new window.
+     *
+     * \param name The name of the set
+     * \param chan The channel to load the set into
+     * \throws uhd::key_error if there is no set with this name
+     * \throws uhd::value_error if the set has too many coefficients for this
+     *         channel
+     */
+    virtual void load_coefficient_set(const std::string& name, const size_t chan) = 0;
+
+    /*! Return the name of the coefficient set a channel uses
+     *
+     * \returns the name of the set last loaded with load_coefficient_set(), or
+     *          an empty string if the coefficients were set otherwise
+     */
+    virtual std::string get_coefficient_set(const size_t chan) const = 0;
 };
 
 }} // namespace uhd::rfnoc
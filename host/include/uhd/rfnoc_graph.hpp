@@ -16,7 +16,9 @@
 #include <uhd/types/time_spec.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <boost/units/detail/utility.hpp> // for demangle
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace uhd { namespace rfnoc {
@@ -225,6 +227,45 @@ public:
         size_t strm_port,
         uhd::transport::adapter_id_t adapter_id = uhd::transport::NULL_ADAPTER_ID) = 0;
 
+    /*! Connect all ports of a TX streamer to inputs of NoC blocks
+     *
+     * This is equivalent to connecting port \p i of the streamer to
+     * \p dst_ports[i] with the connect() call above, but it is faster for
+     * streamers with many channels: The stream endpoints of all channels are
+     * configured in one go, and those of different motherboards at the same
+     * time.
+     *
+     * \param streamer The streamer to connect.
+     * \param dst_ports The block IDs and ports of the destination blocks, one
+     *                  for every port of the streamer.
+     * \param adapter_id The local device ID (transport) to use for these connections.
+     *
+     * \throws connect_disallowed_on_dst
+     *     if a destination port is statically connected to a *different* block
+     */
+    virtual void connect(uhd::tx_streamer::sptr streamer,
+        const std::vector<std::pair<block_id_t, size_t>>& dst_ports,
+        uhd::transport::adapter_id_t adapter_id = uhd::transport::NULL_ADAPTER_ID) = 0;
+
+    /*! Connect outputs of NoC blocks to all ports of an RX streamer
+     *
+     * This is equivalent to connecting \p src_ports[i] to port \p i of the
+     * streamer with the connect() call above, but it is faster for streamers
+     * with many channels: The stream endpoints of all channels are configured
+     * in one go, and those of different motherboards at the same time.
+     *
+     * \param src_ports The block IDs and ports of the source blocks, one for
+     *                  every port of the streamer.
+     * \param streamer The streamer to connect.
+     * \param adapter_id The local device ID (transport) to use for these connections.
+     *
+     * \throws connect_disallowed_on_src
+     *     if a source port is statically connected to a *different* block
+     */
+    virtual void connect(const std::vector<std::pair<block_id_t, size_t>>& src_ports,
+        uhd::rx_streamer::sptr streamer,
+        uhd::transport::adapter_id_t adapter_id = uhd::transport::NULL_ADAPTER_ID) = 0;
+
     /*! Disconnect a RFNoC block with block ID \p src_blk from another with block ID
      * \p dst_blk.  This will logically disconnect the blocks, but the physical
      * connection will not be changed until a new connection is made on the source
@@ -326,6 +367,36 @@ public:
      */
     virtual void release() = 0;
 
+    /*! Enable or disable dynamic reconfiguration
+     *
+     * By default, commit() checks the topology of every block and runs a
+     * property propagation across the whole graph. When rewiring a graph at
+     * runtime, e.g., switching paths through a switchboard block, this can
+     * take much longer than the change itself. With dynamic reconfiguration,
+     * commit() only checks the blocks whose connections changed since the
+     * last commit, and only resolves the properties which the new connections
+     * change. Reconnecting two blocks across the crossbar reuses the data
+     * stream which was set up when they were first connected.
+     *
+     * This only applies if all blocks whose connections changed were part of
+     * an earlier commit. Adding a block or a streamer to the graph always
+     * causes a full commit.
+     *
+     * Example:
+     * \code{.cpp}
+     * graph->commit();
+     * graph->set_dynamic_reconfig(true);
+     * // Later, while streaming:
+     * graph->release();
+     * graph->disconnect(switchboard_id, 0, ddc0_id, 0);
+     * graph->connect(switchboard_id, 0, ddc1_id, 0);
+     * graph->commit();
+     * \endcode
+     *
+     * \param enable True to enable dynamic reconfiguration
+     */
+    virtual void set_dynamic_reconfig(const bool enable) = 0;
+
     /******************************************
      * Streaming
      ******************************************/
@@ -389,6 +460,90 @@ public:
     virtual bool synchronize_devices(
         const uhd::time_spec_t& time_spec, const bool quiet) = 0;
 
+    /*! Start a command batch on the calling thread
+     *
+     * Normally, a register write which requests an ACK (this includes all
+     * writes if the block was configured to always require ACKs) waits for
+     * it before returning. Timed commands are only ACKed once they have been
+     * executed, so a sequence of timed commands to several blocks takes at
+     * least as long as the commands are spread out in time.
+     *
+     * Between begin_command_batch() and end_command_batch(), such writes
+     * return as soon as they have been sent. The commands for every block are
+     * sent back to back, as far as the command FIFO of the block allows, and
+     * end_command_batch() waits for all the ACKs at once. Reads still wait
+     * for their results.
+     *
+     * Example:
+     * \code{.cpp}
+     * graph->begin_command_batch();
+     * for (auto& radio : radios) {
+     *     radio->set_command_time(cmd_time, 0);
+     *     radio->set_rx_frequency(freq, 0);
+     *     radio->clear_command_time(0);
+     * }
+     * graph->end_command_batch();
+     * \endcode
+     *
+     * Batches may be nested. Only the outermost end_command_batch() waits for
+     * the ACKs.
+     */
+    virtual void begin_command_batch() = 0;
+
+    /*! End the command batch of the calling thread
+     *
+     * Waits for the ACKs of all commands which were sent since the matching
+     * call to begin_command_batch().
+     *
+     * \throws uhd::runtime_error if no batch was started
+     * \throws uhd::op_failed, uhd::op_timerr, uhd::op_timeout, etc. if any of
+     *         the commands of the batch failed. All ACKs are collected before
+     *         the first of these errors is thrown.
+     */
+    virtual void end_command_batch() = 0;
+
+    //! Report of issue_group_stream_cmd()
+    struct group_stream_cmd_report_t
+    {
+        //! The time at which the stream command takes effect on all radios
+        uhd::time_spec_t start_time;
+        /*! How long before start_time the radios of each motherboard were
+         * programmed, by motherboard index
+         *
+         * This is the difference between start_time and the time of the
+         * motherboard right after its last command was sent. A small or
+         * negative margin means that the command was (nearly) late, and that
+         * a longer lead time is needed.
+         */
+        std::map<size_t, uhd::time_spec_t> margins;
+    };
+
+    /*! Issue the same timed stream command to many radios at once
+     *
+     * This is meant for starting (or stopping) many devices at the same time.
+     * The stream command is scheduled \p lead_time seconds after the current
+     * time of motherboard 0. The radios are then programmed in parallel, one
+     * thread per motherboard.
+     *
+     * The stream commands go straight to the radios, without passing through
+     * the blocks between the radios and the streamers. For finite
+     * acquisitions, \p stream_cmd.num_samps is therefore the number of samples
+     * at the sample rate of the radio. The devices must be synchronized (see
+     * synchronize_devices()).
+     *
+     * \param radio_ports The radio blocks and their ports (channels)
+     * \param stream_cmd The stream command. Its time_spec and stream_now
+     *                   fields are ignored.
+     * \param lead_time How far in the future the command takes effect, in seconds
+     * \returns the start time, and how far ahead of it every motherboard was
+     *          programmed
+     * \throws uhd::lookup_error if one of the blocks is not a radio
+     */
+    virtual group_stream_cmd_report_t issue_group_stream_cmd(
+        const std::vector<std::pair<block_id_t, size_t>>& radio_ports,
+        const uhd::stream_cmd_t& stream_cmd,
+        const double lead_time) = 0;
+
     //! Return a reference to the property tree
     virtual uhd::property_tree::sptr get_tree(void) const = 0;
 }; // class rfnoc_graph
@@ -14,6 +14,7 @@
 #include <uhd/types/stream_cmd.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <boost/utility.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -60,6 +61,10 @@ struct UHD_API stream_args_t
      *  - fc32 - complex<float>
      *  - sc16 - complex<int16_t>
      *  - sc8 - complex<int8_t>
+     *  - fc16 - pairs of IEEE 754 half-precision floats (I, then Q), only
+     *    with sc16 over the wire
+     *  - bf16 - pairs of bfloat16 floats (I, then Q), with the same value range
+     *    as fc32 but only 8 significant bits, only with sc16 over the wire
      *
      * The following are not implemented, but are listed to demonstrate naming convention:
      *  - f32 - float
@@ -119,6 +124,52 @@ struct UHD_API stream_args_t
      *
      * - noclear: Used by tx_dsp_core_200 and rx_dsp_core_200
      *
+     * - convert_threads: (RFNoC devices only) number of additional threads
+     * which convert samples of multi-channel streamers in parallel. By default,
+     * all channels are converted one after the other by the thread calling
+     * recv() or send(). At most one thread per channel (beyond the first one)
+     * is used.
+     *
+     * - convert_cpus: (RFNoC devices only) colon-separated list of CPUs to pin
+     * the convert_threads to, e.g. "2:3:4". With "auto", each thread gets a
+     * physical core of its own from uhd::get_thread_placement(), next to
+     * num_poll_offload_threads I/O threads on numa_node.
+     *
+     * - host_fft_length: (RFNoC RX streamers with the fc32 CPU format only)
+     * transform the received samples with a uhd::rfnoc::host_fft of this
+     * length, right after they are converted. host_fft_magnitude, host_fft_shift,
+     * host_fft_direction and host_fft_scaling configure it like the FFT block.
+     *
+     * - host_vector_iir_delay, host_moving_average_sum_len: (RFNoC RX
+     * streamers with the fc32 CPU format only) filter the received samples
+     * with a uhd::rfnoc::host_vector_iir or average them with a
+     * uhd::rfnoc::host_moving_average, after the host FFT (if any).
+     * host_vector_iir_alpha, host_vector_iir_beta and
+     * host_moving_average_divisor configure them like the blocks.
+     *
+     * - host_keep_one_in_n: (RFNoC RX streamers only) keep one in this many
+     * samples, and skip the others before converting them. With
+     * host_keep_one_in_n_mode=packet, one in this many packets is kept.
+     *
+     * - host_resample_interp, host_resample_decim: (RFNoC streamers with the
+     * fc32 CPU format only) resample every channel by interp / decim with a
+     * uhd::rfnoc::host_resampler, i.e., RX samples come at the device rate
+     * times this ratio, and TX samples are sent at the device rate divided by
+     * it. host_resample_taps sets the taps per phase.
+     *
+     * - host_agc: (RX streamers of multi_usrp on RFNoC devices with the sc16
+     * OTW format only) control the RX gain from the power of the received
+     * samples, and flag gain changes in the rx_metadata_t. host_agc_setpoint,
+     * host_agc_hysteresis, host_agc_max_step, host_agc_packets and
+     * host_agc_latency configure it.
+     *
+     * - channel_layout: (RFNoC RX streamers only) "separate" (the default)
+     * converts every channel into its own buffer. "interleaved" converts all
+     * channels into the first buffer, which then holds sample 0 of every
+     * channel, then sample 1 of every channel, and so on. The transpose is
+     * part of the conversion, which supports the sc16 OTW format with the
+     * fc32, fc64 and sc16 CPU formats, and up to 16 channels.
+     *
      * The following are not implemented, but are listed for conceptual purposes:
      * - function: magnitude or phase/magnitude
      * - units: numeric units like counts or dBm
@@ -158,6 +209,160 @@ struct UHD_API stream_args_t
     std::vector<size_t> channels;
 };
 
+/*!
+ * Counters describing the activity of a streamer since it was created.
+ *
+ * The counters are updated by the thread calling recv() or send() and can be
+ * read from any other thread with rx_streamer::get_telemetry() or
+ * tx_streamer::get_telemetry(), e.g., to find out where time was spent when
+ * an overrun occurs. Counters which a streamer does not support remain zero.
+ */
+struct UHD_API stream_telemetry_t
+{
+    //! Number of data packets received (RX) or sent (TX), summed over all channels
+    uint64_t packets = 0;
+
+    //! Number of samples received (RX) or sent (TX), per channel
+    uint64_t samples = 0;
+
+    /*! Number of sequence errors
+     *
+     * On RX, this is the number of times packets went missing on the way to
+     * the host. On TX, this is the number of sequence errors reported by the
+     * device.
+     */
+    uint64_t sequence_errors = 0;
+
+    //! Number of overruns reported to the application (RX only)
+    uint64_t overflows = 0;
+
+    //! Number of underruns reported by the device (TX only)
+    uint64_t underflows = 0;
+
+    /*! Number of async messages which were dropped (TX only)
+     *
+     * Async messages are queued until the application calls
+     * tx_streamer::recv_async_msg(). If it doesn't call it often enough, the
+     * queue fills up, and new messages are dropped.
+     */
+    uint64_t async_msgs_dropped = 0;
+
+    /*! Flow control state, summed over all channels
+     *
+     * On RX, this is the data that was received, but not yet acknowledged to
+     * the device. On TX, this is the data that was sent, but not yet
+     * acknowledged by the device, i.e., the fullness of the device's buffer as
+     * seen by the host.
+     */
+    uint64_t fc_bytes_outstanding   = 0;
+    uint64_t fc_packets_outstanding = 0;
+
+    //! Time spent converting samples between the CPU and OTW formats, in ns
+    uint64_t convert_ns = 0;
+
+    /*! Time spent waiting for a buffer, in ns
+     *
+     * On RX, this is the time recv() blocked because no packets were
+     * available. On TX, this is the time send() blocked waiting for a free
+     * buffer or flow control credits.
+     */
+    uint64_t buff_wait_ns = 0;
+
+    /*! State of the receive buffers of the transport (RX only)
+     *
+     * For transports which queue up transfers to the kernel, such as USB,
+     * this is the number of transfers currently waiting for data, the lowest
+     * number seen since the transport was created, and the number of
+     * completed transfers not yet picked up by recv(). If the number in flight
+     * drops to zero, the host can't keep up with the device, and overruns
+     * follow.
+     */
+    uint64_t xport_frames_in_flight     = 0;
+    uint64_t xport_frames_in_flight_min = 0;
+    uint64_t xport_frames_ready         = 0;
+
+    /*! Buffering of the transports, as chosen when the streamer was created
+     *
+     * This is the flow control window in bytes (the receive buffer on RX, the
+     * device's buffer on TX), the number of frames reserved from the link, and
+     * the size of those frames, per channel (the largest of all channels).
+     * With the auto_tune transport argument, these are the values it chose.
+     */
+    uint64_t xport_fc_window_bytes = 0;
+    uint64_t xport_num_frames      = 0;
+    uint64_t xport_frame_size      = 0;
+
+    /*! CPU cycles spent in the calls to recv() (RX) or send() (TX), by stage
+     *
+     * These are only counted if UHD was built with the CMake option
+     * UHD_CYCLE_ACCOUNTING, and are zero otherwise (see
+     * \ref stream_cycle_accounting). Every cycle of a call counts towards one
+     * stage: waiting for buffers, decoding or writing the CHDR headers, flow
+     * control, converting the samples, handling the metadata, sending the
+     * packets (TX only), or anything else (cycles_other). cycles_total is the
+     * sum of all stages, and num_calls the number of calls.
+     *
+     * The cycles are those of the time stamp counter on x86 and of the generic
+     * timer on ARM64, which count at a fixed rate; cycles_per_second is that
+     * rate, as measured since the streamer was created.
+     */
+    uint64_t num_calls         = 0;
+    uint64_t cycles_total      = 0;
+    uint64_t cycles_buff_wait  = 0;
+    uint64_t cycles_header     = 0;
+    uint64_t cycles_flow_ctrl  = 0;
+    uint64_t cycles_convert    = 0;
+    uint64_t cycles_metadata   = 0;
+    uint64_t cycles_send       = 0;
+    uint64_t cycles_other      = 0;
+    uint64_t cycles_per_second = 0;
+};
+
+/*!
+ * Host memory which a streamer and its transports allocated when they were
+ * created.
+ *
+ * Read it with rx_streamer::get_memory_footprint() or
+ * tx_streamer::get_memory_footprint(), e.g., to plan how many channels fit
+ * into a machine. The memory_budget stream argument limits it. The socket
+ * buffers of the kernel are not included. Streamers which do not support this
+ * report no links.
+ */
+struct UHD_API stream_memory_t
+{
+    //! The frames which the link of one channel allocated
+    struct link_t
+    {
+        size_t num_recv_frames = 0;
+        size_t recv_frame_size = 0;
+        size_t num_send_frames = 0;
+        size_t send_frame_size = 0;
+
+        //! Return the size of all frames of the link, in bytes
+        uint64_t get_bytes() const
+        {
+            return uint64_t(num_recv_frames) * recv_frame_size
+                   + uint64_t(num_send_frames) * send_frame_size;
+        }
+    };
+
+    //! The links, in the order of the channels
+    std::vector<link_t> links;
+
+    //! Buffers of the streamer itself, such as registered waveforms, in bytes
+    uint64_t streamer_bytes = 0;
+
+    //! Return the memory of all links and of the streamer, in bytes
+    uint64_t get_total_bytes() const
+    {
+        uint64_t total = streamer_bytes;
+        for (const auto& link : links) {
+            total += link.get_bytes();
+        }
+        return total;
+    }
+};
+
 /*!
  * The RX streamer is the host interface to receiving samples.
  * It represents the layer between the samples on the host
@@ -242,6 +447,89 @@ public:
         const double timeout  = 0.1,
         const bool one_packet = false) = 0;
 
+    //! One set of buffers to receive one packet into, with recv_many()
+    struct recv_slot_t
+    {
+        //! The buffers, one per channel
+        std::vector<void*> buffs;
+        //! The size of each buffer in number of samples
+        size_t nsamps_per_buff = 0;
+        //! Output: The number of samples received into each buffer
+        size_t num_samps = 0;
+        //! Output: Data describing the buffers
+        rx_metadata_t metadata;
+    };
+
+    /*!
+     * Receive several packets in one call, one packet per slot.
+     *
+     * The first slot is filled in like recv() with one_packet set, i.e., this
+     * waits up to \p timeout for the first packet. The following slots are
+     * only filled in with packets which have already arrived, so this does
+     * not wait any longer once the first packet is there. This saves the
+     * per-call overhead of recv() with small packets.
+     *
+     * Receiving stops after a slot whose metadata has an end of burst. Every
+     * slot has its own metadata with its own end-of-vector positions, if
+     * requested. An error on one of the
+     * following slots is not returned in that slot, but by the next call to
+     * recv() or recv_many(), like recv() does with errors after its first
+     * packet. If a packet does not fit into a slot, the rest of the packet
+     * goes into the next slot.
+     *
+     * Streamers which can not check whether packets have arrived only fill
+     * in the first slot. The thread-safety rules of recv() apply.
+     *
+     * \param slots The slots to receive into. Their number is the maximum
+     *              number of packets to receive.
+     * \param timeout the timeout in seconds to wait for the first packet
+     * \return the number of slots which were filled in. If there are slots,
+     *         this is at least one, and the metadata of the first slot may
+     *         carry an error code.
+     */
+    virtual size_t recv_many(std::vector<recv_slot_t>& slots, const double timeout = 0.1);
+
+    //! Typedef for the pointers to borrowed samples, one per channel
+    typedef std::vector<const void*> recv_buffs_type;
+
+    /*!
+     * Receive one packet without copying its samples.
+     *
+     * Instead of converting the samples into buffers provided by the
+     * application like recv() does, this returns pointers to the samples
+     * within the transport's frame buffers. This saves a pass over the data,
+     * but is only possible if no conversion is required, i.e., if the CPU
+     * format equals the over-the-wire format (e.g., "sc16" for both).
+     *
+     * The buffers remain owned by the streamer. They are valid until they are
+     * returned with release_recv_buffs(), which must happen before the next
+     * call to recv() or get_recv_buffs(). The transport cannot reuse the
+     * frames in the meantime, so they should be released soon.
+     *
+     * The metadata is filled in as with recv() and one_packet set. If a
+     * previous call to recv() only returned part of a packet, this returns the
+     * remainder of that packet. The thread-safety rules of recv() apply to
+     * both calls.
+     *
+     * \param[out] buffs set to the samples, one pointer per channel
+     * \param[out] metadata data to fill describing the buffer
+     * \param timeout the timeout in seconds to wait for a packet
+     * \return the number of samples per channel, or 0 on error. No buffers
+     *         need to be released in that case.
+     * \throws uhd::not_implemented_error if the streamer does not support this,
+     *         uhd::runtime_error if the samples would need to be converted or
+     *         buffers are already borrowed
+     */
+    virtual size_t get_recv_buffs(
+        recv_buffs_type& buffs, rx_metadata_t& metadata, const double timeout = 0.1);
+
+    /*!
+     * Return the buffers borrowed with get_recv_buffs() to the streamer.
+     *
+     * Does nothing if no buffers are borrowed.
+     */
+    virtual void release_recv_buffs(void);
+
     /*!
      * Issue a stream command to the usrp device.
      * This tells the usrp to send samples into the host.
@@ -254,6 +542,47 @@ public:
      * \param stream_cmd the stream command to issue
      */
     virtual void issue_stream_cmd(const stream_cmd_t& stream_cmd) = 0;
+
+    /*!
+     * Get counters describing the activity of this streamer.
+     *
+     * Unlike recv(), this may be called from any thread. It is cheap enough to
+     * be called periodically while streaming.
+     *
+     * \return the counters, all zero if this streamer does not support them
+     */
+    virtual stream_telemetry_t get_telemetry(void) const;
+
+    /*!
+     * Get the host memory of this streamer and of the links of its channels.
+     *
+     * The links are connected when the streamer is, so call this after
+     * connecting all channels.
+     *
+     * \return the memory, with no links if this streamer does not support it
+     */
+    virtual stream_memory_t get_memory_footprint(void) const;
+
+    /*!
+     * Get a file descriptor which becomes readable when samples arrive.
+     *
+     * This lets one thread wait for many streamers, devices and other
+     * descriptors, e.g. with poll() or an event loop, and then call recv()
+     * with a timeout of zero. The descriptor is only cleared when recv() finds
+     * no data, so call recv() until it returns no samples before waiting on it
+     * again. It may be readable when no samples are waiting. With several
+     * channels, it is readable when any of them has data. The descriptor
+     * belongs to the streamer, and must not be read from or closed.
+     *
+     * RFNoC streamers provide it when they receive on an offload I/O service
+     * (device or stream argument recv_offload=1). Call it before streaming
+     * starts.
+     *
+     * \return the file descriptor
+     * \throws uhd::not_implemented_error if this streamer, its transport or the
+     *         platform does not provide one
+     */
+    virtual int get_recv_fd(void);
 };
 
 /*!
@@ -310,6 +639,134 @@ public:
         const tx_metadata_t& metadata,
         const double timeout = 0.1) = 0;
 
+    //! One buffer per channel to send with send_many(), e.g., one burst
+    struct send_burst_t
+    {
+        //! The buffers, one per channel
+        std::vector<const void*> buffs;
+        //! The number of samples to send, per buffer
+        size_t nsamps_per_buff = 0;
+        //! Data describing the buffers' contents, e.g., the burst flags and
+        //! the time of the burst
+        tx_metadata_t metadata;
+    };
+
+    /*!
+     * Send several sets of buffers in one call, each with its own metadata.
+     *
+     * This is the same as calling send() for each entry of \p bursts in
+     * turn, but the streamer is only checked once per call. Applications
+     * which send many short, timed bursts (e.g., pulsed radars) save the
+     * per-call overhead of send().
+     *
+     * Sending stops at the first entry which could not be sent completely,
+     * e.g., on a timeout. The thread-safety rules of send() apply.
+     *
+     * \param bursts the buffers to send, in order
+     * \param timeout the timeout in seconds to wait on a packet
+     * \return the number of entries of \p bursts which were sent completely
+     * \throws uhd::value_error if an entry doesn't have one buffer per channel
+     */
+    virtual size_t send_many(
+        const std::vector<send_burst_t>& bursts, const double timeout = 0.1);
+
+    //! Typedef for the pointers to the payloads of acquired packets, one per channel
+    typedef std::vector<void*> send_buffs_type;
+
+    /*!
+     * Acquire one packet per channel, for the application to write samples
+     * into directly.
+     *
+     * Instead of converting samples from buffers provided by the application
+     * like send() does, this returns pointers to the payloads of the
+     * transport's frame buffers. The application writes up to the returned
+     * number of samples per channel into them and then sends them with
+     * commit_send_buffs(). This saves a pass over the data, but is only
+     * possible if no conversion is required, i.e., if the CPU format equals
+     * the over-the-wire format (e.g., "sc16" for both).
+     *
+     * Where the payload starts depends on whether the packet carries a
+     * timestamp, so that must be known up front. The thread-safety rules of
+     * send() apply to both calls.
+     *
+     * \param[out] buffs set to the payloads, one pointer per channel
+     * \param has_time_spec true if the packets will have a time spec
+     * \param timeout the timeout in seconds to wait for frame buffers
+     * \return the maximum number of samples per channel, or 0 on timeout. No
+     *         buffers need to be committed in that case.
+     * \throws uhd::not_implemented_error if the streamer does not support this,
+     *         uhd::runtime_error if the samples would need to be converted or
+     *         buffers were already acquired
+     */
+    virtual size_t get_send_buffs(
+        send_buffs_type& buffs, const bool has_time_spec, const double timeout = 0.1);
+
+    /*!
+     * Send the packets acquired with get_send_buffs().
+     *
+     * \param nsamps_per_buff the number of samples written to each payload
+     * \param metadata data describing the packets. Its has_time_spec must
+     *        match what was passed to get_send_buffs(). End-of-vector
+     *        positions are not supported.
+     * \return the number of samples sent
+     * \throws uhd::runtime_error if no buffers were acquired, uhd::value_error
+     *         if \p nsamps_per_buff or \p metadata are invalid
+     */
+    virtual size_t commit_send_buffs(
+        const size_t nsamps_per_buff, const tx_metadata_t& metadata);
+
+    /*!
+     * Convert a waveform to the over-the-wire format once, for sending it
+     * repeatedly with send_waveform().
+     *
+     * The waveform is split into packets of the current maximum number of
+     * samples per packet, and every packet is converted like send() would.
+     * send_waveform() then only writes the packet headers and copies the
+     * converted samples, which saves the conversion on every repetition of
+     * the waveform, e.g., for continuous playback of a tone.
+     *
+     * The scaling of the streamer at the time of the call is applied. The
+     * streamer keeps the converted waveform until unregister_waveform().
+     *
+     * \param buffs the samples of the waveform, one buffer per channel
+     * \param nsamps_per_buff the number of samples per buffer
+     * eturn the ID of the waveform, for send_waveform()
+     * \throws uhd::not_implemented_error if the streamer does not support
+     *         this, uhd::value_error if there isn't one buffer per channel or
+     *         the waveform is empty
+     */
+    virtual size_t register_waveform(
+        const buffs_type& buffs, const size_t nsamps_per_buff);
+
+    /*!
+     * Release a waveform from register_waveform()
+     *
+     * \throws uhd::value_error if there is no such waveform
+     */
+    virtual void unregister_waveform(const size_t waveform_id);
+
+    /*!
+     * Send a waveform from register_waveform()
+     *
+     * This sends the whole waveform like send() would send its samples with
+     * \p metadata, i.e., a start of burst goes with the first packet, an end
+     * of burst with the last one, and the time spec is that of the first
+     * sample. End-of-vector positions are not supported. The thread-safety
+     * rules of send() apply.
+     *
+     * \param waveform_id the ID returned by register_waveform()
+     * \param metadata data describing the waveform
+     * \param timeout the timeout in seconds to wait on a packet
+     * eturn the number of samples sent, which is less than the length of
+     *         the waveform on a timeout
+     * \throws uhd::runtime_error if the maximum number of samples per packet
+     *         has become smaller since the waveform was registered,
+     *         uhd::value_error if there is no such waveform
+     */
+    virtual size_t send_waveform(const size_t waveform_id,
+        const tx_metadata_t& metadata,
+        const double timeout = 0.1);
+
     /*!
      * Receive an asynchronous message from this TX stream.
      * \param async_metadata the metadata to be filled in
@@ -318,6 +775,42 @@ public:
      */
     virtual bool recv_async_msg(
         async_metadata_t& async_metadata, double timeout = 0.1) = 0;
+
+    /*!
+     * Get a file descriptor which is readable while async messages are waiting.
+     *
+     * This lets an application wait for async messages together with other
+     * descriptors, e.g. with poll() or an event loop, and then read them with
+     * recv_async_msg() and a timeout of zero. The descriptor may be readable
+     * when no message is waiting; calling recv_async_msg() until it returns
+     * false clears it. The descriptor belongs to the streamer, and must not be
+     * read from or closed.
+     *
+     * \return the file descriptor
+     * \throws uhd::not_implemented_error if this streamer or platform does not
+     *         provide one
+     */
+    virtual int get_async_msg_fd(void);
+
+    /*!
+     * Get counters describing the activity of this streamer.
+     *
+     * Unlike send(), this may be called from any thread. It is cheap enough to
+     * be called periodically while streaming.
+     *
+     * \return the counters, all zero if this streamer does not support them
+     */
+    virtual stream_telemetry_t get_telemetry(void) const;
+
+    /*!
+     * Get the host memory of this streamer and of the links of its channels.
+     *
+     * This includes the waveforms which are registered at the time, so call it
+     * from the thread which registers them, after connecting all channels.
+     *
+     * \return the memory, with no links if this streamer does not support it
+     */
+    virtual stream_memory_t get_memory_footprint(void) const;
 };
 
 } // namespace uhd
@@ -9,6 +9,7 @@
 
 #include <uhd/config.hpp>
 #include <uhd/utils/noncopyable.hpp>
+#include <functional>
 #include <memory>
 
 namespace uhd { namespace transport {
@@ -30,10 +31,43 @@ public:
      * \param num_buffs the number of buffers to allocate
      * \param buff_size the size of each buffer in bytes
      * \param alignment the alignment boundary in bytes
+     * \param numa_node if not negative, place the memory on this NUMA node.
+     *        If that is not supported on this platform, the memory is
+     *        allocated as usual.
+     * \param use_hugepages if true, back the memory with hugepages (Linux
+     *        only). If no hugepages are available, regular pages are used.
      * \return a new buffer pool buff_size X num_buffs
      */
-    static sptr make(
-        const size_t num_buffs, const size_t buff_size, const size_t alignment = 16);
+    static sptr make(const size_t num_buffs,
+        const size_t buff_size,
+        const size_t alignment   = 16,
+        const int numa_node      = -1,
+        const bool use_hugepages = false);
+
+    //! Callback for the memory of a buffer pool, see set_memory_hooks()
+    typedef std::function<void(void* mem, size_t size)> memory_hook_t;
+
+    /*!
+     * Register callbacks which are notified of the memory of every buffer pool.
+     *
+     * \p on_alloc is called with the memory block of every buffer pool that is
+     * made after this call, and \p on_free right before that block is freed.
+     * The transports allocate their frame buffers from buffer pools, so
+     * applications which process the samples on a GPU or another accelerator
+     * can use these hooks to register the frame buffers with its driver (e.g.,
+     * page-lock them with cudaHostRegister() and cudaHostUnregister()). The
+     * samples returned by uhd::rx_streamer::get_recv_buffs() can then be
+     * copied to the device with DMA, straight out of the frame buffers.
+     *
+     * Both callbacks are called from the thread which creates (or destroys)
+     * the pool, and must not throw. A pool keeps the \p on_free that was set
+     * when it was made. Pass empty functions to remove the hooks.
+     *
+     * \param on_alloc called with the memory of each new buffer pool
+     * \param on_free called with the same arguments before it is freed
+     */
+    static void set_memory_hooks(
+        const memory_hook_t& on_alloc, const memory_hook_t& on_free);
 
     //! Get a pointer to the buffer start at the specified index
     virtual ptr_type at(const size_t index) const = 0;
@@ -21,6 +21,8 @@ struct UHD_API if_addrs_t
     std::string inet;
     std::string mask;
     std::string bcast;
+    //! Name of the interface, if the platform provides it (e.g., "eth0")
+    std::string ifname;
 };
 
 /*!
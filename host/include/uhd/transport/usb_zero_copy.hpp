@@ -28,8 +28,29 @@ class UHD_API usb_zero_copy : public virtual zero_copy_if
 public:
     typedef std::shared_ptr<usb_zero_copy> sptr;
 
+    //! State of the receive transfers (see get_recv_queue_stats())
+    struct queue_stats_t
+    {
+        //! Number of transfers which are submitted, and waiting for data
+        size_t in_flight = 0;
+        //! Number of completed transfers which get_recv_buff() did not return yet
+        size_t ready = 0;
+        //! Lowest value of in_flight since the transport was created
+        size_t min_in_flight = 0;
+    };
+
     ~usb_zero_copy(void) override;
 
+    /*!
+     * Get the state of the receive transfers
+     *
+     * The receive side keeps get_num_recv_frames() transfers in flight. If
+     * none are in flight, the host can't take any more data from the device.
+     * This may be called from any thread. Transports which don't keep track of
+     * their transfers return all zeros.
+     */
+    virtual queue_stats_t get_recv_queue_stats(void) const;
+
     /*!
      * Make a new zero copy USB transport:
      * This transport is for sending and receiving between the host
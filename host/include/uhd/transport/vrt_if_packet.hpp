@@ -169,6 +169,32 @@ UHD_API void if_hdr_pack_le(uint32_t* packet_buff, if_packet_info_t& if_packet_i
 UHD_API void if_hdr_unpack_le(
     const uint32_t* packet_buff, if_packet_info_t& if_packet_info);
 
+/*!
+ * Unpack a CHDR header to metadata (big endian format).
+ *
+ * This is equivalent to if_hdr_unpack_be() with `link_type` set to
+ * LINK_TYPE_CHDR (which it sets), but parses the header directly. It is meant
+ * for the receive paths which only ever see CHDR packets.
+ *
+ * See \ref vrt_unpack_contract.
+ *
+ * \param packet_buff memory to read the packed chdr header
+ * \param if_packet_info the if packet info (read/write)
+ */
+UHD_API void if_hdr_unpack_chdr_be(
+    const uint32_t* packet_buff, if_packet_info_t& if_packet_info);
+
+/*!
+ * Unpack a CHDR header to metadata (little endian format).
+ *
+ * See if_hdr_unpack_chdr_be() and \ref vrt_unpack_contract.
+ *
+ * \param packet_buff memory to read the packed chdr header
+ * \param if_packet_info the if packet info (read/write)
+ */
+UHD_API void if_hdr_unpack_chdr_le(
+    const uint32_t* packet_buff, if_packet_info_t& if_packet_info);
+
 UHD_INLINE if_packet_info_t::if_packet_info_t(void)
     : link_type(LINK_TYPE_NONE)
     , packet_type(PACKET_TYPE_DATA)
@@ -284,7 +284,9 @@ typedef enum {
     //! Packet loss within a burst.
     UHD_ASYNC_METADATA_EVENT_CODE_SEQ_ERROR_IN_BURST  = 0x20,
     //! Some kind of custom user payload.
-    UHD_ASYNC_METADATA_EVENT_CODE_USER_PAYLOAD        = 0x40
+    UHD_ASYNC_METADATA_EVENT_CODE_USER_PAYLOAD        = 0x40,
+    //! The streamer sent zeros because send() was late.
+    UHD_ASYNC_METADATA_EVENT_CODE_PADDING             = 0x80
 } uhd_async_metadata_event_code_t;
 
 //! Create a new async metadata handle
@@ -32,6 +32,11 @@ struct UHD_API rx_metadata_t
     {
         has_time_spec       = false;
         time_spec           = time_spec_t(0.0);
+        has_time_ticks      = false;
+        time_ticks          = 0;
+        tick_rate           = 1.0;
+        time_samps          = 0;
+        samp_rate           = 1.0;
         more_fragments      = false;
         fragment_offset     = 0;
         start_of_burst      = false;
@@ -41,6 +46,11 @@ struct UHD_API rx_metadata_t
         eov_positions_count = 0;
         error_code          = ERROR_CODE_NONE;
         out_of_sequence     = false;
+        has_gain_change     = false;
+        gain                = 0.0;
+        has_gap             = false;
+        gap_offset          = 0;
+        gap_length          = 0;
     }
 
     //! Has time specification?
@@ -49,6 +59,30 @@ struct UHD_API rx_metadata_t
     //! Time of the first sample.
     time_spec_t time_spec;
 
+    /*!
+     * Time of the first sample, in integer form:
+     * The first sample comes `time_samps` samples (at `samp_rate`) after the
+     * timestamp `time_ticks` (at `tick_rate`).
+     *
+     * These fields are only valid if has_time_spec and has_time_ticks are
+     * true. Streamers which fill them in can skip calculating `time_spec` for
+     * every packet (see the `lazy_time_spec` stream argument), so
+     * get_time_spec() is the accessor which works either way.
+     */
+    bool has_time_ticks;
+    uint64_t time_ticks;
+    double tick_rate;
+    uint64_t time_samps;
+    double samp_rate;
+
+    /*!
+     * Return the time of the first sample
+     *
+     * If the time is available in integer form, it is calculated from that.
+     * Otherwise, this returns `time_spec`.
+     */
+    time_spec_t get_time_spec() const;
+
     /*!
      * Fragmentation flag:
      * Similar to IPv4 fragmentation:
@@ -139,6 +173,29 @@ struct UHD_API rx_metadata_t
     //! of order.
     bool out_of_sequence;
 
+    /*!
+     * Gain change of the host AGC (see the `host_agc` stream argument):
+     * If has_gain_change is true, the first sample of this buffer is the first
+     * one which was received with the overall gain `gain` (in dB). The gain
+     * applies to all channels of the streamer, and stays the same until the
+     * next buffer with a gain change.
+     */
+    bool has_gain_change;
+    double gain;
+
+    /*!
+     * Gap in the stream (see the `gap_fill` stream argument):
+     * If has_gap is true, `gap_length` samples were dropped, e.g., by an
+     * overflow, right before sample `gap_offset` of this buffer. With
+     * `gap_fill=zeros`, the `gap_length` samples from `gap_offset` on are zeros
+     * which take the place of the dropped samples instead. The zeros of a long
+     * gap continue at the start of the next buffer, which then has a gap, too.
+     * A buffer holds at most one gap.
+     */
+    bool has_gap;
+    size_t gap_offset;
+    size_t gap_length;
+
     /*!
      * Convert a rx_metadata_t into a pretty print string.
      *
@@ -227,11 +284,17 @@ struct UHD_API async_metadata_t
         //! Packet loss within a burst.
         EVENT_CODE_SEQ_ERROR_IN_BURST = 0x20,
         //! Some kind of custom user payload
-        EVENT_CODE_USER_PAYLOAD = 0x40
+        EVENT_CODE_USER_PAYLOAD = 0x40,
+        //! The streamer sent zeros because send() was late (see the
+        //! `auto_padding` stream argument).
+        EVENT_CODE_PADDING = 0x80
     } event_code;
 
     /*!
      * A special payload populated by custom FPGA fabric.
+     *
+     * With EVENT_CODE_PADDING, `user_payload[0]` is the number of zeros which
+     * the streamer sent.
      */
     uint32_t user_payload[4];
 };
@@ -160,6 +160,21 @@ public:
      */
     virtual void write_spi(
         int which_slave, const spi_config_t& config, uint32_t data, size_t num_bits);
+
+    /*!
+     * Write several words to the SPI bus, one transaction per word.
+     * This is equivalent to calling write_spi() for every word, but an
+     * implementation may send all of them in one burst, and only wait for its
+     * bus once. The default implementation calls write_spi() for every word.
+     * \param which_slave the slave device number
+     * \param config spi config args
+     * \param data the words to write, in order
+     * \param num_bits how many bits in every word
+     */
+    virtual void multi_write_spi(int which_slave,
+        const spi_config_t& config,
+        const std::vector<uint32_t>& data,
+        size_t num_bits);
 };
 
 /*!
@@ -193,6 +193,23 @@ public:
     virtual void write_spi(
         unit_t unit, const spi_config_t& config, uint32_t data, size_t num_bits) = 0;
 
+    /*!
+     * Write several words to SPI bus peripheral, in order.
+     *
+     * The default implementation calls write_spi() for every word. Devices
+     * whose SPI core can queue the writes override it to send all words at
+     * once.
+     *
+     * \param unit which unit, rx or tx
+     * \param config configuration settings
+     * \param data the words to write, each MSB first
+     * \param num_bits the number of bits in every word
+     */
+    virtual void multi_write_spi(unit_t unit,
+        const spi_config_t& config,
+        const std::vector<uint32_t>& data,
+        size_t num_bits);
+
     /*!
      * Read and write data to SPI bus peripheral.
      *
@@ -37,11 +37,13 @@
 #include <uhd/types/tune_result.hpp>
 #include <uhd/types/wb_iface.hpp>
 #include <uhd/usrp/dboard_iface.hpp>
+#include <uhd/usrp/radio_profile.hpp>
 #include <uhd/usrp/subdev_spec.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <complex>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -112,6 +114,9 @@ public:
     //! A wildcard LO stage name
     static const std::string ALL_LOS;
 
+    //! A list of tune requests and the times at which they take effect
+    using freq_schedule_t = std::vector<std::pair<time_spec_t, tune_request_t>>;
+
     /*!
      * Make a new multi usrp from the device address.
      * \param dev_addr the device address
@@ -240,6 +245,24 @@ public:
      */
     virtual time_spec_t get_time_now(size_t mboard = 0) = 0;
 
+    /*!
+     * Get an estimate of the current time in the usrp time registers.
+     *
+     * Unlike get_time_now(), this reads the time registers only about once a
+     * second, and extrapolates the time with the host clock otherwise. This is
+     * much faster for applications which query the time often, e.g., to
+     * schedule timed commands. The error is at most half of a register
+     * readback round trip, plus the drift of the host clock against the
+     * device clock over one second (e.g., 50 us at 50 ppm). Use
+     * get_time_now() where the exact time matters.
+     *
+     * On devices which don't support estimates, this is get_time_now().
+     *
+     * \param mboard which motherboard to query
+     * eturn a timespec representing the estimated usrp time
+     */
+    virtual time_spec_t get_time_now_estimate(size_t mboard = 0) = 0;
+
     /*!
      * Get the time when the last pps pulse occurred.
      * \param mboard which motherboard to query
@@ -289,6 +312,11 @@ public:
      * - Step1: wait for the last pps time to transition to catch the edge
      * - Step2: set the time at the next pps (synchronous for all boards)
      *
+     * On RFNoC devices, the time is set on all motherboards in parallel, and
+     * the times latched at the next PPS edge are compared to verify the
+     * alignment (see get_time_last_pps_offsets()). A warning is logged for
+     * every motherboard which is not aligned.
+     *
      * \param time_spec the time to latch at the next pps after catching the edge
      */
     virtual void set_time_unknown_pps(const time_spec_t& time_spec) = 0;
@@ -301,6 +329,22 @@ public:
      */
     virtual bool get_time_synchronized(void) = 0;
 
+    /*!
+     * Measure the time offsets between the motherboards at the last PPS edge.
+     *
+     * This reads the time at the last PPS edge from every motherboard and
+     * compares it to the one of motherboard 0. Unlike get_time_synchronized(),
+     * the result does not depend on the round trip time of the control
+     * transactions, so after the times were set with set_time_next_pps() or
+     * set_time_unknown_pps(), all offsets are exactly zero. This requires all
+     * motherboards to share a PPS signal.
+     *
+     * \return the time at the last PPS edge of every motherboard, minus the
+     *         time at the last PPS edge of motherboard 0
+     * \throws uhd::runtime_error if PPS edges kept occurring during the readout
+     */
+    virtual std::vector<time_spec_t> get_time_last_pps_offsets(void) = 0;
+
     /*!
      * Set the time at which the control commands will take effect.
      *
@@ -321,6 +365,72 @@ public:
      */
     virtual void clear_command_time(size_t mboard = ALL_MBOARDS) = 0;
 
+    /*!
+     * Start a command batch on the calling thread.
+     *
+     * Until end_command_batch() is called, settings which are applied with
+     * register writes no longer wait for the device to acknowledge every
+     * write. This way, the timed commands for several channels and
+     * motherboards can be issued in one go, rather than one after the other:
+     *
+     * \code{.cpp}
+     * usrp->begin_command_batch();
+     * usrp->set_command_time(cmd_time);
+     * for (size_t chan = 0; chan < usrp->get_rx_num_channels(); chan++) {
+     *     usrp->set_rx_freq(freq, chan);
+     * }
+     * usrp->clear_command_time();
+     * usrp->end_command_batch();
+     * \endcode
+     *
+     * This only has an effect on RFNoC devices, see
+     * uhd::rfnoc::rfnoc_graph::begin_command_batch() for details. Batches
+     * may be nested.
+     */
+    virtual void begin_command_batch() = 0;
+
+    /*!
+     * End the command batch of the calling thread.
+     *
+     * Waits until all the commands since begin_command_batch() were
+     * acknowledged.
+     *
+     * \throws uhd::runtime_error if no batch was started, or the error of the
+     *         first command which failed
+     */
+    virtual void end_command_batch() = 0;
+
+    /*!
+     * Capture the configuration of all radio channels.
+     *
+     * The profile holds the rate, frequency, overall gain, antenna and
+     * bandwidth of every RX and TX channel. Settings which a device doesn't
+     * support are left unset. See uhd::usrp::radio_profile_t.
+     *
+     * \return the current configuration
+     */
+    virtual radio_profile_t capture_profile() = 0;
+
+    /*!
+     * Apply a configuration to the radio channels.
+     *
+     * Only the settings which differ from the current configuration are
+     * applied (see uhd::usrp::diff_radio_profiles()), so switching between
+     * modes which share most settings is fast. All settings are applied in one
+     * command batch (see begin_command_batch()). On RFNoC devices, the
+     * properties of the graph are also resolved once for all settings, rather
+     * than once per setting.
+     *
+     * \param profile the settings to apply, usually from capture_profile()
+     * \param cmd_time the time at which the settings take effect, or
+     *                 time_spec_t::ASAP to apply them right away. Settings
+     *                 which aren't applied with timed commands on a device
+     *                 take effect right away.
+     * \return the settings which were applied
+     */
+    virtual radio_profile_t apply_profile(const radio_profile_t& profile,
+        const time_spec_t& cmd_time = time_spec_t(time_spec_t::ASAP)) = 0;
+
     /*!
      * Issue a stream command to the usrp device.
      * This tells the usrp to send samples into the host.
@@ -562,6 +672,20 @@ public:
      */
     virtual std::vector<std::string> get_mboard_sensor_names(size_t mboard = 0) = 0;
 
+    /*!
+     * Get the values of all motherboard sensors.
+     *
+     * This is meant for monitoring applications which periodically poll all
+     * sensors. On devices which support it (e.g., MPM-based USRPs), all values
+     * are read with a single request, and the device serves them from a cache.
+     * They may thus be up to a second old. Other devices read out the sensors
+     * one by one, like get_mboard_sensor().
+     *
+     * \param mboard the motherboard index 0 to M-1
+     * \return a vector of sensor value objects
+     */
+    virtual std::vector<sensor_value_t> get_all_mboard_sensors(size_t mboard = 0) = 0;
+
     /*!
      * Perform write on the user configuration register bus. These only exist if
      * the user has implemented custom setting registers in the device FPGA.
@@ -730,6 +854,29 @@ public:
     virtual tune_result_t set_rx_freq(
         const tune_request_t& tune_request, size_t chan = 0) = 0;
 
+    /*! Queue a series of timed RX frequency changes, e.g., for frequency hopping.
+     *
+     * This has the same effect as calling set_command_time(), set_rx_freq(),
+     * and clear_command_time() for every entry of \p schedule, but with less
+     * overhead per tune: The tunable frequency ranges of the channel are only
+     * looked up once (unless the args of the tune requests change between
+     * entries), and the command time is only changed on the blocks that make up
+     * this channel.
+     *
+     * Timed commands back-pressure all subsequent timed commands. If the
+     * schedule is longer than the device's command queue, this call will block
+     * until enough of the earlier frequency changes have taken effect. When it
+     * returns, the command time of the channel is cleared.
+     *
+     * \param schedule pairs of command time and tune request. The times must
+     *                 not decrease.
+     * \param chan the channel index 0 to N-1
+     * \return a tune result object for every entry of \p schedule
+     * \throws uhd::value_error if the times in \p schedule are not sorted
+     */
+    virtual std::vector<tune_result_t> set_rx_freq_schedule(
+        const freq_schedule_t& schedule, size_t chan = 0) = 0;
+
     /*!
      * Get the RX center frequency.
      * \param chan the channel index 0 to N-1
@@ -1446,6 +1593,19 @@ public:
     virtual tune_result_t set_tx_freq(
         const tune_request_t& tune_request, size_t chan = 0) = 0;
 
+    /*! Queue a series of timed TX frequency changes, e.g., for frequency hopping.
+     *
+     * This is the TX equivalent of set_rx_freq_schedule().
+     *
+     * \param schedule pairs of command time and tune request. The times must
+     *                 not decrease.
+     * \param chan the channel index 0 to N-1
+     * \return a tune result object for every entry of \p schedule
+     * \throws uhd::value_error if the times in \p schedule are not sorted
+     */
+    virtual std::vector<tune_result_t> set_tx_freq_schedule(
+        const freq_schedule_t& schedule, size_t chan = 0) = 0;
+
     /*!
      * Get the TX center frequency.
      * \param chan the channel index 0 to N-1
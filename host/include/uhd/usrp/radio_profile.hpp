@@ -0,0 +1,74 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace uhd { namespace usrp {
+
+/*! The configuration of the radio channels of a multi_usrp
+ *
+ * A profile holds the settings of an operational mode, so switching between
+ * modes is one call to multi_usrp::apply_profile() instead of one call per
+ * setting and channel. Profiles are usually captured from a configured device
+ * with multi_usrp::capture_profile():
+ *
+ * \code{.cpp}
+ * usrp->set_rx_rate(rate_a);
+ * usrp->set_rx_freq(freq_a);
+ * const auto mode_a = usrp->capture_profile();
+ * // ... configure and capture mode_b the same way
+ * usrp->apply_profile(mode_a, usrp->get_time_now() + 0.1);
+ * \endcode
+ *
+ * Settings which are not set in a profile are left alone when it is applied,
+ * so profiles may also be written by hand, or be limited to some channels.
+ */
+struct UHD_API radio_profile_t
+{
+    //! The settings of one channel
+    struct chan_settings_t
+    {
+        //! Sample rate in samples per second
+        boost::optional<double> rate;
+        //! Center frequency in Hz, including the DSP tuning
+        boost::optional<double> freq;
+        //! Overall gain in dB
+        boost::optional<double> gain;
+        boost::optional<std::string> antenna;
+        //! Analog frontend filter bandwidth in Hz
+        boost::optional<double> bandwidth;
+
+        //! Return true if none of the settings are set
+        bool empty() const;
+    };
+
+    //! The settings of the RX channels, by channel index
+    std::map<size_t, chan_settings_t> rx;
+    //! The settings of the TX channels, by channel index
+    std::map<size_t, chan_settings_t> tx;
+
+    //! Return true if no channel has any settings
+    bool empty() const;
+};
+
+/*! Return the settings of \p profile which differ from those of \p current
+ *
+ * Channels without any differing settings are left out. Settings which are not
+ * set in \p profile never differ, and those which are only set in \p profile
+ * always do. Frequencies, rates and bandwidths which differ by less than a
+ * millihertz, and gains which differ by less than a millidecibel, are
+ * considered equal, so rounding errors don't make settings differ.
+ */
+UHD_API radio_profile_t diff_radio_profiles(
+    const radio_profile_t& current, const radio_profile_t& profile);
+
+}} // namespace uhd::usrp
@@ -0,0 +1,117 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/cal/pwr_cal.hpp>
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/usrp/multi_usrp.hpp>
+#include <complex>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace usrp {
+
+/*! Return the power of fc32 samples in dBFS
+ *
+ * Like uhd.dsp.signals.get_power_dbfs() in Python, this is the variance of the
+ * samples, i.e., DC does not count, and a sinusoid with an amplitude of 1.0
+ * has a power of 0 dBFS. On CPUs with AVX2, the sums are computed with SIMD
+ * instructions.
+ */
+UHD_API double get_power_dbfs(const std::complex<float>* samps, const size_t num_samps);
+
+/*! Measure the RX power of a channel across frequencies and gains
+ *
+ * This is the engine behind the RX measurements of uhd_power_cal.py. Instead
+ * of tuning, setting the gain and streaming one step at a time, a sweep
+ * schedules every step with timed commands:
+ * - At every frequency, the tune is a timed command, and the first capture
+ *   starts after the tune settling time, counted on the device clock.
+ * - Every gain step changes the gain right after the previous capture ends,
+ *   and captures once the gain settling time has passed. The next step is
+ *   scheduled before the current capture is received, so the device settles
+ *   and captures while the host receives and measures the previous step.
+ *
+ * The streamer must stream the measured channel only, with the fc32 CPU
+ * format, and nothing else may stream from it during a sweep.
+ */
+class UHD_API rx_power_sweep
+{
+public:
+    using sptr = std::shared_ptr<rx_power_sweep>;
+
+    //! Measured powers in dBFS, results[freq][gain] = power
+    using results_t = std::map<double, std::map<double, double>>;
+
+    virtual ~rx_power_sweep() = default;
+
+    //! Set the number of samples per measurement (default: 1e6)
+    virtual void set_num_samps(const size_t num_samps) = 0;
+
+    //! Return the number of samples per measurement
+    virtual size_t get_num_samps() const = 0;
+
+    //! Set the time from a tune to the first capture, in seconds (default: 0.1)
+    virtual void set_tune_settling_time(const double settling_time) = 0;
+
+    //! Return the time from a tune to the first capture, in seconds
+    virtual double get_tune_settling_time() const = 0;
+
+    //! Set the time from a gain change to its capture, in seconds (default: 0.1)
+    virtual void set_gain_settling_time(const double settling_time) = 0;
+
+    //! Return the time from a gain change to its capture, in seconds
+    virtual double get_gain_settling_time() const = 0;
+
+    /*! Measure the power at the current frequency and gain
+     *
+     * This is equivalent to get_usrp_power() of uhd_power_cal.py, i.e., the
+     * capture starts right away.
+     *
+     * \returns the power in dBFS
+     * \throws uhd::runtime_error if the samples can't be received
+     */
+    virtual double measure() = 0;
+
+    /*! Measure the power at every frequency and gain
+     *
+     * The gains are set in the given order at every frequency. Afterwards, the
+     * channel is tuned to the last frequency, with the last gain.
+     *
+     * \param freqs The frequencies to tune to, in Hz
+     * \param gains The overall RX gains to measure every frequency at, in dB
+     * \returns the powers in dBFS
+     * \throws uhd::runtime_error if the samples can't be received
+     */
+    virtual results_t run(
+        const std::vector<double>& freqs, const std::vector<double>& gains) = 0;
+
+    /*! Add power tables to a power cal container
+     *
+     * Every frequency of \p results becomes one power table, whose power
+     * limits are the smallest and the greatest power at this frequency.
+     *
+     * \param cal The container to add the tables to
+     * \param results A mapping freq -> gain -> power (Hz -> dB -> dBm)
+     */
+    static void add_power_tables(
+        uhd::usrp::cal::pwr_cal::sptr cal, const results_t& results);
+
+    /*! Create a sweep
+     *
+     * \param usrp The device
+     * \param streamer An RX streamer of channel \p chan of \p usrp
+     * \param chan The channel to measure
+     */
+    static sptr make(
+        multi_usrp::sptr usrp, uhd::rx_streamer::sptr streamer, const size_t chan = 0);
+};
+
+}} // namespace uhd::usrp
@@ -162,6 +162,54 @@ UHD_API uhd_error uhd_rx_streamer_recv(
     size_t *items_recvd
 );
 
+//! Receive buffers containing samples, without updating the error strings
+/*!
+ * Same as uhd_rx_streamer_recv(), but the error strings of the streamer and
+ * the global error string are only written if the call fails. On success,
+ * uhd_rx_streamer_last_error() still returns the error of the last failed
+ * call. Use this in receive loops with small buffers, where updating the
+ * error strings on every call is a noticeable part of the time per call.
+ */
+UHD_API uhd_error uhd_rx_streamer_recv_fast(
+    uhd_rx_streamer_handle h,
+    void** buffs,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle *md,
+    double timeout,
+    bool one_packet,
+    size_t *items_recvd
+);
+
+//! Receive several buffers per channel in one call
+/*!
+ * Calls uhd::rx_streamer::recv() once per buffer, like
+ * uhd_rx_streamer_recv_fast() does. The pointers to the buffers are
+ * stored buffer by buffer, i.e., buffer i of channel c is
+ * buffs[i * num_channels + c]. Receiving stops early after a buffer which is
+ * not full, whose metadata has an error code, or which ends a burst.
+ *
+ * \param h RX streamer handle
+ * \param buffs num_buffs * num_channels pointers to buffers
+ * \param num_buffs number of buffers per channel
+ * \param samps_per_buff max number of samples per buffer
+ * \param md array of num_buffs RX metadata handles, one per buffer
+ * \param timeout timeout in seconds to wait for a packet, per buffer
+ * \param items_recvd array of num_buffs output variables for the number of
+ *                    samples received into each buffer
+ * \param num_buffs_recvd pointer to output variable for the number of
+ *                        buffers which were received into
+ */
+UHD_API uhd_error uhd_rx_streamer_recv_batch(
+    uhd_rx_streamer_handle h,
+    void** buffs,
+    size_t num_buffs,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle *md,
+    double timeout,
+    size_t *items_recvd,
+    size_t *num_buffs_recvd
+);
+
 //! Issue the given stream command
 /*!
  * See uhd::rx_streamer::issue_stream_cmd() for more details.
@@ -240,6 +288,20 @@ UHD_API uhd_error uhd_tx_streamer_send(
     size_t *items_sent
 );
 
+//! Send buffers containing samples, without updating the error strings
+/*!
+ * Same as uhd_tx_streamer_send(), but the error strings are only written if
+ * the call fails, see uhd_rx_streamer_recv_fast().
+ */
+UHD_API uhd_error uhd_tx_streamer_send_fast(
+    uhd_tx_streamer_handle h,
+    const void **buffs,
+    size_t samps_per_buff,
+    uhd_tx_metadata_handle *md,
+    double timeout,
+    size_t *items_sent
+);
+
 //! Receive an asynchronous message from this streamer
 /*!
  * See uhd::tx_streamer::recv_async_msg() for more details.
@@ -0,0 +1,151 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/rfnoc/rfnoc_types.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace utils { namespace chdr {
+
+/*! Streams CHDR data packets through a UDP socket at high rates
+ *
+ * The device simulator in MPM handles every packet in Python, which limits
+ * its streams to a few MB/s. To load test the host, the simulator hands its
+ * CHDR socket to a chdr_stream_engine instead, and keeps handling the control
+ * plane in Python.
+ *
+ * The engine receives all packets on its own thread. Data and stream command
+ * packets to input streams, and stream status packets to output streams, are
+ * handled by the engine, with the same flow control as the stream endpoints
+ * of a device. All other packets are queued for the control plane, which
+ * reads them with recv_control(), and sends its responses through the socket
+ * itself.
+ *
+ * Output streams are generated by the engine, on one thread per stream. Their
+ * payload is all zeros. The received samples of input streams are counted and
+ * discarded.
+ *
+ * The socket uses the little-endian CHDR format of the UDP transports of MPM
+ * devices. Only available on platforms with sendmmsg() and recvmmsg().
+ */
+class UHD_API chdr_stream_engine
+{
+public:
+    using sptr = std::shared_ptr<chdr_stream_engine>;
+
+    //! A packet for the control plane
+    struct control_packet_t
+    {
+        std::vector<uint8_t> data;
+        //! The IPv4 address of the sender
+        std::string addr;
+        uint16_t port = 0;
+    };
+
+    //! The configuration of an output stream
+    struct output_args_t
+    {
+        uint16_t src_epid = 0;
+        uint16_t dst_epid = 0;
+        //! The IPv4 address and port to send the packets to
+        std::string addr;
+        uint16_t port = 0;
+        //! The number of samples per packet
+        size_t packet_samples = 0;
+        //! The size of a sample in bytes (4 for sc16)
+        size_t bytes_per_sample = 4;
+        //! The rate to pace the packets with, or 0 to send as fast as flow
+        //! control allows
+        double sample_rate = 0.0;
+        //! The number of samples to send, or 0 to stream until end_output()
+        uint64_t num_samples = 0;
+        //! If true, every packet has a timestamp, which counts samples from
+        //! \p timestamp on
+        bool has_timestamp = false;
+        uint64_t timestamp = 0;
+        //! The buffer capacity of the destination, from its initial stream status
+        uint64_t capacity_packets = 0;
+        uint64_t capacity_bytes = 0;
+    };
+
+    //! The counters of a stream
+    struct stream_stats_t
+    {
+        //! False once an output stream sent all its samples or was ended
+        bool active = false;
+        uint64_t num_packets = 0;
+        uint64_t num_bytes = 0;
+        //! The number of data packets an input stream received out of sequence
+        uint64_t num_seq_errors = 0;
+        //! The number of times an output stream waited for flow control credit
+        uint64_t num_fc_stalls = 0;
+    };
+
+    virtual ~chdr_stream_engine() = default;
+
+    /*! Wait for the next packet which the engine does not handle
+     *
+     * \param[out] packet The packet
+     * \param timeout The timeout in seconds
+     * \returns false on a timeout
+     */
+    virtual bool recv_control(control_packet_t& packet, const double timeout) = 0;
+
+    /*! Handle the data and stream commands to an endpoint in the engine
+     *
+     * An input stream that was started before on the same endpoint is
+     * replaced.
+     *
+     * \param epid The endpoint ID of the input stream
+     * \param capacity_bytes The buffer capacity reported to the sender
+     */
+    virtual void begin_input(const uint16_t epid, const uint64_t capacity_bytes) = 0;
+
+    //! Stop handling the packets to an endpoint. Does nothing if it has no input.
+    virtual void end_input(const uint16_t epid) = 0;
+
+    /*! Return the counters of the input stream of an endpoint
+     *
+     * \throws uhd::key_error if no input stream was started on the endpoint
+     */
+    virtual stream_stats_t get_input_stats(const uint16_t epid) const = 0;
+
+    /*! Start generating an output stream
+     *
+     * An output stream that was started before from the same endpoint is
+     * ended first.
+     *
+     * \throws uhd::value_error on invalid arguments
+     */
+    virtual void begin_output(const output_args_t& args) = 0;
+
+    //! Stop the output stream of an endpoint. Does nothing if it has none.
+    virtual void end_output(const uint16_t src_epid) = 0;
+
+    /*! Return the counters of the output stream of an endpoint
+     *
+     * \throws uhd::key_error if no output stream was started from the endpoint
+     */
+    virtual stream_stats_t get_output_stats(const uint16_t src_epid) const = 0;
+
+    /*! Create an engine which receives from and sends through a socket
+     *
+     * The engine does not take ownership of the socket, which must stay open
+     * until the engine is destroyed, and must not be read by anyone else.
+     *
+     * \param socket_fd The file descriptor of a bound UDP socket
+     * \param chdr_w The CHDR width of the simulated device
+     * \throws uhd::not_implemented_error without sendmmsg() and recvmmsg()
+     */
+    static sptr make(const int socket_fd, const uhd::rfnoc::chdr_w_t chdr_w);
+};
+
+}}} // namespace uhd::utils::chdr
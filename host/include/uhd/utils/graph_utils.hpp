@@ -10,9 +10,12 @@
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <uhd/rfnoc/graph_edge.hpp>
+#include <uhd/rfnoc/replay_block_control.hpp>
 #include <uhd/rfnoc_graph.hpp>
 #include <boost/none.hpp>
 #include <boost/optional.hpp>
+#include <functional>
+#include <string>
 #include <vector>
 
 
@@ -77,4 +80,98 @@ std::vector<graph_edge_t> UHD_API connect_through_blocks(rfnoc_graph::sptr graph
     const size_t dst_port,
     const bool skip_property_propagation = false);
 
+/*! Load a file into the memory of a Replay block, as fast as the links allow
+ *
+ * The file is split into one contiguous part for every port in \p ports, and
+ * all parts are streamed to their input port of the Replay block at the same
+ * time, one thread per port. The parts are recorded back to back, so the file
+ * ends up in one contiguous region of the Replay memory, starting at
+ * \p mem_offset. It can then be played back from any port with
+ * uhd::rfnoc::replay_block_control::play().
+ *
+ * The file must contain raw items in the format \p format, which is used both
+ * on the host and on the wire, so the data is recorded as it is.
+ *
+ * This function connects a streamer to every requested input port (and, when
+ * verifying, to every requested output port), and commits the graph. These
+ * ports must not be connected to anything else. The streamers are disconnected
+ * again before this function returns.
+ *
+ *  \param graph The rfnoc_graph that contains the Replay block
+ *  \param replay The Replay block to load the file into
+ *  \param filename The file to load
+ *  \param mem_offset Memory offset in bytes at which the file is stored. Must
+ *                    be a multiple of the memory word size.
+ *  \param ports The ports of the Replay block to use for loading
+ *  \param verify If true, play back the data after loading it, and compare it
+ *                to the contents of the file
+ *  \param format The format of the items in the file (e.g., "sc16")
+ *
+ *  \throws uhd::io_error if the file can't be read
+ *  \throws uhd::value_error if the file is empty, its size is not a multiple
+ *          of the memory word size, or it does not fit into the memory
+ *  \throws uhd::runtime_error if the recording does not complete, or if the
+ *          data read back does not match the file
+ */
+void UHD_API replay_load_file(rfnoc_graph::sptr graph,
+    replay_block_control::sptr replay,
+    const std::string& filename,
+    const uint64_t mem_offset        = 0,
+    const std::vector<size_t>& ports = {0},
+    const bool verify                = false,
+    const std::string& format        = IO_TYPE_SC16);
+
+/*! Capture a stream into a file, using the memory of a Replay block as a buffer
+ *
+ * The data arriving on input port \p port of the Replay block (e.g., from a
+ * radio) is recorded into a ring of \p mem_size bytes, starting at
+ * \p mem_offset. The ring is split into two halves. Once a half is full, it is
+ * played back through output port \p port, and written straight to the file,
+ * while the other half keeps filling up. When both halves are full, the
+ * recording is restarted at the beginning of the ring.
+ *
+ * Captures which fit into the ring can be arbitrarily fast, since the link to
+ * the host is only used once the data is in the Replay memory. For longer
+ * captures, writing one half to the file must take no longer than filling the
+ * other one, i.e., the average rate must not exceed what the link and the disk
+ * sustain. Otherwise, the recording stalls and the source back-pressures
+ * (a radio would overrun).
+ *
+ * The input port must already be connected to the source, and the graph must
+ * be committed. This function connects a streamer to the output port, which
+ * must not be connected to anything else, and commits the graph again. It then
+ * arms the recording, and calls \p start_source, which is where the source must
+ * be started (e.g., by issuing a stream command to the radio). Stopping the
+ * source again is up to the caller, once this function returns.
+ *
+ *  \param graph The rfnoc_graph that contains the Replay block
+ *  \param replay The Replay block to capture through
+ *  \param filename The file to write. An existing file is overwritten.
+ *  \param num_bytes The number of bytes to capture. Must be a multiple of the
+ *                   memory word size.
+ *  \param start_source Called once the recording is armed, to start the source
+ *  \param port The port of the Replay block to use, both for recording and for
+ *              playing back
+ *  \param mem_offset Memory offset in bytes of the ring. Must be a multiple of
+ *                    the memory word size.
+ *  \param mem_size Size of the ring in bytes. 0 means all of the memory from
+ *                  \p mem_offset on.
+ *  \param format The format of the items in the file (e.g., "sc16"). This must
+ *                be the format which is recorded.
+ *
+ *  \throws uhd::io_error if the file can't be written
+ *  \throws uhd::value_error if the sizes or the offset are not multiples of
+ *          the memory word size, or the ring does not fit into the memory
+ *  \throws uhd::runtime_error if the recording or the playback stall
+ */
+void UHD_API replay_capture_to_file(rfnoc_graph::sptr graph,
+    replay_block_control::sptr replay,
+    const std::string& filename,
+    const uint64_t num_bytes,
+    const std::function<void()>& start_source,
+    const size_t port         = 0,
+    const uint64_t mem_offset = 0,
+    const uint64_t mem_size   = 0,
+    const std::string& format = IO_TYPE_SC16);
+
 }} // namespace uhd::rfnoc
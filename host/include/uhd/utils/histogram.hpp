@@ -0,0 +1,61 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace metrics {
+
+/*! A histogram with fixed bucket bounds
+ *
+ * observe() only updates atomic counters, so it can be called from any
+ * thread, including the streaming and control paths, without taking a lock.
+ */
+class UHD_API histogram
+{
+public:
+    using sptr = std::shared_ptr<histogram>;
+
+    //! A consistent-enough copy of the counters of a histogram
+    struct snapshot_t
+    {
+        //! The upper bounds of the buckets, excluding the +Inf bucket
+        std::vector<double> bounds;
+        //! The number of observations per bucket, including the +Inf bucket.
+        // These are not cumulative.
+        std::vector<uint64_t> counts;
+        //! The sum of all observed values
+        double sum = 0.0;
+    };
+
+    /*! Create a histogram
+     *
+     * \param bounds The upper bounds of the buckets, in ascending order
+     * \throws uhd::value_error if \p bounds is empty or not strictly ascending
+     */
+    explicit histogram(const std::vector<double>& bounds);
+
+    //! Add an observation of \p value
+    void observe(const double value);
+
+    //! Return the current counters
+    snapshot_t get_snapshot() const;
+
+private:
+    const std::vector<double> _bounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> _counts;
+    std::atomic<double> _sum;
+};
+
+//! Return the bucket bounds used for control transaction latencies, in seconds
+UHD_API std::vector<double> get_ctrl_latency_bounds();
+
+}} // namespace uhd::metrics
@@ -0,0 +1,93 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*! Lossless compression of sc16 recordings
+ *
+ * The samples are compressed in frames, which are independent of each other,
+ * so a file of back-to-back frames can be decompressed in parts. Inside a
+ * frame, every 64 samples form a block. Each block is stored either as is or
+ * as the differences to the previous sample of the same component (I or Q),
+ * whichever is smaller, and its values are packed with the number of bits
+ * its largest value needs. Noise-dominated signals thus shrink by the high
+ * bits which their levels leave unused, oversampled signals by more.
+ *
+ * Any data is restored exactly, but only sc16 samples in host byte order
+ * compress. Bytes at the end of a frame which don't fill a block are stored
+ * as they are.
+ */
+namespace uhd { namespace iq_codec {
+
+//! The size of the header of a frame, in bytes
+constexpr size_t FRAME_HEADER_SIZE = 24;
+
+//! The header of a frame
+struct frame_info_t
+{
+    //! The size of the frame, including its header and padding, in bytes
+    uint64_t frame_size = 0;
+    //! The size of the samples in the frame, in bytes
+    uint64_t num_bytes = 0;
+};
+
+/*! Return the largest size of a frame which holds \p num_bytes of samples,
+ *  without padding
+ */
+UHD_API size_t get_max_frame_size(const size_t num_bytes);
+
+/*! Compress samples into one frame
+ *
+ * \param samples The samples
+ * \param num_bytes The size of the samples, in bytes
+ * \param frame Receives the frame. It must hold get_max_frame_size(), rounded
+ *              up to a multiple of \p alignment.
+ * \param alignment The frame is padded with zeros to a multiple of this size,
+ *                  e.g., for files which are written with O_DIRECT
+ * \returns The size of the frame, including the padding
+ */
+UHD_API size_t compress(const void* samples,
+    const size_t num_bytes,
+    void* frame,
+    const size_t alignment = 1);
+
+/*! Read the header of a frame
+ *
+ * \param frame The frame
+ * \param size The number of bytes available at \p frame, at least
+ *             FRAME_HEADER_SIZE
+ * \throws uhd::value_error if \p frame doesn't start with a frame header
+ */
+UHD_API frame_info_t get_frame_info(const void* frame, const size_t size);
+
+/*! Decompress one frame
+ *
+ * \param frame The frame
+ * \param size The number of bytes available at \p frame, at least the frame
+ *             size
+ * \param samples Receives the samples. It must hold frame_info_t::num_bytes.
+ * \returns The size of the samples, in bytes
+ * \throws uhd::value_error if the frame is truncated or corrupt
+ */
+UHD_API size_t decompress(const void* frame, const size_t size, void* samples);
+
+/*! Decompress a file of back-to-back frames, e.g., one written by a
+ *  sample_recorder with compression
+ *
+ * \param in_path The compressed file
+ * \param out_path The file to write the samples to
+ * \returns The size of the samples, in bytes
+ * \throws uhd::io_error if a file can't be read or written
+ * \throws uhd::value_error if the compressed file is truncated or corrupt
+ */
+UHD_API uint64_t decompress_file(const std::string& in_path, const std::string& out_path);
+
+}} // namespace uhd::iq_codec
@@ -0,0 +1,108 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/utils/histogram.hpp>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+namespace usrp {
+class multi_usrp;
+}
+
+namespace metrics {
+
+//! Labels of a metric, e.g. {{"device", "x310_a"}, {"chan", "0"}}
+using labels_t = std::map<std::string, std::string>;
+
+/*! Return the histogram of control transaction latencies, in seconds
+ *
+ * Every RFNoC control transaction which waits for an ACK adds the time from
+ * sending the request to receiving its response. The histogram is shared by
+ * all devices in the process.
+ */
+UHD_API histogram::sptr get_ctrl_latency_histogram();
+
+/*! Collects metrics and renders them in the OpenMetrics text format
+ *
+ * UHD does not serve the metrics itself. An application which is scraped by
+ * Prometheus registers its streamers and devices, and returns the output of
+ * scrape() from its own HTTP endpoint:
+ *
+ * \code{.cpp}
+ * auto exporter = uhd::metrics::exporter::make();
+ * exporter->add_usrp(usrp, {{"device", "radio_a"}});
+ * exporter->add_rx_streamer(rx_stream, {{"device", "radio_a"}});
+ * // In the handler for GET /metrics:
+ * return exporter->scrape();
+ * \endcode
+ *
+ * The streamer metrics come from uhd::stream_telemetry_t, so rates such as the
+ * link throughput follow from the packet and sample counters (e.g. with
+ * Prometheus' rate()). On TX, uhd_tx_buffer_wait_seconds_total includes the
+ * time send() was stalled waiting for flow control credits. The control
+ * latency histogram (see get_ctrl_latency_histogram()) is always exported.
+ *
+ * Streamers and devices are held by weak pointers, and dropped from the
+ * output once they are destroyed. All methods are thread-safe.
+ */
+class UHD_API exporter
+{
+public:
+    using sptr     = std::shared_ptr<exporter>;
+    using gauge_fn = std::function<double(void)>;
+
+    virtual ~exporter() = default;
+
+    //! Export the telemetry of \p streamer, with the given labels
+    virtual void add_rx_streamer(
+        rx_streamer::sptr streamer, const labels_t& labels = labels_t()) = 0;
+
+    //! Export the telemetry of \p streamer, with the given labels
+    virtual void add_tx_streamer(
+        tx_streamer::sptr streamer, const labels_t& labels = labels_t()) = 0;
+
+    /*! Export the temperature sensors of \p usrp
+     *
+     * All motherboard, RX and TX sensors whose names contain "temp" are
+     * exported as uhd_temperature_celsius, with an mboard or a direction and
+     * chan label, and a sensor label. The sensor names are read once, when
+     * this is called. Sensors which fail to read during a scrape are skipped.
+     */
+    virtual void add_usrp(std::shared_ptr<uhd::usrp::multi_usrp> usrp,
+        const labels_t& labels = labels_t()) = 0;
+
+    /*! Export the return value of \p fn as a gauge
+     *
+     * \p fn is called on every scrape, and must not block.
+     */
+    virtual void add_gauge(const std::string& name,
+        const std::string& help,
+        gauge_fn fn,
+        const labels_t& labels = labels_t()) = 0;
+
+    //! Export \p hist as a histogram
+    virtual void add_histogram(const std::string& name,
+        const std::string& help,
+        histogram::sptr hist,
+        const labels_t& labels = labels_t()) = 0;
+
+    //! Return all metrics in the OpenMetrics text format
+    virtual std::string scrape() const = 0;
+
+    //! Create an exporter
+    static sptr make();
+};
+
+}} // namespace uhd::metrics
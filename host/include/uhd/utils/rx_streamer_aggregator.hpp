@@ -0,0 +1,77 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/types/metadata.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! Receives from several RX streamers at once, and aligns their samples
+ *
+ * An RX streamer aligns the channels it streams itself, but applications
+ * which receive from several devices, or through several streamers, have to
+ * align the samples by their time stamps manually. The aggregator is an RX
+ * streamer which does that: Its channels are the channels of all streamers,
+ * in the order the streamers were given, and every recv() returns the same
+ * stretch of time on all of them.
+ *
+ * Every streamer is received from on its own thread, so the receives are not
+ * serialized, and the streamers may use different devices and I/O services.
+ * The threads receive one packet at a time into buffers of the aggregator,
+ * from which recv() copies the aligned samples.
+ *
+ * At the start of a burst, and after an overflow or a gap in the samples of
+ * any streamer, the aggregator drops samples until all streamers are aligned
+ * again. Errors are reported through the metadata of recv() as with any
+ * streamer, and per streamer through get_streamer_metadata(). All streamers
+ * need to run at the same sample rate, from synchronized devices.
+ *
+ * \code{.cpp}
+ * auto rx_stream = uhd::rx_streamer_aggregator::make(
+ *     {usrp0->get_rx_stream(stream_args), usrp1->get_rx_stream(stream_args)},
+ *     stream_args.cpu_format,
+ *     rate);
+ * rx_stream->issue_stream_cmd(stream_cmd); // Timed, to all streamers
+ * rx_stream->recv(buffs, num_samps, md); // buffs has a buffer per channel
+ * \endcode
+ *
+ * As with other streamers, recv() must only be called from one thread.
+ */
+class UHD_API rx_streamer_aggregator : public rx_streamer
+{
+public:
+    using sptr = std::shared_ptr<rx_streamer_aggregator>;
+
+    /*! Return the metadata of every streamer from the last call to recv()
+     *
+     * Use this to find out which streamer an error came from. A gap in the
+     * time stamps of a streamer is reported as ERROR_CODE_OVERFLOW with
+     * out_of_sequence set. Call this from the thread which calls recv().
+     *
+     * \returns one entry per streamer, in the order they were given to make()
+     */
+    virtual std::vector<rx_metadata_t> get_streamer_metadata() const = 0;
+
+    /*! Create an aggregator
+     *
+     * \param streamers The streamers to receive from
+     * \param cpu_format The CPU format of the streamers (e.g., "fc32")
+     * \param rate The sample rate of all streamers in samples per second
+     * \throws uhd::value_error if there are no streamers, or the rate is not
+     *         positive
+     */
+    static sptr make(const std::vector<rx_streamer::sptr>& streamers,
+        const std::string& cpu_format,
+        const double rate);
+};
+
+} // namespace uhd
@@ -0,0 +1,102 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace uhd {
+
+/*! Reads samples from a file, for passing them straight to send()
+ *
+ * Where the platform supports it, the file is memory-mapped, and the kernel is
+ * asked to read ahead of the current position. get_read_buff() then returns
+ * pointers into the mapping, so the samples are neither read into nor copied
+ * out of an intermediate buffer:
+ *
+ * \code{.cpp}
+ * auto player = uhd::sample_player::make("samples.dat", sizeof(std::complex<short>));
+ * player->set_loop(true);
+ * const void* buff;
+ * while (!done) {
+ *     const size_t num_samps = player->get_read_buff(buff, spb);
+ *     player->consume(tx_stream->send(buff, num_samps, md));
+ * }
+ * \endcode
+ *
+ * Otherwise, the file is read in large chunks, and get_read_buff() returns
+ * pointers into the current chunk.
+ *
+ * With looping enabled, playback continues at the start of the file once the
+ * end is reached, without reading the file again (if it fits into the page
+ * cache). The file is not reopened when looping or seeking.
+ */
+class UHD_API sample_player
+{
+public:
+    using sptr = std::shared_ptr<sample_player>;
+
+    virtual ~sample_player() = default;
+
+    //! Return the number of samples in the file
+    virtual size_t get_num_samps() const = 0;
+
+    //! Return the position of the next sample get_read_buff() returns
+    virtual size_t get_position() const = 0;
+
+    //! Return the number of samples from the current position to the end of the file
+    virtual size_t get_samps_left() const = 0;
+
+    /*! Move to a sample of the file
+     *
+     * \throws uhd::value_error if \p position is beyond the end of the file
+     */
+    virtual void seek(const size_t position) = 0;
+
+    //! Continue at the start of the file once the end is reached
+    virtual void set_loop(const bool loop) = 0;
+
+    //! Return true if playback continues at the start once the end is reached
+    virtual bool get_loop() const = 0;
+
+    //! Return true if the file is memory-mapped, rather than read in chunks
+    virtual bool is_mapped() const = 0;
+
+    /*! Return the samples at the current position
+     *
+     * The samples stay valid until the next call to consume() or seek().
+     *
+     * \param[out] buff Receives a pointer to the samples
+     * \param max_samps The maximum number of samples to return
+     * \returns The number of samples at \p buff, which is zero only at the end
+     *          of the file (and if looping is disabled). It may be less than
+     *          \p max_samps even before the end.
+     * \throws uhd::io_error if reading the file fails
+     */
+    virtual size_t get_read_buff(const void*& buff, const size_t max_samps) = 0;
+
+    /*! Advance the current position
+     *
+     * \param num_samps The number of samples to advance by, at most the return
+     *                  value of the last call to get_read_buff()
+     */
+    virtual void consume(const size_t num_samps) = 0;
+
+    /*! Open a file for playback
+     *
+     * \param path The file
+     * \param item_size The size of one sample in bytes. Trailing bytes of the
+     *                  file which do not make up a whole sample are ignored.
+     * \throws uhd::io_error if the file cannot be opened
+     * \throws uhd::value_error if \p item_size is zero
+     */
+    static sptr make(const std::string& path, const size_t item_size);
+};
+
+} // namespace uhd
@@ -0,0 +1,186 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+//! Settings of a sample_recorder
+struct sample_recorder_config_t
+{
+    //! Size of every buffer in bytes. It is rounded up to a multiple of 4096.
+    size_t buffer_size = 4 * 1024 * 1024;
+    //! Number of buffers per channel, i.e., how much data may be waiting for
+    // the disk
+    size_t num_buffers = 16;
+    //! Start a new file after this many bytes, or never if zero. It is rounded
+    // up to a multiple of the buffer size.
+    uint64_t max_file_size = 0;
+    //! Write around the page cache (O_DIRECT), where the platform and the file
+    // system support it
+    bool direct_io = true;
+    //! Compress every buffer losslessly on the writer threads before writing
+    // it, see uhd/utils/iq_codec.hpp. Only sc16 samples in host byte order
+    // shrink. The files then hold compressed frames, which
+    // uhd::iq_codec::decompress_file() turns back into samples, and
+    // max_file_size applies to the compressed size.
+    bool compress = false;
+    //! Stripe every channel across these directories, e.g., one per drive,
+    // which is faster than any one of them. Each buffer becomes a chunk of
+    // one of the files, round-robin, and every file has a writer thread of
+    // its own. The recorder also writes an index to the path plus ".index",
+    // which sample_recorder::join_stripes() reassembles the files from.
+    // Striped files cannot have a max_file_size.
+    std::vector<std::string> stripe_dirs;
+};
+
+/*! Writes samples to files on a separate thread per channel
+ *
+ * Writing to disk from the thread which calls recv() turns every stall of the
+ * disk into an overflow. This class decouples the two: It owns a ring of
+ * pre-allocated, page-aligned buffers, which the receiving thread fills, and
+ * writer threads which pass full buffers on to the files. The receiving thread
+ * only waits if all buffers are still being written.
+ *
+ * The buffers can be filled without copying, by receiving into them:
+ *
+ * \code{.cpp}
+ * auto recorder = uhd::sample_recorder::make("samples.dat", 2);
+ * std::vector<void*> buffs;
+ * while (!done) {
+ *     const size_t num_bytes = recorder->get_write_buffs(buffs);
+ *     const size_t num_samps = rx_stream->recv(
+ *         buffs, num_bytes / sizeof(std::complex<short>), md, 0.1);
+ *     recorder->commit(num_samps * sizeof(std::complex<short>));
+ * }
+ * recorder->close();
+ * \endcode
+ *
+ * Every channel is written to its own file, and every file may be split into
+ * parts of a maximum size. The names of the files are derived from the given
+ * path, see get_file_name(). All channels have the same number of bytes
+ * written to them. Alternatively, every channel may be striped across files
+ * in several directories, see sample_recorder_config_t::stripe_dirs. The files
+ * of directory k are then named as part k of a split file.
+ *
+ * The functions which write to the buffers must only be called from one
+ * thread.
+ */
+class UHD_API sample_recorder
+{
+public:
+    using sptr = std::shared_ptr<sample_recorder>;
+
+    //! Settings of the recorder
+    using config_t = sample_recorder_config_t;
+
+    //! Closes the files (see close()), but does not throw
+    virtual ~sample_recorder() = default;
+
+    //! Return the number of channels, i.e., files written at a time
+    virtual size_t get_num_channels() const = 0;
+
+    /*! Return where the next bytes of every channel go
+     *
+     * \param[out] buffs Receives one pointer per channel
+     * \param timeout The timeout in seconds to wait for a buffer, if all of
+     *                them are still being written
+     * \returns The number of bytes which fit into each buffer, or zero if no
+     *          buffer became available within the timeout
+     * \throws uhd::io_error if writing a file has failed
+     */
+    virtual size_t get_write_buffs(
+        std::vector<void*>& buffs, const double timeout = 0.1) = 0;
+
+    /*! Pass bytes which were written to the buffers from get_write_buffs() on
+     * to the files
+     *
+     * \param num_bytes The number of bytes per channel, at most the return
+     *                  value of get_write_buffs()
+     * \throws uhd::value_error if \p num_bytes exceeds the buffers
+     */
+    virtual void commit(const size_t num_bytes) = 0;
+
+    /*! Copy bytes of every channel into the buffers, and commit them
+     *
+     * \param buffs One pointer per channel
+     * \param num_bytes The number of bytes per channel
+     * \param timeout The timeout in seconds to wait for each buffer
+     * \returns The number of bytes which were copied. This is less than
+     *          \p num_bytes if the writer threads fell behind.
+     * \throws uhd::io_error if writing a file has failed
+     */
+    virtual size_t write(const std::vector<const void*>& buffs,
+        const size_t num_bytes,
+        const double timeout = 0.1) = 0;
+
+    /*! Write all committed bytes, and close the files
+     *
+     * Calling any other function which writes afterwards is an error.
+     *
+     * \throws uhd::io_error if writing a file has failed
+     */
+    virtual void close() = 0;
+
+    //! Return the number of bytes per channel which reached the files so far
+    virtual uint64_t get_bytes_written() const = 0;
+
+    //! Return how often get_write_buffs() had to wait for a buffer
+    virtual size_t get_num_stalls() const = 0;
+
+    /*! Create a recorder, and the files of the channels
+     *
+     * \param path The path the file names are derived from
+     * \param num_channels The number of channels
+     * \param config The settings of the recorder
+     * \throws uhd::io_error if a file cannot be created
+     */
+    static sptr make(const std::string& path,
+        const size_t num_channels = 1,
+        const config_t& config    = config_t());
+
+    /*! Return the name of a file, as the recorder names them
+     *
+     * With more than one channel, ".ch<chan>" is inserted in front of the
+     * extension of \p path. For split files, ".<index>" follows, as a four
+     * digit number. E.g., "samples.dat" turns into "samples.ch1.0002.dat" for
+     * the third part of the file of channel 1.
+     *
+     * \param path The path which was given to make()
+     * \param chan The channel
+     * \param num_channels The number of channels of the recorder
+     * \param split True if the recorder has a maximum file size
+     * \param file_index The index of the part of the file
+     */
+    static std::string get_file_name(const std::string& path,
+        const size_t chan,
+        const size_t num_channels,
+        const bool split,
+        const size_t file_index);
+
+    /*! Reassemble a striped recording into one file per channel
+     *
+     * The files are named as those of an unsplit recording of \p path, see
+     * get_file_name(). For a compressed recording, they hold the compressed
+     * frames, in order.
+     *
+     * \param index_path The index the recorder wrote, i.e., its path plus
+     *                   ".index"
+     * \param path The path the file names are derived from
+     * \throws uhd::io_error if a file cannot be read or written
+     * \throws uhd::value_error if \p index_path is not a valid index
+     */
+    static void join_stripes(const std::string& index_path, const std::string& path);
+};
+
+} // namespace uhd
@@ -0,0 +1,165 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/types/metadata.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! Publishes received packets to other processes through shared memory
+ *
+ * Only one process can own an RX streamer. To let several local processes
+ * consume the same samples (e.g., a recorder, a detector and a monitor), the
+ * owner publishes every packet into a ring of slots in a named shared memory
+ * object, and the other processes read them from there with a
+ * shm_iq_subscriber, without any copies or system calls on their side.
+ *
+ * The ring is a broadcast ring: the publisher never waits for subscribers.
+ * A subscriber which falls behind by more than the number of slots loses
+ * packets, which it sees as an overflow.
+ *
+ * \code{.cpp}
+ * auto publisher = uhd::shm_iq_publisher::make("/rx0",
+ *     rx_stream->get_num_channels(), 4, rx_stream->get_max_num_samps(), 256);
+ * rx_stream->issue_stream_cmd(stream_cmd);
+ * uhd::rx_metadata_t md;
+ * while (running) {
+ *     publisher->publish_from(*rx_stream, md); // rx_stream streams sc16 as sc16
+ * }
+ * \endcode
+ *
+ * Only available on platforms with POSIX shared memory.
+ */
+class UHD_API shm_iq_publisher
+{
+public:
+    using sptr = std::shared_ptr<shm_iq_publisher>;
+
+    virtual ~shm_iq_publisher() = default;
+
+    /*! Publish one packet
+     *
+     * \param buffs The samples, one pointer per channel
+     * \param nsamps The number of samples per channel
+     * \param metadata The metadata of the samples
+     * \throws uhd::value_error if the number of channels does not match, or
+     *         there are more samples than fit into a slot
+     */
+    virtual void publish(const std::vector<const void*>& buffs,
+        const size_t nsamps,
+        const rx_metadata_t& metadata) = 0;
+
+    /*! Receive one packet from a streamer and publish it
+     *
+     * The packet is received with rx_streamer::get_recv_buffs(), so the
+     * samples are copied once, straight from the frame buffers of the
+     * transport into the ring. Errors other than timeouts are published with
+     * the metadata, so subscribers see them too.
+     *
+     * \param streamer The streamer to receive from. Its CPU format must equal
+     *        its over-the-wire format.
+     * \param timeout The timeout in seconds to wait for a packet
+     * \param[out] metadata The metadata of the packet
+     * \returns the number of samples per channel of the packet
+     */
+    virtual size_t publish_from(
+        rx_streamer& streamer, rx_metadata_t& metadata, const double timeout = 0.1) = 0;
+
+    /*! Create the shared memory object and a publisher for it
+     *
+     * An existing object of the same name is replaced. Subscribers of the old
+     * object don't receive any more packets. The object is removed when the
+     * publisher is destroyed.
+     *
+     * \param name The name of the shared memory object, starting with a '/'
+     * \param num_channels The number of channels per packet
+     * \param bytes_per_sample The size of a sample (e.g., 4 for sc16)
+     * \param max_samps_per_packet The maximum number of samples per channel of
+     *        a packet
+     * \param num_slots The number of packets the ring holds
+     * \throws uhd::value_error on invalid arguments,
+     *         uhd::os_error if the shared memory object can't be created, or
+     *         uhd::not_implemented_error without POSIX shared memory
+     */
+    static sptr make(const std::string& name,
+        const size_t num_channels,
+        const size_t bytes_per_sample,
+        const size_t max_samps_per_packet,
+        const size_t num_slots);
+};
+
+/*! Reads the packets of a shm_iq_publisher from another process
+ *
+ * The samples are read right where the publisher put them. A packet is held
+ * from acquire() until release(). The publisher doesn't wait for
+ * subscribers, though: if it wraps around the ring while a packet is held,
+ * it overwrites the samples, which release() then reports. Applications
+ * which need intact samples should therefore process or copy them before
+ * releasing them, and discard them if release() returns false.
+ *
+ * A subscriber starts with the next packet which is published after it was
+ * created. Subscribers are not thread-safe, but a process may create several.
+ */
+class UHD_API shm_iq_subscriber
+{
+public:
+    using sptr = std::shared_ptr<shm_iq_subscriber>;
+
+    //! A packet in the ring
+    struct packet_t
+    {
+        //! The samples, one pointer per channel
+        std::vector<const void*> buffs;
+        //! The number of samples per channel
+        size_t nsamps = 0;
+        //! The metadata the packet was published with
+        rx_metadata_t metadata;
+    };
+
+    virtual ~shm_iq_subscriber() = default;
+
+    /*! Wait for the next packet and hold it
+     *
+     * If packets were lost because the subscriber fell behind, the packet
+     * reports an overflow in its metadata, which otherwise is the one the
+     * packet was published with.
+     *
+     * \param[out] packet The packet
+     * \param timeout The timeout in seconds to wait for a packet
+     * \returns false on a timeout
+     */
+    virtual bool acquire(packet_t& packet, const double timeout = 0.1) = 0;
+
+    /*! Release the packet held since the last acquire()
+     *
+     * \returns true if the samples stayed intact while the packet was held
+     */
+    virtual bool release() = 0;
+
+    //! Return the number of channels per packet
+    virtual size_t get_num_channels() const = 0;
+
+    //! Return the size of a sample in bytes
+    virtual size_t get_bytes_per_sample() const = 0;
+
+    /*! Attach to the shared memory object of a publisher
+     *
+     * \param name The name the publisher was created with
+     * \throws uhd::os_error if the shared memory object can't be opened,
+     *         uhd::runtime_error if it was not created by a publisher, or
+     *         uhd::not_implemented_error without POSIX shared memory
+     */
+    static sptr make(const std::string& name);
+};
+
+} // namespace uhd
@@ -0,0 +1,174 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+//! Description of a SigMF recording
+struct sigmf_info_t
+{
+    //! The CPU format of the samples (e.g., "sc16" or "fc32")
+    std::string cpu_format = "sc16";
+    //! The sample rate in samples per second
+    double sample_rate = 0.0;
+    //! The center frequency of each channel in Hz, if known
+    std::vector<double> frequencies;
+    //! The gain of each channel in dB, if known
+    std::vector<double> gains;
+    //! Free-form text which describes the recording
+    std::string description;
+    //! The author of the recording
+    std::string author;
+    //! The hardware which made the recording, e.g., the device name
+    std::string hw;
+};
+
+//! A discontinuity of a recording, i.e., the start of a SigMF capture segment
+struct sigmf_capture_t
+{
+    //! The index of the first sample of the segment
+    size_t sample_start = 0;
+    //! True if the device time of the first sample is known
+    bool has_time_spec = false;
+    //! The device time of the first sample
+    uhd::time_spec_t time_spec;
+    //! The number of samples which were lost before the segment, according to
+    // the time of the first sample
+    size_t dropped_samps = 0;
+};
+
+/*! Records samples in the SigMF format, including their metadata
+ *
+ * Every channel is written to a SigMF recording: a data file with the raw
+ * samples, and a metadata file which describes them. The data goes through a
+ * sample_recorder, so it is written on separate threads. The metadata is
+ * collected from the rx_metadata_t of every recv() call, which only takes a
+ * few comparisons per call, and written to the metadata files by close().
+ *
+ * The metadata file holds:
+ * - A capture segment at the start of the recording, and at every
+ *   discontinuity: whenever the time_spec of a recv() call does not follow the
+ *   samples which were recorded before, and whenever the frequency or the gain
+ *   changes. The segment records the center frequency, the gain ("uhd:gain",
+ *   in dB), the device time of its first sample ("uhd:time_spec",
+ *   in seconds), and how many samples are missing before it
+ *   ("uhd:dropped_samps").
+ * - An annotation at every error which recv() reported (e.g., an overflow),
+ *   labeled with the name of the error code. These form an index of the
+ *   problems of a recording, which does not need the data to be scanned.
+ *
+ * \code{.cpp}
+ * uhd::sigmf_info_t info;
+ * info.cpu_format  = "sc16";
+ * info.sample_rate = usrp->get_rx_rate();
+ * info.frequencies = {usrp->get_rx_freq()};
+ * info.gains       = {usrp->get_rx_gain()};
+ * auto recorder = uhd::sigmf_recorder::make("capture", 1, info);
+ * std::vector<void*> buffs;
+ * while (!done) {
+ *     const size_t max_samps = recorder->get_write_buffs(buffs);
+ *     const size_t num_samps = rx_stream->recv(buffs, max_samps, md, 0.1);
+ *     recorder->commit(num_samps, md);
+ * }
+ * recorder->close();
+ * \endcode
+ *
+ * The functions must only be called from one thread.
+ */
+class UHD_API sigmf_recorder
+{
+public:
+    using sptr = std::shared_ptr<sigmf_recorder>;
+
+    //! Description of a recording
+    using info_t = sigmf_info_t;
+
+    //! Closes the recordings (see close()), but does not throw
+    virtual ~sigmf_recorder() = default;
+
+    //! Return the number of channels, i.e., recordings written at a time
+    virtual size_t get_num_channels() const = 0;
+
+    /*! Return where the next samples of every channel go
+     *
+     * \param[out] buffs Receives one pointer per channel
+     * \param timeout The timeout in seconds to wait for a buffer
+     * \returns The number of samples which fit into each buffer, or zero if
+     *          no buffer became available within the timeout
+     * \throws uhd::io_error if writing a data file has failed
+     */
+    virtual size_t get_write_buffs(
+        std::vector<void*>& buffs, const double timeout = 0.1) = 0;
+
+    /*! Record samples which were received into the buffers from
+     *  get_write_buffs(), and their metadata
+     *
+     * Call this after every recv(), even if it returned no samples, so errors
+     * are recorded.
+     *
+     * \param num_samps The number of samples recv() returned
+     * \param metadata The metadata recv() returned
+     */
+    virtual void commit(const size_t num_samps, const uhd::rx_metadata_t& metadata) = 0;
+
+    /*! Record a change of the center frequency of a channel
+     *
+     * This starts a new capture segment at the next sample.
+     *
+     * \throws uhd::index_error if \p chan is not a valid channel
+     */
+    virtual void set_frequency(const size_t chan, const double frequency) = 0;
+
+    /*! Record a change of the gain of a channel
+     *
+     * This starts a new capture segment at the next sample.
+     *
+     * \throws uhd::index_error if \p chan is not a valid channel
+     */
+    virtual void set_gain(const size_t chan, const double gain) = 0;
+
+    //! Return the capture segments so far
+    virtual std::vector<sigmf_capture_t> get_captures() const = 0;
+
+    //! Return the index of the next sample at every overflow so far
+    virtual std::vector<size_t> get_overflows() const = 0;
+
+    /*! Write all samples, and the metadata files, and close the recordings
+     *
+     * \throws uhd::io_error if writing a file has failed
+     */
+    virtual void close() = 0;
+
+    /*! Create a recorder, and the data files of the channels
+     *
+     * The files are named like the ones of a sample_recorder for the path
+     * \p base + ".sigmf-data", and the metadata files have the extension
+     * ".sigmf-meta" instead. The recorder never splits the files.
+     *
+     * \param base The path of the recordings, without the extension
+     * \param num_channels The number of channels
+     * \param info The description of the recordings
+     * \param config The settings of the sample_recorder which writes the data
+     * \throws uhd::value_error if SigMF has no data type for the CPU format
+     * \throws uhd::io_error if a file cannot be created
+     */
+    static sptr make(const std::string& base,
+        const size_t num_channels,
+        const info_t& info,
+        const sample_recorder::config_t& config = sample_recorder::config_t());
+};
+
+} // namespace uhd
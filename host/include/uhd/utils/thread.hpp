@@ -11,6 +11,7 @@
 #include <boost/thread/thread.hpp>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace uhd {
 
@@ -63,4 +64,48 @@ UHD_API void set_thread_name(std::thread* thread, const std::string& name);
  */
 UHD_API void set_thread_affinity(const std::vector<size_t>& cpu_affinity_list);
 
+/*!
+ * The CPUs chosen for streaming threads by get_thread_placement()
+ */
+struct UHD_API thread_placement_t
+{
+    //! The NUMA node the threads were placed on, or -1 for all nodes
+    int numa_node = -1;
+    //! One CPU for each I/O (offload) thread
+    std::vector<size_t> io_cpus;
+    //! One CPU for each converter thread
+    std::vector<size_t> convert_cpus;
+    //! One CPU for each application streaming thread
+    std::vector<size_t> app_cpus;
+    //! True if there were too few physical cores, and some threads share one
+    bool shares_cores = false;
+
+    //! Return a one-line description of the placement
+    std::string to_pp_string() const;
+};
+
+/*!
+ * Choose CPUs for streaming threads, based on the topology of the machine.
+ *
+ * Each thread gets a physical core of its own, so no two threads compete for
+ * the same core through SMT. Cores on \p numa_node are used first, then cores
+ * excluded from scheduling with the isolcpus kernel parameter. I/O threads
+ * get the best cores, followed by converter threads and application threads.
+ * The result is logged, and can be passed on to set_thread_affinity(), or to
+ * the recv_offload_thread_<N>_cpu and convert_cpus arguments.
+ *
+ * The placement only depends on the arguments and the machine, so calling
+ * this again with the same arguments returns the same CPUs.
+ *
+ * \param num_io_threads Number of I/O threads
+ * \param num_convert_threads Number of converter threads
+ * \param num_app_threads Number of application streaming threads
+ * \param numa_node The NUMA node of the network interface, or -1 if unknown
+ * \return the placement
+ */
+UHD_API thread_placement_t get_thread_placement(const size_t num_io_threads,
+    const size_t num_convert_threads,
+    const size_t num_app_threads,
+    const int numa_node = -1);
+
 } // namespace uhd
@@ -0,0 +1,112 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! Sends timed bursts from a queue on a thread of its own
+ *
+ * Timed packets must neither arrive at the device too late (they are then
+ * dropped with an underflow) nor too early (they then hold the flow control
+ * credits of the streamer, and send() blocks until the device has consumed
+ * them). The scheduler takes timed bursts any time in advance, copies them
+ * into a queue on the host, and returns right away. Its thread sends every
+ * burst once the device time is within the lead time of the burst, in the
+ * order of the burst times. Waiting for flow control credits happens on that
+ * thread, so the application thread never blocks:
+ *
+ * \code{.cpp}
+ * auto scheduler = uhd::tx_burst_scheduler::make(tx_stream,
+ *     "fc32",
+ *     [usrp]() { return usrp->get_time_now_estimate(); });
+ * for (size_t i = 0; i < num_pulses; i++) {
+ *     scheduler->submit({pulse.data()}, pulse.size(), start + i * pri);
+ * }
+ * scheduler->wait_until_empty(timeout);
+ * \endcode
+ *
+ * The device time should be cheap to get, e.g., from
+ * multi_usrp::get_time_now_estimate(), as the scheduler reads it before
+ * every burst, and at least every 100 ms while it waits.
+ *
+ * A burst may span several calls to submit(), with \p end_of_burst only set
+ * on the last one. Errors of send() on the thread of the scheduler are
+ * rethrown by the next call to submit() or wait_until_empty(). The streamer
+ * must not be used by anything else while the scheduler exists.
+ */
+class UHD_API tx_burst_scheduler
+{
+public:
+    using sptr = std::shared_ptr<tx_burst_scheduler>;
+    //! Returns the current device time
+    using get_time_fn_t = std::function<time_spec_t(void)>;
+
+    //! Default time before the start of a burst at which it is sent, in seconds
+    static constexpr double DEFAULT_LEAD_TIME = 0.05;
+
+    //! Stops sending. Bursts which were not sent yet are dropped.
+    virtual ~tx_burst_scheduler() = default;
+
+    /*! Queue samples to be sent at a given time
+     *
+     * The samples are copied, so the buffers may be reused right away.
+     *
+     * \param buffs The samples, one buffer per channel of the streamer
+     * \param nsamps_per_buff The number of samples per buffer
+     * \param time The device time of the first sample
+     * \param end_of_burst Whether these samples end the burst
+     * \throws uhd::value_error if there isn't one buffer per channel, or any
+     *         exception which sending previous bursts threw
+     */
+    virtual void submit(const std::vector<const void*>& buffs,
+        const size_t nsamps_per_buff,
+        const time_spec_t& time,
+        const bool end_of_burst = true) = 0;
+
+    //! Return the number of bursts which were not sent yet
+    virtual size_t get_num_queued() const = 0;
+
+    /*! Return the number of bursts which were sent after their start time
+     *
+     * These were most likely dropped by the device with an underflow. The lead
+     * time needs to be longer if this happens regularly.
+     */
+    virtual size_t get_num_late() const = 0;
+
+    /*! Wait until all queued bursts were sent
+     *
+     * \param timeout The maximum time to wait, in seconds
+     * \returns true if all bursts were sent
+     * \throws any exception which sending a burst threw
+     */
+    virtual bool wait_until_empty(const double timeout) = 0;
+
+    /*! Create a scheduler and start its thread
+     *
+     * \param streamer The streamer to send on
+     * \param cpu_format The CPU format of the streamer (e.g., "fc32")
+     * \param get_time Returns the current device time
+     * \param lead_time The time before the start of a burst at which it is
+     *                  sent, in seconds. It must cover the latency of
+     *                  sending a burst to the device.
+     * \throws uhd::value_error if the lead time is negative
+     */
+    static sptr make(tx_streamer::sptr streamer,
+        const std::string& cpu_format,
+        get_time_fn_t get_time,
+        const double lead_time = DEFAULT_LEAD_TIME);
+};
+
+} // namespace uhd
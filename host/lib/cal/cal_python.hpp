@@ -145,7 +145,8 @@ void export_cal(py::module& m)
         .def("get_dsa_setting",
             &zbx_tx_dsa_cal::get_dsa_setting,
             py::arg("freq"),
-            py::arg("gain_index"));
+            py::arg("gain_index"))
+        .def("get_band_max_freqs", &zbx_tx_dsa_cal::get_band_max_freqs);
 
     py::class_<zbx_rx_dsa_cal, container, zbx_rx_dsa_cal::sptr>(m, "zbx_rx_dsa_cal")
         .def(py::init([](const std::string& name,
@@ -166,7 +167,8 @@ void export_cal(py::module& m)
         .def("get_dsa_setting",
             &zbx_rx_dsa_cal::get_dsa_setting,
             py::arg("freq"),
-            py::arg("gain_index"));
+            py::arg("gain_index"))
+        .def("get_band_max_freqs", &zbx_rx_dsa_cal::get_band_max_freqs);
 
 }
 
@@ -14,7 +14,10 @@
 #include <array>
 #include <ctime>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 CMRC_DECLARE(rc);
@@ -32,6 +35,9 @@ constexpr char CAL_EXT[] = ".cal";
 // someone bringing down a UHD session by trying to import a huge file, because
 // we first load it entirely into heap space, and then deserialize it from there.
 constexpr size_t CALDATA_MAX_SIZE = 10 * 1024 * 1024; // 10 MiB
+//! Upper limit for the total amount of file data that is kept in memory by
+// cal_file_cache. Files that don't fit are read from disk every time.
+constexpr size_t CALDATA_CACHE_MAX_SIZE = 64 * 1024 * 1024; // 64 MiB
 
 /******************************************************************************
  * RC implementation
@@ -118,6 +124,78 @@ std::string get_cal_path_fs(const std::string& key, const std::string& serial)
     return key + "_" + serial + CAL_EXT;
 }
 
+/*! In-process cache for the contents of cal data files
+ *
+ * Devices with many channels read the same cal data files several times during
+ * initialization (e.g., once per channel sharing a daughterboard, or once per
+ * session for every device with the same serial), and every read used to go to
+ * disk. The cache is shared by all devices in the process. An entry is only
+ * used if the file's size and modification time are unchanged, so edits made
+ * by other processes are picked up on the next read. write_cal_data() drops the
+ * entry for the file it replaces.
+ */
+class cal_file_cache
+{
+public:
+    using data_type = std::shared_ptr<const std::vector<uint8_t>>;
+
+    //! Return the cached contents of \p path, or nullptr if the entry is stale
+    data_type get(const fs::path& path, const size_t size, const std::time_t mtime)
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = _entries.find(path.string());
+        if (it == _entries.end()) {
+            return nullptr;
+        }
+        if (it->second.data->size() != size || it->second.mtime != mtime) {
+            _total_size -= it->second.data->size();
+            _entries.erase(it);
+            return nullptr;
+        }
+        return it->second.data;
+    }
+
+    void put(const fs::path& path, const std::time_t mtime, std::vector<uint8_t> data)
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _erase(path.string());
+        if (_total_size + data.size() > CALDATA_CACHE_MAX_SIZE) {
+            return;
+        }
+        _total_size += data.size();
+        _entries[path.string()] = {
+            mtime, std::make_shared<const std::vector<uint8_t>>(std::move(data))};
+    }
+
+    void erase(const fs::path& path)
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _erase(path.string());
+    }
+
+private:
+    struct entry_t
+    {
+        std::time_t mtime;
+        data_type data;
+    };
+
+    void _erase(const std::string& path)
+    {
+        auto it = _entries.find(path);
+        if (it != _entries.end()) {
+            _total_size -= it->second.data->size();
+            _entries.erase(it);
+        }
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, entry_t> _entries;
+    size_t _total_size = 0;
+};
+
+UHD_SINGLETON_FCN(cal_file_cache, get_cal_file_cache);
+
 //! Return true if a cal data resource with given key exists
 bool has_cal_data_fs(const std::string& key, const std::string& serial)
 {
@@ -146,10 +224,20 @@ std::vector<uint8_t> get_cal_data_fs(const std::string& key, const std::string&
             std::string("The following cal data file exceeds maximum size limitations: ")
             + cal_file_path.string());
     }
+    const std::time_t mtime = fs::last_write_time(cal_file_path);
+    if (auto cached_data = get_cal_file_cache().get(cal_file_path, filesize, mtime)) {
+        UHD_LOG_TRACE(LOG_ID, "Using cached data for " << cal_file_path);
+        return *cached_data;
+    }
     std::vector<uint8_t> result(filesize, 0);
     std::ifstream file(cal_file_path.string(), std::ios::binary);
     UHD_LOG_TRACE(LOG_ID, "Reading " << filesize << " bytes from " << cal_file_path);
-    file.read(reinterpret_cast<char*>(&result[0]), filesize);
+    file.read(reinterpret_cast<char*>(result.data()), filesize);
+    if (!file) {
+        throw uhd::key_error(
+            std::string("Unable to read cal data file: ") + cal_file_path.string());
+    }
+    get_cal_file_cache().put(cal_file_path, mtime, result);
     return result;
 }
 
@@ -259,9 +347,14 @@ void database::write_cal_data(const std::string& key,
         fs::rename(fs::path(cal_file_path), cal_file_path_backup);
     }
 
-    std::ofstream file(cal_file_path, std::ios::binary);
-    UHD_LOG_DEBUG(LOG_ID, "Writing to " << cal_file_path);
-    file.write(reinterpret_cast<const char*>(cal_data.data()), cal_data.size());
+    {
+        std::ofstream file(cal_file_path, std::ios::binary);
+        UHD_LOG_DEBUG(LOG_ID, "Writing to " << cal_file_path);
+        file.write(reinterpret_cast<const char*>(cal_data.data()), cal_data.size());
+    }
+    // The new file may have the same size and timestamp as the old one, so
+    // don't rely on get() spotting the change
+    get_cal_file_cache().erase(cal_file_path);
 }
 
 void database::register_lookup(has_data_fn_type has_cal_data,
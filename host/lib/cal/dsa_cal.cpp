@@ -8,9 +8,11 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhdlib/utils/interpolation.hpp>
 #include <map>
 #include <string>
 #include <array>
+#include <vector>
 #include <boost/range/adaptor/indexed.hpp>
 
 using namespace uhd::usrp::cal;
@@ -62,6 +64,7 @@ public:
         const std::array<std::array<uint32_t, num_dsa>, num_gain_stages> dsa_values)
     {
         _data[max_freq] = name_dsas_pair(name, dsa_values);
+        _update_bands();
     }
 
     const std::array<uint32_t, num_dsa> get_dsa_setting(double freq, size_t gain_index) const
@@ -70,9 +73,8 @@ public:
             throw uhd::runtime_error("Cannot get DSA settings from an empty container.");
         }
         // find the lowest band with band_freq_max <= freq
-        const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto freq_it = _data.lower_bound(freqi);
-        if (freq_it == _data.end()) {
+        const size_t band_idx = _get_band_index(freq);
+        if (band_idx == _band_freqs.size()) {
             throw uhd::value_error("No DSA band found for freq " + std::to_string(freq));
         }
         // select DSA setting using gain_index
@@ -80,37 +82,38 @@ public:
             throw uhd::value_error(
                 "gain index " + std::to_string(gain_index) + " out of bounds.");
         }
-        return freq_it->second.second[gain_index];
+        return _band_dsas[band_idx][gain_index];
     }
 
     bool is_same_band(double freq1, double freq2) const
     {
-        const uint64_t freqi1 = static_cast<uint64_t>(freq1);
-        const auto freq_it1 = _data.lower_bound(freqi1);
-        const uint64_t freqi2 = static_cast<uint64_t>(freq2);
-        const auto freq_it2 = _data.lower_bound(freqi2);
-        return freq_it1 == freq_it2;
+        return _get_band_index(freq1) == _get_band_index(freq2);
     }
 
     std::vector<uint32_t> get_band_settings(double freq, uint8_t dsa) const
     {
         std::vector<uint32_t> result;
         // find the lowest band with band_freq_max <= freq
-        const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto freq_it = _data.lower_bound(freqi);
-        if (freq_it == _data.end()) {
+        const size_t band_idx = _get_band_index(freq);
+        if (band_idx == _band_freqs.size()) {
             throw uhd::value_error("No DSA band found for freq " + std::to_string(freq));
         }
         // select DSA setting using gain_index
-        for (auto item : freq_it->second.second) {
+        for (auto item : _band_dsas[band_idx]) {
             result.push_back(item[dsa]);
         }
         return result;
     }
 
+    std::vector<double> get_band_max_freqs() const
+    {
+        return std::vector<double>(_band_freqs.cbegin(), _band_freqs.cend());
+    }
+
     void clear()
     {
         _data.clear();
+        _update_bands();
     }
 
 
@@ -215,6 +218,29 @@ private:
 
     std::map<uint64_t /* freq */, name_dsas_pair> _data;
 
+    //! The max. frequencies and DSA settings of _data, flattened into sorted
+    // arrays. The lookups on every retune are binary searches over contiguous
+    // memory instead of tree walks. Entry i of _band_dsas belongs to
+    // _band_freqs[i].
+    std::vector<uint64_t> _band_freqs;
+    std::vector<dsa_steps> _band_dsas;
+
+    void _update_bands()
+    {
+        _band_freqs.clear();
+        _band_dsas.clear();
+        for (const auto& band : _data) {
+            _band_freqs.push_back(band.first);
+            _band_dsas.push_back(band.second.second);
+        }
+    }
+
+    //! Return the index of the lowest band with band_freq_max >= freq, or the
+    // number of bands if there is none
+    size_t _get_band_index(const double freq) const
+    {
+        return uhd::math::lower_bound_index(_band_freqs, static_cast<uint64_t>(freq));
+    }
 };
 
 } //namespace
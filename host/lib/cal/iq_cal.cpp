@@ -10,7 +10,10 @@
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/interpolation.hpp>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 using namespace uhd::usrp::cal;
 using namespace uhd::math;
@@ -60,26 +63,21 @@ public:
 
     std::complex<double> get_cal_coeff(const double freq) const override
     {
-        UHD_ASSERT_THROW(!_coeffs.empty());
-        // Find the first coefficient in the map that maps to a larger frequency
-        // than freq (or equal)
-        auto next_coeff = _coeffs.lower_bound(freq);
-        if (next_coeff == _coeffs.end()) {
-            // This means freq is larger than our biggest key, and thus we
-            // can't interpolate. We return the coeffs of the largest key.
-            return _coeffs.rbegin()->second;
-        }
-        if (next_coeff == _coeffs.begin()) {
-            // This means freq is smaller than our smallest key, and thus we
-            // can't interpolate. We return the coeffs of the smallest key.
-            return _coeffs.begin()->second;
+        const auto lut = _get_lut();
+        UHD_ASSERT_THROW(!lut->freqs.empty());
+        // Find the coefficients below and above freq
+        const auto idx = get_bounding_indices(lut->freqs, freq);
+        if (idx.first == idx.second) {
+            // This means freq is smaller than our smallest key, or larger than
+            // our biggest key, and thus we can't interpolate. We return the
+            // coeffs of the closest key.
+            return lut->coeffs[idx.first];
         }
         // Stash away freqs and coeffs for easier code
-        const auto hi_freq  = next_coeff->first;
-        const auto hi_coeff = next_coeff->second;
-        next_coeff--;
-        const auto lo_coeff = next_coeff->second;
-        const auto lo_freq  = next_coeff->first; // lo == low, not LO
+        const auto hi_freq  = lut->freqs[idx.second];
+        const auto hi_coeff = lut->coeffs[idx.second];
+        const auto lo_coeff = lut->coeffs[idx.first];
+        const auto lo_freq  = lut->freqs[idx.first]; // lo == low, not LO
         // Now, we're guaranteed to be between two points
         if (_interp == interp_mode::NEAREST_NEIGHBOR) {
             return (hi_freq - freq) < (freq - lo_freq) ? hi_coeff : lo_coeff;
@@ -99,12 +97,14 @@ public:
     {
         _coeffs[freq] = coeff;
         _supp[freq]   = {suppression_abs, suppression_delta};
+        _invalidate_lut();
     }
 
     void clear() override
     {
         _coeffs.clear();
         _supp.clear();
+        _invalidate_lut();
     }
 
     /**************************************************************************
@@ -171,10 +171,45 @@ public:
             // runtime (and not future storage)
             _supp[it->freq()] = {it->suppression_abs(), it->suppression_delta()};
         }
+        _invalidate_lut();
     }
 
 
 private:
+    //! The coefficients, flattened into sorted arrays. Entry i of coeffs
+    // belongs to freqs[i].
+    struct lookup_table
+    {
+        std::vector<double> freqs;
+        std::vector<std::complex<double>> coeffs;
+    };
+
+    //! Return the lookup table, building it from _coeffs if necessary
+    //
+    // Like in pwr_cal, it is built on first use after the data changes, so
+    // lookups are binary searches over contiguous memory instead of tree walks.
+    std::shared_ptr<const lookup_table> _get_lut() const
+    {
+        std::lock_guard<std::mutex> l(_lut_mutex);
+        if (!_lut) {
+            auto lut = std::make_shared<lookup_table>();
+            lut->freqs.reserve(_coeffs.size());
+            lut->coeffs.reserve(_coeffs.size());
+            for (const auto& coeff : _coeffs) {
+                lut->freqs.push_back(coeff.first);
+                lut->coeffs.push_back(coeff.second);
+            }
+            _lut = lut;
+        }
+        return _lut;
+    }
+
+    void _invalidate_lut()
+    {
+        std::lock_guard<std::mutex> l(_lut_mutex);
+        _lut.reset();
+    }
+
     std::string _name;
     std::string _serial;
     uint64_t _timestamp;
@@ -184,6 +219,10 @@ private:
     std::map<double, std::pair<double, double>> _supp;
 
     interp_mode _interp;
+
+    //! Flattened copy of _coeffs, see _get_lut()
+    mutable std::shared_ptr<const lookup_table> _lut;
+    mutable std::mutex _lut_mutex;
 };
 
 
@@ -10,8 +10,13 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/interpolation.hpp>
+#include <algorithm>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace uhd::usrp::cal;
 using namespace uhd::math;
@@ -39,6 +44,56 @@ map_type reverse_map(const map_type& map)
     return result;
 }
 
+//! A std::map<double, double> flattened into two sorted arrays
+struct flat_map
+{
+    flat_map(const std::map<double, double>& map)
+    {
+        keys.reserve(map.size());
+        values.reserve(map.size());
+        for (const auto& entry : map) {
+            keys.push_back(entry.first);
+            values.push_back(entry.second);
+        }
+    }
+
+    //! Like std::map::at()
+    double at(const double key) const
+    {
+        const size_t idx = lower_bound_index(keys, key);
+        if (idx == keys.size() || keys[idx] != key) {
+            throw std::out_of_range("flat_map::at(): Key not found");
+        }
+        return values[idx];
+    }
+
+    //! Like at_nearest()
+    double nearest(const double key) const
+    {
+        return values[get_nearest_index(keys, key)];
+    }
+
+    //! Like at_lin_interp()
+    double lin_interp(const double key) const
+    {
+        const size_t next_idx = lower_bound_index(keys, key);
+        if (next_idx == keys.size()) {
+            return values.back();
+        }
+        if (next_idx == 0) {
+            return values.front();
+        }
+        return linear_interp(key,
+            keys[next_idx - 1],
+            values[next_idx - 1],
+            keys[next_idx],
+            values[next_idx]);
+    }
+
+    std::vector<double> keys;
+    std::vector<double> values;
+};
+
 } // namespace
 
 
@@ -89,8 +144,12 @@ public:
         const int temp    = bool(temperature) ? temperature.get() : _default_temp;
         _data[temp][static_cast<uint64_t>(freq)] = {
             gain_power_map, reverse_map(gain_power_map), min_power, max_power};
+        _invalidate_lut();
     }
 
+    // Note: This is very similar to at_bilin_interp(), but we can't use that
+    // because we mix types in the gain tables (we have uint64_t and double, and
+    // a struct).
     // Note: This is very similar to at_bilin_interp(), but we can't use that
     // because we mix types in the gain tables (we have uint64_t and double, and
     // a struct).
@@ -99,36 +158,34 @@ public:
         const boost::optional<int> temperature = boost::none) const override
     {
         UHD_ASSERT_THROW(!_data.empty());
+        const auto lut       = _get_lut();
+        const auto& table    = _get_table(*lut, temperature);
         const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto& table = _get_table(temperature);
 
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
+        const auto f_idx = get_bounding_indices(table.freqs, freqi);
+        const auto& g2p1 = table.g2p[f_idx.first];
+        const auto& g2p2 = table.g2p[f_idx.second];
         // Frequency is out of bounds
-        if (f1i == f2i) {
-            return at_lin_interp(table.at(f1i).g2p, gain);
+        if (f_idx.first == f_idx.second) {
+            return g2p1.lin_interp(gain);
         }
-        const double f1 = static_cast<double>(f1i);
-        const double f2 = static_cast<double>(f2i);
-        const auto gain_iters = get_bounding_iterators(table.at(f1).g2p, gain);
-        const double gain1 = gain_iters.first->first;
-        const double gain2 = gain_iters.second->first;
+        const double f1     = static_cast<double>(table.freqs[f_idx.first]);
+        const double f2     = static_cast<double>(table.freqs[f_idx.second]);
+        const auto gain_idx = get_bounding_indices(g2p1.keys, gain);
+        const double gain1  = g2p1.keys[gain_idx.first];
+        const double gain2  = g2p1.keys[gain_idx.second];
         // Gain is out of bounds
         if (gain1 == gain2) {
-            return linear_interp(freq,
-                f1,
-                table.at(f1i).g2p.at(gain1),
-                f2,
-                table.at(f2i).g2p.at(gain1));
+            return linear_interp(
+                freq, f1, g2p1.values[gain_idx.first], f2, g2p2.at(gain1));
         }
 
         // Both gain and freq are within bounds: Bi-Linear interpolation
         // Find power values
-        const auto power11 = table.at(f1i).g2p.at(gain1);
-        const auto power12 = table.at(f1i).g2p.at(gain2);
-        const auto power21 = table.at(f2i).g2p.at(gain1);
-        const auto power22 = table.at(f2i).g2p.at(gain2);
+        const auto power11 = g2p1.values[gain_idx.first];
+        const auto power12 = g2p1.values[gain_idx.second];
+        const auto power21 = g2p2.at(gain1);
+        const auto power22 = g2p2.at(gain2);
 
         return bilinear_interp(
             freq, gain, f1, gain1, f2, gain2, power11, power12, power21, power22);
@@ -137,6 +194,7 @@ public:
     void clear() override
     {
         _data.clear();
+        _invalidate_lut();
     }
 
     void set_temperature(const int temperature) override
@@ -162,8 +220,10 @@ public:
     uhd::meta_range_t get_power_limits(const double freq,
         const boost::optional<int> temperature = boost::none) const override
     {
-        const auto table = at_nearest(_get_table(temperature), uint64_t(freq));
-        return uhd::meta_range_t(table.min_power, table.max_power);
+        const auto lut    = _get_lut();
+        const auto& table = _get_table(*lut, temperature);
+        const size_t idx  = get_nearest_index(table.freqs, uint64_t(freq));
+        return uhd::meta_range_t(table.min_power[idx], table.max_power[idx]);
     }
 
     double get_gain(const double power_dbm,
@@ -171,16 +231,20 @@ public:
         const boost::optional<int> temperature = boost::none) const override
     {
         UHD_ASSERT_THROW(!_data.empty());
-        const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto& table = _get_table(temperature);
-        const double power_coerced = get_power_limits(freq, temperature).clip(power_dbm);
-
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
-        if (f1i == f2i) {
+        const auto lut          = _get_lut();
+        const auto& table       = _get_table(*lut, temperature);
+        const uint64_t freqi    = static_cast<uint64_t>(freq);
+        const size_t near_f_idx = get_nearest_index(table.freqs, freqi);
+        const double power_coerced =
+            uhd::meta_range_t(table.min_power[near_f_idx], table.max_power[near_f_idx])
+                .clip(power_dbm);
+
+        const auto f_idx = get_bounding_indices(table.freqs, freqi);
+        const auto& p2g1 = table.p2g[f_idx.first];
+        const auto& p2g2 = table.p2g[f_idx.second];
+        if (f_idx.first == f_idx.second) {
             // Frequency is out of bounds
-            return at_lin_interp(table.at(f1i).p2g, power_coerced);
+            return p2g1.lin_interp(power_coerced);
         }
 
         // NOTE: bilinear_interp() does not interpolate on an arbitrary tetragon,
@@ -191,31 +255,27 @@ public:
         // nearest-neighbor-interpolate the grid coordinates for the power.
         // This snap-to-grid adds another error, which can be counteracted by
         // good choice of frequency and gain points on which to sample.
-        const auto f1pwr_iters = get_bounding_iterators(table.at(f1i).p2g, power_coerced);
-        const double f1pwr1    = f1pwr_iters.first->first;
-        const double f1pwr2    = f1pwr_iters.second->first;
-        const auto f2pwr_iters = get_bounding_iterators(table.at(f2i).p2g, power_coerced);
-        const double f2pwr1    = f2pwr_iters.first->first;
-        const double f2pwr2    = f2pwr_iters.second->first;
-        const double f1        = static_cast<double>(f1i);
-        const double f2        = static_cast<double>(f2i);
-        const double pwr1      = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
-        const double pwr2      = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
+        const auto f1pwr_idx = get_bounding_indices(p2g1.keys, power_coerced);
+        const double f1pwr1  = p2g1.keys[f1pwr_idx.first];
+        const double f1pwr2  = p2g1.keys[f1pwr_idx.second];
+        const auto f2pwr_idx = get_bounding_indices(p2g2.keys, power_coerced);
+        const double f2pwr1  = p2g2.keys[f2pwr_idx.first];
+        const double f2pwr2  = p2g2.keys[f2pwr_idx.second];
+        const double f1      = static_cast<double>(table.freqs[f_idx.first]);
+        const double f2      = static_cast<double>(table.freqs[f_idx.second]);
+        const double pwr1    = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
+        const double pwr2    = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
         // Power is out of bounds (this shouldn't happen after coercing, but this
         // is just another good sanity check on our data)
         if (pwr1 == pwr2) {
-            return linear_interp(freq,
-                f1,
-                at_nearest(table.at(f1i).p2g, pwr1),
-                f2,
-                at_nearest(table.at(f2i).p2g, pwr2));
+            return linear_interp(freq, f1, p2g1.nearest(pwr1), f2, p2g2.nearest(pwr2));
         }
         // Both gain and freq are within bounds => Bi-Linear interpolation
         // Find gain values:
-        const auto gain11 = table.at(f1i).p2g.at(f1pwr1);
-        const auto gain12 = table.at(f1i).p2g.at(f1pwr2);
-        const auto gain21 = table.at(f2i).p2g.at(f2pwr1);
-        const auto gain22 = table.at(f2i).p2g.at(f2pwr2);
+        const auto gain11 = p2g1.values[f1pwr_idx.first];
+        const auto gain12 = p2g1.values[f1pwr_idx.second];
+        const auto gain21 = p2g2.values[f2pwr_idx.first];
+        const auto gain22 = p2g2.values[f2pwr_idx.second];
         return bilinear_interp(
             freq, power_coerced, f1, pwr1, f2, pwr2, gain11, gain12, gain21, gain22);
     }
@@ -329,10 +389,67 @@ private:
 
     using freq_table_map = std::map<uint64_t /* freq */, pwr_cal_table>;
 
-    freq_table_map _get_table(const boost::optional<int> temperature) const
+    //! Lookup table for one temperature
+    //
+    // This holds the same data as a freq_table_map, but every map is flattened
+    // into sorted arrays, so that lookups are binary searches over contiguous
+    // memory instead of tree walks. Entry i of g2p, p2g, min_power, and
+    // max_power belongs to freqs[i].
+    struct flat_freq_table
+    {
+        std::vector<uint64_t> freqs;
+        std::vector<flat_map> g2p;
+        std::vector<flat_map> p2g;
+        std::vector<double> min_power;
+        std::vector<double> max_power;
+    };
+
+    //! Lookup tables for all temperatures. Entry i of tables belongs to temps[i].
+    struct lookup_table
+    {
+        std::vector<int> temps;
+        std::vector<flat_freq_table> tables;
+    };
+
+    //! Return the lookup tables, building them from _data if necessary
+    //
+    // They are built on first use after the data changes, which means
+    // deserializing or adding tables one at a time only builds them once.
+    std::shared_ptr<const lookup_table> _get_lut() const
     {
+        std::lock_guard<std::mutex> l(_lut_mutex);
+        if (!_lut) {
+            auto lut = std::make_shared<lookup_table>();
+            for (const auto& temp_table_pair : _data) {
+                lut->temps.push_back(temp_table_pair.first);
+                flat_freq_table table;
+                for (const auto& freq_table_pair : temp_table_pair.second) {
+                    table.freqs.push_back(freq_table_pair.first);
+                    table.g2p.emplace_back(freq_table_pair.second.g2p);
+                    table.p2g.emplace_back(freq_table_pair.second.p2g);
+                    table.min_power.push_back(freq_table_pair.second.min_power);
+                    table.max_power.push_back(freq_table_pair.second.max_power);
+                }
+                lut->tables.push_back(std::move(table));
+            }
+            _lut = lut;
+        }
+        return _lut;
+    }
+
+    void _invalidate_lut()
+    {
+        std::lock_guard<std::mutex> l(_lut_mutex);
+        _lut.reset();
+    }
+
+    //! Return the table for the temperature closest to \p temperature
+    const flat_freq_table& _get_table(
+        const lookup_table& lut, const boost::optional<int> temperature) const
+    {
+        UHD_ASSERT_THROW(!lut.temps.empty());
         const int temp = bool(temperature) ? temperature.get() : _default_temp;
-        return at_nearest(_data, temp);
+        return lut.tables[get_nearest_index(lut.temps, temp)];
     }
 
     std::string _name;
@@ -343,6 +460,10 @@ private:
     std::map<int /* temp */, freq_table_map> _data;
     double _ref_gain  = 0.0;
     int _default_temp = NORMAL_TEMPERATURE;
+
+    //! Flattened copy of _data, see _get_lut()
+    mutable std::shared_ptr<const lookup_table> _lut;
+    mutable std::mutex _lut_mutex;
 };
 
 
@@ -0,0 +1,101 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*! Convert 8 fc32 samples to sc16, 4 samples per 256-bit input vector
+ *
+ * The scaled values are converted to int32 and packed with signed saturation
+ * into int16 I/Q pairs. _mm256_packs_epi32() operates on 128-bit lanes, so the
+ * 64-bit blocks need to be put back into order afterwards. If \p swap is true,
+ * \p shuf then reorders the bytes into the wire format.
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE void fc32_to_sc16_8x(const fc32_t* input,
+    item32_t* output,
+    const __m256i& shuf,
+    const __m256& scalar)
+{
+    const __m256 tmp0 = _mm256_loadu_ps(reinterpret_cast<const float*>(input + 0));
+    const __m256 tmp1 = _mm256_loadu_ps(reinterpret_cast<const float*>(input + 4));
+
+    const __m256i tmpi0 = _mm256_cvtps_epi32(_mm256_mul_ps(tmp0, scalar));
+    const __m256i tmpi1 = _mm256_cvtps_epi32(_mm256_mul_ps(tmp1, scalar));
+
+    __m256i tmpi = _mm256_packs_epi32(tmpi0, tmpi1);
+    tmpi         = _mm256_permute4x64_epi64(tmpi, _MM_SHUFFLE(3, 1, 2, 0));
+    if (swap) {
+        tmpi = _mm256_shuffle_epi8(tmpi, shuf);
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), tmpi);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+    // swap 16-bit pairs: I/Q -> Q/I
+    const __m256i shuf = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14,
+        15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        fc32_to_sc16_8x<true>(input + i, output + i, shuf, scalar);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+    // byteswap 16-bit words
+    const __m256i shuf = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13,
+        12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        fc32_to_sc16_8x<true>(input + i, output + i, shuf, scalar);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+    // CHDR samples are I/Q pairs in host order, no shuffle required
+    const __m256i shuf = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        fc32_to_sc16_8x<false>(
+            input + i, reinterpret_cast<item32_t*>(output + i), shuf, scalar);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,162 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_pack_sc12.hpp"
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+/*
+ * Every int32 of the input holds the I (lower half) and the Q (upper half) of
+ * a sample. Both are reduced to their upper 12 bits, and packed into the lower
+ * 24 bits of the int32:
+ *
+ *  ---------------------------------------
+ * |      0      |     I0     |     Q0     |
+ *  ---------------------------------------
+ * | 31       24 | 23      12 | 11       0 |
+ *
+ * A byte shuffle then moves the 3 bytes of each sample into wire order, which
+ * leaves 12 bytes (4 samples) per 128-bit lane. For sc12_item32_le, sample 0
+ * (the upper 24 bits of line 0) occupies bytes 3, 2, and 1.
+ */
+#define SC12_PACK_SHUFFLE_LE 6, 0, 1, 2, 9, 10, 4, 5, 12, 13, 14, 8, -1, -1, -1, -1
+#define SC12_PACK_SHUFFLE_BE 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE __m256i load_sc16_8x(const sc16_t* input, const __m256&)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+}
+
+//! Scale 8 fc32 samples, and return them as sc16 with 12 significant bits
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE __m256i load_sc16_8x(const fc32_t* input, const __m256& scalar)
+{
+    const __m256 tmp0 = _mm256_loadu_ps(reinterpret_cast<const float*>(input + 0));
+    const __m256 tmp1 = _mm256_loadu_ps(reinterpret_cast<const float*>(input + 4));
+
+    const __m256i tmpi0 = _mm256_cvtps_epi32(_mm256_mul_ps(tmp0, scalar));
+    const __m256i tmpi1 = _mm256_cvtps_epi32(_mm256_mul_ps(tmp1, scalar));
+
+    // align the 12 bits to the top, the pack saturates them
+    const __m256i lo = _mm256_slli_epi32(tmpi0, 4);
+    const __m256i hi = _mm256_slli_epi32(tmpi1, 4);
+
+    // the pack operates on 128-bit lanes, put the samples back into order
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+//! Pack 8 sc16 samples into 2 item32_sc12_3x
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE void pack_sc12_8x(
+    const __m256i& in, item32_sc12_3x* output, const __m256i& shuf)
+{
+    const __m256i mask = _mm256_set1_epi32(0xfff0);
+    const __m256i i    = _mm256_slli_epi32(_mm256_and_si256(in, mask), 8);
+    const __m256i q    = _mm256_srli_epi32(in, 20);
+    __m256i tmp        = _mm256_shuffle_epi8(_mm256_or_si256(i, q), shuf);
+    // close the gap between the lanes, and write exactly 24 bytes
+    tmp = _mm256_permutevar8x32_epi32(tmp, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+    __m128i* out = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(out, _mm256_castsi256_si128(tmp));
+    _mm_storel_epi64(out + 1, _mm256_extracti128_si256(tmp, 1));
+}
+
+template <typename type, towire32_type towire, bool wire_le>
+struct convert_star_1_to_sc12_item32_avx2 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        convert(inputs, outputs, nsamps);
+    }
+
+    UHD_CONVERT_TARGET("avx2")
+    void convert(
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+    {
+        const std::complex<type>* input =
+            reinterpret_cast<const std::complex<type>*>(inputs[0]);
+        item32_sc12_3x* output;
+
+        size_t i = convert_star_to_sc12_item32_head<type, towire>(
+            input, outputs[0], _scalar, output);
+        if (i >= nsamps) {
+            return;
+        }
+
+        const __m256 scalar     = _mm256_set1_ps(float(_scalar));
+        const __m128i shuf_lane = wire_le ? _mm_setr_epi8(SC12_PACK_SHUFFLE_LE)
+                                          : _mm_setr_epi8(SC12_PACK_SHUFFLE_BE);
+        const __m256i shuf      = _mm256_broadcastsi128_si256(shuf_lane);
+        for (; i + 7 < nsamps; i += 8, output += 2) {
+            pack_sc12_8x(load_sc16_8x(input + i, scalar), output, shuf);
+        }
+
+        convert_star_to_sc12_item32_tail<type, towire>(
+            input + i, output, nsamps - i, _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx2<float, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_be_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx2<float, uhd::ntohx, false>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx2<short, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_be_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx2<short, uhd::ntohx, false>());
+}
+
+UHD_STATIC_BLOCK(register_avx2_pack_sc12)
+{
+    if (!uhd::cpu::has_avx2()) {
+        return;
+    }
+
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.input_format  = "fc32";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD_AVX2);
+    id.output_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_be_1, PRIORITY_SIMD_AVX2);
+
+    id.input_format  = "sc16";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD_AVX2);
+    id.output_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_be_1, PRIORITY_SIMD_AVX2);
+}
@@ -0,0 +1,164 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+//! Return a vector which contains \p c in every I/Q pair
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE __m256 broadcast_iq(const fc32_t& c)
+{
+    const __m128 tmp = _mm_setr_ps(c.real(), c.imag(), c.real(), c.imag());
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(tmp), tmp, 1);
+}
+
+/*! Apply an IQ-balance/DC-offset correction to 4 scaled fc32 samples
+ *
+ * \p dc and \p iq contain the DC offset and the IQ-balance correction in
+ * every I/Q pair. The I value of every sample is duplicated into both lanes so
+ * that the magnitude and phase corrections are a single multiply-add.
+ */
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE __m256 apply_correction_4x(const __m256 y, const __m256& dc, const __m256& iq)
+{
+    const __m256 tmp = _mm256_add_ps(y, dc);
+    return _mm256_add_ps(tmp, _mm256_mul_ps(_mm256_moveldup_ps(tmp), iq));
+}
+
+/*! Convert 8 sc16 samples to fc32, 4 samples per 128-bit input vector
+ *
+ * If \p swap is true, \p shuf reorders the bytes of the input such that it
+ * contains I/Q pairs of little-endian int16 values. Each int16 is then
+ * sign-extended to int32, converted to float and scaled. If \p correct is
+ * true, the correction is applied before the samples are stored.
+ */
+template <bool swap, bool correct>
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE void sc16_to_fc32_8x(const item32_t* input,
+    fc32_t* output,
+    const __m128i& shuf,
+    const __m256& scalar,
+    const __m256& dc,
+    const __m256& iq)
+{
+    __m128i tmpi0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 0));
+    __m128i tmpi1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 4));
+    if (swap) {
+        tmpi0 = _mm_shuffle_epi8(tmpi0, shuf);
+        tmpi1 = _mm_shuffle_epi8(tmpi1, shuf);
+    }
+
+    __m256 tmp0 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(tmpi0)), scalar);
+    __m256 tmp1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(tmpi1)), scalar);
+    if (correct) {
+        tmp0 = apply_correction_4x(tmp0, dc, iq);
+        tmp1 = apply_correction_4x(tmp1, dc, iq);
+    }
+
+    _mm256_storeu_ps(reinterpret_cast<float*>(output + 0), tmp0);
+    _mm256_storeu_ps(reinterpret_cast<float*>(output + 4), tmp1);
+}
+
+/*! Convert the samples which fill whole vectors
+ *
+ * \return the number of samples converted
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE size_t sc16_to_fc32_bulk(const item32_t* input,
+    fc32_t* output,
+    const size_t nsamps,
+    const __m128i& shuf,
+    const double scale_factor,
+    const bool corr_enabled,
+    const fc32_t& iq_corr,
+    const fc32_t& dc_offset)
+{
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+    const __m256 dc     = broadcast_iq(dc_offset);
+    const __m256 iq     = broadcast_iq(iq_corr);
+
+    size_t i = 0;
+    if (corr_enabled) {
+        for (; i + 7 < nsamps; i += 8) {
+            sc16_to_fc32_8x<swap, true>(input + i, output + i, shuf, scalar, dc, iq);
+        }
+    } else {
+        for (; i + 7 < nsamps; i += 8) {
+            sc16_to_fc32_8x<swap, false>(input + i, output + i, shuf, scalar, dc, iq);
+        }
+    }
+    return i;
+}
+
+DECLARE_CORRECTING_CONVERTER_TARGET(
+    sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // swap 16-bit pairs: Q/I -> I/Q
+    const __m128i shuf =
+        _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+
+    const size_t i = sc16_to_fc32_bulk<true>(
+        input, output, nsamps, shuf, scale_factor, corr_enabled, iq_corr, dc_offset);
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
+}
+
+DECLARE_CORRECTING_CONVERTER_TARGET(
+    sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // byteswap 16-bit words
+    const __m128i shuf =
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    const size_t i = sc16_to_fc32_bulk<true>(
+        input, output, nsamps, shuf, scale_factor, corr_enabled, iq_corr, dc_offset);
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
+}
+
+DECLARE_CORRECTING_CONVERTER_TARGET(
+    sc16_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // CHDR samples are already I/Q pairs in host order, no shuffle required
+    const __m128i shuf = _mm_setzero_si128();
+
+    const size_t i = sc16_to_fc32_bulk<false>(reinterpret_cast<const item32_t*>(input),
+        output,
+        nsamps,
+        shuf,
+        scale_factor,
+        corr_enabled,
+        iq_corr,
+        dc_offset);
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
+}
@@ -0,0 +1,92 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+//! Sign-extend 8 int16 values to int32, then scale and round them
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE __m256i scale_s16_8x(const __m128i& in, const __m256& scalar)
+{
+    const __m256 tmp = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(in));
+    return _mm256_cvtps_epi32(_mm256_mul_ps(tmp, scalar));
+}
+
+/*! Convert 16 sc16 samples to sc8 (8 item32s)
+ *
+ * The scaled values are packed with signed saturation, first into int16 and
+ * then into int8. The pack instructions operate on 128-bit lanes, so the
+ * 32-bit blocks need to be put back into order afterwards. If \p swap is true,
+ * \p shuf then reorders the bytes into the wire format.
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE void sc16_to_sc8_16x(const sc16_t* input,
+    item32_t* output,
+    const __m256i& shuf,
+    const __m256& scalar)
+{
+    const __m256i tmp0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+    const __m256i tmp1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 8));
+
+    const __m256i tmpi0 = scale_s16_8x(_mm256_castsi256_si128(tmp0), scalar);
+    const __m256i tmpi1 = scale_s16_8x(_mm256_extracti128_si256(tmp0, 1), scalar);
+    const __m256i tmpi2 = scale_s16_8x(_mm256_castsi256_si128(tmp1), scalar);
+    const __m256i tmpi3 = scale_s16_8x(_mm256_extracti128_si256(tmp1, 1), scalar);
+
+    const __m256i lo = _mm256_packs_epi32(tmpi0, tmpi1);
+    const __m256i hi = _mm256_packs_epi32(tmpi2, tmpi3);
+    __m256i tmpi     = _mm256_packs_epi16(lo, hi);
+    tmpi = _mm256_permutevar8x32_epi32(tmpi, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    if (swap) {
+        tmpi = _mm256_shuffle_epi8(tmpi, shuf);
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), tmpi);
+}
+
+DECLARE_CONVERTER_TARGET(
+    sc16, 1, sc8_item32_be, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor / 32767.));
+    // big-endian sc8 items are I/Q pairs in sample order, no shuffle required
+    const __m256i shuf = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (size_t j = 0; i + 15 < nsamps; i += 16, j += 8) {
+        sc16_to_sc8_16x<false>(input + i, output + j, shuf, scalar);
+    }
+
+    // convert remainder
+    sc16_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    sc16, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX2, "avx2", uhd::cpu::has_avx2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor / 32767.));
+    // reverse the bytes of every item32
+    const __m256i shuf = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15,
+        14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    size_t i = 0;
+    for (size_t j = 0; i + 15 < nsamps; i += 16, j += 8) {
+        sc16_to_sc8_16x<true>(input + i, output + j, shuf, scalar);
+    }
+
+    // convert remainder
+    sc16_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
@@ -0,0 +1,158 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+/*
+ * Every 128-bit lane gets the 12 bytes of an item32_sc12_3x (4 samples). A
+ * byte shuffle then collects the 2 bytes which hold each 12-bit number into a
+ * 16-bit element, high byte first in wire order:
+ *
+ *  ---------------------------------------
+ * | Q3 | I3 | Q2 | I2 | Q1 | I1 | Q0 | I0 |
+ *  ---------------------------------------
+ * | 127                                 0 |
+ *
+ * The I values then fill the upper 12 bits of their element already, while the
+ * Q values start 4 bits lower. For sc12_item32_le, I0 is byte 3 and the upper
+ * half of byte 2.
+ */
+#define SC12_UNPACK_SHUFFLE_LE 2, 3, 1, 2, 7, 0, 6, 7, 4, 5, 11, 4, 9, 10, 8, 9
+#define SC12_UNPACK_SHUFFLE_BE 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+
+//! Unpack 2 item32_sc12_3x into 8 sc16 samples
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE __m256i unpack_sc12_8x(const item32_sc12_3x* input, const __m256i& shuf)
+{
+    // read exactly 24 bytes, then give each lane its 12 bytes
+    const __m128i* in = reinterpret_cast<const __m128i*>(input);
+    const __m128i lo  = _mm_loadu_si128(in);
+    const __m128i hi  = _mm_loadl_epi64(in + 1);
+    __m256i tmp       = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    tmp = _mm256_permutevar8x32_epi32(tmp, _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 5));
+    tmp = _mm256_shuffle_epi8(tmp, shuf);
+
+    const __m256i i = _mm256_and_si256(tmp, _mm256_set1_epi32(0x0000fff0));
+    const __m256i q = _mm256_and_si256(
+        _mm256_slli_epi16(tmp, 4), _mm256_set1_epi32(int32_t(0xfff00000)));
+    return _mm256_or_si256(i, q);
+}
+
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE void store_sc16_8x(const __m256i& in, sc16_t* output, const __m256&)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), in);
+}
+
+UHD_CONVERT_TARGET("avx2")
+UHD_INLINE void store_sc16_8x(const __m256i& in, fc32_t* output, const __m256& scalar)
+{
+    const __m256i tmpi0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(in));
+    const __m256i tmpi1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(in, 1));
+
+    const __m256 tmp0 = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpi0), scalar);
+    const __m256 tmp1 = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpi1), scalar);
+
+    _mm256_storeu_ps(reinterpret_cast<float*>(output + 0), tmp0);
+    _mm256_storeu_ps(reinterpret_cast<float*>(output + 4), tmp1);
+}
+
+template <typename type, tohost32_type tohost, bool wire_le>
+struct convert_sc12_item32_1_to_star_avx2 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        convert(inputs, outputs, nsamps);
+    }
+
+    UHD_CONVERT_TARGET("avx2")
+    void convert(
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+    {
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        const item32_sc12_3x* input;
+
+        size_t o = convert_sc12_item32_to_star_head<type, tohost>(
+            inputs[0], output, _scalar, input);
+        if (o >= nsamps) {
+            return;
+        }
+
+        const __m256 scalar     = _mm256_set1_ps(float(_scalar));
+        const __m128i shuf_lane = wire_le ? _mm_setr_epi8(SC12_UNPACK_SHUFFLE_LE)
+                                          : _mm_setr_epi8(SC12_UNPACK_SHUFFLE_BE);
+        const __m256i shuf      = _mm256_broadcastsi128_si256(shuf_lane);
+        for (; o + 7 < nsamps; o += 8, input += 2) {
+            store_sc16_8x(unpack_sc12_8x(input, shuf), output + o, scalar);
+        }
+
+        convert_sc12_item32_to_star_tail<type, tohost>(
+            input, output + o, nsamps - o, _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx2<float, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_fc32_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx2<float, uhd::ntohx, false>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx2<short, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_sc16_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx2<short, uhd::ntohx, false>());
+}
+
+UHD_STATIC_BLOCK(register_avx2_unpack_sc12)
+{
+    if (!uhd::cpu::has_avx2()) {
+        return;
+    }
+
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.output_format = "fc32";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD_AVX2);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_fc32_1, PRIORITY_SIMD_AVX2);
+
+    id.output_format = "sc16";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD_AVX2);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_sc16_1, PRIORITY_SIMD_AVX2);
+}
@@ -0,0 +1,102 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*! Convert 16 fc32 samples to sc16, 8 samples per 512-bit input vector
+ *
+ * The scaled values are converted to int32 and narrowed to int16 with signed
+ * saturation. Unlike the SSE2/AVX2 pack instructions, _mm512_cvtsepi32_epi16()
+ * preserves the element order. If \p swap is true, \p shuf then reorders the
+ * bytes into the wire format.
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE void fc32_to_sc16_16x(const fc32_t* input,
+    item32_t* output,
+    const __m256i& shuf,
+    const __m512& scalar)
+{
+    const __m512 tmp0 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + 0));
+    const __m512 tmp1 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + 8));
+
+    __m256i tmpi0 =
+        _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(_mm512_mul_ps(tmp0, scalar)));
+    __m256i tmpi1 =
+        _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(_mm512_mul_ps(tmp1, scalar)));
+    if (swap) {
+        tmpi0 = _mm256_shuffle_epi8(tmpi0, shuf);
+        tmpi1 = _mm256_shuffle_epi8(tmpi1, shuf);
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 0), tmpi0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 8), tmpi1);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // swap 16-bit pairs: I/Q -> Q/I
+    const __m256i shuf = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14,
+        15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+
+    size_t i = 0;
+    for (; i + 15 < nsamps; i += 16) {
+        fc32_to_sc16_16x<true>(input + i, output + i, shuf, scalar);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // byteswap 16-bit words
+    const __m256i shuf = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13,
+        12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    size_t i = 0;
+    for (; i + 15 < nsamps; i += 16) {
+        fc32_to_sc16_16x<true>(input + i, output + i, shuf, scalar);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // CHDR samples are I/Q pairs in host order, no shuffle required
+    const __m256i shuf = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 15 < nsamps; i += 16) {
+        fc32_to_sc16_16x<false>(
+            input + i, reinterpret_cast<item32_t*>(output + i), shuf, scalar);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,74 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*! Convert 8 fc32 samples to sc8 (4 item32s)
+ *
+ * The scaled values are converted to int32 and narrowed to int8 with signed
+ * saturation, which preserves the element order. If \p swap is true, \p shuf
+ * then reorders the bytes into the wire format.
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE void fc32_to_sc8_8x(const fc32_t* input,
+    item32_t* output,
+    const __m128i& shuf,
+    const __m512& scalar)
+{
+    const __m512 tmp = _mm512_loadu_ps(reinterpret_cast<const float*>(input));
+
+    __m128i tmpi = _mm512_cvtsepi32_epi8(_mm512_cvtps_epi32(_mm512_mul_ps(tmp, scalar)));
+    if (swap) {
+        tmpi = _mm_shuffle_epi8(tmpi, shuf);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), tmpi);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc8_item32_be, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // big-endian sc8 items are I/Q pairs in sample order, no shuffle required
+    const __m128i shuf = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        fc32_to_sc8_8x<false>(input + i, output + j, shuf, scalar);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // reverse the bytes of every item32
+    const __m128i shuf =
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        fc32_to_sc8_8x<true>(input + i, output + j, shuf, scalar);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
@@ -0,0 +1,194 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*! Convert 16 floats to fc16 (\p bf16 false) or bf16 values
+ *
+ * Both round to nearest even. AVX-512F converts to IEEE half precision itself,
+ * bfloat16 numbers are the upper halves of the rounded floats.
+ */
+template <bool bf16>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE __m256i ps_to_x16_16x(const __m512& in)
+{
+    if (!bf16) {
+        return _mm512_cvtps_ph(in, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    const __m512i tmp = _mm512_castps_si512(in);
+    // round to nearest even: add 0x7fff plus the lowest bit that is kept
+    const __m512i odd =
+        _mm512_and_si512(_mm512_srli_epi32(tmp, 16), _mm512_set1_epi32(1));
+    const __m512i out = _mm512_srli_epi32(
+        _mm512_add_epi32(_mm512_add_epi32(tmp, odd), _mm512_set1_epi32(0x7fff)), 16);
+    return _mm512_cvtepi32_epi16(out);
+}
+
+//! Convert 16 fc16 (\p bf16 false) or bf16 values to floats
+template <bool bf16>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE __m512 x16_to_ps_16x(const __m256i& in)
+{
+    if (!bf16) {
+        return _mm512_cvtph_ps(in);
+    }
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(in), 16));
+}
+
+/*! Convert the sc16 samples which fill whole vectors, 8 samples at a time
+ *
+ * If \p swap is true, \p shuf reorders the bytes of the input such that it
+ * contains I/Q pairs of int16 values in host order.
+ *
+ * \return the number of samples converted
+ */
+template <bool bf16, bool swap>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE size_t sc16_to_x16_bulk(const void* in,
+    uint16_t* output,
+    const size_t nsamps,
+    const __m256i& shuf,
+    const double scale_factor)
+{
+    const __m256i* input = reinterpret_cast<const __m256i*>(in);
+    const __m512 scalar  = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        __m256i tmpi = _mm256_loadu_si256(input + i / 8);
+        if (swap) {
+            tmpi = _mm256_shuffle_epi8(tmpi, shuf);
+        }
+        const __m512 tmp = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(tmpi));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2 * i),
+            ps_to_x16_16x<bf16>(_mm512_mul_ps(tmp, scalar)));
+    }
+    return i;
+}
+
+/*! Convert the 16-bit float samples which fill whole vectors to sc16
+ *
+ * The scaled values are rounded, and saturated to int16. If \p swap is true,
+ * \p shuf then reorders the bytes into the wire format.
+ *
+ * \return the number of samples converted
+ */
+template <bool bf16, bool swap>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE size_t x16_to_sc16_bulk(const uint16_t* input,
+    void* out,
+    const size_t nsamps,
+    const __m256i& shuf,
+    const double scale_factor)
+{
+    __m256i* output     = reinterpret_cast<__m256i*>(out);
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        const __m256i tmp =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 2 * i));
+        const __m512i tmpi =
+            _mm512_cvtps_epi32(_mm512_mul_ps(x16_to_ps_16x<bf16>(tmp), scalar));
+        __m256i outi = _mm512_cvtsepi32_epi16(tmpi);
+        if (swap) {
+            outi = _mm256_shuffle_epi8(outi, shuf);
+        }
+        _mm256_storeu_si256(output + i / 8, outi);
+    }
+    return i;
+}
+
+//! Return the byte shuffle between sc16_item32_le/be and host order I/Q pairs
+template <bool wire_le>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE __m256i sc16_item32_shuffle()
+{
+    // swap 16-bit pairs (Q/I -> I/Q), or byteswap 16-bit words
+    const __m128i shuf =
+        wire_le ? _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13)
+                : _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    return _mm256_broadcastsi128_si256(shuf);
+}
+
+#define __DECLARE_X16_CONVERTER_AVX512(                                              \
+    cpu_type, bf16, to_x16, to_f32, xe, wire_le, htoxx, xxtoh)                       \
+    DECLARE_CONVERTER_TARGET(cpu_type,                                               \
+        1,                                                                           \
+        sc16_item32_##xe,                                                            \
+        1,                                                                           \
+        PRIORITY_SIMD_AVX512,                                                        \
+        "avx512f",                                                                   \
+        uhd::cpu::has_avx512f)                                                       \
+    {                                                                                \
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(inputs[0]);        \
+        item32_t* output      = reinterpret_cast<item32_t*>(outputs[0]);             \
+        const __m256i shuf    = sc16_item32_shuffle<wire_le>();                      \
+        const size_t i =                                                             \
+            x16_to_sc16_bulk<bf16, true>(input, output, nsamps, shuf, scale_factor); \
+        x16_to_item32_sc16<htoxx, to_f32>(                                           \
+            input + 2 * i, output + i, nsamps - i, scale_factor);                    \
+    }                                                                                \
+    DECLARE_CONVERTER_TARGET(sc16_item32_##xe,                                       \
+        1,                                                                           \
+        cpu_type,                                                                    \
+        1,                                                                           \
+        PRIORITY_SIMD_AVX512,                                                        \
+        "avx512f",                                                                   \
+        uhd::cpu::has_avx512f)                                                       \
+    {                                                                                \
+        const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);        \
+        uint16_t* output      = reinterpret_cast<uint16_t*>(outputs[0]);             \
+        const __m256i shuf    = sc16_item32_shuffle<wire_le>();                      \
+        const size_t i =                                                             \
+            sc16_to_x16_bulk<bf16, true>(input, output, nsamps, shuf, scale_factor); \
+        item32_sc16_to_x16<xxtoh, to_x16>(                                           \
+            input + i, output + 2 * i, nsamps - i, scale_factor);                    \
+    }
+
+#define _DECLARE_X16_CONVERTER_AVX512(cpu_type, bf16, to_x16, to_f32)                  \
+    __DECLARE_X16_CONVERTER_AVX512(                                                    \
+        cpu_type, bf16, to_x16, to_f32, be, false, uhd::htonx, uhd::ntohx)             \
+    __DECLARE_X16_CONVERTER_AVX512(                                                    \
+        cpu_type, bf16, to_x16, to_f32, le, true, uhd::htowx, uhd::wtohx)              \
+    DECLARE_CONVERTER_TARGET(cpu_type,                                                 \
+        1,                                                                             \
+        sc16_chdr,                                                                     \
+        1,                                                                             \
+        PRIORITY_SIMD_AVX512,                                                          \
+        "avx512f",                                                                     \
+        uhd::cpu::has_avx512f)                                                         \
+    {                                                                                  \
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(inputs[0]);          \
+        sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);                 \
+        const size_t i        = x16_to_sc16_bulk<bf16, false>(                         \
+            input, output, nsamps, _mm256_setzero_si256(), scale_factor);              \
+        x16_to_chdr_sc16<to_f32>(input + 2 * i, output + i, nsamps - i, scale_factor); \
+    }                                                                                  \
+    DECLARE_CONVERTER_TARGET(sc16_chdr,                                                \
+        1,                                                                             \
+        cpu_type,                                                                      \
+        1,                                                                             \
+        PRIORITY_SIMD_AVX512,                                                          \
+        "avx512f",                                                                     \
+        uhd::cpu::has_avx512f)                                                         \
+    {                                                                                  \
+        const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);              \
+        uint16_t* output    = reinterpret_cast<uint16_t*>(outputs[0]);                 \
+        const size_t i      = sc16_to_x16_bulk<bf16, false>(                           \
+            input, output, nsamps, _mm256_setzero_si256(), scale_factor);              \
+        chdr_sc16_to_x16<to_x16>(input + i, output + 2 * i, nsamps - i, scale_factor); \
+    }
+
+/* Create fc16<->sc16(otw) */
+_DECLARE_X16_CONVERTER_AVX512(fc16, false, f32_to_f16_x1, f16_x1_to_f32)
+/* Create bf16<->sc16(otw) */
+_DECLARE_X16_CONVERTER_AVX512(bf16, true, f32_to_bf16_x1, bf16_x1_to_f32)
@@ -0,0 +1,163 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_pack_sc12.hpp"
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+/*
+ * Every int32 of the input holds the I (lower half) and the Q (upper half) of
+ * a sample. Both are reduced to their upper 12 bits, and packed into the lower
+ * 24 bits of the int32:
+ *
+ *  ---------------------------------------
+ * |      0      |     I0     |     Q0     |
+ *  ---------------------------------------
+ * | 31       24 | 23      12 | 11       0 |
+ *
+ * A byte shuffle then moves the 3 bytes of each sample into wire order, which
+ * leaves 12 bytes (4 samples) per 128-bit lane. For sc12_item32_le, sample 0
+ * (the upper 24 bits of line 0) occupies bytes 3, 2, and 1.
+ */
+#define SC12_PACK_SHUFFLE_LE 6, 0, 1, 2, 9, 10, 4, 5, 12, 13, 14, 8, -1, -1, -1, -1
+#define SC12_PACK_SHUFFLE_BE 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+UHD_CONVERT_TARGET("avx512f,avx512bw")
+UHD_INLINE __m512i load_sc16_16x(const sc16_t* input, const __m512&)
+{
+    return _mm512_loadu_si512(input);
+}
+
+/*! Scale 16 fc32 samples, and return them as sc16 with 12 significant bits
+ *
+ * Unlike the AVX2 pack instructions, _mm512_cvtsepi32_epi16() preserves the
+ * element order.
+ */
+UHD_CONVERT_TARGET("avx512f,avx512bw")
+UHD_INLINE __m512i load_sc16_16x(const fc32_t* input, const __m512& scalar)
+{
+    const __m512 tmp0 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + 0));
+    const __m512 tmp1 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + 8));
+
+    const __m512i tmpi0 = _mm512_cvtps_epi32(_mm512_mul_ps(tmp0, scalar));
+    const __m512i tmpi1 = _mm512_cvtps_epi32(_mm512_mul_ps(tmp1, scalar));
+
+    // align the 12 bits to the top, the narrowing saturates them
+    const __m256i lo = _mm512_cvtsepi32_epi16(_mm512_slli_epi32(tmpi0, 4));
+    const __m256i hi = _mm512_cvtsepi32_epi16(_mm512_slli_epi32(tmpi1, 4));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+}
+
+//! Pack 16 sc16 samples into 4 item32_sc12_3x
+UHD_CONVERT_TARGET("avx512f,avx512bw")
+UHD_INLINE void pack_sc12_16x(
+    const __m512i& in, item32_sc12_3x* output, const __m512i& shuf)
+{
+    const __m512i mask = _mm512_set1_epi32(0xfff0);
+    const __m512i i    = _mm512_slli_epi32(_mm512_and_si512(in, mask), 8);
+    const __m512i q    = _mm512_srli_epi32(in, 20);
+    __m512i tmp        = _mm512_shuffle_epi8(_mm512_or_si512(i, q), shuf);
+    // close the gaps between the lanes, and write exactly 48 bytes
+    const __m512i idx =
+        _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15);
+    tmp = _mm512_permutexvar_epi32(idx, tmp);
+    _mm512_mask_storeu_epi32(output, 0x0fff, tmp);
+}
+
+template <typename type, towire32_type towire, bool wire_le>
+struct convert_star_1_to_sc12_item32_avx512 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        convert(inputs, outputs, nsamps);
+    }
+
+    UHD_CONVERT_TARGET("avx512f,avx512bw")
+    void convert(
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+    {
+        const std::complex<type>* input =
+            reinterpret_cast<const std::complex<type>*>(inputs[0]);
+        item32_sc12_3x* output;
+
+        size_t i = convert_star_to_sc12_item32_head<type, towire>(
+            input, outputs[0], _scalar, output);
+        if (i >= nsamps) {
+            return;
+        }
+
+        const __m512 scalar     = _mm512_set1_ps(float(_scalar));
+        const __m128i shuf_lane = wire_le ? _mm_setr_epi8(SC12_PACK_SHUFFLE_LE)
+                                          : _mm_setr_epi8(SC12_PACK_SHUFFLE_BE);
+        const __m512i shuf      = _mm512_broadcast_i32x4(shuf_lane);
+        for (; i + 15 < nsamps; i += 16, output += 4) {
+            pack_sc12_16x(load_sc16_16x(input + i, scalar), output, shuf);
+        }
+
+        convert_star_to_sc12_item32_tail<type, towire>(
+            input + i, output, nsamps - i, _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx512<float, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_be_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx512<float, uhd::ntohx, false>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx512<short, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_be_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_avx512<short, uhd::ntohx, false>());
+}
+
+UHD_STATIC_BLOCK(register_avx512_pack_sc12)
+{
+    if (!uhd::cpu::has_avx512bw()) {
+        return;
+    }
+
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.input_format  = "fc32";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD_AVX512);
+    id.output_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_be_1, PRIORITY_SIMD_AVX512);
+
+    id.input_format  = "sc16";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD_AVX512);
+    id.output_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_be_1, PRIORITY_SIMD_AVX512);
+}
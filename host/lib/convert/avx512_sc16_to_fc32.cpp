@@ -0,0 +1,163 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+//! Return a vector which contains \p c in every I/Q pair
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE __m512 broadcast_iq(const fc32_t& c)
+{
+    return _mm512_setr4_ps(c.real(), c.imag(), c.real(), c.imag());
+}
+
+/*! Apply an IQ-balance/DC-offset correction to 8 scaled fc32 samples
+ *
+ * \p dc and \p iq contain the DC offset and the IQ-balance correction in
+ * every I/Q pair. The I value of every sample is duplicated into both lanes so
+ * that the magnitude and phase corrections are a single multiply-add.
+ */
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE __m512 apply_correction_8x(const __m512 y, const __m512& dc, const __m512& iq)
+{
+    const __m512 tmp = _mm512_add_ps(y, dc);
+    return _mm512_add_ps(tmp, _mm512_mul_ps(_mm512_moveldup_ps(tmp), iq));
+}
+
+/*! Convert 16 sc16 samples to fc32, 8 samples per 256-bit input vector
+ *
+ * If \p swap is true, \p shuf reorders the bytes of the input such that it
+ * contains I/Q pairs of little-endian int16 values. Each int16 is then
+ * sign-extended to int32, converted to float and scaled. If \p correct is
+ * true, the correction is applied before the samples are stored.
+ */
+template <bool swap, bool correct>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE void sc16_to_fc32_16x(const item32_t* input,
+    fc32_t* output,
+    const __m256i& shuf,
+    const __m512& scalar,
+    const __m512& dc,
+    const __m512& iq)
+{
+    __m256i tmpi0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 0));
+    __m256i tmpi1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 8));
+    if (swap) {
+        tmpi0 = _mm256_shuffle_epi8(tmpi0, shuf);
+        tmpi1 = _mm256_shuffle_epi8(tmpi1, shuf);
+    }
+
+    __m512 tmp0 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(tmpi0)), scalar);
+    __m512 tmp1 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(tmpi1)), scalar);
+    if (correct) {
+        tmp0 = apply_correction_8x(tmp0, dc, iq);
+        tmp1 = apply_correction_8x(tmp1, dc, iq);
+    }
+
+    _mm512_storeu_ps(reinterpret_cast<float*>(output + 0), tmp0);
+    _mm512_storeu_ps(reinterpret_cast<float*>(output + 8), tmp1);
+}
+
+/*! Convert the samples which fill whole vectors
+ *
+ * \return the number of samples converted
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE size_t sc16_to_fc32_bulk(const item32_t* input,
+    fc32_t* output,
+    const size_t nsamps,
+    const __m256i& shuf,
+    const double scale_factor,
+    const bool corr_enabled,
+    const fc32_t& iq_corr,
+    const fc32_t& dc_offset)
+{
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    const __m512 dc     = broadcast_iq(dc_offset);
+    const __m512 iq     = broadcast_iq(iq_corr);
+
+    size_t i = 0;
+    if (corr_enabled) {
+        for (; i + 15 < nsamps; i += 16) {
+            sc16_to_fc32_16x<swap, true>(input + i, output + i, shuf, scalar, dc, iq);
+        }
+    } else {
+        for (; i + 15 < nsamps; i += 16) {
+            sc16_to_fc32_16x<swap, false>(input + i, output + i, shuf, scalar, dc, iq);
+        }
+    }
+    return i;
+}
+
+DECLARE_CORRECTING_CONVERTER_TARGET(
+    sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // swap 16-bit pairs: Q/I -> I/Q
+    const __m256i shuf = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14,
+        15, 12, 13, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+
+    const size_t i = sc16_to_fc32_bulk<true>(
+        input, output, nsamps, shuf, scale_factor, corr_enabled, iq_corr, dc_offset);
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
+}
+
+DECLARE_CORRECTING_CONVERTER_TARGET(
+    sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // byteswap 16-bit words
+    const __m256i shuf = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13,
+        12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    const size_t i = sc16_to_fc32_bulk<true>(
+        input, output, nsamps, shuf, scale_factor, corr_enabled, iq_corr, dc_offset);
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
+}
+
+DECLARE_CORRECTING_CONVERTER_TARGET(
+    sc16_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // CHDR samples are already I/Q pairs in host order, no shuffle required
+    const __m256i shuf = _mm256_setzero_si256();
+
+    const size_t i = sc16_to_fc32_bulk<false>(reinterpret_cast<const item32_t*>(input),
+        output,
+        nsamps,
+        shuf,
+        scale_factor,
+        corr_enabled,
+        iq_corr,
+        dc_offset);
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
+}
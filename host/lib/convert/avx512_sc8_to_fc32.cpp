@@ -0,0 +1,89 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*! Convert 8 sc8 samples (4 item32s) to fc32
+ *
+ * If \p swap is true, \p shuf reorders the bytes of the input such that it
+ * contains I/Q pairs of int8 values in sample order. Each int8 is then
+ * sign-extended to int32, converted to float and scaled.
+ */
+template <bool swap>
+UHD_CONVERT_TARGET("avx512f")
+UHD_INLINE void sc8_to_fc32_8x(const item32_t* input,
+    fc32_t* output,
+    const __m128i& shuf,
+    const __m512& scalar)
+{
+    __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    if (swap) {
+        tmpi = _mm_shuffle_epi8(tmpi, shuf);
+    }
+
+    const __m512 tmp =
+        _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(tmpi)), scalar);
+
+    _mm512_storeu_ps(reinterpret_cast<float*>(output), tmp);
+}
+
+DECLARE_CONVERTER_TARGET(
+    sc8_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // big-endian sc8 items are I/Q pairs in sample order, no shuffle required
+    const __m128i shuf = _mm_setzero_si128();
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::ntohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 7 < num_samps; j += 8, i += 4) {
+        sc8_to_fc32_8x<false>(input + i, output + j, shuf, scalar);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::ntohx>(input + i, output + j, num_samps - j, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(
+    sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX512, "avx512f", uhd::cpu::has_avx512f)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+    // reverse the bytes of every item32
+    const __m128i shuf =
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::wtohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 7 < num_samps; j += 8, i += 4) {
+        sc8_to_fc32_8x<true>(input + i, output + j, shuf, scalar);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::wtohx>(input + i, output + j, num_samps - j, scale_factor);
+}
@@ -0,0 +1,156 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <uhdlib/utils/cpu_features.hpp>
+#include <immintrin.h>
+
+/*
+ * Every 128-bit lane gets the 12 bytes of an item32_sc12_3x (4 samples). A
+ * byte shuffle then collects the 2 bytes which hold each 12-bit number into a
+ * 16-bit element, high byte first in wire order:
+ *
+ *  ---------------------------------------
+ * | Q3 | I3 | Q2 | I2 | Q1 | I1 | Q0 | I0 |
+ *  ---------------------------------------
+ * | 127                                 0 |
+ *
+ * The I values then fill the upper 12 bits of their element already, while the
+ * Q values start 4 bits lower. For sc12_item32_le, I0 is byte 3 and the upper
+ * half of byte 2.
+ */
+#define SC12_UNPACK_SHUFFLE_LE 2, 3, 1, 2, 7, 0, 6, 7, 4, 5, 11, 4, 9, 10, 8, 9
+#define SC12_UNPACK_SHUFFLE_BE 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+
+//! Unpack 4 item32_sc12_3x into 16 sc16 samples
+UHD_CONVERT_TARGET("avx512f,avx512bw")
+UHD_INLINE __m512i unpack_sc12_16x(const item32_sc12_3x* input, const __m512i& shuf)
+{
+    // read exactly 48 bytes, then give each lane its 12 bytes
+    const __m512i idx =
+        _mm512_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 11);
+    __m512i tmp = _mm512_maskz_loadu_epi32(0x0fff, input);
+    tmp         = _mm512_permutexvar_epi32(idx, tmp);
+    tmp         = _mm512_shuffle_epi8(tmp, shuf);
+
+    // align the Q values to the top
+    tmp = _mm512_mask_slli_epi16(tmp, 0xaaaaaaaa, tmp, 4);
+    return _mm512_and_si512(tmp, _mm512_set1_epi16(int16_t(0xfff0)));
+}
+
+UHD_CONVERT_TARGET("avx512f,avx512bw")
+UHD_INLINE void store_sc16_16x(const __m512i& in, sc16_t* output, const __m512&)
+{
+    _mm512_storeu_si512(output, in);
+}
+
+UHD_CONVERT_TARGET("avx512f,avx512bw")
+UHD_INLINE void store_sc16_16x(const __m512i& in, fc32_t* output, const __m512& scalar)
+{
+    const __m512i tmpi0 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(in));
+    const __m512i tmpi1 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(in, 1));
+
+    const __m512 tmp0 = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpi0), scalar);
+    const __m512 tmp1 = _mm512_mul_ps(_mm512_cvtepi32_ps(tmpi1), scalar);
+
+    _mm512_storeu_ps(reinterpret_cast<float*>(output + 0), tmp0);
+    _mm512_storeu_ps(reinterpret_cast<float*>(output + 8), tmp1);
+}
+
+template <typename type, tohost32_type tohost, bool wire_le>
+struct convert_sc12_item32_1_to_star_avx512 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        convert(inputs, outputs, nsamps);
+    }
+
+    UHD_CONVERT_TARGET("avx512f,avx512bw")
+    void convert(
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+    {
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        const item32_sc12_3x* input;
+
+        size_t o = convert_sc12_item32_to_star_head<type, tohost>(
+            inputs[0], output, _scalar, input);
+        if (o >= nsamps) {
+            return;
+        }
+
+        const __m512 scalar     = _mm512_set1_ps(float(_scalar));
+        const __m128i shuf_lane = wire_le ? _mm_setr_epi8(SC12_UNPACK_SHUFFLE_LE)
+                                          : _mm_setr_epi8(SC12_UNPACK_SHUFFLE_BE);
+        const __m512i shuf      = _mm512_broadcast_i32x4(shuf_lane);
+        for (; o + 15 < nsamps; o += 16, input += 4) {
+            store_sc16_16x(unpack_sc12_16x(input, shuf), output + o, scalar);
+        }
+
+        convert_sc12_item32_to_star_tail<type, tohost>(
+            input, output + o, nsamps - o, _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx512<float, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_fc32_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx512<float, uhd::ntohx, false>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx512<short, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_sc16_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_avx512<short, uhd::ntohx, false>());
+}
+
+UHD_STATIC_BLOCK(register_avx512_unpack_sc12)
+{
+    if (!uhd::cpu::has_avx512bw()) {
+        return;
+    }
+
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.output_format = "fc32";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD_AVX512);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_fc32_1, PRIORITY_SIMD_AVX512);
+
+    id.output_format = "sc16";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD_AVX512);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_sc16_1, PRIORITY_SIMD_AVX512);
+}
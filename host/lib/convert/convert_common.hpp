@@ -11,11 +11,14 @@
 #include <uhd/convert.hpp>
 #include <uhd/utils/static.hpp>
 #include <stdint.h>
+#include <cmath>
+#include <cstring>
 #include <limits>
 #include <complex>
+#include <type_traits>
 
-#define _DECLARE_CONVERTER(name, in_form, num_in, out_form, num_out, prio)    \
-    struct name : public uhd::convert::converter                              \
+#define _DECLARE_CONVERTER(name, base, in_form, num_in, out_form, num_out, prio) \
+    struct name : public base                                                     \
     {                                                                         \
         static sptr make(void)                                                \
         {                                                                     \
@@ -56,12 +59,109 @@
  */
 #define DECLARE_CONVERTER(in_form, num_in, out_form, num_out, prio)                      \
     _DECLARE_CONVERTER(__convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio, \
+        uhd::convert::converter,                                                         \
         in_form,                                                                         \
         num_in,                                                                          \
         out_form,                                                                        \
         num_out,                                                                         \
         prio)
 
+/*! Declare a converter which supports an IQ-balance/DC-offset correction
+ *
+ * This works like DECLARE_CONVERTER(), but the converter derives from
+ * correcting_converter. In addition to `scale_factor`, the function block can
+ * use `corr_enabled`, `iq_corr` and `dc_offset` (see
+ * uhd::convert::converter::set_correction()).
+ */
+#define DECLARE_CORRECTING_CONVERTER(in_form, num_in, out_form, num_out, prio)           \
+    _DECLARE_CONVERTER(__convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio, \
+        correcting_converter,                                                            \
+        in_form,                                                                         \
+        num_in,                                                                          \
+        out_form,                                                                        \
+        num_out,                                                                         \
+        prio)
+
+/*! Declare a converter which requires a specific instruction set extension
+ *
+ * This works like DECLARE_CONVERTER(), with two differences:
+ * - The conversion function is compiled for the target given by `isa`
+ *   (e.g., "avx2"), but the rest of the translation unit is not. That way,
+ *   no wider instructions end up in the static registration code.
+ * - The converter is only registered if `cpu_check()` returns true at
+ *   runtime. That way, the same binary can be used on CPUs with or without
+ *   the instruction set extension.
+ *
+ * On MSVC, intrinsics are always available and `isa` is ignored.
+ */
+#ifdef _MSC_VER
+#    define UHD_CONVERT_TARGET(isa)
+#else
+#    define UHD_CONVERT_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+#define _DECLARE_CONVERTER_TARGET(                                                \
+    name, base, in_form, num_in, out_form, num_out, prio, isa, cpu_check)         \
+    struct name : public base                                                     \
+    {                                                                             \
+        static sptr make(void)                                                    \
+        {                                                                         \
+            return sptr(new name());                                              \
+        }                                                                         \
+        double scale_factor;                                                      \
+        void set_scalar(const double s)                                           \
+        {                                                                         \
+            scale_factor = s;                                                     \
+        }                                                                         \
+        void operator()(                                                          \
+            const input_type& inputs, const output_type& outputs, const size_t n) \
+        {                                                                         \
+            convert(inputs, outputs, n);                                          \
+        }                                                                         \
+        UHD_CONVERT_TARGET(isa)                                                   \
+        void convert(const input_type&, const output_type&, const size_t);        \
+    };                                                                            \
+    UHD_STATIC_BLOCK(__register_##name##_##prio)                                  \
+    {                                                                             \
+        if (!cpu_check()) {                                                       \
+            return;                                                               \
+        }                                                                         \
+        uhd::convert::id_type id;                                                 \
+        id.input_format  = #in_form;                                              \
+        id.num_inputs    = num_in;                                                \
+        id.output_format = #out_form;                                             \
+        id.num_outputs   = num_out;                                               \
+        uhd::convert::register_converter(id, &name::make, prio);                  \
+    }                                                                             \
+    void name::convert(                                                           \
+        const input_type& inputs, const output_type& outputs, const size_t nsamps)
+
+#define DECLARE_CONVERTER_TARGET(in_form, num_in, out_form, num_out, prio, tgt, check) \
+    _DECLARE_CONVERTER_TARGET(                                                         \
+        __convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio,              \
+        uhd::convert::converter,                                                       \
+        in_form,                                                                       \
+        num_in,                                                                        \
+        out_form,                                                                      \
+        num_out,                                                                       \
+        prio,                                                                          \
+        tgt,                                                                           \
+        check)
+
+//! Like DECLARE_CONVERTER_TARGET(), for converters which support a correction
+#define DECLARE_CORRECTING_CONVERTER_TARGET(                                           \
+    in_form, num_in, out_form, num_out, prio, tgt, check)                              \
+    _DECLARE_CONVERTER_TARGET(                                                         \
+        __convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio,              \
+        correcting_converter,                                                          \
+        in_form,                                                                       \
+        num_in,                                                                        \
+        out_form,                                                                      \
+        num_out,                                                                       \
+        prio,                                                                          \
+        tgt,                                                                           \
+        check)
+
 /***********************************************************************
  * Setup priorities
  **********************************************************************/
@@ -76,6 +176,10 @@ static const int PRIORITY_TABLE =
 // We used to have ORC, too, so SIMD is 3
 static const int PRIORITY_SIMD  = 3;
 static const int PRIORITY_TABLE = 1;
+// Wider x86 SIMD converters are only registered if the CPU supports them (see
+// DECLARE_CONVERTER_TARGET), so they may outrank the SSE2 ones
+static const int PRIORITY_SIMD_AVX2   = 4;
+static const int PRIORITY_SIMD_AVX512 = 5;
 #endif
 
 /***********************************************************************
@@ -97,6 +201,42 @@ typedef uint32_t item32_t;
 
 typedef item32_t (*xtox_t)(item32_t);
 
+/***********************************************************************
+ * IQ-balance and DC-offset correction
+ **********************************************************************/
+//! Base class for converters which implement set_correction()
+class correcting_converter : public uhd::convert::converter
+{
+public:
+    bool set_correction(
+        const std::complex<double>& iq_balance, const std::complex<double>& dc) override
+    {
+        iq_corr      = fc32_t(iq_balance);
+        dc_offset    = fc32_t(dc);
+        corr_enabled = iq_balance != 0.0 || dc != 0.0;
+        return true;
+    }
+
+protected:
+    bool corr_enabled = false;
+    fc32_t iq_corr;
+    fc32_t dc_offset;
+};
+
+/*! Apply an IQ-balance/DC-offset correction to already scaled samples in place
+ *
+ * The SIMD converters use this for the samples which don't fill a vector.
+ */
+UHD_INLINE void apply_correction(
+    fc32_t* buf, const size_t nsamps, const fc32_t& iq_corr, const fc32_t& dc_offset)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        const fc32_t y = buf[i] + dc_offset;
+        buf[i]         = fc32_t(
+            y.real() + iq_corr.real() * y.real(), y.imag() + iq_corr.imag() * y.real());
+    }
+}
+
 template <class T, class U>
 const T clamp(const U v)
 {
@@ -205,6 +345,259 @@ UHD_FORCE_INLINE void chdr_sc16_to_xx(const sc16_t* input,
     }
 }
 
+/***********************************************************************
+ * Convert the sc16 buffers of several channels to one interleaved buffer
+ *
+ * The output holds sample 0 of every channel, then sample 1 of every channel,
+ * and so on. These converters have one input per channel, and are registered
+ * for 2 to MAX_INTERLEAVED_CHANS inputs.
+ **********************************************************************/
+static const size_t MAX_INTERLEAVED_CHANS = 16;
+
+template <typename T>
+UHD_INLINE std::complex<T> chdr_sc16_x1_to_interleaved(const sc16_t& in, const T scalar)
+{
+    return std::complex<T>(T(in.real()) * scalar, T(in.imag()) * scalar);
+}
+
+template <>
+UHD_INLINE sc16_t chdr_sc16_x1_to_interleaved(const sc16_t& in, const int16_t)
+{
+    return in;
+}
+
+//! Convert \p nsamps samples of one channel, every \p num_chans-th output is written
+template <typename T>
+UHD_INLINE void chdr_sc16_to_interleaved(const sc16_t* input,
+    std::complex<T>* output,
+    const size_t num_chans,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const T scalar = std::is_floating_point<T>::value ? T(scale_factor) : T(0);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i * num_chans] = chdr_sc16_x1_to_interleaved(input[i], scalar);
+    }
+}
+
+/***********************************************************************
+ * Convert sc16 buffers to and from planar xx buffers
+ *
+ * The planar CPU formats (fc32_planar, sc16_planar) hold the I and the Q
+ * values of the samples in separate buffers, i.e., their converters have 2
+ * inputs (or outputs) per channel.
+ **********************************************************************/
+template <typename T>
+UHD_INLINE T s16_to_planar_x1(const int16_t num, const float scale_factor)
+{
+    return T(num * scale_factor);
+}
+
+template <>
+UHD_INLINE int16_t s16_to_planar_x1(const int16_t num, const float)
+{
+    return num;
+}
+
+template <typename T>
+UHD_INLINE int16_t planar_to_s16_x1(const T num, const float scale_factor)
+{
+    return clamp<int16_t>(num * scale_factor);
+}
+
+template <>
+UHD_INLINE int16_t planar_to_s16_x1(const int16_t num, const float)
+{
+    return num;
+}
+
+template <xtox_t to_host, typename T>
+UHD_INLINE void item32_sc16_to_planar(const item32_t* input,
+    T* output_i,
+    T* output_q,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float scalar = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item = to_host(input[i]);
+        output_i[i]         = s16_to_planar_x1<T>(int16_t(item >> 16), scalar);
+        output_q[i]         = s16_to_planar_x1<T>(int16_t(item >> 0), scalar);
+    }
+}
+
+template <xtox_t to_wire, typename T>
+UHD_INLINE void planar_to_item32_sc16(const T* input_i,
+    const T* input_q,
+    item32_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        const uint16_t real = planar_to_s16_x1(input_i[i], float(scale_factor));
+        const uint16_t imag = planar_to_s16_x1(input_q[i], float(scale_factor));
+        output[i]           = to_wire((item32_t(real) << 16) | (item32_t(imag) << 0));
+    }
+}
+
+template <typename T>
+UHD_INLINE void chdr_sc16_to_planar(const sc16_t* input,
+    T* output_i,
+    T* output_q,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        output_i[i] = s16_to_planar_x1<T>(input[i].real(), float(scale_factor));
+        output_q[i] = s16_to_planar_x1<T>(input[i].imag(), float(scale_factor));
+    }
+}
+
+template <typename T>
+UHD_INLINE void planar_to_chdr_sc16(const T* input_i,
+    const T* input_q,
+    sc16_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = sc16_t(planar_to_s16_x1(input_i[i], float(scale_factor)),
+            planar_to_s16_x1(input_q[i], float(scale_factor)));
+    }
+}
+
+/***********************************************************************
+ * Convert sc16 buffers to and from 16-bit float xx buffers
+ *
+ * The CPU formats fc16 (IEEE 754 binary16) and bf16 (bfloat16) store every
+ * sample as two 16-bit floats, I first. C++ has no portable type for either,
+ * so the buffers are accessed as uint16_t values. The values are scaled as
+ * floats, and then rounded to the nearest even 16-bit float, which is also how
+ * the SIMD converters round.
+ **********************************************************************/
+typedef uint16_t (*f32_to_x16_t)(const float);
+typedef float (*x16_to_f32_t)(const uint16_t);
+
+UHD_INLINE uint32_t f32_to_bits(const float num)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &num, sizeof(bits));
+    return bits;
+}
+
+UHD_INLINE float bits_to_f32(const uint32_t bits)
+{
+    float num;
+    std::memcpy(&num, &bits, sizeof(num));
+    return num;
+}
+
+UHD_INLINE uint16_t f32_to_f16_x1(const float num)
+{
+    const uint32_t bits = f32_to_bits(num);
+    const uint16_t sign = uint16_t((bits >> 16) & 0x8000);
+    const uint32_t abs  = bits & 0x7fffffff;
+    if (abs >= 0x47800000) {
+        // too large for a half (65520 and up round to infinity), Inf, or NaN
+        return sign | (abs > 0x7f800000 ? 0x7e00 : 0x7c00);
+    }
+    if (abs < 0x38800000) {
+        // subnormal half: adding 0.5 lets the FPU round to a multiple of 2^-24
+        const float tmp = bits_to_f32(abs) + 0.5f;
+        return sign | uint16_t(f32_to_bits(tmp) - f32_to_bits(0.5f));
+    }
+    // rebias the exponent, and round the mantissa to nearest even
+    const uint32_t odd = (abs >> 13) & 1;
+    return sign | uint16_t((abs + (uint32_t(15 - 127) << 23) + 0xfff + odd) >> 13);
+}
+
+UHD_INLINE float f16_x1_to_f32(const uint16_t num)
+{
+    const uint32_t sign = uint32_t(num & 0x8000) << 16;
+    const uint32_t exp  = num & 0x7c00;
+    const uint32_t bits = uint32_t(num & 0x7fff) << 13;
+    if (exp == 0) {
+        // zero or subnormal, which floats can represent exactly
+        const float tmp = float(num & 0x3ff) * (1.0f / 16777216);
+        return bits_to_f32(sign | f32_to_bits(tmp));
+    }
+    if (exp == 0x7c00) {
+        // Inf or NaN
+        return bits_to_f32(sign | bits | 0x7f800000);
+    }
+    return bits_to_f32(sign | (bits + (uint32_t(127 - 15) << 23)));
+}
+
+UHD_INLINE uint16_t f32_to_bf16_x1(const float num)
+{
+    const uint32_t bits = f32_to_bits(num);
+    if ((bits & 0x7fffffff) > 0x7f800000) {
+        // keep NaNs quiet, the rounding could turn them into Inf
+        return uint16_t((bits >> 16) | 0x0040);
+    }
+    // round to nearest even: add 0x7fff plus the lowest bit that is kept
+    return uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+}
+
+UHD_INLINE float bf16_x1_to_f32(const uint16_t num)
+{
+    return bits_to_f32(uint32_t(num) << 16);
+}
+
+template <xtox_t to_host, f32_to_x16_t to_x16>
+UHD_INLINE void item32_sc16_to_x16(const item32_t* input,
+    uint16_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float scalar = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item = to_host(input[i]);
+        output[2 * i + 0]   = to_x16(int16_t(item >> 16) * scalar);
+        output[2 * i + 1]   = to_x16(int16_t(item >> 0) * scalar);
+    }
+}
+
+template <xtox_t to_wire, x16_to_f32_t to_f32>
+UHD_INLINE void x16_to_item32_sc16(const uint16_t* input,
+    item32_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float scalar = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        const uint16_t real = clamp<int16_t>(to_f32(input[2 * i + 0]) * scalar);
+        const uint16_t imag = clamp<int16_t>(to_f32(input[2 * i + 1]) * scalar);
+        output[i]           = to_wire((item32_t(real) << 16) | (item32_t(imag) << 0));
+    }
+}
+
+template <f32_to_x16_t to_x16>
+UHD_INLINE void chdr_sc16_to_x16(const sc16_t* input,
+    uint16_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float scalar = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[2 * i + 0] = to_x16(input[i].real() * scalar);
+        output[2 * i + 1] = to_x16(input[i].imag() * scalar);
+    }
+}
+
+template <x16_to_f32_t to_f32>
+UHD_INLINE void x16_to_chdr_sc16(const uint16_t* input,
+    sc16_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float scalar = float(scale_factor);
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = sc16_t(clamp<int16_t>(to_f32(input[2 * i + 0]) * scalar),
+            clamp<int16_t>(to_f32(input[2 * i + 1]) * scalar));
+    }
+}
+
 /***********************************************************************
  * Convert xx to items32 sc8 buffer
  **********************************************************************/
@@ -262,6 +655,29 @@ UHD_INLINE void xx_to_item32_sc8(const std::complex<T>* input,
     }
 }
 
+/*! Convert sc16 to items32 sc8 buffer, scaled by \p scalar / 32767
+ *
+ * This rounds and saturates like the SIMD sc16 to sc8 converters, which use
+ * it for the samples which don't fill a vector.
+ */
+template <xtox_t to_wire>
+UHD_INLINE void sc16_to_item32_sc8(
+    const sc16_t* input, item32_t* output, const size_t nsamps, const double scalar)
+{
+    const float scale_factor = float(scalar / 32767.);
+    auto conv                = [scale_factor](const int16_t num) {
+        return uint8_t(clamp<int8_t>(std::lround(num * scale_factor)));
+    };
+    for (size_t i = 0; i < nsamps; i += 2) {
+        const sc16_t in1    = (i + 1 < nsamps) ? input[i + 1] : sc16_t(0);
+        const item32_t item = (item32_t(conv(input[i].real())) << 24)
+                              | (item32_t(conv(input[i].imag())) << 16)
+                              | (item32_t(conv(in1.real())) << 8)
+                              | (item32_t(conv(in1.imag())) << 0);
+        output[i / 2] = to_wire(item);
+    }
+}
+
 /***********************************************************************
  * Convert items32 sc8 buffer to xx
  **********************************************************************/
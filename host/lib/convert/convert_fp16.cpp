@@ -0,0 +1,49 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+
+/*
+ * Converters between the sc16 wire formats and the 16-bit float CPU formats.
+ * Consumers such as ML inference on GPUs or accelerators often want half
+ * precision, and converting straight to it halves the amount of memory that
+ * is written compared to going through fc32.
+ */
+#define __DECLARE_X16_CONVERTER(cpu_type, to_x16, to_f32, xe, htoxx, xxtoh)             \
+    DECLARE_CONVERTER(cpu_type, 1, sc16_item32_##xe, 1, PRIORITY_GENERAL)              \
+    {                                                                                  \
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(inputs[0]);          \
+        item32_t* output      = reinterpret_cast<item32_t*>(outputs[0]);               \
+        x16_to_item32_sc16<htoxx, to_f32>(input, output, nsamps, scale_factor);        \
+    }                                                                                  \
+    DECLARE_CONVERTER(sc16_item32_##xe, 1, cpu_type, 1, PRIORITY_GENERAL)              \
+    {                                                                                  \
+        const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);          \
+        uint16_t* output      = reinterpret_cast<uint16_t*>(outputs[0]);               \
+        item32_sc16_to_x16<xxtoh, to_x16>(input, output, nsamps, scale_factor);        \
+    }
+
+#define _DECLARE_X16_CONVERTER(cpu_type, to_x16, to_f32)                              \
+    __DECLARE_X16_CONVERTER(cpu_type, to_x16, to_f32, be, uhd::htonx, uhd::ntohx)     \
+    __DECLARE_X16_CONVERTER(cpu_type, to_x16, to_f32, le, uhd::htowx, uhd::wtohx)     \
+    DECLARE_CONVERTER(cpu_type, 1, sc16_chdr, 1, PRIORITY_GENERAL)                    \
+    {                                                                                 \
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(inputs[0]);         \
+        sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);                \
+        x16_to_chdr_sc16<to_f32>(input, output, nsamps, scale_factor);                \
+    }                                                                                 \
+    DECLARE_CONVERTER(sc16_chdr, 1, cpu_type, 1, PRIORITY_GENERAL)                    \
+    {                                                                                 \
+        const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);             \
+        uint16_t* output    = reinterpret_cast<uint16_t*>(outputs[0]);                \
+        chdr_sc16_to_x16<to_x16>(input, output, nsamps, scale_factor);                \
+    }
+
+/* Create fc16<->sc16(otw) */
+_DECLARE_X16_CONVERTER(fc16, f32_to_f16_x1, f16_x1_to_f32)
+/* Create bf16<->sc16(otw) */
+_DECLARE_X16_CONVERTER(bf16, f32_to_bf16_x1, bf16_x1_to_f32)
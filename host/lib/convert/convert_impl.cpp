@@ -10,9 +10,12 @@
 #include <uhd/types/dict.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <stdint.h>
 #include <boost/format.hpp>
 #include <complex>
+#include <map>
+#include <tuple>
 
 using namespace uhd;
 
@@ -21,6 +24,12 @@ convert::converter::~converter(void)
     /* NOP */
 }
 
+bool convert::converter::set_correction(
+    const std::complex<double>&, const std::complex<double>&)
+{
+    return false;
+}
+
 bool convert::operator==(const convert::id_type& lhs, const convert::id_type& rhs)
 {
     return true and (lhs.input_format == rhs.input_format)
@@ -49,9 +58,28 @@ std::string convert::id_type::to_string(void) const
 /***********************************************************************
  * Setup the table registry
  **********************************************************************/
-typedef uhd::dict<convert::id_type,
-    uhd::dict<convert::priority_type, convert::function_type>>
-    fcn_table_type;
+namespace {
+
+// Hundreds of converters register before main(), so the registry is an
+// ordered map. The converters themselves (and their lookup tables) are only
+// constructed when a streamer asks for them.
+struct id_less
+{
+    bool operator()(const convert::id_type& lhs, const convert::id_type& rhs) const
+    {
+        return std::tie(
+                   lhs.input_format, lhs.num_inputs, lhs.output_format, lhs.num_outputs)
+               < std::tie(
+                   rhs.input_format, rhs.num_inputs, rhs.output_format, rhs.num_outputs);
+    }
+};
+
+using fcn_table_type = std::map<convert::id_type,
+    std::map<convert::priority_type, convert::function_type>,
+    id_less>;
+
+} // namespace
+
 UHD_SINGLETON_FCN(fcn_table_type, get_table);
 
 /***********************************************************************
@@ -73,37 +101,61 @@ void uhd::convert::register_converter(
  **********************************************************************/
 convert::function_type convert::get_converter(const id_type& id, const priority_type prio)
 {
-    if (not get_table().has_key(id))
+    uhd::load_modules();
+    auto it = get_table().find(id);
+    if (it == get_table().end())
         throw uhd::key_error("Cannot find a conversion routine for " + id.to_pp_string());
+    const auto& prios = it->second;
 
     // find a matching priority
-    priority_type best_prio = -1;
-    for (priority_type prio_i : get_table()[id].keys()) {
-        if (prio_i == prio) {
-            //----------------------------------------------------------------//
-            UHD_LOGGER_DEBUG("CONVERT")
-                << "get_converter: For converter ID: " << id.to_pp_string()
-                << " Found exact match for prio: " << prio;
-            ;
-            //----------------------------------------------------------------//
-            return get_table()[id][prio];
-        }
-        best_prio = std::max(best_prio, prio_i);
+    if (prio != -1) {
+        auto prio_it = prios.find(prio);
+        // wanted a specific prio, didnt find
+        if (prio_it == prios.end())
+            throw uhd::key_error(
+                "Cannot find a conversion routine [with prio] for " + id.to_pp_string());
+        //----------------------------------------------------------------//
+        UHD_LOGGER_DEBUG("CONVERT")
+            << "get_converter: For converter ID: " << id.to_pp_string()
+            << " Found exact match for prio: " << prio;
+        //----------------------------------------------------------------//
+        return prio_it->second;
     }
 
-    // wanted a specific prio, didnt find
-    if (prio != -1)
-        throw uhd::key_error(
-            "Cannot find a conversion routine [with prio] for " + id.to_pp_string());
-
     //----------------------------------------------------------------//
     UHD_LOGGER_DEBUG("CONVERT")
         << "get_converter: For converter ID: " << id.to_pp_string()
-        << " Using best available prio: " << best_prio;
+        << " Using best available prio: " << prios.rbegin()->first;
     //----------------------------------------------------------------//
 
     // otherwise, return best prio
-    return get_table()[id][best_prio];
+    return prios.rbegin()->second;
+}
+
+std::vector<convert::id_type> convert::get_converter_ids(void)
+{
+    uhd::load_modules();
+    std::vector<id_type> ids;
+    ids.reserve(get_table().size());
+    for (const auto& entry : get_table()) {
+        ids.push_back(entry.first);
+    }
+    return ids;
+}
+
+std::vector<convert::priority_type> convert::get_converter_priorities(const id_type& id)
+{
+    uhd::load_modules();
+    auto it = get_table().find(id);
+    if (it == get_table().end())
+        throw uhd::key_error("Cannot find a conversion routine for " + id.to_pp_string());
+
+    // The map is sorted by priority
+    std::vector<priority_type> prios;
+    for (const auto& entry : it->second) {
+        prios.push_back(entry.first);
+    }
+    return prios;
 }
 
 /***********************************************************************
@@ -144,6 +196,10 @@ UHD_STATIC_BLOCK(convert_register_item_sizes)
     convert::register_bytes_per_item("sc16", sizeof(std::complex<int16_t>));
     convert::register_bytes_per_item("sc8", sizeof(std::complex<int8_t>));
 
+    // register complex 16-bit float types, C++ has no portable type for them
+    convert::register_bytes_per_item("fc16", 2 * sizeof(uint16_t));
+    convert::register_bytes_per_item("bf16", 2 * sizeof(uint16_t));
+
     // register standard real types
     convert::register_bytes_per_item("f64", sizeof(double));
     convert::register_bytes_per_item("f32", sizeof(float));
@@ -153,6 +209,10 @@ UHD_STATIC_BLOCK(convert_register_item_sizes)
     convert::register_bytes_per_item("s8", sizeof(int8_t));
     convert::register_bytes_per_item("u8", sizeof(uint8_t));
 
+    // register planar types, their items are the I or the Q values of a buffer
+    convert::register_bytes_per_item("fc32_planar", sizeof(float));
+    convert::register_bytes_per_item("sc16_planar", sizeof(int16_t));
+
     // register VITA types
     convert::register_bytes_per_item("item32", sizeof(int32_t));
 }
@@ -0,0 +1,59 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+
+using namespace uhd::convert;
+
+template <typename type>
+struct convert_sc16_chdr_n_to_interleaved : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        const size_t num_chans     = inputs.size();
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[ch]);
+            chdr_sc16_to_interleaved(input, output + ch, num_chans, nsamps, _scalar);
+        }
+    }
+
+    double _scalar = 0.0;
+};
+
+template <typename type>
+static converter::sptr make_convert_sc16_chdr_n_to_interleaved(void)
+{
+    return converter::sptr(new convert_sc16_chdr_n_to_interleaved<type>());
+}
+
+UHD_STATIC_BLOCK(register_convert_sc16_chdr_n_to_interleaved)
+{
+    uhd::convert::id_type id;
+    id.input_format = "sc16_chdr";
+    id.num_outputs  = 1;
+
+    for (size_t num_chans = 2; num_chans <= MAX_INTERLEAVED_CHANS; num_chans++) {
+        id.num_inputs    = num_chans;
+        id.output_format = "fc64";
+        uhd::convert::register_converter(
+            id, &make_convert_sc16_chdr_n_to_interleaved<double>, PRIORITY_GENERAL);
+        id.output_format = "fc32";
+        uhd::convert::register_converter(
+            id, &make_convert_sc16_chdr_n_to_interleaved<float>, PRIORITY_GENERAL);
+        id.output_format = "sc16";
+        uhd::convert::register_converter(
+            id, &make_convert_sc16_chdr_n_to_interleaved<int16_t>, PRIORITY_GENERAL);
+    }
+}
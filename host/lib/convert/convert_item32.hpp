@@ -0,0 +1,184 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include "convert_common.hpp"
+#include <uhd/types/endianness.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <cstring>
+#include <type_traits>
+
+/***********************************************************************
+ * Generic item32 converters
+ *
+ * An item32 holds one sc16 or two sc8 samples. Instead of assembling the
+ * items with shifts, and byteswapping them as a whole, these converters access
+ * the wire buffer as an array of components (I or Q values). On the wire,
+ * the components of an item are either in the order of the samples (big
+ * endian), or in reverse (little endian). So the byteswap turns into a fixed
+ * permutation of the components within an item, plus a byteswap of every
+ * component of a wire format which isn't in host byte order. The endianness,
+ * the component type and the CPU type are template parameters, and the inner
+ * loops only have constant indices, so the compiler can vectorize them for
+ * every format pair, not only those with hand-written SIMD converters.
+ **********************************************************************/
+#ifdef UHD_BIG_ENDIAN
+constexpr uhd::endianness_t HOST_ENDIANNESS = uhd::ENDIANNESS_BIG;
+#else
+constexpr uhd::endianness_t HOST_ENDIANNESS = uhd::ENDIANNESS_LITTLE;
+#endif
+
+//! The layout of the components of type \p comp_t in an item32_t
+template <uhd::endianness_t wire_end, typename comp_t>
+struct item32_layout
+{
+    //! The number of components per item
+    static constexpr size_t NUM_COMPS = sizeof(item32_t) / sizeof(comp_t);
+    //! The number of samples per item
+    static constexpr size_t SAMPS_PER_ITEM = NUM_COMPS / 2;
+    //! True if the bytes of every component are swapped on the wire
+    static constexpr bool SWAP = sizeof(comp_t) > 1 && wire_end != HOST_ENDIANNESS;
+
+    //! The position in an item of its \p k-th component
+    static constexpr size_t index(const size_t k)
+    {
+        return wire_end == uhd::ENDIANNESS_BIG ? k : NUM_COMPS - 1 - k;
+    }
+};
+
+UHD_FORCE_INLINE int8_t swap_comp(const int8_t num)
+{
+    return num;
+}
+
+UHD_FORCE_INLINE int16_t swap_comp(const int16_t num)
+{
+    return int16_t(uhd::byteswap(uint16_t(num)));
+}
+
+template <typename layout, typename comp_t>
+UHD_FORCE_INLINE comp_t swap_wire_comp(const comp_t num)
+{
+    return layout::SWAP ? swap_comp(num) : num;
+}
+
+//! Scale and saturate the floating-point component \p num to a wire component
+template <typename comp_t, typename T>
+UHD_FORCE_INLINE typename std::enable_if<std::is_floating_point<T>::value, comp_t>::type
+cpu_to_wire_comp(const T num, const float scalar)
+{
+    return clamp<comp_t>(num * scalar);
+}
+
+//! Saturate the integer component \p num to a wire component, without scaling
+template <typename comp_t, typename T>
+UHD_FORCE_INLINE typename std::enable_if<!std::is_floating_point<T>::value, comp_t>::type
+cpu_to_wire_comp(const T num, const float)
+{
+    return clamp<comp_t>(num);
+}
+
+template <typename T, typename comp_t>
+UHD_FORCE_INLINE typename std::enable_if<std::is_floating_point<T>::value, T>::type
+wire_to_cpu_comp(const comp_t num, const float scalar)
+{
+    return T(num * scalar);
+}
+
+template <typename T, typename comp_t>
+UHD_FORCE_INLINE typename std::enable_if<!std::is_floating_point<T>::value, T>::type
+wire_to_cpu_comp(const comp_t num, const float)
+{
+    return T(num);
+}
+
+/*! Convert \p nsamps CPU samples to items with components of type \p comp_t
+ *
+ * If the last item isn't filled, it's padded with zeros.
+ */
+template <uhd::endianness_t wire_end, typename comp_t, typename T>
+UHD_INLINE void cpu_to_item32(const std::complex<T>* input,
+    item32_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    using layout           = item32_layout<wire_end, comp_t>;
+    constexpr size_t N     = layout::NUM_COMPS;
+    const T* in            = reinterpret_cast<const T*>(input);
+    comp_t* out            = reinterpret_cast<comp_t*>(output);
+    const float scalar     = float(scale_factor);
+    const size_t num_items = nsamps / layout::SAMPS_PER_ITEM;
+
+    for (size_t i = 0; i < num_items; i++) {
+        for (size_t k = 0; k < N; k++) {
+            out[i * N + layout::index(k)] =
+                swap_wire_comp<layout>(cpu_to_wire_comp<comp_t>(in[i * N + k], scalar));
+        }
+    }
+
+    const size_t num_left = 2 * (nsamps - num_items * layout::SAMPS_PER_ITEM);
+    if (num_left) {
+        in += num_items * N;
+        out += num_items * N;
+        for (size_t k = 0; k < N; k++) {
+            const comp_t num = k < num_left ? cpu_to_wire_comp<comp_t>(in[k], scalar)
+                                            : comp_t(0);
+            out[layout::index(k)] = swap_wire_comp<layout>(num);
+        }
+    }
+}
+
+/*! Convert items with components of type \p comp_t to \p nsamps CPU samples
+ *
+ * Like the SIMD converters, this reads the input from the start of the item
+ * which holds its first sample.
+ */
+template <uhd::endianness_t wire_end, typename comp_t, typename T>
+UHD_INLINE void item32_to_cpu(const item32_t* input,
+    std::complex<T>* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    using layout           = item32_layout<wire_end, comp_t>;
+    constexpr size_t N     = layout::NUM_COMPS;
+    const comp_t* in       = reinterpret_cast<const comp_t*>(size_t(input) & ~0x3);
+    T* out                 = reinterpret_cast<T*>(output);
+    const float scalar     = float(scale_factor);
+    const size_t num_items = nsamps / layout::SAMPS_PER_ITEM;
+
+    for (size_t i = 0; i < num_items; i++) {
+        for (size_t k = 0; k < N; k++) {
+            out[i * N + k] = wire_to_cpu_comp<T>(
+                swap_wire_comp<layout>(in[i * N + layout::index(k)]), scalar);
+        }
+    }
+
+    const size_t num_left = 2 * (nsamps - num_items * layout::SAMPS_PER_ITEM);
+    in += num_items * N;
+    out += num_items * N;
+    for (size_t k = 0; k < num_left; k++) {
+        out[k] =
+            wire_to_cpu_comp<T>(swap_wire_comp<layout>(in[layout::index(k)]), scalar);
+    }
+}
+
+/*! Copy \p num_words words of a wire buffer, swapping their bytes if needed
+ *
+ * This is a memcpy() if the wire and the host byte order are the same.
+ */
+template <uhd::endianness_t wire_end, typename word_t>
+UHD_INLINE void swap_wire_words(
+    const word_t* input, word_t* output, const size_t num_words)
+{
+    if (wire_end == HOST_ENDIANNESS) {
+        std::memcpy(output, input, num_words * sizeof(word_t));
+        return;
+    }
+    for (size_t i = 0; i < num_words; i++) {
+        output[i] = uhd::byteswap(input[i]);
+    }
+}
@@ -105,3 +105,102 @@ void convert_star_4_to_sc12_item32_3(const std::complex<type>& in0,
     };
     pack<towire>(output, enable, iq);
 }
+
+/*! Convert the samples which precede the first full item32_sc12_3x (the head)
+ *
+ * The SIMD converters use this and convert_star_to_sc12_item32_tail() for the
+ * samples which don't fill a vector.
+ *
+ * \param input The samples
+ * \param out The output buffer of the converter
+ * \param scalar The scalar of the converter
+ * \param[out] output Receives the first full item32_sc12_3x
+ * \returns the number of samples which were converted
+ */
+template <typename type, towire32_type towire>
+size_t convert_star_to_sc12_item32_head(const std::complex<type>* input,
+    void* out,
+    const double scalar,
+    item32_sc12_3x*& output)
+{
+    const size_t head_samps = size_t(out) & 0x3;
+    const size_t rewind     = head_samps ? 12 - 3 * head_samps : 0;
+    output = reinterpret_cast<item32_sc12_3x*>(size_t(out) - rewind);
+
+    switch (head_samps) {
+        case 0:
+            break; // no head
+        case 1:
+            convert_star_4_to_sc12_item32_3<type, towire>(
+                0, 0, 0, input[0], CONVERT12_LINE2, *output++, scalar);
+            break;
+        case 2:
+            convert_star_4_to_sc12_item32_3<type, towire>(0,
+                0,
+                input[0],
+                input[1],
+                CONVERT12_LINE2 | CONVERT12_LINE1,
+                *output++,
+                scalar);
+            break;
+        case 3:
+            convert_star_4_to_sc12_item32_3<type, towire>(0,
+                input[0],
+                input[1],
+                input[2],
+                CONVERT12_LINE2 | CONVERT12_LINE1 | CONVERT12_LINE0,
+                *output++,
+                scalar);
+            break;
+    }
+    return head_samps;
+}
+
+/*! Convert samples, starting at a full item32_sc12_3x
+ *
+ * This only writes the lines which hold samples.
+ */
+template <typename type, towire32_type towire>
+void convert_star_to_sc12_item32_tail(const std::complex<type>* input,
+    item32_sc12_3x* output,
+    const size_t nsamps,
+    const double scalar)
+{
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        convert_star_4_to_sc12_item32_3<type, towire>(input[i + 0],
+            input[i + 1],
+            input[i + 2],
+            input[i + 3],
+            CONVERT12_LINE_ALL,
+            *output++,
+            scalar);
+    }
+
+    switch (nsamps - i) {
+        case 0:
+            break; // no tail
+        case 1:
+            convert_star_4_to_sc12_item32_3<type, towire>(
+                input[i + 0], 0, 0, 0, CONVERT12_LINE0, *output, scalar);
+            break;
+        case 2:
+            convert_star_4_to_sc12_item32_3<type, towire>(input[i + 0],
+                input[i + 1],
+                0,
+                0,
+                CONVERT12_LINE0 | CONVERT12_LINE1,
+                *output,
+                scalar);
+            break;
+        case 3:
+            convert_star_4_to_sc12_item32_3<type, towire>(input[i + 0],
+                input[i + 1],
+                input[i + 2],
+                0,
+                CONVERT12_LINE0 | CONVERT12_LINE1 | CONVERT12_LINE2,
+                *output,
+                scalar);
+            break;
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+
+/*
+ * Converters between the sc16 wire formats and the planar CPU formats. Input
+ * (or output) 0 is the buffer of the I values, and 1 the buffer of the Q
+ * values. Writing the planes while converting saves consumers such as FFTs a
+ * separate deinterleaving pass.
+ */
+#define __DECLARE_PLANAR_CONVERTER(cpu_type, type, xe, htoxx, xxtoh)                   \
+    DECLARE_CONVERTER(cpu_type##_planar, 2, sc16_item32_##xe, 1, PRIORITY_GENERAL)     \
+    {                                                                                  \
+        const type##_t* input_i = reinterpret_cast<const type##_t*>(inputs[0]);        \
+        const type##_t* input_q = reinterpret_cast<const type##_t*>(inputs[1]);        \
+        item32_t* output        = reinterpret_cast<item32_t*>(outputs[0]);             \
+        planar_to_item32_sc16<htoxx>(input_i, input_q, output, nsamps, scale_factor);  \
+    }                                                                                  \
+    DECLARE_CONVERTER(sc16_item32_##xe, 1, cpu_type##_planar, 2, PRIORITY_GENERAL)     \
+    {                                                                                  \
+        const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);          \
+        type##_t* output_i    = reinterpret_cast<type##_t*>(outputs[0]);               \
+        type##_t* output_q    = reinterpret_cast<type##_t*>(outputs[1]);               \
+        item32_sc16_to_planar<xxtoh>(input, output_i, output_q, nsamps, scale_factor); \
+    }
+
+#define _DECLARE_PLANAR_CONVERTER(cpu_type, type)                               \
+    __DECLARE_PLANAR_CONVERTER(cpu_type, type, be, uhd::htonx, uhd::ntohx)      \
+    __DECLARE_PLANAR_CONVERTER(cpu_type, type, le, uhd::htowx, uhd::wtohx)      \
+    DECLARE_CONVERTER(cpu_type##_planar, 2, sc16_chdr, 1, PRIORITY_GENERAL)     \
+    {                                                                           \
+        const type##_t* input_i = reinterpret_cast<const type##_t*>(inputs[0]); \
+        const type##_t* input_q = reinterpret_cast<const type##_t*>(inputs[1]); \
+        sc16_t* output          = reinterpret_cast<sc16_t*>(outputs[0]);        \
+        planar_to_chdr_sc16(input_i, input_q, output, nsamps, scale_factor);    \
+    }                                                                           \
+    DECLARE_CONVERTER(sc16_chdr, 1, cpu_type##_planar, 2, PRIORITY_GENERAL)     \
+    {                                                                           \
+        const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);       \
+        type##_t* output_i  = reinterpret_cast<type##_t*>(outputs[0]);          \
+        type##_t* output_q  = reinterpret_cast<type##_t*>(outputs[1]);          \
+        chdr_sc16_to_planar(input, output_i, output_q, nsamps, scale_factor);   \
+    }
+
+/* Create fc32_planar<->sc16(otw) */
+_DECLARE_PLANAR_CONVERTER(fc32, f32)
+/* Create sc16_planar<->sc16(otw) */
+_DECLARE_PLANAR_CONVERTER(sc16, s16)
@@ -94,3 +94,80 @@ void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
     out2 = std::complex<type>(line1 >> 0 & 0xfff0, line12 >> 20 & 0xfff0);
     out3 = std::complex<type>(line2 >> 8 & 0xfff0, line2 << 4 & 0xfff0);
 }
+
+/*! Convert the samples in the first (partial) item32_sc12_3x (the head)
+ *
+ * The SIMD converters use this and convert_sc12_item32_to_star_tail() for the
+ * samples which don't fill a vector.
+ *
+ * \param in The input buffer of the converter
+ * \param output The samples
+ * \param scalar The scalar of the converter
+ * \param[out] input Receives the first full item32_sc12_3x
+ * \returns the number of samples which were converted
+ */
+template <typename type, tohost32_type tohost>
+size_t convert_sc12_item32_to_star_head(const void* in,
+    std::complex<type>* output,
+    const double scalar,
+    const item32_sc12_3x*& input)
+{
+    const size_t head_samps = size_t(in) & 0x3;
+    const size_t rewind     = head_samps ? 12 - 3 * head_samps : 0;
+    input = reinterpret_cast<const item32_sc12_3x*>(size_t(in) - rewind);
+
+    std::complex<type> dummy;
+    switch (head_samps) {
+        case 0:
+            break; // no head
+        case 1:
+            convert_sc12_item32_3_to_star_4<type, tohost>(
+                *input++, dummy, dummy, dummy, output[0], scalar);
+            break;
+        case 2:
+            convert_sc12_item32_3_to_star_4<type, tohost>(
+                *input++, dummy, dummy, output[0], output[1], scalar);
+            break;
+        case 3:
+            convert_sc12_item32_3_to_star_4<type, tohost>(
+                *input++, dummy, output[0], output[1], output[2], scalar);
+            break;
+    }
+    return head_samps;
+}
+
+//! Convert samples, starting at a full item32_sc12_3x
+template <typename type, tohost32_type tohost>
+void convert_sc12_item32_to_star_tail(const item32_sc12_3x* input,
+    std::complex<type>* output,
+    const size_t nsamps,
+    const double scalar)
+{
+    size_t o = 0;
+    for (; o + 3 < nsamps; o += 4) {
+        convert_sc12_item32_3_to_star_4<type, tohost>(*input++,
+            output[o + 0],
+            output[o + 1],
+            output[o + 2],
+            output[o + 3],
+            scalar);
+    }
+
+    std::complex<type> dummy;
+    switch (nsamps - o) {
+        case 0:
+            break; // no tail
+        case 1:
+            convert_sc12_item32_3_to_star_4<type, tohost>(
+                *input, output[o + 0], dummy, dummy, dummy, scalar);
+            break;
+        case 2:
+            convert_sc12_item32_3_to_star_4<type, tohost>(
+                *input, output[o + 0], output[o + 1], dummy, dummy, scalar);
+            break;
+        case 3:
+            convert_sc12_item32_3_to_star_4<type, tohost>(
+                *input, output[o + 0], output[o + 1], output[o + 2], dummy, scalar);
+            break;
+    }
+}
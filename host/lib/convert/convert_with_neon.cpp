@@ -130,3 +130,476 @@ DECLARE_CONVERTER(sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD)
 
     item32_sc16_to_xx<uhd::wtohx>(input + i, output + i, nsamps - i, scale_factor);
 }
+
+//! Scale 4 int16 values, and round them like lround() with signed saturation
+UHD_INLINE int16x4_t scale_s16_4x(const int16x4_t in, const float32x4_t scalar)
+{
+    const float32x4_t tmp = vmulq_f32(vcvtq_f32_s32(vmovl_s16(in)), scalar);
+    // vcvtq_s32_f32() truncates, so add 0.5 with the sign of the value first
+    const uint32x4_t sign =
+        vandq_u32(vreinterpretq_u32_f32(tmp), vdupq_n_u32(0x80000000));
+    const float32x4_t half =
+        vreinterpretq_f32_u32(vorrq_u32(sign, vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+    return vqmovn_s32(vcvtq_s32_f32(vaddq_f32(tmp, half)));
+}
+
+//! Convert 8 sc16 samples to sc8 (4 item32s), swapping the bytes if \p swap
+template <bool swap>
+UHD_INLINE void sc16_to_sc8_8x(
+    const sc16_t* input, item32_t* output, const float32x4_t scalar)
+{
+    const int16x8_t in0 = vld1q_s16(reinterpret_cast<const int16_t*>(input));
+    const int16x8_t in1 = vld1q_s16(reinterpret_cast<const int16_t*>(input + 4));
+
+    const int16x4_t tmp0 = scale_s16_4x(vget_low_s16(in0), scalar);
+    const int16x4_t tmp1 = scale_s16_4x(vget_high_s16(in0), scalar);
+    const int16x4_t tmp2 = scale_s16_4x(vget_low_s16(in1), scalar);
+    const int16x4_t tmp3 = scale_s16_4x(vget_high_s16(in1), scalar);
+
+    const int16x8_t lo = vcombine_s16(tmp0, tmp1);
+    const int16x8_t hi = vcombine_s16(tmp2, tmp3);
+    int8x16_t out = vcombine_s8(vqmovn_s16(lo), vqmovn_s16(hi));
+    if (swap) {
+        out = vrev32q_s8(out);
+    }
+
+    vst1q_s8(reinterpret_cast<int8_t*>(output), out);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor / 32767.));
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        sc16_to_sc8_8x<false>(input + i, output + j, scalar);
+    }
+
+    sc16_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor / 32767.));
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        sc16_to_sc8_8x<true>(input + i, output + j, scalar);
+    }
+
+    sc16_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+/***********************************************************************
+ * sc16 and sc8 item32 converters for both byte orders, fc32 and fc64
+ **********************************************************************/
+//! Load 2 fc32 samples
+UHD_INLINE float32x4_t load_2x(const fc32_t* input)
+{
+    return vld1q_f32(reinterpret_cast<const float*>(input));
+}
+
+//! Load 2 fc64 samples as floats, NEON on ARMv7 has no double precision
+UHD_INLINE float32x4_t load_2x(const fc64_t* input)
+{
+    const double* in = reinterpret_cast<const double*>(input);
+    const float32x4_t out{float(in[0]), float(in[1]), float(in[2]), float(in[3])};
+    return out;
+}
+
+//! Store 2 fc32 samples
+UHD_INLINE void store_2x(fc32_t* output, const float32x4_t in)
+{
+    vst1q_f32(reinterpret_cast<float*>(output), in);
+}
+
+//! Store 2 samples as fc64
+UHD_INLINE void store_2x(fc64_t* output, const float32x4_t in)
+{
+    double* out = reinterpret_cast<double*>(output);
+    out[0]      = vgetq_lane_f32(in, 0);
+    out[1]      = vgetq_lane_f32(in, 1);
+    out[2]      = vgetq_lane_f32(in, 2);
+    out[3]      = vgetq_lane_f32(in, 3);
+}
+
+/*! Reorder the values of 2 sc16 samples between host order and item32 wire order
+ *
+ * In memory, sc16_item32_le has the Q value first, and sc16_item32_be has the
+ * I value first but the bytes of every value swapped. Both are their own inverse.
+ */
+template <bool wire_le>
+UHD_INLINE int16x4_t swap_sc16_2x(const int16x4_t in)
+{
+    return wire_le ? vrev32_s16(in)
+                   : vreinterpret_s16_s8(vrev16_s8(vreinterpret_s8_s16(in)));
+}
+
+template <xtox_t to_wire, bool wire_le, typename type>
+UHD_INLINE void xx_to_item32_sc16_neon(const std::complex<type>* input,
+    item32_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 1 < nsamps; i += 2) {
+        const float32x4_t tmp = vmulq_f32(load_2x(input + i), scalar);
+        const int16x4_t out   = vqmovn_s32(vcvtq_s32_f32(tmp));
+        vst1_s16(reinterpret_cast<int16_t*>(output + i), swap_sc16_2x<wire_le>(out));
+    }
+
+    xx_to_item32_sc16<to_wire>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+template <xtox_t to_host, bool wire_le, typename type>
+UHD_INLINE void item32_sc16_to_xx_neon(const item32_t* input,
+    std::complex<type>* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 1 < nsamps; i += 2) {
+        const int16x4_t tmp = vld1_s16(reinterpret_cast<const int16_t*>(input + i));
+        const int32x4_t in  = vmovl_s16(swap_sc16_2x<wire_le>(tmp));
+        store_2x(output + i, vmulq_f32(vcvtq_f32_s32(in), scalar));
+    }
+
+    item32_sc16_to_xx<to_host>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+/*! Convert to sc8 items, 4 samples at a time
+ *
+ * In memory, sc8_item32_be has the values in sample order, and sc8_item32_le
+ * has the bytes of every item32 reversed.
+ */
+template <xtox_t to_wire, bool wire_le, typename type>
+UHD_INLINE void xx_to_item32_sc8_neon(const std::complex<type>* input,
+    item32_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        const float32x4_t tmp0 = vmulq_f32(load_2x(input + i + 0), scalar);
+        const float32x4_t tmp1 = vmulq_f32(load_2x(input + i + 2), scalar);
+
+        // narrowing twice saturates like clamp<int8_t>()
+        const int16x8_t tmpi = vcombine_s16(
+            vqmovn_s32(vcvtq_s32_f32(tmp0)), vqmovn_s32(vcvtq_s32_f32(tmp1)));
+        const int8x8_t out = vqmovn_s16(tmpi);
+        vst1_s8(reinterpret_cast<int8_t*>(output + (i / 2)),
+            wire_le ? vrev32_s8(out) : out);
+    }
+
+    xx_to_item32_sc8<to_wire>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+template <xtox_t to_host, bool wire_le, typename type>
+UHD_INLINE void item32_sc8_to_xx_neon(const void* in,
+    std::complex<type>* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(in) & ~0x3);
+    size_t num_samps      = nsamps;
+
+    if ((size_t(in) & 0x3) != 0) {
+        item32_sc8_to_xx<to_host>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 3 < num_samps; i += 4) {
+        int8x8_t tmp = vld1_s8(reinterpret_cast<const int8_t*>(input + (i / 2)));
+        if (wire_le) {
+            tmp = vrev32_s8(tmp);
+        }
+        const int16x8_t tmpi   = vmovl_s8(tmp);
+        const float32x4_t out0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(tmpi)));
+        const float32x4_t out1 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(tmpi)));
+        store_2x(output + i + 0, vmulq_f32(out0, scalar));
+        store_2x(output + i + 2, vmulq_f32(out1, scalar));
+    }
+
+    item32_sc8_to_xx<to_host>(input + (i / 2), output + i, num_samps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc8_neon<uhd::htowx, true>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD)
+{
+    fc32_t* output = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    item32_sc8_to_xx_neon<uhd::wtohx, true>(inputs[0], output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc16_neon<uhd::htonx, false>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    item32_sc16_to_xx_neon<uhd::ntohx, false>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc8_neon<uhd::htonx, false>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc8_item32_be, 1, fc32, 1, PRIORITY_SIMD)
+{
+    fc32_t* output = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    item32_sc8_to_xx_neon<uhd::ntohx, false>(inputs[0], output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(fc64, 1, sc16_item32_le, 1, PRIORITY_SIMD)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc16_neon<uhd::htowx, true>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc64, 1, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    item32_sc16_to_xx_neon<uhd::wtohx, true>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(fc64, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc8_neon<uhd::htowx, true>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc8_item32_le, 1, fc64, 1, PRIORITY_SIMD)
+{
+    fc64_t* output = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    item32_sc8_to_xx_neon<uhd::wtohx, true>(inputs[0], output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(fc64, 1, sc16_item32_be, 1, PRIORITY_SIMD)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc16_neon<uhd::htonx, false>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, fc64, 1, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    item32_sc16_to_xx_neon<uhd::ntohx, false>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(fc64, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    xx_to_item32_sc8_neon<uhd::htonx, false>(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc8_item32_be, 1, fc64, 1, PRIORITY_SIMD)
+{
+    fc64_t* output = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    item32_sc8_to_xx_neon<uhd::ntohx, false>(inputs[0], output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc16_item32_be, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    // swap the bytes of every value
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        const int8x16_t tmp = vld1q_s8(reinterpret_cast<const int8_t*>(input + i));
+        vst1q_s8(reinterpret_cast<int8_t*>(output + i), vrev16q_s8(tmp));
+    }
+
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_be, 1, sc16, 1, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    // swap the bytes of every value
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        const int8x16_t tmp = vld1q_s8(reinterpret_cast<const int8_t*>(input + i));
+        vst1q_s8(reinterpret_cast<int8_t*>(output + i), vrev16q_s8(tmp));
+    }
+
+    item32_sc16_to_xx<uhd::ntohx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+/***********************************************************************
+ * 16-bit float CPU formats
+ **********************************************************************/
+typedef uint16x4_t (*f32_to_x16_4x_t)(const float32x4_t);
+typedef float32x4_t (*x16_to_f32_4x_t)(const uint16x4_t);
+
+//! Convert 4 floats to bfloat16, rounding to nearest even
+UHD_INLINE uint16x4_t f32_to_bf16_4x(const float32x4_t in)
+{
+    const uint32x4_t tmp = vreinterpretq_u32_f32(in);
+    const uint32x4_t odd = vandq_u32(vshrq_n_u32(tmp, 16), vdupq_n_u32(1));
+    return vshrn_n_u32(vaddq_u32(vaddq_u32(tmp, odd), vdupq_n_u32(0x7fff)), 16);
+}
+
+UHD_INLINE float32x4_t bf16_4x_to_f32(const uint16x4_t in)
+{
+    return vreinterpretq_f32_u32(vshlq_n_u32(vmovl_u16(in), 16));
+}
+
+// The half-precision conversions are optional on ARMv7 (e.g., -mfpu=neon-fp16)
+#if defined(__ARM_FP) && (__ARM_FP & 0x2)
+#    define UHD_NEON_HAVE_FP16
+UHD_INLINE uint16x4_t f32_to_f16_4x(const float32x4_t in)
+{
+    return vreinterpret_u16_f16(vcvt_f16_f32(in));
+}
+
+UHD_INLINE float32x4_t f16_4x_to_f32(const uint16x4_t in)
+{
+    return vcvt_f32_f16(vreinterpret_f16_u16(in));
+}
+#endif
+
+/*! Convert sc16 samples to 16-bit floats, 2 samples at a time
+ *
+ * If \p swap is true, the input is in the item32 wire format given by
+ * \p wire_le, else in host order (sc16_chdr).
+ *
+ * \return the number of samples converted
+ */
+template <bool swap, bool wire_le, f32_to_x16_4x_t to_x16_4x>
+UHD_INLINE size_t sc16_to_x16_neon(
+    const void* in, uint16_t* output, const size_t nsamps, const double scale_factor)
+{
+    const int16_t* input     = reinterpret_cast<const int16_t*>(in);
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 1 < nsamps; i += 2) {
+        int16x4_t tmp = vld1_s16(input + 2 * i);
+        if (swap) {
+            tmp = swap_sc16_2x<wire_le>(tmp);
+        }
+        const float32x4_t tmpf = vmulq_f32(vcvtq_f32_s32(vmovl_s16(tmp)), scalar);
+        vst1_u16(output + 2 * i, to_x16_4x(tmpf));
+    }
+    return i;
+}
+
+//! Convert 16-bit floats to sc16 samples, see sc16_to_x16_neon()
+template <bool swap, bool wire_le, x16_to_f32_4x_t to_f32_4x>
+UHD_INLINE size_t x16_to_sc16_neon(
+    const uint16_t* input, void* out, const size_t nsamps, const double scale_factor)
+{
+    int16_t* output          = reinterpret_cast<int16_t*>(out);
+    const float32x4_t scalar = vdupq_n_f32(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 1 < nsamps; i += 2) {
+        const float32x4_t tmp = vmulq_f32(to_f32_4x(vld1_u16(input + 2 * i)), scalar);
+        int16x4_t outi        = vqmovn_s32(vcvtq_s32_f32(tmp));
+        if (swap) {
+            outi = swap_sc16_2x<wire_le>(outi);
+        }
+        vst1_s16(output + 2 * i, outi);
+    }
+    return i;
+}
+
+#define __DECLARE_X16_CONVERTER_NEON(cpu_type, x16, xe, wire_le, htoxx, xxtoh)      \
+    DECLARE_CONVERTER(cpu_type, 1, sc16_item32_##xe, 1, PRIORITY_SIMD)              \
+    {                                                                               \
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(inputs[0]);       \
+        item32_t* output      = reinterpret_cast<item32_t*>(outputs[0]);            \
+        const size_t i        = x16_to_sc16_neon<true, wire_le, x16##_4x_to_f32>(   \
+            input, output, nsamps, scale_factor);                                   \
+        x16_to_item32_sc16<htoxx, x16##_x1_to_f32>(                                 \
+            input + 2 * i, output + i, nsamps - i, scale_factor);                   \
+    }                                                                               \
+    DECLARE_CONVERTER(sc16_item32_##xe, 1, cpu_type, 1, PRIORITY_SIMD)              \
+    {                                                                               \
+        const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);       \
+        uint16_t* output      = reinterpret_cast<uint16_t*>(outputs[0]);            \
+        const size_t i        = sc16_to_x16_neon<true, wire_le, f32_to_##x16##_4x>( \
+            input, output, nsamps, scale_factor);                                   \
+        item32_sc16_to_x16<xxtoh, f32_to_##x16##_x1>(                               \
+            input + i, output + 2 * i, nsamps - i, scale_factor);                   \
+    }
+
+#define _DECLARE_X16_CONVERTER_NEON(cpu_type, x16)                                 \
+    __DECLARE_X16_CONVERTER_NEON(cpu_type, x16, be, false, uhd::htonx, uhd::ntohx) \
+    __DECLARE_X16_CONVERTER_NEON(cpu_type, x16, le, true, uhd::htowx, uhd::wtohx)  \
+    DECLARE_CONVERTER(cpu_type, 1, sc16_chdr, 1, PRIORITY_SIMD)                    \
+    {                                                                              \
+        const uint16_t* input = reinterpret_cast<const uint16_t*>(inputs[0]);      \
+        sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);             \
+        const size_t i        = x16_to_sc16_neon<false, false, x16##_4x_to_f32>(   \
+            input, output, nsamps, scale_factor);                                  \
+        x16_to_chdr_sc16<x16##_x1_to_f32>(                                         \
+            input + 2 * i, output + i, nsamps - i, scale_factor);                  \
+    }                                                                              \
+    DECLARE_CONVERTER(sc16_chdr, 1, cpu_type, 1, PRIORITY_SIMD)                    \
+    {                                                                              \
+        const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);          \
+        uint16_t* output    = reinterpret_cast<uint16_t*>(outputs[0]);             \
+        const size_t i      = sc16_to_x16_neon<false, false, f32_to_##x16##_4x>(   \
+            input, output, nsamps, scale_factor);                                  \
+        chdr_sc16_to_x16<f32_to_##x16##_x1>(                                       \
+            input + i, output + 2 * i, nsamps - i, scale_factor);                  \
+    }
+
+#ifdef UHD_NEON_HAVE_FP16
+/* Create fc16<->sc16(otw) */
+_DECLARE_X16_CONVERTER_NEON(fc16, f16)
+#endif
+/* Create bf16<->sc16(otw) */
+_DECLARE_X16_CONVERTER_NEON(bf16, bf16)
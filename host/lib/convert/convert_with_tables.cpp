@@ -19,6 +19,8 @@ typedef uint16_t (*tohost16_type)(uint16_t);
 /***********************************************************************
  * Implementation for sc16 to sc8 lookup table
  *  - Lookup the real and imaginary parts individually
+ *  - The table is much larger than the caches, so this is only a fallback
+ *    for the SIMD converters (see sse2_sc16_to_sc8.cpp)
  **********************************************************************/
 template <bool swap>
 class convert_sc16_1_to_sc8_item32_1 : public converter
@@ -30,7 +32,7 @@ public:
     {
         for (size_t i = 0; i < sc16_table_len; i++) {
             const int16_t val = uint16_t(i);
-            _table[i]         = int8_t(std::lround(val * scalar / 32767.));
+            _table[i]         = clamp<int8_t>(std::lround(val * scalar / 32767.));
         }
     }
 
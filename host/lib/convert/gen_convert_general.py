@@ -18,6 +18,7 @@ TMPL_HEADER = """
  **********************************************************************/
 
 #include "convert_common.hpp"
+#include "convert_item32.hpp"
 #include <uhd/utils/byteswap.hpp>
 #include <algorithm>
 #include <cstring>
@@ -84,9 +85,7 @@ DECLARE_CONVERTER({in_type}, 1, {out_type}, 1, PRIORITY_GENERAL) {{
     const item32_t *input = reinterpret_cast<const item32_t *>(inputs[0]);
     item32_t *output = reinterpret_cast<item32_t *>(outputs[0]);
 
-    for (size_t i = 0; i < nsamps; i++) {{
-        output[i] = {to_wire_or_host}(input[i]);
-    }}
+    swap_wire_words<{endianness}>(input, output, nsamps);
 }}
 """
 
@@ -97,9 +96,7 @@ DECLARE_CONVERTER({in_type}, 1, {out_type}, 1, PRIORITY_GENERAL) {{
     item32_t *output = reinterpret_cast<item32_t *>(outputs[0]);
 
     // An item64 is two item32_t's
-    for (size_t i = 0; i < nsamps * 2; i++) {{
-        output[i] = {to_wire_or_host}(input[i]);
-    }}
+    swap_wire_words<{endianness}>(input, output, nsamps * 2);
 }}
 """
 
@@ -153,18 +150,14 @@ DECLARE_CONVERTER(s16, 1, s16_item32_{end}, 1, PRIORITY_GENERAL) {{
     const uint16_t *input = reinterpret_cast<const uint16_t *>(inputs[0]);
     uint16_t *output = reinterpret_cast<uint16_t *>(outputs[0]);
 
-    for (size_t i = 0; i < nsamps; i++) {{
-        output[i] = {to_wire}(input[i]);
-    }}
+    swap_wire_words<{endianness}>(input, output, nsamps);
 }}
 
 DECLARE_CONVERTER(s16_item32_{end}, 1, s16, 1, PRIORITY_GENERAL) {{
     const uint16_t *input = reinterpret_cast<const uint16_t *>(inputs[0]);
     uint16_t *output = reinterpret_cast<uint16_t *>(outputs[0]);
 
-    for (size_t i = 0; i < nsamps; i++) {{
-        output[i] = {to_host}(input[i]);
-    }}
+    swap_wire_words<{endianness}>(input, output, nsamps);
 }}
 """
 
@@ -256,19 +249,22 @@ if __name__ == '__main__':
                 ptr_type=ptr_type)
     ## Generate all data types that are exactly
     ## item32 or multiples thereof:
-    for end in ('be', 'le'):
-        host_to_wire = {'be': 'uhd::htonx', 'le': 'uhd::htowx'}[end]
-        wire_to_host = {'be': 'uhd::ntohx', 'le': 'uhd::wtohx'}[end]
+    # Swapping the bytes is the same in both directions, so only the wire
+    # endianness matters.
+    for end, endianness in (
+        ('be', 'uhd::ENDIANNESS_BIG'),
+        ('le', 'uhd::ENDIANNESS_LITTLE'),
+    ):
         # item32 types (sc16->sc16 is a special case because it defaults
         # to Q/I order on the wire:
-        for in_type, out_type, to_wire_or_host in (
-                ('item32', 'sc16_item32_{end}', host_to_wire),
-                ('sc16_item32_{end}', 'item32', wire_to_host),
-                ('f32', 'f32_item32_{end}', host_to_wire),
-                ('f32_item32_{end}', 'f32', wire_to_host),
+        for in_type, out_type in (
+                ('item32', 'sc16_item32_{end}'),
+                ('sc16_item32_{end}', 'item32'),
+                ('f32', 'f32_item32_{end}'),
+                ('f32_item32_{end}', 'f32'),
         ):
             output += TMPL_CONV_ITEM32.format(
-                    end=end, to_wire_or_host=to_wire_or_host,
+                    end=end, endianness=endianness,
                     in_type=in_type.format(end=end), out_type=out_type.format(end=end)
             )
         # 2xitem32 types:
@@ -277,18 +273,16 @@ if __name__ == '__main__':
                 ('fc32_item32_{end}', 'fc32'),
         ):
             output += TMPL_CONV_ITEM64.format(
-                    end=end, to_wire_or_host=to_wire_or_host,
+                    end=end, endianness=endianness,
                     in_type=in_type.format(end=end), out_type=out_type.format(end=end)
             )
 
     ## Real 16-Bit:
-    for end, to_host, to_wire in (
-        ('be', 'uhd::ntohx', 'uhd::htonx'),
-        ('le', 'uhd::wtohx', 'uhd::htowx'),
+    for end, endianness in (
+        ('be', 'uhd::ENDIANNESS_BIG'),
+        ('le', 'uhd::ENDIANNESS_LITTLE'),
     ):
-        output += TMPL_CONV_S16.format(
-            end=end, to_host=to_host, to_wire=to_wire
-        )
+        output += TMPL_CONV_S16.format(end=end, endianness=endianness)
 
     ## Real 8-Bit Types:
     for us8 in ('u8', 's8'):
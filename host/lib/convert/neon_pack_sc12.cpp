@@ -0,0 +1,144 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_pack_sc12.hpp"
+#include <arm_neon.h>
+
+/*
+ * This works like the AVX2 converter (see avx2_pack_sc12.cpp): Every uint32
+ * holds the I (lower half) and the Q (upper half) of a sample. Both are reduced
+ * to their upper 12 bits and packed into the lower 24 bits, then a table
+ * lookup moves the 3 bytes of each sample into wire order.
+ */
+static const uint8_t SC12_PACK_TABLE_LE[16] = {
+    6, 0, 1, 2, 9, 10, 4, 5, 12, 13, 14, 8, 0xff, 0xff, 0xff, 0xff};
+static const uint8_t SC12_PACK_TABLE_BE[16] = {
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0xff, 0xff, 0xff, 0xff};
+
+UHD_INLINE int16x8_t load_sc16_4x(const sc16_t* input, const float32x4_t)
+{
+    return vld1q_s16(reinterpret_cast<const int16_t*>(input));
+}
+
+//! Scale 4 fc32 samples, and return them as sc16 with 12 significant bits
+UHD_INLINE int16x8_t load_sc16_4x(const fc32_t* input, const float32x4_t scalar)
+{
+    const float32x4_t tmp0 = vld1q_f32(reinterpret_cast<const float*>(input + 0));
+    const float32x4_t tmp1 = vld1q_f32(reinterpret_cast<const float*>(input + 2));
+
+    // vcvtq_s32_f32() truncates like the generic converter
+    const int32x4_t tmpi0 = vcvtq_s32_f32(vmulq_f32(tmp0, scalar));
+    const int32x4_t tmpi1 = vcvtq_s32_f32(vmulq_f32(tmp1, scalar));
+
+    // align the 12 bits to the top, the narrowing saturates them
+    return vcombine_s16(
+        vqmovn_s32(vshlq_n_s32(tmpi0, 4)), vqmovn_s32(vshlq_n_s32(tmpi1, 4)));
+}
+
+//! Pack 4 sc16 samples into an item32_sc12_3x
+UHD_INLINE void pack_sc12_4x(const int16x8_t in,
+    item32_sc12_3x* output,
+    const uint8x8_t idx_lo,
+    const uint8x8_t idx_hi)
+{
+    const uint32x4_t tmp = vreinterpretq_u32_s16(in);
+    const uint32x4_t i   = vshlq_n_u32(vandq_u32(tmp, vdupq_n_u32(0xfff0)), 8);
+    const uint32x4_t q   = vshrq_n_u32(tmp, 20);
+    const uint8x16_t iq  = vreinterpretq_u8_u32(vorrq_u32(i, q));
+
+    // write exactly 12 bytes
+    const uint8x8x2_t table = {{vget_low_u8(iq), vget_high_u8(iq)}};
+    const uint8x8_t lo      = vtbl2_u8(table, idx_lo);
+    const uint8x8_t hi      = vtbl2_u8(table, idx_hi);
+    uint8_t* out            = reinterpret_cast<uint8_t*>(output);
+    vst1_u8(out, lo);
+    vst1_lane_u32(reinterpret_cast<uint32_t*>(out + 8), vreinterpret_u32_u8(hi), 0);
+}
+
+template <typename type, towire32_type towire, bool wire_le>
+struct convert_star_1_to_sc12_item32_neon : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const std::complex<type>* input =
+            reinterpret_cast<const std::complex<type>*>(inputs[0]);
+        item32_sc12_3x* output;
+
+        size_t i = convert_star_to_sc12_item32_head<type, towire>(
+            input, outputs[0], _scalar, output);
+        if (i >= nsamps) {
+            return;
+        }
+
+        const float32x4_t scalar = vdupq_n_f32(float(_scalar));
+        const uint8x16_t idx =
+            vld1q_u8(wire_le ? SC12_PACK_TABLE_LE : SC12_PACK_TABLE_BE);
+        const uint8x8_t idx_lo = vget_low_u8(idx);
+        const uint8x8_t idx_hi = vget_high_u8(idx);
+        for (; i + 3 < nsamps; i += 4, output++) {
+            pack_sc12_4x(load_sc16_4x(input + i, scalar), output, idx_lo, idx_hi);
+        }
+
+        convert_star_to_sc12_item32_tail<type, towire>(
+            input + i, output, nsamps - i, _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_neon<float, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_be_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_neon<float, uhd::ntohx, false>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_neon<short, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_be_1(void)
+{
+    return converter::sptr(
+        new convert_star_1_to_sc12_item32_neon<short, uhd::ntohx, false>());
+}
+
+UHD_STATIC_BLOCK(register_neon_pack_sc12)
+{
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.input_format  = "fc32";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD);
+    id.output_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_be_1, PRIORITY_SIMD);
+
+    id.input_format  = "sc16";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD);
+    id.output_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_be_1, PRIORITY_SIMD);
+}
@@ -0,0 +1,138 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <arm_neon.h>
+
+using namespace uhd::convert;
+
+/*
+ * This works like the AVX2 converter (see avx2_unpack_sc12.cpp): A table
+ * lookup collects the 2 bytes which hold each 12-bit number into a 16-bit
+ * element, high byte first in wire order. The I values then fill the upper 12
+ * bits of their element already, while the Q values start 4 bits lower.
+ */
+static const uint8_t SC12_UNPACK_TABLE_LE[16] = {
+    2, 3, 1, 2, 7, 0, 6, 7, 4, 5, 11, 4, 9, 10, 8, 9};
+static const uint8_t SC12_UNPACK_TABLE_BE[16] = {
+    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10};
+
+//! Unpack an item32_sc12_3x into 4 sc16 samples
+UHD_INLINE int16x8_t unpack_sc12_4x(
+    const item32_sc12_3x* input, const uint8x8_t idx_lo, const uint8x8_t idx_hi)
+{
+    // read exactly 12 bytes
+    const uint8_t* in   = reinterpret_cast<const uint8_t*>(input);
+    const uint32x2_t hi = vld1_lane_u32(
+        reinterpret_cast<const uint32_t*>(in + 8), vdup_n_u32(0), 0);
+    const uint8x8x2_t table = {{vld1_u8(in), vreinterpret_u8_u32(hi)}};
+    const uint16x8_t tmp    = vreinterpretq_u16_u8(
+        vcombine_u8(vtbl2_u8(table, idx_lo), vtbl2_u8(table, idx_hi)));
+
+    // align the Q values (the upper half of each uint32) to the top
+    const int16x8_t shift = vreinterpretq_s16_u32(vdupq_n_u32(0x00040000));
+    return vreinterpretq_s16_u16(vandq_u16(vshlq_u16(tmp, shift), vdupq_n_u16(0xfff0)));
+}
+
+UHD_INLINE void store_sc16_4x(const int16x8_t in, sc16_t* output, const float32x4_t)
+{
+    vst1q_s16(reinterpret_cast<int16_t*>(output), in);
+}
+
+UHD_INLINE void store_sc16_4x(
+    const int16x8_t in, fc32_t* output, const float32x4_t scalar)
+{
+    const float32x4_t tmp0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(in)));
+    const float32x4_t tmp1 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(in)));
+
+    vst1q_f32(reinterpret_cast<float*>(output + 0), vmulq_f32(tmp0, scalar));
+    vst1q_f32(reinterpret_cast<float*>(output + 2), vmulq_f32(tmp1, scalar));
+}
+
+template <typename type, tohost32_type tohost, bool wire_le>
+struct convert_sc12_item32_1_to_star_neon : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        const item32_sc12_3x* input;
+
+        size_t o = convert_sc12_item32_to_star_head<type, tohost>(
+            inputs[0], output, _scalar, input);
+        if (o >= nsamps) {
+            return;
+        }
+
+        const float32x4_t scalar = vdupq_n_f32(float(_scalar));
+        const uint8x16_t idx =
+            vld1q_u8(wire_le ? SC12_UNPACK_TABLE_LE : SC12_UNPACK_TABLE_BE);
+        const uint8x8_t idx_lo = vget_low_u8(idx);
+        const uint8x8_t idx_hi = vget_high_u8(idx);
+        for (; o + 3 < nsamps; o += 4, input++) {
+            store_sc16_4x(unpack_sc12_4x(input, idx_lo, idx_hi), output + o, scalar);
+        }
+
+        convert_sc12_item32_to_star_tail<type, tohost>(
+            input, output + o, nsamps - o, _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_neon<float, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_fc32_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_neon<float, uhd::ntohx, false>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_neon<short, uhd::wtohx, true>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_sc16_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_1_to_star_neon<short, uhd::ntohx, false>());
+}
+
+UHD_STATIC_BLOCK(register_neon_unpack_sc12)
+{
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.output_format = "fc32";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_fc32_1, PRIORITY_SIMD);
+
+    id.output_format = "sc16";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_sc16_1, PRIORITY_SIMD);
+}
@@ -0,0 +1,134 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <emmintrin.h>
+
+using namespace uhd::convert;
+
+/*! Deinterleave 4 sc16 samples, and scale them
+ *
+ * Every int32 of \p in holds one sample. If \p i_hi, the I value is in the upper
+ * half of the int32 (sc16_item32_le), otherwise in the lower half (sc16_chdr).
+ */
+template <bool i_hi>
+UHD_INLINE void unpack_planar_4x(
+    const __m128i& in, __m128& out_i, __m128& out_q, const __m128& scalar)
+{
+    // arithmetic shifts sign-extend the values to int32
+    const __m128i hi = _mm_srai_epi32(in, 16);
+    const __m128i lo = _mm_srai_epi32(_mm_slli_epi32(in, 16), 16);
+    out_i            = _mm_mul_ps(_mm_cvtepi32_ps(i_hi ? hi : lo), scalar);
+    out_q            = _mm_mul_ps(_mm_cvtepi32_ps(i_hi ? lo : hi), scalar);
+}
+
+//! Scale and interleave 4 samples, the inverse of unpack_planar_4x()
+template <bool i_hi>
+UHD_INLINE __m128i pack_planar_4x(
+    const float* input_i, const float* input_q, const __m128& scalar)
+{
+    const __m128i tmp_i = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(input_i), scalar));
+    const __m128i tmp_q = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(input_q), scalar));
+
+    // saturate to int16, i.e., I0..I3 followed by Q0..Q3
+    const __m128i tmp = _mm_packs_epi32(tmp_i, tmp_q);
+    const __m128i q   = _mm_unpackhi_epi64(tmp, tmp);
+    return i_hi ? _mm_unpacklo_epi16(q, tmp) : _mm_unpacklo_epi16(tmp, q);
+}
+
+template <bool i_hi>
+UHD_INLINE size_t sc16_to_fc32_planar(const void* input,
+    float* output_i,
+    float* output_q,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    const __m128i* in   = reinterpret_cast<const __m128i*>(input);
+    const __m128 scalar = _mm_set_ps1(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        __m128 out_i, out_q;
+        unpack_planar_4x<i_hi>(_mm_loadu_si128(in++), out_i, out_q, scalar);
+        _mm_storeu_ps(output_i + i, out_i);
+        _mm_storeu_ps(output_q + i, out_q);
+    }
+    return i;
+}
+
+template <bool i_hi>
+UHD_INLINE size_t fc32_planar_to_sc16(const float* input_i,
+    const float* input_q,
+    void* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    __m128i* out        = reinterpret_cast<__m128i*>(output);
+    const __m128 scalar = _mm_set_ps1(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        _mm_storeu_si128(out++, pack_planar_4x<i_hi>(input_i + i, input_q + i, scalar));
+    }
+    return i;
+}
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc32_planar, 2, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    f32_t* output_i     = reinterpret_cast<f32_t*>(outputs[0]);
+    f32_t* output_q     = reinterpret_cast<f32_t*>(outputs[1]);
+
+    const size_t i =
+        sc16_to_fc32_planar<false>(input, output_i, output_q, nsamps, scale_factor);
+
+    // convert remainder
+    chdr_sc16_to_planar(
+        input + i, output_i + i, output_q + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16_item32_le, 1, fc32_planar, 2, PRIORITY_SIMD)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    f32_t* output_i       = reinterpret_cast<f32_t*>(outputs[0]);
+    f32_t* output_q       = reinterpret_cast<f32_t*>(outputs[1]);
+
+    const size_t i =
+        sc16_to_fc32_planar<true>(input, output_i, output_q, nsamps, scale_factor);
+
+    // convert remainder
+    item32_sc16_to_planar<uhd::wtohx>(
+        input + i, output_i + i, output_q + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32_planar, 2, sc16_chdr, 1, PRIORITY_SIMD)
+{
+    const f32_t* input_i = reinterpret_cast<const f32_t*>(inputs[0]);
+    const f32_t* input_q = reinterpret_cast<const f32_t*>(inputs[1]);
+    sc16_t* output       = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const size_t i =
+        fc32_planar_to_sc16<false>(input_i, input_q, output, nsamps, scale_factor);
+
+    // convert remainder
+    planar_to_chdr_sc16(
+        input_i + i, input_q + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(fc32_planar, 2, sc16_item32_le, 1, PRIORITY_SIMD)
+{
+    const f32_t* input_i = reinterpret_cast<const f32_t*>(inputs[0]);
+    const f32_t* input_q = reinterpret_cast<const f32_t*>(inputs[1]);
+    item32_t* output     = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const size_t i =
+        fc32_planar_to_sc16<true>(input_i, input_q, output, nsamps, scale_factor);
+
+    // convert remainder
+    planar_to_item32_sc16<uhd::wtohx>(
+        input_i + i, input_q + i, output + i, nsamps - i, scale_factor);
+}
@@ -11,13 +11,34 @@
 
 using namespace uhd::convert;
 
-DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
+//! Return a vector which contains \p c in every I/Q pair
+UHD_INLINE __m128 broadcast_iq(const fc32_t& c)
+{
+    return _mm_setr_ps(c.real(), c.imag(), c.real(), c.imag());
+}
+
+/*! Apply an IQ-balance/DC-offset correction to 2 scaled fc32 samples
+ *
+ * \p dc and \p iq contain the DC offset and the IQ-balance correction in
+ * every I/Q pair. The I value of every sample is duplicated into both lanes so
+ * that the magnitude and phase corrections are a single multiply-add.
+ */
+UHD_INLINE __m128 apply_correction_2x(const __m128 y, const __m128& dc, const __m128& iq)
+{
+    const __m128 tmp = _mm_add_ps(y, dc);
+    return _mm_add_ps(
+        tmp, _mm_mul_ps(_mm_shuffle_ps(tmp, tmp, _MM_SHUFFLE(2, 2, 0, 0)), iq));
+}
+
+DECLARE_CORRECTING_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
     fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
 
     const __m128 scalar = _mm_set_ps1(float(scale_factor) / (1 << 16));
     const __m128i zeroi = _mm_setzero_si128();
+    const __m128 dc     = broadcast_iq(dc_offset);
+    const __m128 iq     = broadcast_iq(iq_corr);
 
 // this macro converts values faster by using SSE intrinsics to convert 4 values at a time
 #define convert_item32_1_to_fc32_1_nswap_guts(_al_)                                    \
@@ -34,6 +55,10 @@ DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
         /* convert and scale */                                                        \
         __m128 tmplo = _mm_mul_ps(_mm_cvtepi32_ps(tmpilo), scalar);                    \
         __m128 tmphi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);                    \
+        if (corr_enabled) {                                                            \
+            tmplo = apply_correction_2x(tmplo, dc, iq);                                \
+            tmphi = apply_correction_2x(tmphi, dc, iq);                                \
+        }                                                                              \
                                                                                        \
         /* store to output */                                                          \
         _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);          \
@@ -52,6 +77,9 @@ DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
             item32_sc16_to_xx<uhd::htowx>(input, output, 1, scale_factor);
+            if (corr_enabled) {
+                apply_correction(output, 1, iq_corr, dc_offset);
+            }
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
@@ -64,15 +92,20 @@ DECLARE_CONVERTER(sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD)
 
     // convert any remaining samples
     item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
 }
 
-DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
+DECLARE_CORRECTING_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
     fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
 
     const __m128 scalar = _mm_set_ps1(float(scale_factor) / (1 << 16));
     const __m128i zeroi = _mm_setzero_si128();
+    const __m128 dc     = broadcast_iq(dc_offset);
+    const __m128 iq     = broadcast_iq(iq_corr);
 
 // this macro converts values faster by using SSE intrinsics to convert 4 values at a time
 #define convert_item32_1_to_fc32_1_bswap_guts(_al_)                                      \
@@ -88,6 +121,10 @@ DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
         /* convert and scale */                                                          \
         __m128 tmplo = _mm_mul_ps(_mm_cvtepi32_ps(tmpilo), scalar);                      \
         __m128 tmphi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);                      \
+        if (corr_enabled) {                                                              \
+            tmplo = apply_correction_2x(tmplo, dc, iq);                                  \
+            tmphi = apply_correction_2x(tmphi, dc, iq);                                  \
+        }                                                                                \
                                                                                          \
         /* store to output */                                                            \
         _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);            \
@@ -106,6 +143,9 @@ DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
             item32_sc16_to_xx<uhd::htonx>(input, output, 1, scale_factor);
+            if (corr_enabled) {
+                apply_correction(output, 1, iq_corr, dc_offset);
+            }
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
@@ -118,15 +158,20 @@ DECLARE_CONVERTER(sc16_item32_be, 1, fc32, 1, PRIORITY_SIMD)
 
     // convert any remaining samples
     item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
 }
 
-DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
+DECLARE_CORRECTING_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
 {
     const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
     fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
 
     const __m128 scalar = _mm_set_ps1(float(scale_factor) / (1 << 16));
     const __m128i zeroi = _mm_setzero_si128();
+    const __m128 dc     = broadcast_iq(dc_offset);
+    const __m128 iq     = broadcast_iq(iq_corr);
 
 // this macro converts values faster by using SSE intrinsics to convert 4 values at a time
 #define convert_item32_1_to_fc32_1_guts(_al_)                                          \
@@ -141,6 +186,10 @@ DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
         /* convert and scale */                                                        \
         __m128 tmplo = _mm_mul_ps(_mm_cvtepi32_ps(tmpilo), scalar);                    \
         __m128 tmphi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);                    \
+        if (corr_enabled) {                                                            \
+            tmplo = apply_correction_2x(tmplo, dc, iq);                                \
+            tmphi = apply_correction_2x(tmphi, dc, iq);                                \
+        }                                                                              \
                                                                                        \
         /* store to output */                                                          \
         _mm_store##_al_##ps(reinterpret_cast<float*>(output + i + 0), tmplo);          \
@@ -159,6 +208,9 @@ DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
             // the first sample is 8-byte aligned - process it to align the remainder of
             // the samples to 16-bytes
             chdr_sc16_to_xx(input, output, 1, scale_factor);
+            if (corr_enabled) {
+                apply_correction(output, 1, iq_corr, dc_offset);
+            }
             i++;
             // do faster processing of the bulk of the samples now that we are 16-byte
             // aligned
@@ -171,4 +223,7 @@ DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
 
     // convert any remaining samples
     chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+    if (corr_enabled) {
+        apply_correction(output + i, nsamps - i, iq_corr, dc_offset);
+    }
 }
@@ -0,0 +1,80 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <emmintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * Every channel is converted 4 samples at a time, like the sc16_chdr to fc32
+ * converter (see sse2_sc16_to_fc32.cpp), but every sample gets stored at its
+ * position in the interleaved output on its own.
+ */
+struct convert_sc16_chdr_n_to_fc32_interleaved_sse2 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        fc32_t* output         = reinterpret_cast<fc32_t*>(outputs[0]);
+        const size_t num_chans = inputs.size();
+        const __m128 scalar    = _mm_set_ps1(float(_scalar));
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[ch]);
+            fc32_t* out         = output + ch;
+
+            size_t i = 0;
+            for (; i + 3 < nsamps; i += 4) {
+                const __m128i tmpi =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+                // unpacking a register with itself puts every int16 into the
+                // upper half of an int32, an arithmetic shift sign-extends it
+                const __m128i lo  = _mm_srai_epi32(_mm_unpacklo_epi16(tmpi, tmpi), 16);
+                const __m128i hi  = _mm_srai_epi32(_mm_unpackhi_epi16(tmpi, tmpi), 16);
+                const __m128 tmp0 = _mm_mul_ps(_mm_cvtepi32_ps(lo), scalar);
+                const __m128 tmp1 = _mm_mul_ps(_mm_cvtepi32_ps(hi), scalar);
+
+                _mm_storel_pi(reinterpret_cast<__m64*>(out + (i + 0) * num_chans), tmp0);
+                _mm_storeh_pi(reinterpret_cast<__m64*>(out + (i + 1) * num_chans), tmp0);
+                _mm_storel_pi(reinterpret_cast<__m64*>(out + (i + 2) * num_chans), tmp1);
+                _mm_storeh_pi(reinterpret_cast<__m64*>(out + (i + 3) * num_chans), tmp1);
+            }
+
+            // convert remainder
+            chdr_sc16_to_interleaved(
+                input + i, out + i * num_chans, num_chans, nsamps - i, _scalar);
+        }
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_sc16_chdr_n_to_fc32_interleaved_sse2(void)
+{
+    return converter::sptr(new convert_sc16_chdr_n_to_fc32_interleaved_sse2());
+}
+
+UHD_STATIC_BLOCK(register_convert_sc16_chdr_n_to_fc32_interleaved_sse2)
+{
+    uhd::convert::id_type id;
+    id.input_format  = "sc16_chdr";
+    id.output_format = "fc32";
+    id.num_outputs   = 1;
+
+    for (size_t num_chans = 2; num_chans <= MAX_INTERLEAVED_CHANS; num_chans++) {
+        id.num_inputs = num_chans;
+        uhd::convert::register_converter(
+            id, &make_convert_sc16_chdr_n_to_fc32_interleaved_sse2, PRIORITY_SIMD);
+    }
+}
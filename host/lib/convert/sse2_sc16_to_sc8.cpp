@@ -0,0 +1,88 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <emmintrin.h>
+
+using namespace uhd::convert;
+
+/*! Scale and round 4 int16 values, which are in the upper halves of the int32s
+ *  of \p in, and reorder them with \p shuf
+ */
+template <const int shuf>
+UHD_INLINE __m128i scale_s16_4x(const __m128i& in, const __m128& scalar)
+{
+    // an arithmetic shift sign-extends the values to int32
+    const __m128 tmp   = _mm_cvtepi32_ps(_mm_srai_epi32(in, 16));
+    const __m128i tmpi = _mm_cvtps_epi32(_mm_mul_ps(tmp, scalar));
+    return _mm_shuffle_epi32(tmpi, shuf);
+}
+
+/*! Convert 8 sc16 samples to sc8 (4 item32s)
+ *
+ * The samples are sign-extended to int32, scaled as floats, and packed with
+ * signed saturation, first into int16 and then into int8. \p shuf reorders the
+ * values of every item32 into the wire format.
+ */
+template <const int shuf>
+UHD_INLINE __m128i pack_sc16_to_sc8_8x(
+    const __m128i& in0, const __m128i& in1, const __m128& scalar)
+{
+    // unpacking a register with itself puts every int16 into the upper half of
+    // an int32
+    const __m128i tmpi0 = scale_s16_4x<shuf>(_mm_unpacklo_epi16(in0, in0), scalar);
+    const __m128i tmpi1 = scale_s16_4x<shuf>(_mm_unpackhi_epi16(in0, in0), scalar);
+    const __m128i lo    = _mm_packs_epi32(tmpi0, tmpi1);
+
+    const __m128i tmpi2 = scale_s16_4x<shuf>(_mm_unpacklo_epi16(in1, in1), scalar);
+    const __m128i tmpi3 = scale_s16_4x<shuf>(_mm_unpackhi_epi16(in1, in1), scalar);
+    const __m128i hi    = _mm_packs_epi32(tmpi2, tmpi3);
+
+    return _mm_packs_epi16(lo, hi);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m128 scalar = _mm_set_ps1(float(scale_factor / 32767.));
+    const int shuf      = _MM_SHUFFLE(3, 2, 1, 0);
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        const __m128i tmp0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i tmp1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + j),
+            pack_sc16_to_sc8_8x<shuf>(tmp0, tmp1, scalar));
+    }
+
+    // convert remainder
+    sc16_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m128 scalar = _mm_set_ps1(float(scale_factor / 32767.));
+    const int shuf      = _MM_SHUFFLE(0, 1, 2, 3);
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        const __m128i tmp0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i tmp1 =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + j),
+            pack_sc16_to_sc8_8x<shuf>(tmp0, tmp1, scalar));
+    }
+
+    // convert remainder
+    sc16_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
@@ -11,8 +11,12 @@
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/discovery_cache.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <uhdlib/utils/prefs.hpp>
 #include <boost/functional/hash.hpp>
+#include <boost/optional.hpp>
+#include <algorithm>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -79,27 +83,140 @@ device::~device(void)
 /***********************************************************************
  * Discover
  **********************************************************************/
-device_addrs_t device::find(const device_addr_t& hint, device_filter_t filter)
-{
-    std::lock_guard<std::mutex> lock(_device_mutex);
+//! A discovered device, and the index of the finder that found it
+typedef std::tuple<device_addr_t, size_t> found_device_t;
 
-    device_addrs_t device_addrs;
-    std::vector<std::future<device_addrs_t>> find_tasks;
-    for (const auto& fcn : get_dev_fcn_regs()) {
-        if (filter == ANY or std::get<2>(fcn) == filter) {
-            find_tasks.emplace_back(std::async(
-                std::launch::async, [fcn, hint]() { return std::get<0>(fcn)(hint); }));
+/*!
+ * Run all finders that match the filter in parallel.
+ * \return the discovered devices, ordered by finder index
+ */
+static std::vector<found_device_t> probe_devices(
+    const device_addr_t& hint, device::device_filter_t filter)
+{
+    const auto& regs = get_dev_fcn_regs();
+    std::vector<std::tuple<size_t, std::future<device_addrs_t>>> find_tasks;
+    for (size_t finder_idx = 0; finder_idx < regs.size(); finder_idx++) {
+        if (filter == device::ANY or std::get<2>(regs[finder_idx]) == filter) {
+            const auto find = std::get<0>(regs[finder_idx]);
+            find_tasks.emplace_back(finder_idx,
+                std::async(std::launch::async, [find, hint]() { return find(hint); }));
         }
     }
+    std::vector<found_device_t> found_devices;
     for (auto& find_task : find_tasks) {
         try {
-            device_addrs_t discovered_addrs = find_task.get();
-            device_addrs.insert(
-                device_addrs.begin(), discovered_addrs.begin(), discovered_addrs.end());
+            for (const auto& dev_addr : std::get<1>(find_task).get()) {
+                found_devices.emplace_back(dev_addr, std::get<0>(find_task));
+            }
         } catch (const std::exception& e) {
             UHD_LOGGER_ERROR("UHD") << "Device discovery error: " << e.what();
         }
     }
+    return found_devices;
+}
+
+/*!
+ * Look for cached devices again, using only their own address as a hint.
+ * Unlike a full discovery, this does not need to wait for broadcast replies.
+ * \return the devices, or nothing if any of them is gone or has changed
+ */
+static boost::optional<std::vector<found_device_t>> revalidate_devices(
+    const discovery_cache::entries_t& entries)
+{
+    const auto& regs = get_dev_fcn_regs();
+    std::vector<std::future<device_addrs_t>> probe_tasks;
+    for (const auto& entry : entries) {
+        if (entry.finder_idx >= regs.size()) {
+            return boost::none;
+        }
+        // The claimed status may change from one run to the next
+        device_addr_t probe_hint = entry.dev_addr;
+        if (probe_hint.has_key("claimed")) {
+            probe_hint.pop("claimed");
+        }
+        const auto find = std::get<0>(regs[entry.finder_idx]);
+        probe_tasks.emplace_back(std::async(
+            std::launch::async, [find, probe_hint]() { return find(probe_hint); }));
+    }
+
+    std::vector<found_device_t> found_devices;
+    for (size_t i = 0; i < entries.size(); i++) {
+        device_addrs_t probed_addrs;
+        try {
+            probed_addrs = probe_tasks[i].get();
+        } catch (const std::exception& e) {
+            UHD_LOGGER_DEBUG("UHD") << "Device discovery error: " << e.what();
+        }
+        const device_addr_t& cached_addr = entries[i].dev_addr;
+        auto same_device = [&cached_addr](const device_addr_t& dev_addr) {
+            return not cached_addr.has_key("serial")
+                   or dev_addr.get("serial", "") == cached_addr["serial"];
+        };
+        const auto probed_addr =
+            std::find_if(probed_addrs.begin(), probed_addrs.end(), same_device);
+        if (probed_addr == probed_addrs.end()) {
+            return boost::none;
+        }
+        found_devices.emplace_back(*probed_addr, entries[i].finder_idx);
+    }
+    return found_devices;
+}
+
+/*!
+ * Discover devices, using the discovery cache if it's enabled.
+ * \return the discovered devices, ordered by finder index
+ */
+static std::vector<found_device_t> find_devices(
+    const device_addr_t& hint, device::device_filter_t filter)
+{
+    // Modules can register devices, so load them before looking
+    uhd::load_modules();
+    const std::string cache_path = discovery_cache::get_path_from_env();
+    if (cache_path.empty()) {
+        return probe_devices(hint, filter);
+    }
+
+    discovery_cache cache(cache_path);
+    const std::string key = discovery_cache::make_key(hint, filter);
+    if (const auto entries = cache.lookup(key)) {
+        if (const auto found_devices = revalidate_devices(*entries)) {
+            UHD_LOGGER_DEBUG("UHD")
+                << "Using cached discovery results for: " << hint.to_string();
+            return *found_devices;
+        }
+        UHD_LOGGER_DEBUG("UHD") << "Cached discovery results are stale, running "
+                                   "full discovery for: "
+                                << hint.to_string();
+    }
+
+    const auto found_devices = probe_devices(hint, filter);
+    if (found_devices.empty()) {
+        cache.erase(key);
+    } else {
+        discovery_cache::entries_t entries;
+        for (const auto& found_device : found_devices) {
+            entries.push_back({std::get<1>(found_device), std::get<0>(found_device)});
+        }
+        cache.store(key, entries);
+    }
+    return found_devices;
+}
+
+device_addrs_t device::find(const device_addr_t& hint, device_filter_t filter)
+{
+    std::lock_guard<std::mutex> lock(_device_mutex);
+
+    auto found_devices = find_devices(hint, filter);
+    // find() has always listed the devices of later finders first
+    std::stable_sort(found_devices.begin(),
+        found_devices.end(),
+        [](const found_device_t& lhs, const found_device_t& rhs) {
+            return std::get<1>(lhs) > std::get<1>(rhs);
+        });
+    device_addrs_t device_addrs;
+    for (const auto& found_device : found_devices) {
+        device_addrs.push_back(std::get<0>(found_device));
+    }
 
     return device_addrs;
 }
@@ -114,18 +231,10 @@ device::sptr device::make(const device_addr_t& hint, device_filter_t filter, siz
     typedef std::tuple<device_addr_t, make_t> dev_addr_make_t;
     std::vector<dev_addr_make_t> dev_addr_makers;
 
-    for (const dev_fcn_reg_t& fcn : get_dev_fcn_regs()) {
-        try {
-            if (filter == ANY or std::get<2>(fcn) == filter) {
-                for (device_addr_t dev_addr : std::get<0>(fcn)(hint)) {
-                    // append the discovered address and its factory function
-                    dev_addr_makers.push_back(
-                        dev_addr_make_t(dev_addr, std::get<1>(fcn)));
-                }
-            }
-        } catch (const std::exception& e) {
-            UHD_LOGGER_ERROR("UHD") << "Device discovery error: " << e.what();
-        }
+    for (const auto& found_device : find_devices(hint, filter)) {
+        // append the discovered address and its factory function
+        dev_addr_makers.push_back(dev_addr_make_t(std::get<0>(found_device),
+            std::get<1>(get_dev_fcn_regs().at(std::get<1>(found_device)))));
     }
 
     // check that we found any devices
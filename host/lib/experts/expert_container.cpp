@@ -8,15 +8,21 @@
 #include <uhd/exception.hpp>
 #include <uhd/experts/expert_container.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/utils/worker_pool.hpp>
 #include <boost/format.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/depth_first_search.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/topological_sort.hpp>
 #include <boost/thread.hpp>
+#include <algorithm>
+#include <chrono>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <vector>
 
 #ifdef UHD_EXPERT_LOGGING
 #    define EX_LOG(depth, str) _log(depth, str)
@@ -91,8 +97,8 @@ public:
         std::lock_guard<std::recursive_mutex> resolve_lock(_resolve_mutex);
         std::lock_guard<std::mutex> lock(_mutex);
         EX_LOG(0, "resolve_from (overridden to resolve_all)");
-        // Do a full resolve of the graph
-        // Not optimizing the traversal using node_name to reduce experts complexity
+        // Do a full resolve of the graph. This only visits the nodes which
+        // depend on a dirty data node, which includes node_name if it changed.
         _resolve_helper("", "", false);
     }
 
@@ -271,6 +277,36 @@ public:
 #endif
     }
 
+    std::vector<worker_stats_t> get_worker_stats() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<worker_stats_t> stats;
+        for (const vertex_map_t::value_type& v : _worker_map) {
+            worker_timing_t timing;
+            if (v.second < _worker_timing.size()) {
+                timing = _worker_timing[v.second];
+            }
+            stats.push_back({v.first,
+                timing.num_resolves,
+                std::chrono::duration<double>(timing.total_time).count(),
+                std::chrono::duration<double>(timing.max_time).count()});
+        }
+        return stats;
+    }
+
+    void set_parallel_resolve(const size_t num_threads,
+        std::function<void()> begin_group,
+        std::function<void()> end_group) override
+    {
+        std::lock_guard<std::recursive_mutex> resolve_lock(_resolve_mutex);
+        std::lock_guard<std::mutex> lock(_mutex);
+        EX_LOG(0, str(boost::format("set_parallel_resolve(%d)") % num_threads));
+        _pool.reset(
+            num_threads > 0 ? new worker_pool(num_threads, {}, "uhd_expert") : nullptr);
+        _begin_group = std::move(begin_group);
+        _end_group   = std::move(end_group);
+    }
+
     inline std::recursive_mutex& resolve_mutex() override
     {
         return _resolve_mutex;
@@ -304,6 +340,7 @@ protected:
             // Add a vertex in this graph for the data node
             expert_graph_t::vertex_descriptor gr_node =
                 boost::add_vertex(data_node, _expert_dag);
+            _sorted_nodes.clear();
             EX_LOG(1, str(boost::format("added vertex %s") % data_node->get_name()));
             _datanode_map.insert(
                 vertex_map_t::value_type(data_node->get_name(), gr_node));
@@ -353,6 +390,7 @@ protected:
             // Add a vertex in this graph for the worker node
             expert_graph_t::vertex_descriptor gr_node =
                 boost::add_vertex(worker, _expert_dag);
+            _sorted_nodes.clear();
             EX_LOG(1, str(boost::format("added vertex %s") % worker->get_name()));
             _worker_map.insert(vertex_map_t::value_type(worker->get_name(), gr_node));
 
@@ -427,33 +465,53 @@ protected:
         // Release all nodes in the map
         _worker_map.clear();
         _datanode_map.clear();
+        _sorted_nodes.clear();
+        _levels.clear();
+        _worker_timing.clear();
     }
 
 private:
     void _resolve_helper(std::string start, std::string stop, bool force)
     {
-        // Sort the graph topologically. This ensures that for all dependencies, the
-        // dependant is always after all of its dependencies.
-        node_queue_t sorted_nodes;
-        try {
-            boost::topological_sort(_expert_dag, std::front_inserter(sorted_nodes));
-        } catch (boost::not_a_dag&) {
-            std::vector<std::string> back_edges;
-            cycle_det_visitor cdet_vis(back_edges);
-            boost::depth_first_search(_expert_dag, boost::visitor(cdet_vis));
-            if (not back_edges.empty()) {
-                std::string edges;
-                for (const std::string& e : back_edges) {
-                    edges += "* " + e + "";
+        // The graph only changes while it is being built, so we only sort it
+        // again after that
+        if (_sorted_nodes.empty()) {
+            _sort_nodes();
+        }
+        const node_queue_t& sorted_nodes = _sorted_nodes;
+        if (sorted_nodes.empty())
+            return;
+
+        // Only the nodes which depend on a dirty data node can be dirty, or
+        // become dirty while resolving. Mark those, and skip all others.
+        _affected.assign(boost::num_vertices(_expert_dag), force);
+        if (not force) {
+            _pending.clear();
+            for (const vertex_map_t::value_type& v : _datanode_map) {
+                if (_get_vertex(v.second).is_dirty()) {
+                    _pending.push_back(v.second);
+                }
+            }
+            while (not _pending.empty()) {
+                const expert_graph_t::vertex_descriptor vertex = _pending.back();
+                _pending.pop_back();
+                if (_affected[vertex]) {
+                    continue;
+                }
+                _affected[vertex] = true;
+                auto edges = boost::out_edges(vertex, _expert_dag);
+                for (auto ei = edges.first; ei != edges.second; ++ei) {
+                    _pending.push_back(boost::target(*ei, _expert_dag));
                 }
-                throw uhd::runtime_error(
-                    "Cannot resolve expert because it has at least one cycle!\n"
-                    "The following back-edges were found:"
-                    + edges);
             }
         }
-        if (sorted_nodes.empty())
+        if (_worker_timing.size() < _affected.size()) {
+            _worker_timing.resize(_affected.size());
+        }
+        if (_pool and start.empty() and stop.empty()) {
+            _resolve_levels(force);
             return;
+        }
 
         // Determine the start and stop node. If one is not explicitly specified then
         // resolve everything
@@ -467,7 +525,7 @@ private:
         // First Pass: Resolve all nodes if they are dirty, in a topological order
         std::list<dag_vertex_t*> resolved_workers;
         bool start_node_encountered = false;
-        for (node_queue_t::iterator node_iter = sorted_nodes.begin();
+        for (node_queue_t::const_iterator node_iter = sorted_nodes.begin();
              node_iter != sorted_nodes.end();
              ++node_iter) {
             // Determine if we are at or beyond the starting node
@@ -475,13 +533,15 @@ private:
                 start_node_encountered = true;
 
             // Only resolve if the starting node has passed
-            if (start_node_encountered) {
+            if (start_node_encountered and _affected[*node_iter]) {
                 dag_vertex_t& node = _get_vertex(*node_iter);
                 std::string node_val;
                 if (force or node.is_dirty()) {
-                    node.resolve();
                     if (node.get_class() == CLASS_WORKER) {
+                        _resolve_worker(*node_iter);
                         resolved_workers.push_back(&node);
+                    } else {
+                        node.resolve();
                     }
                     EX_LOG(1,
                         str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
@@ -509,6 +569,167 @@ private:
         }
     }
 
+    //! Resolve the graph by depth, and the workers of each depth in parallel (see
+    // set_parallel_resolve()). The vertices of a depth only depend on vertices
+    // of lower depths, so this resolves them in a valid order.
+    void _resolve_levels(const bool force)
+    {
+        std::list<dag_vertex_t*> resolved_workers;
+        std::vector<expert_graph_t::vertex_descriptor> workers;
+        for (const auto& level : _levels) {
+            workers.clear();
+            for (const expert_graph_t::vertex_descriptor vertex : level) {
+                if (not _affected[vertex]) {
+                    continue;
+                }
+                dag_vertex_t& node = _get_vertex(vertex);
+                if (not(force or node.is_dirty())) {
+                    EX_LOG(1,
+                        str(boost::format("skipped node %s (%s) [%s]") % node.get_name()
+                            % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+                    continue;
+                }
+                if (node.get_class() == CLASS_WORKER) {
+                    workers.push_back(vertex);
+                    resolved_workers.push_back(&node);
+                } else {
+                    node.resolve();
+                    EX_LOG(1,
+                        str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
+                            % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+                }
+            }
+            if (not workers.empty()) {
+                _resolve_workers(workers);
+            }
+        }
+
+        // Mark the workers clean, as in _resolve_helper()
+        for (dag_vertex_t* worker : resolved_workers) {
+            worker->mark_clean();
+        }
+    }
+
+    //! Resolve independent workers in parallel. Workers which write the same
+    // data node are resolved one after the other, on the same thread.
+    void _resolve_workers(const std::vector<expert_graph_t::vertex_descriptor>& workers)
+    {
+        // Join the workers which share an output into groups (union-find)
+        std::vector<size_t> parent(workers.size());
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find_root = [&parent](size_t i) {
+            while (parent[i] != i) {
+                i = parent[i] = parent[parent[i]];
+            }
+            return i;
+        };
+        std::map<expert_graph_t::vertex_descriptor, size_t> writers;
+        for (size_t i = 0; i < workers.size(); i++) {
+            auto edges = boost::out_edges(workers[i], _expert_dag);
+            for (auto ei = edges.first; ei != edges.second; ++ei) {
+                const auto writer = writers.emplace(boost::target(*ei, _expert_dag), i);
+                if (not writer.second) {
+                    parent[find_root(i)] = find_root(writer.first->second);
+                }
+            }
+        }
+        std::map<size_t, size_t> group_index;
+        std::vector<std::vector<expert_graph_t::vertex_descriptor>> groups;
+        for (size_t i = 0; i < workers.size(); i++) {
+            const auto group = group_index.emplace(find_root(i), groups.size());
+            if (group.second) {
+                groups.emplace_back();
+            }
+            groups[group.first->second].push_back(workers[i]);
+        }
+
+        auto resolve_group = [this, &groups](const size_t group) {
+            if (_begin_group) {
+                _begin_group();
+            }
+            try {
+                for (const expert_graph_t::vertex_descriptor worker : groups[group]) {
+                    _resolve_worker(worker);
+                    EX_LOG(1,
+                        str(boost::format("resolved node %s")
+                            % _get_vertex(worker).get_name()));
+                }
+            } catch (...) {
+                if (_end_group) {
+                    // The error of the worker is the more useful one
+                    try {
+                        _end_group();
+                    } catch (...) {
+                    }
+                }
+                throw;
+            }
+            if (_end_group) {
+                _end_group();
+            }
+        };
+        if (groups.size() > 1) {
+            _pool->run(groups.size(), resolve_group);
+        } else {
+            resolve_group(0);
+        }
+    }
+
+    //! Resolve one worker, and account for the time it took
+    void _resolve_worker(const expert_graph_t::vertex_descriptor vertex)
+    {
+        dag_vertex_t& node    = _get_vertex(vertex);
+        const auto start_time = std::chrono::steady_clock::now();
+        node.resolve();
+        const auto duration     = std::chrono::steady_clock::now() - start_time;
+        worker_timing_t& timing = _worker_timing[vertex];
+        timing.num_resolves++;
+        timing.total_time += duration;
+        timing.max_time = std::max(timing.max_time, duration);
+    }
+
+    //! Sort the graph topologically into _sorted_nodes. This ensures that for all
+    // dependencies, the dependant is always after all of its dependencies.
+    void _sort_nodes()
+    {
+        node_queue_t sorted_nodes;
+        try {
+            boost::topological_sort(_expert_dag, std::front_inserter(sorted_nodes));
+        } catch (boost::not_a_dag&) {
+            std::vector<std::string> back_edges;
+            cycle_det_visitor cdet_vis(back_edges);
+            boost::depth_first_search(_expert_dag, boost::visitor(cdet_vis));
+            if (not back_edges.empty()) {
+                std::string edges;
+                for (const std::string& e : back_edges) {
+                    edges += "* " + e + "";
+                }
+                throw uhd::runtime_error(
+                    "Cannot resolve expert because it has at least one cycle!\n"
+                    "The following back-edges were found:"
+                    + edges);
+            }
+        }
+
+        // Group the vertices by their depth, i.e., the length of the longest
+        // path to them, for _resolve_levels()
+        std::vector<size_t> depth(boost::num_vertices(_expert_dag), 0);
+        std::vector<std::vector<expert_graph_t::vertex_descriptor>> levels;
+        for (const expert_graph_t::vertex_descriptor vertex : sorted_nodes) {
+            if (depth[vertex] >= levels.size()) {
+                levels.resize(depth[vertex] + 1);
+            }
+            levels[depth[vertex]].push_back(vertex);
+            auto edges = boost::out_edges(vertex, _expert_dag);
+            for (auto ei = edges.first; ei != edges.second; ++ei) {
+                size_t& target_depth = depth[boost::target(*ei, _expert_dag)];
+                target_depth         = std::max(target_depth, depth[vertex] + 1);
+            }
+        }
+        _sorted_nodes.swap(sorted_nodes);
+        _levels.swap(levels);
+    }
+
     expert_graph_t::vertex_descriptor _lookup_vertex(const std::string& name) const
     {
         expert_graph_t::vertex_descriptor vertex;
@@ -553,7 +774,26 @@ private:
     vertex_map_t _worker_map; // A map from vertex name to vertex descriptor for workers
     vertex_map_t
         _datanode_map; // A map from vertex name to vertex descriptor for data nodes
-    std::mutex _mutex;
+    node_queue_t _sorted_nodes; // All vertices in topological order (empty if stale)
+    // The vertices of _sorted_nodes, grouped by depth
+    std::vector<std::vector<expert_graph_t::vertex_descriptor>> _levels;
+    std::vector<bool> _affected; // Vertices visited by the current resolve
+    std::vector<expert_graph_t::vertex_descriptor> _pending; // Scratch for _affected
+
+    struct worker_timing_t
+    {
+        size_t num_resolves = 0;
+        std::chrono::steady_clock::duration total_time{0};
+        std::chrono::steady_clock::duration max_time{0};
+    };
+    std::vector<worker_timing_t> _worker_timing; // Indexed by vertex descriptor
+
+    // Parallel resolves, see set_parallel_resolve()
+    worker_pool::uptr _pool;
+    std::function<void()> _begin_group;
+    std::function<void()> _end_group;
+
+    mutable std::mutex _mutex;
     std::recursive_mutex _resolve_mutex;
 };
 
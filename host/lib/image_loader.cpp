@@ -9,6 +9,7 @@
 #include <uhd/image_loader.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <iostream>
@@ -48,6 +49,7 @@ void uhd::image_loader::register_image_loader(const std::string& device_type,
 bool uhd::image_loader::load(
     const uhd::image_loader::image_loader_args_t& image_loader_args)
 {
+    uhd::load_modules();
     // If "type=foo" given in args, see if we have an image loader for that
     if (image_loader_args.args.has_key("type")) {
         std::string type = image_loader_args.args.get("type");
@@ -72,6 +74,7 @@ bool uhd::image_loader::load(
  */
 std::string uhd::image_loader::get_recovery_instructions(const std::string& device_type)
 {
+    uhd::load_modules();
     if (get_recovery_strings().count(device_type) == 0) {
         return "A firmware or FPGA loading process was interrupted by the user. This can "
                "leave your device in a non-working state.";
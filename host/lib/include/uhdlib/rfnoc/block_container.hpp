@@ -8,9 +8,10 @@
 
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/noc_block_base.hpp>
-#include <unordered_set>
 #include <boost/units/detail/utility.hpp>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace uhd { namespace rfnoc { namespace detail {
@@ -53,11 +54,25 @@ public:
     void shutdown();
 
 private:
+    struct block_id_hash
+    {
+        size_t operator()(const block_id_t& block_id) const;
+    };
+
     //! Lock access to the storage
     mutable std::mutex _mutex;
 
     //! The actual block registry
-    std::unordered_set<noc_block_base::sptr> _blocks;
+    std::unordered_map<block_id_t, noc_block_base::sptr, block_id_hash> _blocks;
+
+    //! The IDs of all blocks, sorted
+    std::vector<block_id_t> _block_ids;
+
+    //! Results of find_blocks() by hint. Blocks are registered while the
+    // graph is initialized, and the results are valid until the next block is
+    // registered, so the hints which multi_usrp and applications look up over
+    // and over again are only matched once.
+    mutable std::unordered_map<std::string, std::vector<block_id_t>> _find_results;
 };
 
 }}} /* namespace uhd::rfnoc::detail */
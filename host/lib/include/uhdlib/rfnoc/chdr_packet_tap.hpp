@@ -0,0 +1,172 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhdlib/utils/mpsc_ring.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace uhd { namespace rfnoc {
+
+/*!
+ * Copies CHDR packets of the host transports into a pcap file
+ *
+ * The tap is enabled by setting the environment variable UHD_CHDR_TAP_FILE to
+ * the path of the pcap file. Transports call capture() for every packet they
+ * send or receive, which copies the first bytes of the packet (the header and
+ * the start of the payload) into a lock-free ring, and a background thread
+ * writes the rings to the file. Of the data packets, only one in
+ * UHD_CHDR_TAP_SAMPLE (default 1000, 0 for none) is copied. Control and flow
+ * control packets are always copied.
+ *
+ * When a transport detects an error, such as a sequence error or an error
+ * status, it calls trigger(), and the next UHD_CHDR_TAP_TRIGGER (default 256)
+ * packets of all transports are then copied completely, without sampling.
+ *
+ * The packets are written as IPv4/UDP packets between the host (10.0.0.1) and
+ * the device (10.0.0.2), port 49153 on the device, and a port for every
+ * transport on the host, so they can be read with Wireshark or
+ * chdr_pcap_analyzer. Packets which don't fit into the rings are dropped and
+ * counted.
+ */
+class chdr_packet_tap
+{
+public:
+    //! Direction of a packet, as seen from the host
+    enum direction_t { RX, TX };
+
+    //! Number of bytes copied from sampled packets
+    static constexpr size_t HEADER_SNAPLEN = 64;
+    //! Number of bytes copied from packets after a trigger
+    static constexpr size_t FULL_SNAPLEN = 9000;
+
+    /*!
+     * The tap of one transport
+     *
+     * A port keeps the tap alive. It is not thread-safe: The data packets of
+     * a port must be captured from one thread at a time.
+     */
+    class port
+    {
+    public:
+        using uptr = std::unique_ptr<port>;
+
+        /*! Copy a packet into the tap
+         *
+         * \param dir Whether the host sends or receives the packet
+         * \param packet The packet, starting with the CHDR header
+         * \param len The length of the packet in bytes
+         * \param is_data Whether the packet is a data packet, which is sampled
+         */
+        void capture(const direction_t dir,
+            const void* packet,
+            const size_t len,
+            const bool is_data)
+        {
+            if (is_data && !_tap->_is_triggered()) {
+                if (_sample_interval == 0 || ++_num_data < _sample_interval) {
+                    return;
+                }
+                _num_data = 0;
+            }
+            _tap->_push(_id, dir, packet, len);
+        }
+
+        //! Copy the next packets completely, see chdr_packet_tap
+        void trigger()
+        {
+            _tap->_trigger();
+        }
+
+    private:
+        friend class chdr_packet_tap;
+
+        port(std::shared_ptr<chdr_packet_tap> tap, const uint16_t id)
+            : _tap(std::move(tap)), _id(id), _sample_interval(_tap->_sample_interval)
+        {
+        }
+
+        const std::shared_ptr<chdr_packet_tap> _tap;
+        const uint16_t _id;
+        const size_t _sample_interval;
+        size_t _num_data = 0;
+    };
+
+    /*!
+     * Return the tap for a new transport
+     *
+     * \param name Describes the transport, for the log message which tells
+     *        which UDP port in the capture shows its packets
+     * \return the port, or nullptr if the tap is not enabled
+     */
+    static port::uptr make_port(const std::string& name);
+
+    ~chdr_packet_tap();
+
+private:
+    template <size_t snaplen>
+    struct record_t
+    {
+        uint64_t time_ns;
+        uint32_t len;
+        uint16_t port_id;
+        uint8_t dir;
+        uint8_t data[snaplen];
+
+        size_t get_caplen() const
+        {
+            return len < snaplen ? len : snaplen;
+        }
+    };
+    using header_record_t = record_t<HEADER_SNAPLEN>;
+    using full_record_t   = record_t<FULL_SNAPLEN>;
+
+    chdr_packet_tap(std::FILE* file,
+        const size_t sample_interval,
+        const size_t trigger_count,
+        const size_t ring_size);
+
+    bool _is_triggered() const
+    {
+        return _full_remaining.load(std::memory_order_relaxed) > 0;
+    }
+
+    void _push(const uint16_t port_id,
+        const direction_t dir,
+        const void* packet,
+        const size_t len);
+    void _trigger();
+
+    //! Writes the rings to the file until the tap is destroyed
+    void _writer_loop();
+    template <size_t snaplen>
+    void _write(const record_t<snaplen>& record);
+
+    std::FILE* _file;
+    const size_t _sample_interval;
+    const size_t _trigger_count;
+    std::atomic<uint16_t> _next_port_id{0};
+
+    //! Number of packets which are still copied completely
+    std::atomic<int64_t> _full_remaining{0};
+    mpsc_ring<header_record_t> _header_ring;
+    std::unique_ptr<mpsc_ring<full_record_t>> _full_ring;
+    std::atomic<uint64_t> _num_dropped{0};
+
+    std::mutex _writer_mutex;
+    std::condition_variable _writer_cond;
+    bool _writer_stop = false;
+    std::thread _writer_thread;
+};
+
+}} // namespace uhd::rfnoc
@@ -124,6 +124,63 @@ public:
     virtual size_t calculate_payload_offset(
         const packet_type_t pkt_type, const uint8_t num_mdata = 0) const = 0;
 
+    //! Fields of a data packet header, as decoded by parse_data_headers()
+    struct data_header_t
+    {
+        //! Pointer to the payload within the packet
+        const void* payload;
+        //! Payload size in bytes, according to the header
+        size_t payload_size;
+        //! Timestamp, or 0 if the packet has none
+        uint64_t tsf;
+        uint16_t seq_num;
+        bool has_tsf;
+        bool eob;
+        bool eov;
+    };
+
+    /*! Decode the headers of a burst of received data packets
+     *
+     * This gives the same results as calling refresh() on every packet and
+     * reading its fields, but decodes all headers in one loop, and reads and
+     * converts every header word only once. It does not change which packet
+     * this object refers to.
+     *
+     * \param pkt_buffs Pointers to the received packets
+     * \param num_pkts Number of entries in \p pkt_buffs and \p headers
+     * \param headers Returns the fields of every packet
+     */
+    virtual void parse_data_headers(const void* const* pkt_buffs,
+        const size_t num_pkts,
+        data_header_t* headers) const = 0;
+
+    /*! Return the CHDR header of a received packet
+     *
+     * This is the same as calling refresh() and get_chdr_header(), but it does
+     * not change which packet this object refers to.
+     *
+     * \param pkt_buff Pointer to the received packet
+     * \return The CHDR header
+     */
+    virtual chdr_header read_chdr_header(const void* pkt_buff) const = 0;
+
+    /*! Write the header and timestamp of a data packet
+     *
+     * This is the same as calling refresh(), update_payload_size() and
+     * get_payload_ptr() on a TX packet, but it writes every header word only
+     * once, and it does not change which packet this object refers to.
+     *
+     * \param pkt_buff Pointer to a buffer that should be populated with the TX packet
+     * \param header The CHDR header to write. Its length is set from \p payload_size.
+     * \param timestamp The timestamp to write, if the packet type has one
+     * \param payload_size The payload size in bytes
+     * \return A pointer to the payload
+     */
+    virtual void* write_data_header(void* pkt_buff,
+        chdr_header& header,
+        const uint64_t timestamp,
+        const size_t payload_size) const = 0;
+
     //! Shortcut to return the const metadata pointer cast as a specific type
     template <typename data_t>
     inline const data_t* get_mdata_const_ptr_as() const
@@ -9,11 +9,17 @@
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/rfnoc/chdr_packet_tap.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/rfnoc/rx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <array>
+#include <atomic>
 #include <memory>
 
 namespace uhd { namespace rfnoc {
@@ -43,8 +49,11 @@ public:
      *
      * \param send_link the link to use to send the packet
      * \counts transfer counts for packet contents
+     * \param tap the packet tap of the transport, if any
      */
-    void send_strs(transport::send_link_if* send_link, const stream_buff_params_t& counts)
+    void send_strs(transport::send_link_if* send_link,
+        const stream_buff_params_t& counts,
+        chdr_packet_tap::port* tap = nullptr)
     {
         auto buff = send_link->get_send_buff(0);
         if (!buff) {
@@ -63,6 +72,9 @@ public:
         const size_t size = header.get_length();
 
         buff->set_packet_size(size);
+        if (tap) {
+            tap->capture(chdr_packet_tap::TX, buff->data(), size, false);
+        }
         send_link->release_send_buff(std::move(buff));
     }
 
@@ -96,6 +108,11 @@ private:
  * For lossy links, the device also sends strc packets to resynchronize the
  * transfer counts between host and device, to correct for any dropped packets
  * in the link.
+ *
+ * To keep the per-packet overhead low, packets are taken from the I/O service
+ * in bursts, if several are already available. The headers of a burst are
+ * decoded and its sequence numbers are checked in one go, and get_recv_buff()
+ * then hands out the packets one by one.
  */
 class chdr_rx_data_xport
 {
@@ -120,8 +137,27 @@ public:
     {
         stream_buff_params_t buff_capacity;
         stream_buff_params_t freq;
+        //! Limits of the adaptive flow control frequency (see
+        // rx_flow_ctrl_state), or zero if the frequency is fixed
+        stream_buff_params_t min_freq{0, 0};
+        stream_buff_params_t max_freq{0, 0};
     };
 
+    /*! Read the limits of the adaptive flow control frequency from the
+     *  transport args
+     *
+     * If \p xport_args contains rx_fc_adaptive=1, the limits are set to
+     * the ratios rx_fc_min_ratio (default 1/128) and rx_fc_max_ratio (default
+     * 1/8) of the buffer capacity. Counts which don't take part in flow
+     * control (their frequency is the maximum) keep a fixed frequency.
+     *
+     * \param xport_args The stream args
+     * \param fc_params The parameters returned by configure_sep()
+     * \throws uhd::value_error if the ratios are invalid
+     */
+    static void read_adaptive_fc_args(
+        const uhd::device_addr_t& xport_args, fc_params_t& fc_params);
+
     /*! Configure stream endpoint route and flow control
      *
      * \param io_srv The service that will schedule the xport I/O
@@ -226,16 +262,17 @@ public:
     std::tuple<typename buff_t::uptr, packet_info_t, bool> get_recv_buff(
         const int32_t timeout_ms)
     {
-        buff_t::uptr buff = _recv_io->get_recv_buff(timeout_ms);
-
-        if (!buff) {
+        if (_burst_pos == _burst_count && !_recv_burst(timeout_ms)) {
             return std::make_tuple(typename buff_t::uptr(), packet_info_t(), false);
         }
 
-        auto info      = _read_data_packet_info(buff);
-        bool seq_error = _is_out_of_sequence(std::get<1>(info));
-
-        return std::make_tuple(std::move(buff), std::get<0>(info), seq_error);
+        const size_t i = _burst_pos++;
+        if (_burst_bad[i]) {
+            _recv_io->release_recv_buff(std::move(_burst_buffs[i]));
+            throw uhd::value_error("Bad CHDR header or invalid packet length.");
+        }
+        return std::make_tuple(
+            std::move(_burst_buffs[i]), _burst_infos[i], _burst_seq_errors[i]);
     }
 
     /*!
@@ -245,9 +282,76 @@ public:
      */
     void release_recv_buff(typename buff_t::uptr buff)
     {
+        // Releasing the buffer may send a flow control response
+        UHD_CYCLE_ACCOUNT(_cycles, FLOW_CTRL);
         _recv_io->release_recv_buff(std::move(buff));
     }
 
+    /*!
+     * Configures the accounting of the cycles spent in this transport
+     *
+     * \param cycles the accounting of the streamer, which must outlive the
+     *               transport, or nullptr
+     */
+    void set_cycle_accounting(transport::cycle_accounting* cycles)
+    {
+        _cycles = cycles;
+    }
+
+    /*!
+     * Restarts the sequence number check for a new stream session
+     *
+     * The next packet starts a new sequence instead of being compared against
+     * the last packet of the previous session, so packets the device dropped
+     * while nobody was reading are not reported as a sequence error.
+     */
+    void reset_seq_num()
+    {
+        _seq_num_valid = false;
+    }
+
+    /*!
+     * Returns a descriptor which becomes readable when packets are ready
+     *
+     * See recv_io_if::get_ready_fd(). Packets which were already taken from
+     * the I/O service in a burst don't keep it readable.
+     *
+     * \return the descriptor, or -1 if the I/O service provides none
+     */
+    int get_ready_fd()
+    {
+        return _recv_io->get_ready_fd();
+    }
+
+    /*!
+     * Returns the data received, but not yet acknowledged to the sender
+     *
+     * Unlike the other methods, this may be called from any thread.
+     */
+    stream_buff_params_t get_fc_outstanding() const
+    {
+        return {_fc_unacked_bytes.load(std::memory_order_relaxed),
+            _fc_unacked_packets.load(std::memory_order_relaxed)};
+    }
+
+    //! Returns the flow control window, i.e., the buffer capacity of the host
+    stream_buff_params_t get_fc_capacity() const
+    {
+        return _fc_capacity;
+    }
+
+    //! Returns the number of frames reserved from the link
+    size_t get_num_frames() const
+    {
+        return _num_frames;
+    }
+
+    //! Returns the frames which the links of this transport allocated
+    stream_memory_t::link_t get_link_memory() const
+    {
+        return _link_memory;
+    }
+
 private:
     /*!
      * Recv callback for I/O service
@@ -263,8 +367,7 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* send_link)
     {
-        _recv_packet_cb->refresh(buff->data());
-        const auto header   = _recv_packet_cb->get_chdr_header();
+        const auto header   = _recv_packet_cb->read_chdr_header(buff->data());
         const auto dst_epid = header.get_dst_epid();
 
         if (dst_epid != _epid) {
@@ -272,12 +375,19 @@ private:
         }
 
         const auto type = header.get_pkt_type();
+        if (_tap) {
+            _tap->capture(chdr_packet_tap::RX,
+                buff->data(),
+                buff->packet_size(),
+                type == chdr::PKT_TYPE_DATA_NO_TS || type == chdr::PKT_TYPE_DATA_WITH_TS);
+        }
         // We need to round the packet size to the nearest multiple of a CHDR
         // width, because that's how the FPGA tracks bytes, and want to match
         // that behaviour.
         const auto packet_size_rounded = _round_pkt_size(header.get_length());
 
         if (type == chdr::PKT_TYPE_STRC) {
+            _recv_packet_cb->refresh(buff->data());
             chdr::strc_payload strc;
             strc.deserialize(_recv_packet_cb->get_payload_const_ptr_as<uint64_t>(),
                 _recv_packet_cb->get_payload_size() / sizeof(uint64_t),
@@ -311,6 +421,7 @@ private:
                    || type == chdr::PKT_TYPE_DATA_WITH_TS) {
             // Update state that we received a packet
             _fc_state.data_received(packet_size_rounded);
+            _publish_fc_state();
 
             // If this is a data packet, just claim it by returning true. The
             // I/O service will queue this packet in the recv_io_if.
@@ -335,8 +446,7 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* send_link)
     {
-        _recv_packet_cb->refresh(buff->data());
-        const auto header        = _recv_packet_cb->get_chdr_header();
+        const auto header        = _recv_packet_cb->read_chdr_header(buff->data());
         const size_t packet_size = _round_pkt_size(header.get_length());
         recv_link->release_recv_buff(std::move(buff));
         _fc_state.xfer_done(packet_size);
@@ -351,64 +461,116 @@ private:
     void _send_fc_response(transport::send_link_if* send_link)
     {
         if (_fc_state.fc_resp_due()) {
-            _fc_sender.send_strs(send_link, _fc_state.get_xfer_counts());
+            _fc_sender.send_strs(send_link, _fc_state.get_xfer_counts(), _tap.get());
             _fc_state.fc_resp_sent();
+            _publish_fc_state();
         }
     }
 
-    /*!
-     * Checks if the sequence number is out of sequence, increments sequence
-     * number for next packet.
-     *
-     * \return true if a sequence error occurred
-     */
-    UHD_FORCE_INLINE bool _is_out_of_sequence(uint16_t seq_num)
+    //! Makes the flow control state available to get_fc_outstanding()
+    void _publish_fc_state()
     {
-        const uint16_t expected_packet_count = _data_seq_num;
-        _data_seq_num                        = seq_num + 1;
-
-        if (expected_packet_count != seq_num) {
-            return true;
-        }
-        return false;
+        const auto unacked = _fc_state.get_unacked_counts();
+        _fc_unacked_bytes.store(unacked.bytes, std::memory_order_relaxed);
+        _fc_unacked_packets.store(unacked.packets, std::memory_order_relaxed);
     }
 
     /*!
-     * Reads packet header and returns information in a struct.
+     * Takes a burst of packets from the I/O service, and decodes their headers
+     *
+     * Only the first packet is waited for. The number of packets to take is
+     * adapted to the traffic: It grows while every attempt to take a packet
+     * succeeds, and shrinks to the number of packets which were available
+     * when one fails, so that a slow stream doesn't keep polling for packets
+     * which aren't there yet.
      *
-     * \return a tuple containing the packet info and packet sequence number
+     * \return false if no packet arrived within the timeout
      */
-    std::tuple<packet_info_t, uint16_t> _read_data_packet_info(buff_t::uptr& buff)
+    bool _recv_burst(const int32_t timeout_ms)
     {
-        const void* data = buff->data();
-        _recv_packet->refresh(data);
-        const auto header        = _recv_packet->get_chdr_header();
-        const auto optional_time = _recv_packet->get_timestamp();
-
-        packet_info_t info;
-        info.eob           = header.get_eob();
-        info.eov           = header.get_eov();
-        info.has_tsf       = optional_time.is_initialized();
-        info.tsf           = optional_time ? *optional_time : 0;
-        info.payload_bytes = _recv_packet->get_payload_size();
-        info.payload       = _recv_packet->get_payload_const_ptr();
-
-        const uint8_t* pkt_end =
-            reinterpret_cast<uint8_t*>(buff->data()) + buff->packet_size();
-        const size_t pyld_pkt_len =
-            pkt_end - reinterpret_cast<const uint8_t*>(info.payload);
-
-        if (pyld_pkt_len < info.payload_bytes) {
-            _recv_io->release_recv_buff(std::move(buff));
-            throw uhd::value_error("Bad CHDR header or invalid packet length.");
+        _burst_pos   = 0;
+        _burst_count = 0;
+        while (_burst_count < _burst_size) {
+            buff_t::uptr buff =
+                _recv_io->get_recv_buff(_burst_count == 0 ? timeout_ms : 0);
+            if (!buff) {
+                break;
+            }
+            _burst_data[_burst_count]    = buff->data();
+            _burst_buffs[_burst_count++] = std::move(buff);
+        }
+        if (_burst_count == 0) {
+            return false;
+        }
+        UHD_CYCLE_ACCOUNT(_cycles, HEADER);
+        _burst_size = (_burst_count == _burst_size)
+                          ? std::min(_burst_size * 2, _max_burst_size)
+                          : _burst_count;
+
+        _recv_packet->parse_data_headers(
+            _burst_data.data(), _burst_count, _burst_headers.data());
+
+        bool any_bad = false;
+        for (size_t i = 0; i < _burst_count; i++) {
+            const auto& header  = _burst_headers[i];
+            packet_info_t& info = _burst_infos[i];
+            info.eob            = header.eob;
+            info.eov            = header.eov;
+            info.has_tsf        = header.has_tsf;
+            info.tsf            = header.tsf;
+            info.payload_bytes  = header.payload_size;
+            info.payload        = header.payload;
+
+            const uint8_t* pkt_end = static_cast<const uint8_t*>(_burst_data[i])
+                                     + _burst_buffs[i]->packet_size();
+            const size_t pyld_pkt_len =
+                pkt_end - static_cast<const uint8_t*>(info.payload);
+            _burst_bad[i] = pyld_pkt_len < info.payload_bytes;
+            any_bad |= _burst_bad[i];
         }
 
-        return std::make_tuple(info, header.get_seq_num());
+        // Every packet is expected to follow the one before it. Without bad
+        // packets, which don't count, there is no dependency on the results
+        // for earlier packets, so this loop can be vectorized.
+        if (!_seq_num_valid) {
+            for (size_t i = 0; i < _burst_count; i++) {
+                if (!_burst_bad[i]) {
+                    _data_seq_num  = _burst_headers[i].seq_num;
+                    _seq_num_valid = true;
+                    break;
+                }
+            }
+        }
+        if (!any_bad) {
+            _burst_seq_errors[0] = _burst_headers[0].seq_num != _data_seq_num;
+            for (size_t i = 1; i < _burst_count; i++) {
+                _burst_seq_errors[i] = _burst_headers[i].seq_num
+                                       != uint16_t(_burst_headers[i - 1].seq_num + 1);
+            }
+            _data_seq_num = _burst_headers[_burst_count - 1].seq_num + 1;
+        } else {
+            for (size_t i = 0; i < _burst_count; i++) {
+                if (!_burst_bad[i]) {
+                    _burst_seq_errors[i] = _burst_headers[i].seq_num != _data_seq_num;
+                    _data_seq_num        = _burst_headers[i].seq_num + 1;
+                }
+            }
+        }
+        if (_tap) {
+            for (size_t i = 0; i < _burst_count; i++) {
+                if (_burst_bad[i] || _burst_seq_errors[i]) {
+                    _tap->trigger();
+                    break;
+                }
+            }
+        }
+        return true;
     }
 
     inline size_t _round_pkt_size(const size_t pkt_size_bytes)
     {
-        return ((pkt_size_bytes + _chdr_w_bytes - 1) / _chdr_w_bytes) * _chdr_w_bytes;
+        // The CHDR width is a power of two
+        return (pkt_size_bytes + _chdr_w_bytes - 1) & ~(_chdr_w_bytes - 1);
     }
 
     // Interface to the I/O service
@@ -417,15 +579,46 @@ private:
     // Flow control state
     rx_flow_ctrl_state _fc_state;
 
+    // Copy of the flow control state for get_fc_outstanding(), which may be
+    // called from threads other than the I/O service
+    std::atomic<uint64_t> _fc_unacked_bytes{0};
+    std::atomic<uint32_t> _fc_unacked_packets{0};
+
     // MTU in bytes
     size_t _mtu = 0;
 
+    // Flow control window, and number of frames reserved from the link
+    stream_buff_params_t _fc_capacity{0, 0};
+    size_t _num_frames = 0;
+    stream_memory_t::link_t _link_memory;
+
     // Size of CHDR headers
     size_t _hdr_len = 0;
 
     // Sequence number for data packets
     uint16_t _data_seq_num = 0;
 
+    // Whether _data_seq_num is the expected sequence number of the next
+    // packet, or whether that packet starts a new sequence
+    bool _seq_num_valid = true;
+
+    // Maximum number of packets taken from the I/O service at once
+    static constexpr size_t MAX_RECV_BURST_SIZE = 16;
+
+    // Number of packets to try to take from the I/O service at once
+    size_t _burst_size = 1;
+
+    // The current burst of packets, of which _burst_pos have been handed out
+    size_t _burst_pos   = 0;
+    size_t _burst_count = 0;
+    std::array<buff_t::uptr, MAX_RECV_BURST_SIZE> _burst_buffs;
+    std::array<const void*, MAX_RECV_BURST_SIZE> _burst_data;
+    std::array<chdr::chdr_packet_writer::data_header_t, MAX_RECV_BURST_SIZE>
+        _burst_headers;
+    std::array<packet_info_t, MAX_RECV_BURST_SIZE> _burst_infos;
+    std::array<bool, MAX_RECV_BURST_SIZE> _burst_seq_errors;
+    std::array<bool, MAX_RECV_BURST_SIZE> _burst_bad;
+
     // Packet for received data
     chdr::chdr_packet_writer::uptr _recv_packet;
 
@@ -441,8 +634,17 @@ private:
     //! The CHDR width in bytes.
     size_t _chdr_w_bytes;
 
+    // Upper limit of _burst_size
+    const size_t _max_burst_size;
+
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Packet tap, or nullptr if it is not enabled
+    chdr_packet_tap::port::uptr _tap;
+
+    // Accounting of the cycles of the streamer, or nullptr
+    transport::cycle_accounting* _cycles = nullptr;
 };
 
 }} // namespace uhd::rfnoc
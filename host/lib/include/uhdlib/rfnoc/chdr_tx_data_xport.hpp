@@ -8,14 +8,19 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/chdr_packet_tap.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/rfnoc/tx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace uhd { namespace rfnoc {
 
@@ -43,9 +48,11 @@ public:
      *
      * \param send_link the link to use to send the packet
      * \counts transfer counts for packet contents
+     * \param tap the packet tap of the transport, if any
      */
-    size_t send_strc_resync(
-        transport::send_link_if* send_link, const stream_buff_params_t& counts)
+    size_t send_strc_resync(transport::send_link_if* send_link,
+        const stream_buff_params_t& counts,
+        chdr_packet_tap::port* tap = nullptr)
     {
         auto buff = send_link->get_send_buff(0);
         if (!buff) {
@@ -64,6 +71,9 @@ public:
         const size_t size = header.get_length();
 
         buff->set_packet_size(size);
+        if (tap) {
+            tap->capture(chdr_packet_tap::TX, buff->data(), size, false);
+        }
         send_link->release_send_buff(std::move(buff));
         return size;
     }
@@ -98,6 +108,12 @@ private:
  * has been freed. For lossy links, the host also sends strc packets to
  * resynchronize the transfer counts between host and device, to correct for
  * any dropped packets in the link.
+ *
+ * With an inline I/O service, the strs packets are normally processed by the
+ * thread which sends, whenever it runs out of flow control credits. With
+ * fc_params_t::fc_offload, the transport processes them on a thread of its
+ * own instead, and publishes the credits to the thread which sends through
+ * atomics, so sending never waits for a strs packet to be processed.
  */
 class chdr_tx_data_xport
 {
@@ -122,6 +138,11 @@ public:
     struct fc_params_t
     {
         stream_buff_params_t buff_capacity;
+        //! Process strs packets on a thread of the transport (see above). This
+        // is ignored for offload I/O services, which already process them on
+        // their thread. The links must not be muxed, and must allow receiving
+        // and sending from different threads (like UDP sockets do).
+        bool fc_offload = false;
     };
 
     /*! Configure route to the sep and flow control
@@ -220,11 +241,17 @@ public:
      */
     buff_t::uptr get_send_buff(const int32_t timeout_ms)
     {
-        if (_send_io->wait_for_dest_ready(_frame_size, timeout_ms)) {
-            return _send_io->get_send_buff(timeout_ms);
-        } else {
-            return nullptr;
+        bool dest_ready = false;
+        {
+            UHD_CYCLE_ACCOUNT(_cycles, FLOW_CTRL);
+            if (_fc_offload) {
+                dest_ready = _fc_state.dest_has_space(_frame_size)
+                             || _wait_for_credits(timeout_ms);
+            } else {
+                dest_ready = _send_io->wait_for_dest_ready(_frame_size, timeout_ms);
+            }
         }
+        return dest_ready ? _send_io->get_send_buff(timeout_ms) : nullptr;
     }
 
     /*!
@@ -244,9 +271,63 @@ public:
      */
     void release_send_buff(buff_t::uptr buff)
     {
+        UHD_CYCLE_ACCOUNT(_cycles, SEND);
         _send_io->release_send_buff(std::move(buff));
     }
 
+    /*!
+     * Configures the accounting of the cycles spent in this transport
+     *
+     * \param cycles the accounting of the streamer, which must outlive the
+     *               transport, or nullptr
+     */
+    void set_cycle_accounting(transport::cycle_accounting* cycles)
+    {
+        _cycles = cycles;
+    }
+
+    /*!
+     * Returns the data sent, but not yet acknowledged by the destination
+     *
+     * Unlike the other methods, this may be called from any thread.
+     */
+    stream_buff_params_t get_fc_outstanding() const
+    {
+        return {_fc_unacked_bytes.load(std::memory_order_relaxed),
+            _fc_unacked_packets.load(std::memory_order_relaxed)};
+    }
+
+    /*!
+     * Makes the device transfer counts match those of the host again
+     *
+     * Call this before a new stream session, so that packets the link dropped
+     * in earlier sessions don't reduce the flow control window. The resync
+     * packet is sent together with the next data packet. Unlike the other
+     * methods, this may be called from any thread.
+     */
+    void request_fc_resync()
+    {
+        _fc_resync_requested.store(true, std::memory_order_relaxed);
+    }
+
+    //! Returns the flow control window, i.e., the buffer capacity of the device
+    stream_buff_params_t get_fc_capacity() const
+    {
+        return _fc_capacity;
+    }
+
+    //! Returns the number of frames reserved from the link
+    size_t get_num_frames() const
+    {
+        return _num_frames;
+    }
+
+    //! Returns the frames which the links of this transport allocated
+    stream_memory_t::link_t get_link_memory() const
+    {
+        return _link_memory;
+    }
+
     /*!
      * Writes header into frame buffer and returns payload pointer
      *
@@ -257,6 +338,7 @@ public:
     std::pair<void*, size_t> write_packet_header(
         buff_t::uptr& buff, const packet_info_t& info)
     {
+        UHD_CYCLE_ACCOUNT(_cycles, HEADER);
         uint64_t tsf = 0;
 
         if (info.has_tsf) {
@@ -270,11 +352,25 @@ public:
         _send_header.set_eov(info.eov);
         _send_header.set_seq_num(_data_seq_num++);
 
-        _send_packet->refresh(buff->data(), _send_header, tsf);
-        _send_packet->update_payload_size(info.payload_bytes);
+        void* payload = _send_packet->write_data_header(
+            buff->data(), _send_header, tsf, info.payload_bytes);
 
-        return std::make_pair(_send_packet->get_payload_ptr(),
-            _send_packet->get_chdr_header().get_length());
+        return std::make_pair(payload, _send_header.get_length());
+    }
+
+    /*!
+     * Returns where the payload of a packet starts, without writing its header
+     *
+     * \param buff Frame buffer the packet will be written into
+     * \param has_tsf Whether the packet will have a timestamp
+     * \return A pointer to the payload data area
+     */
+    void* get_payload_ptr(buff_t::uptr& buff, const bool has_tsf) const
+    {
+        const auto pkt_type = has_tsf ? chdr::PKT_TYPE_DATA_WITH_TS
+                                      : chdr::PKT_TYPE_DATA_NO_TS;
+        return static_cast<uint8_t*>(buff->data())
+               + _send_packet->calculate_payload_offset(pkt_type);
     }
 
 private:
@@ -302,6 +398,10 @@ private:
         }
 
         if (type == chdr::PKT_TYPE_STRS) {
+            if (_tap) {
+                _tap->capture(
+                    chdr_packet_tap::RX, buff->data(), buff->packet_size(), false);
+            }
             chdr::strs_payload strs;
             strs.deserialize(_recv_packet->get_payload_const_ptr_as<uint64_t>(),
                 _recv_packet->get_payload_size() / sizeof(uint64_t),
@@ -309,8 +409,15 @@ private:
 
             _fc_state.update_dest_recv_count(
                 {strs.xfer_count_bytes, static_cast<uint32_t>(strs.xfer_count_pkts)});
+            // With fc_offload, the thread which sends publishes the state
+            if (!_fc_offload) {
+                _publish_fc_state();
+            }
 
             if (strs.status != chdr::STRS_OKAY) {
+                if (_tap) {
+                    _tap->trigger();
+                }
                 switch (strs.status) {
                     case chdr::STRS_SEQERR:
                         UHD_LOG_FASTPATH("S");
@@ -360,23 +467,40 @@ private:
         // still occupy an integer multiple of word size bytes in the FPGA, so
         // we need to calculate appropriately.
         const size_t packet_size_rounded = _round_pkt_size(buff->packet_size());
+        if (_tap) {
+            _tap->capture(chdr_packet_tap::TX, buff->data(), buff->packet_size(), true);
+        }
         send_link->release_send_buff(std::move(buff));
 
         _fc_state.data_sent(packet_size_rounded);
 
+        if (_fc_resync_requested.load(std::memory_order_relaxed)
+            && _fc_resync_requested.exchange(false)) {
+            _fc_state.request_fc_resync();
+        }
         if (_fc_state.get_fc_resync_req_pending()
             && _fc_state.dest_has_space(chdr::strc_payload::MAX_PACKET_SIZE)) {
             const auto& xfer_counts = _fc_state.get_xfer_counts();
-            const size_t strc_size =
-                _round_pkt_size(_fc_sender.send_strc_resync(send_link, xfer_counts));
+            const size_t strc_size = _round_pkt_size(
+                _fc_sender.send_strc_resync(send_link, xfer_counts, _tap.get()));
             _fc_state.clear_fc_resync_req_pending();
             _fc_state.data_sent(strc_size);
         }
+        _publish_fc_state();
+    }
+
+    //! Makes the flow control state available to get_fc_outstanding()
+    void _publish_fc_state()
+    {
+        const auto unacked = _fc_state.get_unacked_counts();
+        _fc_unacked_bytes.store(unacked.bytes, std::memory_order_relaxed);
+        _fc_unacked_packets.store(unacked.packets, std::memory_order_relaxed);
     }
 
     inline size_t _round_pkt_size(const size_t pkt_size_bytes)
     {
-        return ((pkt_size_bytes + _chdr_w_bytes - 1) / _chdr_w_bytes) * _chdr_w_bytes;
+        // The CHDR width is a power of two
+        return (pkt_size_bytes + _chdr_w_bytes - 1) & ~(_chdr_w_bytes - 1);
     }
 
     /*!
@@ -395,15 +519,48 @@ private:
         return _fc_state.dest_has_space(num_bytes);
     }
 
+    /*!
+     * Waits until the flow control thread has received enough credits for a
+     * frame (with fc_offload only)
+     *
+     * \param timeout_ms timeout in milliseconds, negative to wait forever
+     * \return Whether there are enough flow control credits for a frame
+     */
+    bool _wait_for_credits(const int32_t timeout_ms);
+
+    //! Processes strs packets until the transport is destroyed (with fc_offload)
+    void _fc_thread_loop();
+
     // Interface to the I/O service
     transport::send_io_if::sptr _send_io;
 
+    // With fc_offload: The receive client for strs packets, the thread which
+    // processes them, and the flag which stops it
+    bool _fc_offload = false;
+    transport::recv_io_if::sptr _fc_recv_io;
+    std::thread _fc_thread;
+    std::atomic<bool> _fc_thread_stop{false};
+
     // Flow control state
     tx_flow_ctrl_state _fc_state;
 
+    // Copy of the flow control state for get_fc_outstanding(), which may be
+    // called from threads other than the I/O service
+    std::atomic<uint64_t> _fc_unacked_bytes{0};
+    std::atomic<uint32_t> _fc_unacked_packets{0};
+
+    // Set by request_fc_resync(), which may be called from threads other than
+    // the I/O service
+    std::atomic<bool> _fc_resync_requested{false};
+
     // MTU in bytes
     size_t _mtu = 0;
 
+    // Flow control window, and number of frames reserved from the link
+    stream_buff_params_t _fc_capacity{0, 0};
+    size_t _num_frames = 0;
+    stream_memory_t::link_t _link_memory;
+
     // Size of CHDR headers
     size_t _hdr_len = 0;
 
@@ -436,6 +593,12 @@ private:
 
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Packet tap, or nullptr if it is not enabled
+    chdr_packet_tap::port::uptr _tap;
+
+    // Accounting of the cycles of the streamer, or nullptr
+    transport::cycle_accounting* _cycles = nullptr;
 };
 
 }} // namespace uhd::rfnoc
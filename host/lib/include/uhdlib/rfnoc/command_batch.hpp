@@ -0,0 +1,61 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <memory>
+
+namespace uhd { namespace rfnoc { namespace detail {
+
+/*! Command batches
+ *
+ * While a thread has a command batch open, register writes which request an
+ * ACK don't wait for it. The endpoints keep sending the following commands,
+ * so all commands of the batch go out back to back (as far as the command
+ * FIFOs of the device allow). When the batch is closed, the thread waits for
+ * all the deferred ACKs at once.
+ *
+ * This matters most for timed commands: the device only ACKs those once they
+ * were executed, so waiting for every ACK serializes all of them.
+ */
+
+//! An endpoint which can defer waiting for ACKs while a batch is open
+class command_batch_member
+{
+public:
+    virtual ~command_batch_member() = default;
+
+    /*! Wait for all ACKs which were deferred by the batch
+     *
+     * \throws an exception if any of the deferred commands failed
+     */
+    virtual void flush_command_batch() = 0;
+};
+
+/*! Open a command batch on the calling thread
+ *
+ * Batches may be nested, only closing the outermost one waits for the ACKs.
+ */
+void begin_command_batch();
+
+/*! Close the command batch of the calling thread
+ *
+ * Waits for the deferred ACKs of all endpoints which were added to the batch.
+ * All endpoints are flushed, even if one of them fails.
+ *
+ * \throws uhd::runtime_error if no batch is open
+ * \throws the first error reported by one of the endpoints
+ */
+void end_command_batch();
+
+//! Return true if the calling thread has a command batch open
+bool command_batch_open();
+
+//! Add an endpoint to the open command batch of the calling thread
+void add_to_command_batch(std::weak_ptr<command_batch_member> member);
+
+}}} // namespace uhd::rfnoc::detail
@@ -0,0 +1,54 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+namespace uhd { namespace rfnoc { namespace detail {
+
+/*! Decides which control packet goes out next on a shared control transport
+ *
+ * All ctrlport endpoints of a device share one control transport, and only one
+ * thread can send on it at a time. When it is busy, the next sender is the one
+ * with the most urgent priority class, so that, e.g., tuning a radio doesn't
+ * queue up behind a flood of background register accesses. Senders of the
+ * same class go in no particular order.
+ *
+ * This only orders the packets on the host. It does not make the device
+ * execute requests earlier.
+ */
+class ctrl_send_scheduler
+{
+public:
+    using priority_t = ctrlport_endpoint::priority_t;
+
+    /*! Call \p send_fn with exclusive access to the transport
+     *
+     * Blocks while another thread is sending, or while threads with a more
+     * urgent priority are waiting to send.
+     */
+    void send(const priority_t priority, const std::function<void()>& send_fn);
+
+    //! Return the number of threads waiting to send with \p priority
+    size_t get_num_waiting(const priority_t priority) const;
+
+private:
+    static constexpr size_t NUM_PRIORITIES = 3;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    //! True while a thread is sending
+    bool _busy = false;
+    //! The number of waiting threads, by priority
+    std::array<size_t, NUM_PRIORITIES> _num_waiting{};
+};
+
+}}} // namespace uhd::rfnoc::detail
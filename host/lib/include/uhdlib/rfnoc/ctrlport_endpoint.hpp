@@ -25,8 +25,16 @@ class ctrlport_endpoint : public register_iface
 public:
     using sptr = std::shared_ptr<ctrlport_endpoint>;
 
+    /*! Priority classes of control transactions, from most to least urgent
+     *
+     * Every endpoint sends with the priority of its policy, which is set with
+     * the "priority" argument ("realtime", "normal" or "background") of
+     * set_policy(). Timed commands are always sent as realtime.
+     */
+    enum class priority_t { REALTIME = 0, NORMAL = 1, BACKGROUND = 2 };
+
     //! The function to call when sending a packet to a remote device
-    using send_fn_t = std::function<void(const chdr::ctrl_payload&, double)>;
+    using send_fn_t = std::function<void(const chdr::ctrl_payload&, double, priority_t)>;
 
     ~ctrlport_endpoint() override = 0;
 
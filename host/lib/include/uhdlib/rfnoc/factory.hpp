@@ -19,6 +19,8 @@ struct block_factory_info_t
     std::string timebase_clk;
     std::string ctrlport_clk;
     registry::factory_t factory_fn;
+    //! True if the block may be constructed concurrently with other blocks
+    bool parallel_init = false;
 };
 
 /*! Container for factory functionality
@@ -33,6 +35,18 @@ public:
      */
     static block_factory_info_t get_block_factory(
         noc_id_t noc_id, device_type_t device_id);
+
+    /*! Allow constructing a block concurrently with the other blocks
+     *
+     * This is for blocks with lengthy initialization, e.g., radios which
+     * initialize their daughterboards. The block controller must not rely on
+     * any other blocks having been constructed, and any state it shares with
+     * other blocks (e.g., through the motherboard controller) must be thread
+     * safe.
+     *
+     * Call this from a static block after registering the block.
+     */
+    static void register_parallel_init(noc_id_t noc_id, device_type_t device_id);
 };
 
 }} /* namespace uhd::rfnoc */
@@ -14,6 +14,7 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <tuple>
 
 namespace uhd { namespace rfnoc { namespace detail {
@@ -75,6 +76,16 @@ public:
      */
     void release();
 
+    /*! Enable or disable dynamic reconfiguration
+     *
+     * When enabled, commit() only checks the topology of the nodes whose edges
+     * changed since the last commit, forwards the edge properties of those
+     * nodes, and resolves what that forwarding made dirty. This requires that
+     * all of these nodes were part of an earlier commit, so their properties
+     * are resolved. Otherwise, commit() checks and resolves the whole graph.
+     */
+    void set_dynamic_reconfig(const bool enable);
+
     /*! Shutdown graph: Permenanently release
      *
      * This will release the graph permanently and safely. All ongoing property
@@ -239,12 +250,26 @@ private:
      */
     vertex_list_t _find_dirty_nodes();
 
+    /*! Returns true if any of \p nodes has dirty properties
+     */
+    bool _has_dirty_nodes(const vertex_list_t& nodes);
+
     /*! Returns nodes in topologically sorted order
      *
+     * The order is cached until the topology of the graph changes.
      *
      * \throws uhd::runtime_error if the graph was not sortable
      */
-    vertex_list_t _get_topo_sorted_nodes();
+    const vertex_list_t& _get_topo_sorted_nodes();
+
+    /*! Returns the nodes that are connected to any of \p origins, in
+     * topologically sorted order
+     *
+     * Nodes are connected if there is a path of edges between them, in either
+     * direction. Property changes only travel along edges, so these are the
+     * only nodes that need to be visited when properties on \p origins change.
+     */
+    vertex_list_t _get_connected_nodes(const vertex_list_t& origins);
 
     /*! Add a node, but only if it's not already in the graph.
      *
@@ -287,12 +312,24 @@ private:
      */
     bool _assert_edge_props_consistent(rfnoc_graph_t::edge_descriptor edge);
 
-    /*! Query all blocks on their topology
+    /*! Query blocks on their topology
      *
+     * \param vertices The nodes to check
      * \throws uhd::runtime_error if any of the blocks doesn't like its
      * configuration
      */
-    void _check_topology();
+    void _check_topology(const vertex_list_t& vertices);
+
+    /*! Record that the edges or properties of \p node changed while the graph
+     * was released
+     */
+    void _mark_changed(node_ref_t node);
+
+    /*! Commit only the nodes in _changed_nodes, see set_dynamic_reconfig()
+     *
+     * Graph mutex must be held before calling.
+     */
+    void _commit_changes();
 
     /**************************************************************************
      * Attributes
@@ -313,6 +350,11 @@ private:
     //! FIFO for incoming actions
     std::deque<action_tuple_t> _action_queue;
 
+    //! Cache for _get_topo_sorted_nodes(). Must be invalidated whenever nodes
+    // or edges are added or removed.
+    vertex_list_t _topo_sorted_nodes;
+    bool _topo_sorted_nodes_valid{false};
+
     //! Flag to ensure serialized handling of actions
     std::atomic_flag _action_handling_ongoing;
 
@@ -325,6 +367,18 @@ private:
 
     //! A flag if the graph has shut down. Is protected by _release_mutex
     bool _shutdown{false};
+
+    //! True if commit() may only resolve the nodes which changed
+    bool _dynamic_reconfig{false};
+
+    //! Nodes which were part of a commit, so their properties are resolved
+    std::set<node_ref_t> _committed_nodes;
+
+    //! Nodes whose edges or properties changed since the last commit
+    std::set<node_ref_t> _changed_nodes;
+
+    //! True if a node changed which is not in _committed_nodes
+    bool _full_commit_needed{true};
 };
 
 
@@ -20,6 +20,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
@@ -109,6 +110,9 @@ public:
      * \param adapter The preference for the adapter to use to get to the destination
      * \param xport_args The transport arguments
      * \param streamer_id A unique identifier for the streamer that will own the transport
+     * \param byte_rate The expected data rate in bytes per second, or 0 if unknown.
+     *                  If no adapter is given, it is used to balance the load
+     *                  across the adapters.
      * \return An transport instance
      */
     virtual chdr_rx_data_xport::uptr create_device_to_host_data_stream(
@@ -117,7 +121,8 @@ public:
         const sw_buff_t mdata_buff_fmt,
         const uhd::transport::adapter_id_t adapter,
         const device_addr_t& xport_args,
-        const std::string& streamer_id) = 0;
+        const std::string& streamer_id,
+        const double byte_rate) = 0;
 
     /*! \brief Create a data stream going from the host to the device
      *
@@ -127,6 +132,9 @@ public:
      * \param adapter The preference for the adapter to use to get to the destination
      * \param xport_args The transport arguments
      * \param streamer_id A unique identifier for the streamer that will own the transport
+     * \param byte_rate The expected data rate in bytes per second, or 0 if unknown.
+     *                  If no adapter is given, it is used to balance the load
+     *                  across the adapters.
      * \return An transport instance
      */
     virtual chdr_tx_data_xport::uptr create_host_to_device_data_stream(
@@ -135,7 +143,56 @@ public:
         const sw_buff_t mdata_buff_fmt,
         const uhd::transport::adapter_id_t adapter,
         const device_addr_t& xport_args,
-        const std::string& streamer_id) = 0;
+        const std::string& streamer_id,
+        const double byte_rate) = 0;
+
+    //! The parameters of one data stream, see create_device_to_host_data_streams()
+    struct data_stream_args_t
+    {
+        //! The address of the stream endpoint on the device
+        sep_addr_t sep_addr;
+        sw_buff_t pyld_buff_fmt;
+        sw_buff_t mdata_buff_fmt;
+        uhd::transport::adapter_id_t adapter;
+        device_addr_t xport_args;
+        std::string streamer_id;
+        double byte_rate;
+    };
+
+    /*! \brief Create several data streams going from the device to the host
+     *
+     * This is equivalent to calling create_device_to_host_data_stream() for
+     * every element of \p streams, but the streams of different motherboards
+     * are set up at the same time. The adapters are chosen in the order of
+     * \p streams.
+     *
+     * \param streams The parameters of the data streams
+     * \return The transport instances, in the order of \p streams
+     */
+    virtual std::vector<chdr_rx_data_xport::uptr> create_device_to_host_data_streams(
+        const std::vector<data_stream_args_t>& streams) = 0;
+
+    /*! \brief Create several data streams going from the host to the device
+     *
+     * This is equivalent to calling create_host_to_device_data_stream() for
+     * every element of \p streams, but the streams of different motherboards
+     * are set up at the same time. The adapters are chosen in the order of
+     * \p streams.
+     *
+     * \param streams The parameters of the data streams
+     * \return The transport instances, in the order of \p streams
+     */
+    virtual std::vector<chdr_tx_data_xport::uptr> create_host_to_device_data_streams(
+        const std::vector<data_stream_args_t>& streams) = 0;
+
+    /*! \brief Release the adapter allocations of a streamer's data streams
+     *
+     * Call this when the streamer is disconnected, so that its data streams no
+     * longer count towards the load of their adapters.
+     *
+     * \param streamer_id The identifier that was used to create the data streams
+     */
+    virtual void release_data_streams(const std::string& streamer_id) = 0;
 
     /*! \brief Get all the adapters that can reach the specified endpoint
      *
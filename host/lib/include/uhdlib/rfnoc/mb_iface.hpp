@@ -79,6 +79,37 @@ public:
     virtual uhd::transport::adapter_id_t get_adapter_id(
         const device_id_t local_device_id) = 0;
 
+    /*! Return a key which identifies the topology behind a link
+     *
+     * The nodes which can be reached through a link (crossbars, stream
+     * endpoints, and so on) only depend on the FPGA image. Management portals
+     * cache their topology discovery under this key, so that later sessions on
+     * the same device and image don't have to discover it again. The key must
+     * therefore change whenever the topology may change, e.g., with the FPGA
+     * image or the link.
+     *
+     * \param local_device_id The local device ID of the link
+     * \returns the key, or an empty string if the topology must always be
+     *          discovered
+     */
+    virtual std::string get_topology_key(const device_id_t /*local_device_id*/)
+    {
+        return "";
+    }
+
+    /*! Return the rate of the link associated with \p local_device_id
+     *
+     * The graph uses this to balance data streams across links of different
+     * speeds.
+     *
+     * \param local_device_id The local device ID of the link
+     * \returns the link rate in bytes per second, or 0 if it is not known
+     */
+    virtual double get_link_rate(const device_id_t /*local_device_id*/)
+    {
+        return 0.0;
+    }
+
     /*! Reset the device
      */
     virtual void reset_network() = 0;
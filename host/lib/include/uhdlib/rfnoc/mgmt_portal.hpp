@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <string>
 
 namespace uhd { namespace rfnoc { namespace mgmt {
 
@@ -165,6 +166,8 @@ public:
     //! Configure a flow controlled transmit data stream from this SW mgmt portal to the
     //  endpoint with the specified ID.
     //
+    // This also sets up the route to the endpoint (see setup_local_route()).
+    //
     // \param xport The host stream endpoint's CTRL transport (same EPID as TX stream)
     // \param pyld_buff_fmt Datatype of SW buffer that holds the data payload
     // \param mdata_buff_fmt Datatype of SW buffer that holds the data metadata
@@ -223,10 +226,16 @@ public:
     // local device endpoint, using the \p xport. The transport object is not
     // stored in the management portal.
     // The discovered topology will be stored within the referenced topo_graph.
+    //
+    // If \p topology_key is not empty, the discovered topology is cached under
+    // that key. Later management portals with the same key set up the cached
+    // topology instead of discovering it again, after checking that it still
+    // matches the hardware. See also mb_iface::get_topology_key().
     static uptr make(chdr_ctrl_xport& xport,
         const chdr::chdr_packet_factory& pkt_factory,
         sep_addr_t my_sep_addr,
-        uhd::rfnoc::detail::topo_graph_t::sptr topo_graph);
+        uhd::rfnoc::detail::topo_graph_t::sptr topo_graph,
+        const std::string& topology_key = "");
 };
 
 }}} // namespace uhd::rfnoc::mgmt
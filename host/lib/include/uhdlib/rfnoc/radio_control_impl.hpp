@@ -12,6 +12,7 @@
 #include <uhdlib/features/discoverable_feature_registry.hpp>
 #include <uhdlib/usrp/common/pwr_cal_mgr.hpp>
 #include <uhd/rfnoc/rf_control/core_iface.hpp>
+#include <uhd/utils/tasks.hpp>
 #include <uhdlib/rfnoc/rf_control/gain_profile_iface.hpp>
 #include <unordered_map>
 #include <mutex>
@@ -48,6 +49,10 @@ public:
     void issue_stream_cmd(
         const uhd::stream_cmd_t& stream_cmd, const size_t port) override;
 
+    void issue_periodic_stream_cmd(const uhd::stream_cmd_t& stream_cmd,
+        const uhd::time_spec_t& period,
+        const size_t port) override;
+
     void enable_rx_timestamps(const bool enable, const size_t chan) override;
 
     /**************************************************************************
@@ -275,6 +280,10 @@ public:
 
             RX_CMD_TIMED_POS = 31,
 
+            // REG_RX_STATUS bit fields
+            RX_STATUS_CMD_FIFO_SPACE_MASK = 0x3F, // Free space in the command FIFO
+            RX_CMD_FIFO_SIZE              = 32, // Size of the command FIFO
+
             PERIPH_BASE       = 0x80000,
             PERIPH_REG_OFFSET = 8,
 
@@ -406,6 +415,33 @@ private:
     std::unordered_map<size_t, double> _rx_bandwidth;
 
     std::vector<uhd::stream_cmd_t> _last_stream_cmd;
+
+    /**************************************************************************
+     * Periodic stream commands
+     *************************************************************************/
+    struct periodic_stream_cmd_t
+    {
+        //! The next window which is not queued yet
+        uhd::stream_cmd_t next_cmd{uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE};
+        uhd::time_spec_t period;
+    };
+
+    //! Write the registers of a stream command to the radio
+    void _write_stream_cmd(const uhd::stream_cmd_t& stream_cmd, const size_t chan);
+
+    //! Queue windows of a periodic stream command while the command FIFO has
+    // space. Requires a lock on _periodic_mutex.
+    void _fill_cmd_fifo(periodic_stream_cmd_t& periodic_cmd, const size_t chan);
+
+    //! Body of _periodic_task: Keep the command FIFOs filled
+    void _periodic_stream_cmd_task();
+
+    std::mutex _periodic_mutex;
+    //! The periodic stream commands which are running, by channel
+    std::unordered_map<size_t, periodic_stream_cmd_t> _periodic_stream_cmds;
+    //! Created with the first periodic stream command. Destroyed first, so it
+    // doesn't outlive the state it uses.
+    uhd::task::sptr _periodic_task;
 };
 
 }} // namespace uhd::rfnoc
@@ -10,6 +10,7 @@
 #include <uhdlib/rfnoc/chdr_rx_data_xport.hpp>
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <atomic>
+#include <mutex>
 #include <string>
 
 namespace uhd { namespace rfnoc {
@@ -94,6 +95,18 @@ public:
      */
     void connect_channel(const size_t channel, chdr_rx_data_xport::uptr xport) override;
 
+    /*! Get counters describing the activity of this streamer
+     *
+     * Overrides method in rx_streamer_impl to add the flow control state.
+     */
+    stream_telemetry_t get_telemetry() const override;
+
+    //! See rx_streamer::get_memory_footprint()
+    stream_memory_t get_memory_footprint() const override;
+
+    //! See rx_streamer::get_recv_fd()
+    int get_recv_fd() override;
+
 private:
     void _register_props(const size_t chan, const std::string& otw_format);
 
@@ -123,6 +136,12 @@ private:
 
     std::atomic<bool> _overrun_handling_mode{false};
     size_t _overrun_channel = 0;
+
+    // Descriptor returned by get_recv_fd(), an epoll instance if it combines
+    // several channels
+    std::mutex _recv_fd_mutex;
+    int _recv_fd        = -1;
+    bool _recv_fd_owned = false;
 };
 
 }} // namespace uhd::rfnoc
@@ -98,15 +98,34 @@ public:
      */
     bool recv_async_msg(uhd::async_metadata_t& async_metadata, double timeout) override;
 
+    //! See tx_streamer::get_async_msg_fd()
+    int get_async_msg_fd() override;
+
+    /*! Get counters describing the activity of this streamer
+     *
+     * Overrides method in tx_streamer_impl to add the flow control state and
+     * the errors reported by the device.
+     */
+    stream_telemetry_t get_telemetry() const override;
+
+    //! See tx_streamer::get_memory_footprint()
+    stream_memory_t get_memory_footprint() const override;
+
 private:
     void _register_props(const size_t chan, const std::string& otw_format);
 
     void _handle_tx_event_action(
         const res_source_info& src, tx_event_action_info::sptr tx_event_action);
 
+    void _enqueue_async_msg(const uhd::async_metadata_t& md);
+
     // Queue for async messages
     tx_async_msg_queue::sptr _async_msg_queue;
 
+    // Telemetry for async messages, which may come from several threads
+    transport::telemetry_counter _sequence_errors;
+    transport::telemetry_counter _underflows;
+
     // Properties
     std::vector<property_t<double>> _scaling_out;
     std::vector<property_t<double>> _samp_rate_out;
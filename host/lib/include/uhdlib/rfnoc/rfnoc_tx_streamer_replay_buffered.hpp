@@ -9,12 +9,31 @@
 #include <uhd/rfnoc_graph.hpp>
 #include <uhd/rfnoc/replay_block_control.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
 /*!
  * Extends the rfnoc_tx_streamer so it can use a Replay block to
  * buffer TX data.
+ *
+ * A background thread keeps track of the play position of every channel, so
+ * that send() does not have to read it while there is room in the buffer. It
+ * only polls a channel while its free room is below the watermark, which is
+ * the size of the last send() call.
+ *
+ * A channel can be striped across several input ports of its Replay block:
+ * The data of every send() call is then split into one part per port, and all
+ * parts are streamed to the Replay block at the same time. The parts are
+ * recorded back to back, and played back through the port of the channel. In
+ * that case, the streamer has one port per stripe, and the streamer ports of
+ * channel i are i * num_stripes to (i + 1) * num_stripes - 1.
  */
 class rfnoc_tx_streamer_replay_buffered : public rfnoc_tx_streamer
 {
@@ -25,6 +44,9 @@ public:
         size_t port                     = 0;        // Replay port to use
         uint64_t start_address          = 0;        // Start address in memory
         uint64_t mem_size               = 0;        // Size of memory block to use
+        // Additional input ports which record a stripe of the data each. All
+        // channels must use the same number of stripes.
+        std::vector<size_t> stripe_ports;
     };
 
     struct replay_status_t {
@@ -32,11 +54,13 @@ public:
         uint64_t record_offset          = 0;
         uint64_t play_offset            = 0;
         uint64_t play_end               = 0;
+        // Room needed for the next send() call, 0 if none is expected yet
+        uint64_t watermark              = 0;
     };
 
     /*! Constructor
      *
-     * \param num_ports     The number of ports
+     * \param num_ports     The number of channels
      * \param stream_args   Arguments to aid the construction of the streamer
      * \param disconnect_cb Callback function to disconnect the streamer when
      *                      the object is destroyed
@@ -52,8 +76,12 @@ public:
      */
     ~rfnoc_tx_streamer_replay_buffered();
 
+    //! Returns the number of channels, which is less than the number of ports
+    // when striping
+    size_t get_num_channels() const override;
+
     /*! Send
-     * 
+     *
      * Sends data by recording to the Replay block and playing it.
      *
      * \param buffs a vector of read-only memory containing samples
@@ -68,11 +96,38 @@ public:
         const double timeout = 0.1) override;
 
 private:
+    //! Returns the room in the buffer of a channel (with _mutex held)
+    static uint64_t _get_room(const replay_status_t& chan);
+
+    //! Waits until all channels have room for record_size bytes
+    bool _wait_for_room(const uint64_t record_size,
+        const std::chrono::steady_clock::time_point timeout_time);
+
+    //! Main loop of the thread which polls the play positions
+    void _poll_play_positions();
+
     // Size of item
     size_t _bytes_per_otw_item;
+    size_t _bytes_per_cpu_item;
+
+    // Number of Replay ports recording the data of each channel
+    size_t _num_stripes;
 
-    // Status of Replay channels
+    // Status of Replay channels (protected by _mutex)
     std::vector<replay_status_t> _replay_chans;
+
+    // Pointers to the stripes of the buffers passed to send()
+    std::vector<const void*> _stripe_buffs;
+
+    std::mutex _mutex;
+    // Notifies the polling thread of changes to watermarks or play ends
+    std::condition_variable _poll_cond;
+    // Notifies send() of changes to play positions
+    std::condition_variable _room_cond;
+    // Error of the polling thread, which send() rethrows
+    std::exception_ptr _poll_error;
+    std::atomic<bool> _stop_polling{false};
+    std::thread _poll_thread;
 };
 
 }} // namespace uhd::rfnoc
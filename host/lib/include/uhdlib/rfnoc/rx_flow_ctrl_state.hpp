@@ -8,10 +8,22 @@
 
 #include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <algorithm>
 
 namespace uhd { namespace rfnoc {
 
-//! Class to manage rx flow control state
+/*! Class to manage rx flow control state
+ *
+ * By default, a flow control response is due whenever the configured amount
+ * of data was transferred since the last one. With set_fc_freq_limits(), the
+ * frequency adapts to how well the data is consumed instead: The backlog of
+ * data which was received, but not transferred yet, is averaged every time a
+ * response is sent. While the backlog is low (the consumer keeps up), the
+ * responses are sent at the maximum interval, which saves upstream bandwidth
+ * and per-packet work. As the backlog grows (the consumer falls behind), the
+ * interval shrinks towards the minimum, so the freed buffer space is returned
+ * to the sender sooner once the consumer catches up.
+ */
 class rx_flow_ctrl_state
 {
 public:
@@ -22,6 +34,27 @@ public:
     {
     }
 
+    /*! Let the flow control frequency adapt between two limits
+     *
+     * The limits of a count (bytes or packets) may be equal, which keeps that
+     * count's frequency fixed.
+     *
+     * \param min_freq The most frequent responses, for a large backlog
+     * \param max_freq The least frequent responses, for no backlog
+     * \param capacity The capacity of the receive buffer
+     */
+    void set_fc_freq_limits(const stream_buff_params_t min_freq,
+        const stream_buff_params_t max_freq,
+        const stream_buff_params_t capacity)
+    {
+        _min_freq = min_freq;
+        _max_freq = max_freq;
+        _capacity = capacity;
+        _adaptive = true;
+        _fc_freq  = {std::min(std::max(_fc_freq.bytes, min_freq.bytes), max_freq.bytes),
+            std::min(std::max(_fc_freq.packets, min_freq.packets), max_freq.packets)};
+    }
+
     //! Resynchronize with transfer counts from the sender
     void resynchronize(const stream_buff_params_t counts)
     {
@@ -78,6 +111,9 @@ public:
     void fc_resp_sent()
     {
         _last_fc_resp_counts = _xfer_counts;
+        if (_adaptive) {
+            _adapt_fc_freq();
+        }
     }
 
     //! Returns counts for completed transfers
@@ -92,6 +128,13 @@ public:
         return _recv_counts;
     }
 
+    //! Returns counts for data received, but not yet acknowledged to the sender
+    stream_buff_params_t get_unacked_counts() const
+    {
+        return {_recv_counts.bytes - _last_fc_resp_counts.bytes,
+            _recv_counts.packets - _last_fc_resp_counts.packets};
+    }
+
     //! Returns configured flow control frequency
     stream_buff_params_t get_fc_freq() const
     {
@@ -99,6 +142,39 @@ public:
     }
 
 private:
+    //! Fraction of the capacity at which the backlog gets the most frequent responses
+    static constexpr double MAX_BACKLOG_RATIO = 0.25;
+
+    //! Weight of the newest backlog in its average
+    static constexpr double BACKLOG_AVG_WEIGHT = 1.0 / 8;
+
+    //! Move the flow control frequency between its limits, according to the backlog
+    void _adapt_fc_freq()
+    {
+        // The transfer counts may run ahead after a resynchronization
+        const uint64_t backlog_bytes = _recv_counts.bytes > _xfer_counts.bytes
+                                           ? _recv_counts.bytes - _xfer_counts.bytes
+                                           : 0;
+        const uint32_t backlog_pkts = _recv_counts.packets > _xfer_counts.packets
+                                          ? _recv_counts.packets - _xfer_counts.packets
+                                          : 0;
+        double fill = 0.0;
+        if (_min_freq.bytes != _max_freq.bytes && _capacity.bytes) {
+            fill = std::max(fill, double(backlog_bytes) / _capacity.bytes);
+        }
+        if (_min_freq.packets != _max_freq.packets && _capacity.packets) {
+            fill = std::max(fill, double(backlog_pkts) / _capacity.packets);
+        }
+        fill = std::min(fill, 1.0);
+        _backlog_avg += BACKLOG_AVG_WEIGHT * (fill - _backlog_avg);
+
+        const double t = std::min(_backlog_avg / MAX_BACKLOG_RATIO, 1.0);
+        _fc_freq       = {
+            _max_freq.bytes - uint64_t(t * double(_max_freq.bytes - _min_freq.bytes)),
+            _max_freq.packets
+                - uint32_t(t * double(_max_freq.packets - _min_freq.packets))};
+    }
+
     // Counts for data received, including any data still in use
     stream_buff_params_t _recv_counts{0, 0};
 
@@ -111,6 +187,14 @@ private:
     // Frequency of flow control responses
     stream_buff_params_t _fc_freq{0, 0};
 
+    // Limits of the adaptive flow control frequency, the buffer capacity, and
+    // the average backlog as a fraction of the capacity
+    bool _adaptive = false;
+    stream_buff_params_t _min_freq{0, 0};
+    stream_buff_params_t _max_freq{0, 0};
+    stream_buff_params_t _capacity{0, 0};
+    double _backlog_avg = 0.0;
+
     // Endpoint ID for log messages
     const sep_id_pair_t _epids;
 };
@@ -13,6 +13,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace uhd { namespace rfnoc { namespace detail {
 
@@ -304,8 +305,14 @@ public:
     topo_edge_t get_edge(const topo_node_t& src, const topo_node_t& dst) const;
 
     //! Return a read/write reference to a node object
+    //
+    // Writing through the reference is not thread safe, use set_epid() when
+    // the graph is shared between threads.
     topo_node_t& access_node(const topo_node_t& node_id);
 
+    //! Bind an EPID to a node
+    void set_epid(const topo_node_t& node_id, const sep_id_t epid);
+
     //! Update the weight (aka distance) on a specific edge
     void update_weight(
         const topo_node_t& src, const topo_edge_t::port_t src_port, const int new_weight);
@@ -380,6 +387,10 @@ private:
     node_map_t _node_map;
 
     std::vector<topo_edge_t> _edge_info;
+
+    //! Protects all of the above. The graph is shared by the management
+    // portals of all local devices, which may set up streams at the same time.
+    mutable std::recursive_mutex _mutex;
 };
 
 }}} // namespace uhd::rfnoc::detail
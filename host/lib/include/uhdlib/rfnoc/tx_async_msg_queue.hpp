@@ -7,13 +7,23 @@
 #pragma once
 
 #include <uhd/types/metadata.hpp>
-#include <boost/lockfree/queue.hpp>
+#include <uhdlib/utils/mpsc_ring.hpp>
+#include <uhdlib/utils/wakeup_fd.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace uhd { namespace rfnoc {
 
 /*!
  *  Implements queue of async messages originating from the tx data transport
  *  and from the rfnoc graph.
+ *
+ *  Messages are pushed onto a lock-free ring from any thread. When the ring is
+ *  full, new messages are dropped and counted. On Linux, macOS and BSD, the
+ *  queue has a file descriptor which is readable while messages are waiting,
+ *  so applications can wait for them together with other descriptors, and
+ *  recv_async_msg() waits on it instead of polling.
  */
 class tx_async_msg_queue
 {
@@ -39,8 +49,28 @@ public:
      */
     void enqueue(const async_metadata_t& async_metadata);
 
+    //! Return the number of messages which were dropped because the queue was full
+    uint64_t get_num_dropped() const;
+
+    /*! Return a file descriptor which is readable while messages are waiting
+     *
+     * The descriptor may also be readable when the queue is empty; reading
+     * from the queue until recv_async_msg() returns false clears it. Don't
+     * read from or close the descriptor.
+     *
+     * \throws uhd::not_implemented_error on platforms without descriptors
+     */
+    int get_fd() const;
+
 private:
-    boost::lockfree::queue<async_metadata_t> _queue;
+    //! Pop a message, and clear the descriptor if there is none
+    bool _pop(async_metadata_t& async_metadata);
+
+    mpsc_ring<async_metadata_t> _queue;
+    //! Serializes consumers, producers don't take it
+    std::mutex _pop_mutex;
+    std::atomic<uint64_t> _num_dropped{0};
+    wakeup_fd _wakeup_fd;
 };
 
 }} // namespace uhd::rfnoc
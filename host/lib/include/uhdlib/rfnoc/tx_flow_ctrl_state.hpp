@@ -7,10 +7,18 @@
 #pragma once
 
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <atomic>
 
 namespace uhd { namespace rfnoc {
 
-//! Class to manage tx flow control state
+/*! Class to manage tx flow control state
+ *
+ * All methods must be called from the thread which sends, except for
+ * update_dest_recv_count(), which may also be called from another thread
+ * (see chdr_tx_data_xport::fc_params_t::fc_offload). The destination counts
+ * are atomics for that purpose, which costs no more than plain loads and
+ * stores on common architectures.
+ */
 class tx_flow_ctrl_state
 {
 public:
@@ -20,7 +28,8 @@ public:
     //! Updates destination received count
     void update_dest_recv_count(const stream_buff_params_t& recv_count)
     {
-        _recv_counts = recv_count;
+        _recv_packets.store(recv_count.packets, std::memory_order_relaxed);
+        _recv_bytes.store(recv_count.bytes, std::memory_order_release);
     }
 
     /*! Returns whether the destination has buffer space for the requested
@@ -30,7 +39,8 @@ public:
     {
         // The stream endpoint only cares about bytes, the packet count is not
         // important to determine the space available.
-        const auto buffer_fullness = _xfer_counts.bytes - _recv_counts.bytes;
+        const auto buffer_fullness =
+            _xfer_counts.bytes - _recv_bytes.load(std::memory_order_acquire);
         const auto space_available = _dest_capacity.bytes - buffer_fullness;
         return space_available >= packet_size;
     }
@@ -60,6 +70,12 @@ public:
         return _fc_resync_req;
     }
 
+    //! Requests an fc resync with the next packet, regardless of the cadence
+    void request_fc_resync()
+    {
+        _fc_resync_req = true;
+    }
+
     //! Clears fc resync request pending status
     void clear_fc_resync_req_pending()
     {
@@ -73,12 +89,21 @@ public:
         return _xfer_counts;
     }
 
+    //! Returns counts for data sent, but not yet acknowledged by the destination
+    stream_buff_params_t get_unacked_counts() const
+    {
+        const uint64_t recv_bytes = _recv_bytes.load(std::memory_order_acquire);
+        return {_xfer_counts.bytes - recv_bytes,
+            _xfer_counts.packets - _recv_packets.load(std::memory_order_relaxed)};
+    }
+
 private:
     // Counts for data sent
     stream_buff_params_t _xfer_counts{0, 0};
 
     // Counts for data received by the destination
-    stream_buff_params_t _recv_counts{0, 0};
+    std::atomic<uint64_t> _recv_bytes{0};
+    std::atomic<uint32_t> _recv_packets{0};
 
     // Buffer size at the destination
     stream_buff_params_t _dest_capacity{0, 0};
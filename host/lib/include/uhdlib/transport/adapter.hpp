@@ -20,11 +20,18 @@ public:
 
     adapter_id_t register_adapter(adapter_info& info);
 
+    /*! Return the NUMA node of a registered adapter
+     *
+     * \return the node, or -1 if it is unknown
+     */
+    int get_numa_node(const adapter_id_t id);
+
 private:
     adapter_ctx() = default;
 
     std::mutex _mutex;
     std::unordered_map<std::string, adapter_id_t> _id_map;
+    std::unordered_map<adapter_id_t, int> _numa_nodes;
 };
 
 }} // namespace uhd::transport
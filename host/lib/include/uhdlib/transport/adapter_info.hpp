@@ -22,6 +22,14 @@ public:
      *  String contents are not API. Only uniqueness is guaranteed.
      */
     virtual std::string to_string() = 0;
+
+    /*! Returns the NUMA node the adapter is attached to, or -1 if it is
+     *  unknown
+     */
+    virtual int get_numa_node()
+    {
+        return -1;
+    }
 };
 
 }} // namespace uhd::transport
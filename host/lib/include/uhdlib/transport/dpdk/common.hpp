@@ -14,15 +14,21 @@
 #include <rte_ether.h>
 #include <rte_flow.h>
 #include <rte_mbuf.h>
+#include <rte_memzone.h>
 #include <rte_mempool.h>
 #include <rte_spinlock.h>
 #include <rte_version.h>
+#include <sys/types.h>
+#include <unistd.h>
 #include <unordered_map>
 #include <array>
 #include <atomic>
+#include <map>
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 /* NOTE: There are changes to all the network standard fields in 19.x */
 
@@ -71,6 +77,18 @@ using queue_id_t = uint16_t;
 using port_id_t  = uint16_t;
 using rte_ipv4_addr  = uint32_t;
 
+/*!
+ * Return the name of a DPDK object (ring, hash table, ...) which every
+ * process creates for itself
+ *
+ * The processes of a multi-process setup share one namespace for DPDK
+ * objects, so the name carries the PID.
+ */
+inline std::string get_process_object_name(const std::string& name)
+{
+    return name + "@" + std::to_string(getpid());
+}
+
 class dpdk_adapter_info : public adapter_info
 {
 public:
@@ -151,6 +169,42 @@ private:
 constexpr size_t DPDK_MBUF_PRIV_SIZE =
     RTE_ALIGN(sizeof(struct dpdk_frame_buff), RTE_MBUF_PRIV_ALIGN);
 
+/*!
+ * State of a NIC port which all processes using it share
+ *
+ * The primary process creates it in a memzone when it configures the port,
+ * and secondary processes look it up to claim DMA queues and UDP ports. The
+ * owners are PIDs, so the resources of processes which exited without
+ * releasing them can be reclaimed.
+ */
+struct dpdk_port_shared
+{
+    static constexpr size_t MAX_QUEUES      = 128;
+    static constexpr size_t MAX_ARP_ENTRIES = 64;
+
+    rte_spinlock_t lock;
+    //! The MTU which the primary process set
+    size_t mtu;
+    //! The number of DMA queues of the port
+    uint16_t num_queues;
+    //! Whether the NIC can steer UDP packets to queues
+    bool flow_steering;
+    //! The process which owns each DMA queue, or 0 if it is free
+    pid_t queue_owners[MAX_QUEUES];
+    //! The process which owns each local UDP port (in host order), or 0
+    pid_t udp_port_owners[65536];
+    //! The MAC addresses which the primary process learned from ARP packets,
+    // which arrive on its queue
+    struct
+    {
+        rte_ipv4_addr ipv4;
+        struct rte_ether_addr mac_addr;
+    } arp_entries[MAX_ARP_ENTRIES];
+    size_t num_arp_entries;
+    //! The ARP entry to replace next, once the table is full
+    size_t next_arp_entry;
+};
+
 /*!
  * Class representing a DPDK NIC port
  *
@@ -171,11 +225,15 @@ public:
      *
      * \param port The port ID
      * \param mtu The intended MTU for the port
-     * \param num_queues Number of DMA queues to reserve for this port
+     * \param num_queues Number of DMA queues to reserve for this port. If
+     *                   there is more than one, received UDP packets are
+     *                   steered to their link's queue with rte_flow rules.
      * \param num_desc The number of descriptors per DMA queue
      * \param rx_pktbuf_pool A pointer to the port's RX packet buffer pool
      * \param tx_pktbuf_pool A pointer to the port's TX packet buffer pool
      * \param rte_ipv4_address The IPv4 network address (w/ netmask)
+     * \param num_secondary_queues Number of DMA queues to set up in addition
+     *                             to \p num_queues, for secondary processes
      * \return A unique_ptr to a dpdk_port object
      */
     static dpdk_port::uptr make(port_id_t port,
@@ -184,6 +242,28 @@ public:
         uint16_t num_desc,
         struct rte_mempool* rx_pktbuf_pool,
         struct rte_mempool* tx_pktbuf_pool,
+        std::string rte_ipv4_address,
+        uint16_t num_secondary_queues = 0);
+
+    /*! Attach to a NIC port which the primary process configured, from a
+     *  secondary process
+     *
+     * The port must have been configured with spare DMA queues (see
+     * make()), and the NIC must be able to steer UDP packets to them.
+     *
+     * \param port The port ID
+     * \param num_queues Number of spare DMA queues to claim for this process
+     * \param rx_pktbuf_pool A pointer to the port's RX packet buffer pool
+     * \param tx_pktbuf_pool A pointer to the port's TX packet buffer pool
+     * \param rte_ipv4_address The IPv4 network address (w/ netmask), as
+     *                         configured in the primary process
+     * \return A unique_ptr to a dpdk_port object
+     * \throws uhd::runtime_error if the port has no spare queues
+     */
+    static dpdk_port::uptr attach(port_id_t port,
+        uint16_t num_queues,
+        struct rte_mempool* rx_pktbuf_pool,
+        struct rte_mempool* tx_pktbuf_pool,
         std::string rte_ipv4_address);
 
     dpdk_port(port_id_t port,
@@ -192,6 +272,14 @@ public:
         uint16_t num_desc,
         struct rte_mempool* rx_pktbuf_pool,
         struct rte_mempool* tx_pktbuf_pool,
+        std::string rte_ipv4_address,
+        uint16_t num_secondary_queues);
+
+    //! Constructor of attach()
+    dpdk_port(port_id_t port,
+        uint16_t num_queues,
+        struct rte_mempool* rx_pktbuf_pool,
+        struct rte_mempool* tx_pktbuf_pool,
         std::string rte_ipv4_address);
 
     ~dpdk_port();
@@ -251,6 +339,17 @@ public:
         return _num_queues;
     }
 
+    /*! Getter for the DMA queues of this process, which are all queues
+     * except those for secondary processes in the primary process, and the
+     * claimed ones in a secondary process
+     *
+     * \return The queue IDs
+     */
+    inline const std::vector<queue_id_t>& get_queues() const
+    {
+        return _queues;
+    }
+
     /*! Getter for this port's RX packet buffer memory pool
      *
      * \return The RX packet buffer pool
@@ -287,6 +386,28 @@ public:
      */
     uint16_t alloc_udp_port(uint16_t udp_port);
 
+    /*!
+     * Allocate a DMA queue for a link, and steer the link's packets to it
+     *
+     * The queue with the fewest links is picked, and a flow rule is added to
+     * the NIC which sends UDP packets for \p udp_port to that queue. If the
+     * port has a single queue, or the NIC doesn't support such rules, this
+     * returns queue 0, and its I/O service demultiplexes the packets in
+     * software.
+     *
+     * \param udp_port The link's local UDP port, in network order
+     * \return the queue for receiving and sending the link's packets
+     */
+    queue_id_t alloc_queue(uint16_t udp_port);
+
+    /*!
+     * Release a DMA queue allocated with alloc_queue(), and remove the flow
+     * rule for the link
+     *
+     * \param udp_port The link's local UDP port, in network order
+     */
+    void free_queue(uint16_t udp_port);
+
 private:
     friend uhd::transport::dpdk_io_service;
 
@@ -295,6 +416,39 @@ private:
      */
     int _arp_reply(queue_id_t queue_id, struct rte_arp_hdr* arp_req);
 
+    /*!
+     * Check whether the NIC can steer UDP packets to a queue, and disable
+     * flow steering if it can't
+     */
+    void _check_flow_steering();
+
+    /*!
+     * Create the state shared with secondary processes, owning the queues of
+     * this process
+     */
+    void _create_shared();
+
+    /*!
+     * Claim a local UDP port (in host order) in the shared state, if there
+     * is one
+     *
+     * \return whether no other process uses the UDP port
+     */
+    bool _claim_shared_udp_port(uint16_t udp_port);
+
+    /*!
+     * Record the MAC address of a host for secondary processes, if there are
+     * any
+     */
+    void _share_arp_entry(rte_ipv4_addr ipv4, const struct rte_ether_addr& mac_addr);
+
+    /*!
+     * Look up the MAC address of a host which the primary process learned
+     *
+     * \return whether the address is known
+     */
+    bool _lookup_shared_arp_entry(rte_ipv4_addr ipv4, struct rte_ether_addr& mac_addr);
+
     port_id_t _port;
     size_t _mtu;
     size_t _num_queues;
@@ -308,6 +462,19 @@ private:
     std::mutex _mutex;
     std::set<uint16_t> _udp_ports;
     uint16_t _next_udp_port = 0xffff;
+    bool _flow_steering = false;
+    //! Number of links using each DMA queue
+    std::vector<size_t> _queue_links;
+    //! Queue and flow rule for every local UDP port (in network order)
+    std::map<uint16_t, std::pair<queue_id_t, struct rte_flow*>> _flows;
+    //! The DMA queues of this process
+    std::vector<queue_id_t> _queues;
+
+    //! Whether a primary process configured the port for this process
+    bool _secondary = false;
+    //! The state shared with the other processes, or nullptr
+    const struct rte_memzone* _memzone = nullptr;
+    dpdk_port_shared* _shared          = nullptr;
 
     // Structures protected by spin lock
     rte_spinlock_t _spinlock = RTE_SPINLOCK_INITIALIZER;
@@ -387,9 +554,10 @@ public:
      */
     bool is_init_done(void) const;
 
-    /*! Return a reference to an IO service given a port ID
+    /*! Return a reference to an IO service given a port ID and DMA queue
      */
-    std::shared_ptr<uhd::transport::dpdk_io_service> get_io_service(const size_t port_id);
+    std::shared_ptr<uhd::transport::dpdk_io_service> get_io_service(
+        const size_t port_id, const queue_id_t queue_id = 0);
 
 private:
     /*! Convert the args to DPDK's EAL args and Initialize the EAL
@@ -420,14 +588,18 @@ private:
     int _num_mbufs;
     int _mbuf_cache_size;
     int _link_init_timeout;
+    //! Whether the ports and mempools belong to a primary process
+    bool _secondary = false;
     std::mutex _init_mutex;
     std::atomic<bool> _init_done;
     uhd::dict<uint32_t, port_id_t> _routes;
     std::unordered_map<port_id_t, dpdk_port::uptr> _ports;
     std::vector<struct rte_mempool*> _rx_pktbuf_pools;
     std::vector<struct rte_mempool*> _tx_pktbuf_pools;
-    // Store all the I/O services, and also store the corresponding port ID
-    std::map<std::shared_ptr<uhd::transport::dpdk_io_service>, std::vector<size_t>>
+    // Store all the I/O services, and also store the corresponding port IDs
+    // and DMA queues
+    std::map<std::shared_ptr<uhd::transport::dpdk_io_service>,
+        std::vector<std::pair<size_t, queue_id_t>>>
         _io_srv_portid_map;
 };
 
@@ -27,8 +27,18 @@ class dpdk_io_service : public virtual io_service,
 public:
     using sptr = std::shared_ptr<dpdk_io_service>;
 
-    static sptr make(
-        unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth);
+    /*! Create an I/O service and launch its worker on a DPDK lcore
+     *
+     * \param lcore_id The lcore to run on
+     * \param ports The NIC ports served by the I/O service
+     * \param queues The DMA queue to receive and send on, for every entry of
+     *               \p ports
+     * \param servq_depth The depth of the service queue
+     */
+    static sptr make(unsigned int lcore_id,
+        std::vector<dpdk::dpdk_port*> ports,
+        std::vector<dpdk::queue_id_t> queues,
+        size_t servq_depth);
 
     ~dpdk_io_service();
 
@@ -65,8 +75,10 @@ private:
     friend class dpdk_recv_io;
     friend class dpdk_send_io;
 
-    dpdk_io_service(
-        unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth);
+    dpdk_io_service(unsigned int lcore_id,
+        std::vector<dpdk::dpdk_port*> ports,
+        std::vector<dpdk::queue_id_t> queues,
+        size_t servq_depth);
     dpdk_io_service(const dpdk_io_service&) = delete;
 
     /*!
@@ -162,6 +174,12 @@ private:
     int _send_arp_request(
         dpdk::dpdk_port* port, dpdk::queue_id_t queue, dpdk::rte_ipv4_addr ip);
 
+    /*!
+     * Helper function for I/O thread to complete the pending ARP requests of
+     * a secondary process with the addresses the primary process learned
+     */
+    void _poll_shared_arp();
+
     /*!
      * Helper function for I/O thread to process an ARP request/reply
      *
@@ -211,6 +229,8 @@ private:
     unsigned int _lcore_id;
     //! The NIC ports served by this dpdk_io_service
     std::vector<dpdk::dpdk_port*> _ports;
+    //! The DMA queue used on each port
+    std::unordered_map<dpdk::port_id_t, dpdk::queue_id_t> _queues;
     //! The set of TX queues associated with a given port
     std::unordered_map<dpdk::port_id_t, std::list<dpdk_send_io*>> _tx_queues;
     //! The list of recv_io for each port
@@ -221,6 +241,8 @@ private:
     dpdk::service_queue _servq;
     //! Retry list for waking clients
     dpdk_io_if* _retry_head = NULL;
+    //! Whether ARP requests of a secondary process wait for the primary
+    bool _shared_arp_pending = false;
 
     //! Mutex to protect below data structures
     std::mutex _mutex;
@@ -83,11 +83,15 @@ public:
         uint16_t id              = io_srv->_get_unique_client_id();
         char name[16];
         snprintf(name, sizeof(name), "tx%hu-%hu", nic_port, id);
-        _buffer_queue = rte_ring_create(
-            name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
+        _buffer_queue = rte_ring_create(dpdk::get_process_object_name(name).c_str(),
+            queue_size,
+            rte_socket_id(),
+            RING_F_SP_ENQ | RING_F_SC_DEQ);
         snprintf(name, sizeof(name), "~tx%hu-%hu", nic_port, id);
-        _send_queue = rte_ring_create(
-            name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
+        _send_queue = rte_ring_create(dpdk::get_process_object_name(name).c_str(),
+            queue_size,
+            rte_socket_id(),
+            RING_F_SP_ENQ | RING_F_SC_DEQ);
         UHD_LOG_TRACE("DPDK::SEND_IO", "dpdk_send_io() " << _buffer_queue->name);
 
         // Create the wait_request object that gets passed around
@@ -204,11 +208,15 @@ public:
             "DPDK::IO_SERVICE", "Creating recv client with queue size of " << queue_size);
         char name[16];
         snprintf(name, sizeof(name), "rx%hu-%hu", nic_port, id);
-        _recv_queue = rte_ring_create(
-            name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
+        _recv_queue = rte_ring_create(dpdk::get_process_object_name(name).c_str(),
+            queue_size,
+            rte_socket_id(),
+            RING_F_SP_ENQ | RING_F_SC_DEQ);
         snprintf(name, sizeof(name), "~rx%hu-%hu", nic_port, id);
-        _release_queue = rte_ring_create(
-            name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
+        _release_queue = rte_ring_create(dpdk::get_process_object_name(name).c_str(),
+            queue_size,
+            rte_socket_id(),
+            RING_F_SP_ENQ | RING_F_SC_DEQ);
         UHD_LOG_TRACE("DPDK::RECV_IO", "dpdk_recv_io() " << _recv_queue->name);
         // Create the wait_request object that gets passed around
         _waiter = dpdk::wait_req_alloc(dpdk::wait_type::WAIT_RX, (void*)&_dpdk_io_if);
@@ -9,12 +9,24 @@
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <unordered_map>
 
 namespace uhd { namespace transport {
 
 /*!
  * Helper class to keep track of the number of frames reserved from a pair of links
+ *
+ * By default, every client is guaranteed all the frames it reserves, and the
+ * reservations of the clients of a link must not exceed the frames of the
+ * link. In the elastic mode (a minimum frames ratio below 1.0), a client is
+ * only guaranteed that share of its frames, and only the guaranteed frames
+ * must fit into the link. The frames of the link which are not guaranteed to
+ * any client form a pool, from which clients borrow the rest of their frames
+ * while they need them. When the pool is exhausted, a client can't use more
+ * than its guaranteed frames until other clients return frames.
  */
 class frame_reservation_mgr
 {
@@ -25,22 +37,37 @@ public:
         size_t num_recv_frames = 0;
         send_link_if::sptr send_link;
         size_t num_send_frames = 0;
+        //! The guaranteed frames, filled in by reserve_frames()
+        size_t min_recv_frames = 0;
+        size_t min_send_frames = 0;
     };
 
+    /*!
+     * \param min_frames_ratio The share of the frames of a reservation which
+     *                         is guaranteed, in (0.0, 1.0]
+     */
+    frame_reservation_mgr(const double min_frames_ratio = 1.0)
+        : _min_frames_ratio(min_frames_ratio)
+    {
+        if (!(min_frames_ratio > 0.0 && min_frames_ratio <= 1.0)) {
+            throw uhd::value_error("Minimum frames ratio must be in (0.0, 1.0]");
+        }
+    }
+
     void register_link(const recv_link_if::sptr& recv_link)
     {
-        if (_recv_tbl[recv_link.get()] != 0) {
+        if (_recv_tbl[recv_link.get()].num_reserved != 0) {
             throw uhd::runtime_error("Recv link already attached to I/O service");
         }
-        _recv_tbl[recv_link.get()] = 0;
+        _recv_tbl[recv_link.get()] = link_frames_t();
     }
 
     void register_link(const send_link_if::sptr& send_link)
     {
-        if (_send_tbl[send_link.get()] != 0) {
+        if (_send_tbl[send_link.get()].num_reserved != 0) {
             throw uhd::runtime_error("Send link already attached to I/O service");
         }
-        _send_tbl[send_link.get()] = 0;
+        _send_tbl[send_link.get()] = link_frames_t();
     }
 
     void unregister_link(const recv_link_if::sptr& recv_link)
@@ -57,51 +84,120 @@ public:
         _send_tbl.erase(link_ptr);
     }
 
-    void reserve_frames(const frame_reservation_t& reservation)
+    /*!
+     * Reserve frames, and fill in the frames which are guaranteed
+     *
+     * \throws uhd::runtime_error if the guaranteed frames exceed the frames
+     *         of a link which are not guaranteed to other clients yet
+     */
+    void reserve_frames(frame_reservation_t& reservation)
     {
         if (reservation.recv_link) {
-            const size_t rsvd_frames = _recv_tbl.at(reservation.recv_link.get());
-            const size_t capacity    = reservation.recv_link->get_num_recv_frames();
-            if (rsvd_frames + reservation.num_recv_frames > capacity) {
+            auto& link_frames = _recv_tbl.at(reservation.recv_link.get());
+            const size_t capacity = reservation.recv_link->get_num_recv_frames();
+            const size_t min_frames = get_min_frames(reservation.num_recv_frames);
+            if (reservation.num_recv_frames > capacity
+                || link_frames.num_reserved + min_frames > capacity) {
                 throw uhd::runtime_error(
                     "Number of frames requested exceeds link recv frame capacity");
             }
-
-            recv_link_if* link_ptr = reservation.recv_link.get();
-            _recv_tbl[link_ptr]    = rsvd_frames + reservation.num_recv_frames;
+            link_frames.num_reserved += min_frames;
+            reservation.min_recv_frames = min_frames;
         }
 
         if (reservation.send_link) {
-            const size_t rsvd_frames = _send_tbl.at(reservation.send_link.get());
-            const size_t capacity    = reservation.send_link->get_num_send_frames();
-            if (rsvd_frames + reservation.num_send_frames > capacity) {
+            auto& link_frames = _send_tbl.at(reservation.send_link.get());
+            const size_t capacity = reservation.send_link->get_num_send_frames();
+            const size_t min_frames = get_min_frames(reservation.num_send_frames);
+            if (reservation.num_send_frames > capacity
+                || link_frames.num_reserved + min_frames > capacity) {
                 throw uhd::runtime_error(
                     "Number of frames requested exceeds link send frame capacity");
             }
-
-            send_link_if* link_ptr = reservation.send_link.get();
-            _send_tbl[link_ptr]    = rsvd_frames + reservation.num_send_frames;
+            link_frames.num_reserved += min_frames;
+            reservation.min_send_frames = min_frames;
         }
     }
 
     void unreserve_frames(const frame_reservation_t& reservation)
     {
         if (reservation.recv_link) {
-            const size_t rsvd_frames = _recv_tbl.at(reservation.recv_link.get());
-            recv_link_if* link_ptr   = reservation.recv_link.get();
-            _recv_tbl[link_ptr]      = rsvd_frames - reservation.num_recv_frames;
+            _recv_tbl.at(reservation.recv_link.get()).num_reserved -=
+                reservation.min_recv_frames;
         }
 
         if (reservation.send_link) {
-            const size_t rsvd_frames = _send_tbl.at(reservation.send_link.get());
-            send_link_if* link_ptr   = reservation.send_link.get();
-            _send_tbl[link_ptr]      = rsvd_frames - reservation.num_send_frames;
+            _send_tbl.at(reservation.send_link.get()).num_reserved -=
+                reservation.min_send_frames;
         }
     }
 
+    //! Return the number of frames which are guaranteed out of \p num_frames
+    size_t get_min_frames(const size_t num_frames) const
+    {
+        // A client is always guaranteed one frame, so it can make progress
+        const auto min_frames =
+            static_cast<size_t>(std::ceil(num_frames * _min_frames_ratio));
+        return std::min(num_frames, std::max<size_t>(min_frames, 1));
+    }
+
+    /*!
+     * Borrow a recv frame from the frames of the link which are not guaranteed
+     *
+     * \return whether a frame was available
+     */
+    bool borrow_recv_frame(recv_link_if* recv_link)
+    {
+        return _borrow_frame(_recv_tbl.at(recv_link), recv_link->get_num_recv_frames());
+    }
+
+    //! Return recv frames which were borrowed with borrow_recv_frame()
+    void return_recv_frames(recv_link_if* recv_link, const size_t num_frames = 1)
+    {
+        auto& link_frames = _recv_tbl.at(recv_link);
+        assert(link_frames.num_borrowed >= num_frames);
+        link_frames.num_borrowed -= num_frames;
+    }
+
+    /*!
+     * Borrow a send frame from the frames of the link which are not guaranteed
+     *
+     * \return whether a frame was available
+     */
+    bool borrow_send_frame(send_link_if* send_link)
+    {
+        return _borrow_frame(_send_tbl.at(send_link), send_link->get_num_send_frames());
+    }
+
+    //! Return send frames which were borrowed with borrow_send_frame()
+    void return_send_frames(send_link_if* send_link, const size_t num_frames = 1)
+    {
+        auto& link_frames = _send_tbl.at(send_link);
+        assert(link_frames.num_borrowed >= num_frames);
+        link_frames.num_borrowed -= num_frames;
+    }
+
 private:
-    std::unordered_map<recv_link_if*, size_t> _recv_tbl;
-    std::unordered_map<send_link_if*, size_t> _send_tbl;
+    struct link_frames_t
+    {
+        //! The number of frames which are guaranteed to clients
+        size_t num_reserved = 0;
+        //! The number of frames which clients borrowed on top of those
+        size_t num_borrowed = 0;
+    };
+
+    static bool _borrow_frame(link_frames_t& link_frames, const size_t capacity)
+    {
+        if (link_frames.num_reserved + link_frames.num_borrowed >= capacity) {
+            return false;
+        }
+        link_frames.num_borrowed++;
+        return true;
+    }
+
+    const double _min_frames_ratio;
+    std::unordered_map<recv_link_if*, link_frames_t> _recv_tbl;
+    std::unordered_map<send_link_if*, link_frames_t> _send_tbl;
 };
 
 }} // namespace uhd::transport
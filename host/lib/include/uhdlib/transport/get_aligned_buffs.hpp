@@ -10,6 +10,7 @@
 #include <uhd/utils/log.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 
 namespace uhd { namespace transport {
 
@@ -49,6 +50,12 @@ public:
     {
     }
 
+    //! Forgets the packet times of the previous stream session
+    void reset()
+    {
+        std::fill(_prev_tsf.begin(), _prev_tsf.end(), 0);
+    }
+
     alignment_result_t operator()(const int32_t timeout_ms)
     {
         // Clear state
@@ -143,6 +143,23 @@ public:
      */
     virtual void release_recv_buff(frame_buff::uptr buff) = 0;
 
+    /*!
+     * Get a file descriptor which becomes readable when a frame is ready.
+     *
+     * The descriptor is only cleared when get_recv_buff() finds no frame, so
+     * callers must take frames until that happens before they wait on it
+     * again. It may be readable when no frame is ready.
+     *
+     * Only I/O services which queue frames for their clients can signal them.
+     * Clients of other I/O services return -1.
+     *
+     * \return the file descriptor, or -1 if there is none
+     */
+    virtual int get_ready_fd()
+    {
+        return -1;
+    }
+
     /*!
      * Get number of send frames reserved by this I/O interface.
      *
@@ -0,0 +1,66 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Receives datagrams from a socket through an io_uring
+ *
+ * A single multishot receive request stays armed on the socket, and the kernel
+ * receives into a ring of frames provided by the caller. As long as packets
+ * keep arriving, receiving them takes no system calls at all: completions are
+ * read from shared memory, and a frame is handed back to the kernel by writing
+ * to the buffer ring. Only re-arming the request (when the kernel ran out of
+ * frames) and waiting for packets need a system call.
+ *
+ * Because there is only one receive request, packets are delivered in the
+ * order in which the socket received them.
+ *
+ * There is no locking, so recv() may only be called from one thread at a time.
+ * This is the same requirement as for recv_link_if::get_recv_buff().
+ */
+class io_uring_recv
+{
+public:
+    using uptr = std::unique_ptr<io_uring_recv>;
+
+    virtual ~io_uring_recv() = default;
+
+    /*! Receive a datagram, exchanging frame memory with the ring
+     *
+     * \param mem On input, a frame of at least the frame size that the caller
+     *            gives to the ring. If a datagram was received, this is set to
+     *            the frame holding it, which is then owned by the caller.
+     *            On timeout, it is left unchanged.
+     * \param timeout_ms Time to wait for a datagram. Zero means don't wait.
+     * \return the length of the datagram, or zero on timeout
+     * \throws uhd::io_error on receive errors
+     */
+    virtual size_t recv(void*& mem, int32_t timeout_ms) = 0;
+
+    /*! Create an io_uring receiver for \p sock_fd
+     *
+     * \param sock_fd The socket to receive from. It must outlive the receiver.
+     * \param frames Memory the kernel receives into. The number of frames must
+     *               be a power of two. The receiver owns this memory until it
+     *               is destroyed, or until it is handed out by recv().
+     * \param frame_size The size of every frame in \p frames
+     * \return the receiver, or nullptr if io_uring or multishot receives are
+     *         not supported (e.g., on kernels older than 6.0, or where io_uring
+     *         was disabled)
+     */
+    static uptr make(int sock_fd, const std::vector<void*>& frames, size_t frame_size);
+};
+
+}} // namespace uhd::transport
@@ -34,6 +34,17 @@ struct link_params_t
     size_t num_send_frames = 0;
     size_t recv_buff_size  = 0;
     size_t send_buff_size  = 0;
+    //! Max. number of frames to fetch per receive call, on links that support
+    // batched receives (others ignore this value)
+    size_t recv_batch_size = 1;
+    //! NUMA node for the frame buffers. If negative, links that support it use
+    // the node of the NIC they are bound to.
+    int numa_node = -1;
+    //! Back the frame buffers with hugepages, on links that support it
+    bool use_hugepages = false;
+    //! Receive through an io_uring, on links that support it. recv_batch_size
+    // then sets the number of frames the kernel can fill ahead of the caller.
+    bool use_io_uring = false;
 };
 
 
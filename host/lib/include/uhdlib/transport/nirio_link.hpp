@@ -15,6 +15,7 @@
 #include <uhdlib/transport/adapter_info.hpp>
 #include <uhdlib/transport/link_base.hpp>
 #include <uhdlib/transport/links.hpp>
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -63,6 +64,11 @@ private:
 };
 
 /*! Link object to talking to NI-RIO USRPs (X310 variants using PCIe)
+ *
+ * With a recv_batch_size of N > 1, the link acquires up to N frames from the
+ * RX DMA FIFO at once, and hands them out one by one without calling into the
+ * FIFO again. It also holds back released frames, and grants them back to the
+ * DMA engine N at a time, which saves a call into the kernel for every frame.
  *
  * \b Note: This link cannot release frame buffers out of order, which means it
  *          can't be used with an IO service that does that.
@@ -149,30 +155,51 @@ private:
     UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
     {
         using namespace uhd::niusrprio;
-        nirio_status status    = 0;
-        size_t elems_acquired  = 0;
-        size_t elems_remaining = 0;
-        // This will modify the data pointer in buff if successful:
-        fifo_data_t** data_ptr = static_cast<nirio_frame_buff&>(buff).get_fifo_ptr_ref();
-        nirio_status_chain(_recv_fifo->acquire(*data_ptr,
-                               _link_params.recv_frame_size / sizeof(fifo_data_t),
-                               static_cast<uint32_t>(timeout_ms),
-                               elems_acquired,
-                               elems_remaining),
-            status);
-        const size_t length = elems_acquired * sizeof(fifo_data_t);
-
-        if (nirio_status_not_fatal(status)) {
-            return length;
-        } else if (status == NiRio_Status_CommunicationTimeout) {
-            nirio_status_to_exception(status, "NI-RIO PCIe data transfer failed.");
+        const size_t frame_elems = _link_params.recv_frame_size / sizeof(fifo_data_t);
+        if (_recv_batch_frames == 0) {
+            nirio_status status    = 0;
+            size_t elems_acquired  = 0;
+            size_t elems_remaining = 0;
+            // Only ask for as many frames as the last call said were available
+            // (and at least one), so that we don't wait for a full batch
+            const size_t num_frames =
+                std::min(_recv_batch_size, std::max<size_t>(_recv_frames_available, 1));
+            nirio_status_chain(_recv_fifo->acquire(_recv_batch_ptr,
+                                   num_frames * frame_elems,
+                                   static_cast<uint32_t>(timeout_ms),
+                                   elems_acquired,
+                                   elems_remaining),
+                status);
+
+            if (!nirio_status_not_fatal(status)) {
+                if (status == NiRio_Status_CommunicationTimeout) {
+                    nirio_status_to_exception(
+                        status, "NI-RIO PCIe data transfer failed.");
+                }
+                return 0; // zero for error
+            }
+            _recv_batch_frames     = elems_acquired / frame_elems;
+            _recv_frames_available = elems_remaining / frame_elems;
+            if (_recv_batch_frames == 0) {
+                return 0; // zero for timeout
+            }
         }
-        return 0; // zero for timeout or error.
+
+        // This will modify the data pointer in buff:
+        *static_cast<nirio_frame_buff&>(buff).get_fifo_ptr_ref() = _recv_batch_ptr;
+        _recv_batch_ptr += frame_elems;
+        _recv_batch_frames--;
+        return frame_elems * sizeof(fifo_data_t);
     }
 
     UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& /*buff*/)
     {
-        _recv_fifo->release(_link_params.recv_frame_size / sizeof(fifo_data_t));
+        // Frames are released in order, so we can grant them back in bulk
+        _recv_elems_to_release += _link_params.recv_frame_size / sizeof(fifo_data_t);
+        if (_recv_elems_to_release >= _recv_release_threshold) {
+            _recv_fifo->release(_recv_elems_to_release);
+            _recv_elems_to_release = 0;
+        }
     }
 
     // Methods called by send_link_base
@@ -217,6 +244,19 @@ private:
 
     const link_params_t _link_params;
 
+    //! Max. number of RX frames to acquire at once, and to grant back at once
+    const size_t _recv_batch_size;
+    //! Number of elements after which released RX frames are granted back
+    const size_t _recv_release_threshold;
+    //! Next frame of the current batch of acquired RX frames
+    fifo_data_t* _recv_batch_ptr = nullptr;
+    //! Number of frames of the current batch which weren't handed out yet
+    size_t _recv_batch_frames = 0;
+    //! Number of RX frames the DMA FIFO had available on the last acquire
+    size_t _recv_frames_available = 0;
+    //! Number of elements released, but not granted back yet
+    size_t _recv_elems_to_release = 0;
+
     std::vector<nirio_frame_buff> _recv_buffs;
     std::vector<nirio_frame_buff> _send_buffs;
 
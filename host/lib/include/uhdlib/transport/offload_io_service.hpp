@@ -7,6 +7,9 @@
 #pragma once
 
 #include <uhdlib/transport/io_service.hpp>
+#include <uhdlib/transport/offload_thread_pool.hpp>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -23,7 +26,15 @@ class offload_io_service : public io_service
 public:
     enum client_type_t { RECV_ONLY, SEND_ONLY, BOTH_SEND_AND_RECV };
 
-    enum wait_mode_t { POLL, BLOCK };
+    /*!
+     * How the offload thread waits for packets and buffers
+     *
+     * POLL never waits and keeps a core busy. BLOCK waits on the links and
+     * queues, which adds the wakeup latency. HYBRID polls for as long as
+     * there is work, and for spin_time_us after that, and then waits like
+     * BLOCK until there is work again.
+     */
+    enum wait_mode_t { POLL, BLOCK, HYBRID };
 
     /*!
      * Options for configuring offload I/O service
@@ -35,8 +46,24 @@ public:
         //! The types of client that the I/O service needs to support.
         client_type_t client_type = BOTH_SEND_AND_RECV;
         //! The thread behavior when waiting for incoming packets If set to
-        //! BLOCK, the client type must be set to either RECV_ONLY or SEND_ONLY.
+        //! BLOCK or HYBRID, the client type must be set to either RECV_ONLY or
+        //! SEND_ONLY.
         wait_mode_t wait_mode = POLL;
+        //! If set, the I/O service is polled by the threads of this pool
+        //! instead of a thread of its own, and cpu_affinity_list is ignored.
+        //! The wait mode must be POLL.
+        offload_thread_pool::sptr thread_pool;
+        //! Name of the I/O service in the statistics of thread_pool
+        std::string name;
+        //! With the HYBRID wait mode, the time in microseconds to keep polling
+        //! after the last packet before blocking. Clients waiting for buffers
+        //! also poll for this long before they block.
+        uint32_t spin_time_us = 100;
+        //! The share of the frames of a client which is guaranteed to it, in
+        //! (0.0, 1.0]. The frames of a link which aren't guaranteed to any
+        //! client are lent to clients which need more than their guaranteed
+        //! frames. With 1.0, all frames of a client are guaranteed.
+        double min_frames_ratio = 1.0;
     };
 
     /*!
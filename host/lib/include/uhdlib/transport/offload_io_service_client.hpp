@@ -97,6 +97,11 @@ public:
         _num_frames_in_use--;
     }
 
+    int get_ready_fd()
+    {
+        return _port->client_get_ready_fd();
+    }
+
 private:
     offload_recv_io()                       = delete;
     offload_recv_io(const offload_recv_io&) = delete;
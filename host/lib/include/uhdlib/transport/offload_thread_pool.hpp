@@ -0,0 +1,112 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Pool of polling threads which balance their tasks among themselves
+ *
+ * A task is polled over and over again by one of the threads, e.g., to run one
+ * iteration of the main loop of an offload_io_service. New tasks go to the
+ * thread with the fewest tasks. To even out the load when tasks turn out to be
+ * busier than others, a thread which is mostly idle takes over (steals) a task
+ * from a thread which is busy nearly all the time.
+ *
+ * The load of a thread is the fraction of its polls in which at least one of
+ * its tasks did some work. It is measured over windows of a few milliseconds.
+ *
+ * A task is never polled by two threads at the same time, and everything a
+ * task did in one thread is visible to it when it is next polled by another
+ * thread. Tasks must not rely on running on a particular thread, though.
+ */
+class offload_thread_pool
+{
+public:
+    using sptr = std::shared_ptr<offload_thread_pool>;
+
+    /*! Function to poll a task
+     *
+     * \return true if the task did any work, i.e., was busy
+     */
+    using task_fn_t = std::function<bool()>;
+
+    struct task_stats_t
+    {
+        //! Name given in add_task()
+        std::string name;
+        //! Index of the thread currently polling the task
+        size_t thread;
+        //! Number of polls in which the task was busy
+        uint64_t num_busy_polls;
+        //! Number of times the task was moved to another thread
+        size_t num_migrations;
+    };
+
+    struct thread_stats_t
+    {
+        //! CPUs the thread runs on, empty if it has no affinity
+        std::vector<size_t> cpu_affinity;
+        //! Number of tasks currently polled by the thread
+        size_t num_tasks;
+        //! Percentage of busy polls in the last measurement window
+        unsigned load;
+        //! Number of times the thread polled its tasks
+        uint64_t num_polls;
+        //! Number of polls in which at least one task was busy
+        uint64_t num_busy_polls;
+        //! Number of tasks this thread took over from other threads
+        size_t num_steals;
+    };
+
+    struct stats_t
+    {
+        std::vector<thread_stats_t> threads;
+        std::vector<task_stats_t> tasks;
+    };
+
+    virtual ~offload_thread_pool() = default;
+
+    /*! Add a task to the pool
+     *
+     * The task is polled from right after this call until remove_task() is
+     * called.
+     *
+     * \param name Name of the task in the statistics
+     * \param fn Function which polls the task
+     * \return an ID for remove_task()
+     */
+    virtual size_t add_task(const std::string& name, task_fn_t fn) = 0;
+
+    /*! Remove a task from the pool
+     *
+     * When this returns, the task is no longer being polled, and it never will
+     * be again.
+     */
+    virtual void remove_task(const size_t task_id) = 0;
+
+    //! Return how the tasks are currently distributed among the threads
+    virtual stats_t get_stats() const = 0;
+
+    /*! Create a pool and start its threads
+     *
+     * \param cpu_affinity_lists The CPU affinity of every thread. The number of
+     *                           entries is the number of threads. An empty list
+     *                           means the thread may run on any CPU.
+     */
+    static sptr make(const std::vector<std::vector<size_t>>& cpu_affinity_lists);
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,164 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/types/ranges.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Software AGC for RX streamers
+ *
+ * The streamer measures the power of the sc16 samples of each packet, right
+ * before it converts them. After a number of packets, the AGC compares the
+ * strongest channel to the set point. If they differ by more than the
+ * hysteresis, it requests a new gain, which applies to all channels of the
+ * streamer.
+ *
+ * A worker thread applies the gain as a timed command, a fixed latency after
+ * the last measured packet, so the streaming thread never waits for the
+ * device. The streamer then marks the first packet at or after the command
+ * time as the first one with the new gain. Packets in between are not
+ * measured.
+ *
+ * measure() may be called from several threads, as long as each channel is
+ * measured by one thread at a time. All other calls (except set_gain_fn())
+ * are made by the streaming thread.
+ */
+class UHD_API rx_agc
+{
+public:
+    using uptr = std::unique_ptr<rx_agc>;
+
+    //! Applies a gain to all channels at a given time, and returns the coerced gain
+    using gain_fn_t =
+        std::function<double(const double gain, const uhd::time_spec_t& time)>;
+
+    struct settings_t
+    {
+        //! Power of the strongest channel to aim for, in dBFS
+        double setpoint = -20.0;
+        //! Maximum deviation from the set point which does not change the gain, in dB
+        double hysteresis = 3.0;
+        //! Largest change of the gain in one step, in dB
+        double max_step = 10.0;
+        //! Number of packets measured for every decision
+        size_t num_packets = 8;
+        //! Minimum time from the start of the last measured packet to the gain
+        //! change, in s. The change is delayed to the next packet boundary.
+        double latency = 0.01;
+    };
+
+    /*! Create an AGC from the host_agc stream arguments
+     *
+     * \return the AGC, or nullptr if the arguments don't enable it
+     * \throws uhd::value_error if the arguments are invalid
+     */
+    static uptr make(const uhd::device_addr_t& args, const size_t num_chans);
+
+    rx_agc(const settings_t& settings, const size_t num_chans);
+    ~rx_agc();
+
+    /*! Start controlling the gain
+     *
+     * Until this is called, the AGC does nothing.
+     *
+     * \param gain_fn Applies a new gain
+     * \param gain The current gain
+     * \param gain_range The range of valid gains
+     */
+    void set_gain_fn(
+        gain_fn_t gain_fn, const double gain, const uhd::meta_range_t& gain_range);
+
+    //! Add \p nsamps sc16 samples of channel \p chan to the current packet
+    UHD_FORCE_INLINE void measure(
+        const size_t chan, const void* samps, const size_t nsamps)
+    {
+        if (_state != state_t::MEASURING) {
+            return;
+        }
+        const int16_t* iq = static_cast<const int16_t*>(samps);
+        int64_t sum       = 0;
+        for (size_t i = 0; i < 2 * nsamps; i++) {
+            sum += int32_t(iq[i]) * iq[i];
+        }
+        _chans[chan].sum += sum;
+        _chans[chan].nsamps += nsamps;
+    }
+
+    /*! Check a new packet for the gain change
+     *
+     * If the packet is the first one with a new gain, this sets
+     * has_gain_change and gain in \p metadata.
+     *
+     * \param metadata The metadata of the packet
+     * \param nsamps The number of samples in the packet
+     * \return true if the packet is the first one with a new gain
+     */
+    bool check_gain_change(uhd::rx_metadata_t& metadata, const size_t nsamps);
+
+    //! The current packet was fully measured
+    void end_packet();
+
+private:
+    enum class state_t { INACTIVE, MEASURING, REQUESTED };
+
+    struct chan_power_t
+    {
+        int64_t sum   = 0;
+        size_t nsamps = 0;
+    };
+
+    void _decide();
+    void _worker();
+
+    const settings_t _settings;
+
+    // The streaming thread's view of the AGC
+    state_t _state = state_t::INACTIVE;
+    std::vector<chan_power_t> _chans;
+    size_t _num_packets   = 0;
+    bool _has_packet_time = false;
+    uhd::time_spec_t _packet_time;
+    // Packet size and sample rate, if the packet time is in integer form
+    size_t _packet_nsamps    = 0;
+    double _packet_samp_rate = 0.0;
+    bool _warned_no_time     = false;
+    double _gain             = 0.0;
+    uhd::meta_range_t _gain_range;
+
+    // State shared with the worker thread, and with set_gain_fn()
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    gain_fn_t _gain_fn;
+    double _shared_gain = 0.0;
+    uhd::meta_range_t _shared_gain_range;
+    std::atomic<bool> _activated{false};
+    bool _request_pending = false;
+    double _request_gain  = 0.0;
+    uhd::time_spec_t _request_time;
+    // Set by the worker thread once the requested gain was applied (or failed)
+    std::atomic<bool> _done{false};
+    bool _done_ok     = false;
+    double _done_gain = 0.0;
+    bool _stop        = false;
+    std::thread _worker_thread;
+};
+
+}} // namespace uhd::transport
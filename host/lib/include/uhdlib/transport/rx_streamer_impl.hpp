@@ -9,18 +9,37 @@
 #include <uhd/config.hpp>
 #include <uhd/convert.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_fft.hpp>
+#include <uhd/rfnoc/host_moving_average.hpp>
+#include <uhd/rfnoc/host_resampler.hpp>
+#include <uhd/rfnoc/host_vector_iir.hpp>
 #include <uhd/stream.hpp>
 #include <uhd/types/endianness.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/transport/rx_agc.hpp>
 #include <uhdlib/transport/rx_streamer_zero_copy.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <uhdlib/utils/args_view.hpp>
+#include <uhdlib/utils/fast_log.hpp>
+#include <uhdlib/utils/thread_placement.hpp>
+#include <uhdlib/utils/trace_points.hpp>
+#include <uhdlib/utils/worker_pool.hpp>
 #include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <functional>
 #include <limits>
+#include <map>
 #include <vector>
 
 namespace uhd { namespace transport {
 
 namespace detail {
 
+//! Number of samples the keep-one-in-N gather buffers hold
+constexpr size_t KEPT_SAMPS_CHUNK_SIZE = 256;
+
 /*!
  * Cache of metadata for error handling
  *
@@ -68,13 +87,17 @@ private:
 
 /*!
  * Implementation of rx streamer API
+ *
+ * Once streaming, recv() does not allocate any memory: Everything it needs per
+ * call is a member which was sized when the channels were connected. Keep it
+ * that way, tests/rx_streamer_test.cpp checks it.
  */
 template <typename transport_t, bool ignore_seq_err = false>
 class rx_streamer_impl : public rx_streamer
 {
 public:
     //! Constructor
-    rx_streamer_impl(const size_t num_ports, const uhd::stream_args_t stream_args)
+    rx_streamer_impl(const size_t num_ports, const uhd::stream_args_t& stream_args)
         : _zero_copy_streamer(num_ports)
         , _in_buffs(num_ports)
         , _chans_connected(num_ports, false)
@@ -85,13 +108,35 @@ public:
         if (stream_args.otw_format.empty()) {
             throw uhd::value_error("[rx_stream] Must provide a otw_format!");
         }
-        _setup_converters(num_ports, stream_args);
+        // Parse the args once for all of the setup below
+        const uhd::args_view args(stream_args.args);
+        _setup_converters(num_ports, stream_args, args);
         _zero_copy_streamer.set_samp_rate(_samp_rate);
         _zero_copy_streamer.set_bytes_per_item(_convert_info.bytes_per_otw_item);
 
-        if (stream_args.args.has_key("spp")) {
-            _spp = stream_args.args.cast<size_t>("spp", _spp);
+        _spp = args.cast<size_t>("spp", _spp);
+        _zero_copy_streamer.set_lazy_time_spec(args.cast<bool>("lazy_time_spec", false));
+        _zero_copy_streamer.set_cycle_accounting(&_cycles);
+
+        _setup_convert_pool(num_ports, stream_args, args);
+        _setup_host_ffts(num_ports, stream_args, args);
+        _setup_host_averages(num_ports, stream_args, args);
+        _setup_keep_one_in_n(num_ports, stream_args, args);
+        _setup_resamplers(num_ports, stream_args, args);
+        if (_interleaved && (_has_host_stages() || _keep_one_in_n > 1)) {
+            throw uhd::value_error("[rx_stream] The interleaved channel layout does not "
+                                   "support host processing or keep-one-in-N!");
+        }
+        _agc = rx_agc::make(stream_args.args, num_ports);
+        if (_agc && stream_args.otw_format != "sc16") {
+            throw uhd::value_error("[rx_stream] The host AGC requires the sc16 "
+                                   "over-the-wire format!");
         }
+        if (_agc && !_resamplers.empty()) {
+            throw uhd::value_error(
+                "[rx_stream] The host resampler does not support the host AGC!");
+        }
+        _setup_gap_fill(args);
     }
 
     //! Connect a new channel to the streamer
@@ -140,10 +185,19 @@ public:
         const double timeout,
         const bool one_packet) override
     {
+        UHD_CYCLE_ACCOUNT(&_cycles, CALL);
         if (!_all_chans_connected) {
             throw uhd::runtime_error("[rx_stream] Attempting to call recv() before all "
                                      "channels are connected!");
         }
+        if (_recv_buffs_borrowed) {
+            throw uhd::runtime_error(
+                "[rx_stream] Attempting to call recv() before release_recv_buffs()!");
+        }
+        if (!_host_ffts.empty() && nsamps_per_buff % _host_ffts[0]->get_length() != 0) {
+            throw uhd::value_error("[rx_stream] recv() requires a multiple of the host "
+                                   "FFT length of samples!");
+        }
 
         if (_error_metadata_cache.check(metadata)) {
             return 0;
@@ -177,7 +231,21 @@ public:
                 loop_metadata,
                 eov_positions,
                 timeout_ms,
-                total_samps_recv * _convert_info.bytes_per_cpu_item);
+                total_samps_recv * _convert_info.bytes_per_cpu_samp);
+
+            // A packet with a new gain starts the buffer of the next call
+            if (_agc_held_packet) {
+                _agc_held_packet = false;
+                break;
+            }
+            // So does a second gap, while the first one goes into this buffer
+            if (_gap_held_packet) {
+                _gap_held_packet = false;
+                if (metadata.has_gap) {
+                    break;
+                }
+                continue;
+            }
 
             // If metadata had an error code set, store for next call and return
             if (loop_metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
@@ -185,6 +253,12 @@ public:
                 break;
             }
 
+            if (loop_metadata.has_gap) {
+                metadata.has_gap    = true;
+                metadata.gap_offset = total_samps_recv;
+                metadata.gap_length = loop_metadata.gap_length;
+            }
+
             total_samps_recv += num_samps;
 
             // Return immediately if end of burst
@@ -201,11 +275,213 @@ public:
         return total_samps_recv;
     }
 
+    //! Implementation of rx_streamer API method
+    size_t recv_many(
+        std::vector<uhd::rx_streamer::recv_slot_t>& slots, const double timeout) override
+    {
+        if (slots.empty()) {
+            return 0;
+        }
+        // The first slot does the checks of recv(), and waits for a packet
+        auto& first_slot     = slots.front();
+        first_slot.num_samps = recv(first_slot.buffs,
+            first_slot.nsamps_per_buff,
+            first_slot.metadata,
+            timeout,
+            true);
+
+        size_t num_slots = 1;
+        for (; num_slots < slots.size(); num_slots++) {
+            const auto& last_metadata = slots[num_slots - 1].metadata;
+            if (last_metadata.error_code != rx_metadata_t::ERROR_CODE_NONE
+                || last_metadata.end_of_burst) {
+                break;
+            }
+            auto& slot = slots[num_slots];
+            if (!_host_ffts.empty()
+                && slot.nsamps_per_buff % _host_ffts[0]->get_length() != 0) {
+                throw uhd::value_error("[rx_stream] recv_many() requires a multiple of "
+                                       "the host FFT length of samples per slot!");
+            }
+            detail::eov_data_wrapper eov_positions(slot.metadata);
+            slot.num_samps = _recv_one_packet(slot.buffs,
+                slot.nsamps_per_buff,
+                slot.metadata,
+                eov_positions,
+                rx_streamer_zero_copy<transport_t>::NO_WAIT_TIMEOUT_MS);
+            // Like in recv(), an error after the first packet is returned by
+            // the next call. Timeouts mean that no more packets arrived.
+            if (slot.metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
+                _error_metadata_cache.store(slot.metadata);
+                break;
+            }
+        }
+        return num_slots;
+    }
+
+    //! Implementation of rx_streamer API method
+    size_t get_recv_buffs(uhd::rx_streamer::recv_buffs_type& buffs,
+        uhd::rx_metadata_t& metadata,
+        const double timeout) override
+    {
+        if (!_all_chans_connected) {
+            throw uhd::runtime_error("[rx_stream] Attempting to call get_recv_buffs() "
+                                     "before all channels are connected!");
+        }
+        if (!_convert_info.is_copy || _has_host_stages() || _keep_one_in_n > 1 || _agc
+            || _gap_fill != gap_fill_t::NONE) {
+            throw uhd::runtime_error("[rx_stream] get_recv_buffs() requires the CPU "
+                                     "format to match the over-the-wire format, and "
+                                     "no host processing, keep-one-in-N, host AGC or "
+                                     "gap fill!");
+        }
+        if (_recv_buffs_borrowed) {
+            throw uhd::runtime_error("[rx_stream] Attempting to call get_recv_buffs() "
+                                     "before release_recv_buffs()!");
+        }
+
+        if (_error_metadata_cache.check(metadata)) {
+            return 0;
+        }
+
+        if (_buff_samps_remaining == 0) {
+            detail::eov_data_wrapper eov_positions(metadata);
+            _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(_in_buffs,
+                metadata,
+                eov_positions,
+                static_cast<int32_t>(timeout * 1000));
+            _fragment_offset_in_samps = 0;
+            if (_buff_samps_remaining == 0) {
+                return 0;
+            }
+        } else {
+            // Hand out the part of the packet recv() did not read
+            metadata = _last_fragment_metadata;
+            _zero_copy_streamer.advance_time(
+                metadata, _fragment_offset_in_samps - metadata.fragment_offset);
+        }
+
+        metadata.more_fragments  = false;
+        metadata.fragment_offset = _fragment_offset_in_samps;
+        buffs                    = _in_buffs;
+        _recv_buffs_borrowed     = true;
+        return _buff_samps_remaining;
+    }
+
+    //! Implementation of rx_streamer API method
+    void release_recv_buffs() override
+    {
+        if (!_recv_buffs_borrowed) {
+            return;
+        }
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            _zero_copy_streamer.release_recv_buff(i);
+        }
+        _buff_samps_remaining = 0;
+        _recv_buffs_borrowed  = false;
+    }
+
+    /*!
+     * Prepares the streamer for a new stream session
+     *
+     * Drops all samples which were received but not read, including the rest
+     * of a packet which recv() did not read completely, and errors cached for
+     * the next recv() call. The sequence number checks of the transports
+     * restart with the next packet.
+     */
+    void reset_stream_state()
+    {
+        release_recv_buffs();
+        _buff_samps_remaining     = 0;
+        _fragment_offset_in_samps = 0;
+        _agc_held_packet          = false;
+        _keep_phase               = 0;
+        _gap_time_valid           = false;
+        _gap_zeros_remaining      = 0;
+        _gap_held_packet          = false;
+        _error_metadata_cache     = detail::rx_metadata_cache();
+        _reset_resamplers();
+        _zero_copy_streamer.reset_stream_state();
+    }
+
+    //! Implementation of rx_streamer API method
+    stream_telemetry_t get_telemetry() const override
+    {
+        stream_telemetry_t telemetry;
+        _zero_copy_streamer.get_telemetry(telemetry);
+        telemetry.convert_ns = _convert_ns.get();
+        _cycles.get_telemetry(telemetry);
+        return telemetry;
+    }
+
+    /*! Let the host AGC control the gain
+     *
+     * \param gain_fn Applies a gain to all channels of the streamer as a timed
+     *                command, and returns the coerced gain
+     * \param gain The current gain
+     * \param gain_range The range of valid gains
+     * \throws uhd::runtime_error if the host_agc stream argument was not given
+     */
+    void set_agc_gain_fn(rx_agc::gain_fn_t gain_fn,
+        const double gain,
+        const uhd::meta_range_t& gain_range)
+    {
+        if (!_agc) {
+            throw uhd::runtime_error("[rx_stream] The host AGC is not enabled!");
+        }
+        _agc->set_gain_fn(std::move(gain_fn), gain, gain_range);
+    }
+
 protected:
+    //! Returns the accounting of the cycles of recv(), for the transports
+    cycle_accounting* get_cycle_accounting()
+    {
+        return &_cycles;
+    }
+
+    //! Adds the flow control state and the buffering of the transports to \p telemetry
+    //
+    // Only available if the transports provide get_fc_outstanding(),
+    // get_fc_capacity() and get_num_frames().
+    void get_fc_telemetry(stream_telemetry_t& telemetry) const
+    {
+        if (_all_chans_connected) {
+            _zero_copy_streamer.get_fc_telemetry(telemetry);
+        }
+    }
+
+    //! Adds the frames of the links and the buffers of this streamer to \p memory
+    //
+    // Only available if the transports provide get_link_memory().
+    void get_streamer_memory(stream_memory_t& memory) const
+    {
+        if (_all_chans_connected) {
+            _zero_copy_streamer.get_link_memory(memory);
+        }
+        for (const auto& buff : _kept_samps) {
+            memory.streamer_bytes += buff.capacity();
+        }
+        for (size_t i = 0; i < _resamplers.size(); i++) {
+            memory.streamer_bytes +=
+                (_resamp_in[i].capacity() + _resamp_out[i].capacity())
+                * sizeof(std::complex<float>);
+        }
+    }
+
+    //! Returns the readiness descriptor of the transport of \p chan
+    //
+    // Returns -1 if the channel is not connected, or if its I/O service does
+    // not provide a descriptor. Only available if the transports provide
+    // get_ready_fd().
+    int get_xport_ready_fd(const size_t chan)
+    {
+        return _zero_copy_streamer.get_ready_fd(chan);
+    }
+
     //! Configures scaling factor for conversion
     void set_scale_factor(const size_t chan, const double scale_factor)
     {
-        _converters[chan]->set_scalar(scale_factor);
+        _converters[_interleaved ? 0 : chan]->set_scalar(scale_factor);
     }
 
     //! set maximum number of sample (per packet)
@@ -269,7 +545,12 @@ private:
     {
         size_t bytes_per_otw_item;
         size_t bytes_per_cpu_item;
+        // Bytes per sample in the CPU buffers, which hold the samples of all
+        // channels with the interleaved channel layout
+        size_t bytes_per_cpu_samp;
         size_t otw_item_bit_width;
+        // The converter is a plain copy, so the samples can be used in place
+        bool is_copy;
     };
 
     //! Receive a single packet
@@ -312,37 +593,136 @@ private:
             return 0;
         }
 
+        if (_gap_zeros_remaining != 0) {
+            return _write_gap_zeros(
+                buffs, nsamps_per_buff, metadata, buffer_offset_bytes);
+        }
+
+        if (!_resamplers.empty()) {
+            return _recv_resampled(buffs,
+                nsamps_per_buff,
+                metadata,
+                eov_positions,
+                timeout_ms,
+                buffer_offset_bytes);
+        }
+
         if (_buff_samps_remaining == 0) {
             // Current set of buffers has expired, get the next one
+            UHD_TRACE_POINT(rx_get_buffs_start, this, timeout_ms);
             _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(
                 _in_buffs, metadata, eov_positions, timeout_ms);
+            UHD_TRACE_POINT(rx_get_buffs_done,
+                this,
+                _buff_samps_remaining,
+                static_cast<int>(metadata.error_code));
             _fragment_offset_in_samps = 0;
+            if (_keep_one_in_n > 1) {
+                _drop_packets(metadata, eov_positions, timeout_ms);
+            }
+            if (_gap_fill != gap_fill_t::NONE) {
+                _skip_overflows(metadata, eov_positions, timeout_ms);
+                if (_buff_samps_remaining != 0 && _find_gap(metadata)) {
+                    if (buffer_offset_bytes != 0) {
+                        // Let recv() decide whether the gap goes into its buffer
+                        _gap_held_packet = true;
+                        return 0;
+                    }
+                    if (_gap_zeros_remaining != 0) {
+                        return _write_gap_zeros(
+                            buffs, nsamps_per_buff, metadata, buffer_offset_bytes);
+                    }
+                }
+            }
+            if (_agc && _buff_samps_remaining != 0
+                && _agc->check_gain_change(metadata, _buff_samps_remaining)
+                && buffer_offset_bytes != 0) {
+                // Hand the packet to the next recv() call, so that the new gain
+                // applies from the first sample of its buffer
+                _last_fragment_metadata = metadata;
+                _agc_held_packet        = true;
+                return 0;
+            }
         } else {
             // There are samples still left in the current set of buffers
             metadata = _last_fragment_metadata;
-            metadata.time_spec += time_spec_t::from_ticks(
-                _fragment_offset_in_samps - metadata.fragment_offset, _samp_rate);
+            _zero_copy_streamer.advance_time(
+                metadata, _fragment_offset_in_samps - metadata.fragment_offset);
         }
 
         if (_buff_samps_remaining != 0) {
-            const size_t num_samps = std::min(nsamps_per_buff, _buff_samps_remaining);
+            // The number of samples to write, the number of samples before the
+            // first one which are dropped, and the number of samples consumed
+            size_t num_samps = std::min(nsamps_per_buff, _buff_samps_remaining);
+            size_t skip      = 0;
+            size_t num_in    = num_samps;
+            if (_keep_one_in_n > 1 && !_keep_packets) {
+                // Only a packet with an end-of-burst flag may have no kept
+                // sample left (see _drop_packets())
+                skip = std::min(_keep_phase, _buff_samps_remaining);
+                const size_t num_kept =
+                    (_buff_samps_remaining - skip + _keep_one_in_n - 1) / _keep_one_in_n;
+                num_samps = std::min(nsamps_per_buff, num_kept);
+
+                // Consume the dropped samples at the end of the packet, too
+                num_in      = num_samps == num_kept
+                                  ? _buff_samps_remaining
+                                  : skip + (num_samps - 1) * _keep_one_in_n + 1;
+                _keep_phase = _keep_phase + num_samps * _keep_one_in_n - num_in;
+            }
 
             // Convert samples to the streamer's output format
-            for (size_t i = 0; i < get_num_channels(); i++) {
-                char* b = reinterpret_cast<char*>(buffs[i]);
-                const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
-                _convert_to_out_buff(out_buffs, i, num_samps);
+            {
+                telemetry_timer timer(_convert_ns);
+                UHD_CYCLE_ACCOUNT(&_cycles, CONVERT);
+                if (_interleaved) {
+                    _convert_interleaved(buffs, buffer_offset_bytes, num_samps);
+                } else if (_convert_pool) {
+                    _convert_in_parallel(
+                        buffs, buffer_offset_bytes, num_samps, skip, num_in);
+                } else {
+                    for (size_t i = 0; i < get_num_channels(); i++) {
+                        char* b = reinterpret_cast<char*>(buffs[i]);
+                        const uhd::rx_streamer::buffs_type out_buffs(
+                            b + buffer_offset_bytes);
+                        _convert_to_out_buff(out_buffs, i, num_samps, skip, num_in);
+                    }
+                }
             }
 
-            _buff_samps_remaining -= num_samps;
+            // Release the packets once they were fully read. This is done by
+            // this thread only, since the transports are not thread-safe. It
+            // may send flow control responses, so it is not counted as
+            // conversion time.
+            if (_buff_samps_remaining == num_in) {
+                UHD_TRACE_POINT(rx_release_buffs, this, get_num_channels());
+                for (size_t i = 0; i < get_num_channels(); i++) {
+                    _zero_copy_streamer.release_recv_buff(i);
+                }
+                if (_agc) {
+                    _agc->end_packet();
+                }
+            }
+
+            _buff_samps_remaining -= num_in;
 
             // Write the fragment flags and offset
             metadata.more_fragments  = _buff_samps_remaining != 0;
             metadata.fragment_offset = _fragment_offset_in_samps;
 
             if (metadata.more_fragments) {
-                _fragment_offset_in_samps += num_samps;
+                _fragment_offset_in_samps += num_in;
                 _last_fragment_metadata = metadata;
+                // Only the first fragment starts with the new gain, or the gap
+                _last_fragment_metadata.has_gain_change = false;
+                _last_fragment_metadata.has_gap         = false;
+            } else if (metadata.end_of_burst) {
+                // Every burst starts with a kept sample (or packet)
+                _keep_phase = 0;
+            }
+            // Return the time of the first kept sample
+            if (skip != 0) {
+                _zero_copy_streamer.advance_time(metadata, skip);
             }
 
             return num_samps;
@@ -351,26 +731,624 @@ private:
         }
     }
 
-    //! Convert samples for one channel into its buffer
+    /*! Convert samples for one channel into its buffer
+     *
+     * \param num_samps The number of samples to write
+     * \param skip The number of dropped samples before the first kept one
+     * \param num_in The number of samples to consume from the packet
+     */
     UHD_FORCE_INLINE void _convert_to_out_buff(
         const uhd::rx_streamer::buffs_type& out_buffs,
         const size_t chan,
-        const size_t num_samps)
+        const size_t num_samps,
+        const size_t skip,
+        const size_t num_in)
     {
         const char* buffer_ptr = reinterpret_cast<const char*>(_in_buffs[chan]);
 
-        _converters[chan]->conv(buffer_ptr, out_buffs, num_samps);
+        UHD_TRACE_POINT(rx_convert_start, this, chan, num_samps);
+        if (_agc) {
+            _agc->measure(chan, buffer_ptr, num_in);
+        }
+        if (_kept_samps.empty()) {
+            _converters[chan]->conv(buffer_ptr, out_buffs, num_samps);
+        } else {
+            _convert_kept_samps(chan,
+                buffer_ptr + skip * _convert_info.bytes_per_otw_item,
+                static_cast<char*>(out_buffs[0]),
+                num_samps);
+        }
+        _apply_host_fft(chan, out_buffs[0], num_samps);
+        _apply_host_averages(chan, out_buffs[0], num_samps);
+        UHD_TRACE_POINT(rx_convert_done, this, chan, num_samps);
 
         // Advance the pointer for the source buffer
-        _in_buffs[chan] = buffer_ptr + num_samps * _convert_info.bytes_per_otw_item;
+        _in_buffs[chan] = buffer_ptr + num_in * _convert_info.bytes_per_otw_item;
+    }
+
+    //! Convert the samples of all channels into the first buffer, interleaving them
+    UHD_FORCE_INLINE void _convert_interleaved(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
+        const size_t num_samps)
+    {
+        char* b = reinterpret_cast<char*>(buffs[0]);
+        const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
+
+        UHD_TRACE_POINT(rx_convert_start, this, 0, num_samps);
+        if (_agc) {
+            for (size_t chan = 0; chan < _in_buffs.size(); chan++) {
+                _agc->measure(chan, _in_buffs[chan], num_samps);
+            }
+        }
+        _converters[0]->conv(_in_buffs, out_buffs, num_samps);
+        UHD_TRACE_POINT(rx_convert_done, this, 0, num_samps);
+
+        for (auto& in_buff : _in_buffs) {
+            in_buff = reinterpret_cast<const char*>(in_buff)
+                      + num_samps * _convert_info.bytes_per_otw_item;
+        }
+    }
+
+    //! Convert every _keep_one_in_n-th sample, starting with the one at \p in
+    void _convert_kept_samps(
+        const size_t chan, const char* in, char* out, size_t num_samps)
+    {
+        const size_t item_size = _convert_info.bytes_per_otw_item;
+        const size_t stride    = _keep_one_in_n * item_size;
+        char* kept             = _kept_samps[chan].data();
+        // Gather the kept samples in chunks, which then get converted in one go
+        while (num_samps != 0) {
+            const size_t num_chunk_samps =
+                std::min(num_samps, detail::KEPT_SAMPS_CHUNK_SIZE);
+            switch (item_size) {
+                case 4:
+                    _gather_items<4>(kept, in, stride, num_chunk_samps);
+                    break;
+                case 8:
+                    _gather_items<8>(kept, in, stride, num_chunk_samps);
+                    break;
+                default:
+                    for (size_t i = 0; i < num_chunk_samps; i++) {
+                        std::memcpy(kept + i * item_size, in + i * stride, item_size);
+                    }
+            }
+            const uhd::rx_streamer::buffs_type out_buffs(out);
+            _converters[chan]->conv(kept, out_buffs, num_chunk_samps);
+            in += num_chunk_samps * stride;
+            out += num_chunk_samps * _convert_info.bytes_per_cpu_item;
+            num_samps -= num_chunk_samps;
+        }
+    }
+
+    template <size_t item_size>
+    static UHD_FORCE_INLINE void _gather_items(
+        char* dst, const char* src, const size_t stride, const size_t num_items)
+    {
+        for (size_t i = 0; i < num_items; i++) {
+            std::memcpy(dst + i * item_size, src + i * stride, item_size);
+        }
+    }
 
-        if (_buff_samps_remaining == num_samps) {
-            _zero_copy_streamer.release_recv_buff(chan);
+    //! Release the packets which keep-one-in-N drops as a whole
+    //
+    // Packets with an end-of-burst flag are never dropped.
+    void _drop_packets(uhd::rx_metadata_t& metadata,
+        detail::eov_data_wrapper& eov_positions,
+        const int32_t timeout_ms)
+    {
+        while (_buff_samps_remaining != 0 && !metadata.end_of_burst
+               && (_keep_packets ? _keep_phase != 0
+                                 : _buff_samps_remaining <= _keep_phase)) {
+            _keep_phase -= _keep_packets ? 1 : _buff_samps_remaining;
+            UHD_TRACE_POINT(rx_release_buffs, this, get_num_channels());
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                _zero_copy_streamer.release_recv_buff(i);
+            }
+            UHD_TRACE_POINT(rx_get_buffs_start, this, timeout_ms);
+            _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(
+                _in_buffs, metadata, eov_positions, timeout_ms);
+            UHD_TRACE_POINT(rx_get_buffs_done,
+                this,
+                _buff_samps_remaining,
+                static_cast<int>(metadata.error_code));
+        }
+        if (_keep_packets && _buff_samps_remaining != 0) {
+            _keep_phase = _keep_one_in_n - 1;
+        }
+    }
+
+    //! Get the packets which follow overflows, which the gap fill mode reports
+    // as gaps instead
+    //
+    // If no packet follows in time, e.g., because the stream was not
+    // continuous, the overflow is returned after all.
+    void _skip_overflows(uhd::rx_metadata_t& metadata,
+        detail::eov_data_wrapper& eov_positions,
+        const int32_t timeout_ms)
+    {
+        while (_buff_samps_remaining == 0
+               && metadata.error_code == rx_metadata_t::ERROR_CODE_OVERFLOW) {
+            const uhd::rx_metadata_t overflow_metadata = metadata;
+            UHD_TRACE_POINT(rx_get_buffs_start, this, timeout_ms);
+            _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(
+                _in_buffs, metadata, eov_positions, timeout_ms);
+            UHD_TRACE_POINT(rx_get_buffs_done,
+                this,
+                _buff_samps_remaining,
+                static_cast<int>(metadata.error_code));
+            if (metadata.error_code == rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                metadata = overflow_metadata;
+            }
+        }
+    }
+
+    /*! Compare the time of a new packet to the end of the previous one
+     *
+     * If samples are missing in between, the packet is held in
+     * _last_fragment_metadata, and either the zeros which fill the gap are
+     * queued, or the gap is marked in \p metadata.
+     *
+     * \returns true if there is a gap before the packet
+     */
+    bool _find_gap(uhd::rx_metadata_t& metadata)
+    {
+        if (!metadata.has_time_spec) {
+            _gap_time_valid = false;
+            return false;
+        }
+        const time_spec_t time     = metadata.get_time_spec();
+        const time_spec_t expected = _gap_next_time;
+        const bool expected_valid  = _gap_time_valid;
+        _gap_time_valid            = !metadata.end_of_burst;
+
+        _gap_next_time =
+            time + time_spec_t::from_ticks(_buff_samps_remaining, _samp_rate);
+
+        // Time going backwards means a new stream, not a gap
+        const long long gap = expected_valid ? (time - expected).to_ticks(_samp_rate) : 0;
+        if (gap <= 0) {
+            return false;
+        }
+        if (_gap_fill == gap_fill_t::ZEROS
+            && gap <= std::llround(_gap_fill_max_time * _samp_rate)) {
+            _gap_zeros_remaining         = static_cast<size_t>(gap);
+            _gap_metadata                = metadata;
+            _gap_metadata.has_time_ticks = false;
+            _gap_metadata.time_spec      = expected;
+            _gap_metadata.end_of_burst   = false;
+        } else {
+            metadata.has_gap    = true;
+            metadata.gap_offset = 0;
+            metadata.gap_length = static_cast<size_t>(gap);
+        }
+        _last_fragment_metadata = metadata;
+        return true;
+    }
+
+    //! Write the zeros which fill a gap, before the packet which follows it
+    size_t _write_gap_zeros(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        const size_t buffer_offset_bytes)
+    {
+        const size_t num_samps = std::min(nsamps_per_buff, _gap_zeros_remaining);
+        const size_t num_bytes = num_samps * _convert_info.bytes_per_cpu_samp;
+        for (size_t i = 0; i < (_interleaved ? 1 : get_num_channels()); i++) {
+            std::memset(static_cast<char*>(buffs[i]) + buffer_offset_bytes, 0, num_bytes);
+        }
+        metadata            = _gap_metadata;
+        metadata.has_gap    = true;
+        metadata.gap_offset = 0;
+        metadata.gap_length = num_samps;
+        _gap_metadata.time_spec += time_spec_t::from_ticks(num_samps, _samp_rate);
+        _gap_zeros_remaining -= num_samps;
+        return num_samps;
+    }
+
+    //! Convert samples for all channels on the convert pool
+    void _convert_in_parallel(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
+        const size_t num_samps,
+        const size_t skip,
+        const size_t num_in)
+    {
+        _convert_job.buffs               = &buffs;
+        _convert_job.buffer_offset_bytes = buffer_offset_bytes;
+        _convert_job.num_samps           = num_samps;
+        _convert_job.skip                = skip;
+        _convert_job.num_in              = num_in;
+        _convert_pool->run(get_num_channels(), _convert_job.fn);
+    }
+
+    //! Create the worker pool for multi-threaded conversion, if requested
+    void _setup_convert_pool(const size_t num_ports,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
+    {
+        const size_t num_threads =
+            std::min(args.cast<size_t>("convert_threads", 0), num_ports - 1);
+        if (num_ports < 2 || num_threads == 0 || _interleaved) {
+            return;
+        }
+        _convert_job.fn = [this](const size_t chan) {
+            char* b = reinterpret_cast<char*>((*_convert_job.buffs)[chan]);
+            const uhd::rx_streamer::buffs_type out_buffs(
+                b + _convert_job.buffer_offset_bytes);
+            _convert_to_out_buff(out_buffs,
+                chan,
+                _convert_job.num_samps,
+                _convert_job.skip,
+                _convert_job.num_in);
+        };
+        _convert_pool.reset(new uhd::worker_pool(num_threads,
+            uhd::numa::get_convert_cpus(stream_args.args, num_threads),
+            "uhd_rx_conv"));
+        UHD_LOG_DEBUG("STREAMER",
+            "Converting " << num_ports << " RX channels on " << num_threads + 1
+                          << " threads");
+    }
+
+    //! Transform the samples which were just converted, while they are in the cache
+    UHD_FORCE_INLINE void _apply_host_fft(
+        const size_t chan, void* out_buff, const size_t num_samps)
+    {
+        if (_host_ffts.empty()) {
+            return;
+        }
+        auto* samps         = static_cast<std::complex<float>*>(out_buff);
+        const size_t length = _host_ffts[chan]->get_length();
+        _host_ffts[chan]->process(samps, samps, num_samps / length);
+        if (num_samps % length != 0) {
+            UHD_LOG_FAST_WARNING("STREAMER",
+                "Packet does not hold whole host FFT frames, passing %d samples of "
+                "channel %d through untransformed",
+                num_samps % length,
+                chan);
+        }
+    }
+
+    //! Average the samples which were just converted (and transformed, if there
+    // is a host FFT)
+    UHD_FORCE_INLINE void _apply_host_averages(
+        const size_t chan, void* out_buff, const size_t num_samps)
+    {
+        auto* samps = static_cast<std::complex<float>*>(out_buff);
+        if (!_host_vector_iirs.empty()) {
+            _host_vector_iirs[chan]->process(samps, samps, num_samps);
+        }
+        if (!_host_moving_averages.empty()) {
+            _host_moving_averages[chan]->process(samps, samps, num_samps);
+        }
+    }
+
+    //! Return true if the converted samples are processed further on the host
+    bool _has_host_stages() const
+    {
+        return !_host_ffts.empty() || !_host_vector_iirs.empty()
+               || !_host_moving_averages.empty() || !_resamplers.empty();
+    }
+
+    /*! Write the resampled samples of the packets, one packet at a time
+     *
+     * Every packet is converted and resampled as a whole, by the thread which
+     * converts its channel, and released. Its outputs are then copied to the
+     * buffers of this and the following calls. The time of an output is
+     * derived from the time of the first packet of its burst, and the number
+     * of outputs since then, so it does not accumulate rounding errors.
+     */
+    size_t _recv_resampled(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        detail::eov_data_wrapper& eov_positions,
+        const int32_t timeout_ms,
+        const size_t buffer_offset_bytes)
+    {
+        // The start of a burst may take several packets to fill the filter
+        while (_resamp_remaining == 0) {
+            UHD_TRACE_POINT(rx_get_buffs_start, this, timeout_ms);
+            const size_t num_samps = _zero_copy_streamer.get_recv_buffs(
+                _in_buffs, metadata, eov_positions, timeout_ms);
+            UHD_TRACE_POINT(rx_get_buffs_done,
+                this,
+                num_samps,
+                static_cast<int>(metadata.error_code));
+            if (num_samps == 0) {
+                // Samples are missing after an error, so the next packet
+                // starts a new stream for the filters
+                if (metadata.error_code != rx_metadata_t::ERROR_CODE_NONE
+                    && metadata.error_code != rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                    _reset_resamplers();
+                }
+                return 0;
+            }
+            // All outputs of the previous packet were read
+            _resamp_num_out += _resamp_offset;
+            _resamp_offset = 0;
+            if (!_resamp_in_burst) {
+                _resamp_has_time   = metadata.has_time_spec;
+                _resamp_start_time = metadata.get_time_spec();
+                _resamp_num_out    = 0;
+                _resamp_in_burst   = true;
+            }
+
+            {
+                telemetry_timer timer(_convert_ns);
+                UHD_CYCLE_ACCOUNT(&_cycles, CONVERT);
+                _resample_job.num_samps = num_samps;
+                _resample_job.eob       = metadata.end_of_burst;
+                if (_convert_pool) {
+                    _convert_pool->run(get_num_channels(), _resample_job.fn);
+                } else {
+                    for (size_t i = 0; i < get_num_channels(); i++) {
+                        _resample_job.fn(i);
+                    }
+                }
+            }
+            UHD_TRACE_POINT(rx_release_buffs, this, get_num_channels());
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                _zero_copy_streamer.release_recv_buff(i);
+            }
+
+            // All channels have the same number of samples, and so outputs
+            _resamp_remaining = _resamp_num_chan_out;
+            _resamp_metadata  = metadata;
+            if (metadata.end_of_burst) {
+                _resamp_in_burst = false;
+            }
+        }
+
+        const size_t num_samps = std::min(nsamps_per_buff, _resamp_remaining);
+        for (size_t i = 0; i < get_num_channels(); i++) {
+            std::memcpy(static_cast<char*>(buffs[i]) + buffer_offset_bytes,
+                _resamp_out[i].data() + _resamp_offset,
+                num_samps * sizeof(std::complex<float>));
+        }
+
+        metadata                 = _resamp_metadata;
+        metadata.has_time_spec   = _resamp_has_time;
+        metadata.has_time_ticks  = false;
+        metadata.time_spec       = _get_resampled_time(_resamp_num_out + _resamp_offset);
+        metadata.fragment_offset = _resamp_offset;
+        _resamp_remaining -= num_samps;
+        _resamp_offset += num_samps;
+        metadata.more_fragments = _resamp_remaining != 0;
+        metadata.end_of_burst =
+            _resamp_metadata.end_of_burst && !metadata.more_fragments;
+        return num_samps;
+    }
+
+    //! Return the time of output \p num_out of the current burst
+    time_spec_t _get_resampled_time(const uint64_t num_out) const
+    {
+        // Output k is at input sample k * decim / interp, in whole samples
+        // and in fractions of a sample
+        const uint64_t interp   = _resamplers[0]->get_interp();
+        const uint64_t in_samps = num_out * _resamplers[0]->get_decim();
+        return _resamp_start_time
+               + time_spec_t::from_ticks(
+                   static_cast<long long>(in_samps / interp), _samp_rate)
+               + time_spec_t::from_ticks(
+                   static_cast<long long>(in_samps % interp), _samp_rate * interp);
+    }
+
+    //! Convert and resample the packet of one channel
+    void _resample_chan(const size_t chan, const size_t num_samps, const bool eob)
+    {
+        auto& in                 = _resamp_in[chan];
+        auto& out                = _resamp_out[chan];
+        const size_t max_outputs = _resamplers[chan]->get_max_num_outputs(num_samps);
+        // Only the first packets of a stream grow the buffers
+        if (in.size() < num_samps) {
+            in.resize(num_samps);
+        }
+        if (out.size() < max_outputs) {
+            out.resize(max_outputs);
+        }
+        const uhd::rx_streamer::buffs_type in_buffs(in.data());
+        _convert_to_out_buff(in_buffs, chan, num_samps, 0, num_samps);
+        size_t num_out = _resamplers[chan]->process(in.data(), num_samps, out.data());
+        if (eob) {
+            num_out += _resamplers[chan]->flush(out.data() + num_out);
+        }
+        if (chan == 0) {
+            _resamp_num_chan_out = num_out;
+        }
+    }
+
+    //! Start a new stream for the resamplers, dropping the outputs not read yet
+    void _reset_resamplers()
+    {
+        for (auto& resampler : _resamplers) {
+            resampler->reset();
+        }
+        _resamp_in_burst  = false;
+        _resamp_remaining = 0;
+        _resamp_offset    = 0;
+    }
+
+    //! Create the host FFTs, if requested
+    void _setup_host_ffts(const size_t num_ports,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
+    {
+        if (!args.has_key("host_fft_length")) {
+            return;
+        }
+        if (stream_args.cpu_format != "fc32") {
+            throw uhd::value_error("[rx_stream] The host FFT requires the fc32 CPU "
+                                   "format!");
+        }
+        const std::map<std::string, uhd::rfnoc::fft_magnitude> magnitudes{
+            {"complex", uhd::rfnoc::fft_magnitude::COMPLEX},
+            {"magnitude", uhd::rfnoc::fft_magnitude::MAGNITUDE},
+            {"magnitude_squared", uhd::rfnoc::fft_magnitude::MAGNITUDE_SQUARED}};
+        const std::map<std::string, uhd::rfnoc::fft_shift> shifts{
+            {"normal", uhd::rfnoc::fft_shift::NORMAL},
+            {"reverse", uhd::rfnoc::fft_shift::REVERSE},
+            {"natural", uhd::rfnoc::fft_shift::NATURAL}};
+        const std::map<std::string, uhd::rfnoc::fft_direction> directions{
+            {"forward", uhd::rfnoc::fft_direction::FORWARD},
+            {"reverse", uhd::rfnoc::fft_direction::REVERSE}};
+        auto lookup = [&args](const auto& values, const std::string& key,
+                          const std::string& default_value) {
+            const std::string value = args.get(key, default_value);
+            if (!values.count(value)) {
+                throw uhd::value_error(
+                    "[rx_stream] Invalid value for " + key + ": " + value);
+            }
+            return values.at(value);
+        };
+
+        const size_t length = args.cast<size_t>("host_fft_length", 0);
+        for (size_t i = 0; i < num_ports; i++) {
+            auto fft = uhd::rfnoc::host_fft::make(length);
+            fft->set_magnitude(lookup(magnitudes, "host_fft_magnitude", "complex"));
+            fft->set_shift_config(lookup(shifts, "host_fft_shift", "normal"));
+            fft->set_direction(lookup(directions, "host_fft_direction", "forward"));
+            fft->set_scaling(args.cast<uint16_t>(
+                "host_fft_scaling", uhd::rfnoc::host_fft::DEFAULT_SCALING));
+            _host_ffts.push_back(fft);
+        }
+        UHD_LOG_DEBUG("STREAMER",
+            "Transforming RX samples with a host FFT of length "
+                << _host_ffts[0]->get_length());
+    }
+
+    //! Create the host vector IIR filters and moving averages, if requested
+    void _setup_host_averages(const size_t num_ports,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
+    {
+        const bool has_iir = args.has_key("host_vector_iir_delay");
+        const bool has_avg = args.has_key("host_moving_average_sum_len");
+        if (!has_iir && !has_avg) {
+            return;
+        }
+        if (stream_args.cpu_format != "fc32") {
+            throw uhd::value_error("[rx_stream] The host vector IIR and moving average "
+                                   "require the fc32 CPU format!");
+        }
+        if (has_iir) {
+            const auto delay = args.cast<uint16_t>("host_vector_iir_delay", 0);
+            const auto alpha = args.cast<double>("host_vector_iir_alpha", 0.9);
+            const auto beta  = args.cast<double>("host_vector_iir_beta", 0.9);
+            for (size_t i = 0; i < num_ports; i++) {
+                _host_vector_iirs.push_back(
+                    uhd::rfnoc::host_vector_iir::make(delay, alpha, beta));
+            }
+            UHD_LOG_DEBUG("STREAMER",
+                "Filtering RX samples with a host vector IIR with a delay of " << delay);
+        }
+        if (has_avg) {
+            // The block casts to uint8_t too, so cast a wider type and check it
+            const auto sum_len = args.cast<uint32_t>("host_moving_average_sum_len", 0);
+            if (sum_len > std::numeric_limits<uint8_t>::max()) {
+                throw uhd::value_error(
+                    "[rx_stream] host_moving_average_sum_len must be in [1, 255]!");
+            }
+            const auto divisor =
+                args.cast<uint32_t>("host_moving_average_divisor", sum_len);
+            for (size_t i = 0; i < num_ports; i++) {
+                _host_moving_averages.push_back(uhd::rfnoc::host_moving_average::make(
+                    static_cast<uint8_t>(sum_len), divisor));
+            }
+            UHD_LOG_DEBUG("STREAMER",
+                "Averaging RX samples on the host over " << sum_len << " samples");
+        }
+    }
+
+    //! Set up keep-one-in-N, if requested
+    void _setup_keep_one_in_n(const size_t num_ports,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
+    {
+        const size_t n  = args.cast<size_t>("host_keep_one_in_n", 1);
+        const auto mode = args.get("host_keep_one_in_n_mode", "sample");
+        if (n == 0) {
+            throw uhd::value_error("[rx_stream] host_keep_one_in_n must be at least 1!");
+        }
+        if (mode != "sample" && mode != "packet") {
+            throw uhd::value_error(
+                "[rx_stream] Invalid value for host_keep_one_in_n_mode: " + mode);
+        }
+        if (n == 1) {
+            return;
+        }
+        _keep_one_in_n = n;
+        _keep_packets  = mode == "packet";
+        if (!_keep_packets) {
+            // Packed formats have no byte offset for every sample
+            if (stream_args.otw_format == "sc12") {
+                throw uhd::value_error("[rx_stream] Keeping one in N samples does not "
+                                       "support the sc12 over-the-wire format!");
+            }
+            _kept_samps.assign(num_ports,
+                std::vector<char>(
+                    detail::KEPT_SAMPS_CHUNK_SIZE * _convert_info.bytes_per_otw_item));
+        }
+        UHD_LOG_DEBUG("STREAMER",
+            "Keeping one in " << n << (_keep_packets ? " packets" : " samples"));
+    }
+
+    //! Create the host resamplers, if requested
+    void _setup_resamplers(const size_t num_ports,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
+    {
+        if (!args.has_key("host_resample_interp")
+            && !args.has_key("host_resample_decim")) {
+            return;
+        }
+        if (stream_args.cpu_format != "fc32") {
+            throw uhd::value_error("[rx_stream] The host resampler requires the fc32 CPU "
+                                   "format!");
+        }
+        if (!_host_ffts.empty() || _keep_one_in_n > 1) {
+            throw uhd::value_error("[rx_stream] The host resampler does not support the "
+                                   "host FFT or keep-one-in-N!");
+        }
+        const size_t interp = args.cast<size_t>("host_resample_interp", 1);
+        const size_t decim  = args.cast<size_t>("host_resample_decim", 1);
+        const size_t taps   = args.cast<size_t>(
+            "host_resample_taps", uhd::rfnoc::host_resampler::DEFAULT_TAPS_PER_PHASE);
+        for (size_t i = 0; i < num_ports; i++) {
+            _resamplers.push_back(uhd::rfnoc::host_resampler::make(interp, decim, taps));
+        }
+        _resamp_in.resize(num_ports);
+        _resamp_out.resize(num_ports);
+        _resample_job.fn = [this](const size_t chan) {
+            _resample_chan(chan, _resample_job.num_samps, _resample_job.eob);
+        };
+        UHD_LOG_DEBUG("STREAMER",
+            "Resampling RX samples on the host by " << _resamplers[0]->get_interp() << "/"
+                                                    << _resamplers[0]->get_decim());
+    }
+
+    //! Enable the gap fill mode, if requested
+    void _setup_gap_fill(const uhd::args_view& args)
+    {
+        const auto mode = args.get("gap_fill");
+        if (mode.empty()) {
+            return;
+        }
+        if (mode != "zeros" && mode != "mark") {
+            throw uhd::value_error("[rx_stream] Invalid value for gap_fill: " + mode);
+        }
+        if (_has_host_stages() || _keep_one_in_n > 1 || _agc) {
+            throw uhd::value_error("[rx_stream] The gap fill mode does not support host "
+                                   "processing, keep-one-in-N or the host AGC!");
+        }
+        _gap_fill          = mode == "zeros" ? gap_fill_t::ZEROS : gap_fill_t::MARK;
+        _gap_fill_max_time = args.cast<double>("gap_fill_max_time", _gap_fill_max_time);
+        if (_gap_fill_max_time < 0.0) {
+            throw uhd::value_error("[rx_stream] gap_fill_max_time must not be negative!");
         }
     }
 
     //! Create converters and initialize _convert_info
-    void _setup_converters(const size_t num_ports, const uhd::stream_args_t stream_args)
+    void _setup_converters(const size_t num_ports,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
     {
         // Note to code archaeologists: In the past, we had to also specify the
         // endianness here, but that is no longer necessary because we can make
@@ -381,6 +1359,18 @@ private:
         id.output_format = stream_args.cpu_format;
         id.num_outputs   = 1;
 
+        // With the interleaved channel layout, a single converter writes the
+        // samples of all channels into one buffer
+        const std::string layout = args.get("channel_layout", "separate");
+        if (layout != "separate" && layout != "interleaved") {
+            throw uhd::value_error(
+                "[rx_stream] Invalid value for channel_layout: " + layout);
+        }
+        _interleaved = layout == "interleaved" && num_ports > 1;
+        if (_interleaved) {
+            id.num_inputs = num_ports;
+        }
+
         auto starts_with = [](const std::string& s, const std::string v) {
             return s.find(v) == 0;
         };
@@ -391,16 +1381,20 @@ private:
         convert_info info;
         info.bytes_per_otw_item = convert::get_bytes_per_item(id.input_format);
         info.bytes_per_cpu_item = convert::get_bytes_per_item(id.output_format);
+        info.bytes_per_cpu_samp =
+            info.bytes_per_cpu_item * (_interleaved ? num_ports : 1);
 
         if (otw_is_complex) {
             info.otw_item_bit_width = info.bytes_per_otw_item * 8 / 2;
         } else {
             info.otw_item_bit_width = info.bytes_per_otw_item * 8;
         }
+        // The CHDR converters between a type and itself are a memcpy
+        info.is_copy = stream_args.otw_format == stream_args.cpu_format && !_interleaved;
 
         _convert_info = info;
 
-        for (size_t i = 0; i < num_ports; i++) {
+        for (size_t i = 0; i < (_interleaved ? 1 : num_ports); i++) {
             _converters.push_back(convert::get_converter(id)());
             _converters.back()->set_scalar(1 / 32767.0);
         }
@@ -409,8 +1403,98 @@ private:
     // Converter and item sizes
     convert_info _convert_info;
 
-    // Converters
+    // Converters, one per channel, or a single one for all channels with the
+    // interleaved channel layout
     std::vector<uhd::convert::converter::sptr> _converters;
+    bool _interleaved = false;
+
+    // Arguments of the current multi-threaded conversion, and the function
+    // which converts one channel of it
+    struct
+    {
+        const uhd::rx_streamer::buffs_type* buffs = nullptr;
+        size_t buffer_offset_bytes                = 0;
+        size_t num_samps                          = 0;
+        size_t skip                               = 0;
+        size_t num_in                             = 0;
+        std::function<void(size_t)> fn;
+    } _convert_job;
+
+    // Worker threads for multi-threaded conversion, or null if all channels
+    // are converted by the calling thread
+    uhd::worker_pool::uptr _convert_pool;
+
+    // Time spent in the converters (and the host FFTs)
+    telemetry_counter _convert_ns;
+
+    // FFTs which transform the converted samples, one per channel, or empty
+    std::vector<uhd::rfnoc::host_fft::sptr> _host_ffts;
+
+    // Vector IIR filters and moving averages of the converted (and
+    // transformed) samples, one per channel, or empty
+    std::vector<uhd::rfnoc::host_vector_iir::sptr> _host_vector_iirs;
+    std::vector<uhd::rfnoc::host_moving_average::sptr> _host_moving_averages;
+
+    // Resamplers of the converted (and filtered) samples, one per channel, or
+    // empty. Every packet is resampled from _resamp_in into _resamp_out.
+    std::vector<uhd::rfnoc::host_resampler::sptr> _resamplers;
+    std::vector<std::vector<std::complex<float>>> _resamp_in;
+    std::vector<std::vector<std::complex<float>>> _resamp_out;
+    // The packet to resample, and the function which resamples one channel
+    struct
+    {
+        size_t num_samps = 0;
+        bool eob         = false;
+        std::function<void(size_t)> fn;
+    } _resample_job;
+    // The number of outputs of the last packet, the number of them still to
+    // be read and the offset of the next one, and the metadata of the packet
+    size_t _resamp_num_chan_out = 0;
+    size_t _resamp_remaining    = 0;
+    size_t _resamp_offset       = 0;
+    uhd::rx_metadata_t _resamp_metadata;
+    // The time of the first packet of the current burst, and the number of
+    // outputs of the burst before those of the last packet
+    bool _resamp_in_burst    = false;
+    bool _resamp_has_time    = false;
+    uint64_t _resamp_num_out = 0;
+    time_spec_t _resamp_start_time;
+
+    // Keep one in this many samples or packets, and drop the rest before
+    // converting them
+    size_t _keep_one_in_n = 1;
+    bool _keep_packets    = false;
+    // Number of samples (or packets) to drop before the next kept one
+    size_t _keep_phase = 0;
+    // Buffers which gather the kept samples of each channel, if keeping samples
+    std::vector<std::vector<char>> _kept_samps;
+
+    // Host AGC, or null
+    rx_agc::uptr _agc;
+    // True if the last packet was left for the next recv() call, because it is
+    // the first one with a new gain
+    bool _agc_held_packet = false;
+
+    // Whether gaps in the stream are filled with zeros or marked (see the
+    // gap_fill stream argument). Longer gaps than _gap_fill_max_time (in
+    // seconds) are always marked.
+    enum class gap_fill_t { NONE, ZEROS, MARK };
+    gap_fill_t _gap_fill      = gap_fill_t::NONE;
+    double _gap_fill_max_time = 1.0;
+    // Time of the sample after the last packet, if there is one
+    time_spec_t _gap_next_time;
+    bool _gap_time_valid = false;
+    // Zeros still to be written before the held packet, and their metadata
+    size_t _gap_zeros_remaining = 0;
+    uhd::rx_metadata_t _gap_metadata;
+    // True if the last packet was left for the next loop iteration of recv(),
+    // because there is a gap before it
+    bool _gap_held_packet = false;
+
+    // Cycles spent in recv(), by stage. The zero copy streamer and the
+    // transports hold pointers to it, so it is declared before (and destroyed
+    // after) them.
+    cycle_accounting _cycles;
 
     // Implementation of frame buffer management and packet info
     rx_streamer_zero_copy<transport_t, ignore_seq_err> _zero_copy_streamer;
@@ -435,6 +1519,9 @@ private:
     // Num samps remaining in buffer currently held by zero copy streamer
     size_t _buff_samps_remaining = 0;
 
+    // True between get_recv_buffs() and release_recv_buffs()
+    bool _recv_buffs_borrowed = false;
+
     // Metadata cache for error handling
     detail::rx_metadata_cache _error_metadata_cache;
 
@@ -8,11 +8,15 @@
 
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/get_aligned_buffs.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -88,6 +92,10 @@ class rx_streamer_zero_copy
 public:
     using overrun_handler_t = std::function<void()>;
 
+    //! A timeout for get_recv_buffs() which only returns packets which have
+    // already arrived, without waiting for any
+    static constexpr int32_t NO_WAIT_TIMEOUT_MS = std::numeric_limits<int32_t>::min();
+
     //! Constructor
     rx_streamer_zero_copy(const size_t num_ports)
         : _xports(num_ports)
@@ -128,6 +136,34 @@ public:
         return _xports.size();
     }
 
+    //! Returns the readiness descriptor of the transport of \p port, or -1
+    //
+    // Requires transports with a get_ready_fd() method.
+    int get_ready_fd(const size_t port)
+    {
+        return _xports.at(port) ? _xports[port]->get_ready_fd() : -1;
+    }
+
+    /*!
+     * Prepares the streamer for a new stream session
+     *
+     * Drops all packets which were received but not read, restarts the
+     * sequence number check of every transport, and clears the error state.
+     * Requires transports with a reset_seq_num() method.
+     */
+    void reset_stream_state()
+    {
+        _flush_xports();
+        for (auto& xport : _xports) {
+            xport->reset_seq_num();
+        }
+        _get_aligned_buffs.reset();
+        _last_read_time_info     = last_read_time_info_t();
+        _total_num_samps         = 0;
+        _stopped_due_to_overrun  = false;
+        _stopped_due_to_late_cmd = false;
+    }
+
     //! Configures tick rate for conversion of timestamp
     void set_tick_rate(const double rate)
     {
@@ -140,6 +176,33 @@ public:
         _samp_rate = rate;
     }
 
+    /*!
+     * Configures whether metadata.time_spec is left for get_time_spec() to
+     * calculate, so that receiving a packet takes no floating point math
+     */
+    void set_lazy_time_spec(const bool lazy)
+    {
+        _lazy_time_spec = lazy;
+    }
+
+    //! Configures the accounting of the cycles of get_recv_buffs(), or nullptr
+    void set_cycle_accounting(cycle_accounting* cycles)
+    {
+        _cycles = cycles;
+    }
+
+    /*!
+     * Moves the time of the first sample in \p metadata by \p num_samps
+     * samples, e.g., for a fragment of a packet
+     */
+    void advance_time(rx_metadata_t& metadata, const size_t num_samps) const
+    {
+        metadata.time_samps += num_samps;
+        if (!_lazy_time_spec) {
+            metadata.time_spec += time_spec_t::from_ticks(num_samps, _samp_rate);
+        }
+    }
+
     //! Configures the size of each sample
     void set_bytes_per_item(const size_t bpi)
     {
@@ -169,7 +232,7 @@ public:
      *
      * \param buffs returns a pointer to the buffer data
      * \param metadata returns the metadata corresponding to the buffer
-     * \param timeout_ms timeout in milliseconds
+     * \param timeout_ms timeout in milliseconds, or NO_WAIT_TIMEOUT_MS
      * \return the size in samples of each packet, or 0 if timeout
      */
     size_t get_recv_buffs(std::vector<const void*>& buffs,
@@ -195,8 +258,7 @@ public:
                         break;
 
                     case get_aligned_buffs_t::SEQUENCE_ERROR:
-                        std::tie(metadata.has_time_spec, metadata.time_spec) =
-                            _last_read_time_info.get_next_packet_time(_samp_rate);
+                        _set_next_packet_time(metadata);
                         metadata.out_of_sequence = true;
                         metadata.error_code      = rx_metadata_t::ERROR_CODE_OVERFLOW;
                         break;
@@ -206,17 +268,19 @@ public:
                 }
             };
 
+        UHD_CYCLE_ACCOUNT(_cycles, METADATA);
         metadata.reset();
 
         // Try to get buffs with a 0 timeout first. This avoids needing to check
         // if radios are stopped due to overrun when packets are available.
-        auto result = _get_aligned_buffs(0);
+        auto result = _get_buffs(0);
 
         if (result == get_aligned_buffs_t::TIMEOUT) {
-            if (!_stopped_due_to_overrun) {
+            if (!_stopped_due_to_overrun && timeout_ms != NO_WAIT_TIMEOUT_MS) {
                 // Packets were not available with zero timeout, wait for them
                 // to arrive using the specified timeout.
-                result = _get_aligned_buffs(std::max(1,timeout_ms));
+                telemetry_timer timer(_buff_wait_ns);
+                result = _get_buffs(std::max(1,timeout_ms));
             }
             if (result == get_aligned_buffs_t::TIMEOUT) {
                 if (_stopped_due_to_overrun) {
@@ -224,8 +288,8 @@ public:
                     // that were buffered prior to the overrun. Call the overrun
                     // handler and return overrun error.
                     _handle_overrun();
-                    std::tie(metadata.has_time_spec, metadata.time_spec) =
-                        _last_read_time_info.get_next_packet_time(_samp_rate);
+                    _overflows.add(1);
+                    _set_next_packet_time(metadata);
                     metadata.error_code     = rx_metadata_t::ERROR_CODE_OVERFLOW;
                     _stopped_due_to_overrun = false;
                     return 0;
@@ -239,6 +303,9 @@ public:
         }
 
         if (result != get_aligned_buffs_t::SUCCESS) {
+            if (result == get_aligned_buffs_t::SEQUENCE_ERROR) {
+                _sequence_errors.add(1);
+            }
             set_metadata_for_error(result, metadata);
             return 0;
         }
@@ -259,8 +326,7 @@ public:
         // Set the metadata from the buffer information at index zero
         const auto& info_0 = _infos[0];
 
-        metadata.has_time_spec  = info_0.has_tsf;
-        metadata.time_spec      = time_spec_t::from_ticks(info_0.tsf, _tick_rate);
+        _set_time(metadata, info_0.has_tsf, info_0.tsf, 0);
         metadata.start_of_burst = false;
         metadata.end_of_burst   = eob;
         metadata.error_code     = rx_metadata_t::ERROR_CODE_NONE;
@@ -276,13 +342,65 @@ public:
 
         // Done with these packets, save timestamp info for next call
         _last_read_time_info.has_time_spec = metadata.has_time_spec;
-        _last_read_time_info.time_spec     = metadata.time_spec;
+        _last_read_time_info.time_ticks    = info_0.tsf;
         _last_read_time_info.num_samps     = info_0.payload_bytes / _bytes_per_item;
         eov_positions.update_running_sample_count(_last_read_time_info.num_samps);
 
+        _packets.add(buffs.size());
+        _samples.add(_last_read_time_info.num_samps);
         return _last_read_time_info.num_samps;
     }
 
+    /*!
+     * Read the packet counters and the time spent waiting for packets
+     *
+     * May be called from any thread.
+     */
+    void get_telemetry(stream_telemetry_t& telemetry) const
+    {
+        telemetry.packets         = _packets.get();
+        telemetry.samples         = _samples.get();
+        telemetry.sequence_errors = _sequence_errors.get();
+        telemetry.overflows       = _overflows.get();
+        telemetry.buff_wait_ns    = _buff_wait_ns.get();
+    }
+
+    /*!
+     * Read the flow control state and the buffering of the transports
+     *
+     * May be called from any thread, once all channels are connected. Requires
+     * transports with a thread-safe get_fc_outstanding() method, and with
+     * get_fc_capacity(), get_num_frames() and get_mtu().
+     */
+    void get_fc_telemetry(stream_telemetry_t& telemetry) const
+    {
+        telemetry.fc_bytes_outstanding   = 0;
+        telemetry.fc_packets_outstanding = 0;
+        for (const auto& xport : _xports) {
+            const auto counts = xport->get_fc_outstanding();
+            telemetry.fc_bytes_outstanding += counts.bytes;
+            telemetry.fc_packets_outstanding += counts.packets;
+            telemetry.xport_fc_window_bytes = std::max<uint64_t>(
+                telemetry.xport_fc_window_bytes, xport->get_fc_capacity().bytes);
+            telemetry.xport_num_frames =
+                std::max<uint64_t>(telemetry.xport_num_frames, xport->get_num_frames());
+            telemetry.xport_frame_size =
+                std::max<uint64_t>(telemetry.xport_frame_size, xport->get_mtu());
+        }
+    }
+
+    /*!
+     * Append the frames of the links of all channels to \p memory
+     *
+     * Requires transports with get_link_memory(), and all channels connected.
+     */
+    void get_link_memory(stream_memory_t& memory) const
+    {
+        for (const auto& xport : _xports) {
+            memory.links.push_back(xport->get_link_memory());
+        }
+    }
+
     /*!
      * Release the packet for the specified channel
      *
@@ -297,11 +415,29 @@ public:
 private:
     using get_aligned_buffs_t = get_aligned_buffs<transport_t, ignore_seq_err>;
 
+    //! Gets the aligned buffers, accounting the cycles as waiting for buffers
+    typename get_aligned_buffs_t::alignment_result_t _get_buffs(const int32_t timeout_ms)
+    {
+        UHD_CYCLE_ACCOUNT(_cycles, BUFF_WAIT);
+        return _get_aligned_buffs(timeout_ms);
+    }
+
     void _handle_overrun()
     {
         // Flush any remaining packets. This method is called after any channel
         // times out, so here we ensure all channels are flushed prior to
         // calling the overrun handler to potentially restart the radios.
+        _flush_xports();
+
+        // Now call the overrun handler
+        if (_overrun_handler) {
+            _overrun_handler();
+        }
+    }
+
+    //! Releases the packets in flight and all packets waiting in the transports
+    void _flush_xports()
+    {
         for (size_t chan = 0; chan < _xports.size(); chan++) {
             if (_frame_buffs[chan]) {
                 _xports[chan]->release_recv_buff(std::move(_frame_buffs[chan]));
@@ -318,30 +454,50 @@ private:
                 _xports[chan]->release_recv_buff(std::move(buff));
             }
         }
+    }
 
-        // Now call the overrun handler
-        if (_overrun_handler) {
-            _overrun_handler();
+    //! Fills in the time of the first sample, \p samps samples after the
+    // timestamp \p ticks
+    void _set_time(rx_metadata_t& metadata,
+        const bool has_time,
+        const uint64_t ticks,
+        const uint64_t samps) const
+    {
+        metadata.has_time_spec  = has_time;
+        metadata.has_time_ticks = has_time;
+        metadata.time_ticks     = ticks;
+        metadata.tick_rate      = _tick_rate;
+        metadata.time_samps     = samps;
+        metadata.samp_rate      = _samp_rate;
+        if (!_lazy_time_spec) {
+            metadata.time_spec = time_spec_t::from_ticks(ticks, _tick_rate);
+            if (samps != 0) {
+                metadata.time_spec += time_spec_t::from_ticks(samps, _samp_rate);
+            }
         }
     }
 
+    //! Fills in the time at which the packet after the last one read was
+    // expected, for errors
+    void _set_next_packet_time(rx_metadata_t& metadata) const
+    {
+        if (!_last_read_time_info.has_time_spec) {
+            metadata.has_time_spec = false;
+            return;
+        }
+        _set_time(metadata,
+            _last_read_time_info.has_time_spec,
+            _last_read_time_info.time_ticks,
+            _last_read_time_info.num_samps);
+    }
+
     // Information recorded by streamer about the last data packet processed,
     // used to create the metadata when there is a sequence error.
     struct last_read_time_info_t
     {
-        size_t num_samps   = 0;
-        bool has_time_spec = false;
-        time_spec_t time_spec;
-
-        std::tuple<bool, time_spec_t> get_next_packet_time(double samp_rate)
-        {
-            if (has_time_spec) {
-                return std::make_tuple(
-                    true, time_spec + time_spec_t::from_ticks(num_samps, samp_rate));
-            } else {
-                return std::make_tuple(false, time_spec_t());
-            }
-        }
+        size_t num_samps    = 0;
+        bool has_time_spec  = false;
+        uint64_t time_ticks = 0;
     };
 
     // Transports for each channel
@@ -360,6 +516,9 @@ private:
     // Rate used in conversion of timestamp to time_spec_t
     double _samp_rate = 1.0;
 
+    // Whether metadata.time_spec is only calculated by get_time_spec()
+    bool _lazy_time_spec = false;
+
     // Size of a sample on the device
     size_t _bytes_per_item = 0;
 
@@ -382,6 +541,16 @@ private:
 
     // Callback for overrun
     overrun_handler_t _overrun_handler;
+
+    // Telemetry, updated by the thread calling get_recv_buffs()
+    telemetry_counter _packets;
+    telemetry_counter _samples;
+    telemetry_counter _sequence_errors;
+    telemetry_counter _overflows;
+    telemetry_counter _buff_wait_ns;
+
+    // Accounting of the cycles of get_recv_buffs(), owned by the streamer
+    cycle_accounting* _cycles = nullptr;
 };
 
 }} // namespace uhd::transport
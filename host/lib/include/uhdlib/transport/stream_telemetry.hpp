@@ -0,0 +1,258 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+/*! \file stream_telemetry.hpp
+ * Counters of the streamers, and the accounting of their CPU cycles
+ *
+ * UHD_CYCLE_ACCOUNT(accounting, stage) adds the cycles of the rest of the
+ * scope to a stage of a cycle_accounting, e.g. UHD_CYCLE_ACCOUNT(&_cycles,
+ * CONVERT). The accounting is compiled in if the CMake option
+ * UHD_CYCLE_ACCOUNTING is enabled, which defines UHD_ENABLE_CYCLE_ACCOUNTING.
+ * Otherwise, the macro expands to nothing, and its arguments are not
+ * evaluated.
+ */
+
+namespace uhd { namespace transport {
+
+/*!
+ * A counter which is updated by the streaming thread and may be read by any
+ * other thread.
+ *
+ * Since there is only a single writer, add() is a plain load and store rather
+ * than an atomic read-modify-write, so it costs about as much as incrementing
+ * a regular variable. Counters which are updated from several threads must
+ * use add_shared() instead, and never add().
+ */
+class telemetry_counter
+{
+public:
+    //! Add to the counter. Must only ever be called from one thread.
+    UHD_FORCE_INLINE void add(const uint64_t value)
+    {
+        _value.store(_value.load(std::memory_order_relaxed) + value,
+            std::memory_order_relaxed);
+    }
+
+    //! Add to the counter from any thread
+    void add_shared(const uint64_t value)
+    {
+        _value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    //! Read the counter from any thread
+    uint64_t get() const
+    {
+        return _value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> _value{0};
+};
+
+/*!
+ * Adds the time spent in a scope to a telemetry_counter, in nanoseconds
+ */
+class telemetry_timer
+{
+public:
+    UHD_FORCE_INLINE telemetry_timer(telemetry_counter& counter)
+        : _counter(counter), _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    UHD_FORCE_INLINE ~telemetry_timer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - _start;
+        _counter.add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    telemetry_timer(const telemetry_timer&) = delete;
+    telemetry_timer& operator=(const telemetry_timer&) = delete;
+
+private:
+    telemetry_counter& _counter;
+    const std::chrono::steady_clock::time_point _start;
+};
+
+/*!
+ * Returns a counter which counts CPU cycles, or at least at a fixed rate
+ *
+ * This is the time stamp counter on x86 (which runs at a constant rate on
+ * current CPUs) and the virtual counter of the generic timer on ARM64. Other
+ * CPUs count nanoseconds.
+ */
+UHD_FORCE_INLINE uint64_t get_cycle_count()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t count;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+    return count;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+//! The stages of recv() and send() which a cycle_accounting tells apart
+enum class stream_stage : size_t {
+    //! Waiting for buffers (RX: packets, TX: frames)
+    BUFF_WAIT,
+    //! Decoding (RX) or writing (TX) the CHDR headers
+    HEADER,
+    //! Sending (RX) or waiting for and processing (TX) flow control messages
+    FLOW_CTRL,
+    //! Converting samples between the CPU and OTW formats
+    CONVERT,
+    //! Turning packet headers into metadata (RX) or metadata into packet info (TX)
+    METADATA,
+    //! Sending the packets (TX only)
+    SEND,
+    //! The rest of a call, outside of the other stages
+    CALL,
+    NUM_STAGES
+};
+
+/*!
+ * The CPU cycles which a streamer spent in recv() or send(), per stage
+ *
+ * Stages may nest: The transport decodes the headers of the packets while the
+ * streamer waits for them, for example. A stage only counts the cycles which
+ * none of the stages inside of it count, so every cycle of a call counts
+ * towards one stage. The CALL stage, which spans the whole call, keeps the
+ * cycles which no other stage claimed.
+ *
+ * Like telemetry_counter::add(), the stages must all be accounted on one
+ * thread. get_telemetry() may be called from any thread.
+ */
+class cycle_accounting
+{
+public:
+    cycle_accounting()
+        : _start_cycles(get_cycle_count()), _start_time(std::chrono::steady_clock::now())
+    {
+    }
+
+    //! Add the cycles counted by this accounting to \p telemetry
+    void get_telemetry(stream_telemetry_t& telemetry) const
+    {
+#ifdef UHD_ENABLE_CYCLE_ACCOUNTING
+        telemetry.num_calls        = _num_calls.get();
+        telemetry.cycles_buff_wait = _get(stream_stage::BUFF_WAIT);
+        telemetry.cycles_header    = _get(stream_stage::HEADER);
+        telemetry.cycles_flow_ctrl = _get(stream_stage::FLOW_CTRL);
+        telemetry.cycles_convert   = _get(stream_stage::CONVERT);
+        telemetry.cycles_metadata  = _get(stream_stage::METADATA);
+        telemetry.cycles_send      = _get(stream_stage::SEND);
+        telemetry.cycles_other     = _get(stream_stage::CALL);
+        telemetry.cycles_total     = 0;
+        for (const auto& cycles : _cycles) {
+            telemetry.cycles_total += cycles.get();
+        }
+        // The rate of the counter, measured over the lifetime of the streamer
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - _start_time;
+        telemetry.cycles_per_second =
+            elapsed.count() > 0.0
+                ? uint64_t((get_cycle_count() - _start_cycles) / elapsed.count())
+                : 0;
+#else
+        (void)telemetry;
+#endif
+    }
+
+private:
+    friend class cycle_scope;
+
+    uint64_t _get(const stream_stage stage) const
+    {
+        return _cycles[static_cast<size_t>(stage)].get();
+    }
+
+    std::array<telemetry_counter, static_cast<size_t>(stream_stage::NUM_STAGES)> _cycles;
+    telemetry_counter _num_calls;
+
+    // The cycles which the stages counted so far, which a stage subtracts from
+    // its own cycles for the stages inside of it
+    uint64_t _accounted = 0;
+
+    const uint64_t _start_cycles;
+    const std::chrono::steady_clock::time_point _start_time;
+};
+
+/*!
+ * Adds the cycles spent in a scope to a stage of a cycle_accounting, less
+ * those of the stages inside of it
+ *
+ * Does nothing if the accounting is nullptr, e.g., for a transport which
+ * doesn't belong to a streamer (yet). Use it with UHD_CYCLE_ACCOUNT.
+ */
+class cycle_scope
+{
+public:
+    UHD_FORCE_INLINE cycle_scope(cycle_accounting* accounting, const stream_stage stage)
+        : _accounting(accounting), _stage(static_cast<size_t>(stage))
+    {
+        if (_accounting) {
+            if (stage == stream_stage::CALL) {
+                _accounting->_num_calls.add(1);
+            }
+            _accounted = _accounting->_accounted;
+            _start     = get_cycle_count();
+        }
+    }
+
+    UHD_FORCE_INLINE ~cycle_scope()
+    {
+        if (_accounting) {
+            const uint64_t cycles = get_cycle_count() - _start;
+            const uint64_t inner  = _accounting->_accounted - _accounted;
+            // The counters of different cores may disagree a bit
+            const uint64_t own = cycles > inner ? cycles - inner : 0;
+            _accounting->_cycles[_stage].add(own);
+            _accounting->_accounted += own;
+        }
+    }
+
+    cycle_scope(const cycle_scope&) = delete;
+    cycle_scope& operator=(const cycle_scope&) = delete;
+
+private:
+    cycle_accounting* const _accounting;
+    const size_t _stage;
+    uint64_t _accounted = 0;
+    uint64_t _start     = 0;
+};
+
+}} // namespace uhd::transport
+
+#define UHD_CYCLE_ACCOUNT_CONCAT_(a, b) a##b
+#define UHD_CYCLE_ACCOUNT_CONCAT(a, b) UHD_CYCLE_ACCOUNT_CONCAT_(a, b)
+#ifdef UHD_ENABLE_CYCLE_ACCOUNTING
+#    define UHD_CYCLE_ACCOUNT(accounting, stage)                \
+        ::uhd::transport::cycle_scope UHD_CYCLE_ACCOUNT_CONCAT( \
+            _uhd_cycle_scope_, __LINE__)(                       \
+            accounting, ::uhd::transport::stream_stage::stage)
+#else
+#    define UHD_CYCLE_ACCOUNT(accounting, stage)
+#endif
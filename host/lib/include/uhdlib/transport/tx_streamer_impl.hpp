@@ -8,19 +8,35 @@
 
 #include <uhd/config.hpp>
 #include <uhd/convert.hpp>
+#include <uhd/rfnoc/host_resampler.hpp>
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <uhdlib/transport/tx_streamer_zero_copy.hpp>
+#include <uhdlib/utils/args_view.hpp>
+#include <uhdlib/utils/thread_placement.hpp>
+#include <uhdlib/utils/trace_points.hpp>
+#include <uhdlib/utils/worker_pool.hpp>
 #include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstring>
+#include <functional>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace uhd { namespace transport {
 
 namespace detail {
 
+//! Number of input samples which the host resamplers process at a time
+constexpr size_t RESAMPLE_CHUNK_SIZE = 2048;
+
 /*!
  * Cache of metadata for send calls with zero samples
  *
@@ -98,12 +114,16 @@ private:
 
 /*!
  * Implementation of tx streamer API
+ *
+ * Once streaming, send() does not allocate any memory: Everything it needs per
+ * call is a member which was sized when the channels were connected. Keep it
+ * that way, tests/tx_streamer_test.cpp checks it.
  */
 template <typename transport_t>
 class tx_streamer_impl : public tx_streamer
 {
 public:
-    tx_streamer_impl(const size_t num_chans, const uhd::stream_args_t stream_args)
+    tx_streamer_impl(const size_t num_chans, const uhd::stream_args_t& stream_args)
         : _zero_copy_streamer(num_chans)
         , _zero_buffs(num_chans, &_zero)
         , _out_buffs(num_chans)
@@ -111,12 +131,25 @@ public:
     {
         _setup_converters(num_chans, stream_args);
         _zero_copy_streamer.set_bytes_per_item(_convert_info.bytes_per_otw_item);
+        _zero_copy_streamer.set_cycle_accounting(&_cycles);
+
+        const uhd::args_view args(stream_args.args);
+        _spp = args.cast<size_t>("spp", _spp);
 
-        if (stream_args.args.has_key("spp")) {
-            _spp = stream_args.args.cast<size_t>("spp", _spp);
+        _setup_convert_pool(num_chans, stream_args, args);
+        _setup_resamplers(num_chans, stream_args, args);
+
+        _padding_time = args.cast<double>("auto_padding", 0.0);
+        if (_padding_time < 0.0) {
+            throw uhd::value_error("[tx_stream] auto_padding must not be negative!");
         }
     }
 
+    ~tx_streamer_impl() override
+    {
+        stop_padding();
+    }
+
     virtual void connect_channel(const size_t channel, typename transport_t::uptr xport)
     {
         const size_t mtu = xport->get_mtu();
@@ -135,7 +168,7 @@ public:
 
     size_t get_num_channels() const override
     {
-        return _zero_copy_streamer.get_num_channels();
+        return get_num_ports();
     }
 
     size_t get_max_num_samps() const override
@@ -156,10 +189,546 @@ public:
         const uhd::tx_metadata_t& metadata_,
         const double timeout) override
     {
+        UHD_CYCLE_ACCOUNT(&_cycles, CALL);
         if (!_all_chans_connected) {
             throw uhd::runtime_error("[tx_stream] Attempting to call send() before all "
                                      "channels are connected!");
         }
+        if (_send_buffs_acquired) {
+            throw uhd::runtime_error(
+                "[tx_stream] Attempting to call send() before commit_send_buffs()!");
+        }
+        const auto lock = _lock_transports();
+        return _send(
+            buffs, nsamps_per_buff, metadata_, static_cast<int32_t>(timeout * 1000));
+    }
+
+    //! Implementation of tx_streamer API method
+    size_t send_many(
+        const std::vector<send_burst_t>& bursts, const double timeout) override
+    {
+        if (!_all_chans_connected) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call send_many() before "
+                                     "all channels are connected!");
+        }
+        if (_send_buffs_acquired) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call send_many() before "
+                                     "commit_send_buffs()!");
+        }
+        const auto lock          = _lock_transports();
+        const int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
+        size_t num_bursts        = 0;
+        for (const auto& burst : bursts) {
+            if (burst.buffs.size() != get_num_ports()) {
+                throw uhd::value_error(
+                    "[tx_stream] send_many() requires one buffer per channel");
+            }
+            const size_t num_samps_sent =
+                _send(burst.buffs, burst.nsamps_per_buff, burst.metadata, timeout_ms);
+            if (num_samps_sent < burst.nsamps_per_buff) {
+                break;
+            }
+            num_bursts++;
+        }
+        return num_bursts;
+    }
+
+    //! Implementation of tx_streamer API method
+    size_t get_send_buffs(uhd::tx_streamer::send_buffs_type& buffs,
+        const bool has_time_spec,
+        const double timeout) override
+    {
+        if (!_all_chans_connected) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call get_send_buffs() "
+                                     "before all channels are connected!");
+        }
+        if (!_convert_info.is_copy || !_resamplers.empty()) {
+            throw uhd::runtime_error("[tx_stream] get_send_buffs() requires the CPU "
+                                     "format to match the over-the-wire format, and "
+                                     "no host resampler!");
+        }
+        if (_send_buffs_acquired) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call get_send_buffs() "
+                                     "before commit_send_buffs()!");
+        }
+
+        const auto lock = _lock_transports();
+        if (!_zero_copy_streamer.get_frame_buffs(static_cast<int32_t>(timeout * 1000))) {
+            return 0;
+        }
+
+        // The headers are written on commit, once the metadata is known
+        buffs.resize(get_num_ports());
+        for (size_t i = 0; i < get_num_ports(); i++) {
+            buffs[i] = _zero_copy_streamer.get_payload_ptr(i, has_time_spec);
+        }
+        _send_buffs_has_time_spec = has_time_spec;
+        _send_buffs_acquired      = true;
+        return _spp;
+    }
+
+    //! Implementation of tx_streamer API method
+    size_t commit_send_buffs(
+        const size_t nsamps_per_buff, const uhd::tx_metadata_t& metadata) override
+    {
+        if (!_send_buffs_acquired) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call "
+                                     "commit_send_buffs() before get_send_buffs()!");
+        }
+        if (nsamps_per_buff == 0 || nsamps_per_buff > _spp) {
+            throw uhd::value_error("[tx_stream] commit_send_buffs() requires between 1 "
+                                   "and spp samples per buffer");
+        }
+        if (metadata.has_time_spec != _send_buffs_has_time_spec) {
+            throw uhd::value_error("[tx_stream] has_time_spec must match the value "
+                                   "passed to get_send_buffs()");
+        }
+        if (metadata.eov_positions_size > 0) {
+            throw uhd::value_error(
+                "[tx_stream] commit_send_buffs() does not support EOV positions");
+        }
+
+        const auto lock = _lock_transports();
+        _zero_copy_streamer.write_packet_headers(
+            _out_buffs, nsamps_per_buff, metadata, false);
+        for (size_t i = 0; i < get_num_ports(); i++) {
+            _zero_copy_streamer.release_send_buff(i);
+        }
+        _in_burst            = !metadata.end_of_burst;
+        _send_buffs_acquired = false;
+        return nsamps_per_buff;
+    }
+
+    //! Implementation of tx_streamer API method
+    size_t register_waveform(
+        const uhd::tx_streamer::buffs_type& buffs, const size_t nsamps_per_buff) override
+    {
+        if (buffs.size() != get_num_ports()) {
+            throw uhd::value_error(
+                "[tx_stream] register_waveform() requires one buffer per channel");
+        }
+        if (nsamps_per_buff == 0) {
+            throw uhd::value_error("[tx_stream] Waveforms must not be empty");
+        }
+        if (!_resamplers.empty()) {
+            throw uhd::runtime_error(
+                "[tx_stream] Waveforms do not support the host resampler");
+        }
+
+        // Convert every packet on its own, exactly as send() would
+        waveform_t waveform;
+        waveform.num_samps = nsamps_per_buff;
+        waveform.spp       = std::min(_spp, nsamps_per_buff);
+        for (size_t i = 0; i < get_num_ports(); i++) {
+            waveform.buffs.emplace_back(
+                nsamps_per_buff * _convert_info.bytes_per_otw_item);
+            for (size_t offset = 0; offset < nsamps_per_buff; offset += waveform.spp) {
+                const size_t num_samps = std::min(waveform.spp, nsamps_per_buff - offset);
+                const void* input_ptr  = static_cast<const uint8_t*>(buffs[i])
+                                        + offset * _convert_info.bytes_per_cpu_item;
+                _converters[i]->conv(input_ptr,
+                    waveform.buffs[i].data() + offset * _convert_info.bytes_per_otw_item,
+                    num_samps);
+            }
+        }
+
+        const size_t waveform_id = _next_waveform_id++;
+        _waveforms.emplace(waveform_id, std::move(waveform));
+        return waveform_id;
+    }
+
+    //! Implementation of tx_streamer API method
+    void unregister_waveform(const size_t waveform_id) override
+    {
+        if (_waveforms.erase(waveform_id) == 0) {
+            throw uhd::value_error("[tx_stream] Unknown waveform ID");
+        }
+    }
+
+    //! Implementation of tx_streamer API method
+    size_t send_waveform(const size_t waveform_id,
+        const uhd::tx_metadata_t& metadata_,
+        const double timeout) override
+    {
+        if (!_all_chans_connected) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call send_waveform() "
+                                     "before all channels are connected!");
+        }
+        if (_send_buffs_acquired) {
+            throw uhd::runtime_error("[tx_stream] Attempting to call send_waveform() "
+                                     "before commit_send_buffs()!");
+        }
+        const auto it = _waveforms.find(waveform_id);
+        if (it == _waveforms.end()) {
+            throw uhd::value_error("[tx_stream] Unknown waveform ID");
+        }
+        const waveform_t& waveform = it->second;
+        if (waveform.spp > _spp) {
+            throw uhd::runtime_error("[tx_stream] The waveform was registered with a "
+                                     "larger spp, it needs to be registered again");
+        }
+
+        const auto lock = _lock_transports();
+        uhd::tx_metadata_t metadata(metadata_);
+        _metadata_cache.check(metadata);
+        const bool eob_on_last_packet = metadata.end_of_burst;
+        const int32_t timeout_ms      = static_cast<int32_t>(timeout * 1000);
+
+        // Only the headers are written, the payloads are copied as they are
+        _zero_copy_streamer.begin_send(metadata);
+        size_t num_samps_sent = 0;
+        while (num_samps_sent < waveform.num_samps) {
+            const size_t num_samps =
+                std::min(waveform.spp, waveform.num_samps - num_samps_sent);
+            metadata.end_of_burst =
+                eob_on_last_packet && num_samps_sent + num_samps == waveform.num_samps;
+            if (!_zero_copy_streamer.get_send_buffs(_out_buffs,
+                    num_samps_sent,
+                    num_samps,
+                    metadata.end_of_burst,
+                    false,
+                    timeout_ms)) {
+                break;
+            }
+            const size_t byte_offset = num_samps_sent * _convert_info.bytes_per_otw_item;
+            for (size_t i = 0; i < get_num_ports(); i++) {
+                std::memcpy(_out_buffs[i],
+                    waveform.buffs[i].data() + byte_offset,
+                    num_samps * _convert_info.bytes_per_otw_item);
+                _zero_copy_streamer.release_send_buff(i);
+            }
+            _in_burst = !metadata.end_of_burst;
+
+            num_samps_sent += num_samps;
+        }
+        return num_samps_sent;
+    }
+
+    /*!
+     * Prepares the streamer for a new stream session
+     *
+     * Drops the metadata of a send() call with zero samples which is waiting
+     * for the next call, and resynchronizes the flow control counts of the
+     * transports with the device.
+     */
+    void reset_stream_state()
+    {
+        const auto lock = _lock_transports();
+        _in_burst       = false;
+        _metadata_cache = detail::tx_metadata_cache();
+        _reset_resamplers();
+        _zero_copy_streamer.reset_stream_state();
+    }
+
+    //! Implementation of tx_streamer API method
+    stream_telemetry_t get_telemetry() const override
+    {
+        stream_telemetry_t telemetry;
+        _zero_copy_streamer.get_telemetry(telemetry);
+        telemetry.convert_ns = _convert_ns.get();
+        _cycles.get_telemetry(telemetry);
+        return telemetry;
+    }
+
+protected:
+    //! Returns the accounting of the cycles of send(), for the transports
+    cycle_accounting* get_cycle_accounting()
+    {
+        return &_cycles;
+    }
+
+    //! Adds the flow control state and the buffering of the transports to \p telemetry
+    //
+    // Only available if the transports provide get_fc_outstanding(),
+    // get_fc_capacity() and get_num_frames().
+    void get_fc_telemetry(stream_telemetry_t& telemetry) const
+    {
+        if (_all_chans_connected) {
+            _zero_copy_streamer.get_fc_telemetry(telemetry);
+        }
+    }
+
+    //! Adds the frames of the links and the buffers of this streamer to \p memory
+    //
+    // Only available if the transports provide get_link_memory().
+    void get_streamer_memory(stream_memory_t& memory) const
+    {
+        if (_all_chans_connected) {
+            _zero_copy_streamer.get_link_memory(memory);
+        }
+        for (const auto& waveform : _waveforms) {
+            for (const auto& buff : waveform.second.buffs) {
+                memory.streamer_bytes += buff.capacity();
+            }
+        }
+        for (const auto& buff : _resamp_out) {
+            memory.streamer_bytes += buff.capacity() * sizeof(std::complex<float>);
+        }
+    }
+
+    /*! Returns the number of ports, i.e., of transports
+     *
+     * This is the number of channels, unless a derived streamer overrides
+     * get_num_channels() to spread a channel over several ports.
+     */
+    size_t get_num_ports() const
+    {
+        return _zero_copy_streamer.get_num_channels();
+    }
+
+    //! Returns the tick rate for conversion of timestamp
+    double get_tick_rate() const
+    {
+        return _zero_copy_streamer.get_tick_rate();
+    }
+
+    //! set maximum number of sample (per packet)
+    void set_max_num_samps(const size_t value)
+    {
+        _spp = value;
+    }
+
+    //! Returns the maximum payload size
+    size_t get_mtu() const
+    {
+        return _mtu;
+    }
+
+    //! Sets the MTU and checks spp. If spp would exceed the new MTU, it is
+    // reduced accordingly.
+    void set_mtu(const size_t mtu)
+    {
+        _mtu = mtu;
+        const size_t spp_from_mtu = (_mtu - _hdr_len) / _convert_info.bytes_per_otw_item;
+        if (spp_from_mtu < _spp) {
+            _spp = spp_from_mtu;
+        }
+    }
+
+    //! Configures scaling factor for conversion
+    void set_scale_factor(const size_t chan, const double scale_factor)
+    {
+        _converters[chan]->set_scalar(scale_factor);
+    }
+
+    //! Configures sample rate for conversion of timestamp
+    void set_samp_rate(const double rate)
+    {
+        _samp_rate = rate;
+        _zero_copy_streamer.set_samp_rate(rate);
+    }
+
+    //! Configures tick rate for conversion of timestamp
+    void set_tick_rate(const double rate)
+    {
+        _zero_copy_streamer.set_tick_rate(rate);
+    }
+
+    //! Called with the number of zeros sent by the padding task
+    using padding_handler_t = std::function<void(size_t)>;
+
+    /*! Start the task which sends zeros when send() is late, if the
+     *  auto_padding stream argument was given
+     *
+     * Only available if the transports provide get_fc_outstanding(). Derived
+     * classes must call stop_padding() before \p handler becomes invalid.
+     */
+    void start_padding(padding_handler_t handler)
+    {
+        if (_padding_time == 0.0) {
+            return;
+        }
+        _padding_handler = std::move(handler);
+        _padding_task    = uhd::task::make([this]() { _pad(); }, "uhd_tx_padding");
+        UHD_LOG_DEBUG("STREAMER",
+            "Padding TX bursts with less than " << _padding_time * 1e3
+                                                << " ms buffered on the device");
+    }
+
+    //! Stop the padding task, if there is one
+    void stop_padding()
+    {
+        _padding_task.reset();
+    }
+
+private:
+    //! Converter and associated item sizes
+    //! A waveform from register_waveform(), in the over-the-wire format
+    struct waveform_t
+    {
+        size_t num_samps = 0;
+        //! The number of samples per packet the waveform was converted for
+        size_t spp = 0;
+        //! The converted samples of each channel, one packet after the other
+        std::vector<std::vector<uint8_t>> buffs;
+    };
+
+    struct convert_info
+    {
+        size_t bytes_per_otw_item;
+        size_t bytes_per_cpu_item;
+        size_t otw_item_bit_width;
+        // The converter is a plain copy, so the samples can be used in place
+        bool is_copy;
+    };
+
+    /*!
+     * Send one buffer per channel, the common part of send() and send_many()
+     */
+    size_t _send(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const uhd::tx_metadata_t& metadata,
+        const int32_t timeout_ms)
+    {
+        if (!_resamplers.empty()) {
+            return _send_resampled(buffs, nsamps_per_buff, metadata, timeout_ms);
+        }
+        return _send_packets(buffs, nsamps_per_buff, metadata, timeout_ms);
+    }
+
+    /*!
+     * Resample the buffers, and send the outputs
+     *
+     * The input is resampled in chunks, which are then converted and sent
+     * while they are in the cache. Every chunk is a send of its own, with the
+     * time of its first output, which is derived from the time of the first
+     * send of the burst and the number of outputs since then. A timeout ends
+     * the burst for the resamplers.
+     *
+     * \returns the number of input samples which were sent
+     */
+    size_t _send_resampled(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const uhd::tx_metadata_t& metadata_,
+        const int32_t timeout_ms)
+    {
+        uhd::tx_metadata_t metadata(metadata_);
+        if (metadata.eov_positions_size > 0) {
+            throw uhd::value_error(
+                "[tx_stream] The host resampler does not support EOV positions");
+        }
+        if (nsamps_per_buff == 0 && metadata.start_of_burst) {
+            _metadata_cache.store(metadata);
+            return 0;
+        }
+        _metadata_cache.check(metadata);
+
+        if (metadata.start_of_burst || !_resamp_in_burst) {
+            for (auto& resampler : _resamplers) {
+                resampler->reset();
+            }
+            _resamp_in_burst   = true;
+            _resamp_has_time   = metadata.has_time_spec;
+            _resamp_start_time = metadata.time_spec;
+            _resamp_num_in     = 0;
+            _resamp_num_out    = 0;
+        } else if (metadata.has_time_spec) {
+            // A later time of the burst moves its start
+            _resamp_has_time   = true;
+            _resamp_start_time = metadata.time_spec - _get_input_time(_resamp_num_in);
+        }
+
+        size_t num_done = 0;
+        do {
+            const size_t num_samps =
+                std::min(detail::RESAMPLE_CHUNK_SIZE, nsamps_per_buff - num_done);
+            const bool eob =
+                metadata.end_of_burst && num_done + num_samps == nsamps_per_buff;
+            {
+                telemetry_timer timer(_convert_ns);
+                UHD_CYCLE_ACCOUNT(&_cycles, CONVERT);
+                _resample_job.buffs     = &buffs;
+                _resample_job.offset    = num_done;
+                _resample_job.num_samps = num_samps;
+                _resample_job.eob       = eob;
+                if (_convert_pool) {
+                    _convert_pool->run(get_num_ports(), _resample_job.fn);
+                } else {
+                    for (size_t i = 0; i < get_num_ports(); i++) {
+                        _resample_job.fn(i);
+                    }
+                }
+            }
+
+            // The first inputs of a burst may not have outputs yet
+            const size_t num_out = _resamp_num_chan_out;
+            if (num_out != 0 || eob) {
+                uhd::tx_metadata_t out_metadata;
+                out_metadata.has_time_spec = _resamp_has_time;
+                out_metadata.time_spec =
+                    _resamp_start_time
+                    + time_spec_t::from_ticks(
+                        static_cast<long long>(_resamp_num_out), _samp_rate);
+                out_metadata.end_of_burst = eob;
+                const size_t num_sent =
+                    _send_packets(_resamp_buffs, num_out, out_metadata, timeout_ms);
+                _resamp_num_out += num_sent;
+                if (num_sent < num_out) {
+                    _reset_resamplers();
+                    return num_done
+                           + std::min(num_samps,
+                               num_sent * _resamplers[0]->get_decim()
+                                   / _resamplers[0]->get_interp());
+                }
+            }
+            num_done += num_samps;
+            _resamp_num_in += num_samps;
+        } while (num_done < nsamps_per_buff);
+
+        if (metadata.end_of_burst) {
+            _resamp_in_burst = false;
+        }
+        return nsamps_per_buff;
+    }
+
+    //! Return the time of input sample \p num_in of the current burst,
+    // relative to its start
+    time_spec_t _get_input_time(const uint64_t num_in) const
+    {
+        // Input n is at output sample n * decim / interp, in whole samples
+        // and in fractions of a sample
+        const uint64_t interp    = _resamplers[0]->get_interp();
+        const uint64_t out_samps = num_in * _resamplers[0]->get_decim();
+        return time_spec_t::from_ticks(
+                   static_cast<long long>(out_samps / interp), _samp_rate)
+               + time_spec_t::from_ticks(
+                   static_cast<long long>(out_samps % interp), _samp_rate * interp);
+    }
+
+    //! Resample a chunk of the input of one channel
+    void _resample_chan(const size_t chan)
+    {
+        const auto* input = static_cast<const std::complex<float>*>(
+                                (*_resample_job.buffs)[chan])
+                            + _resample_job.offset;
+        auto* output   = _resamp_out[chan].data();
+        size_t num_out =
+            _resamplers[chan]->process(input, _resample_job.num_samps, output);
+        if (_resample_job.eob) {
+            num_out += _resamplers[chan]->flush(output + num_out);
+        }
+        if (chan == 0) {
+            _resamp_num_chan_out = num_out;
+        }
+    }
+
+    //! Start a new burst for the resamplers
+    void _reset_resamplers()
+    {
+        for (auto& resampler : _resamplers) {
+            resampler->reset();
+        }
+        _resamp_in_burst = false;
+    }
+
+    /*!
+     * Send one buffer per channel, converting it into packets
+     */
+    size_t _send_packets(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const uhd::tx_metadata_t& metadata_,
+        const int32_t timeout_ms)
+    {
         uhd::tx_metadata_t metadata(metadata_);
 
         if (nsamps_per_buff == 0 && metadata.start_of_burst) {
@@ -168,11 +737,10 @@ public:
         }
 
         _metadata_cache.check(metadata);
+        _zero_copy_streamer.begin_send(metadata);
 
         const bool eob_on_last_packet = metadata.end_of_burst;
 
-        const int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
-
         detail::tx_eov_data_wrapper eov_positions(metadata);
 
         // If there are EOVs specified in the metadata, it will be necessary
@@ -241,7 +809,7 @@ public:
                 _send_one_packet(_zero_buffs,
                     0, // buffer offset
                     1, // num samples
-                    metadata,
+                    metadata.end_of_burst,
                     false,
                     timeout_ms);
 
@@ -252,10 +820,12 @@ public:
                 metadata.end_of_burst =
                     (eob_on_last_packet and nsamps_to_send == nsamps_to_send_remaining);
 
-                num_samps_sent = _send_one_packet(
-                    buffs, total_nsamps_sent, nsamps_to_send, metadata, eov, timeout_ms);
-
-                metadata.start_of_burst = false;
+                num_samps_sent = _send_one_packet(buffs,
+                    total_nsamps_sent,
+                    nsamps_to_send,
+                    metadata.end_of_burst,
+                    eov,
+                    timeout_ms);
             } else {
                 // Note: since `nsamps_to_send` is guaranteed to be > _spp
                 // if the code reaches this else clause, `num_fragments` will
@@ -263,11 +833,11 @@ public:
                 const size_t num_fragments = (nsamps_to_send - 1) / _spp;
                 const size_t final_length  = ((nsamps_to_send - 1) % _spp) + 1;
 
-                metadata.end_of_burst = false;
-
+                // The timestamps of the fragments are advanced by the zero
+                // copy streamer, see begin_send()
                 for (size_t i = 0; i < num_fragments; i++) {
                     num_samps_sent = _send_one_packet(
-                        buffs, total_nsamps_sent, _spp, metadata, false, timeout_ms);
+                        buffs, total_nsamps_sent, _spp, false, false, timeout_ms);
 
                     // Advance sample accumulator and decrement remaining
                     // samples for this segment
@@ -277,23 +847,18 @@ public:
                     if (num_samps_sent == 0) {
                         return total_nsamps_sent;
                     }
-
-                    // Setup timespec for the next fragment
-                    if (metadata.has_time_spec) {
-                        metadata.time_spec =
-                            metadata.time_spec
-                            + time_spec_t::from_ticks(num_samps_sent, _samp_rate);
-                    }
-
-                    metadata.start_of_burst = false;
                 }
 
                 // Send the final fragment
                 metadata.end_of_burst =
                     (eob_on_last_packet and final_length == nsamps_to_send_remaining);
 
-                num_samps_sent = _send_one_packet(
-                    buffs, total_nsamps_sent, final_length, metadata, eov, timeout_ms);
+                num_samps_sent = _send_one_packet(buffs,
+                    total_nsamps_sent,
+                    final_length,
+                    metadata.end_of_burst,
+                    eov,
+                    timeout_ms);
             }
 
             // Advance sample accumulator and decrement remaining samples
@@ -306,15 +871,6 @@ public:
                 break;
             }
 
-            // If there are more samples to be sent, thus requiring another
-            // trip around the do/while loop, update the timespec in the
-            // metadata for the next fragment (if desired)
-            if (nsamps_to_send_remaining > 0 and metadata.has_time_spec) {
-                metadata.time_spec =
-                    metadata.time_spec
-                    + time_spec_t::from_ticks(num_samps_sent, _samp_rate);
-            }
-
             last_eov_position = total_nsamps_sent;
 
         } while (nsamps_to_send_remaining > 0);
@@ -322,92 +878,155 @@ public:
         return total_nsamps_sent;
     }
 
-protected:
-    //! Returns the tick rate for conversion of timestamp
-    double get_tick_rate() const
+    /*!
+     * Convert samples for one channel and sends a packet
+     *
+     * The packet starts at sample \p buffer_offset_in_samps of the send, so its
+     * timestamp is derived from the time passed to begin_send().
+     */
+    size_t _send_one_packet(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_in_samps,
+        const size_t num_samples,
+        const bool eob,
+        const bool eov,
+        const int32_t timeout_ms)
     {
-        return _zero_copy_streamer.get_tick_rate();
-    }
+        assert(buffs.size() == get_num_ports());
 
-    //! set maximum number of sample (per packet)
-    void set_max_num_samps(const size_t value)
-    {
-        _spp = value;
-    }
+        UHD_TRACE_POINT(tx_get_buffs_start, this, num_samples);
+        const bool got_buffs = _zero_copy_streamer.get_send_buffs(
+            _out_buffs, buffer_offset_in_samps, num_samples, eob, eov, timeout_ms);
+        UHD_TRACE_POINT(tx_get_buffs_done, this, got_buffs);
+        if (!got_buffs) {
+            return 0;
+        }
 
-    //! Returns the maximum payload size
-    size_t get_mtu() const
-    {
-        return _mtu;
-    }
+        size_t byte_offset = buffer_offset_in_samps * _convert_info.bytes_per_cpu_item;
 
-    //! Sets the MTU and checks spp. If spp would exceed the new MTU, it is
-    // reduced accordingly.
-    void set_mtu(const size_t mtu)
-    {
-        _mtu = mtu;
-        const size_t spp_from_mtu = (_mtu - _hdr_len) / _convert_info.bytes_per_otw_item;
-        if (spp_from_mtu < _spp) {
-            _spp = spp_from_mtu;
+        {
+            telemetry_timer timer(_convert_ns);
+            UHD_CYCLE_ACCOUNT(&_cycles, CONVERT);
+            if (_convert_pool) {
+                _convert_job.buffs       = &buffs;
+                _convert_job.byte_offset = byte_offset;
+                _convert_job.num_samps   = num_samples;
+                _convert_pool->run(get_num_ports(), _convert_job.fn);
+            } else {
+                for (size_t i = 0; i < get_num_ports(); i++) {
+                    const void* input_ptr =
+                        static_cast<const uint8_t*>(buffs[i]) + byte_offset;
+                    UHD_TRACE_POINT(tx_convert_start, this, i, num_samples);
+                    _converters[i]->conv(input_ptr, _out_buffs[i], num_samples);
+                    UHD_TRACE_POINT(tx_convert_done, this, i, num_samples);
+                }
+            }
         }
-    }
 
-    //! Configures scaling factor for conversion
-    void set_scale_factor(const size_t chan, const double scale_factor)
-    {
-        _converters[chan]->set_scalar(scale_factor);
+        // Buffers are released by this thread only, the transports are not
+        // thread-safe. Sending is not counted as conversion time.
+        UHD_TRACE_POINT(tx_send, this, num_samples);
+        for (size_t i = 0; i < get_num_ports(); i++) {
+            _zero_copy_streamer.release_send_buff(i);
+        }
+        _in_burst = !eob;
+
+        return num_samples;
     }
 
-    //! Configures sample rate for conversion of timestamp
-    void set_samp_rate(const double rate)
+    //! Lock the transports against the padding task, if there is one
+    std::unique_lock<std::mutex> _lock_transports()
     {
-        _samp_rate = rate;
+        return _padding_task ? std::unique_lock<std::mutex>(_padding_mutex)
+                             : std::unique_lock<std::mutex>();
     }
 
-    //! Configures tick rate for conversion of timestamp
-    void set_tick_rate(const double rate)
+    //! Send zeros while the device has less than _padding_time buffered in a burst
+    void _pad()
     {
-        _zero_copy_streamer.set_tick_rate(rate);
+        std::this_thread::sleep_for(std::chrono::duration<double>(_padding_time / 2));
+
+        std::unique_lock<std::mutex> lock(_padding_mutex);
+        if (!_in_burst || _send_buffs_acquired) {
+            return;
+        }
+        const uint64_t min_bytes = static_cast<uint64_t>(
+            _padding_time * _samp_rate * _convert_info.bytes_per_otw_item);
+        const tx_metadata_t metadata;
+        size_t num_samps = 0;
+        while (_zero_copy_streamer.get_min_fc_bytes_outstanding() < min_bytes) {
+            if (!_zero_copy_streamer.get_send_buffs(
+                    _out_buffs, _spp, metadata, false, 0)) {
+                break;
+            }
+            for (size_t i = 0; i < get_num_ports(); i++) {
+                std::memset(_out_buffs[i], 0, _spp * _convert_info.bytes_per_otw_item);
+                _zero_copy_streamer.release_send_buff(i);
+            }
+            num_samps += _spp;
+        }
+        lock.unlock();
+        if (num_samps != 0) {
+            _padding_handler(num_samps);
+        }
     }
 
-private:
-    //! Converter and associated item sizes
-    struct convert_info
+    //! Create the worker pool for multi-threaded conversion, if requested
+    void _setup_convert_pool(const size_t num_chans,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
     {
-        size_t bytes_per_otw_item;
-        size_t bytes_per_cpu_item;
-        size_t otw_item_bit_width;
-    };
+        const size_t num_threads =
+            std::min(args.cast<size_t>("convert_threads", 0), num_chans - 1);
+        if (num_chans < 2 || num_threads == 0) {
+            return;
+        }
+        _convert_job.fn = [this](const size_t chan) {
+            const void* input_ptr =
+                static_cast<const uint8_t*>((*_convert_job.buffs)[chan])
+                + _convert_job.byte_offset;
+            UHD_TRACE_POINT(tx_convert_start, this, chan, _convert_job.num_samps);
+            _converters[chan]->conv(input_ptr, _out_buffs[chan], _convert_job.num_samps);
+            UHD_TRACE_POINT(tx_convert_done, this, chan, _convert_job.num_samps);
+        };
+        _convert_pool.reset(new uhd::worker_pool(num_threads,
+            uhd::numa::get_convert_cpus(stream_args.args, num_threads),
+            "uhd_tx_conv"));
+        UHD_LOG_DEBUG("STREAMER",
+            "Converting " << num_chans << " TX channels on " << num_threads + 1
+                          << " threads");
+    }
 
-    //! Convert samples for one channel and sends a packet
-    size_t _send_one_packet(const uhd::tx_streamer::buffs_type& buffs,
-        const size_t buffer_offset_in_samps,
-        const size_t num_samples,
-        const tx_metadata_t& metadata,
-        const bool eov,
-        const int32_t timeout_ms)
+    //! Create the host resamplers, if requested
+    void _setup_resamplers(const size_t num_chans,
+        const uhd::stream_args_t& stream_args,
+        const uhd::args_view& args)
     {
-        assert(buffs.size() == get_num_channels());
-
-        if (!_zero_copy_streamer.get_send_buffs(
-                _out_buffs, num_samples, metadata, eov, timeout_ms)) {
-            return 0;
+        if (!args.has_key("host_resample_interp")
+            && !args.has_key("host_resample_decim")) {
+            return;
         }
-
-        size_t byte_offset = buffer_offset_in_samps * _convert_info.bytes_per_cpu_item;
-
-        for (size_t i = 0; i < get_num_channels(); i++) {
-            const void* input_ptr = static_cast<const uint8_t*>(buffs[i]) + byte_offset;
-            _converters[i]->conv(input_ptr, _out_buffs[i], num_samples);
-
-            _zero_copy_streamer.release_send_buff(i);
+        if (stream_args.cpu_format != "fc32") {
+            throw uhd::value_error("[tx_stream] The host resampler requires the fc32 CPU "
+                                   "format!");
         }
-
-        return num_samples;
+        const size_t interp = args.cast<size_t>("host_resample_interp", 1);
+        const size_t decim  = args.cast<size_t>("host_resample_decim", 1);
+        const size_t taps   = args.cast<size_t>(
+            "host_resample_taps", uhd::rfnoc::host_resampler::DEFAULT_TAPS_PER_PHASE);
+        for (size_t i = 0; i < num_chans; i++) {
+            _resamplers.push_back(uhd::rfnoc::host_resampler::make(interp, decim, taps));
+            _resamp_out.emplace_back(
+                _resamplers.back()->get_max_num_outputs(detail::RESAMPLE_CHUNK_SIZE));
+            _resamp_buffs.push_back(_resamp_out.back().data());
+        }
+        _resample_job.fn = [this](const size_t chan) { _resample_chan(chan); };
+        UHD_LOG_DEBUG("STREAMER",
+            "Resampling TX samples on the host by " << _resamplers[0]->get_interp() << "/"
+                                                    << _resamplers[0]->get_decim());
     }
 
     //! Create converters and initialize _bytes_per_cpu_item
-    void _setup_converters(const size_t num_chans, const uhd::stream_args_t stream_args)
+    void _setup_converters(const size_t num_chans, const uhd::stream_args_t& stream_args)
     {
         // Note to code archaeologists: In the past, we had to also specify the
         // endianness here, but that is no longer necessary because we can make
@@ -434,6 +1053,8 @@ private:
         } else {
             info.otw_item_bit_width = info.bytes_per_otw_item * 8;
         }
+        // The CHDR converters between a type and itself are a memcpy
+        info.is_copy = stream_args.otw_format == stream_args.cpu_format;
 
         _convert_info = info;
 
@@ -449,6 +1070,52 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // Arguments of the current multi-threaded conversion, and the function
+    // which converts one channel of it
+    struct
+    {
+        const uhd::tx_streamer::buffs_type* buffs = nullptr;
+        size_t byte_offset                        = 0;
+        size_t num_samps                          = 0;
+        std::function<void(size_t)> fn;
+    } _convert_job;
+
+    // Worker threads for multi-threaded conversion, or null if all channels
+    // are converted by the calling thread
+    uhd::worker_pool::uptr _convert_pool;
+
+    // Resamplers of the input, one per channel, or empty. Every chunk of the
+    // input is resampled into _resamp_out, which _resamp_buffs points to.
+    std::vector<uhd::rfnoc::host_resampler::sptr> _resamplers;
+    std::vector<std::vector<std::complex<float>>> _resamp_out;
+    std::vector<const void*> _resamp_buffs;
+    // The chunk to resample, and the function which resamples one channel
+    struct
+    {
+        const uhd::tx_streamer::buffs_type* buffs = nullptr;
+        size_t offset                             = 0;
+        size_t num_samps                          = 0;
+        bool eob                                  = false;
+        std::function<void(size_t)> fn;
+    } _resample_job;
+    // The number of outputs of the last chunk
+    size_t _resamp_num_chan_out = 0;
+    // The time of the start of the current burst, and the number of inputs
+    // and outputs of the burst so far
+    bool _resamp_in_burst    = false;
+    bool _resamp_has_time    = false;
+    uint64_t _resamp_num_in  = 0;
+    uint64_t _resamp_num_out = 0;
+    time_spec_t _resamp_start_time;
+
+    // Time spent in the converters
+    telemetry_counter _convert_ns;
+
+    // Cycles spent in send(), by stage. The zero copy streamer and the
+    // transports hold pointers to it, so it is declared before (and destroyed
+    // after) them.
+    cycle_accounting _cycles;
+
     // Manages frame buffers and packet info
     tx_streamer_zero_copy<transport_t> _zero_copy_streamer;
 
@@ -477,6 +1144,27 @@ private:
     // Metadata cache for send calls with no data
     detail::tx_metadata_cache _metadata_cache;
 
+    // Waveforms from register_waveform(), by their ID
+    std::map<size_t, waveform_t> _waveforms;
+    size_t _next_waveform_id = 0;
+
+    // True between get_send_buffs() and commit_send_buffs(), and the
+    // has_time_spec value the payload pointers were calculated for
+    bool _send_buffs_acquired      = false;
+    bool _send_buffs_has_time_spec = false;
+
+    // Automatic padding (see the auto_padding stream argument): The task sends
+    // zeros while the device has less than _padding_time seconds of samples
+    // buffered within a burst. While it runs, _padding_mutex protects the
+    // transports, which are not thread-safe.
+    double _padding_time = 0.0;
+    padding_handler_t _padding_handler;
+    std::mutex _padding_mutex;
+    uhd::task::sptr _padding_task;
+
+    // True if the last packet sent did not end its burst
+    bool _in_burst = false;
+
     // Store a list of channels that are already connected
     std::vector<bool> _chans_connected;
 
@@ -9,6 +9,10 @@
 #include <uhd/config.hpp>
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -56,10 +60,31 @@ public:
         return _tick_rate;
     }
 
+    /*!
+     * Prepares the streamer for a new stream session
+     *
+     * Makes the transports resynchronize their flow control counts with the
+     * device. Requires transports with a request_fc_resync() method.
+     */
+    void reset_stream_state()
+    {
+        for (auto& xport : _xports) {
+            xport->request_fc_resync();
+        }
+    }
+
     //! Configures tick rate for conversion of timestamp
     void set_tick_rate(const double rate)
     {
         _tick_rate = rate;
+        _update_ticks_per_samp();
+    }
+
+    //! Configures sample rate for the timestamps of the packets of a send
+    void set_samp_rate(const double rate)
+    {
+        _samp_rate = rate;
+        _update_ticks_per_samp();
     }
 
     //! Configures the size of each sample
@@ -68,6 +93,12 @@ public:
         _bytes_per_item = bpi;
     }
 
+    //! Configures the accounting of the cycles of the sends, or nullptr
+    void set_cycle_accounting(cycle_accounting* cycles)
+    {
+        _cycles = cycles;
+    }
+
     /*!
      * Gets a set of frame buffers, one per channel.
      *
@@ -83,20 +114,132 @@ public:
         const tx_metadata_t& metadata,
         const bool eov,
         const int32_t timeout_ms)
+    {
+        if (!get_frame_buffs(timeout_ms)) {
+            return false;
+        }
+        write_packet_headers(buffs, nsamps_per_buff, metadata, eov);
+        return true;
+    }
+
+    /*!
+     * Starts the packet headers of a send, which may be split into several
+     * packets
+     *
+     * The headers of the packets of a send only differ in their payload sizes,
+     * EOB and EOV flags, and timestamps. So the timestamp of the first sample
+     * is converted to ticks once, here. If the tick rate is an integer multiple
+     * of the sample rate, the timestamps of the following packets are advanced
+     * in whole ticks, without any time_spec_t math.
+     *
+     * \param metadata the metadata of the send, whose time_spec is the time of
+     *                 the first sample
+     */
+    UHD_FORCE_INLINE void begin_send(const tx_metadata_t& metadata)
+    {
+        UHD_CYCLE_ACCOUNT(_cycles, METADATA);
+        _send_info.has_tsf = metadata.has_time_spec;
+        if (metadata.has_time_spec) {
+            _send_time     = metadata.time_spec;
+            _send_info.tsf = metadata.time_spec.to_ticks(_tick_rate);
+        }
+    }
+
+    /*!
+     * Gets a set of frame buffers, one per channel, for a packet of the send
+     * started with begin_send()
+     *
+     * \param buffs returns a pointer to the buffer data
+     * \param samp_offset the offset of the first sample of the packet in the send
+     * \param nsamps_per_buff the number of samples that will be written to each buffer
+     * \param eob EOB flag to write to the packet header
+     * \param eov EOV flag to write to the packet header
+     * \param timeout_ms timeout in milliseconds
+     * \return true if the operation was sucessful, false if timeout occurs
+     */
+    UHD_FORCE_INLINE bool get_send_buffs(std::vector<void*>& buffs,
+        const size_t samp_offset,
+        const size_t nsamps_per_buff,
+        const bool eob,
+        const bool eov,
+        const int32_t timeout_ms)
+    {
+        UHD_CYCLE_ACCOUNT(_cycles, METADATA);
+        if (!get_frame_buffs(timeout_ms)) {
+            return false;
+        }
+
+        typename transport_t::packet_info_t info = _send_info;
+        if (info.has_tsf && samp_offset != 0) {
+            if (_ticks_per_samp != 0) {
+                info.tsf += samp_offset * _ticks_per_samp;
+            } else {
+                const time_spec_t time =
+                    _send_time + time_spec_t::from_ticks(samp_offset, _samp_rate);
+                info.tsf = time.to_ticks(_tick_rate);
+            }
+        }
+        info.payload_bytes = nsamps_per_buff * _bytes_per_item;
+        info.eob           = eob;
+        info.eov           = eov;
+        _write_packet_headers(buffs, nsamps_per_buff, info);
+        return true;
+    }
+
+    /*!
+     * Gets a set of frame buffers, one per channel, without writing the
+     * packet headers.
+     *
+     * \param timeout_ms timeout in milliseconds
+     * \return true if the operation was sucessful, false if timeout occurs
+     */
+    UHD_FORCE_INLINE bool get_frame_buffs(const int32_t timeout_ms)
     {
         // Try to get a buffer per channel
-        for (; _next_buff_to_get < _xports.size(); _next_buff_to_get++) {
-            _frame_buffs[_next_buff_to_get].first =
-                _xports[_next_buff_to_get]->get_send_buff(timeout_ms);
+        {
+            telemetry_timer timer(_buff_wait_ns);
+            UHD_CYCLE_ACCOUNT(_cycles, BUFF_WAIT);
+            for (; _next_buff_to_get < _xports.size(); _next_buff_to_get++) {
+                _frame_buffs[_next_buff_to_get].first =
+                    _xports[_next_buff_to_get]->get_send_buff(timeout_ms);
 
-            if (!_frame_buffs[_next_buff_to_get].first) {
-                return false;
+                if (!_frame_buffs[_next_buff_to_get].first) {
+                    return false;
+                }
             }
         }
 
         // Got all the buffers, start from index 0 next call
         _next_buff_to_get = 0;
+        return true;
+    }
+
+    /*!
+     * Returns where the payload of the frame buffer of a channel starts,
+     * before its packet header is written
+     *
+     * \param channel the channel of the frame buffer
+     * \param has_tsf whether the packet will have a timestamp
+     */
+    UHD_FORCE_INLINE void* get_payload_ptr(const size_t channel, const bool has_tsf)
+    {
+        return _xports[channel]->get_payload_ptr(_frame_buffs[channel].first, has_tsf);
+    }
 
+    /*!
+     * Writes the packet headers to the frame buffers from get_frame_buffs()
+     *
+     * \param buffs returns a pointer to the buffer data
+     * \param nsamps_per_buff the number of samples that will be written to each buffer
+     * \param metadata the metadata to write to the packet header
+     * \param eov EOV flag to write to the packet header
+     */
+    UHD_FORCE_INLINE void write_packet_headers(std::vector<void*>& buffs,
+        const size_t nsamps_per_buff,
+        const tx_metadata_t& metadata,
+        const bool eov)
+    {
+        UHD_CYCLE_ACCOUNT(_cycles, METADATA);
         // Store portions of metadata we care about
         typename transport_t::packet_info_t info;
         info.has_tsf = metadata.has_time_spec;
@@ -108,14 +251,7 @@ public:
         info.payload_bytes = nsamps_per_buff * _bytes_per_item;
         info.eob           = metadata.end_of_burst;
         info.eov           = eov;
-
-        // Write packet header
-        for (size_t i = 0; i < buffs.size(); i++) {
-            std::tie(buffs[i], _frame_buffs[i].second) =
-                _xports[i]->write_packet_header(_frame_buffs[i].first, info);
-        }
-
-        return true;
+        _write_packet_headers(buffs, nsamps_per_buff, info);
     }
 
     /*!
@@ -132,7 +268,93 @@ public:
         _frame_buffs[channel].second = 0;
     }
 
+    /*!
+     * Read the packet counters and the time spent waiting for buffers
+     *
+     * May be called from any thread.
+     */
+    void get_telemetry(stream_telemetry_t& telemetry) const
+    {
+        telemetry.packets      = _packets.get();
+        telemetry.samples      = _samples.get();
+        telemetry.buff_wait_ns = _buff_wait_ns.get();
+    }
+
+    /*!
+     * Read the flow control state and the buffering of the transports
+     *
+     * May be called from any thread, once all channels are connected. Requires
+     * transports with a thread-safe get_fc_outstanding() method, and with
+     * get_fc_capacity(), get_num_frames() and get_mtu().
+     */
+    void get_fc_telemetry(stream_telemetry_t& telemetry) const
+    {
+        telemetry.fc_bytes_outstanding   = 0;
+        telemetry.fc_packets_outstanding = 0;
+        for (const auto& xport : _xports) {
+            const auto counts = xport->get_fc_outstanding();
+            telemetry.fc_bytes_outstanding += counts.bytes;
+            telemetry.fc_packets_outstanding += counts.packets;
+            telemetry.xport_fc_window_bytes = std::max<uint64_t>(
+                telemetry.xport_fc_window_bytes, xport->get_fc_capacity().bytes);
+            telemetry.xport_num_frames =
+                std::max<uint64_t>(telemetry.xport_num_frames, xport->get_num_frames());
+            telemetry.xport_frame_size =
+                std::max<uint64_t>(telemetry.xport_frame_size, xport->get_mtu());
+        }
+    }
+
+    /*!
+     * Append the frames of the links of all channels to \p memory
+     *
+     * Requires transports with get_link_memory(), and all channels connected.
+     */
+    void get_link_memory(stream_memory_t& memory) const
+    {
+        for (const auto& xport : _xports) {
+            memory.links.push_back(xport->get_link_memory());
+        }
+    }
+
+    /*!
+     * Return the flow control bytes outstanding of the transport which has the
+     * fewest, i.e., how much the device has buffered at least
+     *
+     * Has the same requirements as get_fc_telemetry().
+     */
+    uint64_t get_min_fc_bytes_outstanding() const
+    {
+        uint64_t min_bytes = std::numeric_limits<uint64_t>::max();
+        for (const auto& xport : _xports) {
+            min_bytes = std::min<uint64_t>(min_bytes, xport->get_fc_outstanding().bytes);
+        }
+        return min_bytes;
+    }
+
 private:
+    UHD_FORCE_INLINE void _write_packet_headers(std::vector<void*>& buffs,
+        const size_t nsamps_per_buff,
+        const typename transport_t::packet_info_t& info)
+    {
+        for (size_t i = 0; i < buffs.size(); i++) {
+            std::tie(buffs[i], _frame_buffs[i].second) =
+                _xports[i]->write_packet_header(_frame_buffs[i].first, info);
+        }
+
+        _packets.add(buffs.size());
+        _samples.add(nsamps_per_buff);
+    }
+
+    //! Use whole ticks per sample if the rates allow it, or 0 if they don't
+    void _update_ticks_per_samp()
+    {
+        const double ratio   = _tick_rate / _samp_rate;
+        const double rounded = std::round(ratio);
+        const bool is_integer =
+            rounded >= 1.0 && std::abs(ratio - rounded) < 1e-9 * ratio;
+        _ticks_per_samp = is_integer ? static_cast<uint64_t>(rounded) : 0;
+    }
+
     // Transports for each channel
     std::vector<typename transport_t::uptr> _xports;
 
@@ -142,12 +364,31 @@ private:
     // Rate used in conversion of timestamp to time_spec_t
     double _tick_rate = 1.0;
 
+    // Rate used to advance the timestamps of the packets of a send
+    double _samp_rate = 1.0;
+
+    // Ticks per sample, or 0 if the tick rate isn't an integer multiple of the
+    // sample rate
+    uint64_t _ticks_per_samp = 1;
+
+    // Header info and time of the first packet of the current send
+    typename transport_t::packet_info_t _send_info;
+    time_spec_t _send_time;
+
     // Size of a sample on the device
     size_t _bytes_per_item = 0;
 
     // Next channel from which to get a buffer, stored as a member to
     // allow the streamer to continue where it stopped due to timeouts.
     size_t _next_buff_to_get = 0;
+
+    // Telemetry, updated by the thread calling get_send_buffs()
+    telemetry_counter _packets;
+    telemetry_counter _samples;
+    telemetry_counter _buff_wait_ns;
+
+    // Accounting of the cycles of the sends, owned by the streamer
+    cycle_accounting* _cycles = nullptr;
 };
 
 }} // namespace uhd::transport
@@ -0,0 +1,262 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <boost/asio.hpp>
+#include <linux/bpf.h>
+#include <xdp/xsk.h>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+class udp_af_xdp_frame_buff : public frame_buff
+{
+public:
+    //! Marks a frame buffer that currently does not own a UMEM frame
+    static constexpr uint64_t NO_FRAME = ~uint64_t(0);
+
+    /*! Point this frame buffer at the payload of a UMEM frame
+     *
+     * \param data Pointer to the UDP payload
+     * \param umem_addr Offset of the UMEM frame which contains \p data
+     */
+    void set_frame(void* data, uint64_t umem_addr)
+    {
+        _data      = data;
+        _umem_addr = umem_addr;
+    }
+
+    uint64_t get_umem_addr() const
+    {
+        return _umem_addr;
+    }
+
+private:
+    uint64_t _umem_addr = NO_FRAME;
+};
+
+class udp_af_xdp_adapter_info : public adapter_info
+{
+public:
+    udp_af_xdp_adapter_info(const std::string& ifname) : _ifname(ifname) {}
+
+    ~udp_af_xdp_adapter_info() {}
+
+    std::string to_string() override
+    {
+        return std::string("Ethernet(af_xdp):") + _ifname;
+    }
+
+    int get_numa_node() override
+    {
+        return uhd::numa::get_ifname_node(_ifname);
+    }
+
+    bool operator==(const udp_af_xdp_adapter_info& rhs) const
+    {
+        return (_ifname == rhs._ifname);
+    }
+
+private:
+    std::string _ifname;
+};
+
+/*!
+ * A zero copy UDP link based on AF_XDP sockets.
+ *
+ * The link binds an AF_XDP socket to a single receive queue of the NIC which
+ * carries the traffic to the local IP address. Frames are exchanged with the
+ * driver through a UMEM region that is shared between the kernel and this
+ * link, so the network stack is bypassed for this queue only; the interface
+ * and all its other queues remain available to the kernel.
+ *
+ * A kernel UDP socket is opened alongside the AF_XDP socket. It reserves the
+ * local UDP port, and it is used to determine the interface, the local IP
+ * address and the MAC address of the remote device. The link attempts to
+ * install an ntuple flow steering rule which directs the traffic for its
+ * local port to its queue, and removes it again on destruction.
+ */
+class udp_af_xdp_link : public recv_link_base<udp_af_xdp_link>,
+                        public send_link_base<udp_af_xdp_link>
+{
+public:
+    using sptr = std::shared_ptr<udp_af_xdp_link>;
+
+    //! Size of the Ethernet, IPv4 and UDP headers of every frame
+    static constexpr size_t HDR_LEN = 14 + 20 + 8;
+
+    //! Size of a UMEM frame. Every packet must fit into a single frame.
+    static constexpr size_t UMEM_FRAME_SIZE = XSK_UMEM__DEFAULT_FRAME_SIZE;
+
+    //! Largest UDP payload which fits into a UMEM frame, after the headroom
+    //  the kernel reserves for XDP
+    static constexpr size_t MAX_FRAME_SIZE =
+        UMEM_FRAME_SIZE - XDP_PACKET_HEADROOM - HDR_LEN;
+
+    ~udp_af_xdp_link();
+
+    /*!
+     * Make a new AF_XDP link.
+     *
+     * The link uses the first queue of \p queues that is not already in use
+     * by another AF_XDP link on the same interface.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes and num frames. The frame sizes
+     *        are limited to what fits into a UMEM frame.
+     * \param queues The NIC queues this link may bind to
+     * \return a shared_ptr to a new link
+     * \throws uhd::runtime_error if the link cannot be created, e.g., because
+     *         all queues are in use or the process lacks CAP_NET_ADMIN
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const std::vector<uint32_t>& queues);
+
+    /*! Return the local port of the UDP connection. Port is in host byte order.
+     */
+    uint16_t get_local_port() const;
+
+    //! Return the name of the network interface used by this link
+    std::string get_ifname() const
+    {
+        return _ifname;
+    }
+
+    //! Return the NIC queue this link is bound to
+    uint32_t get_queue_id() const
+    {
+        return _queue_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<udp_af_xdp_link>;
+    using send_link_base_t = send_link_base<udp_af_xdp_link>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    udp_af_xdp_link(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const std::vector<uint32_t>& queues);
+
+    //! Free all kernel resources (flow rule, socket, UMEM, queue)
+    void release_resources();
+
+    //! Look up the interface, queue and MAC addresses for this link
+    void init_addresses(const std::vector<uint32_t>& queues);
+
+    //! Create the UMEM and the AF_XDP socket, and fill the fill ring
+    void init_xsk();
+
+    //! Steer the traffic for our local port to our queue, if the NIC allows it
+    void add_flow_rule();
+
+    //! Wake up the driver if it asked for it (XDP_USE_NEED_WAKEUP)
+    void kick_tx();
+
+    //! Move completed TX frames back onto the list of free TX frames
+    void reap_tx_completions();
+
+    // Methods called by recv_link_base
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms);
+
+    UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& buff)
+    {
+        auto& xdp_buff = static_cast<udp_af_xdp_frame_buff&>(buff);
+        uint32_t idx;
+        // The fill ring can hold every RX frame, so this cannot fail
+        xsk_ring_prod__reserve(&_fill_ring, 1, &idx);
+        *xsk_ring_prod__fill_addr(&_fill_ring, idx) = xdp_buff.get_umem_addr();
+        xsk_ring_prod__submit(&_fill_ring, 1);
+        xdp_buff.set_frame(nullptr, udp_af_xdp_frame_buff::NO_FRAME);
+    }
+
+    // Methods called by send_link_base
+    bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms);
+
+    void release_send_buff_derived(frame_buff& buff);
+
+    // Connected kernel socket, owns the local port
+    boost::asio::io_service _io_service;
+    std::shared_ptr<boost::asio::ip::udp::socket> _socket;
+
+    std::string _ifname;
+    uint32_t _queue_id = 0;
+    // Location of our ntuple rule, or -1 if none was installed
+    int64_t _flow_rule_loc = -1;
+
+    // In network order
+    uint32_t _local_ipv4  = 0;
+    uint32_t _remote_ipv4 = 0;
+    uint16_t _local_port  = 0;
+    uint16_t _remote_port = 0;
+    uint8_t _local_mac[6];
+    uint8_t _remote_mac[6];
+    bool _queue_claimed = false;
+
+    // Headers of outgoing frames, only the lengths and checksum change
+    std::array<uint8_t, HDR_LEN> _tx_hdr;
+
+    // UMEM layout: The first _num_rx_umem_frames frames are for RX, the
+    // remaining num_send_frames frames for TX
+    void* _umem_area           = nullptr;
+    size_t _umem_size          = 0;
+    size_t _num_rx_umem_frames = 0;
+    xsk_umem* _umem            = nullptr;
+    xsk_socket* _xsk           = nullptr;
+    int _xsk_fd                = -1;
+    bool _zero_copy            = false;
+    xsk_ring_prod _fill_ring;
+    xsk_ring_cons _comp_ring;
+    xsk_ring_cons _rx_ring;
+    xsk_ring_prod _tx_ring;
+
+    // TX frames neither owned by a frame buffer nor in flight
+    std::vector<uint64_t> _tx_free_frames;
+    size_t _tx_in_flight = 0;
+
+    // Number of received frames which were not for this link
+    size_t _num_rx_dropped = 0;
+
+    std::vector<udp_af_xdp_frame_buff> _recv_buffs;
+    std::vector<udp_af_xdp_frame_buff> _send_buffs;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
@@ -10,9 +10,11 @@
 #include <uhd/transport/buffer_pool.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/io_uring_recv.hpp>
 #include <uhdlib/transport/link_base.hpp>
 #include <uhdlib/transport/links.hpp>
 #include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/utils/numa.hpp>
 #include <boost/asio.hpp>
 #include <memory>
 #include <vector>
@@ -26,6 +28,16 @@ public:
     {
         _data = mem;
     }
+
+    /*! Point this frame buffer at different memory
+     *
+     * Used by batched receives to hand out frames that were received into
+     * memory other than that of the frame buffer being requested.
+     */
+    void set_data(void* mem)
+    {
+        _data = mem;
+    }
 };
 
 class udp_boost_asio_adapter_info : public adapter_info
@@ -43,6 +55,11 @@ public:
         return std::string("Ethernet(kernel):") + _src_ip.to_string();
     }
 
+    int get_numa_node() override
+    {
+        return uhd::numa::get_ipv4_node(_src_ip.to_string());
+    }
+
     bool operator==(const udp_boost_asio_adapter_info& rhs) const
     {
         return (_src_ip == rhs._src_ip);
@@ -117,9 +134,29 @@ private:
     size_t resize_recv_socket_buffer(size_t num_bytes);
     size_t resize_send_socket_buffer(size_t num_bytes);
 
+    /*! Receive a frame into \p buff, fetching up to _recv_batch_size frames
+     *  from the socket per system call
+     *
+     * If frames from a previous batch are still pending, the next one is
+     * handed out by swapping the memory of \p buff with that of the pending
+     * frame. Otherwise, a new batch is received into the memory of \p buff
+     * plus the _recv_batch_size - 1 spare frames owned by the batch.
+     */
+    size_t recv_batched(udp_boost_asio_frame_buff& buff, int32_t timeout_ms);
+
     // Methods called by recv_link_base
     UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
     {
+        if (_io_uring) {
+            void* mem        = buff.data();
+            const size_t len = _io_uring->recv(mem, timeout_ms);
+            static_cast<udp_boost_asio_frame_buff&>(buff).set_data(mem);
+            return len;
+        }
+        if (_recv_batch_size > 1) {
+            return recv_batched(
+                static_cast<udp_boost_asio_frame_buff&>(buff), timeout_ms);
+        }
         return recv_udp_packet(_sock_fd, buff.data(), get_recv_frame_size(), timeout_ms);
     }
 
@@ -146,10 +183,23 @@ private:
     std::vector<udp_boost_asio_frame_buff> _recv_buffs;
     std::vector<udp_boost_asio_frame_buff> _send_buffs;
 
+    // Batched receive state. Slot 0 of _recv_batch_mem is only used during
+    // a receive call; the other slots hold either spare frame memory or
+    // the frames of the current batch that were not yet handed out.
+    size_t _recv_batch_size = 1;
+    std::vector<void*> _recv_batch_mem;
+    std::vector<size_t> _recv_batch_len;
+    size_t _recv_batch_next  = 0;
+    size_t _recv_batch_count = 0;
+
     boost::asio::io_service _io_service;
     std::shared_ptr<boost::asio::ip::udp::socket> _socket;
     int _sock_fd;
     adapter_id_t _adapter_id;
+
+    // Receives through an io_uring, if enabled. It owns some frames of
+    // _recv_memory_pool, and must be destroyed before the pool and the socket.
+    io_uring_recv::uptr _io_uring;
 };
 
 }} // namespace uhd::transport
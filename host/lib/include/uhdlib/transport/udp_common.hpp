@@ -13,10 +13,13 @@
 #include <uhd/rfnoc/constants.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/transport/links.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <boost/asio.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <cmath>
 #include <thread>
 
 namespace uhd { namespace transport {
@@ -199,6 +202,109 @@ UHD_INLINE size_t resize_udp_socket_buffer_with_warning(
     return actual_size;
 }
 
+/*!
+ * Sizes the buffers of a UDP CHDR data link for a data rate and a round trip
+ * time, instead of using the fixed defaults of the device.
+ *
+ * The buffer has to hold the data which is in flight during one round trip,
+ * so flow control credits get back before the sender runs out of them, plus
+ * the data which arrives while the host stalls for up to \p latency. The
+ * frames cover one round trip worth of data, unless \p frames_buffer is set
+ * (for links without a socket buffer, such as DPDK and AF_XDP), in which case
+ * they have to hold the whole buffer. Otherwise, the number of frames of
+ * \p link_params is the minimum. The frame sizes are not changed.
+ *
+ * \param link_params the default values to adjust
+ * \param link_type the link type; only RX and TX data links are adjusted
+ * \param rate the data rate in bytes per second
+ * \param rtt the round trip time in seconds
+ * \param latency the longest stall of the host to absorb, in seconds
+ * \param frames_buffer true if the frames are the only buffer of the link
+ */
+inline void auto_tune_udp_link_params(link_params_t& link_params,
+    const uhd::transport::link_type_t link_type,
+    const double rate,
+    const double rtt,
+    const double latency,
+    const bool frames_buffer)
+{
+    auto tune = [&](size_t& buff_size, size_t& num_frames, const size_t frame_size) {
+        const size_t min_buff_size = uhd::rfnoc::MIN_NUM_FRAMES * frame_size;
+        buff_size                  = std::max(
+            min_buff_size, static_cast<size_t>(std::ceil(rate * (rtt + latency))));
+        const size_t buff_frames = (buff_size + frame_size - 1) / frame_size;
+        const size_t rtt_frames =
+            static_cast<size_t>(std::ceil(rate * rtt / double(frame_size)));
+        num_frames = frames_buffer ? buff_frames : std::max(num_frames, rtt_frames);
+    };
+    if (link_type == link_type_t::RX_DATA) {
+        tune(link_params.recv_buff_size,
+            link_params.num_recv_frames,
+            link_params.recv_frame_size);
+    } else if (link_type == link_type_t::TX_DATA) {
+        tune(link_params.send_buff_size,
+            link_params.num_send_frames,
+            link_params.send_frame_size);
+    }
+}
+
+/*!
+ * Sizes the frames of a UDP CHDR data link to fit a memory budget
+ *
+ * The other direction of the link only carries flow control packets, so it
+ * keeps MIN_NUM_FRAMES frames at most, and the direction of the data gets the
+ * rest of the budget, but at least MIN_NUM_FRAMES frames. An explicit number
+ * of frames in \p link_args takes precedence. If the frames are the only
+ * buffer of the link, the buffer shrinks with them, so the device never sends
+ * more than the frames hold. Socket buffers of the kernel are not part of the
+ * budget.
+ *
+ * \param link_params the values to adjust
+ * \param link_type the link type; only RX and TX data links are adjusted
+ * \param budget the memory for all frames of the link, in bytes
+ * \param link_args argument dictionary with stream-level overrides
+ * \param frames_buffer true if the frames are the only buffer of the link
+ */
+inline void apply_udp_link_memory_budget(link_params_t& link_params,
+    const uhd::transport::link_type_t link_type,
+    const uint64_t budget,
+    const uhd::device_addr_t& link_args,
+    const bool frames_buffer)
+{
+    auto fit = [&](size_t& num_frames,
+                   const size_t frame_size,
+                   size_t& buff_size,
+                   size_t& num_fc_frames,
+                   const size_t fc_frame_size,
+                   const bool explicit_frames) {
+        num_fc_frames = std::min(num_fc_frames, uhd::rfnoc::MIN_NUM_FRAMES);
+        if (!explicit_frames) {
+            const uint64_t fc_bytes = uint64_t(num_fc_frames) * fc_frame_size;
+            num_frames              = std::max(uhd::rfnoc::MIN_NUM_FRAMES,
+                static_cast<size_t>((budget > fc_bytes ? budget - fc_bytes : 0)
+                                    / frame_size));
+        }
+        if (frames_buffer) {
+            buff_size = std::min(buff_size, num_frames * frame_size);
+        }
+    };
+    if (link_type == link_type_t::RX_DATA) {
+        fit(link_params.num_recv_frames,
+            link_params.recv_frame_size,
+            link_params.recv_buff_size,
+            link_params.num_send_frames,
+            link_params.send_frame_size,
+            link_args.has_key("num_recv_frames"));
+    } else if (link_type == link_type_t::TX_DATA) {
+        fit(link_params.num_send_frames,
+            link_params.send_frame_size,
+            link_params.send_buff_size,
+            link_params.num_recv_frames,
+            link_params.recv_frame_size,
+            link_args.has_key("num_send_frames"));
+    }
+}
+
 /*!
  * Determines a set of values to use for a UDP CHDR link based on defaults and
  * any overrides that the user may have provided. In cases where both device
@@ -243,6 +349,14 @@ inline link_params_t calculate_udp_link_params(
         device_args.cast<size_t>("send_buff_size", default_link_params.send_buff_size);
     link_params.recv_buff_size =
         device_args.cast<size_t>("recv_buff_size", default_link_params.recv_buff_size);
+    link_params.recv_batch_size =
+        device_args.cast<size_t>("recv_batch_size", default_link_params.recv_batch_size);
+    link_params.numa_node =
+        device_args.cast<int>("numa_node", default_link_params.numa_node);
+    link_params.use_hugepages =
+        device_args.cast<bool>("use_hugepages", default_link_params.use_hugepages);
+    link_params.use_io_uring =
+        device_args.cast<bool>("use_io_uring", default_link_params.use_io_uring);
 
     // Now apply stream-level overrides based on the link type.
     if (link_type == link_type_t::CTRL) {
@@ -269,6 +383,15 @@ inline link_params_t calculate_udp_link_params(
             link_args.cast<size_t>("num_recv_frames", link_params.num_recv_frames);
         link_params.recv_buff_size =
             link_args.cast<size_t>("recv_buff_size", link_params.recv_buff_size);
+        link_params.recv_batch_size =
+            link_args.cast<size_t>("recv_batch_size", link_params.recv_batch_size);
+        link_params.use_io_uring =
+            link_args.cast<bool>("use_io_uring", link_params.use_io_uring);
+    }
+    if (link_type != link_type_t::RX_DATA) {
+        // Only RX data links receive enough packets for batching to pay off
+        link_params.recv_batch_size = 1;
+        link_params.use_io_uring    = false;
     }
 
 #if defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
@@ -13,6 +13,7 @@
 #include <uhdlib/transport/link_if.hpp>
 #include <uhdlib/transport/links.hpp>
 #include <rte_udp.h>
+#include <array>
 #include <cassert>
 #include <string>
 #include <vector>
@@ -203,10 +204,19 @@ public:
     /*!
      * Release a frame buffer, allowing the link driver to reuse it.
      *
+     * The rte_mbufs are returned to the mempool in batches. Until a batch is
+     * full, they are only collected, so call flush_recv_buffs() once done
+     * releasing a burst of buffers.
+     *
      * \param buffer frame buffer to release for reuse by the link
      */
     void release_recv_buff(frame_buff::uptr buff);
 
+    /*!
+     * Return all rte_mbufs collected by release_recv_buff() to the mempool
+     */
+    void flush_recv_buffs();
+
     /*!
      * Get an empty frame buffer in which to write packet contents.
      *
@@ -257,7 +267,12 @@ private:
     adapter_id_t _adapter_id;
     //! The RX frame buff list head
     dpdk::dpdk_frame_buff* _recv_buff_head = nullptr;
-    // TODO: Implement ability to use multiple queues
+    //! Maximum number of released RX mbufs to return to the mempool at once
+    static constexpr size_t RECV_FREE_BURST_SIZE = 32;
+    //! Released RX mbufs which were not yet returned to the mempool
+    std::array<struct rte_mbuf*, RECV_FREE_BURST_SIZE> _recv_free_mbufs;
+    size_t _num_recv_free_mbufs = 0;
+    //! The DMA queue for this link, which also selects its I/O service
     dpdk::queue_id_t _queue = 0;
 };
 
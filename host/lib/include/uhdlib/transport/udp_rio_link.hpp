@@ -0,0 +1,222 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <winsock2.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+// Needs the types of winsock2.h
+#include <mswsock.h>
+
+namespace uhd { namespace transport {
+
+class udp_rio_frame_buff : public frame_buff
+{
+public:
+    /*! Point this frame buffer at a frame of the registered buffer region
+     *
+     * \param data Pointer to the frame
+     * \param index Index of the frame in the region
+     */
+    void set_frame(void* data, size_t index)
+    {
+        _data  = data;
+        _index = index;
+    }
+
+    size_t get_index() const
+    {
+        return _index;
+    }
+
+private:
+    size_t _index = 0;
+};
+
+class udp_rio_adapter_info : public adapter_info
+{
+public:
+    udp_rio_adapter_info(const std::string& src_ip) : _src_ip(src_ip) {}
+
+    ~udp_rio_adapter_info() {}
+
+    std::string to_string() override
+    {
+        return std::string("Ethernet(rio):") + _src_ip;
+    }
+
+    int get_numa_node() override
+    {
+        return uhd::numa::get_ipv4_node(_src_ip);
+    }
+
+    bool operator==(const udp_rio_adapter_info& rhs) const
+    {
+        return (_src_ip == rhs._src_ip);
+    }
+
+private:
+    std::string _src_ip;
+};
+
+/*!
+ * A UDP link based on Windows Registered I/O (RIO)
+ *
+ * All frames live in a single buffer region, which is registered with the
+ * kernel once, so sends and receives don't need to lock and map the memory
+ * of every packet like overlapped I/O does. Every receive frame is posted to
+ * the request queue of the socket while the link owns it, and the completions
+ * of sends and receives are read from completion queues in user space. A
+ * thread only enters the kernel to wait when there are no completions.
+ *
+ * The request queue is not thread-safe, so posting sends and receives is
+ * serialized with a lock. The completion queues are only read by the sending
+ * and the receiving side, respectively.
+ */
+class udp_rio_link : public recv_link_base<udp_rio_link>,
+                     public send_link_base<udp_rio_link>
+{
+public:
+    using sptr = std::shared_ptr<udp_rio_link>;
+
+    ~udp_rio_link();
+
+    /*!
+     * Make a new RIO link.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes, num frames, and buffer sizes. The
+     *        receive frames provide the buffering, so there should be enough
+     *        of them for recv_buff_size.
+     * \return a shared_ptr to a new link
+     * \throws uhd::runtime_error if the link cannot be created, e.g., because
+     *         the system does not support RIO
+     */
+    static sptr make(
+        const std::string& addr, const std::string& port, const link_params_t& params);
+
+    /*! Return the local port of the UDP connection. Port is in host byte order.
+     */
+    uint16_t get_local_port() const
+    {
+        return _local_port;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<udp_rio_link>;
+    using send_link_base_t = send_link_base<udp_rio_link>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    //! Maximum number of completions read at once
+    static constexpr size_t MAX_COMPLETIONS = 64;
+
+    udp_rio_link(
+        const std::string& addr, const std::string& port, const link_params_t& params);
+
+    //! Free all kernel resources (queues, buffer region, socket)
+    void release_resources();
+
+    /*! Create and connect the socket, and look up the RIO functions
+     *
+     * \return the local IP address of the connection
+     */
+    std::string init_socket(const std::string& addr, const std::string& port);
+
+    //! Register the buffer region, create the queues and post all receives
+    void init_queues(const link_params_t& params);
+
+    //! Post a receive for frame \p index of the region
+    void post_recv(size_t index);
+
+    /*! Read completions from \p cq, waiting up to \p timeout_ms if there are none
+     *
+     * \return the number of completions in \p results
+     */
+    size_t dequeue(RIO_CQ cq, HANDLE event, RIORESULT* results, int32_t timeout_ms);
+
+    // Methods called by recv_link_base
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms);
+
+    UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& buff)
+    {
+        post_recv(static_cast<udp_rio_frame_buff&>(buff).get_index());
+    }
+
+    // Methods called by send_link_base
+    bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms);
+
+    void release_send_buff_derived(frame_buff& buff);
+
+    bool _wsa_started    = false;
+    SOCKET _socket       = INVALID_SOCKET;
+    uint16_t _local_port = 0;
+
+    //! The RIO functions, which are looked up at run time
+    RIO_EXTENSION_FUNCTION_TABLE _rio = {};
+
+    // The buffer region holds the receive frames, followed by the send frames
+    char* _region           = nullptr;
+    RIO_BUFFERID _buffer_id = RIO_INVALID_BUFFERID;
+    size_t _recv_stride     = 0;
+    size_t _send_stride     = 0;
+    size_t _send_offset     = 0;
+
+    // Completion queues with the events they signal, once they were armed
+    // with RIONotify()
+    RIO_CQ _recv_cq    = RIO_INVALID_CQ;
+    RIO_CQ _send_cq    = RIO_INVALID_CQ;
+    HANDLE _recv_event = nullptr;
+    HANDLE _send_event = nullptr;
+    RIO_RQ _rq         = RIO_INVALID_RQ;
+    std::mutex _rq_mutex;
+    //! Number of receives which were posted, but not committed yet
+    size_t _num_deferred = 0;
+
+    // Receive completions which were not handed out yet
+    RIORESULT _recv_results[MAX_COMPLETIONS];
+    size_t _recv_result_pos   = 0;
+    size_t _recv_result_count = 0;
+
+    // Send frames which are neither in use nor in flight
+    std::vector<size_t> _send_free_frames;
+    RIORESULT _send_results[MAX_COMPLETIONS];
+
+    std::vector<udp_rio_frame_buff> _recv_buffs;
+    std::vector<udp_rio_frame_buff> _send_buffs;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
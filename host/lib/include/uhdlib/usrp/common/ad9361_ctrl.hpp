@@ -133,6 +133,13 @@ public:
     //! enable or disable the quadrature calibration
     virtual void set_iq_balance_auto(const std::string& which, const bool on) = 0;
 
+    //! enable or disable the tune cache of the synthesizer for the given frontend
+    virtual void set_tune_cache(const std::string&, const bool)
+    {
+        throw uhd::not_implemented_error(
+            "ad9361_ctrl::set_tune_cache is not supported on this device.");
+    }
+
     //! get the current frequency for the given frontend
     virtual double get_freq(const std::string& which) = 0;
 
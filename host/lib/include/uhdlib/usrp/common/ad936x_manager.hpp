@@ -39,6 +39,7 @@ public:
     static const bool DEFAULT_AUTO_DC_OFFSET;
     static const bool DEFAULT_AUTO_IQ_BALANCE;
     static const bool DEFAULT_AGC_ENABLE;
+    static const bool DEFAULT_TUNE_CACHE;
 
     /*!
      * \param codec_ctrl The actual AD936x control object
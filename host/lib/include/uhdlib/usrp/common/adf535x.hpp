@@ -71,6 +71,36 @@ public:
         const uint32_t mod2 = 2,
         const bool flush = false) = 0;
 
+    //! Precomputed PLL settings for one output frequency (see get_frequency_image())
+    struct frequency_image_t
+    {
+        //! The actual output frequency
+        double freq;
+        uint32_t rf_divider;
+        uint16_t int_value;
+        uint32_t frac1;
+        uint32_t frac2;
+        uint32_t mod2;
+    };
+
+    //! Compute the PLL settings for an output frequency
+    //
+    // This does the same calculations as set_frequency(), but leaves the
+    // registers untouched. The returned image can be applied any number of
+    // times with load_frequency_image(), which skips the calculations.
+    //
+    // The settings depend on the PFD frequency and the feedback selection at
+    // the time of this call. The image must only be loaded while those are the
+    // same.
+    virtual frequency_image_t get_frequency_image(
+        const double target_freq, const uint32_t mod2 = 2) = 0;
+
+    //! Apply an image from get_frequency_image()
+    //
+    // \return the actual output frequency
+    virtual double load_frequency_image(
+        const frequency_image_t& image, const bool flush = false) = 0;
+
     virtual double set_charge_pump_current(
         const double target_current, const bool flush = false) = 0;
 
@@ -229,7 +259,23 @@ public:
         const uint32_t mod2 = 2,
         const bool flush = false) override
     {
-        return _set_frequency(target_freq, mod2, flush);
+        return load_frequency_image(_get_frequency_image(target_freq, mod2), flush);
+    }
+
+    frequency_image_t get_frequency_image(
+        const double target_freq, const uint32_t mod2 = 2) override
+    {
+        return _get_frequency_image(target_freq, mod2);
+    }
+
+    double load_frequency_image(
+        const frequency_image_t& image, const bool flush = false) override
+    {
+        _load_frequency_image(image);
+        if (flush) {
+            commit();
+        }
+        return image.freq;
     }
 
     double set_charge_pump_current(const double current, const bool flush) override
@@ -339,7 +385,8 @@ public:
 
 protected:
     uint8_t _set_vco_band_div(double);
-    double _set_frequency(double, uint32_t, bool);
+    frequency_image_t _get_frequency_image(double, uint32_t);
+    void _load_frequency_image(const frequency_image_t&);
     uhd::meta_range_t _get_charge_pump_current_range();
     void _commit();
 
@@ -364,8 +411,8 @@ inline uint8_t adf535x_impl<adf5355_regs_t>::_set_vco_band_div(double pfd_freq)
 }
 
 template <>
-inline double adf535x_impl<adf5355_regs_t>::_set_frequency(
-    double target_freq, uint32_t mod2, bool flush)
+inline adf535x_iface::frequency_image_t
+adf535x_impl<adf5355_regs_t>::_get_frequency_image(double target_freq, uint32_t mod2)
 {
     if (target_freq > ADF535X_MAX_OUT_FREQ or target_freq < ADF535X_MIN_OUT_FREQ) {
         throw uhd::runtime_error("requested frequency out of range.");
@@ -383,32 +430,6 @@ inline double adf535x_impl<adf5355_regs_t>::_set_frequency(
         rf_divider *= 2;
     }
 
-    switch (rf_divider) {
-        case 1:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV1;
-            break;
-        case 2:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV2;
-            break;
-        case 4:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV4;
-            break;
-        case 8:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV8;
-            break;
-        case 16:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV16;
-            break;
-        case 32:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV32;
-            break;
-        case 64:
-            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV64;
-            break;
-        default:
-            UHD_THROW_INVALID_CODE_PATH();
-    }
-
     // Compute fractional PLL params
     double prescaler_input_freq = target_vco_freq;
     if (_fb_after_divider) {
@@ -445,22 +466,58 @@ inline double adf535x_impl<adf5355_regs_t>::_set_frequency(
         boost::format("ADF5355 Settings: N=%f INT=%d FRAC1=%u MOD2=%d FRAC2=%u") % N % INT
             % FRAC1 % MOD2 % FRAC2);
 
+    frequency_image_t image;
+    image.freq       = coerced_out_freq;
+    image.rf_divider = rf_divider;
+    image.int_value  = INT;
+    image.frac1      = FRAC1;
+    image.frac2      = FRAC2;
+    image.mod2       = MOD2;
+    return image;
+}
+
+template <>
+inline void adf535x_impl<adf5355_regs_t>::_load_frequency_image(
+    const frequency_image_t& image)
+{
     /* Update registers */
-    if ((rf_divider == 1) or not _fb_after_divider) {
+    switch (image.rf_divider) {
+        case 1:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV1;
+            break;
+        case 2:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV2;
+            break;
+        case 4:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV4;
+            break;
+        case 8:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV8;
+            break;
+        case 16:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV16;
+            break;
+        case 32:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV32;
+            break;
+        case 64:
+            _regs.rf_divider_select = adf5355_regs_t::RF_DIVIDER_SELECT_DIV64;
+            break;
+        default:
+            UHD_THROW_INVALID_CODE_PATH();
+    }
+
+    if ((image.rf_divider == 1) or not _fb_after_divider) {
         _regs.feedback_select = adf5355_regs_t::FEEDBACK_SELECT_FUNDAMENTAL;
     }
     else {
         _regs.feedback_select = adf5355_regs_t::FEEDBACK_SELECT_DIVIDED;
     }
-    _regs.int_16_bit   = INT;
-    _regs.frac1_24_bit = FRAC1;
-    _regs.frac2_14_bit = FRAC2;
-    _regs.mod2_14_bit  = MOD2;
+    _regs.int_16_bit   = image.int_value;
+    _regs.frac1_24_bit = image.frac1;
+    _regs.frac2_14_bit = image.frac2;
+    _regs.mod2_14_bit  = image.mod2;
     _regs.phase_24_bit = 0;
-
-    if (flush)
-        commit();
-    return coerced_out_freq;
 }
 
 template <>
@@ -508,8 +565,8 @@ inline uint8_t adf535x_impl<adf5356_regs_t>::_set_vco_band_div(double pfd_freq)
 }
 
 template <>
-inline double adf535x_impl<adf5356_regs_t>::_set_frequency(
-    double target_freq, uint32_t mod2, bool flush)
+inline adf535x_iface::frequency_image_t
+adf535x_impl<adf5356_regs_t>::_get_frequency_image(double target_freq, uint32_t mod2)
 {
     if (target_freq > ADF535X_MAX_OUT_FREQ or target_freq < ADF535X_MIN_OUT_FREQ) {
         throw uhd::runtime_error("requested frequency out of range.");
@@ -527,32 +584,6 @@ inline double adf535x_impl<adf5356_regs_t>::_set_frequency(
         rf_divider *= 2;
     }
 
-    switch (rf_divider) {
-        case 1:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV1;
-            break;
-        case 2:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV2;
-            break;
-        case 4:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV4;
-            break;
-        case 8:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV8;
-            break;
-        case 16:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV16;
-            break;
-        case 32:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV32;
-            break;
-        case 64:
-            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV64;
-            break;
-        default:
-            UHD_THROW_INVALID_CODE_PATH();
-    }
-
     // Compute fractional PLL params
     double prescaler_input_freq = target_vco_freq;
     if (_fb_after_divider) {
@@ -589,28 +620,64 @@ inline double adf535x_impl<adf5356_regs_t>::_set_frequency(
         boost::format("ADF5356 Settings: N=%f INT=%d FRAC1=%u MOD2=%d FRAC2=%u") % N % INT
             % FRAC1 % MOD2 % FRAC2);
 
+    frequency_image_t image;
+    image.freq       = coerced_out_freq;
+    image.rf_divider = rf_divider;
+    image.int_value  = INT;
+    image.frac1      = FRAC1;
+    image.frac2      = FRAC2;
+    image.mod2       = MOD2;
+    return image;
+}
+
+template <>
+inline void adf535x_impl<adf5356_regs_t>::_load_frequency_image(
+    const frequency_image_t& image)
+{
     /* Update registers */
-    if ((rf_divider == 1) or not _fb_after_divider) {
+    switch (image.rf_divider) {
+        case 1:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV1;
+            break;
+        case 2:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV2;
+            break;
+        case 4:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV4;
+            break;
+        case 8:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV8;
+            break;
+        case 16:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV16;
+            break;
+        case 32:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV32;
+            break;
+        case 64:
+            _regs.rf_divider_select = adf5356_regs_t::RF_DIVIDER_SELECT_DIV64;
+            break;
+        default:
+            UHD_THROW_INVALID_CODE_PATH();
+    }
+
+    if ((image.rf_divider == 1) or not _fb_after_divider) {
         _regs.feedback_select = adf5356_regs_t::FEEDBACK_SELECT_FUNDAMENTAL;
     }
     else {
         _regs.feedback_select = adf5356_regs_t::FEEDBACK_SELECT_DIVIDED;
     }
-    _regs.int_16_bit   = INT;
-    _regs.frac1_24_bit = FRAC1;
-    _regs.frac2_lsb    = narrow_cast<uint16_t>(FRAC2 & 0x3FFF);
-    _regs.mod2_lsb     = narrow_cast<uint16_t>(MOD2 & 0x3FFF);
-    _regs.frac2_msb    = narrow_cast<uint16_t>(FRAC2 >> 14);
-    _regs.mod2_msb     = narrow_cast<uint16_t>(MOD2 >> 14);
+    _regs.int_16_bit   = image.int_value;
+    _regs.frac1_24_bit = image.frac1;
+    _regs.frac2_lsb    = narrow_cast<uint16_t>(image.frac2 & 0x3FFF);
+    _regs.mod2_lsb     = narrow_cast<uint16_t>(image.mod2 & 0x3FFF);
+    _regs.frac2_msb    = narrow_cast<uint16_t>(image.frac2 >> 14);
+    _regs.mod2_msb     = narrow_cast<uint16_t>(image.mod2 >> 14);
     _regs.phase_24_bit = 0;
 
-    _regs.negative_bleed =  FRAC1 != 0 or FRAC2 != 0 ?
+    _regs.negative_bleed =  image.frac1 != 0 or image.frac2 != 0 ?
                             adf5356_regs_t::NEGATIVE_BLEED_ENABLED :
                             adf5356_regs_t::NEGATIVE_BLEED_DISABLED;
-
-    if (flush)
-        commit();
-    return coerced_out_freq;
 }
 
 template <>
@@ -55,7 +55,8 @@ private:
         auto link = std::dynamic_pointer_cast<transport::udp_dpdk_link>(recv_link);
         port_id_t port_id = link->get_port()->get_port_id();
 
-        auto io_srv = _dpdk_ctx->get_io_service(port_id);
+        // Every DMA queue of a port has its own I/O service
+        auto io_srv = _dpdk_ctx->get_io_service(port_id, link->get_queue_id());
         UHD_ASSERT_THROW(io_srv);
         return io_srv;
     }
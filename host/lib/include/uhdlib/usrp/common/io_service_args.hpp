@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/types/device_addr.hpp>
+#include <cstdint>
 #include <map>
 
 namespace uhd { namespace usrp {
@@ -19,33 +20,70 @@ namespace uhd { namespace usrp {
  *               to use an inline I/O service.
  * send_offload: set to "true" to use an offload thread for TX_DATA links, "false"
  *               to use an inline I/O service.
+ * send_fc_offload: set to "true" to process the flow control packets of TX_DATA
+ *                  links with an inline I/O service on a thread of their own,
+ *                  so the streamer never waits for them to be processed. The
+ *                  default is "false". Offload I/O services always process
+ *                  flow control on their offload thread.
  * recv_offload_wait_mode: set to "poll" to use a polling strategy in the offload
- *                         thread, set to "block" to use a blocking strategy.
+ *                         thread, set to "block" to use a blocking strategy, set
+ *                         to "hybrid" to poll while packets arrive and block
+ *                         once they stop for recv_offload_spin_us.
  * send_offload_wait_mode: set to "poll" to use a polling strategy in the offload
- *                         thread, set to "block" to use a blocking strategy.
+ *                         thread, set to "block" to use a blocking strategy, set
+ *                         to "hybrid" to poll while packets are sent and block
+ *                         once they stop for send_offload_spin_us.
+ * recv_offload_spin_us: with the "hybrid" wait mode, the number of microseconds
+ *                       the offload thread keeps polling after the last packet
+ *                       before it blocks. The streamer also polls for this long
+ *                       before it waits for the offload thread. The default is
+ *                       100.
+ * send_offload_spin_us: like recv_offload_spin_us, but for TX data.
  * num_poll_offload_threads: set to the total number of offload threads to use for
  *                           RX_DATA and TX_DATA in this rfnoc_graph. New connections
  *                           always go to the offload thread containing the fewest
  *                           connections, with lowest numbered thread as a second
  *                           criterion. The default is 1.
+ * poll_offload_work_stealing: set to "true" to balance the load among the polling
+ *                             offload threads at runtime. Every pair of links
+ *                             then gets an I/O service of its own, and an idle
+ *                             thread takes over I/O services from threads which
+ *                             are busy nearly all the time. The default is
+ *                             "false", where connections are assigned to threads
+ *                             once, when they are created.
+ * offload_min_frames_ratio: the share of the frames of a streamer which is
+ *                           guaranteed to it on an offloaded link, in (0, 1].
+ *                           The other frames of a link are shared by its
+ *                           streamers, which borrow frames from there while
+ *                           they need more than their guaranteed ones. The
+ *                           default is 1, where the frames of all streamers
+ *                           must fit into the link.
  * recv_offload_thread_<N>_cpu: an integer to specify cpu affinity of the offload
  *                              thread. N indicates the thread instance, starting
  *                              with 0 for each streamer and ending with the number
  *                              of transport adapters minus one. Only used if the
- *                              I/O service is configured to block.
+ *                              I/O service is configured to block or hybrid.
  * send_offload_thread_<N>_cpu: an integer to specify cpu affinity of the offload
  *                              thread. N indicates the thread instance, starting
  *                              with 0 for each streamer and ending with the number
  *                              of transport adapters minus one. Only used if the
- *                              I/O service is configured to block.
+ *                              I/O service is configured to block or hybrid.
  * poll_offload_thread_<N>_cpu: an integer to specify cpu affinity of the offload
  *                              thread. N indicates the thread instance, starting
  *                              with 0 and up to num_poll_offload_threads minus 1.
  *                              Only used if the I/O service is configured to poll.
+ * numa_node: the NUMA node whose cores are used by offload threads which have no
+ *            cpu affinity specified. By default, the cores of the NUMA node of
+ *            the transport adapter are used, if it is known.
+ * thread_placement: set to "auto" to pin every offload thread which has no cpu
+ *                   affinity specified to a physical core of its own, chosen
+ *                   by uhd::get_thread_placement() on the NUMA node above.
+ *                   The default is "node", where such threads may run on all
+ *                   cores of the node.
  */
 struct io_service_args_t
 {
-    enum wait_mode_t { POLL, BLOCK };
+    enum wait_mode_t { POLL, BLOCK, HYBRID };
 
     //! Whether to offload streaming I/O to a worker thread
     bool recv_offload = false;
@@ -53,15 +91,33 @@ struct io_service_args_t
     //! Whether to offload streaming I/O to a worker thread
     bool send_offload = false;
 
+    //! Whether to process TX flow control on a thread of its own, if the I/O
+    // is not offloaded
+    bool send_fc_offload = false;
+
     //! Whether the offload thread should poll or block
     wait_mode_t recv_offload_wait_mode = BLOCK;
 
     //! Whether the offload thread should poll or block
     wait_mode_t send_offload_wait_mode = BLOCK;
 
+    //! Time to poll before blocking, if wait_mode is set to HYBRID
+    uint32_t recv_offload_spin_us = 100;
+
+    //! Time to poll before blocking, if wait_mode is set to HYBRID
+    uint32_t send_offload_spin_us = 100;
+
     //! Number of polling threads to use, if wait_mode is set to POLL
     size_t num_poll_offload_threads = 1;
 
+    //! Whether polling threads take over links from busier ones, if wait_mode
+    // is set to POLL
+    bool poll_offload_work_stealing = false;
+
+    //! Share of the frames of a streamer which are guaranteed to it, if the
+    // link is offloaded
+    double offload_min_frames_ratio = 1.0;
+
     //! CPU affinity of offload threads, if wait_mode is set to BLOCK
     std::map<size_t, size_t> recv_offload_thread_cpu;
 
@@ -70,6 +126,13 @@ struct io_service_args_t
 
     //! CPU affinity of offload threads, if wait_mode is set to POLL
     std::map<size_t, size_t> poll_offload_thread_cpu;
+
+    //! NUMA node for offload threads without CPU affinity, -1 to use the node
+    // of the transport adapter
+    int numa_node = -1;
+
+    //! Whether offload threads without CPU affinity get a core of their own
+    bool auto_thread_placement = false;
 };
 
 /*! Reads I/O service args from provided dictionary
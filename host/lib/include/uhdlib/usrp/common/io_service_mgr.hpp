@@ -26,18 +26,22 @@ namespace uhd { namespace usrp {
  * The I/O service manager supports two types of I/O services: inline I/O service
  * and offload I/O service. Inline I/O services execute all I/O in the caller
  * thread. Offload I/O services execute all I/O in an offload thread. The offload
- * thread can be configured to block or poll. All control links use inline I/O
+ * thread can be configured to block or poll, or to poll while there is traffic
+ * and block while there is none (hybrid). All control links use inline I/O
  * services, only RX and TX data links currently use offload I/O services.
  *
  * If polling I/O services are requested, the I/O service manager instantiates
  * the number of I/O services specified by the user through args. It chooses
  * which I/O service to connect a set of links to by selecting the I/O service
- * with the fewest number of connections.
+ * with the fewest number of connections. If work stealing is enabled through
+ * args, every set of links gets an I/O service of its own instead, and the I/O
+ * services are polled by a pool of that many threads, which move I/O services
+ * from busy threads to idle ones at runtime.
  *
- * If blocking I/O services are requested, the I/O service manager instantiates
- * one offload I/O service for each transport adapter used by a streamer. When
- * there are multiple streamers, this manager creates a separate set of I/O
- * services for each streamer.
+ * If blocking or hybrid I/O services are requested, the I/O service manager
+ * instantiates one offload I/O service for each transport adapter used by a
+ * streamer. When there are multiple streamers, this manager creates a separate
+ * set of I/O services for each streamer.
  *
  * Offload I/O services have a number of restrictions that must be observed:
  * - Offload I/O services currently do not support links that require frame
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <uhd/types/time_spec.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 //! Control interface for an LMX2572 synthesizer
 class lmx2572_iface
@@ -36,6 +38,16 @@ public:
     //! Sleep functor: sleep for the specified time
     using sleep_fn_t = std::function<void(const uhd::time_spec_t&)>;
 
+    //! Precomputed register settings for one output frequency (see
+    // get_frequency_image())
+    struct frequency_image_t
+    {
+        //! The actual output frequency
+        double freq;
+        //! The values of all registers, indexed by address
+        std::vector<uint16_t> regs;
+    };
+
     //! Factory
     //
     // \param write SPI write function object
@@ -99,4 +111,28 @@ public:
     virtual double set_frequency(const double target_freq,
         const double ref_freq,
         const bool spur_dodging) = 0;
+
+    //! Compute the register settings for an output frequency
+    //
+    // This does the same calculations as set_frequency(), but leaves the
+    // register cache untouched. The returned image can be applied any number of
+    // times with load_frequency_image(), which is much cheaper than calling
+    // set_frequency() again.
+    //
+    // The image also captures the other settings of the chip at the time of
+    // this call, like the output enables and the sync mode. It must only be
+    // loaded while those settings are the same.
+    //
+    // \param target_freq The target frequency
+    // \param ref_freq The input reference frequency
+    // \param spur_dodging Set to true to enable spur dodging
+    virtual frequency_image_t get_frequency_image(const double target_freq,
+        const double ref_freq,
+        const bool spur_dodging) = 0;
+
+    //! Load an image from get_frequency_image() into the register cache
+    //
+    // Like set_frequency(), this only updates the register cache. Call commit()
+    // to write the registers that changed to the chip.
+    virtual void load_frequency_image(const frequency_image_t& image) = 0;
 };
@@ -28,7 +28,20 @@ public:
     //! SPI read functor: Return SPI
     using read_spi_t = std::function<uint32_t(uint32_t)>;
 
-    static sptr make(write_spi_t write, read_spi_t read);
+    //! Batched SPI write functor: Clock out several SPI transactions, in order
+    using write_multi_spi_t = std::function<void(const std::vector<uint32_t>&)>;
+
+    /*! Create an LMX2592 controller
+     *
+     * \param write Clocks out one SPI transaction
+     * \param read Clocks out one SPI transaction and returns the readback value
+     * \param write_multi If given, commit() clocks out all of its register
+     *        writes with one call to this functor, rather than calling
+     *        \p write for every register
+     */
+    static sptr make(write_spi_t write,
+        read_spi_t read,
+        write_multi_spi_t write_multi = write_multi_spi_t());
 
     virtual ~lmx2592_iface() = default;
 
@@ -16,6 +16,7 @@
 #include <uhdlib/utils/rpc.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace uhd { namespace rfnoc {
 
@@ -31,7 +32,14 @@ class mpmd_mb_controller : public mb_controller,
 public:
     using sptr = std::shared_ptr<mpmd_mb_controller>;
 
-    mpmd_mb_controller(uhd::usrp::mpmd_rpc_iface::sptr rpcc, uhd::device_addr_t device_info);
+    /*!
+     * \param rpcc The RPC interface to MPM
+     * \param device_info The device info as reported by MPM
+     * \param has_sensor_snapshot True if MPM provides get_all_mb_sensors()
+     */
+    mpmd_mb_controller(uhd::usrp::mpmd_rpc_iface::sptr rpcc,
+        uhd::device_addr_t device_info,
+        const bool has_sensor_snapshot = false);
 
     //! Return reference to the RPC client
     uhd::rpc_client::sptr get_rpc_client()
@@ -75,6 +83,9 @@ public:
         void update_tick_rate(const double tick_rate);
 
     private:
+        //! Radio blocks may update the tick rate from different threads
+        std::mutex _tick_rate_mutex;
+
         const size_t _tk_idx;
         uhd::usrp::mpmd_rpc_iface::sptr _rpc;
     };
@@ -98,6 +109,7 @@ public:
     void set_time_source_out(const bool enb) override;
     uhd::sensor_value_t get_sensor(const std::string& name) override;
     std::vector<std::string> get_sensor_names() override;
+    std::vector<uhd::sensor_value_t> get_all_sensors() override;
     uhd::usrp::mboard_eeprom_t get_eeprom() override;
     std::vector<std::string> get_gpio_banks() const override;
     std::vector<std::string> get_gpio_srcs(const std::string& bank) const override;
@@ -119,6 +131,9 @@ private:
     //! List of MB sensor names
     std::unordered_set<std::string> _sensor_names;
 
+    //! True if all sensors can be read with a single (cached) RPC call
+    const bool _has_sensor_snapshot;
+
     //! Cache of available GPIO sources
     std::vector<std::string> _gpio_banks;
     std::unordered_map<std::string, std::vector<std::string>> _gpio_srcs;
@@ -143,6 +158,7 @@ public:
         void request_cb(uhd::features::fpga_load_notification_iface::sptr handler);
 
     private:
+        std::mutex _cbs_mutex;
         std::vector<std::weak_ptr<uhd::features::fpga_load_notification_iface>> _cbs;
     };
 
@@ -9,18 +9,23 @@
 
 #include <uhd/config.hpp>
 #include <uhd/transport/zero_copy.hpp>
-#include <uhd/types/time_spec.hpp>
-#include <uhd/utils/byteswap.hpp>
-#include <uhd/utils/log.hpp>
+#include <uhdlib/utils/spsc_ring.hpp>
 #include <stdint.h>
-#include <chrono>
-#include <map>
+#include <atomic>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <thread>
+#include <vector>
 
 namespace uhd { namespace usrp {
 
+/*! Demultiplexes the packets of a transport by their SID
+ *
+ * A dedicated thread receives all packets from the transport and pushes each
+ * into the lock-free ring of its SID, from where get_recv_buff() pops it. So
+ * the receivers of different SIDs neither contend for a lock nor race on the
+ * transport. Packets with SIDs which were never asked for are dropped.
+ */
 struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demuxer_3000>
 {
     typedef std::shared_ptr<recv_packet_demuxer_3000> sptr;
@@ -29,82 +34,52 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
         return sptr(new recv_packet_demuxer_3000(xport));
     }
 
-    recv_packet_demuxer_3000(transport::zero_copy_if::sptr xport) : _xport(xport)
-    { /*NOP*/
-    }
+    recv_packet_demuxer_3000(transport::zero_copy_if::sptr xport);
+
+    ~recv_packet_demuxer_3000();
 
+    /*! Pop the next packet of a SID
+     *
+     * Only one thread at a time may receive packets of a given SID.
+     *
+     * eturns the packet, or an empty pointer on a timeout
+     */
     transport::managed_recv_buffer::sptr get_recv_buff(
-        const uint32_t sid, const double timeout)
-    {
-        const auto exit_time = std::chrono::high_resolution_clock::now()
-                               + std::chrono::microseconds(int64_t(timeout * 1e6));
-        transport::managed_recv_buffer::sptr buff;
-        buff = _internal_get_recv_buff(sid, timeout);
-        while (not buff) // loop until timeout
-        {
-            const auto delta = exit_time - std::chrono::high_resolution_clock::now();
-            const double new_timeout =
-                std::chrono::duration_cast<std::chrono::duration<double>>(delta).count();
-            if (new_timeout < 0.0) {
-                break;
-            }
-            buff = _internal_get_recv_buff(sid, new_timeout);
-        }
-        return buff;
-    }
+        const uint32_t sid, const double timeout);
 
-    transport::managed_recv_buffer::sptr _internal_get_recv_buff(
-        const uint32_t sid, const double timeout)
-    {
-        transport::managed_recv_buffer::sptr buff;
-
-        //----------------------------------------------------------
-        //-- Check the queue to see if we already have a buffer
-        //----------------------------------------------------------
-        {
-            std::lock_guard<std::mutex> l(mutex);
-            queue_type_t& queue = _queues[sid];
-            if (not queue.empty()) {
-                buff = queue.front();
-                queue.front().reset();
-                queue.pop();
-                return buff;
-            }
-        }
-        {
-            buff = _xport->get_recv_buff(timeout);
-            if (buff) {
-                const uint32_t new_sid = uhd::wtohx(buff->cast<const uint32_t*>()[1]);
-                if (new_sid != sid) {
-                    std::lock_guard<std::mutex> l(mutex);
-                    if (_queues.count(new_sid) == 0)
-                        UHD_LOGGER_ERROR("STREAMER")
-                            << "recv packet demuxer unexpected sid 0x" << std::hex
-                            << new_sid << std::dec;
-                    else
-                        _queues[new_sid].push(buff);
-                    buff.reset();
-                }
-            }
-        }
-        return buff;
-    }
+    //! Drop all packets of a SID which were not received yet
+    void realloc_sid(const uint32_t sid);
+
+    transport::zero_copy_if::sptr make_proxy(const uint32_t sid);
+
+private:
+    //! Maximum number of SIDs per demuxer
+    static constexpr size_t MAX_NUM_SIDS = 16;
 
-    void realloc_sid(const uint32_t sid)
+    typedef spsc_ring<transport::managed_recv_buffer::sptr> queue_type_t;
+
+    struct sid_queue_t
     {
-        std::lock_guard<std::mutex> l(mutex);
-        while (not _queues[sid].empty()) // allocated and clears if already allocated
-        {
-            _queues[sid].pop();
-        }
-    }
+        //! Set once sid and queue are valid, which never change afterwards
+        std::atomic<bool> used{false};
+        uint32_t sid = 0;
+        std::unique_ptr<queue_type_t> queue;
+    };
 
-    transport::zero_copy_if::sptr make_proxy(const uint32_t sid);
+    //! Return the queue of a SID, or nullptr if it has none yet
+    queue_type_t* _find_queue(const uint32_t sid);
+
+    //! Return the queue of a SID, and create it if necessary
+    queue_type_t& _get_queue(const uint32_t sid);
+
+    void _demux_loop();
 
-    typedef std::queue<transport::managed_recv_buffer::sptr> queue_type_t;
-    std::map<uint32_t, queue_type_t> _queues;
     transport::zero_copy_if::sptr _xport;
-    std::mutex mutex;
+    std::vector<sid_queue_t> _queues;
+    //! Serializes the creation of queues. The demux thread never takes it.
+    std::mutex _queues_mutex;
+    std::atomic<bool> _stop{false};
+    std::thread _demux_thread;
 };
 
 struct recv_packet_demuxer_proxy_3000 : transport::zero_copy_if
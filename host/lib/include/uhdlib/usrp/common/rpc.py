@@ -47,6 +47,7 @@ IFACES = [
         fn_from_string("size_t get_num_timekeepers()"),
         fn_from_string("std::vector<std::string> get_mb_sensors()"),
         fn_from_string("sensor_value_t::sensor_map_t get_mb_sensor(const std::string& sensor)"),
+        fn_from_string("std::map<std::string, sensor_value_t::sensor_map_t> get_all_mb_sensors()"),
         fn_from_string("std::vector<std::string> get_gpio_banks()"),
         fn_from_string("std::vector<std::string> get_gpio_srcs(const std::string& bank)"),
         fn_from_string("bool supports_feature(const std::string& feature)"),
@@ -77,6 +78,9 @@ IFACES = [
         fn_from_string("std::vector<std::map<std::string, std::string>> get_dboard_info()", no_claim=True),
         fn_from_string("void set_cal_frozen(bool state, size_t block_count, size_t chan)"),
         fn_from_string("std::vector<int> get_cal_frozen(size_t block_count, size_t chan)"),
+        fn_from_string("void set_cal_coefs(size_t chan, size_t block_count, size_t cal_block, const std::string& coefs)"),
+        fn_from_string("std::vector<std::vector<uint32_t>> get_cal_coefs(size_t chan, size_t block_count, size_t cal_block)"),
+        fn_from_string("void reset_cal_coefs(size_t chan, size_t block_count, size_t cal_block)"),
         fn_from_string("double rfdc_set_nco_freq(const std::string& trx, size_t block_count, size_t chan, double freq)"),
         fn_from_string("double rfdc_get_nco_freq(const std::string& trx, size_t block_count, size_t chan)"),
         fn_from_string("double get_master_clock_rate()"),
@@ -8,12 +8,15 @@
 #pragma once
 
 #include <uhd/config.hpp>
+#include <uhd/types/time_spec.hpp>
 #include <uhd/types/wb_iface.hpp>
 #include <uhd/usrp/dboard_iface.hpp>
 #include <uhd/usrp/gpio_defs.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace gpio_atr {
 
@@ -66,6 +69,20 @@ class gpio_atr_3000 : uhd::noncopyable
 public:
     typedef std::shared_ptr<gpio_atr_3000> sptr;
 
+    //! Returns how many timed register writes fit into the command FIFO
+    using cmd_fifo_slots_fn_t = std::function<size_t(void)>;
+
+    //! One step of a GPIO pattern, see set_gpio_pattern()
+    struct gpio_pattern_step_t
+    {
+        //! The time at which the outputs change
+        uhd::time_spec_t time;
+        //! The new values of the outputs
+        uint32_t value;
+        //! The outputs which change
+        uint32_t mask;
+    };
+
     static const uint32_t MASK_SET_ALL = 0xFFFFFFFF;
 
     virtual ~gpio_atr_3000(void) {}
@@ -75,8 +92,13 @@ public:
      *
      * \param iface register iface to GPIO ATR registers
      * \param registers Register offsets
+     * \param cmd_fifo_slots_fn If given, set_gpio_pattern() issues no more
+     *        steps than this returns (e.g., a call to
+     *        uhd::rfnoc::register_iface::get_cmd_fifo_free_slots(true))
      */
-    static sptr make(uhd::wb_iface::sptr iface, gpio_atr_offsets registers);
+    static sptr make(uhd::wb_iface::sptr iface,
+        gpio_atr_offsets registers,
+        cmd_fifo_slots_fn_t&& cmd_fifo_slots_fn = cmd_fifo_slots_fn_t());
 
     /*!
      * Select the ATR mode for all bits in the mask
@@ -114,6 +136,23 @@ public:
     virtual void set_gpio_out(
         const uint32_t value, const uint32_t mask = MASK_SET_ALL) = 0;
 
+    /*!
+     * Write a sequence of static GPIO outputs with timed commands
+     *
+     * Every step is one write of the static outputs like set_gpio_out(), timed
+     * to the time of the step. The steps are only issued as far as they fit
+     * into the command FIFO (see make()), so this call does not block until
+     * the device has executed earlier timed commands. The caller issues the
+     * remaining steps with another call once there is room again. The command
+     * time of the register iface is restored afterwards.
+     *
+     * \param steps the steps, in chronological order
+     * \return the number of steps which were issued
+     * \throws uhd::value_error if the steps are not in chronological order
+     * \throws uhd::not_implemented_error if the register iface is not timed
+     */
+    virtual size_t set_gpio_pattern(const std::vector<gpio_pattern_step_t>& steps) = 0;
+
     /*!
      * Read the state of the GPIO pins
      * If a pin is configured as an input, reads the actual value of the pin
@@ -13,6 +13,7 @@
 #include <uhd/utils/noncopyable.hpp>
 #include <functional>
 #include <memory>
+#include <vector>
 
 class spi_core_3000 : uhd::noncopyable, public uhd::spi_iface
 {
@@ -20,18 +21,29 @@ public:
     using sptr        = std::shared_ptr<spi_core_3000>;
     using poke32_fn_t = std::function<void(uint32_t, uint32_t)>;
     using peek32_fn_t = std::function<uint32_t(uint32_t)>;
+    //! Writes values[i] to addrs[i], in order
+    using multi_poke32_fn_t = std::function<void(
+        const std::vector<uint32_t>& addrs, const std::vector<uint32_t>& values)>;
 
     ~spi_core_3000(void) override = 0;
 
     //! makes a new spi core from iface and slave base
     static sptr make(uhd::wb_iface::sptr iface, const size_t base, const size_t readback);
 
-    //! makes a new spi core from register iface and slave base
+    /*! makes a new spi core from register iface and slave base
+     *
+     * \param multi_poke32_fn If given, every SPI transaction hands all of its
+     *        register writes to this function at once, instead of calling
+     *        poke32_fn for every one of them. In particular, multi_write_spi()
+     *        then sends all of its words in one burst (e.g., with
+     *        uhd::rfnoc::register_iface::multi_poke32()).
+     */
     static sptr make(poke32_fn_t&& poke32_fn,
         peek32_fn_t&& peek32_fn,
         const size_t base,
         const size_t reg_offset,
-        const size_t readback);
+        const size_t readback,
+        multi_poke32_fn_t&& multi_poke32_fn = multi_poke32_fn_t());
 
     //! Set the spi clock divider to something usable
     virtual void set_divider(const double div) = 0;
@@ -13,6 +13,7 @@
 #include <uhdlib/usrp/cores/gpio_port_mapper.hpp>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace uhd { namespace cores {
 class spi_core_4000 : uhd::noncopyable, public uhd::spi_iface
@@ -22,13 +23,21 @@ public:
     using mapper_sptr = std::shared_ptr<uhd::mapper::gpio_port_mapper>;
     using poke32_fn_t = std::function<void(uint32_t, uint32_t)>;
     using peek32_fn_t = std::function<uint32_t(uint32_t)>;
+    //! Writes values[i] to addrs[i], in order
+    using multi_poke32_fn_t = std::function<void(
+        const std::vector<uint32_t>& addrs, const std::vector<uint32_t>& values)>;
 
     virtual ~spi_core_4000(void) = default;
 
     //! makes a new spi core from iface and peripheral base
     static sptr make(uhd::wb_iface::sptr iface, const size_t base, const size_t readback);
 
-    //! makes a new spi core from register iface and peripheral
+    /*! makes a new spi core from register iface and peripheral
+     *
+     * \param multi_poke32_fn If given, every SPI transaction hands all of its
+     *        register writes to this function at once, instead of calling
+     *        poke32_fn for every one of them (see spi_core_3000::make()).
+     */
     static sptr make(poke32_fn_t&& poke32_fn,
         peek32_fn_t&& peek_fn,
         const size_t spi_periph_cfg,
@@ -36,7 +45,8 @@ public:
         const size_t spi_transaction_go,
         const size_t spi_status,
         const size_t spi_controller_info,
-        const mapper_sptr port_mapper);
+        const mapper_sptr port_mapper,
+        multi_poke32_fn_t&& multi_poke32_fn = multi_poke32_fn_t());
 
     //! Configures the SPI transaction. The vector index refers to the peripheral number.
     virtual void set_spi_periph_config(
@@ -37,6 +37,17 @@ public:
 
     virtual uhd::time_spec_t get_time_now(void) = 0;
 
+    /*! Return an estimate of the current time
+     *
+     * Unlike get_time_now(), this reads the time from the hardware only about
+     * once a second, and extrapolates it from there otherwise. See
+     * uhd::time_estimator for the error bounds.
+     */
+    virtual uhd::time_spec_t get_time_now_estimate(void) = 0;
+
+    //! Discard the time of the estimate, e.g., after latching a new time
+    virtual void invalidate_time_estimate(void) = 0;
+
     virtual uhd::time_spec_t get_time_last_pps(void) = 0;
 
     virtual void set_time_now(const uhd::time_spec_t& time) = 0;
@@ -183,6 +183,10 @@ static constexpr std::array<size_t, 2> ZBX_CHANNELS{0, 1};
 
 static constexpr double ZBX_MIX1_MN_THRESHOLD = 4e9;
 
+//! Number of threads, in addition to the resolving thread, which resolve the
+// independent expert workers, e.g., those of the LOs of different channels
+static constexpr size_t ZBX_NUM_EXPERT_THREADS = 3;
+
 // These are addresses for the various table-based registers
 static constexpr uint32_t ATR_ADDR_0X = 0;
 static constexpr uint32_t ATR_ADDR_RX = 1;
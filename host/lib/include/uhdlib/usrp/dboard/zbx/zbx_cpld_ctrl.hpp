@@ -56,6 +56,10 @@ public:
     //! Maps a DSA name ("DSA1", "DSA2", etc.) to its equivalent dsa_type
     static const std::unordered_map<std::string, dsa_type> dsa_map;
 
+    //! The maximum number of entries write_tx_dsa_table() and
+    // write_rx_dsa_table() can write
+    static constexpr size_t MAX_DSA_TABLE_WRITE_SIZE = 64;
+
     zbx_cpld_ctrl(poke_fn_type&& poke_fn,
         peek_fn_type&& peek_fn,
         sleep_fn_type&& sleep_fn,
@@ -391,17 +395,41 @@ public:
     //               and pulse_lo_sync() can be called.
     void set_lo_sync_bypass(const bool enable);
 
-    /*! Write DSA table for TX frequency to DB CPLD
+    /*! Return the value of a TX DSA (table) register for the given DSA steps
+     *
+     * The TX DSA registers and the TX DSA table registers share the same
+     * layout. The amp path (dsa_steps[2]) is not part of these registers, and
+     * is ignored.
+     */
+    static uint32_t get_tx_dsa_reg_value(const tx_dsa_type& dsa_steps);
+
+    /*! Return the value of an RX DSA (table) register for the given DSA steps
+     *
+     * The RX DSA registers and the RX DSA table registers share the same
+     * layout.
+     */
+    static uint32_t get_rx_dsa_reg_value(const rx_dsa_type& dsa_steps);
+
+    /*! Write the TX DSA table of a channel to the DB CPLD
+     *
+     * The values are written as they are, which means the table can be
+     * compiled from the cal data once (see get_tx_dsa_reg_value()) and then
+     * written on every band change.
+     *
+     * \param channel The channel of the table
+     * \param table_regs One register value per table index, at most
+     *                   MAX_DSA_TABLE_WRITE_SIZE values
      */
-    void update_tx_dsa_settings(
-        const std::vector<uint32_t>& dsa1_table, const std::vector<uint32_t>& dsa2_table);
+    void write_tx_dsa_table(
+        const size_t channel, const std::vector<uint32_t>& table_regs);
 
-    /*! Write DSA table for RX frequency to DB CPLD
+    /*! Write the RX DSA table of a channel to the DB CPLD
+     *
+     * See write_tx_dsa_table(), the values are computed with
+     * get_rx_dsa_reg_value().
      */
-    void update_rx_dsa_settings(const std::vector<uint32_t>& dsa1_table,
-        const std::vector<uint32_t>& dsa2_table,
-        const std::vector<uint32_t>& dsa3a_table,
-        const std::vector<uint32_t>& dsa3b_table);
+    void write_rx_dsa_table(
+        const size_t channel, const std::vector<uint32_t>& table_regs);
 
 private:
     /*! Dump the state of the registers into the CPLD
@@ -446,15 +474,13 @@ private:
         const spi_xact_t xact_type,
         const bool throttle = true);
 
-    /*! Write a list of values to a register.
-     * The list start address is searched using reg_addr_name.
-     * The method will raise an exception if values is longer than
-     * the register size.
-     * The caller is responsible to commit the data once values are written.
-     * This allows multiple vector writes with a single commit.
+    /*! Write precompiled values to a DSA table register array
+     *
+     * \param field The first field of the register array
+     * \param table_regs One register value per array index
      */
-    void write_register_vector(
-        const std::string& reg_addr_name, const std::vector<uint32_t>& values);
+    void _write_dsa_table(const zbx_cpld_regs_t::zbx_cpld_field_t field,
+        const std::vector<uint32_t>& table_regs);
 
     // Cached register state
     zbx_cpld_regs_t _regs = zbx_cpld_regs_t();
@@ -475,6 +501,10 @@ private:
     std::string _db_rev_info;
 
     const std::string _log_id;
+
+    //! Serializes the public methods, which the expert workers of both channels
+    // may call concurrently (see zbx_dboard_impl)
+    std::mutex _mutex;
 };
 
 }}} // namespace uhd::usrp::zbx
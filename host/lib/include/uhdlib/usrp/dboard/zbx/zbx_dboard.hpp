@@ -319,6 +319,10 @@ private:
     // Get all los "lock status", per enabled && locked individual LOs
     bool _get_all_los_locked(const direction_t dir, const size_t chan);
 
+    // Precompute the LO settings for a list of tune frequencies
+    void _set_precomputed_freqs(
+        const direction_t dir, const size_t chan, const std::vector<double>& freqs);
+
     const std::string _unique_id;
     std::string get_unique_id() const;
 
@@ -21,7 +21,9 @@
 #include <uhdlib/usrp/common/x400_rfdc_control.hpp>
 #include <uhdlib/utils/rpc.hpp>
 #include <cmath>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace zbx {
 
@@ -43,6 +45,63 @@ uhd::freq_range_t _get_quantized_lo_range(const double lo_step_size)
 
 } // namespace
 
+//! The frontend settings for one tune frequency (see zbx_calc_lo_freqs())
+struct zbx_lo_freqs_t
+{
+    //! The tune frequency, clipped to the valid range
+    double tune_freq;
+    //! The entry of the tune table which covers tune_freq
+    zbx_tune_map_item_t tune_settings;
+    bool lo1_enabled;
+    //! Only valid if lo1_enabled is true
+    double lo1_freq;
+    double lo2_freq;
+    double if2_freq;
+};
+
+/*! Calculate the LO and IF2 frequencies for a frontend tune frequency
+ *
+ * This is the calculation that zbx_freq_fe_expert does on every tune. It is
+ * also used to precompute the LO settings for a list of tune frequencies.
+ *
+ * \param freq The desired tune frequency
+ * \param tune_table The tune table of the frontend
+ * \param chan The channel, which determines the direction of the LO offset that
+ *             avoids injection locking
+ * \param lo_freq_range The quantized LO frequency range (see
+ *                      _get_quantized_lo_range())
+ */
+zbx_lo_freqs_t zbx_calc_lo_freqs(const double freq,
+    const std::vector<zbx_tune_map_item_t>& tune_table,
+    const size_t chan,
+    const uhd::freq_range_t& lo_freq_range);
+
+/*! DSA cal data, compiled to the register values of the CPLD DSA tables
+ *
+ * The programming experts compile the cal data once, when they are created.
+ * A band change then writes one precompiled value per table index (see
+ * zbx_cpld_ctrl::write_rx_dsa_table()), and a retune within a band doesn't
+ * touch the tables at all.
+ */
+struct zbx_dsa_table_regs_t
+{
+    //! Marks that no table was written yet
+    static constexpr size_t NO_BAND = std::numeric_limits<size_t>::max();
+
+    //! The upper (inclusive) frequency limits of the bands, in ascending order
+    std::vector<double> band_max_freqs;
+    //! tables[band][gain_index] is a DSA table register value
+    std::vector<std::vector<uint32_t>> tables;
+
+    //! Return the index of the band that contains \p freq
+    //
+    // \throws uhd::value_error if \p freq is above all bands
+    size_t get_band_index(const double freq) const;
+
+    static zbx_dsa_table_regs_t compile(uhd::usrp::cal::zbx_tx_dsa_cal::sptr dsa_cal);
+    static zbx_dsa_table_regs_t compile(uhd::usrp::cal::zbx_rx_dsa_cal::sptr dsa_cal);
+};
+
 /*!---------------------------------------------------------
  * zbx_scheduling_expert
  *
@@ -473,7 +532,7 @@ public:
         , _is_highband(db, tx_fe_path / "is_highband")
         , _lo1_source(db, tx_fe_path / "ch" / ZBX_LO1 / "source")
         , _lo2_source(db, tx_fe_path / "ch" / ZBX_LO2 / "source")
-        , _dsa_cal(dsa_cal)
+        , _dsa_table(zbx_dsa_table_regs_t::compile(dsa_cal))
         , _cpld(cpld)
         , _chan(chan)
     {
@@ -521,7 +580,10 @@ private:
     uhd::experts::data_reader_t<zbx_lo_source_t> _lo1_source;
     uhd::experts::data_reader_t<zbx_lo_source_t> _lo2_source;
 
-    uhd::usrp::cal::zbx_tx_dsa_cal::sptr _dsa_cal;
+    //! The DSA cal data, compiled to DSA table register values
+    const zbx_dsa_table_regs_t _dsa_table;
+    //! The band whose DSA table was last written to the CPLD
+    size_t _dsa_table_band = zbx_dsa_table_regs_t::NO_BAND;
     // Expects constructed cpld control objects
     std::shared_ptr<zbx_cpld_ctrl> _cpld;
     const size_t _chan;
@@ -563,7 +625,7 @@ public:
         , _is_highband(db, fe_path / "is_highband")
         , _lo1_source(db, fe_path / "ch" / ZBX_LO1 / "source")
         , _lo2_source(db, fe_path / "ch" / ZBX_LO2 / "source")
-        , _dsa_cal(dsa_cal)
+        , _dsa_table(zbx_dsa_table_regs_t::compile(dsa_cal))
         , _cpld(cpld)
         , _chan(chan)
     {
@@ -614,7 +676,10 @@ private:
     uhd::experts::data_reader_t<zbx_lo_source_t> _lo1_source;
     uhd::experts::data_reader_t<zbx_lo_source_t> _lo2_source;
 
-    uhd::usrp::cal::zbx_rx_dsa_cal::sptr _dsa_cal;
+    //! The DSA cal data, compiled to DSA table register values
+    const zbx_dsa_table_regs_t _dsa_table;
+    //! The band whose DSA table was last written to the CPLD
+    size_t _dsa_table_band = zbx_dsa_table_regs_t::NO_BAND;
     // Expects constructed cpld control objects
     std::shared_ptr<zbx_cpld_ctrl> _cpld;
     const size_t _chan;
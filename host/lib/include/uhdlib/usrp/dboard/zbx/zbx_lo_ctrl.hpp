@@ -10,6 +10,8 @@
 #include <uhd/types/direction.hpp>
 #include <uhdlib/usrp/common/lmx2572.hpp>
 #include <functional>
+#include <map>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace zbx {
 
@@ -17,13 +19,17 @@ class zbx_lo_ctrl final
 {
 public:
     // Pass in our lo selection and poke/peek functions
+    //
+    // If wait_for_lock is false, the caller must call wait_for_lo_lock() before
+    // using the LO. That way, the lock times of several LOs can overlap.
     zbx_lo_ctrl(zbx_lo_t lo,
         lmx2572_iface::write_fn_t&& poke16,
         lmx2572_iface::read_fn_t&& peek16,
         lmx2572_iface::sleep_fn_t&& sleep,
         const double default_frequency,
         const double db_prc_rate,
-        const bool testing_mode_enabled);
+        const bool testing_mode_enabled,
+        const bool wait_for_lock = true);
 
     // Passes in a desired LO frequency to the LMX driver, returns the coerced frequency
     double set_lo_freq(const double freq);
@@ -31,6 +37,19 @@ public:
     // Returns cached LO frequency value
     double get_lo_freq();
 
+    // Precompute the LMX settings for a list of LO frequencies. Calling
+    // set_lo_freq() with any of these frequencies will then skip the LMX
+    // calculations, and only write the registers which differ from the current
+    // ones. This replaces any previous list, an empty list clears it.
+    //
+    // The settings depend on whether the LO port and the test mode are enabled.
+    // If those are different when set_lo_freq() is called, the settings are
+    // computed again, and stored for the next time.
+    void set_precomputed_lo_freqs(const std::vector<double>& freqs);
+
+    // Returns the number of precomputed LO frequencies
+    size_t get_num_precomputed_lo_freqs();
+
     // Spins up a timeout loop to wait for the PLL's to lock
     // \throws uhd::runtime_error on a failure to lock
     void wait_for_lo_lock();
@@ -62,6 +81,18 @@ private:
     // Returns the appropriate output port for given LO
     lmx2572_iface::output_t _get_output_port(bool test_port);
 
+    // LMX settings for a precomputed LO frequency, and the port settings they
+    // were computed for
+    struct freq_image_t
+    {
+        lmx2572_iface::frequency_image_t image;
+        bool port_enabled;
+        bool testing_mode_enabled;
+    };
+
+    // Compute the LMX settings for an LO frequency with the current port settings
+    freq_image_t _compute_freq_image(const double freq);
+
     // String prefix for log messages
     const std::string _log_id;
 
@@ -79,6 +110,12 @@ private:
     // Set LO output mode, RF output mode is considered normal use case
     // Testing mode is for LMX V&V
     bool _testing_mode_enabled;
+
+    // Last value passed to set_lo_port_enabled()
+    bool _port_enabled = false;
+
+    // Precomputed LMX settings, by LO frequency (see set_precomputed_lo_freqs())
+    std::map<double, freq_image_t> _freq_images;
 };
 
 }}} // namespace uhd::usrp::zbx
@@ -6,7 +6,15 @@
 
 #pragma once
 
+#include <uhd/exception.hpp>
 #include <uhd/types/ranges.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <uhd/types/tune_request.hpp>
+#include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/usrp/radio_profile.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace uhd {
 
@@ -33,5 +41,42 @@ static meta_range_t make_overall_tune_range(
     return range;
 }
 
+/*! Check that the times of a multi_usrp frequency schedule don't decrease
+ *
+ * \throws uhd::value_error otherwise
+ */
+static void assert_freq_schedule_sorted(
+    const std::vector<std::pair<time_spec_t, tune_request_t>>& schedule)
+{
+    for (size_t i = 1; i < schedule.size(); i++) {
+        if (schedule[i].first < schedule[i - 1].first) {
+            throw uhd::value_error("Frequency schedule: Entry " + std::to_string(i)
+                                   + " is scheduled before the previous entry!");
+        }
+    }
+}
+
+namespace usrp {
+
+/*! Read the settings of some channels of a multi_usrp
+ *
+ * Settings which the device doesn't support are left unset.
+ */
+radio_profile_t capture_radio_profile(multi_usrp& usrp,
+    const std::vector<size_t>& rx_chans,
+    const std::vector<size_t>& tx_chans);
+
+/*! Apply the settings of \p profile which differ from the current ones
+ *
+ * This is the implementation of multi_usrp::apply_profile(). All settings
+ * are applied in one command batch, with \p cmd_time as the command time
+ * unless it is time_spec_t::ASAP.
+ *
+ * \returns the settings which were applied
+ */
+radio_profile_t apply_radio_profile(
+    multi_usrp& usrp, const radio_profile_t& profile, const time_spec_t& cmd_time);
+
+} // namespace usrp
 
 } // namespace uhd
@@ -0,0 +1,176 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace usrp {
+
+/*!
+ * Keeps released streamers so that they can be handed out again
+ *
+ * A streamer which was handed out with lend() is not destroyed when the last
+ * reference to it is dropped. Instead, it goes back to the pool, together with
+ * its graph connections, transports and buffers. acquire() hands out an idle
+ * streamer which was lent with the same key again, after calling its
+ * reset_stream_state() method. If the pool is full or was destroyed, released
+ * streamers are destroyed as usual.
+ *
+ * Idle streamers still use their channels. Before a streamer with a different
+ * key is created for any of them, evict() must destroy the idle streamers
+ * which use them.
+ *
+ * \tparam streamer_t The streamer type, which needs a reset_stream_state()
+ *         method
+ */
+template <typename streamer_t>
+class streamer_pool : public std::enable_shared_from_this<streamer_pool<streamer_t>>
+{
+public:
+    using sptr          = std::shared_ptr<streamer_pool>;
+    using streamer_sptr = std::shared_ptr<streamer_t>;
+
+    /*!
+     * \param capacity The maximum number of idle streamers the pool keeps
+     */
+    static sptr make(const size_t capacity)
+    {
+        return sptr(new streamer_pool(capacity));
+    }
+
+    //! Returns the maximum number of idle streamers
+    size_t get_capacity() const
+    {
+        return _capacity;
+    }
+
+    //! Returns the number of idle streamers
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _idle.size();
+    }
+
+    /*!
+     * Takes an idle streamer out of the pool
+     *
+     * \param key Identifies the streamer arguments
+     * \return the streamer after resetting its stream state, or nullptr if
+     *         there is no idle streamer for \p key
+     */
+    streamer_sptr acquire(const std::string& key)
+    {
+        entry_t entry;
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            auto it = _idle.find(key);
+            if (it == _idle.end()) {
+                return nullptr;
+            }
+            entry = std::move(it->second);
+            _idle.erase(it);
+        }
+        entry.streamer->reset_stream_state();
+        return lend(key, entry.channels, std::move(entry.streamer));
+    }
+
+    /*!
+     * Returns a reference to \p streamer which returns it to the pool when it
+     * is released
+     *
+     * \param key Identifies the streamer arguments
+     * \param channels The channels the streamer uses, for evict()
+     * \param streamer The streamer
+     */
+    streamer_sptr lend(const std::string& key,
+        const std::vector<size_t>& channels,
+        streamer_sptr streamer)
+    {
+        std::weak_ptr<streamer_pool> pool_ref(this->shared_from_this());
+        streamer_t* ptr = streamer.get();
+        // The deleter owns the streamer. It must not keep it until the deleter
+        // itself is destroyed, which weak references to the returned pointer
+        // can delay, so the streamer is destroyed on release unless the pool
+        // takes it.
+        return streamer_sptr(
+            ptr, [pool_ref, key, channels, streamer](streamer_t*) mutable {
+                streamer_sptr released = std::move(streamer);
+                if (auto pool = pool_ref.lock()) {
+                    pool->_release(key, channels, std::move(released));
+                }
+            });
+    }
+
+    /*!
+     * Destroys the idle streamers which use any of \p channels
+     */
+    void evict(const std::vector<size_t>& channels)
+    {
+        std::vector<entry_t> evicted;
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            for (auto it = _idle.begin(); it != _idle.end();) {
+                const auto& used = it->second.channels;
+                const bool overlap =
+                    std::any_of(channels.cbegin(), channels.cend(), [&](size_t chan) {
+                        return std::find(used.cbegin(), used.cend(), chan)
+                               != used.cend();
+                    });
+                if (overlap) {
+                    evicted.push_back(std::move(it->second));
+                    it = _idle.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        // The streamers are destroyed here, without holding the lock, because
+        // destroying them disconnects them from the graph
+    }
+
+    //! Destroys all idle streamers
+    void clear()
+    {
+        std::map<std::string, entry_t> idle;
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            idle.swap(_idle);
+        }
+    }
+
+private:
+    struct entry_t
+    {
+        streamer_sptr streamer;
+        std::vector<size_t> channels;
+    };
+
+    streamer_pool(const size_t capacity) : _capacity(capacity) {}
+
+    //! Keeps \p streamer if there is room. Otherwise, it is destroyed when the
+    // parameter goes out of scope, after the lock was released.
+    void _release(const std::string& key,
+        const std::vector<size_t>& channels,
+        streamer_sptr streamer)
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_idle.size() < _capacity && !_idle.count(key)) {
+            _idle[key] = entry_t{std::move(streamer), channels};
+        }
+    }
+
+    const size_t _capacity;
+    mutable std::mutex _mutex;
+    std::map<std::string, entry_t> _idle;
+};
+
+}} // namespace uhd::usrp
@@ -0,0 +1,96 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/device_addr.hpp>
+#include <boost/lexical_cast.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace uhd {
+
+/*! A pre-parsed, read-only view of a device_addr_t
+ *
+ * Looking up a key of a device_addr_t searches all of its pairs, and cast<>()
+ * does that twice before it runs lexical_cast. Code which reads many args,
+ * like the construction of streamers, creates an args_view once instead. It
+ * indexes the keys in a hash map, and keeps every conversion, so reading the
+ * same arg as the same type again is a lookup.
+ *
+ * The accessors behave like the ones of device_addr_t. As they fill the
+ * cache, an args_view must not be shared between threads.
+ */
+class args_view
+{
+public:
+    explicit args_view(const device_addr_t& args)
+    {
+        for (const auto& key : args.keys()) {
+            _entries.emplace(key, entry_t{args[key], {}});
+        }
+    }
+
+    bool has_key(const std::string& key) const
+    {
+        return _entries.count(key) > 0;
+    }
+
+    //! Return the value of a key, or \p def if the key is not present
+    std::string get(const std::string& key, const std::string& def = "") const
+    {
+        const auto entry = _entries.find(key);
+        return entry == _entries.end() ? def : entry->second.value;
+    }
+
+    /*! Lexically cast a value, or return \p def if the key is not present
+     *
+     * \throws std::runtime_error if the value cannot be cast, like
+     *         device_addr_t::cast()
+     */
+    template <typename T>
+    T cast(const std::string& key, const T& def) const
+    {
+        const auto entry = _entries.find(key);
+        if (entry == _entries.end()) {
+            return def;
+        }
+        auto& conversions = entry->second.conversions;
+        const std::type_index type(typeid(T));
+        for (const auto& conversion : conversions) {
+            if (conversion.first == type) {
+                return *static_cast<const T*>(conversion.second.get());
+            }
+        }
+        try {
+            auto value = std::make_shared<const T>(
+                boost::lexical_cast<T>(entry->second.value));
+            conversions.emplace_back(type, value);
+            return *value;
+        } catch (const boost::bad_lexical_cast&) {
+            throw std::runtime_error("cannot cast " + key + " = " + entry->second.value);
+        }
+    }
+
+private:
+    struct entry_t
+    {
+        std::string value;
+        //! The value converted to every type it was cast to so far
+        mutable std::vector<std::pair<std::type_index, std::shared_ptr<const void>>>
+            conversions;
+    };
+
+    std::unordered_map<std::string, entry_t> _entries;
+};
+
+} // namespace uhd
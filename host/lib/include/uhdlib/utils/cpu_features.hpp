@@ -0,0 +1,64 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <string>
+
+namespace uhd { namespace cpu {
+
+/*! Runtime-detected instruction set extensions of the host CPU
+ *
+ * The features are queried once (using CPUID on x86) and cached. A feature is
+ * only reported as available if both the CPU and the operating system support
+ * it (e.g., AVX requires the OS to save the YMM registers on context switches).
+ * On non-x86 platforms, all x86 features are reported as unavailable.
+ */
+struct features_t
+{
+    bool sse2     = false;
+    bool ssse3    = false;
+    bool avx2     = false;
+    bool avx512f  = false;
+    bool avx512bw = false;
+    bool f16c     = false;
+
+    //! Return a comma-separated list of the supported features
+    std::string to_string() const;
+};
+
+/*! Return the instruction set extensions of the host CPU
+ *
+ * This function is thread-safe and cheap to call after the first invocation.
+ */
+const features_t& get_features();
+
+//! Shorthand for get_features().avx2
+inline bool has_avx2()
+{
+    return get_features().avx2;
+}
+
+//! Return true if both AVX2 and F16C (float/half conversions) are available
+inline bool has_avx2_f16c()
+{
+    return get_features().avx2 && get_features().f16c;
+}
+
+//! Shorthand for get_features().avx512f
+inline bool has_avx512f()
+{
+    return get_features().avx512f;
+}
+
+//! Return true if both AVX512F and AVX512BW are available
+inline bool has_avx512bw()
+{
+    return get_features().avx512f && get_features().avx512bw;
+}
+
+}} // namespace uhd::cpu
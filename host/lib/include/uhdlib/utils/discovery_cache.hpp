@@ -0,0 +1,73 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/device_addr.hpp>
+#include <boost/optional.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! An on-disk cache of device discovery results
+ *
+ * For every discovery hint, the cache stores the devices that were found, and
+ * the index of the finder (see device::register_device()) that found them.
+ * The cache does not check if the devices still exist, that's up to the
+ * caller.
+ *
+ * The cache is a text file which records the UHD version that wrote it. If
+ * the version doesn't match, all entries are ignored, because the finder
+ * indices may have changed. I/O errors are logged, but never thrown; a broken
+ * cache behaves like an empty one.
+ */
+class discovery_cache
+{
+public:
+    //! Environment variable which enables the cache
+    static constexpr const char* ENV_VAR = "UHD_DISCOVERY_CACHE";
+
+    struct entry_t
+    {
+        size_t finder_idx;
+        device_addr_t dev_addr;
+    };
+    using entries_t = std::vector<entry_t>;
+
+    /*! Return the path of the cache file, or an empty string if the cache is
+     * disabled
+     *
+     * The cache is enabled by setting UHD_DISCOVERY_CACHE either to 1, which
+     * selects a file in the UHD data directory, or to the path of a file.
+     */
+    static std::string get_path_from_env();
+
+    //! Create a key for a discovery hint and a device filter
+    static std::string make_key(const device_addr_t& hint, const int filter);
+
+    discovery_cache(const std::string& path);
+
+    //! Return the entries for \p key, or nothing if there are none
+    boost::optional<entries_t> lookup(const std::string& key) const;
+
+    //! Replace the entries for \p key
+    void store(const std::string& key, const entries_t& entries);
+
+    //! Remove the entries for \p key
+    void erase(const std::string& key);
+
+private:
+    using cache_t = std::map<std::string, entries_t>;
+
+    cache_t _read() const;
+    void _write(const cache_t& cache) const;
+
+    const std::string _path;
+};
+
+} // namespace uhd
@@ -0,0 +1,192 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/log.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+/*! \file fast_log.hpp
+ * Logging for threads which must not be slowed down, e.g., streaming threads
+ *
+ * The regular UHD_LOG_* macros format the message on the calling thread, and
+ * hand it to the logger thread through a shared, locked queue. The macros in
+ * this file instead copy the format string pointer and the raw values of the
+ * arguments into a ring buffer owned by the calling thread, without allocating
+ * memory or taking a lock. The logger thread drains these rings, formats the
+ * messages, and passes them on to the regular logging backends.
+ *
+ * Example:
+ *
+ *     UHD_LOG_FAST_DEBUG("IO_SRV", "Dropping packet of %d bytes", size);
+ *
+ * Formatting uses boost::format, so both printf-style (`%d`, `%x`) and
+ * positional (`%1%`) directives work. Only arithmetic and enum arguments are
+ * supported, at most fast_log_record::MAX_ARGS of them. The component and the
+ * format must be string literals, or otherwise outlive the logger thread.
+ *
+ * If the ring of a thread is full, its messages are dropped, and the number of
+ * dropped messages is logged later on.
+ */
+
+namespace uhd { namespace _log {
+
+//! The raw value of an argument to a fast log message
+struct fast_log_arg
+{
+    enum type_t : uint8_t { SIGNED, UNSIGNED, FLOAT };
+
+    type_t type;
+    union {
+        int64_t s;
+        uint64_t u;
+        double f;
+    };
+};
+
+//! A fast log message which has not been formatted yet
+struct fast_log_record
+{
+    static constexpr size_t MAX_ARGS = 6;
+    //! Size of the text of a fastpath message (see UHD_LOG_FASTPATH)
+    static constexpr size_t TEXT_SIZE = MAX_ARGS * sizeof(fast_log_arg);
+
+    //! Time since the epoch of the system clock
+    int64_t time_ns;
+    std::thread::id thread_id;
+    const char* file;
+    const char* component;
+    //! nullptr for fastpath messages, which store their text instead of args
+    const char* format;
+    uint32_t line;
+    uhd::log::severity_level verbosity;
+    uint8_t num_args;
+    union {
+        fast_log_arg args[MAX_ARGS];
+        char text[TEXT_SIZE];
+    };
+};
+
+//! Return true if messages of this level pass the global log level
+UHD_API bool fast_log_enabled(const uhd::log::severity_level verbosity);
+
+//! Time-stamp a record and add it to the ring of the calling thread
+UHD_API void push_fast_log(fast_log_record& record);
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, fast_log_arg>::type
+make_fast_log_arg(const T value)
+{
+    fast_log_arg arg;
+    arg.type = fast_log_arg::FLOAT;
+    arg.f    = static_cast<double>(value);
+    return arg;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+    fast_log_arg>::type
+make_fast_log_arg(const T value)
+{
+    fast_log_arg arg;
+    arg.type = fast_log_arg::SIGNED;
+    arg.s    = static_cast<int64_t>(value);
+    return arg;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,
+    fast_log_arg>::type
+make_fast_log_arg(const T value)
+{
+    fast_log_arg arg;
+    arg.type = fast_log_arg::UNSIGNED;
+    arg.u    = static_cast<uint64_t>(value);
+    return arg;
+}
+
+template <typename T>
+typename std::enable_if<std::is_enum<T>::value, fast_log_arg>::type make_fast_log_arg(
+    const T value)
+{
+    return make_fast_log_arg(static_cast<typename std::underlying_type<T>::type>(value));
+}
+
+//! Log a message without formatting it on this thread (called by UHD_LOG_FAST_*)
+template <typename... Args>
+void log_fast(const uhd::log::severity_level verbosity,
+    const char* file,
+    const unsigned int line,
+    const char* component,
+    const char* format,
+    const Args... args)
+{
+    static_assert(sizeof...(Args) <= fast_log_record::MAX_ARGS,
+        "Too many arguments for a fast log message");
+    if (!fast_log_enabled(verbosity)) {
+        return;
+    }
+    fast_log_record record;
+    record.file      = file;
+    record.line      = static_cast<uint32_t>(line);
+    record.component = component;
+    record.format    = format;
+    record.verbosity = verbosity;
+    record.num_args  = static_cast<uint8_t>(sizeof...(Args));
+    size_t i         = 0;
+    // The leading zero keeps this array non-empty when there are no arguments
+    const int unused[] = {0, (record.args[i++] = make_fast_log_arg(args), 0)...};
+    (void)unused;
+    (void)i;
+    push_fast_log(record);
+}
+
+}} // namespace uhd::_log
+
+//! \cond
+//! Internal fast logging macro, the format is the first of the variadic arguments
+#define _UHD_LOG_FAST_INTERNAL(component, level, ...) \
+    uhd::_log::log_fast(level, __FILE__, __LINE__, component, __VA_ARGS__)
+//! \endcond
+
+#if UHD_LOG_MIN_LEVEL < 1
+#    define UHD_LOG_FAST_TRACE(component, ...) \
+        _UHD_LOG_FAST_INTERNAL(component, uhd::log::trace, __VA_ARGS__);
+#else
+#    define UHD_LOG_FAST_TRACE(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 2
+#    define UHD_LOG_FAST_DEBUG(component, ...) \
+        _UHD_LOG_FAST_INTERNAL(component, uhd::log::debug, __VA_ARGS__);
+#else
+#    define UHD_LOG_FAST_DEBUG(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 3
+#    define UHD_LOG_FAST_INFO(component, ...) \
+        _UHD_LOG_FAST_INTERNAL(component, uhd::log::info, __VA_ARGS__);
+#else
+#    define UHD_LOG_FAST_INFO(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 4
+#    define UHD_LOG_FAST_WARNING(component, ...) \
+        _UHD_LOG_FAST_INTERNAL(component, uhd::log::warning, __VA_ARGS__);
+#else
+#    define UHD_LOG_FAST_WARNING(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 5
+#    define UHD_LOG_FAST_ERROR(component, ...) \
+        _UHD_LOG_FAST_INTERNAL(component, uhd::log::error, __VA_ARGS__);
+#else
+#    define UHD_LOG_FAST_ERROR(component, ...)
+#endif
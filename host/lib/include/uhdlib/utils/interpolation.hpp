@@ -10,8 +10,10 @@
 
 #include <uhd/utils/math.hpp>
 #include <uhd/utils/interpolation.hpp>
+#include <cstddef>
 #include <map>
 #include <utility>
+#include <vector>
 
 namespace uhd { namespace math {
 
@@ -47,6 +49,59 @@ get_bounding_iterators(const map_type& data, const typename map_type::key_type&
     return {prev_it, next_it};
 }
 
+//! Like std::lower_bound(), but returns an index into a sorted vector
+//
+// Complexity: Logarithmic, like std::lower_bound(). The search is branchless:
+// Every step halves the search range by picking one of the two halves with a
+// conditional move instead of a branch, so the number of steps only depends on
+// the size of \p keys, and the CPU never mispredicts which half to continue with.
+// This is the search for the flattened (sorted-array) lookup tables of the cal
+// data containers.
+//
+// Returns keys.size() if all keys are smaller than \p key.
+template <typename key_type>
+size_t lower_bound_index(const std::vector<key_type>& keys, const key_type key)
+{
+    if (keys.empty()) {
+        return 0;
+    }
+    const key_type* base = keys.data();
+    size_t size          = keys.size();
+    while (size > 1) {
+        const size_t half = size / 2;
+        base              = (base[half] < key) ? base + half : base;
+        size -= half;
+    }
+    return static_cast<size_t>(base - keys.data()) + (*base < key ? 1 : 0);
+}
+
+//! Like get_bounding_iterators(), but for a sorted vector of keys
+//
+// Returns the indices of the keys before and after \p key.
+template <typename key_type>
+std::pair<size_t, size_t> get_bounding_indices(
+    const std::vector<key_type>& keys, const key_type key)
+{
+    const size_t next_idx = lower_bound_index(keys, key);
+    if (next_idx == keys.size()) {
+        return {next_idx - 1, next_idx - 1};
+    }
+    return {next_idx == 0 ? 0 : next_idx - 1, next_idx};
+}
+
+//! Like at_nearest(), but returns the index of the nearest key in a sorted vector
+template <typename key_type>
+size_t get_nearest_index(const std::vector<key_type>& keys, const key_type key)
+{
+    const size_t next_idx = lower_bound_index(keys, key);
+    if (next_idx == keys.size()) {
+        return next_idx - 1;
+    }
+    if (next_idx == 0) {
+        return 0;
+    }
+    return (keys[next_idx] - key < key - keys[next_idx - 1]) ? next_idx : next_idx - 1;
+}
 
 //! Linearly interpolate f(x) given f(x0) = y0 and f(x1) = y1
 //
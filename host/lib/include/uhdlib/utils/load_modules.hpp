@@ -0,0 +1,23 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+namespace uhd {
+
+/*! Load all modules in the module paths, unless that already happened
+ *
+ * Modules are loaded on first use rather than when the library is loaded,
+ * so tools which never look for devices, blocks or converters don't pay for
+ * scanning the module paths. Every registry that modules can add to calls
+ * this before it is looked up.
+ *
+ * Thread-safe. Does not throw: errors are printed to std error. Calls from
+ * the static initializers of a module return right away.
+ */
+void load_modules();
+
+} /* namespace uhd */
@@ -0,0 +1,124 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace uhd {
+
+/*!
+ * A fixed-size, lock-free multi-producer/single-consumer ring buffer
+ *
+ * push() may be called from any number of threads at the same time, pop()
+ * only from one thread at a time. Every slot carries a sequence number, which
+ * tells producers whether the slot is free and the consumer whether it has
+ * been written. Producers claim slots with a compare-and-swap on the tail, so
+ * a producer which is preempted between claiming and filling its slot only
+ * delays the consumer, not the other producers.
+ */
+template <typename T>
+class mpsc_ring
+{
+public:
+    /*!
+     * \param capacity Minimum number of items the ring can hold. It is rounded
+     *        up to the next power of two.
+     */
+    mpsc_ring(const size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _slots.reset(new slot_t[size]);
+        _mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            _slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpsc_ring(const mpsc_ring&) = delete;
+    mpsc_ring& operator=(const mpsc_ring&) = delete;
+
+    //! Return the number of items the ring can hold
+    size_t capacity() const
+    {
+        return _mask + 1;
+    }
+
+    /*! Add an item to the ring (any thread)
+     *
+     * \return false if the ring is full
+     */
+    bool push(const T& item)
+    {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        slot_t* slot;
+        while (true) {
+            slot = &_slots[tail & _mask];
+            const size_t seq    = slot->seq.load(std::memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(tail);
+            if (diff == 0) {
+                // The slot is free, try to claim it
+                if (_tail.compare_exchange_weak(
+                        tail, tail + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot still holds the item from one round earlier
+                return false;
+            } else {
+                // Another producer claimed the slot
+                tail = _tail.load(std::memory_order_relaxed);
+            }
+        }
+        slot->item = item;
+        slot->seq.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*! Remove the oldest item (consumer only)
+     *
+     * \return false if the ring is empty, or if the producer of the oldest
+     *         item is still writing it
+     */
+    bool pop(T& item)
+    {
+        slot_t& slot = _slots[_head & _mask];
+        if (slot.seq.load(std::memory_order_acquire) != _head + 1) {
+            return false;
+        }
+        item = slot.item;
+        // Free the slot for the producers of the next round
+        slot.seq.store(_head + _mask + 1, std::memory_order_release);
+        _head++;
+        return true;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct slot_t
+    {
+        std::atomic<size_t> seq;
+        T item;
+    };
+
+    // Read-only after construction
+    std::unique_ptr<slot_t[]> _slots;
+    size_t _mask = 0;
+
+    // Consumer side: index of the next item to read
+    alignas(CACHE_LINE_SIZE) size_t _head = 0;
+
+    // Producer side: index of the next slot to claim
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail{0};
+};
+
+} // namespace uhd
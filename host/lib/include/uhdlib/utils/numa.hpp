@@ -0,0 +1,73 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace numa {
+
+//! Node value meaning "no NUMA node, or unknown"
+constexpr int NO_NODE = -1;
+
+/*! Return the NUMA node a network interface is attached to
+ *
+ * On Linux, this is read from sysfs. On other platforms, or for virtual
+ * interfaces, NO_NODE is returned.
+ */
+int get_ifname_node(const std::string& ifname);
+
+/*! Return the NUMA node of the network interface with an IPv4 address
+ *
+ * \param ipv4_addr Address in dotted-decimal notation
+ * \return the node, or NO_NODE if no interface has that address or its node
+ *         is unknown
+ */
+int get_ipv4_node(const std::string& ipv4_addr);
+
+/*! Return the CPUs of a NUMA node
+ *
+ * \return the CPU numbers, or an empty list if \p node is unknown
+ */
+std::vector<size_t> get_node_cpus(const int node);
+
+/*! Parse a Linux CPU list, e.g., "0-3,8,10-11"
+ *
+ * \throws uhd::value_error if \p cpu_list is malformed
+ */
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list);
+
+/*! Allocate memory whose pages are placed on a NUMA node
+ *
+ * The memory is page-aligned and zero-initialized. The placement is a
+ * preference: if the node runs out of memory, the kernel uses another one.
+ *
+ * \param size Number of bytes to allocate
+ * \param node The NUMA node
+ * \return the memory, or nullptr if NUMA placement is not supported on this
+ *         platform or the allocation failed. Release it with free_on_node().
+ */
+void* alloc_on_node(const size_t size, const int node);
+
+//! Release memory returned by alloc_on_node()
+void free_on_node(void* mem, const size_t size);
+
+/*! Ask for pages of an existing mapping to be placed on a NUMA node
+ *
+ * This only affects pages which are not allocated yet, i.e., it must be called
+ * before the memory is first touched.
+ *
+ * \param mem Page-aligned start of the memory, e.g., as returned by mmap()
+ * \param size Number of bytes
+ * \param node The NUMA node
+ * \return false if NUMA placement is not supported or failed
+ */
+bool bind_to_node(void* mem, const size_t size, const int node);
+
+}} // namespace uhd::numa
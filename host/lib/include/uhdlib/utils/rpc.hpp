@@ -17,6 +17,9 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -44,6 +47,85 @@ bool await_rpc_connected_state(
 
 namespace uhd {
 
+/*! A list of RPC calls which is sent to the server in a single request
+ *
+ * The RPC server needs to provide a `batch` call. It takes a token and a list
+ * of (function name, arguments) pairs, runs the calls in order, and returns
+ * the list of their return values. See rpc_client::request_batch().
+ */
+class rpc_batch
+{
+public:
+    /*! Add a call to the batch
+     *
+     * \param func_name The function name that is called via RPC
+     * \param args All these arguments are passed to the RPC call. Don't pass
+     *             the token, the server does that if the call requires it.
+     */
+    template <typename... Args>
+    void add(std::string const& func_name, Args&&... args)
+    {
+        _calls.emplace_back(func_name,
+            RPCLIB_MSGPACK::object(std::make_tuple(std::forward<Args>(args)...), _zone));
+    }
+
+    //! Return the number of calls in the batch
+    size_t size() const
+    {
+        return _calls.size();
+    }
+
+private:
+    friend class rpc_client;
+
+    //! Owns the memory of the arguments
+    RPCLIB_MSGPACK::zone _zone;
+    std::vector<std::pair<std::string, RPCLIB_MSGPACK::object>> _calls;
+};
+
+/*! The return values of the calls of an rpc_batch
+ *
+ * The return values are in the order the calls were added to the batch.
+ */
+class rpc_batch_result
+{
+public:
+    /*! Return the return value of a call
+     *
+     * \param idx The index of the call within the batch
+     * \throws uhd::runtime_error if the value can't be converted to return_type
+     */
+    template <typename return_type>
+    return_type get(const size_t idx) const
+    {
+        try {
+            return _results.at(idx).template as<return_type>();
+        } catch (const std::bad_cast& ex) {
+            throw uhd::runtime_error(
+                str(boost::format("Error reading result %d of RPC batch: %s") % idx
+                    % ex.what()));
+        }
+    }
+
+    //! Return the number of return values
+    size_t size() const
+    {
+        return _results.size();
+    }
+
+private:
+    friend class rpc_client;
+
+    rpc_batch_result(RPCLIB_MSGPACK::object_handle&& handle)
+        : _handle(std::move(handle))
+        , _results(_handle.get().as<std::vector<RPCLIB_MSGPACK::object>>())
+    {
+    }
+
+    //! Owns the memory of the return values
+    RPCLIB_MSGPACK::object_handle _handle;
+    std::vector<RPCLIB_MSGPACK::object> _results;
+};
 
 /*! Abstraction for RPC client
  *
@@ -223,6 +305,38 @@ public:
         }
     };
 
+    /*! Perform all the calls of an RPC batch with a single request.
+     *
+     * Thread safe (locked). This function blocks until it receives a valid
+     * response from the server. The server runs the calls in order, and
+     * passes the token to the calls which require one. The first call that
+     * fails aborts the batch.
+     *
+     * \param batch The calls to perform
+     * \returns the return values of the calls
+     *
+     * \throws uhd::runtime_error in case of failure
+     */
+    rpc_batch_result request_batch(const rpc_batch& batch)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        try {
+            return rpc_batch_result(_client->call("batch", _token, batch._calls));
+        } catch (const ::rpc::rpc_error& ex) {
+            const std::string error = _get_last_error_safe();
+            if (not error.empty()) {
+                UHD_LOG_ERROR("RPC", error);
+            }
+            throw uhd::runtime_error(
+                str(boost::format("Error during RPC batch call. Error message: %s")
+                    % (error.empty() ? ex.what() : error)));
+        } catch (const std::bad_cast& ex) {
+            throw uhd::runtime_error(
+                str(boost::format("Error during RPC batch call. Error message: %s")
+                    % ex.what()));
+        }
+    };
+
     /*! Like request(), also provides a token.
      *
      * This is a convenience wrapper to directly call a function that requires
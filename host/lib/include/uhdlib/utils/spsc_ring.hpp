@@ -0,0 +1,195 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace uhd {
+
+/*!
+ * A fixed-size, lock-free single-producer/single-consumer ring buffer
+ *
+ * push() may only be called from one thread at a time, and so may peek() and
+ * pop(). The producer and consumer indices live on separate cache lines, and
+ * each side keeps a private copy of the other side's index, so that it only
+ * reads the other side's cache line when the ring appears full or empty.
+ *
+ * If the ring is created with \p blocking set, the consumer may also wait for
+ * items with pop(item, timeout_ms). The wakeup works like a futex: a waiting
+ * consumer announces itself through a flag, and the producer only takes the
+ * mutex to notify it if that flag is set. When nobody waits, push() takes no
+ * lock.
+ */
+template <typename T>
+class spsc_ring
+{
+public:
+    /*!
+     * \param capacity Minimum number of items the ring can hold. It is rounded
+     *        up to the next power of two.
+     * \param blocking Allow the consumer to wait for items with a timeout
+     */
+    spsc_ring(const size_t capacity, const bool blocking = false)
+        : _blocking(blocking)
+    {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _buffer.resize(size);
+        _mask = size - 1;
+    }
+
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    //! Return the number of items the ring can hold
+    size_t capacity() const
+    {
+        return _buffer.size();
+    }
+
+    /*! Add an item to the ring (producer only)
+     *
+     * \return false if the ring is full
+     */
+    bool push(const T& item)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cached_head == _buffer.size()) {
+            _cached_head = _head.load(std::memory_order_acquire);
+            if (tail - _cached_head == _buffer.size()) {
+                return false;
+            }
+        }
+        _buffer[tail & _mask] = item;
+        _tail.store(tail + 1, std::memory_order_release);
+
+        if (_blocking) {
+            // Pairs with the fence in pop(): Either the consumer sees the new
+            // tail, or we see that it is waiting
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_waiting.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _cond.notify_one();
+            }
+        }
+        return true;
+    }
+
+    /*! Read the oldest item without removing it (consumer only)
+     *
+     * \return false if the ring is empty
+     */
+    bool peek(T& item)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (!_readable(head)) {
+            return false;
+        }
+        item = _buffer[head & _mask];
+        return true;
+    }
+
+    /*! Remove the oldest item (consumer only)
+     *
+     * \return false if the ring is empty
+     */
+    bool pop(T& item)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (!_readable(head)) {
+            return false;
+        }
+        item = _buffer[head & _mask];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*! Remove the oldest item, waiting for one if necessary (consumer only)
+     *
+     * The ring must have been created with \p blocking set, unless
+     * \p timeout_ms is zero.
+     *
+     * \param item The removed item
+     * \param timeout_ms Time to wait for an item. A negative value waits
+     *        indefinitely.
+     * \return false if no item arrived before the timeout
+     */
+    bool pop(T& item, const int32_t timeout_ms)
+    {
+        if (pop(item)) {
+            return true;
+        }
+        if (timeout_ms == 0) {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const size_t head = _head.load(std::memory_order_relaxed);
+        auto ready        = [this, head]() {
+            return _tail.load(std::memory_order_acquire) != head;
+        };
+        bool success = true;
+        if (timeout_ms < 0) {
+            _cond.wait(lock, ready);
+        } else {
+            success = _cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready);
+        }
+        _waiting.store(false, std::memory_order_relaxed);
+        lock.unlock();
+
+        return success && pop(item);
+    }
+
+    //! Return the number of items in the ring
+    size_t read_available() const
+    {
+        return _tail.load(std::memory_order_acquire)
+               - _head.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    bool _readable(const size_t head)
+    {
+        if (head == _cached_tail) {
+            _cached_tail = _tail.load(std::memory_order_acquire);
+            return head != _cached_tail;
+        }
+        return true;
+    }
+
+    // Read-only after construction
+    std::vector<T> _buffer;
+    size_t _mask = 0;
+    const bool _blocking;
+
+    // Consumer side: index of the next item to read, and the last tail it saw.
+    // The indices only ever increase, the slot is index & _mask.
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head{0};
+    size_t _cached_tail = 0;
+
+    // Producer side: index of the next slot to write, and the last head it saw
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail{0};
+    size_t _cached_head = 0;
+
+    // Only used in blocking mode
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> _waiting{false};
+    std::mutex _mutex;
+    std::condition_variable _cond;
+};
+
+} // namespace uhd
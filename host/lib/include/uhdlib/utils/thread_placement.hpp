@@ -0,0 +1,66 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/types/device_addr.hpp>
+#include <uhd/utils/thread.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace uhd { namespace numa {
+
+//! Where a logical CPU sits in the machine
+struct cpu_info_t
+{
+    //! The CPU number, as used by set_thread_affinity()
+    size_t cpu = 0;
+    //! The physical package (socket)
+    int package = 0;
+    //! The NUMA node, or NO_NODE if unknown
+    int node = -1;
+    //! The lowest CPU number of the physical core, which is shared by all of
+    //! its SMT siblings
+    size_t core = 0;
+    //! True if the CPU was excluded from scheduling with isolcpus
+    bool isolated = false;
+};
+
+/*! Read the online CPUs of this machine
+ *
+ * On Linux, this is read from sysfs. Elsewhere, every CPU is reported as a
+ * core of its own, with an unknown node.
+ */
+std::vector<cpu_info_t> get_cpu_topology();
+
+/*! Assign CPUs to streaming threads
+ *
+ * Every thread gets a physical core of its own, as long as there are enough.
+ * The I/O threads get the best cores, followed by the converter threads and
+ * the application threads. The best cores are those on \p numa_node (if it is
+ * known), then the isolated ones, and the core of CPU 0 (which handles most
+ * housekeeping) comes last. If there are more threads than cores, they start
+ * sharing cores in the same order, using the SMT siblings first.
+ */
+uhd::thread_placement_t plan_thread_placement(const std::vector<cpu_info_t>& topology,
+    const size_t num_io_threads,
+    const size_t num_convert_threads,
+    const size_t num_app_threads,
+    const int numa_node);
+
+/*! Return the CPUs for the converter threads of a streamer
+ *
+ * \param stream_args The stream args. convert_cpus is either a colon-separated
+ *        list of CPU numbers, or "auto" to place the threads with
+ *        get_thread_placement(), next to num_poll_offload_threads I/O threads
+ *        (default 1) on numa_node (default: all nodes).
+ * \param num_threads The number of converter threads
+ * \throws uhd::value_error if convert_cpus is malformed
+ */
+std::vector<size_t> get_convert_cpus(
+    const uhd::device_addr_t& stream_args, const size_t num_threads);
+
+}} // namespace uhd::numa
@@ -0,0 +1,85 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace uhd {
+
+/*! Extrapolate the time of a device from its last readback
+ *
+ * Reading the time of a device is a register readback, i.e., a round trip
+ * over the control transport. The estimator reads the device time at most once
+ * per resync period, stores it along with the host time of the readback
+ * (steady_clock, taken in the middle of the round trip), and extrapolates the
+ * device time from there with the nominal tick rate.
+ *
+ * The error of an estimate is at most half of the round trip of the last
+ * readback, plus the drift of the host clock against the device clock over one
+ * resync period. With clocks which are 50 ppm apart and the default resync
+ * period, the drift is 50 us.
+ *
+ * get_ticks() doesn't lock when it extrapolates. The readback is published
+ * with a sequence counter, and a thread which finds the readback too old does
+ * the next readback, while other threads keep extrapolating the previous one.
+ */
+class time_estimator
+{
+public:
+    using read_ticks_fn_t = std::function<uint64_t(void)>;
+
+    //! Default time between two readbacks, in seconds
+    static constexpr double DEFAULT_RESYNC_PERIOD = 1.0;
+
+    /*!
+     * \param read_ticks Reads the device time from the hardware
+     * \param resync_period Time between two readbacks, in seconds
+     */
+    time_estimator(
+        read_ticks_fn_t read_ticks, const double resync_period = DEFAULT_RESYNC_PERIOD);
+
+    /*! Return the estimated device time
+     *
+     * \param tick_rate The tick rate of the device time, in Hz
+     * \returns the estimated device time in ticks
+     */
+    uint64_t get_ticks(const double tick_rate);
+
+    /*! Discard the last readback
+     *
+     * Call this after every change of the device time, or of its tick rate.
+     *
+     * \param holdoff For this long (in seconds), every get_ticks() reads the
+     *                time from the hardware. Use this when the device time
+     *                changes later, e.g., at the next PPS edge.
+     */
+    void invalidate(const double holdoff = 0.0);
+
+private:
+    //! Load the last readback, returns false if there is no valid readback
+    bool _load(int64_t& host_ns, uint64_t& ticks) const;
+
+    void _store(const int64_t host_ns, const uint64_t ticks);
+
+    read_ticks_fn_t _read_ticks;
+    const int64_t _resync_period_ns;
+
+    //! Serializes readbacks and invalidations
+    std::mutex _resync_mutex;
+    //! Odd while a readback is being stored
+    std::atomic<uint32_t> _seq{0};
+    //! Host time of the last readback in ns, 0 if there is no valid readback
+    std::atomic<int64_t> _host_ns{0};
+    std::atomic<uint64_t> _ticks{0};
+    //! Host time until which every get_ticks() reads the hardware
+    std::atomic<int64_t> _holdoff_end_ns{0};
+};
+
+} // namespace uhd
@@ -0,0 +1,63 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+/*! \file trace_points.hpp
+ * Static trace points (USDT probes) on the streaming paths
+ *
+ * UHD_TRACE_POINT(name, args...) marks a point which bpftrace, perf, or
+ * SystemTap can attach to at run time, without rebuilding UHD. All probes
+ * belong to the provider "uhd", e.g.:
+ *
+ *     bpftrace -e 'usdt:/usr/local/lib/libuhd.so:uhd:rx_convert_start
+ *                  { @start[tid] = nsecs; }
+ *                  usdt:/usr/local/lib/libuhd.so:uhd:rx_convert_done
+ *                  { @ns = hist(nsecs - @start[tid]); }'
+ *
+ * As long as no tool is attached, a probe is a single nop instruction, plus
+ * whatever it takes to have the arguments in registers. The probes are
+ * compiled in if <sys/sdt.h> (e.g., from systemtap-sdt-dev) is found and the
+ * CMake option UHD_TRACE_POINTS is enabled, which defines
+ * UHD_ENABLE_TRACE_POINTS. Otherwise, the macro expands to nothing, and its
+ * arguments are not evaluated.
+ *
+ * Every probe takes at least one argument, which is the object the probe
+ * belongs to (e.g., the streamer), so concurrent streams can be told apart.
+ * Arguments must be integers or pointers, and at most 6 of them are allowed.
+ *
+ * The probes are:
+ * - rx_get_buffs_start(streamer, timeout_ms), rx_get_buffs_done(streamer,
+ *   num_samps, error_code): Waiting for the next packet of every channel
+ * - rx_convert_start(streamer, chan, num_samps), rx_convert_done(streamer,
+ *   chan, num_samps): Converting the samples of a channel
+ * - rx_release_buffs(streamer, num_chans): Releasing the packets, which also
+ *   sends flow control responses
+ * - tx_get_buffs_start(streamer, num_samps), tx_get_buffs_done(streamer,
+ *   success): Waiting for a buffer and flow control credits of every channel
+ * - tx_convert_start(streamer, chan, num_samps), tx_convert_done(streamer,
+ *   chan, num_samps): Converting the samples of a channel
+ * - tx_send(streamer, num_samps): Sending the packets of all channels
+ * - io_get_recv_buff(client, success), io_release_recv_buff(client): A
+ *   receive client of an I/O service gets a frame, or releases it (and
+ *   updates the flow control state)
+ * - io_fc_wait(client, num_bytes), io_fc_update(client, updated): A send
+ *   client waits for flow control credits, and has received a flow control
+ *   update (or timed out)
+ * - io_send(client, num_bytes): A send client sends a frame
+ * - offload_recv_buff(client, num_frames_in_use),
+ *   offload_release_recv_buff(client, num_frames_in_use),
+ *   offload_send_buff(client, num_frames_in_use),
+ *   offload_release_send_buff(client, num_frames_in_use): The offload thread
+ *   of an offload_io_service moves a frame from or to a client
+ */
+
+#ifdef UHD_ENABLE_TRACE_POINTS
+#    include <sys/sdt.h>
+#    define UHD_TRACE_POINT(name, ...) STAP_PROBEV(uhd, name, __VA_ARGS__)
+#else
+#    define UHD_TRACE_POINT(name, ...)
+#endif
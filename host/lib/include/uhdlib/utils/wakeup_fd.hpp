@@ -0,0 +1,56 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace uhd {
+
+/*!
+ * A file descriptor which one thread makes readable to wake up another
+ *
+ * On Linux, this is an eventfd. macOS and BSD use a non-blocking pipe. On
+ * other platforms, get_fd() returns -1 and all other methods do nothing.
+ *
+ * notify() may be called from any thread, clear() only from the thread which
+ * waits for the descriptor. Each notify() costs a system call, so users which
+ * notify often should only do so when the other side is waiting.
+ */
+class wakeup_fd
+{
+public:
+    wakeup_fd();
+    ~wakeup_fd();
+
+    wakeup_fd(const wakeup_fd&) = delete;
+    wakeup_fd& operator=(const wakeup_fd&) = delete;
+
+    //! Return the descriptor to poll for readability, or -1 if there is none
+    int get_fd() const
+    {
+        return _read_fd;
+    }
+
+    //! Make the descriptor readable
+    void notify();
+
+    //! Make the descriptor unreadable until the next notify()
+    void clear();
+
+    /*! Wait until the descriptor is readable
+     *
+     * \param timeout_ms The timeout in milliseconds, or -1 to wait forever
+     * \return false if the timeout expired, or if there is no descriptor
+     */
+    bool wait(const int32_t timeout_ms);
+
+private:
+    int _read_fd  = -1;
+    int _write_fd = -1;
+};
+
+} // namespace uhd
@@ -0,0 +1,198 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uhd {
+
+/*!
+ * A small pool of worker threads for splitting latency-sensitive work, such
+ * as per-channel sample conversion, across cores.
+ *
+ * run() hands out work items to the workers and to the calling thread, and
+ * returns once all of them are done. Idle workers spin for a short while
+ * before going to sleep, so that back-to-back calls to run() don't pay for a
+ * wakeup each time.
+ *
+ * run() must not be called from more than one thread at a time.
+ */
+class worker_pool
+{
+public:
+    using uptr = std::unique_ptr<worker_pool>;
+
+    /*!
+     * \param num_threads Number of worker threads, in addition to the
+     *        thread calling run()
+     * \param cpu_affinity If not empty, worker i is pinned to CPU
+     *        cpu_affinity[i % cpu_affinity.size()]
+     * \param name Thread name prefix
+     */
+    worker_pool(const size_t num_threads,
+        const std::vector<size_t>& cpu_affinity = {},
+        const std::string& name                 = "uhd_worker")
+    {
+        _threads.reserve(num_threads);
+        for (size_t i = 0; i < num_threads; i++) {
+            _threads.emplace_back([this, i, cpu_affinity]() {
+                if (!cpu_affinity.empty()) {
+                    uhd::set_thread_affinity({cpu_affinity[i % cpu_affinity.size()]});
+                }
+                _worker_loop();
+            });
+            uhd::set_thread_name(&_threads.back(), name + std::to_string(i));
+        }
+    }
+
+    ~worker_pool()
+    {
+        _stop = true;
+        _start_generation();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    worker_pool(const worker_pool&) = delete;
+    worker_pool& operator=(const worker_pool&) = delete;
+
+    /*! Parse a colon-separated list of CPU numbers, e.g. "2:3:4"
+     *
+     * \throws uhd::value_error if \p cpu_list is malformed
+     */
+    static std::vector<size_t> parse_cpu_list(const std::string& cpu_list)
+    {
+        std::vector<size_t> cpus;
+        size_t start = 0;
+        while (start < cpu_list.size()) {
+            const size_t end = std::min(cpu_list.find(':', start), cpu_list.size());
+            try {
+                cpus.push_back(std::stoul(cpu_list.substr(start, end - start)));
+            } catch (const std::exception&) {
+                throw uhd::value_error("Invalid CPU list: " + cpu_list);
+            }
+            start = end + 1;
+        }
+        return cpus;
+    }
+
+    //! Return the number of worker threads
+    size_t size() const
+    {
+        return _threads.size();
+    }
+
+    /*! Call \p fn for every index in [0, num_items), in parallel
+     *
+     * The calling thread takes part in the work. If any call to \p fn throws,
+     * the first exception is rethrown after all items were processed.
+     */
+    void run(const size_t num_items, const std::function<void(size_t)>& fn)
+    {
+        _fn        = &fn;
+        _num_items = num_items;
+        _next_item.store(0, std::memory_order_relaxed);
+        _num_finished.store(0, std::memory_order_relaxed);
+        _exception = nullptr;
+        _start_generation();
+
+        _do_work();
+        // Every worker acknowledges every generation, so none of them can
+        // still be looking at _fn once we return
+        while (_num_finished.load(std::memory_order_acquire) != _threads.size()) {
+            std::this_thread::yield();
+        }
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+    }
+
+private:
+    //! Number of polls of an idle worker before it goes to sleep
+    static constexpr size_t SPIN_COUNT = 10000;
+
+    void _start_generation()
+    {
+        _generation.fetch_add(1, std::memory_order_seq_cst);
+        if (_num_sleeping.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cond.notify_all();
+        }
+    }
+
+    void _do_work()
+    {
+        size_t item;
+        while ((item = _next_item.fetch_add(1, std::memory_order_relaxed))
+               < _num_items) {
+            try {
+                (*_fn)(item);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_exception) {
+                    _exception = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void _worker_loop()
+    {
+        uint64_t seen_generation = 0;
+        while (true) {
+            size_t spins = 0;
+            while (_generation.load(std::memory_order_acquire) == seen_generation) {
+                if (++spins < SPIN_COUNT) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(_mutex);
+                _num_sleeping.fetch_add(1, std::memory_order_seq_cst);
+                _cond.wait(lock, [this, seen_generation]() {
+                    return _generation.load(std::memory_order_seq_cst)
+                           != seen_generation;
+                });
+                _num_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+            }
+            seen_generation = _generation.load(std::memory_order_acquire);
+            if (_stop) {
+                return;
+            }
+            _do_work();
+            _num_finished.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    std::vector<std::thread> _threads;
+
+    // State of the current run() call
+    const std::function<void(size_t)>* _fn = nullptr;
+    size_t _num_items                      = 0;
+    std::atomic<size_t> _next_item{0};
+    std::atomic<size_t> _num_finished{0};
+    std::exception_ptr _exception;
+
+    std::atomic<uint64_t> _generation{0};
+    std::atomic<size_t> _num_sleeping{0};
+    std::atomic<bool> _stop{false};
+    std::mutex _mutex;
+    std::condition_variable _cond;
+};
+
+} // namespace uhd
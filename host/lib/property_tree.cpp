@@ -8,8 +8,11 @@
 
 #include <uhd/property_tree.hpp>
 #include <uhd/types/dict.hpp>
+#include <uhd/utils/log.hpp>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <utility>
 
 using namespace uhd;
 
@@ -80,7 +83,7 @@ public:
     sptr subtree(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_timed_mutex> lock(_guts->mutex);
 
         property_tree_impl* subtree = new property_tree_impl(path);
         subtree->_guts              = this->_guts; // copy the guts sptr
@@ -90,7 +93,7 @@ public:
     void remove(const fs_path& path_) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::lock_guard<std::shared_timed_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
         node_type* node   = &_guts->root;
@@ -110,38 +113,27 @@ public:
     bool exists(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_timed_mutex> lock(_guts->mutex);
 
-        node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                return false;
-            }
-            node = &(*node)[name];
-        }
-        return true;
+        return _find(path) != NULL;
     }
 
     std::vector<std::string> list(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_timed_mutex> lock(_guts->mutex);
 
-        node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                throw_path_not_found(path);
-            }
-            node = &(*node)[name];
+        node_type* node = _find(path);
+        if (node == NULL) {
+            throw_path_not_found(path);
         }
-
         return node->keys();
     }
 
     std::shared_ptr<property_iface> _pop(const fs_path& path_) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::lock_guard<std::shared_timed_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
         node_type* node   = &_guts->root;
@@ -167,7 +159,7 @@ public:
     void _create(const fs_path& path_, const std::shared_ptr<property_iface>& prop) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::lock_guard<std::shared_timed_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
         for (const std::string& name : path_tokenizer(path)) {
@@ -186,14 +178,11 @@ public:
     std::shared_ptr<property_iface>& _access(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_timed_mutex> lock(_guts->mutex);
 
-        node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                throw_path_not_found(path);
-            }
-            node = &(*node)[name];
+        node_type* node = _find(path);
+        if (node == NULL) {
+            throw_path_not_found(path);
         }
         if (node->prop.get() == NULL) {
             throw uhd::runtime_error("Cannot access! Property uninitialized at: " + path);
@@ -201,6 +190,61 @@ public:
         return node->prop;
     }
 
+    void add_prefetcher(const fs_path& path_, const prefetcher_type& prefetcher) override
+    {
+        const fs_path path = _root / path_;
+        std::lock_guard<std::shared_timed_mutex> lock(_guts->mutex);
+
+        node_type* node = _find(path);
+        if (node == NULL) {
+            throw_path_not_found(path);
+        }
+        node->prefetchers.push_back(prefetcher);
+    }
+
+    sptr snapshot(const fs_path& path_) const override
+    {
+        const fs_path path = _root / path_;
+        auto snap          = std::make_shared<property_tree_impl>();
+
+        // Only copy the structure while holding the lock. Publishers and
+        // prefetchers may access the tree themselves.
+        std::vector<std::pair<node_type*, std::shared_ptr<property_iface>>> props;
+        std::vector<std::pair<fs_path, prefetcher_type>> prefetchers;
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(_guts->mutex);
+            node_type* node = _find(path);
+            if (node == NULL) {
+                throw_path_not_found(path);
+            }
+            _copy_structure(*node, snap->_guts->root, "/", props, prefetchers);
+        }
+
+        for (const auto& prefetcher : prefetchers) {
+            try {
+                prefetcher.second(*snap->subtree(prefetcher.first));
+            } catch (const std::exception& ex) {
+                UHD_LOG_DEBUG("PROPTREE",
+                    "Prefetching " << (path / prefetcher.first)
+                                   << " failed, reading values one by one: "
+                                   << ex.what());
+            }
+        }
+        // The nodes of the copy don't move when prefetchers add properties,
+        // the dict is a list
+        for (const auto& entry : props) {
+            std::shared_ptr<property_iface> copy;
+            if (!snap->_has_prop(entry.first)) {
+                copy = entry.second->snapshot();
+            }
+            std::lock_guard<std::shared_timed_mutex> lock(snap->_guts->mutex);
+            if (copy and entry.first->prop.get() == NULL) {
+                entry.first->prop = copy;
+            }
+        }
+        return snap;
+    }
+
 private:
     void throw_path_not_found(const fs_path& path) const
     {
@@ -211,15 +255,60 @@ private:
     struct node_type : uhd::dict<std::string, node_type>
     {
         std::shared_ptr<property_iface> prop;
+        std::vector<prefetcher_type> prefetchers;
     };
 
     // tree guts which may be referenced in a subtree
     struct tree_guts_type
     {
         node_type root;
-        std::mutex mutex;
+        // Lookups only need a shared lock, only changing the structure of
+        // the tree needs an exclusive one
+        std::shared_timed_mutex mutex;
     };
 
+    //! Return the node at an absolute path, or NULL if there is none. This
+    // doesn't change the tree, so a shared lock is enough.
+    node_type* _find(const fs_path& path) const
+    {
+        node_type* node = &_guts->root;
+        for (const std::string& name : path_tokenizer(path)) {
+            if (not node->has_key(name)) {
+                return NULL;
+            }
+            node = &(*node)[name];
+        }
+        return node;
+    }
+
+    //! Copy the directories below \p src to \p dst, and collect the
+    // properties and prefetchers of \p src with the matching copies. The
+    // paths of the prefetchers are relative to the original \p src.
+    static void _copy_structure(const node_type& src,
+        node_type& dst,
+        const fs_path& path,
+        std::vector<std::pair<node_type*, std::shared_ptr<property_iface>>>& props,
+        std::vector<std::pair<fs_path, prefetcher_type>>& prefetchers)
+    {
+        if (src.prop) {
+            props.emplace_back(&dst, src.prop);
+        }
+        for (const auto& prefetcher : src.prefetchers) {
+            prefetchers.emplace_back(path, prefetcher);
+        }
+        for (const std::string& name : src.keys()) {
+            dst[name] = node_type();
+            _copy_structure(src[name], dst[name], path / name, props, prefetchers);
+        }
+    }
+
+    //! True if a prefetcher already created the property of \p node
+    bool _has_prop(const node_type* node) const
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(_guts->mutex);
+        return node->prop.get() != NULL;
+    }
+
     // members, the tree and root prefix
     std::shared_ptr<tree_guts_type> _guts;
     const fs_path _root;
@@ -46,6 +46,7 @@ void export_property_tree(py::module& m)
         .def("subtree", &property_tree::subtree, py::arg("path"))
         .def("exists", &property_tree::exists, py::arg("path"))
         .def("list", &property_tree::list, py::arg("path"))
+        .def("snapshot", &property_tree::snapshot, py::arg("path") = fs_path("/"))
         // One line per type
         .def(
             "access_int", &property_tree::access<int>, py::return_value_policy::reference)
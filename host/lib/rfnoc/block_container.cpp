@@ -8,6 +8,7 @@
 #include <uhdlib/rfnoc/block_container.hpp>
 #include <uhdlib/rfnoc/node_accessor.hpp>
 #include <boost/format.hpp>
+#include <boost/functional/hash.hpp>
 #include <algorithm>
 
 
@@ -16,6 +17,13 @@ using namespace uhd::rfnoc::detail;
 using uhd::rfnoc::block_id_t;
 using uhd::rfnoc::noc_block_base;
 
+namespace {
+
+//! Number of find_blocks() results which are stored until they are cleared
+constexpr size_t MAX_FIND_RESULTS = 256;
+
+} // namespace
+
 /******************************************************************************
  * Structors
  *****************************************************************************/
@@ -34,55 +42,62 @@ void block_container_t::register_block(noc_block_base::sptr block)
     UHD_LOGGER_DEBUG("RFNOC::BLOCK_CONTAINER")
         << boost::format("Registering block: %s (NOC ID=%08x)") % block->get_unique_id()
                % block->get_noc_id();
-    _blocks.insert(block);
+    const block_id_t block_id = block->get_block_id();
+    if (!_blocks.emplace(block_id, block).second) {
+        return;
+    }
+    _block_ids.insert(
+        std::upper_bound(_block_ids.begin(), _block_ids.end(), block_id), block_id);
+    _find_results.clear();
 }
 
 std::vector<block_id_t> block_container_t::find_blocks(
     const std::string& block_id_hint) const
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    if (block_id_hint.empty()) {
+        return _block_ids;
+    }
+    auto result_it = _find_results.find(block_id_hint);
+    if (result_it != _find_results.end()) {
+        return result_it->second;
+    }
+
     std::vector<block_id_t> block_ids;
-    for (auto it = _blocks.cbegin(); it != _blocks.cend(); ++it) {
-        auto id = (*it)->get_block_id();
-        if (id.match(block_id_hint) || block_id_hint.empty()) {
+    for (auto id : _block_ids) {
+        if (id.match(block_id_hint)) {
             block_ids.push_back(id);
         }
     }
-    std::sort(block_ids.begin(),
-        block_ids.end(),
-        [](const uhd::rfnoc::block_id_t& i, const uhd::rfnoc::block_id_t& j) {
-            return i < j;
-        });
+    if (_find_results.size() >= MAX_FIND_RESULTS) {
+        _find_results.clear();
+    }
+    _find_results.emplace(block_id_hint, block_ids);
     return block_ids;
 }
 
 bool block_container_t::has_block(const block_id_t& block_id) const
 {
     std::lock_guard<std::mutex> lock(_mutex);
-    return std::any_of(
-        _blocks.cbegin(), _blocks.cend(), [block_id](noc_block_base::sptr block) {
-            return block->get_block_id() == block_id;
-        });
+    return _blocks.count(block_id) > 0;
 }
 
 noc_block_base::sptr block_container_t::get_block(const block_id_t& block_id) const
 {
-    auto block_itr = std::find_if(
-        _blocks.cbegin(), _blocks.cend(), [block_id](noc_block_base::sptr block) {
-            return block->get_block_id() == block_id;
-        });
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto block_itr = _blocks.find(block_id);
     if (block_itr == _blocks.cend()) {
         throw uhd::lookup_error(std::string("This device does not have a block with ID: ")
                                 + block_id.to_string());
     }
-    return *block_itr;
+    return block_itr->second;
 }
 
 void block_container_t::shutdown()
 {
     node_accessor_t node_accessor{};
     for (auto it = _blocks.begin(); it != _blocks.end(); ++it) {
-        node_accessor.shutdown(it->get());
+        node_accessor.shutdown(it->second.get());
     }
 }
 
@@ -90,6 +105,15 @@ void block_container_t::init_props()
 {
     node_accessor_t node_accessor{};
     for (auto it = _blocks.begin(); it != _blocks.end(); ++it) {
-        node_accessor.init_props(it->get());
+        node_accessor.init_props(it->second.get());
     }
 }
+
+size_t block_container_t::block_id_hash::operator()(const block_id_t& block_id) const
+{
+    size_t hash = 0;
+    boost::hash_combine(hash, block_id.get_device_no());
+    boost::hash_combine(hash, block_id.get_block_name());
+    boost::hash_combine(hash, block_id.get_block_count());
+    return hash;
+}
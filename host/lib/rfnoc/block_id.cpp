@@ -17,6 +17,30 @@
 
 using namespace uhd::rfnoc;
 
+namespace {
+
+// Compiling a regex takes much longer than matching it, so every regex is only
+// compiled once. Matching a const std::regex is thread-safe.
+const std::regex& get_valid_blockname_regex()
+{
+    static const std::regex regex(VALID_BLOCKNAME_REGEX);
+    return regex;
+}
+
+const std::regex& get_valid_blockid_regex()
+{
+    static const std::regex regex(VALID_BLOCKID_REGEX);
+    return regex;
+}
+
+const std::regex& get_match_blockid_regex()
+{
+    static const std::regex regex(MATCH_BLOCKID_REGEX);
+    return regex;
+}
+
+} // namespace
+
 block_id_t::block_id_t() : _device_no(0), _block_name(""), _block_ctr(0) {}
 
 block_id_t::block_id_t(const std::string& block_str)
@@ -39,12 +63,12 @@ block_id_t::block_id_t(
 
 bool block_id_t::is_valid_blockname(const std::string& block_name)
 {
-    return std::regex_match(block_name, std::regex(VALID_BLOCKNAME_REGEX));
+    return std::regex_match(block_name, get_valid_blockname_regex());
 }
 
 bool block_id_t::is_valid_block_id(const std::string& block_id)
 {
-    return std::regex_match(block_id, std::regex(VALID_BLOCKID_REGEX));
+    return std::regex_match(block_id, get_valid_blockid_regex());
 }
 
 std::string block_id_t::to_string() const
@@ -65,8 +89,7 @@ uhd::fs_path block_id_t::get_tree_root() const
 bool block_id_t::match(const std::string& block_str)
 {
     std::cmatch matches;
-    if (not std::regex_match(
-            block_str.c_str(), matches, std::regex(MATCH_BLOCKID_REGEX))) {
+    if (not std::regex_match(block_str.c_str(), matches, get_match_blockid_regex())) {
         return false;
     }
     try {
@@ -84,8 +107,7 @@ bool block_id_t::match(const std::string& block_str)
 bool block_id_t::set(const std::string& new_name)
 {
     std::cmatch matches;
-    if (not std::regex_match(
-            new_name.c_str(), matches, std::regex(VALID_BLOCKID_REGEX))) {
+    if (not std::regex_match(new_name.c_str(), matches, get_valid_blockid_regex())) {
         return false;
     }
     if (not(matches[1] == "")) {
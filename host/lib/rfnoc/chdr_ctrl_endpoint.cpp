@@ -10,7 +10,9 @@
 #include <uhd/utils/safe_call.hpp>
 #include <uhd/utils/thread.hpp>
 #include <uhdlib/rfnoc/chdr_ctrl_endpoint.hpp>
+#include <uhdlib/rfnoc/chdr_packet_tap.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
+#include <uhdlib/rfnoc/ctrl_send_scheduler.hpp>
 #include <boost/format.hpp>
 #include <boost/thread.hpp>
 #include <atomic>
@@ -35,6 +37,8 @@ public:
         , _num_drops(0)
         , _send_pkt(pkt_factory.make_ctrl())
         , _recv_pkt(pkt_factory.make_ctrl())
+        , _tap(chdr_packet_tap::make_port(
+              str(boost::format("control EPID %d") % my_epid)))
         , _stop_recv_thread(false)
         , _recv_thread([this]() { recv_worker(); })
     {
@@ -80,19 +84,28 @@ public:
 
         ep_map_key_t key{dst_epid, dst_port};
         // Function to send a control payload
-        auto send_fn = [this, dst_epid](const ctrl_payload& payload, double timeout) {
-            // Build header
-            chdr_header header;
-            header.set_pkt_type(PKT_TYPE_CTRL);
-            header.set_num_mdata(0);
-            header.set_seq_num(_send_seqnum++);
-            header.set_dst_epid(dst_epid);
-            // Acquire send buffer and send the packet
-            std::lock_guard<std::mutex> lock(_send_mutex);
-            auto send_buff = _xport->get_send_buff(timeout * 1000);
-            _send_pkt->refresh(send_buff->data(), header, payload);
-            send_buff->set_packet_size(header.get_length());
-            _xport->release_send_buff(std::move(send_buff));
+        auto send_fn = [this, dst_epid](const ctrl_payload& payload,
+                           double timeout,
+                           ctrlport_endpoint::priority_t priority) {
+            // Wait for our turn, then acquire a send buffer and send the packet
+            _send_scheduler.send(priority, [&]() {
+                // Build header
+                chdr_header header;
+                header.set_pkt_type(PKT_TYPE_CTRL);
+                header.set_num_mdata(0);
+                header.set_seq_num(_send_seqnum++);
+                header.set_dst_epid(dst_epid);
+                auto send_buff = _xport->get_send_buff(timeout * 1000);
+                _send_pkt->refresh(send_buff->data(), header, payload);
+                send_buff->set_packet_size(header.get_length());
+                if (_tap) {
+                    _tap->capture(chdr_packet_tap::TX,
+                        send_buff->data(),
+                        header.get_length(),
+                        false);
+                }
+                _xport->release_send_buff(std::move(send_buff));
+            });
         };
 
         if (_endpoint_map.find(key) == _endpoint_map.end()) {
@@ -132,9 +145,16 @@ private:
             if (buff) {
                 // FIXME Move lock back to here once have threaded_io_service
                 // std::lock_guard<std::mutex> lock(_mutex);
+                if (_tap) {
+                    _tap->capture(
+                        chdr_packet_tap::RX, buff->data(), buff->packet_size(), false);
+                }
                 try {
                     _recv_pkt->refresh(buff->data());
                     const ctrl_payload payload = _recv_pkt->get_payload();
+                    if (_tap && payload.status != CMD_OKAY) {
+                        _tap->trigger();
+                    }
                     ep_map_key_t key{payload.src_epid, payload.dst_port};
                     auto ep_iter = _endpoint_map.find(key);
                     if (ep_iter != _endpoint_map.end()) {
@@ -189,12 +209,15 @@ private:
     // Packet containers
     chdr_ctrl_packet::uptr _send_pkt;
     chdr_ctrl_packet::cuptr _recv_pkt;
+    // Packet tap, or nullptr if it is not enabled
+    chdr_packet_tap::port::uptr _tap;
     // A collection of ctrlport endpoints (keyed by the port number)
     std::map<ep_map_key_t, ctrlport_endpoint::sptr> _endpoint_map;
     // Mutex that protects all state in this class except for _send_pkt
     std::mutex _mutex;
-    // Mutex that protects _send_pkt and _xport.send
-    std::mutex _send_mutex;
+    // Serializes access to _send_seqnum, _send_pkt and _xport.send, giving
+    // precedence to urgent control traffic
+    detail::ctrl_send_scheduler _send_scheduler;
     // A thread that will handle all responses and async message requests
     // Must be declared after the mutexes, the thread starts at construction and
     // depends on the mutexes having been constructed.
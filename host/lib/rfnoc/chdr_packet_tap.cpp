@@ -0,0 +1,263 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/rfnoc/chdr_packet_tap.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr char LOG_ID[] = "CHDR_TAP";
+
+constexpr char FILE_ENV_VAR[]    = "UHD_CHDR_TAP_FILE";
+constexpr char SAMPLE_ENV_VAR[]  = "UHD_CHDR_TAP_SAMPLE";
+constexpr char TRIGGER_ENV_VAR[] = "UHD_CHDR_TAP_TRIGGER";
+
+constexpr size_t DEFAULT_SAMPLE_INTERVAL = 1000;
+constexpr size_t DEFAULT_TRIGGER_COUNT   = 256;
+constexpr size_t HEADER_RING_SIZE        = 4096;
+constexpr size_t MAX_FULL_RING_SIZE      = 256;
+
+//! How often the writer thread drains the rings
+constexpr auto WRITER_PERIOD = std::chrono::milliseconds(10);
+
+// pcap file format, with nanosecond timestamps and raw IPv4 packets
+constexpr uint32_t PCAP_MAGIC_NS  = 0xa1b23c4d;
+constexpr uint32_t LINKTYPE_IPV4  = 228;
+constexpr size_t IP_UDP_HDR_LEN   = 28;
+constexpr uint32_t HOST_IP_ADDR   = 0x0a000001;
+constexpr uint32_t DEVICE_IP_ADDR = 0x0a000002;
+constexpr uint16_t DEVICE_PORT    = 49153;
+constexpr uint16_t HOST_BASE_PORT = 50000;
+
+size_t get_env_size(const char* var, const size_t default_value)
+{
+    const char* env_value = std::getenv(var);
+    if (env_value == nullptr || env_value[0] == '\0') {
+        return default_value;
+    }
+    char* end;
+    const unsigned long value = std::strtoul(env_value, &end, 0);
+    if (*end != '\0') {
+        UHD_LOG_WARNING(LOG_ID,
+            "Ignoring invalid value `" << env_value << "' of " << var << ", using "
+                                       << default_value);
+        return default_value;
+    }
+    return value;
+}
+
+void put_u16_be(uint8_t* p, const uint16_t value)
+{
+    p[0] = value >> 8;
+    p[1] = value & 0xff;
+}
+
+void put_u32_be(uint8_t* p, const uint32_t value)
+{
+    put_u16_be(p, value >> 16);
+    put_u16_be(p + 2, value & 0xffff);
+}
+
+} // namespace
+
+constexpr size_t chdr_packet_tap::HEADER_SNAPLEN;
+constexpr size_t chdr_packet_tap::FULL_SNAPLEN;
+
+chdr_packet_tap::port::uptr chdr_packet_tap::make_port(const std::string& name)
+{
+    // The tap lives until the end of the program, so the file isn't truncated
+    // when the transports are recreated
+    static const std::shared_ptr<chdr_packet_tap> tap =
+        []() -> std::shared_ptr<chdr_packet_tap> {
+        const char* path = std::getenv(FILE_ENV_VAR);
+        if (path == nullptr || path[0] == '\0') {
+            return nullptr;
+        }
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file) {
+            UHD_LOG_ERROR(LOG_ID, "Could not open CHDR tap file " << path);
+            return nullptr;
+        }
+        const size_t sample_interval =
+            get_env_size(SAMPLE_ENV_VAR, DEFAULT_SAMPLE_INTERVAL);
+        const size_t trigger_count = get_env_size(TRIGGER_ENV_VAR, DEFAULT_TRIGGER_COUNT);
+        UHD_LOG_INFO(LOG_ID,
+            "Capturing CHDR packets to " << path << ", one in " << sample_interval
+                                         << " data packets, " << trigger_count
+                                         << " packets after errors");
+        return std::shared_ptr<chdr_packet_tap>(new chdr_packet_tap(file,
+            sample_interval,
+            trigger_count,
+            std::min(trigger_count, MAX_FULL_RING_SIZE)));
+    }();
+
+    if (!tap) {
+        return nullptr;
+    }
+    const uint16_t id = tap->_next_port_id++;
+    UHD_LOG_INFO(
+        LOG_ID, "Packets of " << name << " are on host port " << (HOST_BASE_PORT + id));
+    return port::uptr(new port(tap, id));
+}
+
+chdr_packet_tap::chdr_packet_tap(std::FILE* file,
+    const size_t sample_interval,
+    const size_t trigger_count,
+    const size_t ring_size)
+    : _file(file)
+    , _sample_interval(sample_interval)
+    , _trigger_count(trigger_count)
+    , _header_ring(HEADER_RING_SIZE)
+{
+    if (ring_size > 0) {
+        _full_ring = std::make_unique<mpsc_ring<full_record_t>>(ring_size);
+    }
+    const uint32_t file_header[] = {PCAP_MAGIC_NS,
+        // Version 2.4
+        (4 << 16) | 2,
+        // Time zone and timestamp accuracy
+        0,
+        0,
+        uint32_t(FULL_SNAPLEN + IP_UDP_HDR_LEN),
+        LINKTYPE_IPV4};
+    std::fwrite(file_header, sizeof(file_header), 1, _file);
+    std::fflush(_file);
+
+    _writer_thread = std::thread([this]() { _writer_loop(); });
+    uhd::set_thread_name(&_writer_thread, "uhd_chdr_tap");
+}
+
+chdr_packet_tap::~chdr_packet_tap()
+{
+    {
+        std::lock_guard<std::mutex> l(_writer_mutex);
+        _writer_stop = true;
+    }
+    _writer_cond.notify_one();
+    _writer_thread.join();
+    std::fclose(_file);
+    if (_num_dropped > 0) {
+        UHD_LOG_WARNING(LOG_ID,
+            "Dropped " << _num_dropped.load()
+                       << " packets which didn't fit into the rings");
+    }
+}
+
+void chdr_packet_tap::_push(
+    const uint16_t port_id, const direction_t dir, const void* packet, const size_t len)
+{
+    const uint64_t time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+    int64_t remaining = _full_remaining.load(std::memory_order_relaxed);
+    while (remaining > 0
+           && !_full_remaining.compare_exchange_weak(
+               remaining, remaining - 1, std::memory_order_relaxed)) {
+    }
+
+    if (remaining > 0 && _full_ring) {
+        full_record_t record;
+        record.time_ns = time_ns;
+        record.len     = uint32_t(len);
+        record.port_id = port_id;
+        record.dir     = uint8_t(dir);
+        std::memcpy(record.data, packet, record.get_caplen());
+        if (!_full_ring->push(record)) {
+            _num_dropped++;
+        }
+        return;
+    }
+    header_record_t record;
+    record.time_ns = time_ns;
+    record.len     = uint32_t(len);
+    record.port_id = port_id;
+    record.dir     = uint8_t(dir);
+    std::memcpy(record.data, packet, record.get_caplen());
+    if (!_header_ring.push(record)) {
+        _num_dropped++;
+    }
+}
+
+void chdr_packet_tap::_trigger()
+{
+    _full_remaining.store(int64_t(_trigger_count), std::memory_order_relaxed);
+}
+
+void chdr_packet_tap::_writer_loop()
+{
+    // The records are large, keep them off the stack
+    auto header = std::make_unique<header_record_t>();
+    auto full   = std::make_unique<full_record_t>();
+    bool stop   = false;
+    while (!stop) {
+        {
+            std::unique_lock<std::mutex> l(_writer_mutex);
+            _writer_cond.wait_for(l, WRITER_PERIOD, [this]() { return _writer_stop; });
+            stop = _writer_stop;
+        }
+        // Merge the rings by time. Within a ring, the records of different
+        // threads may be slightly out of order.
+        bool have_header = _header_ring.pop(*header);
+        bool have_full   = _full_ring && _full_ring->pop(*full);
+        if (!have_header && !have_full) {
+            continue;
+        }
+        while (have_header || have_full) {
+            if (have_header && (!have_full || header->time_ns <= full->time_ns)) {
+                _write(*header);
+                have_header = _header_ring.pop(*header);
+            } else {
+                _write(*full);
+                have_full = _full_ring->pop(*full);
+            }
+        }
+        // Keep the file readable while the application runs
+        std::fflush(_file);
+    }
+}
+
+template <size_t snaplen>
+void chdr_packet_tap::_write(const record_t<snaplen>& record)
+{
+    const size_t caplen = record.get_caplen();
+    const uint32_t record_header[] = {uint32_t(record.time_ns / 1000000000),
+        uint32_t(record.time_ns % 1000000000),
+        uint32_t(caplen + IP_UDP_HDR_LEN),
+        uint32_t(record.len + IP_UDP_HDR_LEN)};
+    std::fwrite(record_header, sizeof(record_header), 1, _file);
+
+    const bool rx            = (record.dir == RX);
+    const uint16_t host_port = HOST_BASE_PORT + record.port_id;
+    const size_t udp_len     = std::min<size_t>(record.len + 8, 0xffff - 20);
+    uint8_t hdr[IP_UDP_HDR_LEN] = {};
+    // IPv4 header, without options
+    hdr[0] = 0x45;
+    put_u16_be(hdr + 2, uint16_t(udp_len + 20));
+    hdr[8] = 64;
+    hdr[9] = 17;
+    put_u32_be(hdr + 12, rx ? DEVICE_IP_ADDR : HOST_IP_ADDR);
+    put_u32_be(hdr + 16, rx ? HOST_IP_ADDR : DEVICE_IP_ADDR);
+    uint32_t checksum = 0;
+    for (size_t i = 0; i < 20; i += 2) {
+        checksum += (hdr[i] << 8) | hdr[i + 1];
+    }
+    checksum = (checksum & 0xffff) + (checksum >> 16);
+    checksum = (checksum & 0xffff) + (checksum >> 16);
+    put_u16_be(hdr + 10, uint16_t(~checksum));
+    // UDP header, without checksum
+    put_u16_be(hdr + 20, rx ? DEVICE_PORT : host_port);
+    put_u16_be(hdr + 22, rx ? host_port : DEVICE_PORT);
+    put_u16_be(hdr + 24, uint16_t(udp_len));
+    std::fwrite(hdr, sizeof(hdr), 1, _file);
+    std::fwrite(record.data, caplen, 1, _file);
+}
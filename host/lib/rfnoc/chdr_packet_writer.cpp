@@ -123,6 +123,49 @@ public:
         return (_compute_mdata_offset(header) + num_mdata) * chdr_w_bytes;
     }
 
+    void parse_data_headers(const void* const* pkt_buffs,
+        const size_t num_pkts,
+        data_header_t* headers) const override
+    {
+        for (size_t i = 0; i < num_pkts; i++) {
+            const uint64_t* pkt_buff = reinterpret_cast<const uint64_t*>(pkt_buffs[i]);
+            const chdr_header header(u64_to_host(pkt_buff[0]));
+            const bool has_tsf  = _has_timestamp(header);
+            const size_t offset = _compute_mdata_offset(header) + header.get_num_mdata();
+
+            data_header_t& info = headers[i];
+            info.payload        = pkt_buff + (chdr_w_stride * offset);
+            info.payload_size   = header.get_length() - (chdr_w_bytes * offset);
+            info.tsf            = has_tsf ? u64_to_host(pkt_buff[1]) : 0;
+            info.seq_num        = header.get_seq_num();
+            info.has_tsf        = has_tsf;
+            info.eob            = header.get_eob();
+            info.eov            = header.get_eov();
+        }
+    }
+
+    chdr_header read_chdr_header(const void* pkt_buff) const override
+    {
+        assert(pkt_buff);
+        return chdr_header(u64_to_host(*reinterpret_cast<const uint64_t*>(pkt_buff)));
+    }
+
+    void* write_data_header(void* pkt_buff,
+        chdr_header& header,
+        const uint64_t timestamp,
+        const size_t payload_size) const override
+    {
+        assert(pkt_buff);
+        uint64_t* buff      = reinterpret_cast<uint64_t*>(pkt_buff);
+        const size_t offset = _compute_mdata_offset(header) + header.get_num_mdata();
+        header.set_length(offset * chdr_w_bytes + payload_size);
+        buff[0] = u64_from_host(header);
+        if (_has_timestamp(header)) {
+            buff[1] = u64_from_host(timestamp);
+        }
+        return buff + (chdr_w_stride * offset);
+    }
+
 private:
     inline bool _has_timestamp(const chdr_header& header) const
     {
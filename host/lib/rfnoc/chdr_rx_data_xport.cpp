@@ -5,12 +5,16 @@
 //
 
 #include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/cast.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/chdr_rx_data_xport.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <cmath>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -44,6 +48,9 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     , _fc_sender(pkt_factory, epids)
     , _epid(epids.second)
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
+    // Leave at least half of the frames to the caller of get_recv_buff()
+    , _max_burst_size(
+          std::max<size_t>(1, std::min(MAX_RECV_BURST_SIZE, num_recv_frames / 2)))
     , _disconnect(disconnect)
 {
     UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
@@ -53,11 +60,29 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     _recv_packet    = pkt_factory.make_generic();
     _recv_packet_cb = pkt_factory.make_generic();
     _fc_sender.set_capacity(fc_params.buff_capacity);
+    _fc_capacity = fc_params.buff_capacity;
+    _num_frames  = num_recv_frames;
+
+    // The links belong to this transport alone
+    _link_memory.num_recv_frames = recv_link->get_num_recv_frames();
+    _link_memory.recv_frame_size = recv_link->get_recv_frame_size();
+    if (send_link) {
+        _link_memory.num_send_frames = send_link->get_num_send_frames();
+        _link_memory.send_frame_size = send_link->get_send_frame_size();
+    }
+
+    if (fc_params.max_freq.bytes || fc_params.max_freq.packets) {
+        _fc_state.set_fc_freq_limits(
+            fc_params.min_freq, fc_params.max_freq, fc_params.buff_capacity);
+    }
 
     // Calculate header size
     _hdr_len = _recv_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     UHD_ASSERT_THROW(_hdr_len);
 
+    _tap = chdr_packet_tap::make_port(
+        str(boost::format("RX data EPID %d -> %d") % epids.first % epids.second));
+
     // Make data transport
     auto recv_cb =
         [this](buff_t::uptr& buff, recv_link_if* recv_link, send_link_if* send_link) {
@@ -83,11 +108,19 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
             << "capacity bytes=" << fc_params.buff_capacity.bytes
             << ", packets=" << fc_params.buff_capacity.packets << std::endl
             << "fc frequency bytes=" << fc_params.freq.bytes
-            << ", packets=" << fc_params.freq.packets);
+            << ", packets=" << fc_params.freq.packets << std::endl
+            << "adaptive fc frequency bytes=" << fc_params.min_freq.bytes << "..."
+            << fc_params.max_freq.bytes << ", packets=" << fc_params.min_freq.packets
+            << "..." << fc_params.max_freq.packets);
 }
 
 chdr_rx_data_xport::~chdr_rx_data_xport()
 {
+    // Return the packets of the current burst which weren't handed out
+    for (size_t i = _burst_pos; i < _burst_count; i++) {
+        _recv_io->release_recv_buff(std::move(_burst_buffs[i]));
+    }
+
     // Release recv_io before allowing members needed by callbacks be destroyed
     _recv_io.reset();
 
@@ -219,3 +252,40 @@ chdr_rx_data_xport::fc_params_t chdr_rx_data_xport::configure_sep(io_service::sp
 
     return fc_params;
 }
+
+void chdr_rx_data_xport::read_adaptive_fc_args(
+    const uhd::device_addr_t& xport_args, fc_params_t& fc_params)
+{
+    const bool fc_enabled = (fc_params.freq.bytes != 0) || (fc_params.freq.packets != 0);
+    if (!fc_enabled || !xport_args.has_key("rx_fc_adaptive")
+        || !uhd::cast::from_str<bool>(xport_args["rx_fc_adaptive"])) {
+        return;
+    }
+
+    const double min_ratio = xport_args.cast<double>("rx_fc_min_ratio", 1.0 / 128);
+    const double max_ratio = xport_args.cast<double>("rx_fc_max_ratio", 1.0 / 8);
+    // Beyond half of the capacity, the sender would stall before it gets a
+    // response
+    if (!(min_ratio > 0.0 && min_ratio <= max_ratio && max_ratio <= 0.5)) {
+        throw uhd::value_error("Invalid adaptive RX flow control ratios: "
+                               "rx_fc_min_ratio="
+                               + std::to_string(min_ratio) + ", rx_fc_max_ratio="
+                               + std::to_string(max_ratio));
+    }
+
+    const auto& capacity = fc_params.buff_capacity;
+    fc_params.min_freq   = fc_params.freq;
+    fc_params.max_freq   = fc_params.freq;
+    if (fc_params.freq.bytes != MAX_FC_FREQ_BYTES) {
+        fc_params.min_freq.bytes =
+            std::max<uint64_t>(1, std::ceil(double(capacity.bytes) * min_ratio));
+        fc_params.max_freq.bytes =
+            std::max<uint64_t>(1, std::ceil(double(capacity.bytes) * max_ratio));
+    }
+    if (fc_params.freq.packets != MAX_FC_FREQ_PKTS) {
+        fc_params.min_freq.packets =
+            std::max<uint32_t>(1, std::ceil(double(capacity.packets) * min_ratio));
+        fc_params.max_freq.packets =
+            std::max<uint32_t>(1, std::ceil(double(capacity.packets) * max_ratio));
+    }
+}
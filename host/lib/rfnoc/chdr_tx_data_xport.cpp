@@ -6,17 +6,28 @@
 
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
 #include <uhdlib/rfnoc/chdr_tx_data_xport.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <boost/format.hpp>
+#include <chrono>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
 using namespace uhd::rfnoc::detail;
 using namespace uhd::transport;
 
+namespace {
+
+//! How often the flow control thread checks whether to stop, in milliseconds
+constexpr int32_t FC_THREAD_TIMEOUT_MS = 100;
+
+} // namespace
+
 tx_flow_ctrl_sender::tx_flow_ctrl_sender(
     const chdr::chdr_packet_factory& pkt_factory, const sep_id_pair_t sep_ids)
     : _dst_epid(sep_ids.second)
@@ -49,11 +60,24 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     _send_header.set_dst_epid(epids.second);
     _send_packet = pkt_factory.make_generic();
     _recv_packet = pkt_factory.make_generic();
+    _fc_capacity = fc_params.buff_capacity;
+    _num_frames  = num_send_frames;
+
+    // The links belong to this transport alone
+    _link_memory.num_send_frames = send_link->get_num_send_frames();
+    _link_memory.send_frame_size = send_link->get_send_frame_size();
+    if (recv_link) {
+        _link_memory.num_recv_frames = recv_link->get_num_recv_frames();
+        _link_memory.recv_frame_size = recv_link->get_recv_frame_size();
+    }
 
     // Calculate header length
     _hdr_len = _send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     UHD_ASSERT_THROW(_hdr_len);
 
+    _tap = chdr_packet_tap::make_port(
+        str(boost::format("TX data EPID %d -> %d") % epids.first % epids.second));
+
     // Now create the send I/O we will use for data
     auto send_cb = [this](buff_t::uptr buff, transport::send_link_if* send_link) {
         this->_send_callback(std::move(buff), send_link);
@@ -67,18 +91,52 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
 
     auto fc_cb = [this](size_t num_bytes) { return this->_fc_callback(num_bytes); };
 
-    // Needs just a single recv frame for strs packets
-    _send_io = io_srv->make_send_client(send_link,
-        num_send_frames,
-        send_cb,
-        recv_link,
-        /* num_recv_frames */ 1,
-        recv_cb,
-        fc_cb);
+    // Offload I/O services already process strs packets on their own thread
+    _fc_offload = fc_params.fc_offload
+                  && std::dynamic_pointer_cast<inline_io_service>(io_srv) != nullptr;
+    if (fc_params.fc_offload && !_fc_offload) {
+        UHD_LOG_DEBUG("XPORT::TX_DATA_XPORT",
+            "Ignoring fc_offload, the I/O service processes flow control already");
+    }
+
+    if (_fc_offload) {
+        // The send client does no flow control, strs packets go to a recv
+        // client of their own, which the flow control thread polls
+        _send_io = io_srv->make_send_client(
+            send_link, num_send_frames, send_cb, nullptr, 0, nullptr, nullptr);
+        auto release_cb = [](frame_buff::uptr buff,
+                              recv_link_if* recv_link,
+                              send_link_if* /*send_link*/) {
+            recv_link->release_recv_buff(std::move(buff));
+        };
+        _fc_recv_io = io_srv->make_recv_client(recv_link,
+            /* num_recv_frames */ 1,
+            recv_cb,
+            nullptr,
+            /* num_send_frames */ 0,
+            release_cb);
+        _fc_thread = std::thread([this]() { _fc_thread_loop(); });
+        uhd::set_thread_name(&_fc_thread, "uhd_tx_fc");
+    } else {
+        // Needs just a single recv frame for strs packets
+        _send_io = io_srv->make_send_client(send_link,
+            num_send_frames,
+            send_cb,
+            recv_link,
+            /* num_recv_frames */ 1,
+            recv_cb,
+            fc_cb);
+    }
 }
 
 chdr_tx_data_xport::~chdr_tx_data_xport()
 {
+    if (_fc_thread.joinable()) {
+        _fc_thread_stop = true;
+        _fc_thread.join();
+    }
+    _fc_recv_io.reset();
+
     // Release send_io before allowing members needed by callbacks be destroyed
     _send_io.reset();
 
@@ -86,6 +144,35 @@ chdr_tx_data_xport::~chdr_tx_data_xport()
     _disconnect();
 }
 
+bool chdr_tx_data_xport::_wait_for_credits(const int32_t timeout_ms)
+{
+    using namespace std::chrono;
+    const auto end_time = steady_clock::now() + milliseconds(timeout_ms);
+    do {
+        std::this_thread::yield();
+        if (_fc_state.dest_has_space(_frame_size)) {
+            return true;
+        }
+    } while (timeout_ms < 0 || steady_clock::now() < end_time);
+    return false;
+}
+
+void chdr_tx_data_xport::_fc_thread_loop()
+{
+    try {
+        while (!_fc_thread_stop) {
+            // The recv callback consumes the strs packets, so this only
+            // returns a buffer for packets which are not for this transport
+            if (auto buff = _fc_recv_io->get_recv_buff(FC_THREAD_TIMEOUT_MS)) {
+                _fc_recv_io->release_recv_buff(std::move(buff));
+            }
+        }
+    } catch (const std::exception& ex) {
+        UHD_LOG_ERROR("XPORT::TX_DATA_XPORT",
+            "Stopping to process flow control packets: " << ex.what());
+    }
+}
+
 /*
  * To configure flow control, we need to send an init strc packet, then
  * receive a strs containing the stream endpoint ingress buffer size. We
@@ -248,9 +335,8 @@ chdr_tx_data_xport::fc_params_t chdr_tx_data_xport::configure_sep(io_service::sp
         1, // num_recv_frames
         disconnect);
 
-    // Setup a route to the EPID
-    mgmt_portal.setup_local_route(*ctrl_xport, remote_epid);
-
+    // Setup a route to the EPID and configure the stream. Note that
+    // config_local_tx_stream() sets up the route itself.
     mgmt_portal.config_local_tx_stream(
         *ctrl_xport, remote_epid, pyld_buff_fmt, mdata_buff_fmt);
 
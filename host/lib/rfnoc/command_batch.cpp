@@ -0,0 +1,79 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/rfnoc/command_batch.hpp>
+#include <exception>
+#include <set>
+
+using namespace uhd::rfnoc::detail;
+
+namespace {
+
+struct batch_state_t
+{
+    //! Number of nested batches which are open
+    size_t depth = 0;
+    //! Endpoints with deferred ACKs
+    std::set<std::weak_ptr<command_batch_member>,
+        std::owner_less<std::weak_ptr<command_batch_member>>>
+        members;
+};
+
+batch_state_t& get_batch_state()
+{
+    static thread_local batch_state_t state;
+    return state;
+}
+
+} // namespace
+
+void uhd::rfnoc::detail::begin_command_batch()
+{
+    get_batch_state().depth++;
+}
+
+void uhd::rfnoc::detail::end_command_batch()
+{
+    batch_state_t& state = get_batch_state();
+    if (state.depth == 0) {
+        throw uhd::runtime_error("Cannot end a command batch: No batch is open");
+    }
+    if (--state.depth > 0) {
+        return;
+    }
+
+    auto members = std::move(state.members);
+    state.members.clear();
+    std::exception_ptr error;
+    for (const auto& weak_member : members) {
+        // Endpoints which are gone have nothing left to wait for
+        auto member = weak_member.lock();
+        if (!member) {
+            continue;
+        }
+        try {
+            member->flush_command_batch();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+bool uhd::rfnoc::detail::command_batch_open()
+{
+    return get_batch_state().depth > 0;
+}
+
+void uhd::rfnoc::detail::add_to_command_batch(std::weak_ptr<command_batch_member> member)
+{
+    get_batch_state().members.insert(std::move(member));
+}
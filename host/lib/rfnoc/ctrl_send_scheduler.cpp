@@ -0,0 +1,46 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/scope_exit.hpp>
+#include <uhdlib/rfnoc/ctrl_send_scheduler.hpp>
+#include <algorithm>
+
+using namespace uhd::rfnoc::detail;
+
+constexpr size_t ctrl_send_scheduler::NUM_PRIORITIES;
+
+void ctrl_send_scheduler::send(
+    const priority_t priority, const std::function<void()>& send_fn)
+{
+    const size_t index = static_cast<size_t>(priority);
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _num_waiting[index]++;
+        _cond.wait(lock, [this, index]() {
+            return !_busy
+                   && std::all_of(_num_waiting.begin(),
+                       _num_waiting.begin() + index,
+                       [](const size_t num_waiting) { return num_waiting == 0; });
+        });
+        _num_waiting[index]--;
+        _busy = true;
+    }
+    auto release = uhd::utils::scope_exit::make([this]() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _busy = false;
+        }
+        // Waiters of different classes wait for different conditions
+        _cond.notify_all();
+    });
+    send_fn();
+}
+
+size_t ctrl_send_scheduler::get_num_waiting(const priority_t priority) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _num_waiting[static_cast<size_t>(priority)];
+}
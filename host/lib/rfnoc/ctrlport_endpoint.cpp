@@ -7,14 +7,19 @@
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/metrics.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
+#include <uhdlib/rfnoc/command_batch.hpp>
 #include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
-#include <condition_variable>
 #include <boost/optional.hpp>
+#include <algorithm>
+#include <condition_variable>
 #include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
+#include <map>
 #include <numeric>
-#include <set>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -32,11 +37,56 @@ constexpr double DEFAULT_TIMEOUT = 1.0;
 constexpr double MASSIVE_TIMEOUT = 10.0;
 //! Default value for whether ACKs are always required
 constexpr bool DEFAULT_FORCE_ACKS = false;
+//! Sequence numbers wrap around at this value
+constexpr size_t SEQ_NUM_MODULUS = 64;
+//! Like multi_poke32_acked(), command batches don't have more requests in
+// flight than we can tell apart by their sequence numbers
+constexpr size_t MAX_BATCHED_ACKS = SEQ_NUM_MODULUS / 2;
+
+//! The name of an opcode, as used by get_transaction_stats()
+std::string opcode_to_string(const ctrl_opcode_t op_code)
+{
+    switch (op_code) {
+        case OP_SLEEP:
+            return "sleep";
+        case OP_WRITE:
+            return "write";
+        case OP_READ:
+            return "read";
+        case OP_READ_WRITE:
+            return "read_write";
+        case OP_BLOCK_WRITE:
+            return "block_write";
+        case OP_BLOCK_READ:
+            return "block_read";
+        case OP_POLL:
+            return "poll";
+        default:
+            return "user" + std::to_string(int(op_code) - int(OP_USER1) + 1);
+    }
+}
+
+ctrlport_endpoint::priority_t parse_priority(const std::string& priority)
+{
+    if (priority == "realtime") {
+        return ctrlport_endpoint::priority_t::REALTIME;
+    }
+    if (priority == "normal") {
+        return ctrlport_endpoint::priority_t::NORMAL;
+    }
+    if (priority == "background") {
+        return ctrlport_endpoint::priority_t::BACKGROUND;
+    }
+    throw uhd::value_error("Invalid control priority: " + priority
+                           + " (must be realtime, normal or background)");
+}
 } // namespace
 
 ctrlport_endpoint::~ctrlport_endpoint() = default;
 
-class ctrlport_endpoint_impl : public ctrlport_endpoint
+class ctrlport_endpoint_impl : public ctrlport_endpoint,
+                               public detail::command_batch_member,
+                               public std::enable_shared_from_this<ctrlport_endpoint_impl>
 {
 public:
     ctrlport_endpoint_impl(const send_fn_t& send_fcn,
@@ -58,6 +108,20 @@ public:
 
     ~ctrlport_endpoint_impl() override = default;
 
+    void flush_command_batch() override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        try {
+            wait_for_batched_acks(lock, 0);
+        } catch (...) {
+            for (const auto& request : _batched_acks) {
+                forget_ack(request);
+            }
+            _batched_acks.clear();
+            throw;
+        }
+    }
+
     void poke32(uint32_t addr,
         uint32_t data,
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
@@ -67,6 +131,30 @@ public:
         send_request_packet(OP_WRITE, addr, {data}, timestamp, ack);
     }
 
+    bool try_poke32(uint32_t addr,
+        uint32_t data,
+        uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
+        bool ack                   = false) override
+    {
+        const auto ts = get_timestamp(timestamp);
+        std::unique_lock<std::mutex> lock(_mutex);
+        // Waiting for batched ACKs would block just like a full FIFO
+        if ((is_batched(OP_WRITE, ack) && _batched_acks.size() >= MAX_BATCHED_ACKS)
+            || !buff_has_room(get_write_size(ts.is_initialized()))) {
+            return false;
+        }
+        send_request_locked(lock, OP_WRITE, addr, {data}, ts, ack);
+        return true;
+    }
+
+    size_t get_cmd_fifo_free_slots(const bool timed = false) const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const ssize_t free_words = static_cast<ssize_t>(get_usable_buff_capacity())
+                                   - _buff_occupied;
+        return free_words > 0 ? free_words / get_write_size(timed) : 0;
+    }
+
     void multi_poke32(const std::vector<uint32_t> addrs,
         const std::vector<uint32_t> data,
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
@@ -101,6 +189,54 @@ public:
         */
     }
 
+    void multi_poke32_acked(const std::vector<uint32_t>& addrs,
+        const std::vector<uint32_t>& data,
+        uhd::time_spec_t timestamp   = uhd::time_spec_t::ASAP,
+        const size_t max_outstanding = 16) override
+    {
+        if (addrs.size() != data.size()) {
+            throw uhd::value_error("addrs and data vectors must be of the same length");
+        }
+        if (max_outstanding == 0) {
+            throw uhd::value_error("max_outstanding must be at least 1");
+        }
+        if (data.empty()) {
+            return;
+        }
+        // Responses are matched by sequence number, so we can't have more of
+        // our own requests in flight than there are sequence numbers
+        const size_t window = std::min<size_t>(max_outstanding, SEQ_NUM_MODULUS / 2);
+        const auto first_timestamp = get_timestamp(timestamp);
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        std::deque<ctrl_payload> in_flight;
+        try {
+            for (size_t i = 0; i < data.size(); i++) {
+                if (in_flight.size() == window) {
+                    wait_for_ack(in_flight.front(), lock);
+                    in_flight.pop_front();
+                }
+                in_flight.push_back(send_request(lock,
+                    OP_WRITE,
+                    addrs[i],
+                    {data[i]},
+                    (i == 0) ? first_timestamp : boost::none,
+                    true));
+            }
+            while (!in_flight.empty()) {
+                wait_for_ack(in_flight.front(), lock);
+                in_flight.pop_front();
+            }
+        } catch (...) {
+            // Nobody will wait for the remaining ACKs anymore, so make sure
+            // they don't pile up in the response queue
+            for (const auto& request : in_flight) {
+                forget_ack(request);
+            }
+            throw;
+        }
+    }
+
     uint32_t peek32(
         uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
     {
@@ -111,15 +247,33 @@ public:
         return response.get().data_vtr[0];
     }
 
+    std::future<uint32_t> peek32_async(
+        uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
+    {
+        const auto ts = get_timestamp(timestamp);
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto read = std::make_unique<pending_read>(shared_from_this(),
+            send_request(lock, OP_READ, addr, {uint32_t(0)}, ts, true));
+        lock.unlock();
+        // The future is deferred, so the ACK is collected by whoever calls get()
+        return std::async(
+            std::launch::deferred, [read = std::move(read)]() { return read->get(); });
+    }
+
     std::vector<uint32_t> block_peek32(uint32_t first_addr,
         size_t length,
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
     {
-        std::vector<uint32_t> values;
+        // Send all requests before waiting for the first response
+        std::vector<std::future<uint32_t>> responses;
         for (size_t i = 0; i < length; i++) {
-            values.push_back(peek32(first_addr + (i * sizeof(uint32_t)),
+            responses.push_back(peek32_async(first_addr + (i * sizeof(uint32_t)),
                 (i == 0) ? timestamp : uhd::time_spec_t::ASAP));
         }
+        std::vector<uint32_t> values;
+        for (auto& response : responses) {
+            values.push_back(response.get());
+        }
         return values;
 
         /* TODO: Uncomment when the atomic block peek is implemented in the FPGA
@@ -180,8 +334,10 @@ public:
     {
         std::unique_lock<std::mutex> lock(_mutex);
         if (name == "default") {
-            _policy.timeout    = args.cast<double>("timeout", DEFAULT_TIMEOUT);
-            _policy.force_acks = DEFAULT_FORCE_ACKS;
+            const priority_t priority = parse_priority(args.get("priority", "normal"));
+            _policy.timeout           = args.cast<double>("timeout", DEFAULT_TIMEOUT);
+            _policy.force_acks        = DEFAULT_FORCE_ACKS;
+            _policy.priority          = priority;
         } else {
             // TODO: Uncomment when custom policies are implemented
             throw uhd::not_implemented_error("Policy implemented in the FPGA");
@@ -206,8 +362,14 @@ public:
                 // the client wanted an ACK for this packet
                 wanted_ack_key request_key{
                     rx_ctrl.seq_num, rx_ctrl.op_code, rx_ctrl.address};
-                if (_wanted_acks.count(request_key)) {
-                    _wanted_acks.erase(request_key);
+                auto wanted_ack = _wanted_acks.find(request_key);
+                if (wanted_ack != _wanted_acks.end()) {
+                    const double round_trip =
+                        duration<double>(steady_clock::now() - wanted_ack->second)
+                            .count();
+                    _ctrl_latency->observe(round_trip);
+                    _op_stats[rx_ctrl.op_code].round_trip.observe(round_trip);
+                    _wanted_acks.erase(wanted_ack);
                     _resp_queue.push_back(std::make_tuple(rx_ctrl, resp_status));
                     _resp_ready_cond.notify_all();
                 } else {
@@ -296,7 +458,8 @@ public:
                     std::unique_lock<std::mutex> lock(_mutex);
                     return _policy.timeout;
                 }();
-                _handle_send(tx_ctrl, timeout);
+                // The block waits for this response
+                _handle_send(tx_ctrl, timeout, priority_t::REALTIME);
             } catch (...) {
                 UHD_LOG_ERROR("CTRLEP",
                     "Encountered an error sending a response for an async message");
@@ -329,16 +492,101 @@ public:
         return _local_port;
     }
 
+    std::map<std::string, transaction_stats_t> get_transaction_stats() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::map<std::string, transaction_stats_t> stats;
+        for (const auto& op_stats : _op_stats) {
+            transaction_stats_t& op = stats[opcode_to_string(op_stats.first)];
+            op.round_trip           = op_stats.second.round_trip.get_snapshot();
+            op.ack_wait             = op_stats.second.ack_wait.get_snapshot();
+            op.timeouts             = op_stats.second.timeouts;
+        }
+        return stats;
+    }
+
 private:
     //! The software status (different from the transaction status) of the response
     enum response_status_t { RESP_VALID, RESP_DROPPED, RESP_RTERR, RESP_SIZEERR };
 
+    //! A read request whose ACK has not been collected yet
+    //
+    // If the read is abandoned before get() is called, the endpoint stops
+    // waiting for its ACK.
+    struct pending_read
+    {
+        pending_read(std::weak_ptr<ctrlport_endpoint_impl> ep, const ctrl_payload& req)
+            : endpoint(std::move(ep)), request(req)
+        {
+        }
+
+        ~pending_read()
+        {
+            if (done) {
+                return;
+            }
+            if (auto ep = endpoint.lock()) {
+                std::lock_guard<std::mutex> lock(ep->_mutex);
+                ep->forget_ack(request);
+            }
+        }
+
+        uint32_t get()
+        {
+            auto ep = endpoint.lock();
+            if (!ep) {
+                throw uhd::runtime_error("Ctrlport endpoint was destroyed during a read");
+            }
+            done = true;
+            std::unique_lock<std::mutex> lock(ep->_mutex);
+            try {
+                return ep->wait_for_ack(request, lock).data_vtr[0];
+            } catch (...) {
+                ep->forget_ack(request);
+                throw;
+            }
+        }
+
+        std::weak_ptr<ctrlport_endpoint_impl> endpoint;
+        const ctrl_payload request;
+        bool done = false;
+    };
+
     //! Returns the length of the control payload in 32-bit words
     inline static size_t get_payload_size(const ctrl_payload& payload)
     {
         return 2 + (payload.timestamp.is_initialized() ? 2 : 0) + payload.data_vtr.size();
     }
 
+    //! Returns the length of the payload of a single register write in 32-bit words
+    inline static size_t get_write_size(const bool timed)
+    {
+        return 2 + (timed ? 2 : 0) + 1;
+    }
+
+    //! Returns the room in the downstream buffer for requests in 32-bit words
+    size_t get_usable_buff_capacity() const
+    {
+        // Leave room in the buffer for one response per async message
+        return _buff_capacity - (ASYNC_MESSAGE_SIZE * _max_outstanding_async_msgs);
+    }
+
+    //! Returns whether a request of this size fits into the downstream buffer
+    bool buff_has_room(const size_t pyld_size) const
+    {
+        return (_buff_occupied + static_cast<ssize_t>(pyld_size))
+               <= static_cast<ssize_t>(get_usable_buff_capacity());
+    }
+
+    //! Returns whether we defer waiting for the ACK of this request, because
+    // a command batch is open (see command_batch.hpp)
+    bool is_batched(const ctrl_opcode_t op_code, const bool require_ack) const
+    {
+        return (require_ack || _policy.force_acks)
+               && (op_code == OP_WRITE || op_code == OP_BLOCK_WRITE)
+               && detail::command_batch_open();
+    }
+
     //! Marks the start of a timeout for an operation and returns the expiration time
     inline const steady_clock::time_point start_timeout(double duration)
     {
@@ -356,20 +604,13 @@ private:
         return false;
     }
 
-    //! Sends a request control packet to a remote device, optionally waiting
-    // for an ACK, and returns any response if applicable
-    const std::pair<ctrl_payload, boost::optional<ctrl_payload>> send_request_packet(
-        ctrl_opcode_t op_code,
-        uint32_t address,
-        const std::vector<uint32_t>& data_vtr,
-        const uhd::time_spec_t& time_spec,
-        const bool require_ack = true)
+    //! Checks the clocks and converts from uhd::time_spec to timestamp
+    boost::optional<uint64_t> get_timestamp(const uhd::time_spec_t& time_spec) const
     {
         if (!_client_clk.is_running()) {
             throw uhd::system_error("Ctrlport client clock is not running");
         }
 
-        // Convert from uhd::time_spec to timestamp
         boost::optional<uint64_t> timestamp;
         if (time_spec != time_spec_t::ASAP) {
             if (!_timebase_clk.is_running()) {
@@ -377,9 +618,74 @@ private:
             }
             timestamp = time_spec.to_ticks(_timebase_clk.get_freq());
         }
+        return timestamp;
+    }
+
+    //! Sends a request control packet to a remote device, optionally waiting
+    // for an ACK, and returns any response if applicable
+    const std::pair<ctrl_payload, boost::optional<ctrl_payload>> send_request_packet(
+        ctrl_opcode_t op_code,
+        uint32_t address,
+        const std::vector<uint32_t>& data_vtr,
+        const uhd::time_spec_t& time_spec,
+        const bool require_ack = true)
+    {
+        const auto timestamp = get_timestamp(time_spec);
 
         std::unique_lock<std::mutex> lock(_mutex);
+        return send_request_locked(
+            lock, op_code, address, data_vtr, timestamp, require_ack);
+    }
 
+    //! Same as send_request_packet(), with the mutex already locked
+    const std::pair<ctrl_payload, boost::optional<ctrl_payload>> send_request_locked(
+        std::unique_lock<std::mutex>& lock,
+        ctrl_opcode_t op_code,
+        uint32_t address,
+        const std::vector<uint32_t>& data_vtr,
+        const boost::optional<uint64_t>& timestamp,
+        const bool require_ack)
+    {
+        // Within a command batch, we don't wait for the ACKs of writes until
+        // the batch is closed
+        const bool batched = is_batched(op_code, require_ack);
+        if (batched) {
+            wait_for_batched_acks(lock, MAX_BATCHED_ACKS - 1);
+        }
+        const ctrl_payload tx_ctrl =
+            send_request(lock, op_code, address, data_vtr, timestamp, require_ack);
+
+        if (!require_ack && !_policy.force_acks) {
+            return {tx_ctrl, {}};
+        }
+        if (batched) {
+            _batched_acks.push_back(tx_ctrl);
+            lock.unlock();
+            detail::add_to_command_batch(shared_from_this());
+            return {tx_ctrl, {}};
+        }
+        try {
+            auto response = wait_for_ack(tx_ctrl, lock);
+            return {tx_ctrl, response};
+        } catch (...) {
+            wanted_ack_key ack_key{tx_ctrl.seq_num, tx_ctrl.op_code, tx_ctrl.address};
+            _wanted_acks.erase(ack_key);
+            throw;
+        }
+    }
+
+    //! Sends a request control packet to a remote device without waiting for
+    // an ACK, and returns the request
+    //
+    // If an ACK is required, the caller must either wait for it with
+    // wait_for_ack(), or call forget_ack().
+    const ctrl_payload send_request(std::unique_lock<std::mutex>& lock,
+        ctrl_opcode_t op_code,
+        uint32_t address,
+        const std::vector<uint32_t>& data_vtr,
+        const boost::optional<uint64_t>& timestamp,
+        const bool require_ack)
+    {
         // Assemble the control payload
         ctrl_payload tx_ctrl;
         tx_ctrl.dst_port    = _local_port;
@@ -398,11 +704,8 @@ private:
         // If there is no room in the downstream buffer, then wait until the timeout
         size_t pyld_size   = get_payload_size(tx_ctrl);
         auto buff_not_full = [this, pyld_size]() -> bool {
-            // Allocate room in the queue for one async response packet
             // If we can fit the current request in the queue then we can proceed
-            return (_buff_occupied + pyld_size)
-                   <= (_buff_capacity
-                       - (ASYNC_MESSAGE_SIZE * _max_outstanding_async_msgs));
+            return buff_has_room(pyld_size);
         };
         if (!buff_not_full()) {
             // If there is a timed command in the queue, use the
@@ -411,6 +714,7 @@ private:
                 start_timeout(check_timed_in_queue() ? MASSIVE_TIMEOUT : _policy.timeout);
 
             if (not _buff_free_cond.wait_until(lock, timeout_time, buff_not_full)) {
+                _op_stats[op_code].timeouts++;
                 throw uhd::op_timeout(
                     "Control operation timed out waiting for space in command buffer");
             }
@@ -420,23 +724,20 @@ private:
 
         if (require_ack || _policy.force_acks) {
             // If the client wants an ACK for this request, make note of its
-            // details in a set. This set will be consulted when responses are
-            // received.
+            // details and when it was sent in a map. This map will be
+            // consulted when responses are received.
             wanted_ack_key ack_key{tx_ctrl.seq_num, tx_ctrl.op_code, tx_ctrl.address};
-            _wanted_acks.insert(ack_key);
+            _wanted_acks[ack_key] = steady_clock::now();
         }
 
         try {
             // Send the payload as soon as there is room in the buffer
-            _handle_send(tx_ctrl, _policy.timeout);
-            _tx_seq_num = (_tx_seq_num + 1) % 64;
-
-            if (require_ack || _policy.force_acks) {
-                auto response = wait_for_ack(tx_ctrl, lock);
-                return {tx_ctrl, response};
-            } else {
-                return {tx_ctrl, {}};
-            }
+            // Timed commands must reach the block before their time
+            _handle_send(tx_ctrl,
+                _policy.timeout,
+                timestamp ? priority_t::REALTIME : _policy.priority);
+            _tx_seq_num = (_tx_seq_num + 1) % SEQ_NUM_MODULUS;
+            return tx_ctrl;
         } catch (...) {
             // Something went wrong while trying to send the request.
             // Remove the entry from the ACK tracking set.
@@ -455,6 +756,7 @@ private:
         // command in the queue) at which point we flag a timeout.
         const auto timeout_time =
             start_timeout(check_timed_in_queue() ? MASSIVE_TIMEOUT : _policy.timeout);
+        const auto wait_start = steady_clock::now();
 
         // Check the queue for the response for the specific request, looping
         // until it's found or the timeout timepoint has been reached.
@@ -476,6 +778,9 @@ private:
                     && rx_ctrl.address == request.address) {
                     // Remove the response from the queue
                     _resp_queue.erase(q_iterator);
+                    const double ack_wait =
+                        duration<double>(steady_clock::now() - wait_start).count();
+                    _op_stats[request.op_code].ack_wait.observe(ack_wait);
 
                     // Validate transaction status, either returning the
                     // response if everything checks out, or throwing an
@@ -494,9 +799,43 @@ private:
         } while (
             _resp_ready_cond.wait_until(lock, timeout_time) != std::cv_status::timeout);
 
+        _op_stats[request.op_code].timeouts++;
         throw uhd::op_timeout("Control operation timed out waiting for ACK");
     }
 
+    //! Waits for the oldest ACKs deferred by a command batch, until at most
+    // max_pending of them are left
+    void wait_for_batched_acks(
+        std::unique_lock<std::mutex>& lock, const size_t max_pending)
+    {
+        while (_batched_acks.size() > max_pending) {
+            const ctrl_payload request = _batched_acks.front();
+            _batched_acks.pop_front();
+            try {
+                wait_for_ack(request, lock);
+            } catch (...) {
+                forget_ack(request);
+                throw;
+            }
+        }
+    }
+
+    //! Stops tracking the ACK for the specified request, and drops it if it
+    // has already been received
+    void forget_ack(const ctrl_payload& request)
+    {
+        _wanted_acks.erase(
+            wanted_ack_key{request.seq_num, request.op_code, request.address});
+        for (auto it = _resp_queue.begin(); it != _resp_queue.end(); ++it) {
+            const auto& rx_ctrl = std::get<0>(*it);
+            if (rx_ctrl.seq_num == request.seq_num && rx_ctrl.op_code == request.op_code
+                && rx_ctrl.address == request.address) {
+                _resp_queue.erase(it);
+                return;
+            }
+        }
+    }
+
     const ctrl_payload validate_ack(
         const ctrl_payload& rx_ctrl, response_status_t resp_status) const
     {
@@ -535,11 +874,20 @@ private:
             "CTRLEP", "Control response for ack-less request was dropped: " << packet);
     }
 
+    //! The latency statistics of the transactions with one opcode
+    struct op_stats_t
+    {
+        uhd::metrics::histogram round_trip{uhd::metrics::get_ctrl_latency_bounds()};
+        uhd::metrics::histogram ack_wait{uhd::metrics::get_ctrl_latency_bounds()};
+        uint64_t timeouts = 0;
+    };
+
     //! The parameters associated with the policy that governs this object
     struct policy_args
     {
-        double timeout  = DEFAULT_TIMEOUT;
-        bool force_acks = DEFAULT_FORCE_ACKS;
+        double timeout      = DEFAULT_TIMEOUT;
+        bool force_acks     = DEFAULT_FORCE_ACKS;
+        priority_t priority = priority_t::NORMAL;
     };
 
     //! Function to call to send a control packet
@@ -578,11 +926,19 @@ private:
     //! A condition variable that hold the "response is available" condition
     std::condition_variable _resp_ready_cond;
     //! A mutex to protect all state in this class
-    std::mutex _mutex;
-    //! A set of {opcode, address, sequence numbers} triples associated with
-    // request packets for which the client cares about receiving ACKs
+    mutable std::mutex _mutex;
+    //! The {opcode, address, sequence numbers} triples associated with request
+    // packets for which the client cares about receiving ACKs, and the times
+    // the requests were sent
     using wanted_ack_key = std::tuple<uint8_t, ctrl_opcode_t, uint32_t>;
-    std::set<wanted_ack_key> _wanted_acks;
+    std::map<wanted_ack_key, steady_clock::time_point> _wanted_acks;
+    //! The histogram of the time it takes to receive an ACK
+    const uhd::metrics::histogram::sptr _ctrl_latency =
+        uhd::metrics::get_ctrl_latency_histogram();
+    //! Writes for which a command batch deferred waiting for the ACK, oldest first
+    std::deque<ctrl_payload> _batched_acks;
+    //! The latency statistics of the transactions, by opcode
+    std::map<ctrl_opcode_t, op_stats_t> _op_stats;
 };
 
 ctrlport_endpoint::sptr ctrlport_endpoint::make(const send_fn_t& handle_send,
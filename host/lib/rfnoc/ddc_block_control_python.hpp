@@ -21,6 +21,11 @@ void export_ddc_block_control(py::module& m)
             py::arg("freq"),
             py::arg("chan"),
             py::arg("time") = boost::optional<uhd::time_spec_t>())
+        .def("set_freqs",
+            &ddc_block_control::set_freqs,
+            py::arg("freqs"),
+            py::arg("chans"),
+            py::arg("time") = boost::optional<uhd::time_spec_t>())
         .def("get_freq", &ddc_block_control::get_freq)
         .def("get_frequency_range", &ddc_block_control::get_frequency_range)
         .def("get_input_rate", &ddc_block_control::get_input_rate)
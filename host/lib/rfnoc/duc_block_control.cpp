@@ -17,6 +17,7 @@
 #include <uhdlib/utils/compat_check.hpp>
 #include <uhdlib/utils/math.hpp>
 #include <cmath>
+#include <map>
 #include <set>
 #include <string>
 
@@ -120,6 +121,43 @@ public:
         return get_freq(chan);
     }
 
+    std::vector<double> set_freqs(const std::vector<double>& freqs,
+        const std::vector<size_t>& chans,
+        const boost::optional<uhd::time_spec_t> time) override
+    {
+        if (freqs.size() != chans.size()) {
+            throw uhd::value_error(
+                "set_freqs(): Number of frequencies does not match number of channels");
+        }
+        std::map<size_t, double> chan_freqs;
+        for (size_t i = 0; i < chans.size(); i++) {
+            if (chans[i] >= get_num_ports()) {
+                throw uhd::value_error(
+                    "set_freqs(): Invalid channel " + std::to_string(chans[i]));
+            }
+            chan_freqs[chans[i]] = freqs[i];
+        }
+        // Store the current command times so we can restore them later
+        std::map<size_t, uhd::time_spec_t> prev_cmd_times;
+        for (const auto& chan_freq : chan_freqs) {
+            prev_cmd_times[chan_freq.first] = get_command_time(chan_freq.first);
+            if (time) {
+                set_command_time(time.get(), chan_freq.first);
+            }
+        }
+        // This will trigger one property propagation for all channels:
+        set_properties<double>("freq", chan_freqs);
+        for (const auto& chan_cmd_time : prev_cmd_times) {
+            set_command_time(chan_cmd_time.second, chan_cmd_time.first);
+        }
+        std::vector<double> actual_freqs;
+        actual_freqs.reserve(chans.size());
+        for (const size_t chan : chans) {
+            actual_freqs.push_back(get_freq(chan));
+        }
+        return actual_freqs;
+    }
+
     double get_freq(const size_t chan) const override
     {
         return _freq.at(chan).get();
@@ -21,6 +21,11 @@ void export_duc_block_control(py::module& m)
             py::arg("freq"),
             py::arg("chan"),
             py::arg("time") = boost::optional<uhd::time_spec_t>())
+        .def("set_freqs",
+            &duc_block_control::set_freqs,
+            py::arg("freqs"),
+            py::arg("chans"),
+            py::arg("time") = boost::optional<uhd::time_spec_t>())
         .def("get_freq", &duc_block_control::get_freq)
         .def("get_frequency_range", &duc_block_control::get_frequency_range)
         .def("get_input_rate", &duc_block_control::get_input_rate)
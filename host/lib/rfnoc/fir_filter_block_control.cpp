@@ -10,6 +10,8 @@
 #include <uhd/rfnoc/property.hpp>
 #include <uhd/rfnoc/registry.hpp>
 #include <uhd/rfnoc/fir_filter_block_control.hpp>
+#include <algorithm>
+#include <map>
 
 using namespace uhd::rfnoc;
 
@@ -63,6 +65,7 @@ public:
         // by padding with zeroes
         _coeffs[chan].resize(_max_num_coeffs.at(chan), 0);
         _program_coefficients(chan);
+        _coeff_set_names[chan].clear();
     }
 
     std::vector<int16_t> get_coefficients(const size_t chan = 0) const override
@@ -77,12 +80,77 @@ public:
         return _coeffs.at(chan);
     }
 
+    void add_coefficient_set(
+        const std::string& name, const std::vector<int16_t>& coeffs) override
+    {
+        const size_t max_num_coeffs =
+            *std::max_element(_max_num_coeffs.cbegin(), _max_num_coeffs.cend());
+        if (coeffs.size() > max_num_coeffs) {
+            throw uhd::value_error("Too many filter coefficients in set " + name
+                                   + " (max " + std::to_string(max_num_coeffs) + ")");
+        }
+        _coeff_sets[name] = coeffs;
+        // Channels which use a previous set of this name must be reloaded
+        for (auto& set_name : _coeff_set_names) {
+            if (set_name == name) {
+                set_name.clear();
+            }
+        }
+    }
+
+    bool has_coefficient_set(const std::string& name) const override
+    {
+        return _coeff_sets.count(name) > 0;
+    }
+
+    void remove_coefficient_set(const std::string& name) override
+    {
+        if (_coeff_sets.erase(name) == 0) {
+            throw uhd::key_error("No FIR filter coefficient set named " + name);
+        }
+    }
+
+    std::vector<std::string> get_coefficient_sets() const override
+    {
+        std::vector<std::string> names;
+        for (const auto& coeff_set : _coeff_sets) {
+            names.push_back(coeff_set.first);
+        }
+        return names;
+    }
+
+    void load_coefficient_set(const std::string& name, const size_t chan = 0) override
+    {
+        auto coeff_set = _coeff_sets.find(name);
+        if (coeff_set == _coeff_sets.end()) {
+            throw uhd::key_error("No FIR filter coefficient set named " + name);
+        }
+        if (chan < _coeff_set_names.size() && _coeff_set_names[chan] == name) {
+            return;
+        }
+        set_coefficients(coeff_set->second, chan);
+        _coeff_set_names[chan] = name;
+    }
+
+    std::string get_coefficient_set(const size_t chan = 0) const override
+    {
+        if (chan >= get_num_input_ports()) {
+            std::string error_msg =
+                "Cannot get coefficient set for FIR Filter channel "
+                + std::to_string(chan) + ", channel value must be less than "
+                "or equal to " + std::to_string(get_num_input_ports()-1);
+            throw uhd::value_error(error_msg);
+        }
+        return _coeff_set_names.at(chan);
+    }
+
 private:
     void _register_props()
     {
         const size_t num_chans = get_num_input_ports();
         _max_num_coeffs.reserve(num_chans);
         _coeffs.reserve(num_chans);
+        _coeff_set_names.resize(num_chans);
         _prop_max_num_coeffs.reserve(num_chans);
         _prop_type_in.reserve(num_chans);
         _prop_type_out.reserve(num_chans);
@@ -149,6 +217,12 @@ private:
     //! Current fir filter coefficients
     std::vector<std::vector<int16_t>> _coeffs;
 
+    //! Named coefficient sets
+    std::map<std::string, std::vector<int16_t>> _coeff_sets;
+
+    //! Name of the coefficient set each channel uses, empty if none
+    std::vector<std::string> _coeff_set_names;
+
     /**************************************************************************
      * Attributes
      *************************************************************************/
@@ -19,5 +19,17 @@ void export_fir_filter_block_control(py::module& m)
         .def("get_max_num_coefficients",
             &fir_filter_block_control::get_max_num_coefficients)
         .def("set_coefficients", &fir_filter_block_control::set_coefficients)
-        .def("get_coefficients", &fir_filter_block_control::get_coefficients);
+        .def("get_coefficients", &fir_filter_block_control::get_coefficients)
+        .def("add_coefficient_set", &fir_filter_block_control::add_coefficient_set)
+        .def("has_coefficient_set", &fir_filter_block_control::has_coefficient_set)
+        .def("remove_coefficient_set",
+            &fir_filter_block_control::remove_coefficient_set)
+        .def("get_coefficient_sets", &fir_filter_block_control::get_coefficient_sets)
+        .def("load_coefficient_set",
+            &fir_filter_block_control::load_coefficient_set,
+            py::arg("name"),
+            py::arg("chan") = 0)
+        .def("get_coefficient_set",
+            &fir_filter_block_control::get_coefficient_set,
+            py::arg("chan") = 0);
 }
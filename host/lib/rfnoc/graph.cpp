@@ -10,6 +10,7 @@
 #include <uhdlib/rfnoc/node_accessor.hpp>
 #include <boost/graph/filtered_graph.hpp>
 #include <boost/graph/topological_sort.hpp>
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -168,6 +169,7 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
     auto edge_descriptor =
         boost::add_edge(src_vertex_desc, dst_vertex_desc, edge_info, _graph);
     UHD_ASSERT_THROW(edge_descriptor.second);
+    _topo_sorted_nodes_valid = false;
 
     // Now make sure we didn't add an unintended cycle
     try {
@@ -180,10 +182,13 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
                            << " without disabling is_forward_edge will lead "
                               "to unresolvable graph!");
         boost::remove_edge(edge_descriptor.first, _graph);
+        _topo_sorted_nodes_valid = false;
         throw uhd::rfnoc_error(
             "Adding edge without disabling is_forward_edge will lead "
             "to unresolvable graph!");
     }
+    _mark_changed(src_node);
+    _mark_changed(dst_node);
 }
 
 void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edge_info)
@@ -213,6 +218,9 @@ void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t
             return (edge_info == boost::get(edge_property_t(), this->_graph, edge_desc));
         },
         _graph);
+    _topo_sorted_nodes_valid = false;
+    _mark_changed(src_node);
+    _mark_changed(dst_node);
 
     if (boost::degree(src_vertex_desc, _graph) == 0) {
         _remove_node(src_node);
@@ -241,7 +249,25 @@ void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t
 void graph_t::remove(node_ref_t node)
 {
     std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+    if (_node_map.count(node)) {
+        // The neighbours lose their edges to this node
+        const auto vertex_desc = _node_map.at(node);
+        auto out_edge_range    = boost::out_edges(vertex_desc, _graph);
+        for (auto it = out_edge_range.first; it != out_edge_range.second; ++it) {
+            const auto neighbour = boost::target(*it, _graph);
+            _mark_changed(boost::get(vertex_property_t(), _graph, neighbour));
+        }
+        auto in_edge_range = boost::in_edges(vertex_desc, _graph);
+        for (auto it = in_edge_range.first; it != in_edge_range.second; ++it) {
+            const auto neighbour = boost::source(*it, _graph);
+            _mark_changed(boost::get(vertex_property_t(), _graph, neighbour));
+        }
+    }
     _remove_node(node);
+    // The node may be destroyed now, and a new one may be created at the same
+    // address, so it must not be mistaken for a committed node
+    _committed_nodes.erase(node);
+    _changed_nodes.erase(node);
 }
 
 void graph_t::commit()
@@ -251,9 +277,19 @@ void graph_t::commit()
         _release_count--;
     }
     if (_release_count == 0) {
-        _check_topology();
-        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        resolve_all_properties(resolve_context::INIT, *boost::vertices(_graph).first);
+        if (_dynamic_reconfig && !_full_commit_needed) {
+            _commit_changes();
+        } else {
+            auto v_iterators = boost::vertices(_graph);
+            _check_topology(vertex_list_t(v_iterators.first, v_iterators.second));
+            std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+            resolve_all_properties(resolve_context::INIT, *boost::vertices(_graph).first);
+        }
+        for (const auto& node : _node_map) {
+            _committed_nodes.insert(node.first);
+        }
+        _changed_nodes.clear();
+        _full_commit_needed = false;
     }
 }
 
@@ -264,6 +300,13 @@ void graph_t::release()
     _release_count++;
 }
 
+void graph_t::set_dynamic_reconfig(const bool enable)
+{
+    std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+    UHD_LOG_TRACE(LOG_ID, "graph::set_dynamic_reconfig(" << enable << ")");
+    _dynamic_reconfig = enable;
+}
+
 void graph_t::shutdown()
 {
     std::lock_guard<std::recursive_mutex> l(_graph_mutex);
@@ -310,6 +353,8 @@ void graph_t::resolve_all_properties(
         node_accessor.resolve_props(current_node);
         // Now mark all properties on this node as clean
         node_accessor.clean_props(current_node);
+        // The neighbours don't know about the changes yet
+        _mark_changed(current_node);
         return;
     }
 
@@ -327,7 +372,7 @@ void graph_t::_resolve_all_properties(resolve_context context,
     node_accessor_t node_accessor{};
 
     // First, find the node on which we'll start.
-    auto initial_dirty_nodes = _find_dirty_nodes();
+    const auto initial_dirty_nodes = _find_dirty_nodes();
     if (initial_dirty_nodes.size() > 1) {
         UHD_LOGGER_WARNING(LOG_ID)
             << "Found " << initial_dirty_nodes.size()
@@ -340,11 +385,20 @@ void graph_t::_resolve_all_properties(resolve_context context,
     }
 
     // Now get all nodes in topologically sorted order, and the appropriate
-    // iterators.
-    auto topo_sorted_nodes = _get_topo_sorted_nodes();
-    auto node_it           = topo_sorted_nodes.begin();
-    auto begin_it          = topo_sorted_nodes.begin();
-    auto end_it            = topo_sorted_nodes.end();
+    // iterators. If a node property changed, only the nodes which that change
+    // (or any other dirty property) can reach need to be visited. This keeps
+    // the resolution local to one channel on devices with many blocks.
+    vertex_list_t topo_sorted_nodes;
+    if (context == resolve_context::NODE_PROP) {
+        vertex_list_t origins(initial_dirty_nodes);
+        origins.push_back(initial_node);
+        topo_sorted_nodes = _get_connected_nodes(origins);
+    } else {
+        topo_sorted_nodes = _get_topo_sorted_nodes();
+    }
+    auto node_it  = topo_sorted_nodes.begin();
+    auto begin_it = topo_sorted_nodes.begin();
+    auto end_it   = topo_sorted_nodes.end();
     while (*node_it != initial_node) {
         if (node_it == end_it) {
             throw uhd::rfnoc_error("Cannot find node in graph!");
@@ -389,7 +443,8 @@ void graph_t::_resolve_all_properties(resolve_context context,
 
         // If the property resolution was triggered by a node updating one of
         // its properties, we can stop anytime there are no more dirty nodes.
-        if (context == resolve_context::NODE_PROP && _find_dirty_nodes().empty()) {
+        if (context == resolve_context::NODE_PROP
+            && !_has_dirty_nodes(topo_sorted_nodes)) {
             UHD_LOG_TRACE(LOG_ID,
                 "Terminating graph resolution early during iteration " << num_iterations);
             break;
@@ -421,7 +476,8 @@ void graph_t::_resolve_all_properties(resolve_context context,
         // we've gone full circle (one full iteration).
         if (forward_dir && (*node_it == initial_node)) {
             num_iterations++;
-            if (num_iterations == MAX_NUM_ITERATIONS || _find_dirty_nodes().empty()) {
+            if (num_iterations == MAX_NUM_ITERATIONS
+                || !_has_dirty_nodes(topo_sorted_nodes)) {
                 UHD_LOG_TRACE(LOG_ID,
                     "Terminating graph resolution after iteration " << num_iterations);
                 break;
@@ -563,20 +619,73 @@ graph_t::vertex_list_t graph_t::_find_dirty_nodes()
     return vertex_list_t(v_iterators.first, v_iterators.second);
 }
 
-graph_t::vertex_list_t graph_t::_get_topo_sorted_nodes()
+bool graph_t::_has_dirty_nodes(const vertex_list_t& nodes)
 {
+    return std::any_of(nodes.cbegin(), nodes.cend(), [this](const auto vertex) {
+        return !get_dirty_props(boost::get(vertex_property_t(), _graph, vertex)).empty();
+    });
+}
+
+const graph_t::vertex_list_t& graph_t::_get_topo_sorted_nodes()
+{
+    if (_topo_sorted_nodes_valid) {
+        return _topo_sorted_nodes;
+    }
+
     // Create a view on the graph that doesn't include the back-edges
     ForwardEdgePredicate edge_filter(_graph);
     boost::filtered_graph<rfnoc_graph_t, ForwardEdgePredicate> fg(_graph, edge_filter);
 
-    // Topo-sort and return
+    // Topo-sort and cache the result
     vertex_list_t sorted_nodes;
     try {
         boost::topological_sort(fg, std::front_inserter(sorted_nodes));
     } catch (boost::not_a_dag&) {
         throw uhd::rfnoc_error("Cannot resolve graph because it has at least one cycle!");
     }
-    return sorted_nodes;
+    _topo_sorted_nodes       = std::move(sorted_nodes);
+    _topo_sorted_nodes_valid = true;
+    return _topo_sorted_nodes;
+}
+
+graph_t::vertex_list_t graph_t::_get_connected_nodes(const vertex_list_t& origins)
+{
+    // Flood-fill from the origins along edges in both directions. Vertex
+    // descriptors are indices, because the vertex list is a vecS.
+    std::vector<bool> connected(boost::num_vertices(_graph), false);
+    std::vector<rfnoc_graph_t::vertex_descriptor> to_visit;
+    for (const auto origin : origins) {
+        if (!connected[origin]) {
+            connected[origin] = true;
+            to_visit.push_back(origin);
+        }
+    }
+    auto visit = [&connected, &to_visit](const rfnoc_graph_t::vertex_descriptor v) {
+        if (!connected[v]) {
+            connected[v] = true;
+            to_visit.push_back(v);
+        }
+    };
+    while (!to_visit.empty()) {
+        const auto vertex = to_visit.back();
+        to_visit.pop_back();
+        auto out_edges = boost::out_edges(vertex, _graph);
+        for (auto it = out_edges.first; it != out_edges.second; ++it) {
+            visit(boost::target(*it, _graph));
+        }
+        auto in_edges = boost::in_edges(vertex, _graph);
+        for (auto it = in_edges.first; it != in_edges.second; ++it) {
+            visit(boost::source(*it, _graph));
+        }
+    }
+
+    vertex_list_t connected_nodes;
+    for (const auto vertex : _get_topo_sorted_nodes()) {
+        if (connected[vertex]) {
+            connected_nodes.push_back(vertex);
+        }
+    }
+    return connected_nodes;
 }
 
 void graph_t::_add_node(node_ref_t new_node)
@@ -586,6 +695,7 @@ void graph_t::_add_node(node_ref_t new_node)
     }
 
     _node_map.emplace(new_node, boost::add_vertex(new_node, _graph));
+    _topo_sorted_nodes_valid = false;
 }
 
 void graph_t::_remove_node(node_ref_t node)
@@ -599,6 +709,7 @@ void graph_t::_remove_node(node_ref_t node)
         // Remove the vertex
         boost::remove_vertex(vertex_desc, _graph);
         _node_map.erase(node);
+        _topo_sorted_nodes_valid = false;
 
         // Removing the vertex changes the vertex descriptors,
         // so update the node map
@@ -698,21 +809,20 @@ bool graph_t::_assert_edge_props_consistent(rfnoc_graph_t::edge_descriptor edge)
     return props_match;
 }
 
-void graph_t::_check_topology()
+void graph_t::_check_topology(const vertex_list_t& vertices)
 {
     node_accessor_t node_accessor{};
-    bool topo_ok     = true;
-    auto v_iterators = boost::vertices(_graph);
-    for (auto it = v_iterators.first; it != v_iterators.second; ++it) {
-        node_ref_t node = boost::get(vertex_property_t(), _graph, *it);
+    bool topo_ok = true;
+    for (const auto vertex : vertices) {
+        node_ref_t node = boost::get(vertex_property_t(), _graph, vertex);
         std::vector<size_t> connected_inputs;
         std::vector<size_t> connected_outputs;
-        auto ie_iters = boost::in_edges(*it, _graph);
+        auto ie_iters = boost::in_edges(vertex, _graph);
         for (auto it = ie_iters.first; it != ie_iters.second; ++it) {
             graph_edge_t edge_info = boost::get(edge_property_t(), _graph, *it);
             connected_inputs.push_back(edge_info.dst_port);
         }
-        auto oe_iters = boost::out_edges(*it, _graph);
+        auto oe_iters = boost::out_edges(vertex, _graph);
         for (auto it = oe_iters.first; it != oe_iters.second; ++it) {
             graph_edge_t edge_info = boost::get(edge_property_t(), _graph, *it);
             connected_outputs.push_back(edge_info.src_port);
@@ -770,6 +880,46 @@ void graph_t::_check_topology()
     }
 }
 
+void graph_t::_mark_changed(node_ref_t node)
+{
+    if (!_committed_nodes.count(node)) {
+        _full_commit_needed = true;
+    }
+    _changed_nodes.insert(node);
+}
+
+void graph_t::_commit_changes()
+{
+    vertex_list_t changed_vertices;
+    for (const auto vertex : _get_topo_sorted_nodes()) {
+        if (_changed_nodes.count(boost::get(vertex_property_t(), _graph, vertex))) {
+            changed_vertices.push_back(vertex);
+        }
+    }
+    UHD_LOG_TRACE(
+        LOG_ID, "Committing changes to " << changed_vertices.size() << " node(s)");
+    _check_topology(changed_vertices);
+
+    // All nodes were resolved before, so only the edge properties of the
+    // changed nodes can differ from those of their (new) neighbours. Forward
+    // them in the order of a full resolution, so upstream values win.
+    for (const auto vertex : changed_vertices) {
+        _forward_edge_props(vertex, true);
+    }
+    for (const auto vertex : changed_vertices) {
+        _forward_edge_props(vertex, false);
+    }
+
+    // If that made properties dirty, resolve them like a property change,
+    // starting with the node furthest upstream
+    for (const auto vertex : _get_topo_sorted_nodes()) {
+        if (!get_dirty_props(boost::get(vertex_property_t(), _graph, vertex)).empty()) {
+            resolve_all_properties(resolve_context::NODE_PROP, vertex);
+            return;
+        }
+    }
+}
+
 std::pair<graph_t::node_ref_t, graph_t::graph_edge_t> graph_t::_find_neighbour(
     rfnoc_graph_t::vertex_descriptor origin, res_source_info port_info)
 {
@@ -11,9 +11,12 @@
 #include <uhdlib/rfnoc/topo_graph.hpp>
 #include <uhdlib/transport/links.hpp>
 #include <boost/format.hpp>
+#include <exception>
+#include <future>
 #include <map>
 #include <memory>
 #include <set>
+#include <tuple>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -37,8 +40,10 @@ public:
                     pkt_factory, *lnk.second, epid_alloc, lnk.first, _tgraph));
             auto adapter = _link_mgrs.at(lnk.first)->get_adapter_id();
             if (_alloc_map.count(adapter) == 0) {
-                _alloc_map[adapter] = allocation_info{0, 0};
+                _alloc_map[adapter] = allocation_info{};
             }
+            _link_rates[lnk.first]   = lnk.second->get_link_rate(lnk.first);
+            _link_mboards[lnk.first] = lnk.second;
         }
         for (const auto& mgr_pair : _link_mgrs) {
             mgr_pair.second->add_unreachable_transport_adapters();
@@ -191,14 +196,12 @@ public:
         const sw_buff_t mdata_buff_fmt,
         const uhd::transport::adapter_id_t adapter,
         const device_addr_t& xport_args,
-        const std::string& streamer_id) override
+        const std::string& streamer_id,
+        const double byte_rate) override
     {
         device_id_t dev = _check_dst_and_find_src(
-            src_addr, adapter, uhd::transport::link_type_t::RX_DATA);
-        uhd::transport::adapter_id_t chosen = _link_mgrs.at(dev)->get_adapter_id();
-        auto allocs                         = _alloc_map.at(chosen);
-        allocs.rx++;
-        _alloc_map[chosen] = allocs;
+            src_addr, adapter, uhd::transport::link_type_t::RX_DATA, byte_rate);
+        _allocate(dev, true, byte_rate, streamer_id);
         return _link_mgrs.at(dev)->create_device_to_host_data_stream(
             src_addr, pyld_buff_fmt, mdata_buff_fmt, xport_args, streamer_id);
     }
@@ -208,18 +211,62 @@ public:
         const sw_buff_t mdata_buff_fmt,
         const uhd::transport::adapter_id_t adapter,
         const device_addr_t& xport_args,
-        const std::string& streamer_id) override
+        const std::string& streamer_id,
+        const double byte_rate) override
     {
         device_id_t dev = _check_dst_and_find_src(
-            dst_addr, adapter, uhd::transport::link_type_t::TX_DATA);
-        uhd::transport::adapter_id_t chosen = _link_mgrs.at(dev)->get_adapter_id();
-        auto allocs                         = _alloc_map.at(chosen);
-        allocs.tx++;
-        _alloc_map[chosen] = allocs;
+            dst_addr, adapter, uhd::transport::link_type_t::TX_DATA, byte_rate);
+        _allocate(dev, false, byte_rate, streamer_id);
         return _link_mgrs.at(dev)->create_host_to_device_data_stream(
             dst_addr, pyld_buff_fmt, mdata_buff_fmt, xport_args, streamer_id);
     }
 
+    std::vector<chdr_rx_data_xport::uptr> create_device_to_host_data_streams(
+        const std::vector<data_stream_args_t>& streams) override
+    {
+        return _create_data_streams<chdr_rx_data_xport::uptr>(streams,
+            true,
+            [](link_stream_manager& link_mgr, const data_stream_args_t& stream) {
+                return link_mgr.create_device_to_host_data_stream(stream.sep_addr,
+                    stream.pyld_buff_fmt,
+                    stream.mdata_buff_fmt,
+                    stream.xport_args,
+                    stream.streamer_id);
+            });
+    }
+
+    std::vector<chdr_tx_data_xport::uptr> create_host_to_device_data_streams(
+        const std::vector<data_stream_args_t>& streams) override
+    {
+        return _create_data_streams<chdr_tx_data_xport::uptr>(streams,
+            false,
+            [](link_stream_manager& link_mgr, const data_stream_args_t& stream) {
+                return link_mgr.create_host_to_device_data_stream(stream.sep_addr,
+                    stream.pyld_buff_fmt,
+                    stream.mdata_buff_fmt,
+                    stream.xport_args,
+                    stream.streamer_id);
+            });
+    }
+
+    void release_data_streams(const std::string& streamer_id) override
+    {
+        if (_stream_allocs.count(streamer_id) == 0) {
+            return;
+        }
+        for (const auto& stream_alloc : _stream_allocs.at(streamer_id)) {
+            auto& allocs = _alloc_map.at(stream_alloc.adapter);
+            if (stream_alloc.rx) {
+                allocs.rx--;
+                allocs.rx_byte_rate -= stream_alloc.byte_rate;
+            } else {
+                allocs.tx--;
+                allocs.tx_byte_rate -= stream_alloc.byte_rate;
+            }
+        }
+        _stream_allocs.erase(streamer_id);
+    }
+
     std::vector<uhd::transport::adapter_id_t> get_adapters(sep_addr_t addr) const override
     {
         auto adapters = std::vector<uhd::transport::adapter_id_t>();
@@ -250,38 +297,52 @@ private:
     // \param link_type The type of link for which we're finding a local device
     //                  ID. When \p adapter is NULL_ADAPTER_ID, then we use this
     //                  in our heuristics for choosing an adapter.
+    // \param byte_rate The expected rate of a data stream in bytes/sec, or 0
+    //                  if unknown. Also used in the heuristics.
     device_id_t _check_dst_and_find_src(sep_addr_t dst_addr,
         uhd::transport::adapter_id_t adapter,
-        uhd::transport::link_type_t link_type) const
+        uhd::transport::link_type_t link_type,
+        const double byte_rate = 0.0) const
     {
         if (_src_map.count(dst_addr) > 0) {
             const auto& src_devs = _src_map.at(dst_addr);
             if (adapter == uhd::transport::NULL_ADAPTER_ID) {
-                // TODO: Maybe we can come up with a better heuristic for when the user
-                // gives no preference
+                if (link_type != uhd::transport::link_type_t::TX_DATA
+                    && link_type != uhd::transport::link_type_t::RX_DATA) {
+                    // Just accept first device for CTRL and ASYNC_MSG
+                    return src_devs[0];
+                }
+                // Pick the link with the lowest utilization in the direction
+                // of the stream (the links are full duplex), and the fewest
+                // streams if the utilizations are equal (e.g. unknown rates)
+                const bool rx  = link_type == uhd::transport::link_type_t::RX_DATA;
+                auto get_score = [this, rx, byte_rate](const device_id_t dev) {
+                    const auto& alloc =
+                        _alloc_map.at(_link_mgrs.at(dev)->get_adapter_id());
+                    const double link_rate = _link_rates.at(dev);
+                    double load = (rx ? alloc.rx_byte_rate : alloc.tx_byte_rate);
+                    if (link_rate > 0.0) {
+                        load = (load + byte_rate) / link_rate;
+                    }
+                    return std::make_tuple(load, rx ? alloc.rx : alloc.tx);
+                };
                 auto dev       = src_devs[0];
-                auto dev_alloc = _alloc_map.at(_link_mgrs.at(dev)->get_adapter_id());
+                auto dev_score = get_score(dev);
                 for (auto candidate : src_devs) {
-                    auto candidate_alloc =
-                        _alloc_map.at(_link_mgrs.at(candidate)->get_adapter_id());
-                    switch (link_type) {
-                        case uhd::transport::link_type_t::TX_DATA:
-                            if (candidate_alloc.tx < dev_alloc.tx) {
-                                dev       = candidate;
-                                dev_alloc = candidate_alloc;
-                            }
-                            break;
-                        case uhd::transport::link_type_t::RX_DATA:
-                            if (candidate_alloc.rx < dev_alloc.rx) {
-                                dev       = candidate;
-                                dev_alloc = candidate_alloc;
-                            }
-                            break;
-                        default:
-                            // Just accept first device for CTRL and ASYNC_MSG
-                            break;
+                    const auto candidate_score = get_score(candidate);
+                    if (candidate_score < dev_score) {
+                        dev       = candidate;
+                        dev_score = candidate_score;
                     }
                 }
+                if (std::get<0>(dev_score) > 1.0 && _link_rates.at(dev) > 0.0) {
+                    UHD_LOG_WARNING("RFNOC::GRAPH",
+                        "The data streams on link "
+                            << dev << " exceed its rate of " << _link_rates.at(dev)
+                            << " bytes/s. A single stream can not be split across "
+                               "several links, consider a faster link or a lower "
+                               "sample rate.");
+                }
                 return dev;
             } else {
                 for (const auto& src : src_devs) {
@@ -306,16 +367,107 @@ private:
     // A map of addresses that can be taken to reach a particular destination
     std::map<sep_addr_t, std::vector<device_id_t>> _src_map;
 
+    //! Account for a new data stream through the adapter of \p dev
+    void _allocate(const device_id_t dev,
+        const bool rx,
+        const double byte_rate,
+        const std::string& streamer_id)
+    {
+        const uhd::transport::adapter_id_t chosen = _link_mgrs.at(dev)->get_adapter_id();
+        auto& allocs                              = _alloc_map.at(chosen);
+        if (rx) {
+            allocs.rx++;
+            allocs.rx_byte_rate += byte_rate;
+        } else {
+            allocs.tx++;
+            allocs.tx_byte_rate += byte_rate;
+        }
+        _stream_allocs[streamer_id].push_back({chosen, rx, byte_rate});
+    }
+
+    //! Create the data streams of create_*_data_streams()
+    //
+    // The links are chosen one stream after the other, so the load balancing
+    // sees the streams which came before. The streams are then set up by the
+    // link managers. The transports and management portals of a motherboard
+    // are not shared with any other motherboard, so every motherboard sets up
+    // its streams on a thread of its own.
+    template <typename xport_uptr_t, typename create_fn_t>
+    std::vector<xport_uptr_t> _create_data_streams(
+        const std::vector<data_stream_args_t>& streams,
+        const bool rx,
+        create_fn_t&& create_fn)
+    {
+        const auto link_type = rx ? uhd::transport::link_type_t::RX_DATA
+                                  : uhd::transport::link_type_t::TX_DATA;
+        std::map<mb_iface*, std::vector<std::pair<size_t, device_id_t>>> mb_streams;
+        for (size_t i = 0; i < streams.size(); i++) {
+            const auto& stream    = streams[i];
+            const device_id_t dev = _check_dst_and_find_src(
+                stream.sep_addr, stream.adapter, link_type, stream.byte_rate);
+            _allocate(dev, rx, stream.byte_rate, stream.streamer_id);
+            mb_streams[_link_mboards.at(dev)].emplace_back(i, dev);
+        }
+
+        std::vector<xport_uptr_t> xports(streams.size());
+        // With only one motherboard, there's nothing to gain from another thread
+        const auto policy =
+            mb_streams.size() > 1 ? std::launch::async : std::launch::deferred;
+        std::vector<std::future<void>> tasks;
+        for (const auto& mb_stream : mb_streams) {
+            tasks.push_back(std::async(policy, [&]() {
+                for (const auto& stream_dev : mb_stream.second) {
+                    xports[stream_dev.first] = create_fn(
+                        *_link_mgrs.at(stream_dev.second), streams[stream_dev.first]);
+                }
+            }));
+        }
+        // Wait for all motherboards before throwing the first error
+        std::exception_ptr error;
+        for (auto& task : tasks) {
+            try {
+                task.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return xports;
+    }
+
     // Data used for heuristic to determine which link to use
     struct allocation_info
     {
-        size_t rx;
-        size_t tx;
+        size_t rx           = 0;
+        size_t tx           = 0;
+        double rx_byte_rate = 0.0;
+        double tx_byte_rate = 0.0;
     };
 
     // A map of allocations for each host transport adapter
     std::map<uhd::transport::adapter_id_t, allocation_info> _alloc_map;
 
+    // The rate of each link in bytes/sec, or 0 if unknown
+    std::map<device_id_t, double> _link_rates;
+
+    // The motherboard of every local device
+    std::map<device_id_t, mb_iface*> _link_mboards;
+
+    // A data stream which counts towards the allocations of an adapter
+    struct stream_allocation
+    {
+        uhd::transport::adapter_id_t adapter;
+        bool rx;
+        double byte_rate;
+    };
+
+    // The data streams of each streamer, so they can be released again
+    std::map<std::string, std::vector<stream_allocation>> _stream_allocs;
+
     //! Graph object for the available topology
     detail::topo_graph_t::sptr _tgraph;
 };
@@ -0,0 +1,340 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_fft.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/math.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <uhdlib/utils/worker_pool.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+#ifdef UHD_HOST_FFT_AVX2
+#    include <immintrin.h>
+#endif
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr char LOG_ID[] = "HOST_FFT";
+
+using fc32_t = std::complex<float>;
+
+//! Functions compiled for an instruction set extension, see convert_common.hpp
+#ifdef _MSC_VER
+#    define UHD_HOST_FFT_TARGET(isa)
+#else
+#    define UHD_HOST_FFT_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+//! The butterflies of a radix-2 stage, which combines DFTs of size h
+using stage_fn_t = void (*)(fc32_t*, const size_t, const size_t, const fc32_t*);
+
+void stage_generic(fc32_t* x, const size_t length, const size_t h, const fc32_t* w)
+{
+    for (size_t k = 0; k < length; k += 2 * h) {
+        fc32_t* a = x + k;
+        fc32_t* b = a + h;
+        for (size_t j = 0; j < h; j++) {
+            // Multiply by hand, std::complex checks for NaNs and infinities
+            const fc32_t t(b[j].real() * w[j].real() - b[j].imag() * w[j].imag(),
+                b[j].real() * w[j].imag() + b[j].imag() * w[j].real());
+            b[j] = a[j] - t;
+            a[j] = a[j] + t;
+        }
+    }
+}
+
+#ifdef UHD_HOST_FFT_AVX2
+//! Same as stage_generic(), 4 samples at a time. Requires h >= 4.
+UHD_HOST_FFT_TARGET("avx2")
+void stage_avx2(fc32_t* x, const size_t length, const size_t h, const fc32_t* w)
+{
+    const float* wf = reinterpret_cast<const float*>(w);
+    for (size_t k = 0; k < length; k += 2 * h) {
+        float* a = reinterpret_cast<float*>(x + k);
+        float* b = a + 2 * h;
+        for (size_t j = 0; j < 2 * h; j += 8) {
+            const __m256 wv = _mm256_loadu_ps(wf + j);
+            const __m256 bv = _mm256_loadu_ps(b + j);
+            // (br * wr - bi * wi, bi * wr + br * wi)
+            const __m256 t = _mm256_addsub_ps(_mm256_mul_ps(bv, _mm256_moveldup_ps(wv)),
+                _mm256_mul_ps(_mm256_permute_ps(bv, 0xB1), _mm256_movehdup_ps(wv)));
+            const __m256 av = _mm256_loadu_ps(a + j);
+            _mm256_storeu_ps(a + j, _mm256_add_ps(av, t));
+            _mm256_storeu_ps(b + j, _mm256_sub_ps(av, t));
+        }
+    }
+}
+#endif
+
+stage_fn_t get_wide_stage_fn()
+{
+#ifdef UHD_HOST_FFT_AVX2
+    if (uhd::cpu::has_avx2()) {
+        return &stage_avx2;
+    }
+#endif
+    return &stage_generic;
+}
+
+} // namespace
+
+class host_fft_impl : public host_fft
+{
+public:
+    host_fft_impl(const size_t length, const size_t num_threads)
+        : _wide_stage(get_wide_stage_fn())
+    {
+        set_length(length);
+        if (num_threads > 0) {
+            _pool.reset(new uhd::worker_pool(num_threads, {}, "uhd_host_fft"));
+            _job.fn = [this](const size_t frame) {
+                const size_t offset = frame * _length;
+                _process_frame(_job.input + offset, _job.output + offset);
+            };
+        }
+    }
+
+    void set_direction(const fft_direction direction) override
+    {
+        if (direction != fft_direction::FORWARD && direction != fft_direction::REVERSE) {
+            throw uhd::value_error("Host FFT: Invalid direction");
+        }
+        _direction = direction;
+        _make_plan();
+    }
+
+    fft_direction get_direction() const override
+    {
+        return _direction;
+    }
+
+    void set_magnitude(const fft_magnitude magnitude) override
+    {
+        if (magnitude != fft_magnitude::COMPLEX && magnitude != fft_magnitude::MAGNITUDE
+            && magnitude != fft_magnitude::MAGNITUDE_SQUARED) {
+            throw uhd::value_error("Host FFT: Invalid magnitude");
+        }
+        _magnitude = magnitude;
+    }
+
+    fft_magnitude get_magnitude() const override
+    {
+        return _magnitude;
+    }
+
+    void set_shift_config(const fft_shift shift) override
+    {
+        if (shift != fft_shift::NORMAL && shift != fft_shift::REVERSE
+            && shift != fft_shift::NATURAL) {
+            throw uhd::value_error("Host FFT: Invalid shift configuration");
+        }
+        _shift = shift;
+    }
+
+    fft_shift get_shift_config() const override
+    {
+        return _shift;
+    }
+
+    void set_scaling(const uint16_t scaling) override
+    {
+        if (scaling > (1 << 12) - 1) {
+            throw uhd::value_error("Host FFT: Scale value must be in [0, 4095]");
+        }
+        _scaling = scaling;
+        _update_scale();
+    }
+
+    uint16_t get_scaling() const override
+    {
+        return _scaling;
+    }
+
+    void set_length(const size_t length) override
+    {
+        if (length < MIN_LENGTH || length > MAX_LENGTH) {
+            throw uhd::value_error("Host FFT: Length must be in ["
+                                   + std::to_string(MIN_LENGTH) + ", "
+                                   + std::to_string(MAX_LENGTH) + "]");
+        }
+        size_t length_log2 = 0;
+        while ((length >> (length_log2 + 1)) != 0) {
+            length_log2++;
+        }
+        const size_t coerced_length = size_t(1) << length_log2;
+        if (coerced_length != length) {
+            UHD_LOG_WARNING(LOG_ID,
+                "Length " << length << " not an integral power of two; coercing to "
+                          << coerced_length);
+        }
+        _length      = coerced_length;
+        _length_log2 = length_log2;
+        _make_plan();
+        _update_scale();
+    }
+
+    size_t get_length() const override
+    {
+        return _length;
+    }
+
+    void process(const fc32_t* input, fc32_t* output, const size_t num_frames) override
+    {
+        if (_pool && num_frames > 1) {
+            _job.input  = input;
+            _job.output = output;
+            _pool->run(num_frames, _job.fn);
+            return;
+        }
+        for (size_t i = 0; i < num_frames; i++) {
+            _process_frame(input + i * _length, output + i * _length);
+        }
+    }
+
+private:
+    //! Compute the bit reversal table and the twiddle factors
+    void _make_plan()
+    {
+        _bit_reversed.resize(_length);
+        for (size_t i = 0; i < _length; i++) {
+            size_t reversed = 0;
+            for (size_t bit = 0; bit < _length_log2; bit++) {
+                reversed |= ((i >> bit) & 1) << (_length_log2 - 1 - bit);
+            }
+            _bit_reversed[i] = uint32_t(reversed);
+        }
+
+        // The twiddle factors of the stage which combines DFTs of size h start
+        // at index h - 1, so every stage reads them consecutively
+        const double sign = _direction == fft_direction::FORWARD ? -1.0 : 1.0;
+        _twiddles.resize(_length - 1);
+        for (size_t h = 1; h < _length; h *= 2) {
+            for (size_t j = 0; j < h; j++) {
+                const double phase = sign * uhd::math::PI * double(j) / double(h);
+                _twiddles[h - 1 + j] =
+                    fc32_t(float(std::cos(phase)), float(std::sin(phase)));
+            }
+        }
+    }
+
+    //! Compute the output scale from the scaling schedule
+    void _update_scale()
+    {
+        // The FFT IP uses radix 4 stages, the last one is radix 2 for odd
+        // powers of two
+        const size_t num_ip_stages = (_length_log2 + 1) / 2;
+        int shift                  = 0;
+        for (size_t stage = 0; stage < num_ip_stages; stage++) {
+            shift += (_scaling >> (2 * stage)) & 0x3;
+        }
+        _scale = std::ldexp(1.0f, -shift);
+    }
+
+    void _process_frame(const fc32_t* input, fc32_t* x) const
+    {
+        if (input == x) {
+            for (size_t i = 0; i < _length; i++) {
+                if (i < _bit_reversed[i]) {
+                    std::swap(x[i], x[_bit_reversed[i]]);
+                }
+            }
+        } else {
+            for (size_t i = 0; i < _length; i++) {
+                x[i] = input[_bit_reversed[i]];
+            }
+        }
+
+        // The first stage does not need any multiplications
+        for (size_t k = 0; k < _length; k += 2) {
+            const fc32_t a = x[k];
+            x[k]           = a + x[k + 1];
+            x[k + 1]       = a - x[k + 1];
+        }
+        for (size_t h = 2; h < _length; h *= 2) {
+            const fc32_t* w = _twiddles.data() + h - 1;
+            if (h >= 4) {
+                _wide_stage(x, _length, h, w);
+            } else {
+                stage_generic(x, _length, h, w);
+            }
+        }
+
+        _finish_frame(x);
+    }
+
+    //! Scale the bins, compute the magnitudes, and reorder the bins
+    void _finish_frame(fc32_t* x) const
+    {
+        const float scale = _scale;
+        switch (_magnitude) {
+            case fft_magnitude::COMPLEX:
+                for (size_t i = 0; i < _length; i++) {
+                    x[i] = fc32_t(x[i].real() * scale, x[i].imag() * scale);
+                }
+                break;
+            case fft_magnitude::MAGNITUDE:
+                for (size_t i = 0; i < _length; i++) {
+                    x[i] = fc32_t(std::hypot(x[i].real(), x[i].imag()) * scale, 0.0f);
+                }
+                break;
+            case fft_magnitude::MAGNITUDE_SQUARED:
+                for (size_t i = 0; i < _length; i++) {
+                    const float re = x[i].real() * scale;
+                    const float im = x[i].imag() * scale;
+                    x[i]           = fc32_t(re * re + im * im, 0.0f);
+                }
+                break;
+        }
+
+        // NORMAL puts the negative frequencies first, REVERSE reverses that
+        if (_shift != fft_shift::NATURAL) {
+            std::swap_ranges(x, x + _length / 2, x + _length / 2);
+            if (_shift == fft_shift::REVERSE) {
+                std::reverse(x, x + _length);
+            }
+        }
+    }
+
+    const stage_fn_t _wide_stage;
+
+    size_t _length           = 0;
+    size_t _length_log2      = 0;
+    fft_direction _direction = fft_direction::FORWARD;
+    fft_magnitude _magnitude = fft_magnitude::COMPLEX;
+    fft_shift _shift         = fft_shift::NORMAL;
+    uint16_t _scaling        = DEFAULT_SCALING;
+    float _scale             = 1.0f;
+
+    // The plan
+    std::vector<uint32_t> _bit_reversed;
+    std::vector<fc32_t> _twiddles;
+
+    // Arguments of the current multi-threaded process() call, and the function
+    // which transforms one frame of it
+    struct
+    {
+        const fc32_t* input = nullptr;
+        fc32_t* output      = nullptr;
+        std::function<void(size_t)> fn;
+    } _job;
+
+    // Worker threads, or null if all frames are transformed by the caller
+    uhd::worker_pool::uptr _pool;
+};
+
+constexpr size_t host_fft::MIN_LENGTH;
+constexpr size_t host_fft::MAX_LENGTH;
+constexpr uint16_t host_fft::DEFAULT_SCALING;
+
+host_fft::sptr host_fft::make(const size_t length, const size_t num_threads)
+{
+    return std::make_shared<host_fft_impl>(length, num_threads);
+}
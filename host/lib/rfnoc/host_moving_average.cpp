@@ -0,0 +1,203 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_moving_average.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#ifdef UHD_HOST_MOVING_AVERAGE_AVX2
+#    include <immintrin.h>
+#endif
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+//! Number of consecutive sums which are updated from the previous one. The
+// first sum of every chunk is computed from scratch.
+constexpr size_t CHUNK_SIZE = 256;
+
+//! Functions compiled for an instruction set extension, see convert_common.hpp
+#ifdef _MSC_VER
+#    define UHD_HOST_MOVING_AVERAGE_TARGET(isa)
+#else
+#    define UHD_HOST_MOVING_AVERAGE_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+/*! Compute the sums of num_sums consecutive windows of sum_len samples
+ *
+ * The window of output[i] is samps[i] to samps[i + sum_len - 1], i.e.,
+ * \p samps holds num_sums + sum_len - 1 samples. The sums are multiplied by
+ * \p scale.
+ */
+using window_sum_fn_t =
+    void (*)(const fc32_t*, const size_t, const size_t, const float, fc32_t*);
+
+void window_sum_generic(const fc32_t* samps,
+    const size_t sum_len,
+    const size_t num_sums,
+    const float scale,
+    fc32_t* output)
+{
+    float re = 0.0f, im = 0.0f;
+    for (size_t k = 0; k < sum_len; k++) {
+        re += samps[k].real();
+        im += samps[k].imag();
+    }
+    output[0] = fc32_t(re * scale, im * scale);
+    for (size_t i = 1; i < num_sums; i++) {
+        re += samps[i + sum_len - 1].real() - samps[i - 1].real();
+        im += samps[i + sum_len - 1].imag() - samps[i - 1].imag();
+        output[i] = fc32_t(re * scale, im * scale);
+    }
+}
+
+#ifdef UHD_HOST_MOVING_AVERAGE_AVX2
+//! Same as window_sum_generic(), but the differences between four consecutive
+// sums are added up in parallel (a prefix sum over the four samples of a
+// register), so there is only one dependent addition per four sums.
+UHD_HOST_MOVING_AVERAGE_TARGET("avx2")
+void window_sum_avx2(const fc32_t* samps,
+    const size_t sum_len,
+    const size_t num_sums,
+    const float scale,
+    fc32_t* output)
+{
+    float re = 0.0f, im = 0.0f;
+    for (size_t k = 0; k < sum_len; k++) {
+        re += samps[k].real();
+        im += samps[k].imag();
+    }
+    output[0] = fc32_t(re * scale, im * scale);
+
+    const float* in      = reinterpret_cast<const float*>(samps);
+    float* out           = reinterpret_cast<float*>(output);
+    const __m256 scale_v = _mm256_set1_ps(scale);
+    const __m256d zero   = _mm256_setzero_pd();
+    // The previous sum, in all four samples
+    __m256 sum = _mm256_setr_ps(re, im, re, im, re, im, re, im);
+    size_t i   = 1;
+    for (; i + 4 <= num_sums; i += 4) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(in + 2 * (i + sum_len - 1)),
+            _mm256_loadu_ps(in + 2 * (i - 1)));
+        // Every sample is 64 bits, so shift by one and then two samples
+        __m256d shifted = _mm256_blend_pd(
+            _mm256_permute4x64_pd(_mm256_castps_pd(diff), _MM_SHUFFLE(2, 1, 0, 0)),
+            zero,
+            0x1);
+        diff    = _mm256_add_ps(diff, _mm256_castpd_ps(shifted));
+        shifted = _mm256_blend_pd(
+            _mm256_permute4x64_pd(_mm256_castps_pd(diff), _MM_SHUFFLE(1, 0, 0, 0)),
+            zero,
+            0x3);
+        diff = _mm256_add_ps(diff, _mm256_castpd_ps(shifted));
+        sum  = _mm256_add_ps(sum, diff);
+        _mm256_storeu_ps(out + 2 * i, _mm256_mul_ps(sum, scale_v));
+        sum = _mm256_castpd_ps(
+            _mm256_permute4x64_pd(_mm256_castps_pd(sum), _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    const __m128 last = _mm256_castps256_ps128(sum);
+    re                = _mm_cvtss_f32(last);
+    im                = _mm_cvtss_f32(_mm_shuffle_ps(last, last, 1));
+    for (; i < num_sums; i++) {
+        re += samps[i + sum_len - 1].real() - samps[i - 1].real();
+        im += samps[i + sum_len - 1].imag() - samps[i - 1].imag();
+        output[i] = fc32_t(re * scale, im * scale);
+    }
+}
+#endif
+
+window_sum_fn_t get_window_sum_fn()
+{
+#ifdef UHD_HOST_MOVING_AVERAGE_AVX2
+    if (uhd::cpu::has_avx2()) {
+        return &window_sum_avx2;
+    }
+#endif
+    return &window_sum_generic;
+}
+
+} // namespace
+
+class host_moving_average_impl : public host_moving_average
+{
+public:
+    host_moving_average_impl(const uint8_t sum_len, const uint32_t divisor)
+        : _window_sum(get_window_sum_fn())
+        , _samps(std::numeric_limits<uint8_t>::max() - 1 + CHUNK_SIZE)
+    {
+        set_sum_len(sum_len);
+        set_divisor(divisor);
+    }
+
+    void set_sum_len(const uint8_t sum_len) override
+    {
+        if (sum_len < 1) {
+            throw uhd::value_error("Host moving average: Sum length must be in [1, 255]");
+        }
+        _sum_len = sum_len;
+        reset();
+    }
+
+    uint8_t get_sum_len() const override
+    {
+        return _sum_len;
+    }
+
+    void set_divisor(const uint32_t divisor) override
+    {
+        if (divisor < 1 || divisor > MAX_DIVISOR) {
+            throw uhd::value_error("Host moving average: Divisor must be in [1, 2^24-1]");
+        }
+        _divisor = divisor;
+    }
+
+    uint32_t get_divisor() const override
+    {
+        return _divisor;
+    }
+
+    void reset() override
+    {
+        std::fill(_samps.begin(), _samps.end(), fc32_t(0.0f, 0.0f));
+    }
+
+    void process(const fc32_t* input, fc32_t* output, const size_t num_samps) override
+    {
+        // The first sum_len - 1 samples of the buffer are the last ones of
+        // the previous chunk, the new ones go behind them
+        const size_t history = _sum_len - 1;
+        const float scale    = 1.0f / _divisor;
+        size_t done          = 0;
+        while (done < num_samps) {
+            const size_t n = std::min(CHUNK_SIZE, num_samps - done);
+            std::copy(input + done, input + done + n, _samps.begin() + history);
+            _window_sum(_samps.data(), _sum_len, n, scale, output + done);
+            std::copy(_samps.begin() + n, _samps.begin() + n + history, _samps.begin());
+            done += n;
+        }
+    }
+
+private:
+    const window_sum_fn_t _window_sum;
+    uint8_t _sum_len  = 0;
+    uint32_t _divisor = 0;
+
+    //! The history, followed by room for a chunk of input samples
+    std::vector<fc32_t> _samps;
+};
+
+constexpr uint32_t host_moving_average::MAX_DIVISOR;
+
+host_moving_average::sptr host_moving_average::make(
+    const uint8_t sum_len, const uint32_t divisor)
+{
+    return std::make_shared<host_moving_average_impl>(sum_len, divisor);
+}
@@ -0,0 +1,316 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_resampler.hpp>
+#include <uhd/utils/math.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#ifdef UHD_HOST_RESAMPLER_AVX2
+#    include <immintrin.h>
+#endif
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+//! Number of input samples which are buffered at once
+constexpr size_t CHUNK_SIZE = 256;
+
+//! Shape parameter of the Kaiser window, for about 80 dB of stopband attenuation
+constexpr double KAISER_BETA = 7.86;
+
+//! Share of the lower Nyquist frequency which the filter passes
+constexpr double CUTOFF = 0.9;
+
+//! Functions compiled for an instruction set extension, see convert_common.hpp
+#ifdef _MSC_VER
+#    define UHD_HOST_RESAMPLER_TARGET(isa)
+#else
+#    define UHD_HOST_RESAMPLER_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+/*! Compute the dot product of samples with one phase of the filter
+ *
+ * \p samps are interleaved I/Q floats, and every tap is stored twice, once
+ * for I and once for Q, so both are multiplied the same way. \p num_floats is
+ * a multiple of 8.
+ */
+using dot_fn_t = fc32_t (*)(const float*, const float*, const size_t);
+
+fc32_t dot_generic(const float* samps, const float* taps, const size_t num_floats)
+{
+    // Independent sums, which the compiler can keep in vector registers
+    float acc[8] = {};
+    for (size_t i = 0; i < num_floats; i += 8) {
+        for (size_t k = 0; k < 8; k++) {
+            acc[k] += samps[i + k] * taps[i + k];
+        }
+    }
+    return fc32_t(
+        acc[0] + acc[2] + acc[4] + acc[6], acc[1] + acc[3] + acc[5] + acc[7]);
+}
+
+#ifdef UHD_HOST_RESAMPLER_AVX2
+//! Same as dot_generic(), 8 floats (4 samples) at a time, with two sums to
+// hide the latency of the additions
+UHD_HOST_RESAMPLER_TARGET("avx2")
+fc32_t dot_avx2(const float* samps, const float* taps, const size_t num_floats)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i    = 0;
+    for (; i + 16 <= num_floats; i += 16) {
+        acc0 = _mm256_add_ps(acc0,
+            _mm256_mul_ps(_mm256_loadu_ps(samps + i), _mm256_loadu_ps(taps + i)));
+        acc1 = _mm256_add_ps(acc1,
+            _mm256_mul_ps(
+                _mm256_loadu_ps(samps + i + 8), _mm256_loadu_ps(taps + i + 8)));
+    }
+    if (i < num_floats) {
+        acc0 = _mm256_add_ps(acc0,
+            _mm256_mul_ps(_mm256_loadu_ps(samps + i), _mm256_loadu_ps(taps + i)));
+    }
+    // Add up the four samples of the register
+    const __m256 sum = _mm256_add_ps(acc0, acc1);
+    __m128 half =
+        _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    half           = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    const float re = _mm_cvtss_f32(half);
+    const float im = _mm_cvtss_f32(_mm_shuffle_ps(half, half, 1));
+    return fc32_t(re, im);
+}
+#endif
+
+dot_fn_t get_dot_fn()
+{
+#ifdef UHD_HOST_RESAMPLER_AVX2
+    if (uhd::cpu::has_avx2()) {
+        return &dot_avx2;
+    }
+#endif
+    return &dot_generic;
+}
+
+//! The modified Bessel function of the first kind of order zero
+double bessel_i0(const double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 50 && term > 1e-12 * sum; k++) {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+/*! Design the prototype filter, at the interpolated rate
+ *
+ * The filter has \p num_taps taps and is symmetric around tap num_taps / 2,
+ * so its first tap is zero. Its gain is \p interp, which makes up for the
+ * zeros of the interpolation.
+ */
+std::vector<double> design_filter(
+    const size_t num_taps, const size_t interp, const size_t decim)
+{
+    const double cutoff = CUTOFF * 0.5 / std::max(interp, decim);
+    const double center = num_taps / 2;
+    std::vector<double> taps(num_taps, 0.0);
+    double sum = 0.0;
+    for (size_t i = 1; i < num_taps; i++) {
+        const double t      = i - center;
+        const double x      = t / center;
+        const double window = bessel_i0(KAISER_BETA * std::sqrt(1.0 - x * x))
+                              / bessel_i0(KAISER_BETA);
+        const double sinc =
+            t == 0.0 ? 1.0 : std::sin(2 * M_PI * cutoff * t) / (2 * M_PI * cutoff * t);
+        taps[i] = window * sinc;
+        sum += taps[i];
+    }
+    for (auto& tap : taps) {
+        tap *= interp / sum;
+    }
+    return taps;
+}
+
+} // namespace
+
+class host_resampler_impl : public host_resampler
+{
+public:
+    host_resampler_impl(const size_t interp, const size_t decim, const size_t taps)
+        : _dot(get_dot_fn())
+    {
+        if (interp < 1 || interp > MAX_FACTOR || decim < 1 || decim > MAX_FACTOR) {
+            throw uhd::value_error("Host resampler: Interpolation and decimation must "
+                                   "be in [1, "
+                                   + std::to_string(MAX_FACTOR) + "]");
+        }
+        if (taps < 1 || taps > MAX_TAPS_PER_PHASE) {
+            throw uhd::value_error("Host resampler: Taps per phase must be in [1, "
+                                   + std::to_string(MAX_TAPS_PER_PHASE) + "]");
+        }
+        const size_t gcd = uhd::math::gcd<size_t>(interp, decim);
+        _interp          = interp / gcd;
+        _decim           = decim / gcd;
+        // When decimating, the filter spans taps samples of the output rate
+        const size_t num_taps =
+            (taps * std::max(_interp, _decim) + _interp - 1) / _interp;
+        _taps_per_phase = (num_taps + 3) / 4 * 4;
+        _center         = _taps_per_phase * _interp / 2;
+
+        // Phase p holds the taps p, p + interp, ... of the prototype, in
+        // reverse, so that it lines up with the input samples in time order
+        const auto prototype = design_filter(_taps_per_phase * _interp, _interp, _decim);
+        _phases.resize(_interp * 2 * _taps_per_phase);
+        for (size_t p = 0; p < _interp; p++) {
+            float* phase = &_phases[p * 2 * _taps_per_phase];
+            for (size_t m = 0; m < _taps_per_phase; m++) {
+                const float tap =
+                    float(prototype[p + (_taps_per_phase - 1 - m) * _interp]);
+                phase[2 * m]     = tap;
+                phase[2 * m + 1] = tap;
+            }
+        }
+        // Room for the history, a chunk, and the zeros of flush()
+        _samps.resize(2 * _taps_per_phase + CHUNK_SIZE);
+        reset();
+    }
+
+    size_t get_interp() const override
+    {
+        return _interp;
+    }
+
+    size_t get_decim() const override
+    {
+        return _decim;
+    }
+
+    size_t get_taps_per_phase() const override
+    {
+        return _taps_per_phase;
+    }
+
+    size_t get_max_num_outputs(const size_t num_samps) const override
+    {
+        return ((num_samps + _taps_per_phase) * _interp + _decim - 1) / _decim + 1;
+    }
+
+    void reset() override
+    {
+        // The samples before the first one are zeros
+        _num_buffered = _taps_per_phase - 1;
+        std::fill(_samps.begin(), _samps.begin() + _num_buffered, fc32_t(0.0f, 0.0f));
+        _first   = -static_cast<int64_t>(_num_buffered);
+        _num_in  = 0;
+        _num_out = 0;
+    }
+
+    size_t process(const fc32_t* input, const size_t num_samps, fc32_t* output) override
+    {
+        size_t num_out = 0;
+        size_t done    = 0;
+        while (done < num_samps) {
+            const size_t n = std::min(CHUNK_SIZE, num_samps - done);
+            std::copy(input + done, input + done + n, _samps.begin() + _num_buffered);
+            _num_buffered += n;
+            _num_in += n;
+            done += n;
+            num_out += _filter(output + num_out, std::numeric_limits<uint64_t>::max());
+        }
+        return num_out;
+    }
+
+    size_t flush(fc32_t* output) override
+    {
+        // The zeros after the stream cover the second half of the filter of
+        // the last output, which is the last one before the end of the stream
+        std::fill(_samps.begin() + _num_buffered,
+            _samps.begin() + _num_buffered + _taps_per_phase,
+            fc32_t(0.0f, 0.0f));
+        _num_buffered += _taps_per_phase;
+        const size_t num_out = _filter(output, (_num_in * _interp + _decim - 1) / _decim);
+        reset();
+        return num_out;
+    }
+
+private:
+    /*! Compute the outputs for which all input samples are buffered, up to
+     *  output \p max_out of the stream, and drop the samples which no later
+     *  output needs
+     *
+     * Output k is centered on sample k * decim / interp, i.e., at tap
+     * k * decim + _center of the interpolated input. The phase of the filter
+     * and the last input sample of the output follow from that.
+     */
+    size_t _filter(fc32_t* output, const uint64_t max_out)
+    {
+        const int64_t end   = _first + static_cast<int64_t>(_num_buffered);
+        const size_t floats = 2 * _taps_per_phase;
+        size_t num_out      = 0;
+        for (; _num_out < max_out; _num_out++) {
+            const uint64_t tap = _num_out * _decim + _center;
+            const int64_t last = static_cast<int64_t>(tap / _interp);
+            if (last >= end) {
+                break;
+            }
+            const int64_t start = last - static_cast<int64_t>(_taps_per_phase - 1);
+            const float* samps =
+                reinterpret_cast<const float*>(_samps.data() + (start - _first));
+            output[num_out++] =
+                _dot(samps, _phases.data() + (tap % _interp) * floats, floats);
+        }
+
+        const int64_t next_start =
+            static_cast<int64_t>((_num_out * _decim + _center) / _interp)
+            - static_cast<int64_t>(_taps_per_phase - 1);
+        const size_t num_drop = static_cast<size_t>(
+            std::min<int64_t>(std::max<int64_t>(next_start - _first, 0), _num_buffered));
+        std::copy(_samps.begin() + num_drop,
+            _samps.begin() + _num_buffered,
+            _samps.begin());
+        _num_buffered -= num_drop;
+        _first += num_drop;
+        return num_out;
+    }
+
+    const dot_fn_t _dot;
+    size_t _interp         = 1;
+    size_t _decim          = 1;
+    size_t _taps_per_phase = 0;
+    //! The tap of the prototype filter at the time of the output
+    size_t _center = 0;
+
+    //! The phases of the filter, each with two floats per tap
+    std::vector<float> _phases;
+
+    //! The buffered input samples, of which the first one has index _first in
+    // the stream
+    std::vector<fc32_t> _samps;
+    size_t _num_buffered = 0;
+    int64_t _first       = 0;
+    //! The number of input samples of the stream so far
+    uint64_t _num_in = 0;
+    //! The number of output samples of the stream so far
+    uint64_t _num_out = 0;
+};
+
+constexpr size_t host_resampler::DEFAULT_TAPS_PER_PHASE;
+constexpr size_t host_resampler::MAX_FACTOR;
+constexpr size_t host_resampler::MAX_TAPS_PER_PHASE;
+
+host_resampler::sptr host_resampler::make(
+    const size_t interp, const size_t decim, const size_t taps_per_phase)
+{
+    return std::make_shared<host_resampler_impl>(interp, decim, taps_per_phase);
+}
@@ -0,0 +1,192 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_vector_iir.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+#ifdef UHD_HOST_VECTOR_IIR_AVX2
+#    include <immintrin.h>
+#endif
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+//! Functions compiled for an instruction set extension, see convert_common.hpp
+#ifdef _MSC_VER
+#    define UHD_HOST_VECTOR_IIR_TARGET(isa)
+#else
+#    define UHD_HOST_VECTOR_IIR_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+/*! Filter n samples, which are all within one delay line
+ *
+ * \p history holds the outputs of one delay earlier, and receives the new
+ * ones. The samples are interleaved I/Q floats, and alpha and beta are real,
+ * so every float is filtered on its own.
+ */
+using filter_fn_t = void (*)(
+    const float*, float*, float*, const size_t, const float, const float);
+
+void filter_generic(const float* input,
+    float* output,
+    float* history,
+    const size_t n,
+    const float alpha,
+    const float beta)
+{
+    for (size_t i = 0; i < n; i++) {
+        const float y = beta * input[i] + alpha * history[i];
+        history[i]    = y;
+        output[i]     = y;
+    }
+}
+
+#ifdef UHD_HOST_VECTOR_IIR_AVX2
+//! Same as filter_generic(), 8 floats (4 samples) at a time
+UHD_HOST_VECTOR_IIR_TARGET("avx2")
+void filter_avx2(const float* input,
+    float* output,
+    float* history,
+    const size_t n,
+    const float alpha,
+    const float beta)
+{
+    const __m256 alpha_v = _mm256_set1_ps(alpha);
+    const __m256 beta_v  = _mm256_set1_ps(beta);
+    size_t i             = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256 y = _mm256_add_ps(_mm256_mul_ps(beta_v, _mm256_loadu_ps(input + i)),
+            _mm256_mul_ps(alpha_v, _mm256_loadu_ps(history + i)));
+        _mm256_storeu_ps(history + i, y);
+        _mm256_storeu_ps(output + i, y);
+    }
+    filter_generic(input + i, output + i, history + i, n - i, alpha, beta);
+}
+#endif
+
+filter_fn_t get_filter_fn()
+{
+#ifdef UHD_HOST_VECTOR_IIR_AVX2
+    if (uhd::cpu::has_avx2()) {
+        return &filter_avx2;
+    }
+#endif
+    return &filter_generic;
+}
+
+} // namespace
+
+class host_vector_iir_impl : public host_vector_iir
+{
+public:
+    host_vector_iir_impl(const uint16_t delay, const double alpha, const double beta)
+        : _filter(get_filter_fn())
+    {
+        set_delay(delay);
+        set_alpha(alpha);
+        set_beta(beta);
+    }
+
+    void set_alpha(const double alpha) override
+    {
+        if (alpha < 0.0 || alpha > 1.0) {
+            throw uhd::value_error("Host vector IIR: Alpha value must be in [0.0, 1.0]");
+        }
+        _alpha = alpha;
+    }
+
+    double get_alpha() const override
+    {
+        return _alpha;
+    }
+
+    void set_beta(const double beta) override
+    {
+        if (beta < 0.0 || beta > 1.0) {
+            throw uhd::value_error("Host vector IIR: Beta value must be in [0.0, 1.0]");
+        }
+        _beta = beta;
+    }
+
+    double get_beta() const override
+    {
+        return _beta;
+    }
+
+    void set_delay(const uint16_t delay) override
+    {
+        if (delay < MIN_DELAY) {
+            throw uhd::value_error("Host vector IIR: Delay value must be in ["
+                                   + std::to_string(MIN_DELAY) + ", "
+                                   + std::to_string(MAX_DELAY) + "]");
+        }
+        _delay = delay;
+        reset();
+    }
+
+    uint16_t get_delay() const override
+    {
+        return _delay;
+    }
+
+    uint16_t get_max_delay() const override
+    {
+        return MAX_DELAY;
+    }
+
+    void reset() override
+    {
+        _history.assign(_delay, fc32_t(0.0f, 0.0f));
+        _pos = 0;
+    }
+
+    void process(const fc32_t* input, fc32_t* output, const size_t num_samps) override
+    {
+        const float alpha = static_cast<float>(_alpha);
+        const float beta  = static_cast<float>(_beta);
+        size_t done       = 0;
+        while (done < num_samps) {
+            const size_t n = std::min<size_t>(_delay - _pos, num_samps - done);
+            _filter(reinterpret_cast<const float*>(input + done),
+                reinterpret_cast<float*>(output + done),
+                reinterpret_cast<float*>(_history.data() + _pos),
+                2 * n,
+                alpha,
+                beta);
+            done += n;
+            _pos += n;
+            if (_pos == _delay) {
+                _pos = 0;
+            }
+        }
+    }
+
+private:
+    const filter_fn_t _filter;
+    double _alpha   = 0.0;
+    double _beta    = 0.0;
+    uint16_t _delay = 0;
+
+    //! The outputs of the last delay line, and the position of the next sample
+    // in it
+    std::vector<fc32_t> _history;
+    size_t _pos = 0;
+};
+
+constexpr uint16_t host_vector_iir::MIN_DELAY;
+constexpr uint16_t host_vector_iir::MAX_DELAY;
+
+host_vector_iir::sptr host_vector_iir::make(
+    const uint16_t delay, const double alpha, const double beta)
+{
+    return std::make_shared<host_vector_iir_impl>(delay, alpha, beta);
+}
@@ -76,11 +76,13 @@ public:
         _my_adapter_id = _mb_iface.get_adapter_id(_my_device_id);
 
         // Create management portal using one of the child transports. This also
-        // runs the topology discovery.
+        // runs the topology discovery, unless an earlier session on the same
+        // link and FPGA image already did.
         _mgmt_portal = mgmt_portal::make(*_ctrl_xport,
             _pkt_factory,
             sep_addr_t(_my_device_id, SEP_INST_MGMT_CTRL),
-            _tgraph);
+            _tgraph,
+            _mb_iface.get_topology_key(_my_device_id));
     }
 
     void add_unreachable_transport_adapters() override
@@ -8,6 +8,7 @@
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/utils/time_estimator.hpp>
 #include <atomic>
 #include <chrono>
 #include <thread>
@@ -113,8 +114,9 @@ bool mb_controller::synchronize(std::vector<mb_controller::sptr>& mb_controllers
  * Timekeeper API
  *****************************************************************************/
 mb_controller::timekeeper::timekeeper()
+    : _time_estimator(
+        std::make_shared<uhd::time_estimator>([this]() { return get_ticks_now(); }))
 {
-    // nop
 }
 
 uhd::time_spec_t mb_controller::timekeeper::get_time_now()
@@ -122,6 +124,11 @@ uhd::time_spec_t mb_controller::timekeeper::get_time_now()
     return time_spec_t::from_ticks(get_ticks_now(), _tick_rate);
 }
 
+uhd::time_spec_t mb_controller::timekeeper::get_time_now_estimate()
+{
+    return time_spec_t::from_ticks(_time_estimator->get_ticks(_tick_rate), _tick_rate);
+}
+
 uhd::time_spec_t mb_controller::timekeeper::get_time_last_pps()
 {
     return time_spec_t::from_ticks(get_ticks_last_pps(), _tick_rate);
@@ -130,11 +137,14 @@ uhd::time_spec_t mb_controller::timekeeper::get_time_last_pps()
 void mb_controller::timekeeper::set_time_now(const uhd::time_spec_t& time)
 {
     set_ticks_now(time.to_ticks(_tick_rate));
+    _time_estimator->invalidate();
 }
 
 void mb_controller::timekeeper::set_time_next_pps(const uhd::time_spec_t& time)
 {
     set_ticks_next_pps(time.to_ticks(_tick_rate));
+    // The time changes on the next PPS edge, which is at most a second away
+    _time_estimator->invalidate(1.1);
 }
 
 void mb_controller::timekeeper::set_tick_rate(const double tick_rate)
@@ -143,6 +153,7 @@ void mb_controller::timekeeper::set_tick_rate(const double tick_rate)
         return;
     }
     _tick_rate = tick_rate;
+    _time_estimator->invalidate();
 
     // The period is the inverse of the tick rate, normalized by nanoseconds,
     // and represented as Q32 (e.g., period == 1ns means period_ns == 1<<32)
@@ -171,6 +182,15 @@ void mb_controller::register_timekeeper(const size_t idx, timekeeper::sptr tk)
     _timekeepers.emplace(idx, std::move(tk));
 }
 
+std::vector<uhd::sensor_value_t> mb_controller::get_all_sensors()
+{
+    std::vector<uhd::sensor_value_t> sensors;
+    for (const auto& name : get_sensor_names()) {
+        sensors.push_back(get_sensor(name));
+    }
+    return sensors;
+}
+
 std::vector<std::string> mb_controller::get_gpio_banks() const
 {
     return {};
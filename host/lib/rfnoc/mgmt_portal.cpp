@@ -7,6 +7,7 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/static.hpp>
 #include <uhdlib/rfnoc/chdr_ctrl_xport.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
@@ -78,6 +79,31 @@ constexpr uint32_t STRM_STATUS_FC_ENABLED    = 0x80000000;
 constexpr uint32_t STRM_STATUS_SETUP_ERR     = 0x40000000;
 constexpr uint32_t STRM_STATUS_SETUP_PENDING = 0x20000000;
 
+//! One node found during topology discovery, in the order they were found
+struct topo_cache_step_t
+{
+    //! Index of the step which found the node we went out from, or -1 if we
+    // went out from the local stream endpoint
+    int parent;
+    topo_edge_t::port_t parent_port;
+    //! The node that was found. Its device ID is not used, because device IDs
+    // are assigned anew in every session.
+    topo_node_t node;
+    topo_edge_t::port_t dst_port;
+    //! True if the node was new to the graph, and was therefore initialized
+    bool init;
+};
+
+//! Topologies found by earlier management portals in this process, by topology
+// key (see mb_iface::get_topology_key())
+struct topo_cache_t
+{
+    std::mutex mutex;
+    std::map<std::string, std::vector<topo_cache_step_t>> entries;
+};
+
+UHD_SINGLETON_FCN(topo_cache_t, get_topo_cache);
+
 } // namespace
 
 
@@ -93,7 +119,8 @@ public:
     mgmt_portal_impl(chdr_ctrl_xport& xport,
         const chdr::chdr_packet_factory& pkt_factory,
         sep_addr_t my_sep_addr,
-        topo_graph_t::sptr topo_graph)
+        topo_graph_t::sptr topo_graph,
+        const std::string& topology_key)
         : _protover(pkt_factory.get_protover())
         , _chdr_w(pkt_factory.get_chdr_w())
         , _endianness(pkt_factory.get_endianness())
@@ -112,7 +139,9 @@ public:
             UHD_LOG_ERROR(LOG_ID, err_msg);
             throw uhd::runtime_error(err_msg);
         }
-        _discover_topology(xport);
+        if (topology_key.empty() || !_discover_cached_topology(xport, topology_key)) {
+            _discover_topology(xport, topology_key);
+        }
         UHD_LOG_DEBUG(LOG_ID,
             "The following endpoints are reachable from " << _my_node_id.to_string());
         for (const auto& ep : get_reachable_endpoints()) {
@@ -179,7 +208,7 @@ public:
                 + std::to_string(addr.first) + ":" + std::to_string(addr.second));
         }
         // Add/update the EPID entry in the topo graph
-        _tgraph->access_node(topo_node_t(addr)).epid = epid;
+        _tgraph->set_epid(topo_node_t(addr), epid);
         UHD_LOG_DEBUG(LOG_ID,
             (boost::format("Bound stream endpoint with Addr=(%d,%d) to EPID=%d")
                 % addr.first % addr.second % epid));
@@ -465,13 +494,14 @@ public:
         auto dst_node = _get_sep_node(epid);
 
         // Wait for stream configuration to finish on the HW side
-        _validate_stream_setup(xport, dst_node, timeout, fc_enabled);
+        const stream_buff_params_t buff_params =
+            _validate_stream_setup(xport, dst_node, timeout, fc_enabled);
 
         UHD_LOG_DEBUG(LOG_ID,
             (boost::format("Finished RX stream setup for EPID=%d") % epid));
 
         // Return discovered buffer parameters
-        return std::get<1>(_get_ostrm_status(xport, dst_node));
+        return buff_params;
     }
 
     void config_local_tx_stream(chdr_ctrl_xport& xport,
@@ -593,14 +623,15 @@ public:
         }
 
         // Wait for stream configuration to finish on the HW side
-        _validate_stream_setup(xport, src_node, timeout, fc_enabled);
+        const stream_buff_params_t buff_params =
+            _validate_stream_setup(xport, src_node, timeout, fc_enabled);
 
         UHD_LOG_DEBUG(LOG_ID,
             (boost::format("Setup a stream from EPID=%d to EPID=%d") % src_epid
                 % dst_epid));
 
         // Return discovered buffer parameters
-        return std::get<1>(_get_ostrm_status(xport, src_node));
+        return buff_params;
     }
 
 
@@ -615,7 +646,10 @@ public:
 
 private: // Functions
     // Discover all nodes that are reachable from this software stream endpoint
-    void _discover_topology(chdr_ctrl_xport& xport)
+    //
+    // If \p topology_key is not empty, the result is stored in the topology
+    // cache under that key.
+    void _discover_topology(chdr_ctrl_xport& xport, const std::string& topology_key)
     {
         using port_t    = topo_edge_t::port_t;
         using node_type = topo_node_t::node_type;
@@ -630,6 +664,12 @@ private: // Functions
             "Starting topology discovery from " << _my_node_id.to_string());
         pending_paths.push({_my_node_id, port_t(-1)});
 
+        // Record what we find for the topology cache. Nodes are identified by
+        // the step which found them.
+        std::vector<topo_cache_step_t> steps;
+        std::map<topo_node_t, int> node_steps;
+        bool cacheable = true;
+
         while (!pending_paths.empty()) {
             // Pop the next path to discover from the pending queue
             const auto next_path = pending_paths.front();
@@ -698,6 +738,13 @@ private: // Functions
 
             topo_edge_t new_edge(next_node, new_node, next_path.second, dst_port);
 
+            const int parent_step =
+                next_node == _my_node_id ? -1 : node_steps.at(next_node);
+            // The cache can only replace the device ID of a single device
+            cacheable = cacheable
+                        && (steps.empty()
+                            || new_node.device_id == steps.front().node.device_id);
+
             // Because next_node was unknown before topo discovery started, we
             // can safely add a route from next_node to new_node. That doesn't
             // preclude that new_node was previously detected, so we check for that.
@@ -706,9 +753,13 @@ private: // Functions
             if (!_tgraph->add_biedge(next_node, new_node, new_edge)) {
                 UHD_LOG_DEBUG(LOG_ID,
                     "Re-discovered node " << new_node.to_string() << ". Skipping it");
+                steps.push_back(
+                    {parent_step, next_path.second, new_node, dst_port, false});
                 continue;
             }
             UHD_LOG_DEBUG(LOG_ID, "Discovered node " << new_node.to_string());
+            node_steps[new_node] = static_cast<int>(steps.size());
+            steps.push_back({parent_step, next_path.second, new_node, dst_port, true});
 
             // Initialize the node (first time config)
             mgmt_payload init_req_xact(route_xact);
@@ -760,6 +811,147 @@ private: // Functions
             }
             // That's it! Now go check the next path.
         }
+
+        if (!topology_key.empty() && cacheable && !steps.empty()) {
+            UHD_LOG_TRACE(LOG_ID, "Caching topology under key " << topology_key);
+            auto& cache = get_topo_cache();
+            std::lock_guard<std::mutex> l(cache.mutex);
+            cache.entries[topology_key] = std::move(steps);
+        }
+    }
+
+    //! Set up the topology from the cache instead of discovering it
+    //
+    // The cached discovery is replayed, including the initialization of every
+    // node, but without asking every node to identify itself, and without
+    // waiting for timeouts on unconnected crossbar ports. To make sure the
+    // cache entry still matches the hardware, the node attached to the local
+    // endpoint and the node found last are asked to identify themselves.
+    //
+    // \returns false if there was no cache entry, or it didn't match the
+    //          hardware. Then, the entry is removed, and the topology must be
+    //          discovered.
+    bool _discover_cached_topology(
+        chdr_ctrl_xport& xport, const std::string& topology_key)
+    {
+        std::vector<topo_cache_step_t> steps;
+        {
+            auto& cache = get_topo_cache();
+            std::lock_guard<std::mutex> l(cache.mutex);
+            auto entry = cache.entries.find(topology_key);
+            if (entry == cache.entries.end()) {
+                return false;
+            }
+            steps = entry->second;
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Replaying cached topology for " << _my_node_id.to_string() << " (key "
+                                             << topology_key << ")");
+
+        // Replay into a graph of our own, so that a stale cache entry leaves
+        // nothing behind in the shared graph
+        topo_graph_t::sptr tgraph = std::make_shared<topo_graph_t>();
+        tgraph->add_node(_my_node_id);
+        std::swap(_tgraph, tgraph);
+        std::vector<topo_node_t> nodes;
+        bool valid = false;
+        try {
+            valid = _replay_topology(xport, steps, nodes);
+        } catch (const uhd::exception& ex) {
+            UHD_LOG_DEBUG(LOG_ID, "Replaying cached topology failed: " << ex.what());
+        }
+        std::swap(_tgraph, tgraph);
+
+        if (!valid) {
+            UHD_LOG_DEBUG(LOG_ID, "Cached topology is stale, discovering it instead");
+            auto& cache = get_topo_cache();
+            std::lock_guard<std::mutex> l(cache.mutex);
+            cache.entries.erase(topology_key);
+            return false;
+        }
+        for (size_t i = 0; i < steps.size(); i++) {
+            const topo_cache_step_t& step = steps[i];
+            const topo_node_t& parent =
+                step.parent < 0 ? _my_node_id : nodes[step.parent];
+            _tgraph->add_biedge(parent,
+                nodes[i],
+                topo_edge_t(parent, nodes[i], step.parent_port, step.dst_port));
+        }
+        return true;
+    }
+
+    //! Replay cached discovery steps into _tgraph, and fill \p nodes with the
+    // node found by each step
+    //
+    // \returns false if a probed node doesn't match the cache
+    bool _replay_topology(chdr_ctrl_xport& xport,
+        const std::vector<topo_cache_step_t>& steps,
+        std::vector<topo_node_t>& nodes)
+    {
+        const auto my_epid = xport.get_epid();
+        // The attached node also tells us the device ID for this session
+        const topo_node_t attached =
+            _probe_node(xport, _my_node_id, steps.front().parent_port);
+        if (!_matches_step(attached, steps.front(), attached.device_id)) {
+            return false;
+        }
+
+        for (const auto& step : steps) {
+            const topo_node_t parent = step.parent < 0 ? _my_node_id : nodes[step.parent];
+            topo_node_t node         = step.node;
+            node.device_id           = attached.device_id;
+            nodes.push_back(node);
+            _tgraph->add_biedge(
+                parent, node, topo_edge_t(parent, node, step.parent_port, step.dst_port));
+            if (!step.init) {
+                continue;
+            }
+            mgmt_payload init_req_xact;
+            init_req_xact.set_header(my_epid, _protover, _chdr_w);
+            _traverse_to_node(init_req_xact, parent, my_epid, step.parent_port);
+            _push_node_init_hop(init_req_xact, node, my_epid, step.dst_port);
+            // Send the transaction and receive a response.
+            // We don't care about the contents of the response.
+            _send_recv_mgmt_transaction(xport, init_req_xact);
+        }
+
+        // The last node is the one farthest from us, if it's still there, so
+        // is everything in between
+        const topo_cache_step_t& last = steps.back();
+        const topo_node_t last_parent =
+            last.parent < 0 ? _my_node_id : nodes[last.parent];
+        return _matches_step(_probe_node(xport, last_parent, last.parent_port),
+            last,
+            attached.device_id);
+    }
+
+    //! Ask the node attached to \p port of \p node to identify itself
+    topo_node_t _probe_node(chdr_ctrl_xport& xport,
+        const topo_node_t& node,
+        const topo_edge_t::port_t port)
+    {
+        const auto my_epid = xport.get_epid();
+        mgmt_payload disc_req_xact;
+        disc_req_xact.set_header(my_epid, _protover, _chdr_w);
+        _traverse_to_node(disc_req_xact, node, my_epid, port);
+        mgmt_hop_t disc_hop;
+        disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
+        disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
+        disc_req_xact.add_hop(disc_hop);
+        return _pop_node_discovery_hop(_send_recv_mgmt_transaction(xport, disc_req_xact));
+    }
+
+    //! Check if a node that identified itself is the one a cached step found
+    bool _matches_step(const topo_node_t& node,
+        const topo_cache_step_t& step,
+        const device_id_t device_id) const
+    {
+        // Crossbars publish the port we're connected on in the 'inst' field
+        // (see _discover_topology())
+        const int inst = node.type == topo_node_t::node_type::XBAR ? step.dst_port
+                                                                   : step.node.inst;
+        return node.device_id == device_id && node.type == step.node.type
+               && node.inst == inst && node.extended_info == step.node.extended_info;
     }
 
     //! Add hops to the management transaction to reach the specified node
@@ -907,17 +1099,19 @@ private: // Functions
         return std::make_tuple(status_pl.data, buff_params);
     }
 
-    // Make sure that stream setup is complete and successful, else throw exception
-    void _validate_stream_setup(chdr_ctrl_xport& xport,
+    // Make sure that stream setup is complete and successful, else throw exception.
+    // Returns the buffer parameters which were read together with the final status.
+    stream_buff_params_t _validate_stream_setup(chdr_ctrl_xport& xport,
         const topo_node_t& dst_node,
         const double timeout,
         const bool fc_enabled)
     {
         // Get the status of the output stream
         uint32_t ostrm_status = 0;
-        double sleep_s        = 0.001;
+        stream_buff_params_t buff_params;
+        double sleep_s = 0.001;
         for (size_t i = 0; i < size_t(std::ceil(timeout / sleep_s)); i++) {
-            ostrm_status = std::get<0>(_get_ostrm_status(xport, dst_node));
+            std::tie(ostrm_status, buff_params) = _get_ostrm_status(xport, dst_node);
             if ((ostrm_status & STRM_STATUS_SETUP_PENDING) != 0) {
                 // Wait and retry
                 std::this_thread::sleep_for(
@@ -937,6 +1131,7 @@ private: // Functions
         if (fc_enabled != bool(ostrm_status & STRM_STATUS_FC_ENABLED)) {
             throw uhd::op_failed("config_stream: Flow control negotiation failed");
         }
+        return buff_params;
     }
 
 
@@ -1130,10 +1325,11 @@ private: // Members
 mgmt_portal::uptr mgmt_portal::make(chdr_ctrl_xport& xport,
     const chdr::chdr_packet_factory& pkt_factory,
     sep_addr_t my_sep_addr,
-    uhd::rfnoc::detail::topo_graph_t::sptr topo_graph)
+    uhd::rfnoc::detail::topo_graph_t::sptr topo_graph,
+    const std::string& topology_key)
 {
     return std::make_unique<mgmt_portal_impl>(
-        xport, pkt_factory, my_sep_addr, topo_graph);
+        xport, pkt_factory, my_sep_addr, topo_graph, topology_key);
 }
 
 }}} // namespace uhd::rfnoc::mgmt
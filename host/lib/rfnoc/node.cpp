@@ -118,18 +118,21 @@ void node_t::register_property(property_base_t* prop, resolve_callback_t&& clean
         _props[src_type] = {};
     }
 
+    // A property with the same ID is the only one which can collide
+    auto& props_with_id = _props_by_id[prop->get_id()];
     auto prop_already_registered = [prop](const property_base_t* existing_prop) {
         return (prop == existing_prop)
-               || (prop->get_src_info() == existing_prop->get_src_info()
-                      && prop->get_id() == existing_prop->get_id());
+               || (prop->get_src_info() == existing_prop->get_src_info());
     };
-    if (!filter_props(prop_already_registered).empty()) {
+    if (std::any_of(
+            props_with_id.cbegin(), props_with_id.cend(), prop_already_registered)) {
         throw uhd::runtime_error(std::string("Attempting to double-register property: ")
                                  + prop->get_id() + "[" + prop->get_src_info().to_string()
                                  + "]");
     }
 
     _props[src_type].push_back(prop);
+    props_with_id.push_back(prop);
     if (clean_callback) {
         _clean_cb_registry[prop] = std::move(clean_callback);
     }
@@ -162,6 +165,14 @@ void node_t::add_property_resolver(
     }
 
     // All good, we can store it
+    const size_t resolver_idx = _prop_resolvers.size();
+    for (const auto& prop : inputs) {
+        auto& resolver_idxs = _prop_resolvers_by_input[prop];
+        // A property which is listed twice still only runs the resolver once
+        if (resolver_idxs.empty() || resolver_idxs.back() != resolver_idx) {
+            resolver_idxs.push_back(resolver_idx);
+        }
+    }
     _prop_resolvers.push_back(std::make_tuple(std::forward<prop_ptrs_t>(inputs),
         std::forward<prop_ptrs_t>(outputs),
         std::forward<resolver_fn_t>(resolver_fn)));
@@ -224,14 +235,13 @@ bool node_t::check_topology(const std::vector<size_t>& connected_inputs,
 property_base_t* node_t::_find_property(
     res_source_info src_info, const std::string& id) const
 {
-    for (const auto& type_prop_pair : _props) {
-        if (type_prop_pair.first != src_info.type) {
-            continue;
-        }
-        for (const auto& prop : type_prop_pair.second) {
-            if (prop->get_id() == id && prop->get_src_info() == src_info) {
-                return prop;
-            }
+    auto props_it = _props_by_id.find(id);
+    if (props_it == _props_by_id.end()) {
+        return nullptr;
+    }
+    for (const auto& prop : props_it->second) {
+        if (prop->get_src_info() == src_info) {
+            return prop;
         }
     }
 
@@ -447,12 +457,14 @@ void node_t::resolve_props()
             continue;
         }
         // Find all resolvers that take this dirty property as an input:
-        for (auto& resolver_tuple : _prop_resolvers) {
-            auto& inputs  = std::get<0>(resolver_tuple);
-            auto& outputs = std::get<1>(resolver_tuple);
-            if (!uhd::has(inputs, current_input_prop)) {
-                continue;
-            }
+        auto resolver_idxs_it = _prop_resolvers_by_input.find(current_input_prop);
+        if (resolver_idxs_it == _prop_resolvers_by_input.end()) {
+            processed_props.insert(current_input_prop);
+            continue;
+        }
+        for (const size_t resolver_idx : resolver_idxs_it->second) {
+            auto& resolver_tuple = _prop_resolvers[resolver_idx];
+            auto& outputs        = std::get<1>(resolver_tuple);
 
             // Enable outputs
             std::vector<uhd::utils::scope_exit::uptr> access_holder;
@@ -494,8 +506,11 @@ void node_t::clean_props()
     prop_accessor_t prop_accessor{};
     for (const auto& type_prop_pair : _props) {
         for (const auto& prop : type_prop_pair.second) {
-            if (prop->is_valid() && prop->is_dirty() && _clean_cb_registry.count(prop)) {
-                _clean_cb_registry.at(prop)();
+            if (prop->is_valid() && prop->is_dirty()) {
+                auto clean_cb_it = _clean_cb_registry.find(prop);
+                if (clean_cb_it != _clean_cb_registry.end()) {
+                    clean_cb_it->second();
+                }
             }
             prop_accessor.mark_clean(*prop);
             prop_accessor.set_access(prop, property_base_t::RO);
@@ -12,7 +12,10 @@
 #include <uhd/utils/math.hpp>
 #include <uhdlib/rfnoc/radio_control_impl.hpp>
 #include <uhdlib/utils/compat_check.hpp>
+#include <algorithm>
+#include <chrono>
 #include <map>
+#include <thread>
 #include <tuple>
 
 using namespace uhd::rfnoc;
@@ -925,8 +928,97 @@ void radio_control_impl::issue_stream_cmd(
     // std::lock_guard<std::mutex> lock(_mutex);
     RFNOC_LOG_TRACE("radio_control_impl::issue_stream_cmd(chan="
                     << chan << ", mode=" << char(stream_cmd.stream_mode) << ")");
+    // Once the periodic stream command is removed, the task no longer writes
+    // any commands to this channel
+    std::lock_guard<std::mutex> l(_periodic_mutex);
+    _periodic_stream_cmds.erase(chan);
     _last_stream_cmd[chan] = stream_cmd;
+    _write_stream_cmd(stream_cmd, chan);
+}
+
+void radio_control_impl::issue_periodic_stream_cmd(const uhd::stream_cmd_t& stream_cmd,
+    const uhd::time_spec_t& period,
+    const size_t chan)
+{
+    RFNOC_LOG_TRACE("radio_control_impl::issue_periodic_stream_cmd(chan="
+                    << chan << ", period=" << period.get_real_secs() << ")");
+    if (stream_cmd.stream_mode != stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE
+        || stream_cmd.stream_now) {
+        throw uhd::value_error("Periodic stream commands must be timed "
+                               "STREAM_MODE_NUM_SAMPS_AND_DONE commands!");
+    }
+    if (chan >= get_num_output_ports()) {
+        throw uhd::value_error(
+            "Invalid channel for periodic stream command: " + std::to_string(chan));
+    }
+    const double window_length = double(stream_cmd.num_samps) / get_rate();
+    if (period.get_real_secs() < window_length) {
+        throw uhd::value_error("The period of a periodic stream command must not be "
+                               "shorter than a window of "
+                               + std::to_string(window_length) + " s!");
+    }
 
+    std::lock_guard<std::mutex> l(_periodic_mutex);
+    _last_stream_cmd[chan] = stream_cmd;
+    auto& periodic_cmd     = _periodic_stream_cmds[chan];
+    periodic_cmd.next_cmd  = stream_cmd;
+    periodic_cmd.period    = period;
+    // Queue the first windows right away, in case the start time is close
+    _fill_cmd_fifo(periodic_cmd, chan);
+    if (!_periodic_task) {
+        _periodic_task =
+            uhd::task::make([this]() { _periodic_stream_cmd_task(); }, "radio_cmd_fifo");
+    }
+}
+
+void radio_control_impl::_fill_cmd_fifo(
+    periodic_stream_cmd_t& periodic_cmd, const size_t chan)
+{
+    size_t space = _radio_reg_iface.peek32(regmap::REG_RX_STATUS, chan)
+                   & regmap::RX_STATUS_CMD_FIFO_SPACE_MASK;
+    if (space >= regmap::RX_CMD_FIFO_SIZE) {
+        // The FIFO ran empty, so the next window may be in the past. Skip
+        // those instead of getting a late command for each of them.
+        const uhd::time_spec_t now =
+            get_mb_controller()->get_timekeeper(0)->get_time_now();
+        if (periodic_cmd.next_cmd.time_spec < now) {
+            RFNOC_LOG_WARNING("Periodic stream command fell behind, skipping windows");
+            while (periodic_cmd.next_cmd.time_spec < now) {
+                periodic_cmd.next_cmd.time_spec += periodic_cmd.period;
+            }
+        }
+    }
+    for (; space > 0; space--) {
+        _write_stream_cmd(periodic_cmd.next_cmd, chan);
+        periodic_cmd.next_cmd.time_spec += periodic_cmd.period;
+    }
+}
+
+void radio_control_impl::_periodic_stream_cmd_task()
+{
+    // Don't sleep for longer than this, so destroying the task doesn't block
+    // for long
+    double sleep_time = 0.1;
+    {
+        std::lock_guard<std::mutex> l(_periodic_mutex);
+        for (auto& entry : _periodic_stream_cmds) {
+            try {
+                _fill_cmd_fifo(entry.second, entry.first);
+            } catch (const uhd::exception& ex) {
+                RFNOC_LOG_ERROR("Failed to queue periodic stream command: " << ex.what());
+            }
+            // Refill when half of the queued windows are done
+            const double half_fifo_time =
+                entry.second.period.get_real_secs() * (regmap::RX_CMD_FIFO_SIZE / 2);
+            sleep_time = std::min(sleep_time, half_fifo_time);
+        }
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(sleep_time));
+}
+
+void radio_control_impl::_write_stream_cmd(
+    const uhd::stream_cmd_t& stream_cmd, const size_t chan)
+{
     // calculate the command word
     const std::unordered_map<stream_cmd_t::stream_mode_t, uint32_t, std::hash<size_t>>
         stream_mode_to_cmd_word{
@@ -165,6 +165,7 @@ void export_radio_control(py::module& m)
         .def("get_tx_sensor_names", &radio_control::get_tx_sensor_names)
         .def("get_tx_sensor", &radio_control::get_tx_sensor)
         .def("issue_stream_cmd", &radio_control::issue_stream_cmd)
+        .def("issue_periodic_stream_cmd", &radio_control::issue_periodic_stream_cmd)
         .def("enable_rx_timestamps", &radio_control::enable_rx_timestamps)
         .def("get_slot_name", &radio_control::get_slot_name)
         .def("get_chan_from_dboard_fe", &radio_control::get_chan_from_dboard_fe)
@@ -6,6 +6,9 @@
 
 #include <uhd/rfnoc/register_iface_holder.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <mutex>
+#include <unordered_map>
 
 using namespace uhd::rfnoc;
 
@@ -40,12 +43,28 @@ public:
         UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
     }
 
+    void multi_poke32_acked(const std::vector<uint32_t>&,
+        const std::vector<uint32_t>&,
+        uhd::time_spec_t,
+        const size_t) override
+    {
+        UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
+    }
+
     uint32_t peek32(uint32_t, uhd::time_spec_t) override
     {
         UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
         return {};
     }
 
+    std::future<uint32_t> peek32_async(uint32_t, uhd::time_spec_t) override
+    {
+        UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
+        std::promise<uint32_t> value;
+        value.set_value({});
+        return value.get_future();
+    }
+
     std::vector<uint32_t> block_peek32(uint32_t, size_t, uhd::time_spec_t) override
     {
         UHD_LOG_ERROR("REGS", "Attempting to use invalidated register interface!");
@@ -91,11 +110,291 @@ public:
     }
 }; // class invalid_register_iface
 
+/*! Shadow layer for register_iface_holder::enable_write_coalescing()
+ *
+ * Keeps the last value written to each of the coalesced registers, and drops
+ * untimed, unacknowledged writes which don't change it. During a batch, the
+ * last such write is held back until another register is accessed. All other
+ * transactions are passed through, after sending the held back write, so the
+ * order of the transactions on the bus does not change.
+ */
+class register_iface_holder::write_coalescer : public register_iface
+{
+public:
+    write_coalescer(register_iface::sptr iface, const std::vector<uint32_t>& addrs)
+        : _iface(std::move(iface)), _addrs(addrs)
+    {
+        for (const uint32_t addr : addrs) {
+            _shadow.emplace(addr, shadow_t());
+        }
+    }
+
+    ~write_coalescer() override
+    {
+        UHD_SAFE_CALL(std::lock_guard<std::mutex> l(_mutex); _flush();)
+    }
+
+    register_iface::sptr get_iface() const
+    {
+        return _iface;
+    }
+
+    const std::vector<uint32_t>& get_addrs() const
+    {
+        return _addrs;
+    }
+
+    void begin_batch()
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _batch_depth++;
+    }
+
+    void end_batch()
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (--_batch_depth == 0) {
+            _flush();
+        }
+    }
+
+    void poke32(uint32_t addr, uint32_t data, uhd::time_spec_t time, bool ack) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = _shadow.find(addr);
+        if (it == _shadow.end() || time != uhd::time_spec_t::ASAP || ack) {
+            _flush();
+            _iface->poke32(addr, data, time, ack);
+            _track(addr, data, time);
+            return;
+        }
+        if (_batch_depth > 0) {
+            if (_pending && _pending_addr != addr) {
+                _flush();
+            }
+            _pending      = true;
+            _pending_addr = addr;
+            _pending_data = data;
+            return;
+        }
+        _write(addr, it->second, data);
+    }
+
+    bool try_poke32(
+        uint32_t addr, uint32_t data, uhd::time_spec_t time, bool ack) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _flush();
+        if (!_iface->try_poke32(addr, data, time, ack)) {
+            return false;
+        }
+        _track(addr, data, time);
+        return true;
+    }
+
+    size_t get_cmd_fifo_free_slots(const bool timed) const override
+    {
+        return _iface->get_cmd_fifo_free_slots(timed);
+    }
+
+    void multi_poke32(const std::vector<uint32_t> addrs,
+        const std::vector<uint32_t> data,
+        uhd::time_spec_t time,
+        bool ack) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _flush();
+        _iface->multi_poke32(addrs, data, time, ack);
+        for (size_t i = 0; i < addrs.size() && i < data.size(); i++) {
+            _track(addrs[i], data[i], time);
+        }
+    }
+
+    void block_poke32(uint32_t first_addr,
+        const std::vector<uint32_t> data,
+        uhd::time_spec_t time,
+        bool ack) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _flush();
+        _iface->block_poke32(first_addr, data, time, ack);
+        for (size_t i = 0; i < data.size(); i++) {
+            _track(first_addr + 4 * i, data[i], time);
+        }
+    }
+
+    void multi_poke32_acked(const std::vector<uint32_t>& addrs,
+        const std::vector<uint32_t>& data,
+        uhd::time_spec_t time,
+        const size_t max_outstanding) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _flush();
+        _iface->multi_poke32_acked(addrs, data, time, max_outstanding);
+        for (size_t i = 0; i < addrs.size() && i < data.size(); i++) {
+            _track(addrs[i], data[i], time);
+        }
+    }
+
+    uint32_t peek32(uint32_t addr, uhd::time_spec_t time) override
+    {
+        flush();
+        return _iface->peek32(addr, time);
+    }
+
+    std::future<uint32_t> peek32_async(uint32_t addr, uhd::time_spec_t time) override
+    {
+        flush();
+        return _iface->peek32_async(addr, time);
+    }
+
+    std::vector<uint32_t> block_peek32(
+        uint32_t first_addr, size_t length, uhd::time_spec_t time) override
+    {
+        flush();
+        return _iface->block_peek32(first_addr, length, time);
+    }
+
+    void poll32(uint32_t addr,
+        uint32_t data,
+        uint32_t mask,
+        uhd::time_spec_t timeout,
+        uhd::time_spec_t time,
+        bool ack) override
+    {
+        flush();
+        _iface->poll32(addr, data, mask, timeout, time, ack);
+    }
+
+    void sleep(uhd::time_spec_t duration, bool ack) override
+    {
+        flush();
+        _iface->sleep(duration, ack);
+    }
+
+    void register_async_msg_handler(async_msg_callback_t callback_f) override
+    {
+        _iface->register_async_msg_handler(callback_f);
+    }
+
+    void register_async_msg_validator(async_msg_validator_t callback_f) override
+    {
+        _iface->register_async_msg_validator(callback_f);
+    }
+
+    void set_policy(const std::string& name, const uhd::device_addr_t& args) override
+    {
+        _iface->set_policy(name, args);
+    }
+
+    uint16_t get_src_epid() const override
+    {
+        return _iface->get_src_epid();
+    }
+
+    uint16_t get_port_num() const override
+    {
+        return _iface->get_port_num();
+    }
+
+    std::map<std::string, transaction_stats_t> get_transaction_stats() const override
+    {
+        return _iface->get_transaction_stats();
+    }
+
+private:
+    struct shadow_t
+    {
+        bool valid     = false;
+        uint32_t value = 0;
+    };
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _flush();
+    }
+
+    //! Send the write which was held back, if any. Requires _mutex.
+    void _flush()
+    {
+        if (!_pending) {
+            return;
+        }
+        _pending = false;
+        _write(_pending_addr, _shadow.at(_pending_addr), _pending_data);
+    }
+
+    //! Write a coalesced register, unless it has that value. Requires _mutex.
+    void _write(const uint32_t addr, shadow_t& shadow, const uint32_t data)
+    {
+        if (shadow.valid && shadow.value == data) {
+            return;
+        }
+        _iface->poke32(addr, data, uhd::time_spec_t::ASAP, false);
+        shadow.valid = true;
+        shadow.value = data;
+    }
+
+    //! Update the shadow copy after a write that was passed through
+    void _track(const uint32_t addr, const uint32_t data, const uhd::time_spec_t time)
+    {
+        auto it = _shadow.find(addr);
+        if (it == _shadow.end()) {
+            return;
+        }
+        // A timed write changes the register later, so until then, the value
+        // of the register is unknown
+        it->second.valid = (time == uhd::time_spec_t::ASAP);
+        it->second.value = data;
+    }
+
+    const register_iface::sptr _iface;
+    const std::vector<uint32_t> _addrs;
+
+    std::mutex _mutex;
+    std::unordered_map<uint32_t, shadow_t> _shadow;
+    size_t _batch_depth    = 0;
+    bool _pending          = false;
+    uint32_t _pending_addr = 0;
+    uint32_t _pending_data = 0;
+}; // class register_iface_holder::write_coalescer
+
 void register_iface_holder::update_reg_iface(register_iface::sptr new_iface)
 {
     if (new_iface) {
-        _reg = new_iface;
+        if (_coalescer) {
+            _coalescer =
+                std::make_shared<write_coalescer>(new_iface, _coalescer->get_addrs());
+            _reg = _coalescer;
+        } else {
+            _reg = new_iface;
+        }
     } else {
+        _coalescer.reset();
         _reg = std::make_shared<invalid_register_iface>();
     }
 }
+
+void register_iface_holder::enable_write_coalescing(const std::vector<uint32_t>& addrs)
+{
+    // Don't stack shadow layers, replace the existing one
+    register_iface::sptr iface = _reg;
+    if (_coalescer) {
+        iface = _coalescer->get_iface();
+    }
+    _coalescer = std::make_shared<write_coalescer>(iface, addrs);
+    _reg       = _coalescer;
+}
+
+uhd::utils::scope_exit::uptr register_iface_holder::coalesce_writes()
+{
+    // The batch keeps the shadow layer alive, even if it is replaced
+    std::shared_ptr<write_coalescer> coalescer = _coalescer;
+    if (!coalescer) {
+        return uhd::utils::scope_exit::make([]() {});
+    }
+    coalescer->begin_batch();
+    return uhd::utils::scope_exit::make(
+        [coalescer]() { UHD_SAFE_CALL(coalescer->end_batch();) });
+}
@@ -11,7 +11,9 @@
 #include <uhd/rfnoc/registry.hpp>
 #include <uhd/utils/static.hpp>
 #include <uhdlib/rfnoc/factory.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <unordered_map>
+#include <unordered_set>
 #include <boost/functional/hash.hpp>
 #include <iomanip>
 #include <iostream>
@@ -42,6 +44,11 @@ using block_descriptor_reg_t =
 UHD_SINGLETON_FCN(block_descriptor_reg_t, get_descriptor_block_registry);
 ///////////////////////////////////////////////////////////////////////////////
 
+//! Blocks which may be constructed concurrently with other blocks
+using block_parallel_init_reg_t =
+    std::unordered_set<block_device_pair_t, boost::hash<block_device_pair_t>>;
+UHD_SINGLETON_FCN(block_parallel_init_reg_t, get_parallel_init_registry);
+
 /******************************************************************************
  * Registry functions
  *
@@ -89,6 +96,9 @@ void registry::register_block_descriptor(
  *****************************************************************************/
 block_factory_info_t factory::get_block_factory(noc_id_t noc_id, device_type_t device_id)
 {
+    // Modules can register block controllers
+    uhd::load_modules();
+
     // First, check the descriptor registry
     // FIXME TODO
 
@@ -104,5 +114,12 @@ block_factory_info_t factory::get_block_factory(noc_id_t noc_id, device_type_t d
                                                 << key.second << std::dec);
         key = block_device_pair_t(DEFAULT_NOC_ID, ANY_DEVICE);
     }
-    return get_direct_block_registry().at(key);
+    block_factory_info_t block_factory_info = get_direct_block_registry().at(key);
+    block_factory_info.parallel_init = get_parallel_init_registry().count(key) > 0;
+    return block_factory_info;
+}
+
+void factory::register_parallel_init(noc_id_t noc_id, device_type_t device_id)
+{
+    get_parallel_init_registry().insert({noc_id, device_id});
 }
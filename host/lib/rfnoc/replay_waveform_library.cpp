@@ -0,0 +1,251 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/replay_waveform_library.hpp>
+#include <uhd/utils/log.hpp>
+#include <boost/format.hpp>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr char LOG_ID[] = "REPLAY_LIB";
+
+} // namespace
+
+class replay_waveform_library_impl : public replay_waveform_library
+{
+public:
+    replay_waveform_library_impl(
+        const uint64_t mem_size, const uint64_t word_size, const uint64_t mem_offset)
+        : _mem_size(mem_size), _word_size(word_size), _mem_offset(mem_offset)
+    {
+        if (word_size == 0 || mem_offset % word_size != 0) {
+            throw uhd::value_error(
+                "Replay waveform library: Memory offset must be a multiple of the "
+                "word size");
+        }
+    }
+
+    waveform_t add(
+        const std::string& name, const uint64_t size, const bool pinned) override
+    {
+        // The callback may want to use the library, so we only call it once
+        // the lock is released. This includes the case where no room could be
+        // made after all.
+        std::vector<waveform_t> evicted;
+        evict_callback_t evict_callback;
+        waveform_t waveform;
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            evict_callback = _evict_callback;
+            try {
+                waveform = _add(name, size, pinned, evicted);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        if (evict_callback) {
+            for (const auto& evicted_waveform : evicted) {
+                evict_callback(evicted_waveform);
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return waveform;
+    }
+
+    waveform_t get(const std::string& name) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        entry_t& entry = _get_entry(name);
+        entry.last_use = ++_use_count;
+        return entry.waveform;
+    }
+
+    bool has_waveform(const std::string& name) const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _waveforms.count(name) > 0;
+    }
+
+    void remove(const std::string& name) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _offsets.erase(_get_entry(name).waveform.offset);
+        _waveforms.erase(name);
+    }
+
+    void set_pinned(const std::string& name, const bool pinned) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _get_entry(name).waveform.pinned = pinned;
+    }
+
+    std::vector<waveform_t> get_waveforms() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<waveform_t> waveforms;
+        for (const auto& offset_name : _offsets) {
+            waveforms.push_back(_waveforms.at(offset_name.second).waveform);
+        }
+        return waveforms;
+    }
+
+    uint64_t get_free_size() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        uint64_t free_size = 0;
+        _for_each_gap([&](const uint64_t, const uint64_t size) { free_size += size; });
+        return free_size;
+    }
+
+    uint64_t get_largest_free_size() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        uint64_t largest = 0;
+        _for_each_gap([&](const uint64_t, const uint64_t size) {
+            largest = std::max(largest, size);
+        });
+        return largest;
+    }
+
+    void set_evict_callback(evict_callback_t callback) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _evict_callback = std::move(callback);
+    }
+
+private:
+    struct entry_t
+    {
+        waveform_t waveform;
+        //! Size of the waveform, rounded up to whole memory words
+        uint64_t aligned_size;
+        //! Value of _use_count when the waveform was last used
+        uint64_t last_use;
+    };
+
+    //! Adds a waveform, and appends the waveforms it evicted to evicted
+    waveform_t _add(const std::string& name,
+        const uint64_t size,
+        const bool pinned,
+        std::vector<waveform_t>& evicted)
+    {
+        if (_waveforms.count(name)) {
+            throw uhd::key_error("Replay waveform already exists: " + name);
+        }
+        if (size == 0 || size > _mem_size) {
+            throw uhd::value_error(
+                str(boost::format("Invalid size for replay waveform %s: %d bytes")
+                    % name % size));
+        }
+        const uint64_t aligned_size = (size + _word_size - 1) / _word_size * _word_size;
+
+        uint64_t offset = 0;
+        while (!_find_best_fit(aligned_size, offset)) {
+            evicted.push_back(_evict_lru(name));
+        }
+        _waveforms[name] = {{name, offset, size, pinned}, aligned_size, ++_use_count};
+        _offsets[offset] = name;
+        return _waveforms[name].waveform;
+    }
+
+    entry_t& _get_entry(const std::string& name)
+    {
+        auto it = _waveforms.find(name);
+        if (it == _waveforms.end()) {
+            throw uhd::key_error("No such replay waveform: " + name);
+        }
+        return it->second;
+    }
+
+    //! Calls fn(offset, size) for every free region of memory
+    template <typename fn_t>
+    void _for_each_gap(fn_t fn) const
+    {
+        uint64_t gap_start = _mem_offset;
+        for (const auto& offset_name : _offsets) {
+            if (offset_name.first > gap_start) {
+                fn(gap_start, offset_name.first - gap_start);
+            }
+            gap_start =
+                offset_name.first + _waveforms.at(offset_name.second).aligned_size;
+        }
+        if (_mem_offset + _mem_size > gap_start) {
+            fn(gap_start, _mem_offset + _mem_size - gap_start);
+        }
+    }
+
+    //! Finds the smallest free region with room for size bytes
+    bool _find_best_fit(const uint64_t size, uint64_t& offset) const
+    {
+        uint64_t best_size = std::numeric_limits<uint64_t>::max();
+        _for_each_gap([&](const uint64_t gap_offset, const uint64_t gap_size) {
+            if (gap_size >= size && gap_size < best_size) {
+                best_size = gap_size;
+                offset    = gap_offset;
+            }
+        });
+        return best_size != std::numeric_limits<uint64_t>::max();
+    }
+
+    //! Evicts the least recently used waveform which is not pinned, and
+    // returns it
+    waveform_t _evict_lru(const std::string& new_name)
+    {
+        auto lru = _waveforms.end();
+        for (auto it = _waveforms.begin(); it != _waveforms.end(); ++it) {
+            if (it->second.waveform.pinned) {
+                continue;
+            }
+            if (lru == _waveforms.end() || it->second.last_use < lru->second.last_use) {
+                lru = it;
+            }
+        }
+        if (lru == _waveforms.end()) {
+            throw uhd::runtime_error("Not enough replay memory for waveform " + new_name);
+        }
+        const waveform_t waveform = lru->second.waveform;
+        UHD_LOG_DEBUG(LOG_ID,
+            "Evicting waveform " << waveform.name << " to make room for " << new_name);
+        _offsets.erase(waveform.offset);
+        _waveforms.erase(lru);
+        return waveform;
+    }
+
+    const uint64_t _mem_size;
+    const uint64_t _word_size;
+    const uint64_t _mem_offset;
+
+    mutable std::mutex _mutex;
+    std::map<std::string, entry_t> _waveforms;
+    //! Names of the waveforms by their memory offset
+    std::map<uint64_t, std::string> _offsets;
+    //! Incremented whenever a waveform is used
+    uint64_t _use_count = 0;
+    evict_callback_t _evict_callback;
+};
+
+replay_waveform_library::sptr replay_waveform_library::make(
+    const uint64_t mem_size, const uint64_t word_size, const uint64_t mem_offset)
+{
+    return std::make_shared<replay_waveform_library_impl>(
+        mem_size, word_size, mem_offset);
+}
+
+replay_waveform_library::sptr replay_waveform_library::make(
+    replay_block_control::sptr replay)
+{
+    return make(replay->get_mem_size(), replay->get_word_size());
+}
@@ -10,17 +10,23 @@
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhd/rfnoc/noc_block_make_args.hpp>
 #include <uhd/rfnoc/node.hpp>
+#include <uhd/rfnoc/radio_control.hpp>
 #include <uhd/rfnoc_graph.hpp>
 #include <uhdlib/rfnoc/block_container.hpp>
+#include <uhdlib/rfnoc/command_batch.hpp>
 #include <uhdlib/rfnoc/factory.hpp>
 #include <uhdlib/rfnoc/graph.hpp>
 #include <uhdlib/rfnoc/graph_stream_manager.hpp>
+#include <uhdlib/rfnoc/node_accessor.hpp>
 #include <uhdlib/rfnoc/rfnoc_device.hpp>
 #include <uhdlib/rfnoc/rfnoc_rx_streamer.hpp>
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <exception>
+#include <future>
 #include <memory>
+#include <set>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -59,6 +65,23 @@ struct route_info_t
     graph_edge_t dst_static_edge;
 };
 
+/*! Return the arguments of the data link of one port of a streamer
+ *
+ * The memory_budget stream argument covers the whole streamer, so every link
+ * gets its share of it as link_memory_budget.
+ */
+uhd::device_addr_t get_link_args(
+    const uhd::device_addr_t& stream_args, const size_t num_ports)
+{
+    uhd::device_addr_t link_args = stream_args;
+    if (stream_args.has_key("memory_budget")) {
+        const uint64_t budget = stream_args.cast<uint64_t>("memory_budget", 0);
+        link_args["link_memory_budget"] =
+            std::to_string(budget / std::max<size_t>(num_ports, 1));
+    }
+    return link_args;
+}
+
 } // namespace
 
 // Define an attorney to limit access to noc_block_base internals
@@ -279,59 +302,19 @@ public:
         size_t dst_port,
         uhd::transport::adapter_id_t adapter_id) override
     {
-        // Verify the streamer was created by us
-        auto rfnoc_streamer = std::dynamic_pointer_cast<rfnoc_tx_streamer>(streamer);
-        if (!rfnoc_streamer) {
-            throw uhd::type_error("Streamer is not rfnoc capable");
-        }
-
-        // Verify src_blk even exists in this graph
-        if (!has_block(dst_blk)) {
-            throw uhd::lookup_error(
-                std::string("Cannot connect block to streamer, source block not found: ")
-                + dst_blk.to_string());
-        }
+        _connect_tx_streamer(streamer, {{strm_port, dst_blk, dst_port}}, adapter_id);
+    }
 
-        // Verify src_blk has an SEP upstream
-        graph_edge_t dst_static_edge = _assert_edge(
-            _get_static_edge(
-                [dst_blk_id = dst_blk.to_string(), dst_port](const graph_edge_t& edge) {
-                    return edge.dst_blockid == dst_blk_id && edge.dst_port == dst_port;
-                }),
-            dst_blk.to_string());
-        if (block_id_t(dst_static_edge.src_blockid).get_block_name() != NODE_ID_SEP) {
-            const std::string err_msg =
-                dst_blk.to_string() + ":" + std::to_string(dst_port)
-                + " is not connected to an SEP! Routing impossible.";
-            UHD_LOG_ERROR(LOG_ID, err_msg);
-            throw uhd::routing_error(err_msg);
+    void connect(uhd::tx_streamer::sptr streamer,
+        const std::vector<std::pair<block_id_t, size_t>>& dst_ports,
+        uhd::transport::adapter_id_t adapter_id) override
+    {
+        std::vector<streamer_port_t> ports;
+        for (size_t strm_port = 0; strm_port < dst_ports.size(); ++strm_port) {
+            ports.push_back(
+                {strm_port, dst_ports[strm_port].first, dst_ports[strm_port].second});
         }
-
-        // Now get the name and address of the SEP
-        const std::string sep_block_id = dst_static_edge.src_blockid;
-        const sep_addr_t sep_addr      = _sep_map.at(sep_block_id);
-
-        const sw_buff_t pyld_fmt =
-            bits_to_sw_buff(rfnoc_streamer->get_otw_item_comp_bit_width());
-        const sw_buff_t mdata_fmt = BUFF_U64;
-
-        auto xport = _gsm->create_host_to_device_data_stream(sep_addr,
-            pyld_fmt,
-            mdata_fmt,
-            adapter_id,
-            rfnoc_streamer->get_stream_args().args,
-            rfnoc_streamer->get_unique_id());
-
-        rfnoc_streamer->connect_channel(strm_port, std::move(xport));
-
-        // If this worked, then also connect the streamer in the BGL graph
-        auto dst = get_block(dst_blk);
-        graph_edge_t edge_info(strm_port, dst_port, graph_edge_t::TX_STREAM, true);
-        _graph->connect(rfnoc_streamer.get(), dst.get(), edge_info);
-
-        _tx_streamers[rfnoc_streamer->get_unique_id()].node = rfnoc_streamer.get();
-        _tx_streamers[rfnoc_streamer->get_unique_id()].connections[strm_port] = {
-            rfnoc_streamer.get(), dst.get(), edge_info};
+        _connect_tx_streamer(streamer, ports, adapter_id);
     }
 
     void connect(const block_id_t& src_blk,
@@ -340,59 +323,19 @@ public:
         size_t strm_port,
         uhd::transport::adapter_id_t adapter_id) override
     {
-        // Verify the streamer was created by us
-        auto rfnoc_streamer = std::dynamic_pointer_cast<rfnoc_rx_streamer>(streamer);
-        if (!rfnoc_streamer) {
-            throw uhd::type_error("Streamer is not rfnoc capable");
-        }
-
-        // Verify src_blk even exists in this graph
-        if (!has_block(src_blk)) {
-            throw uhd::lookup_error(
-                std::string("Cannot connect block to streamer, source block not found: ")
-                + src_blk.to_string());
-        }
+        _connect_rx_streamer({{strm_port, src_blk, src_port}}, streamer, adapter_id);
+    }
 
-        // Verify src_blk has an SEP downstream
-        graph_edge_t src_static_edge = _assert_edge(
-            _get_static_edge(
-                [src_blk_id = src_blk.to_string(), src_port](const graph_edge_t& edge) {
-                    return edge.src_blockid == src_blk_id && edge.src_port == src_port;
-                }),
-            src_blk.to_string());
-        if (block_id_t(src_static_edge.dst_blockid).get_block_name() != NODE_ID_SEP) {
-            const std::string err_msg =
-                src_blk.to_string() + ":" + std::to_string(src_port)
-                + " is not connected to an SEP! Routing impossible.";
-            UHD_LOG_ERROR(LOG_ID, err_msg);
-            throw uhd::routing_error(err_msg);
+    void connect(const std::vector<std::pair<block_id_t, size_t>>& src_ports,
+        uhd::rx_streamer::sptr streamer,
+        uhd::transport::adapter_id_t adapter_id) override
+    {
+        std::vector<streamer_port_t> ports;
+        for (size_t strm_port = 0; strm_port < src_ports.size(); ++strm_port) {
+            ports.push_back(
+                {strm_port, src_ports[strm_port].first, src_ports[strm_port].second});
         }
-
-        // Now get the name and address of the SEP
-        const std::string sep_block_id = src_static_edge.dst_blockid;
-        const sep_addr_t sep_addr      = _sep_map.at(sep_block_id);
-
-        const sw_buff_t pyld_fmt =
-            bits_to_sw_buff(rfnoc_streamer->get_otw_item_comp_bit_width());
-        const sw_buff_t mdata_fmt = BUFF_U64;
-
-        auto xport = _gsm->create_device_to_host_data_stream(sep_addr,
-            pyld_fmt,
-            mdata_fmt,
-            adapter_id,
-            rfnoc_streamer->get_stream_args().args,
-            rfnoc_streamer->get_unique_id());
-
-        rfnoc_streamer->connect_channel(strm_port, std::move(xport));
-
-        // If this worked, then also connect the streamer in the BGL graph
-        auto src = get_block(src_blk);
-        graph_edge_t edge_info(src_port, strm_port, graph_edge_t::RX_STREAM, true);
-        _graph->connect(src.get(), rfnoc_streamer.get(), edge_info);
-
-        _rx_streamers[rfnoc_streamer->get_unique_id()].node = rfnoc_streamer.get();
-        _rx_streamers[rfnoc_streamer->get_unique_id()].connections[strm_port] = {
-            src.get(), rfnoc_streamer.get(), edge_info};
+        _connect_rx_streamer(ports, streamer, adapter_id);
     }
 
     void disconnect(const std::string& streamer_id) override
@@ -418,6 +361,10 @@ public:
             // Remove the streamer from the map
             _rx_streamers.erase(streamer_id);
         }
+        // The streamer's data streams no longer load their adapters
+        if (_gsm) {
+            _gsm->release_data_streams(streamer_id);
+        }
         UHD_LOG_TRACE(LOG_ID, std::string("Disconnected ") + streamer_id);
     }
 
@@ -493,6 +440,76 @@ public:
         return result;
     }
 
+    void begin_command_batch() override
+    {
+        detail::begin_command_batch();
+    }
+
+    void end_command_batch() override
+    {
+        detail::end_command_batch();
+    }
+
+    group_stream_cmd_report_t issue_group_stream_cmd(
+        const std::vector<std::pair<block_id_t, size_t>>& radio_ports,
+        const uhd::stream_cmd_t& stream_cmd,
+        const double lead_time) override
+    {
+        // Look up all radios before programming any of them
+        std::map<size_t, std::vector<std::pair<radio_control::sptr, size_t>>> mb_radios;
+        for (const auto& radio_port : radio_ports) {
+            auto radio = rfnoc_graph::get_block<radio_control>(radio_port.first);
+            mb_radios[radio_port.first.get_device_no()].emplace_back(
+                radio, radio_port.second);
+        }
+
+        group_stream_cmd_report_t report;
+        report.start_time =
+            get_mb_controller(0)->get_timekeeper(0)->get_time_now() + lead_time;
+        uhd::stream_cmd_t timed_cmd = stream_cmd;
+        timed_cmd.stream_now        = false;
+        timed_cmd.time_spec         = report.start_time;
+
+        // Every motherboard has its own control transports, so we can program
+        // them all at the same time
+        std::map<size_t, std::future<uhd::time_spec_t>> margins;
+        for (const auto& mb_radio : mb_radios) {
+            auto mb_controller = get_mb_controller(mb_radio.first);
+            const auto& radios = mb_radio.second;
+            margins[mb_radio.first] =
+                std::async(std::launch::async, [mb_controller, &radios, timed_cmd]() {
+                    for (const auto& radio_chan : radios) {
+                        radio_chan.first->issue_stream_cmd(timed_cmd, radio_chan.second);
+                    }
+                    return timed_cmd.time_spec
+                           - mb_controller->get_timekeeper(0)->get_time_now();
+                });
+        }
+        // Wait for all motherboards before reporting the first error
+        std::exception_ptr error;
+        for (auto& margin : margins) {
+            try {
+                report.margins[margin.first] = margin.second.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+                continue;
+            }
+            if (report.margins[margin.first] <= uhd::time_spec_t(0.0)) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "Group stream command was late on motherboard "
+                        << margin.first << " by "
+                        << -report.margins[margin.first].get_real_secs()
+                        << " s, consider a longer lead time");
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return report;
+    }
+
     uhd::property_tree::sptr get_tree(void) const override
     {
         return _tree;
@@ -585,6 +602,12 @@ public:
         _graph->release();
     }
 
+    void set_dynamic_reconfig(const bool enable) override
+    {
+        _dynamic_reconfig = enable;
+        _graph->set_dynamic_reconfig(enable);
+    }
+
 private:
     /**************************************************************************
      * Device Setup
@@ -699,6 +722,20 @@ private:
         // Make a map to count the number of each block we have
         std::unordered_map<std::string, uint16_t> block_count_map;
 
+        // Blocks which allow it are constructed in the background while the
+        // other blocks are constructed one after the other. This lets, e.g.,
+        // the radios initialize their daughterboards at the same time.
+        struct pending_block_t
+        {
+            block_id_t block_id;
+            size_t portno;
+            noc_id_t noc_id;
+            bool parallel_init;
+            std::future<noc_block_base::sptr> block;
+        };
+        std::vector<pending_block_t> pending_blocks;
+        pending_blocks.reserve(num_blocks);
+
         // Iterate through and register each of the blocks in this mboard
         for (size_t portno = 0; portno < num_blocks; ++portno) {
             const auto noc_id       = mb_cz->get_noc_id(portno + first_block_port);
@@ -745,19 +782,51 @@ private:
             _tree->create<uint32_t>(block_path / "noc_id").set(noc_id);
             make_args_uptr->tree = _tree->subtree(block_path);
             make_args_uptr->args = dev_addr; // TODO filter the device args
+            // Deferred blocks get constructed in order when we wait for them
+            const auto policy = block_factory_info.parallel_init ? std::launch::async
+                                                                 : std::launch::deferred;
+            pending_blocks.push_back({block_id,
+                portno,
+                noc_id,
+                block_factory_info.parallel_init,
+                std::async(policy,
+                    [factory_fn = block_factory_info.factory_fn,
+                        make_args = std::move(make_args_uptr)]() mutable {
+                        return factory_fn(std::move(make_args));
+                    })});
+        }
+
+        // Register the blocks in the order of their ports. We always wait for
+        // all blocks running in the background, even if another one failed.
+        std::exception_ptr init_error;
+        for (auto& pending : pending_blocks) {
+            if (init_error && !pending.parallel_init) {
+                continue;
+            }
+            const auto& block_id = pending.block_id;
             try {
-                _block_registry->register_block(
-                    block_factory_info.factory_fn(std::move(make_args_uptr)));
+                auto block = pending.block.get();
+                if (init_error) {
+                    continue;
+                }
+                _block_registry->register_block(std::move(block));
                 block_initializer::post_init(_block_registry->get_block(block_id));
             } catch (...) {
                 UHD_LOG_ERROR(
                     LOG_ID, "Error during initialization of block " << block_id << "!");
-                throw;
+                if (!init_error) {
+                    init_error = std::current_exception();
+                }
+                continue;
             }
             _xbar_block_config[block_id.to_string()] = {
-                portno, noc_id, block_id.get_block_count()};
+                pending.portno, pending.noc_id, block_id.get_block_count()};
 
-            _port_block_map.insert({{mb_idx, portno + first_block_port}, block_id});
+            _port_block_map.insert(
+                {{mb_idx, pending.portno + first_block_port}, block_id});
+        }
+        if (init_error) {
+            std::rethrow_exception(init_error);
         }
     }
 
@@ -813,6 +882,180 @@ private:
     /**************************************************************************
      * Helpers
      *************************************************************************/
+    //! A port of a streamer, and the block port it connects to
+    struct streamer_port_t
+    {
+        size_t strm_port;
+        block_id_t blk;
+        size_t blk_port;
+    };
+
+    /*! Connect a TX streamer to inputs of blocks
+     *
+     * The data streams of all ports are created at once, so the graph stream
+     * manager can set them up at the same time.
+     */
+    void _connect_tx_streamer(uhd::tx_streamer::sptr streamer,
+        const std::vector<streamer_port_t>& ports,
+        uhd::transport::adapter_id_t adapter_id)
+    {
+        // Verify the streamer was created by us
+        auto rfnoc_streamer = std::dynamic_pointer_cast<rfnoc_tx_streamer>(streamer);
+        if (!rfnoc_streamer) {
+            throw uhd::type_error("Streamer is not rfnoc capable");
+        }
+
+        const sw_buff_t pyld_fmt =
+            bits_to_sw_buff(rfnoc_streamer->get_otw_item_comp_bit_width());
+        const sw_buff_t mdata_fmt = BUFF_U64;
+
+        const auto link_args = get_link_args(rfnoc_streamer->get_stream_args().args,
+            rfnoc_streamer->get_num_output_ports());
+        std::vector<graph_stream_manager::data_stream_args_t> streams;
+        for (const auto& port : ports) {
+            const block_id_t& dst_blk = port.blk;
+            const size_t dst_port     = port.blk_port;
+            // Verify src_blk even exists in this graph
+            if (!has_block(dst_blk)) {
+                throw uhd::lookup_error(
+                    std::string(
+                        "Cannot connect block to streamer, source block not found: ")
+                    + dst_blk.to_string());
+            }
+
+            // Verify src_blk has an SEP upstream
+            graph_edge_t dst_static_edge = _assert_edge(
+                _get_static_edge([dst_blk_id = dst_blk.to_string(), dst_port](
+                                     const graph_edge_t& edge) {
+                    return edge.dst_blockid == dst_blk_id && edge.dst_port == dst_port;
+                }),
+                dst_blk.to_string());
+            if (block_id_t(dst_static_edge.src_blockid).get_block_name()
+                != NODE_ID_SEP) {
+                const std::string err_msg =
+                    dst_blk.to_string() + ":" + std::to_string(dst_port)
+                    + " is not connected to an SEP! Routing impossible.";
+                UHD_LOG_ERROR(LOG_ID, err_msg);
+                throw uhd::routing_error(err_msg);
+            }
+
+            // Now get the name and address of the SEP
+            const std::string sep_block_id = dst_static_edge.src_blockid;
+            const sep_addr_t sep_addr      = _sep_map.at(sep_block_id);
+
+            auto dst = get_block(dst_blk);
+            streams.push_back({sep_addr,
+                pyld_fmt,
+                mdata_fmt,
+                adapter_id,
+                link_args,
+                rfnoc_streamer->get_unique_id(),
+                _get_stream_byte_rate(dst.get(),
+                    {res_source_info::INPUT_EDGE, dst_port},
+                    rfnoc_streamer->get_otw_item_comp_bit_width())});
+        }
+
+        auto xports = _gsm->create_host_to_device_data_streams(streams);
+
+        for (size_t i = 0; i < ports.size(); ++i) {
+            const size_t strm_port = ports[i].strm_port;
+            const size_t dst_port  = ports[i].blk_port;
+            auto dst               = get_block(ports[i].blk);
+            rfnoc_streamer->connect_channel(strm_port, std::move(xports[i]));
+
+            // If this worked, then also connect the streamer in the BGL graph
+            graph_edge_t edge_info(strm_port, dst_port, graph_edge_t::TX_STREAM, true);
+            _graph->connect(rfnoc_streamer.get(), dst.get(), edge_info);
+
+            _tx_streamers[rfnoc_streamer->get_unique_id()].node = rfnoc_streamer.get();
+            _tx_streamers[rfnoc_streamer->get_unique_id()].connections[strm_port] = {
+                rfnoc_streamer.get(), dst.get(), edge_info};
+        }
+    }
+
+    /*! Connect outputs of blocks to an RX streamer
+     *
+     * The data streams of all ports are created at once, so the graph stream
+     * manager can set them up at the same time.
+     */
+    void _connect_rx_streamer(const std::vector<streamer_port_t>& ports,
+        uhd::rx_streamer::sptr streamer,
+        uhd::transport::adapter_id_t adapter_id)
+    {
+        // Verify the streamer was created by us
+        auto rfnoc_streamer = std::dynamic_pointer_cast<rfnoc_rx_streamer>(streamer);
+        if (!rfnoc_streamer) {
+            throw uhd::type_error("Streamer is not rfnoc capable");
+        }
+
+        const sw_buff_t pyld_fmt =
+            bits_to_sw_buff(rfnoc_streamer->get_otw_item_comp_bit_width());
+        const sw_buff_t mdata_fmt = BUFF_U64;
+
+        const auto link_args = get_link_args(rfnoc_streamer->get_stream_args().args,
+            rfnoc_streamer->get_num_input_ports());
+        std::vector<graph_stream_manager::data_stream_args_t> streams;
+        for (const auto& port : ports) {
+            const block_id_t& src_blk = port.blk;
+            const size_t src_port     = port.blk_port;
+            // Verify src_blk even exists in this graph
+            if (!has_block(src_blk)) {
+                throw uhd::lookup_error(
+                    std::string(
+                        "Cannot connect block to streamer, source block not found: ")
+                    + src_blk.to_string());
+            }
+
+            // Verify src_blk has an SEP downstream
+            graph_edge_t src_static_edge = _assert_edge(
+                _get_static_edge([src_blk_id = src_blk.to_string(), src_port](
+                                     const graph_edge_t& edge) {
+                    return edge.src_blockid == src_blk_id && edge.src_port == src_port;
+                }),
+                src_blk.to_string());
+            if (block_id_t(src_static_edge.dst_blockid).get_block_name()
+                != NODE_ID_SEP) {
+                const std::string err_msg =
+                    src_blk.to_string() + ":" + std::to_string(src_port)
+                    + " is not connected to an SEP! Routing impossible.";
+                UHD_LOG_ERROR(LOG_ID, err_msg);
+                throw uhd::routing_error(err_msg);
+            }
+
+            // Now get the name and address of the SEP
+            const std::string sep_block_id = src_static_edge.dst_blockid;
+            const sep_addr_t sep_addr      = _sep_map.at(sep_block_id);
+
+            auto src = get_block(src_blk);
+            streams.push_back({sep_addr,
+                pyld_fmt,
+                mdata_fmt,
+                adapter_id,
+                link_args,
+                rfnoc_streamer->get_unique_id(),
+                _get_stream_byte_rate(src.get(),
+                    {res_source_info::OUTPUT_EDGE, src_port},
+                    rfnoc_streamer->get_otw_item_comp_bit_width())});
+        }
+
+        auto xports = _gsm->create_device_to_host_data_streams(streams);
+
+        for (size_t i = 0; i < ports.size(); ++i) {
+            const size_t strm_port = ports[i].strm_port;
+            const size_t src_port  = ports[i].blk_port;
+            auto src               = get_block(ports[i].blk);
+            rfnoc_streamer->connect_channel(strm_port, std::move(xports[i]));
+
+            // If this worked, then also connect the streamer in the BGL graph
+            graph_edge_t edge_info(src_port, strm_port, graph_edge_t::RX_STREAM, true);
+            _graph->connect(src.get(), rfnoc_streamer.get(), edge_info);
+
+            _rx_streamers[rfnoc_streamer->get_unique_id()].node = rfnoc_streamer.get();
+            _rx_streamers[rfnoc_streamer->get_unique_id()].connections[strm_port] = {
+                src.get(), rfnoc_streamer.get(), edge_info};
+        }
+    }
+
     /*! Internal connection helper
      *
      * Make the connections in the _graph, and set up property propagation
@@ -898,6 +1141,36 @@ private:
         return {edge_type, src_static_edge, dst_static_edge};
     }
 
+    /*! Return the expected data rate of a streamer connection
+     *
+     * This is the sample rate of the block's edge property at \p src_info,
+     * times the size of an over-the-wire sample.
+     *
+     * \param blk The block on the device side of the connection
+     * \param src_info The edge of \p blk that is connected to the streamer
+     * \param otw_item_comp_bit_width The bit width of an I or Q component
+     * \return The rate in bytes per second, or 0 if the sample rate is not
+     *         known yet
+     */
+    double _get_stream_byte_rate(node_t* blk,
+        const res_source_info& src_info,
+        const size_t otw_item_comp_bit_width)
+    {
+        node_accessor_t node_accessor{};
+        auto rate_props =
+            node_accessor.filter_props(blk, [&src_info](property_base_t* prop) {
+                return prop->get_id() == PROP_KEY_SAMP_RATE
+                       && prop->get_src_info() == src_info;
+            });
+        for (auto prop : rate_props) {
+            auto rate_prop = dynamic_cast<property_t<double>*>(prop);
+            if (rate_prop && rate_prop->is_valid()) {
+                return rate_prop->get() * (2 * otw_item_comp_bit_width / 8);
+            }
+        }
+        return 0.0;
+    }
+
     /*! Internal physical connection helper
      *
      * Make the connections in the physical device
@@ -918,6 +1191,15 @@ private:
             const std::string dst_sep_info = route_info.dst_static_edge.src_blockid;
             const sep_addr_t dst_sep_addr  = _sep_map.at(dst_sep_info);
 
+            // Disconnecting leaves the data stream in place
+            const auto strm_key = std::make_pair(src_sep_addr, dst_sep_addr);
+            if (_dynamic_reconfig && _established_streams.count(strm_key)) {
+                UHD_LOG_TRACE(LOG_ID,
+                    "Reusing data stream from " << src_sep_info << " to "
+                                                << dst_sep_info);
+                return route_info.edge_type;
+            }
+
             auto strm_info = _gsm->create_device_to_device_data_stream(
                 dst_sep_addr, src_sep_addr, false, 0.1, 0.0, false);
 
@@ -927,6 +1209,7 @@ private:
                        "where downstream buffer can hold %lu bytes and %u packets")
                        % std::get<0>(strm_info).first % std::get<0>(strm_info).second
                        % std::get<1>(strm_info).bytes % std::get<1>(strm_info).packets;
+            _established_streams.insert(strm_key);
         }
 
         return route_info.edge_type;
@@ -1061,6 +1344,12 @@ private:
 
     //! Map from RX streamer ID to streamer info
     std::map<std::string, streamer_info_t> _rx_streamers;
+
+    //! See set_dynamic_reconfig()
+    bool _dynamic_reconfig = false;
+
+    //! Pairs of (source, destination) SEPs with a data stream between them
+    std::set<std::pair<sep_addr_t, sep_addr_t>> _established_streams;
 }; /* class rfnoc_graph_impl */
 
 
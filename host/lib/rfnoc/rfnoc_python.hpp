@@ -21,6 +21,7 @@
 #include <uhd/transport/adapter_id.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/utils/graph_utils.hpp>
+#include <pybind11/functional.h>
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 #include <memory>
@@ -163,6 +164,11 @@ void export_rfnoc(py::module& m)
         // Operators
         .def(py::self == py::self);
 
+    py::class_<rfnoc_graph::group_stream_cmd_report_t>(m, "group_stream_cmd_report")
+        .def(py::init<>())
+        .def_readwrite("start_time", &rfnoc_graph::group_stream_cmd_report_t::start_time)
+        .def_readwrite("margins", &rfnoc_graph::group_stream_cmd_report_t::margins);
+
     py::class_<rfnoc_graph, rfnoc_graph::sptr>(m, "rfnoc_graph")
         .def(py::init(&rfnoc_graph::make))
 
@@ -224,12 +230,20 @@ void export_rfnoc(py::module& m)
         .def("enumerate_active_connections", &rfnoc_graph::enumerate_active_connections)
         .def("commit", &rfnoc_graph::commit)
         .def("release", &rfnoc_graph::release)
+        .def("set_dynamic_reconfig", &rfnoc_graph::set_dynamic_reconfig)
         .def("create_rx_streamer", &rfnoc_graph::create_rx_streamer)
         .def("create_tx_streamer", &rfnoc_graph::create_tx_streamer)
         .def("get_num_mboards", &rfnoc_graph::get_num_mboards)
         .def(
             "get_mb_controller", &rfnoc_graph::get_mb_controller, py::arg("mb_index") = 0)
         .def("synchronize_devices", &rfnoc_graph::synchronize_devices)
+        .def("begin_command_batch", &rfnoc_graph::begin_command_batch)
+        .def("end_command_batch", &rfnoc_graph::end_command_batch)
+        .def("issue_group_stream_cmd",
+            &rfnoc_graph::issue_group_stream_cmd,
+            py::arg("radio_ports"),
+            py::arg("stream_cmd"),
+            py::arg("lead_time"))
         .def("get_tree", &rfnoc_graph::get_tree);
 
     py::class_<uhd::features::gpio_power_iface>(m, "gpio_power")
@@ -269,6 +283,7 @@ void export_rfnoc(py::module& m)
         .def("set_time_source_out", &mb_controller::set_time_source_out)
         .def("get_sensor", &mb_controller::get_sensor)
         .def("get_sensor_names", &mb_controller::get_sensor_names)
+        .def("get_all_sensors", &mb_controller::get_all_sensors)
         .def("get_eeprom", &mb_controller::get_eeprom)
         .def("synchronize", &mb_controller::synchronize)
         .def("get_gpio_banks", &mb_controller::get_gpio_banks)
@@ -281,6 +296,7 @@ void export_rfnoc(py::module& m)
         // Methods
         // FIXME? .def(py::init<>())
         .def("get_time_now", &timekeeper::get_time_now)
+        .def("get_time_now_estimate", &timekeeper::get_time_now_estimate)
         .def("get_ticks_now", &timekeeper::get_ticks_now)
         .def("get_time_last_pps", &timekeeper::get_time_last_pps)
         .def("get_ticks_last_pps", &timekeeper::get_ticks_last_pps)
@@ -359,6 +375,19 @@ void export_rfnoc(py::module& m)
             py::arg("data"),
             py::arg("time"),
             py::arg("ack") = false)
+        .def(
+            "multi_poke32_acked",
+            [](noc_block_base& self,
+                std::vector<uint32_t> addr,
+                std::vector<uint32_t> data,
+                uhd::time_spec_t time  = uhd::time_spec_t::ASAP,
+                size_t max_outstanding = 16) {
+                self.regs().multi_poke32_acked(addr, data, time, max_outstanding);
+            },
+            py::arg("addr"),
+            py::arg("data"),
+            py::arg("time")            = uhd::time_spec_t::ASAP,
+            py::arg("max_outstanding") = 16)
         .def(
             "block_poke32",
             [](noc_block_base& self, uint32_t first_addr, std::vector<uint32_t> data) {
@@ -537,6 +566,28 @@ void export_rfnoc(py::module& m)
         py::arg("dst_blk"),
         py::arg("dst_port"),
         py::arg("skip_property_propagation") = false);
+    m.def("replay_load_file",
+        &uhd::rfnoc::replay_load_file,
+        py::call_guard<py::gil_scoped_release>(),
+        py::arg("graph"),
+        py::arg("replay"),
+        py::arg("filename"),
+        py::arg("mem_offset") = 0,
+        py::arg("ports")      = std::vector<size_t>{0},
+        py::arg("verify")     = false,
+        py::arg("format")     = uhd::rfnoc::IO_TYPE_SC16);
+    m.def("replay_capture_to_file",
+        &uhd::rfnoc::replay_capture_to_file,
+        py::call_guard<py::gil_scoped_release>(),
+        py::arg("graph"),
+        py::arg("replay"),
+        py::arg("filename"),
+        py::arg("num_bytes"),
+        py::arg("start_source"),
+        py::arg("port")       = 0,
+        py::arg("mem_offset") = 0,
+        py::arg("mem_size")   = 0,
+        py::arg("format")     = uhd::rfnoc::IO_TYPE_SC16);
 }
 
 #endif /* INCLUDED_UHD_RFNOC_PYTHON_HPP */
@@ -4,11 +4,16 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/config.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <uhdlib/rfnoc/node_accessor.hpp>
 #include <uhdlib/rfnoc/rfnoc_rx_streamer.hpp>
 #include <atomic>
 #include <thread>
+#ifdef UHD_PLATFORM_LINUX
+#    include <sys/epoll.h>
+#    include <unistd.h>
+#endif
 
 using namespace std::chrono_literals;
 ;
@@ -100,6 +105,11 @@ rfnoc_rx_streamer::~rfnoc_rx_streamer()
     if (_disconnect_cb) {
         _disconnect_cb(_unique_id);
     }
+#ifdef UHD_PLATFORM_LINUX
+    if (_recv_fd_owned) {
+        ::close(_recv_fd);
+    }
+#endif
 }
 
 std::string rfnoc_rx_streamer::get_unique_id() const
@@ -152,6 +162,66 @@ bool rfnoc_rx_streamer::check_topology(const std::vector<size_t>& connected_inpu
     return node_t::check_topology(connected_inputs, connected_outputs);
 }
 
+stream_telemetry_t rfnoc_rx_streamer::get_telemetry() const
+{
+    stream_telemetry_t telemetry = rx_streamer_impl::get_telemetry();
+    get_fc_telemetry(telemetry);
+    return telemetry;
+}
+
+stream_memory_t rfnoc_rx_streamer::get_memory_footprint() const
+{
+    stream_memory_t memory;
+    get_streamer_memory(memory);
+    return memory;
+}
+
+int rfnoc_rx_streamer::get_recv_fd()
+{
+    std::lock_guard<std::mutex> lock(_recv_fd_mutex);
+    if (_recv_fd >= 0) {
+        return _recv_fd;
+    }
+
+    std::vector<int> fds;
+    for (size_t chan = 0; chan < get_num_channels(); chan++) {
+        const int fd = get_xport_ready_fd(chan);
+        if (fd < 0) {
+            throw uhd::not_implemented_error(
+                "[rx_stream] get_recv_fd() requires a connected streamer which "
+                "receives on an offload I/O service (recv_offload=1)");
+        }
+        fds.push_back(fd);
+    }
+    if (fds.size() == 1) {
+        _recv_fd = fds.front();
+        return _recv_fd;
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    // An epoll instance is readable while any of its descriptors is
+    const int epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        throw uhd::os_error("[rx_stream] Failed to create an epoll instance");
+    }
+    for (const int fd : fds) {
+        epoll_event event{};
+        event.events  = EPOLLIN;
+        event.data.fd = fd;
+        if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            ::close(epoll_fd);
+            throw uhd::os_error("[rx_stream] Failed to add a descriptor to epoll");
+        }
+    }
+    _recv_fd       = epoll_fd;
+    _recv_fd_owned = true;
+    return _recv_fd;
+#else
+    throw uhd::not_implemented_error(
+        "[rx_stream] get_recv_fd() only supports one channel on this platform");
+#endif
+}
+
 void rfnoc_rx_streamer::_handle_overrun()
 {
     if (_overrun_handling_mode) {
@@ -169,6 +239,7 @@ void rfnoc_rx_streamer::connect_channel(
     // Stash away the MTU before we lose access to xports
     const size_t mtu = xport->get_mtu();
 
+    xport->set_cycle_accounting(get_cycle_accounting());
     rx_streamer_impl<chdr_rx_data_xport>::connect_channel(channel, std::move(xport));
 
     // Update MTU property based on xport limits. We need to do this after
@@ -25,6 +25,16 @@ rfnoc_tx_streamer::rfnoc_tx_streamer(const size_t num_chans,
     , _disconnect_cb(disconnect_cb)
 {
     _async_msg_queue = std::make_shared<tx_async_msg_queue>(ASYNC_MSG_QUEUE_SIZE);
+    start_padding([this](const size_t num_samps) {
+        for (size_t chan = 0; chan < get_num_ports(); chan++) {
+            async_metadata_t md;
+            md.channel         = chan;
+            md.event_code      = async_metadata_t::EVENT_CODE_PADDING;
+            md.has_time_spec   = false;
+            md.user_payload[0] = static_cast<uint32_t>(num_samps);
+            _enqueue_async_msg(md);
+        }
+    });
 
     // No block to which to forward properties or actions
     set_prop_forwarding_policy(forwarding_policy_t::DROP);
@@ -85,6 +95,8 @@ rfnoc_tx_streamer::rfnoc_tx_streamer(const size_t num_chans,
 
 rfnoc_tx_streamer::~rfnoc_tx_streamer()
 {
+    // The padding task reports to the async message queue
+    stop_padding();
     if (_disconnect_cb) {
         _disconnect_cb(_unique_id);
     }
@@ -102,7 +114,7 @@ size_t rfnoc_tx_streamer::get_num_input_ports() const
 
 size_t rfnoc_tx_streamer::get_num_output_ports() const
 {
-    return get_num_channels();
+    return get_num_ports();
 }
 
 const uhd::stream_args_t& rfnoc_tx_streamer::get_stream_args() const
@@ -142,8 +154,9 @@ void rfnoc_tx_streamer::connect_channel(
                 md.time_spec = time_spec_t::from_ticks(tsf, get_tick_rate());
             }
 
-            this->_async_msg_queue->enqueue(md);
+            this->_enqueue_async_msg(md);
         });
+    xport->set_cycle_accounting(get_cycle_accounting());
 
     tx_streamer_impl<chdr_tx_data_xport>::connect_channel(channel, std::move(xport));
 
@@ -160,6 +173,28 @@ bool rfnoc_tx_streamer::recv_async_msg(
     return _async_msg_queue->recv_async_msg(async_metadata, timeout_ms);
 }
 
+int rfnoc_tx_streamer::get_async_msg_fd()
+{
+    return _async_msg_queue->get_fd();
+}
+
+stream_telemetry_t rfnoc_tx_streamer::get_telemetry() const
+{
+    stream_telemetry_t telemetry = tx_streamer_impl::get_telemetry();
+    get_fc_telemetry(telemetry);
+    telemetry.sequence_errors    = _sequence_errors.get();
+    telemetry.underflows         = _underflows.get();
+    telemetry.async_msgs_dropped = _async_msg_queue->get_num_dropped();
+    return telemetry;
+}
+
+stream_memory_t rfnoc_tx_streamer::get_memory_footprint() const
+{
+    stream_memory_t memory;
+    get_streamer_memory(memory);
+    return memory;
+}
+
 void rfnoc_tx_streamer::_register_props(const size_t chan, const std::string& otw_format)
 {
     // Create actual properties and store them
@@ -252,5 +287,22 @@ void rfnoc_tx_streamer::_handle_tx_event_action(
     }
 
     RFNOC_LOG_TRACE("Pushing metadata onto tx async msg queue, channel " << md.channel);
+    _enqueue_async_msg(md);
+}
+
+void rfnoc_tx_streamer::_enqueue_async_msg(const uhd::async_metadata_t& md)
+{
+    switch (md.event_code) {
+        case async_metadata_t::EVENT_CODE_UNDERFLOW:
+        case async_metadata_t::EVENT_CODE_UNDERFLOW_IN_PACKET:
+            _underflows.add_shared(1);
+            break;
+        case async_metadata_t::EVENT_CODE_SEQ_ERROR:
+        case async_metadata_t::EVENT_CODE_SEQ_ERROR_IN_BURST:
+            _sequence_errors.add_shared(1);
+            break;
+        default:
+            break;
+    }
     _async_msg_queue->enqueue(md);
 }
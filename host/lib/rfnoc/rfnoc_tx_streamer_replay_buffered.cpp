@@ -8,17 +8,63 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhd/utils/safe_call.hpp>
+#include <algorithm>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
 
+namespace {
+
+//! How often the play positions are read while a channel is below its watermark
+constexpr auto POLL_INTERVAL = std::chrono::microseconds(100);
+
+//! Returns the number of streamer ports needed for the configurations
+size_t get_num_stripe_ports(
+    const std::vector<rfnoc_tx_streamer_replay_buffered::replay_config_t>& configs)
+{
+    return configs.empty() ? 0 : configs.size() * (1 + configs[0].stripe_ports.size());
+}
+
+//! Calls fn until it does not time out reading or writing registers, or the
+// timeout expires. Returns false on timeout.
+template <typename fn_t>
+bool retry_until(const std::chrono::steady_clock::time_point timeout_time,
+    const std::string& what,
+    fn_t&& fn)
+{
+    while (1) {
+        try {
+            fn();
+            return true;
+        } catch (uhd::op_failed& e) {
+            // Too many play commands in queue
+            if (std::chrono::steady_clock::now() > timeout_time) {
+                UHD_LOG_TRACE("MULTI_USRP",
+                    "send() timed out " << what << ": " << e.what());
+                return false;
+            }
+        } catch (uhd::op_timeout& e) {
+            // Internal timeout trying to write the registers
+            if (std::chrono::steady_clock::now() > timeout_time) {
+                UHD_LOG_TRACE("MULTI_USRP",
+                    "send() timed out " << what << ": " << e.what());
+                return false;
+            }
+        }
+    }
+}
+
+} // namespace
+
 rfnoc_tx_streamer_replay_buffered::rfnoc_tx_streamer_replay_buffered(
     const size_t num_ports,
     const uhd::stream_args_t stream_args,
     std::function<void(const std::string&)> disconnect_cb,
     std::vector<replay_config_t> replay_configs) :
-    rfnoc_tx_streamer(num_ports, stream_args, disconnect_cb),
-    _bytes_per_otw_item(uhd::convert::get_bytes_per_item(stream_args.otw_format))
+    rfnoc_tx_streamer(get_num_stripe_ports(replay_configs), stream_args, disconnect_cb),
+    _bytes_per_otw_item(uhd::convert::get_bytes_per_item(stream_args.otw_format)),
+    _bytes_per_cpu_item(uhd::convert::get_bytes_per_item(stream_args.cpu_format)),
+    _num_stripes(replay_configs.empty() ? 1 : 1 + replay_configs[0].stripe_ports.size())
 {
     if(replay_configs.size() != num_ports) {
         throw uhd::value_error("[TX Streamer] Number of Replay configurations "
@@ -27,13 +73,27 @@ rfnoc_tx_streamer_replay_buffered::rfnoc_tx_streamer_replay_buffered(
 
     for (auto config : replay_configs)
     {
-        _replay_chans.push_back({config, 0, 0, 0});
-        config.ctrl->set_play_type(stream_args.otw_format);
+        if (config.stripe_ports.size() + 1 != _num_stripes) {
+            throw uhd::value_error("[TX Streamer] All channels must be striped "
+                                   "across the same number of Replay ports");
+        }
+        _replay_chans.push_back({config, 0, 0, 0, 0});
+        config.ctrl->set_play_type(stream_args.otw_format, config.port);
     }
+    _stripe_buffs.resize(get_num_ports());
+
+    _poll_thread = std::thread([this]() { _poll_play_positions(); });
 }
 
 rfnoc_tx_streamer_replay_buffered::~rfnoc_tx_streamer_replay_buffered()
 {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop_polling = true;
+    }
+    _poll_cond.notify_all();
+    _poll_thread.join();
+
     // Stop all playback
     for (auto chan : _replay_chans)
     {
@@ -41,101 +101,174 @@ rfnoc_tx_streamer_replay_buffered::~rfnoc_tx_streamer_replay_buffered()
     }
 }
 
+size_t rfnoc_tx_streamer_replay_buffered::get_num_channels() const
+{
+    return _replay_chans.size();
+}
+
+uint64_t rfnoc_tx_streamer_replay_buffered::_get_room(const replay_status_t& chan)
+{
+    const auto& config      = chan.config;
+    const auto& play_offset = chan.play_offset;
+    const auto& play_end    = chan.play_end;
+
+    // The buffer can be full or empty when play_offset and play_end
+    // are the same, so subtract one from the calculated room to make
+    // sure the buffer is never absolutely full and it can be assumed
+    // the buffer is empty when they are the same.
+    return (play_end == play_offset ? config.mem_size - 1 :
+        play_end < play_offset ? play_offset - play_end - 1 :
+        std::max<uint64_t>(config.mem_size - play_end - 1,
+        play_offset - 1));
+}
+
+bool rfnoc_tx_streamer_replay_buffered::_wait_for_room(const uint64_t record_size,
+    const std::chrono::steady_clock::time_point timeout_time)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    // The next send() is likely to be of the same size, so the polling thread
+    // keeps reading the play positions until there is room for it
+    for (auto& chan : _replay_chans) {
+        chan.watermark = record_size;
+    }
+    _poll_cond.notify_all();
+    const bool has_room = _room_cond.wait_until(lock, timeout_time, [&]() {
+        return _poll_error
+               || std::all_of(_replay_chans.cbegin(),
+                   _replay_chans.cend(),
+                   [record_size](const replay_status_t& chan) {
+                       return _get_room(chan) >= record_size;
+                   });
+    });
+    if (_poll_error) {
+        std::rethrow_exception(_poll_error);
+    }
+    if (!has_room) {
+        UHD_LOG_TRACE("MULTI_USRP", "send() timed out waiting for room in buffer");
+    }
+    return has_room;
+}
+
+void rfnoc_tx_streamer_replay_buffered::_poll_play_positions()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop_polling) {
+        bool polled = false;
+        for (auto& chan : _replay_chans) {
+            // Channels with enough room don't need their position read
+            if (_get_room(chan) >= chan.watermark) {
+                continue;
+            }
+            const auto& config = chan.config;
+            polled             = true;
+            lock.unlock();
+            uint64_t play_position = 0;
+            bool valid             = false;
+            try {
+                play_position = config.ctrl->get_play_position(config.port);
+                valid         = true;
+            } catch (uhd::op_timeout&) {
+                // Internal timeout trying to read the register, try again
+            } catch (...) {
+                lock.lock();
+                _poll_error = std::current_exception();
+                _room_cond.notify_all();
+                return;
+            }
+            lock.lock();
+            if (valid) {
+                chan.play_offset = play_position - config.start_address;
+            }
+        }
+        if (polled) {
+            _room_cond.notify_all();
+            _poll_cond.wait_for(lock, POLL_INTERVAL);
+        } else {
+            _poll_cond.wait(lock);
+        }
+    }
+}
+
 size_t rfnoc_tx_streamer_replay_buffered::send(
         const buffs_type& buffs,
         const size_t nsamps_per_buff,
         const tx_metadata_t& metadata,
         const double timeout)
 {
-    uint64_t record_size = nsamps_per_buff * _bytes_per_otw_item;
+    if (buffs.size() != _replay_chans.size()) {
+        throw uhd::value_error("[TX Streamer] send() requires one buffer per channel");
+    }
+    const uint64_t record_size = nsamps_per_buff * _bytes_per_otw_item;
+    const size_t stripe_samps  = nsamps_per_buff / _num_stripes;
+    const uint64_t stripe_size = stripe_samps * _bytes_per_otw_item;
 
-    // Make sure there is space in the buffer
-    auto timeout_time = std::chrono::steady_clock::now() +
-                        std::chrono::microseconds(long(timeout * 1000000));
     for (auto& chan : _replay_chans) {
         const auto& config = chan.config;
         const auto& replay = config.ctrl;
-        auto& play_offset = chan.play_offset;
-        const auto& play_end = chan.play_end;
 
-        // Make sure the send does not exceed the memory space
-        if (record_size > config.mem_size) {
+        // Make sure the send does not exceed the memory space (which is never
+        // filled up completely, see _get_room())
+        if (record_size >= config.mem_size) {
             throw uhd::runtime_error("[multi_usrp] Unable to buffer more than " +
-                std::to_string(config.mem_size) + " bytes");
+                std::to_string(config.mem_size - 1) + " bytes");
         }
 
-        // Make sure nsamps_per_buff is properly aligned to the DRAM
-        if (record_size % replay->get_word_size() != 0) {
+        // Make sure nsamps_per_buff is properly aligned to the DRAM, in every
+        // stripe
+        if (nsamps_per_buff % _num_stripes != 0
+            || stripe_size % replay->get_word_size() != 0) {
             throw uhd::runtime_error(
                 "[multi_usrp] Number of samples for send() call must be a "
-                "multiple of " + std::to_string(uhd::math::lcm<uint64_t>(
-                    replay->get_word_size(), uint64_t(_bytes_per_otw_item))) +
+                "multiple of " + std::to_string(_num_stripes * uhd::math::lcm<uint64_t>(
+                    replay->get_word_size(), uint64_t(_bytes_per_otw_item))
+                    / _bytes_per_otw_item) +
                     " for DRAM alignment");
         }
+    }
 
-        // The buffer can be full or empty when play_offset and play_end
-        // are the same, so subtract one from the calculated room to make
-        // sure the buffer is never absolutely full and it can be assumed
-        // the buffer is empty when they are the same.
-        auto room = (play_end == play_offset ? config.mem_size - 1 :
-            play_end < play_offset ? play_offset - play_end - 1 :
-            std::max<uint64_t>(config.mem_size - play_end - 1,
-            play_offset - 1));
-        while (room < record_size) {
-            // Return 0 if timeout
-            if (std::chrono::steady_clock::now() > timeout_time) {
-                UHD_LOG_TRACE("MULTI_USRP",
-                    "send() timed out waiting for room in buffer");
-                return 0;
-            }
-            try {
-                play_offset = replay->get_play_position(config.port) -
-                    config.start_address;
-            } catch (uhd::op_timeout&) {
-                // Internal timeout trying to read the register
-                continue;
-            }
-            room = (play_end == play_offset ? config.mem_size - 1 :
-                play_end < play_offset ? play_offset - play_end - 1 :
-                std::max<uint64_t>(config.mem_size - play_end - 1,
-                play_offset - 1));
-        }
+    // Make sure there is space in the buffer
+    auto timeout_time = std::chrono::steady_clock::now() +
+                        std::chrono::microseconds(long(timeout * 1000000));
+    if (!_wait_for_room(record_size, timeout_time)) {
+        return 0;
     }
 
     // Set up replay blocks to record
-    for (auto& chan : _replay_chans) {
-        const auto& config = chan.config;
-        const auto& replay = config.ctrl;
-        const auto& play_end = chan.play_end;
+    for (size_t i = 0; i < _replay_chans.size(); i++) {
+        auto& chan          = _replay_chans[i];
+        const auto& config  = chan.config;
+        const auto& replay  = config.ctrl;
         auto& record_offset = chan.record_offset;
 
         // Default to using space at end of last playback
-        record_offset = play_end;
+        record_offset = chan.play_end;
         // Change to beginning of memory block if not enough room at end
         if (config.mem_size - record_offset < record_size) {
             record_offset = 0;
         }
-        while (1) {
-            try {
-                replay->record(config.start_address + record_offset, record_size,
-                    config.port);
-                break;
-            } catch(uhd::op_timeout& e) {
-                // Internal timeout trying to write the registers
-                // Return 0 if timeout
-                if (std::chrono::steady_clock::now() > timeout_time) {
-                    UHD_LOG_TRACE("MULTI_USRP",
-                        std::string("send() timed out while setting up to record: ") +
-                        e.what());
-                    return 0;
-                }
+        for (size_t stripe = 0; stripe < _num_stripes; stripe++) {
+            const size_t port =
+                stripe == 0 ? config.port : config.stripe_ports[stripe - 1];
+            const uint64_t offset =
+                config.start_address + record_offset + stripe * stripe_size;
+            if (!retry_until(timeout_time, "while setting up to record", [&]() {
+                    replay->record(offset, stripe_size, port);
+                })) {
+                return 0;
             }
+            _stripe_buffs[i * _num_stripes + stripe] =
+                static_cast<const char*>(buffs[i])
+                + stripe * stripe_samps * _bytes_per_cpu_item;
         }
     }
 
-    // Send data to replay blocks
-    auto num_samps = rfnoc_tx_streamer::send(
-        buffs, nsamps_per_buff, metadata, timeout);
+    // Send data to replay blocks, all stripes at once
+    const size_t num_stripe_samps = rfnoc_tx_streamer::send(
+        buffs_type(_stripe_buffs), stripe_samps, metadata, timeout);
+    // If a stripe was not sent completely, only the part of the first stripe
+    // which was sent is contiguous in memory
+    const size_t num_samps =
+        num_stripe_samps == stripe_samps ? nsamps_per_buff : num_stripe_samps;
 
     if (num_samps) {
         // Play data
@@ -145,37 +278,19 @@ size_t rfnoc_tx_streamer_replay_buffered::send(
             const auto& record_offset = chan.record_offset;
             const uint64_t play_start = config.start_address + record_offset;
             const uint64_t play_size = num_samps * _bytes_per_otw_item;
-            auto& play_end = chan.play_end;
 
-            while (1) {
-                try {
+            if (!retry_until(timeout_time, "issuing play command", [&]() {
                     replay->play(play_start, play_size, config.port,
                         metadata.has_time_spec ? metadata.time_spec :
                         uhd::time_spec_t(0.0));
-                    break;
-                } catch(uhd::op_failed& e) {
-                    // Too many play commands in queue 
-                    // Return 0 if timeout.
-                    if (std::chrono::steady_clock::now() > timeout_time) {
-                        UHD_LOG_TRACE("MULTI_USRP",
-                            std::string("send() timed out issuing play command: ") +
-                            e.what());
-                        return 0;
-                    }
-                } catch (uhd::op_timeout& e) {
-                    // Internal timeout trying to write the registers
-                    // Return 0 if timeout
-                    if (std::chrono::steady_clock::now() > timeout_time) {
-                        UHD_LOG_TRACE("MULTI_USRP",
-                            std::string("send() timed out issuing play command: ") +
-                            e.what());
-                        return 0;
-                    }
-                }
+                })) {
+                return 0;
             }
 
-            play_end = record_offset + play_size;
+            std::lock_guard<std::mutex> lock(_mutex);
+            chan.play_end = record_offset + play_size;
         }
+        _poll_cond.notify_all();
     }
     return num_samps;
-}
\ No newline at end of file
+}
@@ -13,8 +13,14 @@
 #include <uhd/rfnoc/siggen_block_control.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <chrono>
+#include <iomanip>
 #include <limits>
+#include <map>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <utility>
 
 using namespace uhd::rfnoc;
 
@@ -45,6 +51,69 @@ const T clamp(const double v)
     constexpr T max_t = std::numeric_limits<T>::max();
     return (v < min_t) ? min_t : (v > max_t) ? max_t : T(v);
 }
+
+// The CORDIC IP scales the value written to the Cartesian coordinate register
+// (i.e., the phasor that is rotated to generate the sinusoid) by this value, so
+// we pre-scale the input value before writing. See the comment in the
+// rfnoc_block_siggen_regs.vh header file for the derivation of this value.
+constexpr double CORDIC_SCALE_VALUE = 1.164435344782938;
+
+void check_waveform_and_amplitude(const int waveform_val, const double amplitude)
+{
+    const int low_limit  = static_cast<int>(siggen_waveform::CONSTANT);
+    const int high_limit = static_cast<int>(siggen_waveform::NOISE);
+    if (waveform_val < low_limit || waveform_val > high_limit) {
+        throw uhd::value_error("Waveform value must be in [" + std::to_string(low_limit)
+                               + ", " + std::to_string(high_limit) + "]");
+    }
+    if (amplitude < 0.0 || amplitude > 1.0) {
+        throw uhd::value_error("Amplitude value must be in [0.0, 1.0]");
+    }
+}
+
+void check_phase_inc(const double phase_inc)
+{
+    if (phase_inc < (-uhd::math::PI) || phase_inc > (uhd::math::PI)) {
+        throw uhd::value_error("Phase increment value must be in [-pi, pi]");
+    }
+}
+
+uint32_t get_gain_reg_value(const double gain)
+{
+    return static_cast<uint32_t>(clamp<int16_t>(gain * 32768.0));
+}
+
+uint32_t get_phase_inc_reg_value(const double phase_inc)
+{
+    const int16_t phase_inc_scaled_rads_fp =
+        clamp<int16_t>((phase_inc / uhd::math::PI) * 8192.0);
+    return phase_inc_scaled_rads_fp & 0xffff;
+}
+
+uint32_t get_cartesian_reg_value(const double amplitude)
+{
+    // The rotator that rotates the phasor to generate the sinusoidal
+    // data has an initial phase offset which is impossible to predict.
+    // Thus, the Cartesian parameter is largely immaterial, as long as
+    // the phasor's amplitude matches what the client has specified.
+    // For simplicity, the Cartesian parameter is chosen to have a real
+    // (X) component of the desired amplitude and an imaginary (Y)
+    // component of 0.0.
+    const int16_t cartesian_x_fp = clamp<int16_t>(amplitude * 32767.0);
+
+    // Bits 31:16 represent the real component (the pre-scaled fixed-point
+    // amplitude), while bits 15:0 represent the imaginary component (which
+    // is zeroed).
+    return (uint32_t(cartesian_x_fp) << 16);
+}
+
+//! Format a double such that uhd::cast::from_str() returns the same value
+std::string to_exact_str(const double value)
+{
+    std::ostringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    return ss.str();
+}
 } // namespace
 
 class siggen_block_control_impl : public siggen_block_control
@@ -118,6 +187,61 @@ public:
         return _prop_spp.at(port).get();
     }
 
+    void run_sequence(const std::vector<siggen_step_t>& steps, const size_t port) override
+    {
+        if (port >= get_num_output_ports()) {
+            throw uhd::value_error("Invalid siggen port " + std::to_string(port));
+        }
+
+        // Compute all register writes up front, so no step needs more than a
+        // batch of writes, and nothing is written if any step is invalid
+        std::vector<std::vector<uint32_t>> addrs(steps.size());
+        std::vector<std::vector<uint32_t>> data(steps.size());
+        std::map<uint32_t, uint32_t> reg_values;
+        uhd::time_spec_t prev_time(0.0);
+        for (size_t i = 0; i < steps.size(); i++) {
+            const siggen_step_t& step = steps[i];
+            if (step.time < prev_time) {
+                throw uhd::value_error("Siggen sequence step times must not decrease");
+            }
+            prev_time = step.time;
+            check_waveform_and_amplitude(static_cast<int>(step.waveform), step.amplitude);
+            check_phase_inc(step.phase_inc);
+            for (const auto& reg : _get_step_regs(step)) {
+                auto reg_value = reg_values.find(reg.first);
+                if (reg_value == reg_values.end() || reg_value->second != reg.second) {
+                    addrs[i].push_back(reg.first);
+                    data[i].push_back(reg.second);
+                    reg_values[reg.first] = reg.second;
+                }
+            }
+        }
+        if (steps.empty()) {
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < steps.size(); i++) {
+            std::this_thread::sleep_until(
+                start
+                + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(steps[i].time.get_real_secs())));
+            if (!addrs[i].empty()) {
+                _siggen_reg_iface.multi_poke32(addrs[i], data[i], port);
+            }
+        }
+
+        // Update all properties in one resolution, which rewrites the values
+        // of the last step. Setting them one by one would briefly combine the
+        // waveform of the last step with the amplitude of the first one.
+        const siggen_step_t& last = steps.back();
+        uhd::device_addr_t props;
+        props[PROP_KEY_WAVEFORM]       = std::to_string(static_cast<int>(last.waveform));
+        props[PROP_KEY_AMPLITUDE]      = to_exact_str(last.amplitude);
+        props[PROP_KEY_SINE_PHASE_INC] = to_exact_str(last.phase_inc);
+        set_properties(props, port);
+    }
+
     /**************************************************************************
      * Initialization
      *************************************************************************/
@@ -184,14 +308,9 @@ private:
             });
             register_property(&_prop_phase_inc.back(), [this, port]() {
                 const double phase_inc = _prop_phase_inc.at(port).get();
-                if (phase_inc < (-uhd::math::PI) || phase_inc > (uhd::math::PI)) {
-                    throw uhd::value_error(
-                        "Phase increment value must be in [-pi, pi]");
-                }
-                const int16_t phase_inc_scaled_rads_fp =
-                    clamp<int16_t>((phase_inc / uhd::math::PI) * 8192.0);
+                check_phase_inc(phase_inc);
                 _siggen_reg_iface.poke32(
-                    REG_PHASE_INC_OFFSET, phase_inc_scaled_rads_fp & 0xffff, port);
+                    REG_PHASE_INC_OFFSET, get_phase_inc_reg_value(phase_inc), port);
             });
             register_property(&_prop_spp.back(), [this, port]() {
                 const uint32_t spp = _prop_spp.at(port).get();
@@ -207,17 +326,8 @@ private:
                     // If either are out of range, throw an exception and
                     // do not set any registers.
                     const int waveform_val = _prop_waveform.at(port).get();
-                    const int low_limit    = static_cast<int>(siggen_waveform::CONSTANT);
-                    const int high_limit   = static_cast<int>(siggen_waveform::NOISE);
-                    if (waveform_val < low_limit || waveform_val > high_limit) {
-                        throw uhd::value_error("Waveform value must be in ["
-                                               + std::to_string(low_limit) + ", "
-                                               + std::to_string(high_limit) + "]");
-                    }
                     const double amplitude = _prop_amplitude.at(port).get();
-                    if (amplitude < 0.0 || amplitude > 1.0) {
-                        throw uhd::value_error("Amplitude value must be in [0.0, 1.0]");
-                    }
+                    check_waveform_and_amplitude(waveform_val, amplitude);
 
                     // Set the waveform register appropriately.
                     _siggen_reg_iface.poke32(REG_WAVEFORM_OFFSET, waveform_val, port);
@@ -234,15 +344,7 @@ private:
                         case siggen_waveform::SINE_WAVE: {
                             // Set the phasor to the appropriate amplitude value and
                             // fix the gain to 1.
-
-                            // The CORDIC IP scales the value written to the Cartesian
-                            // coordinate register (i.e., the phasor that is rotated to
-                            // generate the sinusoid) by this value, so we pre-scale the
-                            // input value before writing. See the comment in the
-                            // rfnoc_block_siggen_regs.vh header file for the derivation
-                            // of this value.
-                            constexpr double cordic_scale_value = 1.164435344782938;
-                            _set_cartesian_register(amplitude / cordic_scale_value, port);
+                            _set_cartesian_register(amplitude / CORDIC_SCALE_VALUE, port);
                             _set_gain_register(1.0, port);
                             break;
                         }
@@ -300,26 +402,36 @@ private:
 
     void _set_gain_register(const double gain, const size_t port)
     {
-        const int16_t gain_fp = clamp<int16_t>(gain * 32768.0);
-        _siggen_reg_iface.poke32(REG_GAIN_OFFSET, gain_fp, port);
+        _siggen_reg_iface.poke32(REG_GAIN_OFFSET, get_gain_reg_value(gain), port);
     }
 
     void _set_cartesian_register(const double amplitude, const size_t port)
     {
-        // The rotator that rotates the phasor to generate the sinusoidal
-        // data has an initial phase offset which is impossible to predict.
-        // Thus, the Cartesian parameter is largely immaterial, as long as
-        // the phasor's amplitude matches what the client has specified.
-        // For simplicity, the Cartesian parameter is chosen to have a real
-        // (X) component of the desired amplitude and an imaginary (Y)
-        // component of 0.0.
-        const int16_t cartesian_x_fp = clamp<int16_t>(amplitude * 32767.0);
-
-        // Bits 31:16 represent the real component (the pre-scaled fixed-point
-        // amplitude), while bits 15:0 represent the imaginary component (which
-        // is zeroed).
-        const uint32_t cartesian_reg_value = (uint32_t(cartesian_x_fp) << 16);
-        _siggen_reg_iface.poke32(REG_CARTESIAN_OFFSET, cartesian_reg_value, port);
+        _siggen_reg_iface.poke32(
+            REG_CARTESIAN_OFFSET, get_cartesian_reg_value(amplitude), port);
+    }
+
+    //! Return the registers a sequence step writes, in the order the
+    // property resolvers write them
+    std::vector<std::pair<uint32_t, uint32_t>> _get_step_regs(const siggen_step_t& step)
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> regs{
+            {REG_WAVEFORM_OFFSET, static_cast<uint32_t>(step.waveform)}};
+        switch (step.waveform) {
+            case siggen_waveform::CONSTANT:
+                regs.emplace_back(REG_GAIN_OFFSET, get_gain_reg_value(1.0));
+                break;
+            case siggen_waveform::SINE_WAVE:
+                regs.emplace_back(REG_CARTESIAN_OFFSET,
+                    get_cartesian_reg_value(step.amplitude / CORDIC_SCALE_VALUE));
+                regs.emplace_back(REG_GAIN_OFFSET, get_gain_reg_value(1.0));
+                break;
+            case siggen_waveform::NOISE:
+                regs.emplace_back(REG_GAIN_OFFSET, get_gain_reg_value(step.amplitude));
+                break;
+        }
+        regs.emplace_back(REG_PHASE_INC_OFFSET, get_phase_inc_reg_value(step.phase_inc));
+        return regs;
     }
 
     /**************************************************************************
@@ -19,6 +19,13 @@ void export_siggen_block_control(py::module& m)
         .value("NOISE", siggen_waveform::NOISE)
         .export_values();
 
+    py::class_<siggen_step_t>(m, "siggen_step")
+        .def(py::init<>())
+        .def_readwrite("time", &siggen_step_t::time)
+        .def_readwrite("waveform", &siggen_step_t::waveform)
+        .def_readwrite("amplitude", &siggen_step_t::amplitude)
+        .def_readwrite("phase_inc", &siggen_step_t::phase_inc);
+
     py::class_<siggen_block_control, noc_block_base, siggen_block_control::sptr>(
         m, "siggen_block_control")
         .def(py::init(&block_controller_factory<siggen_block_control>::make_from))
@@ -34,5 +41,6 @@ void export_siggen_block_control(py::module& m)
         .def("get_sine_phase_increment", &siggen_block_control::get_sine_phase_increment)
         .def("set_sine_frequency", &siggen_block_control::set_sine_frequency)
         .def("set_samples_per_packet", &siggen_block_control::set_samples_per_packet)
-        .def("get_samples_per_packet", &siggen_block_control::get_samples_per_packet);
+        .def("get_samples_per_packet", &siggen_block_control::get_samples_per_packet)
+        .def("run_sequence", &siggen_block_control::run_sequence);
 }
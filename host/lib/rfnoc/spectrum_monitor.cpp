@@ -0,0 +1,263 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/defaults.hpp>
+#include <uhd/rfnoc/fft_block_control.hpp>
+#include <uhd/rfnoc/keep_one_in_n_block_control.hpp>
+#include <uhd/rfnoc/logpwr_block_control.hpp>
+#include <uhd/rfnoc/moving_average_block_control.hpp>
+#include <uhd/rfnoc/spectrum_monitor.hpp>
+#include <uhd/rfnoc/vector_iir_block_control.hpp>
+#include <uhd/utils/graph_utils.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr char LOG_ID[] = "SPECTRUM_MON";
+
+//! The Log Power block outputs 1024 * log2(i^2 + q^2)
+constexpr double LOGPWR_SCALE = 1024.0;
+//! Power of a full scale sc16 sample, i.e., 10 * log10(32768^2 + 32768^2)
+const double FULL_SCALE_DB = 10.0 * std::log10(2.0 * 32768.0 * 32768.0);
+
+//! Position of the optional blocks in the chain
+enum chain_pos_t { POS_LOGPWR, POS_MOVING_AVERAGE, POS_VECTOR_IIR, POS_KEEP_ONE_IN_N };
+
+} // namespace
+
+class spectrum_monitor_impl : public spectrum_monitor
+{
+public:
+    spectrum_monitor_impl(rfnoc_graph::sptr graph,
+        const std::vector<block_id_t>& chain,
+        const size_t port,
+        const config_t& config)
+        : _graph(graph), _port(port)
+    {
+        if (chain.size() < 2) {
+            throw uhd::value_error(
+                "Spectrum monitor: The chain needs at least a source and an FFT block");
+        }
+        auto fft = graph->get_block<fft_block_control>(chain[1]);
+        if (!fft) {
+            throw uhd::value_error("Spectrum monitor: " + chain[1].to_string()
+                                   + " is not an FFT block");
+        }
+        fft->set_direction(fft_direction::FORWARD);
+        fft->set_magnitude(fft_magnitude::COMPLEX);
+        fft->set_shift_config(fft_shift::NORMAL);
+        fft->set_length(config.fft_length);
+        _fft_length = fft->get_length();
+
+        int last_pos = -1;
+        for (size_t i = 2; i < chain.size(); i++) {
+            const int pos = _configure_block(graph->get_block(chain[i]), config);
+            if (pos <= last_pos) {
+                throw uhd::value_error("Spectrum monitor: " + chain[i].to_string()
+                                       + " is not supported, or out of order");
+            }
+            last_pos = pos;
+        }
+
+        uhd::stream_args_t stream_args(IO_TYPE_SC16, IO_TYPE_SC16);
+        stream_args.args["spp"] = std::to_string(_fft_length);
+        _streamer               = graph->create_rx_streamer(1, stream_args);
+        try {
+            for (size_t i = 0; i + 1 < chain.size(); i++) {
+                _add_edges(
+                    connect_through_blocks(graph, chain[i], port, chain[i + 1], port));
+            }
+            graph->connect(chain.back(), port, _streamer, 0);
+            graph->commit();
+        } catch (...) {
+            _disconnect();
+            throw;
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Receiving frames of " << _fft_length << " bins from " << chain.back()
+                                   << ":" << port);
+    }
+
+    ~spectrum_monitor_impl() override
+    {
+        UHD_SAFE_CALL(release_frame(); stop(););
+        _disconnect();
+    }
+
+    size_t get_fft_length() const override
+    {
+        return _fft_length;
+    }
+
+    bool has_log_power() const override
+    {
+        return _log_power;
+    }
+
+    void start(const uhd::time_spec_t& time_spec) override
+    {
+        uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+        stream_cmd.stream_now = (time_spec == uhd::time_spec_t(0.0));
+        stream_cmd.time_spec  = time_spec;
+        _streamer->issue_stream_cmd(stream_cmd);
+    }
+
+    void stop() override
+    {
+        _streamer->issue_stream_cmd(
+            uhd::stream_cmd_t(uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS));
+    }
+
+    bool recv_frame(frame_t& frame, const double timeout) override
+    {
+        frame.num_bins = _streamer->get_recv_buffs(_buffs, frame.metadata, timeout);
+        frame.bins     = frame.num_bins
+                             ? static_cast<const std::complex<int16_t>*>(_buffs[0])
+                             : nullptr;
+        return frame.num_bins != 0;
+    }
+
+    void release_frame() override
+    {
+        _streamer->release_recv_buffs();
+    }
+
+    void get_power_db(const frame_t& frame, float* power_db) const override
+    {
+        convert_to_db(frame.bins, frame.num_bins, _log_power, power_db);
+    }
+
+    uhd::rx_streamer::sptr get_streamer() const override
+    {
+        return _streamer;
+    }
+
+private:
+    //! Apply the settings to an optional block, and return its position
+    int _configure_block(noc_block_base::sptr block, const config_t& config)
+    {
+        if (std::dynamic_pointer_cast<logpwr_block_control>(block)) {
+            _log_power = true;
+            return POS_LOGPWR;
+        }
+        if (auto moving_average =
+                std::dynamic_pointer_cast<moving_average_block_control>(block)) {
+            if (config.smoothing_len == 0) {
+                throw uhd::value_error(
+                    "Spectrum monitor: The smoothing length must be at least 1");
+            }
+            moving_average->set_sum_len(config.smoothing_len);
+            moving_average->set_divisor(config.smoothing_len);
+            return POS_MOVING_AVERAGE;
+        }
+        if (auto iir = std::dynamic_pointer_cast<vector_iir_block_control>(block)) {
+            if (_fft_length > iir->get_max_delay(_port)) {
+                throw uhd::value_error("Spectrum monitor: The FFT length exceeds the "
+                                       "maximum delay of "
+                                       + block->get_unique_id());
+            }
+            if (config.iir_alpha < 0.0 || config.iir_alpha >= 1.0) {
+                throw uhd::value_error(
+                    "Spectrum monitor: The IIR feedback tap must be in [0, 1)");
+            }
+            // Every bin is averaged with the same bin of the previous frames,
+            // at unity gain
+            iir->set_delay(uint16_t(_fft_length), _port);
+            iir->set_alpha(config.iir_alpha, _port);
+            iir->set_beta(1.0 - config.iir_alpha, _port);
+            return POS_VECTOR_IIR;
+        }
+        if (auto keep_one_in_n =
+                std::dynamic_pointer_cast<keep_one_in_n_block_control>(block)) {
+            if (config.keep_one_in == 0
+                || config.keep_one_in > keep_one_in_n->get_max_n()) {
+                throw uhd::value_error(
+                    "Spectrum monitor: Can keep one frame in at most "
+                    + std::to_string(keep_one_in_n->get_max_n()));
+            }
+            keep_one_in_n->set_mode(
+                keep_one_in_n_block_control::mode::PACKET_MODE, _port);
+            keep_one_in_n->set_n(config.keep_one_in, _port);
+            return POS_KEEP_ONE_IN_N;
+        }
+        return -1;
+    }
+
+    //! Remember the connections which connect_through_blocks() made
+    void _add_edges(const std::vector<graph_edge_t>& edges)
+    {
+        // A path through stream endpoints was connected as one edge from the
+        // block before the first endpoint to the block after the second one
+        graph_edge_t sep_edge;
+        for (const auto& edge : edges) {
+            if (block_id_t(edge.dst_blockid).match(NODE_ID_SEP)) {
+                sep_edge.src_blockid = edge.src_blockid;
+                sep_edge.src_port    = edge.src_port;
+            } else if (block_id_t(edge.src_blockid).match(NODE_ID_SEP)) {
+                sep_edge.dst_blockid = edge.dst_blockid;
+                sep_edge.dst_port    = edge.dst_port;
+                _edges.push_back(sep_edge);
+            } else {
+                _edges.push_back(edge);
+            }
+        }
+    }
+
+    void _disconnect()
+    {
+        // Destroying the streamer disconnects it
+        _streamer.reset();
+        for (const auto& edge : _edges) {
+            UHD_SAFE_CALL(_graph->disconnect(
+                edge.src_blockid, edge.src_port, edge.dst_blockid, edge.dst_port););
+        }
+        _edges.clear();
+    }
+
+    rfnoc_graph::sptr _graph;
+    const size_t _port;
+    size_t _fft_length;
+    bool _log_power = false;
+    uhd::rx_streamer::sptr _streamer;
+    //! The connections between the blocks of the chain
+    std::vector<graph_edge_t> _edges;
+    uhd::rx_streamer::recv_buffs_type _buffs;
+};
+
+spectrum_monitor::sptr spectrum_monitor::make(rfnoc_graph::sptr graph,
+    const std::vector<block_id_t>& chain,
+    const size_t port,
+    const config_t& config)
+{
+    return std::make_shared<spectrum_monitor_impl>(graph, chain, port, config);
+}
+
+void spectrum_monitor::convert_to_db(const std::complex<int16_t>* bins,
+    const size_t num_bins,
+    const bool log_power,
+    float* power_db)
+{
+    if (log_power) {
+        // The log power values are unsigned
+        const double scale = 10.0 * std::log10(2.0) / LOGPWR_SCALE;
+        std::transform(bins, bins + num_bins, power_db, [&](std::complex<int16_t> bin) {
+            return float(uint16_t(bin.real()) * scale - FULL_SCALE_DB);
+        });
+    } else {
+        std::transform(bins, bins + num_bins, power_db, [](std::complex<int16_t> bin) {
+            const double power =
+                double(bin.real()) * bin.real() + double(bin.imag()) * bin.imag();
+            // Clamp the power to that of the smallest non-zero sample
+            return float(10.0 * std::log10(std::max(power, 1.0)) - FULL_SCALE_DB);
+        });
+    }
+}
@@ -9,6 +9,8 @@
 #include <uhd/rfnoc/property.hpp>
 #include <uhd/rfnoc/registry.hpp>
 #include <uhd/rfnoc/switchboard_block_control.hpp>
+#include <mutex>
+#include <string>
 
 using namespace uhd::rfnoc;
 
@@ -27,6 +29,8 @@ public:
     RFNOC_BLOCK_CONSTRUCTOR(switchboard_block_control),
         _num_input_ports(get_num_input_ports()),
         _num_output_ports(get_num_output_ports()),
+        _input_sel(_num_output_ports, 0),
+        _output_sel(_num_input_ports, 0),
         _switchboard_reg_iface(*this, 0, REG_BLOCK_SIZE)
     {
         UHD_ASSERT_THROW(_num_input_ports > 0 && _num_output_ports > 0);
@@ -49,10 +53,92 @@ public:
         set_property<int>(PROP_KEY_INPUT_SELECT, static_cast<int>(input), output);
         set_property<int>(PROP_KEY_OUTPUT_SELECT, static_cast<int>(output), input);
 
+        std::lock_guard<std::mutex> l(_sel_mutex);
+        if (input >= _num_input_ports || output >= _num_output_ports) {
+            throw uhd::value_error("Index out of bounds");
+        }
+        // After select_route(), the registers may differ from the properties,
+        // which don't write them again if their value didn't change
+        if (_input_sel.at(output) != input) {
+            _switchboard_reg_iface.poke32(REG_MUX_SELECT_ADDR, input, output);
+            _input_sel[output] = input;
+        }
+        if (_output_sel.at(input) != output) {
+            _switchboard_reg_iface.poke32(REG_DEMUX_SELECT_ADDR, output, input);
+            _output_sel[input] = output;
+        }
+        _update_forwarding_map();
+    }
+
+    void set_routes(const std::vector<route_t>& routes) override
+    {
+        std::vector<route_cmds_t> route_cmds;
+        route_cmds.reserve(routes.size());
+        for (size_t idx = 0; idx < routes.size(); idx++) {
+            std::vector<bool> input_used(_num_input_ports, false);
+            std::vector<bool> output_used(_num_output_ports, false);
+            route_cmds_t cmds;
+            cmds.route = routes[idx];
+            for (const auto& pair : routes[idx]) {
+                const size_t input  = pair.first;
+                const size_t output = pair.second;
+                if (input >= _num_input_ports || output >= _num_output_ports) {
+                    throw uhd::value_error("Route " + std::to_string(idx)
+                                           + ": Index out of bounds");
+                }
+                if (input_used[input] || output_used[output]) {
+                    throw uhd::value_error("Route " + std::to_string(idx)
+                                           + ": Ports may only be connected once");
+                }
+                input_used[input]   = true;
+                output_used[output] = true;
+                cmds.addrs.push_back(REG_MUX_SELECT_ADDR + REG_BLOCK_SIZE * output);
+                cmds.data.push_back(input);
+                cmds.addrs.push_back(REG_DEMUX_SELECT_ADDR + REG_BLOCK_SIZE * input);
+                cmds.data.push_back(output);
+            }
+            route_cmds.push_back(std::move(cmds));
+        }
+
+        std::lock_guard<std::mutex> l(_sel_mutex);
+        _routes = std::move(route_cmds);
+    }
+
+    size_t get_num_routes() const override
+    {
+        std::lock_guard<std::mutex> l(_sel_mutex);
+        return _routes.size();
+    }
+
+    void select_route(const size_t route, const uhd::time_spec_t& time) override
+    {
+        std::lock_guard<std::mutex> l(_sel_mutex);
+        if (route >= _routes.size()) {
+            throw uhd::index_error("Invalid route index: " + std::to_string(route));
+        }
+        const auto& cmds = _routes[route];
+        if (cmds.addrs.empty()) {
+            return;
+        }
+        // The switchboard registers are at the start of the block's register
+        // space, so the offsets are the addresses
+        regs().multi_poke32(cmds.addrs, cmds.data, time);
+        for (const auto& pair : cmds.route) {
+            _input_sel[pair.second] = pair.first;
+            _output_sel[pair.first] = pair.second;
+        }
         _update_forwarding_map();
     }
 
 private:
+    //! A route of set_routes(), and the register writes which select it
+    struct route_cmds_t
+    {
+        route_t route;
+        std::vector<uint32_t> addrs;
+        std::vector<uint32_t> data;
+    };
+
     const size_t _num_input_ports;
     const size_t _num_output_ports;
 
@@ -71,8 +157,10 @@ private:
                 if (select_val < 0 
                     || static_cast<unsigned int>(select_val) >= _num_input_ports)
                     throw uhd::value_error("Index out of bounds");
+                std::lock_guard<std::mutex> l(_sel_mutex);
                 _switchboard_reg_iface.poke32(
                     REG_MUX_SELECT_ADDR, select_val, output_port);
+                _input_sel[output_port] = select_val;
             });
         }
 
@@ -86,12 +174,16 @@ private:
                 if (select_val < 0
                     || static_cast<unsigned int>(select_val) >= _num_output_ports)
                     throw uhd::value_error("Index out of bounds");
+                std::lock_guard<std::mutex> l(_sel_mutex);
                 _switchboard_reg_iface.poke32(
                     REG_DEMUX_SELECT_ADDR, select_val, input_port);
+                _output_sel[input_port] = select_val;
             });
         }
     }
 
+    //! Sets the forwarding maps from the routing in the registers. Requires
+    // _sel_mutex.
     void _update_forwarding_map()
     {
         node_t::forwarding_map_t prop_fwd_map;
@@ -101,8 +193,8 @@ private:
         //   Connected inputs and outputs will propagate to each other.
         //   Unconnected inputs and outputs do not propagate.
         for (size_t input_port = 0; input_port < _num_input_ports; input_port++) {
-            size_t linked_output_port = _output_select.at(input_port).get();
-            size_t linked_input_port  = _input_select.at(linked_output_port).get();
+            size_t linked_output_port = _output_sel.at(input_port);
+            size_t linked_input_port  = _input_sel.at(linked_output_port);
             if (linked_input_port == input_port) {
                 prop_fwd_map.insert({{res_source_info::INPUT_EDGE, linked_input_port},
                     {{res_source_info::OUTPUT_EDGE, linked_output_port}}});
@@ -124,6 +216,19 @@ private:
     std::vector<property_t<int>> _input_select;
     std::vector<property_t<int>> _output_select;
 
+    //! The routing in the registers: The input selected by every output, and
+    // the output selected by every input. Unlike the properties, these follow
+    // select_route().
+    std::vector<size_t> _input_sel;
+    std::vector<size_t> _output_sel;
+
+    //! The routes of set_routes()
+    std::vector<route_cmds_t> _routes;
+
+    //! Protects the routing state, which select_route() changes without a
+    // property resolution
+    mutable std::mutex _sel_mutex;
+
     /**************************************************************************
      * Register Interface
      *************************************************************************/
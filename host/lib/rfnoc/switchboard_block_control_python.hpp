@@ -17,5 +17,11 @@ void export_switchboard_block_control(py::module& m)
         noc_block_base,
         switchboard_block_control::sptr>(m, "switchboard_block_control")
         .def(py::init(&block_controller_factory<switchboard_block_control>::make_from))
-        .def("connect", &switchboard_block_control::connect);
+        .def("connect", &switchboard_block_control::connect)
+        .def("set_routes", &switchboard_block_control::set_routes, py::arg("routes"))
+        .def("get_num_routes", &switchboard_block_control::get_num_routes)
+        .def("select_route",
+            &switchboard_block_control::select_route,
+            py::arg("route"),
+            py::arg("time") = uhd::time_spec_t::ASAP);
 }
@@ -0,0 +1,216 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/traffic_monitor.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <uhd/utils/thread.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr char LOG_ID[] = "TRAFFIC_MON";
+
+const uhd::fs_path COUNTER_PATH = "traffic_counter";
+
+//! A block with traffic counters
+struct counter_block_t
+{
+    std::string id;
+    uhd::property_tree::sptr tree;
+};
+
+traffic_counter_values_t read_counters(uhd::property_tree::sptr tree)
+{
+    auto read = [&tree](const std::string& name) {
+        return tree->access<uint64_t>(COUNTER_PATH / name).get();
+    };
+    traffic_counter_values_t values;
+    values.bus_clock_ticks          = read("bus_clock_ticks");
+    values.xbar_to_shell_xfer_count = read("xbar_to_shell_xfer_count");
+    values.xbar_to_shell_pkt_count  = read("xbar_to_shell_pkt_count");
+    values.shell_to_xbar_xfer_count = read("shell_to_xbar_xfer_count");
+    values.shell_to_xbar_pkt_count  = read("shell_to_xbar_pkt_count");
+    values.shell_to_ce_xfer_count   = read("shell_to_ce_xfer_count");
+    values.shell_to_ce_pkt_count    = read("shell_to_ce_pkt_count");
+    values.ce_to_shell_xfer_count   = read("ce_to_shell_xfer_count");
+    values.ce_to_shell_pkt_count    = read("ce_to_shell_pkt_count");
+    return values;
+}
+
+} // namespace
+
+class traffic_monitor_impl : public traffic_monitor
+{
+public:
+    traffic_monitor_impl(rfnoc_graph::sptr graph, const double interval)
+        : _graph(graph), _interval(interval)
+    {
+        for (const auto& block_id : graph->find_blocks("")) {
+            auto tree = graph->get_block(block_id)->get_tree();
+            if (tree->exists(COUNTER_PATH / "enable")) {
+                tree->access<bool>(COUNTER_PATH / "enable").set(true);
+                _blocks.push_back({block_id.to_string(), tree});
+            }
+        }
+        if (_blocks.empty()) {
+            UHD_LOG_WARNING(LOG_ID, "No block of the graph has traffic counters");
+        } else {
+            UHD_LOG_DEBUG(LOG_ID,
+                "Sampling the traffic counters of " << _blocks.size()
+                                                    << " blocks every " << interval
+                                                    << " s");
+        }
+        _thread = std::thread([this]() { _sample_loop(); });
+        uhd::set_thread_name(&_thread, "uhd_traffic_mon");
+    }
+
+    ~traffic_monitor_impl() override
+    {
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            _stop = true;
+        }
+        _cond.notify_one();
+        _thread.join();
+        for (const auto& block : _blocks) {
+            UHD_SAFE_CALL(block.tree->access<bool>(COUNTER_PATH / "enable").set(false);)
+        }
+    }
+
+    std::vector<std::string> get_counter_blocks() const override
+    {
+        std::vector<std::string> ids;
+        for (const auto& block : _blocks) {
+            ids.push_back(block.id);
+        }
+        return ids;
+    }
+
+    std::vector<traffic_edge_stats_t> get_edge_stats() const override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _stats;
+    }
+
+    void set_callback(callback_t callback) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _callback = std::move(callback);
+    }
+
+private:
+    void _sample_loop()
+    {
+        std::map<std::string, traffic_counter_values_t> prev;
+        auto prev_time = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> l(_mutex);
+        while (!_stop) {
+            // Don't hold the lock while reading registers
+            l.unlock();
+            std::map<std::string, traffic_counter_values_t> cur;
+            const auto time = std::chrono::steady_clock::now();
+            try {
+                for (const auto& block : _blocks) {
+                    cur[block.id] = read_counters(block.tree);
+                }
+            } catch (const uhd::exception& ex) {
+                UHD_LOG_ERROR(LOG_ID, "Failed to read traffic counters: " << ex.what());
+                cur.clear();
+            }
+            std::vector<traffic_edge_stats_t> stats;
+            if (!prev.empty() && !cur.empty()) {
+                const double elapsed =
+                    std::chrono::duration<double>(time - prev_time).count();
+                stats = compute_edge_stats(
+                    _graph->enumerate_active_connections(), prev, cur, elapsed);
+            }
+            prev      = std::move(cur);
+            prev_time = time;
+            l.lock();
+
+            if (!stats.empty()) {
+                _stats = std::move(stats);
+                if (_callback) {
+                    _callback(_stats);
+                }
+            }
+            _cond.wait_for(l,
+                std::chrono::duration<double>(_interval),
+                [this]() { return _stop; });
+        }
+    }
+
+    rfnoc_graph::sptr _graph;
+    const double _interval;
+    std::vector<counter_block_t> _blocks;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _stop = false;
+    std::vector<traffic_edge_stats_t> _stats;
+    callback_t _callback;
+    std::thread _thread;
+};
+
+traffic_monitor::sptr traffic_monitor::make(
+    rfnoc_graph::sptr graph, const double interval)
+{
+    if (!(interval > 0.0)) {
+        throw uhd::value_error("Traffic monitor: The interval must be positive");
+    }
+    return std::make_shared<traffic_monitor_impl>(graph, interval);
+}
+
+std::vector<traffic_edge_stats_t> traffic_monitor::compute_edge_stats(
+    const std::vector<graph_edge_t>& edges,
+    const std::map<std::string, traffic_counter_values_t>& prev,
+    const std::map<std::string, traffic_counter_values_t>& cur,
+    const double elapsed)
+{
+    auto has_counters = [&prev, &cur](const std::string& id) {
+        return prev.count(id) != 0 && cur.count(id) != 0;
+    };
+
+    std::vector<traffic_edge_stats_t> stats;
+    for (const auto& edge : edges) {
+        // Traffic leaves the source block through ce_to_shell, and enters the
+        // destination block through shell_to_ce
+        const bool use_src = has_counters(edge.src_blockid);
+        if (!use_src && !has_counters(edge.dst_blockid)) {
+            continue;
+        }
+        traffic_edge_stats_t edge_stats;
+        edge_stats.edge          = edge;
+        edge_stats.counter_block = use_src ? edge.src_blockid : edge.dst_blockid;
+        const auto& p            = prev.at(edge_stats.counter_block);
+        const auto& c            = cur.at(edge_stats.counter_block);
+
+        // The counters are free-running, unsigned subtraction handles wrapping
+        const uint64_t ticks = c.bus_clock_ticks - p.bus_clock_ticks;
+        const uint64_t xfers = use_src
+                                   ? c.ce_to_shell_xfer_count - p.ce_to_shell_xfer_count
+                                   : c.shell_to_ce_xfer_count - p.shell_to_ce_xfer_count;
+        const uint64_t pkts  = use_src
+                                   ? c.ce_to_shell_pkt_count - p.ce_to_shell_pkt_count
+                                   : c.shell_to_ce_pkt_count - p.shell_to_ce_pkt_count;
+        if (elapsed > 0.0) {
+            edge_stats.xfers_per_sec = double(xfers) / elapsed;
+            edge_stats.pkts_per_sec  = double(pkts) / elapsed;
+        }
+        if (ticks != 0) {
+            edge_stats.utilization = double(xfers) / double(ticks);
+        }
+        stats.push_back(edge_stats);
+    }
+    return stats;
+}
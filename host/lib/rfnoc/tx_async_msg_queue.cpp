@@ -4,7 +4,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -18,32 +20,69 @@ bool tx_async_msg_queue::recv_async_msg(
 {
     using namespace std::chrono;
 
-    if (timeout_ms == 0.0) {
-        return _queue.pop(async_metadata);
+    if (_pop(async_metadata)) {
+        return true;
+    }
+    if (timeout_ms == 0) {
+        return false;
     }
 
     const auto end_time = steady_clock::now() + milliseconds(timeout_ms);
-
-    bool last_check = false;
-
     while (true) {
-        if (_queue.pop(async_metadata)) {
+        const auto remaining =
+            duration_cast<milliseconds>(end_time - steady_clock::now());
+        if (_wakeup_fd.get_fd() >= 0) {
+            // The descriptor was cleared when the queue was found empty, so it
+            // becomes readable with the next message
+            _wakeup_fd.wait(std::max<int32_t>(0, int32_t(remaining.count()) + 1));
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        if (_pop(async_metadata)) {
             return true;
         }
-
         if (steady_clock::now() > end_time) {
-            if (last_check) {
-                return false;
-            } else {
-                last_check = true;
-            }
+            return false;
         }
-
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
     }
 }
 
 void tx_async_msg_queue::enqueue(const async_metadata_t& async_metadata)
 {
-    _queue.push(async_metadata);
+    if (!_queue.push(async_metadata)) {
+        _num_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // Async messages are rare enough to afford a system call each
+    _wakeup_fd.notify();
+}
+
+uint64_t tx_async_msg_queue::get_num_dropped() const
+{
+    return _num_dropped.load(std::memory_order_relaxed);
+}
+
+int tx_async_msg_queue::get_fd() const
+{
+    const int fd = _wakeup_fd.get_fd();
+    if (fd < 0) {
+        throw uhd::not_implemented_error(
+            "No file descriptor for async messages on this platform");
+    }
+    return fd;
+}
+
+bool tx_async_msg_queue::_pop(async_metadata_t& async_metadata)
+{
+    std::lock_guard<std::mutex> lock(_pop_mutex);
+    if (_queue.pop(async_metadata)) {
+        return true;
+    }
+    if (_wakeup_fd.get_fd() < 0) {
+        return false;
+    }
+    // Clear the descriptor, then look again: A message which was pushed before
+    // clearing is found now, any later one sets the descriptor again
+    _wakeup_fd.clear();
+    return _queue.pop(async_metadata);
 }
@@ -18,5 +18,11 @@ void export_window_block_control(py::module& m)
         .def(py::init(&block_controller_factory<window_block_control>::make_from))
         .def("get_max_num_coefficients", &window_block_control::get_max_num_coefficients)
         .def("set_coefficients", &window_block_control::set_coefficients)
-        .def("get_coefficients", &window_block_control::get_coefficients);
+        .def("get_coefficients", &window_block_control::get_coefficients)
+        .def("add_coefficient_set", &window_block_control::add_coefficient_set)
+        .def("has_coefficient_set", &window_block_control::has_coefficient_set)
+        .def("remove_coefficient_set", &window_block_control::remove_coefficient_set)
+        .def("get_coefficient_sets", &window_block_control::get_coefficient_sets)
+        .def("load_coefficient_set", &window_block_control::load_coefficient_set)
+        .def("get_coefficient_set", &window_block_control::get_coefficient_set);
 }
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
 
 using namespace uhd;
@@ -14,7 +15,102 @@ rx_streamer::~rx_streamer(void)
     // empty
 }
 
+size_t rx_streamer::get_recv_buffs(recv_buffs_type&, rx_metadata_t&, const double)
+{
+    throw uhd::not_implemented_error("This streamer does not support zero-copy receive");
+}
+
+size_t rx_streamer::recv_many(std::vector<recv_slot_t>& slots, const double timeout)
+{
+    if (slots.empty()) {
+        return 0;
+    }
+    recv_slot_t& slot = slots.front();
+    slot.num_samps =
+        recv(slot.buffs, slot.nsamps_per_buff, slot.metadata, timeout, true);
+    return 1;
+}
+
+void rx_streamer::release_recv_buffs(void)
+{
+    // nop
+}
+
+stream_telemetry_t rx_streamer::get_telemetry(void) const
+{
+    return stream_telemetry_t();
+}
+
+stream_memory_t rx_streamer::get_memory_footprint(void) const
+{
+    return stream_memory_t();
+}
+
+int rx_streamer::get_recv_fd(void)
+{
+    throw uhd::not_implemented_error(
+        "This streamer does not provide a file descriptor for received data");
+}
+
 tx_streamer::~tx_streamer(void)
 {
     // empty
 }
+
+size_t tx_streamer::send_many(
+    const std::vector<send_burst_t>& bursts, const double timeout)
+{
+    size_t num_bursts = 0;
+    for (const auto& burst : bursts) {
+        if (burst.buffs.size() != get_num_channels()) {
+            throw uhd::value_error("send_many() requires one buffer per channel");
+        }
+        if (send(burst.buffs, burst.nsamps_per_buff, burst.metadata, timeout)
+            < burst.nsamps_per_buff) {
+            break;
+        }
+        num_bursts++;
+    }
+    return num_bursts;
+}
+
+size_t tx_streamer::get_send_buffs(send_buffs_type&, const bool, const double)
+{
+    throw uhd::not_implemented_error("This streamer does not support zero-copy send");
+}
+
+size_t tx_streamer::commit_send_buffs(const size_t, const tx_metadata_t&)
+{
+    throw uhd::not_implemented_error("This streamer does not support zero-copy send");
+}
+
+size_t tx_streamer::register_waveform(const buffs_type&, const size_t)
+{
+    throw uhd::not_implemented_error("This streamer does not support waveforms");
+}
+
+void tx_streamer::unregister_waveform(const size_t)
+{
+    throw uhd::not_implemented_error("This streamer does not support waveforms");
+}
+
+size_t tx_streamer::send_waveform(const size_t, const tx_metadata_t&, const double)
+{
+    throw uhd::not_implemented_error("This streamer does not support waveforms");
+}
+
+int tx_streamer::get_async_msg_fd(void)
+{
+    throw uhd::not_implemented_error(
+        "This streamer does not provide a file descriptor for async messages");
+}
+
+stream_telemetry_t tx_streamer::get_telemetry(void) const
+{
+    return stream_telemetry_t();
+}
+
+stream_memory_t tx_streamer::get_memory_footprint(void) const
+{
+    return stream_memory_t();
+}
@@ -139,6 +139,8 @@ void export_stream(py::module& m)
     using stream_args_t = uhd::stream_args_t;
     using rx_streamer   = uhd::rx_streamer;
     using tx_streamer   = uhd::tx_streamer;
+    using telemetry_t   = uhd::stream_telemetry_t;
+    using memory_t      = uhd::stream_memory_t;
 
     py::class_<stream_args_t>(m, "stream_args")
         .def(py::init<const std::string&, const std::string&>())
@@ -148,6 +150,55 @@ void export_stream(py::module& m)
         .def_readwrite("args", &stream_args_t::args)
         .def_readwrite("channels", &stream_args_t::channels);
 
+    py::class_<telemetry_t>(m, "stream_telemetry", "See: uhd::stream_telemetry_t")
+        .def(py::init<>())
+        // Properties
+        .def_readonly("packets", &telemetry_t::packets)
+        .def_readonly("samples", &telemetry_t::samples)
+        .def_readonly("sequence_errors", &telemetry_t::sequence_errors)
+        .def_readonly("overflows", &telemetry_t::overflows)
+        .def_readonly("underflows", &telemetry_t::underflows)
+        .def_readonly("async_msgs_dropped", &telemetry_t::async_msgs_dropped)
+        .def_readonly("fc_bytes_outstanding", &telemetry_t::fc_bytes_outstanding)
+        .def_readonly("fc_packets_outstanding", &telemetry_t::fc_packets_outstanding)
+        .def_readonly("convert_ns", &telemetry_t::convert_ns)
+        .def_readonly("buff_wait_ns", &telemetry_t::buff_wait_ns)
+        .def_readonly("xport_frames_in_flight", &telemetry_t::xport_frames_in_flight)
+        .def_readonly(
+            "xport_frames_in_flight_min", &telemetry_t::xport_frames_in_flight_min)
+        .def_readonly("xport_frames_ready", &telemetry_t::xport_frames_ready)
+        .def_readonly("xport_fc_window_bytes", &telemetry_t::xport_fc_window_bytes)
+        .def_readonly("xport_num_frames", &telemetry_t::xport_num_frames)
+        .def_readonly("xport_frame_size", &telemetry_t::xport_frame_size)
+        .def_readonly("num_calls", &telemetry_t::num_calls)
+        .def_readonly("cycles_total", &telemetry_t::cycles_total)
+        .def_readonly("cycles_buff_wait", &telemetry_t::cycles_buff_wait)
+        .def_readonly("cycles_header", &telemetry_t::cycles_header)
+        .def_readonly("cycles_flow_ctrl", &telemetry_t::cycles_flow_ctrl)
+        .def_readonly("cycles_convert", &telemetry_t::cycles_convert)
+        .def_readonly("cycles_metadata", &telemetry_t::cycles_metadata)
+        .def_readonly("cycles_send", &telemetry_t::cycles_send)
+        .def_readonly("cycles_other", &telemetry_t::cycles_other)
+        .def_readonly("cycles_per_second", &telemetry_t::cycles_per_second);
+
+    py::class_<memory_t::link_t>(m, "stream_link_memory", "See: uhd::stream_memory_t")
+        .def(py::init<>())
+        // Properties
+        .def_readonly("num_recv_frames", &memory_t::link_t::num_recv_frames)
+        .def_readonly("recv_frame_size", &memory_t::link_t::recv_frame_size)
+        .def_readonly("num_send_frames", &memory_t::link_t::num_send_frames)
+        .def_readonly("send_frame_size", &memory_t::link_t::send_frame_size)
+        // Methods
+        .def("get_bytes", &memory_t::link_t::get_bytes);
+
+    py::class_<memory_t>(m, "stream_memory", "See: uhd::stream_memory_t")
+        .def(py::init<>())
+        // Properties
+        .def_readonly("links", &memory_t::links)
+        .def_readonly("streamer_bytes", &memory_t::streamer_bytes)
+        // Methods
+        .def("get_total_bytes", &memory_t::get_total_bytes);
+
     py::class_<rx_streamer, rx_streamer::sptr>(m, "rx_streamer", "See: uhd::rx_streamer")
         // Methods
         .def("recv",
@@ -157,7 +208,10 @@ void export_stream(py::module& m)
             py::arg("timeout") = 0.1)
         .def("get_num_channels", &uhd::rx_streamer::get_num_channels)
         .def("get_max_num_samps", &uhd::rx_streamer::get_max_num_samps)
-        .def("issue_stream_cmd", &uhd::rx_streamer::issue_stream_cmd);
+        .def("issue_stream_cmd", &uhd::rx_streamer::issue_stream_cmd)
+        .def("get_recv_fd", &uhd::rx_streamer::get_recv_fd)
+        .def("get_telemetry", &uhd::rx_streamer::get_telemetry)
+        .def("get_memory_footprint", &uhd::rx_streamer::get_memory_footprint);
 
     py::class_<tx_streamer, tx_streamer::sptr>(m, "tx_streamer", "See: uhd::tx_streamer")
         // Methods
@@ -171,7 +225,10 @@ void export_stream(py::module& m)
         .def("recv_async_msg",
             &wrap_recv_async_msg,
             py::arg("async_metadata"),
-            py::arg("timeout") = 0.1);
+            py::arg("timeout") = 0.1)
+        .def("get_async_msg_fd", &tx_streamer::get_async_msg_fd)
+        .def("get_telemetry", &tx_streamer::get_telemetry)
+        .def("get_memory_footprint", &tx_streamer::get_memory_footprint);
 }
 
 #endif /* INCLUDED_UHD_STREAM_PYTHON_HPP */
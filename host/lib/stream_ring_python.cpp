@@ -0,0 +1,686 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include "stream_ring_python.hpp"
+#include <uhd/exception.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/config.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(UHD_PLATFORM_LINUX)
+#    define HAVE_NOTIFIER_FD
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#elif defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
+#    define HAVE_NOTIFIER_FD
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+
+/*! A file descriptor which is readable while a condition holds
+ *
+ * This lets an event loop (e.g., with asyncio's add_reader()) wait for the
+ * threads of the rings, instead of blocking a thread of its own. Linux uses an
+ * eventfd, other POSIX systems a pipe, and other systems have no descriptor.
+ * set() and clear() must be called with the lock which protects the condition.
+ */
+class ready_notifier
+{
+public:
+    ready_notifier()
+    {
+#if defined(UHD_PLATFORM_LINUX)
+        _read_fd  = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        _write_fd = _read_fd;
+#elif defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
+        int fds[2];
+        if (::pipe(fds) == 0) {
+            for (const int fd : fds) {
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+                ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+            _read_fd  = fds[0];
+            _write_fd = fds[1];
+        }
+#endif
+    }
+
+    ~ready_notifier()
+    {
+#ifdef HAVE_NOTIFIER_FD
+        if (_write_fd >= 0 && _write_fd != _read_fd) {
+            ::close(_write_fd);
+        }
+        if (_read_fd >= 0) {
+            ::close(_read_fd);
+        }
+#endif
+    }
+
+    //! Return the descriptor to wait for
+    int fileno() const
+    {
+        if (_read_fd < 0) {
+            throw uhd::not_implemented_error(
+                "No file descriptor for notifications on this platform");
+        }
+        return _read_fd;
+    }
+
+    void set()
+    {
+        if (_set || _write_fd < 0) {
+            return;
+        }
+        _set = true;
+#ifdef HAVE_NOTIFIER_FD
+        const uint64_t value = 1;
+        const ssize_t result = ::write(_write_fd, &value, _write_fd == _read_fd ? 8 : 1);
+        (void)result;
+#endif
+    }
+
+    void clear()
+    {
+        if (!_set) {
+            return;
+        }
+        _set = false;
+#ifdef HAVE_NOTIFIER_FD
+        uint64_t value;
+        const ssize_t result = ::read(_read_fd, &value, _write_fd == _read_fd ? 8 : 1);
+        (void)result;
+#endif
+    }
+
+private:
+    int _read_fd  = -1;
+    int _write_fd = -1;
+    bool _set     = false;
+};
+
+/*! Receives into a preallocated numpy ring on a thread of its own
+ *
+ * The ring is a numpy array of shape (num_segments, num_channels,
+ * segment_size), which is allocated once. The thread fills one segment per
+ * recv() call without ever taking the GIL, and get() hands the completed
+ * segments to Python in order, as views into the ring. A view stays valid
+ * until release() returns its segment to the thread. If Python doesn't release
+ * the segments fast enough, the thread waits, and the device reports an
+ * overflow in the metadata of the next segment. fileno() is readable while a
+ * segment is ready.
+ */
+class rx_stream_ring
+{
+public:
+    rx_stream_ring(uhd::rx_streamer::sptr rx_stream,
+        const py::dtype& dtype,
+        const size_t segment_size,
+        const size_t num_segments)
+        : _rx_stream(rx_stream)
+        , _num_chans(rx_stream->get_num_channels())
+        , _segment_size(segment_size)
+        , _num_segments(num_segments)
+        , _item_size(dtype.itemsize())
+        , _ring(dtype, std::vector<size_t>{num_segments, _num_chans, segment_size})
+        , _data(static_cast<char*>(_ring.mutable_data()))
+        , _num_free(num_segments)
+    {
+        if (segment_size == 0 || num_segments < 2) {
+            throw uhd::value_error("rx_stream_ring: Need a segment size of at least 1, "
+                                   "and at least 2 segments");
+        }
+    }
+
+    ~rx_stream_ring()
+    {
+        stop();
+    }
+
+    //! Start receiving on the thread, with \p timeout for every recv() call
+    void start(const double timeout)
+    {
+        if (_thread.joinable()) {
+            throw uhd::runtime_error("rx_stream_ring: Already started");
+        }
+        _stop = false;
+        _timeout = timeout;
+        _thread  = std::thread([this]() { _recv_loop(); });
+        uhd::set_thread_name(&_thread, "uhd_py_rx_ring");
+    }
+
+    //! Stop the thread. Segments which are ready can still be taken.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _free_cond.notify_all();
+        if (_thread.joinable()) {
+            py::gil_scoped_release release;
+            _thread.join();
+        }
+    }
+
+    /*! Take the next completed segment
+     *
+     * \return A tuple of a view of the samples, with shape (num_channels,
+     *         num_samps), and the rx_metadata_t of the recv() call which
+     *         filled it, or None if no segment completed within \p timeout
+     */
+    py::object get(const double timeout)
+    {
+        segment_t segment;
+        std::exception_ptr error;
+        bool got_segment = false;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(_mutex);
+            const auto ready = [this]() { return !_ready.empty() || _error; };
+            if (_ready_cond.wait_for(
+                    lock, std::chrono::duration<double>(timeout), ready)) {
+                if (_ready.empty()) {
+                    error = _error;
+                } else {
+                    segment = _ready.front();
+                    _ready.pop_front();
+                    _held.push_back(segment.index);
+                    got_segment = true;
+                    if (_ready.empty()) {
+                        _notifier.clear();
+                    }
+                }
+            }
+        }
+        // Python objects may only be touched with the GIL held
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if (!got_segment) {
+            return py::none();
+        }
+
+        char* data = _data + segment.index * _num_chans * _segment_size * _item_size;
+        py::array samples(_ring.dtype(),
+            std::vector<size_t>{_num_chans, segment.num_samps},
+            std::vector<size_t>{_segment_size * _item_size, _item_size},
+            data,
+            _ring);
+        return py::make_tuple(samples, segment.metadata);
+    }
+
+    //! Return the oldest segment which get() handed out to the thread
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_held.empty()) {
+                throw uhd::runtime_error("rx_stream_ring: No segment to release");
+            }
+            _held.pop_front();
+            _num_free++;
+        }
+        _free_cond.notify_one();
+    }
+
+    //! Return the number of completed segments which get() has not taken yet
+    size_t get_num_ready()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _ready.size();
+    }
+
+    //! Return the whole ring, with shape (num_segments, num_channels, segment_size)
+    py::array get_ring() const
+    {
+        return _ring;
+    }
+
+    //! Return a file descriptor which is readable while a segment is ready
+    int fileno() const
+    {
+        return _notifier.fileno();
+    }
+
+private:
+    struct segment_t
+    {
+        size_t index     = 0;
+        size_t num_samps = 0;
+        uhd::rx_metadata_t metadata;
+    };
+
+    void _recv_loop()
+    {
+        std::vector<void*> buffs(_num_chans);
+        size_t index = 0;
+        try {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _free_cond.wait(lock, [this]() { return _stop || _num_free > 0; });
+                    if (_stop) {
+                        return;
+                    }
+                }
+                char* data = _data + index * _num_chans * _segment_size * _item_size;
+                for (size_t chan = 0; chan < _num_chans; chan++) {
+                    buffs[chan] = data + chan * _segment_size * _item_size;
+                }
+
+                segment_t segment;
+                segment.index     = index;
+                segment.num_samps = _rx_stream->recv(
+                    buffs, _segment_size, segment.metadata, _timeout);
+                // Timeouts are not handed out, but every other error is
+                if (segment.num_samps == 0
+                    && segment.metadata.error_code
+                           == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                    continue;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _ready.push_back(segment);
+                    _num_free--;
+                    _notifier.set();
+                }
+                _ready_cond.notify_one();
+                index = (index + 1) % _num_segments;
+            }
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR("PYUHD", "rx_stream_ring: recv() failed: " << ex.what());
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _error = std::current_exception();
+                _notifier.set();
+            }
+            _ready_cond.notify_all();
+        }
+    }
+
+    const uhd::rx_streamer::sptr _rx_stream;
+    const size_t _num_chans;
+    const size_t _segment_size;
+    const size_t _num_segments;
+    const size_t _item_size;
+    py::array _ring;
+    char* const _data;
+    double _timeout = 0.1;
+
+    // The thread, and the state it shares with Python. Segments go from free to
+    // ready (filled by the thread) to held (handed out by get()) and back to
+    // free, in the order of the ring.
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _free_cond;
+    std::condition_variable _ready_cond;
+    bool _stop = false;
+    size_t _num_free;
+    std::deque<segment_t> _ready;
+    std::deque<size_t> _held;
+    std::exception_ptr _error;
+    ready_notifier _notifier;
+};
+
+/*! Sends from a preallocated numpy ring on a thread of its own
+ *
+ * Like rx_stream_ring, for the other direction: get() hands out the free
+ * segments in order, as writable views of shape (num_channels, segment_size).
+ * commit() queues the first samples of the oldest segment which get() handed
+ * out, and the thread sends them without the GIL, and then frees the segment.
+ * A second thread collects the async messages of the streamer, which
+ * recv_async_msg() returns. fileno() is readable while a segment is free, and
+ * async_msg_fileno() while an async message is waiting.
+ */
+class tx_stream_ring
+{
+public:
+    //! The most async messages which are kept, older ones are dropped
+    static constexpr size_t MAX_ASYNC_MSGS = 1000;
+
+    tx_stream_ring(uhd::tx_streamer::sptr tx_stream,
+        const py::dtype& dtype,
+        const size_t segment_size,
+        const size_t num_segments)
+        : _tx_stream(tx_stream)
+        , _num_chans(tx_stream->get_num_channels())
+        , _segment_size(segment_size)
+        , _num_segments(num_segments)
+        , _item_size(dtype.itemsize())
+        , _ring(dtype, std::vector<size_t>{num_segments, _num_chans, segment_size})
+        , _data(static_cast<char*>(_ring.mutable_data()))
+        , _num_free(num_segments)
+    {
+        if (segment_size == 0 || num_segments < 2) {
+            throw uhd::value_error("tx_stream_ring: Need a segment size of at least 1, "
+                                   "and at least 2 segments");
+        }
+        _free_notifier.set();
+    }
+
+    ~tx_stream_ring()
+    {
+        stop();
+    }
+
+    //! Start sending on the thread, with \p timeout for every send() call
+    void start(const double timeout)
+    {
+        if (_thread.joinable()) {
+            throw uhd::runtime_error("tx_stream_ring: Already started");
+        }
+        _stop    = false;
+        _timeout = timeout;
+        _thread  = std::thread([this]() { _send_loop(); });
+        uhd::set_thread_name(&_thread, "uhd_py_tx_ring");
+        _async_thread = std::thread([this]() { _async_msg_loop(); });
+        uhd::set_thread_name(&_async_thread, "uhd_py_tx_async");
+    }
+
+    //! Send the committed segments, and stop the threads
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _queued_cond.notify_all();
+        py::gil_scoped_release release;
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+        if (_async_thread.joinable()) {
+            _async_thread.join();
+        }
+    }
+
+    /*! Take the next free segment
+     *
+     * \return A writable view of the segment, with shape (num_channels,
+     *         segment_size), or None if no segment became free within
+     *         \p timeout
+     */
+    py::object get(const double timeout)
+    {
+        size_t index = 0;
+        std::exception_ptr error;
+        bool got_segment = false;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(_mutex);
+            const auto free = [this]() { return _num_free > 0 || _error; };
+            if (_free_cond.wait_for(lock, std::chrono::duration<double>(timeout), free)) {
+                if (_error) {
+                    error = _error;
+                } else {
+                    index      = _get_index;
+                    _get_index = (_get_index + 1) % _num_segments;
+                    _held.push_back(index);
+                    _num_free--;
+                    got_segment = true;
+                    if (_num_free == 0) {
+                        _free_notifier.clear();
+                    }
+                }
+            }
+        }
+        // Python objects may only be touched with the GIL held
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if (!got_segment) {
+            return py::none();
+        }
+
+        char* data = _data + index * _num_chans * _segment_size * _item_size;
+        return py::array(_ring.dtype(),
+            std::vector<size_t>{_num_chans, _segment_size},
+            std::vector<size_t>{_segment_size * _item_size, _item_size},
+            data,
+            _ring);
+    }
+
+    //! Queue the oldest segment which get() handed out for sending
+    void commit(const size_t num_samps, const uhd::tx_metadata_t& metadata)
+    {
+        if (num_samps > _segment_size) {
+            throw uhd::value_error("tx_stream_ring: More samples than fit a segment");
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_held.empty()) {
+                throw uhd::runtime_error("tx_stream_ring: No segment to commit");
+            }
+            _queued.push_back({_held.front(), num_samps, metadata});
+            _held.pop_front();
+        }
+        _queued_cond.notify_one();
+    }
+
+    //! Return the number of free segments
+    size_t get_num_free()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _num_free;
+    }
+
+    //! Return the oldest async message, or None if none is waiting
+    py::object recv_async_msg()
+    {
+        uhd::async_metadata_t async_metadata;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_async_msgs.empty()) {
+                return py::none();
+            }
+            async_metadata = _async_msgs.front();
+            _async_msgs.pop_front();
+            if (_async_msgs.empty()) {
+                _async_msg_notifier.clear();
+            }
+        }
+        return py::cast(async_metadata);
+    }
+
+    //! Return the whole ring, with shape (num_segments, num_channels, segment_size)
+    py::array get_ring() const
+    {
+        return _ring;
+    }
+
+    //! Return a file descriptor which is readable while a segment is free
+    int fileno() const
+    {
+        return _free_notifier.fileno();
+    }
+
+    //! Return a file descriptor which is readable while an async message waits
+    int async_msg_fileno() const
+    {
+        return _async_msg_notifier.fileno();
+    }
+
+private:
+    struct segment_t
+    {
+        size_t index     = 0;
+        size_t num_samps = 0;
+        uhd::tx_metadata_t metadata;
+    };
+
+    void _send_loop()
+    {
+        std::vector<const void*> buffs(_num_chans);
+        try {
+            while (true) {
+                segment_t segment;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _queued_cond.wait(
+                        lock, [this]() { return _stop || !_queued.empty(); });
+                    if (_queued.empty()) {
+                        return;
+                    }
+                    segment = _queued.front();
+                    _queued.pop_front();
+                }
+
+                // Keep sending the rest of the segment after a timeout, unless
+                // the ring is stopping
+                const char* data =
+                    _data + segment.index * _num_chans * _segment_size * _item_size;
+                size_t num_sent = 0;
+                do {
+                    for (size_t chan = 0; chan < _num_chans; chan++) {
+                        buffs[chan] =
+                            data + (chan * _segment_size + num_sent) * _item_size;
+                    }
+                    const size_t result = _tx_stream->send(
+                        buffs, segment.num_samps - num_sent, segment.metadata, _timeout);
+                    num_sent += result;
+                    if (result) {
+                        segment.metadata.start_of_burst = false;
+                        segment.metadata.has_time_spec  = false;
+                    } else if (_is_stopping()) {
+                        break;
+                    }
+                } while (num_sent < segment.num_samps);
+
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _num_free++;
+                    _free_notifier.set();
+                }
+                _free_cond.notify_one();
+            }
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR("PYUHD", "tx_stream_ring: send() failed: " << ex.what());
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _error = std::current_exception();
+                _free_notifier.set();
+            }
+            _free_cond.notify_all();
+        }
+    }
+
+    void _async_msg_loop()
+    {
+        try {
+            while (!_is_stopping()) {
+                uhd::async_metadata_t async_metadata;
+                if (!_tx_stream->recv_async_msg(async_metadata, _timeout)) {
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_async_msgs.size() == MAX_ASYNC_MSGS) {
+                    _async_msgs.pop_front();
+                }
+                _async_msgs.push_back(async_metadata);
+                _async_msg_notifier.set();
+            }
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR(
+                "PYUHD", "tx_stream_ring: recv_async_msg() failed: " << ex.what());
+        }
+    }
+
+    bool _is_stopping()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stop;
+    }
+
+    const uhd::tx_streamer::sptr _tx_stream;
+    const size_t _num_chans;
+    const size_t _segment_size;
+    const size_t _num_segments;
+    const size_t _item_size;
+    py::array _ring;
+    char* const _data;
+    double _timeout = 0.1;
+
+    // The threads, and the state they share with Python. Segments go from free
+    // to held (handed out by get()) to queued (by commit()) and back to free
+    // once they were sent, in the order of the ring.
+    std::thread _thread;
+    std::thread _async_thread;
+    std::mutex _mutex;
+    std::condition_variable _free_cond;
+    std::condition_variable _queued_cond;
+    bool _stop = false;
+    size_t _num_free;
+    size_t _get_index = 0;
+    std::deque<size_t> _held;
+    std::deque<segment_t> _queued;
+    std::exception_ptr _error;
+    ready_notifier _free_notifier;
+    std::deque<uhd::async_metadata_t> _async_msgs;
+    ready_notifier _async_msg_notifier;
+};
+
+} // namespace
+
+void export_stream_ring(py::module& m)
+{
+    py::class_<rx_stream_ring>(m,
+        "rx_stream_ring",
+        "Receives into a preallocated ring of numpy segments on a C++ thread, "
+        "without the GIL. get() returns views of the completed segments, which "
+        "stay valid until release().")
+        .def(py::init<uhd::rx_streamer::sptr, const py::dtype&, size_t, size_t>(),
+            py::arg("rx_streamer"),
+            py::arg("dtype"),
+            py::arg("segment_size"),
+            py::arg("num_segments") = 16)
+        .def("start", &rx_stream_ring::start, py::arg("timeout") = 0.1)
+        .def("stop", &rx_stream_ring::stop)
+        .def("get", &rx_stream_ring::get, py::arg("timeout") = 0.1)
+        .def("release", &rx_stream_ring::release)
+        .def("get_num_ready", &rx_stream_ring::get_num_ready)
+        .def("get_ring", &rx_stream_ring::get_ring)
+        .def("fileno", &rx_stream_ring::fileno);
+
+    py::class_<tx_stream_ring>(m,
+        "tx_stream_ring",
+        "Sends from a preallocated ring of numpy segments on a C++ thread, "
+        "without the GIL. get() returns views of the free segments, which "
+        "commit() queues for sending.")
+        .def(py::init<uhd::tx_streamer::sptr, const py::dtype&, size_t, size_t>(),
+            py::arg("tx_streamer"),
+            py::arg("dtype"),
+            py::arg("segment_size"),
+            py::arg("num_segments") = 16)
+        .def("start", &tx_stream_ring::start, py::arg("timeout") = 0.1)
+        .def("stop", &tx_stream_ring::stop)
+        .def("get", &tx_stream_ring::get, py::arg("timeout") = 0.1)
+        .def("commit",
+            &tx_stream_ring::commit,
+            py::arg("num_samps"),
+            py::arg("metadata"))
+        .def("get_num_free", &tx_stream_ring::get_num_free)
+        .def("recv_async_msg", &tx_stream_ring::recv_async_msg)
+        .def("get_ring", &tx_stream_ring::get_ring)
+        .def("fileno", &tx_stream_ring::fileno)
+        .def("async_msg_fileno", &tx_stream_ring::async_msg_fileno);
+}
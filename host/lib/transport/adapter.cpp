@@ -18,6 +18,14 @@ adapter_id_t adapter_ctx::register_adapter(adapter_info& info)
     } else {
         adapter_id_t id = _id_map.size() + 1;
         _id_map.emplace(std::make_pair(key, id));
+        _numa_nodes.emplace(std::make_pair(id, info.get_numa_node()));
         return id;
     }
 }
+
+int adapter_ctx::get_numa_node(const adapter_id_t id)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _numa_nodes.find(id);
+    return (it == _numa_nodes.end()) ? -1 : it->second;
+}
@@ -7,9 +7,19 @@
 
 #include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/zero_copy.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/utils/numa.hpp>
 #include <boost/shared_array.hpp>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
 #include <vector>
 
+#ifdef HAVE_MAP_HUGETLB
+#    include <sys/mman.h>
+#    include <linux/mman.h>
+#endif
+
 using namespace uhd::transport;
 
 //! pad the byte count to a multiple of alignment
@@ -50,17 +60,143 @@ private:
     boost::shared_array<char> _mem;
 };
 
+/***********************************************************************
+ * Hugepage allocation
+ **********************************************************************/
+#ifdef HAVE_MAP_HUGETLB
+/*! Allocate memory backed by hugepages
+ *
+ * 1 GiB pages are only tried if at least one of them would be filled, since
+ * the remainder of the last page is wasted.
+ *
+ * \return the memory, or an empty array if no hugepages are available
+ */
+static boost::shared_array<char> alloc_hugepages(const size_t size, const int numa_node)
+{
+    static const struct
+    {
+        size_t page_size;
+        size_t min_size;
+        int flag;
+        const char* name;
+    } page_types[] = {
+        {size_t(1) << 30, size_t(1) << 30, MAP_HUGE_1GB, "1 GiB"},
+        {size_t(1) << 21, 0, MAP_HUGE_2MB, "2 MiB"},
+    };
+
+    for (const auto& page_type : page_types) {
+        if (size < page_type.min_size) {
+            continue;
+        }
+        const size_t map_size = pad_to_boundary(size, page_type.page_size);
+        void* mem             = mmap(nullptr,
+            map_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_type.flag,
+            -1,
+            0);
+        if (mem == MAP_FAILED) {
+            UHD_LOG_TRACE("BUFFER_POOL",
+                "Could not map " << page_type.name << " hugepages: " << strerror(errno));
+            continue;
+        }
+        if (numa_node >= 0) {
+            uhd::numa::bind_to_node(mem, map_size, numa_node);
+        }
+        UHD_LOG_INFO("BUFFER_POOL",
+            "Using " << page_type.name << " hugepages for " << map_size
+                     << " bytes of frame buffers");
+        return boost::shared_array<char>(static_cast<char*>(mem),
+            [map_size](char* p) { munmap(p, map_size); });
+    }
+    return boost::shared_array<char>();
+}
+#else
+static boost::shared_array<char> alloc_hugepages(const size_t, const int)
+{
+    return boost::shared_array<char>();
+}
+#endif /* HAVE_MAP_HUGETLB */
+
+/***********************************************************************
+ * Memory hooks
+ **********************************************************************/
+static std::mutex memory_hooks_mutex;
+static buffer_pool::memory_hook_t memory_hook_on_alloc;
+static buffer_pool::memory_hook_t memory_hook_on_free;
+
+void buffer_pool::set_memory_hooks(
+    const memory_hook_t& on_alloc, const memory_hook_t& on_free)
+{
+    std::lock_guard<std::mutex> lock(memory_hooks_mutex);
+    memory_hook_on_alloc = on_alloc;
+    memory_hook_on_free  = on_free;
+}
+
+/*! Report \p mem to the memory hooks, if there are any
+ *
+ * \return an array which calls the on_free hook before it frees \p mem
+ */
+static boost::shared_array<char> apply_memory_hooks(
+    boost::shared_array<char> mem, const size_t mem_size)
+{
+    buffer_pool::memory_hook_t on_alloc, on_free;
+    {
+        std::lock_guard<std::mutex> lock(memory_hooks_mutex);
+        on_alloc = memory_hook_on_alloc;
+        on_free  = memory_hook_on_free;
+    }
+    if (on_alloc) {
+        on_alloc(mem.get(), mem_size);
+    }
+    if (!on_free) {
+        return mem;
+    }
+    // The copy of mem in the deleter keeps the memory alive until on_free returns
+    return boost::shared_array<char>(
+        mem.get(), [mem, mem_size, on_free](char* p) { on_free(p, mem_size); });
+}
+
 /***********************************************************************
  * Buffer pool factor function
  **********************************************************************/
-buffer_pool::sptr buffer_pool::make(
-    const size_t num_buffs, const size_t buff_size, const size_t alignment)
+buffer_pool::sptr buffer_pool::make(const size_t num_buffs,
+    const size_t buff_size,
+    const size_t alignment,
+    const int numa_node,
+    const bool use_hugepages)
 {
     // 1) pad the buffer size to be a multiple of alignment
     // 2) pad the overall memory size for room after alignment
     // 3) allocate the memory in one block of sufficient size
     const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
-    boost::shared_array<char> mem(new char[padded_buff_size * num_buffs + alignment - 1]);
+    const size_t mem_size         = padded_buff_size * num_buffs + alignment - 1;
+    boost::shared_array<char> mem;
+    if (use_hugepages) {
+        mem = alloc_hugepages(mem_size, numa_node);
+        if (!mem) {
+            UHD_LOG_WARNING("BUFFER_POOL",
+                "Could not allocate hugepages for frame buffers, using regular pages. "
+                "Check the number of hugepages reserved in "
+                "/proc/sys/vm/nr_hugepages.");
+        }
+    }
+    if (!mem && numa_node >= 0) {
+        char* numa_mem =
+            static_cast<char*>(uhd::numa::alloc_on_node(mem_size, numa_node));
+        if (numa_mem) {
+            mem.reset(numa_mem,
+                [mem_size](char* p) { uhd::numa::free_on_node(p, mem_size); });
+        } else {
+            UHD_LOG_DEBUG("BUFFER_POOL",
+                "Could not allocate buffers on NUMA node " << numa_node
+                                                           << ", using default memory");
+        }
+    }
+    if (!mem) {
+        mem.reset(new char[mem_size]);
+    }
+    mem = apply_memory_hooks(mem, mem_size);
 
     // Fill a vector with boundary-aligned points in the memory
     const size_t mem_start = pad_to_boundary(size_t(mem.get()), alignment);
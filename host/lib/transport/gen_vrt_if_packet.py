@@ -68,18 +68,6 @@ static const uint32_t occ_table[] = {0, 2, 1, 3};
 const uint32_t VRLP = ('V' << 24) | ('R' << 16) | ('L' << 8) | ('P' << 0);
 const uint32_t VEND = ('V' << 24) | ('E' << 16) | ('N' << 8) | ('D' << 0);
 
-UHD_INLINE static uint32_t chdr_to_vrt(const uint32_t chdr, if_packet_info_t &info)
-{
-    const uint32_t bytes = chdr & 0xffff;
-    uint32_t vrt = (bytes + 3)/4;
-    info.packet_count = (chdr >> 16) & 0xfff;
-    vrt |= ((chdr >> 31) & 0x1) << 30; //context packet
-    vrt |= ((chdr >> 29) & 0x1) << 20; //has tsf
-    vrt |= ((chdr >> 28) & 0x1) << 24; //has eob
-    vrt |= (0x1) << 28; //has sid (always)
-    return vrt;
-}
-
 UHD_INLINE static uint32_t vrt_to_chdr(const uint32_t vrt, const if_packet_info_t &info)
 {
     const uint32_t words32 = vrt & 0xffff;
@@ -256,6 +244,54 @@ UHD_INLINE void __if_hdr_unpack_${suffix}(
     }
 }
 
+/***********************************************************************
+ * CHDR unpacking:
+ * CHDR packets always have a SID, and never have a class ID, integer time
+ * or trailer. That leaves the fractional time as the only optional field,
+ * so the header is parsed directly instead of being translated into a VRT
+ * header word and going through the jump table.
+ **********************************************************************/
+void vrt::if_hdr_unpack_chdr_${suffix}(
+    const uint32_t *packet_buff,
+    if_packet_info_t &if_packet_info
+){
+    const uint32_t chdr = ${XE_MACRO}(packet_buff[0]);
+    const size_t packet_words32 = ((chdr & 0xffff) + 3)/4;
+
+    //failure case
+    if (if_packet_info.num_packet_words32 < packet_words32)
+        throw uhd::value_error("bad vrt header or packet fragment");
+
+    const bool has_tsf = ((chdr >> 29) & 0x1) != 0;
+    const size_t num_header_words = has_tsf ? 4 : 2;
+
+    //another failure case
+    if (packet_words32 < num_header_words)
+        throw uhd::value_error("bad vrt header or invalid packet length");
+
+    //extract fields from the header
+    if_packet_info.link_type = if_packet_info_t::LINK_TYPE_CHDR;
+    if_packet_info.packet_type = if_packet_info_t::packet_type_t(((chdr >> 31) & 0x1) << 1);
+    if_packet_info.packet_count = (chdr >> 16) & 0xfff;
+    if_packet_info.sob = false;
+    if_packet_info.eob = ((chdr >> 28) & 0x1) != 0;
+    if_packet_info.has_sid = true;
+    if_packet_info.sid = ${XE_MACRO}(packet_buff[1]);
+    if_packet_info.has_cid = false;
+    if_packet_info.has_tsi = false;
+    if_packet_info.has_tsf = has_tsf;
+    if (has_tsf){
+        if_packet_info.tsf = uint64_t(${XE_MACRO}(packet_buff[2])) << 32;
+        if_packet_info.tsf |= ${XE_MACRO}(packet_buff[3]);
+    }
+    if_packet_info.has_tlr = false;
+
+    if_packet_info.num_header_words32 = num_header_words;
+    if_packet_info.num_payload_words32 = packet_words32 - num_header_words;
+    if_packet_info.num_payload_bytes = if_packet_info.num_payload_words32*sizeof(uint32_t)
+        - ((~chdr + 1) & 0x3);
+}
+
 /***********************************************************************
  * link layer + VRT IF packing
  **********************************************************************/
@@ -310,15 +346,8 @@ void vrt::if_hdr_unpack_${suffix}(
         break;
 
     case if_packet_info_t::LINK_TYPE_CHDR:
-    {
-        const uint32_t chdr = ${XE_MACRO}(packet_buff[0]);
-        vrt_hdr_word32 = chdr_to_vrt(chdr, if_packet_info);
-        size_t packet_count = if_packet_info.packet_count;
-        __if_hdr_unpack_${suffix}(packet_buff, if_packet_info, vrt_hdr_word32);
-        if_packet_info.num_payload_bytes -= (~chdr + 1) & 0x3;
-        if_packet_info.packet_count = packet_count;
+        vrt::if_hdr_unpack_chdr_${suffix}(packet_buff, if_packet_info);
         break;
-    }
 
     case if_packet_info_t::LINK_TYPE_VRLP:
     {
@@ -40,9 +40,10 @@ std::vector<uhd::transport::if_addrs_t> uhd::transport::get_if_addrs(void)
 
             // append a new set of interface addresses
             if_addrs_t if_addr;
-            if_addr.inet  = sockaddr_to_ip_addr(iter->ifa_addr).to_string();
-            if_addr.mask  = sockaddr_to_ip_addr(iter->ifa_netmask).to_string();
-            if_addr.bcast = sockaddr_to_ip_addr(iter->ifa_broadaddr).to_string();
+            if_addr.inet   = sockaddr_to_ip_addr(iter->ifa_addr).to_string();
+            if_addr.mask   = sockaddr_to_ip_addr(iter->ifa_netmask).to_string();
+            if_addr.bcast  = sockaddr_to_ip_addr(iter->ifa_broadaddr).to_string();
+            if_addr.ifname = iter->ifa_name;
 
             // correct the bcast address when its same as the gateway
             if (if_addr.inet == if_addr.bcast
@@ -8,8 +8,13 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/utils/fast_log.hpp>
+#include <uhdlib/utils/trace_points.hpp>
 #include <boost/circular_buffer.hpp>
 #include <cassert>
+#include <limits>
+#include <memory>
+#include <vector>
 
 namespace uhd { namespace transport {
 
@@ -46,6 +51,13 @@ protected:
 /*!
  * Mux class that intercepts packets from the link and distributes them to
  * queues for each client that is not the caller of the recv() function
+ *
+ * Every received frame is offered to the receivers until one claims it. Frames
+ * tend to arrive in bursts for the same receiver, and the caller of recv() is
+ * waiting for a frame of its own, so the receiver which claimed the previous
+ * frame and the caller are asked first. In the common cases, this claims a
+ * frame with one or two callbacks, no matter how many receivers share the
+ * link.
  */
 class inline_recv_mux
 {
@@ -61,14 +73,14 @@ public:
      */
     void connect(inline_recv_cb* cb)
     {
-        UHD_ASSERT_THROW(_queues.count(cb) == 0);
+        UHD_ASSERT_THROW(_rcvr_idxs.count(cb) == 0);
         /* Always create queue of max size, since we don't know when there are
          * virtual channels (which share frames)
          */
-        auto queue =
-            new boost::circular_buffer<frame_buff*>(_link->get_num_recv_frames());
-        _queues[cb] = queue;
-        _callbacks.push_back(cb);
+        _rcvrs.push_back(rcvr_t{cb,
+            std::make_unique<boost::circular_buffer<frame_buff*>>(
+                _link->get_num_recv_frames())});
+        _update_rcvr_idxs();
     }
 
     /*!
@@ -77,15 +89,16 @@ public:
      */
     void disconnect(inline_recv_cb* cb)
     {
-        auto queue = _queues.at(cb);
-        while (!queue->empty()) {
-            frame_buff* buff = queue->front();
+        const size_t idx = _rcvr_idxs.at(cb);
+        auto& queue      = *_rcvrs[idx].queue;
+        while (!queue.empty()) {
+            frame_buff* buff = queue.front();
             _link->release_recv_buff(frame_buff::uptr(buff));
-            queue->pop_front();
+            queue.pop_front();
         }
-        delete queue;
-        _queues.erase(cb);
-        _callbacks.remove(cb);
+        _rcvrs.erase(_rcvrs.begin() + idx);
+        _update_rcvr_idxs();
+        _last_idx = 0;
     }
 
     /*!
@@ -94,7 +107,7 @@ public:
      */
     UHD_FORCE_INLINE bool is_empty(void) const
     {
-        return _callbacks.empty();
+        return _rcvrs.empty();
     }
 
     /*!
@@ -106,38 +119,22 @@ public:
      */
     frame_buff::uptr recv(inline_recv_cb* cb, recv_link_if* recv_link, int32_t timeout_ms)
     {
-        auto queue = _queues.at(cb);
-        if (!queue->empty()) {
-            frame_buff* buff = queue->front();
-            queue->pop_front();
+        const size_t caller_idx = _rcvr_idxs.at(cb);
+        auto& queue             = *_rcvrs[caller_idx].queue;
+        if (!queue.empty()) {
+            frame_buff* buff = queue.front();
+            queue.pop_front();
             return frame_buff::uptr(buff);
         }
         while (true) {
             frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
             /* Process buffer */
             if (buff) {
-                bool rcvr_found = false;
-                for (auto& rcvr : _callbacks) {
-                    if (rcvr->callback(buff, recv_link)) {
-                        rcvr_found = true;
-                        if (buff) {
-                            if (rcvr == cb) {
-                                return frame_buff::uptr(std::move(buff));
-                            } else {
-                                /* NOTE: Should not overflow, by construction
-                                 * Every queue can hold link->get_num_recv_frames()
-                                 */
-                                _queues[rcvr]->push_back(buff.release());
-                            }
-                        }
-                        /* Continue looping if buffer was consumed */
-                        break;
-                    }
-                }
-                if (not rcvr_found) {
-                    UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
-                    recv_link->release_recv_buff(std::move(buff));
+                const size_t rcvr_idx = _dispatch(buff, recv_link, caller_idx);
+                if (rcvr_idx == caller_idx && buff) {
+                    return frame_buff::uptr(std::move(buff));
                 }
+                /* Continue looping if buffer was consumed or queued */
             } else { /* Timeout */
                 return frame_buff::uptr();
             }
@@ -146,33 +143,16 @@ public:
 
     bool recv_flow_ctrl(inline_recv_cb* cb, recv_link_if* recv_link, int32_t timeout_ms)
     {
+        const size_t caller_idx = _rcvr_idxs.at(cb);
         while (true) {
             frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
             /* Process buffer */
             if (buff) {
-                bool rcvr_found = false;
-                for (auto& rcvr : _callbacks) {
-                    if (rcvr->callback(buff, recv_link)) {
-                        rcvr_found = true;
-                        if (rcvr == cb) {
-                            assert(!buff);
-                            return true;
-                        } else if (buff) {
-                            /* NOTE: Should not overflow, by construction
-                             * Every queue can hold link->get_num_recv_frames()
-                             */
-                            _queues[rcvr]->push_back(buff.release());
-                        } else {
-                            /* Continue looping if buffer was consumed and
-                               receiver is not the requested one */
-                            break;
-                        }
-                    }
-                }
-                if (not rcvr_found) {
-                    UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
-                    recv_link->release_recv_buff(std::move(buff));
+                if (_dispatch(buff, recv_link, caller_idx) == caller_idx) {
+                    assert(!buff);
+                    return true;
                 }
+                /* Continue looping if buffer was consumed or queued */
             } else { /* Timeout */
                 return false;
             }
@@ -180,9 +160,72 @@ public:
     }
 
 private:
+    struct rcvr_t
+    {
+        inline_recv_cb* cb;
+        std::unique_ptr<boost::circular_buffer<frame_buff*>> queue;
+    };
+
+    static constexpr size_t NO_RCVR = std::numeric_limits<size_t>::max();
+
+    /*!
+     * Offer a frame to the receivers until one claims it
+     *
+     * If a receiver other than the caller claims the frame without consuming
+     * it, the frame is put into that receiver's queue. A frame which no
+     * receiver claims is dropped.
+     *
+     * \return the index of the receiver which claimed the frame, or NO_RCVR
+     */
+    UHD_FORCE_INLINE size_t _dispatch(
+        frame_buff::uptr& buff, recv_link_if* recv_link, const size_t caller_idx)
+    {
+        size_t rcvr_idx = NO_RCVR;
+        if (_rcvrs[_last_idx].cb->callback(buff, recv_link)) {
+            rcvr_idx = _last_idx;
+        } else if (caller_idx != _last_idx
+                   && _rcvrs[caller_idx].cb->callback(buff, recv_link)) {
+            rcvr_idx = caller_idx;
+        } else {
+            for (size_t i = 0; i < _rcvrs.size(); i++) {
+                if (i != _last_idx && i != caller_idx
+                    && _rcvrs[i].cb->callback(buff, recv_link)) {
+                    rcvr_idx = i;
+                    break;
+                }
+            }
+        }
+
+        if (rcvr_idx == NO_RCVR) {
+            UHD_LOG_FAST_DEBUG("IO_SRV", "Dropping packet with no receiver");
+            recv_link->release_recv_buff(std::move(buff));
+            return NO_RCVR;
+        }
+        _last_idx = rcvr_idx;
+        if (rcvr_idx != caller_idx && buff) {
+            /* NOTE: Should not overflow, by construction
+             * Every queue can hold link->get_num_recv_frames()
+             */
+            _rcvrs[rcvr_idx].queue->push_back(buff.release());
+        }
+        return rcvr_idx;
+    }
+
+    void _update_rcvr_idxs()
+    {
+        _rcvr_idxs.clear();
+        for (size_t i = 0; i < _rcvrs.size(); i++) {
+            _rcvr_idxs[_rcvrs[i].cb] = i;
+        }
+    }
+
     recv_link_if* _link;
-    std::list<inline_recv_cb*> _callbacks;
-    std::unordered_map<inline_recv_cb*, boost::circular_buffer<frame_buff*>*> _queues;
+    //! The receivers, in the order in which they were connected
+    std::vector<rcvr_t> _rcvrs;
+    //! The index into _rcvrs of every receiver
+    std::unordered_map<inline_recv_cb*, size_t> _rcvr_idxs;
+    //! The index of the receiver which claimed the last frame
+    size_t _last_idx = 0;
 };
 
 class inline_recv_io : public virtual recv_io_if, public virtual inline_recv_cb
@@ -218,6 +261,7 @@ public:
     frame_buff::uptr get_recv_buff(int32_t timeout_ms) override
     {
         auto buff = _io_srv->recv(this, _data_link.get(), timeout_ms);
+        UHD_TRACE_POINT(io_get_recv_buff, this, bool(buff));
         if (buff) {
             _num_frames_in_use++;
             assert(_num_frames_in_use <= _num_recv_frames);
@@ -227,6 +271,7 @@ public:
 
     void release_recv_buff(frame_buff::uptr buff) override
     {
+        UHD_TRACE_POINT(io_release_recv_buff, this);
         _fc_cb(frame_buff::uptr(std::move(buff)), _data_link.get(), _fc_link.get());
         _num_frames_in_use--;
     }
@@ -280,8 +325,10 @@ public:
         }
 
         while (!_fc_cb(num_bytes)) {
+            UHD_TRACE_POINT(io_fc_wait, this, num_bytes);
             const bool updated =
                 _io_srv->recv_flow_ctrl(this, _recv_link.get(), timeout_ms);
+            UHD_TRACE_POINT(io_fc_update, this, updated);
 
             if (!updated) {
                 return false;
@@ -304,6 +351,7 @@ public:
     void release_send_buff(frame_buff::uptr buff) override
     {
         // Send the packet using callback
+        UHD_TRACE_POINT(io_send, this, buff->packet_size());
         _send_cb(std::move(buff), _send_link.get());
         _num_frames_in_use--;
     }
@@ -483,7 +531,7 @@ frame_buff::uptr inline_io_service::recv(
                 }
                 /* Retry receive if got buffer but it got consumed */
             } else {
-                UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
+                UHD_LOG_FAST_DEBUG("IO_SRV", "Dropping packet with no receiver");
                 recv_link->release_recv_buff(std::move(buff));
             }
         } else { /* Timeout */
@@ -514,7 +562,7 @@ bool inline_io_service::recv_flow_ctrl(
                 assert(!buff);
                 return true;
             } else {
-                UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
+                UHD_LOG_FAST_DEBUG("IO_SRV", "Dropping packet with no receiver");
                 recv_link->release_recv_buff(std::move(buff));
             }
         } else { /* Timeout */
@@ -0,0 +1,388 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/io_uring_recv.hpp>
+#include <string>
+
+#ifdef HAVE_IO_URING
+#    include <linux/io_uring.h>
+#    include <poll.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstring>
+#endif
+
+using namespace uhd::transport;
+
+#ifdef HAVE_IO_URING
+
+namespace {
+
+constexpr char LOG_ID[] = "IO_URING";
+
+//! Number of submission queue entries. We only ever submit the receive request
+// and a cancellation for it.
+constexpr unsigned SQ_ENTRIES = 4;
+
+constexpr uint64_t RECV_USER_DATA   = 1;
+constexpr uint64_t CANCEL_USER_DATA = 2;
+constexpr uint16_t BUF_GROUP_ID     = 0;
+
+//! Maximum number of entries of a provided buffer ring
+constexpr size_t MAX_FRAMES = 32768;
+
+//! How long the destructor waits for the kernel to cancel the receive request
+constexpr int32_t CANCEL_TIMEOUT_MS = 100;
+
+std::string errno_str(const std::string& what, const int err)
+{
+    return what + ": " + strerror(err);
+}
+
+template <typename T>
+T load_acquire(const T* p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+void store_release(T* p, const T value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+} // namespace
+
+class io_uring_recv_impl : public io_uring_recv
+{
+public:
+    io_uring_recv_impl(
+        const int sock_fd, const std::vector<void*>& frames, const size_t frame_size)
+        : _sock_fd(sock_fd), _frames(frames), _frame_size(frame_size)
+    {
+        try {
+            _setup_ring();
+            _setup_buf_ring();
+            _arm();
+            // Kernels that know io_uring receives, but not multishot receives,
+            // reject the request right away
+            io_uring_cqe cqe;
+            if (_pop_cqe(cqe) && cqe.res < 0) {
+                throw uhd::os_error(errno_str("Multishot receive failed", -cqe.res));
+            }
+        } catch (...) {
+            _cleanup();
+            throw;
+        }
+    }
+
+    ~io_uring_recv_impl() override
+    {
+        if (_armed) {
+            _cancel();
+        }
+        _cleanup();
+    }
+
+    size_t recv(void*& mem, int32_t timeout_ms) override
+    {
+        while (true) {
+            io_uring_cqe cqe;
+            if (_pop_cqe(cqe)) {
+                if (cqe.user_data != RECV_USER_DATA) {
+                    continue;
+                }
+                // Without this flag, the receive request has terminated
+                if (!(cqe.flags & IORING_CQE_F_MORE)) {
+                    _armed = false;
+                }
+                if (cqe.res == -ENOBUFS) {
+                    // The kernel filled every frame before we consumed them.
+                    // The remaining packets wait in the socket buffer until we
+                    // re-arm the request.
+                    continue;
+                }
+                if (cqe.res < 0) {
+                    throw uhd::io_error(errno_str("recv error on socket", -cqe.res));
+                }
+                if (!(cqe.flags & IORING_CQE_F_BUFFER)) {
+                    continue;
+                }
+                // Hand out the frame that the kernel received into, and give
+                // it the caller's frame in exchange
+                const uint16_t buf_id = cqe.flags >> IORING_CQE_BUFFER_SHIFT;
+                void* data            = _frames[buf_id];
+                _frames[buf_id]       = mem;
+                _provide_buf(buf_id);
+                mem = data;
+                if (cqe.res == 0) {
+                    throw uhd::io_error("socket closed");
+                }
+                return static_cast<size_t>(cqe.res);
+            }
+
+            if (!_armed) {
+                _arm();
+                continue;
+            }
+            if (timeout_ms == 0) {
+                return 0;
+            }
+            // The ring is readable when there are completions
+            pollfd pfd{_ring_fd, POLLIN, 0};
+            const int ret = ::poll(&pfd, 1, timeout_ms);
+            if (ret == 0) {
+                return 0; // timeout
+            }
+            if (ret < 0 && errno != EINTR) {
+                throw uhd::io_error(errno_str("poll error on io_uring", errno));
+            }
+            // Check for completions once more, but don't wait a second time
+            timeout_ms = 0;
+        }
+    }
+
+private:
+    void _setup_ring()
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        // Every frame can produce a completion before we consume any, plus
+        // the ones for errors and cancellation
+        params.flags      = IORING_SETUP_CQSIZE;
+        params.cq_entries = static_cast<unsigned>(2 * _frames.size());
+        _ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, SQ_ENTRIES, &params));
+        if (_ring_fd < 0) {
+            throw uhd::os_error(errno_str("io_uring_setup() failed", errno));
+        }
+
+        _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+        }
+        _sq_ring = _mmap_ring(_sq_ring_size, IORING_OFF_SQ_RING);
+        _cq_ring = (params.features & IORING_FEAT_SINGLE_MMAP)
+                       ? _sq_ring
+                       : _mmap_ring(_cq_ring_size, IORING_OFF_CQ_RING);
+        _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        _sqes      = static_cast<io_uring_sqe*>(_mmap_ring(_sqes_size, IORING_OFF_SQES));
+
+        auto* sq  = static_cast<uint8_t*>(_sq_ring);
+        auto* cq  = static_cast<uint8_t*>(_cq_ring);
+        _sq_tail  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        _sq_mask  = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        _sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        _cq_head  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        _cq_tail  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        _cq_mask  = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        _cqes     = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    }
+
+    void* _mmap_ring(const size_t size, const uint64_t offset)
+    {
+        void* mem = mmap(nullptr,
+            size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            _ring_fd,
+            static_cast<off_t>(offset));
+        if (mem == MAP_FAILED) {
+            throw uhd::os_error(errno_str("Cannot map io_uring", errno));
+        }
+        return mem;
+    }
+
+    void _setup_buf_ring()
+    {
+        _buf_ring_size = _frames.size() * sizeof(io_uring_buf);
+        void* mem      = mmap(nullptr,
+            _buf_ring_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0);
+        if (mem == MAP_FAILED) {
+            throw uhd::os_error(errno_str("Cannot allocate buffer ring", errno));
+        }
+        // Don't use io_uring_buf_ring::bufs: in C++, the kernel header puts an
+        // empty struct in front of the flexible array, which moves it
+        _buf_ring = static_cast<io_uring_buf_ring*>(mem);
+        _bufs     = static_cast<io_uring_buf*>(mem);
+
+        io_uring_buf_reg reg;
+        std::memset(&reg, 0, sizeof(reg));
+        reg.ring_addr    = reinterpret_cast<uint64_t>(_buf_ring);
+        reg.ring_entries = static_cast<uint32_t>(_frames.size());
+        reg.bgid         = BUF_GROUP_ID;
+        if (syscall(__NR_io_uring_register, _ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1)
+            != 0) {
+            throw uhd::os_error(errno_str("Cannot register buffer ring", errno));
+        }
+        for (size_t i = 0; i < _frames.size(); i++) {
+            _provide_buf(static_cast<uint16_t>(i));
+        }
+    }
+
+    //! Give frame \p buf_id back to the kernel
+    void _provide_buf(const uint16_t buf_id)
+    {
+        // Don't assign the entry as a whole: the ring tail overlays the
+        // reserved field of the first entry
+        io_uring_buf& buf = _bufs[_buf_ring_tail & (_frames.size() - 1)];
+        buf.addr          = reinterpret_cast<uint64_t>(_frames[buf_id]);
+        buf.len           = static_cast<uint32_t>(_frame_size);
+        buf.bid           = buf_id;
+        _buf_ring_tail++;
+        store_release(&_buf_ring->tail, _buf_ring_tail);
+    }
+
+    //! Submit a single request
+    void _submit(const io_uring_sqe& request)
+    {
+        const unsigned tail = *_sq_tail;
+        const unsigned idx  = tail & _sq_mask;
+        _sqes[idx]          = request;
+        _sq_array[idx]      = idx;
+        store_release(_sq_tail, tail + 1);
+        if (syscall(__NR_io_uring_enter, _ring_fd, 1, 0, 0, nullptr, 0) < 0) {
+            throw uhd::io_error(errno_str("io_uring_enter() failed", errno));
+        }
+    }
+
+    //! Submit the multishot receive request
+    void _arm()
+    {
+        io_uring_sqe sqe;
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode    = IORING_OP_RECV;
+        sqe.fd        = _sock_fd;
+        sqe.ioprio    = IORING_RECV_MULTISHOT;
+        sqe.flags     = IOSQE_BUFFER_SELECT;
+        sqe.buf_group = BUF_GROUP_ID;
+        sqe.user_data = RECV_USER_DATA;
+        _submit(sqe);
+        _armed = true;
+    }
+
+    //! Cancel the receive request and wait until the kernel no longer uses
+    // the frames
+    void _cancel()
+    {
+        try {
+            io_uring_sqe sqe;
+            std::memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode    = IORING_OP_ASYNC_CANCEL;
+            sqe.fd        = -1;
+            sqe.addr      = RECV_USER_DATA;
+            sqe.user_data = CANCEL_USER_DATA;
+            _submit(sqe);
+            while (_armed) {
+                io_uring_cqe cqe;
+                if (_pop_cqe(cqe)) {
+                    if (cqe.user_data == RECV_USER_DATA
+                        && !(cqe.flags & IORING_CQE_F_MORE)) {
+                        _armed = false;
+                    }
+                    continue;
+                }
+                pollfd pfd{_ring_fd, POLLIN, 0};
+                if (::poll(&pfd, 1, CANCEL_TIMEOUT_MS) == 0) {
+                    UHD_LOG_WARNING(LOG_ID, "Timeout while cancelling io_uring receive");
+                    return;
+                }
+            }
+        } catch (const uhd::exception& ex) {
+            UHD_LOG_WARNING(LOG_ID, "Error cancelling io_uring receive: " << ex.what());
+        }
+    }
+
+    bool _pop_cqe(io_uring_cqe& cqe)
+    {
+        const unsigned head = *_cq_head;
+        if (head == load_acquire(_cq_tail)) {
+            return false;
+        }
+        cqe = _cqes[head & _cq_mask];
+        store_release(_cq_head, head + 1);
+        return true;
+    }
+
+    void _cleanup()
+    {
+        // Closing the ring also unregisters the buffer ring
+        if (_ring_fd >= 0) {
+            close(_ring_fd);
+        }
+        if (_sqes) {
+            munmap(_sqes, _sqes_size);
+        }
+        if (_cq_ring && _cq_ring != _sq_ring) {
+            munmap(_cq_ring, _cq_ring_size);
+        }
+        if (_sq_ring) {
+            munmap(_sq_ring, _sq_ring_size);
+        }
+        if (_buf_ring) {
+            munmap(_buf_ring, _buf_ring_size);
+        }
+    }
+
+    const int _sock_fd;
+    //! Frame memory, indexed by buffer ID
+    std::vector<void*> _frames;
+    const size_t _frame_size;
+
+    int _ring_fd         = -1;
+    void* _sq_ring       = nullptr;
+    void* _cq_ring       = nullptr;
+    size_t _sq_ring_size = 0;
+    size_t _cq_ring_size = 0;
+    io_uring_sqe* _sqes  = nullptr;
+    size_t _sqes_size    = 0;
+
+    unsigned* _sq_tail  = nullptr;
+    unsigned* _sq_array = nullptr;
+    unsigned _sq_mask   = 0;
+    unsigned* _cq_head  = nullptr;
+    unsigned* _cq_tail  = nullptr;
+    unsigned _cq_mask   = 0;
+    io_uring_cqe* _cqes = nullptr;
+
+    io_uring_buf_ring* _buf_ring = nullptr;
+    io_uring_buf* _bufs          = nullptr;
+    size_t _buf_ring_size        = 0;
+    uint16_t _buf_ring_tail      = 0;
+
+    bool _armed = false;
+};
+
+io_uring_recv::uptr io_uring_recv::make(
+    int sock_fd, const std::vector<void*>& frames, size_t frame_size)
+{
+    UHD_ASSERT_THROW(!frames.empty() && frames.size() <= MAX_FRAMES);
+    UHD_ASSERT_THROW((frames.size() & (frames.size() - 1)) == 0);
+    try {
+        return uptr(new io_uring_recv_impl(sock_fd, frames, frame_size));
+    } catch (const uhd::exception& ex) {
+        UHD_LOG_DEBUG(LOG_ID, "io_uring receives not available: " << ex.what());
+        return nullptr;
+    }
+}
+
+#else
+
+io_uring_recv::uptr io_uring_recv::make(int, const std::vector<void*>&, size_t)
+{
+    return nullptr;
+}
+
+#endif /* HAVE_IO_URING */
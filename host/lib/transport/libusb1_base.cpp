@@ -12,6 +12,8 @@
 #include <uhd/types/serial.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
+#include <uhd/utils/thread.hpp>
+#include <atomic>
 #include <cstdlib>
 #include <functional>
 #include <iostream>
@@ -53,10 +55,21 @@ public:
         return _context;
     }
 
+    void set_event_thread_affinity(const std::vector<size_t>& cpus) override
+    {
+        std::lock_guard<std::mutex> lock(_affinity_mutex);
+        _event_thread_cpus = cpus;
+        _affinity_pending  = true;
+    }
+
 private:
     libusb_context* _context;
     task::sptr task_handler;
 
+    std::mutex _affinity_mutex;
+    std::vector<size_t> _event_thread_cpus;
+    std::atomic<bool> _affinity_pending{false};
+
     /*
      * Task to handle libusb events.  There should only be one thread per libusb_context
      * handling events. Using more than one thread can result in excessive CPU usage in
@@ -66,6 +79,11 @@ private:
      */
     UHD_INLINE void libusb_event_handler_task(libusb_context* context)
     {
+        if (_affinity_pending) {
+            std::lock_guard<std::mutex> lock(_affinity_mutex);
+            _affinity_pending = false;
+            uhd::set_thread_affinity(_event_thread_cpus);
+        }
         timeval tv;
         tv.tv_sec  = 0;
         tv.tv_usec = 100000;
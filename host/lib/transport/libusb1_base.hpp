@@ -13,6 +13,7 @@
 #include <uhd/utils/noncopyable.hpp>
 #include <libusb.h>
 #include <memory>
+#include <vector>
 
 //! Define LIBUSB_CALL when its missing (non-windows)
 #ifndef LIBUSB_CALL
@@ -70,6 +71,16 @@ public:
 
     //! get the underlying libusb context pointer
     virtual libusb_context* get_context(void) const = 0;
+
+    /*!
+     * Pin the thread which handles the libusb events of this session
+     *
+     * All transfer callbacks run on this thread. The new affinity is applied
+     * the next time the thread wakes up from handling events.
+     *
+     * \param cpus The CPUs to run on, an empty list means any CPU
+     */
+    virtual void set_event_thread_affinity(const std::vector<size_t>& cpus) = 0;
 };
 
 /*!
@@ -8,17 +8,21 @@
 
 #include "libusb1_base.hpp"
 #include <uhd/exception.hpp>
-#include <uhd/transport/bounded_buffer.hpp>
 #include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/usb_zero_copy.hpp>
 #include <uhd/utils/log.hpp>
-#include <boost/circular_buffer.hpp>
+#include <uhdlib/utils/spsc_ring.hpp>
+#include <uhdlib/utils/worker_pool.hpp>
 #include <boost/format.hpp>
-#include <boost/thread/condition.hpp>
+#include <atomic>
+#include <cmath>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#ifdef UHD_TXRX_DEBUG_PRINTS
+#    include <boost/thread/thread_time.hpp>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -26,9 +30,29 @@ using namespace uhd::transport;
 static const size_t DEFAULT_NUM_XFERS = 16; // num xfers
 static const size_t DEFAULT_XFER_SIZE = 32 * 512; // bytes
 
-//! type for sharing the release queue with managed buffers
 class libusb_zero_copy_mb;
-typedef std::shared_ptr<bounded_buffer<libusb_zero_copy_mb*>> mb_queue_sptr;
+
+/*!
+ * The transfers of one endpoint
+ *
+ * The libusb event thread pushes every transfer that completes into the
+ * completion queue, and get_buff() pops them from there. The event thread is
+ * the only producer, and get_buff() calls are serialized, so the queue needs no
+ * lock. Since it can hold all transfers, pushing to it never fails.
+ */
+struct xfer_queue_t
+{
+    xfer_queue_t(const size_t num_xfers)
+        : completed(num_xfers, true), min_in_flight(num_xfers)
+    {
+    }
+
+    uhd::spsc_ring<libusb_zero_copy_mb*> completed;
+    //! Number of submitted transfers which have not completed yet
+    std::atomic<size_t> in_flight{0};
+    //! Lowest value of in_flight after a completion (only written by the callback)
+    std::atomic<size_t> min_in_flight;
+};
 
 /*!
  * The libusb docs state that status and actual length can only be read in the callback.
@@ -36,9 +60,8 @@ typedef std::shared_ptr<bounded_buffer<libusb_zero_copy_mb*>> mb_queue_sptr;
  */
 struct lut_result_t
 {
-    lut_result_t(void)
+    lut_result_t(libusb_zero_copy_mb* mb, xfer_queue_t& queue) : mb(mb), queue(queue)
     {
-        completed     = 0;
         status        = LIBUSB_TRANSFER_COMPLETED;
         actual_length = 0;
 #ifdef UHD_TXRX_DEBUG_PRINTS
@@ -46,11 +69,10 @@ struct lut_result_t
         buff_num   = -1;
 #endif
     }
-    int completed;
     libusb_transfer_status status;
     int actual_length;
-    std::mutex mut;
-    boost::condition usb_transfer_complete;
+    libusb_zero_copy_mb* const mb;
+    xfer_queue_t& queue;
 
 #ifdef UHD_TXRX_DEBUG_PRINTS
     // These are fore debugging
@@ -60,17 +82,6 @@ struct lut_result_t
 #endif
 };
 
-// Created to be used as an argument to boost::condition_variable::timed_wait() function
-struct lut_result_completed
-{
-    const lut_result_t& _result;
-    lut_result_completed(const lut_result_t& result) : _result(result) {}
-    bool operator()() const
-    {
-        return (_result.completed ? true : false);
-    }
-};
-
 #ifdef UHD_TXRX_DEBUG_PRINTS
 static std::string dbg_prefix("libusb1_zero_copy,");
 static void libusb1_zerocopy_dbg_print_err(std::string msg)
@@ -89,12 +100,16 @@ static void libusb1_zerocopy_dbg_print_err(std::string msg)
 static void LIBUSB_CALL libusb_async_cb(libusb_transfer* lut)
 {
     lut_result_t* r = (lut_result_t*)lut->user_data;
-    std::lock_guard<std::mutex> lock(r->mut);
     r->status        = lut->status;
     r->actual_length = lut->actual_length;
-    r->completed     = 1;
-    r->usb_transfer_complete.notify_one(); // wake up thread waiting in
-                                           // wait_for_completion() member function below
+
+    xfer_queue_t& queue    = r->queue;
+    const size_t in_flight = queue.in_flight.fetch_sub(1, std::memory_order_relaxed) - 1;
+    if (in_flight < queue.min_in_flight.load(std::memory_order_relaxed)) {
+        queue.min_in_flight.store(in_flight, std::memory_order_relaxed);
+    }
+    // Publishes the status and length to the thread in get_buff()
+    queue.completed.push(r->mb);
 #ifdef UHD_TXRX_DEBUG_PRINTS
     long end_time = boost::get_system_time().time_of_day().total_microseconds();
     libusb1_zerocopy_dbg_print_err(
@@ -121,8 +136,10 @@ public:
         const size_t frame_size,
         std::function<void(libusb_zero_copy_mb*)> release_cb,
         const bool is_recv,
-        const std::string& name)
-        : _release_cb(release_cb)
+        const std::string& name,
+        xfer_queue_t& queue)
+        : result(this, queue)
+        , _release_cb(release_cb)
         , _is_recv(is_recv)
         , _name(name)
         , _lut(lut)
@@ -145,55 +162,34 @@ public:
         result.buff_num   = num();
         result.is_recv    = _is_recv;
 #endif
+        // Count the transfer before libusb knows about it, so that the
+        // callback never sees a count that is too low
+        result.queue.in_flight.fetch_add(1, std::memory_order_relaxed);
         int ret = libusb_submit_transfer(_lut);
-        if (ret != LIBUSB_SUCCESS)
+        if (ret != LIBUSB_SUCCESS) {
+            result.queue.in_flight.fetch_sub(1, std::memory_order_relaxed);
             throw uhd::usb_error(ret,
                 str(boost::format("usb %s submit failed: %s") % _name
                     % libusb_error_name(ret)));
+        }
     }
 
+    //! Hand out this buffer after its transfer was popped off the completion queue
     template <typename buffer_type>
-    UHD_INLINE typename buffer_type::sptr get_new(const double timeout)
+    UHD_INLINE typename buffer_type::sptr get_new(void)
     {
-        if (wait_for_completion(timeout)) {
-            if (result.status != LIBUSB_TRANSFER_COMPLETED
-                && result.status != LIBUSB_TRANSFER_CANCELLED)
-                throw uhd::io_error(str(boost::format("usb %s transfer status: %d")
-                                        % _name % libusb_error_name(result.status)));
-            result.completed = 0;
-            return make(reinterpret_cast<buffer_type*>(this),
-                _lut->buffer,
-                (_is_recv) ? size_t(result.actual_length) : _frame_size);
-        }
-        return typename buffer_type::sptr();
+        if (result.status != LIBUSB_TRANSFER_COMPLETED
+            && result.status != LIBUSB_TRANSFER_CANCELLED)
+            throw uhd::io_error(str(boost::format("usb %s transfer status: %d") % _name
+                                    % libusb_error_name(result.status)));
+        return make(reinterpret_cast<buffer_type*>(this),
+            _lut->buffer,
+            (_is_recv) ? size_t(result.actual_length) : _frame_size);
     }
 
     // This is public because it is accessed from the libusb_zero_copy_single constructor
     lut_result_t result;
 
-    /*!
-     * Wait for a managed buffer to become complete.
-     *
-     * \param timeout the wait timeout in seconds.  A negative value will wait forever.
-     * \return true for completion, false for timeout
-     */
-    UHD_INLINE bool wait_for_completion(const double timeout)
-    {
-        std::unique_lock<std::mutex> lock(result.mut);
-        if (!result.completed) {
-            if (timeout < 0.0) {
-                result.usb_transfer_complete.wait(lock);
-            } else {
-                const boost::system_time timeout_time =
-                    boost::get_system_time()
-                    + boost::posix_time::microseconds(long(timeout * 1000000));
-                result.usb_transfer_complete.timed_wait(
-                    lock, timeout_time, lut_result_completed(result));
-            }
-        }
-        return (result.completed > 0);
-    }
-
 private:
     std::function<void(libusb_zero_copy_mb*)> _release_cb;
     const bool _is_recv;
@@ -217,18 +213,23 @@ public:
         const int interface,
         const unsigned char endpoint,
         const size_t num_frames,
-        const size_t frame_size)
+        const size_t frame_size,
+        const bool use_dev_mem)
         : _handle(handle)
         , _num_frames(num_frames)
         , _frame_size(frame_size)
-        , _buffer_pool(buffer_pool::make(_num_frames, _frame_size))
-        , _enqueued(_num_frames)
-        , _released(_num_frames)
-        , _status(STATUS_RUNNING)
+        , _queue(_num_frames)
     {
         const bool is_recv = (endpoint & 0x80) != 0;
         const std::string name =
             str(boost::format("%s%d") % ((is_recv) ? "rx" : "tx") % int(endpoint & 0x7f));
+
+        if (use_dev_mem) {
+            _alloc_dev_mem(name);
+        }
+        if (not _dev_mem) {
+            _buffer_pool = buffer_pool::make(_num_frames, _frame_size);
+        }
         _handle->claim_interface(interface);
 
         // flush the buffers out of the recv endpoint
@@ -255,16 +256,17 @@ public:
 
             _mb_pool.push_back(std::make_shared<libusb_zero_copy_mb>(lut,
                 this->get_frame_size(),
-                std::bind(&libusb_zero_copy_single::enqueue_buffer,
+                std::bind(&libusb_zero_copy_single::release_buffer,
                     this,
                     std::placeholders::_1),
                 is_recv,
-                name));
+                name,
+                _queue));
 
             libusb_fill_bulk_transfer(lut, // transfer
                 _handle->get(), // dev_handle
                 endpoint, // endpoint
-                static_cast<unsigned char*>(_buffer_pool->at(i)), // buffer
+                _get_frame(i), // buffer
                 int(this->get_frame_size()), // length
                 libusb_transfer_cb_fn(&libusb_async_cb), // callback
                 static_cast<void*>(&_mb_pool.back()->result), // user_data
@@ -274,16 +276,17 @@ public:
             _all_luts.push_back(lut);
         }
 
-        // initial release for all buffers
+        // initial release for all buffers: RX buffers are submitted to wait
+        // for data, TX buffers are ready to be filled
         for (size_t i = 0; i < get_num_frames(); i++) {
             libusb_zero_copy_mb& mb = *(_mb_pool[i]);
             if (is_recv)
                 mb.release();
-            else {
-                mb.result.completed = 1;
-                _enqueued.push_back(&mb);
-            }
+            else
+                _queue.completed.push(&mb);
         }
+        if (not is_recv)
+            _queue.min_in_flight = 0;
     }
 
     ~libusb_zero_copy_single(void)
@@ -294,44 +297,49 @@ public:
         }
 
         // process all transfers until timeout occurs
-        for (libusb_zero_copy_mb* mb : _enqueued) {
-            mb->wait_for_completion(0.01);
+        libusb_zero_copy_mb* mb = nullptr;
+        size_t num_timeouts     = 0;
+        while (_queue.in_flight > 0 and num_timeouts < _num_frames) {
+            if (not _queue.completed.pop(mb, 10))
+                num_timeouts++;
         }
 
         // free all transfers
         for (libusb_transfer* lut : _all_luts) {
             libusb_free_transfer(lut);
         }
+
+#if LIBUSB_API_VERSION >= 0x01000105
+        if (_dev_mem) {
+            libusb_dev_mem_free(_handle->get(), _dev_mem, _dev_mem_size);
+        }
+#endif
     }
 
     template <typename buffer_type>
     UHD_INLINE typename buffer_type::sptr get_buff(double timeout)
     {
-        typename buffer_type::sptr buff;
+        if (_error)
+            return typename buffer_type::sptr();
 
-        if (_status == STATUS_ERROR)
-            return buff;
-
-        // Serialize access to buffers
+        // Serialize access to buffers: we're the only consumer of the queue
         std::lock_guard<std::mutex> get_buff_lock(_get_buff_mutex);
 
-        std::unique_lock<std::mutex> queue_lock(_queue_mutex);
-        if (_enqueued.empty()) {
-            _buff_ready_cond.timed_wait(
-                queue_lock, boost::posix_time::microseconds(long(timeout * 1e6)));
-        }
-        if (_enqueued.empty())
-            return buff;
-        libusb_zero_copy_mb* front = _enqueued.front();
-
-        queue_lock.unlock();
-        buff = front->get_new<buffer_type>(timeout);
-        queue_lock.lock();
-
-        if (buff)
-            _enqueued.pop_front();
-        this->submit_what_we_can();
-        return buff;
+        const int32_t timeout_ms =
+            (timeout < 0.0) ? -1 : int32_t(std::ceil(timeout * 1000));
+        libusb_zero_copy_mb* mb = nullptr;
+        if (not _queue.completed.pop(mb, timeout_ms))
+            return typename buffer_type::sptr();
+        return mb->get_new<buffer_type>();
+    }
+
+    usb_zero_copy::queue_stats_t get_queue_stats(void) const
+    {
+        usb_zero_copy::queue_stats_t stats;
+        stats.in_flight     = _queue.in_flight.load(std::memory_order_relaxed);
+        stats.ready         = _queue.completed.read_available();
+        stats.min_in_flight = _queue.min_in_flight.load(std::memory_order_relaxed);
+        return stats;
     }
 
     UHD_INLINE size_t get_num_frames(void) const
@@ -347,45 +355,67 @@ private:
     libusb::device_handle::sptr _handle;
     const size_t _num_frames, _frame_size;
 
-    //! Storage for transfer related objects
+    //! Storage for transfer related objects: either device memory, or a
+    // buffer pool if that's not available
+    unsigned char* _dev_mem = nullptr;
+    size_t _dev_mem_size    = 0;
     buffer_pool::sptr _buffer_pool;
     std::vector<std::shared_ptr<libusb_zero_copy_mb>> _mb_pool;
 
-    std::mutex _queue_mutex;
-    boost::condition _buff_ready_cond;
     std::mutex _get_buff_mutex;
+    xfer_queue_t _queue;
 
-    //! why 2 queues? there is room in the future to have > N buffers but only N in flight
-    boost::circular_buffer<libusb_zero_copy_mb*> _enqueued, _released;
-
-    enum { STATUS_RUNNING, STATUS_ERROR } _status;
+    //! Set once a submit failed, after which no more buffers are handed out
+    std::atomic<bool> _error{false};
 
-    void enqueue_buffer(libusb_zero_copy_mb* mb)
+    //! Submit the transfer of a buffer the user is done with. This may be
+    // called from any thread, libusb_submit_transfer() is thread safe.
+    void release_buffer(libusb_zero_copy_mb* mb)
     {
-        std::lock_guard<std::mutex> l(_queue_mutex);
-        _released.push_back(mb);
-        this->submit_what_we_can();
-        _buff_ready_cond.notify_one();
+        if (_error)
+            return;
+        try {
+            mb->submit();
+        } catch (uhd::usb_error& e) {
+            _error = true;
+            throw e;
+        }
     }
 
-    void submit_what_we_can(void)
+    //! a list of all transfer structs we allocated
+    std::list<libusb_transfer*> _all_luts;
+
+    /*!
+     * Try to allocate the transfer buffers in device memory
+     *
+     * On Linux, usbfs can map memory which it then uses for the transfers
+     * directly, instead of copying the data between the kernel and these
+     * buffers. On failure, or with older libusb versions, this leaves _dev_mem
+     * at nullptr.
+     */
+    void _alloc_dev_mem(const std::string& name)
     {
-        if (_status == STATUS_ERROR)
+#if LIBUSB_API_VERSION >= 0x01000105
+        _dev_mem_size = _num_frames * _frame_size;
+        _dev_mem      = libusb_dev_mem_alloc(_handle->get(), _dev_mem_size);
+        if (_dev_mem) {
+            UHD_LOGGER_DEBUG("USB") << "usb " << name << ": Using " << _dev_mem_size
+                                    << " bytes of device memory for transfer buffers";
             return;
-        while (not _released.empty() and not _enqueued.full()) {
-            try {
-                _released.front()->submit();
-                _enqueued.push_back(_released.front());
-                _released.pop_front();
-            } catch (uhd::usb_error& e) {
-                _status = STATUS_ERROR;
-                throw e;
-            }
         }
+#endif
+        UHD_LOGGER_DEBUG("USB") << "usb " << name
+                                << ": Device memory is not supported, allocating "
+                                   "transfer buffers on the heap";
     }
 
-    //! a list of all transfer structs we allocated
-    std::list<libusb_transfer*> _all_luts;
+    unsigned char* _get_frame(const size_t i)
+    {
+        if (_dev_mem) {
+            return _dev_mem + i * _frame_size;
+        }
+        return static_cast<unsigned char*>(_buffer_pool->at(i));
+    }
 };
 
 /***********************************************************************
@@ -400,16 +430,19 @@ struct libusb_zero_copy_impl : usb_zero_copy
         const unsigned char send_endpoint,
         const device_addr_t& hints)
     {
-        _recv_impl.reset(new libusb_zero_copy_single(handle,
+        const bool use_dev_mem = hints.cast<bool>("usb_dev_mem", false);
+        _recv_impl = std::make_shared<libusb_zero_copy_single>(handle,
             recv_interface,
             (recv_endpoint & 0x7f) | 0x80,
             size_t(hints.cast<double>("num_recv_frames", DEFAULT_NUM_XFERS)),
-            size_t(hints.cast<double>("recv_frame_size", DEFAULT_XFER_SIZE))));
-        _send_impl.reset(new libusb_zero_copy_single(handle,
+            size_t(hints.cast<double>("recv_frame_size", DEFAULT_XFER_SIZE)),
+            use_dev_mem);
+        _send_impl = std::make_shared<libusb_zero_copy_single>(handle,
             send_interface,
             (send_endpoint & 0x7f) | 0x00,
             size_t(hints.cast<double>("num_send_frames", DEFAULT_NUM_XFERS)),
-            size_t(hints.cast<double>("send_frame_size", DEFAULT_XFER_SIZE))));
+            size_t(hints.cast<double>("send_frame_size", DEFAULT_XFER_SIZE)),
+            use_dev_mem);
     }
 
     ~libusb_zero_copy_impl(void) override;
@@ -444,6 +477,11 @@ struct libusb_zero_copy_impl : usb_zero_copy
         return _send_impl->get_frame_size();
     }
 
+    queue_stats_t get_recv_queue_stats(void) const override
+    {
+        return _recv_impl->get_queue_stats();
+    }
+
     std::shared_ptr<libusb_zero_copy_single> _recv_impl, _send_impl;
     std::mutex _recv_mutex, _send_mutex;
 };
@@ -461,6 +499,11 @@ usb_zero_copy::~usb_zero_copy(void)
     /* NOP */
 }
 
+usb_zero_copy::queue_stats_t usb_zero_copy::get_recv_queue_stats(void) const
+{
+    return queue_stats_t();
+}
+
 /***********************************************************************
  * USB zero_copy make functions
  **********************************************************************/
@@ -473,6 +516,12 @@ usb_zero_copy::sptr usb_zero_copy::make(usb_device_handle::sptr handle,
 {
     libusb::device_handle::sptr dev_handle(libusb::device_handle::get_cached_handle(
         std::static_pointer_cast<libusb::special_handle>(handle)->get_device()));
+    if (hints.has_key("usb_event_cpus")) {
+        // All transfers complete on the event thread of the session, so that's
+        // the thread worth pinning
+        libusb::session::get_global_session()->set_event_thread_affinity(
+            uhd::worker_pool::parse_cpu_list(hints["usb_event_cpus"]));
+    }
     return sptr(new libusb_zero_copy_impl(
         dev_handle, recv_interface, recv_endpoint, send_interface, send_endpoint, hints));
 }
@@ -56,6 +56,9 @@ nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
     , _fpga_session(fpga_session)
     , _fifo_instance(instance)
     , _link_params(params)
+    , _recv_batch_size(std::max<size_t>(params.recv_batch_size, 1))
+    , _recv_release_threshold(
+          _recv_batch_size * params.recv_frame_size / sizeof(fifo_data_t))
 {
     UHD_LOG_TRACE("NIRIO", "Creating PCIe transport for channel " << instance);
     UHD_LOGGER_TRACE("NIRIO")
@@ -68,6 +71,10 @@ nirio_link::nirio_link(uhd::niusrprio::niusrprio_session::sptr fpga_session,
                          "%u, #frames = %u, buffer size = %u\n")
                % _link_params.send_frame_size % _link_params.num_send_frames
                % (_link_params.send_frame_size * _link_params.num_send_frames);
+    if (_recv_batch_size > 1) {
+        UHD_LOGGER_TRACE("NIRIO") << "Acquiring and releasing up to " << _recv_batch_size
+                                  << " RX frames at once";
+    }
 
     nirio_status status = 0;
     size_t actual_depth = 0, actual_size = 0;
@@ -160,6 +167,10 @@ nirio_link::~nirio_link()
     PROXY->poke(PCIE_TX_DMA_REG(DMA_CTRL_STATUS_REG, _fifo_instance), DMA_CTRL_DISABLED);
     PROXY->poke(PCIE_RX_DMA_REG(DMA_CTRL_STATUS_REG, _fifo_instance), DMA_CTRL_DISABLED);
 
+    // Grant back the frames we held back, so they get flushed as well
+    if (_recv_elems_to_release > 0) {
+        _recv_fifo->release(_recv_elems_to_release);
+    }
     UHD_SAFE_CALL(_flush_rx_buff();)
 
     // Stop DMA channels. Stop is called in the fifo dtor but
@@ -295,6 +306,12 @@ nirio_link::sptr nirio_link::make(uhd::niusrprio::niusrprio_session::sptr fpga_s
                 .str());
     }
 
+    // Holding back more than half the frames would starve the DMA engine
+    link_params.recv_batch_size =
+        hints.cast<size_t>("recv_batch_size", default_params.recv_batch_size);
+    link_params.recv_batch_size = std::max<size_t>(1,
+        std::min(link_params.recv_batch_size, link_params.num_recv_frames / 2));
+
     recv_buff_size = link_params.num_recv_frames * link_params.recv_frame_size;
     send_buff_size = link_params.num_send_frames * link_params.send_frame_size;
 
@@ -10,7 +10,9 @@
 #include <uhdlib/transport/frame_reservation_mgr.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <uhdlib/transport/offload_io_service_client.hpp>
-#include <uhdlib/utils/semaphore.hpp>
+#include <uhdlib/utils/spsc_ring.hpp>
+#include <uhdlib/utils/trace_points.hpp>
+#include <uhdlib/utils/wakeup_fd.hpp>
 #include <condition_variable>
 #include <boost/lockfree/queue.hpp>
 #include <atomic>
@@ -26,84 +28,21 @@ namespace {
 
 constexpr int32_t blocking_timeout_ms = 10;
 
-// Fixed-size queue that supports blocking semantics
-template <typename queue_item_t>
-class offload_thread_queue
-{
-public:
-    offload_thread_queue(size_t size) : _buffer(new queue_item_t[size]), _capacity(size)
-    {
-    }
-
-    ~offload_thread_queue()
-    {
-        delete[] _buffer;
-    }
-
-    void push(const queue_item_t& item)
-    {
-        _buffer[_write_index++] = item;
-        _write_index %= _capacity;
-        _item_sem.notify();
-    }
-
-    bool peek(queue_item_t& item)
-    {
-        if (_item_sem.count()) {
-            item = _buffer[_read_index];
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    bool pop(queue_item_t& item)
-    {
-        if (_item_sem.try_wait()) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    bool pop(queue_item_t& item, int32_t timeout_ms)
-    {
-        if (_item_sem.wait_for(timeout_ms)) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    size_t read_available()
-    {
-        return _item_sem.count();
-    }
-
-private:
-    queue_item_t* _buffer;
-    const size_t _capacity;
-
-    size_t _read_index  = 0;
-    size_t _write_index = 0;
-
-    // Semaphore gating number of items available to read
-    semaphore _item_sem;
-};
-
 // Object that implements the communication between client and offload thread
 struct client_port_impl_t
 {
 public:
     using sptr = std::shared_ptr<client_port_impl_t>;
 
-    client_port_impl_t(size_t size)
-        : _from_offload_thread(size)
-        , _to_offload_thread(size + 1) // add one for disconnect command
+    // Both threads only wait on the queues if blocking is set, so polling
+    // clients never take a lock to hand off a frame. With a spin time, both
+    // threads poll the queue for that long before they wait on it.
+    client_port_impl_t(size_t size,
+        bool blocking,
+        std::chrono::microseconds spin_time = std::chrono::microseconds(0))
+        : _from_offload_thread(size, blocking)
+        , _to_offload_thread(size + 1, blocking) // add one for disconnect command
+        , _spin_time(spin_time)
     {
     }
 
@@ -113,17 +52,38 @@ public:
     frame_buff* client_pop()
     {
         from_offload_thread_t queue_element;
-        _from_offload_thread.pop(queue_element);
+        if (!_from_offload_thread.pop(queue_element)) {
+            _client_arm_ready_fd();
+        }
         return queue_element.buff;
     }
 
     frame_buff* client_pop(int32_t timeout_ms)
     {
         from_offload_thread_t queue_element;
-        _from_offload_thread.pop(queue_element, timeout_ms);
+        if (!_pop(_from_offload_thread, queue_element, timeout_ms)) {
+            _client_arm_ready_fd();
+        }
         return queue_element.buff;
     }
 
+    // Returns a descriptor which is readable while frames are waiting for the
+    // client. It is created on the first call, the offload thread only writes
+    // to it when the client has found the queue empty since it last did so.
+    int client_get_ready_fd()
+    {
+        std::lock_guard<std::mutex> lock(_ready_fd_mutex);
+        if (!_ready_fd) {
+            _ready_fd.reset(new wakeup_fd());
+            if (_ready_fd->get_fd() < 0) {
+                return -1;
+            }
+            _ready_fd_created.store(true, std::memory_order_release);
+            _client_arm_ready_fd();
+        }
+        return _ready_fd->get_fd();
+    }
+
     size_t client_read_available()
     {
         return _from_offload_thread.read_available();
@@ -132,7 +92,7 @@ public:
     void client_push(frame_buff* buff)
     {
         to_offload_thread_t queue_element{buff, false};
-        _to_offload_thread.push(queue_element);
+        UHD_ASSERT_THROW(_to_offload_thread.push(queue_element));
     }
 
     void client_wait_until_connected()
@@ -144,7 +104,7 @@ public:
     void client_disconnect()
     {
         to_offload_thread_t queue_element{nullptr, true};
-        _to_offload_thread.push(queue_element);
+        UHD_ASSERT_THROW(_to_offload_thread.push(queue_element));
 
         // Need to wait for the disconnect to occur before returning, since the
         // caller (the xport object) has callbacks installed in the inline I/O
@@ -159,7 +119,16 @@ public:
     void offload_thread_push(frame_buff* buff)
     {
         from_offload_thread_t queue_element{buff};
-        _from_offload_thread.push(queue_element);
+        UHD_ASSERT_THROW(_from_offload_thread.push(queue_element));
+        if (_ready_fd_created.load(std::memory_order_acquire)) {
+            // Pairs with the fence in _client_arm_ready_fd(): Either the client
+            // sees this frame, or this thread sees that the client is waiting
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_ready_fd_armed.load(std::memory_order_relaxed)
+                && _ready_fd_armed.exchange(false)) {
+                _ready_fd->notify();
+            }
+        }
     }
 
     std::tuple<frame_buff*, bool> offload_thread_peek()
@@ -179,7 +148,7 @@ public:
     std::tuple<frame_buff*, bool> offload_thread_pop(int32_t timeout_ms)
     {
         to_offload_thread_t queue_element;
-        _to_offload_thread.pop(queue_element, timeout_ms);
+        _pop(_to_offload_thread, queue_element, timeout_ms);
         return std::make_tuple(queue_element.buff, queue_element.disconnect);
     }
 
@@ -208,13 +177,56 @@ public:
     }
 
 private:
+    // Called by the client after it found no frame: Clears the descriptor and
+    // asks the offload thread to set it with the next frame
+    void _client_arm_ready_fd()
+    {
+        if (!_ready_fd_created.load(std::memory_order_acquire)) {
+            return;
+        }
+        _ready_fd->clear();
+        _ready_fd_armed.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // A frame which was pushed before the store above was missed by the
+        // offload thread
+        if (_from_offload_thread.read_available() > 0
+            && _ready_fd_armed.exchange(false)) {
+            _ready_fd->notify();
+        }
+    }
+
+    // Pop from a queue, polling it for up to the spin time before waiting
+    template <typename queue_t, typename element_t>
+    bool _pop(queue_t& queue, element_t& element, int32_t timeout_ms)
+    {
+        using namespace std::chrono;
+        if (_spin_time.count() > 0 && timeout_ms != 0) {
+            const auto start     = steady_clock::now();
+            const auto spin_time = (timeout_ms < 0)
+                                       ? _spin_time
+                                       : std::min<microseconds>(
+                                           _spin_time, milliseconds(timeout_ms));
+            do {
+                if (queue.pop(element)) {
+                    return true;
+                }
+            } while (steady_clock::now() - start < spin_time);
+            if (timeout_ms > 0) {
+                const auto spun =
+                    duration_cast<milliseconds>(steady_clock::now() - start).count();
+                timeout_ms = std::max<int32_t>(timeout_ms - spun, 0);
+            }
+        }
+        return queue.pop(element, timeout_ms);
+    }
+
     // Queue for frame buffers coming from the offload thread
     struct from_offload_thread_t
     {
         frame_buff* buff = nullptr;
     };
 
-    using from_offload_thread_queue_t = offload_thread_queue<from_offload_thread_t>;
+    using from_offload_thread_queue_t = spsc_ring<from_offload_thread_t>;
 
     // Queue for frame buffers and disconnect requests to offload thread. Disconnect
     // requests must be inline with incoming buffers to avoid any race conditions
@@ -225,7 +237,7 @@ private:
         bool disconnect  = false;
     };
 
-    using to_offload_thread_queue_t = offload_thread_queue<to_offload_thread_t>;
+    using to_offload_thread_queue_t = spsc_ring<to_offload_thread_t>;
 
     // Queues to carry frame buffers in both directions
     from_offload_thread_queue_t _from_offload_thread;
@@ -235,6 +247,14 @@ private:
     std::condition_variable _connect_cv;
     std::mutex _connect_cv_mutex;
     bool _connected = false;
+
+    const std::chrono::microseconds _spin_time;
+
+    // Readiness descriptor for the client, see client_get_ready_fd()
+    std::mutex _ready_fd_mutex;
+    std::unique_ptr<wakeup_fd> _ready_fd;
+    std::atomic<bool> _ready_fd_created{false};
+    std::atomic<bool> _ready_fd_armed{false};
 };
 
 } // namespace
@@ -311,19 +331,31 @@ private:
     };
 
     void _queue_client_req(std::function<void()> fn);
-    void _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
-    void _get_send_buff(send_client_info_t& info);
+    bool _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
+    bool _get_send_buff(send_client_info_t& info);
     void _release_recv_buff(recv_client_info_t& info, frame_buff* buff);
     void _release_send_buff(send_client_info_t& info, frame_buff* buff);
     void _disconnect_recv_client(recv_client_info_t& info);
     void _disconnect_send_client(send_client_info_t& info);
 
+    template <bool allow_recv, bool allow_send>
+    bool _poll_once();
+
     template <bool allow_recv, bool allow_send>
     void _do_work_polling();
 
+    template <bool allow_recv, bool allow_send>
+    bool _block_once();
+
     template <bool allow_recv, bool allow_send>
     void _do_work_blocking();
 
+    template <bool allow_recv, bool allow_send>
+    void _do_work_hybrid();
+
+    // Create a port for a new client
+    client_port_t::sptr _make_port(const size_t num_frames) const;
+
     // The I/O service that executes within the offload thread
     io_service::sptr _io_srv;
 
@@ -332,6 +364,9 @@ private:
     std::atomic<bool> _stop_offload_thread{false};
     offload_io_service::params_t _offload_thread_params;
 
+    // Task which polls this I/O service, if it runs in a thread pool
+    size_t _pool_task_id = 0;
+
     // Lists of clients and their respective queues
     std::list<recv_client_info_t> _recv_clients;
     std::list<send_client_info_t> _send_clients;
@@ -360,13 +395,32 @@ offload_io_service_impl::offload_io_service_impl(
     : _io_srv(io_srv)
     , _offload_thread_params(params)
     , _client_connect_queue(10) // arbitrary initial size
+    , _reservation_mgr(params.min_frames_ratio)
 {
-    if (params.wait_mode == BLOCK && params.client_type == BOTH_SEND_AND_RECV) {
+    if (params.wait_mode != POLL && params.client_type == BOTH_SEND_AND_RECV) {
         throw uhd::value_error(
             "An I/O service configured to block should only service either "
             "send or recv clients to prevent one client type from starving "
             "the other");
     }
+    if (params.wait_mode != POLL && params.thread_pool) {
+        throw uhd::value_error("A thread pool can only run polling I/O services");
+    }
+
+    if (params.thread_pool) {
+        std::function<bool()> poll_fn;
+        if (params.client_type == RECV_ONLY) {
+            poll_fn = [this]() { return _poll_once<true, false>(); };
+        } else if (params.client_type == SEND_ONLY) {
+            poll_fn = [this]() { return _poll_once<false, true>(); };
+        } else if (params.client_type == BOTH_SEND_AND_RECV) {
+            poll_fn = [this]() { return _poll_once<true, true>(); };
+        } else {
+            UHD_THROW_INVALID_CODE_PATH();
+        }
+        _pool_task_id = params.thread_pool->add_task(params.name, poll_fn);
+        return;
+    }
 
     std::function<void()> thread_fn;
 
@@ -378,6 +432,14 @@ offload_io_service_impl::offload_io_service_impl(
         } else {
             UHD_THROW_INVALID_CODE_PATH();
         }
+    } else if (params.wait_mode == HYBRID) {
+        if (params.client_type == RECV_ONLY) {
+            thread_fn = [this]() { _do_work_hybrid<true, false>(); };
+        } else if (params.client_type == SEND_ONLY) {
+            thread_fn = [this]() { _do_work_hybrid<false, true>(); };
+        } else {
+            UHD_THROW_INVALID_CODE_PATH();
+        }
     } else if (params.wait_mode == POLL) {
         if (params.client_type == RECV_ONLY) {
             thread_fn = [this]() { _do_work_polling<true, false>(); };
@@ -397,6 +459,10 @@ offload_io_service_impl::offload_io_service_impl(
 
 offload_io_service_impl::~offload_io_service_impl()
 {
+    if (_offload_thread_params.thread_pool) {
+        _offload_thread_params.thread_pool->remove_task(_pool_task_id);
+    }
+
     _stop_offload_thread = true;
 
     if (_offload_thread) {
@@ -463,13 +529,13 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
     size_t num_send_frames,
     recv_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(_offload_thread || _offload_thread_params.thread_pool);
 
     if (_offload_thread_params.client_type == SEND_ONLY) {
         throw uhd::runtime_error("Recv client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_recv_frames);
+    auto port = _make_port(num_recv_frames);
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn =
@@ -513,13 +579,13 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     recv_callback_t recv_cb,
     send_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(_offload_thread || _offload_thread_params.thread_pool);
 
     if (_offload_thread_params.client_type == RECV_ONLY) {
         throw uhd::runtime_error("Send client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_send_frames);
+    auto port = _make_port(num_send_frames);
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn = [this,
@@ -557,8 +623,9 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     _queue_client_req(req_fn);
     port->client_wait_until_connected();
 
-    // Wait for buffer queue to be full
-    while (port->client_read_available() != num_send_frames) {
+    // Wait for the guaranteed buffers, the others may be lent to other clients
+    const size_t min_send_frames = _reservation_mgr.get_min_frames(num_send_frames);
+    while (port->client_read_available() < min_send_frames) {
         std::this_thread::sleep_for(std::chrono::microseconds(100));
     }
 
@@ -572,6 +639,17 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     }
 }
 
+offload_io_service_impl::client_port_t::sptr offload_io_service_impl::_make_port(
+    const size_t num_frames) const
+{
+    const auto wait_mode = _offload_thread_params.wait_mode;
+    const auto spin_time = (wait_mode == HYBRID)
+                               ? std::chrono::microseconds(
+                                   _offload_thread_params.spin_time_us)
+                               : std::chrono::microseconds(0);
+    return std::make_shared<client_port_t>(num_frames, wait_mode != POLL, spin_time);
+}
+
 void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
 {
     client_req_t queue_element;
@@ -583,25 +661,51 @@ void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
 }
 
 // Get a single receive buffer if available and update client info
-void offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
+bool offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
 {
-    if (info.num_frames_in_use < info.frames_reserved.num_recv_frames) {
-        if (frame_buff::uptr buff = info.inline_io->get_recv_buff(timeout_ms)) {
-            info.port->offload_thread_push(buff.release());
-            info.num_frames_in_use++;
-        }
+    if (info.num_frames_in_use >= info.frames_reserved.num_recv_frames) {
+        return false;
     }
+    // Frames beyond the guaranteed ones are borrowed from the link
+    auto recv_link    = info.frames_reserved.recv_link.get();
+    const bool borrow = info.num_frames_in_use >= info.frames_reserved.min_recv_frames;
+    if (borrow && !_reservation_mgr.borrow_recv_frame(recv_link)) {
+        return false;
+    }
+    if (frame_buff::uptr buff = info.inline_io->get_recv_buff(timeout_ms)) {
+        info.port->offload_thread_push(buff.release());
+        info.num_frames_in_use++;
+        UHD_TRACE_POINT(offload_recv_buff, info.port.get(), info.num_frames_in_use);
+        return true;
+    }
+    if (borrow) {
+        _reservation_mgr.return_recv_frames(recv_link);
+    }
+    return false;
 }
 
 // Get a single send buffer if available and update client info
-void offload_io_service_impl::_get_send_buff(send_client_info_t& info)
+bool offload_io_service_impl::_get_send_buff(send_client_info_t& info)
 {
-    if (info.num_frames_in_use < info.frames_reserved.num_send_frames) {
-        if (frame_buff::uptr buff = info.inline_io->get_send_buff(0)) {
-            info.port->offload_thread_push(buff.release());
-            info.num_frames_in_use++;
-        }
+    if (info.num_frames_in_use >= info.frames_reserved.num_send_frames) {
+        return false;
+    }
+    // Frames beyond the guaranteed ones are borrowed from the link
+    auto send_link    = info.frames_reserved.send_link.get();
+    const bool borrow = info.num_frames_in_use >= info.frames_reserved.min_send_frames;
+    if (borrow && !_reservation_mgr.borrow_send_frame(send_link)) {
+        return false;
+    }
+    if (frame_buff::uptr buff = info.inline_io->get_send_buff(0)) {
+        info.port->offload_thread_push(buff.release());
+        info.num_frames_in_use++;
+        UHD_TRACE_POINT(offload_send_buff, info.port.get(), info.num_frames_in_use);
+        return true;
     }
+    if (borrow) {
+        _reservation_mgr.return_send_frames(send_link);
+    }
+    return false;
 }
 
 // Release a single recv buffer and update client info
@@ -610,7 +714,12 @@ void offload_io_service_impl::_release_recv_buff(
 {
     info.inline_io->release_recv_buff(frame_buff::uptr(buff));
     assert(info.num_frames_in_use > 0);
+    if (info.num_frames_in_use > info.frames_reserved.min_recv_frames) {
+        _reservation_mgr.return_recv_frames(info.frames_reserved.recv_link.get());
+    }
     info.num_frames_in_use--;
+    UHD_TRACE_POINT(
+        offload_release_recv_buff, info.port.get(), info.num_frames_in_use);
 }
 
 // Release a single send info
@@ -619,7 +728,12 @@ void offload_io_service_impl::_release_send_buff(
 {
     info.inline_io->release_send_buff(frame_buff::uptr(buff));
     assert(info.num_frames_in_use > 0);
+    if (info.num_frames_in_use > info.frames_reserved.min_send_frames) {
+        _reservation_mgr.return_send_frames(info.frames_reserved.send_link.get());
+    }
     info.num_frames_in_use--;
+    UHD_TRACE_POINT(
+        offload_release_send_buff, info.port.get(), info.num_frames_in_use);
 }
 
 // Flush client queues and unreserve its frames
@@ -629,6 +743,11 @@ void offload_io_service_impl::_disconnect_recv_client(recv_client_info_t& info)
         info.inline_io->release_recv_buff(frame_buff::uptr(buff));
     };
 
+    const size_t min_frames = info.frames_reserved.min_recv_frames;
+    if (info.num_frames_in_use > min_frames) {
+        _reservation_mgr.return_recv_frames(
+            info.frames_reserved.recv_link.get(), info.num_frames_in_use - min_frames);
+    }
     info.num_frames_in_use -= info.port->offload_thread_flush(release_buff);
     assert(info.num_frames_in_use == 0);
     _reservation_mgr.unreserve_frames(info.frames_reserved);
@@ -643,6 +762,11 @@ void offload_io_service_impl::_disconnect_send_client(send_client_info_t& info)
     auto release_buff = [&info](frame_buff* buff) {
         info.inline_io->release_send_buff(frame_buff::uptr(buff));
     };
+    const size_t min_frames = info.frames_reserved.min_send_frames;
+    if (info.num_frames_in_use > min_frames) {
+        _reservation_mgr.return_send_frames(
+            info.frames_reserved.send_link.get(), info.num_frames_in_use - min_frames);
+    }
     info.num_frames_in_use -= info.port->offload_thread_flush(release_buff);
     assert(info.num_frames_in_use == 0);
     _reservation_mgr.unreserve_frames(info.frames_reserved);
@@ -651,68 +775,169 @@ void offload_io_service_impl::_disconnect_send_client(send_client_info_t& info)
     info.port->offload_thread_set_connected(false);
 }
 
+// Run one iteration of the polling loop, return true if any buffers or
+// requests were handled
 template <bool allow_recv, bool allow_send>
-void offload_io_service_impl::_do_work_polling()
+bool offload_io_service_impl::_poll_once()
 {
-    uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
+    bool busy = false;
 
-    client_req_t client_req;
+    if (allow_recv) {
+        // Get recv buffers
+        for (auto& recv_info : _recv_clients) {
+            busy |= _get_recv_buff(recv_info, 0);
+        }
 
-    while (!_stop_offload_thread) {
-        if (allow_recv) {
-            // Get recv buffers
-            for (auto& recv_info : _recv_clients) {
-                _get_recv_buff(recv_info, 0);
+        // Release recv buffers
+        for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
+            frame_buff* buff;
+            bool disconnect;
+            std::tie(buff, disconnect) = it->port->offload_thread_pop();
+            if (buff) {
+                _release_recv_buff(*it, buff);
+                busy = true;
+            } else if (disconnect) {
+                _disconnect_recv_client(*it);
+                it   = _recv_clients.erase(it); // increments it
+                busy = true;
+                continue;
             }
+            ++it;
+        }
+    }
 
-            // Release recv buffers
-            for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
-                frame_buff* buff;
-                bool disconnect;
-                std::tie(buff, disconnect) = it->port->offload_thread_pop();
-                if (buff) {
-                    _release_recv_buff(*it, buff);
-                } else if (disconnect) {
-                    _disconnect_recv_client(*it);
-                    it = _recv_clients.erase(it); // increments it
-                    continue;
+    if (allow_send) {
+        // Get send buffers
+        for (auto& send_info : _send_clients) {
+            busy |= _get_send_buff(send_info);
+        }
+
+        // Release send buffers
+        for (auto it = _send_clients.begin(); it != _send_clients.end();) {
+            frame_buff* buff;
+            bool disconnect;
+            std::tie(buff, disconnect) = it->port->offload_thread_peek();
+            if (buff) {
+                if (it->inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
+                    _release_send_buff(*it, buff);
+                    it->port->offload_thread_pop();
+                    busy = true;
                 }
-                ++it;
+            } else if (disconnect) {
+                it->port->offload_thread_pop();
+                _disconnect_send_client(*it);
+                it   = _send_clients.erase(it); // increments it
+                busy = true;
+                continue;
             }
+            ++it;
+        }
+    }
+
+    // Execute one client connect command per main loop iteration
+    client_req_t client_req;
+    if (_client_connect_queue.pop(client_req)) {
+        (*client_req.req)();
+        delete client_req.req;
+        busy = true;
+    }
+
+    return busy;
+}
+
+template <bool allow_recv, bool allow_send>
+void offload_io_service_impl::_do_work_polling()
+{
+    uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
+
+    while (!_stop_offload_thread) {
+        _poll_once<allow_recv, allow_send>();
+    }
+}
+
+// Run one iteration of the blocking loop, return true if any buffers or
+// requests were handled
+template <bool allow_recv, bool allow_send>
+bool offload_io_service_impl::_block_once()
+{
+    bool busy = false;
+
+    if (allow_recv) {
+        // Get recv buffers
+        for (auto& recv_info : _recv_clients) {
+            busy |= _get_recv_buff(recv_info, blocking_timeout_ms);
         }
 
-        if (allow_send) {
-            // Get send buffers
-            for (auto& send_info : _send_clients) {
-                _get_send_buff(send_info);
+        // Release recv buffers
+        for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
+            frame_buff* buff;
+            bool disconnect;
+
+            if (it->num_frames_in_use == it->frames_reserved.num_recv_frames) {
+                // If all buffers are in use, block to avoid excessive CPU usage
+                std::tie(buff, disconnect) =
+                    it->port->offload_thread_pop(blocking_timeout_ms);
+            } else {
+                // Otherwise, just check current status
+                std::tie(buff, disconnect) = it->port->offload_thread_pop();
             }
 
-            // Release send buffers
-            for (auto it = _send_clients.begin(); it != _send_clients.end();) {
+            if (buff) {
+                _release_recv_buff(*it, buff);
+                busy = true;
+            } else if (disconnect) {
+                _disconnect_recv_client(*it);
+                it   = _recv_clients.erase(it); // increments it
+                busy = true;
+                continue;
+            }
+            ++it;
+        }
+    }
+
+    if (allow_send) {
+        // Get send buffers
+        for (auto& send_info : _send_clients) {
+            busy |= _get_send_buff(send_info);
+        }
+
+        // Release send buffers
+        for (auto it = _send_clients.begin(); it != _send_clients.end();) {
+            if (it->num_frames_in_use > 0) {
                 frame_buff* buff;
                 bool disconnect;
                 std::tie(buff, disconnect) = it->port->offload_thread_peek();
                 if (buff) {
-                    if (it->inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
+                    if (it->inline_io->wait_for_dest_ready(
+                            buff->packet_size(), blocking_timeout_ms)) {
                         _release_send_buff(*it, buff);
                         it->port->offload_thread_pop();
+                        busy = true;
                     }
                 } else if (disconnect) {
                     it->port->offload_thread_pop();
                     _disconnect_send_client(*it);
-                    it = _send_clients.erase(it); // increments it
+                    it   = _send_clients.erase(it); // increments it
+                    busy = true;
                     continue;
                 }
-                ++it;
             }
+            ++it;
         }
+    }
 
-        // Execute one client connect command per main loop iteration
-        if (_client_connect_queue.pop(client_req)) {
-            (*client_req.req)();
-            delete client_req.req;
-        }
+    // Execute one client connect command per main loop iteration
+    // TODO: In a blocking I/O strategy, the loop can take a long time to
+    // service these requests. Need to configure all clients up-front,
+    // before starting the offload thread to avoid this.
+    client_req_t client_req;
+    if (_client_connect_queue.pop(client_req)) {
+        (*client_req.req)();
+        delete client_req.req;
+        busy = true;
     }
+
+    return busy;
 }
 
 template <bool allow_recv, bool allow_send>
@@ -720,76 +945,39 @@ void offload_io_service_impl::_do_work_blocking()
 {
     uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
 
-    client_req_t client_req;
-
     while (!_stop_offload_thread) {
-        if (allow_recv) {
-            // Get recv buffers
-            for (auto& recv_info : _recv_clients) {
-                _get_recv_buff(recv_info, blocking_timeout_ms);
-            }
+        _block_once<allow_recv, allow_send>();
+    }
+}
 
-            // Release recv buffers
-            for (auto it = _recv_clients.begin(); it != _recv_clients.end();) {
-                frame_buff* buff;
-                bool disconnect;
+template <bool allow_recv, bool allow_send>
+void offload_io_service_impl::_do_work_hybrid()
+{
+    using namespace std::chrono;
+    uhd::set_thread_affinity(_offload_thread_params.cpu_affinity_list);
 
-                if (it->num_frames_in_use == it->frames_reserved.num_recv_frames) {
-                    // If all buffers are in use, block to avoid excessive CPU usage
-                    std::tie(buff, disconnect) =
-                        it->port->offload_thread_pop(blocking_timeout_ms);
-                } else {
-                    // Otherwise, just check current status
-                    std::tie(buff, disconnect) = it->port->offload_thread_pop();
-                }
+    const microseconds spin_time(_offload_thread_params.spin_time_us);
+    // Only read the clock once we run out of work
+    bool idle = false;
+    steady_clock::time_point idle_start;
 
-                if (buff) {
-                    _release_recv_buff(*it, buff);
-                } else if (disconnect) {
-                    _disconnect_recv_client(*it);
-                    it = _recv_clients.erase(it); // increments it
-                    continue;
-                }
-                ++it;
-            }
+    while (!_stop_offload_thread) {
+        if (_poll_once<allow_recv, allow_send>()) {
+            idle = false;
+            continue;
         }
-
-        if (allow_send) {
-            // Get send buffers
-            for (auto& send_info : _send_clients) {
-                _get_send_buff(send_info);
-            }
-
-            // Release send buffers
-            for (auto it = _send_clients.begin(); it != _send_clients.end();) {
-                if (it->num_frames_in_use > 0) {
-                    frame_buff* buff;
-                    bool disconnect;
-                    std::tie(buff, disconnect) = it->port->offload_thread_peek();
-                    if (buff) {
-                        if (it->inline_io->wait_for_dest_ready(
-                                buff->packet_size(), blocking_timeout_ms)) {
-                            _release_send_buff(*it, buff);
-                            it->port->offload_thread_pop();
-                        }
-                    } else if (disconnect) {
-                        it->port->offload_thread_pop();
-                        _disconnect_send_client(*it);
-                        it = _send_clients.erase(it); // increments it
-                        continue;
-                    }
-                }
-                ++it;
-            }
+        const auto now = steady_clock::now();
+        if (!idle) {
+            idle       = true;
+            idle_start = now;
         }
-
-        // Execute one client connect command per main loop iteration
-        // TODO: In a blocking I/O strategy, the loop can take a long time to
-        // service these requests. Need to configure all clients up-front,
-        // before starting the offload thread to avoid this.
-        if (_client_connect_queue.pop(client_req)) {
-            (*client_req.req)();
-            delete client_req.req;
+        if (now - idle_start < spin_time) {
+            continue;
+        }
+        // Nothing happened for the whole spin time, so stop burning the
+        // core and wait for the next packet or buffer
+        if (_block_once<allow_recv, allow_send>()) {
+            idle = false;
         }
     }
 }
@@ -0,0 +1,333 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/transport/offload_thread_pool.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr char LOG_ID[] = "IO_SRV";
+
+//! Length of the windows over which the load of a thread is measured
+constexpr auto LOAD_WINDOW = std::chrono::milliseconds(10);
+
+//! Number of polls between checks whether the current window has ended, so
+// that we don't read the clock on every poll
+constexpr uint64_t POLLS_PER_CLOCK_CHECK = 64;
+
+//! How long a thread without any tasks sleeps between polls
+constexpr auto IDLE_SLEEP = std::chrono::microseconds(100);
+
+//! Threads only steal tasks if their load is at most this percentage
+constexpr unsigned THIEF_MAX_LOAD = 25;
+
+//! Threads only lose tasks if their load is at least this percentage
+constexpr unsigned VICTIM_MIN_LOAD = 90;
+
+constexpr size_t NO_THREAD = std::numeric_limits<size_t>::max();
+
+} // namespace
+
+class offload_thread_pool_impl : public offload_thread_pool
+{
+public:
+    offload_thread_pool_impl(const std::vector<std::vector<size_t>>& cpu_affinity_lists)
+    {
+        UHD_ASSERT_THROW(!cpu_affinity_lists.empty());
+        for (const auto& cpu_affinity : cpu_affinity_lists) {
+            _threads.emplace_back(new thread_info_t);
+            _threads.back()->cpu_affinity = cpu_affinity;
+        }
+        for (size_t i = 0; i < _threads.size(); i++) {
+            _threads[i]->thread = std::thread([this, i]() { _run(i); });
+        }
+    }
+
+    ~offload_thread_pool_impl() override
+    {
+        _stop = true;
+        for (auto& thread_info : _threads) {
+            thread_info->thread.join();
+        }
+        for (size_t i = 0; i < _threads.size(); i++) {
+            const thread_info_t& thread_info = *_threads[i];
+            UHD_LOG_DEBUG(LOG_ID,
+                "Offload thread " << i << ": " << thread_info.num_busy_polls.get()
+                                  << " of " << thread_info.num_polls.get()
+                                  << " polls busy, "
+                                  << thread_info.num_steals.load()
+                                  << " tasks taken over");
+        }
+    }
+
+    size_t add_task(const std::string& name, task_fn_t fn) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Like the polling I/O service manager, pick the thread with the fewest
+        // tasks, and the lowest numbered one among those
+        size_t thread = 0;
+        for (size_t i = 1; i < _threads.size(); i++) {
+            if (_threads[i]->tasks.size() < _threads[thread]->tasks.size()) {
+                thread = i;
+            }
+        }
+
+        const size_t task_id = _next_task_id++;
+        auto task            = std::make_shared<task_t>(name, std::move(fn));
+        task->thread         = thread;
+        _tasks[task_id]      = task;
+        _threads[thread]->tasks.push_back(task);
+        _threads[thread]->tasks_version++;
+        return task_id;
+    }
+
+    void remove_task(const size_t task_id) override
+    {
+        task_sptr task;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _tasks.find(task_id);
+            UHD_ASSERT_THROW(it != _tasks.end());
+            task = it->second;
+            _tasks.erase(it);
+
+            thread_info_t& thread_info = *_threads[task->thread];
+            thread_info.tasks.erase(
+                std::find(thread_info.tasks.begin(), thread_info.tasks.end(), task));
+            thread_info.tasks_version++;
+            task->thread = NO_THREAD;
+        }
+        // The thread may not have seen its new list of tasks yet, and still be
+        // polling this one. Once it is done, it will see that it no longer
+        // owns the task, and never poll it again.
+        while (task->polling) {
+            std::this_thread::yield();
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Offload task " << task->name << ": " << task->num_busy_polls.get()
+                            << " busy polls, moved " << task->num_migrations.load()
+                            << " times");
+    }
+
+    stats_t get_stats() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        stats_t stats;
+        for (const auto& thread_info : _threads) {
+            stats.threads.push_back({thread_info->cpu_affinity,
+                thread_info->tasks.size(),
+                thread_info->load.load(),
+                thread_info->num_polls.get(),
+                thread_info->num_busy_polls.get(),
+                thread_info->num_steals.load()});
+        }
+        for (const auto& id_task : _tasks) {
+            const task_t& task = *id_task.second;
+            stats.tasks.push_back({task.name,
+                task.thread.load(),
+                task.num_busy_polls.get(),
+                task.num_migrations.load()});
+        }
+        return stats;
+    }
+
+private:
+    struct task_t
+    {
+        task_t(const std::string& name, task_fn_t fn) : name(name), fn(std::move(fn)) {}
+
+        const std::string name;
+        const task_fn_t fn;
+
+        //! Set while a thread polls the task. This is what keeps two threads
+        // from polling the task at the same time.
+        std::atomic<bool> polling{false};
+        //! The thread which owns the task, NO_THREAD once it is removed
+        std::atomic<size_t> thread{NO_THREAD};
+
+        // Only ever updated while polling is set, i.e., by one thread at a time
+        telemetry_counter num_busy_polls;
+        //! Busy polls in the last window of the owning thread
+        std::atomic<uint64_t> window_busy_polls{0};
+        std::atomic<uint64_t> window_start_busy_polls{0};
+        std::atomic<size_t> num_migrations{0};
+    };
+    using task_sptr = std::shared_ptr<task_t>;
+
+    struct thread_info_t
+    {
+        std::vector<size_t> cpu_affinity;
+        std::thread thread;
+
+        //! Tasks owned by this thread (protected by the pool mutex)
+        std::vector<task_sptr> tasks;
+        //! Incremented whenever tasks is changed, so that the thread knows to
+        // pick up a new copy
+        std::atomic<size_t> tasks_version{0};
+
+        //! Percentage of busy polls in the last window
+        std::atomic<unsigned> load{0};
+
+        telemetry_counter num_polls;
+        telemetry_counter num_busy_polls;
+        std::atomic<size_t> num_steals{0};
+    };
+
+    void _run(const size_t index)
+    {
+        thread_info_t& thread_info = *_threads[index];
+        uhd::set_thread_affinity(thread_info.cpu_affinity);
+
+        // Our own copy of the task list, so that we don't need the lock on
+        // every poll
+        std::vector<task_sptr> tasks;
+        size_t tasks_version = 0;
+
+        auto window_start          = std::chrono::steady_clock::now();
+        uint64_t window_polls      = 0;
+        uint64_t window_busy_polls = 0;
+
+        while (!_stop) {
+            if (thread_info.tasks_version != tasks_version) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                tasks         = thread_info.tasks;
+                tasks_version = thread_info.tasks_version;
+            }
+
+            bool busy = false;
+            for (auto& task : tasks) {
+                busy |= _poll(*task, index);
+            }
+            if (tasks.empty()) {
+                std::this_thread::sleep_for(IDLE_SLEEP);
+            }
+
+            window_polls++;
+            thread_info.num_polls.add(1);
+            if (busy) {
+                window_busy_polls++;
+                thread_info.num_busy_polls.add(1);
+            }
+
+            if (!tasks.empty() && window_polls % POLLS_PER_CLOCK_CHECK != 0) {
+                continue;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (now - window_start < LOAD_WINDOW) {
+                continue;
+            }
+            const unsigned load = static_cast<unsigned>(
+                window_busy_polls * 100 / std::max<uint64_t>(window_polls, 1));
+            thread_info.load = load;
+            for (auto& task : tasks) {
+                if (task->thread != index) {
+                    continue;
+                }
+                const uint64_t busy_polls = task->num_busy_polls.get();
+                const uint64_t prev_polls =
+                    task->window_start_busy_polls.exchange(busy_polls);
+                task->window_busy_polls = busy_polls - prev_polls;
+            }
+            if (load <= THIEF_MAX_LOAD) {
+                _steal_task(index);
+            }
+            window_start      = now;
+            window_polls      = 0;
+            window_busy_polls = 0;
+        }
+    }
+
+    //! Poll a task if it is still owned by this thread, return true if it was
+    // busy
+    bool _poll(task_t& task, const size_t index)
+    {
+        // The order of these atomic operations matters: remove_task() first
+        // clears the owner, and then waits for polling to be cleared
+        if (task.polling.exchange(true)) {
+            return false;
+        }
+        bool busy = false;
+        if (task.thread == index) {
+            busy = task.fn();
+            if (busy) {
+                task.num_busy_polls.add(1);
+            }
+        }
+        task.polling = false;
+        return busy;
+    }
+
+    //! Take over a task from the busiest thread, if it is busy enough
+    void _steal_task(const size_t thief)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        thread_info_t* victim = nullptr;
+        for (size_t i = 0; i < _threads.size(); i++) {
+            thread_info_t& thread_info = *_threads[i];
+            // With a single task, there is nothing to balance
+            if (i == thief || thread_info.tasks.size() < 2
+                || thread_info.load < VICTIM_MIN_LOAD) {
+                continue;
+            }
+            if (!victim || thread_info.load > victim->load) {
+                victim = &thread_info;
+            }
+        }
+        if (!victim) {
+            return;
+        }
+
+        // Leave the busiest task where it is, and take the next busiest one.
+        // Taking the busiest one would only move the problem to this thread.
+        std::vector<task_sptr> tasks = victim->tasks;
+        std::sort(
+            tasks.begin(), tasks.end(), [](const task_sptr& a, const task_sptr& b) {
+                return a->window_busy_polls > b->window_busy_polls;
+            });
+        task_sptr task = tasks[1];
+
+        UHD_LOG_TRACE(LOG_ID,
+            "Moving task " << task->name << " from offload thread " << task->thread.load()
+                           << " to offload thread " << thief);
+        victim->tasks.erase(std::find(victim->tasks.begin(), victim->tasks.end(), task));
+        victim->tasks_version++;
+        task->thread = thief;
+        task->num_migrations++;
+        // The task has no busy polls in our current window yet
+        task->window_start_busy_polls = task->num_busy_polls.get();
+
+        thread_info_t& thread_info = *_threads[thief];
+        thread_info.tasks.push_back(task);
+        thread_info.tasks_version++;
+        thread_info.num_steals++;
+    }
+
+    // Protects the task lists, i.e., _tasks and thread_info_t::tasks
+    mutable std::mutex _mutex;
+    std::map<size_t, task_sptr> _tasks;
+    size_t _next_task_id = 0;
+
+    std::vector<std::unique_ptr<thread_info_t>> _threads;
+    std::atomic<bool> _stop{false};
+};
+
+offload_thread_pool::sptr offload_thread_pool::make(
+    const std::vector<std::vector<size_t>>& cpu_affinity_lists)
+{
+    return std::make_shared<offload_thread_pool_impl>(cpu_affinity_lists);
+}
@@ -0,0 +1,204 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/transport/rx_agc.hpp>
+#include <uhdlib/utils/fast_log.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr char LOG_ID[] = "RX_AGC";
+
+//! Power of a full-scale complex sc16 tone, which is 0 dBFS
+constexpr double FULL_SCALE_POWER = 32767.0 * 32767.0;
+
+} // namespace
+
+rx_agc::uptr rx_agc::make(const uhd::device_addr_t& args, const size_t num_chans)
+{
+    if (!args.cast<bool>("host_agc", false)) {
+        return nullptr;
+    }
+    settings_t settings;
+    settings.setpoint    = args.cast<double>("host_agc_setpoint", settings.setpoint);
+    settings.hysteresis  = args.cast<double>("host_agc_hysteresis", settings.hysteresis);
+    settings.max_step    = args.cast<double>("host_agc_max_step", settings.max_step);
+    settings.num_packets = args.cast<size_t>("host_agc_packets", settings.num_packets);
+    settings.latency     = args.cast<double>("host_agc_latency", settings.latency);
+    if (settings.hysteresis < 0 || settings.max_step <= 0 || settings.num_packets == 0
+        || settings.latency < 0) {
+        throw uhd::value_error("[rx_stream] Invalid host AGC settings!");
+    }
+    return std::make_unique<rx_agc>(settings, num_chans);
+}
+
+rx_agc::rx_agc(const settings_t& settings, const size_t num_chans)
+    : _settings(settings), _chans(num_chans)
+{
+    _worker_thread = std::thread([this]() { _worker(); });
+    uhd::set_thread_name(&_worker_thread, "uhd_rx_agc");
+}
+
+rx_agc::~rx_agc()
+{
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _stop = true;
+    }
+    _cond.notify_one();
+    _worker_thread.join();
+}
+
+void rx_agc::set_gain_fn(
+    gain_fn_t gain_fn, const double gain, const uhd::meta_range_t& gain_range)
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    _gain_fn           = std::move(gain_fn);
+    _shared_gain       = gain;
+    _shared_gain_range = gain_range;
+    _activated.store(true, std::memory_order_release);
+}
+
+bool rx_agc::check_gain_change(uhd::rx_metadata_t& metadata, const size_t nsamps)
+{
+    if (_state == state_t::INACTIVE) {
+        if (!_activated.load(std::memory_order_acquire)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> l(_mutex);
+        _gain       = _shared_gain;
+        _gain_range = _shared_gain_range;
+        _state      = state_t::MEASURING;
+    }
+    _has_packet_time = metadata.has_time_spec;
+    if (!_has_packet_time) {
+        if (_state == state_t::MEASURING && !_warned_no_time) {
+            UHD_LOG_FAST_WARNING(LOG_ID,
+                "Packets have no timestamps, the host AGC can't time gain changes");
+            _warned_no_time = true;
+        }
+        return false;
+    }
+    _packet_time      = metadata.get_time_spec();
+    _packet_nsamps    = nsamps;
+    _packet_samp_rate = metadata.has_time_ticks ? metadata.samp_rate : 0.0;
+    if (_state != state_t::REQUESTED || !_done.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_done_ok && _packet_time < _request_time) {
+        // The gain changes later in the stream
+        return false;
+    }
+    _done  = false;
+    _state = state_t::MEASURING;
+    if (!_done_ok) {
+        return false;
+    }
+    _gain                    = _done_gain;
+    metadata.has_gain_change = true;
+    metadata.gain            = _gain;
+    return true;
+}
+
+void rx_agc::end_packet()
+{
+    if (_state != state_t::MEASURING) {
+        return;
+    }
+    if (!_has_packet_time) {
+        // Without a time for the gain change, the measurement is useless
+        for (chan_power_t& chan : _chans) {
+            chan = chan_power_t();
+        }
+        return;
+    }
+    if (++_num_packets >= _settings.num_packets) {
+        _decide();
+    }
+}
+
+void rx_agc::_decide()
+{
+    double max_power = 0.0;
+    for (chan_power_t& chan : _chans) {
+        if (chan.nsamps != 0) {
+            max_power = std::max(max_power, double(chan.sum) / double(chan.nsamps));
+        }
+        chan = chan_power_t();
+    }
+    _num_packets = 0;
+
+    const double level = 10 * std::log10(std::max(max_power, 1.0) / FULL_SCALE_POWER);
+    const double error = _settings.setpoint - level;
+    if (std::abs(error) <= _settings.hysteresis) {
+        return;
+    }
+    const double step =
+        std::max(-_settings.max_step, std::min(_settings.max_step, error));
+    const double gain = _gain_range.clip(_gain + step);
+    if (gain == _gain) {
+        // Already at the limit of the gain range
+        return;
+    }
+
+    // Change the gain at the start of a later packet, if the packets are
+    // contiguous, so that no packet has samples with both gains
+    uhd::time_spec_t delay(_settings.latency);
+    if (_packet_samp_rate > 0 && _packet_nsamps != 0) {
+        const double packet_duration = _packet_nsamps / _packet_samp_rate;
+        const auto num_packets       = static_cast<long long>(
+            std::max(1.0, std::ceil(_settings.latency / packet_duration)));
+        delay                        = uhd::time_spec_t::from_ticks(
+            num_packets * _packet_nsamps, _packet_samp_rate);
+    }
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _request_pending = true;
+        _request_gain    = gain;
+        _request_time    = _packet_time + delay;
+    }
+    _state = state_t::REQUESTED;
+    _cond.notify_one();
+}
+
+void rx_agc::_worker()
+{
+    std::unique_lock<std::mutex> l(_mutex);
+    while (true) {
+        _cond.wait(l, [this]() { return _stop || _request_pending; });
+        if (_stop) {
+            return;
+        }
+        _request_pending         = false;
+        const double gain        = _request_gain;
+        const uhd::time_spec_t t = _request_time;
+        gain_fn_t gain_fn        = _gain_fn;
+
+        // Don't hold the lock while the device is busy
+        l.unlock();
+        bool ok             = true;
+        double coerced_gain = gain;
+        try {
+            coerced_gain = gain_fn(gain, t);
+        } catch (const uhd::exception& ex) {
+            UHD_LOG_ERROR(LOG_ID, "Failed to set the gain: " << ex.what());
+            ok = false;
+        }
+        l.lock();
+
+        _done_ok   = ok;
+        _done_gain = coerced_gain;
+        _done.store(true, std::memory_order_release);
+    }
+}
@@ -136,6 +136,27 @@ public:
             };
         }
         _props.at(xport_chan).get_buff = get_buff;
+        _props.at(xport_chan).xport.reset();
+    }
+
+    /*!
+     * Set the transport to get managed buffers from.
+     *
+     * This is equivalent to a getter function which calls
+     * zero_copy_if::get_recv_buff(), but saves going through a function
+     * object for every packet.
+     * \param xport_chan which transport channel
+     * \param xport the transport
+     */
+    void set_xport_chan_get_buff(
+        const size_t xport_chan, zero_copy_if::sptr xport, const bool flush = false)
+    {
+        if (flush) {
+            while (xport->get_recv_buff(0.0)) {
+            };
+        }
+        _props.at(xport_chan).get_buff = nullptr;
+        _props.at(xport_chan).xport    = xport;
     }
 
     /*!
@@ -290,6 +311,7 @@ private:
         {
         }
         get_buff_type get_buff;
+        zero_copy_if::sptr xport; // used instead of get_buff if set
         issue_stream_cmd_type issue_stream_cmd;
         size_t packet_count;
         handle_overflow_type handle_overflow;
@@ -390,6 +412,14 @@ private:
      * Extract all the relevant info and store.
      * Check the info to determine the return code.
      ******************************************************************/
+    UHD_INLINE managed_recv_buffer::sptr get_xport_chan_buff(
+        const size_t index, const double timeout)
+    {
+        const xport_chan_props_type& props = _props[index];
+        return props.xport ? props.xport->get_recv_buff(timeout)
+                           : props.get_buff(timeout);
+    }
+
     UHD_INLINE packet_type get_and_process_single_packet(const size_t index,
         per_buffer_info_type& prev_buffer_info,
         per_buffer_info_type& curr_buffer_info,
@@ -399,7 +429,7 @@ private:
         per_buffer_info_type& info      = curr_buffer_info;
         while (1) {
             // get a single packet from the transport layer
-            buff = _props[index].get_buff(timeout);
+            buff = get_xport_chan_buff(index, timeout);
             if (buff.get() == nullptr)
                 return PACKET_TIMEOUT_ERROR;
 
@@ -407,7 +437,7 @@ private:
             if (++recvd_packets > 1000) {
                 recvd_packets = 0;
                 buff.reset();
-                buff = _props[index].get_buff(timeout);
+                buff = get_xport_chan_buff(index, timeout);
                 if (buff.get() == nullptr)
                     return PACKET_TIMEOUT_ERROR;
             }
@@ -802,11 +832,28 @@ private:
 class recv_packet_streamer : public recv_packet_handler, public rx_streamer
 {
 public:
+    typedef std::function<void(stream_telemetry_t&)> telemetry_fn_type;
+
     recv_packet_streamer(const size_t max_num_samps)
     {
         _max_num_samps = max_num_samps;
     }
 
+    //! Set the function which fills in the telemetry of the transport
+    void set_telemetry_fn(const telemetry_fn_type& telemetry_fn)
+    {
+        _telemetry_fn = telemetry_fn;
+    }
+
+    stream_telemetry_t get_telemetry(void) const override
+    {
+        stream_telemetry_t telemetry;
+        if (_telemetry_fn) {
+            _telemetry_fn(telemetry);
+        }
+        return telemetry;
+    }
+
     size_t get_num_channels(void) const override
     {
         return this->size();
@@ -834,6 +881,7 @@ public:
 
 private:
     size_t _max_num_samps;
+    telemetry_fn_type _telemetry_fn;
 };
 
 }}} // namespace uhd::transport::sph
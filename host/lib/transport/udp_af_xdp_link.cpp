@@ -0,0 +1,547 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_af_xdp_link.hpp>
+#include <arpa/inet.h>
+#include <linux/ethtool.h>
+#include <linux/if_ether.h>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <boost/format.hpp>
+#include <chrono>
+#include <cstring>
+#include <ifaddrs.h>
+#include <mutex>
+#include <poll.h>
+#include <set>
+
+using namespace uhd::transport;
+
+constexpr uint64_t udp_af_xdp_frame_buff::NO_FRAME;
+constexpr size_t udp_af_xdp_link::HDR_LEN;
+constexpr size_t udp_af_xdp_link::UMEM_FRAME_SIZE;
+constexpr size_t udp_af_xdp_link::MAX_FRAME_SIZE;
+
+namespace {
+
+constexpr size_t ETH_HDR_LEN = sizeof(ethhdr);
+constexpr size_t IP_HDR_LEN  = sizeof(iphdr);
+constexpr size_t UDP_HDR_LEN = sizeof(udphdr);
+static_assert(ETH_HDR_LEN + IP_HDR_LEN + UDP_HDR_LEN == udp_af_xdp_link::HDR_LEN,
+    "Unexpected header sizes");
+
+//! Round up to the next power of two, as required for the ring sizes
+uint32_t next_pow2(const size_t n)
+{
+    uint32_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
+//! Ones' complement checksum of an IPv4 header without options
+uint16_t ipv4_checksum(const iphdr* hdr)
+{
+    const uint16_t* words = reinterpret_cast<const uint16_t*>(hdr);
+    uint32_t sum          = 0;
+    for (size_t i = 0; i < IP_HDR_LEN / 2; i++) {
+        sum += words[i];
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return static_cast<uint16_t>(~sum);
+}
+
+/*! Registry of the NIC queues claimed by AF_XDP links in this process
+ *
+ * Only one AF_XDP socket can be bound to a queue, so every link needs its
+ * own queue.
+ */
+class queue_registry
+{
+public:
+    static queue_registry& get()
+    {
+        static queue_registry registry;
+        return registry;
+    }
+
+    bool claim(const std::string& ifname, const uint32_t queue)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _queues.insert({ifname, queue}).second;
+    }
+
+    void release(const std::string& ifname, const uint32_t queue)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queues.erase({ifname, queue});
+    }
+
+private:
+    std::mutex _mutex;
+    std::set<std::pair<std::string, uint32_t>> _queues;
+};
+
+//! Return the name of the interface which has the IPv4 address \p ipv4
+std::string get_ifname_for_ipv4(const uint32_t ipv4)
+{
+    ifaddrs* ifaddr;
+    if (getifaddrs(&ifaddr) != 0) {
+        throw uhd::runtime_error(
+            str(boost::format("getifaddrs() failed: %s") % strerror(errno)));
+    }
+    std::string ifname;
+    for (ifaddrs* ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next) {
+        if (ifa->ifa_addr == nullptr || ifa->ifa_addr->sa_family != AF_INET) {
+            continue;
+        }
+        if (reinterpret_cast<sockaddr_in*>(ifa->ifa_addr)->sin_addr.s_addr == ipv4) {
+            ifname = ifa->ifa_name;
+            break;
+        }
+    }
+    freeifaddrs(ifaddr);
+    return ifname;
+}
+
+} // namespace
+
+udp_af_xdp_link::udp_af_xdp_link(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const std::vector<uint32_t>& queues)
+    : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
+    , send_link_base_t(params.num_send_frames, params.send_frame_size)
+{
+    // The kernel socket reserves the local port and tells us which local
+    // address is used to reach the device
+    _socket      = open_udp_socket(addr, port, _io_service);
+    _local_ipv4  = htonl(_socket->local_endpoint().address().to_v4().to_ulong());
+    _local_port  = htons(_socket->local_endpoint().port());
+    _remote_ipv4 = htonl(_socket->remote_endpoint().address().to_v4().to_ulong());
+    _remote_port = htons(_socket->remote_endpoint().port());
+
+    try {
+        init_addresses(queues);
+        init_xsk();
+    } catch (...) {
+        release_resources();
+        throw;
+    }
+
+    _recv_buffs.resize(params.num_recv_frames);
+    for (auto& buff : _recv_buffs) {
+        recv_link_base_t::preload_free_buff(&buff);
+    }
+
+    _send_buffs.resize(params.num_send_frames);
+    for (auto& buff : _send_buffs) {
+        send_link_base_t::preload_free_buff(&buff);
+    }
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        _tx_free_frames.push_back((_num_rx_umem_frames + i) * UMEM_FRAME_SIZE);
+    }
+
+    // Prepare the headers of outgoing frames
+    _tx_hdr.fill(0);
+    auto* eth = reinterpret_cast<ethhdr*>(_tx_hdr.data());
+    std::memcpy(eth->h_dest, _remote_mac, ETH_ALEN);
+    std::memcpy(eth->h_source, _local_mac, ETH_ALEN);
+    eth->h_proto = htons(ETH_P_IP);
+    auto* ip     = reinterpret_cast<iphdr*>(_tx_hdr.data() + ETH_HDR_LEN);
+    ip->version  = 4;
+    ip->ihl      = IP_HDR_LEN / 4;
+    ip->frag_off = htons(IP_DF);
+    ip->ttl      = 64;
+    ip->protocol = IPPROTO_UDP;
+    ip->saddr    = _local_ipv4;
+    ip->daddr    = _remote_ipv4;
+    auto* udp    = reinterpret_cast<udphdr*>(_tx_hdr.data() + ETH_HDR_LEN + IP_HDR_LEN);
+    udp->source  = _local_port;
+    udp->dest    = _remote_port;
+
+    add_flow_rule();
+
+    auto info   = udp_af_xdp_adapter_info(_ifname);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("AF_XDP") << boost::format("Created AF_XDP link to %s:%s on %s, "
+                                                "queue %d (%s)")
+                                      % addr % port % _ifname % _queue_id
+                                      % (_zero_copy ? "zero-copy" : "copy mode");
+    UHD_LOGGER_TRACE("AF_XDP") << "Local UDP port: " << get_local_port();
+}
+
+udp_af_xdp_link::~udp_af_xdp_link()
+{
+    if (_num_rx_dropped > 0) {
+        UHD_LOG_DEBUG("AF_XDP",
+            "Dropped " << _num_rx_dropped << " frames on " << _ifname << " queue "
+                       << _queue_id << " which were not addressed to this link");
+    }
+    release_resources();
+}
+
+uint16_t udp_af_xdp_link::get_local_port() const
+{
+    return ntohs(_local_port);
+}
+
+void udp_af_xdp_link::release_resources()
+{
+    if (_flow_rule_loc >= 0) {
+        ethtool_rxnfc nfc{};
+        nfc.cmd         = ETHTOOL_SRXCLSRLDEL;
+        nfc.fs.location = static_cast<uint32_t>(_flow_rule_loc);
+        ifreq ifr{};
+        std::strncpy(ifr.ifr_name, _ifname.c_str(), IFNAMSIZ - 1);
+        ifr.ifr_data = reinterpret_cast<char*>(&nfc);
+        if (ioctl(_socket->native_handle(), SIOCETHTOOL, &ifr) != 0) {
+            UHD_LOG_WARNING("AF_XDP",
+                "Failed to remove flow rule " << _flow_rule_loc << " from "
+                                              << _ifname << ": " << strerror(errno));
+        }
+        _flow_rule_loc = -1;
+    }
+    if (_xsk) {
+        xsk_socket__delete(_xsk);
+        _xsk = nullptr;
+    }
+    if (_umem) {
+        xsk_umem__delete(_umem);
+        _umem = nullptr;
+    }
+    if (_umem_area) {
+        munmap(_umem_area, _umem_size);
+        _umem_area = nullptr;
+    }
+    if (_queue_claimed) {
+        queue_registry::get().release(_ifname, _queue_id);
+        _queue_claimed = false;
+    }
+}
+
+void udp_af_xdp_link::init_addresses(const std::vector<uint32_t>& queues)
+{
+    const int sock_fd = _socket->native_handle();
+
+    _ifname = get_ifname_for_ipv4(_local_ipv4);
+    if (_ifname.empty()) {
+        throw uhd::runtime_error(str(boost::format("No interface has the address %s")
+                                     % _socket->local_endpoint().address().to_string()));
+    }
+
+    ifreq ifr{};
+    std::strncpy(ifr.ifr_name, _ifname.c_str(), IFNAMSIZ - 1);
+    if (ioctl(sock_fd, SIOCGIFHWADDR, &ifr) != 0) {
+        throw uhd::runtime_error(str(boost::format("Cannot get MAC address of %s: %s")
+                                     % _ifname % strerror(errno)));
+    }
+    std::memcpy(_local_mac, ifr.ifr_hwaddr.sa_data, ETH_ALEN);
+
+    // The device has already been contacted through its management
+    // interface on the same address, so the kernel knows its MAC
+    arpreq req{};
+    auto* pa            = reinterpret_cast<sockaddr_in*>(&req.arp_pa);
+    pa->sin_family      = AF_INET;
+    pa->sin_addr.s_addr = _remote_ipv4;
+    std::strncpy(req.arp_dev, _ifname.c_str(), sizeof(req.arp_dev) - 1);
+    if (ioctl(sock_fd, SIOCGARP, &req) != 0 || !(req.arp_flags & ATF_COM)) {
+        throw uhd::runtime_error(
+            str(boost::format("No ARP entry for %s on %s. AF_XDP links require the "
+                              "device to be directly connected to the host.")
+                % _socket->remote_endpoint().address().to_string() % _ifname));
+    }
+    std::memcpy(_remote_mac, req.arp_ha.sa_data, ETH_ALEN);
+
+    for (const uint32_t queue : queues) {
+        if (queue_registry::get().claim(_ifname, queue)) {
+            _queue_id      = queue;
+            _queue_claimed = true;
+            return;
+        }
+    }
+    throw uhd::runtime_error(
+        str(boost::format("All AF_XDP queues of %s are in use") % _ifname));
+}
+
+void udp_af_xdp_link::init_xsk()
+{
+    // Ring sizes must be powers of two. The fill ring and the RX ring can
+    // hold every RX frame, and the TX and completion rings every TX frame,
+    // so producing into them never fails.
+    _num_rx_umem_frames     = next_pow2(get_num_recv_frames());
+    const uint32_t tx_size  = next_pow2(get_num_send_frames());
+    const size_t num_frames = _num_rx_umem_frames + get_num_send_frames();
+    _umem_size              = num_frames * UMEM_FRAME_SIZE;
+
+    void* area = mmap(nullptr,
+        _umem_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    if (area == MAP_FAILED) {
+        throw uhd::runtime_error(
+            str(boost::format("Cannot allocate %d bytes of UMEM: %s") % _umem_size
+                % strerror(errno)));
+    }
+    _umem_area = area;
+
+    xsk_umem_config umem_cfg{};
+    umem_cfg.fill_size      = _num_rx_umem_frames;
+    umem_cfg.comp_size      = tx_size;
+    umem_cfg.frame_size     = UMEM_FRAME_SIZE;
+    umem_cfg.frame_headroom = 0;
+    umem_cfg.flags          = 0;
+    int ret = xsk_umem__create(
+        &_umem, _umem_area, _umem_size, &_fill_ring, &_comp_ring, &umem_cfg);
+    if (ret != 0) {
+        _umem = nullptr;
+        throw uhd::runtime_error(
+            str(boost::format("Cannot create UMEM: %s") % strerror(-ret)));
+    }
+
+    xsk_socket_config xsk_cfg{};
+    xsk_cfg.rx_size    = _num_rx_umem_frames;
+    xsk_cfg.tx_size    = tx_size;
+    xsk_cfg.xdp_flags  = 0;
+    xsk_cfg.bind_flags = XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY;
+    ret                = xsk_socket__create(
+        &_xsk, _ifname.c_str(), _queue_id, _umem, &_rx_ring, &_tx_ring, &xsk_cfg);
+    _zero_copy = (ret == 0);
+    if (ret != 0) {
+        // Not all drivers support zero-copy mode. Copy mode still saves the
+        // trip through the network stack.
+        xsk_cfg.bind_flags = XDP_USE_NEED_WAKEUP | XDP_COPY;
+        ret                = xsk_socket__create(
+            &_xsk, _ifname.c_str(), _queue_id, _umem, &_rx_ring, &_tx_ring, &xsk_cfg);
+        if (ret == 0) {
+            UHD_LOG_INFO("AF_XDP",
+                _ifname << " does not support zero-copy AF_XDP, using copy mode");
+        }
+    }
+    if (ret != 0) {
+        _xsk = nullptr;
+        throw uhd::runtime_error(
+            str(boost::format("Cannot create AF_XDP socket on %s queue %d: %s")
+                % _ifname % _queue_id % strerror(-ret)));
+    }
+    _xsk_fd = xsk_socket__fd(_xsk);
+
+    // Hand all RX frames to the kernel
+    uint32_t idx;
+    xsk_ring_prod__reserve(&_fill_ring, _num_rx_umem_frames, &idx);
+    for (size_t i = 0; i < _num_rx_umem_frames; i++) {
+        *xsk_ring_prod__fill_addr(&_fill_ring, idx + i) = i * UMEM_FRAME_SIZE;
+    }
+    xsk_ring_prod__submit(&_fill_ring, _num_rx_umem_frames);
+}
+
+void udp_af_xdp_link::add_flow_rule()
+{
+    ethtool_rxnfc nfc{};
+    nfc.cmd                        = ETHTOOL_SRXCLSRLINS;
+    nfc.fs.flow_type               = UDP_V4_FLOW;
+    nfc.fs.h_u.udp_ip4_spec.ip4src = _remote_ipv4;
+    nfc.fs.h_u.udp_ip4_spec.pdst   = _local_port;
+    nfc.fs.m_u.udp_ip4_spec.ip4src = 0xFFFFFFFF;
+    nfc.fs.m_u.udp_ip4_spec.pdst   = 0xFFFF;
+    nfc.fs.ring_cookie             = _queue_id;
+    nfc.fs.location                = RX_CLS_LOC_ANY;
+    ifreq ifr{};
+    std::strncpy(ifr.ifr_name, _ifname.c_str(), IFNAMSIZ - 1);
+    ifr.ifr_data = reinterpret_cast<char*>(&nfc);
+    if (ioctl(_socket->native_handle(), SIOCETHTOOL, &ifr) != 0) {
+        UHD_LOG_WARNING("AF_XDP",
+            "Could not add a flow rule on "
+                << _ifname << " (" << strerror(errno)
+                << "). Make sure the traffic for this link is steered to queue "
+                << _queue_id << ", e.g.: ethtool -N " << _ifname
+                << " flow-type udp4 dst-port " << get_local_port() << " action "
+                << _queue_id);
+        return;
+    }
+    _flow_rule_loc = nfc.fs.location;
+}
+
+void udp_af_xdp_link::kick_tx()
+{
+    if (!xsk_ring_prod__needs_wakeup(&_tx_ring)) {
+        return;
+    }
+    if (::sendto(_xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0) < 0) {
+        // These indicate that the driver is busy and will pick up the
+        // frames later
+        if (errno == EAGAIN || errno == EBUSY || errno == ENOBUFS || errno == EINTR) {
+            return;
+        }
+        throw uhd::io_error(
+            str(boost::format("send error on AF_XDP socket: %s") % strerror(errno)));
+    }
+}
+
+void udp_af_xdp_link::reap_tx_completions()
+{
+    if (_tx_in_flight == 0) {
+        return;
+    }
+    uint32_t idx;
+    const uint32_t num_done = xsk_ring_cons__peek(&_comp_ring, _tx_in_flight, &idx);
+    for (uint32_t i = 0; i < num_done; i++) {
+        _tx_free_frames.push_back(*xsk_ring_cons__comp_addr(&_comp_ring, idx + i));
+    }
+    xsk_ring_cons__release(&_comp_ring, num_done);
+    _tx_in_flight -= num_done;
+}
+
+size_t udp_af_xdp_link::get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    while (true) {
+        uint32_t idx;
+        if (xsk_ring_cons__peek(&_rx_ring, 1, &idx) == 0) {
+            // poll() also wakes up the driver if it is waiting for the fill
+            // ring to be replenished
+            if (timeout_ms == 0 && !xsk_ring_prod__needs_wakeup(&_fill_ring)) {
+                return 0;
+            }
+            pollfd pfd;
+            pfd.fd     = _xsk_fd;
+            pfd.events = POLLIN;
+            if (::poll(&pfd, 1, timeout_ms) <= 0
+                || xsk_ring_cons__peek(&_rx_ring, 1, &idx) == 0) {
+                return 0; // timeout
+            }
+            // Don't wait again if a frame must be dropped
+            timeout_ms = 0;
+        }
+        const xdp_desc* desc = xsk_ring_cons__rx_desc(&_rx_ring, idx);
+        const uint64_t addr  = desc->addr;
+        const size_t len     = desc->len;
+        xsk_ring_cons__release(&_rx_ring, 1);
+
+        // Only accept unfragmented UDP/IPv4 packets from the device to our
+        // port. Anything else on this queue cannot be passed back to the
+        // kernel and gets dropped.
+        uint8_t* frame   = static_cast<uint8_t*>(xsk_umem__get_data(_umem_area, addr));
+        const auto* eth  = reinterpret_cast<const ethhdr*>(frame);
+        const auto* ip   = reinterpret_cast<const iphdr*>(frame + ETH_HDR_LEN);
+        const size_t ihl = (len >= ETH_HDR_LEN + IP_HDR_LEN) ? ip->ihl * 4 : 0;
+        const auto* udp  = reinterpret_cast<const udphdr*>(frame + ETH_HDR_LEN + ihl);
+        const size_t payload_offset = ETH_HDR_LEN + ihl + UDP_HDR_LEN;
+        const size_t payload_len =
+            (ihl >= IP_HDR_LEN && len >= payload_offset) ? ntohs(udp->len) - UDP_HDR_LEN
+                                                         : 0;
+        if (ihl < IP_HDR_LEN || len < payload_offset || eth->h_proto != htons(ETH_P_IP)
+            || ip->protocol != IPPROTO_UDP || ip->saddr != _remote_ipv4
+            || (ip->frag_off & htons(IP_MF | IP_OFFMASK)) || udp->dest != _local_port
+            || ntohs(udp->len) <= UDP_HDR_LEN || payload_offset + payload_len > len) {
+            auto& xdp_buff = static_cast<udp_af_xdp_frame_buff&>(buff);
+            xdp_buff.set_frame(nullptr, addr);
+            release_recv_buff_derived(buff);
+            _num_rx_dropped++;
+            continue;
+        }
+
+        static_cast<udp_af_xdp_frame_buff&>(buff).set_frame(frame + payload_offset, addr);
+        return payload_len;
+    }
+}
+
+bool udp_af_xdp_link::get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    auto& xdp_buff = static_cast<udp_af_xdp_frame_buff&>(buff);
+    // Buffers released without sending anything keep their frame
+    if (xdp_buff.get_umem_addr() != udp_af_xdp_frame_buff::NO_FRAME) {
+        return true;
+    }
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    reap_tx_completions();
+    while (_tx_free_frames.empty()) {
+        if (timeout_ms == 0
+            || (timeout_ms > 0 && std::chrono::steady_clock::now() >= deadline)) {
+            return false;
+        }
+        // Completions are only written once the driver processed the TX ring
+        kick_tx();
+        pollfd pfd;
+        pfd.fd     = _xsk_fd;
+        pfd.events = POLLOUT;
+        ::poll(&pfd, 1, 1);
+        reap_tx_completions();
+    }
+
+    const uint64_t addr = _tx_free_frames.back();
+    _tx_free_frames.pop_back();
+    uint8_t* frame = static_cast<uint8_t*>(xsk_umem__get_data(_umem_area, addr));
+    xdp_buff.set_frame(frame + HDR_LEN, addr);
+    return true;
+}
+
+void udp_af_xdp_link::release_send_buff_derived(frame_buff& buff)
+{
+    auto& xdp_buff      = static_cast<udp_af_xdp_frame_buff&>(buff);
+    const uint64_t addr = xdp_buff.get_umem_addr();
+    uint8_t* frame      = static_cast<uint8_t*>(xsk_umem__get_data(_umem_area, addr));
+    const size_t len    = buff.packet_size();
+
+    std::memcpy(frame, _tx_hdr.data(), HDR_LEN);
+    auto* ip    = reinterpret_cast<iphdr*>(frame + ETH_HDR_LEN);
+    ip->tot_len = htons(static_cast<uint16_t>(IP_HDR_LEN + UDP_HDR_LEN + len));
+    ip->check   = ipv4_checksum(ip);
+    auto* udp   = reinterpret_cast<udphdr*>(frame + ETH_HDR_LEN + IP_HDR_LEN);
+    udp->len    = htons(static_cast<uint16_t>(UDP_HDR_LEN + len));
+
+    uint32_t idx;
+    // The TX ring can hold every TX frame, so this cannot fail
+    xsk_ring_prod__reserve(&_tx_ring, 1, &idx);
+    xdp_desc* desc = xsk_ring_prod__tx_desc(&_tx_ring, idx);
+    desc->addr     = addr;
+    desc->len      = static_cast<uint32_t>(HDR_LEN + len);
+    xsk_ring_prod__submit(&_tx_ring, 1);
+    _tx_in_flight++;
+    kick_tx();
+
+    xdp_buff.set_frame(nullptr, udp_af_xdp_frame_buff::NO_FRAME);
+}
+
+udp_af_xdp_link::sptr udp_af_xdp_link::make(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const std::vector<uint32_t>& queues)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+    UHD_ASSERT_THROW(!queues.empty());
+
+    // Every packet must fit into a single UMEM frame
+    link_params_t xdp_params = params;
+    if (xdp_params.recv_frame_size > MAX_FRAME_SIZE
+        || xdp_params.send_frame_size > MAX_FRAME_SIZE) {
+        UHD_LOG_DEBUG("AF_XDP",
+            "Limiting frame sizes to " << MAX_FRAME_SIZE << " bytes for AF_XDP");
+        xdp_params.recv_frame_size = std::min(xdp_params.recv_frame_size, MAX_FRAME_SIZE);
+        xdp_params.send_frame_size = std::min(xdp_params.send_frame_size, MAX_FRAME_SIZE);
+    }
+
+    return sptr(new udp_af_xdp_link(addr, port, xdp_params, queues));
+}
@@ -8,22 +8,125 @@
 #include <uhdlib/transport/adapter.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <boost/format.hpp>
+#include <cstring>
+#ifdef HAVE_RECVMMSG
+#    include <sys/socket.h>
+#endif
 
 using namespace uhd::transport;
 
 namespace asio = boost::asio;
 
+namespace {
+
+//! Upper limit for recv_batch_size, also sizes the stack arrays for recvmmsg()
+constexpr size_t MAX_RECV_BATCH_SIZE = 64;
+
+//! Number of frames owned by the io_uring, unless recv_batch_size is larger
+constexpr size_t MIN_IO_URING_FRAMES = 32;
+constexpr size_t MAX_IO_URING_FRAMES = 4096;
+
+size_t get_recv_batch_size(const link_params_t& params)
+{
+    if (params.use_io_uring) {
+        // recv_batch_size is the number of frames of the io_uring instead
+        return 1;
+    }
+    size_t batch_size = std::max<size_t>(params.recv_batch_size, 1);
+#ifdef HAVE_RECVMMSG
+    if (batch_size > MAX_RECV_BATCH_SIZE) {
+        UHD_LOG_WARNING("UDP",
+            "recv_batch_size of " << batch_size << " exceeds the maximum of "
+                                  << MAX_RECV_BATCH_SIZE << ", using the maximum.");
+        batch_size = MAX_RECV_BATCH_SIZE;
+    }
+#else
+    if (batch_size > 1) {
+        UHD_LOG_WARNING("UDP",
+            "Batched receives (recv_batch_size) are not supported on this "
+            "platform, receiving one frame per call.");
+        batch_size = 1;
+    }
+#endif
+    return batch_size;
+}
+
+//! Return the number of frames to hand to the io_uring (0 if not enabled)
+size_t get_io_uring_frames(const link_params_t& params)
+{
+    if (!params.use_io_uring) {
+        return 0;
+    }
+    const size_t min_frames = std::min(
+        std::max(params.recv_batch_size, MIN_IO_URING_FRAMES), MAX_IO_URING_FRAMES);
+    // The kernel requires a power of two
+    size_t num_frames = 1;
+    while (num_frames < min_frames) {
+        num_frames <<= 1;
+    }
+    return num_frames;
+}
+
+} // namespace
+
 udp_boost_asio_link::udp_boost_asio_link(
     const std::string& addr, const std::string& port, const link_params_t& params)
     : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
     , send_link_base_t(params.num_send_frames, params.send_frame_size)
-    , _recv_memory_pool(buffer_pool::make(params.num_recv_frames, params.recv_frame_size))
-    , _send_memory_pool(buffer_pool::make(params.num_send_frames, params.send_frame_size))
+    , _recv_batch_size(get_recv_batch_size(params))
 {
+    // create, open, and connect the socket
+    _socket  = open_udp_socket(addr, port, _io_service);
+    _sock_fd = _socket->native_handle();
+
+    auto info   = udp_boost_asio_adapter_info(*_socket);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    // Now that we know which NIC we're using, put the frames on its NUMA node
+    const int numa_node =
+        (params.numa_node >= 0) ? params.numa_node : info.get_numa_node();
+    const size_t num_io_uring_frames = get_io_uring_frames(params);
+    const size_t num_pool_frames =
+        params.num_recv_frames + _recv_batch_size - 1 + num_io_uring_frames;
+    _recv_memory_pool = buffer_pool::make(num_pool_frames,
+        params.recv_frame_size,
+        16,
+        numa_node,
+        params.use_hugepages);
+    _send_memory_pool = buffer_pool::make(params.num_send_frames,
+        params.send_frame_size,
+        16,
+        numa_node,
+        params.use_hugepages);
+
     for (size_t i = 0; i < params.num_recv_frames; i++) {
         _recv_buffs.push_back(udp_boost_asio_frame_buff(_recv_memory_pool->at(i)));
     }
 
+    // The spare frames for batched receives come after the regular ones
+    _recv_batch_mem.resize(_recv_batch_size, nullptr);
+    _recv_batch_len.resize(_recv_batch_size, 0);
+    for (size_t i = 1; i < _recv_batch_size; i++) {
+        _recv_batch_mem[i] = _recv_memory_pool->at(params.num_recv_frames + i - 1);
+    }
+
+    // The frames of the io_uring come last
+    if (num_io_uring_frames) {
+        std::vector<void*> io_uring_frames;
+        const size_t first_frame = params.num_recv_frames + _recv_batch_size - 1;
+        for (size_t i = 0; i < num_io_uring_frames; i++) {
+            io_uring_frames.push_back(_recv_memory_pool->at(first_frame + i));
+        }
+        _io_uring =
+            io_uring_recv::make(_sock_fd, io_uring_frames, params.recv_frame_size);
+        if (!_io_uring) {
+            UHD_LOG_WARNING("UDP",
+                "Receiving through io_uring (use_io_uring) is not supported on "
+                "this system, using recv() instead.");
+        }
+    }
+
     for (size_t i = 0; i < params.num_send_frames; i++) {
         _send_buffs.push_back(udp_boost_asio_frame_buff(_send_memory_pool->at(i)));
     }
@@ -36,15 +139,18 @@ udp_boost_asio_link::udp_boost_asio_link(
         send_link_base_t::preload_free_buff(&buff);
     }
 
-    // create, open, and connect the socket
-    _socket  = open_udp_socket(addr, port, _io_service);
-    _sock_fd = _socket->native_handle();
-
-    auto info   = udp_boost_asio_adapter_info(*_socket);
-    auto& ctx   = adapter_ctx::get();
-    _adapter_id = ctx.register_adapter(info);
-
     UHD_LOGGER_TRACE("UDP") << boost::format("Created UDP link to %s:%s") % addr % port;
+    if (numa_node >= 0) {
+        UHD_LOGGER_TRACE("UDP") << "Placing frame buffers on NUMA node " << numa_node;
+    }
+    if (_recv_batch_size > 1) {
+        UHD_LOGGER_TRACE("UDP") << "Receiving up to " << _recv_batch_size
+                                << " frames per call";
+    }
+    if (_io_uring) {
+        UHD_LOGGER_TRACE("UDP") << "Receiving through io_uring with "
+                                << num_io_uring_frames << " frames";
+    }
     UHD_LOGGER_TRACE("UDP") << boost::format("Local UDP socket endpoint: %s:%s")
                                    % get_local_addr() % get_local_port();
 }
@@ -59,6 +165,71 @@ std::string udp_boost_asio_link::get_local_addr() const
     return _socket->local_endpoint().address().to_string();
 }
 
+size_t udp_boost_asio_link::recv_batched(
+    udp_boost_asio_frame_buff& buff, int32_t timeout_ms)
+{
+    // Hand out the next frame of the current batch, if any. The memory
+    // previously held by buff becomes a spare frame.
+    if (_recv_batch_next < _recv_batch_count) {
+        const size_t idx = _recv_batch_next++;
+        void* spare      = buff.data();
+        buff.set_data(_recv_batch_mem[idx]);
+        _recv_batch_mem[idx] = spare;
+        return _recv_batch_len[idx];
+    }
+
+#ifdef HAVE_RECVMMSG
+    _recv_batch_mem[0] = buff.data();
+    const size_t frame_size = get_recv_frame_size();
+    iovec iovs[MAX_RECV_BATCH_SIZE];
+    mmsghdr msgs[MAX_RECV_BATCH_SIZE];
+    std::memset(msgs, 0, sizeof(mmsghdr) * _recv_batch_size);
+    for (size_t i = 0; i < _recv_batch_size; i++) {
+        iovs[i].iov_base           = _recv_batch_mem[i];
+        iovs[i].iov_len            = frame_size;
+        msgs[i].msg_hdr.msg_iov    = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // Try a non-blocking receive first, and only wait if nothing is pending
+    int num_msgs = ::recvmmsg(_sock_fd,
+        msgs,
+        static_cast<unsigned int>(_recv_batch_size),
+        MSG_DONTWAIT,
+        nullptr);
+    if (num_msgs <= 0) {
+        if (!wait_for_recv_ready(_sock_fd, timeout_ms)) {
+            return 0; // timeout
+        }
+        num_msgs = ::recvmmsg(_sock_fd,
+            msgs,
+            static_cast<unsigned int>(_recv_batch_size),
+            MSG_DONTWAIT,
+            nullptr);
+        if (num_msgs < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return 0;
+            }
+            throw uhd::io_error(
+                str(boost::format("recv error on socket: %s") % strerror(errno)));
+        }
+    }
+
+    for (size_t i = 0; i < size_t(num_msgs); i++) {
+        if (msgs[i].msg_len == 0) {
+            throw uhd::io_error("socket closed");
+        }
+        _recv_batch_len[i] = msgs[i].msg_len;
+    }
+    // Frame 0 was received into buff, the rest are handed out by the next calls
+    _recv_batch_next  = 1;
+    _recv_batch_count = size_t(num_msgs);
+    return _recv_batch_len[0];
+#else
+    return recv_udp_packet(_sock_fd, buff.data(), get_recv_frame_size(), timeout_ms);
+#endif
+}
+
 size_t udp_boost_asio_link::resize_recv_socket_buffer(size_t num_bytes)
 {
     return resize_udp_socket_buffer<asio::socket_base::receive_buffer_size>(
@@ -51,6 +51,8 @@ udp_dpdk_link::udp_dpdk_link(dpdk::port_id_t port_id,
     uint16_t local_port_num = rte_cpu_to_be_16(std::stoul(local_port));
     // Get an unused UDP port for listening
     _local_port = _port->alloc_udp_port(local_port_num);
+    // Receive and send on the DMA queue which the NIC steers that UDP port to
+    _queue = _port->alloc_queue(_local_port);
 
     // Validate params
     const size_t max_frame_size = _port->get_mtu() - dpdk::HDR_SIZE_UDP_IPV4;
@@ -78,7 +80,11 @@ udp_dpdk_link::udp_dpdk_link(dpdk::port_id_t port_id,
                % params.send_frame_size;
 }
 
-udp_dpdk_link::~udp_dpdk_link() {}
+udp_dpdk_link::~udp_dpdk_link()
+{
+    flush_recv_buffs();
+    _port->free_queue(_local_port);
+}
 
 udp_dpdk_link::sptr udp_dpdk_link::make(const std::string& remote_addr,
     const std::string& remote_port,
@@ -159,7 +165,25 @@ void udp_dpdk_link::release_recv_buff(frame_buff::uptr buff)
 {
     dpdk_frame_buff* buff_ptr = (dpdk_frame_buff*)buff.release();
     assert(buff_ptr);
-    rte_pktmbuf_free(buff_ptr->get_pktmbuf());
+    _recv_free_mbufs[_num_recv_free_mbufs++] = buff_ptr->get_pktmbuf();
+    if (_num_recv_free_mbufs == RECV_FREE_BURST_SIZE) {
+        flush_recv_buffs();
+    }
+}
+
+void udp_dpdk_link::flush_recv_buffs()
+{
+    if (_num_recv_free_mbufs == 0) {
+        return;
+    }
+#if RTE_VER_YEAR > 20 || (RTE_VER_YEAR == 20 && RTE_VER_MONTH >= 5)
+    rte_pktmbuf_free_bulk(_recv_free_mbufs.data(), _num_recv_free_mbufs);
+#else
+    for (size_t i = 0; i < _num_recv_free_mbufs; i++) {
+        rte_pktmbuf_free(_recv_free_mbufs[i]);
+    }
+#endif
+    _num_recv_free_mbufs = 0;
 }
 
 frame_buff::uptr udp_dpdk_link::get_send_buff(int32_t /*timeout_ms*/)
@@ -0,0 +1,389 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_rio_link.hpp>
+#include <ws2tcpip.h>
+#include <boost/format.hpp>
+#include <chrono>
+
+using namespace uhd::transport;
+
+constexpr size_t udp_rio_link::MAX_COMPLETIONS;
+
+namespace {
+
+constexpr char LOG_ID[] = "RIO";
+
+//! Frames start on cache line boundaries
+constexpr size_t FRAME_ALIGNMENT = 64;
+
+size_t align_frame_size(const size_t frame_size)
+{
+    return (frame_size + FRAME_ALIGNMENT - 1) & ~(FRAME_ALIGNMENT - 1);
+}
+
+std::string get_wsa_error()
+{
+    return str(boost::format("WSA error %d") % WSAGetLastError());
+}
+
+} // namespace
+
+udp_rio_link::udp_rio_link(
+    const std::string& addr, const std::string& port, const link_params_t& params)
+    : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
+    , send_link_base_t(params.num_send_frames, params.send_frame_size)
+{
+    std::string local_ip;
+    try {
+        local_ip = init_socket(addr, port);
+        init_queues(params);
+    } catch (...) {
+        release_resources();
+        throw;
+    }
+
+    _recv_buffs.resize(params.num_recv_frames);
+    for (auto& buff : _recv_buffs) {
+        recv_link_base_t::preload_free_buff(&buff);
+    }
+
+    _send_buffs.resize(params.num_send_frames);
+    for (auto& buff : _send_buffs) {
+        send_link_base_t::preload_free_buff(&buff);
+    }
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        _send_free_frames.push_back(i);
+    }
+
+    auto info   = udp_rio_adapter_info(local_ip);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE(LOG_ID) << boost::format("Created RIO link to %s:%s from %s, "
+                                              "%d receive frames, %d send frames")
+                                    % addr % port % local_ip % params.num_recv_frames
+                                    % params.num_send_frames;
+    UHD_LOGGER_TRACE(LOG_ID) << "Local UDP port: " << get_local_port();
+}
+
+udp_rio_link::~udp_rio_link()
+{
+    release_resources();
+}
+
+void udp_rio_link::release_resources()
+{
+    // Closing the socket also frees its request queue
+    if (_socket != INVALID_SOCKET) {
+        closesocket(_socket);
+        _socket = INVALID_SOCKET;
+    }
+    _rq = RIO_INVALID_RQ;
+    if (_recv_cq != RIO_INVALID_CQ) {
+        _rio.RIOCloseCompletionQueue(_recv_cq);
+        _recv_cq = RIO_INVALID_CQ;
+    }
+    if (_send_cq != RIO_INVALID_CQ) {
+        _rio.RIOCloseCompletionQueue(_send_cq);
+        _send_cq = RIO_INVALID_CQ;
+    }
+    if (_buffer_id != RIO_INVALID_BUFFERID) {
+        _rio.RIODeregisterBuffer(_buffer_id);
+        _buffer_id = RIO_INVALID_BUFFERID;
+    }
+    if (_region) {
+        VirtualFree(_region, 0, MEM_RELEASE);
+        _region = nullptr;
+    }
+    for (HANDLE* event : {&_recv_event, &_send_event}) {
+        if (*event) {
+            CloseHandle(*event);
+            *event = nullptr;
+        }
+    }
+    if (_wsa_started) {
+        WSACleanup();
+        _wsa_started = false;
+    }
+}
+
+std::string udp_rio_link::init_socket(const std::string& addr, const std::string& port)
+{
+    WSADATA wsa_data;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0) {
+        throw uhd::runtime_error("Cannot initialize Winsock");
+    }
+    _wsa_started = true;
+
+    addrinfo hints    = {};
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_protocol = IPPROTO_UDP;
+    addrinfo* result  = nullptr;
+    if (getaddrinfo(addr.c_str(), port.c_str(), &hints, &result) != 0 || !result) {
+        throw uhd::runtime_error(str(
+            boost::format("Cannot resolve %s:%s: %s") % addr % port % get_wsa_error()));
+    }
+    const sockaddr_in remote_addr = *reinterpret_cast<sockaddr_in*>(result->ai_addr);
+    freeaddrinfo(result);
+
+    _socket =
+        WSASocketW(AF_INET, SOCK_DGRAM, IPPROTO_UDP, NULL, 0, WSA_FLAG_REGISTERED_IO);
+    if (_socket == INVALID_SOCKET) {
+        throw uhd::runtime_error("Cannot create RIO socket: " + get_wsa_error());
+    }
+    if (connect(_socket,
+            reinterpret_cast<const sockaddr*>(&remote_addr),
+            sizeof(remote_addr))
+        != 0) {
+        throw uhd::runtime_error(str(boost::format("Cannot connect to %s:%s: %s") % addr
+                                     % port % get_wsa_error()));
+    }
+
+    sockaddr_in local_addr = {};
+    int local_addr_len     = sizeof(local_addr);
+    if (getsockname(_socket, reinterpret_cast<sockaddr*>(&local_addr), &local_addr_len)
+        != 0) {
+        throw uhd::runtime_error("Cannot get local address: " + get_wsa_error());
+    }
+    _local_port = ntohs(local_addr.sin_port);
+    char local_ip[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &local_addr.sin_addr, local_ip, sizeof(local_ip));
+
+    GUID function_table_id = WSAID_MULTIPLE_RIO;
+    DWORD bytes            = 0;
+    if (WSAIoctl(_socket,
+            SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+            &function_table_id,
+            sizeof(function_table_id),
+            &_rio,
+            sizeof(_rio),
+            &bytes,
+            NULL,
+            NULL)
+        != 0) {
+        throw uhd::runtime_error(
+            "Registered I/O is not supported on this system: " + get_wsa_error());
+    }
+    return local_ip;
+}
+
+void udp_rio_link::init_queues(const link_params_t& params)
+{
+    // Datagrams which arrive while no receive is posted are held in the
+    // socket buffer, so size it like the other links do
+    for (const auto& opt : {std::make_pair(SO_RCVBUF, params.recv_buff_size),
+             std::make_pair(SO_SNDBUF, params.send_buff_size)}) {
+        if (opt.second == 0) {
+            continue;
+        }
+        const int buff_size = static_cast<int>(opt.second);
+        if (setsockopt(_socket,
+                SOL_SOCKET,
+                opt.first,
+                reinterpret_cast<const char*>(&buff_size),
+                sizeof(buff_size))
+            != 0) {
+            UHD_LOG_WARNING(
+                LOG_ID, "Cannot set the socket buffer size: " << get_wsa_error());
+        }
+    }
+
+    _recv_stride             = align_frame_size(params.recv_frame_size);
+    _send_stride             = align_frame_size(params.send_frame_size);
+    _send_offset             = params.num_recv_frames * _recv_stride;
+    const size_t region_size = _send_offset + params.num_send_frames * _send_stride;
+    _region                  = static_cast<char*>(
+        VirtualAlloc(NULL, region_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+    if (!_region) {
+        throw uhd::runtime_error(str(
+            boost::format("Cannot allocate %d bytes for the RIO frames") % region_size));
+    }
+    _buffer_id = _rio.RIORegisterBuffer(_region, static_cast<DWORD>(region_size));
+    if (_buffer_id == RIO_INVALID_BUFFERID) {
+        throw uhd::runtime_error("Cannot register the RIO frames: " + get_wsa_error());
+    }
+
+    // The events are reset automatically when a waiting thread is released
+    _recv_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    _send_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (!_recv_event || !_send_event) {
+        throw uhd::runtime_error("Cannot create the RIO completion events");
+    }
+    RIO_NOTIFICATION_COMPLETION notification = {};
+    notification.Type                        = RIO_EVENT_COMPLETION;
+    notification.Event.NotifyReset           = FALSE;
+    notification.Event.EventHandle           = _recv_event;
+    _recv_cq = _rio.RIOCreateCompletionQueue(
+        static_cast<DWORD>(params.num_recv_frames), &notification);
+    notification.Event.EventHandle = _send_event;
+    _send_cq                       = _rio.RIOCreateCompletionQueue(
+        static_cast<DWORD>(params.num_send_frames), &notification);
+    if (_recv_cq == RIO_INVALID_CQ || _send_cq == RIO_INVALID_CQ) {
+        throw uhd::runtime_error(
+            "Cannot create the RIO completion queues: " + get_wsa_error());
+    }
+
+    _rq = _rio.RIOCreateRequestQueue(_socket,
+        static_cast<ULONG>(params.num_recv_frames),
+        1,
+        static_cast<ULONG>(params.num_send_frames),
+        1,
+        _recv_cq,
+        _send_cq,
+        this);
+    if (_rq == RIO_INVALID_RQ) {
+        throw uhd::runtime_error(
+            "Cannot create the RIO request queue: " + get_wsa_error());
+    }
+
+    for (size_t i = 0; i < params.num_recv_frames; i++) {
+        post_recv(i);
+    }
+    std::lock_guard<std::mutex> lock(_rq_mutex);
+    _rio.RIOReceive(_rq, NULL, 0, RIO_MSG_COMMIT_ONLY, NULL);
+    _num_deferred = 0;
+}
+
+void udp_rio_link::post_recv(size_t index)
+{
+    RIO_BUF buf  = {};
+    buf.BufferId = _buffer_id;
+    buf.Offset   = static_cast<ULONG>(index * _recv_stride);
+    buf.Length   = static_cast<ULONG>(get_recv_frame_size());
+    // Receives are committed in batches, before the completions are read
+    std::lock_guard<std::mutex> lock(_rq_mutex);
+    if (!_rio.RIOReceive(_rq, &buf, 1, RIO_MSG_DEFER, reinterpret_cast<PVOID>(index))) {
+        throw uhd::io_error("RIOReceive failed: " + get_wsa_error());
+    }
+    _num_deferred++;
+}
+
+size_t udp_rio_link::dequeue(
+    RIO_CQ cq, HANDLE event, RIORESULT* results, int32_t timeout_ms)
+{
+    auto dequeue_completions = [this, cq, results]() {
+        const ULONG num_results =
+            _rio.RIODequeueCompletion(cq, results, static_cast<ULONG>(MAX_COMPLETIONS));
+        if (num_results == RIO_CORRUPT_CQ) {
+            throw uhd::io_error("RIO completion queue is corrupt");
+        }
+        return static_cast<size_t>(num_results);
+    };
+
+    size_t num_results = dequeue_completions();
+    if (num_results != 0 || timeout_ms == 0) {
+        return num_results;
+    }
+
+    const auto end_time =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (true) {
+        // Arm the event, then look again in case a completion arrived before
+        // it was armed. If it is still armed from the last wait, this fails
+        // with WSAEALREADY, which is fine.
+        _rio.RIONotify(cq);
+        num_results = dequeue_completions();
+        if (num_results != 0) {
+            return num_results;
+        }
+        DWORD wait_ms = INFINITE;
+        if (timeout_ms > 0) {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                end_time - std::chrono::steady_clock::now())
+                                       .count();
+            if (remaining <= 0) {
+                return 0;
+            }
+            wait_ms = static_cast<DWORD>(remaining);
+        }
+        WaitForSingleObject(event, wait_ms);
+    }
+}
+
+size_t udp_rio_link::get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    if (_recv_result_pos == _recv_result_count) {
+        // Hand the released frames to the NIC before reading a new batch
+        {
+            std::lock_guard<std::mutex> lock(_rq_mutex);
+            if (_num_deferred > 0) {
+                _rio.RIOReceive(_rq, NULL, 0, RIO_MSG_COMMIT_ONLY, NULL);
+                _num_deferred = 0;
+            }
+        }
+        _recv_result_pos   = 0;
+        _recv_result_count = dequeue(_recv_cq, _recv_event, _recv_results, timeout_ms);
+        if (_recv_result_count == 0) {
+            return 0;
+        }
+    }
+
+    const RIORESULT& result = _recv_results[_recv_result_pos++];
+    const size_t index      = static_cast<size_t>(result.RequestContext);
+    if (result.Status != NO_ERROR) {
+        // E.g., a datagram which was larger than the frame. Drop it, like the
+        // other links do.
+        UHD_LOG_TRACE(LOG_ID, "Receive failed with status " << result.Status);
+        post_recv(index);
+        return 0;
+    }
+    static_cast<udp_rio_frame_buff&>(buff).set_frame(
+        _region + index * _recv_stride, index);
+    return result.BytesTransferred;
+}
+
+bool udp_rio_link::get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    if (_send_free_frames.empty()) {
+        const size_t num_results =
+            dequeue(_send_cq, _send_event, _send_results, timeout_ms);
+        for (size_t i = 0; i < num_results; i++) {
+            if (_send_results[i].Status != NO_ERROR) {
+                UHD_LOG_TRACE(
+                    LOG_ID, "Send failed with status " << _send_results[i].Status);
+            }
+            _send_free_frames.push_back(
+                static_cast<size_t>(_send_results[i].RequestContext));
+        }
+        if (_send_free_frames.empty()) {
+            return false;
+        }
+    }
+
+    const size_t index = _send_free_frames.back();
+    _send_free_frames.pop_back();
+    static_cast<udp_rio_frame_buff&>(buff).set_frame(
+        _region + _send_offset + index * _send_stride, index);
+    return true;
+}
+
+void udp_rio_link::release_send_buff_derived(frame_buff& buff)
+{
+    const size_t index = static_cast<udp_rio_frame_buff&>(buff).get_index();
+    RIO_BUF buf        = {};
+    buf.BufferId       = _buffer_id;
+    buf.Offset         = static_cast<ULONG>(_send_offset + index * _send_stride);
+    buf.Length         = static_cast<ULONG>(buff.packet_size());
+    std::lock_guard<std::mutex> lock(_rq_mutex);
+    if (!_rio.RIOSend(_rq, &buf, 1, 0, reinterpret_cast<PVOID>(index))) {
+        throw uhd::io_error("RIOSend failed: " + get_wsa_error());
+    }
+}
+
+udp_rio_link::sptr udp_rio_link::make(
+    const std::string& addr, const std::string& port, const link_params_t& params)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+
+    return sptr(new udp_rio_link(addr, port, params));
+}
@@ -142,15 +142,22 @@ public:
 
     udp_zero_copy_asio_impl(const std::string& addr,
         const std::string& port,
-        const zero_copy_xport_params& xport_params)
+        const zero_copy_xport_params& xport_params,
+        const bool use_hugepages)
         : _recv_frame_size(xport_params.recv_frame_size)
         , _num_recv_frames(xport_params.num_recv_frames)
         , _send_frame_size(xport_params.send_frame_size)
         , _num_send_frames(xport_params.num_send_frames)
-        , _recv_buffer_pool(buffer_pool::make(
-              xport_params.num_recv_frames, xport_params.recv_frame_size))
-        , _send_buffer_pool(buffer_pool::make(
-              xport_params.num_send_frames, xport_params.send_frame_size))
+        , _recv_buffer_pool(buffer_pool::make(xport_params.num_recv_frames,
+              xport_params.recv_frame_size,
+              16,
+              -1,
+              use_hugepages))
+        , _send_buffer_pool(buffer_pool::make(xport_params.num_send_frames,
+              xport_params.send_frame_size,
+              16,
+              -1,
+              use_hugepages))
         , _next_recv_buff_index(0)
         , _next_send_buff_index(0)
     {
@@ -332,8 +339,9 @@ udp_zero_copy::sptr udp_zero_copy::make(const std::string& addr,
     }
 #endif
 
+    const bool use_hugepages = hints.cast<bool>("use_hugepages", false);
     udp_zero_copy_asio_impl::sptr udp_trans(
-        new udp_zero_copy_asio_impl(addr, port, xport_params));
+        new udp_zero_copy_asio_impl(addr, port, xport_params, use_hugepages));
 
     // call the helper to resize send and recv buffers
     buff_params_out.recv_buff_size = resize_udp_socket_buffer_with_warning(
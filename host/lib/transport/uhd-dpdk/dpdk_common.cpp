@@ -13,7 +13,10 @@
 #include <uhdlib/utils/prefs.hpp>
 #include <arpa/inet.h>
 #include <rte_arp.h>
+#include <rte_eal.h>
 #include <boost/algorithm/string.hpp>
+#include <cerrno>
+#include <csignal>
 
 namespace uhd { namespace transport { namespace dpdk {
 
@@ -27,6 +30,18 @@ constexpr uint16_t DPDK_DEFAULT_RING_SIZE    = 512;
 constexpr int DEFAULT_DPDK_LINK_INIT_TIMEOUT = 1000;
 constexpr int LINK_STATUS_INTERVAL           = 250;
 
+//! Return whether a resource owner of the shared port state has exited
+inline bool owner_exited(const pid_t pid)
+{
+    return pid != 0 && kill(pid, 0) != 0 && errno == ESRCH;
+}
+
+//! Return the name of the memzone with the shared state of a port
+inline std::string get_shared_port_name(const port_id_t port)
+{
+    return "uhd_port_" + std::to_string(port);
+}
+
 inline char* eal_add_opt(
     std::vector<const char*>& argv, size_t n, char* dst, const char* opt, const char* arg)
 {
@@ -53,15 +68,76 @@ inline void separate_rte_ipv4_addr(
     int netbits   = std::atoi(result[1].c_str());
     netmask       = htonl(0xffffffff << (32 - netbits));
 }
+
+inline std::vector<size_t> separate_lcores(const std::string& lcores)
+{
+    std::vector<std::string> result;
+    boost::algorithm::split(result,
+        lcores,
+        [](const char& in) { return in == ','; },
+        boost::token_compress_on);
+    std::vector<size_t> lcore_ids;
+    for (const auto& lcore : result) {
+        lcore_ids.push_back(std::stoul(boost::algorithm::trim_copy(lcore)));
+    }
+    return lcore_ids;
+}
+
+/*!
+ * Flow rule which sends UDP packets for a local IPv4 address and UDP port to a
+ * DMA queue
+ */
+struct udp_flow_rule
+{
+    udp_flow_rule(rte_ipv4_addr ipv4, uint16_t udp_port, queue_id_t queue)
+    {
+        attr.ingress = 1;
+
+        ipv4_spec.hdr.dst_addr = ipv4;
+        ipv4_mask.hdr.dst_addr = 0xffffffff;
+        udp_spec.hdr.dst_port  = udp_port;
+        udp_mask.hdr.dst_port  = 0xffff;
+
+        pattern[0].type = RTE_FLOW_ITEM_TYPE_ETH;
+        pattern[1].type = RTE_FLOW_ITEM_TYPE_IPV4;
+        pattern[1].spec = &ipv4_spec;
+        pattern[1].mask = &ipv4_mask;
+        pattern[2].type = RTE_FLOW_ITEM_TYPE_UDP;
+        pattern[2].spec = &udp_spec;
+        pattern[2].mask = &udp_mask;
+        pattern[3].type = RTE_FLOW_ITEM_TYPE_END;
+
+        queue_conf.index = queue;
+        actions[0].type  = RTE_FLOW_ACTION_TYPE_QUEUE;
+        actions[0].conf  = &queue_conf;
+        actions[1].type  = RTE_FLOW_ACTION_TYPE_END;
+    }
+
+    // The pattern and actions point into this object, so don't copy it
+    udp_flow_rule(const udp_flow_rule&) = delete;
+
+    struct rte_flow_attr attr               = {};
+    struct rte_flow_item_ipv4 ipv4_spec     = {};
+    struct rte_flow_item_ipv4 ipv4_mask     = {};
+    struct rte_flow_item_udp udp_spec       = {};
+    struct rte_flow_item_udp udp_mask       = {};
+    struct rte_flow_item pattern[4]         = {};
+    struct rte_flow_action_queue queue_conf = {};
+    struct rte_flow_action actions[2]       = {};
+};
 } // namespace
 
+constexpr size_t dpdk_port_shared::MAX_QUEUES;
+constexpr size_t dpdk_port_shared::MAX_ARP_ENTRIES;
+
 dpdk_port::uptr dpdk_port::make(port_id_t port,
     size_t mtu,
     uint16_t num_queues,
     uint16_t num_desc,
     struct rte_mempool* rx_pktbuf_pool,
     struct rte_mempool* tx_pktbuf_pool,
-    std::string rte_ipv4_address)
+    std::string rte_ipv4_address,
+    uint16_t num_secondary_queues)
 {
     return std::make_unique<dpdk_port>(port,
         mtu,
@@ -69,7 +145,18 @@ dpdk_port::uptr dpdk_port::make(port_id_t port,
         num_desc,
         rx_pktbuf_pool,
         tx_pktbuf_pool,
-        rte_ipv4_address);
+        rte_ipv4_address,
+        num_secondary_queues);
+}
+
+dpdk_port::uptr dpdk_port::attach(port_id_t port,
+    uint16_t num_queues,
+    struct rte_mempool* rx_pktbuf_pool,
+    struct rte_mempool* tx_pktbuf_pool,
+    std::string rte_ipv4_address)
+{
+    return std::make_unique<dpdk_port>(
+        port, num_queues, rx_pktbuf_pool, tx_pktbuf_pool, rte_ipv4_address);
 }
 
 dpdk_port::dpdk_port(port_id_t port,
@@ -78,7 +165,8 @@ dpdk_port::dpdk_port(port_id_t port,
     uint16_t num_desc,
     struct rte_mempool* rx_pktbuf_pool,
     struct rte_mempool* tx_pktbuf_pool,
-    std::string rte_ipv4_address)
+    std::string rte_ipv4_address,
+    uint16_t num_secondary_queues)
     : _port(port)
     , _mtu(mtu)
     , _num_queues(num_queues)
@@ -107,12 +195,17 @@ dpdk_port::dpdk_port(port_id_t port,
     }
 
     // Check number of available queues
-    if (dev_info.max_rx_queues < num_queues || dev_info.max_tx_queues < num_queues) {
+    const size_t total_queues = std::min<size_t>(
+        num_queues + num_secondary_queues, dpdk_port_shared::MAX_QUEUES);
+    if (dev_info.max_rx_queues < total_queues || dev_info.max_tx_queues < total_queues) {
         _num_queues = std::min(dev_info.max_rx_queues, dev_info.max_tx_queues);
         UHD_LOGGER_WARNING("DPDK")
             << boost::format("%d: Maximum queues supported is %d") % _port % _num_queues;
     } else {
-        _num_queues = num_queues;
+        _num_queues = total_queues;
+    }
+    for (size_t i = 0; i < std::min<size_t>(num_queues, _num_queues); i++) {
+        _queues.push_back(static_cast<queue_id_t>(i));
     }
 
     struct rte_eth_conf port_conf = {};
@@ -201,8 +294,6 @@ dpdk_port::dpdk_port(port_id_t port,
         }
     }
 
-    /* TODO: Enable multiple queues (only support 1 right now) */
-
     /* Start the Ethernet device */
     retval = rte_eth_dev_start(_port);
     if (retval < 0) {
@@ -211,15 +302,107 @@ dpdk_port::dpdk_port(port_id_t port,
         throw uhd::runtime_error("DPDK: Failure to start device");
     }
 
+    /* Packets go to queue 0, unless flow rules send them elsewhere */
+    _queue_links.resize(_num_queues, 0);
+    if (_num_queues > 1) {
+        _check_flow_steering();
+    }
+    _create_shared();
+
     /* Grab and display the port MAC address. */
     rte_eth_macaddr_get(_port, &_mac_addr);
     UHD_LOGGER_TRACE("DPDK") << "Port " << _port
                              << " MAC: " << eth_addr_to_string(_mac_addr);
 }
 
+dpdk_port::dpdk_port(port_id_t port,
+    uint16_t num_queues,
+    struct rte_mempool* rx_pktbuf_pool,
+    struct rte_mempool* tx_pktbuf_pool,
+    std::string rte_ipv4_address)
+    : _port(port)
+    , _rx_pktbuf_pool(rx_pktbuf_pool)
+    , _tx_pktbuf_pool(tx_pktbuf_pool)
+    , _secondary(true)
+{
+    separate_rte_ipv4_addr(rte_ipv4_address, _ipv4, _netmask);
+
+    _memzone = rte_memzone_lookup(get_shared_port_name(_port).c_str());
+    if (!_memzone) {
+        UHD_LOGGER_ERROR("DPDK")
+            << boost::format("Port %d: Not configured by the primary process") % _port;
+        throw uhd::runtime_error("DPDK: Port not configured by the primary process");
+    }
+    _shared        = static_cast<dpdk_port_shared*>(_memzone->addr);
+    _mtu           = _shared->mtu;
+    _num_queues    = _shared->num_queues;
+    _flow_steering = _shared->flow_steering;
+    // Packets only reach the queues of this process through flow rules
+    if (!_flow_steering) {
+        UHD_LOGGER_ERROR("DPDK")
+            << boost::format("Port %d: NIC cannot steer UDP packets to the queues of "
+                             "secondary processes")
+                   % _port;
+        throw uhd::runtime_error("DPDK: NIC cannot steer UDP packets to queues");
+    }
+
+    // Claim the free queues, and those of processes which exited
+    const pid_t pid = getpid();
+    rte_spinlock_lock(&_shared->lock);
+    for (queue_id_t i = 1; i < _num_queues && _queues.size() < num_queues; i++) {
+        if (_shared->queue_owners[i] == 0 || owner_exited(_shared->queue_owners[i])) {
+            _shared->queue_owners[i] = pid;
+            _queues.push_back(i);
+        }
+    }
+    rte_spinlock_unlock(&_shared->lock);
+    if (_queues.empty()) {
+        UHD_LOGGER_ERROR("DPDK")
+            << boost::format("Port %d: All DMA queues are in use. Increase "
+                             "dpdk_num_queues of the primary process.")
+                   % _port;
+        throw uhd::runtime_error("DPDK: All DMA queues are in use");
+    }
+    if (_queues.size() < num_queues) {
+        UHD_LOGGER_WARNING("DPDK")
+            << boost::format("%d: Only %d DMA queues are free") % _port % _queues.size();
+    }
+    _queue_links.resize(_num_queues, 0);
+
+    rte_eth_macaddr_get(_port, &_mac_addr);
+    UHD_LOGGER_TRACE("DPDK") << "Port " << _port
+                             << " MAC: " << eth_addr_to_string(_mac_addr)
+                             << ", attached to " << _queues.size() << " queues";
+}
+
 dpdk_port::~dpdk_port()
 {
-    rte_eth_dev_stop(_port);
+    if (_secondary) {
+        // The links removed their flow rules, the primary process keeps the
+        // port running
+        const pid_t pid = getpid();
+        rte_spinlock_lock(&_shared->lock);
+        for (const queue_id_t queue : _queues) {
+            if (_shared->queue_owners[queue] == pid) {
+                _shared->queue_owners[queue] = 0;
+            }
+        }
+        for (auto& owner : _shared->udp_port_owners) {
+            if (owner == pid) {
+                owner = 0;
+            }
+        }
+        rte_spinlock_unlock(&_shared->lock);
+    } else {
+        if (!_flows.empty()) {
+            struct rte_flow_error error;
+            rte_flow_flush(_port, &error);
+        }
+        rte_eth_dev_stop(_port);
+        if (_memzone) {
+            rte_memzone_free(_memzone);
+        }
+    }
     rte_spinlock_lock(&_spinlock);
     for (auto kv : _arp_table) {
         for (auto req : kv.second->reqs) {
@@ -236,7 +419,8 @@ uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
     uint16_t port_selected;
     std::lock_guard<std::mutex> lock(_mutex);
     if (udp_port) {
-        if (_udp_ports.count(rte_be_to_cpu_16(udp_port))) {
+        if (_udp_ports.count(rte_be_to_cpu_16(udp_port))
+            || !_claim_shared_udp_port(rte_be_to_cpu_16(udp_port))) {
             return 0;
         }
         port_selected = rte_be_to_cpu_16(udp_port);
@@ -250,7 +434,8 @@ uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
             if (port_selected == 0) {
                 continue;
             }
-            if (_udp_ports.count(port_selected) == 0) {
+            if (_udp_ports.count(port_selected) == 0
+                && _claim_shared_udp_port(port_selected)) {
                 _next_udp_port = port_selected - 1;
                 break;
             }
@@ -264,6 +449,167 @@ uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
     return rte_cpu_to_be_16(port_selected);
 }
 
+queue_id_t dpdk_port::alloc_queue(uint16_t udp_port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    UHD_ASSERT_THROW(_flows.count(udp_port) == 0);
+    queue_id_t queue      = _queues.front();
+    struct rte_flow* flow = nullptr;
+    if (_flow_steering) {
+        for (const queue_id_t i : _queues) {
+            if (_queue_links[i] < _queue_links[queue]) {
+                queue = i;
+            }
+        }
+    }
+    // Queue 0 receives the packets which no flow rule matches
+    if (queue != 0) {
+        udp_flow_rule rule(_ipv4, udp_port, queue);
+        struct rte_flow_error error;
+        flow = rte_flow_create(_port, &rule.attr, rule.pattern, rule.actions, &error);
+        if (!flow && _secondary) {
+            UHD_LOGGER_ERROR("DPDK")
+                << boost::format("Port %d: Could not add flow rule for UDP port %d: %s")
+                       % _port % rte_be_to_cpu_16(udp_port)
+                       % (error.message ? error.message : "unknown error");
+            throw uhd::runtime_error("DPDK: Could not add flow rule");
+        } else if (!flow) {
+            UHD_LOGGER_WARNING("DPDK")
+                << boost::format("Port %d: Could not add flow rule for UDP port %d: %s. "
+                                 "Receiving on queue 0 instead.")
+                       % _port % rte_be_to_cpu_16(udp_port)
+                       % (error.message ? error.message : "unknown error");
+            queue = 0;
+        }
+    }
+    UHD_LOGGER_TRACE("DPDK") << boost::format("Port %d: UDP port %d uses queue %d")
+                                    % _port % rte_be_to_cpu_16(udp_port) % queue;
+    _queue_links[queue]++;
+    _flows[udp_port] = {queue, flow};
+    return queue;
+}
+
+void dpdk_port::free_queue(uint16_t udp_port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _flows.find(udp_port);
+    if (it == _flows.end()) {
+        return;
+    }
+    const queue_id_t queue = it->second.first;
+    struct rte_flow* flow  = it->second.second;
+    if (flow) {
+        struct rte_flow_error error;
+        if (rte_flow_destroy(_port, flow, &error)) {
+            UHD_LOGGER_WARNING("DPDK")
+                << boost::format("Port %d: Could not remove flow rule for UDP port %d")
+                       % _port % rte_be_to_cpu_16(udp_port);
+        }
+    }
+    _queue_links[queue]--;
+    _flows.erase(it);
+    if (_shared) {
+        rte_spinlock_lock(&_shared->lock);
+        _shared->udp_port_owners[rte_be_to_cpu_16(udp_port)] = 0;
+        rte_spinlock_unlock(&_shared->lock);
+    }
+}
+
+void dpdk_port::_create_shared()
+{
+    _memzone = rte_memzone_reserve(get_shared_port_name(_port).c_str(),
+        sizeof(dpdk_port_shared),
+        rte_eth_dev_socket_id(_port),
+        0);
+    if (!_memzone) {
+        UHD_LOGGER_ERROR("DPDK")
+            << boost::format("Port %d: Could not allocate the state shared with "
+                             "secondary processes")
+                   % _port;
+        throw uhd::runtime_error("DPDK: Could not allocate shared port state");
+    }
+    _shared = static_cast<dpdk_port_shared*>(_memzone->addr);
+    memset(_shared, 0, sizeof(*_shared));
+    rte_spinlock_init(&_shared->lock);
+    _shared->mtu           = _mtu;
+    _shared->num_queues    = static_cast<uint16_t>(_num_queues);
+    _shared->flow_steering = _flow_steering;
+    for (const queue_id_t queue : _queues) {
+        _shared->queue_owners[queue] = getpid();
+    }
+}
+
+bool dpdk_port::_claim_shared_udp_port(uint16_t udp_port)
+{
+    if (!_shared) {
+        return true;
+    }
+    rte_spinlock_lock(&_shared->lock);
+    pid_t& owner    = _shared->udp_port_owners[udp_port];
+    const bool free = owner == 0 || owner_exited(owner);
+    if (free) {
+        owner = getpid();
+    }
+    rte_spinlock_unlock(&_shared->lock);
+    return free;
+}
+
+void dpdk_port::_share_arp_entry(
+    rte_ipv4_addr ipv4, const struct rte_ether_addr& mac_addr)
+{
+    if (!_shared || _secondary) {
+        return;
+    }
+    rte_spinlock_lock(&_shared->lock);
+    size_t i = 0;
+    while (i < _shared->num_arp_entries && _shared->arp_entries[i].ipv4 != ipv4) {
+        i++;
+    }
+    if (i == dpdk_port_shared::MAX_ARP_ENTRIES) {
+        i                       = _shared->next_arp_entry;
+        _shared->next_arp_entry = (i + 1) % dpdk_port_shared::MAX_ARP_ENTRIES;
+    } else if (i == _shared->num_arp_entries) {
+        _shared->num_arp_entries++;
+    }
+    _shared->arp_entries[i].ipv4 = ipv4;
+    rte_ether_addr_copy(&mac_addr, &_shared->arp_entries[i].mac_addr);
+    rte_spinlock_unlock(&_shared->lock);
+}
+
+bool dpdk_port::_lookup_shared_arp_entry(
+    rte_ipv4_addr ipv4, struct rte_ether_addr& mac_addr)
+{
+    if (!_shared) {
+        return false;
+    }
+    bool found = false;
+    rte_spinlock_lock(&_shared->lock);
+    for (size_t i = 0; i < _shared->num_arp_entries && !found; i++) {
+        if (_shared->arp_entries[i].ipv4 == ipv4) {
+            rte_ether_addr_copy(&_shared->arp_entries[i].mac_addr, &mac_addr);
+            found = true;
+        }
+    }
+    rte_spinlock_unlock(&_shared->lock);
+    return found;
+}
+
+void dpdk_port::_check_flow_steering()
+{
+    // Any UDP port will do, this only checks that the NIC supports the rule
+    udp_flow_rule rule(_ipv4, rte_cpu_to_be_16(0xffff), 1);
+    struct rte_flow_error error;
+    if (rte_flow_validate(_port, &rule.attr, rule.pattern, rule.actions, &error)) {
+        UHD_LOGGER_WARNING("DPDK")
+            << boost::format("Port %d: NIC cannot steer UDP packets to queues (%s). "
+                             "Only queue 0 will be used.")
+                   % _port % (error.message ? error.message : "unknown error");
+        _flow_steering = false;
+    } else {
+        _flow_steering = true;
+    }
+}
+
 int dpdk_port::_arp_reply(queue_id_t queue_id, struct rte_arp_hdr* arp_req)
 {
     struct rte_mbuf* mbuf;
@@ -336,12 +682,16 @@ dpdk_ctx::~dpdk_ctx(void)
     _io_srv_portid_map.clear();
     // Destroy and stop all the ports
     _ports.clear();
-    // Free mempools
+    // Free mempools, unless they belong to the primary process
     for (auto& pool : _rx_pktbuf_pools) {
-        rte_mempool_free(pool);
+        if (!_secondary) {
+            rte_mempool_free(pool);
+        }
     }
     for (auto& pool : _tx_pktbuf_pools) {
-        rte_mempool_free(pool);
+        if (!_secondary) {
+            rte_mempool_free(pool);
+        }
     }
     // Free EAL resources
     rte_eal_cleanup();
@@ -397,6 +747,12 @@ void dpdk_ctx::_eal_init(const device_addr_t& eal_args)
             opt = eal_add_opt(argv, end - opt, opt, "--file-prefix", val.c_str());
         } else if (key == "dpdk_driver") {
             opt = eal_add_opt(argv, end - opt, opt, "-d", val.c_str());
+        } else if (key == "dpdk_proc_type") {
+            if (val != "primary" && val != "secondary" && val != "auto") {
+                delete args;
+                throw uhd::value_error("DPDK: Invalid dpdk_proc_type: " + val);
+            }
+            opt = eal_add_opt(argv, end - opt, opt, "--proc-type", val.c_str());
         }
         /* TODO: Change where log goes?
            int rte_openlog_stream( FILE * f)
@@ -411,6 +767,10 @@ void dpdk_ctx::_eal_init(const device_addr_t& eal_args)
         UHD_LOG_ERROR("DPDK", "Error with EAL initialization");
         throw uhd::runtime_error("Error with EAL initialization");
     }
+    _secondary = rte_eal_process_type() == RTE_PROC_SECONDARY;
+    if (_secondary) {
+        UHD_LOG_DEBUG("DPDK", "Attaching to the ports of the primary process");
+    }
 
     /* Create pktbuf pool entries, but only allocate on use  */
     int socket_count = rte_socket_count();
@@ -487,29 +847,28 @@ void dpdk_ctx::init(const device_addr_t& user_args)
             }
             /* Now combine user args with conf file */
             auto conf = uhd::prefs::get_dpdk_nic_args(nic);
-            // TODO: Enable the use of multiple DMA queues
-            conf["dpdk_num_queues"] = "1";
 
             /* Update config, and remove ports that aren't fully configured */
             if (conf.has_key("dpdk_ipv4")) {
+                UHD_ASSERT_THROW(conf.has_key("dpdk_lcore"));
                 nics[i] = conf;
-                /* Update queue count, to generate a large enough mempool */
-                queue_count += conf.cast<uint16_t>("dpdk_num_queues", rte_lcore_count());
+                /* Update queue count, to generate a large enough mempool. There
+                 * is one DMA queue per lcore, plus those for secondary
+                 * processes. */
+                queue_count += std::max(separate_lcores(conf["dpdk_lcore"]).size(),
+                    conf.cast<size_t>("dpdk_num_queues", 0));
             } else {
                 nics[i] = device_addr_t();
             }
         }
 
-        std::map<size_t, std::vector<size_t>> lcore_to_port_id_map;
+        std::map<size_t, std::vector<std::pair<size_t, queue_id_t>>>
+            lcore_to_port_id_map;
         RTE_ETH_FOREACH_DEV(i)
         {
             auto& conf = nics.at(i);
             if (conf.has_key("dpdk_ipv4")) {
-                UHD_ASSERT_THROW(conf.has_key("dpdk_lcore"));
-                const size_t lcore_id = conf.cast<size_t>("dpdk_lcore", 0);
-                if (!lcore_to_port_id_map.count(lcore_id)) {
-                    lcore_to_port_id_map.insert({lcore_id, {}});
-                }
+                const std::vector<size_t> lcore_ids = separate_lcores(conf["dpdk_lcore"]);
 
                 // Allocating enough buffers for all DMA queues for each CPU socket
                 // - This is a bit inefficient for larger systems, since NICs may not
@@ -520,16 +879,45 @@ void dpdk_ctx::init(const device_addr_t& user_args)
                 UHD_LOG_TRACE("DPDK",
                     "Initializing NIC(" << i << "):" << std::endl
                                         << conf.to_pp_string());
-                _ports[i] = dpdk_port::make(i,
-                    _mtu,
-                    conf.cast<uint16_t>("dpdk_num_queues", rte_lcore_count()),
-                    conf.cast<uint16_t>("dpdk_num_desc", DPDK_DEFAULT_RING_SIZE),
-                    rx_pool,
-                    tx_pool,
-                    conf["dpdk_ipv4"]);
-
-                // Remember all port IDs that map to an lcore
-                lcore_to_port_id_map.at(lcore_id).push_back(i);
+                const size_t num_queues = conf.cast<size_t>("dpdk_num_queues", 0);
+                if (_secondary) {
+                    _ports[i] = dpdk_port::attach(i,
+                        static_cast<uint16_t>(lcore_ids.size()),
+                        rx_pool,
+                        tx_pool,
+                        conf["dpdk_ipv4"]);
+                } else if (num_queues > 0 && num_queues < lcore_ids.size()) {
+                    throw uhd::value_error("DPDK: dpdk_num_queues of port "
+                                           + std::to_string(i)
+                                           + " is less than the number of lcores");
+                } else {
+                    _ports[i] = dpdk_port::make(i,
+                        _mtu,
+                        static_cast<uint16_t>(lcore_ids.size()),
+                        conf.cast<uint16_t>("dpdk_num_desc", DPDK_DEFAULT_RING_SIZE),
+                        rx_pool,
+                        tx_pool,
+                        conf["dpdk_ipv4"],
+                        static_cast<uint16_t>(
+                            num_queues > 0 ? num_queues - lcore_ids.size() : 0));
+                }
+
+                // Remember all port IDs and queues that map to an lcore. The
+                // NIC may support fewer queues than there are lcores.
+                const auto& queues = _ports[i]->get_queues();
+                for (size_t queue = 0; queue < std::min(lcore_ids.size(), queues.size());
+                     queue++) {
+                    auto& port_queues = lcore_to_port_id_map[lcore_ids.at(queue)];
+                    for (const auto& port_queue : port_queues) {
+                        if (port_queue.first == i) {
+                            throw uhd::value_error(
+                                "DPDK: Cannot serve two queues of port "
+                                + std::to_string(i) + " on lcore "
+                                + std::to_string(lcore_ids.at(queue)));
+                        }
+                    }
+                    port_queues.push_back({i, queues.at(queue)});
+                }
             }
         }
 
@@ -566,18 +954,21 @@ void dpdk_ctx::init(const device_addr_t& user_args)
         for (auto& lcore_portids_pair : lcore_to_port_id_map) {
             const size_t lcore_id = lcore_portids_pair.first;
             std::vector<dpdk_port*> dpdk_ports;
+            std::vector<queue_id_t> queues;
             dpdk_ports.reserve(lcore_portids_pair.second.size());
-            for (const size_t port_id : lcore_portids_pair.second) {
-                dpdk_ports.push_back(get_port(port_id));
+            queues.reserve(lcore_portids_pair.second.size());
+            for (const auto& port_queue : lcore_portids_pair.second) {
+                dpdk_ports.push_back(get_port(port_queue.first));
+                queues.push_back(port_queue.second);
             }
             const size_t servq_depth = 32; // FIXME
             UHD_LOG_TRACE("DPDK",
                 "Creating I/O service for lcore "
                     << lcore_id << ", servicing " << dpdk_ports.size()
                     << " ports, service queue depth " << servq_depth);
-            _io_srv_portid_map.insert(
-                {uhd::transport::dpdk_io_service::make(lcore_id, dpdk_ports, servq_depth),
-                    lcore_portids_pair.second});
+            _io_srv_portid_map.insert({uhd::transport::dpdk_io_service::make(
+                                           lcore_id, dpdk_ports, queues, servq_depth),
+                lcore_portids_pair.second});
         }
     }
 }
@@ -649,16 +1040,18 @@ bool dpdk_ctx::is_init_done(void) const
     return _init_done.load();
 }
 
-uhd::transport::dpdk_io_service::sptr dpdk_ctx::get_io_service(const size_t port_id)
+uhd::transport::dpdk_io_service::sptr dpdk_ctx::get_io_service(
+    const size_t port_id, const queue_id_t queue_id)
 {
     for (auto& io_srv_portid_pair : _io_srv_portid_map) {
-        if (uhd::has(io_srv_portid_pair.second, port_id)) {
+        if (uhd::has(io_srv_portid_pair.second, std::make_pair(port_id, queue_id))) {
             return io_srv_portid_pair.first;
         }
     }
 
     std::string err_msg = std::string("Cannot look up I/O service for port ID: ")
-                          + std::to_string(port_id) + ". No such port ID!";
+                          + std::to_string(port_id) + ", queue "
+                          + std::to_string(queue_id) + ". No such port ID!";
     UHD_LOG_ERROR("DPDK", err_msg);
     throw uhd::lookup_error(err_msg);
 }
@@ -666,7 +1059,15 @@ uhd::transport::dpdk_io_service::sptr dpdk_ctx::get_io_service(const size_t port
 struct rte_mempool* dpdk_ctx::_get_rx_pktbuf_pool(
     unsigned int cpu_socket, size_t num_bufs)
 {
-    if (!_rx_pktbuf_pools.at(cpu_socket)) {
+    if (!_rx_pktbuf_pools.at(cpu_socket) && _secondary) {
+        char name[32];
+        snprintf(name, sizeof(name), "rx_mbuf_pool_%u", cpu_socket);
+        _rx_pktbuf_pools[cpu_socket] = rte_mempool_lookup(name);
+        if (!_rx_pktbuf_pools.at(cpu_socket)) {
+            UHD_LOG_ERROR("DPDK", "Could not find the RX pktbuf pool of the primary");
+            throw uhd::runtime_error("DPDK: Could not find RX pktbuf pool");
+        }
+    } else if (!_rx_pktbuf_pools.at(cpu_socket)) {
         const int mbuf_size =
             _mtu + RTE_PKTMBUF_HEADROOM + RTE_ETHER_HDR_LEN + RTE_ETHER_CRC_LEN;
         char name[32];
@@ -688,7 +1089,15 @@ struct rte_mempool* dpdk_ctx::_get_rx_pktbuf_pool(
 struct rte_mempool* dpdk_ctx::_get_tx_pktbuf_pool(
     unsigned int cpu_socket, size_t num_bufs)
 {
-    if (!_tx_pktbuf_pools.at(cpu_socket)) {
+    if (!_tx_pktbuf_pools.at(cpu_socket) && _secondary) {
+        char name[32];
+        snprintf(name, sizeof(name), "tx_mbuf_pool_%u", cpu_socket);
+        _tx_pktbuf_pools[cpu_socket] = rte_mempool_lookup(name);
+        if (!_tx_pktbuf_pools.at(cpu_socket)) {
+            UHD_LOG_ERROR("DPDK", "Could not find the TX pktbuf pool of the primary");
+            throw uhd::runtime_error("DPDK: Could not find TX pktbuf pool");
+        }
+    } else if (!_tx_pktbuf_pools.at(cpu_socket)) {
         const int mbuf_size = _mtu + RTE_PKTMBUF_HEADROOM;
         char name[32];
         snprintf(name, sizeof(name), "tx_mbuf_pool_%u", cpu_socket);
@@ -49,17 +49,23 @@
 
 using namespace uhd::transport;
 
-dpdk_io_service::dpdk_io_service(
-    unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth)
+dpdk_io_service::dpdk_io_service(unsigned int lcore_id,
+    std::vector<dpdk::dpdk_port*> ports,
+    std::vector<dpdk::queue_id_t> queues,
+    size_t servq_depth)
     : _ctx(dpdk::dpdk_ctx::get())
     , _lcore_id(lcore_id)
     , _ports(ports)
     , _servq(servq_depth, lcore_id)
 {
     UHD_LOG_TRACE("DPDK::IO_SERVICE", "Launching I/O service for lcore " << lcore_id);
-    for (auto port : _ports) {
+    UHD_ASSERT_THROW(ports.size() == queues.size());
+    for (size_t i = 0; i < _ports.size(); i++) {
+        auto port = _ports[i];
         UHD_LOG_TRACE("DPDK::IO_SERVICE",
-            "lcore_id " << lcore_id << ": Adding port index " << port->get_port_id());
+            "lcore_id " << lcore_id << ": Adding port index " << port->get_port_id()
+                        << ", queue " << queues[i]);
+        _queues[port->get_port_id()]         = queues[i];
         _tx_queues[port->get_port_id()]      = std::list<dpdk_send_io*>();
         _recv_xport_map[port->get_port_id()] = std::list<dpdk_recv_io*>();
     }
@@ -69,10 +75,13 @@ dpdk_io_service::dpdk_io_service(
     }
 }
 
-dpdk_io_service::sptr dpdk_io_service::make(
-    unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth)
+dpdk_io_service::sptr dpdk_io_service::make(unsigned int lcore_id,
+    std::vector<dpdk::dpdk_port*> ports,
+    std::vector<dpdk::queue_id_t> queues,
+    size_t servq_depth)
 {
-    return dpdk_io_service::sptr(new dpdk_io_service(lcore_id, ports, servq_depth));
+    return dpdk_io_service::sptr(
+        new dpdk_io_service(lcore_id, ports, queues, servq_depth));
 }
 
 dpdk_io_service::~dpdk_io_service()
@@ -274,7 +283,8 @@ int dpdk_io_service::_io_worker(void* arg)
     uhd::set_thread_priority_safe();
 
     snprintf(name, sizeof(name), "rx-tbl_%hu", (uint16_t)lcore_id);
-    struct rte_hash_parameters hash_params = {.name = name,
+    const std::string table_name           = dpdk::get_process_object_name(name);
+    struct rte_hash_parameters hash_params = {.name = table_name.c_str(),
         .entries                                    = MAX_FLOWS,
         .reserved                                   = 0,
         .key_len                                    = sizeof(struct dpdk::ipv4_5tuple),
@@ -291,7 +301,7 @@ int dpdk_io_service::_io_worker(void* arg)
     while (!status) {
         /* For each port, attempt to receive packets and process */
         for (auto port : srv->_ports) {
-            srv->_rx_burst(port, 0);
+            srv->_rx_burst(port, srv->_queues.at(port->get_port_id()));
         }
         /* For each port's TX queues, do TX */
         for (auto port : srv->_ports) {
@@ -301,6 +311,10 @@ int dpdk_io_service::_io_worker(void* arg)
         for (auto port : srv->_ports) {
             srv->_rx_release(port);
         }
+        /* Check for ARP replies which the primary process received */
+        if (srv->_shared_arp_pending) {
+            srv->_poll_shared_arp();
+        }
         /* Retry waking clients */
         if (srv->_retry_head) {
             dpdk_io_if* node = srv->_retry_head;
@@ -533,6 +547,7 @@ void dpdk_io_service::_service_xport_disconnect(dpdk::wait_req* req)
             rte_ring_dequeue(recv_client->_release_queue, (void**)&buff_ptr);
             dpdk_io->link->release_recv_buff(frame_buff::uptr(buff_ptr));
         }
+        dpdk_io->link->flush_recv_buffs();
     } else {
         UHD_LOG_TRACE("DPDK::IO_SERVICE", "Servicing TX disconnect request...");
         dpdk_send_io* send_client = static_cast<dpdk_send_io*>(dpdk_io->io_client);
@@ -588,24 +603,28 @@ int dpdk_io_service::_service_arp_request(dpdk::wait_req* req)
             goto arp_end;
         }
         entry = new (entry) dpdk::arp_entry();
-        entry->reqs.push_back(req);
         port->_arp_table[dst_addr] = entry;
-        status                     = -EAGAIN;
-        UHD_LOG_TRACE("DPDK::IO_SERVICE", "Address not in table. Sending ARP request.");
-        _send_arp_request(port, 0, arp_req_data->tpa);
+        UHD_LOG_TRACE("DPDK::IO_SERVICE", "ARP: Address not in table.");
     } else {
         entry = port->_arp_table.at(dst_addr);
-        if (rte_is_zero_ether_addr(&entry->mac_addr)) {
-            UHD_LOG_TRACE("DPDK::IO_SERVICE",
-                "ARP: Address in table, but not populated yet. Resending ARP request.");
-            port->_arp_table.at(dst_addr)->reqs.push_back(req);
-            status = -EAGAIN;
-            _send_arp_request(port, 0, arp_req_data->tpa);
-        } else {
-            UHD_LOG_TRACE("DPDK::IO_SERVICE", "ARP: Address in table.");
-            rte_ether_addr_copy(&entry->mac_addr, &arp_req_data->tha);
-            status = 0;
-        }
+    }
+    // In a secondary process, ARP replies arrive on the queue of the primary
+    // process, which shares what it learned
+    if (rte_is_zero_ether_addr(&entry->mac_addr) && port->_secondary
+        && port->_lookup_shared_arp_entry(dst_addr, entry->mac_addr)) {
+        UHD_LOG_TRACE("DPDK::IO_SERVICE", "ARP: Address learned by primary process.");
+    }
+    if (rte_is_zero_ether_addr(&entry->mac_addr)) {
+        UHD_LOG_TRACE(
+            "DPDK::IO_SERVICE", "ARP: Address not populated. Sending ARP request.");
+        entry->reqs.push_back(req);
+        status = -EAGAIN;
+        _send_arp_request(port, _queues.at(port->get_port_id()), arp_req_data->tpa);
+        _shared_arp_pending |= port->_secondary;
+    } else {
+        UHD_LOG_TRACE("DPDK::IO_SERVICE", "ARP: Address in table.");
+        rte_ether_addr_copy(&entry->mac_addr, &arp_req_data->tha);
+        status = 0;
     }
 arp_end:
     rte_spinlock_unlock(&port->_spinlock);
@@ -737,6 +756,7 @@ int dpdk_io_service::_process_arp(
         entry->reqs.clear();
     }
     rte_spinlock_unlock(&port->_spinlock);
+    port->_share_arp_entry(dest_ip, dest_addr);
 
     /* Respond if this was an ARP request */
     if (arp_frame->arp_opcode == rte_cpu_to_be_16(RTE_ARP_OP_REQUEST)
@@ -791,6 +811,7 @@ int dpdk_io_service::_process_udp(
     link->enqueue_recv_mbuf(mbuf);
     auto buff       = link->get_recv_buff(0);
     bool rcvr_found = false;
+    bool queued     = false;
     for (auto client_if : *rx_entry) {
         // Check all the muxed receivers...
         if (client_if->recv_cb(buff, link, link)) {
@@ -807,6 +828,7 @@ int dpdk_io_service::_process_udp(
                     recv_io->_num_frames_in_use++;
                     assert(recv_io->_num_frames_in_use <= recv_io->_num_recv_frames);
                     _wake_client(client_if);
+                    queued = true;
                 }
             }
             break;
@@ -816,8 +838,15 @@ int dpdk_io_service::_process_udp(
         UHD_LOG_WARNING("DPDK::IO_SERVICE", "Dropping packet: No receiver xport found");
         // Release the buffer if no receiver found
         link->release_recv_buff(std::move(buff));
+        link->flush_recv_buffs();
         return -ENOENT;
     }
+    // Callbacks which consume the packet themselves (e.g., for flow control
+    // responses) release it right away, so don't hold on to it. Packets
+    // handed to a client are freed in bursts by _rx_release().
+    if (!queued) {
+        link->flush_recv_buffs();
+    }
     return 0;
 }
 
@@ -872,26 +901,59 @@ int dpdk_io_service::_rx_release(dpdk::dpdk_port* port)
     auto& queues            = _recv_xport_map.at(port->get_port_id());
 
     for (auto& recv_io : queues) {
-        unsigned int num_buf = rte_ring_count(recv_io->_release_queue);
-        num_buf              = (num_buf < RX_BURST_SIZE) ? num_buf : RX_BURST_SIZE;
+        dpdk::dpdk_frame_buff* buffs[RX_BURST_SIZE];
+        const unsigned int num_buf = rte_ring_dequeue_burst(
+            recv_io->_release_queue, (void**)buffs, RX_BURST_SIZE, NULL);
+        if (num_buf == 0) {
+            continue;
+        }
         for (unsigned int i = 0; i < num_buf; i++) {
-            dpdk::dpdk_frame_buff* buff_ptr;
-            int status = rte_ring_dequeue(recv_io->_release_queue, (void**)&buff_ptr);
-            if (status) {
-                UHD_LOG_ERROR("DPDK::IO_SERVICE", "RX Q Count doesn't match actual");
-                break;
-            }
-            recv_io->_fc_cb(frame_buff::uptr(buff_ptr),
+            recv_io->_fc_cb(frame_buff::uptr(buffs[i]),
                 recv_io->_dpdk_io_if.link,
                 recv_io->_dpdk_io_if.link);
             recv_io->_num_frames_in_use--;
         }
+        // Return the whole burst to the mempool at once
+        recv_io->_dpdk_io_if.link->flush_recv_buffs();
         total_bufs += num_buf;
     }
 
     return total_bufs;
 }
 
+void dpdk_io_service::_poll_shared_arp()
+{
+    bool pending = false;
+    for (auto port : _ports) {
+        if (!port->_secondary) {
+            continue;
+        }
+        rte_spinlock_lock(&port->_spinlock);
+        for (auto& ip_entry : port->_arp_table) {
+            struct dpdk::arp_entry* entry = ip_entry.second;
+            if (entry->reqs.empty()) {
+                continue;
+            }
+            if (!port->_lookup_shared_arp_entry(ip_entry.first, entry->mac_addr)) {
+                pending = true;
+                continue;
+            }
+            UHD_LOG_TRACE("DPDK::IO_SERVICE",
+                "ARP: " << dpdk::ipv4_num_to_str(ip_entry.first)
+                        << " learned by primary process");
+            for (auto req : entry->reqs) {
+                auto arp_data = (struct dpdk::arp_request*)req->data;
+                rte_ether_addr_copy(&entry->mac_addr, &arp_data->tha);
+                while (_servq.complete(req) == -ENOBUFS)
+                    ;
+            }
+            entry->reqs.clear();
+        }
+        rte_spinlock_unlock(&port->_spinlock);
+    }
+    _shared_arp_pending = pending;
+}
+
 uint16_t dpdk_io_service::_get_unique_client_id()
 {
     std::lock_guard<std::mutex> lock(_mutex);
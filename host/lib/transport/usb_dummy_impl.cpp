@@ -28,6 +28,11 @@ usb_zero_copy::~usb_zero_copy(void)
     /* NOP */
 }
 
+usb_zero_copy::queue_stats_t usb_zero_copy::get_recv_queue_stats(void) const
+{
+    return queue_stats_t();
+}
+
 std::vector<usb_device_handle::sptr> usb_device_handle::get_device_list(
     uint16_t, uint16_t)
 {
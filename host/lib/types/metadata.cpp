@@ -14,13 +14,22 @@
 
 using namespace uhd;
 
+time_spec_t rx_metadata_t::get_time_spec() const
+{
+    if (!has_time_ticks) {
+        return time_spec;
+    }
+    return time_spec_t::from_ticks(time_ticks, tick_rate)
+           + time_spec_t::from_ticks(time_samps, samp_rate);
+}
+
 std::string rx_metadata_t::to_pp_string(bool compact) const
 {
     std::stringstream ss;
 
     if (compact) {
         if (has_time_spec) {
-            ss << "Time: " << time_spec << " s\n";
+            ss << "Time: " << get_time_spec() << " s\n";
         }
         if (more_fragments) {
             ss << "Fragmentation offset: " << fragment_offset << "\n";
@@ -31,12 +40,18 @@ std::string rx_metadata_t::to_pp_string(bool compact) const
         if (end_of_burst) {
             ss << "End of burst.\n" << fragment_offset;
         }
+        if (has_gain_change) {
+            ss << "Gain change: " << gain << " dB\n";
+        }
+        if (has_gap) {
+            ss << "Gap: " << gap_length << " samples at " << gap_offset << "\n";
+        }
         if (error_code != ERROR_CODE_NONE) {
             ss << strerror() << "\n";
         }
     } else {
         ss << "Has timespec: " << (has_time_spec ? "Yes" : "No")
-           << "\tTime of first sample: " << time_spec
+           << "\tTime of first sample: " << get_time_spec()
            << "\nFragmented: " << (more_fragments ? "Yes" : "No")
            << "  Fragmentation offset: " << fragment_offset
            << "\nStart of burst: " << (start_of_burst ? "Yes" : "No")
@@ -61,16 +61,24 @@ void export_metadata(py::module& m)
         .def("reset", &rx_metadata_t::reset)
         .def("to_pp_string", &rx_metadata_t::to_pp_string)
         .def("strerror", &rx_metadata_t::strerror)
+        .def("get_time_spec", &rx_metadata_t::get_time_spec)
         .def("__str__", &rx_metadata_t::to_pp_string, py::arg("compact") = false)
 
         // Properties
         .def_readonly("has_time_spec", &rx_metadata_t::has_time_spec)
         .def_readonly("time_spec", &rx_metadata_t::time_spec)
+        .def_readonly("has_time_ticks", &rx_metadata_t::has_time_ticks)
+        .def_readonly("time_ticks", &rx_metadata_t::time_ticks)
+        .def_readonly("tick_rate", &rx_metadata_t::tick_rate)
+        .def_readonly("time_samps", &rx_metadata_t::time_samps)
+        .def_readonly("samp_rate", &rx_metadata_t::samp_rate)
         .def_readonly("more_fragments", &rx_metadata_t::more_fragments)
         .def_readonly("start_of_burst", &rx_metadata_t::start_of_burst)
         .def_readonly("end_of_burst", &rx_metadata_t::end_of_burst)
         .def_readonly("error_code", &rx_metadata_t::error_code)
-        .def_readonly("out_of_sequence", &rx_metadata_t::out_of_sequence);
+        .def_readonly("out_of_sequence", &rx_metadata_t::out_of_sequence)
+        .def_readonly("has_gain_change", &rx_metadata_t::has_gain_change)
+        .def_readonly("gain", &rx_metadata_t::gain);
 
     py::class_<tx_metadata_t>(m, "tx_metadata")
         .def(py::init<>())
@@ -88,7 +96,8 @@ void export_metadata(py::module& m)
         .value("time_error", event_code_t::EVENT_CODE_TIME_ERROR)
         .value("underflow_in_packet", event_code_t::EVENT_CODE_UNDERFLOW_IN_PACKET)
         .value("seq_error_in_packet", event_code_t::EVENT_CODE_SEQ_ERROR_IN_BURST)
-        .value("user_payload", event_code_t::EVENT_CODE_USER_PAYLOAD);
+        .value("user_payload", event_code_t::EVENT_CODE_USER_PAYLOAD)
+        .value("padding", event_code_t::EVENT_CODE_PADDING);
 
     py::class_<async_metadata_t>(m, "async_metadata")
         .def(py::init<>())
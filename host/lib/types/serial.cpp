@@ -121,3 +121,13 @@ void spi_iface::write_spi(
 {
     transact_spi(which_slave, config, data, num_bits, false);
 }
+
+void spi_iface::multi_write_spi(int which_slave,
+    const spi_config_t& config,
+    const std::vector<uint32_t>& data,
+    size_t num_bits)
+{
+    for (const uint32_t word : data) {
+        write_spi(which_slave, config, word, num_bits);
+    }
+}
@@ -167,10 +167,7 @@ rx_streamer::sptr b100_impl::get_rx_stream(const uhd::stream_args_t& args_)
         _rx_dsps[dsp]->setup(args);
         _recv_demuxer->realloc_sid(B100_RX_SID_BASE + dsp);
         my_streamer->set_xport_chan_get_buff(chan_i,
-            std::bind(&recv_packet_demuxer_3000::get_recv_buff,
-                _recv_demuxer,
-                B100_RX_SID_BASE + dsp,
-                std::placeholders::_1),
+            _recv_demuxer->make_proxy(B100_RX_SID_BASE + dsp),
             true /*flush*/);
         my_streamer->set_overflow_handler(
             chan_i, std::bind(&rx_dsp_core_200::handle_overflow, _rx_dsps[dsp]));
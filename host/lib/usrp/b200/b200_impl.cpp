@@ -588,10 +588,16 @@ b200_impl::b200_impl(
     }
 
     data_xport_args["recv_frame_size"] = std::to_string(recv_frame_size);
-    data_xport_args["num_recv_frames"] = device_addr.get("num_recv_frames", "16");
+    data_xport_args["num_recv_frames"] = device_addr.get(
+        "num_recv_frames", std::to_string(B200_USB_DATA_DEFAULT_NUM_RECV_FRAMES));
     data_xport_args["send_frame_size"] = device_addr.get(
         "send_frame_size", std::to_string(B200_USB_DATA_DEFAULT_FRAME_SIZE));
     data_xport_args["num_send_frames"] = device_addr.get("num_send_frames", "16");
+    for (const std::string key : {"usb_event_cpus", "usb_dev_mem"}) {
+        if (device_addr.has_key(key)) {
+            data_xport_args[key] = device_addr[key];
+        }
+    }
 
     // This may throw a uhd::usb_error, which will be caught by b200_make().
     _data_transport = usb_zero_copy::make(handle, // identifier
@@ -710,6 +716,9 @@ b200_impl::b200_impl(
         .add_coerced_subscriber(
             std::bind(&b200_impl::set_time, this, std::placeholders::_1))
         .set(0.0);
+    _tree->create<time_spec_t>(mb_path / "time" / "now_estimate")
+        .set_publisher(std::bind(
+            &time_core_3000::get_time_now_estimate, _radio_perifs[0].time64));
     // re-sync the times when the tick rate changes
     _tree->access<double>(mb_path / "tick_rate")
         .add_coerced_subscriber(std::bind(&b200_impl::sync_times, this));
@@ -1304,6 +1313,8 @@ void b200_impl::set_time(const uhd::time_spec_t& t)
         perif.time64->set_time_sync(t);
     _local_ctrl->poke32(TOREG(SR_CORE_SYNC), 1 << 2 | uint32_t(_time_source));
     _local_ctrl->poke32(TOREG(SR_CORE_SYNC), _time_source);
+    for (radio_perifs_t& perif : _radio_perifs)
+        perif.time64->invalidate_time_estimate();
     _time_set_with_pps = false;
 }
 
@@ -88,6 +88,9 @@ static const int B200_USB_DATA_DEFAULT_FRAME_SIZE = 8176;
 // recv_frame_size values below this will be upped to this value
 static const int B200_USB_DATA_MIN_RECV_FRAME_SIZE = 40;
 static const int B200_USB_DATA_MAX_RECV_FRAME_SIZE = 16360;
+// Default number of receive transfers kept in flight. More transfers give the
+// host more time to return buffers before the device overruns.
+static const size_t B200_USB_DATA_DEFAULT_NUM_RECV_FRAMES = 32;
 
 /*
  * VID/PID pairs for all B2xx products
@@ -284,8 +284,7 @@ void b200_impl::update_subdev_spec(
 static void b200_if_hdr_unpack_le(
     const uint32_t* packet_buff, vrt::if_packet_info_t& if_packet_info)
 {
-    if_packet_info.link_type = vrt::if_packet_info_t::LINK_TYPE_CHDR;
-    return vrt::if_hdr_unpack_le(packet_buff, if_packet_info);
+    return vrt::if_hdr_unpack_chdr_le(packet_buff, if_packet_info);
 }
 
 static void b200_if_hdr_pack_le(
@@ -442,7 +441,7 @@ rx_streamer::sptr b200_impl::get_rx_stream(const uhd::stream_args_t& args_)
         my_streamer->resize(args.channels.size());
 
         // init some streamer stuff
-        my_streamer->set_vrt_unpacker(&b200_if_hdr_unpack_le);
+        my_streamer->set_vrt_unpacker(&vrt::if_hdr_unpack_chdr_le);
 
         // set the converter
         uhd::convert::id_type id;
@@ -458,18 +457,26 @@ rx_streamer::sptr b200_impl::get_rx_stream(const uhd::stream_args_t& args_)
         perif.framer->setup(args);
         perif.ddc->setup(args);
         _demux->realloc_sid(sid);
-        my_streamer->set_xport_chan_get_buff(stream_i,
-            std::bind(&recv_packet_demuxer_3000::get_recv_buff,
-                _demux,
-                sid,
-                std::placeholders::_1),
-            true /*flush*/);
+        my_streamer->set_xport_chan_get_buff(
+            stream_i, _demux->make_proxy(sid), true /*flush*/);
         my_streamer->set_overflow_handler(
             stream_i, std::bind(&b200_impl::handle_overflow, this, radio_index));
         my_streamer->set_issue_stream_cmd(stream_i,
             std::bind(&rx_vita_core_3000::issue_stream_command,
                 perif.framer,
                 std::placeholders::_1));
+        if (stream_i == 0) {
+            std::weak_ptr<usb_zero_copy> weak_xport =
+                std::dynamic_pointer_cast<usb_zero_copy>(_data_transport);
+            my_streamer->set_telemetry_fn([weak_xport](stream_telemetry_t& telemetry) {
+                if (auto xport = weak_xport.lock()) {
+                    const auto stats = xport->get_recv_queue_stats();
+                    telemetry.xport_frames_in_flight     = stats.in_flight;
+                    telemetry.xport_frames_in_flight_min = stats.min_in_flight;
+                    telemetry.xport_frames_ready         = stats.ready;
+                }
+            });
+        }
         perif.rx_streamer = my_streamer; // store weak pointer
 
         // sets all tick and samp rates on this streamer
@@ -226,6 +226,14 @@ public:
         _device.set_iq_balance_auto(direction, on);
     }
 
+    void set_tune_cache(const std::string& which, const bool on) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        ad9361_device_t::direction_t direction = _get_direction_from_antenna(which);
+        _device.set_tune_cache(direction, on);
+    }
+
     double set_bw_filter(const std::string& which, const double bw) override
     {
         ad9361_device_t::direction_t direction = _get_direction_from_antenna(which);
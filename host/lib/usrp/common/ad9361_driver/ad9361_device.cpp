@@ -83,6 +83,8 @@ const double ad9361_device_t::AD9361_MAX_GAIN         = 89.75;
 const double ad9361_device_t::AD9361_MIN_CLOCK_RATE   = 220e3;
 const double ad9361_device_t::AD9361_MAX_CLOCK_RATE   = 61.44e6;
 const double ad9361_device_t::AD9361_CAL_VALID_WINDOW = 100e6;
+// Number of frequencies the tune cache remembers per direction.
+const size_t ad9361_device_t::AD9361_TUNE_CACHE_SIZE = 1024;
 // Max bandwdith is due to filter rolloff in analog filter stage
 const double ad9361_device_t::AD9361_MIN_BW = 200e3;
 const double ad9361_device_t::AD9361_MAX_BW = 56e6;
@@ -1134,21 +1136,8 @@ void ad9361_device_t::_setup_gain_control(bool agc)
  * This setup depends on a fixed look-up table, which is stored in an
  * included header file. The table is indexed based on the passed VCO rate.
  */
-void ad9361_device_t::_setup_synth(direction_t direction, double vcorate)
+void ad9361_device_t::_setup_synth(direction_t direction, const int vcoindex)
 {
-    /* The vcorates in the vco_index array represent lower boundaries for
-     * rates. Once we find a match, we use that index to look-up the rest of
-     * the register values in the LUT. */
-    int vcoindex = 0;
-    for (size_t i = 0; i < 53; i++) {
-        vcoindex = i;
-        if (vcorate > vco_index[i]) {
-            break;
-        }
-    }
-    if (vcoindex > 53)
-        throw uhd::runtime_error("[ad9361_device_t] vcoindex > 53");
-
     /* Parse the values out of the LUT based on our calculated index... */
     uint8_t vco_output_level = synth_cal_lut[vcoindex][0];
     uint8_t vco_varactor     = synth_cal_lut[vcoindex][1];
@@ -1163,36 +1152,92 @@ void ad9361_device_t::_setup_synth(direction_t direction, double vcorate)
     uint8_t loop_filter_c3   = synth_cal_lut[vcoindex][10];
     uint8_t loop_filter_r3   = synth_cal_lut[vcoindex][11];
 
-    /* ... annnd program! */
-    if (direction == RX) {
-        _io_iface->poke8(0x23a, 0x40 | vco_output_level);
-        _io_iface->poke8(0x239, 0xC0 | vco_varactor);
-        _io_iface->poke8(0x242, vco_bias_ref | (vco_bias_tcf << 3));
-        _io_iface->poke8(0x238, (vco_cal_offset << 3));
-        _io_iface->poke8(0x245, 0x00);
-        _io_iface->poke8(0x251, vco_varactor_ref);
-        _io_iface->poke8(0x250, 0x70);
-        _io_iface->poke8(0x23b, 0x80 | charge_pump_curr);
-        _io_iface->poke8(0x23e, loop_filter_c1 | (loop_filter_c2 << 4));
-        _io_iface->poke8(0x23f, loop_filter_c3 | (loop_filter_r1 << 4));
-        _io_iface->poke8(0x240, loop_filter_r3);
-    } else if (direction == TX) {
-        _io_iface->poke8(0x27a, 0x40 | vco_output_level);
-        _io_iface->poke8(0x279, 0xC0 | vco_varactor);
-        _io_iface->poke8(0x282, vco_bias_ref | (vco_bias_tcf << 3));
-        _io_iface->poke8(0x278, (vco_cal_offset << 3));
-        _io_iface->poke8(0x285, 0x00);
-        _io_iface->poke8(0x291, vco_varactor_ref);
-        _io_iface->poke8(0x290, 0x70);
-        _io_iface->poke8(0x27b, 0x80 | charge_pump_curr);
-        _io_iface->poke8(0x27e, loop_filter_c1 | (loop_filter_c2 << 4));
-        _io_iface->poke8(0x27f, loop_filter_c3 | (loop_filter_r1 << 4));
-        _io_iface->poke8(0x280, loop_filter_r3);
-    } else {
+    /* ... annnd program! The TX synthesizer registers are at an offset of
+     * 0x40 from the RX ones. */
+    if (direction != RX and direction != TX) {
         throw uhd::runtime_error("[ad9361_device_t] [_setup_synth] INVALID_CODE_PATH");
     }
+    const uint16_t offs = (direction == RX) ? 0x000 : 0x040;
+    _poke_synth_reg(direction, 0x23a + offs, 0x40 | vco_output_level);
+    _poke_synth_reg(direction, 0x239 + offs, 0xC0 | vco_varactor);
+    _poke_synth_reg(direction, 0x242 + offs, vco_bias_ref | (vco_bias_tcf << 3));
+    _poke_synth_reg(direction, 0x238 + offs, (vco_cal_offset << 3));
+    _poke_synth_reg(direction, 0x245 + offs, 0x00);
+    _poke_synth_reg(direction, 0x251 + offs, vco_varactor_ref);
+    _poke_synth_reg(direction, 0x250 + offs, 0x70);
+    _poke_synth_reg(direction, 0x23b + offs, 0x80 | charge_pump_curr);
+    _poke_synth_reg(direction, 0x23e + offs, loop_filter_c1 | (loop_filter_c2 << 4));
+    _poke_synth_reg(direction, 0x23f + offs, loop_filter_c3 | (loop_filter_r1 << 4));
+    _poke_synth_reg(direction, 0x240 + offs, loop_filter_r3);
+}
+
+/* Write a register of the RX or TX synthesizer.
+ *
+ * If the tune cache is on, the write is skipped when the register already
+ * holds the value. Every write goes over the control interface, so this
+ * saves time when retuning within or between nearby bands. */
+void ad9361_device_t::_poke_synth_reg(
+    direction_t direction, const uint16_t addr, const uint8_t val)
+{
+    const bool use_cache = (direction == RX) ? _use_rx_tune_cache : _use_tx_tune_cache;
+    const auto reg       = _synth_regs.find(addr);
+    if (use_cache and reg != _synth_regs.end() and reg->second == val) {
+        return;
+    }
+    _io_iface->poke8(addr, val);
+    _synth_regs[addr] = val;
 }
 
+/* Calculate the RF synthesizer settings for an LO frequency.
+ *
+ * This picks the VCO divider, the integer and fractional words of the
+ * synthesizer, and the index of the synthesizer LUT entry. */
+ad9361_device_t::synth_settings_t ad9361_device_t::_calc_synth_settings(
+    const double value)
+{
+    /* The RFPLL runs from 6 GHz - 12 GHz */
+    const double fref   = 80e6;
+    const int modulus   = 8388593;
+    const double vcomax = 12e9;
+    const double vcomin = 6e9;
+    double vcorate;
+    int vcodiv;
+
+    /* Iterate over VCO dividers until appropriate divider is found. */
+    int i;
+    for (i = 0; i <= 6; i++) {
+        vcodiv  = 2 << i;
+        vcorate = value * vcodiv;
+        if (vcorate >= vcomin && vcorate <= vcomax)
+            break;
+    }
+    if (i == 7)
+        throw uhd::runtime_error("[ad9361_device_t] RFVCO can't find valid VCO rate!");
+
+    synth_settings_t synth;
+    synth.vcodiv_index = i;
+    synth.nint         = static_cast<int>(vcorate / fref);
+    synth.nfrac = static_cast<int>(((vcorate / fref) - synth.nint) * modulus);
+
+    double actual_vcorate = fref * (synth.nint + (double)(synth.nfrac) / modulus);
+    synth.actual_lo       = actual_vcorate / vcodiv;
+
+    /* The vcorates in the vco_index array represent lower boundaries for
+     * rates. Once we find a match, we use that index to look-up the rest of
+     * the register values in the LUT. */
+    int vcoindex = 0;
+    for (size_t j = 0; j < 53; j++) {
+        vcoindex = j;
+        if (actual_vcorate > vco_index[j]) {
+            break;
+        }
+    }
+    if (vcoindex > 53)
+        throw uhd::runtime_error("[ad9361_device_t] vcoindex > 53");
+    synth.vcoindex = vcoindex;
+
+    return synth;
+}
 
 /* Tune the baseband VCO.
  *
@@ -1297,30 +1342,27 @@ void ad9361_device_t::_reprogram_gains()
  * tune the RX or TX VCO. */
 double ad9361_device_t::_tune_helper(direction_t direction, const double value)
 {
-    /* The RFPLL runs from 6 GHz - 12 GHz */
-    const double fref   = 80e6;
-    const int modulus   = 8388593;
-    const double vcomax = 12e9;
-    const double vcomin = 6e9;
-    double vcorate;
-    int vcodiv;
-
-    /* Iterate over VCO dividers until appropriate divider is found. */
-    int i;
-    for (i = 0; i <= 6; i++) {
-        vcodiv  = 2 << i;
-        vcorate = value * vcodiv;
-        if (vcorate >= vcomin && vcorate <= vcomax)
-            break;
+    /* Look up the synthesizer settings, or calculate them. */
+    std::map<double, synth_settings_t>& cache =
+        (direction == RX) ? _rx_synth_cache : _tx_synth_cache;
+    const bool use_cache = (direction == RX) ? _use_rx_tune_cache : _use_tx_tune_cache;
+    synth_settings_t synth;
+    const auto cached = cache.find(value);
+    if (cached != cache.end()) {
+        synth = cached->second;
+    } else {
+        synth = _calc_synth_settings(value);
+        if (use_cache) {
+            if (cache.size() >= AD9361_TUNE_CACHE_SIZE) {
+                cache.clear();
+            }
+            cache[value] = synth;
+        }
     }
-    if (i == 7)
-        throw uhd::runtime_error("[ad9361_device_t] RFVCO can't find valid VCO rate!");
-
-    int nint  = static_cast<int>(vcorate / fref);
-    int nfrac = static_cast<int>(((vcorate / fref) - nint) * modulus);
-
-    double actual_vcorate = fref * (nint + (double)(nfrac) / modulus);
-    double actual_lo      = actual_vcorate / vcodiv;
+    const int i            = synth.vcodiv_index;
+    const int nint         = synth.nint;
+    const int nfrac        = synth.nfrac;
+    const double actual_lo = synth.actual_lo;
 
     if (direction == RX) {
         _req_rx_freq = value;
@@ -1345,13 +1387,13 @@ double ad9361_device_t::_tune_helper(direction_t direction, const double value)
         _regs.vcodivs = (_regs.vcodivs & 0xF0) | (i & 0x0F);
 
         /* Setup the synthesizer. */
-        _setup_synth(RX, actual_vcorate);
+        _setup_synth(RX, synth.vcoindex);
 
-        /* Tune!!!! */
-        _io_iface->poke8(0x233, nfrac & 0xFF);
-        _io_iface->poke8(0x234, (nfrac >> 8) & 0xFF);
-        _io_iface->poke8(0x235, (nfrac >> 16) & 0xFF);
-        _io_iface->poke8(0x232, (nint >> 8) & 0xFF);
+        /* Tune!!!! Writing the lower integer byte starts the tune. */
+        _poke_synth_reg(RX, 0x233, nfrac & 0xFF);
+        _poke_synth_reg(RX, 0x234, (nfrac >> 8) & 0xFF);
+        _poke_synth_reg(RX, 0x235, (nfrac >> 16) & 0xFF);
+        _poke_synth_reg(RX, 0x232, (nint >> 8) & 0xFF);
         _io_iface->poke8(0x231, nint & 0xFF);
         _io_iface->poke8(0x005, _regs.vcodivs);
 
@@ -1385,13 +1427,13 @@ double ad9361_device_t::_tune_helper(direction_t direction, const double value)
         _regs.vcodivs = (_regs.vcodivs & 0x0F) | ((i & 0x0F) << 4);
 
         /* Setup the synthesizer. */
-        _setup_synth(TX, actual_vcorate);
+        _setup_synth(TX, synth.vcoindex);
 
-        /* Tune it, homey. */
-        _io_iface->poke8(0x273, nfrac & 0xFF);
-        _io_iface->poke8(0x274, (nfrac >> 8) & 0xFF);
-        _io_iface->poke8(0x275, (nfrac >> 16) & 0xFF);
-        _io_iface->poke8(0x272, (nint >> 8) & 0xFF);
+        /* Tune it, homey. Writing the lower integer byte starts the tune. */
+        _poke_synth_reg(TX, 0x273, nfrac & 0xFF);
+        _poke_synth_reg(TX, 0x274, (nfrac >> 8) & 0xFF);
+        _poke_synth_reg(TX, 0x275, (nfrac >> 16) & 0xFF);
+        _poke_synth_reg(TX, 0x272, (nint >> 8) & 0xFF);
         _io_iface->poke8(0x271, nint & 0xFF);
         _io_iface->poke8(0x005, _regs.vcodivs);
 
@@ -1587,6 +1629,11 @@ void ad9361_device_t::initialize()
     _regs.bbpll          = 0x02;
     _regs.bbftune_config = 0x1e;
     _regs.bbftune_mode   = 0x1e;
+    /* The reset below returns the synthesizer registers to their defaults,
+     * and undoes the filter calibrations. */
+    _synth_regs.clear();
+    _rx_filter_cal = filter_cal_t();
+    _tx_filter_cal = filter_cal_t();
 
     /* Initialize private VRQ fields. */
     _rx_freq                 = DEFAULT_RX_FREQ;
@@ -2392,6 +2439,26 @@ void ad9361_device_t::set_iq_balance_auto(direction_t direction, const bool on)
     }
 }
 
+/* Turn the tune cache of the RX or TX synthesizer on or off. */
+void ad9361_device_t::set_tune_cache(direction_t direction, const bool on)
+{
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+    if (direction == RX) {
+        _use_rx_tune_cache = on;
+        if (!on) {
+            _rx_synth_cache.clear();
+        }
+    } else if (direction == TX) {
+        _use_tx_tune_cache = on;
+        if (!on) {
+            _tx_synth_cache.clear();
+        }
+    } else {
+        throw uhd::runtime_error("[ad9361_device_t] [set_tune_cache] INVALID_CODE_PATH");
+    }
+}
+
 /* Sets the RX gain mode to be used.
  * If a transition from an AGC to an non AGC mode occurs (or vice versa)
  * the gain configuration will be reloaded. */
@@ -2535,6 +2602,19 @@ double ad9361_device_t::set_bw_filter(direction_t direction, const double rf_bw)
     // differ. Together they should create the requested bb bw. Select rf_bw if it is
     // between AD9361_MIN_BW & AD9361_MAX_BW.
     const double clipped_bw = std::min(std::max(rf_bw, AD9361_MIN_BW), AD9361_MAX_BW);
+
+    /* The calibrations only depend on the bandwidth, the sample rate and the
+     * BBPLL. If none of them changed, the filters are still calibrated. */
+    filter_cal_t& last_cal = (direction == RX) ? _rx_filter_cal : _tx_filter_cal;
+    if (last_cal.valid and freq_is_nearly_equal(clipped_bw, last_cal.rf_bw)
+        and freq_is_nearly_equal(_baseband_bw, last_cal.baseband_bw)
+        and freq_is_nearly_equal(_bbpll_freq, last_cal.bbpll_freq)) {
+        UHD_LOG_TRACE("AD936X",
+            "[ad9361_device_t::set_bw_filter] Skipping calibration, rf_bw="
+                << clipped_bw);
+        return clipped_bw;
+    }
+
     if (direction == RX) {
         _rx_bb_lp_bw  = _calibrate_baseband_rx_analog_filter(clipped_bw); // returns bb bw
         _rx_tia_lp_bw = _calibrate_rx_TIAs(clipped_bw);
@@ -2544,6 +2624,10 @@ double ad9361_device_t::set_bw_filter(direction_t direction, const double rf_bw)
         _tx_sec_lp_bw = _calibrate_secondary_tx_filter(clipped_bw);
         _tx_analog_bw = clipped_bw;
     }
+    last_cal.valid       = true;
+    last_cal.rf_bw       = clipped_bw;
+    last_cal.baseband_bw = _baseband_bw;
+    last_cal.bbpll_freq  = _bbpll_freq;
 
     return (clipped_bw);
 }
@@ -2978,6 +3062,8 @@ void ad9361_device_t::_set_filter_lp_bb(
 {
     analog_filter_lp::sptr lpf = std::dynamic_pointer_cast<analog_filter_lp>(filter);
     double bw                  = lpf->get_cutoff();
+    // set_bw_filter() has to recalibrate after this
+    ((direction == RX) ? _rx_filter_cal : _tx_filter_cal).valid = false;
     if (direction == RX) {
         // remember: this function takes rf bw as its input and calibrated to 1.4 x the
         // given value
@@ -2996,6 +3082,8 @@ void ad9361_device_t::_set_filter_lp_tia_sec(
 {
     analog_filter_lp::sptr lpf = std::dynamic_pointer_cast<analog_filter_lp>(filter);
     double bw                  = lpf->get_cutoff();
+    // set_bw_filter() has to recalibrate after this
+    ((direction == RX) ? _rx_filter_cal : _tx_filter_cal).valid = false;
     if (direction == RX) {
         // remember: this function takes rf bw as its input and calibrated to 2.5 x the
         // given value
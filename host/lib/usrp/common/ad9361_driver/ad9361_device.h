@@ -38,6 +38,7 @@ public:
         _rx1_agc_mode(GAIN_MODE_MANUAL), _rx2_agc_mode(GAIN_MODE_MANUAL),
         _rx1_agc_enable(false), _rx2_agc_enable(false),
         _use_dc_offset_tracking(false), _use_iq_balance_tracking(false),
+        _use_rx_tune_cache(true), _use_tx_tune_cache(true),
         _rx_filters{
             {"LPF_TIA", std::make_tuple(
                     [this](const chain_t){
@@ -230,6 +231,13 @@ public:
     /* Turn on/off AD9361's RX IQ imbalance correction */
     void set_iq_balance_auto(direction_t direction, const bool on);
 
+    /* Turn on/off the tune cache of the RX or TX synthesizer.
+     *
+     * With the cache on, the synthesizer settings of every requested
+     * frequency are remembered, and tuning only writes the synthesizer
+     * registers which change. Turning it off also clears it. */
+    void set_tune_cache(direction_t direction, const bool on);
+
     /* Configure AD9361's AGC module to use either fast or slow AGC mode. */
     void set_agc_mode(chain_t chain, gain_mode_t gain_mode);
 
@@ -254,6 +262,7 @@ public:
     static const double AD9361_MAX_CLOCK_RATE;
     static const double AD9361_MIN_CLOCK_RATE;
     static const double AD9361_CAL_VALID_WINDOW;
+    static const size_t AD9361_TUNE_CACHE_SIZE;
     static const double AD9361_MIN_BW;
     static const double AD9361_MAX_BW;
     static const double DEFAULT_RX_FREQ;
@@ -281,7 +290,8 @@ private:    //Methods
     void _program_mixer_gm_subtable();
     void _program_gain_table();
     void _setup_gain_control(bool use_agc);
-    void _setup_synth(direction_t direction, double vcorate);
+    void _setup_synth(direction_t direction, const int vcoindex);
+    void _poke_synth_reg(direction_t direction, const uint16_t addr, const uint8_t val);
     double _tune_bbvco(const double rate);
     void _reprogram_gains();
     double _tune_helper(direction_t direction, const double value);
@@ -320,6 +330,27 @@ private:    //Members
         uint8_t bbftune_mode;
     };
 
+    //! RF synthesizer settings for one requested LO frequency
+    struct synth_settings_t
+    {
+        double actual_lo;
+        int vcodiv_index;
+        int nint;
+        int nfrac;
+        //! Index into the synthesizer LUT
+        int vcoindex;
+    };
+    synth_settings_t _calc_synth_settings(const double value);
+
+    //! Inputs of the last analog filter calibration of one direction
+    struct filter_cal_t
+    {
+        bool valid         = false;
+        double rf_bw       = 0.0;
+        double baseband_bw = 0.0;
+        double bbpll_freq  = 0.0;
+    };
+
     //Interfaces
     ad9361_params::sptr _client_params;
     ad9361_io::sptr     _io_iface;
@@ -350,6 +381,13 @@ private:    //Members
     std::recursive_mutex  _mutex;
     bool _use_dc_offset_tracking;
     bool _use_iq_balance_tracking;
+    //Tune cache
+    bool _use_rx_tune_cache, _use_tx_tune_cache;
+    std::map<double, synth_settings_t> _rx_synth_cache, _tx_synth_cache;
+    //! Last values written to the synthesizer registers, by address
+    std::map<uint16_t, uint8_t> _synth_regs;
+    //Analog filter calibrations
+    filter_cal_t _rx_filter_cal, _tx_filter_cal;
 
     // Filter API
     using filter_tuple = std::tuple<
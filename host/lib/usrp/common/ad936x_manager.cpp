@@ -30,6 +30,7 @@ const uint32_t ad936x_manager::DEFAULT_INTERP      = 128;
 const bool ad936x_manager::DEFAULT_AUTO_DC_OFFSET  = true;
 const bool ad936x_manager::DEFAULT_AUTO_IQ_BALANCE = true;
 const bool ad936x_manager::DEFAULT_AGC_ENABLE      = false;
+const bool ad936x_manager::DEFAULT_TUNE_CACHE      = true;
 
 class ad936x_manager_impl : public ad936x_manager
 {
@@ -259,6 +260,11 @@ public:
             .set_coercer([this, key](const double freq) {
                 return this->_codec_ctrl->tune(key, freq);
             });
+        subtree->create<bool>("freq/cache/enable")
+            .set(DEFAULT_TUNE_CACHE)
+            .add_coerced_subscriber([this, key](const bool enable) {
+                this->_codec_ctrl->set_tune_cache(key, enable);
+            });
 
         // Frontend corrections
         if (dir == RX_DIRECTION) {
@@ -7,17 +7,25 @@
 #include <uhd/utils/log.hpp>
 #include <uhdlib/usrp/common/io_service_args.hpp>
 #include <uhdlib/usrp/constrained_device_args.hpp>
+#include <uhdlib/utils/args_view.hpp>
 #include <boost/format.hpp>
 #include <regex>
 #include <string>
 
 static const std::string LOG_ID = "IO_SRV";
 
-static const char* recv_offload_str             = "recv_offload";
-static const char* send_offload_str             = "send_offload";
-static const char* recv_offload_wait_mode_str   = "recv_offload_wait_mode";
-static const char* send_offload_wait_mode_str   = "send_offload_wait_mode";
-static const char* num_poll_offload_threads_str = "num_poll_offload_threads";
+static const char* recv_offload_str               = "recv_offload";
+static const char* send_offload_str               = "send_offload";
+static const char* send_fc_offload_str            = "send_fc_offload";
+static const char* recv_offload_wait_mode_str     = "recv_offload_wait_mode";
+static const char* send_offload_wait_mode_str     = "send_offload_wait_mode";
+static const char* recv_offload_spin_us_str       = "recv_offload_spin_us";
+static const char* send_offload_spin_us_str       = "send_offload_spin_us";
+static const char* num_poll_offload_threads_str   = "num_poll_offload_threads";
+static const char* poll_offload_work_stealing_str = "poll_offload_work_stealing";
+static const char* offload_min_frames_ratio_str   = "offload_min_frames_ratio";
+static const char* numa_node_str                  = "numa_node";
+static const char* thread_placement_str           = "thread_placement";
 
 static const std::regex recv_offload_thread_cpu_expr("^recv_offload_thread_(\\d+)_cpu");
 static const std::regex send_offload_thread_cpu_expr("^send_offload_thread_(\\d+)_cpu");
@@ -27,25 +35,27 @@ namespace uhd { namespace usrp {
 
 namespace {
 
-bool get_bool_arg(const device_addr_t& args, const std::string& key, const bool def)
+bool get_bool_arg(const args_view& args, const std::string& key, const bool def)
 {
     constrained_device_args_t::bool_arg arg(key, def);
     if (args.has_key(key)) {
-        arg.parse(args[key]);
+        arg.parse(args.get(key));
     }
     return arg.get();
 }
 
-io_service_args_t::wait_mode_t get_wait_mode_arg(const device_addr_t& args,
+io_service_args_t::wait_mode_t get_wait_mode_arg(const args_view& args,
     const std::string& key,
     const io_service_args_t::wait_mode_t def)
 {
     constrained_device_args_t::enum_arg<io_service_args_t::wait_mode_t> arg(key,
         def,
-        {{"poll", io_service_args_t::POLL}, {"block", io_service_args_t::BLOCK}});
+        {{"poll", io_service_args_t::POLL},
+            {"block", io_service_args_t::BLOCK},
+            {"hybrid", io_service_args_t::HYBRID}});
 
     if (args.has_key(key)) {
-        arg.parse(args[key]);
+        arg.parse(args.get(key));
     }
     return arg.get();
 }
@@ -53,8 +63,10 @@ io_service_args_t::wait_mode_t get_wait_mode_arg(const device_addr_t& args,
 }; // namespace
 
 io_service_args_t read_io_service_args(
-    const device_addr_t& args, const io_service_args_t& defaults)
+    const device_addr_t& dev_args, const io_service_args_t& defaults)
 {
+    // This runs for every transport, so parse the args only once
+    const args_view args(dev_args);
     io_service_args_t io_srv_args;
     std::string tmp_str, default_str;
 
@@ -62,12 +74,19 @@ io_service_args_t read_io_service_args(
         get_bool_arg(args, recv_offload_str, defaults.recv_offload);
     io_srv_args.send_offload =
         get_bool_arg(args, send_offload_str, defaults.send_offload);
+    io_srv_args.send_fc_offload =
+        get_bool_arg(args, send_fc_offload_str, defaults.send_fc_offload);
 
     io_srv_args.recv_offload_wait_mode = get_wait_mode_arg(
         args, recv_offload_wait_mode_str, defaults.recv_offload_wait_mode);
     io_srv_args.send_offload_wait_mode = get_wait_mode_arg(
         args, send_offload_wait_mode_str, defaults.send_offload_wait_mode);
 
+    io_srv_args.recv_offload_spin_us =
+        args.cast<uint32_t>(recv_offload_spin_us_str, defaults.recv_offload_spin_us);
+    io_srv_args.send_offload_spin_us =
+        args.cast<uint32_t>(send_offload_spin_us_str, defaults.send_offload_spin_us);
+
     io_srv_args.num_poll_offload_threads = args.cast<size_t>(
         num_poll_offload_threads_str, defaults.num_poll_offload_threads);
     if (io_srv_args.num_poll_offload_threads == 0) {
@@ -76,10 +95,36 @@ io_service_args_t read_io_service_args(
             "Value must be greater than 0.");
         io_srv_args.num_poll_offload_threads = 1;
     }
+    io_srv_args.poll_offload_work_stealing = get_bool_arg(
+        args, poll_offload_work_stealing_str, defaults.poll_offload_work_stealing);
+
+    io_srv_args.offload_min_frames_ratio = args.cast<double>(
+        offload_min_frames_ratio_str, defaults.offload_min_frames_ratio);
+    if (!(io_srv_args.offload_min_frames_ratio > 0.0
+            && io_srv_args.offload_min_frames_ratio <= 1.0)) {
+        UHD_LOG_WARNING(LOG_ID,
+            "Invalid value for offload_min_frames_ratio. "
+            "Value must be greater than 0 and at most 1.");
+        io_srv_args.offload_min_frames_ratio = 1.0;
+    }
 
-    auto read_thread_args = [&args](
+    io_srv_args.numa_node = args.cast<int>(numa_node_str, defaults.numa_node);
+
+    io_srv_args.auto_thread_placement = defaults.auto_thread_placement;
+    if (args.has_key(thread_placement_str)) {
+        const std::string placement = args.get(thread_placement_str);
+        if (placement == "auto" || placement == "node") {
+            io_srv_args.auto_thread_placement = (placement == "auto");
+        } else {
+            UHD_LOG_WARNING(LOG_ID,
+                "Invalid value for thread_placement: " << placement
+                                                       << ". Must be auto or node.");
+        }
+    }
+
+    auto read_thread_args = [&args, &dev_args](
                                 const std::regex& expr, std::map<size_t, size_t>& dest) {
-        auto keys = args.keys();
+        auto keys = dev_args.keys();
         for (const auto& key : keys) {
             std::smatch match;
             if (std::regex_match(key, match, expr)) {
@@ -115,9 +160,16 @@ device_addr_t merge_io_service_dev_args(
 
     merge_args(dev_args, args, recv_offload_str);
     merge_args(dev_args, args, send_offload_str);
+    merge_args(dev_args, args, send_fc_offload_str);
     merge_args(dev_args, args, recv_offload_wait_mode_str);
     merge_args(dev_args, args, send_offload_wait_mode_str);
+    merge_args(dev_args, args, recv_offload_spin_us_str);
+    merge_args(dev_args, args, send_offload_spin_us_str);
     merge_args(dev_args, args, num_poll_offload_threads_str);
+    merge_args(dev_args, args, poll_offload_work_stealing_str);
+    merge_args(dev_args, args, offload_min_frames_ratio_str);
+    merge_args(dev_args, args, numa_node_str);
+    merge_args(dev_args, args, thread_placement_str);
 
     auto merge_thread_args = [&merge_args](const device_addr_t& dev_args,
                                  device_addr_t& stream_args,
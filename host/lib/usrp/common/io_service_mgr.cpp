@@ -8,6 +8,8 @@
 #include <uhd/transport/adapter_id.hpp>
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/transport/adapter.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #ifdef HAVE_DPDK
@@ -15,6 +17,8 @@
 #endif
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/usrp/constrained_device_args.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -31,6 +35,43 @@ namespace uhd { namespace usrp {
  * object selects which one to invoke based on the provided stream args.
  */
 
+namespace {
+
+/* Returns the CPU affinity for an offload thread that has none specified in
+ * the args: the cores of the NUMA node given in the args, or else the cores of
+ * the NUMA node of the adapter. Returns an empty list if neither is known.
+ *
+ * With automatic thread placement, thread \p thread_index out of
+ * \p num_threads gets a core of its own instead, preferably on that node.
+ */
+std::vector<size_t> get_default_cpu_affinity(const io_service_args_t& args,
+    const adapter_id_t adapter_id,
+    const size_t thread_index,
+    const size_t num_threads,
+    std::string& cpu_affinity_str)
+{
+    const int node = (args.numa_node >= 0)
+                         ? args.numa_node
+                         : adapter_ctx::get().get_numa_node(adapter_id);
+    if (args.auto_thread_placement) {
+        const auto placement = get_thread_placement(num_threads, 0, 0, node);
+        if (thread_index < placement.io_cpus.size()) {
+            const size_t cpu = placement.io_cpus[thread_index];
+            cpu_affinity_str = ", cpu affinity: " + std::to_string(cpu) + " (auto)";
+            return {cpu};
+        }
+    }
+    const auto cpus = numa::get_node_cpus(node);
+    if (cpus.empty()) {
+        cpu_affinity_str = ", cpu affinity: none";
+    } else {
+        cpu_affinity_str = ", cpu affinity: cores of NUMA node " + std::to_string(node);
+    }
+    return cpus;
+}
+
+} // namespace
+
 /* Inline I/O service manager
  *
  * I/O service manager for inline I/O services. Creates a new inline_io_service
@@ -105,10 +146,11 @@ void inline_io_service_mgr::disconnect_links(
 
 /* Blocking I/O service manager
  *
- * I/O service manager for offload I/O services configured to block. This
- * manager creates one offload I/O service for each transport adapter used by
- * a streamer. If there are multiple streamers, this manager creates a separate
- * set of I/O services for each streamer.
+ * I/O service manager for offload I/O services configured to block, or to
+ * poll before they block (hybrid). This manager creates one offload I/O
+ * service for each transport adapter used by a streamer. If there are multiple
+ * streamers, this manager creates a separate set of I/O services for each
+ * streamer.
  */
 class blocking_io_service_mgr
 {
@@ -137,6 +179,7 @@ private:
 
     io_service::sptr _create_new_io_service(const io_service_args_t& args,
         const link_type_t link_type,
+        const adapter_id_t adapter_id,
         const size_t thread_index);
 
     // Map of links to streamer, so we can look up an I/O service from links
@@ -183,7 +226,7 @@ io_service::sptr blocking_io_service_mgr::connect_links(recv_link_if::sptr recv_
 
     if (it == info_vtr.end()) {
         const size_t new_thread_index = info_vtr.size();
-        io_srv = _create_new_io_service(args, link_type, new_thread_index);
+        io_srv = _create_new_io_service(args, link_type, adapter_id, new_thread_index);
         info_vtr.push_back({adapter_id, io_srv, 1 /*connection_count*/});
     } else {
         it->connection_count++;
@@ -243,13 +286,24 @@ void blocking_io_service_mgr::disconnect_links(
 }
 
 io_service::sptr blocking_io_service_mgr::_create_new_io_service(
-    const io_service_args_t& args, const link_type_t link_type, const size_t thread_index)
+    const io_service_args_t& args,
+    const link_type_t link_type,
+    const adapter_id_t adapter_id,
+    const size_t thread_index)
 {
+    const bool is_rx     = (link_type == link_type_t::RX_DATA);
+    const auto wait_mode = is_rx ? args.recv_offload_wait_mode
+                                 : args.send_offload_wait_mode;
+
     offload_io_service::params_t params;
-    params.wait_mode   = offload_io_service::BLOCK;
-    params.client_type = (link_type == link_type_t::RX_DATA)
-                             ? offload_io_service::RECV_ONLY
-                             : offload_io_service::SEND_ONLY;
+    params.wait_mode    = (wait_mode == io_service_args_t::HYBRID)
+                              ? offload_io_service::HYBRID
+                              : offload_io_service::BLOCK;
+    params.spin_time_us = is_rx ? args.recv_offload_spin_us : args.send_offload_spin_us;
+    params.client_type  = is_rx ? offload_io_service::RECV_ONLY
+                                : offload_io_service::SEND_ONLY;
+
+    params.min_frames_ratio = args.offload_min_frames_ratio;
 
     const auto& cpu_map = (link_type == link_type_t::RX_DATA)
                               ? args.recv_offload_thread_cpu
@@ -261,14 +315,19 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
         params.cpu_affinity_list = {cpu};
         cpu_affinity_str         = ", cpu affinity: " + std::to_string(cpu);
     } else {
-        cpu_affinity_str = ", cpu affinity: none";
+        params.cpu_affinity_list = get_default_cpu_affinity(
+            args, adapter_id, thread_index, thread_index + 1, cpu_affinity_str);
     }
 
     std::string link_type_str = (link_type == link_type_t::RX_DATA) ? "RX data"
                                                                     : "TX data";
 
+    const std::string wait_mode_str =
+        (params.wait_mode == offload_io_service::HYBRID) ? "hybrid" : "blocking";
+
     UHD_LOG_INFO(LOG_ID,
-        "Creating new blocking I/O service for " << link_type_str << cpu_affinity_str);
+        "Creating new " << wait_mode_str << " I/O service for " << link_type_str
+                        << cpu_affinity_str);
 
     return offload_io_service::make(inline_io_service::make(), params);
 }
@@ -279,13 +338,19 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
  * number of I/O services specified by the user in stream_args, and distributes
  * links among them. New connections always go to the offload thread containing
  * the fewest connections, with lowest numbered thread as a second criterion.
+ *
+ * With work stealing, every pair of links gets an I/O service of its own
+ * instead, and all of them are polled by a shared pool of threads. The pool
+ * moves I/O services from busy threads to idle ones while streaming.
  */
 class polling_io_service_mgr
 {
 public:
     io_service::sptr connect_links(recv_link_if::sptr recv_link,
         send_link_if::sptr send_link,
-        const io_service_args_t& args);
+        const link_type_t link_type,
+        const io_service_args_t& args,
+        const std::string& streamer_id);
 
     void disconnect_links(recv_link_if::sptr recv_link, send_link_if::sptr send_link);
 
@@ -294,14 +359,25 @@ private:
     {
         io_service::sptr io_srv;
         size_t mux_ref_count;
+        bool pooled = false;
     };
     struct io_srv_info_t
     {
         size_t connection_count;
     };
 
-    io_service::sptr _create_new_io_service(
-        const io_service_args_t& args, const size_t thread_index);
+    io_service::sptr _create_new_io_service(const io_service_args_t& args,
+        const adapter_id_t adapter_id,
+        const size_t thread_index);
+
+    io_service::sptr _create_pooled_io_service(const io_service_args_t& args,
+        const adapter_id_t adapter_id,
+        const std::string& name);
+
+    std::vector<size_t> _get_cpu_affinity(const io_service_args_t& args,
+        const adapter_id_t adapter_id,
+        const size_t thread_index,
+        std::string& cpu_affinity_str);
 
     // Map of links to I/O service
     using link_pair_t = std::pair<recv_link_if::sptr, send_link_if::sptr>;
@@ -309,11 +385,16 @@ private:
 
     // For each I/O service, keep track of the number of connections
     std::map<io_service::sptr, io_srv_info_t> _io_srv_info_map;
+
+    // Threads polling the I/O services of work stealing connections
+    offload_thread_pool::sptr _thread_pool;
 };
 
 io_service::sptr polling_io_service_mgr::connect_links(recv_link_if::sptr recv_link,
     send_link_if::sptr send_link,
-    const io_service_args_t& args)
+    const link_type_t link_type,
+    const io_service_args_t& args,
+    const std::string& streamer_id)
 {
     // Check if links are already connected
     const link_pair_t links{recv_link, send_link};
@@ -321,19 +402,32 @@ io_service::sptr polling_io_service_mgr::connect_links(recv_link_if::sptr recv_l
     if (it != _link_info_map.end()) {
         // Muxing links, add to mux ref count and connection count
         it->second.mux_ref_count++;
-        _io_srv_info_map[it->second.io_srv].connection_count++;
+        if (!it->second.pooled) {
+            _io_srv_info_map[it->second.io_srv].connection_count++;
+        }
         return it->second.io_srv;
     }
 
-    // Links are not muxed. If there are fewer offload threads than requested in
-    // the args, create a new service and add the links to it. Otherwise, add it
-    // to the service that has the fewest connections.
+    // Links are not muxed. With work stealing, they get a new service in the
+    // thread pool. Without, if there are fewer offload threads than requested
+    // in the args, create a new service and add the links to it. Otherwise, add
+    // it to the service that has the fewest connections.
+    const adapter_id_t adapter_id = recv_link ? recv_link->get_recv_adapter_id()
+                                              : send_link->get_send_adapter_id();
     io_service::sptr io_srv;
-    if (_io_srv_info_map.size() < args.num_poll_offload_threads) {
+    if (args.poll_offload_work_stealing) {
+        std::string name = (link_type == link_type_t::RX_DATA) ? "RX data links"
+                                                               : "TX data links";
+        if (!streamer_id.empty()) {
+            name += " of " + streamer_id;
+        }
+        io_srv = _create_pooled_io_service(args, adapter_id, name);
+        _link_info_map[links] = {io_srv, 1 /*mux_ref_count*/, true /*pooled*/};
+    } else if (_io_srv_info_map.size() < args.num_poll_offload_threads) {
         const size_t thread_index = _io_srv_info_map.size();
-        io_srv                    = _create_new_io_service(args, thread_index);
-        _link_info_map[links]     = {io_srv, 1 /*mux_ref_count*/};
-        _io_srv_info_map[io_srv]  = {1 /*connection_count*/};
+        io_srv = _create_new_io_service(args, adapter_id, thread_index);
+        _link_info_map[links]    = {io_srv, 1 /*mux_ref_count*/};
+        _io_srv_info_map[io_srv] = {1 /*connection_count*/};
     } else {
         using map_pair_t = std::pair<io_service::sptr, io_srv_info_t>;
         auto cmp         = [](const map_pair_t& left, const map_pair_t& right) {
@@ -373,34 +467,85 @@ void polling_io_service_mgr::disconnect_links(
             io_srv->detach_send_link(send_link);
         }
 
+        const bool pooled = it->second.pooled;
         _link_info_map.erase(it);
         _io_srv_info_map.erase(io_srv);
+
+        // Stop the thread pool once the last of its I/O services is gone
+        if (pooled
+            && std::none_of(_link_info_map.begin(),
+                _link_info_map.end(),
+                [](const std::pair<const link_pair_t, link_info_t>& link_info) {
+                    return link_info.second.pooled;
+                })) {
+            _thread_pool.reset();
+        }
     }
 }
 
 io_service::sptr polling_io_service_mgr::_create_new_io_service(
-    const io_service_args_t& args, const size_t thread_index)
+    const io_service_args_t& args,
+    const adapter_id_t adapter_id,
+    const size_t thread_index)
 {
     offload_io_service::params_t params;
-    params.client_type = offload_io_service::BOTH_SEND_AND_RECV;
-    params.wait_mode   = offload_io_service::POLL;
-
-    const auto& cpu_map = args.poll_offload_thread_cpu;
+    params.client_type      = offload_io_service::BOTH_SEND_AND_RECV;
+    params.wait_mode        = offload_io_service::POLL;
+    params.min_frames_ratio = args.offload_min_frames_ratio;
 
     std::string cpu_affinity_str;
-    if (cpu_map.count(thread_index) != 0) {
-        const size_t cpu         = cpu_map.at(thread_index);
-        params.cpu_affinity_list = {cpu};
-        cpu_affinity_str         = ", cpu affinity: " + std::to_string(cpu);
-    } else {
-        cpu_affinity_str = ", cpu affinity: none";
-    }
+    params.cpu_affinity_list =
+        _get_cpu_affinity(args, adapter_id, thread_index, cpu_affinity_str);
 
     UHD_LOG_INFO(LOG_ID, "Creating new polling I/O service" << cpu_affinity_str);
 
     return offload_io_service::make(inline_io_service::make(), params);
 }
 
+io_service::sptr polling_io_service_mgr::_create_pooled_io_service(
+    const io_service_args_t& args,
+    const adapter_id_t adapter_id,
+    const std::string& name)
+{
+    // The first connection decides the number of threads and their affinity
+    if (!_thread_pool) {
+        std::vector<std::vector<size_t>> cpu_affinity_lists;
+        for (size_t i = 0; i < args.num_poll_offload_threads; i++) {
+            std::string cpu_affinity_str;
+            cpu_affinity_lists.push_back(
+                _get_cpu_affinity(args, adapter_id, i, cpu_affinity_str));
+            UHD_LOG_INFO(LOG_ID,
+                "Creating new work stealing polling I/O thread" << cpu_affinity_str);
+        }
+        _thread_pool = offload_thread_pool::make(cpu_affinity_lists);
+    }
+
+    offload_io_service::params_t params;
+    params.client_type      = offload_io_service::BOTH_SEND_AND_RECV;
+    params.wait_mode        = offload_io_service::POLL;
+    params.thread_pool      = _thread_pool;
+    params.name             = name;
+    params.min_frames_ratio = args.offload_min_frames_ratio;
+
+    return offload_io_service::make(inline_io_service::make(), params);
+}
+
+std::vector<size_t> polling_io_service_mgr::_get_cpu_affinity(
+    const io_service_args_t& args,
+    const adapter_id_t adapter_id,
+    const size_t thread_index,
+    std::string& cpu_affinity_str)
+{
+    const auto& cpu_map = args.poll_offload_thread_cpu;
+    if (cpu_map.count(thread_index) != 0) {
+        const size_t cpu = cpu_map.at(thread_index);
+        cpu_affinity_str = ", cpu affinity: " + std::to_string(cpu);
+        return {cpu};
+    }
+    return get_default_cpu_affinity(
+        args, adapter_id, thread_index, args.num_poll_offload_threads, cpu_affinity_str);
+}
+
 /* Main I/O service manager implementation class
  *
  * Composite I/O service manager that dispatches requests to other managers,
@@ -540,7 +685,8 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
                 recv_link, send_link, link_type, args, streamer_id);
             break;
         case POLLING_IO_SRV:
-            io_srv = _polling_io_srv_mgr.connect_links(recv_link, send_link, args);
+            io_srv = _polling_io_srv_mgr.connect_links(
+                recv_link, send_link, link_type, args, streamer_id);
             break;
         default:
             UHD_THROW_INVALID_CODE_PATH();
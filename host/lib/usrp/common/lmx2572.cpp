@@ -372,6 +372,45 @@ public:
         return actual_freq;
     }
 
+    frequency_image_t get_frequency_image(const double target_freq,
+        const double fOSC,
+        const bool spur_dodging) override
+    {
+        // set_frequency() only updates the register cache, so we let it work on
+        // the cache, and restore the current settings afterwards
+        const lmx2572_regs_t regs = _regs;
+        frequency_image_t image;
+        try {
+            image.freq = set_frequency(target_freq, fOSC, spur_dodging);
+        } catch (...) {
+            _regs = regs;
+            throw;
+        }
+        for (int addr = 0; addr < _regs.get_num_regs(); addr++) {
+            image.regs.push_back(_regs.get_reg(addr));
+        }
+        _regs = regs;
+        return image;
+    }
+
+    void load_frequency_image(const frequency_image_t& image) override
+    {
+        UHD_ASSERT_THROW(image.regs.size() == size_t(_regs.get_num_regs()));
+        // These fields are written to the chip right away when they change, and
+        // not on commit(), so the cache must keep their current state
+        const auto muxout_ld_sel = _regs.muxout_ld_sel;
+        const auto powerdown     = _regs.powerdown;
+        const auto ro_regs       = _regs.get_ro_regs();
+        for (int addr = 0; addr < _regs.get_num_regs(); addr++) {
+            if (ro_regs.count(addr)) {
+                continue;
+            }
+            _regs.set_reg(uhd::narrow_cast<uint8_t>(addr), image.regs[addr]);
+        }
+        _regs.muxout_ld_sel = muxout_ld_sel;
+        _regs.powerdown     = powerdown;
+    }
+
 private:
     /**************************************************************************
      * Attributes
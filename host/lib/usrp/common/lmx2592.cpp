@@ -117,8 +117,10 @@ inline bool offset_abs_less_than_compare(const offset_t a, const offset_t b)
 class lmx2592_impl : public lmx2592_iface
 {
 public:
-    explicit lmx2592_impl(write_spi_t write_fn, read_spi_t read_fn)
-        : _write_fn([write_fn](const uint8_t addr, const uint16_t data) {
+    explicit lmx2592_impl(
+        write_spi_t write_fn, read_spi_t read_fn, write_multi_spi_t write_multi_fn)
+        : _write_multi_fn(std::move(write_multi_fn))
+        , _write_fn([write_fn](const uint8_t addr, const uint16_t data) {
             const uint32_t spi_transaction =
                 0 | ((addr & SPI_ADDR_MASK) << SPI_ADDR_SHIFT) | data;
             write_fn(spi_transaction);
@@ -405,13 +407,22 @@ public:
         const auto changed_addrs = _rewrite_regs ? _regs.get_all_addrs()
                                                  : _regs.get_changed_addrs<size_t>();
 
+        std::vector<uint32_t> spi_transactions;
         for (const auto addr : changed_addrs) {
-            _write_fn(addr, _regs.get_reg(addr));
+            if (_write_multi_fn) {
+                spi_transactions.push_back(
+                    ((addr & SPI_ADDR_MASK) << SPI_ADDR_SHIFT) | _regs.get_reg(addr));
+            } else {
+                _write_fn(addr, _regs.get_reg(addr));
+            }
             UHD_LOGGER_TRACE("LMX2592")
                 << "Register " << std::setw(2) << static_cast<unsigned int>(addr)
                 << ": 0x" << std::hex << std::uppercase << std::setw(4)
                 << std::setfill('0') << static_cast<unsigned int>(_regs.get_reg(addr));
         }
+        if (!spi_transactions.empty()) {
+            _write_multi_fn(spi_transactions);
+        }
 
         _regs.save_state();
         UHD_LOG_DEBUG("LMX2592",
@@ -428,6 +439,8 @@ private: // Members
     //! Read functor: Return value given address
     using read_fn_t = std::function<uint16_t(uint8_t)>;
 
+    //! Clocks out the writes of commit() in one go, if given
+    write_multi_spi_t _write_multi_fn;
     write_fn_t _write_fn;
     read_fn_t _read_fn;
     lmx2592_regs_t _regs;
@@ -760,7 +773,8 @@ private: // Members
     };
 };
 
-lmx2592_impl::sptr lmx2592_iface::make(write_spi_t write, read_spi_t read)
+lmx2592_impl::sptr lmx2592_iface::make(
+    write_spi_t write, read_spi_t read, write_multi_spi_t write_multi)
 {
-    return std::make_shared<lmx2592_impl>(write, read);
+    return std::make_shared<lmx2592_impl>(write, read, write_multi);
 }
@@ -5,41 +5,132 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
-#include <uhd/transport/vrt_if_packet.hpp>
-#include <uhd/types/metadata.hpp>
+#include <uhd/exception.hpp>
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
 #include <uhdlib/usrp/common/recv_packet_demuxer.hpp>
-#include <deque>
-#include <mutex>
-#include <queue>
-#include <vector>
+#include <uhdlib/usrp/common/recv_packet_demuxer_3000.hpp>
+#include <cmath>
+#include <exception>
 
 using namespace uhd;
 using namespace uhd::usrp;
 using namespace uhd::transport;
 
-struct recv_pkt_demux_mrb : public managed_recv_buffer
+namespace {
+
+//! Time after which the demux thread checks whether it should stop
+constexpr double DEMUX_TIMEOUT = 0.1;
+
+uint32_t extract_sid(const managed_recv_buffer::sptr& buff)
 {
-public:
-    recv_pkt_demux_mrb(void)
-    { /*NOP*/
+    // ASSUME that the data is in little endian format
+    return uhd::wtohx(buff->cast<const uint32_t*>()[1]);
+}
+
+} // namespace
+
+/***********************************************************************
+ * recv_packet_demuxer_3000
+ **********************************************************************/
+recv_packet_demuxer_3000::recv_packet_demuxer_3000(zero_copy_if::sptr xport)
+    : _xport(xport), _queues(MAX_NUM_SIDS)
+{
+    _demux_thread = std::thread([this]() { _demux_loop(); });
+    set_thread_name(&_demux_thread, "uhd_rx_demux");
+}
+
+recv_packet_demuxer_3000::~recv_packet_demuxer_3000()
+{
+    _stop = true;
+    _demux_thread.join();
+}
+
+managed_recv_buffer::sptr recv_packet_demuxer_3000::get_recv_buff(
+    const uint32_t sid, const double timeout)
+{
+    managed_recv_buffer::sptr buff;
+    _get_queue(sid).pop(buff, int32_t(std::ceil(std::max(timeout, 0.0) * 1000)));
+    return buff;
+}
+
+void recv_packet_demuxer_3000::realloc_sid(const uint32_t sid)
+{
+    managed_recv_buffer::sptr buff;
+    queue_type_t& queue = _get_queue(sid);
+    while (queue.pop(buff)) {
     }
+}
 
-    void release(void) override
-    {
-        delete this;
+recv_packet_demuxer_3000::queue_type_t* recv_packet_demuxer_3000::_find_queue(
+    const uint32_t sid)
+{
+    for (auto& sid_queue : _queues) {
+        if (!sid_queue.used.load(std::memory_order_acquire)) {
+            // Queues are used in order, so there are no more after this one
+            return nullptr;
+        }
+        if (sid_queue.sid == sid) {
+            return sid_queue.queue.get();
+        }
     }
+    return nullptr;
+}
 
-    uint32_t buff[10];
-};
+recv_packet_demuxer_3000::queue_type_t& recv_packet_demuxer_3000::_get_queue(
+    const uint32_t sid)
+{
+    queue_type_t* queue = _find_queue(sid);
+    if (queue) {
+        return *queue;
+    }
+    std::lock_guard<std::mutex> lock(_queues_mutex);
+    for (auto& sid_queue : _queues) {
+        if (!sid_queue.used.load(std::memory_order_relaxed)) {
+            // Every frame of the transport fits into the queue, so the demux
+            // thread never has to drop packets of a SID which is received
+            sid_queue.sid   = sid;
+            sid_queue.queue = std::make_unique<queue_type_t>(
+                _xport->get_num_recv_frames(), true /* blocking */);
+            sid_queue.used.store(true, std::memory_order_release);
+            return *sid_queue.queue;
+        }
+        if (sid_queue.sid == sid) {
+            return *sid_queue.queue;
+        }
+    }
+    throw uhd::runtime_error("recv packet demuxer: Too many SIDs");
+}
 
-static UHD_INLINE uint32_t extract_sid(managed_recv_buffer::sptr& buff)
+void recv_packet_demuxer_3000::_demux_loop()
 {
-    // ASSUME that the data is in little endian format
-    return uhd::wtohx(buff->cast<const uint32_t*>()[1]);
+    while (!_stop) {
+        managed_recv_buffer::sptr buff;
+        try {
+            buff = _xport->get_recv_buff(DEMUX_TIMEOUT);
+        } catch (const std::exception& ex) {
+            UHD_LOGGER_ERROR("STREAMER")
+                << "recv packet demuxer failed to receive: " << ex.what();
+            continue;
+        }
+        if (!buff) {
+            continue;
+        }
+        const uint32_t sid  = extract_sid(buff);
+        queue_type_t* queue = _find_queue(sid);
+        if (!queue) {
+            UHD_LOGGER_ERROR("STREAMER") << "recv packet demuxer unexpected sid 0x"
+                                         << std::hex << sid << std::dec;
+        } else if (!queue->push(buff)) {
+            UHD_LOG_FASTPATH("O");
+        }
+    }
 }
 
+/***********************************************************************
+ * recv_packet_demuxer
+ **********************************************************************/
 recv_packet_demuxer::~recv_packet_demuxer(void)
 {
     /* NOP */
@@ -51,67 +142,22 @@ public:
     recv_packet_demuxer_impl(transport::zero_copy_if::sptr transport,
         const size_t size,
         const uint32_t sid_base)
-        : _transport(transport), _sid_base(sid_base), _queues(size)
+        : _demux(recv_packet_demuxer_3000::make(transport)), _sid_base(sid_base)
     {
-        /* NOP */
+        for (size_t index = 0; index < size; index++) {
+            _demux->realloc_sid(_sid_base + uint32_t(index));
+        }
     }
 
     managed_recv_buffer::sptr get_recv_buff(
         const size_t index, const double timeout) override
     {
-        std::lock_guard<std::mutex> lock(_mutex);
-        managed_recv_buffer::sptr buff;
-
-        // there is already an entry in the queue, so pop that
-        if (not _queues[index].wrapper.empty()) {
-            std::swap(buff, _queues[index].wrapper.front());
-            _queues[index].wrapper.pop();
-            return buff;
-        }
-
-        while (true) {
-            // otherwise call into the transport
-            buff = _transport->get_recv_buff(timeout);
-            if (buff.get() == NULL)
-                return buff; // timeout
-
-            // check the stream id to know which channel
-            const size_t rx_index = extract_sid(buff) - _sid_base;
-            if (rx_index == index)
-                return buff; // got expected message
-
-            // otherwise queue and try again
-            if (rx_index < _queues.size())
-                _queues[rx_index].wrapper.push(buff);
-            else {
-                UHD_LOGGER_ERROR("STREAMER")
-                    << "Got a data packet with unknown SID " << extract_sid(buff);
-                recv_pkt_demux_mrb* mrb = new recv_pkt_demux_mrb();
-                vrt::if_packet_info_t info;
-                info.packet_type         = vrt::if_packet_info_t::PACKET_TYPE_DATA;
-                info.num_payload_words32 = 1;
-                info.num_payload_bytes   = info.num_payload_words32 * sizeof(uint32_t);
-                info.has_sid             = true;
-                info.sid                 = _sid_base + index;
-                vrt::if_hdr_pack_le(mrb->buff, info);
-                mrb->buff[info.num_header_words32] = rx_metadata_t::ERROR_CODE_OVERFLOW;
-                return mrb->make(
-                    mrb, mrb->buff, info.num_packet_words32 * sizeof(uint32_t));
-            }
-        }
+        return _demux->get_recv_buff(_sid_base + uint32_t(index), timeout);
     }
 
 private:
-    transport::zero_copy_if::sptr _transport;
+    recv_packet_demuxer_3000::sptr _demux;
     const uint32_t _sid_base;
-    std::mutex _mutex;
-    struct channel_guts_type
-    {
-        channel_guts_type(void) : wrapper(container) {}
-        std::deque<managed_recv_buffer::sptr> container;
-        std::queue<managed_recv_buffer::sptr> wrapper;
-    };
-    std::vector<channel_guts_type> _queues;
 };
 
 recv_packet_demuxer::sptr recv_packet_demuxer::make(
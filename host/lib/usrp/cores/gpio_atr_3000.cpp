@@ -8,6 +8,7 @@
 #include <uhd/types/dict.hpp>
 #include <uhd/utils/soft_register.hpp>
 #include <uhdlib/usrp/cores/gpio_atr_3000.hpp>
+#include <algorithm>
 #include <unordered_map>
 
 using namespace uhd;
@@ -58,8 +59,10 @@ class gpio_atr_3000_impl : public gpio_atr_3000
 {
 public:
     gpio_atr_3000_impl(wb_iface::sptr iface,
-        const gpio_atr_offsets registers)
+        const gpio_atr_offsets registers,
+        cmd_fifo_slots_fn_t&& cmd_fifo_slots_fn = cmd_fifo_slots_fn_t())
         : _iface(iface)
+        , _cmd_fifo_slots_fn(std::move(cmd_fifo_slots_fn))
         , _rb_addr(registers.readback)
         , _atr_idle_reg(registers.idle, _atr_disable_reg)
         , _atr_rx_reg(registers.rx)
@@ -168,6 +171,37 @@ public:
         _update_attr_state(GPIO_OUT, value, mask);
     }
 
+    size_t set_gpio_pattern(const std::vector<gpio_pattern_step_t>& steps) override
+    {
+        auto timed_iface = std::dynamic_pointer_cast<timed_wb_iface>(_iface);
+        if (!timed_iface) {
+            throw uhd::not_implemented_error(
+                "set_gpio_pattern not supported for untimed interface.");
+        }
+        for (size_t i = 1; i < steps.size(); i++) {
+            if (steps[i].time < steps[i - 1].time) {
+                throw uhd::value_error(
+                    "set_gpio_pattern: Steps are not in chronological order.");
+            }
+        }
+        // Every step is exactly one write to the idle register
+        const size_t num_steps = _cmd_fifo_slots_fn
+                                     ? std::min(steps.size(), _cmd_fifo_slots_fn())
+                                     : steps.size();
+        const uhd::time_spec_t cmd_time = timed_iface->get_time();
+        try {
+            for (size_t i = 0; i < num_steps; i++) {
+                timed_iface->set_time(steps[i].time);
+                set_gpio_out(steps[i].value, steps[i].mask);
+            }
+        } catch (...) {
+            timed_iface->set_time(cmd_time);
+            throw;
+        }
+        timed_iface->set_time(cmd_time);
+        return num_steps;
+    }
+
     uint32_t read_gpio() override
     {
         // Read the state of the GPIO pins
@@ -316,6 +350,7 @@ protected:
 
     std::unordered_map<gpio_attr_t, uint32_t, std::hash<size_t>> _attr_reg_state;
     wb_iface::sptr _iface;
+    cmd_fifo_slots_fn_t _cmd_fifo_slots_fn;
     wb_iface::wb_addr_type _rb_addr;
     atr_idle_reg_t _atr_idle_reg;
     masked_reg_t _atr_rx_reg;
@@ -331,10 +366,12 @@ protected:
     }
 };
 
-gpio_atr_3000::sptr gpio_atr_3000::make(wb_iface::sptr iface, gpio_atr_offsets registers)
+gpio_atr_3000::sptr gpio_atr_3000::make(wb_iface::sptr iface,
+    gpio_atr_offsets registers,
+    cmd_fifo_slots_fn_t&& cmd_fifo_slots_fn)
 {
     gpio_atr_3000::sptr gpio_iface = std::make_shared<gpio_atr_3000_impl>(
-        iface, registers);
+        iface, registers, std::move(cmd_fifo_slots_fn));
     if (registers.is_writeonly()) {
         gpio_iface->set_gpio_ddr(DDR_OUTPUT, MASK_SET_ALL);
     }
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <map>
 
 #define REG_DSP_RX_FREQ _dsp_base + 0
 #define REG_DSP_RX_SCALE_IQ _dsp_base + 4
@@ -35,6 +36,9 @@ T ceil_log2(T num)
 
 using namespace uhd;
 
+//! Number of rate plans which are cached until the cache is cleared
+static constexpr size_t MAX_RATE_PLANS = 32;
+
 const double rx_dsp_core_3000::DEFAULT_CORDIC_FREQ = 0.0;
 const double rx_dsp_core_3000::DEFAULT_RATE        = 1e6;
 
@@ -102,6 +106,9 @@ public:
 
     void set_tick_rate(const double rate) override
     {
+        if (rate != _tick_rate) {
+            _invalidate_rate_plans();
+        }
         _tick_rate = rate;
         set_freq(_current_freq);
     }
@@ -109,114 +116,35 @@ public:
     void set_link_rate(const double rate) override
     {
         //_link_rate = rate/sizeof(uint32_t); //in samps/s
-        _link_rate = rate / sizeof(uint16_t); // in samps/s (allows for 8sc)
+        const double link_rate = rate / sizeof(uint16_t); // in samps/s (allows for 8sc)
+        if (link_rate != _link_rate) {
+            _invalidate_rate_plans();
+        }
+        _link_rate = link_rate;
     }
 
     uhd::meta_range_t get_host_rates(void) override
     {
-        meta_range_t range;
-        if (!_is_b200) {
-            for (int rate = 1024; rate > 512; rate -= 8) {
-                range.push_back(range_t(_tick_rate / rate));
-            }
-        }
-        for (int rate = 512; rate > 256; rate -= 4) {
-            range.push_back(range_t(_tick_rate / rate));
+        if (_host_rates.empty()) {
+            _host_rates = _make_host_rates();
         }
-        for (int rate = 256; rate > 128; rate -= 2) {
-            range.push_back(range_t(_tick_rate / rate));
-        }
-        for (int rate = 128; rate >= int(std::ceil(_tick_rate / _link_rate)); rate -= 1) {
-            range.push_back(range_t(_tick_rate / rate));
-        }
-        return range;
+        return _host_rates;
     }
 
     double set_host_rate(const double rate) override
     {
-        const size_t decim_rate =
-            std::lround(_tick_rate / this->get_host_rates().clip(rate, true));
-        size_t decim = decim_rate;
-
-        // determine which half-band filters are activated
-        int hb0 = 0, hb1 = 0, hb2 = 0, hb_enable = 0;
-        if (decim % 2 == 0) {
-            hb0 = 1;
-            decim /= 2;
-        }
-        if (decim % 2 == 0) {
-            hb1 = 1;
-            decim /= 2;
-        }
-        // the third half-band is not supported by the B200
-        if (decim % 2 == 0 && !_is_b200) {
-            hb2 = 1;
-            decim /= 2;
-        }
-
-        if (_is_b200) {
-            _iface->poke32(REG_DSP_RX_DECIM,
-                (hb0 << 9) /*small HB */ | (hb1 << 8) /*large HB*/ | (decim & 0xff));
-
-            if (decim > 1 and hb0 == 0 and hb1 == 0) {
-                UHD_LOGGER_WARNING("CORES")
-                    << boost::format(
-                           "The requested decimation is odd; the user should expect CIC "
-                           "rolloff.\n"
-                           "Select an even decimation to ensure that a halfband filter "
-                           "is enabled.\n"
-                           "decimation = dsp_rate/samp_rate -> %d = (%f MHz)/(%f MHz)\n")
-                           % decim_rate % (_tick_rate / 1e6) % (rate / 1e6);
-            }
-        } else {
-            // Encode Halfband config for setting register programming.
-            if (hb2) { // Implies HB1 and HB0 also asserted
-                hb_enable = 3;
-            } else if (hb1) { // Implies HB0 is also asserted
-                hb_enable = 2;
-            } else if (hb0) {
-                hb_enable = 1;
-            } else {
-                hb_enable = 0;
-            }
-            _iface->poke32(REG_DSP_RX_DECIM, (hb_enable << 8) | (decim & 0xff));
-
-            if (decim > 1 and hb0 == 0 and hb1 == 0 and hb2 == 0) {
-                UHD_LOGGER_WARNING("CORES")
-                    << boost::format(
-                           "The requested decimation is odd; the user should expect "
-                           "passband CIC rolloff.\n"
-                           "Select an even decimation to ensure that a halfband filter "
-                           "is enabled.\n"
-                           "Decimations factorable by 4 will enable 2 halfbands, those "
-                           "factorable by 8 will enable 3 halfbands.\n"
-                           "decimation = dsp_rate/samp_rate -> %d = (%f MHz)/(%f MHz)\n")
-                           % decim_rate % (_tick_rate / 1e6) % (rate / 1e6);
+        auto plan_it = _rate_plans.find(rate);
+        if (plan_it == _rate_plans.end()) {
+            if (_rate_plans.size() >= MAX_RATE_PLANS) {
+                _rate_plans.clear();
             }
+            plan_it = _rate_plans.emplace(rate, _make_rate_plan(rate)).first;
         }
-
-        // Caclulate algorithmic gain of CIC for a given decimation.
-        // For Ettus CIC R=decim, M=1, N=4. Gain = (R * M) ^ N
-        const double rate_pow = std::pow(double(decim & 0xff), 4);
-        // Calculate compensation gain values for algorithmic gain of CORDIC and CIC
-        // taking into account gain compensation blocks already hardcoded in place in DDC
-        // (that provide simple 1/2^n gain compensation). CORDIC algorithmic gain limits
-        // asymptotically around 1.647 after many iterations.
-        //
-        // The polar rotation of [I,Q] = [1,1] by Pi/8 also yields max magnitude of
-        // SQRT(2) (~1.4142) however input to the CORDIC thats outside the unit circle can
-        // only be sourced from a saturated RF frontend. To provide additional dynamic
-        // range head room accordingly using scale factor applied at egress from DDC would
-        // cost us small signal performance, thus we do no provide compensation gain for a
-        // saturated front end and allow the signal to clip in the H/W as needed. If we
-        // wished to avoid the signal clipping in these circumstances then adjust code to
-        // read: _scaling_adjustment = std::pow(2,
-        // ceil_log2(rate_pow))/(1.648*rate_pow*1.415);
-        _scaling_adjustment = std::pow(2, ceil_log2(rate_pow)) / (1.648 * rate_pow);
-
+        const rate_plan_t& plan = plan_it->second;
+        _iface->poke32(REG_DSP_RX_DECIM, plan.decim_word);
+        _scaling_adjustment = plan.scaling_adjustment;
         this->update_scalar();
-
-        return _tick_rate / decim_rate;
+        return plan.host_rate;
     }
 
     // Calculate compensation gain values for algorithmic gain of CORDIC and CIC taking
@@ -311,6 +239,129 @@ public:
     }
 
 private:
+    //! Register values and scaling of a host rate, which only depend on the
+    // tick rate and the link rate
+    struct rate_plan_t
+    {
+        uint32_t decim_word       = 0;
+        double scaling_adjustment = 1.0;
+        double host_rate          = 0.0;
+    };
+
+    uhd::meta_range_t _make_host_rates(void) const
+    {
+        meta_range_t range;
+        if (!_is_b200) {
+            for (int rate = 1024; rate > 512; rate -= 8) {
+                range.push_back(range_t(_tick_rate / rate));
+            }
+        }
+        for (int rate = 512; rate > 256; rate -= 4) {
+            range.push_back(range_t(_tick_rate / rate));
+        }
+        for (int rate = 256; rate > 128; rate -= 2) {
+            range.push_back(range_t(_tick_rate / rate));
+        }
+        for (int rate = 128; rate >= int(std::ceil(_tick_rate / _link_rate)); rate -= 1) {
+            range.push_back(range_t(_tick_rate / rate));
+        }
+        return range;
+    }
+
+    //! Call when the tick rate or the link rate changes
+    void _invalidate_rate_plans(void)
+    {
+        _host_rates.clear();
+        _rate_plans.clear();
+    }
+
+    //! Compute the register values for a host rate
+    rate_plan_t _make_rate_plan(const double rate)
+    {
+        const size_t decim_rate =
+            std::lround(_tick_rate / this->get_host_rates().clip(rate, true));
+        size_t decim = decim_rate;
+
+        // determine which half-band filters are activated
+        int hb0 = 0, hb1 = 0, hb2 = 0, hb_enable = 0;
+        rate_plan_t plan;
+        if (decim % 2 == 0) {
+            hb0 = 1;
+            decim /= 2;
+        }
+        if (decim % 2 == 0) {
+            hb1 = 1;
+            decim /= 2;
+        }
+        // the third half-band is not supported by the B200
+        if (decim % 2 == 0 && !_is_b200) {
+            hb2 = 1;
+            decim /= 2;
+        }
+
+        if (_is_b200) {
+            plan.decim_word =
+                (hb0 << 9) /*small HB */ | (hb1 << 8) /*large HB*/ | (decim & 0xff);
+
+            if (decim > 1 and hb0 == 0 and hb1 == 0) {
+                UHD_LOGGER_WARNING("CORES")
+                    << boost::format(
+                           "The requested decimation is odd; the user should expect CIC "
+                           "rolloff.\n"
+                           "Select an even decimation to ensure that a halfband filter "
+                           "is enabled.\n"
+                           "decimation = dsp_rate/samp_rate -> %d = (%f MHz)/(%f MHz)\n")
+                           % decim_rate % (_tick_rate / 1e6) % (rate / 1e6);
+            }
+        } else {
+            // Encode Halfband config for setting register programming.
+            if (hb2) { // Implies HB1 and HB0 also asserted
+                hb_enable = 3;
+            } else if (hb1) { // Implies HB0 is also asserted
+                hb_enable = 2;
+            } else if (hb0) {
+                hb_enable = 1;
+            } else {
+                hb_enable = 0;
+            }
+            plan.decim_word = (hb_enable << 8) | (decim & 0xff);
+
+            if (decim > 1 and hb0 == 0 and hb1 == 0 and hb2 == 0) {
+                UHD_LOGGER_WARNING("CORES")
+                    << boost::format(
+                           "The requested decimation is odd; the user should expect "
+                           "passband CIC rolloff.\n"
+                           "Select an even decimation to ensure that a halfband filter "
+                           "is enabled.\n"
+                           "Decimations factorable by 4 will enable 2 halfbands, those "
+                           "factorable by 8 will enable 3 halfbands.\n"
+                           "decimation = dsp_rate/samp_rate -> %d = (%f MHz)/(%f MHz)\n")
+                           % decim_rate % (_tick_rate / 1e6) % (rate / 1e6);
+            }
+        }
+
+        // Caclulate algorithmic gain of CIC for a given decimation.
+        // For Ettus CIC R=decim, M=1, N=4. Gain = (R * M) ^ N
+        const double rate_pow = std::pow(double(decim & 0xff), 4);
+        // Calculate compensation gain values for algorithmic gain of CORDIC and CIC
+        // taking into account gain compensation blocks already hardcoded in place in DDC
+        // (that provide simple 1/2^n gain compensation). CORDIC algorithmic gain limits
+        // asymptotically around 1.647 after many iterations.
+        //
+        // The polar rotation of [I,Q] = [1,1] by Pi/8 also yields max magnitude of
+        // SQRT(2) (~1.4142) however input to the CORDIC thats outside the unit circle can
+        // only be sourced from a saturated RF frontend. To provide additional dynamic
+        // range head room accordingly using scale factor applied at egress from DDC would
+        // cost us small signal performance, thus we do no provide compensation gain for a
+        // saturated front end and allow the signal to clip in the H/W as needed. If we
+        // wished to avoid the signal clipping in these circumstances then adjust code to
+        // read: _scaling_adjustment = std::pow(2,
+        // ceil_log2(rate_pow))/(1.648*rate_pow*1.415);
+        plan.scaling_adjustment = std::pow(2, ceil_log2(rate_pow)) / (1.648 * rate_pow);
+        plan.host_rate          = _tick_rate / decim_rate;
+        return plan;
+    }
+
     wb_iface::sptr _iface;
     const size_t _dsp_base;
     const bool _is_b200; // TODO: Obsolete this when we switch to the new DDC on the B200
@@ -323,6 +374,12 @@ private:
     double _host_extra_scaling     = 0.0;
     double _fxpt_scalar_correction = 0.0;
     double _current_freq           = 0.0;
+
+    //! Host rates with the current tick rate and link rate, empty until needed
+    uhd::meta_range_t _host_rates;
+    //! Rate plans by requested host rate, so the coercer of a rate which was
+    // set before doesn't have to recompute it
+    std::map<double, rate_plan_t> _rate_plans;
 };
 
 rx_dsp_core_3000::sptr rx_dsp_core_3000::make(
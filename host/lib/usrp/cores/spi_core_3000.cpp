@@ -12,6 +12,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace {
 constexpr double DEFAULT_DIVIDER = 30.0;
@@ -31,9 +32,11 @@ public:
         peek32_fn_t&& peek32_fn,
         const size_t base,
         const size_t reg_offset,
-        const size_t readback)
+        const size_t readback,
+        multi_poke32_fn_t&& multi_poke32_fn = multi_poke32_fn_t())
         : _poke32(std::move(poke32_fn))
         , _peek32(std::move(peek32_fn))
+        , _multi_poke32(std::move(multi_poke32_fn))
         , _spi_div_addr(base + 0 * reg_offset)
         , _spi_ctrl_addr(base + 1 * reg_offset)
         , _spi_data_addr(base + 2 * reg_offset)
@@ -50,6 +53,48 @@ public:
     {
         std::lock_guard<std::mutex> lock(_mutex);
 
+        _queue_config(which_slave, config, num_bits);
+        // load data word (must be in upper bits)
+        _queue_poke(_spi_data_addr, data << (32 - num_bits));
+        _flush_pokes();
+
+        // conditional readback
+        if (readback) {
+            return _peek32(_readback_addr);
+        }
+
+        return 0;
+    }
+
+    void multi_write_spi(int which_slave,
+        const spi_config_t& config,
+        const std::vector<uint32_t>& data,
+        size_t num_bits) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // All words share the divider and the control word, so they only need
+        // to be sent (if at all) ahead of the first one
+        _queue_config(which_slave, config, num_bits);
+        for (const uint32_t word : data) {
+            _queue_poke(_spi_data_addr, word << (32 - num_bits));
+        }
+        _flush_pokes();
+    }
+
+    void set_divider(const double div) override
+    {
+        _div = size_t((div / 2) - 0.5);
+    }
+
+private:
+    //! Queue the writes of the divider and the control word, if they changed
+    void _queue_config(
+        const int which_slave, const spi_config_t& config, const size_t num_bits)
+    {
+        _poke_addrs.clear();
+        _poke_values.clear();
+
         // load SPI divider
         size_t spi_divider = _div;
         if (config.use_custom_divider) {
@@ -60,7 +105,7 @@ public:
 
         // conditionally send SPI divider
         if (spi_divider != _divider_cache) {
-            _poke32(_spi_div_addr, spi_divider);
+            _queue_poke(_spi_div_addr, spi_divider);
             _divider_cache = spi_divider;
         }
 
@@ -75,32 +120,34 @@ public:
 
         // conditionally send control word
         if (_ctrl_word_cache != ctrl_word) {
-            _poke32(_spi_ctrl_addr, ctrl_word);
+            _queue_poke(_spi_ctrl_addr, ctrl_word);
             _ctrl_word_cache = ctrl_word;
         }
+    }
 
-        // load data word (must be in upper bits)
-        const uint32_t data_out = data << (32 - num_bits);
-
-        // send data word
-        _poke32(_spi_data_addr, data_out);
-
-        // conditional readback
-        if (readback) {
-            return _peek32(_readback_addr);
-        }
-
-        return 0;
+    void _queue_poke(const size_t addr, const uint32_t value)
+    {
+        _poke_addrs.push_back(static_cast<uint32_t>(addr));
+        _poke_values.push_back(value);
     }
 
-    void set_divider(const double div) override
+    //! Send the queued writes, in one burst if possible
+    void _flush_pokes()
     {
-        _div = size_t((div / 2) - 0.5);
+        if (_multi_poke32 && _poke_addrs.size() > 1) {
+            _multi_poke32(_poke_addrs, _poke_values);
+        } else {
+            for (size_t i = 0; i < _poke_addrs.size(); i++) {
+                _poke32(_poke_addrs[i], _poke_values[i]);
+            }
+        }
+        _poke_addrs.clear();
+        _poke_values.clear();
     }
 
-private:
     poke32_fn_t _poke32;
     peek32_fn_t _peek32;
+    multi_poke32_fn_t _multi_poke32;
     const size_t _spi_div_addr;
     const size_t _spi_ctrl_addr;
     const size_t _spi_data_addr;
@@ -109,6 +156,9 @@ private:
     std::mutex _mutex;
     size_t _div;
     size_t _divider_cache = 0;
+    //! The register writes of the current transaction(s)
+    std::vector<uint32_t> _poke_addrs;
+    std::vector<uint32_t> _poke_values;
 };
 
 spi_core_3000::sptr spi_core_3000::make(
@@ -127,8 +177,13 @@ spi_core_3000::sptr spi_core_3000::make(spi_core_3000::poke32_fn_t&& poke32_fn,
     spi_core_3000::peek32_fn_t&& peek32_fn,
     const size_t base,
     const size_t reg_offset,
-    const size_t readback)
+    const size_t readback,
+    spi_core_3000::multi_poke32_fn_t&& multi_poke32_fn)
 {
-    return std::make_shared<spi_core_3000_impl>(
-        std::move(poke32_fn), std::move(peek32_fn), base, reg_offset, readback);
+    return std::make_shared<spi_core_3000_impl>(std::move(poke32_fn),
+        std::move(peek32_fn),
+        base,
+        reg_offset,
+        readback,
+        std::move(multi_poke32_fn));
 }
@@ -12,6 +12,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 
 namespace uhd { namespace cores {
@@ -26,9 +27,11 @@ public:
         const size_t spi_transaction_go,
         const size_t spi_status,
         const size_t spi_controller_info,
-        const mapper_sptr port_mapper)
+        const mapper_sptr port_mapper,
+        multi_poke32_fn_t&& multi_poke32_fn)
         : _poke32(std::move(poke32_fn))
         , _peek32(std::move(peek32_fn))
+        , _multi_poke32(std::move(multi_poke32_fn))
         , _spi_periph_cfg(spi_periph_cfg)
         , _spi_transaction_cfg(spi_transaction_cfg)
         , _spi_transaction_go(spi_transaction_go)
@@ -60,6 +63,61 @@ public:
         const size_t num_bits,
         const bool readback) override
     {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue_config(which_periph, config, num_bits);
+
+        // load data word (in upper bits)
+        const uint32_t data_out = data << (32 - num_bits);
+
+        // send data word
+        _queue_poke(_spi_transaction_go, data_out);
+        _flush_pokes();
+
+        // conditional readback
+        if (readback) {
+            uint32_t spi_response = 0;
+            bool spi_ready        = false;
+            // Poll the SPI status until we get a SPI Ready flag
+            std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+            while (!spi_ready) {
+                spi_response = _peek32(_spi_status);
+                spi_ready    = spi_ready_bit(spi_response);
+                if (spi_timeout(t1, 5)) {
+                    throw uhd::io_error(
+                        "SPI Read did not receive a SPI Ready within 5 seconds");
+                    return 0;
+                }
+            }
+            return (0xFFFFFF & spi_response);
+        }
+
+        return 0;
+    }
+
+    void multi_write_spi(const int which_periph,
+        const spi_config_t& config,
+        const std::vector<uint32_t>& data,
+        const size_t num_bits) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // All words share the peripheral control and the transaction config,
+        // so they only need to be sent (if at all) ahead of the first one
+        _queue_config(which_periph, config, num_bits);
+        for (const uint32_t word : data) {
+            _queue_poke(_spi_transaction_go, word << (32 - num_bits));
+        }
+        _flush_pokes();
+    }
+
+private:
+    //! Queue the writes of the peripheral control and the transaction config,
+    // if they changed
+    void _queue_config(
+        const int which_periph, const spi_config_t& config, const size_t num_bits)
+    {
+        _poke_addrs.clear();
+        _poke_values.clear();
+
         if (static_cast<uint32_t>(which_periph) >= _spi_periph_config.size()) {
             throw uhd::value_error(
                 "No configuration given for requested SPI peripheral.");
@@ -67,7 +125,6 @@ public:
         if (config.divider > 0xFFFF) {
             throw uhd::value_error("Clock divider exceeds maximum value (65535).");
         }
-        std::lock_guard<std::mutex> lock(_mutex);
         uint32_t periph_ctrl = 0;
         if (config.mosi_edge == spi_config_t::EDGE_FALL) {
             periph_ctrl |= (1 << 27);
@@ -95,7 +152,7 @@ public:
 
         // conditionally send peripheral control
         if (_periph_ctrl_cache[which_periph] != periph_ctrl) {
-            _poke32(_spi_periph_cfg + (which_periph * 0x4), periph_ctrl);
+            _queue_poke(_spi_periph_cfg + (which_periph * 0x4), periph_ctrl);
             _periph_ctrl_cache[which_periph] = periph_ctrl;
         }
 
@@ -107,40 +164,34 @@ public:
 
         // conditionally send transaction config
         if (_transaction_cfg_cache != transaction_config) {
-            _poke32(_spi_transaction_cfg, transaction_config);
+            _queue_poke(_spi_transaction_cfg, transaction_config);
             _transaction_cfg_cache = transaction_config;
         }
+    }
 
-        // load data word (in upper bits)
-        const uint32_t data_out = data << (32 - num_bits);
-
-        // send data word
-        _poke32(_spi_transaction_go, data_out);
+    void _queue_poke(const size_t addr, const uint32_t value)
+    {
+        _poke_addrs.push_back(static_cast<uint32_t>(addr));
+        _poke_values.push_back(value);
+    }
 
-        // conditional readback
-        if (readback) {
-            uint32_t spi_response = 0;
-            bool spi_ready        = false;
-            // Poll the SPI status until we get a SPI Ready flag
-            std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
-            while (!spi_ready) {
-                spi_response = _peek32(_spi_status);
-                spi_ready    = spi_ready_bit(spi_response);
-                if (spi_timeout(t1, 5)) {
-                    throw uhd::io_error(
-                        "SPI Read did not receive a SPI Ready within 5 seconds");
-                    return 0;
-                }
+    //! Send the queued writes, in one burst if possible
+    void _flush_pokes()
+    {
+        if (_multi_poke32 && _poke_addrs.size() > 1) {
+            _multi_poke32(_poke_addrs, _poke_values);
+        } else {
+            for (size_t i = 0; i < _poke_addrs.size(); i++) {
+                _poke32(_poke_addrs[i], _poke_values[i]);
             }
-            return (0xFFFFFF & spi_response);
         }
-
-        return 0;
+        _poke_addrs.clear();
+        _poke_values.clear();
     }
 
-private:
     poke32_fn_t _poke32;
     peek32_fn_t _peek32;
+    multi_poke32_fn_t _multi_poke32;
     const size_t _spi_periph_cfg;
     const size_t _spi_transaction_cfg;
     const size_t _spi_transaction_go;
@@ -151,6 +202,9 @@ private:
     uint32_t _transaction_cfg_cache = 0;
     std::mutex _mutex;
     std::vector<uhd::features::spi_periph_config_t> _spi_periph_config;
+    //! The register writes of the current transaction(s)
+    std::vector<uint32_t> _poke_addrs;
+    std::vector<uint32_t> _poke_values;
 
     /*! Gets the SPI_READY flag */
     bool spi_ready_bit(uint32_t spi_response)
@@ -173,7 +227,8 @@ spi_core_4000::sptr spi_core_4000::make(spi_core_4000::poke32_fn_t&& poke32_fn,
     const size_t spi_transaction_go,
     const size_t spi_status,
     const size_t spi_controller_info,
-    const mapper_sptr port_mapper)
+    const mapper_sptr port_mapper,
+    spi_core_4000::multi_poke32_fn_t&& multi_poke32_fn)
 {
     return std::make_shared<spi_core_4000_impl>(std::move(poke32_fn),
         std::move(peek32_fn),
@@ -182,7 +237,8 @@ spi_core_4000::sptr spi_core_4000::make(spi_core_4000::poke32_fn_t&& poke32_fn,
         spi_transaction_go,
         spi_status,
         spi_controller_info,
-        port_mapper);
+        port_mapper,
+        std::move(multi_poke32_fn));
 }
 
 }} // namespace uhd::cores
@@ -8,6 +8,7 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/safe_call.hpp>
 #include <uhdlib/usrp/cores/time_core_3000.hpp>
+#include <uhdlib/utils/time_estimator.hpp>
 #include <chrono>
 #include <thread>
 
@@ -21,6 +22,9 @@
 
 using namespace uhd;
 
+//! Time the estimate reads the hardware after a time was set for the next PPS
+static constexpr double PPS_HOLDOFF = 1.1;
+
 time_core_3000::~time_core_3000(void)
 {
     /* NOP */
@@ -31,7 +35,10 @@ struct time_core_3000_impl : time_core_3000
     time_core_3000_impl(wb_iface::sptr iface,
         const size_t base,
         const readback_bases_type& readback_bases)
-        : _iface(iface), _base(base), _readback_bases(readback_bases)
+        : _iface(iface)
+        , _base(base)
+        , _readback_bases(readback_bases)
+        , _time_estimator([this]() { return _iface->peek64(_readback_bases.rb_now); })
     {
         this->set_tick_rate(1); // init to non zero
     }
@@ -45,6 +52,7 @@ struct time_core_3000_impl : time_core_3000
     void set_tick_rate(const double rate) override
     {
         _tick_rate = rate;
+        _time_estimator.invalidate();
     }
 
     void self_test(void) override
@@ -77,6 +85,16 @@ struct time_core_3000_impl : time_core_3000
         return time_spec_t::from_ticks(ticks, _tick_rate);
     }
 
+    uhd::time_spec_t get_time_now_estimate(void) override
+    {
+        return time_spec_t::from_ticks(_time_estimator.get_ticks(_tick_rate), _tick_rate);
+    }
+
+    void invalidate_time_estimate(void) override
+    {
+        _time_estimator.invalidate();
+    }
+
     uhd::time_spec_t get_time_last_pps(void) override
     {
         const uint64_t ticks = _iface->peek64(_readback_bases.rb_pps);
@@ -89,6 +107,7 @@ struct time_core_3000_impl : time_core_3000
         _iface->poke32(REG_TIME_HI, uint32_t(ticks >> 32));
         _iface->poke32(REG_TIME_LO, uint32_t(ticks >> 0));
         _iface->poke32(REG_TIME_CTRL, CTRL_LATCH_TIME_NOW);
+        _time_estimator.invalidate();
     }
 
     void set_time_sync(const uhd::time_spec_t& time) override
@@ -97,6 +116,9 @@ struct time_core_3000_impl : time_core_3000
         _iface->poke32(REG_TIME_HI, uint32_t(ticks >> 32));
         _iface->poke32(REG_TIME_LO, uint32_t(ticks >> 0));
         _iface->poke32(REG_TIME_CTRL, CTRL_LATCH_TIME_SYNC);
+        // The time is latched on the next sync pulse, which must be followed
+        // by invalidate_time_estimate()
+        _time_estimator.invalidate();
     }
 
     void set_time_next_pps(const uhd::time_spec_t& time) override
@@ -105,12 +127,14 @@ struct time_core_3000_impl : time_core_3000
         _iface->poke32(REG_TIME_HI, uint32_t(ticks >> 32));
         _iface->poke32(REG_TIME_LO, uint32_t(ticks >> 0));
         _iface->poke32(REG_TIME_CTRL, CTRL_LATCH_TIME_PPS);
+        _time_estimator.invalidate(PPS_HOLDOFF);
     }
 
     wb_iface::sptr _iface;
     const size_t _base;
     const readback_bases_type _readback_bases;
     double _tick_rate;
+    time_estimator _time_estimator;
 };
 
 time_core_3000::sptr time_core_3000::make(
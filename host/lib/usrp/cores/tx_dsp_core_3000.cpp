@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <map>
 
 #define REG_DSP_TX_FREQ _dsp_base + 0
 #define REG_DSP_TX_SCALE_IQ _dsp_base + 4
@@ -27,6 +28,9 @@ T ceil_log2(T num)
 
 using namespace uhd;
 
+//! Number of rate plans which are cached until the cache is cleared
+static constexpr size_t MAX_RATE_PLANS = 32;
+
 const double tx_dsp_core_3000::DEFAULT_CORDIC_FREQ = 0.0;
 const double tx_dsp_core_3000::DEFAULT_RATE        = 1e6;
 
@@ -46,6 +50,9 @@ public:
 
     void set_tick_rate(const double rate) override
     {
+        if (rate != _tick_rate) {
+            _invalidate_rate_plans();
+        }
         _tick_rate = rate;
         set_freq(_current_freq);
     }
@@ -53,65 +60,35 @@ public:
     void set_link_rate(const double rate) override
     {
         //_link_rate = rate/sizeof(uint32_t); //in samps/s
-        _link_rate = rate / sizeof(uint16_t); // in samps/s (allows for 8sc)
+        const double link_rate = rate / sizeof(uint16_t); // in samps/s (allows for 8sc)
+        if (link_rate != _link_rate) {
+            _invalidate_rate_plans();
+        }
+        _link_rate = link_rate;
     }
 
     uhd::meta_range_t get_host_rates(void) override
     {
-        meta_range_t range;
-        for (int rate = 512; rate > 256; rate -= 4) {
-            range.push_back(range_t(_tick_rate / rate));
+        if (_host_rates.empty()) {
+            _host_rates = _make_host_rates();
         }
-        for (int rate = 256; rate > 128; rate -= 2) {
-            range.push_back(range_t(_tick_rate / rate));
-        }
-        for (int rate = 128; rate >= int(std::ceil(_tick_rate / _link_rate)); rate -= 1) {
-            range.push_back(range_t(_tick_rate / rate));
-        }
-        return range;
+        return _host_rates;
     }
 
     double set_host_rate(const double rate) override
     {
-        const size_t interp_rate =
-            std::lround(_tick_rate / this->get_host_rates().clip(rate, true));
-        size_t interp = interp_rate;
-
-        // determine which half-band filters are activated
-        int hb0 = 0, hb1 = 0;
-        if (interp % 2 == 0) {
-            hb0 = 1;
-            interp /= 2;
-        }
-        if (interp % 2 == 0) {
-            hb1 = 1;
-            interp /= 2;
+        auto plan_it = _rate_plans.find(rate);
+        if (plan_it == _rate_plans.end()) {
+            if (_rate_plans.size() >= MAX_RATE_PLANS) {
+                _rate_plans.clear();
+            }
+            plan_it = _rate_plans.emplace(rate, _make_rate_plan(rate)).first;
         }
-
-        _iface->poke32(REG_DSP_TX_INTERP, (hb1 << 9) | (hb0 << 8) | (interp & 0xff));
-
-        if (interp > 1 and hb0 == 0 and hb1 == 0) {
-            UHD_LOGGER_WARNING("CORES")
-                << boost::format(
-                       "The requested interpolation is odd; the user should expect CIC "
-                       "rolloff.\n"
-                       "Select an even interpolation to ensure that a halfband filter is "
-                       "enabled.\n"
-                       "interpolation = dsp_rate/samp_rate -> %d = (%f MHz)/(%f MHz)\n")
-                       % interp_rate % (_tick_rate / 1e6) % (rate / 1e6);
-        }
-
-        // Caclulate algorithmic gain of CIC for a given interpolation
-        // For Ettus CIC R=decim, M=1, N=3. Gain = (R * M) ^ N
-        const double rate_pow = std::pow(double(interp & 0xff), 3);
-        // Calculate compensation gain values for algorithmic gain of CORDIC and CIC
-        // taking into account gain compensation blocks already hardcoded in place in DDC
-        // (that provide simple 1/2^n gain compensation). CORDIC algorithmic gain limits
-        // asymptotically around 1.647 after many iterations.
-        _scaling_adjustment = std::pow(2, ceil_log2(rate_pow)) / (1.648 * rate_pow);
+        const rate_plan_t& plan = plan_it->second;
+        _iface->poke32(REG_DSP_TX_INTERP, plan.interp_word);
+        _scaling_adjustment = plan.scaling_adjustment;
         this->update_scalar();
-
-        return _tick_rate / interp_rate;
+        return plan.host_rate;
     }
 
     // Calculate compensation gain values for algorithmic gain of CORDIC and CIC taking
@@ -197,6 +174,81 @@ public:
     }
 
 private:
+    //! Register values and scaling of a host rate, which only depend on the
+    // tick rate and the link rate
+    struct rate_plan_t
+    {
+        uint32_t interp_word      = 0;
+        double scaling_adjustment = 1.0;
+        double host_rate          = 0.0;
+    };
+
+    uhd::meta_range_t _make_host_rates(void) const
+    {
+        meta_range_t range;
+        for (int rate = 512; rate > 256; rate -= 4) {
+            range.push_back(range_t(_tick_rate / rate));
+        }
+        for (int rate = 256; rate > 128; rate -= 2) {
+            range.push_back(range_t(_tick_rate / rate));
+        }
+        for (int rate = 128; rate >= int(std::ceil(_tick_rate / _link_rate)); rate -= 1) {
+            range.push_back(range_t(_tick_rate / rate));
+        }
+        return range;
+    }
+
+    //! Call when the tick rate or the link rate changes
+    void _invalidate_rate_plans(void)
+    {
+        _host_rates.clear();
+        _rate_plans.clear();
+    }
+
+    //! Compute the register values for a host rate
+    rate_plan_t _make_rate_plan(const double rate)
+    {
+        const size_t interp_rate =
+            std::lround(_tick_rate / this->get_host_rates().clip(rate, true));
+        size_t interp = interp_rate;
+
+        // determine which half-band filters are activated
+        int hb0 = 0, hb1 = 0;
+        if (interp % 2 == 0) {
+            hb0 = 1;
+            interp /= 2;
+        }
+        if (interp % 2 == 0) {
+            hb1 = 1;
+            interp /= 2;
+        }
+
+        rate_plan_t plan;
+        plan.interp_word = (hb1 << 9) | (hb0 << 8) | (interp & 0xff);
+
+        if (interp > 1 and hb0 == 0 and hb1 == 0) {
+            UHD_LOGGER_WARNING("CORES")
+                << boost::format(
+                       "The requested interpolation is odd; the user should expect CIC "
+                       "rolloff.\n"
+                       "Select an even interpolation to ensure that a halfband filter is "
+                       "enabled.\n"
+                       "interpolation = dsp_rate/samp_rate -> %d = (%f MHz)/(%f MHz)\n")
+                       % interp_rate % (_tick_rate / 1e6) % (rate / 1e6);
+        }
+
+        // Caclulate algorithmic gain of CIC for a given interpolation
+        // For Ettus CIC R=decim, M=1, N=3. Gain = (R * M) ^ N
+        const double rate_pow = std::pow(double(interp & 0xff), 3);
+        // Calculate compensation gain values for algorithmic gain of CORDIC and CIC
+        // taking into account gain compensation blocks already hardcoded in place in DDC
+        // (that provide simple 1/2^n gain compensation). CORDIC algorithmic gain limits
+        // asymptotically around 1.647 after many iterations.
+        plan.scaling_adjustment = std::pow(2, ceil_log2(rate_pow)) / (1.648 * rate_pow);
+        plan.host_rate          = _tick_rate / interp_rate;
+        return plan;
+    }
+
     wb_iface::sptr _iface;
     const size_t _dsp_base;
     double _tick_rate              = 1.0;
@@ -206,6 +258,12 @@ private:
     double _host_extra_scaling     = 0.0;
     double _fxpt_scalar_correction = 0.0;
     double _current_freq           = 0.0;
+
+    //! Host rates with the current tick rate and link rate, empty until needed
+    uhd::meta_range_t _host_rates;
+    //! Rate plans by requested host rate, so the coercer of a rate which was
+    // set before doesn't have to recompute it
+    std::map<double, rate_plan_t> _rate_plans;
 };
 
 tx_dsp_core_3000::sptr tx_dsp_core_3000::make(wb_iface::sptr iface, const size_t dsp_base)
@@ -82,6 +82,18 @@ public:
             1.0e9,
             AUTO_RESOLVE_ON_READ_WRITE);
         get_rx_subtree()->create<device_addr_t>("tune_args").set(device_addr_t());
+        // Precomputed LO1 settings. Writing a list of tune frequencies here
+        // makes tuning to any of them faster, on both channels.
+        get_rx_subtree()
+            ->create<std::vector<double>>("freq/precompute")
+            .add_coerced_subscriber([this](const std::vector<double>& freqs) {
+                std::vector<double> lo1_freqs;
+                lo1_freqs.reserve(freqs.size());
+                for (const double freq : freqs) {
+                    lo1_freqs.push_back(twinrx_freq_path_expert::get_lo1_freq(freq));
+                }
+                _ctrl->set_precomputed_lo1_freqs(lo1_freqs);
+            });
 
         static const double DEFAULT_IF_FREQ = 150e6;
         meta_range_t if_freq_range;
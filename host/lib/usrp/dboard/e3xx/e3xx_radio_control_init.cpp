@@ -32,7 +32,7 @@ void e3xx_radio_control_impl::_init_defaults()
     // in arguments from the device args. So if block_args contains a
     // master_clock_rate key, then it should better be whatever the device is
     // configured to do.
-    auto block_args = get_block_args();
+    const auto& block_args = get_block_args();
     _master_clock_rate =
         _rpcc->request_with_token<double>(_rpc_prefix + "get_master_clock_rate");
     const double block_args_mcr =
@@ -109,10 +109,11 @@ void e3xx_radio_control_impl::_init_peripherals()
         usrp::gpio_atr::gpio_atr_offsets::make_default(
             e3xx_regs::SR_FP_GPIO,
             e3xx_regs::RB_FP_GPIO,
-            e3xx_regs::PERIPH_REG_OFFSET));
+            e3xx_regs::PERIPH_REG_OFFSET),
+        [this]() { return regs().get_cmd_fifo_free_slots(true); });
 
 
-    auto block_args = get_block_args();
+    const auto& block_args = get_block_args();
     if (block_args.has_key("identify")) {
         const std::string identify_val = block_args.get("identify");
         int identify_duration          = std::atoi(identify_val.c_str());
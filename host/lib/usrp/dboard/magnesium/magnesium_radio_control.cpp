@@ -15,6 +15,8 @@
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhd/utils/static.hpp>
+#include <uhdlib/rfnoc/factory.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <cmath>
@@ -1371,3 +1373,9 @@ std::string magnesium_radio_control_impl::get_fe_name(
 // Register the block
 UHD_RFNOC_BLOCK_REGISTER_FOR_DEVICE_DIRECT(
     magnesium_radio_control, RADIO_BLOCK, N300, "Radio", true, "radio_clk", "bus_clk");
+
+// Both daughterboards can be initialized at the same time
+UHD_STATIC_BLOCK(register_magnesium_radio_control_parallel_init)
+{
+    uhd::rfnoc::factory::register_parallel_init(RADIO_BLOCK, N300);
+}
@@ -47,7 +47,7 @@ void magnesium_radio_control_impl::_init_defaults()
         radio_control_impl::set_tx_bandwidth(MAGNESIUM_DEFAULT_BANDWIDTH, chan);
     }
 
-    const auto block_args = get_block_args();
+    const auto& block_args = get_block_args();
     if (block_args.has_key("tx_gain_profile")) {
         RFNOC_LOG_INFO("Using user specified TX gain profile: " << block_args.get(
                            "tx_gain_profile"));
@@ -82,7 +82,10 @@ void magnesium_radio_control_impl::_init_peripherals()
         [this](uint32_t addr) { return regs().peek32(addr, get_command_time(0)); },
         n310_regs::SR_SPI,
         8,
-        n310_regs::RB_SPI);
+        n310_regs::RB_SPI,
+        [this](const std::vector<uint32_t>& addrs, const std::vector<uint32_t>& values) {
+            regs().multi_poke32(addrs, values, get_command_time(0));
+        });
     RFNOC_LOG_TRACE("Initializing CPLD...");
     RFNOC_LOG_TRACE("Creating new CPLD object...");
     spi_config_t spi_config;
@@ -138,7 +141,8 @@ void magnesium_radio_control_impl::_init_peripherals()
         usrp::gpio_atr::gpio_atr_offsets::make_default(
             n310_regs::SR_FP_GPIO,
             n310_regs::RB_FP_GPIO,
-            n310_regs::PERIPH_REG_OFFSET));
+            n310_regs::PERIPH_REG_OFFSET),
+        [this]() { return regs().get_cmd_fifo_free_slots(true); });
 }
 
 void magnesium_radio_control_impl::_init_frontend_subtree(
@@ -424,7 +428,7 @@ void magnesium_radio_control_impl::_init_prop_tree()
 
 void magnesium_radio_control_impl::_init_mpm()
 {
-    auto block_args = get_block_args();
+    const auto& block_args = get_block_args();
     RFNOC_LOG_TRACE("Instantiating AD9371 control object...");
     _ad9371 = magnesium_ad9371_iface::uptr(
         new magnesium_ad9371_iface(_rpcc, (_radio_slot == "A") ? 0 : 1));
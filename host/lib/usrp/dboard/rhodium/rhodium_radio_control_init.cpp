@@ -85,6 +85,14 @@ std::function<void(uint32_t)> _generate_write_spi(
     };
 }
 
+std::function<void(const std::vector<uint32_t>&)> _generate_write_multi_spi(
+    uhd::spi_iface::sptr spi, slave_select_t slave, spi_config_t config)
+{
+    return [spi, slave, config](const std::vector<uint32_t>& transactions) {
+        spi->multi_write_spi(slave, config, transactions, 24);
+    };
+}
+
 std::function<uint32_t(uint32_t)> _generate_read_spi(
     uhd::spi_iface::sptr spi, slave_select_t slave, spi_config_t config)
 {
@@ -121,7 +129,7 @@ void rhodium_radio_control_impl::_init_defaults()
     register_property(&_highband_spur_reduction_mode);
 
     // Update configurable block arguments from the device arguments provided
-    const auto block_args = get_block_args();
+    const auto& block_args = get_block_args();
     if (block_args.has_key(SPUR_DODGING_PROP_NAME)) {
         _spur_dodging_mode.set(block_args.get(SPUR_DODGING_PROP_NAME));
     }
@@ -145,7 +153,10 @@ void rhodium_radio_control_impl::_init_peripherals()
         [this](uint32_t addr) { return regs().peek32(addr, get_command_time(0)); },
         n320_regs::SR_SPI,
         8,
-        n320_regs::RB_SPI);
+        n320_regs::RB_SPI,
+        [this](const std::vector<uint32_t>& addrs, const std::vector<uint32_t>& values) {
+            regs().multi_poke32(addrs, values, get_command_time(0));
+        });
     _wb_iface = RFNOC_MAKE_WB_IFACE(0, 0);
 
     RFNOC_LOG_TRACE("Initializing CPLD...");
@@ -178,7 +189,8 @@ void rhodium_radio_control_impl::_init_peripherals()
     RFNOC_LOG_TRACE("Initializing TX LO...");
     _tx_lo = lmx2592_iface::make(
         _generate_write_spi(this->_spi, SEN_TX_LO, _get_tx_lo_spi_config()),
-        _generate_read_spi(this->_spi, SEN_TX_LO, _get_tx_lo_spi_config()));
+        _generate_read_spi(this->_spi, SEN_TX_LO, _get_tx_lo_spi_config()),
+        _generate_write_multi_spi(this->_spi, SEN_TX_LO, _get_tx_lo_spi_config()));
 
     RFNOC_LOG_TRACE("Writing initial TX LO state...");
     _tx_lo->set_reference_frequency(RHODIUM_LO1_REF_FREQ);
@@ -187,7 +199,8 @@ void rhodium_radio_control_impl::_init_peripherals()
     RFNOC_LOG_TRACE("Initializing RX LO...");
     _rx_lo = lmx2592_iface::make(
         _generate_write_spi(this->_spi, SEN_RX_LO, _get_rx_lo_spi_config()),
-        _generate_read_spi(this->_spi, SEN_RX_LO, _get_rx_lo_spi_config()));
+        _generate_read_spi(this->_spi, SEN_RX_LO, _get_rx_lo_spi_config()),
+        _generate_write_multi_spi(this->_spi, SEN_RX_LO, _get_rx_lo_spi_config()));
 
     RFNOC_LOG_TRACE("Writing initial RX LO state...");
     _rx_lo->set_reference_frequency(RHODIUM_LO1_REF_FREQ);
@@ -210,7 +223,8 @@ void rhodium_radio_control_impl::_init_peripherals()
         gpio_atr::gpio_atr_offsets::make_default(
             n320_regs::SR_FP_GPIO,
             n320_regs::RB_FP_GPIO,
-            n320_regs::PERIPH_REG_OFFSET));
+            n320_regs::PERIPH_REG_OFFSET),
+        [this]() { return regs().get_cmd_fifo_free_slots(true); });
 
     RFNOC_LOG_TRACE("Set initial ATR values...");
     _update_atr(RHODIUM_DEFAULT_TX_ANTENNA, TX_DIRECTION);
@@ -578,7 +592,7 @@ void rhodium_radio_control_impl::_init_prop_tree()
 
 void rhodium_radio_control_impl::_init_mpm()
 {
-    auto block_args = get_block_args();
+    const auto& block_args = get_block_args();
     if (block_args.has_key("identify")) {
         const std::string identify_val = block_args.get("identify");
         int identify_duration          = std::atoi(identify_val.c_str());
@@ -15,6 +15,7 @@
 #include <boost/format.hpp>
 #include <chrono>
 #include <cmath>
+#include <map>
 #include <thread>
 
 using namespace uhd;
@@ -570,13 +571,11 @@ public:
 
         double coerced_freq = 0.0;
         if (ch == CH1 or ch == BOTH) {
-            coerced_freq =
-                _lo1_iface[size_t(CH1)]->set_frequency(freq, TWINRX_LO1_MOD2, false);
+            coerced_freq           = _set_lo1_synth_freq(size_t(CH1), freq);
             _lo1_freq[size_t(CH1)] = tune_freq_t(freq);
         }
         if (ch == CH2 or ch == BOTH) {
-            coerced_freq =
-                _lo1_iface[size_t(CH2)]->set_frequency(freq, TWINRX_LO1_MOD2, false);
+            coerced_freq           = _set_lo1_synth_freq(size_t(CH2), freq);
             _lo1_freq[size_t(CH2)] = tune_freq_t(freq);
         }
 
@@ -585,6 +584,28 @@ public:
         return coerced_freq;
     }
 
+    void set_precomputed_lo1_freqs(const std::vector<double>& freqs) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (size_t i = 0; i < NUM_CHANS; i++) {
+            std::map<double, adf535x_iface::frequency_image_t> freq_images;
+            for (const double freq : freqs) {
+                if (!freq_images.count(freq)) {
+                    freq_images.emplace(
+                        freq, _lo1_iface[i]->get_frequency_image(freq, TWINRX_LO1_MOD2));
+                }
+            }
+            _lo1_freq_images[i].swap(freq_images);
+        }
+    }
+
+    size_t get_num_precomputed_lo1_freqs() override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _lo1_freq_images[size_t(CH1)].size();
+    }
+
     double set_lo2_synth_freq(channel_t ch, double freq, bool commit = true) override
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -729,11 +750,18 @@ private: // Functions
         _cpld_regs->if0_reg2.flush();
     }
 
-    void _write_lo_spi(dboard_iface::unit_t unit, const std::vector<uint32_t>& regs)
+    double _set_lo1_synth_freq(const size_t synth, const double freq)
     {
-        for (uint32_t reg : regs) {
-            _db_iface->write_spi(unit, _spi_config, reg, 32);
+        const auto it = _lo1_freq_images[synth].find(freq);
+        if (it != _lo1_freq_images[synth].end()) {
+            return _lo1_iface[synth]->load_frequency_image(it->second, false);
         }
+        return _lo1_iface[synth]->set_frequency(freq, TWINRX_LO1_MOD2, false);
+    }
+
+    void _write_lo_spi(dboard_iface::unit_t unit, const std::vector<uint32_t>& regs)
+    {
+        _db_iface->multi_write_spi(unit, _spi_config, regs, 32);
     }
 
     void _commit()
@@ -859,6 +887,8 @@ private: // Members
     spi_config_t _spi_config;
     double _lo1_pfd_freq;
     adf535x_iface::sptr _lo1_iface[NUM_CHANS];
+    //! Precomputed LO1 synthesizer settings, by LO1 frequency
+    std::map<double, adf535x_iface::frequency_image_t> _lo1_freq_images[NUM_CHANS];
     adf435x_iface::sptr _lo2_iface[NUM_CHANS];
     lo_source_t _lo1_src[NUM_CHANS];
     lo_source_t _lo2_src[NUM_CHANS];
@@ -12,6 +12,7 @@
 #include <uhd/types/ranges.hpp>
 #include <uhd/types/wb_iface.hpp>
 #include <uhd/utils/noncopyable.hpp>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace dboard { namespace twinrx {
 
@@ -91,6 +92,15 @@ public:
 
     virtual double set_lo2_synth_freq(channel_t ch, double freq, bool commit = true) = 0;
 
+    // Precompute the synthesizer settings for a list of LO1 frequencies, for
+    // both LO1 synthesizers. Calling set_lo1_synth_freq() with any of these
+    // frequencies then skips the synthesizer calculations. This replaces any
+    // previous list, an empty list clears it.
+    virtual void set_precomputed_lo1_freqs(const std::vector<double>& freqs) = 0;
+
+    // Returns the number of precomputed LO1 frequencies
+    virtual size_t get_num_precomputed_lo1_freqs() = 0;
+
     virtual double set_lo1_charge_pump(
         channel_t ch, double current, bool commit = true) = 0;
 
@@ -30,20 +30,39 @@ void twinrx_scheduling_expert::resolve()
     _rx_frontend_time = _command_time;
 }
 
+// Lowband/highband switch point
+static const double LB_HB_THRESHOLD_FREQ    = 1.8e9;
+static const double LB_TARGET_IF1_FREQ      = 2.345e9;
+static const double HB_TARGET_IF1_FREQ      = 1.25e9;
+static const double INJ_SIDE_THRESHOLD_FREQ = 5.1e9;
+
+static const double FIXED_LO1_THRESHOLD_FREQ = 50e6;
+
+static const uhd::freq_range_t RF_FREQ_RANGE(10e6, 6e9);
+
+double twinrx_freq_path_expert::get_lo1_freq(const double rf_freq_d)
+{
+    const rf_freq_abs_t rf_freq(RF_FREQ_RANGE.clip(rf_freq_d));
+    const double target_if1_freq =
+        (rf_freq > LB_HB_THRESHOLD_FREQ) ? HB_TARGET_IF1_FREQ : LB_TARGET_IF1_FREQ;
+
+    if (rf_freq <= FIXED_LO1_THRESHOLD_FREQ) {
+        // LO1 Freq static
+        return target_if1_freq + FIXED_LO1_THRESHOLD_FREQ;
+    } else if (rf_freq <= INJ_SIDE_THRESHOLD_FREQ) {
+        // High-side LO1 Injection
+        return rf_freq.get() + target_if1_freq;
+    }
+    // Low-side LO1 Injection
+    return rf_freq.get() - target_if1_freq;
+}
+
 /*!---------------------------------------------------------
  * twinrx_freq_path_expert::resolve
  * ---------------------------------------------------------
  */
 void twinrx_freq_path_expert::resolve()
 {
-    // Lowband/highband switch point
-    static const double LB_HB_THRESHOLD_FREQ    = 1.8e9;
-    static const double LB_TARGET_IF1_FREQ      = 2.345e9;
-    static const double HB_TARGET_IF1_FREQ      = 1.25e9;
-    static const double INJ_SIDE_THRESHOLD_FREQ = 5.1e9;
-
-    static const double FIXED_LO1_THRESHOLD_FREQ = 50e6;
-
     // Preselector filter switch point
     static const double LB_FILT1_THRESHOLD_FREQ = 0.5e9;
     static const double LB_FILT2_THRESHOLD_FREQ = 0.8e9;
@@ -60,8 +79,7 @@ void twinrx_freq_path_expert::resolve()
     static const double INST_BANDWIDTH           = 80e6;
     static const double MANUAL_LO_HYSTERESIS_PPM = 1.0;
 
-    static const freq_range_t FREQ_RANGE(10e6, 6e9);
-    rf_freq_abs_t rf_freq(FREQ_RANGE.clip(_rf_freq_d));
+    rf_freq_abs_t rf_freq(RF_FREQ_RANGE.clip(_rf_freq_d));
 
     // Choose low-band vs high-band depending on frequency
     _signal_path = (rf_freq > LB_HB_THRESHOLD_FREQ) ? twinrx_ctrl::PATH_HIGHBAND
@@ -106,17 +124,8 @@ void twinrx_freq_path_expert::resolve()
     const double target_if2_freq = _if_freq_d;
 
     // LO1
-    double lo1_freq_ideal = 0.0, lo2_freq_ideal = 0.0;
-    if (rf_freq <= FIXED_LO1_THRESHOLD_FREQ) {
-        // LO1 Freq static
-        lo1_freq_ideal = target_if1_freq + FIXED_LO1_THRESHOLD_FREQ;
-    } else if (rf_freq <= INJ_SIDE_THRESHOLD_FREQ) {
-        // High-side LO1 Injection
-        lo1_freq_ideal = rf_freq.get() + target_if1_freq;
-    } else {
-        // Low-side LO1 Injection
-        lo1_freq_ideal = rf_freq.get() - target_if1_freq;
-    }
+    const double lo1_freq_ideal = get_lo1_freq(_rf_freq_d);
+    double lo2_freq_ideal       = 0.0;
 
     if (_lo1_freq_d.get_author() == experts::AUTHOR_USER) {
         if (_lo1_freq_d.is_dirty()) { // Are we here because the LO frequency was set?
@@ -125,6 +125,9 @@ public:
         bind_accessor(_lo2_inj_side);
     }
 
+    //! Returns the LO1 frequency this expert picks for an RF frequency
+    static double get_lo1_freq(const double rf_freq);
+
 private:
     void resolve() override;
     static lo_inj_side_t _compute_lo2_inj_side(
@@ -13,6 +13,16 @@
 namespace {
 //! The time we need to wait after sending a SPI command
 const uhd::time_spec_t SPI_THROTTLE_TIME = uhd::time_spec_t(2e-6);
+
+//! Layout of the DSA registers and DSA table registers (see gen_zbx_cpld_regs.py)
+constexpr uint32_t TX_DSA_MASK   = 0x1F;
+constexpr size_t TX_DSA1_SHIFT   = 0;
+constexpr size_t TX_DSA2_SHIFT   = 8;
+constexpr uint32_t RX_DSA_MASK   = 0xF;
+constexpr size_t RX_DSA1_SHIFT   = 0;
+constexpr size_t RX_DSA2_SHIFT   = 4;
+constexpr size_t RX_DSA3_A_SHIFT = 8;
+constexpr size_t RX_DSA3_B_SHIFT = 12;
 } // namespace
 
 namespace uhd { namespace usrp { namespace zbx {
@@ -75,18 +85,21 @@ zbx_cpld_ctrl::zbx_cpld_ctrl(poke_fn_type&& poke_fn,
 
 void zbx_cpld_ctrl::set_scratch(const uint32_t value)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _regs.SCRATCH = value;
     commit(NO_CHAN);
 }
 
 uint32_t zbx_cpld_ctrl::get_scratch()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     return _peek32(_regs.get_addr("SCRATCH"));
 }
 
 void zbx_cpld_ctrl::set_atr_mode(
     const size_t channel, const atr_mode_target target, const atr_mode mode)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     if (target == atr_mode_target::DSA) {
         if (channel == 0) {
@@ -107,6 +120,7 @@ void zbx_cpld_ctrl::set_atr_mode(
 void zbx_cpld_ctrl::set_sw_config(
     const size_t channel, const atr_mode_target target, const uint8_t rf_config)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     // clang-format off
     static const std::map<std::pair<size_t, atr_mode_target>, zbx_cpld_regs_t::zbx_cpld_field_t>
@@ -124,6 +138,7 @@ void zbx_cpld_ctrl::set_sw_config(
 uint8_t zbx_cpld_ctrl::get_current_config(
     const size_t channel, const atr_mode_target target)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     const uint16_t addr       = _regs.get_addr("CURRENT_RF0_CONFIG");
     const uint32_t config_reg = _peek32(addr);
@@ -144,6 +159,7 @@ uint8_t zbx_cpld_ctrl::get_current_config(
 void zbx_cpld_ctrl::set_tx_gain_switches(
     const size_t channel, const uint8_t idx, const tx_dsa_type& dsa_steps)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
 
     UHD_LOG_TRACE(_log_id,
@@ -163,6 +179,7 @@ void zbx_cpld_ctrl::set_tx_gain_switches(
 void zbx_cpld_ctrl::set_rx_gain_switches(
     const size_t channel, const uint8_t idx, const rx_dsa_type& dsa_steps)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_LOG_TRACE(_log_id,
         "Setting RX DSA for channel "
             << channel << ": DSA1=" << dsa_steps[0] << ", DSA2=" << dsa_steps[1]
@@ -184,6 +201,7 @@ void zbx_cpld_ctrl::set_rx_gain_switches(
 void zbx_cpld_ctrl::set_rx_gain_switches(
     const size_t channel, const uint8_t idx, const uint8_t table_idx)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
     UHD_LOG_TRACE(_log_id,
         "Setting RX DSA for channel " << channel << " from table index " << table_idx);
@@ -198,6 +216,7 @@ void zbx_cpld_ctrl::set_rx_gain_switches(
 void zbx_cpld_ctrl::set_tx_gain_switches(
     const size_t channel, const uint8_t idx, const uint8_t table_idx)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
     UHD_LOG_TRACE(_log_id,
         "Setting TX DSA for channel " << channel << " from table index " << table_idx);
@@ -212,6 +231,7 @@ void zbx_cpld_ctrl::set_tx_gain_switches(
 uint8_t zbx_cpld_ctrl::set_tx_dsa(
     const size_t channel, const uint8_t idx, const dsa_type tx_dsa, const uint8_t att)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     UHD_ASSERT_THROW(tx_dsa == dsa_type::DSA1 || tx_dsa == dsa_type::DSA2);
     const uint8_t att_coerced = std::min(att, ZBX_TX_DSA_MAX_ATT);
@@ -223,6 +243,7 @@ uint8_t zbx_cpld_ctrl::set_tx_dsa(
 uint8_t zbx_cpld_ctrl::set_rx_dsa(
     const size_t channel, const uint8_t idx, const dsa_type rx_dsa, const uint8_t att)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     const uint8_t att_coerced = std::min(att, ZBX_RX_DSA_MAX_ATT);
     _regs.set_field(RX_DSA_CPLD_MAP.at(channel).at(rx_dsa), att_coerced, idx);
@@ -235,6 +256,7 @@ uint8_t zbx_cpld_ctrl::get_tx_dsa(const size_t channel,
     const dsa_type tx_dsa,
     const bool update_cache)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     UHD_ASSERT_THROW(tx_dsa == dsa_type::DSA1 || tx_dsa == dsa_type::DSA2);
     if (update_cache) {
@@ -248,6 +270,7 @@ uint8_t zbx_cpld_ctrl::get_rx_dsa(const size_t channel,
     const dsa_type rx_dsa,
     const bool update_cache)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel == 0 || channel == 1);
     if (update_cache) {
         update_field(RX_DSA_CPLD_MAP.at(channel).at(rx_dsa), idx);
@@ -258,6 +281,7 @@ uint8_t zbx_cpld_ctrl::get_rx_dsa(const size_t channel,
 void zbx_cpld_ctrl::set_tx_antenna_switches(
     const size_t channel, const uint8_t idx, const std::string& antenna, const tx_amp amp)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
     UHD_ASSERT_THROW(
         amp == tx_amp::BYPASS || amp == tx_amp::LOWBAND || amp == tx_amp::HIGHBAND);
@@ -316,6 +340,7 @@ void zbx_cpld_ctrl::set_tx_antenna_switches(
 void zbx_cpld_ctrl::set_rx_antenna_switches(
     const size_t channel, const uint8_t idx, const std::string& antenna)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
 
     // Antenna settings: RX2, TX/RX, CAL_LOOPBACK, TERMINATION
@@ -358,6 +383,7 @@ void zbx_cpld_ctrl::set_rx_antenna_switches(
 tx_amp zbx_cpld_ctrl::get_tx_amp_settings(
     const size_t channel, const uint8_t idx, const bool update_cache)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     if (channel == 0) {
         if (update_cache) {
             update_field(zbx_cpld_regs_t::zbx_cpld_field_t::TX0_ANT_10, idx);
@@ -412,6 +438,7 @@ tx_amp zbx_cpld_ctrl::get_tx_amp_settings(
 void zbx_cpld_ctrl::set_rx_rf_filter(
     const size_t channel, const uint8_t idx, const uint8_t rf_fir)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS && rf_fir < 4);
 
     if (rf_fir == 0) {
@@ -453,6 +480,7 @@ void zbx_cpld_ctrl::set_rx_rf_filter(
 void zbx_cpld_ctrl::set_rx_if1_filter(
     const size_t channel, const uint8_t idx, const uint8_t if1_fir)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS && if1_fir != 0 && if1_fir < 5);
 
     // Clang-format likes to "staircase" multiple tertiary statements, it's much
@@ -486,6 +514,7 @@ void zbx_cpld_ctrl::set_rx_if1_filter(
 void zbx_cpld_ctrl::set_rx_if2_filter(
     const size_t channel, const uint8_t idx, const uint8_t if2_fir)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS && if2_fir != 0 && if2_fir < 3);
 
     if (channel == 0) {
@@ -501,6 +530,7 @@ void zbx_cpld_ctrl::set_rx_if2_filter(
 void zbx_cpld_ctrl::set_tx_rf_filter(
     const size_t channel, const uint8_t idx, const uint8_t rf_fir)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS && rf_fir < 4);
 
     if (rf_fir == 0) {
@@ -542,6 +572,7 @@ void zbx_cpld_ctrl::set_tx_rf_filter(
 void zbx_cpld_ctrl::set_tx_if1_filter(
     const size_t channel, const uint8_t idx, const uint8_t if1_fir)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS && if1_fir != 0 && if1_fir < 7);
 
     if (if1_fir < 4) {
@@ -599,6 +630,7 @@ void zbx_cpld_ctrl::set_tx_if1_filter(
 void zbx_cpld_ctrl::set_tx_if2_filter(
     const size_t channel, const uint8_t idx, const uint8_t if2_fir)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS && if2_fir != 0 && if2_fir < 3);
 
     if (channel == 0) {
@@ -620,6 +652,7 @@ void zbx_cpld_ctrl::set_leds(const size_t channel,
     const bool trx_rx,
     const bool trx_tx)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
     if (channel == 0) {
         _regs.RX0_RX_LED[idx] = rx ? zbx_cpld_regs_t::RX0_RX_LED_ENABLE
@@ -644,6 +677,7 @@ void zbx_cpld_ctrl::set_leds(const size_t channel,
  *****************************************************************************/
 void zbx_cpld_ctrl::lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint16_t data)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _lo_spi_transact(lo, addr, data, spi_xact_t::WRITE, true);
     // We always sleep here, in the assumption that the next poke to the CPLD is
     // also a
@@ -657,6 +691,7 @@ void zbx_cpld_ctrl::lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint1
 
 uint16_t zbx_cpld_ctrl::lo_peek16(const zbx_lo_t lo, const uint8_t addr)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _lo_spi_transact(lo, addr, 0, spi_xact_t::READ, true);
     // Now poll the LO_SPI_READY register until we have good return value
     const auto timeout = std::chrono::steady_clock::now()
@@ -687,12 +722,14 @@ uint16_t zbx_cpld_ctrl::lo_peek16(const zbx_lo_t lo, const uint8_t addr)
 
 bool zbx_cpld_ctrl::lo_spi_ready()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     return _peek32(_lo_spi_offset) & (1 << 30);
 }
 
 void zbx_cpld_ctrl::set_lo_source(
     const size_t idx, const zbx_lo_t lo, const zbx_lo_source_t lo_source)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     // LO source is either internal or external
     const bool internal = lo_source == zbx_lo_source_t::internal;
     switch (lo) {
@@ -741,6 +778,7 @@ void zbx_cpld_ctrl::set_lo_source(
 
 zbx_lo_source_t zbx_cpld_ctrl::get_lo_source(const size_t idx, zbx_lo_t lo)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     switch (lo) {
         case zbx_lo_t::TX0_LO1:
             return _regs.TX0_LO_14[idx] == zbx_cpld_regs_t::TX0_LO_14_INTERNAL
@@ -781,6 +819,7 @@ zbx_lo_source_t zbx_cpld_ctrl::get_lo_source(const size_t idx, zbx_lo_t lo)
 
 void zbx_cpld_ctrl::pulse_lo_sync(const size_t ref_chan, const std::vector<zbx_lo_t>& los)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     if (_regs.BYPASS_SYNC_REGISTER == zbx_cpld_regs_t::BYPASS_SYNC_REGISTER_ENABLE) {
         const std::string err_msg = "Cannot pulse LO SYNC when bypass is enabled!";
         UHD_LOG_ERROR(_log_id, err_msg);
@@ -812,35 +851,44 @@ void zbx_cpld_ctrl::pulse_lo_sync(const size_t ref_chan, const std::vector<zbx_l
 
 void zbx_cpld_ctrl::set_lo_sync_bypass(const bool enable)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _regs.BYPASS_SYNC_REGISTER = enable ? zbx_cpld_regs_t::BYPASS_SYNC_REGISTER_ENABLE
                                         : zbx_cpld_regs_t::BYPASS_SYNC_REGISTER_DISABLE;
     commit(NO_CHAN);
 }
 
-void zbx_cpld_ctrl::update_tx_dsa_settings(
-    const std::vector<uint32_t>& dsa1_table, const std::vector<uint32_t>& dsa2_table)
+uint32_t zbx_cpld_ctrl::get_tx_dsa_reg_value(const tx_dsa_type& dsa_steps)
 {
-    write_register_vector("TX0_TABLE_DSA1", dsa1_table);
-    write_register_vector("TX0_TABLE_DSA2", dsa2_table);
-    write_register_vector("TX1_TABLE_DSA1", dsa1_table);
-    write_register_vector("TX1_TABLE_DSA2", dsa2_table);
-    commit(NO_CHAN);
+    return ((dsa_steps[0] & TX_DSA_MASK) << TX_DSA1_SHIFT)
+           | ((dsa_steps[1] & TX_DSA_MASK) << TX_DSA2_SHIFT);
 }
 
-void zbx_cpld_ctrl::update_rx_dsa_settings(const std::vector<uint32_t>& dsa1_table,
-    const std::vector<uint32_t>& dsa2_table,
-    const std::vector<uint32_t>& dsa3a_table,
-    const std::vector<uint32_t>& dsa3b_table)
+uint32_t zbx_cpld_ctrl::get_rx_dsa_reg_value(const rx_dsa_type& dsa_steps)
 {
-    write_register_vector("RX0_TABLE_DSA1", dsa1_table);
-    write_register_vector("RX0_TABLE_DSA2", dsa2_table);
-    write_register_vector("RX0_TABLE_DSA3_A", dsa3a_table);
-    write_register_vector("RX0_TABLE_DSA3_B", dsa3b_table);
-    write_register_vector("RX1_TABLE_DSA1", dsa1_table);
-    write_register_vector("RX1_TABLE_DSA2", dsa2_table);
-    write_register_vector("RX1_TABLE_DSA3_A", dsa3a_table);
-    write_register_vector("RX1_TABLE_DSA3_B", dsa3b_table);
-    commit(NO_CHAN);
+    return ((dsa_steps[0] & RX_DSA_MASK) << RX_DSA1_SHIFT)
+           | ((dsa_steps[1] & RX_DSA_MASK) << RX_DSA2_SHIFT)
+           | ((dsa_steps[2] & RX_DSA_MASK) << RX_DSA3_A_SHIFT)
+           | ((dsa_steps[3] & RX_DSA_MASK) << RX_DSA3_B_SHIFT);
+}
+
+void zbx_cpld_ctrl::write_tx_dsa_table(
+    const size_t channel, const std::vector<uint32_t>& table_regs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
+    _write_dsa_table(channel == 0 ? zbx_cpld_regs_t::zbx_cpld_field_t::TX0_TABLE_DSA1
+                                  : zbx_cpld_regs_t::zbx_cpld_field_t::TX1_TABLE_DSA1,
+        table_regs);
+}
+
+void zbx_cpld_ctrl::write_rx_dsa_table(
+    const size_t channel, const std::vector<uint32_t>& table_regs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    UHD_ASSERT_THROW(channel < ZBX_NUM_CHANS);
+    _write_dsa_table(channel == 0 ? zbx_cpld_regs_t::zbx_cpld_field_t::RX0_TABLE_DSA1
+                                  : zbx_cpld_regs_t::zbx_cpld_field_t::RX1_TABLE_DSA1,
+        table_regs);
 }
 
 /******************************************************************************
@@ -876,23 +924,19 @@ void zbx_cpld_ctrl::_lo_spi_transact(const zbx_lo_t lo,
     }
 }
 
-void zbx_cpld_ctrl::write_register_vector(
-    const std::string& reg_addr_name, const std::vector<uint32_t>& values)
+void zbx_cpld_ctrl::_write_dsa_table(const zbx_cpld_regs_t::zbx_cpld_field_t field,
+    const std::vector<uint32_t>& table_regs)
 {
-    UHD_LOG_DEBUG(
-        _log_id, "Write " << values.size() << " values to register " << reg_addr_name);
-    zbx_cpld_regs_t::zbx_cpld_field_t type = _regs.get_field_type(reg_addr_name);
-    if (values.size() > _regs.get_array_size(type)) {
-        const std::string err_msg = "Number of values passed for register vector("
-                                    + std::to_string(values.size())
-                                    + ") exceeds size of register ("
-                                    + std::to_string(_regs.get_array_size(type)) + ")";
-        UHD_LOG_ERROR(_log_id, err_msg);
-        throw uhd::runtime_error(err_msg);
-    }
-    for (size_t i = 0; i < values.size(); i++) {
-        _regs.set_field(type, values[i], i);
+    // set_reg() can only address the first 64 entries of a register array
+    UHD_ASSERT_THROW(table_regs.size() <= MAX_DSA_TABLE_WRITE_SIZE);
+    UHD_LOG_TRACE(_log_id, "Write " << table_regs.size() << " DSA table registers");
+    const uint16_t base_addr = _regs.get_addr(field);
+    for (size_t i = 0; i < table_regs.size(); i++) {
+        _regs.set_reg(static_cast<uint16_t>(base_addr + 4 * i), table_regs[i]);
     }
+    // The tables are only written outside of timed commands, see
+    // zbx_rx_programming_expert
+    commit(NO_CHAN);
 }
 
 void zbx_cpld_ctrl::commit(const chan_t chan, const bool save_all)
@@ -10,6 +10,7 @@
 #include <uhd/utils/assert_has.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhdlib/rfnoc/command_batch.hpp>
 #include <uhdlib/usrp/dboard/zbx/zbx_dboard.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <cstdlib>
@@ -81,6 +82,12 @@ zbx_dboard_impl::zbx_dboard_impl(register_iface& reg_iface,
 
     _expert_container =
         uhd::experts::expert_factory::create_container("zbx_radio_" + _radio_slot);
+    // The workers of the two channels, and of their LOs, are independent, so
+    // they are resolved in parallel. The register writes of each group of
+    // workers are batched, so they don't wait for one ACK after the other.
+    _expert_container->set_parallel_resolve(ZBX_NUM_EXPERT_THREADS,
+        &uhd::rfnoc::detail::begin_command_batch,
+        &uhd::rfnoc::detail::end_command_batch);
     _init_cpld();
     _init_peripherals();
     // Prop tree requires the initialization of certain peripherals
@@ -687,6 +694,36 @@ bool zbx_dboard_impl::_get_all_los_locked(const direction_t dir, const size_t ch
     return (!is_lo1_enabled || is_lo1_locked) && (!is_lo2_enabled || is_lo2_locked);
 }
 
+void zbx_dboard_impl::_set_precomputed_freqs(
+    const direction_t dir, const size_t chan, const std::vector<double>& freqs)
+{
+    const fs_path fe_path = _get_frontend_path(dir, chan);
+    const auto tune_table =
+        _tree->access<std::vector<zbx_tune_map_item_t>>(fe_path / "tune_table").get();
+    const freq_range_t lo_freq_range =
+        _get_quantized_lo_range(_prc_rate / ZBX_RELATIVE_LO_STEP_SIZE);
+
+    // Do the same calculations as zbx_freq_fe_expert, to find out which LO
+    // frequencies these tune frequencies will need
+    std::vector<double> lo1_freqs;
+    std::vector<double> lo2_freqs;
+    for (const double freq : freqs) {
+        const zbx_lo_freqs_t lo_freqs =
+            zbx_calc_lo_freqs(freq, tune_table, chan, lo_freq_range);
+        if (lo_freqs.lo1_enabled) {
+            lo1_freqs.push_back(lo_freqs.lo1_freq);
+        }
+        lo2_freqs.push_back(lo_freqs.lo2_freq);
+    }
+
+    _lo_ctrl_map.at(zbx_lo_ctrl::lo_string_to_enum(dir, chan, ZBX_LO1))
+        ->set_precomputed_lo_freqs(lo1_freqs);
+    _lo_ctrl_map.at(zbx_lo_ctrl::lo_string_to_enum(dir, chan, ZBX_LO2))
+        ->set_precomputed_lo_freqs(lo2_freqs);
+    RFNOC_LOG_DEBUG("Precomputed LO settings for " << freqs.size() << " " << fe_path
+                                                   << " frequencies");
+}
+
 fs_path zbx_dboard_impl::_get_frontend_path(
     const direction_t dir, const size_t chan_idx) const
 {
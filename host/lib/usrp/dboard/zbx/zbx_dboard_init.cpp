@@ -186,6 +186,13 @@ void zbx_dboard_impl::_init_prop_tree()
         _init_frontend_subtree(subtree, TX_DIRECTION, chan_idx, fe_path);
     }
 
+    // All LOs of this daughterboard are programmed by now, so they can lock at
+    // the same time instead of one after the other.
+    RFNOC_LOG_TRACE("Waiting for all LOs to lock...");
+    for (auto& lo_ctrl : _lo_ctrl_map) {
+        lo_ctrl.second->wait_for_lo_lock();
+    }
+
     // Now add the sync worker:
     expert_factory::add_worker_node<zbx_sync_expert>(_expert_container,
         _expert_container->node_retriever(),
@@ -364,7 +371,8 @@ void zbx_dboard_impl::_init_experts(uhd::property_tree::sptr subtree,
                 [this](const uhd::time_spec_t& sleep_time) { _regs.sleep(sleep_time); },
                 LMX2572_DEFAULT_FREQ,
                 _prc_rate,
-                false);
+                false,
+                false /* wait_for_lock: see _init_prop_tree() */);
             expert_factory::add_worker_node<zbx_lo_expert>(
                 expert, expert->node_retriever(), fe_path, lo_select, lo_ctrl);
             _lo_ctrl_map.insert({lo, lo_ctrl});
@@ -657,6 +665,15 @@ void zbx_dboard_impl::_init_lo_prop_tree(uhd::property_tree::sptr subtree,
         ZBX_DEFAULT_LO_SOURCE,
         AUTO_RESOLVE_ON_WRITE);
 
+    // Precomputed LO settings. Writing a list of tune frequencies here makes
+    // tuning to any of them faster. There is no initial value, because the LO
+    // controls don't exist yet.
+    subtree->create<std::vector<double>>(fe_path / "freq" / "precompute")
+        .add_coerced_subscriber(
+            [this, trx, chan_idx](const std::vector<double>& freqs) {
+                this->_set_precomputed_freqs(trx, chan_idx, freqs);
+            });
+
     // LO lock sensor
     // We can't make this its own property value because it has to have access to two
     // containers (two instances of zbx lo expert)
@@ -128,64 +128,72 @@ double _calc_ideal_if2_freq(
         tune_setting.if2_freq_max);
 }
 
-} // namespace
-
-/*!---------------------------------------------------------
- * EXPERT RESOLVE FUNCTIONS
- *
- * This sections contains all expert resolve functions.
- * These methods are triggered by any of the bound accessors becoming "dirty",
- * or changing value
- * --------------------------------------------------------
- */
-void zbx_scheduling_expert::resolve()
+//! Compile the DSA cal data of one direction to DSA table register values
+//
+// \param get_reg_value Maps the DSA settings of one gain index to a register value
+template <typename dsa_cal_type, typename reg_value_fn_type>
+zbx_dsa_table_regs_t _compile_dsa_table(
+    const dsa_cal_type& dsa_cal, reg_value_fn_type&& get_reg_value)
 {
-    // We currently have no fancy scheduling, but here is where we'd add it if
-    // we need to do that (e.g., plan out SYNC pulse timing vs. NCO timing etc.)
-    _frontend_time = _command_time;
+    zbx_dsa_table_regs_t dsa_table;
+    dsa_table.band_max_freqs = dsa_cal->get_band_max_freqs();
+    for (const double band_max_freq : dsa_table.band_max_freqs) {
+        std::vector<uint32_t> table;
+        table.reserve(dsa_cal->NUM_GAIN_STAGES);
+        for (size_t gain_idx = 0; gain_idx < dsa_cal->NUM_GAIN_STAGES; gain_idx++) {
+            table.push_back(
+                get_reg_value(dsa_cal->get_dsa_setting(band_max_freq, gain_idx)));
+        }
+        UHD_ASSERT_THROW(table.size() <= zbx_cpld_ctrl::MAX_DSA_TABLE_WRITE_SIZE);
+        dsa_table.tables.push_back(std::move(table));
+    }
+    return dsa_table;
 }
 
-void zbx_freq_fe_expert::resolve()
-{
-    const double tune_freq = ZBX_FREQ_RANGE.clip(_desired_frequency);
-    _tune_settings         = _get_tune_settings(tune_freq, _tune_table.get());
+} // namespace
 
-    // Set mixer values so the backend expert knows how to calculate final frequency
-    _lo1_inj_side = _tune_settings.lo1_inj_side;
-    _lo2_inj_side = _tune_settings.lo2_inj_side;
+zbx_lo_freqs_t zbx_calc_lo_freqs(const double freq,
+    const std::vector<zbx_tune_map_item_t>& tune_table,
+    const size_t chan,
+    const uhd::freq_range_t& lo_freq_range)
+{
+    zbx_lo_freqs_t lo_freqs;
+    lo_freqs.tune_freq     = ZBX_FREQ_RANGE.clip(freq);
+    lo_freqs.tune_settings = _get_tune_settings(lo_freqs.tune_freq, tune_table);
+    const double tune_freq = lo_freqs.tune_freq;
+    const zbx_tune_map_item_t& tune_settings = lo_freqs.tune_settings;
 
-    _is_highband = _is_band_highband(_tune_settings);
-    _lo1_enabled = !_is_highband.get();
+    lo_freqs.lo1_enabled = !_is_band_highband(tune_settings);
+    lo_freqs.lo1_freq    = 0.0;
 
     double if1_freq      = tune_freq;
-    const double lo_step = _lo_freq_range.step();
+    const double lo_step = lo_freq_range.step();
     // If we need to apply an offset to avoid injection locking, we need to
     // offset in different directions for different channels on the same zbx
-    const double lo_offset_sign = (_chan == 0) ? -1 : 1;
+    const double lo_offset_sign = (chan == 0) ? -1 : 1;
     // In high band, LO1 is not needed (the signal is already at a high enough
     // frequency for the second stage)
-    if (_lo1_enabled) {
+    if (lo_freqs.lo1_enabled) {
         // Calculate the ideal IF1:
-        if1_freq = _calc_if1_freq(tune_freq, _tune_settings);
+        if1_freq = _calc_if1_freq(tune_freq, tune_settings);
         // We calculate the LO1 frequency by first shifting the tune frequency to the
         // desired IF, and then applying an offset such that CH0 and CH1 tune to distinct
         // LO1 frequencies: This is done to prevent the LO's from interfering with each
         // other in a phenomenon known as injection locking.
-        const double lo1_freq = if1_freq - (_tune_settings.lo1_inj_side * tune_freq)
+        const double lo1_freq = if1_freq - (tune_settings.lo1_inj_side * tune_freq)
                                 + (lo_offset_sign * lo_step);
         // Now, quantize the LO frequency to the nearest valid value:
-        _desired_lo1_frequency = _lo_freq_range.clip(lo1_freq, true);
+        lo_freqs.lo1_freq = lo_freq_range.clip(lo1_freq, true);
         // Because LO1 frequency probably changed during quantization, we simply
         // re-calculate the now-valid IF1 (the following equation is the same as
         // the LO1 frequency calculation, but solved for if1_freq):
-        if1_freq = _desired_lo1_frequency + (_tune_settings.lo1_inj_side * tune_freq);
+        if1_freq = lo_freqs.lo1_freq + (tune_settings.lo1_inj_side * tune_freq);
     }
 
-    _lo2_enabled = true;
     // Calculate ideal IF2 frequency:
-    const double if2_freq = _calc_ideal_if2_freq(tune_freq, _tune_settings);
+    const double if2_freq = _calc_ideal_if2_freq(tune_freq, tune_settings);
     // Calculate LO2 frequency from that:
-    _desired_lo2_frequency = _calc_lo2_freq(if1_freq, if2_freq, _lo2_inj_side);
+    double lo2_freq = _calc_lo2_freq(if1_freq, if2_freq, tune_settings.lo2_inj_side);
     // Similar to LO1, apply an offset such that CH0 and CH1 tune to distinct LO2
     // frequencies to prevent potential interference between CH0 and CH1 LO2's from
     // injection locking: In highband (LO1 disabled), this must explicitly be done below.
@@ -195,13 +203,73 @@ void zbx_freq_fe_expert::resolve()
     // CH1; however, they will be offset in opposite direction such that the NCO frequency
     // will be the same between CH0 and CH1. This is not the case for highband (only LO2
     // and they must be offset).
-    if (!_lo1_enabled) {
-        _desired_lo2_frequency = _desired_lo2_frequency + (lo_offset_sign * lo_step);
+    if (!lo_freqs.lo1_enabled) {
+        lo2_freq = lo2_freq + (lo_offset_sign * lo_step);
     }
     // Now, quantize the LO frequency to the nearest valid value:
-    _desired_lo2_frequency = _lo_freq_range.clip(_desired_lo2_frequency, true);
+    lo_freqs.lo2_freq = lo_freq_range.clip(lo2_freq, true);
     // Calculate actual IF2 frequency from LO2 and IF1 frequencies:
-    _desired_if2_frequency = _calc_if2_freq(if1_freq, _desired_lo2_frequency);
+    lo_freqs.if2_freq = _calc_if2_freq(if1_freq, lo_freqs.lo2_freq);
+    return lo_freqs;
+}
+
+size_t zbx_dsa_table_regs_t::get_band_index(const double freq) const
+{
+    // Like the cal data, compare integer frequencies
+    const double freq_hz  = static_cast<double>(static_cast<uint64_t>(freq));
+    const size_t band_idx = uhd::math::lower_bound_index(band_max_freqs, freq_hz);
+    if (band_idx == band_max_freqs.size()) {
+        throw uhd::value_error("No DSA band found for freq " + std::to_string(freq));
+    }
+    return band_idx;
+}
+
+zbx_dsa_table_regs_t zbx_dsa_table_regs_t::compile(
+    uhd::usrp::cal::zbx_tx_dsa_cal::sptr dsa_cal)
+{
+    return _compile_dsa_table(dsa_cal, &zbx_cpld_ctrl::get_tx_dsa_reg_value);
+}
+
+zbx_dsa_table_regs_t zbx_dsa_table_regs_t::compile(
+    uhd::usrp::cal::zbx_rx_dsa_cal::sptr dsa_cal)
+{
+    return _compile_dsa_table(dsa_cal, &zbx_cpld_ctrl::get_rx_dsa_reg_value);
+}
+
+/*!---------------------------------------------------------
+ * EXPERT RESOLVE FUNCTIONS
+ *
+ * This sections contains all expert resolve functions.
+ * These methods are triggered by any of the bound accessors becoming "dirty",
+ * or changing value
+ * --------------------------------------------------------
+ */
+void zbx_scheduling_expert::resolve()
+{
+    // We currently have no fancy scheduling, but here is where we'd add it if
+    // we need to do that (e.g., plan out SYNC pulse timing vs. NCO timing etc.)
+    _frontend_time = _command_time;
+}
+
+void zbx_freq_fe_expert::resolve()
+{
+    const zbx_lo_freqs_t lo_freqs =
+        zbx_calc_lo_freqs(_desired_frequency, _tune_table.get(), _chan, _lo_freq_range);
+    _tune_settings = lo_freqs.tune_settings;
+
+    // Set mixer values so the backend expert knows how to calculate final frequency
+    _lo1_inj_side = _tune_settings.lo1_inj_side;
+    _lo2_inj_side = _tune_settings.lo2_inj_side;
+
+    _is_highband = _is_band_highband(_tune_settings);
+    _lo1_enabled = lo_freqs.lo1_enabled;
+    if (lo_freqs.lo1_enabled) {
+        _desired_lo1_frequency = lo_freqs.lo1_freq;
+    }
+
+    _lo2_enabled           = true;
+    _desired_lo2_frequency = lo_freqs.lo2_freq;
+    _desired_if2_frequency = lo_freqs.if2_freq;
 
     // If the frequency is in a different tuning band, we need to switch filters
     _rf_filter  = _tune_settings.rf_fltr;
@@ -343,20 +411,22 @@ void zbx_tx_programming_expert::resolve()
         _cpld->set_tx_gain_switches(_chan, ATR_ADDR_XX, dsa_settings);
     }
 
-    // If frequency changed, we might have changed bands and the CPLD dsa tables need to
-    // be reloaded
-    // TODO: This is a major hack, and these tables should be loaded outside of the
-    // tuning call.  This means every tuning request involves a large amount of CPLD
-    // writes.
+    // If frequency changed, we might have changed bands and the CPLD dsa table needs to
+    // be reloaded. The tables were compiled when this expert was created, so a band
+    // change writes the precompiled values, and a retune within the band writes
+    // nothing.
     // We only write when we aren't using a command time, otherwise all those CPLD
     // commands will line up in the CPLD command queue, and diminish any purpose
     // of timed commands in the first place
     // Clip _frequency to valid ZBX range to avoid errors in the scenario when user
     // manually configures LO frequencies and causes an illegal overall frequency
     if (_command_time == 0.0) {
-        _cpld->update_tx_dsa_settings(
-            _dsa_cal->get_band_settings(ZBX_FREQ_RANGE.clip(_frequency), 0 /*dsa1*/),
-            _dsa_cal->get_band_settings(ZBX_FREQ_RANGE.clip(_frequency), 1 /*dsa2*/));
+        const size_t band_idx =
+            _dsa_table.get_band_index(ZBX_FREQ_RANGE.clip(_frequency));
+        if (band_idx != _dsa_table_band) {
+            _cpld->write_tx_dsa_table(_chan, _dsa_table.tables[band_idx]);
+            _dsa_table_band = band_idx;
+        }
     }
 
     for (const size_t idx : ATR_ADDRS) {
@@ -415,22 +485,15 @@ void zbx_rx_programming_expert::resolve()
     }
 
 
-    // If frequency changed, we might have changed bands and the CPLD dsa tables need to
-    // be reloaded
-    // TODO: This is a major hack, and these tables should be loaded outside of the
-    // tuning call.  This means every tuning request involves a large amount of CPLD
-    // writes.
-    // We only write when we aren't using a command time, otherwise all those CPLD
-    // commands will line up in the CPLD command queue, and diminish any purpose
-    // of timed commands in the first place
-    // Clip _frequency to valid ZBX range to avoid errors in the scenario when user
-    // manually configures LO frequencies and causes an illegal overall frequency
+    // If frequency changed, we might have changed bands and the CPLD dsa table needs to
+    // be reloaded (see zbx_tx_programming_expert::resolve())
     if (_command_time == 0.0) {
-        _cpld->update_rx_dsa_settings(
-            _dsa_cal->get_band_settings(ZBX_FREQ_RANGE.clip(_frequency), 0 /*dsa1*/),
-            _dsa_cal->get_band_settings(ZBX_FREQ_RANGE.clip(_frequency), 1 /*dsa2*/),
-            _dsa_cal->get_band_settings(ZBX_FREQ_RANGE.clip(_frequency), 2 /*dsa3a*/),
-            _dsa_cal->get_band_settings(ZBX_FREQ_RANGE.clip(_frequency), 3 /*dsa3b*/));
+        const size_t band_idx =
+            _dsa_table.get_band_index(ZBX_FREQ_RANGE.clip(_frequency));
+        if (band_idx != _dsa_table_band) {
+            _cpld->write_rx_dsa_table(_chan, _dsa_table.tables[band_idx]);
+            _dsa_table_band = band_idx;
+        }
     }
 
     for (const size_t idx : ATR_ADDRS) {
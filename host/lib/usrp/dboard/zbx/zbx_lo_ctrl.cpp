@@ -17,7 +17,8 @@ zbx_lo_ctrl::zbx_lo_ctrl(zbx_lo_t lo,
     lmx2572_iface::sleep_fn_t&& sleep,
     const double default_frequency,
     const double db_prc_rate,
-    const bool testing_mode_enabled)
+    const bool testing_mode_enabled,
+    const bool wait_for_lock)
     : _log_id(ZBX_LO_LOG_ID.at(lo))
     , _freq(default_frequency)
     , _db_prc_rate(db_prc_rate)
@@ -33,17 +34,31 @@ zbx_lo_ctrl::zbx_lo_ctrl(zbx_lo_t lo,
     // to not do so, but we gain nothing by doing that.
     _lmx->set_sync_mode(true);
     set_lo_freq(LMX2572_DEFAULT_FREQ);
-    wait_for_lo_lock();
+    if (wait_for_lock) {
+        wait_for_lo_lock();
+    }
 }
 
 double zbx_lo_ctrl::set_lo_freq(const double freq)
 {
     UHD_ASSERT_THROW(_lmx);
-    UHD_LOG_TRACE(_log_id, "Setting LO frequency " << freq / 1e6 << " MHz");
-
-    _freq = _lmx->set_frequency(freq,
-        _db_prc_rate,
-        false /*TODO: get_spur_dodging()*/);
+    auto image_it = _freq_images.find(freq);
+    if (image_it != _freq_images.end()) {
+        UHD_LOG_TRACE(
+            _log_id, "Setting precomputed LO frequency " << freq / 1e6 << " MHz");
+        freq_image_t& freq_image = image_it->second;
+        if (freq_image.port_enabled != _port_enabled
+            || freq_image.testing_mode_enabled != _testing_mode_enabled) {
+            freq_image = _compute_freq_image(freq);
+        }
+        _lmx->load_frequency_image(freq_image.image);
+        _freq = freq_image.image.freq;
+    } else {
+        UHD_LOG_TRACE(_log_id, "Setting LO frequency " << freq / 1e6 << " MHz");
+        _freq = _lmx->set_frequency(freq,
+            _db_prc_rate,
+            false /*TODO: get_spur_dodging()*/);
+    }
     _lmx->commit();
     return _freq;
 }
@@ -53,6 +68,24 @@ double zbx_lo_ctrl::get_lo_freq()
     return _freq;
 }
 
+void zbx_lo_ctrl::set_precomputed_lo_freqs(const std::vector<double>& freqs)
+{
+    UHD_ASSERT_THROW(_lmx);
+    std::map<double, freq_image_t> freq_images;
+    for (const double freq : freqs) {
+        if (!freq_images.count(freq)) {
+            freq_images.emplace(freq, _compute_freq_image(freq));
+        }
+    }
+    _freq_images.swap(freq_images);
+    UHD_LOG_DEBUG(_log_id, "Precomputed " << _freq_images.size() << " LO frequencies");
+}
+
+size_t zbx_lo_ctrl::get_num_precomputed_lo_freqs()
+{
+    return _freq_images.size();
+}
+
 void zbx_lo_ctrl::wait_for_lo_lock()
 {
     UHD_LOG_TRACE(_log_id, "Waiting for LO lock,  " << ZBX_LO_LOCK_TIMEOUT_MS << " ms");
@@ -74,6 +107,7 @@ bool zbx_lo_ctrl::get_lock_status()
 
 void zbx_lo_ctrl::set_lo_port_enabled(bool enable)
 {
+    _port_enabled = enable;
     UHD_LOG_TRACE(_log_id,
         "Enabling LO " << (_testing_mode_enabled ? "test" : "output") << " port");
 
@@ -145,6 +179,14 @@ zbx_lo_t zbx_lo_ctrl::lo_string_to_enum(
     UHD_THROW_INVALID_CODE_PATH();
 }
 
+zbx_lo_ctrl::freq_image_t zbx_lo_ctrl::_compute_freq_image(const double freq)
+{
+    return {_lmx->get_frequency_image(
+                freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/),
+        _port_enabled,
+        _testing_mode_enabled};
+}
+
 lmx2572_iface::output_t zbx_lo_ctrl::_get_output_port(bool testing_mode)
 {
     // Note: The LO output ports here are dependent to the LO and zbx hardware
@@ -30,3 +30,13 @@ void dboard_iface::sleep(const std::chrono::nanoseconds& time)
         }
     }
 }
+
+void dboard_iface::multi_write_spi(unit_t unit,
+    const spi_config_t& config,
+    const std::vector<uint32_t>& data,
+    size_t num_bits)
+{
+    for (const uint32_t word : data) {
+        write_spi(unit, config, word, num_bits);
+    }
+}
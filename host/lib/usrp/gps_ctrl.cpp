@@ -16,7 +16,9 @@
 #include <boost/format.hpp>
 #include <boost/thread/thread_time.hpp>
 #include <boost/tokenizer.hpp>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <mutex>
 #include <regex>
@@ -35,6 +37,9 @@ constexpr int GPS_SERVO_FRESHNESS       = 1000;
 constexpr int GPS_LOCK_FRESHNESS        = 2500;
 constexpr int GPS_TIMEOUT_DELAY_MS      = 200;
 constexpr int GPSDO_COMMAND_DELAY_MS    = 200;
+//! Interval at which the background reader drains the UART. Some UARTs busy-poll
+// the device while reading, so it does not block in read_uart().
+constexpr int GPS_READER_PERIOD_MS = 50;
 } // namespace
 
 /*!
@@ -49,63 +54,48 @@ gps_ctrl::~gps_ctrl(void)
 class gps_ctrl_impl : public gps_ctrl
 {
 private:
-    std::map<std::string, std::tuple<std::string, boost::system_time, bool>> sentences;
+    using clock_t = std::chrono::steady_clock;
+
+    //! The latest sentence of each type, when it was received, and whether it
+    // was handed out already. Filled by the background reader.
+    std::map<std::string, std::tuple<std::string, clock_t::time_point, bool>> sentences;
     std::mutex cache_mutex;
-    boost::system_time _last_cache_update;
+    //! Notified whenever the reader stored new sentences
+    std::condition_variable cache_cond;
+    clock_t::time_point _last_sentence_time;
+
+    std::thread _reader_thread;
+    std::atomic<bool> _reader_running{false};
 
     std::string get_sentence(const std::string which,
         const int max_age_ms,
         const int timeout,
         const bool wait_for_next = false)
     {
-        std::string sentence;
-        boost::system_time now       = boost::get_system_time();
-        boost::system_time exit_time = now + milliseconds(timeout);
-        boost::posix_time::time_duration age;
+        const auto exit_time = clock_t::now() + std::chrono::milliseconds(timeout);
+        const auto max_age   = std::chrono::milliseconds(max_age_ms);
 
-        if (wait_for_next) {
-            std::lock_guard<std::mutex> lock(cache_mutex);
-            update_cache();
+        // The background reader keeps the cache up to date, so this only waits
+        // if the sentence is missing or stale, or the next one was requested
+        std::unique_lock<std::mutex> lock(cache_mutex);
+        if (wait_for_next and sentences.find(which) != sentences.end()) {
             // mark sentence as touched
-            if (sentences.find(which) != sentences.end())
-                std::get<2>(sentences[which]) = true;
+            std::get<2>(sentences[which]) = true;
         }
-        while (1) {
-            try {
-                std::lock_guard<std::mutex> lock(cache_mutex);
-
-                // update cache if older than a millisecond
-                if (now - _last_cache_update > milliseconds(1)) {
-                    update_cache();
-                }
-
-                if (sentences.find(which) == sentences.end()) {
-                    age = milliseconds(max_age_ms);
-                } else {
-                    age = boost::get_system_time() - std::get<1>(sentences[which]);
-                }
-                if (age < milliseconds(max_age_ms)
-                    and (not(wait_for_next and std::get<2>(sentences[which])))) {
-                    sentence                      = std::get<0>(sentences[which]);
-                    std::get<2>(sentences[which]) = true;
-                }
-            } catch (std::exception& e) {
-                UHD_LOGGER_DEBUG("GPS") << "get_sentence: " << e.what();
+        while (true) {
+            auto it = sentences.find(which);
+            if (it != sentences.end()
+                and clock_t::now() - std::get<1>(it->second) < max_age
+                and not(wait_for_next and std::get<2>(it->second))) {
+                std::get<2>(it->second) = true;
+                return std::get<0>(it->second);
             }
-
-            if (not sentence.empty() or now > exit_time) {
+            if (cache_cond.wait_until(lock, exit_time) == std::cv_status::timeout) {
                 break;
             }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            now = boost::get_system_time();
         }
 
-        if (sentence.empty()) {
-            throw uhd::value_error("gps ctrl: No " + which + " message found");
-        }
-
-        return sentence;
+        throw uhd::value_error("gps ctrl: No " + which + " message found");
     }
 
     static bool is_nmea_checksum_ok(std::string nmea)
@@ -170,16 +160,35 @@ private:
             }
         }
 
-        boost::system_time time = boost::get_system_time();
+        if (msgs.empty()) {
+            return;
+        }
+        const auto time = clock_t::now();
 
         // Update sentences with newly read data
-        for (std::string key : keys) {
-            if (not msgs[key].empty()) {
-                sentences[key] = std::make_tuple(msgs[key], time, false);
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            for (std::string key : keys) {
+                if (not msgs[key].empty()) {
+                    sentences[key] = std::make_tuple(msgs[key], time, false);
+                }
             }
+            _last_sentence_time = time;
         }
+        cache_cond.notify_all();
+    }
 
-        _last_cache_update = time;
+    //! Drain the UART into the cache until the destructor stops it
+    void reader_loop()
+    {
+        while (_reader_running) {
+            try {
+                update_cache();
+            } catch (const std::exception& e) {
+                UHD_LOGGER_DEBUG("GPS") << "NMEA reader: " << e.what();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(GPS_READER_PERIOD_MS));
+        }
     }
 
 public:
@@ -245,20 +254,27 @@ public:
                 break;
         }
 
-        // initialize cache
+        // initialize cache, and keep it up to date from now on
         update_cache();
+        if (gps_detected()) {
+            _reader_running = true;
+            _reader_thread  = std::thread([this]() { reader_loop(); });
+        }
     }
 
     ~gps_ctrl_impl(void) override
     {
-        /* NOP */
+        _reader_running = false;
+        if (_reader_thread.joinable()) {
+            _reader_thread.join();
+        }
     }
 
     // return a list of supported sensors
     std::vector<std::string> get_sensors(void) override
     {
         std::vector<std::string> ret{
-            "gps_gpgga", "gps_gprmc", "gps_time", "gps_locked", "gps_servo"};
+            "gps_gpgga", "gps_gprmc", "gps_time", "gps_locked", "gps_servo", "gps_age"};
         return ret;
     }
 
@@ -280,6 +296,8 @@ public:
                     GPS_SERVO_FRESHNESS,
                     GPS_TIMEOUT_DELAY_MS),
                 "");
+        } else if (key == "gps_age") {
+            return sensor_value_t("GPS data age", get_age(), "s");
         } else {
             throw uhd::value_error("gps ctrl get_sensor unknown key: " + key);
         }
@@ -374,6 +392,17 @@ private:
         return (_gps_type != GPS_TYPE_NONE);
     }
 
+    //! Return the time since the last valid sentence was received, in seconds
+    double get_age(void)
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (sentences.empty()) {
+            throw uhd::value_error("gps ctrl: No message received yet");
+        }
+        return std::chrono::duration<double>(clock_t::now() - _last_sentence_time)
+            .count();
+    }
+
     bool locked(void)
     {
         int error_cnt = 0;
@@ -24,6 +24,7 @@
 #include <boost/filesystem/convenience.hpp>
 #include <boost/optional.hpp>
 #include <boost/property_tree/xml_parser.hpp>
+#include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <iterator>
@@ -296,7 +297,34 @@ static uhd::usrp::component_files_t bin_dts_to_component_files(
     return all_component_files;
 }
 
-static void mpmd_send_fpga_to_device(
+/*! Return true if the device reports that the FPGA image in \p component_files
+ * is loaded already
+ *
+ * MPM records the MD5 hash of the last FPGA image it loaded, so this requires
+ * a hash file next to the image file.
+ */
+static bool mpmd_fpga_is_loaded(const uhd::usrp::component_files_t& component_files,
+    uhd::property_tree::sptr tree)
+{
+    const auto fpga_component = std::find_if(component_files.cbegin(),
+        component_files.cend(),
+        [](const uhd::usrp::component_file_t& component) {
+            return component.metadata.get("id", "") == "fpga";
+        });
+    if (fpga_component == component_files.cend()
+        or not fpga_component->metadata.has_key("md5")
+        or not tree->exists("/mboards/0/components/fpga")) {
+        return false;
+    }
+    const auto loaded_metadata =
+        tree->access<uhd::usrp::component_files_t>("/mboards/0/components/fpga")
+            .get()[0]
+            .metadata;
+    return loaded_metadata.get("md5", "") == fpga_component->metadata.get("md5");
+}
+
+//! Send the FPGA image to the device. Returns false if it was skipped.
+static bool mpmd_send_fpga_to_device(
     const image_loader::image_loader_args_t& image_loader_args, device_addr_t dev_addr)
 {
     // Skip initializing the device
@@ -343,6 +371,14 @@ static void mpmd_send_fpga_to_device(
         } else {
             all_component_files = bin_dts_to_component_files(fpga_path, delay_reload);
         }
+
+        if (image_loader_args.skip_if_loaded and not delay_reload
+            and mpmd_fpga_is_loaded(all_component_files, tree)) {
+            UHD_LOG_INFO("MPMD IMAGE LOADER",
+                "The FPGA image " << fpga_path
+                                  << " is loaded already. Skipping the update.");
+            return false;
+        }
     }
 
     // Call RPC to update the component
@@ -350,6 +386,7 @@ static void mpmd_send_fpga_to_device(
     tree->access<uhd::usrp::component_files_t>("/mboards/0/components/fpga")
         .set(all_component_files);
     UHD_LOG_INFO("MPMD IMAGE LOADER", "Update component function succeeded.");
+    return true;
 }
 
 /*
@@ -369,7 +406,9 @@ static bool mpmd_image_loader(const image_loader::image_loader_args_t& image_loa
     // Grab the first device_addr
     device_addr_t dev_addr(devs[0]);
 
-    mpmd_send_fpga_to_device(image_loader_args, dev_addr);
+    if (not mpmd_send_fpga_to_device(image_loader_args, dev_addr)) {
+        return true;
+    }
 
     {
         // All MPM devices use RFNoC
@@ -13,6 +13,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/thread.hpp>
 #include <chrono>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -130,6 +131,61 @@ void assert_compat_number_throw(const std::string& component,
         UHD_LOG_WARNING("MPMD", err_msg);
     }
 }
+
+/*! Run a task for every motherboard and wait for all of them to finish.
+ *
+ * The tasks run in parallel, unless \p serialize is set. Even if a task fails,
+ * all others are still run to completion, so that every failing device is
+ * reported.
+ *
+ * \param num_mboards Number of motherboards
+ * \param serialize Run the tasks one after another, in order
+ * \param action Description of the task, for error messages
+ * \param task The task, gets called with the motherboard index
+ * \throws the exception of the failing task if only one failed, or a
+ *         uhd::runtime_error listing all failures if there were several
+ */
+void for_each_mboard(const size_t num_mboards,
+    const bool serialize,
+    const std::string& action,
+    const std::function<void(const size_t)>& task)
+{
+    // If we don't force async, most compilers will default to deferred
+    const auto launch_policy = serialize ? std::launch::deferred : std::launch::async;
+    std::vector<std::future<void>> task_list;
+    task_list.reserve(num_mboards);
+    for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
+        task_list.push_back(std::async(launch_policy, task, mb_i));
+    }
+
+    std::exception_ptr first_error;
+    std::vector<std::string> errors;
+    for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
+        std::string error;
+        try {
+            task_list[mb_i].get();
+            continue;
+        } catch (const std::exception& ex) {
+            error       = ex.what();
+            first_error = first_error ? first_error : std::current_exception();
+        } catch (...) {
+            error       = "Unknown exception";
+            first_error = first_error ? first_error : std::current_exception();
+        }
+        UHD_LOG_ERROR(
+            "MPMD", "Failed to " << action << " mboard " << mb_i << ": " << error);
+        errors.push_back("mboard " + std::to_string(mb_i) + ": " + error);
+    }
+
+    if (errors.size() == 1) {
+        std::rethrow_exception(first_error);
+    }
+    if (!errors.empty()) {
+        throw uhd::runtime_error(str(boost::format("Failed to %s %d of %d mboards (%s)")
+                                     % action % errors.size() % num_mboards
+                                     % boost::algorithm::join(errors, "; ")));
+    }
+}
 } // namespace
 
 /*****************************************************************************
@@ -156,7 +212,7 @@ mpmd_impl::mpmd_impl(const device_addr_t& device_args)
         mb_args.push_back(prefs::get_usrp_args(mb_args_without_prefs[i]));
     }
     const size_t num_mboards = mb_args.size();
-    _mb.reserve(num_mboards);
+    _mb.resize(num_mboards);
     const bool serialize_init = device_args.cast<bool>("serialize_init", false);
     const bool skip_init      = device_args.cast<bool>("skip_init", false);
     UHD_LOGGER_INFO("MPMD") << "Initializing " << num_mboards << " device(s) "
@@ -164,20 +220,25 @@ mpmd_impl::mpmd_impl(const device_addr_t& device_args)
                             << "with args: " << device_args.to_string();
 
     // First, claim all the devices (so we own them and no one else can claim
-    // them).
-    // This can be parallelized as long as uptrs are stored in the right spot;
-    // they need to be correctly indexed.
-    for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
+    // them). Every task only writes its own slot in _mb, so this can run in
+    // parallel. If any claim fails, the devices that were claimed get
+    // released again when _mb is destroyed.
+    for_each_mboard(num_mboards, serialize_init, "claim", [&](const size_t mb_i) {
         UHD_LOG_DEBUG("MPMD", "Claiming mboard " << mb_i);
-        _mb.push_back(claim_and_make(mb_args[mb_i]));
-    }
+        _mb[mb_i] = claim_and_make(mb_args[mb_i]);
+    });
 
     if (not skip_init) {
-        // Run the actual device initialization. This can run in parallel.
+        // Run the actual device initialization, including the link setup.
+        // Note: This is the only place we do compat number checks. They're
+        // effectively disabled for skip_init=1
+        for_each_mboard(num_mboards,
+            serialize_init,
+            "initialize",
+            [&](const size_t mb_i) { setup_mb(_mb[mb_i].get(), mb_i); });
+        // The controller registry is not thread-safe, so this runs afterwards
         for (size_t mb_i = 0; mb_i < num_mboards; ++mb_i) {
-            // Note: This is the only place we do compat number checks. They're
-            // effectively disabled for skip_init=1
-            setup_mb(_mb[mb_i].get(), mb_i);
+            register_mb_controller(mb_i, _mb[mb_i]->mb_ctrl);
         }
     } else {
         UHD_LOG_DEBUG("MPMD", "Claimed device, but skipped init.");
@@ -242,13 +303,12 @@ void mpmd_impl::setup_mb(mpmd_mboard_impl* mb, const size_t mb_index)
 {
     assert_compat_number_throw("MPM",
         MPM_COMPAT_NUM,
-        mb->rpc->request<std::vector<size_t>>("get_mpm_compat_num"),
+        mb->mpm_compat_num,
         "Please update the version of MPM on your USRP device.");
 
     UHD_LOG_DEBUG("MPMD", "Initializing mboard " << mb_index);
     mb->init();
     UHD_ASSERT_THROW(mb->mb_ctrl);
-    register_mb_controller(mb_index, mb->mb_ctrl);
 }
 
 /*****************************************************************************
@@ -97,6 +97,15 @@ public:
     // to be populated at all.
     std::vector<uhd::device_addr_t> dboard_info;
 
+    //! MPM compat number (major, minor), read back via MPM and stored here
+    std::vector<size_t> mpm_compat_num;
+
+    //! True if MPM can run a uhd::rpc_batch in a single request
+    bool has_batch_rpc = false;
+
+    //! True if MPM serves a snapshot of all motherboard sensors
+    bool has_sensor_snapshot_rpc = false;
+
     //! Reference to this motherboards mb_iface
     std::unique_ptr<mpmd_mb_iface> mb_iface;
 
@@ -256,9 +265,11 @@ private:
      * This is where mpmd_mboard_impl::init() is called.
      * Also assigns the local crossbar addresses.
      *
+     * This may be called for several motherboards at the same time. It does
+     * not register the motherboard controller, the caller must do that.
+     *
      * \param mb Reference to the mboard class
      * \param mb_index Index number of the mboard that's being initialized
-     * \param device_args Device args
      *
      */
     void setup_mb(mpmd_mboard_impl* mb, const size_t mb_index);
@@ -16,11 +16,16 @@
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <chrono>
+#include <cstring>
 #include <string>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_AF_XDP
+#    include <uhdlib/transport/udp_af_xdp_link.hpp>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -44,12 +49,22 @@ const size_t MPMD_1GE_DATA_FRAME_MAX_SIZE = 1500;
 //! Number of send/recv frames
 const size_t MPMD_ETH_NUM_FRAMES = 32;
 
+//! Number of frames per receive call on the internal interface of embedded
+// devices, when the host runs on the device itself. The DMA engine behind it
+// delivers packets in bursts, and on the ARM cores, one system call per packet
+// costs more than the streamer spends on the packet.
+const size_t MPMD_INTERNAL_RECV_BATCH_SIZE = 16;
+
 //! Buffer depth in seconds. We use the link rate to determine how large buffers
 // must be to store this many seconds worth of data.
 const double MPMD_BUFFER_DEPTH = 20.0e-3; // s
 //! For MTU discovery, the time we wait for a packet before calling it
 // oversized (seconds).
 const double MPMD_MTU_DISCOVERY_TIMEOUT = 0.02;
+//! For the round trip time measurement, the number of packets we send, and
+// the time we wait for each of them (seconds)
+const size_t MPMD_RTT_NUM_PINGS = 8;
+const double MPMD_RTT_TIMEOUT   = 0.1;
 
 // TODO: move these to appropriate header file for all other devices
 const size_t MAX_RATE_1GIGE  = 1e9 / 8; // byte/s
@@ -278,6 +293,83 @@ size_t discover_mtu(const std::string& address,
     return min_frame_size;
 }
 
+/*! Measure the round trip time to the device
+ *
+ * Uses the MPM echo service, like discover_mtu(). The result is the longest
+ * of a few round trips, so the jitter is covered, too. This includes the
+ * time MPM takes to answer, so it errs on the large side.
+ *
+ * \param address IP address
+ * \param port UDP port of the MPM discovery service
+ * \return The round trip time in seconds, or zero if the device didn't answer
+ */
+double measure_rtt(
+    const std::string& address, const std::string& port, const bool use_dpdk)
+{
+    using namespace uhd::transport;
+    udp_simple::sptr udp;
+#ifdef HAVE_DPDK
+    if (use_dpdk) {
+        udp = dpdk_simple::make_broadcast(address, port);
+    }
+#else
+    (void)use_dpdk;
+#endif
+    if (!udp) {
+        udp = udp_simple::make_broadcast(address, port);
+    }
+
+    constexpr size_t ping_size      = 64;
+    const size_t echo_prefix_offset = uhd::mpmd::mpmd_impl::MPM_ECHO_CMD.size();
+    std::string send_buf(uhd::mpmd::mpmd_impl::MPM_ECHO_CMD);
+    send_buf.resize(ping_size, '#');
+    std::vector<uint8_t> recv_buf(ping_size);
+
+    double rtt = 0.0;
+    for (size_t seq_no = 0; seq_no < MPMD_RTT_NUM_PINGS; seq_no++) {
+        // The sequence number tells late answers to earlier pings apart
+        std::snprintf(&send_buf[echo_prefix_offset], 6, ";%04lu", seq_no);
+        send_buf[echo_prefix_offset + 5] = '#';
+        const auto start = std::chrono::steady_clock::now();
+        udp->send(boost::asio::buffer(send_buf));
+        const size_t len = udp->recv(boost::asio::buffer(recv_buf), MPMD_RTT_TIMEOUT);
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (len >= echo_prefix_offset + 5
+            && std::memcmp(recv_buf.data(), send_buf.data(), echo_prefix_offset + 5)
+                   == 0) {
+            rtt = std::max(rtt, elapsed.count());
+        }
+    }
+    return rtt;
+}
+
+/*! Parse the af_xdp_queues device arg
+ *
+ * The queues are given as a single queue ("4") or an inclusive range
+ * ("4-7"). Returns an empty list if the argument is missing or malformed.
+ */
+std::vector<uint32_t> get_af_xdp_queues(const uhd::device_addr_t& mb_args)
+{
+    const std::string queues_str = mb_args.get("af_xdp_queues", "");
+    std::vector<uint32_t> queues;
+    try {
+        const size_t dash    = queues_str.find('-');
+        const uint32_t first = std::stoul(queues_str.substr(0, dash));
+        const uint32_t last =
+            (dash == std::string::npos) ? first : std::stoul(queues_str.substr(dash + 1));
+        for (uint32_t queue = first; queue <= last; queue++) {
+            queues.push_back(queue);
+        }
+    } catch (const std::exception&) {
+        UHD_LOG_WARNING("MPMD",
+            "Invalid or missing af_xdp_queues argument `"
+                << queues_str << "', expected a queue (e.g. `4') or a range of queues "
+                << "(e.g. `4-7')");
+    }
+    return queues;
+}
+
 } // namespace
 
 
@@ -348,6 +440,11 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
                            || uhd::cast::from_str<bool>(link_args.get("enable_fc"));
     const bool lossy_xport = enable_fc;
     const bool use_dpdk = _mb_args.has_key("use_dpdk");  // FIXME use constrained device args
+    // Only the data links benefit from AF_XDP. Control and async message
+    // traffic stays on kernel sockets, which also saves NIC queues.
+    const bool use_af_xdp = _mb_args.has_key("use_af_xdp") && !use_dpdk
+                            && (link_type == link_type_t::RX_DATA
+                                || link_type == link_type_t::TX_DATA);
     link_params_t default_link_params;
     default_link_params.num_send_frames = MPMD_ETH_NUM_FRAMES;
     default_link_params.num_recv_frames = MPMD_ETH_NUM_FRAMES;
@@ -363,6 +460,9 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
                                                     : get_mtu(uhd::RX_DIRECTION);
     default_link_params.send_buff_size = get_link_rate(link_idx) * MPMD_BUFFER_DEPTH;
     default_link_params.recv_buff_size = get_link_rate(link_idx) * MPMD_BUFFER_DEPTH;
+    if (_udp_info.at(ip_addr).link_type == "internal") {
+        default_link_params.recv_batch_size = MPMD_INTERNAL_RECV_BATCH_SIZE;
+    }
 
 #ifdef HAVE_DPDK
     if(use_dpdk) {
@@ -370,6 +470,57 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
             default_link_params.recv_frame_size;
     }
 #endif
+#ifdef HAVE_AF_XDP
+    if (use_af_xdp) {
+        // Frames must fit into a UMEM frame, and there is no socket buffer,
+        // so the frames themselves need to provide the buffering
+        default_link_params.send_frame_size = std::min(
+            default_link_params.send_frame_size, udp_af_xdp_link::MAX_FRAME_SIZE);
+        default_link_params.recv_frame_size = std::min(
+            default_link_params.recv_frame_size, udp_af_xdp_link::MAX_FRAME_SIZE);
+        default_link_params.num_recv_frames = default_link_params.recv_buff_size
+                                              / default_link_params.recv_frame_size;
+    }
+#endif
+
+    // Size the buffers of data links for the actual round trip time and data
+    // rate instead, if requested. Explicitly given sizes still take precedence.
+    const bool auto_tune =
+        (link_type == link_type_t::RX_DATA || link_type == link_type_t::TX_DATA)
+        && uhd::cast::from_str<bool>(
+            link_args.get("auto_tune", _mb_args.get("auto_tune", "0")));
+    if (auto_tune) {
+        const double rate    = link_args.cast<double>(
+            "auto_tune_rate", _mb_args.cast<double>("auto_tune_rate", link_rate));
+        const double latency = link_args.cast<double>("auto_tune_latency",
+            _mb_args.cast<double>("auto_tune_latency", MPMD_BUFFER_DEPTH));
+        const double rtt     = measure_rtt(ip_addr,
+            _mb_args.get(mpmd_impl::MPM_DISCOVERY_PORT_KEY,
+                std::to_string(mpmd_impl::MPM_DISCOVERY_PORT)),
+            use_dpdk);
+        if (rtt == 0.0) {
+            UHD_LOG_WARNING("MPMD::XPORT::UDP",
+                "Cannot measure the round trip time to " << ip_addr
+                                                         << ", not tuning the buffers");
+        } else {
+            auto_tune_udp_link_params(default_link_params,
+                link_type,
+                rate,
+                rtt,
+                latency,
+                use_dpdk || use_af_xdp);
+            UHD_LOG_INFO("MPMD::XPORT::UDP",
+                "Tuned the buffers of " << ip_addr << " for " << rate / 1e6
+                                        << " MB/s, a round trip time of " << rtt * 1e6
+                                        << " us, and a latency of " << latency * 1e3
+                                        << " ms: " << default_link_params.recv_buff_size
+                                        << " / " << default_link_params.send_buff_size
+                                        << " bytes and "
+                                        << default_link_params.num_recv_frames << " / "
+                                        << default_link_params.num_send_frames
+                                        << " frames (recv / send)");
+        }
+    }
 
     link_params_t link_params = calculate_udp_link_params(link_type,
         get_mtu(uhd::TX_DIRECTION),
@@ -378,6 +529,16 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
         _mb_args,
         link_args);
 
+    // The graph gives every data link its share of the memory_budget stream
+    // argument
+    if (link_args.has_key("link_memory_budget")) {
+        apply_udp_link_memory_budget(link_params,
+            link_type,
+            link_args.cast<uint64_t>("link_memory_budget", 0),
+            link_args,
+            use_dpdk || use_af_xdp);
+    }
+
     // Enforce a minimum bound of the number of receive and send frames.
     link_params.num_send_frames =
         std::max(uhd::rfnoc::MIN_NUM_FRAMES, link_params.num_send_frames);
@@ -396,6 +557,30 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
             enable_fc);
 #else
         UHD_LOG_WARNING("MPMD", "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (use_af_xdp) {
+#ifdef HAVE_AF_XDP
+        const auto queues = get_af_xdp_queues(_mb_args);
+        if (!queues.empty()) {
+            try {
+                auto link = uhd::transport::udp_af_xdp_link::make(
+                    ip_addr, udp_port, link_params, queues);
+                return std::make_tuple(link,
+                    link_params.send_buff_size,
+                    link,
+                    link_params.recv_buff_size,
+                    lossy_xport,
+                    false,
+                    enable_fc);
+            } catch (const uhd::runtime_error& ex) {
+                UHD_LOG_WARNING("MPMD",
+                    "Cannot create AF_XDP transport, falling back to UDP: "
+                        << ex.what());
+            }
+        }
+#else
+        UHD_LOG_WARNING("MPMD", "Cannot create AF_XDP transport, falling back to UDP");
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(ip_addr,
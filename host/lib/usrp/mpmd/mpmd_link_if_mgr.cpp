@@ -77,6 +77,13 @@ public:
         return _link_if_ctrls.at(_link_link_if_ctrl_map.at(link_idx).first)->get_mtu(dir);
     }
 
+    double get_link_rate(const size_t link_idx) const override
+    {
+        const size_t link_if_ctrl_idx = _link_link_if_ctrl_map.at(link_idx).first;
+        const size_t xport_link_idx   = _link_link_if_ctrl_map.at(link_idx).second;
+        return _link_if_ctrls.at(link_if_ctrl_idx)->get_link_rate(xport_link_idx);
+    }
+
     const uhd::rfnoc::chdr::chdr_packet_factory& get_packet_factory(
         const size_t link_idx) const override
     {
@@ -148,6 +148,10 @@ public:
      */
     virtual size_t get_mtu(const size_t link_idx, const uhd::direction_t dir) const = 0;
 
+    /*! Return the rate of a link in bytes/sec
+     */
+    virtual double get_link_rate(const size_t link_idx) const = 0;
+
     /*! Get packet factory from associated link_mgr
      *
      * \param link_idx The number of the link to use. link_idx < get_num_links()
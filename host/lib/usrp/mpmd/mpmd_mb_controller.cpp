@@ -19,6 +19,7 @@ mpmd_mb_controller::fpga_onload::fpga_onload()
 
 void mpmd_mb_controller::fpga_onload::onload()
 {
+    std::lock_guard<std::mutex> l(_cbs_mutex);
     for (auto& cb : _cbs)
     {
         if (auto spt = cb.lock())
@@ -30,6 +31,7 @@ void mpmd_mb_controller::fpga_onload::onload()
 
 void mpmd_mb_controller::fpga_onload::request_cb(uhd::features::fpga_load_notification_iface::sptr handler)
 {
+    std::lock_guard<std::mutex> l(_cbs_mutex);
     _cbs.emplace_back(handler);
 }
 
@@ -109,9 +111,10 @@ std::string mpmd_mb_controller::gpio_power::get_external_power_status(
     return _rpcc->dio_get_external_power_state(port);
 }
 
-mpmd_mb_controller::mpmd_mb_controller(
-    uhd::usrp::mpmd_rpc_iface::sptr rpcc, uhd::device_addr_t device_info)
-    : _rpc(rpcc), _device_info(device_info)
+mpmd_mb_controller::mpmd_mb_controller(uhd::usrp::mpmd_rpc_iface::sptr rpcc,
+    uhd::device_addr_t device_info,
+    const bool has_sensor_snapshot)
+    : _rpc(rpcc), _device_info(device_info), _has_sensor_snapshot(has_sensor_snapshot)
 {
     const size_t num_tks = _rpc->get_num_timekeepers();
     for (size_t tk_idx = 0; tk_idx < num_tks; tk_idx++) {
@@ -179,6 +182,7 @@ void mpmd_mb_controller::mpmd_timekeeper::set_period(const uint64_t period_ns)
 
 void mpmd_mb_controller::mpmd_timekeeper::update_tick_rate(const double tick_rate)
 {
+    std::lock_guard<std::mutex> l(_tick_rate_mutex);
     set_tick_rate(tick_rate);
 }
 
@@ -307,6 +311,18 @@ std::vector<std::string> mpmd_mb_controller::get_sensor_names()
     return sensor_names;
 }
 
+std::vector<uhd::sensor_value_t> mpmd_mb_controller::get_all_sensors()
+{
+    if (!_has_sensor_snapshot) {
+        return mb_controller::get_all_sensors();
+    }
+    std::vector<uhd::sensor_value_t> sensors;
+    for (const auto& sensor : _rpc->get_all_mb_sensors()) {
+        sensors.push_back(sensor_value_t(sensor.second));
+    }
+    return sensors;
+}
+
 uhd::usrp::mboard_eeprom_t mpmd_mb_controller::get_eeprom()
 {
     auto mb_eeprom = _rpc->get_mb_eeprom();
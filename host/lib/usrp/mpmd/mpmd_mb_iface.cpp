@@ -10,6 +10,7 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/device_id.hpp>
+#include <uhdlib/usrp/common/io_service_args.hpp>
 #include <uhdlib/utils/compat_check.hpp>
 
 using namespace uhd::rfnoc;
@@ -31,18 +32,22 @@ static uhd::usrp::io_service_args_t get_default_io_srv_args()
     return args;
 }
 
-mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(
-    const uhd::device_addr_t& mb_args, uhd::rpc_client::sptr rpc)
-    : _mb_args(mb_args), _rpc(rpc), _link_if_mgr(xport::mpmd_link_if_mgr::make(mb_args))
+mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(const uhd::device_addr_t& mb_args,
+    uhd::rpc_client::sptr rpc,
+    const uhd::device_addr_t& device_info,
+    const std::vector<size_t>& mpm_compat_num)
+    : _mb_args(mb_args)
+    , _rpc(rpc)
+    , _device_info(device_info)
+    , _link_if_mgr(xport::mpmd_link_if_mgr::make(mb_args))
 {
     _remote_device_id = allocate_device_id();
     UHD_LOG_TRACE("MPMD::MB_IFACE", "Assigning device_id " << _remote_device_id);
     _rpc->notify_with_token("set_device_id", _remote_device_id);
 
     // Check for remote streaming capabilities
-    auto compat_num = rpc->request<std::vector<size_t>>("get_mpm_compat_num");
     _has_remote_xport_capability =
-        uhd::compat_num<size_t, size_t>(compat_num[0], compat_num[1])
+        uhd::compat_num<size_t, size_t>(mpm_compat_num.at(0), mpm_compat_num.at(1))
         >= REMOTE_XPORT_CAP_MIN;
 }
 
@@ -144,6 +149,26 @@ std::vector<device_id_t> mpmd_mboard_impl::mpmd_mb_iface::get_local_device_ids()
     return device_ids;
 }
 
+std::string mpmd_mboard_impl::mpmd_mb_iface::get_topology_key(
+    const uhd::rfnoc::device_id_t local_device_id)
+{
+    const std::string serial    = _device_info.get("serial", "");
+    const std::string fpga_hash = _device_info.get("fpga_version_hash", "");
+    // A dirty image may have been rebuilt without changing its hash
+    if (serial.empty() || fpga_hash.empty()
+        || fpga_hash.find("dirty") != std::string::npos) {
+        return "";
+    }
+    return "mpmd/" + serial + "/" + fpga_hash + "/link"
+           + std::to_string(_local_device_id_map.at(local_device_id));
+}
+
+double mpmd_mboard_impl::mpmd_mb_iface::get_link_rate(
+    const uhd::rfnoc::device_id_t local_device_id)
+{
+    return _link_if_mgr->get_link_rate(_local_device_id_map.at(local_device_id));
+}
+
 uhd::transport::adapter_id_t mpmd_mboard_impl::mpmd_mb_iface::get_adapter_id(
     const uhd::rfnoc::device_id_t local_device_id)
 {
@@ -292,6 +317,8 @@ mpmd_mboard_impl::mpmd_mb_iface::make_rx_data_transport(
 
     cfg_io_srv.reset();
 
+    chdr_rx_data_xport::read_adaptive_fc_args(xport_args, fc_params);
+
     // Connect the links to an I/O service
     auto io_srv = get_io_srv_mgr()->connect_links(recv_link,
         send_link,
@@ -358,7 +385,7 @@ mpmd_mboard_impl::mpmd_mb_iface::make_tx_data_transport(
 
     auto pkt_factory         = _link_if_mgr->get_packet_factory(link_idx);
     auto io_srv_mgr = this->get_io_srv_mgr();
-    const auto buff_capacity = chdr_tx_data_xport::configure_sep(cfg_io_srv,
+    auto fc_params = chdr_tx_data_xport::configure_sep(cfg_io_srv,
         recv_link,
         send_link,
         pkt_factory,
@@ -374,6 +401,12 @@ mpmd_mboard_impl::mpmd_mb_iface::make_tx_data_transport(
 
     cfg_io_srv.reset();
 
+    // Process the strs packets on a thread of the transport, if requested
+    const auto io_srv_args = uhd::usrp::read_io_service_args(
+        uhd::usrp::merge_io_service_dev_args(_mb_args, xport_args),
+        get_default_io_srv_args());
+    fc_params.fc_offload = io_srv_args.send_fc_offload;
+
     // Connect the links to an I/O service
     auto io_srv = get_io_srv_mgr()->connect_links(recv_link,
         send_link,
@@ -389,7 +422,7 @@ mpmd_mboard_impl::mpmd_mb_iface::make_tx_data_transport(
         pkt_factory,
         epids,
         send_link->get_num_send_frames(),
-        buff_capacity,
+        fc_params,
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
         });
@@ -22,7 +22,10 @@ class mpmd_mboard_impl::mpmd_mb_iface : public uhd::rfnoc::mb_iface
 public:
     using uptr               = std::unique_ptr<mpmd_mb_iface>;
     using clock_iface_list_t = std::vector<std::map<std::string, std::string>>;
-    mpmd_mb_iface(const uhd::device_addr_t& mb_args, uhd::rpc_client::sptr rpc);
+    mpmd_mb_iface(const uhd::device_addr_t& mb_args,
+        uhd::rpc_client::sptr rpc,
+        const uhd::device_addr_t& device_info,
+        const std::vector<size_t>& mpm_compat_num);
     ~mpmd_mb_iface() override = default;
 
     /*** mpmd_mb_iface API calls *****************************************/
@@ -38,6 +41,8 @@ public:
     std::vector<uhd::rfnoc::device_id_t> get_local_device_ids() override;
     uhd::transport::adapter_id_t get_adapter_id(
         const uhd::rfnoc::device_id_t local_device_id) override;
+    std::string get_topology_key(const uhd::rfnoc::device_id_t local_device_id) override;
+    double get_link_rate(const uhd::rfnoc::device_id_t local_device_id) override;
     void reset_network() override;
     uhd::rfnoc::clock_iface::sptr get_clock_iface(const std::string& clock_name) override;
     uhd::rfnoc::chdr_ctrl_xport::sptr make_ctrl_transport(
@@ -67,6 +72,7 @@ public:
 private:
     uhd::device_addr_t _mb_args;
     uhd::rpc_client::sptr _rpc;
+    const uhd::device_addr_t _device_info;
     xport::mpmd_link_if_mgr::uptr _link_if_mgr;
     uhd::rfnoc::device_id_t _remote_device_id;
     std::map<uhd::rfnoc::device_id_t, size_t> _local_device_id_map;
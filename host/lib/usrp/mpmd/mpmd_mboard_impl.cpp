@@ -10,6 +10,7 @@
 #include <uhd/transport/udp_simple.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/safe_call.hpp>
+#include <uhdlib/utils/compat_check.hpp>
 #include <chrono>
 #include <memory>
 #include <thread>
@@ -26,6 +27,10 @@ const std::string MPMD_DEFAULT_SESSION_ID = "UHD";
 const std::string MPMD_MEAS_LATENCY_KEY = "measure_rpc_latency";
 //! Duration of a latency measurement test
 constexpr size_t MPMD_MEAS_LATENCY_DURATION = 1000;
+//! Oldest MPM which supports batched RPC calls
+constexpr uhd::compat_num<size_t, size_t> MPMD_BATCH_RPC_MIN{4, 4};
+//! Oldest MPM which serves a snapshot of all motherboard sensors
+constexpr uhd::compat_num<size_t, size_t> MPMD_SENSOR_SNAPSHOT_MIN{4, 5};
 
 using log_buf_t = std::vector<std::map<std::string, std::string>>;
 
@@ -285,14 +290,31 @@ mpmd_mboard_impl::mpmd_mboard_impl(
         measure_rpc_latency(rpc, MPMD_MEAS_LATENCY_DURATION);
     }
 
-    /// Get device info
-    const auto device_info_dict = rpc->request<dev_info>("get_device_info");
+    mpm_compat_num = rpc->request<std::vector<size_t>>("get_mpm_compat_num");
+    UHD_ASSERT_THROW(mpm_compat_num.size() >= 2);
+    const uhd::compat_num<size_t, size_t> mpm_compat(
+        mpm_compat_num[0], mpm_compat_num[1]);
+    has_batch_rpc           = mpm_compat >= MPMD_BATCH_RPC_MIN;
+    has_sensor_snapshot_rpc = mpm_compat >= MPMD_SENSOR_SNAPSHOT_MIN;
+
+    /// Get device and dboard info
+    dev_info device_info_dict;
+    std::vector<dev_info> dboards_info;
+    if (has_batch_rpc) {
+        uhd::rpc_batch batch;
+        batch.add("get_device_info");
+        batch.add("get_dboard_info");
+        const auto results = rpc->request_batch(batch);
+        device_info_dict   = results.get<dev_info>(0);
+        dboards_info       = results.get<std::vector<dev_info>>(1);
+    } else {
+        device_info_dict = rpc->request<dev_info>("get_device_info");
+        dboards_info     = rpc->request<std::vector<dev_info>>("get_dboard_info");
+    }
     for (const auto& info_pair : device_info_dict) {
         device_info[info_pair.first] = info_pair.second;
     }
     UHD_LOG_DEBUG("MPMD", "MPM reports device info: " << device_info.to_string());
-    /// Get dboard info
-    const auto dboards_info = rpc->request<std::vector<dev_info>>("get_dboard_info");
     UHD_ASSERT_THROW(this->dboard_info.empty());
     for (const auto& dboard_info_dict : dboards_info) {
         uhd::device_addr_t this_db_info;
@@ -307,8 +329,12 @@ mpmd_mboard_impl::mpmd_mboard_impl(
 
     if (!mb_args.cast<bool>("skip_init", false)) {
         // Initialize mb_iface and mb_controller
-        mb_iface = std::make_unique<mpmd_mb_iface>(mb_args, rpc);
-        mb_ctrl  = std::make_shared<rfnoc::mpmd_mb_controller>(std::make_shared<uhd::usrp::mpmd_rpc>(rpc), device_info);
+        mb_iface =
+            std::make_unique<mpmd_mb_iface>(mb_args, rpc, device_info, mpm_compat_num);
+        mb_ctrl  = std::make_shared<rfnoc::mpmd_mb_controller>(
+            std::make_shared<uhd::usrp::mpmd_rpc>(rpc),
+            device_info,
+            has_sensor_snapshot_rpc);
     } // Note -- when skip_init is used, these are not initialized, and trying
       // to use them will result in a null pointer dereference exception!
 }
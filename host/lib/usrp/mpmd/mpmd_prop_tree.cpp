@@ -75,6 +75,21 @@ uhd::usrp::component_files_t _update_component(
     return all_comps_copy;
 }
 
+/*
+ * Turn the return value of the get_component_info RPC call into component files
+ */
+uhd::usrp::component_files_t _to_component_info(
+    const std::map<std::string, std::string>& component_metadata)
+{
+    // Copy the contents of the component metadata into a object we can return
+    uhd::usrp::component_file_t return_component;
+    auto& return_metadata = return_component.metadata;
+    for (auto item : component_metadata) {
+        return_metadata[item.first] = item.second;
+    }
+    return uhd::usrp::component_files_t{return_component};
+}
+
 /*
  * Query the device to get the metadata for desired component
  *
@@ -86,15 +101,56 @@ uhd::usrp::component_files_t _get_component_info(
     const std::string& comp_name, mpmd_mboard_impl* mb)
 {
     UHD_LOG_TRACE("MPMD", "Getting component info for " << comp_name);
-    const auto component_metadata = mb->rpc->request<std::map<std::string, std::string>>(
-        "get_component_info", comp_name);
-    // Copy the contents of the component metadata into a object we can return
-    uhd::usrp::component_file_t return_component;
-    auto& return_metadata = return_component.metadata;
-    for (auto item : component_metadata) {
-        return_metadata[item.first] = item.second;
+    return _to_component_info(mb->rpc->request<std::map<std::string, std::string>>(
+        "get_component_info", comp_name));
+}
+
+/*
+ * Read all values of the motherboard properties which need an RPC call in a
+ * single batch. This is the prefetcher of the motherboard path.
+ */
+void _prefetch_mb_properties(property_tree& snapshot,
+    mpmd_mboard_impl* mb,
+    const std::vector<std::string>& sensor_list,
+    const std::vector<std::string>& updateable_components)
+{
+    uhd::rpc_batch batch;
+    batch.add("get_clock_source");
+    batch.add("get_clock_sources");
+    batch.add("get_time_source");
+    batch.add("get_time_sources");
+    batch.add("get_mb_eeprom");
+    for (const auto& sensor_name : sensor_list) {
+        batch.add("get_mb_sensor", sensor_name);
+    }
+    for (const auto& comp_name : updateable_components) {
+        batch.add("get_component_info", comp_name);
+    }
+    // If any of the calls fails, the values are read one by one instead
+    const auto results = mb->rpc->request_batch(batch);
+
+    size_t idx = 0;
+    snapshot.create<std::string>("clock_source/value")
+        .set(results.get<std::string>(idx++));
+    snapshot.create<std::vector<std::string>>("clock_source/options")
+        .set(results.get<std::vector<std::string>>(idx++));
+    snapshot.create<std::string>("time_source/value")
+        .set(results.get<std::string>(idx++));
+    snapshot.create<std::vector<std::string>>("time_source/options")
+        .set(results.get<std::vector<std::string>>(idx++));
+    const auto mb_eeprom = results.get<std::map<std::string, std::string>>(idx++);
+    snapshot.create<uhd::usrp::mboard_eeprom_t>("eeprom").set(
+        uhd::usrp::mboard_eeprom_t(mb_eeprom.cbegin(), mb_eeprom.cend()));
+    for (const auto& sensor_name : sensor_list) {
+        snapshot.create<sensor_value_t>(fs_path("sensors") / sensor_name)
+            .set(sensor_value_t(results.get<sensor_value_t::sensor_map_t>(idx++)));
+    }
+    for (const auto& comp_name : updateable_components) {
+        snapshot
+            .create<uhd::usrp::component_files_t>(fs_path("components") / comp_name)
+            .set(_to_component_info(
+                results.get<std::map<std::string, std::string>>(idx++)));
     }
-    return uhd::usrp::component_files_t{return_component};
 }
 } // namespace
 
@@ -156,9 +212,24 @@ void mpmd_impl::init_property_tree(
                 "get_time_sources");
         });
 
+    // Read the lists of sensors and components in one go, if possible
+    std::vector<std::string> sensor_list;
+    std::vector<std::string> updateable_components;
+    if (mb->has_batch_rpc) {
+        uhd::rpc_batch batch;
+        batch.add("get_mb_sensors");
+        batch.add("list_updateable_components");
+        const auto results    = mb->rpc->request_batch(batch);
+        sensor_list           = results.get<std::vector<std::string>>(0);
+        updateable_components = results.get<std::vector<std::string>>(1);
+    } else {
+        sensor_list =
+            mb->rpc->request_with_token<std::vector<std::string>>("get_mb_sensors");
+        updateable_components =
+            mb->rpc->request<std::vector<std::string>>("list_updateable_components");
+    }
+
     /*** Sensors ********************************************************/
-    auto sensor_list =
-        mb->rpc->request_with_token<std::vector<std::string>>("get_mb_sensors");
     UHD_LOG_DEBUG("MPMD", "Found " << sensor_list.size() << " motherboard sensors.");
     for (const auto& sensor_name : sensor_list) {
         UHD_LOG_TRACE("MPMD", "Adding motherboard sensor `" << sensor_name << "'");
@@ -196,8 +267,6 @@ void mpmd_impl::init_property_tree(
         });
 
     /*** Updateable Components ******************************************/
-    std::vector<std::string> updateable_components =
-        mb->rpc->request<std::vector<std::string>>("list_updateable_components");
     // TODO: Check the 'id' against the registered property
     UHD_LOG_DEBUG("MPMD",
         "Found " << updateable_components.size()
@@ -220,4 +289,14 @@ void mpmd_impl::init_property_tree(
                 return _get_component_info(comp_name, mb);
             }); // Done adding component to property tree
     }
+
+    /*** Prefetching ****************************************************/
+    // Snapshots of the tree (e.g., in uhd_usrp_probe) read all of the above
+    // with a single RPC call
+    if (mb->has_batch_rpc) {
+        tree->add_prefetcher(mb_path,
+            [mb, sensor_list, updateable_components](property_tree& snapshot) {
+                _prefetch_mb_properties(snapshot, mb, sensor_list, updateable_components);
+            });
+    }
 }
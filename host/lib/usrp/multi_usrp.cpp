@@ -19,6 +19,7 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhd/utils/soft_register.hpp>
+#include <uhdlib/rfnoc/command_batch.hpp>
 #include <uhdlib/rfnoc/rfnoc_device.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
 #include <uhdlib/usrp/multi_usrp_utils.hpp>
@@ -29,7 +30,10 @@
 #include <chrono>
 #include <cmath>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <thread>
 
 namespace uhd { namespace rfnoc {
@@ -275,9 +279,26 @@ static double derive_freq_from_xx_subdev_and_dsp(const double xx_sign,
 class multi_usrp_impl : public multi_usrp
 {
 public:
-    multi_usrp_impl(device::sptr dev) : _dev(dev)
+    multi_usrp_impl(device::sptr dev)
+        : _dev(dev), _chan_cache(std::make_shared<chan_cache_t>())
     {
         _tree = _dev->get_tree();
+        // The paths of the channels depend on the subdev specs. The subscribers
+        // may outlive this object, so they only hold on to the cache.
+        std::weak_ptr<chan_cache_t> weak_cache = _chan_cache;
+        for (size_t m = 0; m < get_num_mboards(); m++) {
+            for (const char* spec_name : {"rx_subdev_spec", "tx_subdev_spec"}) {
+                if (!_tree->exists(mb_root(m) / spec_name)) {
+                    continue;
+                }
+                _tree->access<subdev_spec_t>(mb_root(m) / spec_name)
+                    .add_coerced_subscriber([weak_cache](const subdev_spec_t&) {
+                        if (auto cache = weak_cache.lock()) {
+                            cache->clear();
+                        }
+                    });
+            }
+        }
     }
 
     device::sptr get_device(void) override
@@ -458,6 +479,15 @@ public:
         return _tree->access<time_spec_t>(mb_root(mboard) / "time/now").get();
     }
 
+    time_spec_t get_time_now_estimate(size_t mboard = 0) override
+    {
+        if (_tree->exists(mb_root(mboard) / "time/now_estimate")) {
+            return _tree->access<time_spec_t>(mb_root(mboard) / "time/now_estimate")
+                .get();
+        }
+        return get_time_now(mboard);
+    }
+
     time_spec_t get_time_last_pps(size_t mboard = 0) override
     {
         return _tree->access<time_spec_t>(mb_root(mboard) / "time/pps").get();
@@ -532,6 +562,23 @@ public:
         return true;
     }
 
+    std::vector<time_spec_t> get_time_last_pps_offsets(void) override
+    {
+        // A PPS edge during the readout makes the times inconsistent, so retry
+        // once when motherboard 0 saw one
+        for (size_t attempt = 0; attempt < 2; attempt++) {
+            const time_spec_t last_pps_0 = get_time_last_pps(0);
+            std::vector<time_spec_t> offsets;
+            for (size_t m = 0; m < get_num_mboards(); m++) {
+                offsets.push_back(get_time_last_pps(m) - last_pps_0);
+            }
+            if (get_time_last_pps(0) == last_pps_0) {
+                return offsets;
+            }
+        }
+        throw uhd::runtime_error("PPS edges occurred while reading the PPS times");
+    }
+
     void set_command_time(const time_spec_t& time_spec, size_t mboard) override
     {
         if (mboard != ALL_MBOARDS) {
@@ -559,6 +606,33 @@ public:
         }
     }
 
+    void begin_command_batch() override
+    {
+        // These devices never defer ACKs, but batches must still nest the
+        // same way as on RFNoC devices
+        uhd::rfnoc::detail::begin_command_batch();
+    }
+
+    void end_command_batch() override
+    {
+        uhd::rfnoc::detail::end_command_batch();
+    }
+
+    radio_profile_t capture_profile() override
+    {
+        std::vector<size_t> rx_chans(get_rx_num_channels());
+        std::iota(rx_chans.begin(), rx_chans.end(), 0);
+        std::vector<size_t> tx_chans(get_tx_num_channels());
+        std::iota(tx_chans.begin(), tx_chans.end(), 0);
+        return capture_radio_profile(*this, rx_chans, tx_chans);
+    }
+
+    radio_profile_t apply_profile(
+        const radio_profile_t& profile, const time_spec_t& cmd_time) override
+    {
+        return apply_radio_profile(*this, profile, cmd_time);
+    }
+
     void issue_stream_cmd(const stream_cmd_t& stream_cmd, size_t chan) override
     {
         if (chan != ALL_CHANS) {
@@ -802,6 +876,15 @@ public:
         return {};
     }
 
+    std::vector<sensor_value_t> get_all_mboard_sensors(size_t mboard) override
+    {
+        std::vector<sensor_value_t> sensors;
+        for (const auto& name : get_mboard_sensor_names(mboard)) {
+            sensors.push_back(get_mboard_sensor(name, mboard));
+        }
+        return sensors;
+    }
+
     void set_user_register(
         const uint8_t addr, const uint32_t data, size_t mboard) override
     {
@@ -911,7 +994,7 @@ public:
     void set_rx_rate(double rate, size_t chan) override
     {
         if (chan != ALL_CHANS) {
-            _tree->access<double>(rx_dsp_root(chan) / "rate" / "value").set(rate);
+            _cached_access<double>(rx_dsp_root(chan) / "rate" / "value").set(rate);
             do_samp_rate_warning_message(rate, get_rx_rate(chan), "RX");
             return;
         }
@@ -927,7 +1010,7 @@ public:
 
     double get_rx_rate(size_t chan) override
     {
-        return _tree->access<double>(rx_dsp_root(chan) / "rate" / "value").get();
+        return _cached_access<double>(rx_dsp_root(chan) / "rate" / "value").get();
     }
 
     meta_range_t get_rx_rates(size_t chan) override
@@ -965,6 +1048,17 @@ public:
         return result;
     }
 
+    std::vector<tune_result_t> set_rx_freq_schedule(
+        const freq_schedule_t& schedule, size_t chan) override
+    {
+        assert_freq_schedule_sorted(schedule);
+        const size_t mboard = rx_chan_to_mcp(chan).mboard;
+        return _run_freq_schedule(
+            schedule, mboard, [this, chan](const tune_request_t& tune_request) {
+                return set_rx_freq(tune_request, chan);
+            });
+    }
+
     double get_rx_freq(size_t chan) override
     {
         return derive_freq_from_xx_subdev_and_dsp(RX_SIGN,
@@ -1956,7 +2050,7 @@ public:
     void set_tx_rate(double rate, size_t chan) override
     {
         if (chan != ALL_CHANS) {
-            _tree->access<double>(tx_dsp_root(chan) / "rate" / "value").set(rate);
+            _cached_access<double>(tx_dsp_root(chan) / "rate" / "value").set(rate);
             do_samp_rate_warning_message(rate, get_tx_rate(chan), "TX");
             return;
         }
@@ -1967,7 +2061,7 @@ public:
 
     double get_tx_rate(size_t chan) override
     {
-        return _tree->access<double>(tx_dsp_root(chan) / "rate" / "value").get();
+        return _cached_access<double>(tx_dsp_root(chan) / "rate" / "value").get();
     }
 
     meta_range_t get_tx_rates(size_t chan) override
@@ -1985,6 +2079,17 @@ public:
         return result;
     }
 
+    std::vector<tune_result_t> set_tx_freq_schedule(
+        const freq_schedule_t& schedule, size_t chan) override
+    {
+        assert_freq_schedule_sorted(schedule);
+        const size_t mboard = tx_chan_to_mcp(chan).mboard;
+        return _run_freq_schedule(
+            schedule, mboard, [this, chan](const tune_request_t& tune_request) {
+                return set_tx_freq(tune_request, chan);
+            });
+    }
+
     double get_tx_freq(size_t chan) override
     {
         return derive_freq_from_xx_subdev_and_dsp(TX_SIGN,
@@ -2473,6 +2578,83 @@ private:
     device::sptr _dev;
     property_tree::sptr _tree;
 
+    //! Tree paths and properties which are expensive to look up. Everything in
+    // here is dropped whenever a subdev spec changes.
+    struct chan_cache_t
+    {
+        enum root_t { RX_DSP, TX_DSP, RX_RF_FE, TX_RF_FE };
+
+        std::mutex mutex;
+        std::map<std::pair<root_t, size_t>, fs_path> roots;
+        std::map<std::string, std::shared_ptr<property_iface>> props;
+        //! Incremented by clear(), so that lookups which raced with it don't
+        // add stale entries
+        size_t generation = 0;
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            roots.clear();
+            props.clear();
+            generation++;
+        }
+    };
+    std::shared_ptr<chan_cache_t> _chan_cache;
+
+    //! Return the root path of a channel, and remember it for the next call
+    template <typename make_root_t>
+    fs_path _cached_root(
+        const chan_cache_t::root_t root, const size_t chan, make_root_t&& make_root)
+    {
+        const auto key    = std::make_pair(root, chan);
+        size_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(_chan_cache->mutex);
+            auto it = _chan_cache->roots.find(key);
+            if (it != _chan_cache->roots.end()) {
+                return it->second;
+            }
+            generation = _chan_cache->generation;
+        }
+        // Don't hold the lock while looking up the path: it accesses the
+        // subdev spec, which may set it and thus clear the cache.
+        const fs_path path = make_root(chan);
+        std::lock_guard<std::mutex> lock(_chan_cache->mutex);
+        if (_chan_cache->generation == generation) {
+            _chan_cache->roots[key] = path;
+        }
+        return path;
+    }
+
+    /*! Like _tree->access(), but remember the property for the next call
+     *
+     * This is for properties which are accessed over and over, e.g., by
+     * setters which are called while streaming.
+     */
+    template <typename T>
+    property<T>& _cached_access(const fs_path& path)
+    {
+        size_t generation = 0;
+        {
+            std::lock_guard<std::mutex> lock(_chan_cache->mutex);
+            auto it = _chan_cache->props.find(path);
+            if (it != _chan_cache->props.end()) {
+                // On a type mismatch, fall through to access_ptr(), which
+                // throws the appropriate error
+                if (auto prop = std::dynamic_pointer_cast<property<T>>(it->second)) {
+                    return *prop;
+                }
+            }
+            generation = _chan_cache->generation;
+        }
+        auto prop = _tree->access_ptr<T>(path);
+        std::lock_guard<std::mutex> lock(_chan_cache->mutex);
+        if (_chan_cache->generation == generation) {
+            _chan_cache->props[path] = prop;
+        }
+        return *prop;
+    }
+
     //! Container for spp values set in set_rx_spp()
     std::unordered_map<size_t, size_t> _rx_spp;
 
@@ -2482,6 +2664,27 @@ private:
         mboard_chan_pair(void) : mboard(0), chan(0) {}
     };
 
+    //! Helper for set_{rx,tx}_freq_schedule(): Call tune() with every entry of
+    // \p schedule, at the respective command time on motherboard \p mboard
+    std::vector<tune_result_t> _run_freq_schedule(const freq_schedule_t& schedule,
+        const size_t mboard,
+        const std::function<tune_result_t(const tune_request_t&)>& tune)
+    {
+        std::vector<tune_result_t> results;
+        results.reserve(schedule.size());
+        try {
+            for (const auto& entry : schedule) {
+                set_command_time(entry.first, mboard);
+                results.push_back(tune(entry.second));
+            }
+        } catch (...) {
+            clear_command_time(mboard);
+            throw;
+        }
+        clear_command_time(mboard);
+        return results;
+    }
+
     mboard_chan_pair rx_chan_to_mcp(size_t chan)
     {
         mboard_chan_pair mcp;
@@ -2537,6 +2740,13 @@ private:
     }
 
     fs_path rx_dsp_root(const size_t chan)
+    {
+        return _cached_root(chan_cache_t::RX_DSP, chan, [this](const size_t c) {
+            return _rx_dsp_root(c);
+        });
+    }
+
+    fs_path _rx_dsp_root(const size_t chan)
     {
         mboard_chan_pair mcp = rx_chan_to_mcp(chan);
         if (_tree->exists(mb_root(mcp.mboard) / "rx_chan_dsp_mapping")) {
@@ -2566,6 +2776,13 @@ private:
     }
 
     fs_path tx_dsp_root(const size_t chan)
+    {
+        return _cached_root(chan_cache_t::TX_DSP, chan, [this](const size_t c) {
+            return _tx_dsp_root(c);
+        });
+    }
+
+    fs_path _tx_dsp_root(const size_t chan)
     {
         mboard_chan_pair mcp = tx_chan_to_mcp(chan);
         if (_tree->exists(mb_root(mcp.mboard) / "tx_chan_dsp_mapping")) {
@@ -2637,6 +2854,13 @@ private:
     }
 
     fs_path rx_rf_fe_root(const size_t chan)
+    {
+        return _cached_root(chan_cache_t::RX_RF_FE, chan, [this](const size_t c) {
+            return _rx_rf_fe_root(c);
+        });
+    }
+
+    fs_path _rx_rf_fe_root(const size_t chan)
     {
         mboard_chan_pair mcp = rx_chan_to_mcp(chan);
         try {
@@ -2651,6 +2875,13 @@ private:
     }
 
     fs_path tx_rf_fe_root(const size_t chan)
+    {
+        return _cached_root(chan_cache_t::TX_RF_FE, chan, [this](const size_t c) {
+            return _tx_rf_fe_root(c);
+        });
+    }
+
+    fs_path _tx_rf_fe_root(const size_t chan)
     {
         mboard_chan_pair mcp = tx_chan_to_mcp(chan);
         try {
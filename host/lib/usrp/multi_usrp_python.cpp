@@ -37,6 +37,7 @@ void export_multi_usrp(py::module& m)
         .def("get_rx_rate"             , &multi_usrp::get_rx_rate, py::arg("chan") = 0)
         .def("get_rx_stream"           , &multi_usrp::get_rx_stream)
         .def("set_rx_freq"             , &multi_usrp::set_rx_freq, py::arg("tune_request"), py::arg("chan") = 0)
+        .def("set_rx_freq_schedule"    , &multi_usrp::set_rx_freq_schedule, py::arg("schedule"), py::arg("chan") = 0)
         .def("set_rx_gain"             , (void (multi_usrp::*)(double, const std::string&, size_t)) &multi_usrp::set_rx_gain, py::arg("gain"), py::arg("name"), py::arg("chan") = 0)
         .def("set_rx_gain"             , (void (multi_usrp::*)(double, size_t)) &multi_usrp::set_rx_gain, py::arg("gain"), py::arg("chan") = 0)
         .def("set_rx_rate"             , &multi_usrp::set_rx_rate, py::arg("rate"), py::arg("chan") = ALL_CHANS)
@@ -46,6 +47,7 @@ void export_multi_usrp(py::module& m)
         .def("get_tx_rate"             , &multi_usrp::get_tx_rate, py::arg("chan") = 0)
         .def("get_tx_stream"           , &multi_usrp::get_tx_stream)
         .def("set_tx_freq"             , &multi_usrp::set_tx_freq, py::arg("tune_request"), py::arg("chan") = 0)
+        .def("set_tx_freq_schedule"    , &multi_usrp::set_tx_freq_schedule, py::arg("schedule"), py::arg("chan") = 0)
         .def("set_tx_gain"             , (void (multi_usrp::*)(double, const std::string&, size_t)) &multi_usrp::set_tx_gain, py::arg("gain"), py::arg("name"), py::arg("chan") = 0)
         .def("set_tx_gain"             , (void (multi_usrp::*)(double, size_t)) &multi_usrp::set_tx_gain, py::arg("gain"), py::arg("chan") = 0)
         .def("set_tx_rate"             , &multi_usrp::set_tx_rate, py::arg("rate"), py::arg("chan") = ALL_CHANS)
@@ -67,13 +69,17 @@ void export_multi_usrp(py::module& m)
         .def("get_pp_string"           , &multi_usrp::get_pp_string)
         .def("get_mboard_name"         , &multi_usrp::get_mboard_name, py::arg("mboard") = 0)
         .def("get_time_now"            , &multi_usrp::get_time_now, py::arg("mboard") = 0)
+        .def("get_time_now_estimate"   , &multi_usrp::get_time_now_estimate, py::arg("mboard") = 0)
         .def("get_time_last_pps"       , &multi_usrp::get_time_last_pps, py::arg("mboard") = 0)
         .def("set_time_now"            , &multi_usrp::set_time_now, py::arg("time_spec"), py::arg("mboard") = ALL_MBOARDS)
         .def("set_time_next_pps"       , &multi_usrp::set_time_next_pps, py::arg("time_spec"), py::arg("mboard") = ALL_MBOARDS)
         .def("set_time_unknown_pps"    , &multi_usrp::set_time_unknown_pps)
         .def("get_time_synchronized"   , &multi_usrp::get_time_synchronized)
+        .def("get_time_last_pps_offsets", &multi_usrp::get_time_last_pps_offsets)
         .def("set_command_time"        , &multi_usrp::set_command_time, py::arg("time_spec"), py::arg("mboard") = ALL_MBOARDS)
         .def("clear_command_time"      , &multi_usrp::clear_command_time, py::arg("mboard") = ALL_MBOARDS)
+        .def("begin_command_batch"     , &multi_usrp::begin_command_batch)
+        .def("end_command_batch"       , &multi_usrp::end_command_batch)
         .def("issue_stream_cmd"        , &multi_usrp::issue_stream_cmd, py::arg("rate"), py::arg("chan") = ALL_CHANS)
         .def("set_time_source"         , &multi_usrp::set_time_source, py::arg("source"), py::arg("mboard") = ALL_MBOARDS)
         .def("get_time_source"         , &multi_usrp::get_time_source)
@@ -90,6 +96,7 @@ void export_multi_usrp(py::module& m)
         .def("get_num_mboards"         , &multi_usrp::get_num_mboards)
         .def("get_mboard_sensor"       , &multi_usrp::get_mboard_sensor, py::arg("name"), py::arg("mboard") = 0)
         .def("get_mboard_sensor_names" , &multi_usrp::get_mboard_sensor_names, py::arg("mboard") = 0)
+        .def("get_all_mboard_sensors"  , &multi_usrp::get_all_mboard_sensors, py::arg("mboard") = 0)
         .def("set_user_register"       , &multi_usrp::set_user_register, py::arg("addr"), py::arg("data"), py::arg("mboard") = ALL_MBOARDS)
         .def("get_radio_control"       , [](multi_usrp& self, const size_t chan){ return &self.get_radio_control(chan); }, py::arg("chan") = 0, py::return_value_policy::reference_internal)
         .def("get_mb_controller"       , [](multi_usrp& self, const size_t chan){ return &self.get_mb_controller(chan); }, py::arg("mboard") = 0, py::return_value_policy::reference_internal)
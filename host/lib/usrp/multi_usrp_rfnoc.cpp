@@ -25,13 +25,16 @@
 #include <uhdlib/rfnoc/rfnoc_tx_streamer_replay_buffered.hpp>
 #include <uhdlib/usrp/gpio_defs.hpp>
 #include <uhdlib/usrp/multi_usrp_utils.hpp>
+#include <uhdlib/usrp/streamer_pool.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <unordered_set>
 #include <boost/format.hpp>
 #include <algorithm>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <thread>
 #include <vector>
 
@@ -128,6 +131,16 @@ private:
     multi_usrp* _musrp;
 };
 
+//! Identifies streamers which can be handed out again by a streamer pool
+std::string get_streamer_pool_key(const stream_args_t& args)
+{
+    std::string key = args.cpu_format + "," + args.otw_format + ",";
+    for (const size_t chan : args.channels) {
+        key += std::to_string(chan) + ",";
+    }
+    return key + args.args.to_string();
+}
+
 /*! Make sure the stream args are valid and can be used by get_tx_stream()
  * and get_rx_stream().
  *
@@ -203,6 +216,13 @@ public:
         , _tree(_graph->get_tree())
         , _device(std::make_shared<redirector_device>(this))
     {
+        // Released streamers are only kept with streamer_pool=N
+        const size_t pool_size = _args.cast<size_t>("streamer_pool", 0);
+        if (pool_size > 0) {
+            _rx_streamer_pool = streamer_pool<rfnoc_rx_streamer>::make(pool_size);
+            _tx_streamer_pool = streamer_pool<rfnoc_tx_streamer>::make(pool_size);
+        }
+
         // Discover all of the radios on our devices and create a mapping between
         // radio chains and channel numbers.  Do this one motherboard at a time
         // because each device can have a different subdev spec.
@@ -325,8 +345,18 @@ public:
     rx_streamer::sptr get_rx_stream(const stream_args_t& args_) override
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        stream_args_t args = sanitize_stream_args(args_);
-        double rate        = 1.0;
+        stream_args_t args         = sanitize_stream_args(args_);
+        double rate                = 1.0;
+        const std::string pool_key = get_streamer_pool_key(args);
+
+        // A pooled streamer is still connected, so it can be handed out as is
+        if (_rx_streamer_pool) {
+            if (auto rx_streamer = _rx_streamer_pool->acquire(pool_key)) {
+                UHD_LOG_TRACE("MULTI_USRP", "Reusing pooled RX streamer");
+                return rx_streamer;
+            }
+            _rx_streamer_pool->evict(args.channels);
+        }
 
         // Note that we don't release the graph, which means that property
         // propagation is possible. This is necessary so we don't disrupt
@@ -353,10 +383,12 @@ public:
                 }
             });
 
-        // Connect the streamer
+        // Connect the streamer. All ports are connected at once, which lets the
+        // graph set up their stream endpoints together.
+        std::vector<std::pair<block_id_t, size_t>> src_ports;
         for (size_t strm_port = 0; strm_port < args.channels.size(); ++strm_port) {
             auto rx_channel = args.channels.at(strm_port);
-            auto rx_chain   = _get_rx_chan(rx_channel);
+            auto& rx_chain  = _get_rx_chan(rx_channel);
             if (rx_chain.edge_list.empty()) {
                 throw uhd::runtime_error("Graph edge list is empty for rx channel "
                                          + std::to_string(rx_channel));
@@ -365,10 +397,8 @@ public:
                 "Connecting " << rx_chain.edge_list.back().src_blockid << ":"
                               << rx_chain.edge_list.back().src_port
                               << " -> RxStreamer:" << strm_port);
-            _graph->connect(rx_chain.edge_list.back().src_blockid,
-                rx_chain.edge_list.back().src_port,
-                rx_streamer,
-                strm_port);
+            src_ports.emplace_back(rx_chain.edge_list.back().src_blockid,
+                rx_chain.edge_list.back().src_port);
             const double chan_rate =
                 _rx_rates.count(rx_channel) ? _rx_rates.at(rx_channel) : 1.0;
             if (chan_rate > 1.0 && rate != chan_rate) {
@@ -381,6 +411,7 @@ public:
                 rate = chan_rate;
             }
         }
+        _graph->connect(src_ports, rx_streamer);
 
         // Now everything is connected, commit() again so we can have stream
         // commands go through the graph
@@ -395,7 +426,7 @@ public:
                 "Now reapplying RX rate " << (rate / 1e6)
                                           << " MHz to all streamer channels");
             for (auto rx_channel : args.channels) {
-                auto rx_chain = _get_rx_chan(rx_channel);
+                auto& rx_chain = _get_rx_chan(rx_channel);
                 if (rx_chain.ddc) {
                     rx_chain.ddc->set_output_rate(rate, rx_chain.block_chan);
                 } else {
@@ -404,6 +435,13 @@ public:
             }
         }
 
+        if (args.args.cast<bool>("host_agc", false)) {
+            _connect_host_agc(rx_streamer, args.channels);
+        }
+
+        if (_rx_streamer_pool) {
+            return _rx_streamer_pool->lend(pool_key, args.channels, rx_streamer);
+        }
         return rx_streamer;
     }
 
@@ -412,8 +450,22 @@ public:
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
         stream_args_t args   = sanitize_stream_args(args_);
         double rate          = 1.0;
-        bool replay_buffered = (args.args.has_key("streamer")
-                                and args.args["streamer"] == "replay_buffered");
+        bool replay_buffered = _use_replay_buffering(args);
+
+        const std::string pool_key = get_streamer_pool_key(args);
+
+        // Replay-buffered streamers depend on the replay block state, so they
+        // are never pooled
+        if (_tx_streamer_pool && !replay_buffered) {
+            if (auto tx_streamer = _tx_streamer_pool->acquire(pool_key)) {
+                UHD_LOG_TRACE("MULTI_USRP", "Reusing pooled TX streamer");
+                _device->set_tx_stream(tx_streamer);
+                return tx_streamer;
+            }
+        }
+        if (_tx_streamer_pool) {
+            _tx_streamer_pool->evict(args.channels);
+        }
 
         // Note that we don't release the graph, which means that property
         // propagation is possible. This is necessary so we don't disrupt
@@ -431,11 +483,16 @@ public:
                 edge_lists[channel] = _connect_tx_chain(channel);
             }
         }
+        const size_t num_stripes =
+            replay_buffered ? args.args.cast<size_t>("replay_stripes", 1) : 1;
+        if (num_stripes > 1) {
+            _assign_replay_stripe_ports(replay_configs, num_stripes);
+        }
 
         // Create a streamer
         // The disconnect callback must disconnect the entire chain because the radio
         // relies on the connections to determine what is enabled.
-        tx_streamer::sptr tx_streamer;
+        std::shared_ptr<rfnoc_tx_streamer> tx_streamer;
         std::weak_ptr<rfnoc_graph> graph_ref(_graph);
         auto disconnect = [=](const std::string& id) {
             if (auto graph = graph_ref.lock()) {
@@ -462,10 +519,15 @@ public:
                 args.channels.size(), args, disconnect);
         }
 
-        // Connect the streamer
-        for (size_t strm_port = 0; strm_port < args.channels.size(); ++strm_port) {
-            auto tx_channel = args.channels.at(strm_port);
-            auto edge_list  = edge_lists[tx_channel];
+        // Connect the streamer. With striping, every channel has one streamer
+        // port per stripe. All ports are connected at once, which lets the
+        // graph set up their stream endpoints together.
+        std::vector<std::pair<block_id_t, size_t>> dst_ports(
+            args.channels.size() * num_stripes);
+        for (size_t chan_idx = 0; chan_idx < args.channels.size(); ++chan_idx) {
+            const size_t strm_port = chan_idx * num_stripes;
+            auto tx_channel        = args.channels.at(chan_idx);
+            auto edge_list         = edge_lists[tx_channel];
             if (edge_list.empty()) {
                 throw uhd::runtime_error("Graph edge list is empty for tx channel "
                                          + std::to_string(tx_channel));
@@ -474,10 +536,18 @@ public:
                 "Connecting TxStreamer:" << strm_port << " -> "
                                          << edge_list.back().dst_blockid << ":"
                                          << edge_list.back().dst_port);
-            _graph->connect(tx_streamer,
-                strm_port,
-                edge_list.back().dst_blockid,
-                edge_list.back().dst_port);
+            dst_ports[strm_port] = {
+                edge_list.back().dst_blockid, edge_list.back().dst_port};
+            for (size_t stripe = 1; stripe < num_stripes; stripe++) {
+                const auto& replay_config = replay_configs.at(chan_idx);
+                UHD_LOG_TRACE("MULTI_USRP",
+                    "Connecting TxStreamer:"
+                        << strm_port + stripe << " -> "
+                        << replay_config.ctrl->get_block_id() << ":"
+                        << replay_config.stripe_ports.at(stripe - 1));
+                dst_ports[strm_port + stripe] = {replay_config.ctrl->get_block_id(),
+                    replay_config.stripe_ports.at(stripe - 1)};
+            }
             const double chan_rate =
                 _tx_rates.count(tx_channel) ? _tx_rates.at(tx_channel) : 1.0;
             if (chan_rate > 1.0 && rate != chan_rate) {
@@ -488,6 +558,7 @@ public:
                 rate = chan_rate;
             }
         }
+        _graph->connect(tx_streamer, dst_ports);
         // Now everything is connected, commit() again so we can have stream
         // commands go through the graph
         _graph->commit();
@@ -502,7 +573,7 @@ public:
                 "Now reapplying TX rate " << (rate / 1e6)
                                           << " MHz to all streamer channels");
             for (auto tx_channel : args.channels) {
-                auto tx_chain = _get_tx_chan(tx_channel);
+                auto& tx_chain = _get_tx_chan(tx_channel);
                 if (tx_chain.duc) {
                     tx_chain.duc->set_input_rate(rate, tx_chain.block_chan);
                 } else {
@@ -511,6 +582,10 @@ public:
             }
         }
 
+        if (_tx_streamer_pool && !replay_buffered) {
+            tx_streamer = _tx_streamer_pool->lend(pool_key, args.channels, tx_streamer);
+        }
+
         // For legacy purposes: This enables recv_async_msg(), which is considered
         // deprecated, but as long as it's there, we need this to approximate
         // previous behaviour.
@@ -820,6 +895,11 @@ public:
         return _radios[mboard][0]->get_time_now();
     }
 
+    time_spec_t get_time_now_estimate(size_t mboard = 0) override
+    {
+        return _get_mbc(mboard)->get_timekeeper(0)->get_time_now_estimate();
+    }
+
     time_spec_t get_time_last_pps(size_t mboard = 0) override
     {
         return _get_mbc(mboard)->get_timekeeper(0)->get_time_last_pps();
@@ -841,35 +921,41 @@ public:
     void set_time_unknown_pps(const time_spec_t& time_spec) override
     {
         UHD_LOGGER_INFO("MULTI_USRP") << "    1) catch time transition at pps edge";
-        auto end_time                   = std::chrono::steady_clock::now() + 1100ms;
-        time_spec_t time_start_last_pps = get_time_last_pps();
-        while (time_start_last_pps == get_time_last_pps()) {
-            if (std::chrono::steady_clock::now() > end_time) {
-                throw uhd::runtime_error("Board 0 may not be getting a PPS signal!\n"
-                                         "No PPS detected within the time interval.\n"
-                                         "See the application notes for your device.\n");
-            }
-            std::this_thread::sleep_for(1ms);
-        }
+        _wait_for_pps_edge(get_time_last_pps());
 
+        // The motherboards are programmed in parallel, so that large arrays
+        // are done well within the PPS period
         UHD_LOGGER_INFO("MULTI_USRP") << "    2) set times next pps (synchronously)";
-        set_time_next_pps(time_spec, ALL_MBOARDS);
-        std::this_thread::sleep_for(1s);
+        const time_spec_t time_start_last_pps = get_time_last_pps();
+        std::vector<std::future<void>> results;
+        for (size_t m = 0; m < get_num_mboards(); m++) {
+            auto timekeeper = _get_mbc(m)->get_timekeeper(0);
+            results.push_back(std::async(std::launch::async,
+                [timekeeper, time_spec]() { timekeeper->set_time_next_pps(time_spec); }));
+        }
+        for (auto& result : results) {
+            result.get();
+        }
 
-        // verify that the time registers are read to be within a few RTT
-        for (size_t m = 1; m < get_num_mboards(); m++) {
-            time_spec_t time_0 = this->get_time_now(0);
-            time_spec_t time_i = this->get_time_now(m);
-            // 10 ms: greater than RTT but not too big
-            if (time_i < time_0 or (time_i - time_0) > time_spec_t(0.01)) {
+        // Verify the times latched at the next PPS edge. These don't depend on
+        // the RTT, so they must match exactly.
+        UHD_LOGGER_INFO("MULTI_USRP") << "    3) verify times at next pps";
+        _wait_for_pps_edge(time_start_last_pps);
+        const auto offsets = get_time_last_pps_offsets();
+        for (size_t m = 0; m < offsets.size(); m++) {
+            if (offsets[m] != time_spec_t(0.0)) {
                 UHD_LOGGER_WARNING("MULTI_USRP")
-                    << boost::format(
-                           "Detected time deviation between board %d and board 0.\n"
-                           "Board 0 time is %f seconds.\n"
-                           "Board %d time is %f seconds.\n")
-                           % m % time_0.get_real_secs() % m % time_i.get_real_secs();
+                    << boost::format("Detected time deviation between board %d and "
+                                     "board 0 of %f seconds at the PPS edge.\n")
+                           % m % offsets[m].get_real_secs();
             }
         }
+        if (get_time_last_pps(0) != time_spec) {
+            UHD_LOGGER_WARNING("MULTI_USRP")
+                << "The time was not set at the expected PPS edge. Board 0 time "
+                   "at the PPS edge is "
+                << get_time_last_pps(0).get_real_secs() << " seconds.";
+        }
     }
 
     bool get_time_synchronized(void) override
@@ -884,6 +970,29 @@ public:
         return true;
     }
 
+    std::vector<time_spec_t> get_time_last_pps_offsets(void) override
+    {
+        // A PPS edge during the readout makes the times inconsistent, so retry
+        // once when motherboard 0 saw one
+        for (size_t attempt = 0; attempt < 2; attempt++) {
+            const time_spec_t last_pps_0 = get_time_last_pps(0);
+            std::vector<std::future<time_spec_t>> readouts;
+            for (size_t m = 0; m < get_num_mboards(); m++) {
+                auto timekeeper = _get_mbc(m)->get_timekeeper(0);
+                readouts.push_back(std::async(std::launch::async,
+                    [timekeeper]() { return timekeeper->get_time_last_pps(); }));
+            }
+            std::vector<time_spec_t> offsets;
+            for (auto& readout : readouts) {
+                offsets.push_back(readout.get() - last_pps_0);
+            }
+            if (get_time_last_pps(0) == last_pps_0) {
+                return offsets;
+            }
+        }
+        throw uhd::runtime_error("PPS edges occurred while reading the PPS times");
+    }
+
     void set_command_time(
         const uhd::time_spec_t& time_spec, size_t mboard = ALL_MBOARDS) override
     {
@@ -940,6 +1049,45 @@ public:
         }
     }
 
+    void begin_command_batch() override
+    {
+        _graph->begin_command_batch();
+    }
+
+    void end_command_batch() override
+    {
+        _graph->end_command_batch();
+    }
+
+    radio_profile_t capture_profile() override
+    {
+        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        std::vector<size_t> rx_chans(get_rx_num_channels());
+        std::iota(rx_chans.begin(), rx_chans.end(), 0);
+        std::vector<size_t> tx_chans(get_tx_num_channels());
+        std::iota(tx_chans.begin(), tx_chans.end(), 0);
+        return capture_radio_profile(*this, rx_chans, tx_chans);
+    }
+
+    radio_profile_t apply_profile(
+        const radio_profile_t& profile, const time_spec_t& cmd_time) override
+    {
+        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        // While the graph is released, every setting only resolves the
+        // properties of its own block. commit() then propagates all changes
+        // through the graph at once.
+        _graph->release();
+        radio_profile_t diff;
+        try {
+            diff = apply_radio_profile(*this, profile, cmd_time);
+        } catch (...) {
+            _graph->commit();
+            throw;
+        }
+        _graph->commit();
+        return diff;
+    }
+
     void issue_stream_cmd(
         const stream_cmd_t& stream_cmd, size_t chan = ALL_CHANS) override
     {
@@ -1038,6 +1186,11 @@ public:
         return _get_mbc(mboard)->get_sensor_names();
     }
 
+    std::vector<sensor_value_t> get_all_mboard_sensors(size_t mboard = 0) override
+    {
+        return _get_mbc(mboard)->get_all_sensors();
+    }
+
     // This only works on the USRP2 and B100, both of which are not rfnoc_device
     void set_user_register(const uint8_t, const uint32_t, size_t) override
     {
@@ -1187,6 +1340,10 @@ public:
     void set_rx_subdev_spec(
         const uhd::usrp::subdev_spec_t& spec, size_t mboard = ALL_MBOARDS) override
     {
+        // The channel numbers of pooled streamers are about to change
+        if (_rx_streamer_pool) {
+            _rx_streamer_pool->clear();
+        }
         _set_subdev_spec(
             _rx_chans,
             [this](size_t current_mboard) {
@@ -1225,7 +1382,7 @@ public:
 
     std::string get_rx_subdev_name(size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_fe_name(rx_chain.block_chan, uhd::RX_DIRECTION);
     }
 
@@ -1234,7 +1391,7 @@ public:
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
         MUX_RX_API_CALL(set_rx_rate, rate);
         const double actual_rate = [&]() {
-            auto rx_chain = _get_rx_chan(chan);
+            auto& rx_chain = _get_rx_chan(chan);
             if (rx_chain.ddc) {
                 return rx_chain.ddc->set_output_rate(rate, rx_chain.block_chan);
             } else {
@@ -1254,7 +1411,7 @@ public:
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
         MUX_RX_API_CALL(set_rx_spp, spp);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_property<int>(
             "spp", narrow_cast<int>(spp), rx_chain.block_chan);
     }
@@ -1272,7 +1429,7 @@ public:
     meta_range_t get_rx_rates(size_t chan = 0) override
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         if (rx_chain.ddc) {
             return rx_chain.ddc->get_output_rates(rx_chain.block_chan);
         }
@@ -1286,50 +1443,41 @@ public:
 
         // TODO: Add external LO warning
 
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
 
         rx_chain.rf_core->set_rx_tune_args(tune_request.args, rx_chain.block_chan);
-        //------------------------------------------------------------------
-        //-- calculate the tunable frequency ranges of the system
-        //------------------------------------------------------------------
-        freq_range_t tune_range_nonmono =
-            (rx_chain.ddc)
-                ? make_overall_tune_range(
-                    rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan),
-                    rx_chain.ddc->get_frequency_range(rx_chain.block_chan),
-                    rx_chain.rf_core->get_rx_bandwidth(rx_chain.block_chan))
-                : rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan);
-        freq_range_t tune_range = tune_range_nonmono.as_monotonic();
+        return _tune_rx(rx_chain, _get_rx_tune_ranges(rx_chain), tune_request);
+    }
 
-        freq_range_t rf_range =
-            rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan);
-        freq_range_t dsp_range =
-            (rx_chain.ddc) ? rx_chain.ddc->get_frequency_range(rx_chain.block_chan)
-                           : meta_range_t(0.0, 0.0);
-        // Create lambdas to feed to tune_xx_subdev_and_dsp()
-        // Note: If there is no DDC present, register empty lambdas for the DSP
-        // functions
-        auto set_rf_freq = [rx_chain](double freq) {
-            rx_chain.rf_core->set_rx_frequency(freq, rx_chain.block_chan);
-        };
-        auto get_rf_freq = [rx_chain](void) {
-            return rx_chain.rf_core->get_rx_frequency(rx_chain.block_chan);
-        };
-        auto set_dsp_freq = [rx_chain](double freq) {
-            (rx_chain.ddc) ? rx_chain.ddc->set_freq(freq, rx_chain.block_chan) : 0;
-        };
-        auto get_dsp_freq = [rx_chain](void) {
-            return (rx_chain.ddc) ? rx_chain.ddc->get_freq(rx_chain.block_chan) : 0.0;
-        };
-        return tune_xx_subdev_and_dsp(RX_SIGN,
-            tune_range,
-            rf_range,
-            dsp_range,
-            set_rf_freq,
-            get_rf_freq,
-            set_dsp_freq,
-            get_dsp_freq,
-            tune_request);
+    std::vector<tune_result_t> set_rx_freq_schedule(
+        const freq_schedule_t& schedule, size_t chan = 0) override
+    {
+        assert_freq_schedule_sorted(schedule);
+        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        auto& rx_chain = _get_rx_chan(chan);
+
+        std::vector<tune_result_t> results;
+        results.reserve(schedule.size());
+        boost::optional<device_addr_t> ranges_args;
+        tune_ranges_t ranges;
+        try {
+            for (const auto& entry : schedule) {
+                const tune_request_t& tune_request = entry.second;
+                if (!ranges_args || ranges_args.get() != tune_request.args) {
+                    rx_chain.rf_core->set_rx_tune_args(
+                        tune_request.args, rx_chain.block_chan);
+                    ranges      = _get_rx_tune_ranges(rx_chain);
+                    ranges_args = tune_request.args;
+                }
+                _set_rx_chan_command_time(rx_chain, entry.first);
+                results.push_back(_tune_rx(rx_chain, ranges, tune_request));
+            }
+        } catch (...) {
+            _clear_rx_chan_command_time(rx_chain);
+            throw;
+        }
+        _clear_rx_chan_command_time(rx_chain);
+        return results;
     }
 
     double get_rx_freq(size_t chan = 0) override
@@ -1349,7 +1497,7 @@ public:
     {
         auto fe_freq_range = get_fe_rx_freq_range(chan);
 
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         uhd::freq_range_t dsp_freq_range =
             (rx_chain.ddc) ? make_overall_tune_range(get_fe_rx_freq_range(chan),
                 rx_chain.ddc->get_frequency_range(rx_chain.block_chan),
@@ -1360,7 +1508,7 @@ public:
 
     freq_range_t get_fe_rx_freq_range(size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan);
     }
 
@@ -1369,7 +1517,7 @@ public:
      *************************************************************************/
     std::vector<std::string> get_rx_lo_names(size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_lo_names(rx_chain.block_chan);
     }
 
@@ -1378,21 +1526,21 @@ public:
         size_t chan             = 0) override
     {
         MUX_RX_API_CALL(set_rx_lo_source, src, name);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_lo_source(src, name, rx_chain.block_chan);
     }
 
     const std::string get_rx_lo_source(
         const std::string& name = ALL_LOS, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_lo_source(name, rx_chain.block_chan);
     }
 
     std::vector<std::string> get_rx_lo_sources(
         const std::string& name = ALL_LOS, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_lo_sources(name, rx_chain.block_chan);
     }
 
@@ -1400,39 +1548,39 @@ public:
         bool enabled, const std::string& name = ALL_LOS, size_t chan = 0) override
     {
         MUX_RX_API_CALL(set_rx_lo_export_enabled, enabled, name);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_lo_export_enabled(enabled, name, rx_chain.block_chan);
     }
 
     bool get_rx_lo_export_enabled(
         const std::string& name = ALL_LOS, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_lo_export_enabled(name, rx_chain.block_chan);
     }
 
     double set_rx_lo_freq(double freq, const std::string& name, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->set_rx_lo_freq(freq, name, rx_chain.block_chan);
     }
 
     double get_rx_lo_freq(const std::string& name, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_lo_freq(name, rx_chain.block_chan);
     }
 
     freq_range_t get_rx_lo_freq_range(const std::string& name, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_lo_freq_range(name, rx_chain.block_chan);
     }
 
     /*** TX LO API ***/
     std::vector<std::string> get_tx_lo_names(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_lo_names(tx_chain.block_chan);
     }
 
@@ -1441,21 +1589,21 @@ public:
         const size_t chan       = 0) override
     {
         MUX_TX_API_CALL(set_tx_lo_source, src, name);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         tx_chain.radio->set_tx_lo_source(src, name, tx_chain.block_chan);
     }
 
     const std::string get_tx_lo_source(
         const std::string& name = ALL_LOS, const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_lo_source(name, tx_chain.block_chan);
     }
 
     std::vector<std::string> get_tx_lo_sources(
         const std::string& name = ALL_LOS, const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_lo_sources(name, tx_chain.block_chan);
     }
 
@@ -1464,34 +1612,34 @@ public:
         const size_t chan       = 0) override
     {
         MUX_TX_API_CALL(set_tx_lo_export_enabled, enabled, name);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         tx_chain.radio->set_tx_lo_export_enabled(enabled, name, tx_chain.block_chan);
     }
 
     bool get_tx_lo_export_enabled(
         const std::string& name = ALL_LOS, const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_lo_export_enabled(name, tx_chain.block_chan);
     }
 
     double set_tx_lo_freq(
         const double freq, const std::string& name, const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->set_tx_lo_freq(freq, name, tx_chain.block_chan);
     }
 
     double get_tx_lo_freq(const std::string& name, const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_lo_freq(name, tx_chain.block_chan);
     }
 
     freq_range_t get_tx_lo_freq_range(
         const std::string& name, const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_lo_freq_range(name, tx_chain.block_chan);
     }
 
@@ -1501,26 +1649,26 @@ public:
     void set_rx_gain(double gain, const std::string& name, size_t chan = 0) override
     {
         MUX_RX_API_CALL(set_rx_gain, gain, name);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         rx_chain.rf_core->set_rx_gain(gain, name, rx_chain.block_chan);
     }
 
     std::vector<std::string> get_rx_gain_profile_names(const size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_gain_profile_names(rx_chain.block_chan);
     }
 
     void set_rx_gain_profile(const std::string& profile, const size_t chan = 0) override
     {
         MUX_RX_API_CALL(set_rx_gain_profile, profile);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_gain_profile(profile, rx_chain.block_chan);
     }
 
     std::string get_rx_gain_profile(const size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_gain_profile(rx_chain.block_chan);
     }
 
@@ -1656,20 +1804,20 @@ public:
 
     sensor_value_t get_rx_sensor(const std::string& name, size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_sensor(name, rx_chain.block_chan);
     }
 
     std::vector<std::string> get_rx_sensor_names(size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_sensor_names(rx_chain.block_chan);
     }
 
     void set_rx_dc_offset(const bool enb, size_t chan = ALL_CHANS) override
     {
         MUX_RX_API_CALL(set_rx_dc_offset, enb);
-        const auto rx_chain = _get_rx_chan(chan);
+        const auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_dc_offset(enb, rx_chain.block_chan);
     }
 
@@ -1677,20 +1825,20 @@ public:
         const std::complex<double>& offset, size_t chan = ALL_CHANS) override
     {
         MUX_RX_API_CALL(set_rx_dc_offset, offset);
-        const auto rx_chain = _get_rx_chan(chan);
+        const auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_dc_offset(offset, rx_chain.block_chan);
     }
 
     meta_range_t get_rx_dc_offset_range(size_t chan = 0) override
     {
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         return rx_chain.radio->get_rx_dc_offset_range(rx_chain.block_chan);
     }
 
     void set_rx_iq_balance(const bool enb, size_t chan) override
     {
         MUX_RX_API_CALL(set_rx_iq_balance, enb);
-        auto rx_chain = _get_rx_chan(chan);
+        auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_iq_balance(enb, rx_chain.block_chan);
     }
 
@@ -1698,7 +1846,7 @@ public:
         const std::complex<double>& correction, size_t chan = ALL_CHANS) override
     {
         MUX_RX_API_CALL(set_rx_iq_balance, correction);
-        const auto rx_chain = _get_rx_chan(chan);
+        const auto& rx_chain = _get_rx_chan(chan);
         rx_chain.radio->set_rx_iq_balance(correction, rx_chain.block_chan);
     }
 
@@ -1876,6 +2024,9 @@ public:
     void set_tx_subdev_spec(
         const uhd::usrp::subdev_spec_t& spec, size_t mboard = ALL_MBOARDS) override
     {
+        if (_tx_streamer_pool) {
+            _tx_streamer_pool->clear();
+        }
         _set_subdev_spec(
             _tx_chans,
             [this](size_t current_mboard) {
@@ -1914,7 +2065,7 @@ public:
 
     std::string get_tx_subdev_name(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_fe_name(tx_chain.block_chan, uhd::TX_DIRECTION);
     }
 
@@ -1923,7 +2074,7 @@ public:
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
         MUX_TX_API_CALL(set_tx_rate, rate);
         const double actual_rate = [&]() {
-            auto tx_chain = _get_tx_chan(chan);
+            auto& tx_chain = _get_tx_chan(chan);
             if (tx_chain.duc) {
                 return tx_chain.duc->set_input_rate(rate, tx_chain.block_chan);
             } else {
@@ -1952,7 +2103,7 @@ public:
     meta_range_t get_tx_rates(size_t chan = 0) override
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         if (tx_chain.duc) {
             return tx_chain.duc->get_input_rates(tx_chain.block_chan);
         }
@@ -1963,50 +2114,41 @@ public:
         const tune_request_t& tune_request, size_t chan = 0) override
     {
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
 
         tx_chain.rf_core->set_tx_tune_args(tune_request.args, tx_chain.block_chan);
-        //------------------------------------------------------------------
-        //-- calculate the tunable frequency ranges of the system
-        //------------------------------------------------------------------
-        freq_range_t tune_range_nonmono =
-            (tx_chain.duc)
-                ? make_overall_tune_range(
-                    tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan),
-                    tx_chain.duc->get_frequency_range(tx_chain.block_chan),
-                    tx_chain.rf_core->get_tx_bandwidth(tx_chain.block_chan))
-                : tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan);
-        freq_range_t tune_range = tune_range_nonmono.as_monotonic();
+        return _tune_tx(tx_chain, _get_tx_tune_ranges(tx_chain), tune_request);
+    }
 
-        freq_range_t rf_range =
-            tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan);
-        freq_range_t dsp_range =
-            (tx_chain.duc) ? tx_chain.duc->get_frequency_range(tx_chain.block_chan)
-                           : meta_range_t(0.0, 0.0);
-        // Create lambdas to feed to tune_xx_subdev_and_dsp()
-        // Note: If there is no DDC present, register empty lambdas for the DSP
-        // functions
-        auto set_rf_freq = [tx_chain](double freq) {
-            tx_chain.rf_core->set_tx_frequency(freq, tx_chain.block_chan);
-        };
-        auto get_rf_freq = [tx_chain](void) {
-            return tx_chain.rf_core->get_tx_frequency(tx_chain.block_chan);
-        };
-        auto set_dsp_freq = [tx_chain](double freq) {
-            (tx_chain.duc) ? tx_chain.duc->set_freq(freq, tx_chain.block_chan) : 0;
-        };
-        auto get_dsp_freq = [tx_chain](void) {
-            return (tx_chain.duc) ? tx_chain.duc->get_freq(tx_chain.block_chan) : 0.0;
-        };
-        return tune_xx_subdev_and_dsp(TX_SIGN,
-            tune_range,
-            rf_range,
-            dsp_range,
-            set_rf_freq,
-            get_rf_freq,
-            set_dsp_freq,
-            get_dsp_freq,
-            tune_request);
+    std::vector<tune_result_t> set_tx_freq_schedule(
+        const freq_schedule_t& schedule, size_t chan = 0) override
+    {
+        assert_freq_schedule_sorted(schedule);
+        std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        auto& tx_chain = _get_tx_chan(chan);
+
+        std::vector<tune_result_t> results;
+        results.reserve(schedule.size());
+        boost::optional<device_addr_t> ranges_args;
+        tune_ranges_t ranges;
+        try {
+            for (const auto& entry : schedule) {
+                const tune_request_t& tune_request = entry.second;
+                if (!ranges_args || ranges_args.get() != tune_request.args) {
+                    tx_chain.rf_core->set_tx_tune_args(
+                        tune_request.args, tx_chain.block_chan);
+                    ranges      = _get_tx_tune_ranges(tx_chain);
+                    ranges_args = tune_request.args;
+                }
+                _set_tx_chan_command_time(tx_chain, entry.first);
+                results.push_back(_tune_tx(tx_chain, ranges, tune_request));
+            }
+        } catch (...) {
+            _clear_tx_chan_command_time(tx_chain);
+            throw;
+        }
+        _clear_tx_chan_command_time(tx_chain);
+        return results;
     }
 
     double get_tx_freq(size_t chan = 0) override
@@ -2023,7 +2165,7 @@ public:
 
     freq_range_t get_tx_freq_range(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return (tx_chain.duc) ? make_overall_tune_range(get_fe_tx_freq_range(chan),
                    tx_chain.duc->get_frequency_range(tx_chain.block_chan),
                    tx_chain.rf_core->get_tx_bandwidth(tx_chain.block_chan))
@@ -2032,34 +2174,34 @@ public:
 
     freq_range_t get_fe_tx_freq_range(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan);
     }
 
     void set_tx_gain(double gain, const std::string& name, size_t chan = 0) override
     {
         MUX_TX_API_CALL(set_tx_gain, gain, name);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         tx_chain.rf_core->set_tx_gain(gain, name, tx_chain.block_chan);
     }
 
     // TODO: Figure out if gain profiles fit with RF extensions
     std::vector<std::string> get_tx_gain_profile_names(const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_gain_profile_names(tx_chain.block_chan);
     }
 
     void set_tx_gain_profile(const std::string& profile, const size_t chan = 0) override
     {
         MUX_TX_API_CALL(set_tx_gain_profile, profile);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         tx_chain.radio->set_tx_gain_profile(profile, tx_chain.block_chan);
     }
 
     std::string get_tx_gain_profile(const size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_gain_profile(tx_chain.block_chan);
     }
 
@@ -2077,7 +2219,7 @@ public:
 
     double get_tx_gain(const std::string& name, size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.rf_core->get_tx_gain(name, tx_chain.block_chan);
     }
 
@@ -2097,13 +2239,13 @@ public:
 
     gain_range_t get_tx_gain_range(const std::string& name, size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.rf_core->get_tx_gain_range(name, tx_chain.block_chan);
     }
 
     std::vector<std::string> get_tx_gain_names(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.rf_core->get_tx_gain_names(tx_chain.block_chan);
     }
 
@@ -2136,7 +2278,7 @@ public:
     void set_tx_antenna(const std::string& ant, size_t chan = 0) override
     {
         MUX_TX_API_CALL(set_tx_antenna, ant);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         tx_chain.rf_core->set_tx_antenna(ant, tx_chain.block_chan);
     }
 
@@ -2155,19 +2297,19 @@ public:
     void set_tx_bandwidth(double bandwidth, size_t chan = 0) override
     {
         MUX_TX_API_CALL(set_tx_bandwidth, bandwidth);
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         tx_chain.rf_core->set_tx_bandwidth(bandwidth, tx_chain.block_chan);
     }
 
     double get_tx_bandwidth(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.rf_core->get_tx_bandwidth(tx_chain.block_chan);
     }
 
     meta_range_t get_tx_bandwidth_range(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.rf_core->get_tx_bandwidth_range(tx_chain.block_chan);
     }
 
@@ -2179,13 +2321,13 @@ public:
 
     sensor_value_t get_tx_sensor(const std::string& name, size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_sensor(name, tx_chain.block_chan);
     }
 
     std::vector<std::string> get_tx_sensor_names(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_sensor_names(tx_chain.block_chan);
     }
 
@@ -2193,13 +2335,13 @@ public:
         const std::complex<double>& offset, size_t chan = ALL_CHANS) override
     {
         MUX_TX_API_CALL(set_tx_dc_offset, offset);
-        const auto tx_chain = _get_tx_chan(chan);
+        const auto& tx_chain = _get_tx_chan(chan);
         tx_chain.radio->set_tx_dc_offset(offset, tx_chain.block_chan);
     }
 
     meta_range_t get_tx_dc_offset_range(size_t chan = 0) override
     {
-        auto tx_chain = _get_tx_chan(chan);
+        auto& tx_chain = _get_tx_chan(chan);
         return tx_chain.radio->get_tx_dc_offset_range(tx_chain.block_chan);
     }
 
@@ -2207,7 +2349,7 @@ public:
         const std::complex<double>& correction, size_t chan = ALL_CHANS) override
     {
         MUX_TX_API_CALL(set_tx_iq_balance, correction);
-        const auto tx_chain = _get_tx_chan(chan);
+        const auto& tx_chain = _get_tx_chan(chan);
         tx_chain.radio->set_tx_iq_balance(correction, tx_chain.block_chan);
     }
 
@@ -2601,22 +2743,173 @@ private:
         return _graph->get_mb_controller(mb_idx);
     }
 
+    /**************************************************************************
+     * Tuning helpers
+     *************************************************************************/
+    //! The frequency ranges tune_xx_subdev_and_dsp() needs to tune a channel
+    struct tune_ranges_t
+    {
+        freq_range_t tune_range;
+        freq_range_t rf_range;
+        freq_range_t dsp_range;
+    };
+
+    tune_ranges_t _get_rx_tune_ranges(const rx_chan_t& rx_chain)
+    {
+        //------------------------------------------------------------------
+        //-- calculate the tunable frequency ranges of the system
+        //------------------------------------------------------------------
+        freq_range_t tune_range_nonmono =
+            (rx_chain.ddc)
+                ? make_overall_tune_range(
+                    rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan),
+                    rx_chain.ddc->get_frequency_range(rx_chain.block_chan),
+                    rx_chain.rf_core->get_rx_bandwidth(rx_chain.block_chan))
+                : rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan);
+        freq_range_t tune_range = tune_range_nonmono.as_monotonic();
+
+        freq_range_t rf_range =
+            rx_chain.rf_core->get_rx_frequency_range(rx_chain.block_chan);
+        freq_range_t dsp_range =
+            (rx_chain.ddc) ? rx_chain.ddc->get_frequency_range(rx_chain.block_chan)
+                           : meta_range_t(0.0, 0.0);
+        return {tune_range, rf_range, dsp_range};
+    }
+
+    tune_result_t _tune_rx(const rx_chan_t& rx_chain,
+        const tune_ranges_t& ranges,
+        const tune_request_t& tune_request)
+    {
+        // Create lambdas to feed to tune_xx_subdev_and_dsp()
+        // Note: If there is no DDC present, register empty lambdas for the DSP
+        // functions
+        auto set_rf_freq = [rx_chain](double freq) {
+            rx_chain.rf_core->set_rx_frequency(freq, rx_chain.block_chan);
+        };
+        auto get_rf_freq = [rx_chain](void) {
+            return rx_chain.rf_core->get_rx_frequency(rx_chain.block_chan);
+        };
+        auto set_dsp_freq = [rx_chain](double freq) {
+            (rx_chain.ddc) ? rx_chain.ddc->set_freq(freq, rx_chain.block_chan) : 0;
+        };
+        auto get_dsp_freq = [rx_chain](void) {
+            return (rx_chain.ddc) ? rx_chain.ddc->get_freq(rx_chain.block_chan) : 0.0;
+        };
+        return tune_xx_subdev_and_dsp(RX_SIGN,
+            ranges.tune_range,
+            ranges.rf_range,
+            ranges.dsp_range,
+            set_rf_freq,
+            get_rf_freq,
+            set_dsp_freq,
+            get_dsp_freq,
+            tune_request);
+    }
+
+    tune_ranges_t _get_tx_tune_ranges(const tx_chan_t& tx_chain)
+    {
+        //------------------------------------------------------------------
+        //-- calculate the tunable frequency ranges of the system
+        //------------------------------------------------------------------
+        freq_range_t tune_range_nonmono =
+            (tx_chain.duc)
+                ? make_overall_tune_range(
+                    tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan),
+                    tx_chain.duc->get_frequency_range(tx_chain.block_chan),
+                    tx_chain.rf_core->get_tx_bandwidth(tx_chain.block_chan))
+                : tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan);
+        freq_range_t tune_range = tune_range_nonmono.as_monotonic();
+
+        freq_range_t rf_range =
+            tx_chain.rf_core->get_tx_frequency_range(tx_chain.block_chan);
+        freq_range_t dsp_range =
+            (tx_chain.duc) ? tx_chain.duc->get_frequency_range(tx_chain.block_chan)
+                           : meta_range_t(0.0, 0.0);
+        return {tune_range, rf_range, dsp_range};
+    }
+
+    tune_result_t _tune_tx(const tx_chan_t& tx_chain,
+        const tune_ranges_t& ranges,
+        const tune_request_t& tune_request)
+    {
+        // Create lambdas to feed to tune_xx_subdev_and_dsp()
+        // Note: If there is no DDC present, register empty lambdas for the DSP
+        // functions
+        auto set_rf_freq = [tx_chain](double freq) {
+            tx_chain.rf_core->set_tx_frequency(freq, tx_chain.block_chan);
+        };
+        auto get_rf_freq = [tx_chain](void) {
+            return tx_chain.rf_core->get_tx_frequency(tx_chain.block_chan);
+        };
+        auto set_dsp_freq = [tx_chain](double freq) {
+            (tx_chain.duc) ? tx_chain.duc->set_freq(freq, tx_chain.block_chan) : 0;
+        };
+        auto get_dsp_freq = [tx_chain](void) {
+            return (tx_chain.duc) ? tx_chain.duc->get_freq(tx_chain.block_chan) : 0.0;
+        };
+        return tune_xx_subdev_and_dsp(TX_SIGN,
+            ranges.tune_range,
+            ranges.rf_range,
+            ranges.dsp_range,
+            set_rf_freq,
+            get_rf_freq,
+            set_dsp_freq,
+            get_dsp_freq,
+            tune_request);
+    }
+
+    //! Set the command time only on the blocks of one RX channel
+    void _set_rx_chan_command_time(const rx_chan_t& rx_chain, const time_spec_t& time)
+    {
+        rx_chain.radio->set_command_time(time, rx_chain.block_chan);
+        if (rx_chain.ddc) {
+            rx_chain.ddc->set_command_time(time, rx_chain.block_chan);
+        }
+    }
+
+    void _clear_rx_chan_command_time(const rx_chan_t& rx_chain)
+    {
+        rx_chain.radio->clear_command_time(rx_chain.block_chan);
+        if (rx_chain.ddc) {
+            rx_chain.ddc->clear_command_time(rx_chain.block_chan);
+        }
+    }
+
+    //! Set the command time only on the blocks of one TX channel
+    void _set_tx_chan_command_time(const tx_chan_t& tx_chain, const time_spec_t& time)
+    {
+        tx_chain.radio->set_command_time(time, tx_chain.block_chan);
+        if (tx_chain.duc) {
+            tx_chain.duc->set_command_time(time, tx_chain.block_chan);
+        }
+    }
+
+    void _clear_tx_chan_command_time(const tx_chan_t& tx_chain)
+    {
+        tx_chain.radio->clear_command_time(tx_chain.block_chan);
+        if (tx_chain.duc) {
+            tx_chain.duc->clear_command_time(tx_chain.block_chan);
+        }
+    }
+
     rx_chan_t& _get_rx_chan(const size_t chan)
     {
-        if (!_rx_chans.count(chan)) {
+        auto chan_it = _rx_chans.find(chan);
+        if (chan_it == _rx_chans.end()) {
             throw uhd::key_error(
                 std::string("Invalid RX channel: ") + std::to_string(chan));
         }
-        return _rx_chans.at(chan);
+        return chan_it->second;
     }
 
     tx_chan_t& _get_tx_chan(const size_t chan)
     {
-        if (!_tx_chans.count(chan)) {
+        auto chan_it = _tx_chans.find(chan);
+        if (chan_it == _tx_chans.end()) {
             throw uhd::key_error(
                 std::string("Invalid TX channel: ") + std::to_string(chan));
         }
-        return _tx_chans.at(chan);
+        return chan_it->second;
     }
 
     std::vector<graph_edge_t> _connect_rx_chains(std::vector<size_t> chans)
@@ -2640,6 +2933,53 @@ private:
         return edges;
     }
 
+    /*! Let the host AGC of \p rx_streamer control the gain of \p channels
+     *
+     * Every gain change is a timed command on all radio channels. The AGC
+     * starts from the gain of the first channel.
+     */
+    void _connect_host_agc(std::shared_ptr<rfnoc_rx_streamer> rx_streamer,
+        const std::vector<size_t>& channels)
+    {
+        std::vector<std::pair<radio_control::sptr, size_t>> radio_chans;
+        for (const size_t chan : channels) {
+            const auto& rx_chain = _get_rx_chan(chan);
+            radio_chans.emplace_back(rx_chain.radio, rx_chain.block_chan);
+        }
+        const auto& first         = radio_chans.front();
+        const double initial_gain = first.first->get_rx_gain(first.second);
+        const auto gain_range     = first.first->get_rx_gain_range(first.second);
+
+        // Capture the radios rather than this object, the streamer may outlive it
+        rx_streamer->set_agc_gain_fn(
+            [radio_chans](const double gain, const time_spec_t& time) {
+                double coerced_gain = gain;
+                for (const auto& radio_chan : radio_chans) {
+                    radio_chan.first->set_command_time(time, radio_chan.second);
+                    coerced_gain = radio_chan.first->set_rx_gain(gain, radio_chan.second);
+                    radio_chan.first->clear_command_time(radio_chan.second);
+                }
+                return coerced_gain;
+            },
+            initial_gain,
+            gain_range);
+    }
+
+    //! Wait until the time at the last PPS edge of board 0 differs from \p
+    // last_pps, i.e., for the next PPS edge after it was read
+    void _wait_for_pps_edge(const time_spec_t& last_pps)
+    {
+        auto end_time = std::chrono::steady_clock::now() + 1100ms;
+        while (last_pps == get_time_last_pps()) {
+            if (std::chrono::steady_clock::now() > end_time) {
+                throw uhd::runtime_error("Board 0 may not be getting a PPS signal!\n"
+                                         "No PPS detected within the time interval.\n"
+                                         "See the application notes for your device.\n");
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
     std::vector<graph_edge_t> _connect_tx_chain(const size_t chan)
     {
         std::vector<graph_edge_t> edges;
@@ -2661,6 +3001,29 @@ private:
         return edges;
     }
 
+    /*! Return true if a TX streamer for \p args buffers through Replay blocks
+     *
+     * With "streamer=auto", replay buffering is used whenever every channel of
+     * the streamer has a Replay block port mapped to it.
+     */
+    bool _use_replay_buffering(const stream_args_t& args)
+    {
+        const std::string streamer_type = args.args.get("streamer", "");
+        if (streamer_type != "auto") {
+            return streamer_type == "replay_buffered";
+        }
+        const bool replay_buffered =
+            std::all_of(args.channels.cbegin(), args.channels.cend(), [&](size_t chan) {
+                return bool(_get_tx_chan(chan).replay.ctrl);
+            });
+        UHD_LOG_DEBUG("MULTI_USRP",
+            "streamer=auto: "
+                << (replay_buffered ? "Buffering TX stream in Replay block memory"
+                                    : "No Replay block for every channel, "
+                                      "not buffering TX stream"));
+        return replay_buffered;
+    }
+
     std::vector<graph_edge_t> _connect_tx_chain_with_replay(size_t chan)
     {
         std::vector<graph_edge_t> edges;
@@ -2697,6 +3060,43 @@ private:
         return edges;
     }
 
+    /*! Assign the input ports used for striping to the Replay configurations
+     *
+     * Every channel gets num_stripes - 1 additional input ports of its own
+     * Replay block, out of the ports which are not used by any of the channels
+     * in \p replay_configs.
+     */
+    void _assign_replay_stripe_ports(
+        std::vector<replay_config_t>& replay_configs, const size_t num_stripes)
+    {
+        std::map<block_id_t, std::vector<size_t>> free_ports;
+        for (const auto& config : replay_configs) {
+            const auto replay_id = config.ctrl->get_block_id();
+            if (!free_ports.count(replay_id)) {
+                auto& ports = free_ports[replay_id];
+                for (size_t port = 0; port < config.ctrl->get_num_input_ports(); port++) {
+                    ports.push_back(port);
+                }
+            }
+        }
+        for (const auto& config : replay_configs) {
+            auto& ports = free_ports[config.ctrl->get_block_id()];
+            ports.erase(
+                std::remove(ports.begin(), ports.end(), config.port), ports.end());
+        }
+        for (auto& config : replay_configs) {
+            auto& ports = free_ports[config.ctrl->get_block_id()];
+            if (ports.size() < num_stripes - 1) {
+                throw uhd::value_error(
+                    "[multi_usrp] Not enough free ports on "
+                    + config.ctrl->get_block_id().to_string() + " to stripe every "
+                    + "channel across " + std::to_string(num_stripes) + " ports");
+            }
+            config.stripe_ports.assign(ports.begin(), ports.begin() + num_stripes - 1);
+            ports.erase(ports.begin(), ports.begin() + num_stripes - 1);
+        }
+    }
+
     template <typename ChanType,
         typename GetSubdevSpecFn,
         typename GenChansFn,
@@ -2780,6 +3180,10 @@ private:
     std::recursive_mutex _graph_mutex;
 
     std::shared_ptr<redirector_device> _device;
+
+    //! Released streamers which are kept connected for reuse (streamer_pool=N)
+    streamer_pool<rfnoc_rx_streamer>::sptr _rx_streamer_pool;
+    streamer_pool<rfnoc_tx_streamer>::sptr _tx_streamer_pool;
 };
 
 /******************************************************************************
@@ -0,0 +1,228 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/tune_request.hpp>
+#include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/usrp/radio_profile.hpp>
+#include <uhdlib/usrp/multi_usrp_utils.hpp>
+#include <cmath>
+#include <functional>
+
+using namespace uhd::usrp;
+
+namespace {
+
+//! Frequencies, rates and bandwidths closer than this are equal, in Hz
+constexpr double FREQ_TOLERANCE = 1e-3;
+
+//! Gains closer than this are equal, in dB
+constexpr double GAIN_TOLERANCE = 1e-3;
+
+using chan_settings_t = radio_profile_t::chan_settings_t;
+
+//! Copy \p setting into \p diff unless it's equal to \p current
+template <typename value_t, typename equal_fn_t>
+void diff_setting(const boost::optional<value_t>& current,
+    const boost::optional<value_t>& setting,
+    boost::optional<value_t>& diff,
+    equal_fn_t&& equal)
+{
+    if (setting && !(current && equal(current.get(), setting.get()))) {
+        diff = setting;
+    }
+}
+
+chan_settings_t diff_chan_settings(
+    const chan_settings_t& current, const chan_settings_t& settings)
+{
+    auto close_to = [](const double tolerance) {
+        return [tolerance](const double a, const double b) {
+            return std::abs(a - b) < tolerance;
+        };
+    };
+    chan_settings_t diff;
+    diff_setting(current.rate, settings.rate, diff.rate, close_to(FREQ_TOLERANCE));
+    diff_setting(current.freq, settings.freq, diff.freq, close_to(FREQ_TOLERANCE));
+    diff_setting(current.gain, settings.gain, diff.gain, close_to(GAIN_TOLERANCE));
+    diff_setting(current.antenna,
+        settings.antenna,
+        diff.antenna,
+        std::equal_to<std::string>());
+    diff_setting(current.bandwidth,
+        settings.bandwidth,
+        diff.bandwidth,
+        close_to(FREQ_TOLERANCE));
+    return diff;
+}
+
+std::map<size_t, chan_settings_t> diff_chans(
+    const std::map<size_t, chan_settings_t>& current,
+    const std::map<size_t, chan_settings_t>& chans)
+{
+    std::map<size_t, chan_settings_t> diff;
+    for (const auto& chan : chans) {
+        const auto current_it           = current.find(chan.first);
+        const chan_settings_t chan_diff = diff_chan_settings(
+            current_it == current.end() ? chan_settings_t() : current_it->second,
+            chan.second);
+        if (!chan_diff.empty()) {
+            diff[chan.first] = chan_diff;
+        }
+    }
+    return diff;
+}
+
+//! Read one setting, which is left unset if the device doesn't support it
+template <typename value_t, typename get_fn_t>
+void capture_setting(boost::optional<value_t>& setting, get_fn_t&& get)
+{
+    try {
+        setting = get();
+    } catch (const uhd::exception&) {
+        setting = boost::none;
+    }
+}
+
+} // namespace
+
+bool radio_profile_t::chan_settings_t::empty() const
+{
+    return !rate && !freq && !gain && !antenna && !bandwidth;
+}
+
+bool radio_profile_t::empty() const
+{
+    for (const auto& chan : rx) {
+        if (!chan.second.empty()) {
+            return false;
+        }
+    }
+    for (const auto& chan : tx) {
+        if (!chan.second.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+radio_profile_t uhd::usrp::diff_radio_profiles(
+    const radio_profile_t& current, const radio_profile_t& profile)
+{
+    radio_profile_t diff;
+    diff.rx = diff_chans(current.rx, profile.rx);
+    diff.tx = diff_chans(current.tx, profile.tx);
+    return diff;
+}
+
+radio_profile_t uhd::usrp::capture_radio_profile(multi_usrp& usrp,
+    const std::vector<size_t>& rx_chans,
+    const std::vector<size_t>& tx_chans)
+{
+    radio_profile_t profile;
+    for (const size_t chan : rx_chans) {
+        auto& settings = profile.rx[chan];
+        capture_setting(settings.rate, [&]() { return usrp.get_rx_rate(chan); });
+        capture_setting(settings.freq, [&]() { return usrp.get_rx_freq(chan); });
+        capture_setting(settings.gain, [&]() { return usrp.get_rx_gain(chan); });
+        capture_setting(settings.antenna, [&]() { return usrp.get_rx_antenna(chan); });
+        capture_setting(
+            settings.bandwidth, [&]() { return usrp.get_rx_bandwidth(chan); });
+    }
+    for (const size_t chan : tx_chans) {
+        auto& settings = profile.tx[chan];
+        capture_setting(settings.rate, [&]() { return usrp.get_tx_rate(chan); });
+        capture_setting(settings.freq, [&]() { return usrp.get_tx_freq(chan); });
+        capture_setting(settings.gain, [&]() { return usrp.get_tx_gain(chan); });
+        capture_setting(settings.antenna, [&]() { return usrp.get_tx_antenna(chan); });
+        capture_setting(
+            settings.bandwidth, [&]() { return usrp.get_tx_bandwidth(chan); });
+    }
+    return profile;
+}
+
+radio_profile_t uhd::usrp::apply_radio_profile(
+    multi_usrp& usrp, const radio_profile_t& profile, const time_spec_t& cmd_time)
+{
+    std::vector<size_t> rx_chans, tx_chans;
+    for (const auto& chan : profile.rx) {
+        rx_chans.push_back(chan.first);
+    }
+    for (const auto& chan : profile.tx) {
+        tx_chans.push_back(chan.first);
+    }
+    const radio_profile_t diff =
+        diff_radio_profiles(capture_radio_profile(usrp, rx_chans, tx_chans), profile);
+    if (diff.empty()) {
+        return diff;
+    }
+
+    const bool timed = cmd_time != time_spec_t(time_spec_t::ASAP);
+    usrp.begin_command_batch();
+    try {
+        if (timed) {
+            usrp.set_command_time(cmd_time);
+        }
+        // The rates come first, as they change the DSP tuning range. The gains
+        // come last, as the gain tables of some daughterboards depend on the
+        // frequency.
+        for (const auto& chan : diff.rx) {
+            if (chan.second.rate) {
+                usrp.set_rx_rate(chan.second.rate.get(), chan.first);
+            }
+        }
+        for (const auto& chan : diff.tx) {
+            if (chan.second.rate) {
+                usrp.set_tx_rate(chan.second.rate.get(), chan.first);
+            }
+        }
+        for (const auto& chan : diff.rx) {
+            const auto& settings = chan.second;
+            if (settings.antenna) {
+                usrp.set_rx_antenna(settings.antenna.get(), chan.first);
+            }
+            if (settings.bandwidth) {
+                usrp.set_rx_bandwidth(settings.bandwidth.get(), chan.first);
+            }
+            if (settings.freq) {
+                usrp.set_rx_freq(tune_request_t(settings.freq.get()), chan.first);
+            }
+            if (settings.gain) {
+                usrp.set_rx_gain(settings.gain.get(), chan.first);
+            }
+        }
+        for (const auto& chan : diff.tx) {
+            const auto& settings = chan.second;
+            if (settings.antenna) {
+                usrp.set_tx_antenna(settings.antenna.get(), chan.first);
+            }
+            if (settings.bandwidth) {
+                usrp.set_tx_bandwidth(settings.bandwidth.get(), chan.first);
+            }
+            if (settings.freq) {
+                usrp.set_tx_freq(tune_request_t(settings.freq.get()), chan.first);
+            }
+            if (settings.gain) {
+                usrp.set_tx_gain(settings.gain.get(), chan.first);
+            }
+        }
+    } catch (...) {
+        if (timed) {
+            usrp.clear_command_time();
+        }
+        // The error of the setting is more useful than that of the batch
+        try {
+            usrp.end_command_batch();
+        } catch (...) {
+        }
+        throw;
+    }
+    if (timed) {
+        usrp.clear_command_time();
+    }
+    usrp.end_command_batch();
+    return diff;
+}
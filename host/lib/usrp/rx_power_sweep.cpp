@@ -0,0 +1,348 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/types/stream_cmd.hpp>
+#include <uhd/types/tune_request.hpp>
+#include <uhd/usrp/rx_power_sweep.hpp>
+#include <uhdlib/utils/cpu_features.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+#ifdef UHD_RX_POWER_SWEEP_AVX2
+#    include <immintrin.h>
+#endif
+
+using namespace uhd::usrp;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+//! Time from scheduling the first command of a frequency to its execution
+constexpr double CMD_LEAD_TIME = 0.05;
+
+//! Time on top of the scheduled end of a capture until recv() gives up
+constexpr double RECV_TIMEOUT_MARGIN = 1.0;
+
+//! Number of samples which are summed up in single precision. The partial sums
+// are then added up in double precision, so no precision is lost on long
+// measurements.
+constexpr size_t BLOCK_SIZE = 4096;
+
+//! Functions compiled for an instruction set extension, see convert_common.hpp
+#ifdef _MSC_VER
+#    define UHD_RX_POWER_SWEEP_TARGET(isa)
+#else
+#    define UHD_RX_POWER_SWEEP_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+//! The sums of the deviations of the samples from a given mean, and of their
+// squared magnitudes
+struct power_sums_t
+{
+    double re = 0.0;
+    double im = 0.0;
+    double sq = 0.0;
+};
+
+/*! Add the sums of at most BLOCK_SIZE samples minus \p mean to \p sums
+ */
+using sum_fn_t = void (*)(const fc32_t*, const size_t, const fc32_t, power_sums_t&);
+
+void sum_generic(
+    const fc32_t* samps, const size_t num_samps, const fc32_t mean, power_sums_t& sums)
+{
+    float re = 0.0f, im = 0.0f, sq = 0.0f;
+    for (size_t i = 0; i < num_samps; i++) {
+        const float dev_re = samps[i].real() - mean.real();
+        const float dev_im = samps[i].imag() - mean.imag();
+        re += dev_re;
+        im += dev_im;
+        sq += dev_re * dev_re + dev_im * dev_im;
+    }
+    sums.re += re;
+    sums.im += im;
+    sums.sq += sq;
+}
+
+#ifdef UHD_RX_POWER_SWEEP_AVX2
+//! Same as sum_generic(), 4 samples at a time
+UHD_RX_POWER_SWEEP_TARGET("avx2")
+void sum_avx2(
+    const fc32_t* samps, const size_t num_samps, const fc32_t mean, power_sums_t& sums)
+{
+    const float* in     = reinterpret_cast<const float*>(samps);
+    const __m256 mean_v = _mm256_setr_ps(mean.real(),
+        mean.imag(),
+        mean.real(),
+        mean.imag(),
+        mean.real(),
+        mean.imag(),
+        mean.real(),
+        mean.imag());
+    __m256 sum = _mm256_setzero_ps();
+    __m256 sq  = _mm256_setzero_ps();
+    size_t i   = 0;
+    for (; i + 4 <= num_samps; i += 4) {
+        const __m256 dev = _mm256_sub_ps(_mm256_loadu_ps(in + 2 * i), mean_v);
+        sum              = _mm256_add_ps(sum, dev);
+        sq               = _mm256_add_ps(sq, _mm256_mul_ps(dev, dev));
+    }
+    alignas(32) float sum_lanes[8];
+    alignas(32) float sq_lanes[8];
+    _mm256_store_ps(sum_lanes, sum);
+    _mm256_store_ps(sq_lanes, sq);
+    // Even lanes hold real parts, odd lanes imaginary parts
+    for (size_t lane = 0; lane < 8; lane += 2) {
+        sums.re += sum_lanes[lane];
+        sums.im += sum_lanes[lane + 1];
+        sums.sq += sq_lanes[lane] + sq_lanes[lane + 1];
+    }
+    sum_generic(samps + i, num_samps - i, mean, sums);
+}
+#endif
+
+sum_fn_t get_sum_fn()
+{
+#ifdef UHD_RX_POWER_SWEEP_AVX2
+    if (uhd::cpu::has_avx2()) {
+        return &sum_avx2;
+    }
+#endif
+    return &sum_generic;
+}
+
+//! Ends a command batch, also if an exception is thrown during the batch
+class command_batch
+{
+public:
+    explicit command_batch(multi_usrp::sptr usrp) : _usrp(usrp)
+    {
+        _usrp->begin_command_batch();
+    }
+
+    ~command_batch()
+    {
+        if (_open) {
+            try {
+                _usrp->end_command_batch();
+            } catch (...) {
+                // The exception which ends the batch early is more relevant
+            }
+        }
+    }
+
+    void end()
+    {
+        _open = false;
+        _usrp->end_command_batch();
+    }
+
+private:
+    multi_usrp::sptr _usrp;
+    bool _open = true;
+};
+
+} // namespace
+
+double uhd::usrp::get_power_dbfs(const fc32_t* samps, const size_t num_samps)
+{
+    static const sum_fn_t sum_fn = get_sum_fn();
+    if (num_samps == 0) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    const double n = static_cast<double>(num_samps);
+    // Like numpy.var(), compute the mean first, and then the deviations from
+    // it. This doesn't lose precision to a large DC offset. The sum of the
+    // deviations corrects for the rounding error of the mean.
+    power_sums_t sums;
+    for (size_t i = 0; i < num_samps; i += BLOCK_SIZE) {
+        sum_fn(samps + i, std::min(BLOCK_SIZE, num_samps - i), fc32_t(0.0f), sums);
+    }
+    const fc32_t mean(static_cast<float>(sums.re / n), static_cast<float>(sums.im / n));
+    sums = power_sums_t();
+    for (size_t i = 0; i < num_samps; i += BLOCK_SIZE) {
+        sum_fn(samps + i, std::min(BLOCK_SIZE, num_samps - i), mean, sums);
+    }
+    const double variance =
+        sums.sq / n - (sums.re * sums.re + sums.im * sums.im) / (n * n);
+    return 10.0 * std::log10(std::max(variance, 0.0));
+}
+
+class rx_power_sweep_impl : public rx_power_sweep
+{
+public:
+    rx_power_sweep_impl(
+        multi_usrp::sptr usrp, uhd::rx_streamer::sptr streamer, const size_t chan)
+        : _usrp(usrp), _streamer(streamer), _chan(chan)
+    {
+        if (_streamer->get_num_channels() != 1) {
+            throw uhd::value_error(
+                "RX power sweep: The streamer must stream one channel only");
+        }
+        set_num_samps(1000000);
+    }
+
+    void set_num_samps(const size_t num_samps) override
+    {
+        if (num_samps == 0) {
+            throw uhd::value_error("RX power sweep: Number of samples must not be zero");
+        }
+        _buff.resize(num_samps);
+    }
+
+    size_t get_num_samps() const override
+    {
+        return _buff.size();
+    }
+
+    void set_tune_settling_time(const double settling_time) override
+    {
+        _tune_settling_time = std::max(settling_time, 0.0);
+    }
+
+    double get_tune_settling_time() const override
+    {
+        return _tune_settling_time;
+    }
+
+    void set_gain_settling_time(const double settling_time) override
+    {
+        _gain_settling_time = std::max(settling_time, 0.0);
+    }
+
+    double get_gain_settling_time() const override
+    {
+        return _gain_settling_time;
+    }
+
+    double measure() override
+    {
+        _issue_capture(uhd::time_spec_t::ASAP);
+        _receive(RECV_TIMEOUT_MARGIN + _get_capture_time());
+        return get_power_dbfs(_buff.data(), _buff.size());
+    }
+
+    results_t run(
+        const std::vector<double>& freqs, const std::vector<double>& gains) override
+    {
+        results_t results;
+        if (gains.empty()) {
+            return results;
+        }
+        const double capture_time = _get_capture_time();
+        // A capture may have to wait for the previous one, and for settling
+        const double timeout = CMD_LEAD_TIME + _tune_settling_time + _gain_settling_time
+                               + 2 * capture_time + RECV_TIMEOUT_MARGIN;
+        for (const double freq : freqs) {
+            // Tune once all captures of the previous frequency were received,
+            // so a tune which waits for the device can't stall them
+            auto batch = std::make_unique<command_batch>(_usrp);
+
+            uhd::time_spec_t step_time = _usrp->get_time_now() + CMD_LEAD_TIME;
+            _usrp->set_command_time(step_time);
+            _usrp->set_rx_freq(uhd::tune_request_t(freq), _chan);
+            _usrp->set_rx_gain(gains.front(), _chan);
+            _usrp->clear_command_time();
+            uhd::time_spec_t capture_start = step_time + _tune_settling_time;
+            _issue_capture(capture_start);
+
+            auto& gain_results = results[freq];
+            for (size_t i = 0; i < gains.size(); i++) {
+                // Schedule the next step, so the device settles and captures
+                // while this step is received
+                if (i + 1 < gains.size()) {
+                    step_time = capture_start + capture_time;
+                    _usrp->set_command_time(step_time);
+                    _usrp->set_rx_gain(gains[i + 1], _chan);
+                    _usrp->clear_command_time();
+                    capture_start = step_time + _gain_settling_time;
+                    _issue_capture(capture_start);
+                }
+                _receive(timeout);
+                // By now, the commands of the next step have been executed,
+                // so ending the batch doesn't wait for long
+                batch->end();
+                if (i + 1 < gains.size()) {
+                    batch = std::make_unique<command_batch>(_usrp);
+                }
+                gain_results[gains[i]] = get_power_dbfs(_buff.data(), _buff.size());
+            }
+        }
+        return results;
+    }
+
+private:
+    double _get_capture_time() const
+    {
+        return _buff.size() / _usrp->get_rx_rate(_chan);
+    }
+
+    void _issue_capture(const uhd::time_spec_t& start_time)
+    {
+        uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+        stream_cmd.num_samps  = _buff.size();
+        stream_cmd.stream_now = (start_time == uhd::time_spec_t::ASAP);
+        stream_cmd.time_spec  = start_time;
+        _streamer->issue_stream_cmd(stream_cmd);
+    }
+
+    void _receive(const double timeout)
+    {
+        size_t num_samps = 0;
+        while (num_samps < _buff.size()) {
+            uhd::rx_metadata_t md;
+            num_samps += _streamer->recv(
+                _buff.data() + num_samps, _buff.size() - num_samps, md, timeout);
+            if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+                throw uhd::runtime_error("RX power sweep: " + md.strerror());
+            }
+            if (md.end_of_burst && num_samps < _buff.size()) {
+                throw uhd::runtime_error(
+                    "RX power sweep: Did not receive the correct number of samples");
+            }
+        }
+    }
+
+    multi_usrp::sptr _usrp;
+    uhd::rx_streamer::sptr _streamer;
+    const size_t _chan;
+    double _tune_settling_time = 0.1;
+    double _gain_settling_time = 0.1;
+
+    //! One capture
+    std::vector<fc32_t> _buff;
+};
+
+void rx_power_sweep::add_power_tables(
+    uhd::usrp::cal::pwr_cal::sptr cal, const results_t& results)
+{
+    for (const auto& freq_results : results) {
+        if (freq_results.second.empty()) {
+            continue;
+        }
+        const auto limits = std::minmax_element(freq_results.second.cbegin(),
+            freq_results.second.cend(),
+            [](const std::pair<const double, double>& lhs,
+                const std::pair<const double, double>& rhs) {
+                return lhs.second < rhs.second;
+            });
+        cal->add_power_table(freq_results.second,
+            limits.first->second,
+            limits.second->second,
+            freq_results.first);
+    }
+}
+
+rx_power_sweep::sptr rx_power_sweep::make(
+    multi_usrp::sptr usrp, uhd::rx_streamer::sptr streamer, const size_t chan)
+{
+    return std::make_shared<rx_power_sweep_impl>(usrp, streamer, chan);
+}
@@ -0,0 +1,42 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/usrp/rx_power_sweep.hpp>
+#include <pybind11/numpy.h>
+
+void export_rx_power_sweep(py::module& m)
+{
+    using rx_power_sweep = uhd::usrp::rx_power_sweep;
+    using fc32_array_t   = py::array_t<std::complex<float>,
+        py::array::c_style | py::array::forcecast>;
+
+    m.def("get_power_dbfs", [](fc32_array_t samps) {
+        return uhd::usrp::get_power_dbfs(samps.data(), samps.size());
+    });
+
+    py::class_<rx_power_sweep, rx_power_sweep::sptr>(m, "rx_power_sweep")
+        .def(py::init(&rx_power_sweep::make),
+            py::arg("usrp"),
+            py::arg("streamer"),
+            py::arg("chan") = 0)
+        .def("set_num_samps", &rx_power_sweep::set_num_samps)
+        .def("get_num_samps", &rx_power_sweep::get_num_samps)
+        .def("set_tune_settling_time", &rx_power_sweep::set_tune_settling_time)
+        .def("get_tune_settling_time", &rx_power_sweep::get_tune_settling_time)
+        .def("set_gain_settling_time", &rx_power_sweep::set_gain_settling_time)
+        .def("get_gain_settling_time", &rx_power_sweep::get_gain_settling_time)
+        .def("measure",
+            &rx_power_sweep::measure,
+            py::call_guard<py::gil_scoped_release>())
+        .def("run",
+            &rx_power_sweep::run,
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("freqs"),
+            py::arg("gains"))
+        .def_static("add_power_tables", &rx_power_sweep::add_power_tables);
+}
@@ -502,11 +502,8 @@ rx_streamer::sptr usrp2_impl::get_rx_stream(const uhd::stream_args_t& args_)
                     spp); // seems to be a good place to set this
                 _mbc[mb].rx_dsps[dsp]->setup(args);
                 this->program_stream_dest(_mbc[mb].rx_dsp_xports[dsp], args);
-                my_streamer->set_xport_chan_get_buff(chan_i,
-                    std::bind(&zero_copy_if::get_recv_buff,
-                        _mbc[mb].rx_dsp_xports[dsp],
-                        std::placeholders::_1),
-                    true /*flush*/);
+                my_streamer->set_xport_chan_get_buff(
+                    chan_i, _mbc[mb].rx_dsp_xports[dsp], true /*flush*/);
                 my_streamer->set_issue_stream_cmd(chan_i,
                     std::bind(&rx_dsp_core_200::issue_stream_command,
                         _mbc[mb].rx_dsps[dsp],
@@ -125,6 +125,57 @@ uhd_error uhd_rx_streamer_recv(uhd_rx_streamer_handle h,
             buffs_cpp, samps_per_buff, (*md)->rx_metadata_cpp, timeout, one_packet);)
 }
 
+uhd_error uhd_rx_streamer_recv_fast(uhd_rx_streamer_handle h,
+    void** buffs,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle* md,
+    double timeout,
+    bool one_packet,
+    size_t* items_recvd)
+{
+    UHD_SAFE_C_SAVE_ERROR_ON_EXCEPT(
+        h, uhd::rx_streamer::buffs_type buffs_cpp(buffs, h->streamer->get_num_channels());
+        *items_recvd = h->streamer->recv(
+            buffs_cpp, samps_per_buff, (*md)->rx_metadata_cpp, timeout, one_packet);)
+}
+
+static size_t _rx_streamer_recv_batch(const uhd::rx_streamer::sptr& streamer,
+    void** buffs,
+    size_t num_buffs,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle* md,
+    double timeout,
+    size_t* items_recvd)
+{
+    const size_t num_channels = streamer->get_num_channels();
+    for (size_t i = 0; i < num_buffs; i++) {
+        uhd::rx_streamer::buffs_type buffs_cpp(buffs + i * num_channels, num_channels);
+        uhd::rx_metadata_t& md_cpp = md[i]->rx_metadata_cpp;
+        items_recvd[i] = streamer->recv(buffs_cpp, samps_per_buff, md_cpp, timeout);
+        if (items_recvd[i] < samps_per_buff
+            || md_cpp.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE
+            || md_cpp.end_of_burst) {
+            return i + 1;
+        }
+    }
+    return num_buffs;
+}
+
+uhd_error uhd_rx_streamer_recv_batch(uhd_rx_streamer_handle h,
+    void** buffs,
+    size_t num_buffs,
+    size_t samps_per_buff,
+    uhd_rx_metadata_handle* md,
+    double timeout,
+    size_t* items_recvd,
+    size_t* num_buffs_recvd)
+{
+    UHD_SAFE_C_SAVE_ERROR_ON_EXCEPT(
+        h, *num_buffs_recvd = 0;
+        *num_buffs_recvd = _rx_streamer_recv_batch(
+            h->streamer, buffs, num_buffs, samps_per_buff, md, timeout, items_recvd);)
+}
+
 uhd_error uhd_rx_streamer_issue_stream_cmd(
     uhd_rx_streamer_handle h, const uhd_stream_cmd_t* stream_cmd)
 {
@@ -180,6 +231,19 @@ uhd_error uhd_tx_streamer_send(uhd_tx_streamer_handle h,
             buffs_cpp, samps_per_buff, (*md)->tx_metadata_cpp, timeout);)
 }
 
+uhd_error uhd_tx_streamer_send_fast(uhd_tx_streamer_handle h,
+    const void** buffs,
+    size_t samps_per_buff,
+    uhd_tx_metadata_handle* md,
+    double timeout,
+    size_t* items_sent)
+{
+    UHD_SAFE_C_SAVE_ERROR_ON_EXCEPT(
+        h, uhd::tx_streamer::buffs_type buffs_cpp(buffs, h->streamer->get_num_channels());
+        *items_sent = h->streamer->send(
+            buffs_cpp, samps_per_buff, (*md)->tx_metadata_cpp, timeout);)
+}
+
 uhd_error uhd_tx_streamer_recv_async_msg(uhd_tx_streamer_handle h,
     uhd_async_metadata_handle* md,
     const double timeout,
@@ -165,14 +165,26 @@ uint32_t x300_dboard_iface::read_gpio(unit_t unit)
  **********************************************************************/
 void x300_dboard_iface::write_spi(
     unit_t unit, const spi_config_t& config, uint32_t data, size_t num_bits)
+{
+    _config.spi->write_spi(_get_spi_slave(unit), config, data, num_bits);
+}
+
+void x300_dboard_iface::multi_write_spi(unit_t unit,
+    const spi_config_t& config,
+    const std::vector<uint32_t>& data,
+    size_t num_bits)
+{
+    _config.spi->multi_write_spi(_get_spi_slave(unit), config, data, num_bits);
+}
+
+int x300_dboard_iface::_get_spi_slave(const unit_t unit) const
 {
     uint32_t slave = 0;
     if (unit == UNIT_TX)
         slave |= _config.tx_spi_slaveno;
     if (unit == UNIT_RX)
         slave |= _config.rx_spi_slaveno;
-
-    _config.spi->write_spi(int(slave), config, data, num_bits);
+    return int(slave);
 }
 
 uint32_t x300_dboard_iface::read_write_spi(
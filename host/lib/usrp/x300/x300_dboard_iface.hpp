@@ -77,6 +77,11 @@ public:
         uint32_t data,
         size_t num_bits) override;
 
+    void multi_write_spi(unit_t unit,
+        const uhd::spi_config_t& config,
+        const std::vector<uint32_t>& data,
+        size_t num_bits) override;
+
     uint32_t read_write_spi(unit_t unit,
         const uhd::spi_config_t& config,
         uint32_t data,
@@ -99,6 +104,8 @@ private:
     uhd::dict<unit_t, double> _clock_rates;
     uhd::dict<std::string, rx_frontend_core_3000::sptr> _rx_fes;
     void _write_aux_dac(unit_t);
+    //! The SPI slave select bits of a unit
+    int _get_spi_slave(const unit_t unit) const;
 };
 
 
@@ -37,6 +37,7 @@ public:
         , _blank_eeprom("blank_eeprom", false)
         , _enable_tx_dual_eth("enable_tx_dual_eth", false)
         , _use_dpdk("use_dpdk", false)
+        , _use_rio("use_rio", false)
         , _fpga_option("fpga", "")
         , _download_fpga("download-fpga", false)
         , _recv_frame_size("recv_frame_size", DATA_FRAME_MAX_SIZE)
@@ -125,6 +126,10 @@ public:
     {
         return _use_dpdk.get();
     }
+    bool get_use_rio() const
+    {
+        return _use_rio.get();
+    }
     std::string get_fpga_option() const
     {
         return _fpga_option.get();
@@ -258,6 +263,15 @@ private:
 #else
             UHD_LOG_WARNING(
                 "DPDK", "Detected use_dpdk argument, but DPDK support not built in.");
+#endif
+        }
+        if (dev_args.has_key("use_rio")) {
+#ifdef UHD_PLATFORM_WIN32
+            _use_rio.set(true);
+#else
+            UHD_LOG_WARNING("X300",
+                "Detected use_rio argument, but Registered I/O is only available on "
+                "Windows.");
 #endif
         }
         PARSE_DEFAULT(_recv_frame_size)
@@ -290,6 +304,7 @@ private:
     constrained_device_args_t::bool_arg _blank_eeprom;
     constrained_device_args_t::bool_arg _enable_tx_dual_eth;
     constrained_device_args_t::bool_arg _use_dpdk;
+    constrained_device_args_t::bool_arg _use_rio;
     constrained_device_args_t::str_arg<true> _fpga_option;
     constrained_device_args_t::bool_arg _download_fpga;
     constrained_device_args_t::num_arg<size_t> _recv_frame_size;
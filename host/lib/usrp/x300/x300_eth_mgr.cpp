@@ -29,6 +29,9 @@
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef UHD_PLATFORM_WIN32
+#    include <uhdlib/transport/udp_rio_link.hpp>
+#endif
 #include <boost/asio.hpp>
 #include <string>
 
@@ -219,10 +222,9 @@ both_links_t eth_manager::get_links(link_type_t link_type,
         UHD_LOG_ERROR("X300", err_msg);
         throw uhd::runtime_error(err_msg);
     }
-    // FIXME: We now need to properly associate local_device_id with the right
-    // entry in eth_conn. We should probably do the load balancing elsewhere,
-    // and do something like this:
-    // However, we might also have to make sure that we don't do 2x TX through
+    // The graph stream manager balances the data streams across the local
+    // device IDs (i.e., the entries in eth_conns) by their expected rate.
+    // FIXME: We might also have to make sure that we don't do 2x TX through
     // a DMA FIFO, which is a device-specific thing. So punt on that for now.
 
     x300_eth_conn_t conn = eth_conns[local_device_id];
@@ -253,6 +255,13 @@ both_links_t eth_manager::get_links(link_type_t link_type,
             default_link_params.recv_buff_size / default_link_params.recv_frame_size;
     }
 #endif
+#ifdef UHD_PLATFORM_WIN32
+    // Registered I/O buffers in its receive frames, not in the socket buffer
+    if (_args.get_use_rio()) {
+        default_link_params.num_recv_frames =
+            default_link_params.recv_buff_size / default_link_params.recv_frame_size;
+    }
+#endif
 
     link_params_t link_params = calculate_udp_link_params(link_type,
         get_mtu(uhd::TX_DIRECTION),
@@ -261,6 +270,20 @@ both_links_t eth_manager::get_links(link_type_t link_type,
         _args.get_orig_args(),
         link_args);
 
+    // The graph gives every data link its share of the memory_budget stream
+    // argument
+    if (link_args.has_key("link_memory_budget")) {
+        bool frames_buffer = _args.get_use_dpdk();
+#ifdef UHD_PLATFORM_WIN32
+        frames_buffer = frames_buffer || _args.get_use_rio();
+#endif
+        apply_udp_link_memory_budget(link_params,
+            link_type,
+            link_args.cast<uint64_t>("link_memory_budget", 0),
+            link_args,
+            frames_buffer);
+    }
+
     // Enforce a minimum bound of the number of receive and send frames.
     link_params.num_send_frames =
         std::max(uhd::rfnoc::MIN_NUM_FRAMES, link_params.num_send_frames);
@@ -282,6 +305,25 @@ both_links_t eth_manager::get_links(link_type_t link_type,
         UHD_LOG_WARNING("X300", "Cannot create DPDK transport, falling back to UDP");
 #endif
     }
+#ifdef UHD_PLATFORM_WIN32
+    if (_args.get_use_rio()) {
+        try {
+            auto link = uhd::transport::udp_rio_link::make(
+                conn.addr, BOOST_STRINGIZE(X300_VITA_UDP_PORT), link_params);
+            return std::make_tuple(link,
+                link_params.send_buff_size,
+                link,
+                link_params.recv_buff_size,
+                lossy_xport,
+                false,
+                enable_fc);
+        } catch (const uhd::runtime_error& ex) {
+            UHD_LOG_WARNING("X300",
+                "Cannot create Registered I/O transport, falling back to UDP: "
+                    << ex.what());
+        }
+    }
+#endif
     auto link = uhd::transport::udp_boost_asio_link::make(conn.addr,
         BOOST_STRINGIZE(X300_VITA_UDP_PORT),
         link_params,
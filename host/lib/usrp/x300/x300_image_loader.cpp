@@ -22,6 +22,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
+#include <algorithm>
 #include <fstream>
 #include <vector>
 
@@ -42,6 +43,8 @@ using namespace uhd::transport;
 #define X300_FPGA_SECTOR_START 32
 #define X300_MAX_RESPONSE_BYTES 128
 #define UDP_TIMEOUT 3
+#define UDP_DRAIN_TIMEOUT 0.1
+#define X300_DEFAULT_WRITE_WINDOW 8
 #define FPGA_LOAD_TIMEOUT 15
 
 /*
@@ -88,6 +91,7 @@ typedef struct
     bool configure; // Reload FPGA after burning to flash (Ethernet only)
     bool verify; // Device will verify the download along the way (Ethernet only)
     bool download; // Host will read the FPGA image on the device to a file
+    size_t window; // Max. number of write packets in flight (Ethernet only)
     bool lvbitx;
     uhd::device_addr_t dev_addr;
     std::string ip_addr;
@@ -213,6 +217,8 @@ static void x300_setup_session(x300_session_t& session,
             session.ip_addr, BOOST_STRINGIZE(X300_FPGA_READ_UDP_PORT));
         session.verify   = args.has_key("verify");
         session.download = args.has_key("download");
+        session.window   = std::max<size_t>(
+            1, args.cast<size_t>("window", X300_DEFAULT_WRITE_WINDOW));
     } else {
         session.resource = session.dev_addr["resource"];
         session.rpc_port = args.get("rpc-port", "5444");
@@ -287,6 +293,55 @@ static UHD_INLINE size_t x300_send_and_recv(udp_simple::sptr xport,
     return xport->recv(boost::asio::buffer(data, udp_simple::mtu), UDP_TIMEOUT);
 }
 
+/*
+ * Send a batch of write packets without waiting for the replies in between,
+ * then collect one reply per packet. The replies don't identify the packet
+ * they belong to, so if any of them is missing, the whole batch is sent again,
+ * one packet per round trip. Writing the same data to the flash again is
+ * harmless, but that is why a batch must not contain an erase packet.
+ *
+ * Returns false if the batch had to be sent again.
+ */
+static bool x300_send_batch(udp_simple::sptr xport,
+    const std::vector<x300_fpga_update_data_t>& pkts,
+    const size_t first,
+    const size_t last,
+    uint8_t* data)
+{
+    const x300_fpga_update_data_t* pkt_in =
+        reinterpret_cast<const x300_fpga_update_data_t*>(data);
+
+    for (size_t i = first; i < last; i++) {
+        xport->send(boost::asio::buffer(&pkts[i], sizeof(pkts[i])));
+    }
+    size_t num_replies = 0;
+    for (; num_replies < last - first; num_replies++) {
+        if (xport->recv(boost::asio::buffer(data, udp_simple::mtu), UDP_TIMEOUT) == 0) {
+            break;
+        }
+        if (ntohl(pkt_in->flags) & X300_FPGA_PROG_FLAGS_ERROR) {
+            throw uhd::runtime_error("Device reported an error.");
+        }
+    }
+    if (num_replies == last - first) {
+        return true;
+    }
+
+    // Discard late replies, so they aren't taken for replies to the resent
+    // packets
+    while (xport->recv(boost::asio::buffer(data, udp_simple::mtu), UDP_DRAIN_TIMEOUT)) {
+    }
+    for (size_t i = first; i < last; i++) {
+        xport->send(boost::asio::buffer(&pkts[i], sizeof(pkts[i])));
+        if (xport->recv(boost::asio::buffer(data, udp_simple::mtu), UDP_TIMEOUT) == 0) {
+            throw uhd::runtime_error("Timed out waiting for reply from device.");
+        } else if (ntohl(pkt_in->flags) & X300_FPGA_PROG_FLAGS_ERROR) {
+            throw uhd::runtime_error("Device reported an error.");
+        }
+    }
+    return false;
+}
+
 static UHD_INLINE bool x300_recv_ok(const x300_fpga_update_data_t* pkt_in, size_t len)
 {
     return (len > 0
@@ -333,6 +388,8 @@ static void x300_ethernet_load(x300_session_t& session)
     size_t current_pos = 0;
     size_t sectors     = (session.size / X300_FLASH_SECTOR_SIZE);
     std::ifstream image(session.filepath.c_str(), std::ios::binary);
+    std::vector<x300_fpga_update_data_t> sector_pkts;
+    size_t window = session.window;
 
     // Each sector
     for (size_t i = 0; i < session.size; i += X300_FLASH_SECTOR_SIZE) {
@@ -344,6 +401,7 @@ static void x300_ethernet_load(x300_session_t& session)
                   << std::flush;
 
         // Each packet
+        sector_pkts.clear();
         for (size_t j = i; (j < session.size and j < (i + X300_FLASH_SECTOR_SIZE));
              j += X300_PACKET_SIZE_BYTES) {
             flags = X300_FPGA_PROG_FLAGS_ACK;
@@ -377,17 +435,34 @@ static void x300_ethernet_load(x300_session_t& session)
                 pkt_out.data16[k] = htonx<uint16_t>(pkt_out.data16[k]);
             }
 
-            len =
-                x300_send_and_recv(session.write_xport, flags, &pkt_out, session.data_in);
+            pkt_out.flags = htonx<uint32_t>(flags);
+            sector_pkts.push_back(pkt_out);
+        }
+
+        // The sector must be erased before any other packet is written to it,
+        // so the first packet is sent on its own. The others are sent in
+        // batches of up to window packets. Batches which need to be sent again
+        // halve the window.
+        try {
+            pkt_out = sector_pkts.front();
+            len     = x300_send_and_recv(
+                session.write_xport, ntohl(pkt_out.flags), &pkt_out, session.data_in);
             if (len == 0) {
-                if (!session.lvbitx)
-                    image.close();
                 throw uhd::runtime_error("Timed out waiting for reply from device.");
             } else if ((ntohl(pkt_in->flags) & X300_FPGA_PROG_FLAGS_ERROR)) {
-                if (!session.lvbitx)
-                    image.close();
                 throw uhd::runtime_error("Device reported an error.");
             }
+            for (size_t first = 1; first < sector_pkts.size(); first += window) {
+                const size_t last = std::min(first + window, sector_pkts.size());
+                if (!x300_send_batch(
+                        session.write_xport, sector_pkts, first, last, session.data_in)) {
+                    window = std::max<size_t>(1, window / 2);
+                }
+            }
+        } catch (const uhd::runtime_error&) {
+            if (!session.lvbitx)
+                image.close();
+            throw;
         }
     }
     if (!session.lvbitx) {
@@ -6,6 +6,7 @@
 
 #include "x300_impl.hpp"
 #include <uhdlib/rfnoc/device_id.hpp>
+#include <uhdlib/usrp/common/io_service_args.hpp>
 
 using namespace uhd::rfnoc;
 using uhd::transport::link_type_t;
@@ -212,6 +213,8 @@ uhd::rfnoc::chdr_rx_data_xport::uptr x300_impl::x300_mb_iface::make_rx_data_tran
 
     cfg_io_srv.reset();
 
+    uhd::rfnoc::chdr_rx_data_xport::read_adaptive_fc_args(xport_args, fc_params);
+
     // Connect the links to an I/O service
     auto io_srv = get_io_srv_mgr()->connect_links(recv_link,
         send_link,
@@ -277,7 +280,7 @@ uhd::rfnoc::chdr_tx_data_xport::uptr x300_impl::x300_mb_iface::make_tx_data_tran
 
     auto io_srv_mgr = this->get_io_srv_mgr();
 
-    const auto buff_capacity = chdr_tx_data_xport::configure_sep(cfg_io_srv,
+    auto fc_params = chdr_tx_data_xport::configure_sep(cfg_io_srv,
         recv_link,
         send_link,
         _pkt_factory,
@@ -293,6 +296,11 @@ uhd::rfnoc::chdr_tx_data_xport::uptr x300_impl::x300_mb_iface::make_tx_data_tran
 
     cfg_io_srv.reset();
 
+    // Process the strs packets on a thread of the transport, if requested
+    fc_params.fc_offload =
+        uhd::usrp::read_io_service_args(xport_args, get_default_io_srv_args())
+            .send_fc_offload;
+
     // Connect the links to an I/O service
     auto io_srv = get_io_srv_mgr()->connect_links(recv_link,
         send_link,
@@ -308,7 +316,7 @@ uhd::rfnoc::chdr_tx_data_xport::uptr x300_impl::x300_mb_iface::make_tx_data_tran
         _pkt_factory,
         epids,
         send_link->get_num_send_frames(),
-        buff_capacity,
+        fc_params,
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
         });
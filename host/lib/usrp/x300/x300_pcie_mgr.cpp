@@ -39,6 +39,8 @@ constexpr uint32_t RADIO_DEST_PREFIX_TX = 0;
 // size aligned to it.
 constexpr size_t PCIE_RX_DATA_FRAME_SIZE = 4096; // bytes
 constexpr size_t PCIE_RX_DATA_NUM_FRAMES = 4096;
+// Number of RX data frames to acquire from, and grant back to, the DMA FIFO at once
+constexpr size_t PCIE_RX_DATA_BATCH_SIZE = 16;
 constexpr size_t PCIE_TX_DATA_FRAME_SIZE = 4096; // bytes
 constexpr size_t PCIE_TX_DATA_NUM_FRAMES = 4096;
 constexpr size_t PCIE_MSG_FRAME_SIZE     = 256; // bytes
@@ -69,6 +71,7 @@ link_params_t get_default_link_params(const link_type_t link_type)
             link_params.recv_frame_size = PCIE_RX_DATA_FRAME_SIZE;
             link_params.num_send_frames = PCIE_MSG_NUM_FRAMES;
             link_params.num_recv_frames = PCIE_RX_DATA_NUM_FRAMES;
+            link_params.recv_batch_size = PCIE_RX_DATA_BATCH_SIZE;
             break;
         default:
             UHD_THROW_INVALID_CODE_PATH();
@@ -150,7 +150,11 @@ public:
                 const uint32_t addr) { return regs().peek32(addr, get_command_time(0)); },
             x300_regs::SR_SPI,
             8,
-            x300_regs::RB_SPI);
+            x300_regs::RB_SPI,
+            [this](const std::vector<uint32_t>& addrs,
+                const std::vector<uint32_t>& values) {
+                regs().multi_poke32(addrs, values, get_command_time(0));
+            });
         // DAC/ADC
         RFNOC_LOG_TRACE("Running init_codec...");
         // Note: ADC calibration and DAC sync happen in x300_mb_controller
@@ -161,7 +165,8 @@ public:
         _fp_gpio = gpio_atr::gpio_atr_3000::make(_wb_iface,
             gpio_atr::gpio_atr_offsets::make_default(x300_regs::SR_FP_GPIO,
                 x300_regs::RB_FP_GPIO,
-                x300_regs::PERIPH_REG_OFFSET));
+                x300_regs::PERIPH_REG_OFFSET),
+            [this]() { return regs().get_cmd_fifo_free_slots(true); });
         // Create the GPIO banks and attributes, and populate them with some default
         // values
         // TODO: Do we need this section? Since the _fp_gpio handles state now, we
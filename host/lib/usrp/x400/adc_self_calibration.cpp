@@ -5,28 +5,156 @@
 //
 
 #include "adc_self_calibration.hpp"
+#include <uhd/cal/database.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/scope_exit.hpp>
 #include <chrono>
+#include <cmath>
+#include <sstream>
 #include <thread>
 
 using namespace std::chrono_literals;
 
+namespace {
+
+//! Cal database key for the stored ADC self calibration results
+constexpr char ADC_SELF_CAL_KEY[] = "x4xx_adc_self_cal";
+//! Version of the format below, bump when it changes
+constexpr uint32_t ADC_SELF_CAL_VERSION = 1;
+//! Number of calibration blocks per ADC (OCB1, OCB2, GCB, TSCB)
+constexpr size_t NUM_CAL_BLOCKS = 4;
+//! Number of coefficients per calibration block
+constexpr size_t NUM_CAL_COEFS = 8;
+//! Width of the temperature ranges which share calibration results
+constexpr double TEMPERATURE_BUCKET_SIZE = 10.0;
+
+/* The stored results are a list of little-endian uint32 values: The format
+ * version, and the coefficients of all calibration blocks.
+ */
+void append_u32(std::vector<uint8_t>& data, const uint32_t value)
+{
+    for (size_t i = 0; i < 4; i++) {
+        data.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint32_t get_u32(const std::vector<uint8_t>& data, const size_t idx)
+{
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; i++) {
+        value |= uint32_t(data.at(4 * idx + i)) << (8 * i);
+    }
+    return value;
+}
+
+} // namespace
+
 namespace uhd { namespace features {
 
 adc_self_calibration::adc_self_calibration(uhd::usrp::x400_rpc_iface::sptr rpcc,
     const std::string rpc_prefix,
     const std::string unique_id,
     size_t db_number,
-    uhd::usrp::x400::x400_dboard_iface::sptr daughterboard)
+    uhd::usrp::x400::x400_dboard_iface::sptr daughterboard,
+    const std::string& mb_serial,
+    std::function<double()> get_temperature)
     : _rpcc(rpcc)
     , _rpc_prefix(rpc_prefix)
     , _db_number(db_number)
     , _daughterboard(daughterboard)
+    , _mb_serial(mb_serial)
+    , _get_temperature(std::move(get_temperature))
     , _unique_id(unique_id)
 {
 }
 
+std::string adc_self_calibration::_get_cal_serial(const size_t chan)
+{
+    // The results depend on the sample rate and the temperature, so store
+    // separate results for each
+    const double spll_freq = _rpcc->get_spll_freq();
+    const double temp      = _get_temperature();
+    const int temp_bucket  = static_cast<int>(
+        std::floor(temp / TEMPERATURE_BUCKET_SIZE) * TEMPERATURE_BUCKET_SIZE);
+    std::ostringstream serial;
+    serial << _mb_serial << "_db" << _db_number << "_ch" << chan << "_"
+           << static_cast<uint64_t>(std::round(spll_freq / 1e3)) << "kHz_"
+           << temp_bucket << "C";
+    return serial.str();
+}
+
+void adc_self_calibration::_store(const size_t chan)
+{
+    std::vector<uint8_t> data;
+    append_u32(data, ADC_SELF_CAL_VERSION);
+    for (size_t cal_block = 0; cal_block < NUM_CAL_BLOCKS; cal_block++) {
+        const auto coefs = _rpcc->get_cal_coefs(chan, _db_number, cal_block);
+        if (coefs.size() != 1 || coefs[0].size() != NUM_CAL_COEFS) {
+            UHD_LOG_WARNING(get_unique_id(),
+                "Unexpected ADC calibration coefficients, not storing them.");
+            return;
+        }
+        for (const uint32_t coef : coefs[0]) {
+            append_u32(data, coef);
+        }
+    }
+    try {
+        const auto serial = _get_cal_serial(chan);
+        uhd::usrp::cal::database::write_cal_data(ADC_SELF_CAL_KEY, serial, data, "bak");
+        UHD_LOG_DEBUG(
+            get_unique_id(), "Stored ADC self calibration results as " << serial);
+    } catch (const std::exception& e) {
+        UHD_LOG_WARNING(get_unique_id(),
+            "Could not store ADC self calibration results: " << e.what());
+    }
+}
+
+bool adc_self_calibration::restore(const size_t chan)
+{
+    if (!_can_restore || _mb_serial.empty()) {
+        return false;
+    }
+    std::string serial;
+    try {
+        serial = _get_cal_serial(chan);
+    } catch (const uhd::exception& e) {
+        UHD_LOG_WARNING(get_unique_id(),
+            "Could not look up ADC self calibration results: " << e.what());
+        return false;
+    }
+    if (!uhd::usrp::cal::database::has_cal_data(
+            ADC_SELF_CAL_KEY, serial, uhd::usrp::cal::source::FILESYSTEM)) {
+        return false;
+    }
+    const auto data = uhd::usrp::cal::database::read_cal_data(
+        ADC_SELF_CAL_KEY, serial, uhd::usrp::cal::source::FILESYSTEM);
+    if (data.size() != 4 * (1 + NUM_CAL_BLOCKS * NUM_CAL_COEFS)
+        || get_u32(data, 0) != ADC_SELF_CAL_VERSION) {
+        UHD_LOG_WARNING(get_unique_id(),
+            "Ignoring invalid ADC self calibration results for " << serial);
+        return false;
+    }
+
+    for (size_t cal_block = 0; cal_block < NUM_CAL_BLOCKS; cal_block++) {
+        // MPM parses the coefficients from a Python list literal
+        std::ostringstream coefs;
+        coefs << "[";
+        for (size_t i = 0; i < NUM_CAL_COEFS; i++) {
+            coefs << (i ? ", " : "") << get_u32(data, 1 + cal_block * NUM_CAL_COEFS + i);
+        }
+        coefs << "]";
+        try {
+            _rpcc->set_cal_coefs(chan, _db_number, cal_block, coefs.str());
+        } catch (const uhd::runtime_error& e) {
+            UHD_LOG_WARNING(get_unique_id(),
+                "Could not restore ADC self calibration results: " << e.what());
+            return false;
+        }
+    }
+    UHD_LOG_DEBUG(get_unique_id(), "Restored ADC self calibration results " << serial);
+    return true;
+}
+
 void adc_self_calibration::run(size_t chan)
 {
     const auto tx_gain_profile =
@@ -45,6 +173,20 @@ void adc_self_calibration::run(size_t chan)
 
     const auto cal_params = _daughterboard->get_adc_self_cal_params(cal_tone_freq);
 
+    // Let the calibration blocks adapt again if restore() overrode them. Older
+    // versions of MPM can't do that, in which case nothing was restored either.
+    if (_can_restore) {
+        try {
+            for (size_t cal_block = 0; cal_block < NUM_CAL_BLOCKS; cal_block++) {
+                _rpcc->reset_cal_coefs(chan, _db_number, cal_block);
+            }
+        } catch (const uhd::runtime_error&) {
+            UHD_LOG_DEBUG(get_unique_id(),
+                "MPM does not support restoring ADC self calibration results.");
+            _can_restore = false;
+        }
+    }
+
     // Switch to CAL_LOOPBACK and save the current antenna
     const auto rx_antenna = _daughterboard->get_rx_antenna(chan);
     const auto tx_antenna = _daughterboard->get_tx_antenna(chan);
@@ -191,6 +333,10 @@ void adc_self_calibration::run(size_t chan)
     // 2000ms was found experimentally to be sufficient
     constexpr auto calibration_time = 2000ms;
     std::this_thread::sleep_for(calibration_time);
+
+    if (_can_restore && !_mb_serial.empty()) {
+        _store(chan);
+    }
 }
 
 }} // namespace uhd::features
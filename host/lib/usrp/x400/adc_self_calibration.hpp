@@ -9,6 +9,7 @@
 #include <uhd/features/adc_self_calibration_iface.hpp>
 #include <uhdlib/usrp/common/rpc.hpp>
 #include <uhdlib/usrp/dboard/x400_dboard_iface.hpp>
+#include <functional>
 #include <string>
 
 namespace uhd { namespace features {
@@ -22,10 +23,14 @@ public:
         const std::string rpc_prefix,
         const std::string unique_id,
         size_t db_number,
-        uhd::usrp::x400::x400_dboard_iface::sptr daughterboard);
+        uhd::usrp::x400::x400_dboard_iface::sptr daughterboard,
+        const std::string& mb_serial,
+        std::function<double()> get_temperature);
 
     void run(const size_t channel) override;
 
+    bool restore(const size_t channel) override;
+
 private:
     //! Reference to the RPC client
     uhd::usrp::x400_rpc_iface::sptr _rpcc;
@@ -36,6 +41,21 @@ private:
 
     uhd::usrp::x400::x400_dboard_iface::sptr _daughterboard;
 
+    //! Motherboard serial, identifies the stored calibration results
+    const std::string _mb_serial;
+
+    //! Returns the current temperature (in degrees C) of the ADCs
+    std::function<double()> _get_temperature;
+
+    //! False if MPM can't override the calibration coefficients
+    bool _can_restore = true;
+
+    //! Return the cal database serial for \p channel in the current conditions
+    std::string _get_cal_serial(const size_t channel);
+
+    //! Store the current calibration coefficients of \p channel
+    void _store(const size_t channel);
+
     const std::string _unique_id;
     std::string get_unique_id() const
     {
@@ -10,6 +10,8 @@
 #include <uhd/types/serial.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhd/utils/static.hpp>
+#include <uhdlib/rfnoc/factory.hpp>
 #include <uhdlib/rfnoc/reg_iface_adapter.hpp>
 #include <uhdlib/usrp/common/x400_rfdc_control.hpp>
 #include <uhdlib/usrp/cores/spi_core_4000.hpp>
@@ -31,7 +33,9 @@ void x400_radio_control_impl::fpga_onload::onload()
     for (size_t channel = 0; channel < _num_channels; channel++) {
         if (_adc_self_cal) {
             try {
-                _adc_self_cal->run(channel);
+                if (!_adc_self_cal->restore(channel)) {
+                    _adc_self_cal->run(channel);
+                }
             } catch (uhd::runtime_error& e) {
                 RFNOC_LOG_WARNING("Failure while running self cal on channel "
                                   << channel << ": " << e.what());
@@ -175,7 +179,11 @@ x400_radio_control_impl::x400_radio_control_impl(make_args_ptr make_args)
                 _rpc_prefix,
                 get_unique_id(),
                 get_block_id().get_block_count(),
-                _daughterboard);
+                _daughterboard,
+                _mb_control->get_eeprom().get("serial", ""),
+                [mb_control = _mb_control]() {
+                    return mb_control->get_sensor("temp_fpga").to_real();
+                });
         register_feature(_adc_self_calibration);
     }
 
@@ -208,7 +216,11 @@ x400_radio_control_impl::x400_radio_control_impl(make_args_ptr make_args)
                 x400_regs::SPI_TRANSACTION_GO_REG,
                 x400_regs::SPI_STATUS_REG,
                 x400_regs::SPI_CONTROLLER_INFO_REG,
-                gpio_port_mapper);
+                gpio_port_mapper,
+                [this](const std::vector<uint32_t>& addrs,
+                    const std::vector<uint32_t>& values) {
+                    regs().multi_poke32(addrs, values, get_command_time(0));
+                });
 
             _spi_getter_iface = std::make_shared<x400_spi_getter>(spicore);
             register_feature(_spi_getter_iface);
@@ -281,8 +293,6 @@ void x400_radio_control_impl::_init_prop_tree()
 
 void x400_radio_control_impl::_validate_master_clock_rate_args()
 {
-    auto block_args = get_block_args();
-
     // Note: MCR gets set during the init() call (prior to this), which takes
     // in arguments from the device args. So if block_args contains a
     // master_clock_rate key, then it should better be whatever the device is
@@ -835,4 +845,10 @@ std::string x400_radio_control_impl::get_dboard_fe_from_chan(
 
 UHD_RFNOC_BLOCK_REGISTER_FOR_DEVICE_DIRECT(
     x400_radio_control, RADIO_BLOCK, X400, "Radio", true, "radio_clk", "ctrl_clk")
+
+// Both daughterboards can be initialized at the same time
+UHD_STATIC_BLOCK(register_x400_radio_control_parallel_init)
+{
+    factory::register_parallel_init(RADIO_BLOCK, X400);
+}
 }} // namespace uhd::rfnoc
@@ -0,0 +1,642 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/chdr/chdr_stream_engine.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/rfnoc/chdr_packet_writer.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#ifdef HAVE_SENDMMSG
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <poll.h>
+#    include <sys/socket.h>
+#    include <cerrno>
+#    include <cstring>
+#endif
+
+using namespace uhd::utils::chdr;
+using namespace uhd::rfnoc;
+using namespace uhd::rfnoc::chdr;
+
+#ifdef HAVE_SENDMMSG
+
+namespace {
+
+//! The largest packet the engine sends or receives (a jumbo frame)
+constexpr size_t MAX_PKT_SIZE = 9000;
+//! The maximum number of packets per call to sendmmsg() and recvmmsg()
+constexpr size_t BURST_SIZE = 32;
+//! How long the threads wait for work before they check whether to stop
+constexpr auto POLL_TIMEOUT = std::chrono::milliseconds(100);
+//! The maximum number of packets queued for the control plane
+constexpr size_t MAX_CONTROL_QUEUE_SIZE = 1024;
+//! The number of packets which input streams report as capacity. Like the
+//! Python simulator, the engine only limits inputs by bytes.
+constexpr uint32_t INPUT_CAPACITY_PKTS = 0xFFFFFF;
+//! MPM devices use little-endian CHDR on UDP
+constexpr uhd::endianness_t ENDIANNESS = uhd::ENDIANNESS_LITTLE;
+
+//! Transfer counts, as carried by stream command and stream status packets
+struct xfer_count_t
+{
+    uint64_t num_packets = 0;
+    uint64_t num_bytes   = 0;
+
+    void count_packet(const size_t len)
+    {
+        num_packets++;
+        num_bytes += len;
+    }
+
+    bool has_reached(const xfer_count_t& limit) const
+    {
+        return num_packets >= limit.num_packets || num_bytes >= limit.num_bytes;
+    }
+};
+
+sockaddr_in make_sockaddr(const std::string& addr, const uint16_t port)
+{
+    sockaddr_in sockaddr{};
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port   = htons(port);
+    if (inet_pton(AF_INET, addr.c_str(), &sockaddr.sin_addr) != 1) {
+        throw uhd::value_error("chdr_stream_engine: Invalid IPv4 address: " + addr);
+    }
+    return sockaddr;
+}
+
+//! The state of an input stream. Only the receive thread changes it.
+struct input_stream_t
+{
+    uint16_t epid           = 0;
+    uint64_t capacity_bytes = 0;
+    //! The transfer counts reported to the sender
+    xfer_count_t xfer;
+    //! The transfer counts since the last flow control status
+    xfer_count_t accum;
+    //! How often the sender wants a flow control status, once it initialized
+    //! the stream
+    bool has_fc_freq = false;
+    xfer_count_t fc_freq;
+    sockaddr_in command_addr{};
+    uint16_t command_epid = 0;
+    bool has_seq_num      = false;
+    uint16_t next_seq_num = 0;
+    chdr_stream_engine::stream_stats_t stats;
+};
+
+/*! Generates the packets of an output stream on its own thread
+ *
+ * The thread sends bursts of up to BURST_SIZE packets with sendmmsg(). When
+ * the stream is paced, every burst holds the packets which are due, so the
+ * pace is kept on average even where the thread can't sleep for the duration
+ * of a single packet.
+ */
+class output_stream
+{
+public:
+    using args_t = chdr_stream_engine::output_args_t;
+
+    output_stream(
+        const int fd, const chdr_packet_factory& pkt_factory, const args_t& args)
+        : _fd(fd)
+        , _args(args)
+        , _sockaddr(make_sockaddr(args.addr, args.port))
+        , _pkt(pkt_factory.make_generic())
+        , _pkt_type(args.has_timestamp ? PKT_TYPE_DATA_WITH_TS : PKT_TYPE_DATA_NO_TS)
+        , _max_pkt_len(_pkt->calculate_payload_offset(_pkt_type)
+                       + args.packet_samples * args.bytes_per_sample)
+    {
+        if (args.packet_samples == 0 || args.bytes_per_sample == 0) {
+            throw uhd::value_error("chdr_stream_engine: Packets must hold samples");
+        }
+        if (_max_pkt_len > MAX_PKT_SIZE) {
+            throw uhd::value_error("chdr_stream_engine: Packets of "
+                                   + std::to_string(_max_pkt_len)
+                                   + " bytes exceed the maximum packet size");
+        }
+        if (args.capacity_packets == 0 || args.capacity_bytes < _max_pkt_len) {
+            throw uhd::value_error(
+                "chdr_stream_engine: Packets don't fit into the downstream buffer");
+        }
+        _thread = std::thread([this]() { _worker(); });
+        uhd::set_thread_name(&_thread, "uhd_chdr_tx");
+    }
+
+    ~output_stream()
+    {
+        stop();
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cond.notify_all();
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    bool is_active() const
+    {
+        return _active;
+    }
+
+    //! Update the flow control credit from a stream status packet
+    void update_recv(const strs_payload& payload)
+    {
+        if (payload.status != STRS_OKAY) {
+            UHD_LOG_WARNING("CHDR_ENGINE",
+                "Output stream EPID " << _args.src_epid
+                                      << " received a stream status error: "
+                                      << payload.status_info);
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _recv.num_packets = payload.xfer_count_pkts;
+            _recv.num_bytes   = payload.xfer_count_bytes;
+        }
+        _cond.notify_all();
+    }
+
+    chdr_stream_engine::stream_stats_t get_stats() const
+    {
+        chdr_stream_engine::stream_stats_t stats;
+        stats.active        = _active;
+        stats.num_packets   = _num_packets;
+        stats.num_bytes     = _num_bytes;
+        stats.num_fc_stalls = _num_fc_stalls;
+        return stats;
+    }
+
+private:
+    //! Return how many packets fit downstream. Requires _mutex.
+    size_t _get_credit() const
+    {
+        const uint64_t pkts_in_transit  = _xfer.num_packets - _recv.num_packets;
+        const uint64_t bytes_in_transit = _xfer.num_bytes - _recv.num_bytes;
+        if (pkts_in_transit >= _args.capacity_packets
+            || bytes_in_transit >= _args.capacity_bytes) {
+            return 0;
+        }
+        return static_cast<size_t>(
+            std::min(_args.capacity_packets - pkts_in_transit,
+                (_args.capacity_bytes - bytes_in_transit) / _max_pkt_len));
+    }
+
+    void _worker()
+    {
+        // The payload stays all zeros, only the headers are written per packet
+        const size_t stride = (_max_pkt_len + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        std::vector<uint64_t> buff(stride * BURST_SIZE, 0);
+        std::vector<iovec> iovs(BURST_SIZE);
+        std::vector<mmsghdr> msgs(BURST_SIZE);
+        for (size_t i = 0; i < BURST_SIZE; i++) {
+            iovs[i].iov_base            = &buff[i * stride];
+            msgs[i].msg_hdr             = {};
+            msgs[i].msg_hdr.msg_name    = &_sockaddr;
+            msgs[i].msg_hdr.msg_namelen = sizeof(_sockaddr);
+            msgs[i].msg_hdr.msg_iov     = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        using steady_clock         = std::chrono::steady_clock;
+        const uint64_t spp         = _args.packet_samples;
+        const uint64_t total_samps = _args.num_samples;
+        const double pkts_per_sec  = _args.sample_rate / spp;
+        const auto start_time      = steady_clock::now();
+        uint64_t num_sent          = 0;
+        uint64_t samps_sent        = 0;
+        uint16_t seq_num           = 0;
+
+        while (!_stop && (total_samps == 0 || samps_sent < total_samps)) {
+            size_t num_pkts = BURST_SIZE;
+            if (total_samps != 0) {
+                num_pkts = static_cast<size_t>(std::min<uint64_t>(
+                    num_pkts, (total_samps - samps_sent + spp - 1) / spp));
+            }
+            if (pkts_per_sec > 0) {
+                const std::chrono::duration<double> elapsed =
+                    steady_clock::now() - start_time;
+                const uint64_t num_due =
+                    static_cast<uint64_t>(elapsed.count() * pkts_per_sec) + 1;
+                if (num_due <= num_sent) {
+                    const std::chrono::duration<double> next_due(num_sent / pkts_per_sec);
+                    std::this_thread::sleep_until(start_time
+                        + std::chrono::duration_cast<steady_clock::duration>(next_due));
+                    continue;
+                }
+                num_pkts = static_cast<size_t>(
+                    std::min<uint64_t>(num_pkts, num_due - num_sent));
+            }
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                const size_t credit = _get_credit();
+                if (credit == 0) {
+                    _num_fc_stalls++;
+                    _cond.wait_for(lock, POLL_TIMEOUT, [this]() {
+                        return _stop || _get_credit() > 0;
+                    });
+                    continue;
+                }
+                num_pkts = std::min(num_pkts, credit);
+            }
+
+            size_t num_bytes = 0;
+            for (size_t i = 0; i < num_pkts; i++) {
+                const size_t nsamps = static_cast<size_t>(
+                    total_samps == 0 ? spp : std::min(spp, total_samps - samps_sent));
+                chdr_header header;
+                header.set_pkt_type(_pkt_type);
+                header.set_dst_epid(_args.dst_epid);
+                header.set_seq_num(seq_num++);
+                header.set_eob(total_samps != 0 && samps_sent + nsamps == total_samps);
+                _pkt->write_data_header(iovs[i].iov_base,
+                    header,
+                    _args.timestamp + samps_sent,
+                    nsamps * _args.bytes_per_sample);
+                iovs[i].iov_len = header.get_length();
+                num_bytes += iovs[i].iov_len;
+                samps_sent += nsamps;
+            }
+            if (!_send(msgs.data(), num_pkts)) {
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _xfer.num_packets += num_pkts;
+                _xfer.num_bytes += num_bytes;
+            }
+            num_sent += num_pkts;
+            _num_packets += num_pkts;
+            _num_bytes += num_bytes;
+        }
+
+        const double duration =
+            std::chrono::duration<double>(steady_clock::now() - start_time).count();
+        UHD_LOG_INFO("CHDR_ENGINE",
+            "Output stream EPID " << _args.src_epid << " sent " << num_sent
+                                  << " packets at "
+                                  << (duration > 0 ? num_sent / duration : 0.0)
+                                  << " packets/sec");
+        _active = false;
+    }
+
+    //! Send all packets of a burst. Returns false on an error.
+    bool _send(mmsghdr* msgs, const size_t num_pkts)
+    {
+        size_t num_sent = 0;
+        while (num_sent < num_pkts) {
+            const int ret = sendmmsg(
+                _fd, msgs + num_sent, static_cast<unsigned>(num_pkts - num_sent), 0);
+            if (ret < 0) {
+                if (errno == EINTR || errno == EAGAIN || errno == ENOBUFS) {
+                    continue;
+                }
+                UHD_LOG_ERROR("CHDR_ENGINE",
+                    "Output stream EPID " << _args.src_epid
+                                          << " failed to send: " << strerror(errno));
+                return false;
+            }
+            num_sent += static_cast<size_t>(ret);
+        }
+        return true;
+    }
+
+    const int _fd;
+    const args_t _args;
+    sockaddr_in _sockaddr;
+    chdr_packet_writer::uptr _pkt;
+    const packet_type_t _pkt_type;
+    const size_t _max_pkt_len;
+
+    //! Protects _stop, _xfer and _recv
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _stop = false;
+    xfer_count_t _xfer;
+    xfer_count_t _recv;
+
+    std::atomic<bool> _active{true};
+    std::atomic<uint64_t> _num_packets{0};
+    std::atomic<uint64_t> _num_bytes{0};
+    std::atomic<uint64_t> _num_fc_stalls{0};
+    std::thread _thread;
+};
+
+class chdr_stream_engine_impl : public chdr_stream_engine
+{
+public:
+    chdr_stream_engine_impl(const int socket_fd, const chdr_w_t chdr_w)
+        : _fd(socket_fd)
+        , _pkt_factory(chdr_w, ENDIANNESS)
+        , _pkt(_pkt_factory.make_generic())
+        , _strc_pkt(_pkt_factory.make_strc())
+        , _strs_pkt(_pkt_factory.make_strs())
+    {
+        _recv_thread = std::thread([this]() { _recv_worker(); });
+        uhd::set_thread_name(&_recv_thread, "uhd_chdr_rx");
+    }
+
+    ~chdr_stream_engine_impl() override
+    {
+        _stop = true;
+        _recv_thread.join();
+        // Stop the outputs before the rest of the engine goes away
+        _outputs.clear();
+    }
+
+    bool recv_control(control_packet_t& packet, const double timeout) override
+    {
+        std::unique_lock<std::mutex> lock(_control_mutex);
+        if (!_control_cond.wait_for(lock,
+                std::chrono::duration<double>(timeout),
+                [this]() { return !_control_queue.empty(); })) {
+            return false;
+        }
+        packet = std::move(_control_queue.front());
+        _control_queue.pop_front();
+        return true;
+    }
+
+    void begin_input(const uint16_t epid, const uint64_t capacity_bytes) override
+    {
+        input_stream_t input;
+        input.epid           = epid;
+        input.capacity_bytes = capacity_bytes;
+        input.stats.active   = true;
+        std::lock_guard<std::mutex> lock(_streams_mutex);
+        _inputs[epid] = input;
+    }
+
+    void end_input(const uint16_t epid) override
+    {
+        std::lock_guard<std::mutex> lock(_streams_mutex);
+        auto input = _inputs.find(epid);
+        if (input != _inputs.end()) {
+            input->second.stats.active = false;
+        }
+    }
+
+    stream_stats_t get_input_stats(const uint16_t epid) const override
+    {
+        std::lock_guard<std::mutex> lock(_streams_mutex);
+        auto input = _inputs.find(epid);
+        if (input == _inputs.end()) {
+            throw uhd::key_error(
+                "chdr_stream_engine: No input stream on EPID " + std::to_string(epid));
+        }
+        return input->second.stats;
+    }
+
+    void begin_output(const output_args_t& args) override
+    {
+        std::unique_ptr<output_stream> old_output;
+        {
+            std::lock_guard<std::mutex> lock(_streams_mutex);
+            auto output = _outputs.find(args.src_epid);
+            if (output != _outputs.end()) {
+                old_output = std::move(output->second);
+                _outputs.erase(output);
+            }
+        }
+        // Join the old thread before the new one starts sending
+        old_output.reset();
+        auto output = std::make_unique<output_stream>(_fd, _pkt_factory, args);
+        std::lock_guard<std::mutex> lock(_streams_mutex);
+        _outputs[args.src_epid] = std::move(output);
+    }
+
+    void end_output(const uint16_t src_epid) override
+    {
+        std::lock_guard<std::mutex> lock(_streams_mutex);
+        auto output = _outputs.find(src_epid);
+        if (output != _outputs.end()) {
+            output->second->stop();
+        }
+    }
+
+    stream_stats_t get_output_stats(const uint16_t src_epid) const override
+    {
+        std::lock_guard<std::mutex> lock(_streams_mutex);
+        auto output = _outputs.find(src_epid);
+        if (output == _outputs.end()) {
+            throw uhd::key_error("chdr_stream_engine: No output stream on EPID "
+                                 + std::to_string(src_epid));
+        }
+        return output->second->get_stats();
+    }
+
+private:
+    void _recv_worker()
+    {
+        std::vector<uint64_t> buff(BURST_SIZE * MAX_PKT_SIZE / sizeof(uint64_t));
+        std::vector<iovec> iovs(BURST_SIZE);
+        std::vector<mmsghdr> msgs(BURST_SIZE);
+        std::vector<sockaddr_in> addrs(BURST_SIZE);
+        for (size_t i = 0; i < BURST_SIZE; i++) {
+            iovs[i].iov_base           = &buff[i * MAX_PKT_SIZE / sizeof(uint64_t)];
+            iovs[i].iov_len            = MAX_PKT_SIZE;
+            msgs[i].msg_hdr            = {};
+            msgs[i].msg_hdr.msg_name   = &addrs[i];
+            msgs[i].msg_hdr.msg_iov    = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        pollfd poll_fd{_fd, POLLIN, 0};
+        const int poll_timeout_ms = static_cast<int>(POLL_TIMEOUT.count());
+
+        while (!_stop) {
+            if (poll(&poll_fd, 1, poll_timeout_ms) <= 0) {
+                continue;
+            }
+            for (auto& msg : msgs) {
+                msg.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+            const int num_pkts = recvmmsg(_fd,
+                msgs.data(),
+                static_cast<unsigned>(BURST_SIZE),
+                MSG_DONTWAIT,
+                nullptr);
+            if (num_pkts <= 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(_streams_mutex);
+            for (int i = 0; i < num_pkts; i++) {
+                _handle_packet(iovs[i].iov_base, msgs[i].msg_len, addrs[i]);
+            }
+        }
+    }
+
+    //! Handle a received packet. Requires _streams_mutex.
+    void _handle_packet(const void* pkt_buff, const size_t len, const sockaddr_in& addr)
+    {
+        if (len >= sizeof(uint64_t)) {
+            const chdr_header header = _pkt->read_chdr_header(pkt_buff);
+            switch (header.get_pkt_type()) {
+                case PKT_TYPE_DATA_NO_TS:
+                case PKT_TYPE_DATA_WITH_TS:
+                case PKT_TYPE_STRC: {
+                    auto input = _inputs.find(header.get_dst_epid());
+                    if (input != _inputs.end() && input->second.stats.active) {
+                        _handle_input_packet(input->second, header, pkt_buff, len, addr);
+                        return;
+                    }
+                    break;
+                }
+                case PKT_TYPE_STRS: {
+                    auto output = _outputs.find(header.get_dst_epid());
+                    if (output != _outputs.end() && output->second->is_active()) {
+                        _strs_pkt->refresh(pkt_buff);
+                        output->second->update_recv(_strs_pkt->get_payload());
+                        return;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        _queue_control_packet(pkt_buff, len, addr);
+    }
+
+    //! Count the packet, and respond with flow control, like a stream endpoint
+    void _handle_input_packet(input_stream_t& input,
+        const chdr_header& header,
+        const void* pkt_buff,
+        const size_t len,
+        const sockaddr_in& addr)
+    {
+        input.xfer.count_packet(len);
+        input.accum.count_packet(len);
+        input.stats.num_packets++;
+        input.stats.num_bytes += len;
+        if (header.get_pkt_type() == PKT_TYPE_STRC) {
+            _strc_pkt->refresh(pkt_buff);
+            const strc_payload payload = _strc_pkt->get_payload();
+            if (payload.op_code == STRC_INIT) {
+                input.xfer         = {};
+                input.accum        = {};
+                input.has_fc_freq  = true;
+                input.fc_freq      = {payload.num_pkts, payload.num_bytes};
+                input.command_addr = addr;
+                input.command_epid = payload.src_epid;
+                input.has_seq_num  = false;
+            } else if (payload.op_code == STRC_RESYNC) {
+                input.xfer = {payload.num_pkts, payload.num_bytes};
+            }
+            _send_strs(input, payload.src_epid, addr);
+        } else {
+            if (input.has_seq_num && header.get_seq_num() != input.next_seq_num) {
+                input.stats.num_seq_errors++;
+            }
+            input.has_seq_num  = true;
+            input.next_seq_num = header.get_seq_num() + 1;
+        }
+        if (input.has_fc_freq && input.accum.has_reached(input.fc_freq)) {
+            input.accum = {};
+            _send_strs(input, input.command_epid, input.command_addr);
+        }
+    }
+
+    void _send_strs(
+        const input_stream_t& input, const uint16_t dst_epid, const sockaddr_in& addr)
+    {
+        chdr_header header;
+        header.set_pkt_type(PKT_TYPE_STRS);
+        header.set_dst_epid(dst_epid);
+        strs_payload payload;
+        payload.src_epid         = input.epid;
+        payload.status           = STRS_OKAY;
+        payload.capacity_bytes   = input.capacity_bytes;
+        payload.capacity_pkts    = INPUT_CAPACITY_PKTS;
+        payload.xfer_count_bytes = input.xfer.num_bytes;
+        payload.xfer_count_pkts  = input.xfer.num_packets;
+        _strs_pkt->refresh(_send_buff.data(), header, payload);
+        if (sendto(_fd,
+                _send_buff.data(),
+                header.get_length(),
+                0,
+                reinterpret_cast<const sockaddr*>(&addr),
+                sizeof(addr))
+            < 0) {
+            UHD_LOG_WARNING("CHDR_ENGINE",
+                "Input stream EPID " << input.epid << " failed to send a stream status: "
+                                     << strerror(errno));
+        }
+    }
+
+    void _queue_control_packet(
+        const void* pkt_buff, const size_t len, const sockaddr_in& addr)
+    {
+        control_packet_t packet;
+        const uint8_t* data = static_cast<const uint8_t*>(pkt_buff);
+        packet.data.assign(data, data + len);
+        char addr_str[INET_ADDRSTRLEN];
+        packet.addr = inet_ntop(AF_INET, &addr.sin_addr, addr_str, sizeof(addr_str));
+        packet.port = ntohs(addr.sin_port);
+        {
+            std::lock_guard<std::mutex> lock(_control_mutex);
+            if (_control_queue.size() >= MAX_CONTROL_QUEUE_SIZE) {
+                UHD_LOG_WARNING("CHDR_ENGINE", "Control queue full, dropping a packet");
+                return;
+            }
+            _control_queue.push_back(std::move(packet));
+        }
+        _control_cond.notify_one();
+    }
+
+    const int _fd;
+    const chdr_packet_factory _pkt_factory;
+    // These are only used by the receive thread
+    chdr_packet_writer::uptr _pkt;
+    chdr_strc_packet::uptr _strc_pkt;
+    chdr_strs_packet::uptr _strs_pkt;
+    std::vector<uint64_t> _send_buff =
+        std::vector<uint64_t>(MAX_PKT_SIZE / sizeof(uint64_t));
+
+    //! Protects _inputs and _outputs
+    mutable std::mutex _streams_mutex;
+    std::map<uint16_t, input_stream_t> _inputs;
+    std::map<uint16_t, std::unique_ptr<output_stream>> _outputs;
+
+    std::mutex _control_mutex;
+    std::condition_variable _control_cond;
+    std::deque<control_packet_t> _control_queue;
+
+    std::atomic<bool> _stop{false};
+    std::thread _recv_thread;
+};
+
+} // namespace
+
+chdr_stream_engine::sptr chdr_stream_engine::make(
+    const int socket_fd, const uhd::rfnoc::chdr_w_t chdr_w)
+{
+    return std::make_shared<chdr_stream_engine_impl>(socket_fd, chdr_w);
+}
+
+#else
+
+chdr_stream_engine::sptr chdr_stream_engine::make(
+    const int /*socket_fd*/, const uhd::rfnoc::chdr_w_t /*chdr_w*/)
+{
+    throw uhd::not_implemented_error(
+        "chdr_stream_engine: sendmmsg() and recvmmsg() are not available");
+}
+
+#endif
@@ -0,0 +1,127 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/cpu_features.hpp>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#    define UHD_CPU_FEATURES_X86
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#endif
+
+using namespace uhd::cpu;
+
+namespace {
+
+#ifdef UHD_CPU_FEATURES_X86
+constexpr uint32_t LEAF1_EDX_SSE2     = 1 << 26;
+constexpr uint32_t LEAF1_ECX_SSSE3    = 1 << 9;
+constexpr uint32_t LEAF1_ECX_OSXSAVE  = 1 << 27;
+constexpr uint32_t LEAF1_ECX_AVX      = 1 << 28;
+constexpr uint32_t LEAF1_ECX_F16C     = 1 << 29;
+constexpr uint32_t LEAF7_EBX_AVX2     = 1 << 5;
+constexpr uint32_t LEAF7_EBX_AVX512F  = 1 << 16;
+constexpr uint32_t LEAF7_EBX_AVX512BW = 1 << 30;
+// XCR0 bits: SSE and AVX (YMM) state, plus opmask/ZMM state for AVX-512
+constexpr uint64_t XCR0_AVX_STATE    = 0x06;
+constexpr uint64_t XCR0_AVX512_STATE = 0xE6;
+
+void cpuid(const uint32_t leaf, const uint32_t subleaf, uint32_t regs[4])
+{
+#    ifdef _MSC_VER
+    int r[4];
+    __cpuidex(r, int(leaf), int(subleaf));
+    for (size_t i = 0; i < 4; i++) {
+        regs[i] = uint32_t(r[i]);
+    }
+#    else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#    endif
+}
+
+uint32_t cpuid_max_leaf()
+{
+#    ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 0);
+    return uint32_t(r[0]);
+#    else
+    return __get_cpuid_max(0, nullptr);
+#    endif
+}
+
+uint64_t read_xcr0()
+{
+#    ifdef _MSC_VER
+    return _xgetbv(0);
+#    else
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (uint64_t(edx) << 32) | eax;
+#    endif
+}
+#endif
+
+features_t detect_features()
+{
+    features_t features;
+#ifdef UHD_CPU_FEATURES_X86
+    const uint32_t max_leaf = cpuid_max_leaf();
+    if (max_leaf < 1) {
+        return features;
+    }
+    uint32_t leaf1[4];
+    cpuid(1, 0, leaf1);
+    features.sse2  = leaf1[3] & LEAF1_EDX_SSE2;
+    features.ssse3 = leaf1[2] & LEAF1_ECX_SSSE3;
+
+    // Without OSXSAVE, we can't query which register state the OS preserves,
+    // and must assume that AVX is unusable.
+    if (!(leaf1[2] & LEAF1_ECX_OSXSAVE) || !(leaf1[2] & LEAF1_ECX_AVX)
+        || max_leaf < 7) {
+        return features;
+    }
+    const uint64_t xcr0    = read_xcr0();
+    const bool os_avx      = (xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE;
+    const bool os_avx512   = (xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE;
+    uint32_t leaf7[4];
+    cpuid(7, 0, leaf7);
+    features.avx2     = os_avx && (leaf7[1] & LEAF7_EBX_AVX2);
+    features.avx512f  = os_avx512 && (leaf7[1] & LEAF7_EBX_AVX512F);
+    features.avx512bw = os_avx512 && (leaf7[1] & LEAF7_EBX_AVX512BW);
+    features.f16c     = os_avx && (leaf1[2] & LEAF1_ECX_F16C);
+#endif
+    return features;
+}
+
+} // namespace
+
+std::string features_t::to_string() const
+{
+    std::string result;
+    auto append = [&result](const bool has_feature, const char* name) {
+        if (has_feature) {
+            result += (result.empty() ? "" : ", ") + std::string(name);
+        }
+    };
+    append(sse2, "SSE2");
+    append(ssse3, "SSSE3");
+    append(avx2, "AVX2");
+    append(avx512f, "AVX512F");
+    append(avx512bw, "AVX512BW");
+    append(f16c, "F16C");
+    return result.empty() ? "none" : result;
+}
+
+const features_t& uhd::cpu::get_features()
+{
+    static const features_t features = detect_features();
+    return features;
+}
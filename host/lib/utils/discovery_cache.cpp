@@ -0,0 +1,148 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhd/version.hpp>
+#include <uhdlib/utils/discovery_cache.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+using namespace uhd;
+namespace fs = boost::filesystem;
+
+namespace {
+
+constexpr char LOG_ID[]           = "DISCOVERY_CACHE";
+constexpr char HEADER_PREFIX[]    = "# UHD discovery cache, version ";
+constexpr char DEFAULT_FILENAME[] = "discovery_cache.txt";
+
+} // namespace
+
+constexpr const char* discovery_cache::ENV_VAR;
+
+std::string discovery_cache::get_path_from_env()
+{
+    const char* env_value = std::getenv(ENV_VAR);
+    if (env_value == nullptr) {
+        return "";
+    }
+    const std::string value(env_value);
+    if (value.empty() || value == "0") {
+        return "";
+    }
+    if (value != "1") {
+        return value;
+    }
+    try {
+        return (get_xdg_data_home() / "uhd" / DEFAULT_FILENAME).string();
+    } catch (const uhd::runtime_error& ex) {
+        UHD_LOG_WARNING(LOG_ID, "Disabling discovery cache: " << ex.what());
+        return "";
+    }
+}
+
+std::string discovery_cache::make_key(const device_addr_t& hint, const int filter)
+{
+    // Sort the keys, the order of the hint arguments does not matter
+    std::vector<std::string> keys = hint.keys();
+    std::sort(keys.begin(), keys.end());
+    std::string key = "filter=" + std::to_string(filter);
+    for (const auto& hint_key : keys) {
+        key += "," + hint_key + "=" + hint[hint_key];
+    }
+    return key;
+}
+
+discovery_cache::discovery_cache(const std::string& path) : _path(path) {}
+
+boost::optional<discovery_cache::entries_t> discovery_cache::lookup(
+    const std::string& key) const
+{
+    const auto cache = _read();
+    const auto it    = cache.find(key);
+    if (it == cache.end()) {
+        return boost::none;
+    }
+    return it->second;
+}
+
+void discovery_cache::store(const std::string& key, const entries_t& entries)
+{
+    auto cache = _read();
+    cache[key] = entries;
+    _write(cache);
+}
+
+void discovery_cache::erase(const std::string& key)
+{
+    auto cache = _read();
+    if (cache.erase(key)) {
+        _write(cache);
+    }
+}
+
+discovery_cache::cache_t discovery_cache::_read() const
+{
+    cache_t cache;
+    std::ifstream file(_path);
+    if (!file) {
+        return cache;
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != HEADER_PREFIX + uhd::get_version_string()) {
+        UHD_LOG_DEBUG(LOG_ID, "Ignoring cache from different UHD version: " << _path);
+        return cache;
+    }
+    // Every other line is: key<TAB>finder index<TAB>device address
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields;
+        boost::split(fields, line, boost::is_any_of("\t"));
+        if (fields.size() != 3) {
+            UHD_LOG_DEBUG(LOG_ID, "Ignoring malformed line in " << _path);
+            continue;
+        }
+        try {
+            cache[fields[0]].push_back(
+                {std::stoul(fields[1]), device_addr_t(fields[2])});
+        } catch (const std::exception&) {
+            UHD_LOG_DEBUG(LOG_ID, "Ignoring malformed line in " << _path);
+        }
+    }
+    return cache;
+}
+
+void discovery_cache::_write(const cache_t& cache) const
+{
+    // Write to a temporary file first, so that other processes never read a
+    // partial cache
+    const fs::path path(_path);
+    const fs::path tmp_path(_path + ".tmp");
+    try {
+        if (path.has_parent_path()) {
+            fs::create_directories(path.parent_path());
+        }
+        {
+            std::ofstream file(tmp_path.string(), std::ios::trunc);
+            file << HEADER_PREFIX << uhd::get_version_string() << "\n";
+            for (const auto& key_entries : cache) {
+                for (const auto& entry : key_entries.second) {
+                    file << key_entries.first << "\t" << entry.finder_idx << "\t"
+                         << entry.dev_addr.to_string() << "\n";
+                }
+            }
+            if (!file) {
+                throw uhd::io_error("Could not write " + tmp_path.string());
+            }
+        }
+        fs::rename(tmp_path, path);
+    } catch (const std::exception& ex) {
+        UHD_LOG_WARNING(LOG_ID, "Failed to update discovery cache: " << ex.what());
+    }
+}
@@ -11,16 +11,14 @@
 #include <uhd/utils/gain_group.hpp>
 #include <uhd/utils/log.hpp>
 #include <algorithm>
-#include <functional>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 using namespace uhd;
 
-static bool compare_by_step_size(
-    const size_t& rhs, const size_t& lhs, std::vector<gain_fcns_t>& fcns)
-{
-    return fcns.at(rhs).get_range().step() > fcns.at(lhs).get_range().step();
-}
+//! Upper limit for the number of overall gain values with a cached distribution
+static constexpr size_t MAX_CACHED_DISTRIBUTIONS = 4096;
 
 /*!
  * Get a multiple of step with the following relation:
@@ -100,55 +98,32 @@ public:
         if (not name.empty())
             return _name_to_fcns.get(name).set_value(gain);
 
-        std::vector<gain_fcns_t> all_fcns = get_all_fcns();
+        const std::vector<gain_fcns_t>& all_fcns = get_all_fcns();
         if (all_fcns.empty())
             return; // nothing to set!
 
-        // get the max step size among the gains
-        double max_step = 0;
+        // The distribution only depends on the ranges of the gain elements, so
+        // it is looked up from a cache which is reset whenever a range changes
+        std::vector<gain_range_t> ranges;
+        ranges.reserve(all_fcns.size());
         for (const gain_fcns_t& fcns : all_fcns) {
-            max_step = std::max(max_step, fcns.get_range().step());
+            ranges.push_back(fcns.get_range());
         }
 
-        // create gain bucket to distribute power
         std::vector<double> gain_bucket;
-
-        // distribute power according to priority (round to max step)
-        double gain_left_to_distribute = gain;
-        for (const gain_fcns_t& fcns : all_fcns) {
-            const gain_range_t range = fcns.get_range();
-            gain_bucket.push_back(floor_step(
-                uhd::clip(gain_left_to_distribute, range.start(), range.stop()),
-                max_step));
-            gain_left_to_distribute -= gain_bucket.back();
-        }
-
-        // get a list of indexes sorted by step size large to small
-        std::vector<size_t> indexes_step_size_dec;
-        for (size_t i = 0; i < all_fcns.size(); i++) {
-            indexes_step_size_dec.push_back(i);
-        }
-        std::sort(indexes_step_size_dec.begin(),
-            indexes_step_size_dec.end(),
-            std::bind(&compare_by_step_size,
-                std::placeholders::_1,
-                std::placeholders::_2,
-                all_fcns));
-        UHD_ASSERT_THROW(all_fcns.at(indexes_step_size_dec.front()).get_range().step()
-                         >= all_fcns.at(indexes_step_size_dec.back()).get_range().step());
-
-        // distribute the remainder (less than max step)
-        // fill in the largest step sizes first that are less than the remainder
-        for (size_t i : indexes_step_size_dec) {
-            const gain_range_t range = all_fcns.at(i).get_range();
-            double additional_gain =
-                floor_step(uhd::clip(gain_bucket.at(i) + gain_left_to_distribute,
-                               range.start(),
-                               range.stop()),
-                    range.step())
-                - gain_bucket.at(i);
-            gain_bucket.at(i) += additional_gain;
-            gain_left_to_distribute -= additional_gain;
+        {
+            std::lock_guard<std::mutex> l(_cache_mutex);
+            if (ranges != _cached_ranges) {
+                _update_distribution(std::move(ranges));
+            }
+            auto it = _cached_distributions.find(gain);
+            if (it == _cached_distributions.end()) {
+                if (_cached_distributions.size() >= MAX_CACHED_DISTRIBUTIONS) {
+                    _cached_distributions.clear();
+                }
+                it = _cached_distributions.emplace(gain, _distribute(gain)).first;
+            }
+            gain_bucket = it->second;
         }
 
         // now write the bucket out to the individual gain values
@@ -171,22 +146,108 @@ public:
         }
         _registry[priority].push_back(gain_fcns);
         _name_to_fcns[name] = gain_fcns;
+
+        // put the gain function sets in order (highest priority first)
+        _all_fcns.clear();
+        for (size_t key : uhd::sorted(_registry.keys())) {
+            const std::vector<gain_fcns_t>& fcns = _registry[key];
+            _all_fcns.insert(_all_fcns.begin(), fcns.begin(), fcns.end());
+        }
+        std::lock_guard<std::mutex> l(_cache_mutex);
+        _cached_ranges.clear();
+        _cached_distributions.clear();
     }
 
 private:
+    //! Start, stop, and step of a gain element's range
+    struct element_range_t
+    {
+        double start;
+        double stop;
+        double step;
+    };
+
     //! get the gain function sets in order (highest priority first)
-    std::vector<gain_fcns_t> get_all_fcns(void)
+    const std::vector<gain_fcns_t>& get_all_fcns(void)
     {
-        std::vector<gain_fcns_t> all_fcns;
-        for (size_t key : uhd::sorted(_registry.keys())) {
-            const std::vector<gain_fcns_t>& fcns = _registry[key];
-            all_fcns.insert(all_fcns.begin(), fcns.begin(), fcns.end());
+        return _all_fcns;
+    }
+
+    /*! Precompute everything the distribution needs from the element ranges
+     *
+     * This also drops all cached distributions. Requires _cache_mutex.
+     */
+    void _update_distribution(std::vector<gain_range_t>&& ranges)
+    {
+        _cached_ranges = std::move(ranges);
+        _cached_distributions.clear();
+
+        _element_ranges.clear();
+        _max_step = 0;
+        for (const gain_range_t& range : _cached_ranges) {
+            _element_ranges.push_back({range.start(), range.stop(), range.step()});
+            // get the max step size among the gains
+            _max_step = std::max(_max_step, _element_ranges.back().step);
+        }
+
+        // get a list of indexes sorted by step size large to small
+        _indexes_step_size_dec.clear();
+        for (size_t i = 0; i < _element_ranges.size(); i++) {
+            _indexes_step_size_dec.push_back(i);
+        }
+        std::sort(_indexes_step_size_dec.begin(),
+            _indexes_step_size_dec.end(),
+            [this](const size_t rhs, const size_t lhs) {
+                return _element_ranges.at(rhs).step > _element_ranges.at(lhs).step;
+            });
+        UHD_ASSERT_THROW(_element_ranges.at(_indexes_step_size_dec.front()).step
+                         >= _element_ranges.at(_indexes_step_size_dec.back()).step);
+    }
+
+    //! Distribute an overall gain across the elements. Requires _cache_mutex.
+    std::vector<double> _distribute(const double gain) const
+    {
+        // create gain bucket to distribute power
+        std::vector<double> gain_bucket;
+        gain_bucket.reserve(_element_ranges.size());
+
+        // distribute power according to priority (round to max step)
+        double gain_left_to_distribute = gain;
+        for (const element_range_t& range : _element_ranges) {
+            gain_bucket.push_back(floor_step(
+                uhd::clip(gain_left_to_distribute, range.start, range.stop), _max_step));
+            gain_left_to_distribute -= gain_bucket.back();
         }
-        return all_fcns;
+
+        // distribute the remainder (less than max step)
+        // fill in the largest step sizes first that are less than the remainder
+        for (size_t i : _indexes_step_size_dec) {
+            const element_range_t& range = _element_ranges.at(i);
+            double additional_gain =
+                floor_step(uhd::clip(gain_bucket.at(i) + gain_left_to_distribute,
+                               range.start,
+                               range.stop),
+                    range.step)
+                - gain_bucket.at(i);
+            gain_bucket.at(i) += additional_gain;
+            gain_left_to_distribute -= additional_gain;
+        }
+        return gain_bucket;
     }
 
     uhd::dict<size_t, std::vector<gain_fcns_t>> _registry;
     uhd::dict<std::string, gain_fcns_t> _name_to_fcns;
+    //! All gain function sets, highest priority first
+    std::vector<gain_fcns_t> _all_fcns;
+
+    std::mutex _cache_mutex;
+    //! The element ranges which the cached values below were computed from
+    std::vector<gain_range_t> _cached_ranges;
+    std::vector<element_range_t> _element_ranges;
+    double _max_step = 0;
+    std::vector<size_t> _indexes_step_size_dec;
+    //! Element gains by overall gain
+    std::unordered_map<double, std::vector<double>> _cached_distributions;
 };
 
 /***********************************************************************
@@ -4,6 +4,8 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <uhd/rfnoc/graph_edge.hpp>
@@ -11,7 +13,14 @@
 #include <uhd/utils/graph_utils.hpp>
 #include <uhd/utils/log.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <numeric>
+#include <thread>
 #include <utility>
 
 
@@ -166,4 +175,301 @@ std::vector<graph_edge_t> connect_through_blocks(rfnoc_graph::sptr graph,
     return block_chain;
 }
 
+namespace {
+
+//! Number of bytes we read from the file and stream in one go
+constexpr size_t REPLAY_LOAD_CHUNK_SIZE = 16 * 1024 * 1024;
+//! Streaming and recording time out when they make no progress for this long
+constexpr double REPLAY_LOAD_TIMEOUT = 5.0;
+
+//! The part of the file which is loaded through one port of the Replay block
+struct replay_part_t
+{
+    size_t index;
+    size_t port;
+    uint64_t file_offset;
+    uint64_t size;
+};
+
+//! Calls fn for every part in a thread of its own, and rethrows the first
+// error once all threads are done
+void run_for_all_parts(const std::vector<replay_part_t>& parts,
+    const std::function<void(const replay_part_t&)>& fn)
+{
+    std::vector<std::future<void>> results;
+    for (const auto& part : parts) {
+        results.push_back(std::async(std::launch::async, fn, std::cref(part)));
+    }
+    std::exception_ptr error;
+    for (auto& result : results) {
+        try {
+            result.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+//! Calls fn with consecutive chunks of a part of the file
+void read_part(const std::string& filename,
+    const replay_part_t& part,
+    const std::function<void(const std::vector<char>& chunk, const size_t size)>& fn)
+{
+    std::ifstream file(filename, std::ios::binary);
+    file.seekg(part.file_offset);
+    std::vector<char> chunk(std::min<uint64_t>(REPLAY_LOAD_CHUNK_SIZE, part.size));
+    for (uint64_t pos = 0; pos < part.size;) {
+        const size_t size = std::min<uint64_t>(chunk.size(), part.size - pos);
+        if (!file.read(chunk.data(), size)) {
+            throw uhd::io_error("Could not read from file: " + filename);
+        }
+        fn(chunk, size);
+        pos += size;
+    }
+}
+
+void stream_part(tx_streamer::sptr streamer,
+    const std::string& filename,
+    const replay_part_t& part,
+    const size_t item_size)
+{
+    uhd::tx_metadata_t md;
+    md.start_of_burst = true;
+    uint64_t num_sent = 0;
+    read_part(filename, part, [&](const std::vector<char>& chunk, const size_t size) {
+        md.end_of_burst        = (num_sent + size == part.size);
+        const size_t num_items = size / item_size;
+        if (streamer->send(chunk.data(), num_items, md, REPLAY_LOAD_TIMEOUT)
+            != num_items) {
+            throw uhd::runtime_error(
+                "Timeout while streaming to Replay port " + std::to_string(part.port));
+        }
+        md.start_of_burst = false;
+        num_sent += size;
+    });
+}
+
+//! Wait until the record fullness of a port reached size bytes
+void wait_for_recording(
+    replay_block_control::sptr replay, const size_t port, const uint64_t size)
+{
+    uint64_t fullness  = replay->get_record_fullness(port);
+    auto last_progress = std::chrono::steady_clock::now();
+    const auto timeout = std::chrono::duration<double>(REPLAY_LOAD_TIMEOUT);
+    while (fullness < size) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const uint64_t new_fullness = replay->get_record_fullness(port);
+        if (new_fullness != fullness) {
+            fullness      = new_fullness;
+            last_progress = std::chrono::steady_clock::now();
+        } else if (std::chrono::steady_clock::now() - last_progress > timeout) {
+            throw uhd::runtime_error(
+                str(boost::format("Recording on Replay port %d stalled at %d of %d "
+                                  "bytes")
+                    % port % fullness % size));
+        }
+    }
+}
+
+//! Receive exactly size bytes from a streamer into buff
+void recv_all(rx_streamer::sptr streamer,
+    char* buff,
+    const size_t size,
+    const size_t item_size,
+    const size_t port)
+{
+    uhd::rx_metadata_t md;
+    const size_t num_items = size / item_size;
+    size_t num_recvd       = 0;
+    while (num_recvd < num_items) {
+        num_recvd += streamer->recv(
+            buff + num_recvd * item_size, num_items - num_recvd, md, REPLAY_LOAD_TIMEOUT);
+        if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+            throw uhd::runtime_error("Error while reading back Replay port "
+                                     + std::to_string(port) + ": " + md.strerror());
+        }
+    }
+}
+
+void verify_part(rx_streamer::sptr streamer,
+    replay_block_control::sptr replay,
+    const std::string& filename,
+    const uint64_t mem_offset,
+    const replay_part_t& part,
+    const size_t item_size)
+{
+    replay->play(mem_offset + part.file_offset, part.size, part.port);
+    std::vector<char> buff(std::min<uint64_t>(REPLAY_LOAD_CHUNK_SIZE, part.size));
+    uint64_t pos = 0;
+    read_part(filename, part, [&](const std::vector<char>& chunk, const size_t size) {
+        recv_all(streamer, buff.data(), size, item_size, part.port);
+        const auto mismatch =
+            std::mismatch(chunk.begin(), chunk.begin() + size, buff.begin());
+        if (mismatch.first != chunk.begin() + size) {
+            const uint64_t byte = part.file_offset + pos + (mismatch.first - chunk.begin());
+            throw uhd::runtime_error(
+                str(boost::format("Replay memory does not match %s at byte %d") % filename
+                    % byte));
+        }
+        pos += size;
+    });
+}
+
+} // namespace
+
+void replay_load_file(rfnoc_graph::sptr graph,
+    replay_block_control::sptr replay,
+    const std::string& filename,
+    const uint64_t mem_offset,
+    const std::vector<size_t>& ports,
+    const bool verify,
+    const std::string& format)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw uhd::io_error("Could not open file: " + filename);
+    }
+    const uint64_t file_size = static_cast<uint64_t>(file.tellg());
+    file.close();
+    const uint64_t word_size = replay->get_word_size();
+    const size_t item_size   = uhd::convert::get_bytes_per_item(format);
+    if (ports.empty()) {
+        throw uhd::value_error("No Replay ports given to load " + filename);
+    }
+    if (file_size == 0 || file_size % word_size != 0 || word_size % item_size != 0) {
+        throw uhd::value_error(
+            str(boost::format("Size of %s (%d bytes) is not a multiple of the "
+                              "Replay memory word size (%d bytes)")
+                % filename % file_size % word_size));
+    }
+    if (mem_offset % word_size != 0 || mem_offset + file_size > replay->get_mem_size()) {
+        throw uhd::value_error(
+            str(boost::format("%s does not fit into the Replay memory at offset %d")
+                % filename % mem_offset));
+    }
+
+    // Split the file into parts of whole memory words, one per port
+    const uint64_t num_words = file_size / word_size;
+    const size_t num_parts   = std::min<uint64_t>(ports.size(), num_words);
+    std::vector<replay_part_t> parts;
+    uint64_t file_offset = 0;
+    for (size_t i = 0; i < num_parts; i++) {
+        const uint64_t part_words = num_words / num_parts + (i < num_words % num_parts);
+        parts.push_back({i, ports[i], file_offset, part_words * word_size});
+        file_offset += parts.back().size;
+    }
+
+    const uhd::stream_args_t stream_args(format, format);
+    std::vector<tx_streamer::sptr> tx_streamers;
+    for (const auto& part : parts) {
+        tx_streamers.push_back(graph->create_tx_streamer(1, stream_args));
+        graph->connect(tx_streamers.back(), 0, replay->get_block_id(), part.port);
+    }
+    graph->commit();
+    for (const auto& part : parts) {
+        replay->record(mem_offset + part.file_offset, part.size, part.port);
+    }
+    UHD_LOG_DEBUG("GRAPH_UTILS",
+        "Loading " << file_size << " bytes from " << filename << " into "
+                   << replay->get_block_id() << " through " << num_parts << " ports");
+    run_for_all_parts(parts, [&](const replay_part_t& part) {
+        stream_part(tx_streamers[part.index], filename, part, item_size);
+        wait_for_recording(replay, part.port, part.size);
+    });
+    // Destroying the streamers disconnects them
+    tx_streamers.clear();
+
+    if (!verify) {
+        return;
+    }
+    std::vector<rx_streamer::sptr> rx_streamers;
+    for (const auto& part : parts) {
+        rx_streamers.push_back(graph->create_rx_streamer(1, stream_args));
+        graph->connect(replay->get_block_id(), part.port, rx_streamers.back(), 0);
+        replay->set_play_type(format, part.port);
+    }
+    graph->commit();
+    run_for_all_parts(parts, [&](const replay_part_t& part) {
+        verify_part(
+            rx_streamers[part.index], replay, filename, mem_offset, part, item_size);
+    });
+}
+
+void replay_capture_to_file(rfnoc_graph::sptr graph,
+    replay_block_control::sptr replay,
+    const std::string& filename,
+    const uint64_t num_bytes,
+    const std::function<void()>& start_source,
+    const size_t port,
+    const uint64_t mem_offset,
+    const uint64_t mem_size,
+    const std::string& format)
+{
+    const uint64_t word_size = replay->get_word_size();
+    const size_t item_size   = uhd::convert::get_bytes_per_item(format);
+    const uint64_t total_mem = replay->get_mem_size();
+    const uint64_t ring_size =
+        mem_size ? mem_size : total_mem - std::min(mem_offset, total_mem);
+    // Both halves must consist of whole memory words
+    const uint64_t half_size = ring_size / 2 / word_size * word_size;
+    if (num_bytes == 0 || num_bytes % word_size != 0 || word_size % item_size != 0) {
+        throw uhd::value_error(
+            str(boost::format("Capture size (%d bytes) is not a multiple of the "
+                              "Replay memory word size (%d bytes)")
+                % num_bytes % word_size));
+    }
+    if (mem_offset % word_size != 0 || mem_offset + ring_size > total_mem
+        || half_size == 0) {
+        throw uhd::value_error(
+            str(boost::format("Invalid capture buffer of %d bytes at offset %d")
+                % ring_size % mem_offset));
+    }
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw uhd::io_error("Could not open file: " + filename);
+    }
+
+    const uhd::stream_args_t stream_args(format, format);
+    auto rx_streamer = graph->create_rx_streamer(1, stream_args);
+    graph->connect(replay->get_block_id(), port, rx_streamer, 0);
+    replay->set_play_type(format, port);
+    graph->commit();
+    replay->record(mem_offset, 2 * half_size, port);
+    UHD_LOG_DEBUG("GRAPH_UTILS",
+        "Capturing " << num_bytes << " bytes through " << replay->get_block_id()
+                     << " into " << filename << " (buffer halves of " << half_size
+                     << " bytes)");
+    if (start_source) {
+        start_source();
+    }
+
+    std::vector<char> buff(std::min<uint64_t>(REPLAY_LOAD_CHUNK_SIZE, half_size));
+    uint64_t captured = 0;
+    for (size_t half = 0; captured < num_bytes; half ^= 1) {
+        const uint64_t size = std::min(half_size, num_bytes - captured);
+        // The record fullness counts from the beginning of the ring
+        wait_for_recording(replay, port, half * half_size + size);
+        if (half == 1 && captured + size < num_bytes) {
+            // The ring is full, and the first half is in the file already, so
+            // we can record over it while draining the second half
+            replay->record_restart(port);
+        }
+        replay->play(mem_offset + half * half_size, size, port);
+        for (uint64_t pos = 0; pos < size;) {
+            const size_t chunk_size = std::min<uint64_t>(buff.size(), size - pos);
+            recv_all(rx_streamer, buff.data(), chunk_size, item_size, port);
+            if (!file.write(buff.data(), chunk_size)) {
+                throw uhd::io_error("Could not write to file: " + filename);
+            }
+            pos += chunk_size;
+        }
+        captured += size;
+    }
+}
+
 }} // namespace uhd::rfnoc
@@ -0,0 +1,279 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/iq_codec.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+using namespace uhd;
+using namespace uhd::iq_codec;
+
+namespace {
+
+constexpr uint32_t FRAME_MAGIC   = 0x51495a55; // "UZIQ"
+constexpr uint32_t FRAME_VERSION = 1;
+
+//! The values (I or Q components) of a block are packed in LANES lanes of
+// DEPTH values each, where value i goes to lane i % LANES. That way, packing
+// shifts all lanes by the same amount, which maps onto SIMD registers.
+constexpr size_t LANES        = 8;
+constexpr size_t DEPTH        = 16;
+constexpr size_t BLOCK_VALUES = LANES * DEPTH;
+constexpr size_t BLOCK_BYTES  = BLOCK_VALUES * sizeof(int16_t);
+
+//! Flag of the block descriptor for blocks of differences
+constexpr uint8_t DELTA_FLAG = 0x80;
+constexpr uint8_t BITS_MASK  = 0x1f;
+
+struct frame_header_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t frame_size;
+    uint64_t num_bytes;
+};
+static_assert(sizeof(frame_header_t) == FRAME_HEADER_SIZE, "Unexpected header size");
+
+inline uint16_t zigzag(const uint16_t value)
+{
+    return uint16_t(value << 1) ^ uint16_t(int16_t(value) >> 15);
+}
+
+inline uint16_t unzigzag(const uint16_t value)
+{
+    return uint16_t(value >> 1) ^ uint16_t(-int16_t(value & 1));
+}
+
+unsigned bit_width(uint16_t value)
+{
+    unsigned bits = 0;
+    for (; value; value >>= 1) {
+        bits++;
+    }
+    return bits;
+}
+
+//! Pack the low \p bits bits of every value into bits * LANES words
+void pack_block(const uint16_t* values, const unsigned bits, uint16_t* packed)
+{
+    std::fill_n(packed, bits * LANES, uint16_t(0));
+    for (unsigned k = 0; k < DEPTH; k++) {
+        const unsigned pos   = k * bits;
+        const unsigned shift = pos % 16;
+        uint16_t* word       = packed + (pos / 16) * LANES;
+        const uint16_t* in   = values + k * LANES;
+        for (size_t lane = 0; lane < LANES; lane++) {
+            word[lane] |= uint16_t(in[lane] << shift);
+        }
+        if (shift + bits > 16) {
+            for (size_t lane = 0; lane < LANES; lane++) {
+                word[LANES + lane] |= uint16_t(in[lane] >> (16 - shift));
+            }
+        }
+    }
+}
+
+void unpack_block(const uint16_t* packed, const unsigned bits, uint16_t* values)
+{
+    const uint16_t mask = uint16_t((1u << bits) - 1);
+    for (unsigned k = 0; k < DEPTH; k++) {
+        const unsigned pos    = k * bits;
+        const unsigned shift  = pos % 16;
+        const uint16_t* word  = packed + (pos / 16) * LANES;
+        uint16_t* out         = values + k * LANES;
+        for (size_t lane = 0; lane < LANES; lane++) {
+            out[lane] = uint16_t(word[lane] >> shift);
+        }
+        if (shift + bits > 16) {
+            for (size_t lane = 0; lane < LANES; lane++) {
+                out[lane] |= uint16_t(word[LANES + lane] << (16 - shift));
+            }
+        }
+        for (size_t lane = 0; lane < LANES; lane++) {
+            out[lane] &= mask;
+        }
+    }
+}
+
+} // namespace
+
+size_t iq_codec::get_max_frame_size(const size_t num_bytes)
+{
+    const size_t num_blocks = num_bytes / BLOCK_BYTES;
+    // One descriptor per block, and at worst 16 bits per value
+    return FRAME_HEADER_SIZE + num_blocks + num_bytes;
+}
+
+size_t iq_codec::compress(
+    const void* samples, const size_t num_bytes, void* frame, const size_t alignment)
+{
+    const uint8_t* in       = static_cast<const uint8_t*>(samples);
+    uint8_t* out            = static_cast<uint8_t*>(frame);
+    const size_t num_blocks = num_bytes / BLOCK_BYTES;
+    uint8_t* descriptors    = out + FRAME_HEADER_SIZE;
+    uint8_t* data           = descriptors + num_blocks;
+
+    // The differences of the first block are to zero, so every frame can be
+    // decompressed by itself
+    uint16_t prev_i = 0, prev_q = 0;
+    for (size_t block = 0; block < num_blocks; block++) {
+        uint16_t values[BLOCK_VALUES], deltas[BLOCK_VALUES], packed[BLOCK_VALUES];
+        std::memcpy(values, in + block * BLOCK_BYTES, BLOCK_BYTES);
+
+        deltas[0] = zigzag(uint16_t(values[0] - prev_i));
+        deltas[1] = zigzag(uint16_t(values[1] - prev_q));
+        for (size_t i = 2; i < BLOCK_VALUES; i++) {
+            deltas[i] = zigzag(uint16_t(values[i] - values[i - 2]));
+        }
+        prev_i = values[BLOCK_VALUES - 2];
+        prev_q = values[BLOCK_VALUES - 1];
+        uint16_t values_or = 0, deltas_or = 0;
+        for (size_t i = 0; i < BLOCK_VALUES; i++) {
+            values[i] = zigzag(values[i]);
+            values_or |= values[i];
+            deltas_or |= deltas[i];
+        }
+
+        const unsigned value_bits = bit_width(values_or);
+        const unsigned delta_bits = bit_width(deltas_or);
+        const bool use_deltas     = delta_bits < value_bits;
+        const unsigned bits       = use_deltas ? delta_bits : value_bits;
+        pack_block(use_deltas ? deltas : values, bits, packed);
+        descriptors[block] = uint8_t(bits | (use_deltas ? DELTA_FLAG : 0));
+        std::memcpy(data, packed, bits * LANES * sizeof(uint16_t));
+        data += bits * LANES * sizeof(uint16_t);
+    }
+
+    const size_t num_left = num_bytes - num_blocks * BLOCK_BYTES;
+    std::memcpy(data, in + num_blocks * BLOCK_BYTES, num_left);
+    data += num_left;
+
+    const size_t size       = size_t(data - out);
+    const size_t frame_size = (size + alignment - 1) / alignment * alignment;
+    std::fill(data, out + frame_size, uint8_t(0));
+
+    const frame_header_t header{FRAME_MAGIC, FRAME_VERSION, frame_size, num_bytes};
+    std::memcpy(out, &header, sizeof(header));
+    return frame_size;
+}
+
+frame_info_t iq_codec::get_frame_info(const void* frame, const size_t size)
+{
+    frame_header_t header;
+    if (size < sizeof(header)) {
+        throw uhd::value_error("IQ codec: Truncated frame header");
+    }
+    std::memcpy(&header, frame, sizeof(header));
+    if (header.magic != FRAME_MAGIC) {
+        throw uhd::value_error("IQ codec: Not a compressed frame");
+    }
+    if (header.version != FRAME_VERSION) {
+        throw uhd::value_error(
+            "IQ codec: Unsupported frame version " + std::to_string(header.version));
+    }
+    if (header.frame_size < sizeof(header)) {
+        throw uhd::value_error("IQ codec: Invalid frame size");
+    }
+    frame_info_t info;
+    info.frame_size = header.frame_size;
+    info.num_bytes  = header.num_bytes;
+    return info;
+}
+
+size_t iq_codec::decompress(const void* frame, const size_t size, void* samples)
+{
+    const frame_info_t info = get_frame_info(frame, size);
+    if (info.frame_size > size) {
+        throw uhd::value_error("IQ codec: Truncated frame");
+    }
+    const uint8_t* in          = static_cast<const uint8_t*>(frame);
+    const uint8_t* end         = in + info.frame_size;
+    uint8_t* out               = static_cast<uint8_t*>(samples);
+    const size_t num_bytes     = size_t(info.num_bytes);
+    const size_t num_blocks    = num_bytes / BLOCK_BYTES;
+    const uint8_t* descriptors = in + FRAME_HEADER_SIZE;
+    const uint8_t* data        = descriptors + num_blocks;
+    if (num_blocks > size_t(end - descriptors)) {
+        throw uhd::value_error("IQ codec: Truncated frame");
+    }
+
+    uint16_t prev_i = 0, prev_q = 0;
+    for (size_t block = 0; block < num_blocks; block++) {
+        const unsigned bits     = descriptors[block] & BITS_MASK;
+        const size_t data_bytes = bits * LANES * sizeof(uint16_t);
+        if (bits > 16 || data_bytes > size_t(end - data)) {
+            throw uhd::value_error("IQ codec: Corrupt frame");
+        }
+        uint16_t packed[BLOCK_VALUES], values[BLOCK_VALUES];
+        std::memcpy(packed, data, data_bytes);
+        data += data_bytes;
+        unpack_block(packed, bits, values);
+
+        for (size_t i = 0; i < BLOCK_VALUES; i++) {
+            values[i] = unzigzag(values[i]);
+        }
+        if (descriptors[block] & DELTA_FLAG) {
+            values[0] = uint16_t(values[0] + prev_i);
+            values[1] = uint16_t(values[1] + prev_q);
+            for (size_t i = 2; i < BLOCK_VALUES; i++) {
+                values[i] = uint16_t(values[i] + values[i - 2]);
+            }
+        }
+        prev_i = values[BLOCK_VALUES - 2];
+        prev_q = values[BLOCK_VALUES - 1];
+        std::memcpy(out + block * BLOCK_BYTES, values, BLOCK_BYTES);
+    }
+
+    const size_t num_left = num_bytes - num_blocks * BLOCK_BYTES;
+    if (num_left > size_t(end - data)) {
+        throw uhd::value_error("IQ codec: Truncated frame");
+    }
+    std::memcpy(out + num_blocks * BLOCK_BYTES, data, num_left);
+    return num_bytes;
+}
+
+uint64_t iq_codec::decompress_file(const std::string& in_path, const std::string& out_path)
+{
+    std::ifstream in(in_path, std::ios::binary);
+    if (!in) {
+        throw uhd::io_error("Cannot open " + in_path);
+    }
+    std::ofstream out(out_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw uhd::io_error("Cannot create " + out_path);
+    }
+
+    std::vector<char> frame, samples;
+    uint64_t num_bytes = 0;
+    while (true) {
+        frame.resize(FRAME_HEADER_SIZE);
+        in.read(frame.data(), FRAME_HEADER_SIZE);
+        if (in.gcount() == 0 && in.eof()) {
+            break;
+        }
+        const frame_info_t info = get_frame_info(frame.data(), size_t(in.gcount()));
+        frame.resize(size_t(info.frame_size));
+        samples.resize(size_t(info.num_bytes));
+        in.read(frame.data() + FRAME_HEADER_SIZE,
+            std::streamsize(info.frame_size - FRAME_HEADER_SIZE));
+        if (uint64_t(in.gcount()) != info.frame_size - FRAME_HEADER_SIZE) {
+            throw uhd::value_error("IQ codec: Truncated frame in " + in_path);
+        }
+        decompress(frame.data(), frame.size(), samples.data());
+        if (!out.write(samples.data(), std::streamsize(samples.size()))) {
+            throw uhd::io_error("Cannot write to " + out_path);
+        }
+        num_bytes += info.num_bytes;
+    }
+    out.close();
+    if (!out) {
+        throw uhd::io_error("Cannot write to " + out_path);
+    }
+    return num_bytes;
+}
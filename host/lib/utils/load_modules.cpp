@@ -7,10 +7,12 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/utils/paths.hpp>
-#include <uhd/utils/static.hpp>
+#include <uhdlib/utils/load_modules.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -88,9 +90,29 @@ static void load_module_path(const fs::path& path)
 /*!
  * Load all the modules given in the module paths.
  */
-UHD_STATIC_BLOCK(load_modules)
+void uhd::load_modules()
 {
-    for (const fs::path& path : uhd::get_module_paths()) {
-        load_module_path(path);
+    static std::atomic<bool> modules_loaded{false};
+    if (modules_loaded.load(std::memory_order_acquire)) {
+        return;
+    }
+    // Other threads wait until the modules are loaded. A module whose static
+    // initializers end up here again (same thread) gets through the lock and
+    // returns, because the flag is set before loading.
+    static std::recursive_mutex load_mutex;
+    static bool loading = false;
+    std::lock_guard<std::recursive_mutex> lock(load_mutex);
+    if (loading) {
+        return;
+    }
+    loading = true;
+    try {
+        for (const fs::path& path : uhd::get_module_paths()) {
+            load_module_path(path);
+        }
+    } catch (const std::exception& err) {
+        std::cerr << boost::format("Error loading modules: %s") % err.what()
+                  << std::endl;
     }
+    modules_loaded.store(true, std::memory_order_release);
 }
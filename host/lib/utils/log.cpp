@@ -13,14 +13,23 @@
 #include <uhd/utils/static.hpp>
 #include <uhd/utils/thread.hpp>
 #include <uhd/version.hpp>
+#include <uhdlib/utils/fast_log.hpp>
 #include <uhdlib/utils/isatty.hpp>
+#include <uhdlib/utils/spsc_ring.hpp>
+#include <boost/date_time/c_local_time_adjustor.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
 #include <atomic>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 #ifdef HAVE_DPDK
 #include <uhdlib/transport/dpdk/common.hpp>
 #endif
@@ -47,9 +56,13 @@ namespace {
 constexpr double READ_TIMEOUT = 0.5; // Waiting time to read from the queue
 #endif
 
-constexpr char LOG_THREAD_NAME[]          = "uhd_log";
-constexpr char LOG_THREAD_NAME_FP[]       = "uhd_log_fastpath";
-constexpr char LOG_THREAD_NAME_FP_DUMMY[] = "uhd_log_fp_dummy";
+constexpr char LOG_THREAD_NAME[]    = "uhd_log";
+constexpr char LOG_THREAD_NAME_FP[] = "uhd_log_fastpath";
+
+//! Number of fast log records each thread can have in flight
+constexpr size_t FAST_LOG_RING_SIZE = 512;
+//! How often the logger thread drains the fast log rings
+constexpr auto FAST_LOG_DRAIN_INTERVAL = std::chrono::milliseconds(1);
 
 std::string verbosity_color(const uhd::log::severity_level& level)
 {
@@ -101,6 +114,49 @@ inline std::string path_to_filename(std::string path)
     return path.substr(path.find_last_of("/\\") + 1);
 }
 
+//! The fast log records of one thread
+struct fast_log_ring
+{
+    fast_log_ring() : records(FAST_LOG_RING_SIZE) {}
+
+    uhd::spsc_ring<uhd::_log::fast_log_record> records;
+    //! Records which didn't fit into the ring
+    std::atomic<size_t> num_dropped{0};
+    //! Set when the thread has exited, and won't add any more records
+    std::atomic<bool> orphaned{false};
+};
+
+//! Format the arguments of a fast log record into its message
+std::string format_fast_log(const uhd::_log::fast_log_record& record)
+{
+    boost::format fmt(record.format);
+    // Like the regular macros, a bad format must never throw
+    fmt.exceptions(boost::io::no_error_bits);
+    for (size_t i = 0; i < record.num_args; i++) {
+        const uhd::_log::fast_log_arg& arg = record.args[i];
+        switch (arg.type) {
+            case uhd::_log::fast_log_arg::SIGNED:
+                fmt % arg.s;
+                break;
+            case uhd::_log::fast_log_arg::UNSIGNED:
+                fmt % arg.u;
+                break;
+            case uhd::_log::fast_log_arg::FLOAT:
+                fmt % arg.f;
+                break;
+        }
+    }
+    return fmt.str();
+}
+
+//! Convert the time stamp of a fast log record to local time
+pt::ptime fast_log_time(const int64_t time_ns)
+{
+    const pt::ptime utc = pt::from_time_t(static_cast<std::time_t>(time_ns / 1000000000))
+                          + pt::microseconds((time_ns % 1000000000) / 1000);
+    return boost::date_time::c_local_adjustor<pt::ptime>::utc_to_local(utc);
+}
+
 } // namespace
 
 namespace uhd { namespace log {
@@ -216,16 +272,10 @@ class log_resource
 {
 public:
     uhd::log::severity_level global_level;
+    //! Set if UHD_LOG_FASTPATH messages are printed
+    bool fastpath_enabled = true;
 
-    log_resource(void)
-        : global_level(uhd::log::off)
-        , _exit(false)
-        ,
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        _fastpath_queue(10)
-        ,
-#endif
-        _log_queue(10)
+    log_resource(void) : global_level(uhd::log::off), _exit(false), _log_queue(10)
     {
         // allow override from macro definition
 #ifdef UHD_LOG_MIN_LEVEL
@@ -259,32 +309,21 @@ public:
             std::make_shared<std::thread>(std::thread([this]() { this->pop_task(); }));
         uhd::set_thread_name(_pop_task.get(), LOG_THREAD_NAME);
 
-        // Fastpath message consumer
+        // Fast log and fastpath message consumer
 #ifndef UHD_LOG_FASTPATH_DISABLE
         // allow override from environment variables
-        const bool enable_fastpath = []() {
-            const char* disable_fastpath_env = std::getenv("UHD_LOG_FASTPATH_DISABLE");
-            if (disable_fastpath_env != NULL && disable_fastpath_env[0] != '\0') {
-                return false;
-            }
-            return true;
-        }();
-
-        if (enable_fastpath) {
-            _pop_fastpath_task = std::make_shared<std::thread>(
-                std::thread([this]() { this->pop_fastpath_task(); }));
-            uhd::set_thread_name(_pop_fastpath_task.get(), LOG_THREAD_NAME_FP);
-        } else {
-            _pop_fastpath_task = std::make_shared<std::thread>(
-                std::thread([this]() { this->pop_fastpath_dummy_task(); }));
-            uhd::set_thread_name(_pop_fastpath_task.get(), LOG_THREAD_NAME_FP_DUMMY);
+        const char* disable_fastpath_env = std::getenv("UHD_LOG_FASTPATH_DISABLE");
+        if (disable_fastpath_env != NULL && disable_fastpath_env[0] != '\0') {
+            fastpath_enabled = false;
             _publish_log_msg("Fastpath logging disabled at runtime.");
         }
 #else
-        {
-            _publish_log_msg("Fastpath logging disabled at compile time.");
-        }
+        fastpath_enabled = false;
+        _publish_log_msg("Fastpath logging disabled at compile time.");
 #endif
+        _pop_fast_task = std::make_shared<std::thread>(
+            std::thread([this]() { this->pop_fast_task(); }));
+        uhd::set_thread_name(_pop_fast_task.get(), LOG_THREAD_NAME_FP);
     }
 
     ~log_resource(void)
@@ -304,21 +343,22 @@ public:
             std::this_thread::get_id());
         final_message.message = "";
         push(final_message);
-#    ifndef UHD_LOG_FASTPATH_DISABLE
-        push_fastpath("");
-#    endif
 #endif // BOOST_MSVC
 
+        {
+            std::lock_guard<std::mutex> l(_rings_mutex);
+            _drain_cond.notify_one();
+        }
+        // The fast log thread passes its messages on to the loggers, so it
+        // must be done before they are cleared
+        _pop_fast_task->join();
+        _pop_fast_task.reset();
         _pop_task->join();
         {
             std::lock_guard<std::mutex> l(_logmap_mutex);
             _loggers.clear();
         }
         _pop_task.reset();
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        _pop_fastpath_task->join();
-        _pop_fastpath_task.reset();
-#endif
     }
 
     void push(const uhd::log::logging_info& log_info)
@@ -327,14 +367,36 @@ public:
         _log_queue.push_with_timed_wait(log_info, PUSH_TIMEOUT);
     }
 
-#ifndef UHD_LOG_FASTPATH_DISABLE
-    void push_fastpath(const std::string& message)
+    /*! Add a fast log record to the ring of the calling thread
+     *
+     * This never waits. If the ring is full, the record is dropped, and only
+     * counted.
+     */
+    void push_fast(const uhd::_log::fast_log_record& record)
     {
-        // Never wait. If the buffer is full, we just don't see the message.
-        // Too bad.
-        _fastpath_queue.push_with_haste(message);
+        // The ring is created on the first message of each thread, and
+        // released by the logger thread once the thread has exited and the
+        // ring is drained
+        struct ring_holder
+        {
+            ~ring_holder()
+            {
+                if (ring) {
+                    ring->orphaned = true;
+                }
+            }
+            std::shared_ptr<fast_log_ring> ring;
+        };
+        static thread_local ring_holder holder;
+        if (!holder.ring) {
+            holder.ring = std::make_shared<fast_log_ring>();
+            std::lock_guard<std::mutex> l(_rings_mutex);
+            _rings.push_back(holder.ring);
+        }
+        if (!holder.ring->records.push(record)) {
+            holder.ring->num_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
     }
-#endif
 
     void _handle_log_info(const uhd::log::logging_info& log_info)
     {
@@ -378,48 +440,38 @@ public:
         // Terminate this thread.
     }
 
-    void pop_fastpath_task()
+    /*! Drain the fast log rings of all threads
+     *
+     * The rings are polled rather than waited on, so that adding a record
+     * never has to wake up this thread.
+     */
+    void pop_fast_task()
     {
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        std::string msg;
+        std::vector<std::shared_ptr<fast_log_ring>> rings;
         while (!_exit) {
-#    ifdef BOOST_MSVC
-            // Some versions of MSVC will hang if threads are being joined after main has
-            // completed, so we need to guarantee a timeout here
-            if (_fastpath_queue.pop_with_timed_wait(msg, READ_TIMEOUT)) {
-                std::cerr << msg << std::flush;
+            {
+                std::unique_lock<std::mutex> l(_rings_mutex);
+                _drain_cond.wait_for(l, FAST_LOG_DRAIN_INTERVAL);
+                // Threads which have exited and whose records have all been
+                // handled won't add any more
+                _rings.erase(std::remove_if(_rings.begin(),
+                                 _rings.end(),
+                                 [](const std::shared_ptr<fast_log_ring>& ring) {
+                                     return ring->orphaned
+                                            && ring->records.read_available() == 0;
+                                 }),
+                    _rings.end());
+                rings = _rings;
             }
-#    else
-            _fastpath_queue.pop_with_wait(msg);
-            std::cerr << msg << std::flush;
-#    endif // BOOST_MSVC
-        }
-
-        // Exit procedure: Clear the queue
-        while (_fastpath_queue.pop_with_haste(msg)) {
-            std::cerr << msg << std::flush;
+            _drain_fast_rings(rings);
         }
-#endif
-    }
 
-    void pop_fastpath_dummy_task()
-    {
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        std::string msg;
-        while (!_exit) {
-#    ifdef BOOST_MSVC
-            // Some versions of MSVC will hang if threads are being joined after main has
-            // completed, so we need to guarantee a timeout here
-            _fastpath_queue.pop_with_timed_wait(msg, READ_TIMEOUT);
-#    else
-            _fastpath_queue.pop_with_wait(msg);
-#    endif // BOOST_MSVC
+        // Exit procedure: Clear the rings
+        {
+            std::lock_guard<std::mutex> l(_rings_mutex);
+            rings = _rings;
         }
-
-        // Exit procedure: Clear the queue
-        while (_fastpath_queue.pop_with_haste(msg))
-            ;
-#endif
+        _drain_fast_rings(rings);
     }
 
     void add_logger(const std::string& key, uhd::log::log_fn_t logger_fn)
@@ -436,9 +488,47 @@ public:
 
 private:
     std::shared_ptr<std::thread> _pop_task;
-#ifndef UHD_LOG_FASTPATH_DISABLE
-    std::shared_ptr<std::thread> _pop_fastpath_task;
-#endif
+    std::shared_ptr<std::thread> _pop_fast_task;
+
+    void _drain_fast_rings(const std::vector<std::shared_ptr<fast_log_ring>>& rings)
+    {
+        uhd::_log::fast_log_record record;
+        for (const auto& ring : rings) {
+            while (ring->records.pop(record)) {
+                _handle_fast_log_record(record);
+            }
+            const size_t num_dropped = ring->num_dropped.exchange(0);
+            if (num_dropped > 0) {
+                auto log_info =
+                    uhd::log::logging_info(pt::microsec_clock::local_time(),
+                        uhd::log::warning,
+                        __FILE__,
+                        __LINE__,
+                        "LOGGING",
+                        std::this_thread::get_id());
+                log_info.message = "Dropped " + std::to_string(num_dropped)
+                                   + " fast log messages, the ring was full";
+                _handle_log_info(log_info);
+            }
+        }
+    }
+
+    void _handle_fast_log_record(const uhd::_log::fast_log_record& record)
+    {
+        if (!record.format) {
+            std::cerr << record.text << std::flush;
+            return;
+        }
+        auto log_info    = uhd::log::logging_info(fast_log_time(record.time_ns),
+            record.verbosity,
+            record.file,
+            record.line,
+            record.component,
+            record.thread_id);
+        log_info.message = format_fast_log(record);
+        _handle_log_info(log_info);
+    }
+
     uhd::log::severity_level _get_log_level(
         const std::string& log_level_str, const uhd::log::severity_level& previous_level)
     {
@@ -513,10 +603,12 @@ private:
     std::atomic<bool> _exit;
     using level_logfn_pair = std::pair<uhd::log::severity_level, uhd::log::log_fn_t>;
     std::map<std::string, level_logfn_pair> _loggers;
-#ifndef UHD_LOG_FASTPATH_DISABLE
-    uhd::transport::bounded_buffer<std::string> _fastpath_queue;
-#endif
     uhd::transport::bounded_buffer<uhd::log::logging_info> _log_queue;
+    //! Protects _rings
+    std::mutex _rings_mutex;
+    //! Signalled to stop the fast log thread
+    std::condition_variable _drain_cond;
+    std::vector<std::shared_ptr<fast_log_ring>> _rings;
 };
 
 UHD_SINGLETON_FCN(log_resource, log_rs);
@@ -552,17 +644,34 @@ uhd::_log::log::~log(void)
     }
 }
 
-#ifndef UHD_LOG_FASTPATH_DISABLE
 void uhd::_log::log_fastpath(const std::string& msg)
 {
-    log_rs().push_fastpath(msg);
+    if (!log_rs().fastpath_enabled) {
+        return;
+    }
+    fast_log_record record;
+    record.format = nullptr;
+    // Fastpath messages are usually a single character, so truncating them
+    // is not expected to ever happen
+    const size_t size = std::min(msg.size(), fast_log_record::TEXT_SIZE - 1);
+    std::memcpy(record.text, msg.data(), size);
+    record.text[size] = '\0';
+    log_rs().push_fast(record);
 }
-#else
-void uhd::_log::log_fastpath(const std::string&)
+
+bool uhd::_log::fast_log_enabled(const uhd::log::severity_level verbosity)
 {
-    // nop
+    return verbosity >= log_rs().global_level;
+}
+
+void uhd::_log::push_fast_log(fast_log_record& record)
+{
+    record.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    record.thread_id = std::this_thread::get_id();
+    log_rs().push_fast(record);
 }
-#endif
 
 /***********************************************************************
  * Public API calls
@@ -0,0 +1,475 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/usrp/multi_usrp.hpp>
+#include <uhd/utils/metrics.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+
+using namespace uhd::metrics;
+
+namespace {
+
+//! Bucket bounds of the control latency histogram, 5 us to 1 s
+const std::vector<double> CTRL_LATENCY_BOUNDS{5e-6,
+    10e-6,
+    20e-6,
+    50e-6,
+    100e-6,
+    200e-6,
+    500e-6,
+    1e-3,
+    2e-3,
+    5e-3,
+    10e-3,
+    100e-3,
+    1.0};
+
+std::string escape_label_value(const std::string& value)
+{
+    std::string escaped;
+    for (const char c : value) {
+        if (c == '\\' || c == '"') {
+            escaped += '\\';
+            escaped += c;
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string format_labels(const labels_t& labels)
+{
+    if (labels.empty()) {
+        return "";
+    }
+    std::string result = "{";
+    for (const auto& label : labels) {
+        result += (result.size() > 1 ? "," : "") + label.first + "=\""
+                  + escape_label_value(label.second) + "\"";
+    }
+    return result + "}";
+}
+
+std::string format_value(const double value)
+{
+    if (value == std::numeric_limits<double>::infinity()) {
+        return "+Inf";
+    }
+    std::ostringstream ss;
+    ss << std::setprecision(12) << value;
+    return ss.str();
+}
+
+labels_t merge_labels(labels_t labels, const labels_t& extra)
+{
+    labels.insert(extra.begin(), extra.end());
+    return labels;
+}
+
+//! The samples of one metric family, in the order they were added
+class metric_families
+{
+public:
+    void add(const std::string& name,
+        const std::string& type,
+        const std::string& help,
+        const std::string& sample_name,
+        const labels_t& labels,
+        const double value)
+    {
+        if (!_families.count(name)) {
+            _order.push_back(name);
+            _families[name] = {type, help, {}};
+        }
+        _families[name].samples.push_back(
+            sample_name + format_labels(labels) + " " + format_value(value));
+    }
+
+    void add_counter(const std::string& name,
+        const std::string& help,
+        const labels_t& labels,
+        const double value)
+    {
+        add(name, "counter", help, name + "_total", labels, value);
+    }
+
+    void add_gauge(const std::string& name,
+        const std::string& help,
+        const labels_t& labels,
+        const double value)
+    {
+        add(name, "gauge", help, name, labels, value);
+    }
+
+    void add_histogram(const std::string& name,
+        const std::string& help,
+        const labels_t& labels,
+        const histogram::snapshot_t& snapshot)
+    {
+        uint64_t count = 0;
+        for (size_t i = 0; i < snapshot.counts.size(); i++) {
+            count += snapshot.counts[i];
+            const double bound = i < snapshot.bounds.size()
+                                     ? snapshot.bounds[i]
+                                     : std::numeric_limits<double>::infinity();
+            add(name,
+                "histogram",
+                help,
+                name + "_bucket",
+                merge_labels({{"le", format_value(bound)}}, labels),
+                double(count));
+        }
+        add(name, "histogram", help, name + "_count", labels, double(count));
+        add(name, "histogram", help, name + "_sum", labels, snapshot.sum);
+    }
+
+    std::string to_string() const
+    {
+        std::ostringstream ss;
+        for (const auto& name : _order) {
+            const family_t& family = _families.at(name);
+            ss << "# TYPE " << name << " " << family.type << "\n";
+            ss << "# HELP " << name << " " << family.help << "\n";
+            for (const auto& sample : family.samples) {
+                ss << sample << "\n";
+            }
+        }
+        ss << "# EOF\n";
+        return ss.str();
+    }
+
+private:
+    struct family_t
+    {
+        std::string type;
+        std::string help;
+        std::vector<std::string> samples;
+    };
+
+    std::vector<std::string> _order;
+    std::map<std::string, family_t> _families;
+};
+
+void add_telemetry(metric_families& families,
+    const std::string& prefix,
+    const uhd::stream_telemetry_t& telemetry,
+    const labels_t& labels)
+{
+    families.add_counter(prefix + "packets",
+        "Data packets, summed over all channels",
+        labels,
+        double(telemetry.packets));
+    families.add_counter(prefix + "samples",
+        "Samples per channel",
+        labels,
+        double(telemetry.samples));
+    families.add_counter(prefix + "sequence_errors",
+        "Sequence errors",
+        labels,
+        double(telemetry.sequence_errors));
+    families.add_gauge(prefix + "fc_bytes_outstanding",
+        "Bytes in flight according to flow control, summed over all channels",
+        labels,
+        double(telemetry.fc_bytes_outstanding));
+    families.add_counter(prefix + "buffer_wait_seconds",
+        "Time spent waiting for buffers or flow control credits",
+        labels,
+        double(telemetry.buff_wait_ns) / 1e9);
+    families.add_counter(prefix + "convert_seconds",
+        "Time spent converting samples",
+        labels,
+        double(telemetry.convert_ns) / 1e9);
+}
+
+//! A temperature sensor, and the labels it is exported with
+struct temp_sensor_t
+{
+    std::string name;
+    std::string direction;
+    size_t index;
+    labels_t labels;
+};
+
+//! Read a sensor as a number, return false if it isn't one
+bool read_sensor(const uhd::sensor_value_t& sensor, double& value)
+{
+    switch (sensor.type) {
+        case uhd::sensor_value_t::REALNUM:
+            value = sensor.to_real();
+            return true;
+        case uhd::sensor_value_t::INTEGER:
+            value = double(sensor.to_int());
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool is_temp_sensor(const std::string& name)
+{
+    return name.find("temp") != std::string::npos;
+}
+
+} // namespace
+
+/******************************************************************************
+ * histogram
+ *****************************************************************************/
+histogram::histogram(const std::vector<double>& bounds)
+    : _bounds(bounds), _counts(new std::atomic<uint64_t>[bounds.size() + 1]), _sum(0.0)
+{
+    if (bounds.empty()) {
+        throw uhd::value_error("histogram: At least one bucket bound is required");
+    }
+    for (size_t i = 1; i < bounds.size(); i++) {
+        if (!(bounds[i] > bounds[i - 1])) {
+            throw uhd::value_error("histogram: Bucket bounds must be ascending");
+        }
+    }
+    for (size_t i = 0; i <= bounds.size(); i++) {
+        _counts[i] = 0;
+    }
+}
+
+void histogram::observe(const double value)
+{
+    const size_t bucket =
+        std::lower_bound(_bounds.begin(), _bounds.end(), value) - _bounds.begin();
+    _counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    double sum = _sum.load(std::memory_order_relaxed);
+    while (!_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+    }
+}
+
+histogram::snapshot_t histogram::get_snapshot() const
+{
+    snapshot_t snapshot;
+    snapshot.bounds = _bounds;
+    for (size_t i = 0; i <= _bounds.size(); i++) {
+        snapshot.counts.push_back(_counts[i].load(std::memory_order_relaxed));
+    }
+    snapshot.sum = _sum.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::vector<double> uhd::metrics::get_ctrl_latency_bounds()
+{
+    return CTRL_LATENCY_BOUNDS;
+}
+
+histogram::sptr uhd::metrics::get_ctrl_latency_histogram()
+{
+    static histogram::sptr ctrl_latency =
+        std::make_shared<histogram>(CTRL_LATENCY_BOUNDS);
+    return ctrl_latency;
+}
+
+/******************************************************************************
+ * exporter
+ *****************************************************************************/
+class exporter_impl : public exporter
+{
+public:
+    exporter_impl()
+    {
+        _histograms.push_back({"uhd_ctrl_latency_seconds",
+            "Time from sending a control request to receiving its ACK",
+            get_ctrl_latency_histogram(),
+            {}});
+    }
+
+    void add_rx_streamer(uhd::rx_streamer::sptr streamer, const labels_t& labels) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _rx_streamers.push_back({streamer, labels});
+    }
+
+    void add_tx_streamer(uhd::tx_streamer::sptr streamer, const labels_t& labels) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _tx_streamers.push_back({streamer, labels});
+    }
+
+    void add_usrp(
+        std::shared_ptr<uhd::usrp::multi_usrp> usrp, const labels_t& labels) override
+    {
+        std::vector<temp_sensor_t> sensors;
+        for (size_t mboard = 0; mboard < usrp->get_num_mboards(); mboard++) {
+            for (const auto& name : usrp->get_mboard_sensor_names(mboard)) {
+                if (is_temp_sensor(name)) {
+                    sensors.push_back({name,
+                        "",
+                        mboard,
+                        merge_labels(
+                            {{"mboard", std::to_string(mboard)}, {"sensor", name}},
+                            labels)});
+                }
+            }
+        }
+        auto add_chan_sensors = [&](const std::string& direction,
+                                    const size_t num_chans,
+                                    const std::function<std::vector<std::string>(size_t)>&
+                                        get_names) {
+            for (size_t chan = 0; chan < num_chans; chan++) {
+                for (const auto& name : get_names(chan)) {
+                    if (is_temp_sensor(name)) {
+                        sensors.push_back({name,
+                            direction,
+                            chan,
+                            merge_labels({{"direction", direction},
+                                             {"chan", std::to_string(chan)},
+                                             {"sensor", name}},
+                                labels)});
+                    }
+                }
+            }
+        };
+        add_chan_sensors("rx", usrp->get_rx_num_channels(), [&usrp](size_t chan) {
+            return usrp->get_rx_sensor_names(chan);
+        });
+        add_chan_sensors("tx", usrp->get_tx_num_channels(), [&usrp](size_t chan) {
+            return usrp->get_tx_sensor_names(chan);
+        });
+
+        std::lock_guard<std::mutex> l(_mutex);
+        _usrps.push_back({usrp, std::move(sensors)});
+    }
+
+    void add_gauge(const std::string& name,
+        const std::string& help,
+        gauge_fn fn,
+        const labels_t& labels) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _gauges.push_back({name, help, std::move(fn), labels});
+    }
+
+    void add_histogram(const std::string& name,
+        const std::string& help,
+        histogram::sptr hist,
+        const labels_t& labels) override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _histograms.push_back({name, help, hist, labels});
+    }
+
+    std::string scrape() const override
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        metric_families families;
+        for (const auto& entry : _rx_streamers) {
+            if (auto streamer = entry.streamer.lock()) {
+                const auto telemetry = streamer->get_telemetry();
+                add_telemetry(families, "uhd_rx_", telemetry, entry.labels);
+                families.add_counter("uhd_rx_overflows",
+                    "Overruns reported to the application",
+                    entry.labels,
+                    double(telemetry.overflows));
+            }
+        }
+        for (const auto& entry : _tx_streamers) {
+            if (auto streamer = entry.streamer.lock()) {
+                const auto telemetry = streamer->get_telemetry();
+                add_telemetry(families, "uhd_tx_", telemetry, entry.labels);
+                families.add_counter("uhd_tx_underflows",
+                    "Underruns reported by the device",
+                    entry.labels,
+                    double(telemetry.underflows));
+                families.add_counter("uhd_tx_async_msgs_dropped",
+                    "Async messages dropped because the queue was full",
+                    entry.labels,
+                    double(telemetry.async_msgs_dropped));
+            }
+        }
+        for (const auto& entry : _usrps) {
+            auto usrp = entry.usrp.lock();
+            if (!usrp) {
+                continue;
+            }
+            for (const auto& sensor : entry.sensors) {
+                auto get_sensor = [&usrp, &sensor]() {
+                    if (sensor.direction.empty()) {
+                        return usrp->get_mboard_sensor(sensor.name, sensor.index);
+                    }
+                    if (sensor.direction == "rx") {
+                        return usrp->get_rx_sensor(sensor.name, sensor.index);
+                    }
+                    return usrp->get_tx_sensor(sensor.name, sensor.index);
+                };
+                double value;
+                try {
+                    if (!read_sensor(get_sensor(), value)) {
+                        continue;
+                    }
+                } catch (const uhd::exception&) {
+                    continue;
+                }
+                families.add_gauge("uhd_temperature_celsius",
+                    "Temperature sensors of the devices",
+                    sensor.labels,
+                    value);
+            }
+        }
+        for (const auto& gauge : _gauges) {
+            families.add_gauge(gauge.name, gauge.help, gauge.labels, gauge.fn());
+        }
+        for (const auto& hist : _histograms) {
+            families.add_histogram(
+                hist.name, hist.help, hist.labels, hist.hist->get_snapshot());
+        }
+        return families.to_string();
+    }
+
+private:
+    template <typename streamer_type>
+    struct streamer_entry_t
+    {
+        std::weak_ptr<streamer_type> streamer;
+        labels_t labels;
+    };
+
+    struct usrp_entry_t
+    {
+        std::weak_ptr<uhd::usrp::multi_usrp> usrp;
+        std::vector<temp_sensor_t> sensors;
+    };
+
+    struct gauge_entry_t
+    {
+        std::string name;
+        std::string help;
+        gauge_fn fn;
+        labels_t labels;
+    };
+
+    struct histogram_entry_t
+    {
+        std::string name;
+        std::string help;
+        histogram::sptr hist;
+        labels_t labels;
+    };
+
+    mutable std::mutex _mutex;
+    std::vector<streamer_entry_t<uhd::rx_streamer>> _rx_streamers;
+    std::vector<streamer_entry_t<uhd::tx_streamer>> _tx_streamers;
+    std::vector<usrp_entry_t> _usrps;
+    std::vector<gauge_entry_t> _gauges;
+    std::vector<histogram_entry_t> _histograms;
+};
+
+exporter::sptr exporter::make()
+{
+    return std::make_shared<exporter_impl>();
+}
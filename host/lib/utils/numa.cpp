@@ -0,0 +1,166 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/transport/if_addrs.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#ifdef HAVE_MBIND
+#    include <linux/mempolicy.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace uhd { namespace numa {
+
+namespace {
+
+//! Read the first line of a (sysfs) file, return an empty string on failure
+std::string read_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+} // namespace
+
+int get_ifname_node(const std::string& ifname)
+{
+    if (ifname.empty()) {
+        return NO_NODE;
+    }
+    // Virtual interfaces have no device, and on non-NUMA machines the kernel
+    // reports -1
+    const std::string node = read_line("/sys/class/net/" + ifname + "/device/numa_node");
+    try {
+        return node.empty() ? NO_NODE : std::max(std::stoi(node), NO_NODE);
+    } catch (const std::exception&) {
+        return NO_NODE;
+    }
+}
+
+int get_ipv4_node(const std::string& ipv4_addr)
+{
+    for (const auto& if_addr : uhd::transport::get_if_addrs()) {
+        if (if_addr.inet == ipv4_addr) {
+            return get_ifname_node(if_addr.ifname);
+        }
+    }
+    return NO_NODE;
+}
+
+std::vector<size_t> get_node_cpus(const int node)
+{
+    if (node < 0) {
+        return {};
+    }
+    const std::string cpu_list =
+        read_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    try {
+        return parse_cpu_list(cpu_list);
+    } catch (const uhd::value_error&) {
+        return {};
+    }
+}
+
+std::vector<size_t> parse_cpu_list(const std::string& cpu_list)
+{
+    std::vector<size_t> cpus;
+    size_t start = 0;
+    while (start < cpu_list.size()) {
+        const size_t end        = std::min(cpu_list.find(',', start), cpu_list.size());
+        const std::string range = cpu_list.substr(start, end - start);
+        const size_t dash       = range.find('-');
+        size_t first, last;
+        try {
+            first = std::stoul(range.substr(0, dash));
+            last  = (dash == std::string::npos) ? first
+                                                : std::stoul(range.substr(dash + 1));
+        } catch (const std::exception&) {
+            throw uhd::value_error("Invalid CPU list: " + cpu_list);
+        }
+        if (last < first) {
+            throw uhd::value_error("Invalid CPU list: " + cpu_list);
+        }
+        for (size_t cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+        start = end + 1;
+    }
+    return cpus;
+}
+
+#ifdef HAVE_MBIND
+
+bool bind_to_node(void* mem, const size_t size, const int node)
+{
+    constexpr size_t NODEMASK_BITS = 8 * sizeof(unsigned long);
+    if (node < 0 || size_t(node) >= NODEMASK_BITS) {
+        return false;
+    }
+
+    const unsigned long nodemask = 1UL << node;
+    if (syscall(SYS_mbind, mem, size, MPOL_PREFERRED, &nodemask, NODEMASK_BITS, 0)
+        != 0) {
+        UHD_LOG_DEBUG("NUMA",
+            "Could not bind memory to NUMA node " << node << ": " << strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void* alloc_on_node(const size_t size, const int node)
+{
+    if (node < 0) {
+        return nullptr;
+    }
+
+    void* mem =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        return nullptr;
+    }
+
+    // The pages are only allocated on first touch, so the policy we set here
+    // decides where they end up
+    bind_to_node(mem, size, node);
+    return mem;
+}
+
+void free_on_node(void* mem, const size_t size)
+{
+    munmap(mem, size);
+}
+
+#else
+
+bool bind_to_node(void*, const size_t, const int)
+{
+    return false;
+}
+
+void* alloc_on_node(const size_t, const int)
+{
+    return nullptr;
+}
+
+void free_on_node(void*, const size_t)
+{
+    UHD_THROW_INVALID_CODE_PATH();
+}
+
+#endif /* HAVE_MBIND */
+
+}} // namespace uhd::numa
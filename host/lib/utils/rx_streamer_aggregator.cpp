@@ -0,0 +1,449 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/rx_streamer_aggregator.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[] = "AGGREGATOR";
+
+//! Number of times the aggregator receives new packets while aligning the
+// streamers before it gives up
+constexpr size_t MAX_ALIGNMENT_ATTEMPTS = 1000;
+
+//! Receives from one streamer on its own thread, one packet at a time
+class recv_worker
+{
+public:
+    recv_worker(rx_streamer::sptr streamer,
+        const size_t bytes_per_samp,
+        const double rate,
+        const std::string& name)
+        : _streamer(std::move(streamer))
+        , _bytes_per_samp(bytes_per_samp)
+        , _rate(rate)
+        , _max_num_samps(_streamer->get_max_num_samps())
+        , _buffs(_streamer->get_num_channels(),
+              std::vector<char>(_max_num_samps * _bytes_per_samp))
+    {
+        for (auto& buff : _buffs) {
+            _buff_ptrs.push_back(buff.data());
+        }
+        _thread = std::thread([this]() { _run(); });
+        uhd::set_thread_name(&_thread, name);
+    }
+
+    ~recv_worker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cond.notify_all();
+        _thread.join();
+    }
+
+    rx_streamer& streamer()
+    {
+        return *_streamer;
+    }
+
+    //! Start receiving the next packet in the background. Any samples which
+    // were not consumed yet are dropped.
+    void start(const double timeout)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _timeout = timeout;
+            _busy    = true;
+        }
+        _cond.notify_all();
+    }
+
+    //! Wait for the packet from start(), and rethrow what recv() threw
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this]() { return !_busy; });
+        if (_error) {
+            std::exception_ptr error = _error;
+            _error                   = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    //! Metadata of the last packet
+    const rx_metadata_t& metadata() const
+    {
+        return _md;
+    }
+
+    //! Number of samples of the last packet which were not consumed yet
+    size_t available() const
+    {
+        return _num_samps;
+    }
+
+    //! Time of the next sample
+    const time_spec_t& get_time() const
+    {
+        return _time;
+    }
+
+    //! Pointer to the next sample of a channel
+    const char* data(const size_t chan) const
+    {
+        return _buffs[chan].data() + _offset * _bytes_per_samp;
+    }
+
+    void consume(const size_t num_samps)
+    {
+        _offset += num_samps;
+        _num_samps -= num_samps;
+        _time += time_spec_t::from_ticks(num_samps, _rate);
+    }
+
+private:
+    void _run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _cond.wait(lock, [this]() { return _busy || _stop; });
+            if (_stop) {
+                return;
+            }
+            const double timeout = _timeout;
+            lock.unlock();
+            rx_metadata_t md;
+            size_t num_samps = 0;
+            std::exception_ptr error;
+            try {
+                num_samps =
+                    _streamer->recv(_buff_ptrs, _max_num_samps, md, timeout, true);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            _md        = md;
+            _num_samps = num_samps;
+            _offset    = 0;
+            _time      = md.time_spec;
+            _error     = error;
+            _busy      = false;
+            _cond.notify_all();
+        }
+    }
+
+    const rx_streamer::sptr _streamer;
+    const size_t _bytes_per_samp;
+    const double _rate;
+    const size_t _max_num_samps;
+    std::vector<std::vector<char>> _buffs;
+    std::vector<void*> _buff_ptrs;
+
+    // The packet which was received last. Only the thread which calls recv()
+    // on the aggregator accesses it while the worker isn't busy.
+    rx_metadata_t _md;
+    size_t _num_samps = 0;
+    size_t _offset    = 0;
+    time_spec_t _time;
+
+    // Hand-over between the threads, protected by _mutex
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _busy      = false;
+    bool _stop      = false;
+    double _timeout = 0.0;
+    std::exception_ptr _error;
+
+    std::thread _thread;
+};
+
+class rx_streamer_aggregator_impl : public rx_streamer_aggregator
+{
+public:
+    rx_streamer_aggregator_impl(const std::vector<rx_streamer::sptr>& streamers,
+        const std::string& cpu_format,
+        const double rate)
+        : _rate(rate)
+        , _bytes_per_samp(uhd::convert::get_bytes_per_item(cpu_format))
+        , _streamer_md(streamers.size())
+        , _end_times(streamers.size())
+        , _start_of_burst(streamers.size(), false)
+    {
+        if (streamers.empty()) {
+            throw uhd::value_error("rx_streamer_aggregator: No streamers given!");
+        }
+        if (!(rate > 0.0)) {
+            throw uhd::value_error("rx_streamer_aggregator: Invalid rate!");
+        }
+        _max_num_samps = streamers.front()->get_max_num_samps();
+        for (const auto& streamer : streamers) {
+            _chan_offsets.push_back(_num_channels);
+            _num_channels += streamer->get_num_channels();
+            _max_num_samps = std::min(_max_num_samps, streamer->get_max_num_samps());
+            _workers.push_back(std::make_unique<recv_worker>(streamer,
+                _bytes_per_samp,
+                _rate,
+                "uhd_aggr" + std::to_string(_workers.size())));
+        }
+    }
+
+    size_t get_num_channels(void) const override
+    {
+        return _num_channels;
+    }
+
+    size_t get_max_num_samps(void) const override
+    {
+        return _max_num_samps;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        rx_metadata_t& metadata,
+        const double timeout  = 0.1,
+        const bool one_packet = false) override
+    {
+        metadata.reset();
+        const auto deadline = std::chrono::steady_clock::now()
+                              + std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::duration<double>(timeout));
+        size_t num_samps_recvd = 0;
+        size_t num_attempts    = 0;
+
+        while (num_samps_recvd < nsamps_per_buff) {
+            const auto time_left = std::chrono::duration<double>(
+                deadline - std::chrono::steady_clock::now());
+            if (!_refill(std::max(0.0, time_left.count()), metadata)) {
+                // Samples which were received before the error are returned,
+                // the error itself is in the metadata. Running out of time
+                // is only an error if there are no samples.
+                if (metadata.error_code == rx_metadata_t::ERROR_CODE_TIMEOUT
+                    && num_samps_recvd > 0) {
+                    metadata.error_code = rx_metadata_t::ERROR_CODE_NONE;
+                }
+                return num_samps_recvd;
+            }
+            if (!_aligned) {
+                if (_align()) {
+                    _aligned = true;
+                } else {
+                    if (++num_attempts > MAX_ALIGNMENT_ATTEMPTS) {
+                        UHD_LOG_ERROR(LOG_ID, "Failed to time-align the streamers.");
+                        metadata.error_code = rx_metadata_t::ERROR_CODE_ALIGNMENT;
+                        return num_samps_recvd;
+                    }
+                    continue;
+                }
+            }
+
+            // Copy the samples which all streamers have
+            size_t num_samps = nsamps_per_buff - num_samps_recvd;
+            for (const auto& worker : _workers) {
+                num_samps = std::min(num_samps, worker->available());
+            }
+            if (num_samps_recvd == 0) {
+                metadata.has_time_spec = _workers.front()->metadata().has_time_spec;
+                metadata.time_spec     = _workers.front()->get_time();
+            }
+            bool end_of_burst = false;
+            for (size_t i = 0; i < _workers.size(); i++) {
+                auto& worker = *_workers[i];
+                for (size_t chan = 0; chan < worker.streamer().get_num_channels();
+                     chan++) {
+                    std::memcpy(static_cast<char*>(buffs[_chan_offsets[i] + chan])
+                                    + num_samps_recvd * _bytes_per_samp,
+                        worker.data(chan),
+                        num_samps * _bytes_per_samp);
+                }
+                worker.consume(num_samps);
+                metadata.start_of_burst |= _start_of_burst[i];
+                _start_of_burst[i] = false;
+                end_of_burst |= worker.available() == 0
+                                && worker.metadata().end_of_burst;
+            }
+            num_samps_recvd += num_samps;
+            if (end_of_burst) {
+                metadata.end_of_burst = true;
+                break;
+            }
+            if (one_packet) {
+                break;
+            }
+        }
+        return num_samps_recvd;
+    }
+
+    void issue_stream_cmd(const stream_cmd_t& stream_cmd) override
+    {
+        _aligned = false;
+        for (auto& worker : _workers) {
+            worker->streamer().issue_stream_cmd(stream_cmd);
+        }
+    }
+
+    std::vector<rx_metadata_t> get_streamer_metadata() const override
+    {
+        return _streamer_md;
+    }
+
+private:
+    /*! Receive a packet on all streamers which have no samples left
+     *
+     * \returns false if a streamer reported an error, which is then copied to
+     *          \p metadata
+     */
+    bool _refill(const double timeout, rx_metadata_t& metadata)
+    {
+        std::vector<size_t> refilled;
+        for (size_t i = 0; i < _workers.size(); i++) {
+            if (_workers[i]->available() == 0) {
+                _workers[i]->start(timeout);
+                refilled.push_back(i);
+            }
+        }
+        // Wait for all workers before rethrowing, so none is still busy
+        std::exception_ptr error;
+        for (const size_t i : refilled) {
+            try {
+                _workers[i]->wait();
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        bool timeout_error = false;
+        bool other_error   = false;
+        for (const size_t i : refilled) {
+            const auto& worker = *_workers[i];
+            rx_metadata_t& md  = _streamer_md[i];
+            md                 = worker.metadata();
+            if (md.error_code == rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                timeout_error = true;
+                continue;
+            }
+            if (md.error_code != rx_metadata_t::ERROR_CODE_NONE) {
+                if (!other_error) {
+                    metadata.error_code      = md.error_code;
+                    metadata.out_of_sequence = md.out_of_sequence;
+                }
+                other_error = true;
+                continue;
+            }
+            if (worker.available() == 0) {
+                continue;
+            }
+            // A new burst needs to be aligned again. Within a burst, every
+            // packet needs to follow its predecessor, or samples are missing.
+            if (md.start_of_burst) {
+                _start_of_burst[i] = true;
+                _aligned           = false;
+            } else if (_aligned && md.has_time_spec
+                       && std::abs((md.time_spec - _end_times[i]).get_real_secs())
+                              > 0.5 / _rate) {
+                UHD_LOG_DEBUG(LOG_ID, "Gap in the samples of streamer " << i);
+                md.error_code      = rx_metadata_t::ERROR_CODE_OVERFLOW;
+                md.out_of_sequence = true;
+                if (!other_error) {
+                    metadata.error_code      = md.error_code;
+                    metadata.out_of_sequence = true;
+                }
+                other_error = true;
+            }
+            _end_times[i] =
+                md.time_spec + time_spec_t::from_ticks(worker.available(), _rate);
+        }
+
+        if (other_error) {
+            // The streamers are no longer aligned after an overflow or a gap
+            _aligned = false;
+            return false;
+        }
+        if (timeout_error) {
+            metadata.error_code = rx_metadata_t::ERROR_CODE_TIMEOUT;
+            return false;
+        }
+        return true;
+    }
+
+    /*! Drop samples until all streamers start at the same time
+     *
+     * \returns false if a streamer ran out of samples, and needs more to
+     *          finish aligning
+     */
+    bool _align()
+    {
+        time_spec_t start_time;
+        bool time_valid = false;
+        for (const auto& worker : _workers) {
+            if (!worker->metadata().has_time_spec) {
+                // Without time stamps, there is nothing to align
+                return true;
+            }
+            if (!time_valid || worker->get_time() > start_time) {
+                start_time = worker->get_time();
+                time_valid = true;
+            }
+        }
+        bool aligned = true;
+        for (auto& worker : _workers) {
+            const size_t num_samps = static_cast<size_t>(
+                std::llround((start_time - worker->get_time()).get_real_secs() * _rate));
+            if (num_samps >= worker->available()) {
+                worker->consume(worker->available());
+                aligned = false;
+            } else {
+                worker->consume(num_samps);
+            }
+        }
+        return aligned;
+    }
+
+    const double _rate;
+    const size_t _bytes_per_samp;
+    size_t _num_channels  = 0;
+    size_t _max_num_samps = 0;
+    //! Index of the first channel of every streamer
+    std::vector<size_t> _chan_offsets;
+    std::vector<std::unique_ptr<recv_worker>> _workers;
+    std::vector<rx_metadata_t> _streamer_md;
+    //! Time after the last sample every streamer received
+    std::vector<time_spec_t> _end_times;
+    //! Streamers whose next samples start a burst
+    std::vector<bool> _start_of_burst;
+    //! False until the next recv() aligned the streamers. Stream commands
+    // clear it from any thread.
+    std::atomic<bool> _aligned{false};
+};
+
+} // namespace
+
+rx_streamer_aggregator::sptr rx_streamer_aggregator::make(
+    const std::vector<rx_streamer::sptr>& streamers,
+    const std::string& cpu_format,
+    const double rate)
+{
+    return std::make_shared<rx_streamer_aggregator_impl>(streamers, cpu_format, rate);
+}
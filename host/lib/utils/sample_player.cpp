@@ -0,0 +1,230 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/sample_player.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#ifdef HAVE_MMAP
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    include <cerrno>
+#endif
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[] = "PLAYER";
+
+//! Number of bytes the kernel is asked to read ahead of the current position
+constexpr size_t READAHEAD_SIZE = 64 * 1024 * 1024;
+
+//! Size of the chunks a file is read in, if it cannot be mapped
+constexpr size_t CHUNK_SIZE = 4 * 1024 * 1024;
+
+} // namespace
+
+class sample_player_impl : public sample_player
+{
+public:
+    sample_player_impl(const std::string& path, const size_t item_size)
+        : _path(path), _item_size(item_size)
+    {
+        if (item_size == 0) {
+            throw uhd::value_error("Sample player: The item size must not be zero");
+        }
+        uint64_t file_size = 0;
+#ifdef HAVE_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st) != 0) {
+            const std::string error = std::strerror(errno);
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw uhd::io_error("Cannot open " + path + ": " + error);
+        }
+        file_size = uint64_t(st.st_size);
+        if (file_size != 0) {
+            // The mapping stays valid after closing the file
+            void* map = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "Cannot map " << path << " (" << std::strerror(errno)
+                                  << "), reading it in chunks instead");
+            } else {
+                _map      = static_cast<const char*>(map);
+                _map_size = size_t(file_size);
+                ::madvise(map, _map_size, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+#endif
+        if (!_map) {
+            _file.open(path, std::ios::binary | std::ios::ate);
+            if (!_file) {
+                throw uhd::io_error("Cannot open " + path);
+            }
+            file_size = uint64_t(_file.tellg());
+            // Chunks hold whole samples
+            _chunk.resize(std::max(CHUNK_SIZE / item_size, size_t(1)) * item_size);
+        }
+        _num_samps = size_t(file_size / item_size);
+        if (file_size % item_size != 0) {
+            UHD_LOG_WARNING(LOG_ID,
+                path << " does not hold a whole number of samples, ignoring the last "
+                     << file_size % item_size << " bytes");
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            (_map ? "Mapped " : "Opened ") << _num_samps << " samples from " << path);
+    }
+
+    ~sample_player_impl() override
+    {
+#ifdef HAVE_MMAP
+        if (_map) {
+            ::munmap(const_cast<char*>(_map), _map_size);
+        }
+#endif
+    }
+
+    size_t get_num_samps() const override
+    {
+        return _num_samps;
+    }
+
+    size_t get_position() const override
+    {
+        return _position;
+    }
+
+    size_t get_samps_left() const override
+    {
+        return _num_samps - _position;
+    }
+
+    void seek(const size_t position) override
+    {
+        if (position > _num_samps) {
+            throw uhd::value_error("Sample player: Cannot seek beyond the end of "
+                                   + _path);
+        }
+        _position = position;
+        // The data of the chunk must be reread, and the read-ahead restarted
+        _chunk_samps    = 0;
+        _advised_offset = position * _item_size / READAHEAD_SIZE * READAHEAD_SIZE;
+    }
+
+    void set_loop(const bool loop) override
+    {
+        _loop = loop;
+    }
+
+    bool get_loop() const override
+    {
+        return _loop;
+    }
+
+    bool is_mapped() const override
+    {
+        return _map != nullptr;
+    }
+
+    size_t get_read_buff(const void*& buff, const size_t max_samps) override
+    {
+        if (_position == _num_samps && _loop) {
+            seek(0);
+        }
+        const size_t num_samps = std::min(max_samps, _num_samps - _position);
+        if (_map) {
+            _read_ahead();
+            buff = _map + _position * _item_size;
+            return num_samps;
+        }
+        if (_chunk_samps == 0) {
+            _read_chunk();
+        }
+        buff = _chunk.data() + _chunk_offset * _item_size;
+        return std::min(num_samps, _chunk_samps - _chunk_offset);
+    }
+
+    void consume(const size_t num_samps) override
+    {
+        _position = std::min(_position + num_samps, _num_samps);
+        if (!_map && _chunk_samps != 0) {
+            _chunk_offset += num_samps;
+            if (_chunk_offset >= _chunk_samps) {
+                _chunk_samps = 0;
+            }
+        }
+        if (_position == _num_samps && _loop) {
+            seek(0);
+        }
+    }
+
+private:
+    //! Ask the kernel to read the part of the mapping after the current position
+    void _read_ahead()
+    {
+#ifdef HAVE_MMAP
+        // Stay at least half of the read-ahead size in front of the position.
+        // The offsets are multiples of READAHEAD_SIZE, so they are page aligned.
+        const size_t file_size = _num_samps * _item_size;
+        const size_t offset    = _position * _item_size;
+        while (_advised_offset < file_size
+               && _advised_offset < offset + READAHEAD_SIZE / 2) {
+            const size_t length = std::min(READAHEAD_SIZE, file_size - _advised_offset);
+            ::madvise(const_cast<char*>(_map) + _advised_offset, length, MADV_WILLNEED);
+            _advised_offset += length;
+        }
+#endif
+    }
+
+    //! Read the chunk which starts at the current position
+    void _read_chunk()
+    {
+        const size_t num_samps =
+            std::min(_chunk.size() / _item_size, _num_samps - _position);
+        _file.clear();
+        _file.seekg(std::streamoff(_position) * std::streamoff(_item_size));
+        _file.read(_chunk.data(), std::streamsize(num_samps * _item_size));
+        if (!_file) {
+            throw uhd::io_error("Cannot read from " + _path);
+        }
+        _chunk_samps  = num_samps;
+        _chunk_offset = 0;
+    }
+
+    const std::string _path;
+    const size_t _item_size;
+    size_t _num_samps = 0;
+    size_t _position  = 0;
+    bool _loop        = false;
+
+    // The mapping of the whole file, and the end of the part which the kernel
+    // was asked to read ahead
+    const char* _map       = nullptr;
+    size_t _map_size       = 0;
+    size_t _advised_offset = 0;
+
+    // If the file is not mapped: The chunk which was read last, the number of
+    // samples it holds (zero if none), and the position in it
+    std::ifstream _file;
+    std::vector<char> _chunk;
+    size_t _chunk_samps  = 0;
+    size_t _chunk_offset = 0;
+};
+
+sample_player::sptr sample_player::make(const std::string& path, const size_t item_size)
+{
+    return std::make_shared<sample_player_impl>(path, item_size);
+}
@@ -0,0 +1,711 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/iq_codec.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#ifdef HAVE_POSIX_FILE_IO
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <cerrno>
+#endif
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[] = "RECORDER";
+
+//! Alignment of the buffers, and granularity of their size. This satisfies the
+// requirements of O_DIRECT on common file systems.
+constexpr size_t ALIGNMENT = 4096;
+
+//! The index of a striped recording is a text file, which starts with a line
+// of INDEX_MAGIC, INDEX_VERSION and the number of channels. Every other line
+// names a chunk: The channel, the index of the chunk, its offset and size in
+// the stripe file, and the name of that file.
+constexpr char INDEX_SUFFIX[] = ".index";
+constexpr char INDEX_MAGIC[]  = "uhd-stripe-index";
+constexpr int INDEX_VERSION   = 1;
+
+size_t round_up(const size_t value, const size_t granularity)
+{
+    return (value + granularity - 1) / granularity * granularity;
+}
+
+//! One file written by a recorder
+class recorder_file
+{
+public:
+    recorder_file(const std::string& name, const bool direct_io) : _name(name)
+    {
+#ifdef HAVE_POSIX_FILE_IO
+        const int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#    ifdef O_DIRECT
+        if (direct_io) {
+            _fd     = ::open(name.c_str(), flags | O_DIRECT, 0644);
+            _direct = _fd >= 0;
+        }
+#    endif
+        // Not every file system supports O_DIRECT (e.g., tmpfs)
+        if (_fd < 0) {
+            _fd = ::open(name.c_str(), flags, 0644);
+        }
+        if (_fd < 0) {
+            throw uhd::io_error("Cannot create " + name + ": " + std::strerror(errno));
+        }
+#else
+        (void)direct_io;
+        _file = std::fopen(name.c_str(), "wb");
+        if (!_file) {
+            throw uhd::io_error("Cannot create " + name);
+        }
+        // The buffers are large already
+        std::setvbuf(_file, nullptr, _IONBF, 0);
+#endif
+    }
+
+    ~recorder_file()
+    {
+        UHD_SAFE_CALL(close(););
+    }
+
+    recorder_file(const recorder_file&) = delete;
+    recorder_file& operator=(const recorder_file&) = delete;
+
+    //! Return true if the file is written around the page cache
+    bool is_direct() const
+    {
+        return _direct;
+    }
+
+    //! Return the number of bytes written so far
+    uint64_t get_size() const
+    {
+        return _size;
+    }
+
+    /*! Append data to the file
+     *
+     * \p data must be aligned to ALIGNMENT, and must be readable up to the
+     * next multiple of ALIGNMENT. Only the last write to a file may have a
+     * size which is not a multiple of ALIGNMENT.
+     */
+    void write(const char* data, const size_t num_bytes)
+    {
+#ifdef HAVE_POSIX_FILE_IO
+        // O_DIRECT only writes whole blocks. The padding is truncated when the
+        // file is closed.
+        size_t remaining = _direct ? round_up(num_bytes, ALIGNMENT) : num_bytes;
+        while (remaining != 0) {
+            const ssize_t written = ::write(_fd, data, remaining);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw uhd::io_error(
+                    "Cannot write to " + _name + ": " + std::strerror(errno));
+            }
+            data += written;
+            remaining -= size_t(written);
+        }
+#else
+        if (std::fwrite(data, 1, num_bytes, _file) != num_bytes) {
+            throw uhd::io_error("Cannot write to " + _name);
+        }
+#endif
+        _size += num_bytes;
+    }
+
+    //! Close the file, and cut off the padding of the last write
+    void close()
+    {
+#ifdef HAVE_POSIX_FILE_IO
+        if (_fd < 0) {
+            return;
+        }
+        const int fd = _fd;
+        _fd          = -1;
+        if (_direct && _size % ALIGNMENT != 0 && ::ftruncate(fd, off_t(_size)) != 0) {
+            ::close(fd);
+            throw uhd::io_error("Cannot truncate " + _name + ": " + std::strerror(errno));
+        }
+        if (::close(fd) != 0) {
+            throw uhd::io_error("Cannot close " + _name + ": " + std::strerror(errno));
+        }
+#else
+        if (!_file) {
+            return;
+        }
+        std::FILE* file = _file;
+        _file           = nullptr;
+        if (std::fclose(file) != 0) {
+            throw uhd::io_error("Cannot close " + _name);
+        }
+#endif
+    }
+
+private:
+    const std::string _name;
+#ifdef HAVE_POSIX_FILE_IO
+    int _fd = -1;
+#else
+    std::FILE* _file = nullptr;
+#endif
+    bool _direct   = false;
+    uint64_t _size = 0;
+};
+
+} // namespace
+
+class sample_recorder_impl : public sample_recorder
+{
+public:
+    sample_recorder_impl(
+        const std::string& path, const size_t num_channels, const config_t& config)
+        : _path(path)
+        , _buffer_size(round_up(std::max<size_t>(config.buffer_size, 1), ALIGNMENT))
+        , _num_buffers(config.num_buffers)
+        , _max_file_size(config.max_file_size
+                             ? round_up(config.max_file_size, _buffer_size)
+                             : 0)
+        , _direct_io(config.direct_io)
+        , _compress(config.compress)
+        , _stripe_dirs(config.stripe_dirs)
+        , _num_stripes(std::max<size_t>(_stripe_dirs.size(), 1))
+        , _slot_bytes(_num_buffers, 0)
+        , _channels(num_channels)
+    {
+        if (num_channels == 0) {
+            throw uhd::value_error("Sample recorder: Requires at least one channel");
+        }
+        if (_num_buffers < 2) {
+            throw uhd::value_error("Sample recorder: Requires at least two buffers");
+        }
+        if (!_stripe_dirs.empty() && _max_file_size) {
+            throw uhd::value_error(
+                "Sample recorder: Striped files cannot have a maximum size");
+        }
+        // The frames are compressed into one buffer per writer
+        const size_t max_frame_size = iq_codec::get_max_frame_size(_buffer_size);
+        const size_t frame_size     = _compress ? round_up(max_frame_size, ALIGNMENT) : 0;
+        for (size_t chan = 0; chan < num_channels; chan++) {
+            auto& channel = _channels[chan];
+            // Touch all of the memory now, rather than while recording
+            channel.buffs = alloc_aligned(channel.storage, _num_buffers * _buffer_size);
+            channel.writers.resize(_num_stripes);
+            for (size_t stripe = 0; stripe < _num_stripes; stripe++) {
+                auto& writer = channel.writers[stripe];
+                // Chunk i of channel chan goes to stripe (i + chan) % _num_stripes,
+                // so the channels start on different drives
+                writer.next =
+                    (stripe + _num_stripes - chan % _num_stripes) % _num_stripes;
+                writer.frame = alloc_aligned(writer.frame_storage, frame_size);
+                _open_file(chan, stripe);
+            }
+        }
+        if (_direct_io && !_channels[0].writers[0].file->is_direct()) {
+            UHD_LOG_WARNING(LOG_ID,
+                "Cannot write around the page cache, using buffered writes instead");
+        }
+        for (size_t chan = 0; chan < num_channels; chan++) {
+            for (size_t stripe = 0; stripe < _num_stripes; stripe++) {
+                auto& writer  = _channels[chan].writers[stripe];
+                writer.thread = std::thread(
+                    [this, chan, stripe]() { _writer_loop(chan, stripe); });
+                uhd::set_thread_name(&writer.thread,
+                    "uhd_rec" + std::to_string(chan)
+                        + (_stripe_dirs.empty() ? "" : "." + std::to_string(stripe)));
+            }
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Recording " << num_channels << " channel(s) to " << path << " with "
+                         << _num_buffers << " buffers of " << _buffer_size
+                         << " bytes each, striped across " << _num_stripes
+                         << " file(s) per channel");
+    }
+
+    ~sample_recorder_impl() override
+    {
+        UHD_SAFE_CALL(close(););
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _channels.size();
+    }
+
+    size_t get_write_buffs(std::vector<void*>& buffs, const double timeout) override
+    {
+        if (_closed) {
+            throw uhd::runtime_error("Sample recorder: Writing after close()");
+        }
+        if (!_slot_ready && !_wait_for_slot(timeout)) {
+            return 0;
+        }
+        const size_t slot = _num_submitted % _num_buffers;
+        buffs.resize(_channels.size());
+        for (size_t chan = 0; chan < _channels.size(); chan++) {
+            buffs[chan] = _channels[chan].buffs + slot * _buffer_size + _fill;
+        }
+        return _buffer_size - _fill;
+    }
+
+    void commit(const size_t num_bytes) override
+    {
+        if (!_slot_ready && num_bytes != 0) {
+            throw uhd::runtime_error(
+                "Sample recorder: commit() called without get_write_buffs()");
+        }
+        if (num_bytes > _buffer_size - _fill) {
+            throw uhd::value_error("Sample recorder: Committed more bytes than fit");
+        }
+        _fill += num_bytes;
+        if (_fill == _buffer_size) {
+            _submit();
+        }
+    }
+
+    size_t write(const std::vector<const void*>& buffs,
+        const size_t num_bytes,
+        const double timeout) override
+    {
+        if (buffs.size() != _channels.size()) {
+            throw uhd::value_error("Sample recorder: Expected one buffer per channel");
+        }
+        size_t num_copied = 0;
+        while (num_copied < num_bytes) {
+            const size_t space = get_write_buffs(_copy_buffs, timeout);
+            if (space == 0) {
+                break;
+            }
+            const size_t n = std::min(space, num_bytes - num_copied);
+            for (size_t chan = 0; chan < _channels.size(); chan++) {
+                std::memcpy(_copy_buffs[chan],
+                    static_cast<const char*>(buffs[chan]) + num_copied,
+                    n);
+            }
+            commit(n);
+            num_copied += n;
+        }
+        return num_copied;
+    }
+
+    void close() override
+    {
+        if (_closed) {
+            return;
+        }
+        _closed = true;
+        if (_fill != 0) {
+            _submit();
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _closing = true;
+        }
+        _full_cond.notify_all();
+        for (auto& channel : _channels) {
+            for (auto& writer : channel.writers) {
+                writer.thread.join();
+            }
+        }
+        for (auto& channel : _channels) {
+            for (auto& writer : channel.writers) {
+                try {
+                    writer.file->close();
+                } catch (...) {
+                    _store_error();
+                }
+            }
+        }
+        _check_error();
+        if (!_stripe_dirs.empty()) {
+            _write_index();
+        }
+    }
+
+    uint64_t get_bytes_written() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _bytes_written;
+    }
+
+    size_t get_num_stalls() const override
+    {
+        return _num_stalls;
+    }
+
+private:
+    //! Where a chunk of a striped channel went
+    struct chunk_t
+    {
+        size_t index;
+        uint64_t offset;
+        size_t size;
+    };
+
+    //! A writer thread, and the file it writes
+    struct writer_t
+    {
+        std::unique_ptr<recorder_file> file;
+        size_t file_index = 0;
+        //! The next buffer this writer writes, counted from the start
+        size_t next = 0;
+        std::vector<char> frame_storage;
+        //! The aligned start of frame_storage, for compressed frames
+        char* frame = nullptr;
+        //! The chunks of a striped file
+        std::vector<chunk_t> chunks;
+        std::thread thread;
+    };
+
+    //! The buffers and the files of one channel
+    struct channel_t
+    {
+        std::vector<char> storage;
+        //! The aligned start of storage, where buffer i starts at i * _buffer_size
+        char* buffs = nullptr;
+        //! One writer per stripe
+        std::vector<writer_t> writers;
+
+        //! Return the number of buffers which all writers are done with
+        size_t get_num_done() const
+        {
+            size_t num_done = writers[0].next;
+            for (const auto& writer : writers) {
+                num_done = std::min(num_done, writer.next);
+            }
+            return num_done;
+        }
+    };
+
+    static char* alloc_aligned(std::vector<char>& storage, const size_t size)
+    {
+        storage.resize(size + ALIGNMENT);
+        const size_t misalignment =
+            reinterpret_cast<uintptr_t>(storage.data()) % ALIGNMENT;
+        return storage.data() + (misalignment ? ALIGNMENT - misalignment : 0);
+    }
+
+    void _open_file(const size_t chan, const size_t stripe)
+    {
+        auto& writer = _channels[chan].writers[stripe];
+        writer.file.reset(new recorder_file(_get_file_name(chan, stripe), _direct_io));
+    }
+
+    std::string _get_file_name(const size_t chan, const size_t stripe) const
+    {
+        if (_stripe_dirs.empty()) {
+            return get_file_name(_path,
+                chan,
+                _channels.size(),
+                _max_file_size != 0,
+                _channels[chan].writers[stripe].file_index);
+        }
+        const size_t sep = _path.find_last_of("/\\");
+        const std::string name =
+            sep == std::string::npos ? _path : _path.substr(sep + 1);
+        return _stripe_dirs[stripe] + "/"
+               + get_file_name(name, chan, _channels.size(), true, stripe);
+    }
+
+    //! Wait until the next buffer has been written by all channels
+    bool _wait_for_slot(const double timeout)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _check_error();
+        auto slot_free = [this]() {
+            return _error || _num_submitted - _min_done() < _num_buffers;
+        };
+        if (!slot_free()) {
+            _num_stalls++;
+            _free_cond.wait_for(lock,
+                std::chrono::microseconds(int64_t(timeout * 1e6)),
+                slot_free);
+        }
+        _check_error();
+        _slot_ready = _num_submitted - _min_done() < _num_buffers;
+        return _slot_ready;
+    }
+
+    //! Hand the buffer which is being filled over to the writers
+    void _submit()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _slot_bytes[_num_submitted % _num_buffers] = _fill;
+            _num_submitted++;
+        }
+        _full_cond.notify_all();
+        _fill       = 0;
+        _slot_ready = false;
+    }
+
+    size_t _min_done() const
+    {
+        size_t min_done = _num_submitted;
+        for (const auto& channel : _channels) {
+            min_done = std::min(min_done, channel.get_num_done());
+        }
+        return min_done;
+    }
+
+    void _writer_loop(const size_t chan, const size_t stripe)
+    {
+        auto& writer = _channels[chan].writers[stripe];
+        while (true) {
+            size_t slot, num_bytes;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _full_cond.wait(
+                    lock, [&]() { return writer.next < _num_submitted || _closing; });
+                if (writer.next >= _num_submitted) {
+                    return;
+                }
+                slot      = writer.next % _num_buffers;
+                num_bytes = _slot_bytes[slot];
+            }
+
+            // After an error, the buffers are still released, so the receiving
+            // thread does not wait for them
+            if (!_has_error()) {
+                try {
+                    _write(chan, stripe, slot, num_bytes);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _store_error();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                const size_t min_done = _min_done();
+                writer.next += _num_stripes;
+                for (size_t done = min_done; done < _min_done(); done++) {
+                    _bytes_written += _slot_bytes[done % _num_buffers];
+                }
+            }
+            _free_cond.notify_all();
+        }
+    }
+
+    //! Write one buffer to the file of a writer
+    void _write(
+        const size_t chan, const size_t stripe, const size_t slot, const size_t num_bytes)
+    {
+        auto& writer = _channels[chan].writers[stripe];
+        if (_max_file_size && writer.file->get_size() >= _max_file_size) {
+            writer.file->close();
+            writer.file_index++;
+            _open_file(chan, stripe);
+        }
+        const char* buff      = _channels[chan].buffs + slot * _buffer_size;
+        const uint64_t offset = writer.file->get_size();
+        if (_compress) {
+            // With O_DIRECT, every write but the last one must be of whole
+            // blocks, so the frames are padded to them
+            const size_t frame_size = iq_codec::compress(buff,
+                num_bytes,
+                writer.frame,
+                writer.file->is_direct() ? ALIGNMENT : 1);
+            writer.file->write(writer.frame, frame_size);
+        } else {
+            writer.file->write(buff, num_bytes);
+        }
+        if (!_stripe_dirs.empty()) {
+            writer.chunks.push_back({writer.next,
+                offset,
+                size_t(writer.file->get_size() - offset)});
+        }
+    }
+
+    //! Write the index of the chunks of all channels, see join_stripes()
+    void _write_index()
+    {
+        const std::string name = _path + INDEX_SUFFIX;
+        std::ofstream index(name);
+        index << INDEX_MAGIC << " " << INDEX_VERSION << " " << _channels.size() << "\n";
+        for (size_t chan = 0; chan < _channels.size(); chan++) {
+            std::vector<std::pair<chunk_t, size_t>> chunks;
+            for (size_t stripe = 0; stripe < _num_stripes; stripe++) {
+                for (const auto& chunk : _channels[chan].writers[stripe].chunks) {
+                    chunks.emplace_back(chunk, stripe);
+                }
+            }
+            std::sort(chunks.begin(), chunks.end(), [](const auto& a, const auto& b) {
+                return a.first.index < b.first.index;
+            });
+            for (const auto& chunk : chunks) {
+                index << chan << " " << chunk.first.index << " " << chunk.first.offset
+                      << " " << chunk.first.size << " "
+                      << _get_file_name(chan, chunk.second) << "\n";
+            }
+        }
+        index.close();
+        if (!index) {
+            throw uhd::io_error("Cannot write " + name);
+        }
+    }
+
+    bool _has_error() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return bool(_error);
+    }
+
+    //! Remember the current exception, unless there already was one
+    // Requires _mutex, unless the writers are done
+    void _store_error()
+    {
+        if (!_error) {
+            _error = std::current_exception();
+        }
+    }
+
+    void _check_error()
+    {
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+
+    const std::string _path;
+    const size_t _buffer_size;
+    const size_t _num_buffers;
+    const uint64_t _max_file_size;
+    const bool _direct_io;
+    const bool _compress;
+    const std::vector<std::string> _stripe_dirs;
+    const size_t _num_stripes;
+
+    // State of the receiving thread
+    bool _slot_ready = false;
+    size_t _fill     = 0;
+    bool _closed     = false;
+    std::vector<void*> _copy_buffs;
+    std::atomic<size_t> _num_stalls{0};
+
+    // Shared with the writers, protected by _mutex
+    mutable std::mutex _mutex;
+    std::condition_variable _full_cond;
+    std::condition_variable _free_cond;
+    std::vector<size_t> _slot_bytes;
+    size_t _num_submitted   = 0;
+    uint64_t _bytes_written = 0;
+    bool _closing           = false;
+    std::exception_ptr _error;
+
+    std::vector<channel_t> _channels;
+};
+
+sample_recorder::sptr sample_recorder::make(
+    const std::string& path, const size_t num_channels, const config_t& config)
+{
+    return std::make_shared<sample_recorder_impl>(path, num_channels, config);
+}
+
+std::string sample_recorder::get_file_name(const std::string& path,
+    const size_t chan,
+    const size_t num_channels,
+    const bool split,
+    const size_t file_index)
+{
+    // The extension starts at the last dot of the last path component
+    const size_t sep = path.find_last_of("/\\");
+    size_t ext_pos   = path.find_last_of('.');
+    if (ext_pos == std::string::npos || (sep != std::string::npos && ext_pos < sep)) {
+        ext_pos = path.size();
+    }
+    std::string infix;
+    if (num_channels > 1) {
+        infix += ".ch" + std::to_string(chan);
+    }
+    if (split) {
+        char index[16];
+        std::snprintf(index, sizeof(index), ".%04zu", file_index);
+        infix += index;
+    }
+    return path.substr(0, ext_pos) + infix + path.substr(ext_pos);
+}
+
+void sample_recorder::join_stripes(const std::string& index_path, const std::string& path)
+{
+    std::ifstream index(index_path);
+    if (!index) {
+        throw uhd::io_error("Cannot open " + index_path);
+    }
+    std::string magic;
+    int version         = 0;
+    size_t num_channels = 0;
+    index >> magic >> version >> num_channels;
+    if (magic != INDEX_MAGIC || version != INDEX_VERSION || num_channels == 0) {
+        throw uhd::value_error("Not a stripe index: " + index_path);
+    }
+
+    std::vector<std::unique_ptr<std::ofstream>> outs;
+    for (size_t chan = 0; chan < num_channels; chan++) {
+        const std::string name = get_file_name(path, chan, num_channels, false, 0);
+        outs.emplace_back(new std::ofstream(name, std::ios::binary | std::ios::trunc));
+        if (!*outs.back()) {
+            throw uhd::io_error("Cannot create " + name);
+        }
+    }
+    std::map<std::string, std::unique_ptr<std::ifstream>> stripes;
+    std::vector<size_t> num_chunks(num_channels, 0);
+    std::vector<char> buff;
+    size_t chan, chunk, size;
+    uint64_t offset;
+    std::string name;
+    while (index >> chan >> chunk >> offset >> size
+           && std::getline(index >> std::ws, name)) {
+        if (chan >= num_channels || chunk != num_chunks[chan]) {
+            throw uhd::value_error("Corrupt stripe index: " + index_path);
+        }
+        num_chunks[chan]++;
+        auto& stripe = stripes[name];
+        if (!stripe) {
+            stripe.reset(new std::ifstream(name, std::ios::binary));
+            if (!*stripe) {
+                throw uhd::io_error("Cannot open " + name);
+            }
+        }
+        buff.resize(size);
+        stripe->seekg(std::streamoff(offset));
+        if (!stripe->read(buff.data(), std::streamsize(size))) {
+            throw uhd::io_error("Cannot read chunk " + std::to_string(chunk) + " from "
+                                + name);
+        }
+        if (!outs[chan]->write(buff.data(), std::streamsize(size))) {
+            throw uhd::io_error("Cannot write to "
+                                + get_file_name(path, chan, num_channels, false, 0));
+        }
+    }
+    if (!index.eof()) {
+        throw uhd::value_error("Corrupt stripe index: " + index_path);
+    }
+    for (size_t chan = 0; chan < num_channels; chan++) {
+        outs[chan]->close();
+        if (!*outs[chan]) {
+            throw uhd::io_error(
+                "Cannot write to " + get_file_name(path, chan, num_channels, false, 0));
+        }
+    }
+}
@@ -0,0 +1,434 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/shm_iq_bus.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#ifdef HAVE_SHM_OPEN
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    include <cerrno>
+#endif
+
+using namespace uhd;
+
+#ifdef HAVE_SHM_OPEN
+namespace {
+
+constexpr char LOG_ID[] = "SHM_IQ_BUS";
+
+//! Identifies the shared memory objects of publishers ("UHDIQBUS")
+constexpr uint64_t RING_MAGIC   = 0x5355424951444855;
+constexpr uint32_t RING_VERSION = 1;
+constexpr size_t CACHE_LINE     = 64;
+
+// The atomics are shared between processes, so they must not need a lock
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "64-bit atomics are not lock-free");
+
+//! Start of the shared memory object, followed by the slots
+struct ring_header_t
+{
+    //! Set to RING_MAGIC once the rest of the header is valid
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    uint32_t num_channels;
+    uint32_t bytes_per_sample;
+    uint32_t num_slots;
+    uint64_t max_samps_per_packet;
+    uint64_t slot_size;
+    //! Number of packets published so far. Written by the publisher only.
+    alignas(CACHE_LINE) std::atomic<uint64_t> num_published;
+};
+
+/*! Start of every slot, followed by the samples of every channel
+ *
+ * The slots are seqlocks: while packet n is written to a slot, its sequence is
+ * 2n+1, afterwards it is 2n+2. Readers check that the sequence is unchanged
+ * after reading.
+ */
+struct alignas(CACHE_LINE) slot_header_t
+{
+    std::atomic<uint64_t> seq;
+    uint64_t nsamps;
+    int64_t full_secs;
+    double frac_secs;
+    uint32_t flags;
+    uint32_t error_code;
+};
+
+constexpr uint32_t FLAG_HAS_TIME_SPEC   = 1 << 0;
+constexpr uint32_t FLAG_MORE_FRAGMENTS  = 1 << 1;
+constexpr uint32_t FLAG_START_OF_BURST  = 1 << 2;
+constexpr uint32_t FLAG_END_OF_BURST    = 1 << 3;
+constexpr uint32_t FLAG_OUT_OF_SEQUENCE = 1 << 4;
+
+constexpr size_t pad_to_cache_line(const size_t size)
+{
+    return (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+}
+
+constexpr size_t ring_header_size()
+{
+    return pad_to_cache_line(sizeof(ring_header_t));
+}
+
+std::string errno_str()
+{
+    return std::strerror(errno);
+}
+
+//! Maps a shared memory object, and unmaps it on destruction
+class shm_mapping
+{
+public:
+    shm_mapping(const int fd, const size_t size, const bool writable) : _size(size)
+    {
+        _mem = ::mmap(nullptr,
+            size,
+            writable ? PROT_READ | PROT_WRITE : PROT_READ,
+            MAP_SHARED,
+            fd,
+            0);
+        const std::string error = errno_str();
+        ::close(fd);
+        if (_mem == MAP_FAILED) {
+            throw uhd::os_error("Cannot map shared memory: " + error);
+        }
+#    ifdef MADV_HUGEPAGE
+        // Fewer TLB misses on large rings, where the system allows it
+        ::madvise(_mem, size, MADV_HUGEPAGE);
+#    endif
+    }
+
+    ~shm_mapping()
+    {
+        ::munmap(_mem, _size);
+    }
+
+    char* data() const
+    {
+        return static_cast<char*>(_mem);
+    }
+
+    ring_header_t& header() const
+    {
+        return *reinterpret_cast<ring_header_t*>(_mem);
+    }
+
+    slot_header_t& slot(const uint64_t packet) const
+    {
+        const ring_header_t& hdr = header();
+        return *reinterpret_cast<slot_header_t*>(
+            data() + ring_header_size() + (packet % hdr.num_slots) * hdr.slot_size);
+    }
+
+    char* samples(const uint64_t packet, const size_t chan) const
+    {
+        const ring_header_t& hdr = header();
+        return reinterpret_cast<char*>(&slot(packet)) + sizeof(slot_header_t)
+               + chan * hdr.max_samps_per_packet * hdr.bytes_per_sample;
+    }
+
+private:
+    void* _mem;
+    const size_t _size;
+};
+
+class shm_iq_publisher_impl : public shm_iq_publisher
+{
+public:
+    shm_iq_publisher_impl(const std::string& name,
+        const size_t num_channels,
+        const size_t bytes_per_sample,
+        const size_t max_samps_per_packet,
+        const size_t num_slots)
+        : _name(name)
+        , _num_channels(num_channels)
+        , _max_samps(max_samps_per_packet)
+        , _bytes_per_sample(bytes_per_sample)
+    {
+        if (name.size() < 2 || name.front() != '/'
+            || name.find('/', 1) != std::string::npos) {
+            throw uhd::value_error(
+                "Invalid shared memory name `" + name + "': Must be of the form /name");
+        }
+        if (num_channels == 0 || bytes_per_sample == 0 || max_samps_per_packet == 0
+            || num_slots == 0 || num_slots > UINT32_MAX) {
+            throw uhd::value_error("Invalid shared memory ring dimensions");
+        }
+        const size_t slot_size = pad_to_cache_line(sizeof(slot_header_t)
+                                                   + num_channels * max_samps_per_packet
+                                                         * bytes_per_sample);
+        const size_t size = ring_header_size() + num_slots * slot_size;
+
+        // Replace stale objects, e.g., of a publisher which crashed
+        ::shm_unlink(name.c_str());
+        const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+        if (fd < 0) {
+            throw uhd::os_error(
+                "Cannot create shared memory " + name + ": " + errno_str());
+        }
+        if (::ftruncate(fd, off_t(size)) != 0) {
+            const std::string error = errno_str();
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw uhd::os_error("Cannot size shared memory " + name + ": " + error);
+        }
+        try {
+            _map = std::make_unique<shm_mapping>(fd, size, true);
+        } catch (...) {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+        // The object is zero-filled, so all slot sequences start out at zero
+        ring_header_t& hdr       = _map->header();
+        hdr.version              = RING_VERSION;
+        hdr.num_channels         = uint32_t(num_channels);
+        hdr.bytes_per_sample     = uint32_t(bytes_per_sample);
+        hdr.num_slots            = uint32_t(num_slots);
+        hdr.max_samps_per_packet = max_samps_per_packet;
+        hdr.slot_size            = slot_size;
+        hdr.num_published.store(0, std::memory_order_relaxed);
+        hdr.magic.store(RING_MAGIC, std::memory_order_release);
+        UHD_LOG_DEBUG(LOG_ID,
+            "Publishing to " << name << " (" << num_slots << " slots of " << slot_size
+                             << " bytes)");
+    }
+
+    ~shm_iq_publisher_impl() override
+    {
+        ::shm_unlink(_name.c_str());
+    }
+
+    void publish(const std::vector<const void*>& buffs,
+        const size_t nsamps,
+        const rx_metadata_t& metadata) override
+    {
+        if (buffs.size() != _num_channels) {
+            throw uhd::value_error("shm_iq_publisher: Expected "
+                                   + std::to_string(_num_channels) + " buffers, got "
+                                   + std::to_string(buffs.size()));
+        }
+        if (nsamps > _max_samps) {
+            throw uhd::value_error("shm_iq_publisher: Packet of "
+                                   + std::to_string(nsamps)
+                                   + " samples does not fit into a slot");
+        }
+        const uint32_t flags = (metadata.has_time_spec ? FLAG_HAS_TIME_SPEC : 0)
+                               | (metadata.more_fragments ? FLAG_MORE_FRAGMENTS : 0)
+                               | (metadata.start_of_burst ? FLAG_START_OF_BURST : 0)
+                               | (metadata.end_of_burst ? FLAG_END_OF_BURST : 0)
+                               | (metadata.out_of_sequence ? FLAG_OUT_OF_SEQUENCE : 0);
+        slot_header_t& slot = _map->slot(_num_published);
+        slot.seq.store(2 * _num_published + 1, std::memory_order_relaxed);
+        // Readers must not see the new samples before the odd sequence
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.nsamps     = nsamps;
+        slot.full_secs  = metadata.time_spec.get_full_secs();
+        slot.frac_secs  = metadata.time_spec.get_frac_secs();
+        slot.error_code = uint32_t(metadata.error_code);
+        slot.flags      = flags;
+        for (size_t chan = 0; chan < _num_channels && nsamps > 0; chan++) {
+            std::memcpy(_map->samples(_num_published, chan),
+                buffs[chan],
+                nsamps * _bytes_per_sample);
+        }
+        slot.seq.store(2 * _num_published + 2, std::memory_order_release);
+        _num_published++;
+        _map->header().num_published.store(_num_published, std::memory_order_release);
+    }
+
+    size_t publish_from(
+        rx_streamer& streamer, rx_metadata_t& metadata, const double timeout) override
+    {
+        rx_streamer::recv_buffs_type buffs;
+        const size_t nsamps = streamer.get_recv_buffs(buffs, metadata, timeout);
+        if (nsamps == 0) {
+            if (metadata.error_code != rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                publish(std::vector<const void*>(_num_channels, nullptr), 0, metadata);
+            }
+            return 0;
+        }
+        try {
+            publish(buffs, nsamps, metadata);
+        } catch (...) {
+            streamer.release_recv_buffs();
+            throw;
+        }
+        streamer.release_recv_buffs();
+        return nsamps;
+    }
+
+private:
+    const std::string _name;
+    const size_t _num_channels;
+    const size_t _max_samps;
+    const size_t _bytes_per_sample;
+    std::unique_ptr<shm_mapping> _map;
+    uint64_t _num_published = 0;
+};
+
+class shm_iq_subscriber_impl : public shm_iq_subscriber
+{
+public:
+    shm_iq_subscriber_impl(const std::string& name)
+    {
+        const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st) != 0) {
+            const std::string error = errno_str();
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw uhd::os_error("Cannot open shared memory " + name + ": " + error);
+        }
+        const size_t size = size_t(st.st_size);
+        if (size < ring_header_size()) {
+            ::close(fd);
+            throw uhd::runtime_error(name + " is not a shared memory IQ ring");
+        }
+        _map = std::make_unique<shm_mapping>(fd, size, false);
+        const ring_header_t& hdr = _map->header();
+        if (hdr.magic.load(std::memory_order_acquire) != RING_MAGIC
+            || hdr.version != RING_VERSION
+            || size < ring_header_size() + uint64_t(hdr.num_slots) * hdr.slot_size) {
+            throw uhd::runtime_error(name + " is not a shared memory IQ ring");
+        }
+        _next_packet = hdr.num_published.load(std::memory_order_acquire);
+    }
+
+    bool acquire(packet_t& packet, const double timeout) override
+    {
+        const ring_header_t& hdr = _map->header();
+        const auto deadline =
+            std::chrono::steady_clock::now()
+            + std::chrono::microseconds(int64_t(timeout * 1e6));
+        bool lost_packets = false;
+        while (true) {
+            const uint64_t num_published =
+                hdr.num_published.load(std::memory_order_acquire);
+            if (_next_packet >= num_published) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    return false;
+                }
+                // The publisher doesn't know about subscribers, so it can't
+                // wake them up. Poll at a fraction of a typical packet time.
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+                continue;
+            }
+            if (num_published - _next_packet > hdr.num_slots) {
+                _next_packet = num_published - hdr.num_slots;
+                lost_packets = true;
+            }
+            const slot_header_t& slot = _map->slot(_next_packet);
+            _seq                      = slot.seq.load(std::memory_order_acquire);
+            if (_seq != 2 * _next_packet + 2) {
+                // Overwritten since num_published was read
+                _next_packet++;
+                lost_packets = true;
+                continue;
+            }
+            packet.nsamps = slot.nsamps;
+            packet.metadata.reset();
+            packet.metadata.time_spec = time_spec_t(slot.full_secs, slot.frac_secs);
+            packet.metadata.error_code =
+                rx_metadata_t::error_code_t(slot.error_code);
+            packet.metadata.has_time_spec   = slot.flags & FLAG_HAS_TIME_SPEC;
+            packet.metadata.more_fragments  = slot.flags & FLAG_MORE_FRAGMENTS;
+            packet.metadata.start_of_burst  = slot.flags & FLAG_START_OF_BURST;
+            packet.metadata.end_of_burst    = slot.flags & FLAG_END_OF_BURST;
+            packet.metadata.out_of_sequence = slot.flags & FLAG_OUT_OF_SEQUENCE;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != _seq
+                || packet.nsamps > hdr.max_samps_per_packet) {
+                _next_packet++;
+                lost_packets = true;
+                continue;
+            }
+            if (lost_packets) {
+                packet.metadata.error_code = rx_metadata_t::ERROR_CODE_OVERFLOW;
+            }
+            packet.buffs.resize(hdr.num_channels);
+            for (size_t chan = 0; chan < hdr.num_channels; chan++) {
+                packet.buffs[chan] = _map->samples(_next_packet, chan);
+            }
+            _held = true;
+            return true;
+        }
+    }
+
+    bool release() override
+    {
+        if (!_held) {
+            return true;
+        }
+        // The samples must be read before the sequence is checked again
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const bool intact = _map->slot(_next_packet).seq.load(std::memory_order_relaxed)
+                            == _seq;
+        _held = false;
+        _next_packet++;
+        return intact;
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _map->header().num_channels;
+    }
+
+    size_t get_bytes_per_sample() const override
+    {
+        return _map->header().bytes_per_sample;
+    }
+
+private:
+    std::unique_ptr<shm_mapping> _map;
+    //! The packet to acquire next, or the one which is held
+    uint64_t _next_packet = 0;
+    //! The sequence of the slot of the held packet
+    uint64_t _seq = 0;
+    bool _held    = false;
+};
+
+} // namespace
+
+shm_iq_publisher::sptr shm_iq_publisher::make(const std::string& name,
+    const size_t num_channels,
+    const size_t bytes_per_sample,
+    const size_t max_samps_per_packet,
+    const size_t num_slots)
+{
+    return std::make_shared<shm_iq_publisher_impl>(
+        name, num_channels, bytes_per_sample, max_samps_per_packet, num_slots);
+}
+
+shm_iq_subscriber::sptr shm_iq_subscriber::make(const std::string& name)
+{
+    return std::make_shared<shm_iq_subscriber_impl>(name);
+}
+
+#else
+
+shm_iq_publisher::sptr shm_iq_publisher::make(
+    const std::string&, const size_t, const size_t, const size_t, const size_t)
+{
+    throw uhd::not_implemented_error(
+        "shm_iq_publisher: Shared memory is not supported on this platform");
+}
+
+shm_iq_subscriber::sptr shm_iq_subscriber::make(const std::string&)
+{
+    throw uhd::not_implemented_error(
+        "shm_iq_subscriber: Shared memory is not supported on this platform");
+}
+
+#endif
@@ -0,0 +1,358 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <uhd/utils/sigmf_recorder.hpp>
+#include <uhd/version.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[] = "SIGMF";
+
+constexpr char SIGMF_VERSION[] = "1.0.0";
+
+//! The gain of channels without a known gain
+const double NO_GAIN = std::numeric_limits<double>::quiet_NaN();
+
+//! The SigMF data type (without the endianness) and the size of the CPU formats
+const std::map<std::string, std::pair<std::string, size_t>>& get_datatypes()
+{
+    static const std::map<std::string, std::pair<std::string, size_t>> datatypes{
+        {"fc64", {"cf64", 16}},
+        {"fc32", {"cf32", 8}},
+        {"sc16", {"ci16", 4}},
+        {"sc8", {"ci8", 2}},
+        {"f64", {"rf64", 8}},
+        {"f32", {"rf32", 4}},
+        {"s16", {"ri16", 2}},
+        {"s8", {"ri8", 1}}};
+    return datatypes;
+}
+
+//! Return the label of the annotation of an error
+std::string get_error_label(const rx_metadata_t::error_code_t error_code)
+{
+    switch (error_code) {
+        case rx_metadata_t::ERROR_CODE_LATE_COMMAND:
+            return "late_command";
+        case rx_metadata_t::ERROR_CODE_BROKEN_CHAIN:
+            return "broken_chain";
+        case rx_metadata_t::ERROR_CODE_OVERFLOW:
+            return "overflow";
+        case rx_metadata_t::ERROR_CODE_ALIGNMENT:
+            return "alignment";
+        case rx_metadata_t::ERROR_CODE_BAD_PACKET:
+            return "bad_packet";
+        default:
+            return "error";
+    }
+}
+
+std::string json_string(const std::string& value)
+{
+    std::string result = "\"";
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            result += escaped;
+        } else {
+            result += c;
+        }
+    }
+    return result + "\"";
+}
+
+//! Format a number with as few digits as it takes to read it back unchanged
+std::string json_number(const double value)
+{
+    char buf[32];
+    for (const int precision : {15, 17}) {
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, value);
+        if (std::strtod(buf, nullptr) == value) {
+            break;
+        }
+    }
+    return buf;
+}
+
+} // namespace
+
+class sigmf_recorder_impl : public sigmf_recorder
+{
+public:
+    sigmf_recorder_impl(const std::string& base,
+        const size_t num_channels,
+        const info_t& info,
+        const sample_recorder::config_t& config)
+        : _base(base)
+        , _info(info)
+        , _frequencies(info.frequencies)
+        , _gains(info.gains)
+    {
+        const auto& datatypes = get_datatypes();
+        if (!datatypes.count(info.cpu_format)) {
+            throw uhd::value_error(
+                "SigMF recorder: No SigMF data type for " + info.cpu_format);
+        }
+        _datatype  = datatypes.at(info.cpu_format).first;
+        _item_size = datatypes.at(info.cpu_format).second;
+        if (_item_size > 1) {
+#ifdef UHD_BIG_ENDIAN
+            _datatype += "_be";
+#else
+            _datatype += "_le";
+#endif
+        }
+        _frequencies.resize(num_channels, 0.0);
+        _gains.resize(num_channels, NO_GAIN);
+
+        // SigMF recordings are a single data file
+        sample_recorder::config_t data_config = config;
+        data_config.max_file_size             = 0;
+        _recorder =
+            sample_recorder::make(base + ".sigmf-data", num_channels, data_config);
+    }
+
+    ~sigmf_recorder_impl() override
+    {
+        UHD_SAFE_CALL(close(););
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _recorder->get_num_channels();
+    }
+
+    size_t get_write_buffs(std::vector<void*>& buffs, const double timeout) override
+    {
+        return _recorder->get_write_buffs(buffs, timeout) / _item_size;
+    }
+
+    void commit(const size_t num_samps, const uhd::rx_metadata_t& metadata) override
+    {
+        if (metadata.error_code != rx_metadata_t::ERROR_CODE_NONE
+            && metadata.error_code != rx_metadata_t::ERROR_CODE_TIMEOUT) {
+            _annotations.push_back({_num_samps, metadata.error_code});
+            if (metadata.error_code == rx_metadata_t::ERROR_CODE_OVERFLOW) {
+                _overflows.push_back(_num_samps);
+            }
+        }
+        if (num_samps == 0) {
+            return;
+        }
+
+        bool discontinuity   = _captures.empty() || _settings_changed;
+        size_t dropped_samps = 0;
+        if (metadata.has_time_spec && !_captures.empty()
+            && _captures.back().capture.has_time_spec && _info.sample_rate > 0.0) {
+            const auto& last = _captures.back().capture;
+            const uhd::time_spec_t expected =
+                last.time_spec
+                + uhd::time_spec_t::from_ticks(
+                    int64_t(_num_samps - last.sample_start), _info.sample_rate);
+            const double gap =
+                (metadata.time_spec - expected).get_real_secs() * _info.sample_rate;
+            if (std::abs(gap) >= 0.5) {
+                discontinuity = true;
+                dropped_samps = gap > 0.0 ? size_t(std::llround(gap)) : 0;
+            }
+        }
+        if (discontinuity) {
+            capture_record_t record;
+            record.capture.sample_start  = _num_samps;
+            record.capture.has_time_spec = metadata.has_time_spec;
+            record.capture.time_spec     = metadata.time_spec;
+            record.capture.dropped_samps = dropped_samps;
+            record.frequencies           = _frequencies;
+            record.gains                 = _gains;
+            _captures.push_back(record);
+            _settings_changed = false;
+        }
+
+        _recorder->commit(num_samps * _item_size);
+        _num_samps += num_samps;
+    }
+
+    void set_frequency(const size_t chan, const double frequency) override
+    {
+        _set_setting(_frequencies, chan, frequency);
+    }
+
+    void set_gain(const size_t chan, const double gain) override
+    {
+        _set_setting(_gains, chan, gain);
+    }
+
+    std::vector<sigmf_capture_t> get_captures() const override
+    {
+        std::vector<sigmf_capture_t> captures;
+        for (const auto& record : _captures) {
+            captures.push_back(record.capture);
+        }
+        return captures;
+    }
+
+    std::vector<size_t> get_overflows() const override
+    {
+        return _overflows;
+    }
+
+    void close() override
+    {
+        if (_closed) {
+            return;
+        }
+        _closed = true;
+        _recorder->close();
+        for (size_t chan = 0; chan < get_num_channels(); chan++) {
+            _write_meta(chan);
+        }
+        UHD_LOG_DEBUG(LOG_ID,
+            "Recorded " << _num_samps << " samples in " << _captures.size()
+                        << " capture segment(s), with " << _annotations.size()
+                        << " error(s)");
+    }
+
+private:
+    struct capture_record_t
+    {
+        sigmf_capture_t capture;
+        std::vector<double> frequencies;
+        std::vector<double> gains;
+    };
+
+    struct annotation_t
+    {
+        size_t sample_start;
+        rx_metadata_t::error_code_t error_code;
+    };
+
+    //! Change the frequency or gain of a channel, and start a new capture segment
+    void _set_setting(
+        std::vector<double>& settings, const size_t chan, const double value)
+    {
+        if (chan >= settings.size()) {
+            throw uhd::index_error(
+                "SigMF recorder: Invalid channel " + std::to_string(chan));
+        }
+        if (settings[chan] != value) {
+            settings[chan]    = value;
+            _settings_changed = true;
+        }
+    }
+
+    void _write_meta(const size_t chan) const
+    {
+        const std::string name = sample_recorder::get_file_name(
+            _base + ".sigmf-meta", chan, get_num_channels(), false, 0);
+        std::ostringstream meta;
+        meta << "{\n"
+             << "    \"global\": {\n"
+             << "        \"core:datatype\": " << json_string(_datatype) << ",\n";
+        if (_info.sample_rate > 0.0) {
+            meta << "        \"core:sample_rate\": " << json_number(_info.sample_rate)
+                 << ",\n";
+        }
+        meta << "        \"core:version\": " << json_string(SIGMF_VERSION) << ",\n"
+             << "        \"core:num_channels\": 1,\n"
+             << "        \"core:recorder\": "
+             << json_string("UHD " + uhd::get_version_string()) << ",\n";
+        if (!_info.description.empty()) {
+            meta << "        \"core:description\": " << json_string(_info.description)
+                 << ",\n";
+        }
+        if (!_info.author.empty()) {
+            meta << "        \"core:author\": " << json_string(_info.author) << ",\n";
+        }
+        if (!_info.hw.empty()) {
+            meta << "        \"core:hw\": " << json_string(_info.hw) << ",\n";
+        }
+        meta << "        \"core:extensions\": [\n"
+             << "            {\"name\": \"uhd\", \"version\": \"1.0.0\", "
+                "\"optional\": true}\n"
+             << "        ]\n"
+             << "    },\n"
+             << "    \"captures\": [";
+        for (size_t i = 0; i < _captures.size(); i++) {
+            const auto& record = _captures[i];
+            meta << (i ? "," : "") << "\n        {\"core:sample_start\": "
+                 << record.capture.sample_start;
+            if (record.frequencies[chan] != 0.0) {
+                meta << ", \"core:frequency\": "
+                     << json_number(record.frequencies[chan]);
+            }
+            if (!std::isnan(record.gains[chan])) {
+                meta << ", \"uhd:gain\": " << json_number(record.gains[chan]);
+            }
+            if (record.capture.has_time_spec) {
+                meta << ", \"uhd:time_spec\": "
+                     << json_number(record.capture.time_spec.get_real_secs());
+            }
+            if (i != 0) {
+                meta << ", \"uhd:dropped_samps\": " << record.capture.dropped_samps;
+            }
+            meta << "}";
+        }
+        meta << (_captures.empty() ? "" : "\n    ") << "],\n"
+             << "    \"annotations\": [";
+        for (size_t i = 0; i < _annotations.size(); i++) {
+            rx_metadata_t metadata;
+            metadata.error_code = _annotations[i].error_code;
+            meta << (i ? "," : "") << "\n        {\"core:sample_start\": "
+                 << _annotations[i].sample_start << ", \"core:label\": "
+                 << json_string(get_error_label(metadata.error_code))
+                 << ", \"core:comment\": " << json_string(metadata.strerror()) << "}";
+        }
+        meta << (_annotations.empty() ? "" : "\n    ") << "]\n"
+             << "}\n";
+
+        std::ofstream file(name);
+        file << meta.str();
+        file.close();
+        if (!file) {
+            throw uhd::io_error("Cannot write " + name);
+        }
+    }
+
+    const std::string _base;
+    const info_t _info;
+    std::string _datatype;
+    size_t _item_size;
+    sample_recorder::sptr _recorder;
+    bool _closed = false;
+
+    // The metadata so far
+    size_t _num_samps = 0;
+    std::vector<double> _frequencies;
+    std::vector<double> _gains;
+    bool _settings_changed = false;
+    std::vector<capture_record_t> _captures;
+    std::vector<annotation_t> _annotations;
+    std::vector<size_t> _overflows;
+};
+
+sigmf_recorder::sptr sigmf_recorder::make(const std::string& base,
+    const size_t num_channels,
+    const info_t& info,
+    const sample_recorder::config_t& config)
+{
+    return std::make_shared<sigmf_recorder_impl>(base, num_channels, info, config);
+}
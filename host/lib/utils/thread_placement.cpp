@@ -0,0 +1,233 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <uhdlib/utils/thread_placement.hpp>
+#include <uhdlib/utils/worker_pool.hpp>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+namespace uhd { namespace numa {
+
+namespace {
+
+const std::string SYS_CPU_PATH = "/sys/devices/system/cpu/";
+
+//! Read the first line of a (sysfs) file, return an empty string on failure
+std::string read_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+//! Parse a Linux CPU list, return an empty list if it is malformed
+std::vector<size_t> read_cpu_list(const std::string& path)
+{
+    try {
+        return parse_cpu_list(read_line(path));
+    } catch (const uhd::value_error&) {
+        return {};
+    }
+}
+
+//! A physical core, and its logical CPUs
+struct core_t
+{
+    size_t core;
+    int package;
+    int node;
+    bool isolated;
+    std::vector<size_t> cpus;
+};
+
+std::string cpus_to_string(const std::vector<size_t>& cpus)
+{
+    std::ostringstream ss;
+    for (size_t i = 0; i < cpus.size(); i++) {
+        ss << (i == 0 ? "" : ",") << cpus[i];
+    }
+    return ss.str();
+}
+
+} // namespace
+
+std::vector<cpu_info_t> get_cpu_topology()
+{
+    std::vector<cpu_info_t> topology;
+    const std::vector<size_t> online = read_cpu_list(SYS_CPU_PATH + "online");
+    if (online.empty()) {
+        // No sysfs, so every CPU is a core of its own
+        const size_t num_cpus = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t cpu = 0; cpu < num_cpus; cpu++) {
+            cpu_info_t info;
+            info.cpu  = cpu;
+            info.core = cpu;
+            topology.push_back(info);
+        }
+        return topology;
+    }
+
+    const std::vector<size_t> isolated = read_cpu_list(SYS_CPU_PATH + "isolated");
+    std::map<size_t, int> cpu_nodes;
+    for (const size_t node : read_cpu_list("/sys/devices/system/node/online")) {
+        for (const size_t cpu : get_node_cpus(int(node))) {
+            cpu_nodes[cpu] = int(node);
+        }
+    }
+
+    for (const size_t cpu : online) {
+        const std::string path =
+            SYS_CPU_PATH + "cpu" + std::to_string(cpu) + "/topology/";
+        cpu_info_t info;
+        info.cpu = cpu;
+        try {
+            info.package = std::stoi(read_line(path + "physical_package_id"));
+        } catch (const std::exception&) {
+            info.package = 0;
+        }
+        // The SMT siblings of a core share its lowest CPU number
+        const auto siblings = read_cpu_list(path + "thread_siblings_list");
+        if (!siblings.empty()) {
+            info.core = *std::min_element(siblings.begin(), siblings.end());
+        } else {
+            info.core = cpu;
+        }
+        const auto node = cpu_nodes.find(cpu);
+        info.node       = (node == cpu_nodes.end()) ? NO_NODE : node->second;
+        info.isolated   = std::find(isolated.begin(), isolated.end(), cpu)
+                        != isolated.end();
+        topology.push_back(info);
+    }
+    return topology;
+}
+
+uhd::thread_placement_t plan_thread_placement(const std::vector<cpu_info_t>& topology,
+    const size_t num_io_threads,
+    const size_t num_convert_threads,
+    const size_t num_app_threads,
+    const int numa_node)
+{
+    std::map<size_t, core_t> core_map;
+    for (const cpu_info_t& info : topology) {
+        auto it = core_map.find(info.core);
+        if (it == core_map.end()) {
+            core_map[info.core] = {info.core, info.package, info.node, info.isolated, {}};
+            it                  = core_map.find(info.core);
+        }
+        // A core is only isolated if none of its siblings is shared with other tasks
+        it->second.isolated = it->second.isolated && info.isolated;
+        it->second.cpus.push_back(info.cpu);
+    }
+
+    uhd::thread_placement_t placement;
+    std::vector<core_t> cores;
+    for (auto& core : core_map) {
+        std::sort(core.second.cpus.begin(), core.second.cpus.end());
+        cores.push_back(core.second);
+        if (numa_node >= 0 && core.second.node == numa_node) {
+            placement.numa_node = numa_node;
+        }
+    }
+    auto rank = [&placement, numa_node](const core_t& core) {
+        return std::make_tuple(placement.numa_node >= 0 && core.node != numa_node,
+            !core.isolated,
+            core.cpus.front() == 0,
+            core.package,
+            core.core);
+    };
+    std::sort(cores.begin(), cores.end(), [&rank](const core_t& a, const core_t& b) {
+        return rank(a) < rank(b);
+    });
+
+    // The first CPU of every core, then the second one of every core, and so on
+    std::vector<size_t> cpus;
+    for (size_t sibling = 0; cpus.size() < topology.size(); sibling++) {
+        for (const core_t& core : cores) {
+            if (sibling < core.cpus.size()) {
+                cpus.push_back(core.cpus[sibling]);
+            }
+        }
+    }
+    if (cpus.empty()) {
+        return placement;
+    }
+
+    size_t next = 0;
+    auto assign = [&cpus, &next](std::vector<size_t>& dest, const size_t num_threads) {
+        for (size_t i = 0; i < num_threads; i++) {
+            dest.push_back(cpus[next++ % cpus.size()]);
+        }
+    };
+    assign(placement.io_cpus, num_io_threads);
+    assign(placement.convert_cpus, num_convert_threads);
+    assign(placement.app_cpus, num_app_threads);
+    placement.shares_cores = next > cores.size();
+    return placement;
+}
+
+std::vector<size_t> get_convert_cpus(
+    const uhd::device_addr_t& stream_args, const size_t num_threads)
+{
+    const std::string convert_cpus = stream_args.get("convert_cpus", "");
+    if (convert_cpus != "auto") {
+        return uhd::worker_pool::parse_cpu_list(convert_cpus);
+    }
+    return uhd::get_thread_placement(
+        stream_args.cast<size_t>("num_poll_offload_threads", 1),
+        num_threads,
+        0,
+        stream_args.cast<int>("numa_node", NO_NODE))
+        .convert_cpus;
+}
+
+}} // namespace uhd::numa
+
+std::string uhd::thread_placement_t::to_pp_string() const
+{
+    std::ostringstream ss;
+    auto add_role = [&ss](const std::string& role, const std::vector<size_t>& cpus) {
+        if (!cpus.empty()) {
+            ss << (ss.tellp() == 0 ? "" : "; ") << role << " threads on CPUs "
+               << uhd::numa::cpus_to_string(cpus);
+        }
+    };
+    add_role("I/O", io_cpus);
+    add_role("converter", convert_cpus);
+    add_role("application", app_cpus);
+    if (ss.tellp() == 0) {
+        return "no threads placed";
+    }
+    if (numa_node >= 0) {
+        ss << " (NUMA node " << numa_node << ")";
+    }
+    if (shares_cores) {
+        ss << ", some threads share physical cores";
+    }
+    return ss.str();
+}
+
+uhd::thread_placement_t uhd::get_thread_placement(const size_t num_io_threads,
+    const size_t num_convert_threads,
+    const size_t num_app_threads,
+    const int numa_node)
+{
+    const auto placement = uhd::numa::plan_thread_placement(uhd::numa::get_cpu_topology(),
+        num_io_threads,
+        num_convert_threads,
+        num_app_threads,
+        numa_node);
+    UHD_LOG_INFO("UHD", "Thread placement: " << placement.to_pp_string());
+    return placement;
+}
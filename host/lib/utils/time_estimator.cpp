@@ -0,0 +1,105 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/time_estimator.hpp>
+#include <chrono>
+#include <cmath>
+
+using namespace uhd;
+
+namespace {
+
+int64_t get_host_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint64_t extrapolate(
+    const uint64_t ticks, const int64_t elapsed_ns, const double tick_rate)
+{
+    return ticks + std::llround(elapsed_ns * 1e-9 * tick_rate);
+}
+
+} // namespace
+
+constexpr double time_estimator::DEFAULT_RESYNC_PERIOD;
+
+time_estimator::time_estimator(read_ticks_fn_t read_ticks, const double resync_period)
+    : _read_ticks(std::move(read_ticks))
+    , _resync_period_ns(static_cast<int64_t>(resync_period * 1e9))
+{
+}
+
+uint64_t time_estimator::get_ticks(const double tick_rate)
+{
+    const int64_t now_ns = get_host_ns();
+    if (now_ns < _holdoff_end_ns.load(std::memory_order_relaxed)) {
+        return _read_ticks();
+    }
+
+    int64_t host_ns = 0;
+    uint64_t ticks  = 0;
+    const bool valid = _load(host_ns, ticks);
+    if (valid && now_ns - host_ns < _resync_period_ns) {
+        return extrapolate(ticks, now_ns - host_ns, tick_rate);
+    }
+
+    std::unique_lock<std::mutex> lock(_resync_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        // Another thread is reading the time from the hardware. The previous
+        // readback is still good enough until that's done.
+        if (valid) {
+            return extrapolate(ticks, now_ns - host_ns, tick_rate);
+        }
+        lock.lock();
+    }
+    // The time may have been invalidated while we were waiting for the lock
+    const int64_t start_ns = get_host_ns();
+    if (start_ns < _holdoff_end_ns.load(std::memory_order_relaxed)) {
+        return _read_ticks();
+    }
+    const uint64_t device_ticks = _read_ticks();
+    const int64_t end_ns        = get_host_ns();
+    _store(start_ns + (end_ns - start_ns) / 2, device_ticks);
+    return device_ticks;
+}
+
+void time_estimator::invalidate(const double holdoff)
+{
+    std::lock_guard<std::mutex> lock(_resync_mutex);
+    _holdoff_end_ns.store(
+        get_host_ns() + static_cast<int64_t>(holdoff * 1e9), std::memory_order_relaxed);
+    _store(0, 0);
+}
+
+bool time_estimator::_load(int64_t& host_ns, uint64_t& ticks) const
+{
+    while (true) {
+        const uint32_t seq = _seq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            // A readback is being stored, which is only two stores
+            continue;
+        }
+        host_ns = _host_ns.load(std::memory_order_relaxed);
+        ticks   = _ticks.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_seq.load(std::memory_order_relaxed) == seq) {
+            return host_ns != 0;
+        }
+    }
+}
+
+void time_estimator::_store(const int64_t host_ns, const uint64_t ticks)
+{
+    const uint32_t seq = _seq.load(std::memory_order_relaxed);
+    _seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _host_ns.store(host_ns, std::memory_order_relaxed);
+    _ticks.store(ticks, std::memory_order_relaxed);
+    _seq.store(seq + 2, std::memory_order_release);
+}
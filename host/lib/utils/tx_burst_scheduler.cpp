@@ -0,0 +1,248 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhd/utils/tx_burst_scheduler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace uhd;
+
+namespace {
+
+constexpr char LOG_ID[] = "TX_SCHEDULER";
+
+//! Maximum time between two reads of the device time while waiting for a
+// burst, so the scheduler follows a device time which is set in between
+constexpr double MAX_WAIT_TIME = 0.1;
+
+//! Timeout of the individual send() calls, after which the scheduler checks
+// whether it is being stopped
+constexpr double SEND_TIMEOUT = 0.1;
+
+//! Samples of one call to submit()
+struct burst_t
+{
+    std::vector<std::vector<char>> buffs;
+    size_t nsamps_per_buff = 0;
+    bool end_of_burst      = true;
+};
+
+} // namespace
+
+constexpr double tx_burst_scheduler::DEFAULT_LEAD_TIME;
+
+class tx_burst_scheduler_impl : public tx_burst_scheduler
+{
+public:
+    tx_burst_scheduler_impl(tx_streamer::sptr streamer,
+        const std::string& cpu_format,
+        get_time_fn_t get_time,
+        const double lead_time)
+        : _streamer(std::move(streamer))
+        , _bytes_per_samp(uhd::convert::get_bytes_per_item(cpu_format))
+        , _get_time(std::move(get_time))
+        , _lead_time(lead_time)
+        , _buff_ptrs(_streamer->get_num_channels())
+    {
+        if (lead_time < 0.0) {
+            throw uhd::value_error("tx_burst_scheduler: Invalid lead time!");
+        }
+        _thread = std::thread([this]() { _run(); });
+        uhd::set_thread_name(&_thread, "uhd_tx_sched");
+    }
+
+    ~tx_burst_scheduler_impl() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cond.notify_all();
+        _thread.join();
+        if (_in_burst) {
+            // Don't leave the device waiting for the rest of the burst
+            tx_metadata_t md;
+            md.end_of_burst = true;
+            try {
+                _streamer->send(_buff_ptrs, 0, md, SEND_TIMEOUT);
+            } catch (...) {
+                UHD_LOG_WARNING(LOG_ID, "Failed to end the current burst");
+            }
+        }
+    }
+
+    void submit(const std::vector<const void*>& buffs,
+        const size_t nsamps_per_buff,
+        const time_spec_t& time,
+        const bool end_of_burst) override
+    {
+        if (buffs.size() != _streamer->get_num_channels()) {
+            throw uhd::value_error(
+                "tx_burst_scheduler: submit() requires one buffer per channel");
+        }
+        burst_t burst;
+        burst.nsamps_per_buff = nsamps_per_buff;
+        burst.end_of_burst    = end_of_burst;
+
+        const size_t num_bytes = nsamps_per_buff * _bytes_per_samp;
+        for (const void* buff : buffs) {
+            const char* samps = static_cast<const char*>(buff);
+            burst.buffs.emplace_back(samps, samps + num_bytes);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _rethrow_error();
+            // Bursts with the same time are sent in the order they came in
+            _queue.emplace(time, std::move(burst));
+        }
+        _cond.notify_all();
+    }
+
+    size_t get_num_queued() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _queue.size();
+    }
+
+    size_t get_num_late() const override
+    {
+        return _num_late.load();
+    }
+
+    bool wait_until_empty(const double timeout) override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        const bool empty = _cond.wait_for(lock,
+            std::chrono::duration<double>(timeout),
+            [this]() { return (_queue.empty() && !_sending) || _error; });
+        _rethrow_error();
+        return empty;
+    }
+
+private:
+    void _run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stop) {
+            if (_queue.empty()) {
+                _cond.wait(lock);
+                continue;
+            }
+            // Reading the device time may be slow, so don't hold the lock
+            const time_spec_t next_time = _queue.begin()->first;
+            lock.unlock();
+            const time_spec_t now = _get_time();
+            lock.lock();
+            if (_stop || _queue.empty() || _queue.begin()->first < next_time) {
+                // An earlier burst came in meanwhile
+                continue;
+            }
+            const double wait_time = (next_time - now).get_real_secs() - _lead_time;
+            if (wait_time > 0.0) {
+                const double timeout = std::min(wait_time, MAX_WAIT_TIME);
+                _cond.wait_for(lock, std::chrono::duration<double>(timeout));
+                continue;
+            }
+
+            burst_t burst = std::move(_queue.begin()->second);
+            _queue.erase(_queue.begin());
+            _sending = true;
+            lock.unlock();
+            if (now > next_time) {
+                _num_late++;
+            }
+            std::exception_ptr error;
+            try {
+                _send(burst, next_time);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            _sending = false;
+            if (error && !_error) {
+                _error = error;
+            }
+            _cond.notify_all();
+        }
+    }
+
+    //! Send one burst, and wait for flow control credits as long as it takes
+    void _send(const burst_t& burst, const time_spec_t& time)
+    {
+        tx_metadata_t md;
+        md.has_time_spec  = true;
+        md.time_spec      = time;
+        md.start_of_burst = !_in_burst;
+        md.end_of_burst   = burst.end_of_burst;
+        _in_burst         = true;
+        size_t num_sent   = 0;
+        while (true) {
+            for (size_t i = 0; i < burst.buffs.size(); i++) {
+                _buff_ptrs[i] = burst.buffs[i].data() + num_sent * _bytes_per_samp;
+            }
+            num_sent += _streamer->send(
+                _buff_ptrs, burst.nsamps_per_buff - num_sent, md, SEND_TIMEOUT);
+            if (num_sent >= burst.nsamps_per_buff || _stop) {
+                break;
+            }
+            // The rest of the burst follows the samples which were sent
+            md.has_time_spec  = false;
+            md.start_of_burst = false;
+        }
+        _in_burst = !burst.end_of_burst || num_sent < burst.nsamps_per_buff;
+    }
+
+    //! Rethrow an error of the thread once, with _mutex locked
+    void _rethrow_error()
+    {
+        if (_error) {
+            std::exception_ptr error = _error;
+            _error                   = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    const tx_streamer::sptr _streamer;
+    const size_t _bytes_per_samp;
+    const get_time_fn_t _get_time;
+    const double _lead_time;
+
+    // Only used by the thread of the scheduler, and after it has stopped
+    std::vector<const void*> _buff_ptrs;
+    bool _in_burst = false;
+
+    // Protected by _mutex
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    std::multimap<time_spec_t, burst_t> _queue;
+    bool _sending = false;
+    std::exception_ptr _error;
+
+    std::atomic<bool> _stop{false};
+    std::atomic<size_t> _num_late{0};
+    std::thread _thread;
+};
+
+tx_burst_scheduler::sptr tx_burst_scheduler::make(tx_streamer::sptr streamer,
+    const std::string& cpu_format,
+    get_time_fn_t get_time,
+    const double lead_time)
+{
+    return std::make_shared<tx_burst_scheduler_impl>(
+        streamer, cpu_format, std::move(get_time), lead_time);
+}
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/utils/chdr/chdr_packet.hpp>
+#include <uhd/utils/chdr/chdr_stream_engine.hpp>
 #include <uhd/utils/pybind_adaptors.hpp>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -366,4 +367,72 @@ void export_utils(py::module& m)
         .value("INIT", chdr_rfnoc::STRC_INIT)
         .value("PING", chdr_rfnoc::STRC_PING)
         .value("RESYNC", chdr_rfnoc::STRC_RESYNC);
+
+    py::class_<chdr_stream_engine::output_args_t>(m, "ChdrStreamEngineOutputArgs")
+        .def(py::init<>())
+        .def_readwrite("src_epid", &chdr_stream_engine::output_args_t::src_epid)
+        .def_readwrite("dst_epid", &chdr_stream_engine::output_args_t::dst_epid)
+        .def_readwrite("addr", &chdr_stream_engine::output_args_t::addr)
+        .def_readwrite("port", &chdr_stream_engine::output_args_t::port)
+        .def_readwrite(
+            "packet_samples", &chdr_stream_engine::output_args_t::packet_samples)
+        .def_readwrite(
+            "bytes_per_sample", &chdr_stream_engine::output_args_t::bytes_per_sample)
+        .def_readwrite("sample_rate", &chdr_stream_engine::output_args_t::sample_rate)
+        .def_readwrite("num_samples", &chdr_stream_engine::output_args_t::num_samples)
+        .def_readwrite("has_timestamp", &chdr_stream_engine::output_args_t::has_timestamp)
+        .def_readwrite("timestamp", &chdr_stream_engine::output_args_t::timestamp)
+        .def_readwrite(
+            "capacity_packets", &chdr_stream_engine::output_args_t::capacity_packets)
+        .def_readwrite(
+            "capacity_bytes", &chdr_stream_engine::output_args_t::capacity_bytes);
+
+    py::class_<chdr_stream_engine::stream_stats_t>(m, "ChdrStreamEngineStats")
+        .def_readonly("active", &chdr_stream_engine::stream_stats_t::active)
+        .def_readonly("num_packets", &chdr_stream_engine::stream_stats_t::num_packets)
+        .def_readonly("num_bytes", &chdr_stream_engine::stream_stats_t::num_bytes)
+        .def_readonly(
+            "num_seq_errors", &chdr_stream_engine::stream_stats_t::num_seq_errors)
+        .def_readonly(
+            "num_fc_stalls", &chdr_stream_engine::stream_stats_t::num_fc_stalls);
+
+    py::class_<chdr_stream_engine, chdr_stream_engine::sptr>(m, "ChdrStreamEngine")
+        .def(py::init(&chdr_stream_engine::make), py::arg("socket_fd"), py::arg("chdr_w"))
+        // Returns None on a timeout, or the packet and the address of the sender
+        // in the format of socket.recvfrom()
+        .def(
+            "recv_control",
+            [](chdr_stream_engine& self, const double timeout) -> py::object {
+                chdr_stream_engine::control_packet_t packet;
+                bool received;
+                {
+                    py::gil_scoped_release release;
+                    received = self.recv_control(packet, timeout);
+                }
+                if (!received) {
+                    return py::none();
+                }
+                return py::make_tuple(
+                    py::bytes(reinterpret_cast<const char*>(packet.data.data()),
+                        packet.data.size()),
+                    py::make_tuple(packet.addr, packet.port));
+            },
+            py::arg("timeout"))
+        .def("begin_input",
+            &chdr_stream_engine::begin_input,
+            py::arg("epid"),
+            py::arg("capacity_bytes"))
+        .def("end_input", &chdr_stream_engine::end_input, py::arg("epid"))
+        .def("get_input_stats", &chdr_stream_engine::get_input_stats, py::arg("epid"))
+        .def("begin_output",
+            &chdr_stream_engine::begin_output,
+            py::arg("args"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("end_output",
+            &chdr_stream_engine::end_output,
+            py::arg("src_epid"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("get_output_stats",
+            &chdr_stream_engine::get_output_stats,
+            py::arg("src_epid"));
 }
@@ -0,0 +1,87 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/config.hpp>
+#include <uhdlib/utils/wakeup_fd.hpp>
+#if defined(UHD_PLATFORM_LINUX)
+#    define HAVE_WAKEUP_FD
+#    include <poll.h>
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#elif defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
+#    define HAVE_WAKEUP_FD
+#    include <fcntl.h>
+#    include <poll.h>
+#    include <unistd.h>
+#endif
+
+using namespace uhd;
+
+wakeup_fd::wakeup_fd()
+{
+#if defined(UHD_PLATFORM_LINUX)
+    _read_fd  = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    _write_fd = _read_fd;
+#elif defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
+    int fds[2];
+    if (::pipe(fds) == 0) {
+        for (const int fd : fds) {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        _read_fd  = fds[0];
+        _write_fd = fds[1];
+    }
+#endif
+}
+
+wakeup_fd::~wakeup_fd()
+{
+#ifdef HAVE_WAKEUP_FD
+    if (_write_fd >= 0 && _write_fd != _read_fd) {
+        ::close(_write_fd);
+    }
+    if (_read_fd >= 0) {
+        ::close(_read_fd);
+    }
+#endif
+}
+
+void wakeup_fd::notify()
+{
+#ifdef HAVE_WAKEUP_FD
+    if (_write_fd >= 0) {
+        // A full pipe or eventfd counter is readable anyway, so errors can be
+        // ignored
+        const uint64_t value = 1;
+        const ssize_t result = ::write(_write_fd, &value, _write_fd == _read_fd ? 8 : 1);
+        (void)result;
+    }
+#endif
+}
+
+void wakeup_fd::clear()
+{
+#ifdef HAVE_WAKEUP_FD
+    if (_read_fd >= 0) {
+        uint64_t value;
+        while (::read(_read_fd, &value, _write_fd == _read_fd ? 8 : 1) > 0) {
+        }
+    }
+#endif
+}
+
+bool wakeup_fd::wait(const int32_t timeout_ms)
+{
+#ifdef HAVE_WAKEUP_FD
+    if (_read_fd >= 0) {
+        pollfd pfd{_read_fd, POLLIN, 0};
+        return ::poll(&pfd, 1, timeout_ms) > 0;
+    }
+#endif
+    (void)timeout_ms;
+    return false;
+}
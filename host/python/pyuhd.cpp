@@ -33,6 +33,7 @@ namespace py = pybind11;
 #include "rfnoc/vector_iir_block_control_python.hpp"
 #include "rfnoc/window_block_control_python.hpp"
 #include "stream_python.hpp"
+#include "stream_ring_python.hpp"
 #include "types/filters_python.hpp"
 #include "types/metadata_python.hpp"
 #include "types/sensors_python.hpp"
@@ -43,6 +44,7 @@ namespace py = pybind11;
 #include "usrp/dboard_iface_python.hpp"
 #include "usrp/fe_connection_python.hpp"
 #include "usrp/multi_usrp_python.hpp"
+#include "usrp/rx_power_sweep_python.hpp"
 #include "usrp/subdev_spec_python.hpp"
 #include "utils/paths_python.hpp"
 #include "utils/utils_python.hpp"
@@ -86,7 +88,9 @@ PYBIND11_MODULE(libpyuhd, m)
     export_subdev_spec(usrp_module);
     export_dboard_iface(usrp_module);
     export_fe_connection(usrp_module);
+    export_rx_power_sweep(usrp_module);
     export_stream(usrp_module);
+    export_stream_ring(usrp_module);
 
     // Register filters submodule
     auto filters_module = m.def_submodule("filters", "Filter Submodule");
@@ -24,6 +24,9 @@ StrsPayload = lib.chdr.StrsPayload
 StrsStatus = lib.chdr.StrsStatus
 StrcPayload = lib.chdr.StrcPayload
 StrcOpCode = lib.chdr.StrcOpCode
+ChdrStreamEngine = lib.chdr.ChdrStreamEngine
+ChdrStreamEngineOutputArgs = lib.chdr.ChdrStreamEngineOutputArgs
+ChdrStreamEngineStats = lib.chdr.ChdrStreamEngineStats
 
 def __get_payload(self):
     pkt_type = self.get_header().pkt_type
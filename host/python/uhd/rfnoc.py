@@ -35,3 +35,5 @@ WindowBlockControl = lib.rfnoc.window_block_control
 
 connect_through_blocks = lib.rfnoc.connect_through_blocks
 get_block_chain = lib.rfnoc.get_block_chain
+replay_load_file = lib.rfnoc.replay_load_file
+replay_capture_to_file = lib.rfnoc.replay_capture_to_file
@@ -17,3 +17,4 @@ from .libtypes import *
 # pylint: enable=wildcard-import
 
 from . import cal
+from . import aio
@@ -0,0 +1,190 @@
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+""" @package usrp.aio
+asyncio interfaces for streamers
+
+The streams receive and send on C++ threads of their own (see RXStreamRing
+and TXStreamRing), which signal a file descriptor when there's something for
+Python to do. A single event loop can thus serve the streams of several
+devices, without a Python thread per stream.
+"""
+
+import asyncio
+import numpy as np
+from .. import libpyuhd as lib
+
+
+async def _wait_readable(fileno):
+    """Wait until the file descriptor is readable"""
+    loop = asyncio.get_running_loop()
+    future = loop.create_future()
+    def on_readable():
+        if not future.done():
+            future.set_result(None)
+    loop.add_reader(fileno, on_readable)
+    try:
+        await future
+    finally:
+        loop.remove_reader(fileno)
+
+
+class AsyncRXStream:
+    """
+    Receives from an RX streamer within an asyncio event loop
+
+    Iterating over the stream yields tuples of the samples, with the shape
+    (num_channels, num_samps), and their RXMetadata. The samples are a view
+    into the ring of the stream, and are only valid until the next iteration.
+
+    Example:
+    >>> async with AsyncRXStream(streamer, np.complex64, 10000) as rx_stream:
+    >>>     streamer.issue_stream_cmd(stream_cmd)
+    >>>     async for samples, metadata in rx_stream:
+    >>>         process(samples)
+    """
+    def __init__(self, streamer, dtype, segment_size, num_segments=16, timeout=0.1):
+        """
+        Arguments:
+        streamer -- The RXStreamer, which must not be used for recv() elsewhere
+        dtype -- The numpy data type which matches the CPU format of the streamer
+        segment_size -- The most samples per channel and iteration
+        num_segments -- The number of segments the ring holds
+        timeout -- The timeout of the recv() calls on the thread, in seconds
+        """
+        self._ring = lib.usrp.rx_stream_ring(streamer, dtype, segment_size, num_segments)
+        self._timeout = timeout
+        self._holding = False
+        self._running = False
+
+    def start(self):
+        """Start receiving"""
+        self._ring.start(self._timeout)
+        self._running = True
+
+    def stop(self):
+        """
+        Stop receiving. The segments which were received already can still be
+        taken, after that, the iteration ends.
+        """
+        self._running = False
+        self._ring.stop()
+
+    async def recv(self):
+        """
+        Return the next tuple (samples, metadata), or None if the stream was
+        stopped and no segment is left
+        """
+        if self._holding:
+            self._ring.release()
+            self._holding = False
+        while True:
+            segment = self._ring.get(0)
+            if segment is not None:
+                self._holding = True
+                return segment
+            if not self._running:
+                return None
+            await _wait_readable(self._ring.fileno())
+
+    def __aiter__(self):
+        return self
+
+    async def __anext__(self):
+        segment = await self.recv()
+        if segment is None:
+            raise StopAsyncIteration
+        return segment
+
+    async def __aenter__(self):
+        self.start()
+        return self
+
+    async def __aexit__(self, *args):
+        self.stop()
+
+
+class AsyncTXStream:
+    """
+    Sends to a TX streamer within an asyncio event loop
+
+    Example:
+    >>> async with AsyncTXStream(streamer, np.complex64, 10000) as tx_stream:
+    >>>     await tx_stream.send(samples, metadata)
+    >>>     async_metadata = await tx_stream.recv_async_msg()
+    """
+    def __init__(self, streamer, dtype, segment_size, num_segments=16, timeout=0.1):
+        """
+        Arguments:
+        streamer -- The TXStreamer, which must not be used elsewhere
+        dtype -- The numpy data type which matches the CPU format of the streamer
+        segment_size -- The most samples per channel and send() call of the
+                        thread
+        num_segments -- The number of segments the ring holds
+        timeout -- The timeout of the send() calls on the thread, in seconds
+        """
+        self._ring = lib.usrp.tx_stream_ring(streamer, dtype, segment_size, num_segments)
+        self._timeout = timeout
+
+    def start(self):
+        """Start sending"""
+        self._ring.start(self._timeout)
+
+    def stop(self):
+        """Send the samples which were queued already, and stop sending"""
+        self._ring.stop()
+
+    async def _get_segment(self):
+        while True:
+            segment = self._ring.get(0)
+            if segment is not None:
+                return segment
+            await _wait_readable(self._ring.fileno())
+
+    async def send(self, samples, metadata):
+        """
+        Queue samples for sending, like TXStreamer.send()
+
+        The samples are copied into the ring, so the array may be reused as
+        soon as this returns. If the ring is full, this waits for the thread
+        to send some of it.
+
+        Arguments:
+        samples -- An array with the shape (num_channels, num_samps), or a 1-D
+                   array for a single channel
+        metadata -- The TXMetadata of the samples
+        """
+        samples = np.atleast_2d(samples)
+        num_samps = samples.shape[1]
+        offset = 0
+        while True:
+            segment = await self._get_segment()
+            chunk = min(segment.shape[1], num_samps - offset)
+            segment[:, :chunk] = samples[:, offset:offset + chunk]
+            # Only the first chunk starts a burst, and only the last one ends it
+            chunk_metadata = lib.types.tx_metadata()
+            chunk_metadata.has_time_spec = metadata.has_time_spec and offset == 0
+            chunk_metadata.time_spec = metadata.time_spec
+            chunk_metadata.start_of_burst = metadata.start_of_burst and offset == 0
+            offset += chunk
+            chunk_metadata.end_of_burst = metadata.end_of_burst and offset == num_samps
+            self._ring.commit(chunk, chunk_metadata)
+            if offset == num_samps:
+                return num_samps
+
+    async def recv_async_msg(self):
+        """Return the next TXAsyncMetadata"""
+        while True:
+            async_metadata = self._ring.recv_async_msg()
+            if async_metadata is not None:
+                return async_metadata
+            await _wait_readable(self._ring.async_msg_fileno())
+
+    async def __aenter__(self):
+        self.start()
+        return self
+
+    async def __aexit__(self, *args):
+        self.stop()
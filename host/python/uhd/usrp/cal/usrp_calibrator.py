@@ -108,6 +108,8 @@ class USRPCalibratorBase:
         self._chan = None
         self._ant = ""
         self._streamer = None
+        # The RX measurements are run by this sweep engine, see update_port()
+        self._sweep = None
         # These dictionaries store the results that get written out as well as
         # the noise floor for reference
         self.results = {} # This must be of the form results[freq][gain] = power
@@ -150,6 +152,10 @@ class USRPCalibratorBase:
             self._streamer = get_streamer(self._usrp, self._dir, chan)
             if self._dir == 'tx':
                 self._tone_gen.set_streamer(self._streamer)
+            else:
+                self._sweep = uhd.usrp.RXPowerSweep(self._usrp, self._streamer, chan)
+                self._sweep.set_num_samps(NUM_SAMPS_PER_EST)
+                self._sweep.set_tune_settling_time(self.tune_settling_time)
         self._chan = chan
 
     def _get_frequencies(self, start_hint=None, stop_hint=None, step_hint=None):
@@ -197,14 +203,13 @@ class USRPCalibratorBase:
                       .format(freq/1e6, self._noise[freq]))
         else: # Rx
             print("===== Measuring noise floor across frequency and gain...")
+            # The sweep schedules the tunes and gain steps with timed commands,
+            # so the device settles and captures while the host measures
+            noise = self._sweep.run(
+                [float(freq) for freq in freqs], [float(gain) for gain in self._gains])
             for freq in freqs:
-                self._noise[freq] = {}
-                tune_req = uhd.types.TuneRequest(freq)
-                self._usrp.set_rx_freq(tune_req, self._chan)
-                time.sleep(self.tune_settling_time)
+                self._noise[freq] = noise[float(freq)]
                 for gain in self._gains:
-                    self._usrp.set_rx_gain(gain, self._chan)
-                    self._noise[freq][gain] = get_usrp_power(self._streamer)
                     print("[RX] Noise floor: {:7.2f} MHz / {} dB => {:+6.2f} dBFS"
                           .format(freq/1e6, gain, self._noise[freq][gain]))
         return freqs
@@ -240,7 +245,7 @@ class USRPCalibratorBase:
         self.log("Requesting input power: {:+.2f} dBm."
                  .format(self.min_detectable_signal))
         usrp_input_power = self._meas_dev.set_power(self.min_detectable_signal)
-        recvd_power = get_usrp_power(self._streamer)
+        recvd_power = self._sweep.measure()
         self.log("Got input power: {:+.2f} dBm. Received power: {:.2f} dBFS. "
                  "Requesting new input power: {:+.2f} dBm."
                  .format(usrp_input_power,
@@ -250,7 +255,7 @@ class USRPCalibratorBase:
             usrp_input_power + PWR_EST_IDEAL_LEVEL - recvd_power)
         siggen_locked = False
         for _ in range(SIGPWR_LOCK_MAX_ITER):
-            recvd_power = get_usrp_power(self._streamer)
+            recvd_power = self._sweep.measure()
             if PWR_EST_LLIM <= recvd_power <= PWR_EST_ULIM:
                 siggen_locked = True
                 break
@@ -283,7 +288,7 @@ class USRPCalibratorBase:
                     min(usrp_input_power + gain_delta, self.max_input_power))
                 # usrp_input_power = self._meas_dev.set_power(usrp_input_power + gain_delta)
                 self.log("New input power is: {:+.2f} dBm".format(usrp_input_power))
-            recvd_power = get_usrp_power(self._streamer)
+            recvd_power = self._sweep.measure()
             self.log("Received power: {:.2f} dBFS".format(recvd_power))
             # It's possible that we lose the lock on the signal power, so allow
             # for a correction
@@ -294,7 +299,7 @@ class USRPCalibratorBase:
                 usrp_input_power = self._meas_dev.set_power(usrp_input_power + power_delta)
                 self.log("New input power is: {:+.2f} dBm".format(usrp_input_power))
                 # And then of course, measure again
-                recvd_power = get_usrp_power(self._streamer)
+                recvd_power = self._sweep.measure()
                 self.log("Received power: {:.2f} dBFS".format(recvd_power))
             # Note: The noise power should be way down there, and really
             # shouldn't matter. We subtract it anyway for formal correctness.
@@ -26,4 +26,7 @@ FEConnection = lib.usrp.fe_connection
 StreamArgs = lib.usrp.stream_args
 RXStreamer = lib.usrp.rx_streamer
 TXStreamer = lib.usrp.tx_streamer
+RXStreamRing = lib.usrp.rx_stream_ring
+TXStreamRing = lib.usrp.tx_stream_ring
+RXPowerSweep = lib.usrp.rx_power_sweep
 # pylint: enable=invalid-name
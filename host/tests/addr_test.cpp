@@ -8,6 +8,7 @@
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/mac_addr.hpp>
 #include <uhd/usrp/dboard_id.hpp>
+#include <uhdlib/utils/args_view.hpp>
 #include <boost/test/unit_test.hpp>
 #include <algorithm>
 #include <iostream>
@@ -65,6 +66,30 @@ BOOST_AUTO_TEST_CASE(test_device_addr)
     std::cout << "Merged: " << dev_addr_lhs1.to_string() << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(test_args_view)
+{
+    const uhd::device_addr_t dev_addr("spp=200, rate=1e6, name=foo, flag");
+    const uhd::args_view args(dev_addr);
+
+    BOOST_CHECK(args.has_key("flag"));
+    BOOST_CHECK(!args.has_key("missing"));
+    BOOST_CHECK_EQUAL(args.get("name"), "foo");
+    BOOST_CHECK_EQUAL(args.get("flag"), "");
+    BOOST_CHECK_EQUAL(args.get("missing", "bar"), "bar");
+    // Cached conversions return the same as the first one, and casting to
+    // another type converts again
+    for (size_t i = 0; i < 2; i++) {
+        BOOST_CHECK_EQUAL(args.cast<size_t>("spp", 0), 200);
+        BOOST_CHECK_EQUAL(args.cast<double>("spp", 0.0), 200.0);
+        BOOST_CHECK_EQUAL(args.cast<double>("rate", 0.0), 1e6);
+    }
+    BOOST_CHECK_EQUAL(args.cast<int>("missing", 5), 5);
+    // Same errors as device_addr_t
+    BOOST_CHECK_THROW(dev_addr.cast<size_t>("name", 0), std::runtime_error);
+    BOOST_CHECK_THROW(args.cast<size_t>("name", 0), std::runtime_error);
+    BOOST_CHECK_THROW(args.cast<size_t>("rate", 0), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_dboard_id)
 {
     std::cout << "Testing dboard id..." << std::endl;
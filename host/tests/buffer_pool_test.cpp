@@ -0,0 +1,74 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/transport/buffer_pool.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+using namespace uhd::transport;
+
+static void check_pool(buffer_pool::sptr pool,
+    const size_t num_buffs,
+    const size_t buff_size,
+    const size_t alignment)
+{
+    BOOST_REQUIRE_EQUAL(pool->size(), num_buffs);
+    for (size_t i = 0; i < num_buffs; i++) {
+        const size_t addr = size_t(pool->at(i));
+        BOOST_CHECK_EQUAL(addr % alignment, 0);
+        if (i > 0) {
+            BOOST_CHECK_GE(addr - size_t(pool->at(i - 1)), buff_size);
+        }
+        // Make sure the memory is actually writable
+        std::memset(pool->at(i), 0xa5, buff_size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_buffer_pool_alignment)
+{
+    check_pool(buffer_pool::make(10, 1000), 10, 1000, 16);
+    check_pool(buffer_pool::make(10, 1000, 64), 10, 1000, 64);
+    check_pool(buffer_pool::make(3, 8000, 4096), 3, 8000, 4096);
+}
+
+BOOST_AUTO_TEST_CASE(test_buffer_pool_numa_and_hugepages)
+{
+    // Whether or not the system supports NUMA placement or has hugepages
+    // reserved, these must fall back to a usable pool
+    check_pool(buffer_pool::make(100, 8000, 16, 0), 100, 8000, 16);
+    check_pool(buffer_pool::make(100, 8000, 16, -1, true), 100, 8000, 16);
+    check_pool(buffer_pool::make(100, 8000, 64, 0, true), 100, 8000, 64);
+}
+
+BOOST_AUTO_TEST_CASE(test_buffer_pool_memory_hooks)
+{
+    std::vector<std::pair<void*, size_t>> allocated, freed;
+    buffer_pool::set_memory_hooks(
+        [&allocated](void* mem, size_t size) { allocated.emplace_back(mem, size); },
+        [&freed](void* mem, size_t size) { freed.emplace_back(mem, size); });
+
+    auto pool = buffer_pool::make(10, 1000, 64);
+    check_pool(pool, 10, 1000, 64);
+    BOOST_REQUIRE_EQUAL(allocated.size(), 1);
+    // The block must contain all buffers
+    const size_t mem = size_t(allocated[0].first);
+    BOOST_CHECK_LE(mem, size_t(pool->at(0)));
+    BOOST_CHECK_GE(mem + allocated[0].second, size_t(pool->at(9)) + 1000);
+    BOOST_CHECK(freed.empty());
+
+    // Removing the hooks does not affect existing pools
+    buffer_pool::set_memory_hooks(nullptr, nullptr);
+    pool.reset();
+    BOOST_REQUIRE_EQUAL(freed.size(), 1);
+    BOOST_CHECK(freed[0] == allocated[0]);
+
+    check_pool(buffer_pool::make(10, 1000), 10, 1000, 16);
+    BOOST_CHECK_EQUAL(allocated.size(), 1);
+    BOOST_CHECK_EQUAL(freed.size(), 1);
+}
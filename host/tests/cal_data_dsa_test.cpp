@@ -53,6 +53,13 @@ BOOST_AUTO_TEST_CASE(test_pwr_cal_api)
     BOOST_CHECK_EQUAL_COLLECTIONS(calculated.begin(), calculated.end(), expected.begin(), expected.end());
 
     BOOST_REQUIRE_THROW(dsa_data->get_dsa_setting(5E9, 1), uhd::value_error);
+
+    const std::vector<double> expected_max_freqs{1E9, 4E9};
+    const auto max_freqs = dsa_data->get_band_max_freqs();
+    BOOST_CHECK_EQUAL_COLLECTIONS(max_freqs.begin(),
+        max_freqs.end(),
+        expected_max_freqs.begin(),
+        expected_max_freqs.end());
 }
 
 BOOST_AUTO_TEST_CASE(test_pwr_cal_serdes)
@@ -117,6 +117,29 @@ BOOST_AUTO_TEST_CASE(test_pwr_cal_api_irreg)
 
 }
 
+BOOST_AUTO_TEST_CASE(test_pwr_cal_update)
+{
+    auto gain_power_data = pwr_cal::make();
+    gain_power_data->add_power_table({{0.0, -30.0}, {10.0, -20.0}}, -40, -10, 1e9);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power(5.0, 1.5e9), -25.0, 1e-6);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power_limits(1.5e9).stop(), -10.0, 1e-6);
+
+    // Lookups must reflect tables added after the first lookup
+    gain_power_data->add_power_table({{0.0, -40.0}, {10.0, -30.0}}, -50, -20, 2e9);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power(5.0, 1.5e9), -30.0, 1e-6);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power_limits(1.9e9).stop(), -20.0, 1e-6);
+
+    // ...and replaced tables
+    gain_power_data->add_power_table({{0.0, -20.0}, {10.0, -10.0}}, -40, -10, 1e9);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power(5.0, 1e9), -15.0, 1e-6);
+
+    // ...and cleared data
+    gain_power_data->clear();
+    BOOST_CHECK_THROW(gain_power_data->get_power(5.0, 1e9), uhd::assertion_error);
+    gain_power_data->add_power_table({{0.0, -10.0}, {10.0, 0.0}}, -40, -10, 1e9);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power(5.0, 1e9), -5.0, 1e-6);
+}
+
 BOOST_AUTO_TEST_CASE(test_pwr_cal_serdes)
 {
     const std::string name   = "Mock Gain/Power Data";
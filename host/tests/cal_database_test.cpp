@@ -10,6 +10,7 @@
 #include <stdlib.h> // putenv or _putenv
 #include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
+#include <fstream>
 #include <iostream>
 #include <numeric>
 
@@ -83,6 +84,25 @@ BOOST_AUTO_TEST_CASE(test_fs)
     BOOST_CHECK(database::has_cal_data("mock_data", "abcd"));
     BOOST_CHECK(fs::exists(tmp_cal_path / "mock_data_abcd.cal.BACKUP"));
 
+    // Repeated reads are served from the cache, but must see updates, both
+    // through write_cal_data() and from other writers
+    mock_data_rb = database::read_cal_data("mock_data", "abcd");
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        mock_data2.begin(), mock_data2.end(), mock_data_rb.begin(), mock_data_rb.end());
+    database::write_cal_data("mock_data", "abcd", mock_data, "BACKUP2");
+    mock_data_rb = database::read_cal_data("mock_data", "abcd");
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        mock_data.begin(), mock_data.end(), mock_data_rb.begin(), mock_data_rb.end());
+    const std::vector<uint8_t> mock_data3{7, 8, 9};
+    {
+        std::ofstream file(
+            (tmp_cal_path / "mock_data_abcd.cal").string(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(mock_data3.data()), mock_data3.size());
+    }
+    mock_data_rb = database::read_cal_data("mock_data", "abcd");
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        mock_data3.begin(), mock_data3.end(), mock_data_rb.begin(), mock_data_rb.end());
+
     fs::remove_all(tmp_cal_path, ec);
     if (ec) {
         std::cout << "WARNING: Could not remove temp cal path." << std::endl;
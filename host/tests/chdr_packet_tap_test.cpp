@@ -0,0 +1,103 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/rfnoc/chdr_packet_tap.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace uhd::rfnoc;
+namespace fs = boost::filesystem;
+
+namespace {
+
+struct pcap_record_t
+{
+    uint32_t caplen;
+    uint32_t len;
+    std::vector<uint8_t> data;
+};
+
+std::vector<pcap_record_t> read_pcap(const fs::path& path)
+{
+    std::ifstream file(path.string(), std::ios::binary);
+    uint32_t file_header[6];
+    file.read(reinterpret_cast<char*>(file_header), sizeof(file_header));
+    BOOST_REQUIRE(file);
+    BOOST_CHECK_EQUAL(file_header[0], 0xa1b23c4d);
+
+    std::vector<pcap_record_t> records;
+    uint32_t record_header[4];
+    while (file.read(reinterpret_cast<char*>(record_header), sizeof(record_header))) {
+        pcap_record_t record{record_header[2], record_header[3], {}};
+        record.data.resize(record.caplen);
+        file.read(reinterpret_cast<char*>(record.data.data()), record.caplen);
+        records.push_back(record);
+    }
+    return records;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_chdr_packet_tap)
+{
+    const fs::path path =
+        fs::temp_directory_path() / fs::unique_path("uhd-tap-%%%%-%%%%.pcap");
+    // The tap reads its configuration once, when the first port is made
+    setenv("UHD_CHDR_TAP_FILE", path.string().c_str(), /* overwrite */ 1);
+    setenv("UHD_CHDR_TAP_SAMPLE", "4", /* overwrite */ 1);
+    setenv("UHD_CHDR_TAP_TRIGGER", "2", /* overwrite */ 1);
+    auto port = chdr_packet_tap::make_port("test");
+    BOOST_REQUIRE(port);
+
+    std::vector<uint8_t> packet(1000);
+    for (size_t i = 0; i < packet.size(); i++) {
+        packet[i] = uint8_t(i);
+    }
+    // One in four data packets is sampled, other packets are all captured
+    for (size_t i = 0; i < 8; i++) {
+        port->capture(chdr_packet_tap::RX, packet.data(), packet.size(), true);
+    }
+    port->capture(chdr_packet_tap::TX, packet.data(), 16, false);
+    // After a trigger, packets are captured completely
+    port->trigger();
+    for (size_t i = 0; i < 3; i++) {
+        port->capture(chdr_packet_tap::RX, packet.data(), packet.size(), true);
+    }
+
+    std::vector<pcap_record_t> records;
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (records.size() < 5 && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        records = read_pcap(path);
+    }
+    fs::remove(path);
+
+    // The records have an IPv4 and a UDP header in front of the packet
+    constexpr size_t IP_UDP_HDR_LEN = 28;
+    BOOST_REQUIRE_EQUAL(records.size(), 5);
+    const size_t expected_caplens[] = {chdr_packet_tap::HEADER_SNAPLEN,
+        chdr_packet_tap::HEADER_SNAPLEN,
+        16,
+        packet.size(),
+        packet.size()};
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto& record = records[i];
+        BOOST_CHECK_EQUAL(record.caplen, expected_caplens[i] + IP_UDP_HDR_LEN);
+        BOOST_CHECK_EQUAL(record.len, (i == 2 ? 16 : packet.size()) + IP_UDP_HDR_LEN);
+        BOOST_CHECK_EQUAL(record.data[9], 17);
+        BOOST_CHECK(std::memcmp(record.data.data() + IP_UDP_HDR_LEN,
+                        packet.data(),
+                        record.caplen - IP_UDP_HDR_LEN)
+                    == 0);
+    }
+}
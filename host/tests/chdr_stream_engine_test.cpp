@@ -0,0 +1,228 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/chdr/chdr_packet.hpp>
+#include <uhd/utils/chdr/chdr_stream_engine.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#    include <arpa/inet.h>
+#    include <netinet/in.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+
+using namespace uhd::rfnoc;
+using namespace uhd::rfnoc::chdr;
+using namespace uhd::utils::chdr;
+
+namespace {
+
+constexpr uint16_t SIM_EPID  = 2;
+constexpr uint16_t HOST_EPID = 1;
+
+//! A UDP socket on the loopback interface
+class test_socket
+{
+public:
+    test_socket()
+    {
+        _fd = socket(AF_INET, SOCK_DGRAM, 0);
+        BOOST_REQUIRE(_fd >= 0);
+        sockaddr_in addr{};
+        addr.sin_family      = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        BOOST_REQUIRE(bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);
+        socklen_t addr_len = sizeof(addr);
+        getsockname(_fd, reinterpret_cast<sockaddr*>(&_addr), &addr_len);
+        timeval timeout{1, 0};
+        setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    ~test_socket()
+    {
+        close(_fd);
+    }
+
+    int get_fd() const
+    {
+        return _fd;
+    }
+
+    uint16_t get_port() const
+    {
+        return ntohs(_addr.sin_port);
+    }
+
+    void send_to(const test_socket& dst, const chdr_packet& packet)
+    {
+        const auto data = packet.serialize_to_byte_vector();
+        sendto(_fd,
+            data.data(),
+            data.size(),
+            0,
+            reinterpret_cast<const sockaddr*>(&dst._addr),
+            sizeof(dst._addr));
+    }
+
+    //! Receive a packet, or fail the test after a second
+    chdr_packet recv()
+    {
+        std::vector<uint8_t> buff(9000);
+        const ssize_t len = ::recv(_fd, buff.data(), buff.size(), 0);
+        BOOST_REQUIRE(len > 0);
+        buff.resize(len);
+        return chdr_packet::deserialize(CHDR_W_64, buff.begin(), buff.end());
+    }
+
+private:
+    int _fd;
+    sockaddr_in _addr{};
+};
+
+chdr_stream_engine::sptr make_engine(const test_socket& sim)
+{
+    try {
+        return chdr_stream_engine::make(sim.get_fd(), CHDR_W_64);
+    } catch (const uhd::not_implemented_error&) {
+        return nullptr;
+    }
+}
+
+chdr_packet make_strc(const strc_op_code_t op_code)
+{
+    chdr_header header;
+    header.set_pkt_type(PKT_TYPE_STRC);
+    header.set_dst_epid(SIM_EPID);
+    strc_payload payload;
+    payload.src_epid  = HOST_EPID;
+    payload.op_code   = op_code;
+    payload.num_pkts  = 4;
+    payload.num_bytes = 1 << 20;
+    return chdr_packet(CHDR_W_64, header, payload);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_chdr_stream_engine_control)
+{
+    test_socket sim, host;
+    auto engine = make_engine(sim);
+    if (!engine) {
+        BOOST_TEST_MESSAGE("chdr_stream_engine not supported, skipping test");
+        return;
+    }
+    // Packets to endpoints without streams go to the control plane
+    host.send_to(sim, make_strc(STRC_INIT));
+    chdr_stream_engine::control_packet_t packet;
+    BOOST_REQUIRE(engine->recv_control(packet, 1.0));
+    BOOST_CHECK_EQUAL(packet.addr, "127.0.0.1");
+    BOOST_CHECK_EQUAL(packet.port, host.get_port());
+    const auto strc = chdr_packet::deserialize(
+        CHDR_W_64, packet.data.begin(), packet.data.end());
+    BOOST_CHECK_EQUAL(strc.get_header().get_pkt_type(), PKT_TYPE_STRC);
+    BOOST_CHECK(!engine->recv_control(packet, 0.0));
+    BOOST_CHECK_THROW(engine->get_input_stats(SIM_EPID), uhd::key_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_chdr_stream_engine_input)
+{
+    test_socket sim, host;
+    auto engine = make_engine(sim);
+    if (!engine) {
+        BOOST_TEST_MESSAGE("chdr_stream_engine not supported, skipping test");
+        return;
+    }
+    engine->begin_input(SIM_EPID, 1 << 20);
+
+    host.send_to(sim, make_strc(STRC_INIT));
+    auto strs = host.recv().get_payload<strs_payload>();
+    BOOST_CHECK_EQUAL(strs.src_epid, SIM_EPID);
+    BOOST_CHECK_EQUAL(strs.capacity_bytes, 1 << 20);
+    BOOST_CHECK_EQUAL(strs.xfer_count_pkts, 0);
+
+    // Every fourth packet is answered with a flow control status
+    chdr_header header;
+    header.set_pkt_type(PKT_TYPE_DATA_NO_TS);
+    header.set_dst_epid(SIM_EPID);
+    for (uint16_t seq_num = 0; seq_num < 4; seq_num++) {
+        // Skip a packet, to see a sequence error
+        header.set_seq_num(seq_num < 2 ? seq_num : seq_num + 1);
+        host.send_to(sim, chdr_packet(CHDR_W_64, header, std::vector<uint8_t>(64)));
+    }
+    strs = host.recv().get_payload<strs_payload>();
+    BOOST_CHECK_EQUAL(strs.xfer_count_pkts, 4);
+    BOOST_CHECK_EQUAL(strs.xfer_count_bytes, 4 * (8 + 64));
+
+    const auto stats = engine->get_input_stats(SIM_EPID);
+    BOOST_CHECK(stats.active);
+    BOOST_CHECK_EQUAL(stats.num_packets, 5);
+    BOOST_CHECK_EQUAL(stats.num_seq_errors, 1);
+    chdr_stream_engine::control_packet_t packet;
+    BOOST_CHECK(!engine->recv_control(packet, 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(test_chdr_stream_engine_output)
+{
+    test_socket sim, host;
+    auto engine = make_engine(sim);
+    if (!engine) {
+        BOOST_TEST_MESSAGE("chdr_stream_engine not supported, skipping test");
+        return;
+    }
+    constexpr size_t SPP      = 100;
+    constexpr size_t NUM_PKTS = 10;
+    chdr_stream_engine::output_args_t args;
+    args.src_epid         = SIM_EPID;
+    args.dst_epid         = HOST_EPID;
+    args.addr             = "127.0.0.1";
+    args.port             = host.get_port();
+    args.packet_samples   = SPP;
+    args.num_samples      = SPP * NUM_PKTS - SPP / 2;
+    args.has_timestamp    = true;
+    args.timestamp        = 1000;
+    args.capacity_packets = NUM_PKTS / 2;
+    args.capacity_bytes   = 1 << 20;
+    engine->begin_output(args);
+
+    for (size_t pkt_num = 0; pkt_num < NUM_PKTS; pkt_num++) {
+        const auto packet = host.recv();
+        const auto header = packet.get_header();
+        BOOST_CHECK_EQUAL(header.get_pkt_type(), PKT_TYPE_DATA_WITH_TS);
+        BOOST_CHECK_EQUAL(header.get_dst_epid(), HOST_EPID);
+        BOOST_CHECK_EQUAL(header.get_seq_num(), pkt_num);
+        BOOST_CHECK_EQUAL(header.get_eob(), pkt_num == NUM_PKTS - 1);
+        BOOST_CHECK_EQUAL(packet.get_timestamp().get(), 1000 + pkt_num * SPP);
+        BOOST_CHECK_EQUAL(packet.get_payload_bytes().size(),
+            (pkt_num == NUM_PKTS - 1 ? SPP / 2 : SPP) * 4);
+
+        // Only half the packets fit into the buffer, so return credit
+        if (pkt_num == NUM_PKTS / 2 - 1) {
+            BOOST_CHECK(engine->get_output_stats(SIM_EPID).active);
+            chdr_header strs_header;
+            strs_header.set_pkt_type(PKT_TYPE_STRS);
+            strs_header.set_dst_epid(SIM_EPID);
+            strs_payload strs;
+            strs.src_epid        = HOST_EPID;
+            strs.xfer_count_pkts = NUM_PKTS / 2;
+            host.send_to(sim, chdr_packet(CHDR_W_64, strs_header, strs));
+        }
+    }
+    // The stream ends by itself once all samples are sent
+    for (int i = 0; i < 100 && engine->get_output_stats(SIM_EPID).active; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    const auto stats = engine->get_output_stats(SIM_EPID);
+    BOOST_CHECK(!stats.active);
+    BOOST_CHECK_EQUAL(stats.num_packets, NUM_PKTS);
+    BOOST_CHECK(stats.num_fc_stalls > 0);
+    engine->end_output(SIM_EPID);
+}
+
+#endif
@@ -0,0 +1,93 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#ifndef INCLUDED_ALLOC_COUNTER_HPP
+#define INCLUDED_ALLOC_COUNTER_HPP
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/*!
+ * Counting replacements of the global operator new and delete
+ *
+ * This header replaces the global allocation functions of the whole test
+ * executable, so it must be included by exactly one of its source files. Use
+ * alloc_counter to count the allocations made by a piece of code, e.g., to
+ * check that a fast path never allocates:
+ *
+ *     alloc_counter counter;
+ *     streamer->recv(...);
+ *     BOOST_CHECK_EQUAL(counter.get(), 0);
+ *
+ * Allocations by all threads are counted.
+ */
+
+namespace uhd { namespace test { namespace detail {
+
+inline std::atomic<size_t>& num_allocs()
+{
+    static std::atomic<size_t> num_allocs{0};
+    return num_allocs;
+}
+
+}}} // namespace uhd::test::detail
+
+void* operator new(std::size_t size)
+{
+    uhd::test::detail::num_allocs().fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace uhd { namespace test {
+
+//! Counts the heap allocations made from its construction on
+class alloc_counter
+{
+public:
+    alloc_counter() : _start(detail::num_allocs().load()) {}
+
+    //! Return the number of allocations since this object was created
+    size_t get() const
+    {
+        return detail::num_allocs().load() - _start;
+    }
+
+private:
+    const size_t _start;
+};
+
+}} // namespace uhd::test
+
+#endif /* INCLUDED_ALLOC_COUNTER_HPP */
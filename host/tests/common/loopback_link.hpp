@@ -0,0 +1,206 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/utils/spsc_ring.hpp>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * A one-way, in-memory channel from a loopback_send_link to a
+ * loopback_recv_link.
+ *
+ * The channel owns a fixed set of frames. A frame moves from the free ring to
+ * the send link, is handed to the receive link through the full ring when it
+ * is sent, and goes back to the free ring when it is released. Packets are
+ * never copied, so the channel costs about as much as the frame buffer
+ * management of a real link, and nothing else.
+ *
+ * The links may be used from different threads, but each one only from one
+ * thread at a time.
+ */
+class loopback_channel
+{
+public:
+    using sptr = std::shared_ptr<loopback_channel>;
+
+    struct frame_t
+    {
+        uint8_t* mem = nullptr;
+        size_t len   = 0;
+    };
+
+    loopback_channel(const size_t num_frames, const size_t frame_size)
+        : _num_frames(num_frames)
+        , _frame_size(frame_size)
+        , _mem(num_frames * frame_size, 0)
+        , _free(num_frames, true)
+        , _full(num_frames, true)
+    {
+        for (size_t i = 0; i < num_frames; i++) {
+            _free.push({&_mem[i * frame_size], 0});
+        }
+    }
+
+    size_t get_num_frames() const
+    {
+        return _num_frames;
+    }
+
+    size_t get_frame_size() const
+    {
+        return _frame_size;
+    }
+
+    //! Frames which the send link may fill
+    spsc_ring<frame_t>& free_frames()
+    {
+        return _free;
+    }
+
+    //! Frames which were sent, but not yet received
+    spsc_ring<frame_t>& full_frames()
+    {
+        return _full;
+    }
+
+private:
+    const size_t _num_frames;
+    const size_t _frame_size;
+    std::vector<uint8_t> _mem;
+    spsc_ring<frame_t> _free;
+    spsc_ring<frame_t> _full;
+};
+
+/*!
+ * Frame buffer of the loopback links
+ */
+class loopback_frame_buff : public frame_buff
+{
+public:
+    void set_mem(uint8_t* mem)
+    {
+        _data = mem;
+    }
+
+    uint8_t* get_mem() const
+    {
+        return static_cast<uint8_t*>(_data);
+    }
+};
+
+/*!
+ * Link which sends packets into a loopback_channel
+ */
+class loopback_send_link : public send_link_base<loopback_send_link>
+{
+public:
+    using sptr   = std::shared_ptr<loopback_send_link>;
+    using base_t = send_link_base<loopback_send_link>;
+
+    loopback_send_link(loopback_channel::sptr channel)
+        : base_t(channel->get_num_frames(), channel->get_frame_size())
+        , _channel(channel)
+        , _buffs(channel->get_num_frames())
+    {
+        for (auto& buff : _buffs) {
+            base_t::preload_free_buff(&buff);
+        }
+    }
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return NULL_ADAPTER_ID;
+    }
+
+private:
+    // Friend declaration to allow base class to call private methods
+    friend base_t;
+
+    // Method called by send_link_base
+    bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+    {
+        auto& loopback_buff = static_cast<loopback_frame_buff&>(buff);
+        // A buffer which was released without being sent keeps its frame
+        if (loopback_buff.get_mem()) {
+            return true;
+        }
+        loopback_channel::frame_t frame;
+        if (!_channel->free_frames().pop(frame, timeout_ms)) {
+            return false;
+        }
+        loopback_buff.set_mem(frame.mem);
+        return true;
+    }
+
+    // Method called by send_link_base
+    void release_send_buff_derived(frame_buff& buff)
+    {
+        auto& loopback_buff = static_cast<loopback_frame_buff&>(buff);
+        _channel->full_frames().push({loopback_buff.get_mem(), buff.packet_size()});
+        loopback_buff.set_mem(nullptr);
+    }
+
+    loopback_channel::sptr _channel;
+    std::vector<loopback_frame_buff> _buffs;
+};
+
+/*!
+ * Link which receives the packets of a loopback_channel
+ */
+class loopback_recv_link : public recv_link_base<loopback_recv_link>
+{
+public:
+    using sptr   = std::shared_ptr<loopback_recv_link>;
+    using base_t = recv_link_base<loopback_recv_link>;
+
+    loopback_recv_link(loopback_channel::sptr channel)
+        : base_t(channel->get_num_frames(), channel->get_frame_size())
+        , _channel(channel)
+        , _buffs(channel->get_num_frames())
+    {
+        for (auto& buff : _buffs) {
+            base_t::preload_free_buff(&buff);
+        }
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return NULL_ADAPTER_ID;
+    }
+
+private:
+    // Friend declaration to allow base class to call private methods
+    friend base_t;
+
+    // Method called by recv_link_base
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+    {
+        loopback_channel::frame_t frame;
+        if (!_channel->full_frames().pop(frame, timeout_ms)) {
+            return 0; // timeout
+        }
+        static_cast<loopback_frame_buff&>(buff).set_mem(frame.mem);
+        return frame.len;
+    }
+
+    // Method called by recv_link_base
+    void release_recv_buff_derived(frame_buff& buff)
+    {
+        auto& loopback_buff = static_cast<loopback_frame_buff&>(buff);
+        _channel->free_frames().push({loopback_buff.get_mem(), 0});
+        loopback_buff.set_mem(nullptr);
+    }
+
+    loopback_channel::sptr _channel;
+    std::vector<loopback_frame_buff> _buffs;
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,84 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/rfnoc/ctrl_send_scheduler.hpp>
+#include <boost/test/unit_test.hpp>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace uhd::rfnoc::detail;
+using namespace std::chrono_literals;
+using priority_t = ctrl_send_scheduler::priority_t;
+
+namespace {
+
+void wait_for_waiters(
+    const ctrl_send_scheduler& scheduler, const priority_t priority, const size_t num)
+{
+    for (size_t i = 0; i < 1000 && scheduler.get_num_waiting(priority) != num; i++) {
+        std::this_thread::sleep_for(1ms);
+    }
+    BOOST_REQUIRE_EQUAL(scheduler.get_num_waiting(priority), num);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_urgent_senders_go_first)
+{
+    ctrl_send_scheduler scheduler;
+    std::mutex order_mutex;
+    std::vector<std::string> order;
+    auto record = [&](const std::string& name) {
+        return [&order_mutex, &order, name]() {
+            std::lock_guard<std::mutex> lock(order_mutex);
+            order.push_back(name);
+        };
+    };
+
+    // Hold the transport while the other senders queue up
+    std::promise<void> held, unblock;
+    std::thread holder([&]() {
+        scheduler.send(priority_t::BACKGROUND, [&]() {
+            held.set_value();
+            unblock.get_future().wait();
+        });
+    });
+    held.get_future().wait();
+
+    std::thread background([&]() {
+        scheduler.send(priority_t::BACKGROUND, record("background"));
+    });
+    wait_for_waiters(scheduler, priority_t::BACKGROUND, 1);
+    std::thread normal([&]() { scheduler.send(priority_t::NORMAL, record("normal")); });
+    wait_for_waiters(scheduler, priority_t::NORMAL, 1);
+    std::thread realtime([&]() {
+        scheduler.send(priority_t::REALTIME, record("realtime"));
+    });
+    wait_for_waiters(scheduler, priority_t::REALTIME, 1);
+
+    unblock.set_value();
+    holder.join();
+    background.join();
+    normal.join();
+    realtime.join();
+    BOOST_CHECK(order == std::vector<std::string>({"realtime", "normal", "background"}));
+}
+
+BOOST_AUTO_TEST_CASE(test_send_error)
+{
+    ctrl_send_scheduler scheduler;
+    BOOST_CHECK_THROW(scheduler.send(priority_t::NORMAL,
+                          []() { throw uhd::op_timeout("No send buffer"); }),
+        uhd::op_timeout);
+
+    // The transport must have been released
+    bool sent = false;
+    scheduler.send(priority_t::BACKGROUND, [&sent]() { sent = true; });
+    BOOST_CHECK(sent);
+}
@@ -0,0 +1,348 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/metrics.hpp>
+#include <uhdlib/rfnoc/command_batch.hpp>
+#include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+using namespace uhd::rfnoc;
+using namespace uhd::rfnoc::chdr;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr sep_id_t MY_EPID         = 0x0001;
+constexpr uint16_t PORT            = 2;
+constexpr size_t BUFF_CAPACITY     = 128;
+constexpr size_t MAX_ASYNC_MSGS    = 1;
+constexpr uint32_t FAILING_ADDRESS = 0xBAD0;
+
+/*! Mock ControlPort device
+ *
+ * Executes requests from a separate thread, with some latency, on its register
+ * memory.
+ */
+class mock_ctrlport_device
+{
+public:
+    mock_ctrlport_device()
+    {
+        client_clk.set_running(true);
+        timebase_clk.set_running(true);
+        endpoint = ctrlport_endpoint::make(
+            [this](const ctrl_payload& request,
+                double,
+                ctrlport_endpoint::priority_t priority) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _requests.push_back(request);
+                priorities.push_back(priority);
+                max_in_flight = std::max(max_in_flight, _requests.size());
+                _cond.notify_one();
+            },
+            MY_EPID,
+            PORT,
+            BUFF_CAPACITY,
+            MAX_ASYNC_MSGS,
+            client_clk,
+            timebase_clk);
+        _thread = std::thread([this]() { _respond(); });
+    }
+
+    ~mock_ctrlport_device()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+            _cond.notify_one();
+        }
+        _thread.join();
+    }
+
+    //! While paused, requests are queued up but not executed
+    void set_paused(const bool paused)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _paused = paused;
+        _cond.notify_one();
+    }
+
+    clock_iface client_clk{"client", 100e6};
+    clock_iface timebase_clk{"timebase", 100e6};
+    ctrlport_endpoint::sptr endpoint;
+
+    std::map<uint32_t, uint32_t> memory;
+    std::vector<uint32_t> write_order;
+    std::vector<ctrlport_endpoint::priority_t> priorities;
+    size_t max_in_flight = 0;
+
+private:
+    void _respond()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _cond.wait(
+                lock, [this]() { return _stop || (!_paused && !_requests.empty()); });
+            if (_stop) {
+                return;
+            }
+            ctrl_payload response = _requests.front();
+            _requests.pop_front();
+            lock.unlock();
+
+            // Take long enough that the sender can queue up more requests
+            std::this_thread::sleep_for(100us);
+            response.is_ack = true;
+            if (response.address == FAILING_ADDRESS) {
+                response.status = CMD_CMDERR;
+            } else if (response.op_code == OP_WRITE) {
+                memory[response.address] = response.data_vtr[0];
+                write_order.push_back(response.address);
+            } else if (response.op_code == OP_READ) {
+                response.data_vtr[0] = memory[response.address];
+            }
+            endpoint->handle_recv(response);
+
+            lock.lock();
+        }
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::deque<ctrl_payload> _requests;
+    bool _stop   = false;
+    bool _paused = false;
+    std::thread _thread;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_multi_poke32_acked)
+{
+    mock_ctrlport_device device;
+    constexpr size_t NUM_WRITES      = 100;
+    constexpr size_t MAX_OUTSTANDING = 8;
+    std::vector<uint32_t> addrs, data;
+    for (size_t i = 0; i < NUM_WRITES; i++) {
+        addrs.push_back(4 * i);
+        data.push_back(0x1000 + i);
+    }
+
+    device.endpoint->multi_poke32_acked(
+        addrs, data, uhd::time_spec_t::ASAP, MAX_OUTSTANDING);
+
+    // All writes must have completed, in order
+    BOOST_CHECK(device.write_order == addrs);
+    for (size_t i = 0; i < NUM_WRITES; i++) {
+        BOOST_CHECK_EQUAL(device.memory[addrs[i]], data[i]);
+    }
+    // The writes must have been pipelined, but never beyond the window
+    BOOST_CHECK_GT(device.max_in_flight, 1);
+    BOOST_CHECK_LE(device.max_in_flight, MAX_OUTSTANDING);
+}
+
+BOOST_AUTO_TEST_CASE(test_multi_poke32_acked_errors)
+{
+    mock_ctrlport_device device;
+
+    BOOST_CHECK_THROW(device.endpoint->multi_poke32_acked({0, 4}, {1}), uhd::value_error);
+    BOOST_CHECK_THROW(
+        device.endpoint->multi_poke32_acked({0}, {1}, uhd::time_spec_t::ASAP, 0),
+        uhd::value_error);
+
+    // A failing write in the middle of a batch must be reported, even though
+    // it was not the last one
+    BOOST_CHECK_THROW(device.endpoint->multi_poke32_acked(
+                          {0, 4, FAILING_ADDRESS, 8, 12}, {1, 2, 3, 4, 5}),
+        uhd::op_failed);
+
+    // The endpoint must still be usable afterwards
+    device.endpoint->poke32(16, 6, uhd::time_spec_t::ASAP, true);
+    BOOST_CHECK_EQUAL(device.memory[16], 6);
+}
+
+BOOST_AUTO_TEST_CASE(test_peek32_async)
+{
+    mock_ctrlport_device device;
+    constexpr size_t NUM_READS = 16;
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        device.memory[4 * i] = 0x2000 + i;
+    }
+
+    // All reads are sent before the first result is requested
+    std::vector<std::future<uint32_t>> values;
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        values.push_back(device.endpoint->peek32_async(4 * i));
+    }
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        BOOST_CHECK_EQUAL(values[i].get(), 0x2000 + i);
+    }
+    BOOST_CHECK_GT(device.max_in_flight, 1);
+
+    // block_peek32() uses the same mechanism
+    const auto block = device.endpoint->block_peek32(0, NUM_READS);
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        BOOST_CHECK_EQUAL(block[i], 0x2000 + i);
+    }
+
+    // Errors are reported when the value is requested, and abandoned reads
+    // must not affect later ones
+    auto failing = device.endpoint->peek32_async(FAILING_ADDRESS);
+    device.endpoint->peek32_async(0);
+    BOOST_CHECK_THROW(failing.get(), uhd::op_failed);
+    BOOST_CHECK_EQUAL(device.endpoint->peek32(4), 0x2001);
+}
+
+BOOST_AUTO_TEST_CASE(test_command_batch)
+{
+    mock_ctrlport_device device0;
+    mock_ctrlport_device device1;
+    constexpr size_t NUM_WRITES = 48;
+    std::vector<uint32_t> addrs;
+    for (uint32_t i = 0; i < NUM_WRITES; i++) {
+        addrs.push_back(4 * i);
+    }
+
+    // Acked writes within a batch go out back to back on every endpoint, and
+    // we only wait for them when the batch is closed
+    detail::begin_command_batch();
+    detail::begin_command_batch();
+    for (uint32_t i = 0; i < NUM_WRITES; i++) {
+        device0.endpoint->poke32(4 * i, i, uhd::time_spec_t::ASAP, true);
+        device1.endpoint->poke32(4 * i, i + 1, uhd::time_spec_t::ASAP, true);
+    }
+    detail::end_command_batch();
+    BOOST_CHECK(detail::command_batch_open());
+    detail::end_command_batch();
+    BOOST_CHECK(!detail::command_batch_open());
+
+    BOOST_CHECK(device0.write_order == addrs);
+    BOOST_CHECK(device1.write_order == addrs);
+    for (uint32_t i = 0; i < NUM_WRITES; i++) {
+        BOOST_CHECK_EQUAL(device0.memory[4 * i], i);
+        BOOST_CHECK_EQUAL(device1.memory[4 * i], i + 1);
+    }
+    BOOST_CHECK_GT(device0.max_in_flight, 1);
+    BOOST_CHECK_GT(device1.max_in_flight, 1);
+
+    // Failing writes are reported when the batch is closed
+    detail::begin_command_batch();
+    device0.endpoint->poke32(0, 1, uhd::time_spec_t::ASAP, true);
+    device0.endpoint->poke32(FAILING_ADDRESS, 2, uhd::time_spec_t::ASAP, true);
+    device0.endpoint->poke32(4, 3, uhd::time_spec_t::ASAP, true);
+    BOOST_CHECK_THROW(detail::end_command_batch(), uhd::op_failed);
+    BOOST_CHECK(!detail::command_batch_open());
+    BOOST_CHECK_THROW(detail::end_command_batch(), uhd::runtime_error);
+
+    // The endpoint must still be usable afterwards
+    device0.endpoint->poke32(8, 4, uhd::time_spec_t::ASAP, true);
+    BOOST_CHECK_EQUAL(device0.memory[8], 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_cmd_fifo_tracking)
+{
+    mock_ctrlport_device device;
+    // Each untimed write takes 3 words, timed ones take 5, and one async
+    // message response of 6 words is always kept free
+    constexpr size_t NUM_SLOTS       = (BUFF_CAPACITY - 6 * MAX_ASYNC_MSGS) / 3;
+    constexpr size_t NUM_TIMED_SLOTS = (BUFF_CAPACITY - 6 * MAX_ASYNC_MSGS) / 5;
+    BOOST_CHECK_EQUAL(device.endpoint->get_cmd_fifo_free_slots(), NUM_SLOTS);
+    BOOST_CHECK_EQUAL(device.endpoint->get_cmd_fifo_free_slots(true), NUM_TIMED_SLOTS);
+
+    // Fill up the FIFO without blocking
+    device.set_paused(true);
+    for (uint32_t i = 0; i < NUM_SLOTS; i++) {
+        BOOST_CHECK_EQUAL(device.endpoint->get_cmd_fifo_free_slots(), NUM_SLOTS - i);
+        BOOST_CHECK(device.endpoint->try_poke32(4 * i, i));
+    }
+    BOOST_CHECK_EQUAL(device.endpoint->get_cmd_fifo_free_slots(), 0);
+    BOOST_CHECK(!device.endpoint->try_poke32(0x100, 1));
+    BOOST_CHECK(!device.endpoint->try_poke32(0x100, 1, uhd::time_spec_t(1.0)));
+
+    // Responses free up the FIFO again. The read is executed after all the
+    // writes, so they have all been responded to when it returns.
+    device.set_paused(false);
+    BOOST_CHECK_EQUAL(device.endpoint->peek32(4), 1);
+    BOOST_CHECK_EQUAL(device.endpoint->get_cmd_fifo_free_slots(), NUM_SLOTS);
+    BOOST_CHECK_EQUAL(device.write_order.size(), NUM_SLOTS);
+    BOOST_CHECK(device.endpoint->try_poke32(0x100, 2, uhd::time_spec_t::ASAP, true));
+    BOOST_CHECK_EQUAL(device.memory[0x100], 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_ctrl_latency_histogram)
+{
+    mock_ctrlport_device device;
+    auto count_acks = []() {
+        const auto snapshot = uhd::metrics::get_ctrl_latency_histogram()->get_snapshot();
+        return std::accumulate(snapshot.counts.begin(), snapshot.counts.end(), 0ull);
+    };
+    const auto num_acks = count_acks();
+
+    // Only requests which wait for an ACK are timed
+    device.endpoint->poke32(0, 1);
+    device.endpoint->poke32(4, 2, uhd::time_spec_t::ASAP, true);
+    BOOST_CHECK_EQUAL(device.endpoint->peek32(4), 2);
+    BOOST_CHECK_EQUAL(count_acks() - num_acks, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_transaction_stats)
+{
+    mock_ctrlport_device device;
+    auto count = [](const uhd::metrics::histogram::snapshot_t& snapshot) {
+        return std::accumulate(snapshot.counts.begin(), snapshot.counts.end(), 0ull);
+    };
+    BOOST_CHECK(device.endpoint->get_transaction_stats().empty());
+
+    device.endpoint->poke32(0, 1, uhd::time_spec_t::ASAP, true);
+    device.endpoint->poke32(4, 2, uhd::time_spec_t::ASAP, true);
+    BOOST_CHECK_EQUAL(device.endpoint->peek32(4), 2);
+    auto stats = device.endpoint->get_transaction_stats();
+    BOOST_REQUIRE_EQUAL(stats.size(), 2);
+    BOOST_CHECK_EQUAL(count(stats.at("write").round_trip), 2);
+    BOOST_CHECK_EQUAL(count(stats.at("write").ack_wait), 2);
+    BOOST_CHECK_EQUAL(count(stats.at("read").round_trip), 1);
+    // The mock device takes 100 us to respond
+    BOOST_CHECK_GE(stats.at("read").round_trip.sum, 100e-6);
+    BOOST_CHECK_GE(stats.at("read").ack_wait.sum, stats.at("read").round_trip.sum);
+    BOOST_CHECK_EQUAL(stats.at("write").timeouts, 0);
+
+    device.endpoint->set_policy("default", uhd::device_addr_t("timeout=0.01"));
+    device.set_paused(true);
+    BOOST_CHECK_THROW(
+        device.endpoint->poke32(8, 3, uhd::time_spec_t::ASAP, true), uhd::op_timeout);
+    stats = device.endpoint->get_transaction_stats();
+    BOOST_CHECK_EQUAL(stats.at("write").timeouts, 1);
+    BOOST_CHECK_EQUAL(count(stats.at("write").ack_wait), 2);
+    device.set_paused(false);
+}
+
+BOOST_AUTO_TEST_CASE(test_priority_policy)
+{
+    using priority_t = ctrlport_endpoint::priority_t;
+    mock_ctrlport_device device;
+
+    device.endpoint->poke32(0, 1, uhd::time_spec_t::ASAP, true);
+    device.endpoint->set_policy("default", uhd::device_addr_t("priority=background"));
+    device.endpoint->poke32(0, 2, uhd::time_spec_t::ASAP, true);
+    // Timed commands are always urgent
+    device.endpoint->poke32(0, 3, uhd::time_spec_t(1.0), true);
+    BOOST_CHECK(device.priorities
+                == std::vector<priority_t>(
+                    {priority_t::NORMAL, priority_t::BACKGROUND, priority_t::REALTIME}));
+
+    BOOST_CHECK_THROW(
+        device.endpoint->set_policy("default", uhd::device_addr_t("priority=urgent")),
+        uhd::value_error);
+}
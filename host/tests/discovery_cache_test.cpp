@@ -0,0 +1,101 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/discovery_cache.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <fstream>
+
+using namespace uhd;
+namespace fs = boost::filesystem;
+
+namespace {
+
+struct temp_cache_file
+{
+    temp_cache_file()
+        : dir(fs::temp_directory_path() / fs::unique_path("uhd-discovery-%%%%-%%%%"))
+        , path((dir / "subdir" / "cache.txt").string())
+    {
+    }
+
+    ~temp_cache_file()
+    {
+        fs::remove_all(dir);
+    }
+
+    const fs::path dir;
+    const std::string path;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_make_key)
+{
+    // Argument order does not matter, but values and the filter do
+    BOOST_CHECK_EQUAL(discovery_cache::make_key(device_addr_t("addr=1.2.3.4,type=x"), 0),
+        discovery_cache::make_key(device_addr_t("type=x,addr=1.2.3.4"), 0));
+    BOOST_CHECK_NE(discovery_cache::make_key(device_addr_t("addr=1.2.3.4"), 0),
+        discovery_cache::make_key(device_addr_t("addr=1.2.3.5"), 0));
+    BOOST_CHECK_NE(discovery_cache::make_key(device_addr_t(""), 0),
+        discovery_cache::make_key(device_addr_t(""), 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_store_lookup)
+{
+    temp_cache_file cache_file;
+    const std::string key      = discovery_cache::make_key(device_addr_t(""), 0);
+    const std::string addr_key = discovery_cache::make_key(device_addr_t("addr=x"), 0);
+
+    {
+        discovery_cache cache(cache_file.path);
+        BOOST_CHECK(!cache.lookup(key));
+        cache.store(key,
+            {{2, device_addr_t("type=n3xx,addr=192.168.10.2,serial=1234")},
+                {0, device_addr_t("type=b200,serial=ABCD")}});
+        cache.store(addr_key, {{1, device_addr_t("addr=x")}});
+    }
+
+    // The entries must survive in the file
+    discovery_cache cache(cache_file.path);
+    const auto entries = cache.lookup(key);
+    BOOST_REQUIRE(entries);
+    BOOST_REQUIRE_EQUAL(entries->size(), 2);
+    BOOST_CHECK_EQUAL(entries->at(0).finder_idx, 2);
+    BOOST_CHECK_EQUAL(entries->at(0).dev_addr["addr"], "192.168.10.2");
+    BOOST_CHECK_EQUAL(entries->at(0).dev_addr["serial"], "1234");
+    BOOST_CHECK_EQUAL(entries->at(1).finder_idx, 0);
+    BOOST_CHECK_EQUAL(entries->at(1).dev_addr["type"], "b200");
+
+    // Storing replaces, erasing only affects one key
+    cache.store(key, {{3, device_addr_t("serial=5678")}});
+    BOOST_REQUIRE_EQUAL(cache.lookup(key)->size(), 1);
+    BOOST_CHECK_EQUAL(cache.lookup(key)->at(0).finder_idx, 3);
+    cache.erase(key);
+    BOOST_CHECK(!cache.lookup(key));
+    BOOST_CHECK(cache.lookup(addr_key));
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_cache)
+{
+    temp_cache_file cache_file;
+    const std::string key = discovery_cache::make_key(device_addr_t(""), 0);
+    discovery_cache cache(cache_file.path);
+    cache.store(key, {{0, device_addr_t("serial=1234")}});
+
+    // A cache written by another UHD version is ignored
+    {
+        std::ofstream file(cache_file.path, std::ios::trunc);
+        file << "# UHD discovery cache, version 0.0.0\n"
+             << key << "\t0\tserial=1234\n";
+    }
+    BOOST_CHECK(!cache.lookup(key));
+
+    // A cache which can't be written is treated like an empty one
+    discovery_cache broken_cache((cache_file.dir / "subdir").string());
+    broken_cache.store(key, {{0, device_addr_t("serial=1234")}});
+    BOOST_CHECK(!broken_cache.lookup(key));
+}
@@ -49,6 +49,17 @@ UHD_INLINE uhd_error throw_unknown_exception(dummy_handle_t* handle)
     UHD_SAFE_C_SAVE_ERROR(handle, throw 1;)
 }
 
+UHD_INLINE uhd_error succeed_on_except(dummy_handle_t* handle)
+{
+    UHD_SAFE_C_SAVE_ERROR_ON_EXCEPT(handle, (void)handle;)
+}
+
+UHD_INLINE uhd_error throw_std_exception_on_except(dummy_handle_t* handle)
+{
+    UHD_SAFE_C_SAVE_ERROR_ON_EXCEPT(
+        handle, throw std::runtime_error("This is a std::runtime_error.");)
+}
+
 // There are enough non-standard names that we can't just use a conversion function
 static const uhd::dict<std::string, std::string> pretty_exception_names =
     boost::assign::map_list_of("assertion_error", "AssertionError")(
@@ -129,3 +140,16 @@ BOOST_AUTO_TEST_CASE(test_unknown_exception)
     BOOST_CHECK_EQUAL(error_code, UHD_ERROR_UNKNOWN);
     BOOST_CHECK_EQUAL(handle.last_error, "Unrecognized exception caught.");
 }
+
+BOOST_AUTO_TEST_CASE(test_save_error_on_except)
+{
+    dummy_handle_t handle;
+    BOOST_CHECK_EQUAL(throw_std_exception_on_except(&handle), UHD_ERROR_STDEXCEPT);
+    BOOST_CHECK_EQUAL(handle.last_error, "This is a std::runtime_error.");
+    BOOST_CHECK_EQUAL(get_c_global_error_string(), "This is a std::runtime_error.");
+
+    // Success leaves the error of the last failed call in place
+    BOOST_CHECK_EQUAL(succeed_on_except(&handle), UHD_ERROR_NONE);
+    BOOST_CHECK_EQUAL(handle.last_error, "This is a std::runtime_error.");
+    BOOST_CHECK_EQUAL(get_c_global_error_string(), "This is a std::runtime_error.");
+}
@@ -10,7 +10,9 @@
 #include <uhd/property_tree.hpp>
 #include <boost/format.hpp>
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <fstream>
+#include <map>
 #include <memory>
 
 using namespace uhd::experts;
@@ -268,3 +270,117 @@ BOOST_AUTO_TEST_CASE(test_experts)
     container->resolve_to("Consume_G");
     VALIDATE_ALL_DEPENDENCIES
 }
+
+BOOST_AUTO_TEST_CASE(test_experts_incremental_resolve)
+{
+    expert_container::sptr container = expert_factory::create_container("example");
+    std::shared_ptr<int> final_output = std::make_shared<int>();
+
+    expert_factory::add_data_node<int>(container, "A/desired", 1);
+    expert_factory::add_data_node<int>(container, "B", 0);
+    expert_factory::add_data_node<int>(container, "C", 0);
+    expert_factory::add_data_node<int>(container, "D", 1);
+    expert_factory::add_data_node<int>(container, "E", 0);
+    expert_factory::add_data_node<int>(container, "F", 0);
+    expert_factory::add_data_node<int>(container, "G", 0);
+    expert_factory::add_worker_node<worker1_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker2_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker3_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker4_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker5_t>(
+        container, container->node_retriever(), final_output);
+    expert_factory::add_worker_node<worker6_t>(container);
+
+    auto num_resolves = [container]() {
+        std::map<std::string, size_t> result;
+        for (const auto& stats : container->get_worker_stats()) {
+            BOOST_CHECK_LE(stats.max_time, stats.total_time);
+            result[stats.name] = stats.num_resolves;
+        }
+        return result;
+    };
+
+    // Initially, all data nodes are dirty, so every worker with inputs runs
+    container->resolve_all();
+    auto resolves = num_resolves();
+    BOOST_REQUIRE_EQUAL(resolves.size(), 6);
+    BOOST_CHECK_EQUAL(resolves["A+B=C"], 1);
+    BOOST_CHECK_EQUAL(resolves["C*D=E"], 1);
+    BOOST_CHECK_EQUAL(resolves["-B=F"], 1);
+    BOOST_CHECK_EQUAL(resolves["E-F=G"], 1);
+    BOOST_CHECK_EQUAL(resolves["Consume_G"], 1);
+    BOOST_CHECK_EQUAL(resolves["null_worker"], 0);
+
+    // Nothing changed, so nothing runs
+    container->resolve_all();
+    BOOST_CHECK(num_resolves() == resolves);
+
+    // Changing D only runs the workers which depend on it
+    data_node_t<int>& nodeD = *(const_cast<data_node_t<int>*>(
+        dynamic_cast<const data_node_t<int>*>(&container->node_retriever().lookup("D"))));
+    nodeD.set(2);
+    container->resolve_from("D");
+    resolves = num_resolves();
+    BOOST_CHECK_EQUAL(resolves["A+B=C"], 1);
+    BOOST_CHECK_EQUAL(resolves["C*D=E"], 2);
+    BOOST_CHECK_EQUAL(resolves["-B=F"], 1);
+    BOOST_CHECK_EQUAL(resolves["E-F=G"], 2);
+    BOOST_CHECK_EQUAL(resolves["Consume_G"], 2);
+    BOOST_CHECK_EQUAL(*final_output, (1 + 0) * 2 - 0);
+
+    // A forced resolve runs every worker
+    container->resolve_all(true);
+    resolves = num_resolves();
+    BOOST_CHECK_EQUAL(resolves["A+B=C"], 2);
+    BOOST_CHECK_EQUAL(resolves["-B=F"], 2);
+    BOOST_CHECK_EQUAL(resolves["null_worker"], 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_experts_parallel_resolve)
+{
+    expert_container::sptr container = expert_factory::create_container("example");
+    std::shared_ptr<int> final_output = std::make_shared<int>();
+
+    expert_factory::add_data_node<int>(container, "A/desired", 1);
+    expert_factory::add_data_node<int>(container, "B", 2);
+    expert_factory::add_data_node<int>(container, "C", 0);
+    expert_factory::add_data_node<int>(container, "D", 3);
+    expert_factory::add_data_node<int>(container, "E", 0);
+    expert_factory::add_data_node<int>(container, "F", 0);
+    expert_factory::add_data_node<int>(container, "G", 0);
+    expert_factory::add_worker_node<worker1_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker2_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker3_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker4_t>(container, container->node_retriever());
+    expert_factory::add_worker_node<worker5_t>(
+        container, container->node_retriever(), final_output);
+
+    std::atomic<size_t> num_begins{0}, num_ends{0};
+    container->set_parallel_resolve(
+        2, [&]() { num_begins++; }, [&]() { num_ends++; });
+
+    // A+B=C and -B=F only depend on data nodes, so they are resolved together
+    // (two groups), followed by C*D=E, E-F=G and Consume_G (one group each)
+    container->resolve_all();
+    BOOST_CHECK_EQUAL(*final_output, (1 + 2) * 3 + 2);
+    BOOST_CHECK_EQUAL(num_begins, 5);
+    BOOST_CHECK_EQUAL(num_ends, 5);
+
+    // Only the workers which depend on a changed node are resolved
+    data_node_t<int>& nodeD = *(const_cast<data_node_t<int>*>(
+        dynamic_cast<const data_node_t<int>*>(&container->node_retriever().lookup("D"))));
+    nodeD.set(4);
+    container->resolve_from("D");
+    BOOST_CHECK_EQUAL(*final_output, (1 + 2) * 4 + 2);
+    BOOST_CHECK_EQUAL(num_begins, 8);
+    for (const auto& stats : container->get_worker_stats()) {
+        BOOST_CHECK_EQUAL(
+            stats.num_resolves, stats.name == "A+B=C" || stats.name == "-B=F" ? 1 : 2);
+    }
+
+    // Back to resolving one worker after the other, without the hooks
+    container->set_parallel_resolve(0);
+    container->resolve_all(true);
+    BOOST_CHECK_EQUAL(*final_output, (1 + 2) * 4 + 2);
+    BOOST_CHECK_EQUAL(num_begins, 8);
+}
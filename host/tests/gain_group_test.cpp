@@ -119,3 +119,26 @@ BOOST_AUTO_TEST_CASE(test_gain_group_priority)
     // test the the higher priority gain got filled first (gain 2)
     BOOST_CHECK_CLOSE(g2.get_value(), g2.get_range().stop(), tolerance);
 }
+
+BOOST_AUTO_TEST_CASE(test_gain_group_range_change)
+{
+    gain_group::sptr gg = get_gain_group();
+    gain_range_t g3_range(0, 10, 1);
+    double g3_gain = 0;
+
+    gain_fcns_t gain_fcns;
+    gain_fcns.get_range = [&g3_range]() { return g3_range; };
+    gain_fcns.get_value = [&g3_gain]() { return g3_gain; };
+    gain_fcns.set_value = [&g3_gain](const double gain) { g3_gain = gain; };
+    gg->register_fcns("g3", gain_fcns, 1);
+
+    gg->set_value(5);
+    BOOST_CHECK_CLOSE(g3_gain, 5.0, tolerance);
+    BOOST_CHECK_CLOSE(gg->get_value(), 5.0, tolerance);
+
+    // the same overall gain must be distributed again after a range change
+    g3_range = gain_range_t(0, 2, 1);
+    gg->set_value(5);
+    BOOST_CHECK_CLOSE(g3_gain, 2.0, tolerance);
+    BOOST_CHECK_CLOSE(gg->get_value(), 5.0, tolerance);
+}
@@ -0,0 +1,67 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/usrp/gps_ctrl.hpp>
+#include <boost/format.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace uhd;
+
+namespace {
+
+//! Emulates a generic NMEA GPS, which sends a GPGGA sentence every 100 ms
+class mock_nmea_uart : public uart_iface
+{
+public:
+    void write_uart(const std::string&) override {}
+
+    std::string read_uart(double timeout) override
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (sending && now - _last_sentence > std::chrono::milliseconds(100)) {
+            _last_sentence = now;
+            return make_nmea("GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,,")
+                   + "\r\n";
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(int64_t(timeout * 1e6)));
+        return "";
+    }
+
+    static std::string make_nmea(const std::string& payload)
+    {
+        uint8_t checksum = 0;
+        for (const char ch : payload) {
+            checksum ^= ch;
+        }
+        return str(boost::format("$%s*%02X") % payload % int(checksum));
+    }
+
+    std::atomic<bool> sending{true};
+
+private:
+    std::chrono::steady_clock::time_point _last_sentence;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_gps_ctrl_cached_sensors)
+{
+    auto uart = std::make_shared<mock_nmea_uart>();
+    auto gps  = gps_ctrl::make(uart);
+    BOOST_REQUIRE(gps->gps_detected());
+
+    BOOST_CHECK(gps->get_sensor("gps_locked").to_bool());
+    BOOST_CHECK_LT(gps->get_sensor("gps_age").to_real(), 0.5);
+
+    // The cached sentences age once the GPS stops sending
+    uart->sending = false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    BOOST_CHECK_GE(gps->get_sensor("gps_age").to_real(), 0.3);
+    BOOST_CHECK(gps->get_sensor("gps_locked").to_bool());
+}
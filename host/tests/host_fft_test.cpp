@@ -0,0 +1,146 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_fft.hpp>
+#include <uhd/utils/math.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+std::vector<fc32_t> make_frames(const size_t length, const size_t num_frames)
+{
+    std::vector<fc32_t> samps(length * num_frames);
+    for (size_t i = 0; i < samps.size(); i++) {
+        samps[i] = fc32_t(std::cos(0.3f * i) + 0.1f * (i % 7), std::sin(0.7f * i));
+    }
+    return samps;
+}
+
+//! The unscaled DFT of one frame, in natural order
+std::vector<fc32_t> dft(const fc32_t* x, const size_t length, const double sign)
+{
+    std::vector<fc32_t> result(length);
+    for (size_t k = 0; k < length; k++) {
+        std::complex<double> sum = 0.0;
+        for (size_t n = 0; n < length; n++) {
+            sum += std::complex<double>(x[n])
+                   * std::polar(1.0, sign * 2 * uhd::math::PI * double(k * n) / length);
+        }
+        result[k] = fc32_t(sum);
+    }
+    return result;
+}
+
+void check_close(const fc32_t& actual, const fc32_t& expected)
+{
+    BOOST_CHECK_SMALL(std::abs(actual - expected), 1e-3f * (1 + std::abs(expected)));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_host_fft_matches_dft)
+{
+    for (const size_t length : {2, 4, 8, 64, 512, 2048}) {
+        auto fft = host_fft::make(length);
+        fft->set_shift_config(fft_shift::NATURAL);
+        fft->set_scaling(0);
+        const auto input = make_frames(length, 2);
+        std::vector<fc32_t> output(input.size());
+        fft->process(input.data(), output.data(), 2);
+
+        for (size_t frame = 0; frame < 2; frame++) {
+            const auto expected = dft(input.data() + frame * length, length, -1.0);
+            for (size_t k = 0; k < length; k++) {
+                check_close(output[frame * length + k], expected[k]);
+            }
+        }
+
+        // In place
+        auto in_place = input;
+        fft->process(in_place.data(), in_place.data(), 2);
+        for (size_t i = 0; i < input.size(); i++) {
+            check_close(in_place[i], output[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_fft_settings)
+{
+    constexpr size_t LENGTH = 16;
+    auto fft                = host_fft::make(20);
+    // Like the FFT block, the length is coerced to a power of two
+    BOOST_CHECK_EQUAL(fft->get_length(), LENGTH);
+    BOOST_CHECK_THROW(fft->set_length(1), uhd::value_error);
+    BOOST_CHECK_THROW(fft->set_scaling(1 << 12), uhd::value_error);
+    BOOST_CHECK(fft->get_direction() == fft_direction::FORWARD);
+    BOOST_CHECK(fft->get_shift_config() == fft_shift::NORMAL);
+    BOOST_CHECK_EQUAL(fft->get_scaling(), host_fft::DEFAULT_SCALING);
+
+    const auto input = make_frames(LENGTH, 1);
+    auto expected    = dft(input.data(), LENGTH, -1.0);
+    std::vector<fc32_t> output(LENGTH);
+
+    // The default scaling is 1/N, and NORMAL puts the negative frequencies
+    // first
+    fft->process(input.data(), output.data(), 1);
+    for (size_t k = 0; k < LENGTH; k++) {
+        check_close(output[k], expected[(k + LENGTH / 2) % LENGTH] / float(LENGTH));
+    }
+
+    // REVERSE reverses the order of NORMAL
+    fft->set_shift_config(fft_shift::REVERSE);
+    fft->process(input.data(), output.data(), 1);
+    for (size_t k = 0; k < LENGTH; k++) {
+        check_close(output[LENGTH - 1 - k],
+            expected[(k + LENGTH / 2) % LENGTH] / float(LENGTH));
+    }
+
+    // Two stages of the schedule, each scaled by 1/2
+    fft->set_shift_config(fft_shift::NATURAL);
+    fft->set_scaling(0x5);
+    fft->set_magnitude(fft_magnitude::MAGNITUDE_SQUARED);
+    fft->process(input.data(), output.data(), 1);
+    for (size_t k = 0; k < LENGTH; k++) {
+        check_close(output[k], fc32_t(std::norm(expected[k] / 4.0f), 0));
+    }
+    fft->set_magnitude(fft_magnitude::MAGNITUDE);
+    fft->process(input.data(), output.data(), 1);
+    for (size_t k = 0; k < LENGTH; k++) {
+        check_close(output[k], fc32_t(std::abs(expected[k] / 4.0f), 0));
+    }
+
+    fft->set_magnitude(fft_magnitude::COMPLEX);
+    fft->set_direction(fft_direction::REVERSE);
+    expected = dft(input.data(), LENGTH, 1.0);
+    fft->process(input.data(), output.data(), 1);
+    for (size_t k = 0; k < LENGTH; k++) {
+        check_close(output[k], expected[k] / 4.0f);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_fft_threads)
+{
+    constexpr size_t LENGTH     = 256;
+    constexpr size_t NUM_FRAMES = 17;
+    auto fft                    = host_fft::make(LENGTH);
+    auto threaded_fft           = host_fft::make(LENGTH, 3);
+
+    auto input = make_frames(LENGTH, NUM_FRAMES);
+    std::vector<fc32_t> expected(input.size());
+    fft->process(input.data(), expected.data(), NUM_FRAMES);
+    threaded_fft->process(input.data(), input.data(), NUM_FRAMES);
+    for (size_t i = 0; i < input.size(); i++) {
+        BOOST_CHECK_EQUAL(input[i], expected[i]);
+    }
+}
@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_moving_average.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+std::vector<fc32_t> make_samps(const size_t num_samps)
+{
+    std::vector<fc32_t> samps(num_samps);
+    for (size_t i = 0; i < samps.size(); i++) {
+        samps[i] = fc32_t(std::cos(0.3f * i) + 0.1f * (i % 7), std::sin(0.7f * i));
+    }
+    return samps;
+}
+
+//! The sum of the last sum_len samples, divided by divisor
+std::vector<fc32_t> reference_average(
+    const std::vector<fc32_t>& x, const size_t sum_len, const double divisor)
+{
+    std::vector<fc32_t> y(x.size());
+    for (size_t n = 0; n < x.size(); n++) {
+        std::complex<double> sum = 0.0;
+        for (size_t k = 0; k < sum_len && k <= n; k++) {
+            sum += std::complex<double>(x[n - k]);
+        }
+        y[n] = fc32_t(sum / divisor);
+    }
+    return y;
+}
+
+void check_close(const fc32_t& actual, const fc32_t& expected)
+{
+    BOOST_CHECK_SMALL(std::abs(actual - expected), 1e-4f * (1 + std::abs(expected)));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_host_moving_average_matches_reference)
+{
+    for (const uint8_t sum_len : {1, 2, 10, 64, 255}) {
+        auto average   = host_moving_average::make(sum_len, sum_len);
+        const auto x   = make_samps(2000);
+        const auto ref = reference_average(x, sum_len, sum_len);
+        std::vector<fc32_t> y(x.size());
+        // Calls of all sizes, some of which span several chunks
+        size_t done = 0;
+        for (size_t n = 1; done < x.size(); n = 2 * n + 1) {
+            n = std::min(n, x.size() - done);
+            average->process(x.data() + done, y.data() + done, n);
+            done += n;
+        }
+        for (size_t i = 0; i < x.size(); i++) {
+            check_close(y[i], ref[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_moving_average_in_place)
+{
+    auto average = host_moving_average::make();
+    BOOST_CHECK_EQUAL(average->get_sum_len(), 10);
+    BOOST_CHECK_EQUAL(average->get_divisor(), 10);
+    auto samps     = make_samps(1000);
+    const auto ref = reference_average(samps, 10, 10);
+    average->process(samps.data(), samps.data(), samps.size());
+    for (size_t i = 0; i < samps.size(); i++) {
+        check_close(samps[i], ref[i]);
+    }
+
+    // A new sum length clears the history
+    average->set_sum_len(20);
+    average->set_divisor(1);
+    BOOST_CHECK_EQUAL(average->get_sum_len(), 20);
+    samps              = make_samps(100);
+    const auto ref_sum = reference_average(samps, 20, 1);
+    average->process(samps.data(), samps.data(), samps.size());
+    for (size_t i = 0; i < samps.size(); i++) {
+        check_close(samps[i], ref_sum[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_moving_average_settings)
+{
+    auto average = host_moving_average::make();
+    BOOST_CHECK_THROW(average->set_sum_len(0), uhd::value_error);
+    BOOST_CHECK_THROW(average->set_divisor(0), uhd::value_error);
+    BOOST_CHECK_THROW(
+        average->set_divisor(host_moving_average::MAX_DIVISOR + 1), uhd::value_error);
+
+    // A constant input converges to sum_len * constant / divisor
+    average->set_sum_len(4);
+    average->set_divisor(2);
+    const std::vector<fc32_t> x(16, fc32_t(1.0f, -1.0f));
+    std::vector<fc32_t> y(x.size());
+    average->process(x.data(), y.data(), x.size());
+    check_close(y[0], fc32_t(0.5f, -0.5f));
+    check_close(y[15], fc32_t(2.0f, -2.0f));
+
+    average->reset();
+    average->process(x.data(), y.data(), 1);
+    check_close(y[0], fc32_t(0.5f, -0.5f));
+}
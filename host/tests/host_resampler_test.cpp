@@ -0,0 +1,127 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_resampler.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+//! A tone at \p freq cycles per sample
+std::vector<fc32_t> make_tone(const size_t num_samps, const double freq)
+{
+    std::vector<fc32_t> samps(num_samps);
+    for (size_t i = 0; i < samps.size(); i++) {
+        samps[i] = fc32_t(std::polar(1.0, 2 * M_PI * freq * i));
+    }
+    return samps;
+}
+
+//! Resample a whole stream, in calls of \p num_per_call samples
+std::vector<fc32_t> resample(host_resampler& resampler,
+    const std::vector<fc32_t>& input,
+    const size_t num_per_call)
+{
+    std::vector<fc32_t> output(resampler.get_max_num_outputs(input.size()));
+    size_t num_out = 0;
+    for (size_t done = 0; done < input.size(); done += num_per_call) {
+        const size_t n = std::min(num_per_call, input.size() - done);
+        num_out += resampler.process(input.data() + done, n, output.data() + num_out);
+    }
+    num_out += resampler.flush(output.data() + num_out);
+    output.resize(num_out);
+    return output;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_host_resampler_num_outputs)
+{
+    const std::vector<std::pair<size_t, size_t>> ratios{
+        {1, 1}, {2, 1}, {1, 2}, {3, 2}, {2, 3}, {125, 96}, {96, 125}, {1, 17}};
+    for (const auto& ratio : ratios) {
+        auto resampler = host_resampler::make(ratio.first, ratio.second);
+        for (const size_t num_samps : {1, 100, 1000, 4321}) {
+            const auto output =
+                resample(*resampler, make_tone(num_samps, 0.01), num_samps);
+            const size_t expected =
+                (num_samps * ratio.first + ratio.second - 1) / ratio.second;
+            BOOST_CHECK_EQUAL(output.size(), expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_resampler_calls_match)
+{
+    // Splitting the stream into calls of any size gives the same outputs, and
+    // so does a second stream after flush()
+    auto resampler   = host_resampler::make(5, 3);
+    const auto input = make_tone(3000, 0.02);
+    const auto ref   = resample(*resampler, input, input.size());
+    for (const size_t num_per_call : {1, 7, 255, 256, 1000}) {
+        const auto output = resample(*resampler, input, num_per_call);
+        BOOST_REQUIRE_EQUAL(output.size(), ref.size());
+        for (size_t i = 0; i < ref.size(); i++) {
+            BOOST_CHECK_EQUAL(output[i], ref[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_resampler_tone)
+{
+    // A tone in the passband keeps its amplitude and its phase at the time of
+    // every output, i.e., the filter does not delay the samples
+    const std::vector<std::pair<size_t, size_t>> ratios{
+        {1, 1}, {4, 1}, {1, 4}, {5, 4}, {4, 5}, {160, 147}};
+    for (const auto& ratio : ratios) {
+        const size_t interp = ratio.first, decim = ratio.second;
+        const double freq   = 0.05 * std::min(1.0, double(interp) / decim);
+        auto resampler      = host_resampler::make(interp, decim);
+        const auto output   = resample(*resampler, make_tone(20000, freq), 1000);
+        // Skip the outputs next to the ends of the stream, which see zeros
+        const size_t margin = 100 * interp / decim + 100;
+        for (size_t k = margin; k + margin < output.size(); k++) {
+            const double t       = double(k) * decim / interp;
+            const fc32_t expected = fc32_t(std::polar(1.0, 2 * M_PI * freq * t));
+            BOOST_CHECK_SMALL(std::abs(output[k] - expected), 2e-3f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_resampler_alias)
+{
+    // A tone above the Nyquist frequency of the output is filtered out
+    for (const size_t decim : {2, 3, 8}) {
+        auto resampler    = host_resampler::make(1, decim);
+        const auto output = resample(*resampler, make_tone(20000, 0.7 / decim), 1000);
+        for (size_t k = 100; k + 100 < output.size(); k++) {
+            BOOST_CHECK_SMALL(std::abs(output[k]), 1e-3f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_resampler_settings)
+{
+    auto resampler = host_resampler::make(640, 480, 30);
+    BOOST_CHECK_EQUAL(resampler->get_interp(), 4);
+    BOOST_CHECK_EQUAL(resampler->get_decim(), 3);
+    BOOST_CHECK_EQUAL(resampler->get_taps_per_phase(), 32);
+
+    BOOST_CHECK_THROW(host_resampler::make(0, 1), uhd::value_error);
+    BOOST_CHECK_THROW(host_resampler::make(1, 0), uhd::value_error);
+    BOOST_CHECK_THROW(
+        host_resampler::make(host_resampler::MAX_FACTOR + 1, 1), uhd::value_error);
+    BOOST_CHECK_THROW(host_resampler::make(1, 1, 0), uhd::value_error);
+}
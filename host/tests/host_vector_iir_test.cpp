@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/host_vector_iir.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+std::vector<fc32_t> make_samps(const size_t num_samps)
+{
+    std::vector<fc32_t> samps(num_samps);
+    for (size_t i = 0; i < samps.size(); i++) {
+        samps[i] = fc32_t(std::cos(0.3f * i) + 0.1f * (i % 7), std::sin(0.7f * i));
+    }
+    return samps;
+}
+
+//! y[n] = beta * x[n] + alpha * y[n - delay]
+std::vector<fc32_t> reference_iir(const std::vector<fc32_t>& x,
+    const size_t delay,
+    const double alpha,
+    const double beta)
+{
+    std::vector<std::complex<double>> y(x.size());
+    for (size_t n = 0; n < x.size(); n++) {
+        y[n] = beta * std::complex<double>(x[n]);
+        if (n >= delay) {
+            y[n] += alpha * y[n - delay];
+        }
+    }
+    return std::vector<fc32_t>(y.begin(), y.end());
+}
+
+void check_close(const fc32_t& actual, const fc32_t& expected)
+{
+    BOOST_CHECK_SMALL(std::abs(actual - expected), 1e-4f * (1 + std::abs(expected)));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_host_vector_iir_matches_reference)
+{
+    for (const uint16_t delay : {5, 8, 37, 1024}) {
+        auto iir       = host_vector_iir::make(delay, 0.75, 0.5);
+        const auto x   = make_samps(5 * delay + 3);
+        const auto ref = reference_iir(x, delay, 0.75, 0.5);
+        std::vector<fc32_t> y(x.size());
+        // Calls of all sizes, which start and end anywhere in the delay line
+        size_t done = 0;
+        for (size_t n = 1; done < x.size(); n = 2 * n + 1) {
+            n = std::min(n, x.size() - done);
+            iir->process(x.data() + done, y.data() + done, n);
+            done += n;
+        }
+        for (size_t i = 0; i < x.size(); i++) {
+            check_close(y[i], ref[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_vector_iir_in_place)
+{
+    constexpr uint16_t DELAY = 16;
+    auto iir                 = host_vector_iir::make(DELAY);
+    BOOST_CHECK_EQUAL(iir->get_alpha(), 0.9);
+    BOOST_CHECK_EQUAL(iir->get_beta(), 0.9);
+    auto samps     = make_samps(10 * DELAY);
+    const auto ref = reference_iir(samps, DELAY, 0.9, 0.9);
+    iir->process(samps.data(), samps.data(), samps.size());
+    for (size_t i = 0; i < samps.size(); i++) {
+        check_close(samps[i], ref[i]);
+    }
+
+    // A new delay starts over from zeros
+    iir->set_delay(DELAY / 2);
+    BOOST_CHECK_EQUAL(iir->get_delay(), DELAY / 2);
+    samps               = make_samps(4 * DELAY);
+    const auto ref_half = reference_iir(samps, DELAY / 2, 0.9, 0.9);
+    iir->process(samps.data(), samps.data(), samps.size());
+    for (size_t i = 0; i < samps.size(); i++) {
+        check_close(samps[i], ref_half[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_host_vector_iir_settings)
+{
+    auto iir = host_vector_iir::make(host_vector_iir::MIN_DELAY);
+    BOOST_CHECK_EQUAL(iir->get_max_delay(), host_vector_iir::MAX_DELAY);
+    BOOST_CHECK_THROW(iir->set_alpha(-0.1), uhd::value_error);
+    BOOST_CHECK_THROW(iir->set_alpha(1.1), uhd::value_error);
+    BOOST_CHECK_THROW(iir->set_beta(1.1), uhd::value_error);
+    BOOST_CHECK_THROW(iir->set_delay(host_vector_iir::MIN_DELAY - 1), uhd::value_error);
+    BOOST_CHECK_THROW(host_vector_iir::make(1), uhd::value_error);
+
+    // With alpha = 0, the filter only scales
+    iir->set_alpha(0.0);
+    iir->set_beta(0.25);
+    const auto x = make_samps(100);
+    std::vector<fc32_t> y(x.size());
+    iir->process(x.data(), y.data(), x.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        check_close(y[i], 0.25f * x[i]);
+    }
+}
@@ -6,7 +6,9 @@
 
 #include <uhdlib/utils/interpolation.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <string>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(test_get_bounding_iterators)
 {
@@ -101,3 +103,45 @@ BOOST_AUTO_TEST_CASE(test_map_bilinear_interp)
     BOOST_CHECK_EQUAL(at_bilin_interp(test_data, 1.5, 2.0), 1.5);
 }
 
+
+BOOST_AUTO_TEST_CASE(test_lower_bound_index)
+{
+    using namespace uhd::math;
+
+    BOOST_CHECK_EQUAL(lower_bound_index(std::vector<double>{}, 1.0), 0);
+    // Compare against std::lower_bound() for all sizes around powers of two,
+    // and for keys on, between, and outside of the data points
+    for (size_t num_keys = 1; num_keys <= 33; num_keys++) {
+        std::vector<double> keys;
+        for (size_t i = 0; i < num_keys; i++) {
+            keys.push_back(10.0 * i);
+        }
+        for (double key = -10.0; key <= 10.0 * num_keys; key += 5.0) {
+            const size_t expected = static_cast<size_t>(
+                std::lower_bound(keys.cbegin(), keys.cend(), key) - keys.cbegin());
+            BOOST_CHECK_EQUAL(lower_bound_index(keys, key), expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_get_bounding_indices)
+{
+    using namespace uhd::math;
+
+    const std::vector<double> keys{1.0, 2.0, 3.0};
+
+    const auto test1 = get_bounding_indices(keys, 1.1);
+    BOOST_CHECK_EQUAL(test1.first, 0);
+    BOOST_CHECK_EQUAL(test1.second, 1);
+    const auto test2 = get_bounding_indices(keys, 0.5);
+    BOOST_CHECK_EQUAL(test2.first, 0);
+    BOOST_CHECK_EQUAL(test2.second, 0);
+    const auto test3 = get_bounding_indices(keys, 17.0);
+    BOOST_CHECK_EQUAL(test3.first, 2);
+    BOOST_CHECK_EQUAL(test3.second, 2);
+
+    BOOST_CHECK_EQUAL(get_nearest_index(keys, 1.4), 0);
+    BOOST_CHECK_EQUAL(get_nearest_index(keys, 1.6), 1);
+    BOOST_CHECK_EQUAL(get_nearest_index(keys, -1.0), 0);
+    BOOST_CHECK_EQUAL(get_nearest_index(keys, 1e9), 2);
+}
@@ -0,0 +1,115 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/iq_codec.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace uhd::iq_codec;
+
+namespace {
+
+std::vector<uint8_t> to_bytes(const std::vector<std::complex<int16_t>>& samples)
+{
+    std::vector<uint8_t> bytes(samples.size() * sizeof(samples[0]));
+    std::memcpy(bytes.data(), samples.data(), bytes.size());
+    return bytes;
+}
+
+//! Compress and decompress \p data, and return the size of the frame
+size_t round_trip(const std::vector<uint8_t>& data, const size_t alignment)
+{
+    std::vector<uint8_t> frame(get_max_frame_size(data.size()) + alignment);
+    const size_t frame_size = compress(data.data(), data.size(), frame.data(), alignment);
+    BOOST_REQUIRE_LE(frame_size, frame.size());
+    BOOST_CHECK_EQUAL(frame_size % alignment, 0);
+
+    const frame_info_t info = get_frame_info(frame.data(), frame_size);
+    BOOST_CHECK_EQUAL(info.frame_size, frame_size);
+    BOOST_CHECK_EQUAL(info.num_bytes, data.size());
+
+    std::vector<uint8_t> restored(data.size());
+    BOOST_CHECK_EQUAL(
+        decompress(frame.data(), frame_size, restored.data()), data.size());
+    BOOST_CHECK(restored == data);
+    return frame_size;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_round_trip)
+{
+    std::mt19937 rng(0);
+    std::normal_distribution<double> noise(0.0, 100.0);
+    for (const size_t num_samps : {0, 1, 63, 64, 65, 1000, 10000}) {
+        std::vector<std::complex<int16_t>> samples(num_samps);
+        for (auto& samp : samples) {
+            samp = {int16_t(noise(rng)), int16_t(noise(rng))};
+        }
+        const auto data = to_bytes(samples);
+        round_trip(data, 1);
+        round_trip(data, 4096);
+        // Odd sizes are stored as they are
+        round_trip(std::vector<uint8_t>(data.begin(), data.begin() + data.size() / 3), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_compression)
+{
+    constexpr size_t NUM_SAMPS = 100000;
+    std::mt19937 rng(0);
+
+    // Noise which spans 10 of 16 bits
+    std::normal_distribution<double> noise(0.0, 100.0);
+    std::vector<std::complex<int16_t>> samples(NUM_SAMPS);
+    for (auto& samp : samples) {
+        samp = {int16_t(noise(rng)), int16_t(noise(rng))};
+    }
+    const size_t raw_size = NUM_SAMPS * sizeof(samples[0]);
+    BOOST_CHECK_LT(round_trip(to_bytes(samples), 1), raw_size * 3 / 4);
+
+    // An oversampled tone uses the differences of the samples
+    for (size_t i = 0; i < NUM_SAMPS; i++) {
+        samples[i] = {int16_t(20000 * std::cos(0.001 * i)),
+            int16_t(20000 * std::sin(0.001 * i))};
+    }
+    BOOST_CHECK_LT(round_trip(to_bytes(samples), 1), raw_size / 2);
+
+    // Full-scale extremes don't grow by more than the descriptors
+    for (size_t i = 0; i < NUM_SAMPS; i++) {
+        samples[i] = {int16_t(i % 2 ? 32767 : -32768), int16_t(rng())};
+    }
+    BOOST_CHECK_LE(round_trip(to_bytes(samples), 1), get_max_frame_size(raw_size));
+}
+
+BOOST_AUTO_TEST_CASE(test_corrupt_frames)
+{
+    std::vector<uint8_t> data(5000, 1);
+    std::vector<uint8_t> frame(get_max_frame_size(data.size()));
+    const size_t frame_size = compress(data.data(), data.size(), frame.data());
+    std::vector<uint8_t> restored(data.size());
+
+    BOOST_CHECK_THROW(get_frame_info(frame.data(), FRAME_HEADER_SIZE - 1),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        decompress(frame.data(), frame_size - 1, restored.data()), uhd::value_error);
+
+    auto bad_magic = frame;
+    bad_magic[0] ^= 0xff;
+    BOOST_CHECK_THROW(
+        decompress(bad_magic.data(), frame_size, restored.data()), uhd::value_error);
+
+    // A block with more than 16 bits
+    auto bad_block = frame;
+    bad_block[FRAME_HEADER_SIZE] = 17;
+    BOOST_CHECK_THROW(
+        decompress(bad_block.data(), frame_size, restored.data()), uhd::value_error);
+}
@@ -148,3 +148,44 @@ BOOST_AUTO_TEST_CASE(lmx_sync_tune_test)
     // VCO_PHASE_SYNC_EN must be on in this case
     BOOST_CHECK(mem.mem[0] & (1 << 14));
 }
+
+BOOST_AUTO_TEST_CASE(lmx_frequency_image_test)
+{
+    auto make_lo = [](lmx2572_mem& mem) {
+        auto lo = lmx2572_iface::make(
+            [&](const uint8_t addr, const uint16_t data) { mem.poke16(addr, data); },
+            [&](const uint8_t addr) -> uint16_t { return mem.peek16(addr); },
+            [](const uhd::time_spec_t&) {});
+        lo->reset();
+        lo->set_sync_mode(true);
+        lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, true);
+        lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, false);
+        lo->commit();
+        return lo;
+    };
+    auto ref_mem = lmx2572_mem{};
+    auto ref_lo  = make_lo(ref_mem);
+    auto mem     = lmx2572_mem{};
+    auto lo      = make_lo(mem);
+
+    // Computing an image must not touch the chip, nor the register cache
+    const auto image = lo->get_frequency_image(50.5 * 64e6 / 2, 64e6, false);
+    const auto mem_before = mem.mem;
+    lo->commit();
+    BOOST_CHECK(mem.mem == mem_before);
+
+    // Loading the image is the same as setting the frequency, also when we come
+    // from another frequency
+    for (const double prev_freq : {40 * 64e6, 10 * 64e6}) {
+        ref_lo->set_frequency(prev_freq, 64e6, false);
+        ref_lo->commit();
+        lo->set_frequency(prev_freq, 64e6, false);
+        lo->commit();
+        BOOST_CHECK_EQUAL(ref_lo->set_frequency(50.5 * 64e6 / 2, 64e6, false),
+            image.freq);
+        ref_lo->commit();
+        lo->load_frequency_image(image);
+        lo->commit();
+        UHD_CHECK_REGMAP(ref_mem.mem, mem.mem);
+    }
+}
@@ -8,8 +8,13 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/log_add.hpp>
+#include <uhdlib/utils/fast_log.hpp>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(test_messages)
 {
@@ -41,3 +46,49 @@ BOOST_AUTO_TEST_CASE(test_throw)
 {
     BOOST_CHECK_THROW(log_with_throw(), uhd::runtime_error);
 }
+
+BOOST_AUTO_TEST_CASE(test_fast_messages)
+{
+    std::mutex mutex;
+    std::vector<uhd::log::logging_info> messages;
+    uhd::log::set_log_level(uhd::log::trace);
+    uhd::log::add_logger("fast_test", [&](const uhd::log::logging_info& I) {
+        if (I.component == "fast_test") {
+            std::lock_guard<std::mutex> l(mutex);
+            messages.push_back(I);
+        }
+    });
+    uhd::log::set_logger_level("fast_test", uhd::log::trace);
+
+    enum class test_enum { FOO = 7 };
+    UHD_LOG_FAST_INFO("fast_test", "no args");
+    UHD_LOG_FAST_DEBUG("fast_test", "%d %x %.1f", -42, 255u, 1.5);
+    UHD_LOG_FAST_WARNING("fast_test", "enum %1%, bool %2%", test_enum::FOO, true);
+    // Too few arguments must not throw
+    UHD_LOG_FAST_ERROR("fast_test", "missing %d");
+    // Messages from threads which have exited are still printed
+    std::thread([]() { UHD_LOG_FAST_TRACE("fast_test", "thread %d", 1); }).join();
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < timeout) {
+        {
+            std::lock_guard<std::mutex> l(mutex);
+            if (messages.size() >= 5) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // Stop capturing before we look at the messages
+    uhd::log::set_logger_level("fast_test", uhd::log::off);
+    std::lock_guard<std::mutex> l(mutex);
+    BOOST_REQUIRE_EQUAL(messages.size(), 5);
+    BOOST_CHECK_EQUAL(messages[0].message, "no args");
+    BOOST_CHECK_EQUAL(messages[0].verbosity, uhd::log::info);
+    BOOST_CHECK_EQUAL(messages[1].message, "-42 ff 1.5");
+    BOOST_CHECK_EQUAL(messages[1].thread_id, std::this_thread::get_id());
+    BOOST_CHECK_EQUAL(messages[2].message, "enum 7, bool 1");
+    BOOST_CHECK_EQUAL(messages[3].message, "missing ");
+    BOOST_CHECK_EQUAL(messages[4].message, "thread 1");
+    BOOST_CHECK_EQUAL(messages[4].verbosity, uhd::log::trace);
+}
@@ -169,3 +169,13 @@ BOOST_AUTO_TEST_CASE(test_mb_controller)
     tk->set_time_next_pps(uhd::time_spec_t(TIME_1));
     BOOST_CHECK_EQUAL(tk->get_ticks_last_pps(), TIME_1 * TICK_RATE);
 }
+
+BOOST_AUTO_TEST_CASE(test_mb_controller_all_sensors)
+{
+    auto mmbc = std::make_shared<mock_mb_controller>();
+
+    const auto sensors = mmbc->get_all_sensors();
+    BOOST_REQUIRE_EQUAL(sensors.size(), 1);
+    BOOST_CHECK_EQUAL(sensors.at(0).name, "Ref");
+    BOOST_CHECK(!sensors.at(0).to_bool());
+}
@@ -0,0 +1,100 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/metrics.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace uhd::metrics;
+
+namespace {
+
+class mock_rx_streamer : public uhd::rx_streamer
+{
+public:
+    size_t get_num_channels(void) const override
+    {
+        return 1;
+    }
+
+    size_t get_max_num_samps(void) const override
+    {
+        return 0;
+    }
+
+    size_t recv(const buffs_type&,
+        const size_t,
+        uhd::rx_metadata_t&,
+        const double,
+        const bool) override
+    {
+        return 0;
+    }
+
+    void issue_stream_cmd(const uhd::stream_cmd_t&) override {}
+
+    uhd::stream_telemetry_t get_telemetry(void) const override
+    {
+        return telemetry;
+    }
+
+    uhd::stream_telemetry_t telemetry;
+};
+
+bool contains(const std::string& output, const std::string& line)
+{
+    return output.find(line + "\n") != std::string::npos;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_histogram)
+{
+    histogram hist({1.0, 2.0});
+    hist.observe(0.5);
+    hist.observe(1.0);
+    hist.observe(1.5);
+    hist.observe(3.0);
+    const auto snapshot = hist.get_snapshot();
+    BOOST_CHECK(snapshot.counts == std::vector<uint64_t>({2, 1, 1}));
+    BOOST_CHECK_EQUAL(snapshot.sum, 6.0);
+
+    BOOST_CHECK_THROW(histogram({}), uhd::value_error);
+    BOOST_CHECK_THROW(histogram({2.0, 1.0}), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_scrape)
+{
+    auto exporter = exporter::make();
+    auto streamer = std::make_shared<mock_rx_streamer>();
+    streamer->telemetry.overflows    = 3;
+    streamer->telemetry.buff_wait_ns = 1500000000;
+    exporter->add_rx_streamer(streamer, {{"device", "radio \"a\""}});
+    exporter->add_gauge("test_gauge", "A gauge", []() { return 0.25; });
+    auto hist = std::make_shared<histogram>(std::vector<double>{1.0});
+    hist->observe(0.5);
+    hist->observe(2.0);
+    exporter->add_histogram("test_hist", "A histogram", hist, {{"chan", "0"}});
+
+    std::string output = exporter->scrape();
+    BOOST_CHECK(contains(output, "# TYPE uhd_rx_overflows counter"));
+    BOOST_CHECK(contains(output, "uhd_rx_overflows_total{device=\"radio \\\"a\\\"\"} 3"));
+    BOOST_CHECK(contains(output,
+        "uhd_rx_buffer_wait_seconds_total{device=\"radio \\\"a\\\"\"} 1.5"));
+    BOOST_CHECK(contains(output, "# TYPE test_gauge gauge"));
+    BOOST_CHECK(contains(output, "test_gauge 0.25"));
+    BOOST_CHECK(contains(output, "test_hist_bucket{chan=\"0\",le=\"1\"} 1"));
+    BOOST_CHECK(contains(output, "test_hist_bucket{chan=\"0\",le=\"+Inf\"} 2"));
+    BOOST_CHECK(contains(output, "test_hist_count{chan=\"0\"} 2"));
+    BOOST_CHECK(contains(output, "test_hist_sum{chan=\"0\"} 2.5"));
+    BOOST_CHECK(contains(output, "# TYPE uhd_ctrl_latency_seconds histogram"));
+    BOOST_CHECK_EQUAL(output.substr(output.size() - 6), "# EOF\n");
+
+    // Destroyed streamers are no longer exported
+    streamer.reset();
+    output = exporter->scrape();
+    BOOST_CHECK(output.find("uhd_rx_overflows") == std::string::npos);
+}
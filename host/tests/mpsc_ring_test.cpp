@@ -0,0 +1,72 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/mpsc_ring.hpp>
+#include <boost/test/unit_test.hpp>
+#include <thread>
+#include <vector>
+
+using namespace uhd;
+
+BOOST_AUTO_TEST_CASE(test_mpsc_ring_push_pop)
+{
+    // Capacity is rounded up to a power of two
+    mpsc_ring<int> ring(3);
+    BOOST_CHECK_EQUAL(ring.capacity(), 4);
+
+    int val = -1;
+    BOOST_CHECK(!ring.pop(val));
+
+    // Go around the ring a few times
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++) {
+            BOOST_CHECK(ring.push(round * 4 + i));
+        }
+        BOOST_CHECK(!ring.push(100));
+
+        for (int i = 0; i < 4; i++) {
+            BOOST_CHECK(ring.pop(val));
+            BOOST_CHECK_EQUAL(val, round * 4 + i);
+        }
+        BOOST_CHECK(!ring.pop(val));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_mpsc_ring_threaded)
+{
+    constexpr size_t num_producers = 4;
+    constexpr size_t num_items     = 50000;
+    mpsc_ring<size_t> ring(16);
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < num_producers; p++) {
+        producers.emplace_back([&ring, p]() {
+            for (size_t i = 0; i < num_items; i++) {
+                while (!ring.push(p * num_items + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Every producer's items must arrive in order, and none twice
+    std::vector<size_t> next(num_producers, 0);
+    size_t val;
+    for (size_t i = 0; i < num_producers * num_items; i++) {
+        while (!ring.pop(val)) {
+            std::this_thread::yield();
+        }
+        const size_t p = val / num_items;
+        if (val % num_items != next[p]) {
+            BOOST_REQUIRE_EQUAL(val % num_items, next[p]);
+        }
+        next[p]++;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    BOOST_CHECK(!ring.pop(val));
+}
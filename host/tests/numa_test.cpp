@@ -0,0 +1,49 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace uhd;
+
+BOOST_AUTO_TEST_CASE(test_parse_cpu_list)
+{
+    BOOST_CHECK(numa::parse_cpu_list("").empty());
+    BOOST_CHECK(numa::parse_cpu_list("3") == std::vector<size_t>({3}));
+    BOOST_CHECK(numa::parse_cpu_list("0-3") == std::vector<size_t>({0, 1, 2, 3}));
+    BOOST_CHECK(
+        numa::parse_cpu_list("0-1,8,10-11") == std::vector<size_t>({0, 1, 8, 10, 11}));
+
+    BOOST_CHECK_THROW(numa::parse_cpu_list("a"), uhd::value_error);
+    BOOST_CHECK_THROW(numa::parse_cpu_list("3-1"), uhd::value_error);
+    BOOST_CHECK_THROW(numa::parse_cpu_list("1,,2"), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_unknown_node)
+{
+    BOOST_CHECK(numa::get_node_cpus(numa::NO_NODE).empty());
+    BOOST_CHECK_EQUAL(numa::get_ifname_node(""), numa::NO_NODE);
+    BOOST_CHECK_EQUAL(numa::get_ipv4_node("0.0.0.0"), numa::NO_NODE);
+    BOOST_CHECK(numa::alloc_on_node(4096, numa::NO_NODE) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_alloc_on_node)
+{
+    // Node 0 exists on every Linux machine, but placement may not be supported
+    constexpr size_t size = 3 * 4096 + 100;
+    void* mem             = numa::alloc_on_node(size, 0);
+    if (!mem) {
+        BOOST_TEST_MESSAGE("NUMA placement not supported, skipping test");
+        return;
+    }
+    const std::vector<char> zeros(size, 0);
+    BOOST_CHECK(std::memcmp(mem, zeros.data(), size) == 0);
+    std::memset(mem, 0x5a, size);
+    numa::free_on_node(mem, size);
+}
@@ -5,10 +5,17 @@
 //
 
 #include "common/mock_link.hpp"
+#include <uhd/config.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
+#include <uhdlib/transport/offload_thread_pool.hpp>
 #include <boost/test/unit_test.hpp>
 #include <atomic>
+#include <chrono>
 #include <iostream>
+#include <thread>
+#ifdef UHD_PLATFORM_LINUX
+#    include <poll.h>
+#endif
 
 using namespace uhd::transport;
 
@@ -146,11 +153,12 @@ private:
 constexpr auto RECV_ONLY          = offload_io_service::RECV_ONLY;
 constexpr auto SEND_ONLY          = offload_io_service::SEND_ONLY;
 
-constexpr auto POLL  = offload_io_service::POLL;
-constexpr auto BLOCK = offload_io_service::BLOCK;
-using params_t       = offload_io_service::params_t;
+constexpr auto POLL   = offload_io_service::POLL;
+constexpr auto BLOCK  = offload_io_service::BLOCK;
+constexpr auto HYBRID = offload_io_service::HYBRID;
+using params_t        = offload_io_service::params_t;
 
-std::vector<offload_io_service::wait_mode_t> wait_modes({POLL, BLOCK});
+std::vector<offload_io_service::wait_mode_t> wait_modes({POLL, BLOCK, HYBRID});
 
 BOOST_AUTO_TEST_CASE(test_construction)
 {
@@ -211,6 +219,58 @@ BOOST_AUTO_TEST_CASE(test_send)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_shared_frames)
+{
+    for (const auto wait_mode : wait_modes) {
+        // Each client is guaranteed 2 of its 4 frames, and the other 2 frames
+        // of the link are shared
+        params_t params         = {{}, SEND_ONLY, wait_mode};
+        params.min_frames_ratio = 0.5;
+        auto mock_io_srv        = std::make_shared<mock_io_service>();
+        auto io_srv             = offload_io_service::make(mock_io_srv, params);
+        auto send_link          = make_send_link(6);
+        io_srv->attach_send_link(send_link);
+        auto send_client0 =
+            io_srv->make_send_client(send_link, 4, nullptr, nullptr, 0, nullptr, nullptr);
+        auto send_client1 =
+            io_srv->make_send_client(send_link, 4, nullptr, nullptr, 0, nullptr, nullptr);
+
+        std::vector<frame_buff::uptr> buffs0, buffs1;
+        while (true) {
+            auto buff0 = send_client0->get_send_buff(10);
+            auto buff1 = send_client1->get_send_buff(10);
+            if (!buff0 && !buff1) {
+                break;
+            }
+            if (buff0) {
+                buffs0.push_back(std::move(buff0));
+            }
+            if (buff1) {
+                buffs1.push_back(std::move(buff1));
+            }
+        }
+        BOOST_CHECK_EQUAL(buffs0.size() + buffs1.size(), 6);
+        BOOST_CHECK_GE(buffs0.size(), 2);
+        BOOST_CHECK_GE(buffs1.size(), 2);
+
+        // Once the first client is gone, the second one gets all its frames
+        for (auto& buff : buffs0) {
+            send_client0->release_send_buff(std::move(buff));
+        }
+        send_client0.reset();
+        while (buffs1.size() < 4) {
+            auto buff = send_client1->get_send_buff(100);
+            BOOST_REQUIRE(buff != nullptr);
+            buffs1.push_back(std::move(buff));
+        }
+        BOOST_CHECK(send_client1->get_send_buff(10) == nullptr);
+        for (auto& buff : buffs1) {
+            send_client1->release_send_buff(std::move(buff));
+        }
+        send_client1.reset();
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv)
 {
     for (const auto wait_mode : wait_modes) {
@@ -351,3 +411,126 @@ BOOST_AUTO_TEST_CASE(test_attach_detach)
     mock_io_srv->allocate_recv_frames(2, 1);
     recv_client2->release_recv_buff(recv_client2->get_recv_buff(100));
 }
+
+BOOST_AUTO_TEST_CASE(test_thread_pool)
+{
+    auto pool = offload_thread_pool::make({{}, {}});
+
+    // Only polling I/O services can run in a pool
+    BOOST_CHECK_THROW(offload_io_service::make(std::make_shared<mock_io_service>(),
+                          params_t{{}, RECV_ONLY, BLOCK, pool, "block"}),
+        uhd::value_error);
+
+    params_t params;
+    params.thread_pool = pool;
+
+    // Three I/O services in a pool of two threads
+    std::vector<std::shared_ptr<mock_io_service>> mock_io_srvs;
+    std::vector<io_service::sptr> io_srvs;
+    std::vector<mock_recv_link::sptr> recv_links;
+    std::vector<recv_io_if::sptr> recv_clients;
+    std::vector<send_io_if::sptr> send_clients;
+    for (size_t i = 0; i < 3; i++) {
+        params.name = "io_srv" + std::to_string(i);
+        mock_io_srvs.push_back(std::make_shared<mock_io_service>());
+        io_srvs.push_back(offload_io_service::make(mock_io_srvs.back(), params));
+        auto send_link = make_send_link(5);
+        auto recv_link = make_recv_link(5);
+        io_srvs.back()->attach_send_link(send_link);
+        io_srvs.back()->attach_recv_link(recv_link);
+        recv_links.push_back(recv_link);
+        send_clients.push_back(io_srvs.back()->make_send_client(
+            send_link, 1, nullptr, nullptr, 0, nullptr, nullptr));
+        recv_clients.push_back(
+            io_srvs.back()->make_recv_client(recv_link, 1, nullptr, nullptr, 0, nullptr));
+    }
+    BOOST_CHECK_EQUAL(pool->get_stats().tasks.size(), 3);
+    BOOST_CHECK_EQUAL(pool->get_stats().tasks[2].name, "io_srv2");
+
+    for (size_t i = 0; i < 10; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            recv_links[j]->push_back_recv_packet(
+                boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+            mock_io_srvs[j]->allocate_recv_frames(0, 1);
+            auto buff = recv_clients[j]->get_recv_buff(100);
+            BOOST_CHECK(buff != nullptr);
+            recv_clients[j]->release_recv_buff(std::move(buff));
+            send_clients[j]->release_send_buff(send_clients[j]->get_send_buff(100));
+        }
+    }
+
+    // Destroying the I/O services removes them from the pool
+    send_clients.clear();
+    recv_clients.clear();
+    io_srvs.clear();
+    BOOST_CHECK(pool->get_stats().tasks.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_hybrid_wakeup)
+{
+    params_t params     = {{}, RECV_ONLY, HYBRID};
+    params.spin_time_us = 100;
+    auto mock_io_srv    = std::make_shared<mock_io_service>();
+    auto io_srv         = offload_io_service::make(mock_io_srv, params);
+    auto recv_link      = make_recv_link(5);
+    io_srv->attach_recv_link(recv_link);
+    auto recv_client =
+        io_srv->make_recv_client(recv_link, 1, nullptr, nullptr, 0, nullptr);
+
+    for (size_t i = 0; i < 3; i++) {
+        // Idle for much longer than the spin time, so the offload thread
+        // blocks, and check that packets still come through
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        recv_link->push_back_recv_packet(
+            boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+        mock_io_srv->allocate_recv_frames(0, 1);
+        auto buff = recv_client->get_recv_buff(500);
+        BOOST_CHECK(buff != nullptr);
+        recv_client->release_recv_buff(std::move(buff));
+    }
+    recv_client.reset();
+}
+
+#ifdef UHD_PLATFORM_LINUX
+static bool is_readable(const int fd, const int timeout_ms)
+{
+    pollfd pfd{fd, POLLIN, 0};
+    return ::poll(&pfd, 1, timeout_ms) > 0;
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_ready_fd)
+{
+    for (const auto wait_mode : wait_modes) {
+        params_t params  = {{}, RECV_ONLY, wait_mode};
+        auto mock_io_srv = std::make_shared<mock_io_service>();
+        auto io_srv      = offload_io_service::make(mock_io_srv, params);
+        auto recv_link   = make_recv_link(5);
+        io_srv->attach_recv_link(recv_link);
+        auto recv_client =
+            io_srv->make_recv_client(recv_link, 2, nullptr, nullptr, 0, nullptr);
+
+        const int fd = recv_client->get_ready_fd();
+        BOOST_REQUIRE(fd >= 0);
+        BOOST_CHECK(!is_readable(fd, 0));
+
+        for (size_t i = 0; i < 3; i++) {
+            for (size_t j = 0; j < 2; j++) {
+                recv_link->push_back_recv_packet(
+                    boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+            }
+            mock_io_srv->allocate_recv_frames(0, 2);
+            BOOST_CHECK(is_readable(fd, 500));
+
+            // The descriptor stays readable until the client finds no frame
+            for (size_t j = 0; j < 2; j++) {
+                auto buff = recv_client->get_recv_buff(100);
+                BOOST_REQUIRE(buff != nullptr);
+                recv_client->release_recv_buff(std::move(buff));
+            }
+            BOOST_CHECK(!recv_client->get_recv_buff(0));
+            BOOST_CHECK(!is_readable(fd, 0));
+        }
+        recv_client.reset();
+    }
+}
+#endif
@@ -0,0 +1,114 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/transport/offload_thread_pool.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+//! Wait until pred() is true, return false on timeout
+template <typename pred_t>
+bool wait_for(pred_t pred)
+{
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > timeout) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_add_remove)
+{
+    auto pool = offload_thread_pool::make({{}, {}});
+    std::atomic<size_t> num_polls0{0};
+    std::atomic<size_t> num_polls1{0};
+    const size_t task0 = pool->add_task("task0", [&num_polls0]() {
+        num_polls0++;
+        return true;
+    });
+    const size_t task1 = pool->add_task("task1", [&num_polls1]() {
+        num_polls1++;
+        return false;
+    });
+    BOOST_CHECK(wait_for([&]() { return num_polls0 > 100 && num_polls1 > 100; }));
+
+    // New tasks go to the thread with the fewest tasks
+    auto stats = pool->get_stats();
+    BOOST_REQUIRE_EQUAL(stats.threads.size(), 2);
+    BOOST_REQUIRE_EQUAL(stats.tasks.size(), 2);
+    BOOST_CHECK_EQUAL(stats.threads[0].num_tasks, 1);
+    BOOST_CHECK_EQUAL(stats.threads[1].num_tasks, 1);
+    BOOST_CHECK_EQUAL(stats.tasks[0].name, "task0");
+    BOOST_CHECK_EQUAL(stats.tasks[0].thread, 0);
+    BOOST_CHECK_EQUAL(stats.tasks[1].thread, 1);
+    BOOST_CHECK_GT(stats.tasks[0].num_busy_polls, 0);
+    BOOST_CHECK_EQUAL(stats.tasks[1].num_busy_polls, 0);
+
+    // Once removed, a task is never polled again
+    pool->remove_task(task0);
+    const size_t num_polls_removed = num_polls0;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    BOOST_CHECK_EQUAL(num_polls0, num_polls_removed);
+    BOOST_CHECK_EQUAL(pool->get_stats().tasks.size(), 1);
+    BOOST_CHECK_EQUAL(pool->get_stats().threads[0].num_tasks, 0);
+
+    pool->remove_task(task1);
+    BOOST_CHECK(pool->get_stats().tasks.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_work_stealing)
+{
+    auto pool = offload_thread_pool::make({{}, {}});
+
+    // Two busy tasks end up on thread 0, and an idle one on thread 1
+    std::atomic<bool> overlap{false};
+    auto make_busy_task = [&overlap]() {
+        auto polling = std::make_shared<std::atomic<bool>>(false);
+        return [&overlap, polling]() {
+            if (polling->exchange(true)) {
+                overlap = true;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            *polling = false;
+            return true;
+        };
+    };
+    std::vector<size_t> tasks;
+    tasks.push_back(pool->add_task("busy0", make_busy_task()));
+    tasks.push_back(pool->add_task("idle", []() { return false; }));
+    tasks.push_back(pool->add_task("busy1", make_busy_task()));
+
+    // Thread 1 should take over one of the busy tasks, and then things should
+    // stay that way
+    BOOST_REQUIRE(wait_for([&pool]() {
+        const auto stats = pool->get_stats();
+        return stats.tasks[0].thread != stats.tasks[2].thread;
+    }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto stats = pool->get_stats();
+    BOOST_CHECK_NE(stats.tasks[0].thread, stats.tasks[2].thread);
+    BOOST_CHECK_EQUAL(stats.threads[0].num_steals, 0);
+    BOOST_CHECK_EQUAL(stats.threads[1].num_steals, 1);
+    BOOST_CHECK_EQUAL(stats.threads[0].num_tasks, 1);
+    BOOST_CHECK_EQUAL(stats.threads[1].num_tasks, 2);
+    BOOST_CHECK_EQUAL(stats.tasks[0].num_migrations + stats.tasks[2].num_migrations, 1);
+    BOOST_CHECK(!overlap);
+
+    for (const size_t task : tasks) {
+        pool->remove_task(task);
+    }
+}
@@ -253,6 +253,23 @@ BOOST_AUTO_TEST_CASE(test_prop_tree_wrong_type_range)
     BOOST_CHECK_EQUAL(prop.get().start(), 5.0);
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_tree_access_ptr)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    tree->create<int>("/test/prop0").set(42);
+
+    auto prop = tree->access_ptr<int>("/test/prop0");
+    BOOST_CHECK_EQUAL(prop->get(), 42);
+    prop->set(43);
+    BOOST_CHECK_EQUAL(tree->access<int>("/test/prop0").get(), 43);
+    BOOST_CHECK_THROW(tree->access_ptr<std::string>("/test/prop0"), uhd::type_error);
+    BOOST_CHECK_THROW(tree->access_ptr<int>("/test/prop1"), uhd::lookup_error);
+
+    // The pointer outlives the property in the tree
+    tree->remove("/test/prop0");
+    BOOST_CHECK_EQUAL(prop->get(), 43);
+}
+
 BOOST_AUTO_TEST_CASE(test_prop_subtree)
 {
     uhd::property_tree::sptr tree = uhd::property_tree::make();
@@ -271,6 +288,73 @@ BOOST_AUTO_TEST_CASE(test_prop_subtree)
         tree_dirs2.begin(), tree_dirs2.end(), subtree2_dirs.begin(), subtree2_dirs.end());
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_tree_snapshot)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    int num_reads                 = 0;
+    tree->create<int>("/mb/set").set(1);
+    tree->create<int>("/mb/published").set_publisher([&num_reads]() {
+        num_reads++;
+        return 2;
+    });
+    tree->create<int>("/mb/fails").set_publisher([]() -> int {
+        throw uhd::runtime_error("cannot read");
+    });
+    tree->create<int>("/mb/empty");
+    tree->create<int>("/other").set(3);
+
+    uhd::property_tree::sptr snap = tree->snapshot("/mb");
+    BOOST_CHECK_EQUAL(num_reads, 1);
+    BOOST_CHECK(!snap->exists("/other"));
+    BOOST_CHECK_EQUAL(snap->access<int>("set").get(), 1);
+    BOOST_CHECK_EQUAL(snap->access<int>("published").get(), 2);
+    BOOST_CHECK_EQUAL(num_reads, 1);
+    BOOST_CHECK(snap->exists("fails"));
+    BOOST_CHECK_THROW(snap->access<int>("fails"), uhd::runtime_error);
+    BOOST_CHECK_THROW(snap->access<int>("empty"), uhd::runtime_error);
+    // The snapshot is a copy
+    tree->access<int>("/mb/set").set(4);
+    BOOST_CHECK_EQUAL(snap->access<int>("set").get(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_prop_tree_prefetcher)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    int num_reads                 = 0;
+    tree->create<int>("/mb/a").set_publisher([&num_reads]() {
+        num_reads++;
+        return 1;
+    });
+    tree->create<int>("/mb/b").set_publisher([&num_reads]() {
+        num_reads++;
+        return 2;
+    });
+    int num_prefetches = 0;
+    tree->add_prefetcher("/mb", [&num_prefetches](uhd::property_tree& snapshot) {
+        num_prefetches++;
+        snapshot.create<int>("a").set(10);
+    });
+    BOOST_CHECK_THROW(
+        tree->add_prefetcher("/nope", [](uhd::property_tree&) {}), uhd::lookup_error);
+
+    uhd::property_tree::sptr snap = tree->snapshot();
+    BOOST_CHECK_EQUAL(num_prefetches, 1);
+    BOOST_CHECK_EQUAL(num_reads, 1);
+    BOOST_CHECK_EQUAL(snap->access<int>("/mb/a").get(), 10);
+    BOOST_CHECK_EQUAL(snap->access<int>("/mb/b").get(), 2);
+
+    // Prefetchers above the root of the snapshot don't run
+    snap = tree->snapshot("/mb/b");
+    BOOST_CHECK_EQUAL(num_prefetches, 1);
+
+    // Failing prefetchers fall back to reading every value
+    tree->add_prefetcher("/mb/b", [](uhd::property_tree&) {
+        throw uhd::runtime_error("batch failed");
+    });
+    snap = tree->snapshot("/mb/b");
+    BOOST_CHECK_EQUAL(snap->access<int>("").get(), 2);
+}
+
 BOOST_AUTO_TEST_CASE(test_prop_operators)
 {
     uhd::fs_path path1 = "/root/";
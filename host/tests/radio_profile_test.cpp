@@ -0,0 +1,90 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/usrp/radio_profile.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace uhd::usrp;
+
+namespace {
+
+radio_profile_t::chan_settings_t make_settings(
+    const double rate, const double freq, const double gain, const std::string& antenna)
+{
+    radio_profile_t::chan_settings_t settings;
+    settings.rate      = rate;
+    settings.freq      = freq;
+    settings.gain      = gain;
+    settings.antenna   = antenna;
+    settings.bandwidth = rate;
+    return settings;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_radio_profile_empty)
+{
+    radio_profile_t profile;
+    BOOST_CHECK(profile.empty());
+    // Channels without settings don't count
+    profile.rx[0];
+    profile.tx[1];
+    BOOST_CHECK(profile.empty());
+    profile.tx[1].gain = 10.0;
+    BOOST_CHECK(!profile.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_radio_profile_diff)
+{
+    radio_profile_t current;
+    current.rx[0] = make_settings(1e6, 1e9, 10.0, "RX2");
+    current.rx[1] = make_settings(1e6, 1e9, 10.0, "RX2");
+    current.tx[0] = make_settings(1e6, 2e9, 0.0, "TX/RX");
+
+    // The same profile, up to rounding errors, is no change
+    radio_profile_t profile = current;
+    profile.rx[0].freq      = 1e9 + 1e-6;
+    profile.tx[0].gain      = 1e-6;
+    BOOST_CHECK(diff_radio_profiles(current, profile).empty());
+
+    // Only the settings which differ are applied
+    profile.rx[1].freq    = 1.1e9;
+    profile.tx[0].antenna = std::string("RX2");
+    const auto diff       = diff_radio_profiles(current, profile);
+    BOOST_CHECK_EQUAL(diff.rx.size(), 1);
+    BOOST_REQUIRE_EQUAL(diff.rx.count(1), 1);
+    BOOST_CHECK_EQUAL(diff.rx.at(1).freq.get(), 1.1e9);
+    BOOST_CHECK(!diff.rx.at(1).rate && !diff.rx.at(1).gain && !diff.rx.at(1).antenna);
+    BOOST_REQUIRE_EQUAL(diff.tx.size(), 1);
+    BOOST_CHECK_EQUAL(diff.tx.at(0).antenna.get(), "RX2");
+    BOOST_CHECK(!diff.tx.at(0).freq && !diff.tx.at(0).bandwidth);
+}
+
+BOOST_AUTO_TEST_CASE(test_radio_profile_diff_partial)
+{
+    radio_profile_t current;
+    current.rx[0] = make_settings(1e6, 1e9, 10.0, "RX2");
+
+    // Settings which the profile leaves unset are left alone
+    radio_profile_t profile;
+    profile.rx[0].gain = 20.0;
+    auto diff          = diff_radio_profiles(current, profile);
+    BOOST_REQUIRE_EQUAL(diff.rx.size(), 1);
+    BOOST_CHECK_EQUAL(diff.rx.at(0).gain.get(), 20.0);
+    BOOST_CHECK(!diff.rx.at(0).rate && !diff.rx.at(0).freq && !diff.rx.at(0).antenna);
+
+    // Settings which weren't captured, e.g. because the device doesn't
+    // support them, are always applied
+    current.rx[0].bandwidth = boost::none;
+    profile.rx[0]           = make_settings(1e6, 1e9, 10.0, "RX2");
+    profile.tx[0].freq      = 2e9;
+    diff                    = diff_radio_profiles(current, profile);
+    BOOST_REQUIRE_EQUAL(diff.rx.size(), 1);
+    BOOST_CHECK_EQUAL(diff.rx.at(0).bandwidth.get(), 1e6);
+    BOOST_CHECK(!diff.rx.at(0).gain);
+    BOOST_REQUIRE_EQUAL(diff.tx.size(), 1);
+    BOOST_CHECK_EQUAL(diff.tx.at(0).freq.get(), 2e9);
+}
@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/rfnoc/mock_block.hpp>
+#include <uhd/rfnoc/register_iface_holder.hpp>
+#include <boost/test/unit_test.hpp>
+#include <utility>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr uint32_t GAIN_ADDR = 0x100;
+constexpr uint32_t ATR_ADDR  = 0x104;
+constexpr uint32_t CMD_ADDR  = 0x108;
+
+//! Records every write that reaches the bus
+class logging_reg_iface_t : public mock_reg_iface_t
+{
+public:
+    std::vector<std::pair<uint32_t, uint32_t>> pokes;
+
+protected:
+    void _poke_cb(
+        uint32_t addr, uint32_t data, uhd::time_spec_t /*time*/, bool /*ack*/) override
+    {
+        pokes.emplace_back(addr, data);
+    }
+};
+
+using pokes_t = std::vector<std::pair<uint32_t, uint32_t>>;
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_redundant_writes)
+{
+    auto mock_reg_iface = std::make_shared<logging_reg_iface_t>();
+    register_iface_holder holder{mock_reg_iface};
+    holder.enable_write_coalescing({GAIN_ADDR, ATR_ADDR});
+
+    holder.regs().poke32(GAIN_ADDR, 1);
+    holder.regs().poke32(GAIN_ADDR, 1);
+    holder.regs().poke32(ATR_ADDR, 7);
+    holder.regs().poke32(ATR_ADDR, 7);
+    holder.regs().poke32(GAIN_ADDR, 2);
+    // Registers which are not coalesced are always written
+    holder.regs().poke32(CMD_ADDR, 3);
+    holder.regs().poke32(CMD_ADDR, 3);
+    // So are writes with an ACK, and timed writes
+    holder.regs().poke32(GAIN_ADDR, 2, uhd::time_spec_t::ASAP, true);
+    holder.regs().poke32(ATR_ADDR, 7, uhd::time_spec_t(1.0));
+    // After the timed write, the value of the register is unknown
+    holder.regs().poke32(ATR_ADDR, 7);
+
+    const pokes_t expected = {{GAIN_ADDR, 1},
+        {ATR_ADDR, 7},
+        {GAIN_ADDR, 2},
+        {CMD_ADDR, 3},
+        {CMD_ADDR, 3},
+        {GAIN_ADDR, 2},
+        {ATR_ADDR, 7},
+        {ATR_ADDR, 7}};
+    BOOST_CHECK(mock_reg_iface->pokes == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_coalesce_writes)
+{
+    auto mock_reg_iface = std::make_shared<logging_reg_iface_t>();
+    register_iface_holder holder{mock_reg_iface};
+    holder.enable_write_coalescing({GAIN_ADDR, ATR_ADDR});
+
+    {
+        auto batch = holder.coalesce_writes();
+        holder.regs().poke32(GAIN_ADDR, 0x10);
+        holder.regs().poke32(GAIN_ADDR, 0x11);
+        {
+            auto nested_batch = holder.coalesce_writes();
+            holder.regs().poke32(GAIN_ADDR, 0x13);
+        }
+        BOOST_CHECK(mock_reg_iface->pokes.empty());
+        // Accessing another register sends the held back write first
+        holder.regs().poke32(ATR_ADDR, 0x20);
+        holder.regs().poke32(CMD_ADDR, 0x30);
+        holder.regs().poke32(GAIN_ADDR, 0x13);
+        holder.regs().poke32(ATR_ADDR, 0x21);
+        mock_reg_iface->read_memory[CMD_ADDR] = 0;
+        holder.regs().peek32(CMD_ADDR);
+        BOOST_CHECK(mock_reg_iface->pokes.back() == std::make_pair(ATR_ADDR, 0x21u));
+        holder.regs().poke32(ATR_ADDR, 0x22);
+    }
+    const pokes_t expected = {{GAIN_ADDR, 0x13},
+        {ATR_ADDR, 0x20},
+        {CMD_ADDR, 0x30},
+        {ATR_ADDR, 0x21},
+        {ATR_ADDR, 0x22}};
+    BOOST_CHECK(mock_reg_iface->pokes == expected);
+    BOOST_CHECK_EQUAL(mock_reg_iface->write_memory[ATR_ADDR], 0x22);
+}
+
+BOOST_AUTO_TEST_CASE(test_coalesce_writes_disabled)
+{
+    auto mock_reg_iface = std::make_shared<logging_reg_iface_t>();
+    register_iface_holder holder{mock_reg_iface};
+
+    {
+        auto batch = holder.coalesce_writes();
+        holder.regs().poke32(GAIN_ADDR, 1);
+        holder.regs().poke32(GAIN_ADDR, 1);
+    }
+    const pokes_t expected = {{GAIN_ADDR, 1}, {GAIN_ADDR, 1}};
+    BOOST_CHECK(mock_reg_iface->pokes == expected);
+}
@@ -0,0 +1,101 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/replay_waveform_library.hpp>
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+constexpr uint64_t MEM_SIZE  = 1024;
+constexpr uint64_t WORD_SIZE = 64;
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_add_remove)
+{
+    auto library = replay_waveform_library::make(MEM_SIZE, WORD_SIZE, 2 * WORD_SIZE);
+
+    // Waveforms are placed back to back, aligned to whole words
+    const auto a = library->add("a", 100);
+    const auto b = library->add("b", 64);
+    BOOST_CHECK_EQUAL(a.offset, 2 * WORD_SIZE);
+    BOOST_CHECK_EQUAL(a.size, 100);
+    BOOST_CHECK_EQUAL(b.offset, 4 * WORD_SIZE);
+    BOOST_CHECK(library->has_waveform("a"));
+    BOOST_CHECK(!library->has_waveform("c"));
+    BOOST_CHECK_EQUAL(library->get("b").offset, b.offset);
+    BOOST_CHECK_EQUAL(library->get_free_size(), MEM_SIZE - 3 * WORD_SIZE);
+
+    BOOST_CHECK_THROW(library->add("a", 64), uhd::key_error);
+    BOOST_CHECK_THROW(library->add("c", 0), uhd::value_error);
+    BOOST_CHECK_THROW(library->add("c", MEM_SIZE + 1), uhd::value_error);
+    BOOST_CHECK_THROW(library->get("c"), uhd::key_error);
+
+    library->remove("a");
+    BOOST_CHECK(!library->has_waveform("a"));
+    BOOST_CHECK_THROW(library->remove("a"), uhd::key_error);
+    const auto waveforms = library->get_waveforms();
+    BOOST_REQUIRE_EQUAL(waveforms.size(), 1);
+    BOOST_CHECK_EQUAL(waveforms[0].name, "b");
+
+    BOOST_CHECK_THROW(replay_waveform_library::make(MEM_SIZE, WORD_SIZE, 1),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_best_fit)
+{
+    auto library = replay_waveform_library::make(MEM_SIZE, WORD_SIZE);
+    // Leave a gap of 3 words and one of 1 word
+    library->add("a", 3 * WORD_SIZE);
+    library->add("b", WORD_SIZE);
+    library->add("c", WORD_SIZE);
+    library->add("d", WORD_SIZE);
+    library->remove("a");
+    library->remove("c");
+    BOOST_CHECK_EQUAL(library->get_largest_free_size(), MEM_SIZE - 6 * WORD_SIZE);
+
+    // A small waveform goes into the smallest gap, keeping the larger one free
+    BOOST_CHECK_EQUAL(library->add("e", WORD_SIZE).offset, 4 * WORD_SIZE);
+    BOOST_CHECK_EQUAL(library->add("f", 2 * WORD_SIZE).offset, 0);
+    BOOST_CHECK_EQUAL(library->add("g", 4 * WORD_SIZE).offset, 6 * WORD_SIZE);
+}
+
+BOOST_AUTO_TEST_CASE(test_lru_eviction)
+{
+    auto library = replay_waveform_library::make(4 * WORD_SIZE, WORD_SIZE);
+    std::vector<std::string> evicted;
+    library->set_evict_callback([&](const replay_waveform_library::waveform_t& waveform) {
+        evicted.push_back(waveform.name);
+        // The library is not locked while the callback runs
+        BOOST_CHECK(!library->has_waveform(waveform.name));
+    });
+
+    library->add("a", WORD_SIZE, true);
+    library->add("b", WORD_SIZE);
+    library->add("c", WORD_SIZE);
+    library->add("d", WORD_SIZE);
+    // Using b makes c the least recently used waveform, and a is pinned
+    library->get("b");
+    library->add("e", WORD_SIZE);
+    BOOST_REQUIRE_EQUAL(evicted.size(), 1);
+    BOOST_CHECK_EQUAL(evicted[0], "c");
+    BOOST_CHECK(library->has_waveform("a"));
+    BOOST_CHECK(library->has_waveform("b"));
+
+    // Pinned waveforms are never evicted, even if nothing fits then
+    library->set_pinned("b", true);
+    library->set_pinned("d", true);
+    library->set_pinned("e", true);
+    BOOST_CHECK_THROW(library->add("f", WORD_SIZE), uhd::runtime_error);
+    BOOST_CHECK_EQUAL(evicted.size(), 1);
+    library->set_pinned("e", false);
+    BOOST_CHECK_EQUAL(library->add("f", WORD_SIZE).offset, 2 * WORD_SIZE);
+    BOOST_CHECK_EQUAL(evicted.back(), "e");
+}
@@ -143,3 +143,61 @@ BOOST_AUTO_TEST_CASE(test_ddc_block)
     BOOST_CHECK_EQUAL(test_ddc->get_property<int>("decim", 0), 1);
     BOOST_CHECK_EQUAL(test_ddc->get_property<double>("freq", 0), 0.0);
 }
+
+BOOST_AUTO_TEST_CASE(test_ddc_set_freqs)
+{
+    node_accessor_t node_accessor{};
+    constexpr size_t num_chans         = 4;
+    constexpr double DEFAULT_RATE      = 200e6;
+    constexpr uint32_t REG_CHAN_OFFSET = 2048;
+
+    auto block_container = get_mock_block(DDC_BLOCK, num_chans, num_chans);
+    auto& ddc_reg_iface  = block_container.reg_iface;
+    ddc_reg_iface->read_memory[ddc_block_control::RB_COMPAT_NUM] =
+        (ddc_block_control::MAJOR_COMPAT << 16) | ddc_block_control::MINOR_COMPAT;
+    ddc_reg_iface->read_memory[ddc_block_control::RB_NUM_HB]        = 2;
+    ddc_reg_iface->read_memory[ddc_block_control::RB_CIC_MAX_DECIM] = 128;
+    auto test_ddc = block_container.get_block<ddc_block_control>();
+    node_accessor.init_props(test_ddc.get());
+
+    detail::graph_t graph{};
+    mock_terminator_t mock_source_term(num_chans);
+    mock_terminator_t mock_sink_term(num_chans);
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        mock_source_term.set_edge_property<std::string>(
+            "type", "sc16", {res_source_info::OUTPUT_EDGE, chan});
+        mock_source_term.set_edge_property<double>(
+            "scaling", 1.0, {res_source_info::OUTPUT_EDGE, chan});
+        mock_source_term.set_edge_property<double>(
+            "samp_rate", DEFAULT_RATE, {res_source_info::OUTPUT_EDGE, chan});
+        detail::graph_t::graph_edge_t edge_info;
+        edge_info.src_port        = chan;
+        edge_info.dst_port        = chan;
+        edge_info.is_forward_edge = true;
+        edge_info.edge            = detail::graph_t::graph_edge_t::DYNAMIC;
+        graph.connect(&mock_source_term, test_ddc.get(), edge_info);
+        graph.connect(test_ddc.get(), &mock_sink_term, edge_info);
+    }
+    graph.commit();
+
+    // Retune channels 1 to 3 in one go, and leave channel 0 alone
+    const std::vector<size_t> chans{3, 1, 2};
+    const std::vector<double> freqs{3e6, 1e6, 2e6};
+    const auto actual_freqs = test_ddc->set_freqs(freqs, chans, uhd::time_spec_t(1.0));
+    BOOST_REQUIRE_EQUAL(actual_freqs.size(), chans.size());
+    for (size_t i = 0; i < chans.size(); i++) {
+        BOOST_CHECK_CLOSE(actual_freqs[i], freqs[i], 1e-3);
+        BOOST_CHECK_EQUAL(test_ddc->get_freq(chans[i]), actual_freqs[i]);
+        // The command time is restored afterwards
+        BOOST_CHECK(test_ddc->get_command_time(chans[i]) == uhd::time_spec_t(0.0));
+    }
+    BOOST_CHECK_EQUAL(test_ddc->get_freq(0), 0.0);
+    const double freq_word_1 = ddc_reg_iface->write_memory.at(
+        ddc_block_control::SR_FREQ_ADDR + REG_CHAN_OFFSET);
+    const double freq_word_3 = ddc_reg_iface->write_memory.at(
+        ddc_block_control::SR_FREQ_ADDR + 3 * REG_CHAN_OFFSET);
+    BOOST_CHECK_CLOSE(freq_word_3 / freq_word_1, 3.0, 1e-3);
+
+    BOOST_CHECK_THROW(test_ddc->set_freqs({1e6}, {0, 1}), uhd::value_error);
+    BOOST_CHECK_THROW(test_ddc->set_freqs({1e6}, {num_chans}), uhd::value_error);
+}
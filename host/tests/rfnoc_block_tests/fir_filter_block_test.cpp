@@ -229,6 +229,63 @@ BOOST_FIXTURE_TEST_CASE(fir_filter_test_length_error, fir_filter_block_fixture)
     }
 }
 
+/*
+ * This test case exercises the coefficient set APIs, and ensures that loading
+ * a set only programs the hardware when the channel uses a different set.
+ */
+BOOST_FIXTURE_TEST_CASE(fir_filter_test_coefficient_sets, fir_filter_block_fixture)
+{
+    const size_t chan       = 2;
+    const size_t num_coeffs = test_fir_filter->get_max_num_coefficients(chan);
+    const std::vector<int16_t> narrow(num_coeffs, 1);
+    const std::vector<int16_t> wide{3, 2, 1};
+    test_fir_filter->add_coefficient_set("narrow", narrow);
+    test_fir_filter->add_coefficient_set("wide", wide);
+    BOOST_CHECK(test_fir_filter->has_coefficient_set("narrow"));
+    BOOST_CHECK(!test_fir_filter->has_coefficient_set("medium"));
+    BOOST_CHECK_EQUAL(test_fir_filter->get_coefficient_sets().size(), 2);
+    BOOST_CHECK_EQUAL(test_fir_filter->get_coefficient_set(chan), "");
+
+    reg_iface->reset();
+    test_fir_filter->load_coefficient_set("wide", chan);
+    BOOST_CHECK_EQUAL(test_fir_filter->get_coefficient_set(chan), "wide");
+    BOOST_REQUIRE_EQUAL(reg_iface->coeffs.at(chan).size(), num_coeffs);
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).at(0), 3);
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).at(3), 0);
+    BOOST_CHECK_EQUAL(reg_iface->last_coeff_write_pos.at(chan), num_coeffs - 1);
+
+    // Loading the same set again does not touch the hardware
+    reg_iface->reset();
+    test_fir_filter->load_coefficient_set("wide", chan);
+    BOOST_CHECK(reg_iface->coeffs.at(chan).empty());
+
+    test_fir_filter->load_coefficient_set("narrow", chan);
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).size(), num_coeffs);
+    BOOST_CHECK(test_fir_filter->get_coefficients(chan) == narrow);
+
+    // Replacing a set, or setting coefficients directly, forces a reload
+    test_fir_filter->add_coefficient_set("narrow", wide);
+    BOOST_CHECK_EQUAL(test_fir_filter->get_coefficient_set(chan), "");
+    reg_iface->reset();
+    test_fir_filter->load_coefficient_set("narrow", chan);
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).size(), num_coeffs);
+    test_fir_filter->set_coefficients(narrow, chan);
+    BOOST_CHECK_EQUAL(test_fir_filter->get_coefficient_set(chan), "");
+
+    // Sets must fit into the largest channel, and into the channel they are
+    // loaded into
+    BOOST_CHECK_THROW(test_fir_filter->add_coefficient_set(
+                          "huge", std::vector<int16_t>(MAX_NUM_COEFFS.back() + 1)),
+        uhd::value_error);
+    BOOST_CHECK_THROW(test_fir_filter->load_coefficient_set("wide", 0), uhd::value_error);
+    BOOST_CHECK_THROW(
+        test_fir_filter->load_coefficient_set("medium", chan), uhd::key_error);
+
+    test_fir_filter->remove_coefficient_set("wide");
+    BOOST_CHECK(!test_fir_filter->has_coefficient_set("wide"));
+    BOOST_CHECK_THROW(test_fir_filter->remove_coefficient_set("wide"), uhd::key_error);
+}
+
 /*
  * This test case ensures that the FIR filter block can be added to
  * an RFNoC graph.
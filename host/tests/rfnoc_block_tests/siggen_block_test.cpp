@@ -51,6 +51,7 @@ public:
         if (port >= _num_ports) {
             throw uhd::assertion_error("Invalid port index");
         }
+        poke_offsets.push_back(addr % siggen_block_control::REG_BLOCK_SIZE);
 
         const size_t offset = addr % siggen_block_control::REG_BLOCK_SIZE;
         if (offset == siggen_block_control::REG_ENABLE_OFFSET) {
@@ -146,6 +147,7 @@ public:
     std::vector<uint32_t> constants;
     std::vector<uint32_t> phase_increments;
     std::vector<uint32_t> phasors;
+    std::vector<uint32_t> poke_offsets;
 };
 
 /*
@@ -312,6 +314,66 @@ BOOST_FIXTURE_TEST_CASE(siggen_test_ranges, siggen_block_fixture)
     }
 }
 
+/*
+ * This test case runs a sequence of waveform settings, and ensures that every
+ * step only writes the registers which change.
+ */
+BOOST_FIXTURE_TEST_CASE(siggen_test_sequence, siggen_block_fixture)
+{
+    const size_t port = 1;
+    std::vector<siggen_step_t> steps(3);
+    steps[0].amplitude = 0.5;
+    steps[0].phase_inc = uhd::math::PI / 8.0;
+    // Only the phase increment changes
+    steps[1].time      = uhd::time_spec_t(0.001);
+    steps[1].amplitude = 0.5;
+    steps[1].phase_inc = uhd::math::PI / 4.0;
+    steps[2].time      = uhd::time_spec_t(0.002);
+    steps[2].waveform  = siggen_waveform::NOISE;
+    steps[2].amplitude = 0.25;
+    steps[2].phase_inc = uhd::math::PI / 4.0;
+
+    // Invalid steps don't write anything
+    std::vector<siggen_step_t> bad_steps = steps;
+    bad_steps[2].amplitude               = 2.0;
+    reg_iface->poke_offsets.clear();
+    BOOST_CHECK_THROW(test_siggen->run_sequence(bad_steps, port), uhd::value_error);
+    bad_steps         = steps;
+    bad_steps[2].time = uhd::time_spec_t(0.0);
+    BOOST_CHECK_THROW(test_siggen->run_sequence(bad_steps, port), uhd::value_error);
+    bad_steps              = steps;
+    bad_steps[0].phase_inc = 4.0;
+    BOOST_CHECK_THROW(test_siggen->run_sequence(bad_steps, port), uhd::value_error);
+    BOOST_CHECK_THROW(test_siggen->run_sequence(steps, NUM_PORTS), uhd::value_error);
+    BOOST_CHECK(reg_iface->poke_offsets.empty());
+
+    // The steps write all their registers, then the phase increment, then the
+    // waveform and the gain. The final property resolution rewrites some more.
+    test_siggen->run_sequence(steps, port);
+    const std::vector<uint32_t> step_offsets{siggen_block_control::REG_WAVEFORM_OFFSET,
+        siggen_block_control::REG_CARTESIAN_OFFSET,
+        siggen_block_control::REG_GAIN_OFFSET,
+        siggen_block_control::REG_PHASE_INC_OFFSET,
+        siggen_block_control::REG_PHASE_INC_OFFSET,
+        siggen_block_control::REG_WAVEFORM_OFFSET,
+        siggen_block_control::REG_GAIN_OFFSET};
+    BOOST_REQUIRE_GE(reg_iface->poke_offsets.size(), step_offsets.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(step_offsets.begin(),
+        step_offsets.end(),
+        reg_iface->poke_offsets.begin(),
+        reg_iface->poke_offsets.begin() + step_offsets.size());
+    BOOST_CHECK(reg_iface->waveforms.at(port) == siggen_waveform::NOISE);
+    BOOST_CHECK_EQUAL(
+        reg_iface->gains.at(port), siggen_mock_reg_iface_t::gain_to_register(0.25));
+    BOOST_CHECK_EQUAL(reg_iface->phase_increments.at(port),
+        siggen_mock_reg_iface_t::phase_increment_to_register(uhd::math::PI / 4.0));
+    BOOST_CHECK_EQUAL(reg_iface->phasors.at(port),
+        siggen_mock_reg_iface_t::phasor_to_register({0.5, 0.0}));
+    BOOST_CHECK(test_siggen->get_waveform(port) == siggen_waveform::NOISE);
+    BOOST_CHECK_EQUAL(test_siggen->get_amplitude(port), 0.25);
+    BOOST_CHECK_EQUAL(test_siggen->get_sine_phase_increment(port), uhd::math::PI / 4.0);
+}
+
 /*
  * This test case exercises the coercion of the SPP parameter to ensure that
  * it does not surpass the MTU.
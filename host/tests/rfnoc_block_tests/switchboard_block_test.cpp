@@ -42,8 +42,10 @@ public:
     }
 
     void _poke_cb(
-        uint32_t addr, uint32_t data, uhd::time_spec_t /*time*/, bool /*ack*/) override
+        uint32_t addr, uint32_t data, uhd::time_spec_t time, bool /*ack*/) override
     {
+        num_pokes++;
+        last_time     = time;
         size_t chan   = addr / switchboard_block_control::REG_BLOCK_SIZE;
         size_t offset = addr % switchboard_block_control::REG_BLOCK_SIZE;
         if (offset == switchboard_block_control::REG_DEMUX_SELECT_ADDR) {
@@ -70,6 +72,8 @@ public:
 
     std::vector<uint32_t> input_select{};
     std::vector<uint32_t> output_select{};
+    size_t num_pokes           = 0;
+    uhd::time_spec_t last_time = uhd::time_spec_t::ASAP;
 };
 
 /* switchboard_block_fixture is a class which is instantiated before each test
@@ -133,6 +137,44 @@ BOOST_FIXTURE_TEST_CASE(swboard_test_exceptions, switchboard_block_fixture)
     BOOST_CHECK_EQUAL(reg_iface->input_select.at(0), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE(swboard_test_routes, switchboard_block_fixture)
+{
+    using route_t = switchboard_block_control::route_t;
+
+    // Invalid routes are rejected, and don't replace the valid ones
+    test_switchboard->set_routes({route_t{{0, 1}, {1, 0}}, route_t{{2, 3}}});
+    BOOST_CHECK_THROW(
+        test_switchboard->set_routes({route_t{{0, NUM_OUTPUTS}}}), uhd::value_error);
+    BOOST_CHECK_THROW(
+        test_switchboard->set_routes({route_t{{0, 1}, {0, 2}}}), uhd::value_error);
+    BOOST_CHECK_THROW(
+        test_switchboard->set_routes({route_t{{0, 1}, {2, 1}}}), uhd::value_error);
+    BOOST_REQUIRE_EQUAL(test_switchboard->get_num_routes(), 2);
+    BOOST_CHECK_THROW(test_switchboard->select_route(2), uhd::index_error);
+
+    // Selecting a route writes only the registers of its ports, at the
+    // requested time
+    const uhd::time_spec_t time(1.5);
+    reg_iface->num_pokes = 0;
+    test_switchboard->select_route(0, time);
+    BOOST_CHECK_EQUAL(reg_iface->num_pokes, 4);
+    BOOST_CHECK(reg_iface->last_time == time);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(0), 1);
+    BOOST_CHECK_EQUAL(reg_iface->input_select.at(1), 0);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(1), 0);
+    BOOST_CHECK_EQUAL(reg_iface->input_select.at(0), 1);
+    test_switchboard->select_route(1);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(2), 3);
+    BOOST_CHECK_EQUAL(reg_iface->input_select.at(3), 2);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(0), 1);
+
+    // The properties still select input 0 for output 0, so connect() must
+    // write the registers itself
+    test_switchboard->connect(0, 0);
+    BOOST_CHECK_EQUAL(reg_iface->output_select.at(0), 0);
+    BOOST_CHECK_EQUAL(reg_iface->input_select.at(0), 0);
+}
+
 BOOST_FIXTURE_TEST_CASE(swboard_test_graph, switchboard_block_fixture)
 {
     detail::graph_t graph{};
@@ -219,6 +219,65 @@ BOOST_FIXTURE_TEST_CASE(window_test_length_error, window_block_fixture)
     }
 }
 
+/*
+ * This test case exercises the coefficient set APIs, and ensures that loading
+ * a set only programs the hardware when the channel uses a different set.
+ */
+BOOST_FIXTURE_TEST_CASE(window_test_coefficient_sets, window_block_fixture)
+{
+    const size_t chan = 2;
+    const std::vector<int16_t> rect(MAX_LENS.at(chan), 1);
+    const std::vector<int16_t> hann{0, 16384, 32767, 16384, 0};
+    test_window->add_coefficient_set("rect", rect);
+    test_window->add_coefficient_set("hann", hann);
+    BOOST_CHECK(test_window->has_coefficient_set("rect"));
+    BOOST_CHECK(!test_window->has_coefficient_set("hamming"));
+    BOOST_CHECK_EQUAL(test_window->get_coefficient_sets().size(), 2);
+    BOOST_CHECK_EQUAL(test_window->get_coefficient_set(chan), "");
+
+    reg_iface->reset();
+    test_window->load_coefficient_set("hann", chan);
+    BOOST_CHECK_EQUAL(test_window->get_coefficient_set(chan), "hann");
+    BOOST_REQUIRE_EQUAL(reg_iface->coeffs.at(chan).size(), hann.size());
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).at(2), 32767);
+    BOOST_CHECK_EQUAL(reg_iface->num_coeffs.at(chan), hann.size());
+    BOOST_CHECK_EQUAL(reg_iface->last_coeff_write_pos.at(chan), hann.size() - 1);
+
+    // Loading the same set again does not touch the hardware
+    reg_iface->reset();
+    test_window->load_coefficient_set("hann", chan);
+    BOOST_CHECK(reg_iface->coeffs.at(chan).empty());
+
+    test_window->load_coefficient_set("rect", chan);
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).size(), rect.size());
+    BOOST_CHECK(test_window->get_coefficients(chan) == rect);
+
+    // Replacing a set, or setting coefficients directly, forces a reload
+    test_window->add_coefficient_set("rect", hann);
+    BOOST_CHECK_EQUAL(test_window->get_coefficient_set(chan), "");
+    reg_iface->reset();
+    test_window->load_coefficient_set("rect", chan);
+    BOOST_CHECK_EQUAL(reg_iface->coeffs.at(chan).size(), hann.size());
+    test_window->set_coefficients(rect, chan);
+    BOOST_CHECK_EQUAL(test_window->get_coefficient_set(chan), "");
+
+    // Sets must fit into the largest channel, and into the channel they are
+    // loaded into
+    BOOST_CHECK_THROW(
+        test_window->add_coefficient_set("huge", std::vector<int16_t>(3001)),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        test_window->add_coefficient_set("empty", std::vector<int16_t>()),
+        uhd::value_error);
+    test_window->add_coefficient_set("long", std::vector<int16_t>(100, 1));
+    BOOST_CHECK_THROW(test_window->load_coefficient_set("long", chan), uhd::value_error);
+    BOOST_CHECK_THROW(test_window->load_coefficient_set("hamming", chan), uhd::key_error);
+
+    test_window->remove_coefficient_set("hann");
+    BOOST_CHECK(!test_window->has_coefficient_set("hann"));
+    BOOST_CHECK_THROW(test_window->remove_coefficient_set("hann"), uhd::key_error);
+}
+
 /*
  * This test case ensures that the window block can be added to
  * an RFNoC graph.
@@ -1178,6 +1178,29 @@ BOOST_FIXTURE_TEST_CASE(zbx_tx_gain_profile_test, x400_radio_fixture)
     BOOST_CHECK_EQUAL(255.0, test_radio->set_tx_gain(1e9, "TABLE", 0));
 }
 
+BOOST_FIXTURE_TEST_CASE(x400_radio_periodic_stream_cmd_test, x400_radio_fixture)
+{
+    uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+    stream_cmd.num_samps  = size_t(test_radio->get_rate() / 1000); // 1 ms
+    stream_cmd.stream_now = false;
+    stream_cmd.time_spec  = uhd::time_spec_t(1.0);
+    // A window must fit into a period
+    BOOST_CHECK_THROW(
+        test_radio->issue_periodic_stream_cmd(stream_cmd, uhd::time_spec_t(0.0005), 0),
+        uhd::value_error);
+    // Windows need a start time
+    stream_cmd.stream_now = true;
+    BOOST_CHECK_THROW(
+        test_radio->issue_periodic_stream_cmd(stream_cmd, uhd::time_spec_t(0.01), 0),
+        uhd::value_error);
+    // Only finite acquisitions can be repeated
+    uhd::stream_cmd_t cont_cmd(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+    cont_cmd.stream_now = false;
+    BOOST_CHECK_THROW(
+        test_radio->issue_periodic_stream_cmd(cont_cmd, uhd::time_spec_t(0.01), 0),
+        uhd::value_error);
+}
+
 // TODO:
 // - concurrent/consecutive configuration
 // - Threading tests
@@ -116,6 +116,21 @@ public:
         return {};
     }
 
+    void set_cal_coefs(size_t, size_t, size_t, const std::string&) override
+    {
+        // nop
+    }
+
+    std::vector<std::vector<uint32_t>> get_cal_coefs(size_t, size_t, size_t) override
+    {
+        return {};
+    }
+
+    void reset_cal_coefs(size_t, size_t, size_t) override
+    {
+        // nop
+    }
+
     std::map<std::string, std::vector<uint8_t>> get_db_eeprom(const size_t) override
     {
         return {{
@@ -268,6 +283,11 @@ public:
         return {};
     }
 
+    std::map<std::string, sensor_value_t::sensor_map_t> get_all_mb_sensors() override
+    {
+        return {};
+    }
+
     void set_time_source(const std::string& /*source*/) override
     {
         // nop
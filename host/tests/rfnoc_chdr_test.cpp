@@ -10,6 +10,7 @@
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <boost/format.hpp>
 #include <boost/test/unit_test.hpp>
+#include <cstring>
 #include <iostream>
 
 using namespace uhd;
@@ -277,6 +278,86 @@ BOOST_AUTO_TEST_CASE(chdr_generic_packet_calculate_pyld_offset_64)
     }
 }
 
+BOOST_AUTO_TEST_CASE(chdr_parse_data_headers)
+{
+    constexpr size_t NUM_PKTS = 8;
+
+    auto test_parse = [](const chdr_packet_factory& factory) {
+        chdr_packet_writer::uptr tx_pkt  = factory.make_generic();
+        chdr_packet_writer::cuptr rx_pkt = factory.make_generic();
+
+        uint64_t buffs[NUM_PKTS][MAX_BUF_SIZE_WORDS];
+        const void* pkt_buffs[NUM_PKTS];
+        for (size_t i = 0; i < NUM_PKTS; i++) {
+            chdr_header header;
+            header.set_pkt_type(i % 2 ? PKT_TYPE_DATA_WITH_TS : PKT_TYPE_DATA_NO_TS);
+            header.set_num_mdata(i % 3);
+            header.set_seq_num(0xFFFC + i);
+            header.set_eob(i % 4 == 1);
+            header.set_eov(i % 4 == 2);
+            tx_pkt->refresh(buffs[i], header, 0x123456789ABCULL * i);
+            tx_pkt->update_payload_size(8 * i);
+            pkt_buffs[i] = buffs[i];
+        }
+
+        chdr_packet_writer::data_header_t headers[NUM_PKTS];
+        rx_pkt->parse_data_headers(pkt_buffs, NUM_PKTS, headers);
+
+        for (size_t i = 0; i < NUM_PKTS; i++) {
+            rx_pkt->refresh(pkt_buffs[i]);
+            const auto header    = rx_pkt->get_chdr_header();
+            const auto timestamp = rx_pkt->get_timestamp();
+            BOOST_CHECK_EQUAL(headers[i].payload, rx_pkt->get_payload_const_ptr());
+            BOOST_CHECK_EQUAL(headers[i].payload_size, rx_pkt->get_payload_size());
+            BOOST_CHECK_EQUAL(headers[i].payload_size, 8 * i);
+            BOOST_CHECK_EQUAL(headers[i].has_tsf, timestamp.is_initialized());
+            BOOST_CHECK_EQUAL(headers[i].tsf, timestamp ? *timestamp : 0);
+            BOOST_CHECK_EQUAL(headers[i].seq_num, header.get_seq_num());
+            BOOST_CHECK_EQUAL(headers[i].eob, header.get_eob());
+            BOOST_CHECK_EQUAL(headers[i].eov, header.get_eov());
+        }
+    };
+
+    test_parse(chdr64_be_factory);
+    test_parse(chdr256_be_factory);
+    test_parse(chdr64_le_factory);
+    test_parse(chdr256_le_factory);
+}
+
+BOOST_AUTO_TEST_CASE(chdr_write_data_header)
+{
+    auto test_write = [](const chdr_packet_factory& factory) {
+        chdr_packet_writer::uptr pkt = factory.make_generic();
+        for (const auto pkt_type : {PKT_TYPE_DATA_NO_TS, PKT_TYPE_DATA_WITH_TS}) {
+            uint64_t expected[MAX_BUF_SIZE_WORDS] = {};
+            uint64_t buff[MAX_BUF_SIZE_WORDS]     = {};
+            chdr_header header;
+            header.set_pkt_type(pkt_type);
+            header.set_seq_num(42);
+            header.set_eob(true);
+            chdr_header expected_header = header;
+
+            pkt->refresh(expected, expected_header, 0xABCDEF);
+            pkt->update_payload_size(100);
+            void* expected_payload = pkt->get_payload_ptr();
+
+            void* payload = pkt->write_data_header(buff, header, 0xABCDEF, 100);
+            BOOST_CHECK_EQUAL(std::memcmp(buff, expected, sizeof(buff)), 0);
+            BOOST_CHECK_EQUAL(
+                static_cast<uint8_t*>(payload) - reinterpret_cast<uint8_t*>(buff),
+                static_cast<uint8_t*>(expected_payload)
+                    - reinterpret_cast<uint8_t*>(expected));
+            BOOST_CHECK(header == pkt->get_chdr_header());
+            BOOST_CHECK(pkt->read_chdr_header(buff) == pkt->get_chdr_header());
+        }
+    };
+
+    test_write(chdr64_be_factory);
+    test_write(chdr256_be_factory);
+    test_write(chdr64_le_factory);
+    test_write(chdr256_le_factory);
+}
+
 
 BOOST_AUTO_TEST_CASE(chdr_mgmt_packet_no_swap_64)
 {
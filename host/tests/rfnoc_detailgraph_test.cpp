@@ -256,3 +256,96 @@ BOOST_AUTO_TEST_CASE(test_graph_disconnect_reconnect)
 
     BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 1);
 }
+
+BOOST_AUTO_TEST_CASE(test_graph_resolve_connected_only)
+{
+    graph_t graph{};
+    uhd::rfnoc::detail::graph_accessor_t graph_accessor(&graph);
+    node_accessor_t node_accessor{};
+
+    // Two independent channels: radio 0 -> radio 1, and radio 2 -> radio 3
+    mock_radio_node_t mock_rx_radio0(0);
+    mock_radio_node_t mock_tx_radio0(1);
+    mock_radio_node_t mock_rx_radio1(2);
+    mock_radio_node_t mock_tx_radio1(3);
+
+    node_accessor.init_props(&mock_rx_radio0);
+    node_accessor.init_props(&mock_tx_radio0);
+    node_accessor.init_props(&mock_rx_radio1);
+    node_accessor.init_props(&mock_tx_radio1);
+
+    uhd::rfnoc::detail::graph_t::graph_edge_t edge_info(
+        0, 0, graph_t::graph_edge_t::DYNAMIC, true);
+    graph.connect(&mock_rx_radio0, &mock_tx_radio0, edge_info);
+    graph.connect(&mock_rx_radio1, &mock_tx_radio1, edge_info);
+    graph.commit();
+    BOOST_CHECK_EQUAL(graph_accessor.get_topo_sorted_nodes().size(), 4);
+
+    // Changing a property on one channel must only resolve that channel
+    const size_t rssi_count0 = mock_rx_radio0.rssi_resolver_count;
+    const size_t rssi_count1 = mock_rx_radio1.rssi_resolver_count;
+    mock_rx_radio0.set_property<double>("rssi", 42.0, 0);
+    BOOST_CHECK_GT(mock_rx_radio0.rssi_resolver_count, rssi_count0);
+    BOOST_CHECK_EQUAL(mock_rx_radio1.rssi_resolver_count, rssi_count1);
+    BOOST_CHECK(graph_accessor.find_dirty_nodes().empty());
+
+    // Connecting the channels invalidates the cached order
+    graph.connect(&mock_tx_radio0, &mock_rx_radio1, edge_info);
+    BOOST_CHECK_EQUAL(graph_accessor.get_topo_sorted_nodes().size(), 4);
+    BOOST_CHECK(graph_accessor.get_topo_sorted_nodes().back() == &mock_tx_radio1);
+}
+
+BOOST_AUTO_TEST_CASE(test_graph_dynamic_reconfig)
+{
+    graph_t graph{};
+    uhd::rfnoc::detail::graph_accessor_t graph_accessor(&graph);
+    node_accessor_t node_accessor{};
+
+    // Three channels: radio 0 -> radio 1, radio 2 -> radio 3, radio 4 -> radio 5
+    std::vector<std::unique_ptr<mock_radio_node_t>> radios;
+    for (size_t i = 0; i < 6; i++) {
+        radios.emplace_back(new mock_radio_node_t(i));
+        node_accessor.init_props(radios.back().get());
+    }
+    auto get_rssi_counts = [&radios]() {
+        std::vector<size_t> counts;
+        for (const auto& radio : radios) {
+            counts.push_back(radio->rssi_resolver_count);
+        }
+        return counts;
+    };
+
+    uhd::rfnoc::detail::graph_t::graph_edge_t edge_info(
+        0, 0, graph_t::graph_edge_t::DYNAMIC, true);
+    graph.connect(radios[0].get(), radios[1].get(), edge_info);
+    graph.connect(radios[2].get(), radios[3].get(), edge_info);
+    graph.connect(radios[4].get(), radios[5].get(), edge_info);
+    graph.commit();
+    graph.set_dynamic_reconfig(true);
+
+    // Swap the destinations of the first two channels. All rates match, so
+    // no node needs to be resolved.
+    const auto counts = get_rssi_counts();
+    graph.release();
+    graph.disconnect(radios[0].get(), radios[1].get(), edge_info);
+    graph.disconnect(radios[2].get(), radios[3].get(), edge_info);
+    graph.connect(radios[0].get(), radios[3].get(), edge_info);
+    graph.connect(radios[2].get(), radios[1].get(), edge_info);
+    graph.commit();
+    BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 3);
+    BOOST_CHECK(get_rssi_counts() == counts);
+    BOOST_CHECK(graph_accessor.find_dirty_nodes().empty());
+
+    // Adding a node requires a full commit, which resolves all nodes
+    mock_radio_node_t new_radio(6);
+    node_accessor.init_props(&new_radio);
+    graph.release();
+    graph.connect(radios[5].get(), &new_radio, edge_info);
+    graph.commit();
+    BOOST_CHECK_EQUAL(graph.enumerate_edges().size(), 4);
+    const auto new_counts = get_rssi_counts();
+    for (size_t i = 0; i < radios.size(); i++) {
+        BOOST_CHECK_GT(new_counts[i], counts[i]);
+    }
+    BOOST_CHECK(graph_accessor.find_dirty_nodes().empty());
+}
@@ -0,0 +1,378 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/rfnoc/node.hpp>
+#include <uhd/rfnoc/property.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/rfnoc/graph.hpp>
+#include <uhdlib/rfnoc/node_accessor.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd::rfnoc;
+using detail::graph_t;
+
+/*!
+ * Node of the synthetic graphs
+ *
+ * Every node has one input and one output port, with num_props edge
+ * properties on either. Each output property is the matching input property
+ * plus the user property "offset", so changing the offset of a node changes
+ * the properties of all the nodes downstream of it.
+ */
+class bench_node_t : public node_t
+{
+public:
+    bench_node_t(const size_t idx, const size_t num_props) : _idx(idx)
+    {
+        set_prop_forwarding_policy(forwarding_policy_t::DROP);
+        set_action_forwarding_policy(forwarding_policy_t::DROP);
+        register_property(&_offset);
+        for (size_t i = 0; i < num_props; i++) {
+            const std::string id = "prop" + std::to_string(i);
+            _props_in.emplace_back(id, 0.0, res_source_info{res_source_info::INPUT_EDGE});
+            _props_out.emplace_back(
+                id, 0.0, res_source_info{res_source_info::OUTPUT_EDGE});
+            auto& prop_in  = _props_in.back();
+            auto& prop_out = _props_out.back();
+            register_property(&prop_in);
+            register_property(&prop_out);
+            add_property_resolver({&prop_in, &_offset},
+                {&prop_out},
+                [this, &prop_in, &prop_out]() {
+                    prop_out = prop_in.get() + _offset.get();
+                });
+        }
+    }
+
+    std::string get_unique_id() const override
+    {
+        return "BENCH" + std::to_string(_idx);
+    }
+
+    size_t get_num_input_ports() const override
+    {
+        return 1;
+    }
+
+    size_t get_num_output_ports() const override
+    {
+        return 1;
+    }
+
+private:
+    const size_t _idx;
+    property_t<double> _offset{"offset", 0.0, {res_source_info::USER}};
+    // Deques, because the nodes keep pointers to the properties
+    std::deque<property_t<double>> _props_in;
+    std::deque<property_t<double>> _props_out;
+};
+
+/*!
+ * Nodes of a synthetic graph: num_chains parallel chains of chain_len nodes
+ */
+class bench_nodes_t
+{
+public:
+    bench_nodes_t(const size_t num_chains, const size_t chain_len, const size_t num_props)
+        : _chain_len(chain_len)
+    {
+        node_accessor_t node_accessor{};
+        for (size_t i = 0; i < num_chains * chain_len; i++) {
+            _nodes.emplace_back(new bench_node_t(i, num_props));
+            // This would normally be done by the framework
+            node_accessor.init_props(_nodes.back().get());
+        }
+    }
+
+    bench_node_t* get(const size_t chain, const size_t idx)
+    {
+        return _nodes.at(chain * _chain_len + idx).get();
+    }
+
+    bench_node_t* get_head()
+    {
+        return _nodes.front().get();
+    }
+
+    bench_node_t* get_tail()
+    {
+        return _nodes.back().get();
+    }
+
+    static graph_t::graph_edge_t make_edge()
+    {
+        return graph_t::graph_edge_t(0, 0, graph_t::graph_edge_t::DYNAMIC, true);
+    }
+
+    void connect_all(graph_t& graph)
+    {
+        for (size_t chain = 0; chain < _nodes.size() / _chain_len; chain++) {
+            for (size_t i = 0; i + 1 < _chain_len; i++) {
+                graph.connect(get(chain, i), get(chain, i + 1), make_edge());
+            }
+        }
+    }
+
+    //! Disconnect and reconnect the middle edge of the first chain
+    void reconnect_middle(graph_t& graph)
+    {
+        const size_t idx = _chain_len / 2 - 1;
+        graph.disconnect(get(0, idx), get(0, idx + 1), make_edge());
+        graph.connect(get(0, idx), get(0, idx + 1), make_edge());
+    }
+
+private:
+    const size_t _chain_len;
+    std::vector<std::unique_ptr<bench_node_t>> _nodes;
+};
+
+struct benchmark_t
+{
+    std::string name;
+    size_t num_nodes;
+    //! Run the given number of iterations, and return the time they took
+    std::function<double(size_t)> run;
+};
+
+struct benchmark_result_t
+{
+    std::string name;
+    size_t num_nodes;
+    size_t iterations;
+    double elapsed_time;
+
+    double get_us_per_iteration() const
+    {
+        return elapsed_time / iterations * 1e6;
+    }
+
+    double get_ns_per_node() const
+    {
+        return get_us_per_iteration() * 1e3 / num_nodes;
+    }
+};
+
+//! Return the time it takes to call \p fn \p iterations times
+static double time_loop(const size_t iterations, const std::function<void(size_t)>& fn)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        fn(i);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+        .count();
+}
+
+static std::vector<benchmark_t> make_benchmarks(const size_t num_props)
+{
+    std::vector<benchmark_t> benchmarks;
+    auto add_benchmarks = [&](const std::string& prefix,
+                              const size_t num_chains,
+                              const size_t chain_len) {
+        const size_t num_nodes = num_chains * chain_len;
+
+        auto add = [&](const std::string& op, std::function<double(size_t)> run) {
+            benchmarks.push_back({prefix + "/" + op, num_nodes, std::move(run)});
+        };
+
+        // Connect all edges of a new graph, and commit it
+        add("build", [=](size_t iterations) {
+            bench_nodes_t nodes(num_chains, chain_len, num_props);
+            return time_loop(iterations, [&](size_t) {
+                graph_t graph{};
+                nodes.connect_all(graph);
+                graph.commit();
+            });
+        });
+        // Commit a graph without changes, which resolves all of its properties
+        add("commit", [=](size_t iterations) {
+            bench_nodes_t nodes(num_chains, chain_len, num_props);
+            graph_t graph{};
+            nodes.connect_all(graph);
+            graph.commit();
+            return time_loop(iterations, [&](size_t) {
+                graph.release();
+                graph.commit();
+            });
+        });
+        // Change a property of the first node, which changes the properties of
+        // its whole chain, and of the last node, which changes nothing else
+        for (const bool head : {true, false}) {
+            add(head ? "set_head" : "set_tail", [=](size_t iterations) {
+                bench_nodes_t nodes(num_chains, chain_len, num_props);
+                graph_t graph{};
+                nodes.connect_all(graph);
+                graph.commit();
+                bench_node_t* node = head ? nodes.get_head() : nodes.get_tail();
+                return time_loop(iterations, [&](size_t i) {
+                    node->set_property<double>("offset", double(i + 1));
+                });
+            });
+        }
+        // Remove and add an edge, and commit the graph
+        for (const bool dynamic : {false, true}) {
+            add(dynamic ? "reconnect_dynamic" : "reconnect", [=](size_t iterations) {
+                bench_nodes_t nodes(num_chains, chain_len, num_props);
+                graph_t graph{};
+                graph.set_dynamic_reconfig(dynamic);
+                nodes.connect_all(graph);
+                graph.commit();
+                return time_loop(iterations, [&](size_t) {
+                    graph.release();
+                    nodes.reconnect_middle(graph);
+                    graph.commit();
+                });
+            });
+        }
+    };
+
+    for (const size_t num_nodes : {10, 100, 500}) {
+        add_benchmarks("chain" + std::to_string(num_nodes), 1, num_nodes);
+    }
+    for (const size_t num_chains : {10, 50}) {
+        add_benchmarks("chains" + std::to_string(num_chains) + "x10", num_chains, 10);
+    }
+    return benchmarks;
+}
+
+/*!
+ * Run a benchmark for at least min_time seconds. The number of iterations is
+ * doubled until a run takes a tenth of that, and then scaled to min_time.
+ */
+static benchmark_result_t run_benchmark(
+    const benchmark_t& benchmark, const double min_time)
+{
+    size_t iterations = 1;
+    while (true) {
+        const double elapsed_time = benchmark.run(iterations);
+        if (elapsed_time >= min_time) {
+            return {benchmark.name, benchmark.num_nodes, iterations, elapsed_time};
+        }
+        if (elapsed_time < min_time / 10) {
+            iterations *= 2;
+        } else {
+            iterations =
+                std::max(iterations + 1, size_t(iterations * min_time / elapsed_time));
+        }
+    }
+}
+
+static void print_result(const benchmark_result_t& result, const std::string& format)
+{
+    if (format == "csv") {
+        std::cout << boost::format("%s,%u,%u,%.3f,%.1f\n") % result.name
+                         % result.num_nodes % result.iterations
+                         % result.get_us_per_iteration() % result.get_ns_per_node();
+    } else if (format == "json") {
+        std::cout << boost::format("    {\"name\": \"%s\", \"num_nodes\": %u, "
+                                   "\"iterations\": %u, \"us_per_iteration\": %.3f, "
+                                   "\"ns_per_node\": %.1f}")
+                         % result.name % result.num_nodes % result.iterations
+                         % result.get_us_per_iteration() % result.get_ns_per_node();
+    } else {
+        std::cout << boost::format("%-32s %8u %12.3f us %12.1f ns %12u\n")
+                         % result.name % result.num_nodes
+                         % result.get_us_per_iteration() % result.get_ns_per_node()
+                         % result.iterations;
+    }
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string filter, format;
+    double min_time;
+    size_t num_props;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("list", "list the benchmarks and exit")
+        ("filter", po::value<std::string>(&filter)->default_value(".*"), "only run the benchmarks whose names match this regular expression")
+        ("min_time", po::value<double>(&min_time)->default_value(0.1), "minimum run time of every benchmark in seconds (0 to run every benchmark once)")
+        ("num_props", po::value<size_t>(&num_props)->default_value(4), "number of edge properties per port of every node")
+        ("format", po::value<std::string>(&format)->default_value("console"), "output format: console, csv, or json")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD RFNoC Graph Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of the property propagation of RFNoC graphs\n"
+                     "    All benchmarks use synthetic graphs of mock nodes. No\n"
+                     "    parameters are needed to run this benchmark.\n"
+                     "    The benchmarks are named <topology>/<operation>. chainN is\n"
+                     "    one chain of N nodes, chainsMx10 are M parallel chains of\n"
+                     "    10 nodes. The operations are:\n"
+                     "      build:     connect all edges of a new graph and commit it\n"
+                     "      commit:    release and commit the unchanged graph\n"
+                     "      set_head:  set a property of the first node, which\n"
+                     "                 changes the properties of its whole chain\n"
+                     "      set_tail:  set a property of the last node\n"
+                     "      reconnect: remove and add an edge, and commit the graph\n"
+                     "                 (_dynamic: with dynamic reconfiguration)\n"
+                     "    Compare the time per node of the topologies to see how the\n"
+                     "    operations scale with the size of the graph.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (format != "console" and format != "csv" and format != "json") {
+        std::cout << "Invalid output format: " << format << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::regex filter_regex(filter);
+    std::vector<benchmark_t> benchmarks;
+    for (const auto& benchmark : make_benchmarks(num_props)) {
+        if (std::regex_search(benchmark.name, filter_regex)) {
+            benchmarks.push_back(benchmark);
+        }
+    }
+    if (vm.count("list")) {
+        for (const auto& benchmark : benchmarks) {
+            std::cout << benchmark.name << std::endl;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (format == "csv") {
+        std::cout << "name,num_nodes,iterations,us_per_iteration,ns_per_node\n";
+    } else if (format == "json") {
+        std::cout << "{\n  \"benchmarks\": [\n";
+    } else {
+        std::cout << boost::format("%-32s %8s %15s %15s %12s\n") % "Benchmark" % "Nodes"
+                         % "Time/call" % "Time/node" % "Iterations"
+                  << std::string(86, '-') << std::endl;
+    }
+    bool first = true;
+    for (const auto& benchmark : benchmarks) {
+        if (format == "json" and not first) {
+            std::cout << ",\n";
+        }
+        print_result(run_benchmark(benchmark, min_time), format);
+        first = false;
+    }
+    if (format == "json") {
+        std::cout << "\n  ]\n}\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,81 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/usrp/rx_power_sweep.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+using namespace uhd::usrp;
+
+namespace {
+
+using fc32_t = std::complex<float>;
+
+//! The variance of the samples in dB, computed in double precision
+double reference_power_dbfs(const std::vector<fc32_t>& samps)
+{
+    std::complex<double> mean = 0.0;
+    for (const auto& samp : samps) {
+        mean += std::complex<double>(samp);
+    }
+    mean /= static_cast<double>(samps.size());
+    double variance = 0.0;
+    for (const auto& samp : samps) {
+        variance += std::norm(std::complex<double>(samp) - mean);
+    }
+    return 10.0 * std::log10(variance / samps.size());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_get_power_dbfs)
+{
+    // A full-scale tone is 0 dBFS, also with a DC offset
+    std::vector<fc32_t> tone(100000);
+    for (size_t i = 0; i < tone.size(); i++) {
+        tone[i] = std::polar(1.0f, 0.01f * i) + fc32_t(0.25f, -0.125f);
+    }
+    BOOST_CHECK_SMALL(get_power_dbfs(tone.data(), tone.size()), 0.01);
+
+    // Odd lengths which don't fill the blocks or the SIMD registers
+    for (const size_t num_samps : {1, 3, 7, 4095, 4097, 10001}) {
+        std::vector<fc32_t> samps(num_samps);
+        for (size_t i = 0; i < samps.size(); i++) {
+            samps[i] = fc32_t(0.1f * std::cos(0.3f * i) + 0.01f * (i % 5),
+                0.05f * std::sin(0.7f * i));
+        }
+        if (num_samps == 1) {
+            BOOST_CHECK_EQUAL(get_power_dbfs(samps.data(), samps.size()),
+                -std::numeric_limits<double>::infinity());
+            continue;
+        }
+        BOOST_CHECK_CLOSE(get_power_dbfs(samps.data(), samps.size()),
+            reference_power_dbfs(samps),
+            0.01);
+    }
+
+    BOOST_CHECK_EQUAL(
+        get_power_dbfs(nullptr, 0), -std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE(test_add_power_tables)
+{
+    auto cal = cal::pwr_cal::make("Test Power Cal", "ABC1234", 0);
+    rx_power_sweep::results_t results;
+    results[1e9] = {{0.0, -5.0}, {10.0, -15.0}, {20.0, -25.0}};
+    results[2e9] = {{0.0, -7.0}, {10.0, -17.0}, {20.0, -27.0}};
+    results[3e9] = {};
+    rx_power_sweep::add_power_tables(cal, results);
+
+    const auto limits = cal->get_power_limits(1e9);
+    BOOST_CHECK_EQUAL(limits.start(), -25.0);
+    BOOST_CHECK_EQUAL(limits.stop(), -5.0);
+    BOOST_CHECK_CLOSE(cal->get_power(10.0, 2e9), -17.0, 1e-6);
+    BOOST_CHECK_CLOSE(cal->get_power(10.0, 1.5e9), -16.0, 1e-6);
+}
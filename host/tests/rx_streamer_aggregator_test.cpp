@@ -0,0 +1,165 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/rx_streamer_aggregator.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr double RATE = 1e6;
+
+//! Streams the tick count of every sample, so aligned samples are equal
+class mock_rx_streamer : public uhd::rx_streamer
+{
+public:
+    mock_rx_streamer(const size_t num_chans, const size_t spp, const int64_t first_tick)
+        : _num_chans(num_chans), _spp(spp), _tick(first_tick)
+    {
+    }
+
+    size_t get_num_channels(void) const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps(void) const override
+    {
+        return _spp;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        const double,
+        const bool) override
+    {
+        metadata.reset();
+        if (_num_packets == gap_at_packet) {
+            // The packet is lost without any notice
+            _tick += _spp;
+        }
+        const size_t num_samps = std::min(nsamps_per_buff, _spp);
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            uint32_t* buff = static_cast<uint32_t*>(buffs[chan]);
+            for (size_t i = 0; i < num_samps; i++) {
+                buff[i] = uint32_t(_tick + i);
+            }
+        }
+        metadata.has_time_spec  = true;
+        metadata.time_spec      = uhd::time_spec_t::from_ticks(_tick, RATE);
+        metadata.start_of_burst = _num_packets == 0;
+        _tick += num_samps;
+        _num_packets++;
+        return num_samps;
+    }
+
+    void issue_stream_cmd(const uhd::stream_cmd_t&) override
+    {
+        num_stream_cmds++;
+    }
+
+    size_t gap_at_packet   = size_t(~0);
+    size_t num_stream_cmds = 0;
+
+private:
+    const size_t _num_chans;
+    const size_t _spp;
+    int64_t _tick;
+    size_t _num_packets = 0;
+};
+
+//! Receive from the aggregator, and check that all channels are equal
+size_t recv_aligned(uhd::rx_streamer& streamer,
+    std::vector<std::vector<uint32_t>>& buffs,
+    uhd::rx_metadata_t& md)
+{
+    std::vector<void*> buff_ptrs;
+    for (auto& buff : buffs) {
+        buff_ptrs.push_back(buff.data());
+    }
+    const size_t num_samps = streamer.recv(buff_ptrs, buffs.front().size(), md);
+    for (size_t chan = 1; chan < buffs.size(); chan++) {
+        BOOST_REQUIRE(std::equal(buffs[0].begin(),
+            buffs[0].begin() + num_samps,
+            buffs[chan].begin()));
+    }
+    return num_samps;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_aggregator_alignment)
+{
+    auto streamer0 = std::make_shared<mock_rx_streamer>(2, 100, 1000);
+    auto streamer1 = std::make_shared<mock_rx_streamer>(1, 64, 1037);
+
+    auto aggregator =
+        uhd::rx_streamer_aggregator::make({streamer0, streamer1}, "sc16", RATE);
+    BOOST_CHECK_EQUAL(aggregator->get_num_channels(), 3);
+    BOOST_CHECK_EQUAL(aggregator->get_max_num_samps(), 64);
+
+    aggregator->issue_stream_cmd(
+        uhd::stream_cmd_t(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS));
+    BOOST_CHECK_EQUAL(streamer0->num_stream_cmds, 1);
+    BOOST_CHECK_EQUAL(streamer1->num_stream_cmds, 1);
+
+    std::vector<std::vector<uint32_t>> buffs(3, std::vector<uint32_t>(500));
+    uhd::rx_metadata_t md;
+    uint32_t next_tick = 1037;
+    for (size_t i = 0; i < 5; i++) {
+        BOOST_REQUIRE_EQUAL(recv_aligned(*aggregator, buffs, md), 500);
+        BOOST_CHECK_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK_EQUAL(md.start_of_burst, i == 0);
+        BOOST_CHECK(md.has_time_spec);
+        BOOST_CHECK_EQUAL(md.time_spec.to_ticks(RATE), next_tick);
+        BOOST_CHECK_EQUAL(buffs[0].front(), next_tick);
+        BOOST_CHECK_EQUAL(buffs[0].back(), next_tick + 499);
+        next_tick += 500;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregator_gap)
+{
+    auto streamer0           = std::make_shared<mock_rx_streamer>(1, 100, 0);
+    auto streamer1           = std::make_shared<mock_rx_streamer>(1, 100, 0);
+    streamer1->gap_at_packet = 5;
+
+    auto aggregator =
+        uhd::rx_streamer_aggregator::make({streamer0, streamer1}, "sc16", RATE);
+
+    std::vector<std::vector<uint32_t>> buffs(2, std::vector<uint32_t>(300));
+    uhd::rx_metadata_t md;
+    BOOST_REQUIRE_EQUAL(recv_aligned(*aggregator, buffs, md), 300);
+    // The gap ends the second call early
+    BOOST_CHECK_EQUAL(recv_aligned(*aggregator, buffs, md), 200);
+    BOOST_CHECK_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+    BOOST_CHECK(md.out_of_sequence);
+    const auto streamer_md = aggregator->get_streamer_metadata();
+    BOOST_REQUIRE_EQUAL(streamer_md.size(), 2);
+    BOOST_CHECK_EQUAL(streamer_md[0].error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(
+        streamer_md[1].error_code, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+
+    // Afterwards, the samples of streamer0 up to the gap are dropped
+    BOOST_REQUIRE_EQUAL(recv_aligned(*aggregator, buffs, md), 300);
+    BOOST_CHECK_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(md.time_spec.to_ticks(RATE), 600);
+    BOOST_CHECK_EQUAL(buffs[0].front(), 600);
+}
+
+BOOST_AUTO_TEST_CASE(test_aggregator_invalid_args)
+{
+    auto streamer = std::make_shared<mock_rx_streamer>(1, 100, 0);
+    BOOST_CHECK_THROW(
+        uhd::rx_streamer_aggregator::make({}, "sc16", RATE), uhd::value_error);
+    BOOST_CHECK_THROW(
+        uhd::rx_streamer_aggregator::make({streamer}, "sc16", 0.0), uhd::value_error);
+}
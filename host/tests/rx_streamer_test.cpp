@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "../common/alloc_counter.hpp"
 #include "../common/mock_link.hpp"
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <boost/test/unit_test.hpp>
@@ -84,6 +85,10 @@ public:
             throw uhd::value_error("Bad header or invalid packet length.");
         }
 
+        if (!_seq_num_valid) {
+            _seq_num       = header.seq_num;
+            _seq_num_valid = true;
+        }
         const bool seq_match = header.seq_num == _seq_num;
         const bool seq_error = !header.ignore_seq && !seq_match;
         _seq_num             = header.seq_num + 1;
@@ -96,6 +101,11 @@ public:
         _recv_link->release_recv_buff(std::move(buff));
     }
 
+    void reset_seq_num()
+    {
+        _seq_num_valid = false;
+    }
+
     size_t get_mtu() const
     {
         return _recv_link->get_recv_frame_size();
@@ -113,7 +123,8 @@ public:
 
 private:
     mock_recv_link::sptr _recv_link;
-    size_t _seq_num = 0;
+    size_t _seq_num     = 0;
+    bool _seq_num_valid = true;
 };
 
 /*!
@@ -175,9 +186,11 @@ static std::vector<mock_recv_link::sptr> make_links(const size_t num)
 static std::shared_ptr<mock_rx_streamer> make_rx_streamer(
     std::vector<mock_recv_link::sptr> recv_links,
     const std::string& host_format,
-    const std::string& otw_format = "sc16")
+    const std::string& otw_format  = "sc16",
+    const uhd::device_addr_t& args = uhd::device_addr_t())
 {
-    const uhd::stream_args_t stream_args(host_format, otw_format);
+    uhd::stream_args_t stream_args(host_format, otw_format);
+    stream_args.args = args;
     auto streamer = std::make_shared<mock_rx_streamer>(recv_links.size(), stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
@@ -397,6 +410,426 @@ BOOST_AUTO_TEST_CASE(test_recv_two_channel_one_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_multi_channel_convert_threads)
+{
+    const size_t NUM_PKTS_TO_TEST = 5;
+    const std::string format("sc16");
+
+    const size_t num_chans = 4;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(
+        recv_links, format, "sc16", uhd::device_addr_t("convert_threads=3"));
+
+    // Receive each packet in two fragments to also cover the buffer offsets
+    const size_t num_samps     = 20;
+    const size_t fragment_size = 12;
+
+    std::vector<std::vector<std::complex<uint16_t>>> buffer(num_chans);
+    std::vector<void*> buffers;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        buffer[ch].resize(num_samps);
+        buffers.push_back(&buffer[ch].front());
+    }
+
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        mock_header_t header;
+        header.eob     = false;
+        header.has_tsf = true;
+        header.tsf     = i;
+
+        size_t samps_pushed = 0;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            push_back_recv_packet(recv_links[ch], header, num_samps, samps_pushed);
+            samps_pushed += num_samps;
+        }
+
+        size_t num_samps_ret =
+            streamer->recv(buffers, fragment_size, metadata, 1.0, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, fragment_size);
+        BOOST_CHECK(metadata.more_fragments);
+
+        std::vector<void*> offset_buffers;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            offset_buffers.push_back(&buffer[ch][fragment_size]);
+        }
+        num_samps_ret = streamer->recv(
+            offset_buffers, num_samps - fragment_size, metadata, 1.0, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, num_samps - fragment_size);
+        BOOST_CHECK(!metadata.more_fragments);
+
+        size_t samps_checked = 0;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            for (size_t samp = 0; samp < num_samps; samp++) {
+                const size_t n   = samps_checked + samp;
+                const auto value = std::complex<uint16_t>((n * 2), (n * 2 + 1));
+                BOOST_CHECK_EQUAL(value, buffer[ch][samp]);
+            }
+            samps_checked += num_samps;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_interleaved_channels)
+{
+    const size_t num_chans = 3;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(
+        recv_links, "sc16", "sc16", uhd::device_addr_t("channel_layout=interleaved"));
+    BOOST_CHECK_THROW(make_rx_streamer(recv_links,
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("channel_layout=planar")),
+        uhd::value_error);
+    BOOST_CHECK_THROW(make_rx_streamer(recv_links,
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t(
+                              "channel_layout=interleaved,host_keep_one_in_n=2")),
+        uhd::value_error);
+
+    // Receive the packets in two fragments to also cover the buffer offset
+    const size_t num_samps     = 20;
+    const size_t fragment_size = 12;
+
+    mock_header_t header;
+    header.has_tsf = true;
+    header.tsf     = 0;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        push_back_recv_packet(recv_links[ch], header, num_samps, ch * num_samps);
+    }
+
+    std::vector<std::complex<uint16_t>> buffer(num_chans * num_samps);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buffer.data(), fragment_size, metadata, 1.0, false),
+        fragment_size);
+    BOOST_CHECK(metadata.more_fragments);
+    BOOST_CHECK_EQUAL(streamer->recv(&buffer[num_chans * fragment_size],
+                          num_samps - fragment_size,
+                          metadata,
+                          1.0,
+                          false),
+        num_samps - fragment_size);
+    BOOST_CHECK(!metadata.more_fragments);
+
+    for (size_t samp = 0; samp < num_samps; samp++) {
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            const size_t n   = ch * num_samps + samp;
+            const auto value = std::complex<uint16_t>((n * 2), (n * 2 + 1));
+            BOOST_CHECK_EQUAL(value, buffer[samp * num_chans + ch]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_host_fft)
+{
+    constexpr size_t FFT_LENGTH = 8;
+    constexpr size_t NUM_SAMPS  = 4 * FFT_LENGTH;
+
+    auto recv_links   = make_links(2);
+    auto streamer     = make_rx_streamer({recv_links[0]}, "fc32");
+    auto fft_streamer = make_rx_streamer({recv_links[1]},
+        "fc32",
+        "sc16",
+        uhd::device_addr_t("host_fft_length=8,host_fft_shift=natural"));
+    BOOST_CHECK_THROW(make_rx_streamer({recv_links[1]},
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("host_fft_length=8")),
+        uhd::value_error);
+
+    mock_header_t header;
+    header.has_tsf = true;
+    // Two packets, which are received in one call
+    for (size_t i = 0; i < 2; i++) {
+        for (const auto& link : recv_links) {
+            push_back_recv_packet(link, header, NUM_SAMPS / 2, i * NUM_SAMPS / 2);
+        }
+    }
+
+    std::vector<std::complex<float>> samps(NUM_SAMPS);
+    std::vector<std::complex<float>> bins(NUM_SAMPS);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), NUM_SAMPS, metadata, 1.0, false), NUM_SAMPS);
+    // Only whole frames can be received
+    BOOST_CHECK_THROW(
+        fft_streamer->recv(bins.data(), NUM_SAMPS - 1, metadata, 1.0, false),
+        uhd::value_error);
+    BOOST_CHECK_EQUAL(
+        fft_streamer->recv(bins.data(), NUM_SAMPS, metadata, 1.0, false), NUM_SAMPS);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+
+    auto fft = uhd::rfnoc::host_fft::make(FFT_LENGTH);
+    fft->set_shift_config(uhd::rfnoc::fft_shift::NATURAL);
+    fft->process(samps.data(), samps.data(), NUM_SAMPS / FFT_LENGTH);
+    for (size_t i = 0; i < NUM_SAMPS; i++) {
+        BOOST_CHECK_EQUAL(bins[i], samps[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_host_averages)
+{
+    constexpr size_t NUM_SAMPS = 40;
+
+    auto recv_links   = make_links(2);
+    auto streamer     = make_rx_streamer({recv_links[0]}, "fc32");
+    auto avg_streamer = make_rx_streamer({recv_links[1]},
+        "fc32",
+        "sc16",
+        uhd::device_addr_t("host_vector_iir_delay=8,host_moving_average_sum_len=4"));
+    BOOST_CHECK_THROW(make_rx_streamer({recv_links[1]},
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("host_moving_average_sum_len=4")),
+        uhd::value_error);
+    BOOST_CHECK_THROW(make_rx_streamer({recv_links[1]},
+                          "fc32",
+                          "sc16",
+                          uhd::device_addr_t("host_moving_average_sum_len=256")),
+        uhd::value_error);
+
+    mock_header_t header;
+    header.has_tsf = true;
+    for (size_t i = 0; i < 2; i++) {
+        for (const auto& link : recv_links) {
+            push_back_recv_packet(link, header, NUM_SAMPS / 2, i * NUM_SAMPS / 2);
+        }
+    }
+
+    std::vector<std::complex<float>> samps(NUM_SAMPS);
+    std::vector<std::complex<float>> averages(NUM_SAMPS);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), NUM_SAMPS, metadata, 1.0, false), NUM_SAMPS);
+    BOOST_CHECK_EQUAL(
+        avg_streamer->recv(averages.data(), NUM_SAMPS, metadata, 1.0, false),
+        NUM_SAMPS);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+
+    // The IIR runs first, then the average (default divisor: the sum length)
+    uhd::rfnoc::host_vector_iir::make(8)->process(samps.data(), samps.data(), NUM_SAMPS);
+    uhd::rfnoc::host_moving_average::make(4, 4)->process(
+        samps.data(), samps.data(), NUM_SAMPS);
+    for (size_t i = 0; i < NUM_SAMPS; i++) {
+        BOOST_CHECK_EQUAL(averages[i], samps[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_host_resampler)
+{
+    constexpr size_t NUM_PKTS  = 3;
+    constexpr size_t SPP       = 20;
+    constexpr size_t NUM_SAMPS = NUM_PKTS * SPP;
+
+    auto recv_links = make_links(3);
+    auto streamer   = make_rx_streamer({recv_links[0]}, "fc32");
+    auto resamp_streamer =
+        make_rx_streamer({recv_links[1], recv_links[2]},
+            "fc32",
+            "sc16",
+            uhd::device_addr_t(
+                "host_resample_interp=3,host_resample_decim=2,convert_threads=1"));
+    BOOST_CHECK_THROW(make_rx_streamer({recv_links[1]},
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("host_resample_interp=3")),
+        uhd::value_error);
+    const uhd::device_addr_t keep_args("host_resample_decim=2,host_keep_one_in_n=2");
+    BOOST_CHECK_THROW(
+        make_rx_streamer({recv_links[1]}, "fc32", "sc16", keep_args), uhd::value_error);
+
+    mock_header_t header;
+    header.has_tsf = true;
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        header.tsf = i * SPP * static_cast<uint64_t>(TICK_RATE / SAMP_RATE);
+        header.eob = i == NUM_PKTS - 1;
+        for (const auto& link : recv_links) {
+            push_back_recv_packet(link, header, SPP, i * SPP);
+        }
+    }
+
+    // The resampled streamer returns the samples of the other one, resampled
+    // as one stream
+    std::vector<std::complex<float>> samps(NUM_SAMPS);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), NUM_SAMPS, metadata, 1.0, false), NUM_SAMPS);
+    auto resampler = uhd::rfnoc::host_resampler::make(3, 2);
+    std::vector<std::complex<float>> expected(resampler->get_max_num_outputs(NUM_SAMPS));
+    size_t num_expected = resampler->process(samps.data(), NUM_SAMPS, expected.data());
+    num_expected += resampler->flush(expected.data() + num_expected);
+    BOOST_REQUIRE_EQUAL(num_expected, NUM_SAMPS * 3 / 2);
+
+    // Read a few samples at a time. Every call returns the time of its first
+    // output, at 3/2 times the sample rate.
+    std::vector<std::vector<std::complex<float>>> outputs(
+        2, std::vector<std::complex<float>>(num_expected));
+    size_t num_out = 0;
+    metadata       = uhd::rx_metadata_t();
+    while (!metadata.end_of_burst) {
+        const std::vector<void*> buffs{
+            outputs[0].data() + num_out, outputs[1].data() + num_out};
+        const size_t num_samps = resamp_streamer->recv(
+            buffs, std::min<size_t>(7, num_expected - num_out), metadata, 1.0, true);
+        BOOST_REQUIRE_GT(num_samps, 0);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK(metadata.has_time_spec);
+        BOOST_CHECK_SMALL(
+            metadata.time_spec.get_real_secs() - num_out / (1.5 * SAMP_RATE), 1e-12);
+        num_out += num_samps;
+    }
+    BOOST_CHECK_EQUAL(num_out, num_expected);
+    for (const auto& output : outputs) {
+        for (size_t i = 0; i < num_expected; i++) {
+            BOOST_CHECK_EQUAL(output[i], expected[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_keep_one_in_n)
+{
+    constexpr size_t N         = 3;
+    constexpr size_t PKT_SAMPS = 10;
+
+    auto recv_links = make_links(2);
+    auto streamer   = make_rx_streamer({recv_links[0]},
+        "sc16",
+        "sc16",
+        uhd::device_addr_t("host_keep_one_in_n=3"));
+    auto pkt_streamer = make_rx_streamer({recv_links[1]},
+        "sc16",
+        "sc16",
+        uhd::device_addr_t("host_keep_one_in_n=3,host_keep_one_in_n_mode=packet"));
+    BOOST_CHECK_THROW(make_rx_streamer({recv_links[1]},
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("host_keep_one_in_n=0")),
+        uhd::value_error);
+    BOOST_CHECK_THROW(make_rx_streamer({recv_links[1]},
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("host_keep_one_in_n_mode=burst")),
+        uhd::value_error);
+
+    mock_header_t header;
+    header.has_tsf = true;
+    for (size_t i = 0; i < 4; i++) {
+        header.tsf = i * PKT_SAMPS * static_cast<size_t>(TICK_RATE / SAMP_RATE);
+        header.eob = i == 3;
+        for (const auto& link : recv_links) {
+            push_back_recv_packet(link, header, PKT_SAMPS, i * PKT_SAMPS);
+        }
+    }
+
+    // Every third sample, across packet boundaries
+    std::vector<std::complex<uint16_t>> samps(4 * PKT_SAMPS);
+    uhd::rx_metadata_t metadata;
+    const size_t num_kept = (4 * PKT_SAMPS + N - 1) / N;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), samps.size(), metadata, 1.0, false), num_kept);
+    BOOST_CHECK(metadata.end_of_burst);
+    for (size_t i = 0; i < num_kept; i++) {
+        const uint16_t val = i * N * 2;
+        BOOST_CHECK_EQUAL(samps[i], std::complex<uint16_t>(val, val + 1));
+    }
+
+    // Every third packet, and the end of the burst
+    BOOST_CHECK_EQUAL(
+        pkt_streamer->recv(samps.data(), PKT_SAMPS, metadata, 1.0, false), PKT_SAMPS);
+    BOOST_CHECK_EQUAL(samps[0], std::complex<uint16_t>(0, 1));
+    BOOST_CHECK_EQUAL(
+        pkt_streamer->recv(samps.data(), PKT_SAMPS, metadata, 1.0, false), PKT_SAMPS);
+    const uint16_t val = 2 * N * PKT_SAMPS;
+    BOOST_CHECK_EQUAL(samps[0], std::complex<uint16_t>(val, val + 1));
+    BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(SAMP_RATE), 3 * PKT_SAMPS);
+    BOOST_CHECK(metadata.end_of_burst);
+
+    // Reading fragments still returns the time of the first kept sample
+    header.eob = false;
+    header.tsf = 0;
+    push_back_recv_packet(recv_links[0], header, PKT_SAMPS);
+    push_back_recv_packet(recv_links[0], header, PKT_SAMPS, PKT_SAMPS);
+    for (size_t expected : {0, 6, 12, 18}) {
+        BOOST_CHECK_EQUAL(
+            streamer->recv(samps.data(), 2, metadata, 1.0, true), expected < 18 ? 2 : 1);
+        BOOST_CHECK_EQUAL(samps[0].real(), expected * 2);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(SAMP_RATE), expected % PKT_SAMPS);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_host_agc)
+{
+    constexpr size_t PKT_SAMPS = 100;
+
+    // Change the gain two packets after the measured one
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links,
+        "sc16",
+        "sc16",
+        uhd::device_addr_t("host_agc=1,host_agc_packets=1,host_agc_latency=15e-6"));
+    BOOST_CHECK_THROW(make_rx_streamer(recv_links,
+                          "sc16",
+                          "sc16",
+                          uhd::device_addr_t("host_agc=1,host_agc_packets=0")),
+        uhd::value_error);
+    auto plain_streamer = make_rx_streamer(recv_links, "sc16");
+    BOOST_CHECK_THROW(plain_streamer->set_agc_gain_fn(
+                          [](double gain, const uhd::time_spec_t&) { return gain; },
+                          0.0,
+                          uhd::meta_range_t(0.0, 30.0)),
+        uhd::runtime_error);
+
+    std::atomic<bool> gain_fn_called{false};
+    double requested_gain = 0.0;
+    uhd::time_spec_t requested_time;
+    streamer->set_agc_gain_fn(
+        [&](double gain, const uhd::time_spec_t& time) {
+            requested_gain = gain;
+            requested_time = time;
+            gain_fn_called = true;
+            return gain;
+        },
+        30.0,
+        uhd::meta_range_t(0.0, 30.0));
+
+    // Almost full scale, which is more than the largest step above the set point
+    mock_header_t header;
+    header.has_tsf = true;
+    for (size_t i = 0; i < 4; i++) {
+        header.tsf = i * PKT_SAMPS * static_cast<size_t>(TICK_RATE / SAMP_RATE);
+        push_back_recv_packet(recv_links[0], header, PKT_SAMPS, 10000);
+    }
+
+    std::vector<std::complex<uint16_t>> samps(3 * PKT_SAMPS);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), PKT_SAMPS, metadata, 1.0, false), PKT_SAMPS);
+    BOOST_CHECK(!metadata.has_gain_change);
+    for (size_t i = 0; i < 1000 && !gain_fn_called; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    BOOST_REQUIRE(gain_fn_called);
+    BOOST_CHECK_EQUAL(requested_gain, 20.0);
+    BOOST_CHECK_EQUAL(requested_time.to_ticks(SAMP_RATE), 2 * PKT_SAMPS);
+    // Give the worker thread time to report the gain as applied
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The packet with the new gain starts the buffer of the next call
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), samps.size(), metadata, 1.0, false), PKT_SAMPS);
+    BOOST_CHECK(!metadata.has_gain_change);
+    BOOST_CHECK_EQUAL(
+        streamer->recv(samps.data(), samps.size(), metadata, 1.0, false), 2 * PKT_SAMPS);
+    BOOST_CHECK(metadata.has_gain_change);
+    BOOST_CHECK_EQUAL(metadata.gain, 20.0);
+    BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(SAMP_RATE), 2 * PKT_SAMPS);
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
 {
     const size_t NUM_PKTS_TO_TEST = 5;
@@ -437,6 +870,7 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
             const size_t ticks_per_sample = static_cast<size_t>(TICK_RATE / SAMP_RATE);
             const size_t expected_ticks   = ticks_per_sample * total_samps_read;
             BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), expected_ticks);
+            BOOST_CHECK(metadata.get_time_spec() == metadata.time_spec);
 
             for (size_t samp = 0; samp < num_samps; samp++) {
                 const size_t pkt_idx = samp + total_samps_read;
@@ -450,6 +884,175 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_lazy_time_spec)
+{
+    const size_t NUM_PKTS_TO_TEST = 3;
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(
+        recv_links, format, "sc16", uhd::device_addr_t("lazy_time_spec=1"));
+
+    // Read every packet in two halves
+    const size_t spp       = streamer->get_max_num_samps();
+    const size_t num_samps = spp / 2;
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        mock_header_t header;
+        header.has_tsf = true;
+        header.tsf     = 1000 * i;
+        push_back_recv_packet(recv_links[0], header, num_samps * 2);
+    }
+
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            const size_t num_samps_ret =
+                streamer->recv(buff.data(), buff.size(), metadata, 1.0, true);
+            BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+            BOOST_CHECK(metadata.has_time_spec);
+            BOOST_CHECK(metadata.has_time_ticks);
+            BOOST_CHECK_EQUAL(metadata.time_ticks, 1000 * i);
+            BOOST_CHECK_EQUAL(metadata.tick_rate, TICK_RATE);
+            BOOST_CHECK_EQUAL(metadata.time_samps, num_samps * j);
+            BOOST_CHECK_EQUAL(metadata.samp_rate, SAMP_RATE);
+
+            // The time_spec_t is only calculated on request
+            BOOST_CHECK(metadata.time_spec == uhd::time_spec_t(0.0));
+            const size_t ticks_per_sample = static_cast<size_t>(TICK_RATE / SAMP_RATE);
+            BOOST_CHECK_EQUAL(metadata.get_time_spec().to_ticks(TICK_RATE),
+                1000 * i + ticks_per_sample * num_samps * j);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_zero_copy)
+{
+    const std::string format("sc16");
+
+    auto recv_links = make_links(2);
+    auto streamer   = make_rx_streamer(recv_links, format, format);
+
+    // Push back two packets per channel, read the first one partially
+    const size_t num_samps = 20;
+    for (size_t i = 0; i < 2; i++) {
+        mock_header_t header;
+        header.has_tsf = true;
+        header.tsf     = i * num_samps * (TICK_RATE / SAMP_RATE);
+        for (auto& recv_link : recv_links) {
+            push_back_recv_packet(recv_link, header, num_samps, i * num_samps);
+        }
+    }
+
+    std::vector<std::complex<uint16_t>> buff0(num_samps / 2), buff1(num_samps / 2);
+    std::vector<void*> buff_ptrs{buff0.data(), buff1.data()};
+    const uhd::rx_streamer::buffs_type buffs(buff_ptrs);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buffs, num_samps / 2, metadata, 1.0, true), num_samps / 2);
+    BOOST_CHECK(metadata.more_fragments);
+
+    // The remainder of the first packet, then the second one
+    uhd::rx_streamer::recv_buffs_type recv_buffs;
+    for (const size_t start : {num_samps / 2, num_samps}) {
+        const size_t expected = (start < num_samps) ? num_samps / 2 : num_samps;
+        BOOST_CHECK_EQUAL(streamer->get_recv_buffs(recv_buffs, metadata, 1.0), expected);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK_EQUAL(metadata.more_fragments, false);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(SAMP_RATE), start);
+        BOOST_REQUIRE_EQUAL(recv_buffs.size(), 2);
+
+        // Buffers must be released before receiving again
+        BOOST_CHECK_THROW(streamer->get_recv_buffs(recv_buffs, metadata, 1.0),
+            uhd::runtime_error);
+        BOOST_CHECK_THROW(streamer->recv(buffs, num_samps, metadata, 1.0, true),
+            uhd::runtime_error);
+
+        for (const void* recv_buff : recv_buffs) {
+            auto samps = reinterpret_cast<const std::complex<uint16_t>*>(recv_buff);
+            for (size_t i = 0; i < expected; i++) {
+                const uint16_t val = (start + i) * 2;
+                BOOST_CHECK_EQUAL(samps[i], std::complex<uint16_t>(val, val + 1));
+            }
+        }
+        streamer->release_recv_buffs();
+    }
+
+    BOOST_CHECK_EQUAL(streamer->get_recv_buffs(recv_buffs, metadata, 0.0), 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+    streamer->release_recv_buffs();
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_zero_copy_needs_matching_format)
+{
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, "fc32");
+
+    uhd::rx_streamer::recv_buffs_type recv_buffs;
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_THROW(
+        streamer->get_recv_buffs(recv_buffs, metadata, 1.0), uhd::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_many)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    // Five packets, the fourth one ends a burst, and a sequence error follows
+    const size_t num_samps = 20;
+    mock_header_t header;
+    header.has_tsf    = true;
+    header.ignore_seq = false;
+    for (const size_t seq_num : {0, 1, 2, 3, 4, 6}) {
+        header.seq_num = seq_num;
+        header.tsf     = seq_num;
+        header.eob     = (seq_num == 3);
+        push_back_recv_packet(recv_links[0], header, num_samps, seq_num);
+    }
+
+    std::vector<std::vector<std::complex<float>>> buffs(8);
+    std::vector<uhd::rx_streamer::recv_slot_t> slots(buffs.size());
+    for (size_t i = 0; i < slots.size(); i++) {
+        buffs[i].resize(num_samps);
+        slots[i].buffs           = {buffs[i].data()};
+        slots[i].nsamps_per_buff = num_samps;
+    }
+
+    // Everything up to the end of burst
+    BOOST_REQUIRE_EQUAL(streamer->recv_many(slots, 1.0), 4);
+    for (size_t i = 0; i < 4; i++) {
+        BOOST_CHECK_EQUAL(slots[i].num_samps, num_samps);
+        BOOST_CHECK_EQUAL(slots[i].metadata.time_spec.to_ticks(TICK_RATE), i);
+        BOOST_CHECK_EQUAL(slots[i].metadata.end_of_burst, i == 3);
+        BOOST_CHECK_EQUAL(buffs[i][0],
+            std::complex<float>((i * 2) * SCALE_FACTOR, (i * 2 + 1) * SCALE_FACTOR));
+    }
+
+    // The sequence error after the first packet is returned by the next call
+    BOOST_CHECK_EQUAL(streamer->recv_many(slots, 1.0), 1);
+    BOOST_CHECK_EQUAL(slots[0].num_samps, num_samps);
+    BOOST_CHECK_EQUAL(slots[0].metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(streamer->recv_many(slots, 1.0), 1);
+    BOOST_CHECK_EQUAL(slots[0].num_samps, 0);
+    BOOST_CHECK_EQUAL(slots[0].metadata.out_of_sequence, true);
+
+    // The packet after the error, then nothing is left
+    BOOST_CHECK_EQUAL(streamer->recv_many(slots, 1.0), 1);
+    BOOST_CHECK_EQUAL(slots[0].num_samps, num_samps);
+    BOOST_CHECK_EQUAL(slots[0].metadata.time_spec.to_ticks(TICK_RATE), 6);
+    BOOST_CHECK_EQUAL(streamer->recv_many(slots, 0.0), 1);
+    BOOST_CHECK_EQUAL(slots[0].num_samps, 0);
+    BOOST_CHECK_EQUAL(
+        slots[0].metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+
+    std::vector<uhd::rx_streamer::recv_slot_t> no_slots;
+    BOOST_CHECK_EQUAL(streamer->recv_many(no_slots, 0.0), 0);
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_seq_error)
 {
     // Test that when we get a sequence error the error is returned in the
@@ -517,6 +1120,150 @@ BOOST_AUTO_TEST_CASE(test_recv_seq_error)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_gap_fill)
+{
+    const size_t num_samps = 20;
+    const size_t pkt_ticks = num_samps * static_cast<size_t>(TICK_RATE / SAMP_RATE);
+
+    // Packets with the samples from 0 to 120, where those from 40 and 80 on are
+    // dropped
+    auto push_packets = [&](mock_recv_link::sptr recv_link) {
+        mock_header_t header;
+        header.has_tsf    = true;
+        header.ignore_seq = false;
+        for (size_t i = 0; i < 6; i++) {
+            header.seq_num = i;
+            header.tsf     = i * pkt_ticks;
+            if (i != 2 && i != 4) {
+                push_back_recv_packet(recv_link, header, num_samps);
+            }
+        }
+    };
+
+    {
+        auto recv_links = make_links(1);
+        auto streamer   = make_rx_streamer(
+            recv_links, "fc32", "sc16", uhd::device_addr_t("gap_fill=zeros"));
+        push_packets(recv_links[0]);
+        std::vector<std::complex<float>> buff(10 * num_samps);
+        uhd::rx_metadata_t metadata;
+
+        // The second gap starts the next buffer
+        size_t num_samps_ret =
+            streamer->recv(buff.data(), buff.size(), metadata, 0.1, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, 4 * num_samps);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK(metadata.has_gap);
+        BOOST_CHECK_EQUAL(metadata.gap_offset, 2 * num_samps);
+        BOOST_CHECK_EQUAL(metadata.gap_length, num_samps);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), 0);
+        for (size_t i = 0; i < num_samps; i++) {
+            BOOST_CHECK_EQUAL(buff[2 * num_samps + i], std::complex<float>(0, 0));
+        }
+        BOOST_CHECK(buff[3 * num_samps] != std::complex<float>(0, 0));
+
+        num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 0.1, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, 2 * num_samps);
+        BOOST_CHECK(metadata.has_gap);
+        BOOST_CHECK_EQUAL(metadata.gap_offset, 0);
+        BOOST_CHECK_EQUAL(metadata.gap_length, num_samps);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), 4 * pkt_ticks);
+        BOOST_CHECK_EQUAL(buff[0], std::complex<float>(0, 0));
+    }
+
+    {
+        auto recv_links = make_links(1);
+        auto streamer   = make_rx_streamer(
+            recv_links, "fc32", "sc16", uhd::device_addr_t("gap_fill=mark"));
+        push_packets(recv_links[0]);
+        std::vector<std::complex<float>> buff(10 * num_samps);
+        uhd::rx_metadata_t metadata;
+
+        size_t num_samps_ret =
+            streamer->recv(buff.data(), buff.size(), metadata, 0.1, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, 3 * num_samps);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK(metadata.has_gap);
+        BOOST_CHECK_EQUAL(metadata.gap_offset, 2 * num_samps);
+        BOOST_CHECK_EQUAL(metadata.gap_length, num_samps);
+
+        num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 0.1, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+        BOOST_CHECK(metadata.has_gap);
+        BOOST_CHECK_EQUAL(metadata.gap_offset, 0);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), 5 * pkt_ticks);
+    }
+
+    auto recv_links = make_links(1);
+    BOOST_CHECK_THROW(make_rx_streamer(recv_links,
+                          "fc32",
+                          "sc16",
+                          uhd::device_addr_t("gap_fill=interpolate")),
+        uhd::value_error);
+    BOOST_CHECK_THROW(make_rx_streamer(recv_links,
+                          "fc32",
+                          "sc16",
+                          uhd::device_addr_t("gap_fill=zeros,host_keep_one_in_n=2")),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_reset_stream_state)
+{
+    // Test that resetting the stream state drops the unread samples and
+    // packets, and that the next session may start with any sequence number
+    // and an earlier time without reporting an error
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    header.eob        = false;
+    header.has_tsf    = true;
+    header.ignore_seq = false;
+    header.seq_num    = 0;
+    header.tsf        = 1000;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    header.seq_num = 1;
+    header.tsf     = 1000 + num_samps;
+    push_back_recv_packet(recv_links[0], header, num_samps);
+
+    // Read part of the first packet
+    size_t num_samps_ret =
+        streamer->recv(buff.data(), num_samps / 2, metadata, 1.0, true);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps / 2);
+    BOOST_CHECK_EQUAL(metadata.more_fragments, true);
+
+    streamer->reset_stream_state();
+
+    const uint16_t start_data = 100;
+    header.seq_num            = 10;
+    header.tsf                = 0;
+    push_back_recv_packet(recv_links[0], header, num_samps, start_data);
+
+    num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(metadata.out_of_sequence, false);
+    BOOST_CHECK_EQUAL(metadata.fragment_offset, 0);
+    BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), 0);
+    BOOST_CHECK_EQUAL(buff[0],
+        std::complex<float>(start_data * 2 * SCALE_FACTOR,
+            (start_data * 2 + 1) * SCALE_FACTOR));
+
+    // The sequence continues from the first packet of the session
+    header.seq_num = 11;
+    header.tsf     = num_samps * (TICK_RATE / SAMP_RATE);
+    push_back_recv_packet(recv_links[0], header, num_samps);
+    num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+    BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_bad_packet)
 {
     // Test that when we receive a packet with invalid chdr header or length
@@ -900,3 +1647,139 @@ BOOST_AUTO_TEST_CASE(test_recv_zero_samples)
     // timeout period of 10 seconds.
     BOOST_CHECK_LE(elapsed_time.count(), 0.5);
 }
+
+BOOST_AUTO_TEST_CASE(test_recv_telemetry)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    auto telemetry = streamer->get_telemetry();
+    BOOST_CHECK_EQUAL(telemetry.packets, 0);
+    BOOST_CHECK_EQUAL(telemetry.samples, 0);
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    // Push back two packets, then skip a seq_num to cause a sequence error
+    mock_header_t header;
+    header.ignore_seq = false;
+    for (const size_t seq_num : {0, 1, 3}) {
+        header.seq_num = seq_num;
+        push_back_recv_packet(recv_links[0], header, num_samps);
+    }
+
+    for (size_t i = 0; i < 2; i++) {
+        BOOST_CHECK_EQUAL(
+            streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    }
+    BOOST_CHECK_EQUAL(streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), 0);
+    BOOST_CHECK_EQUAL(metadata.out_of_sequence, true);
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+
+    telemetry = streamer->get_telemetry();
+    BOOST_CHECK_EQUAL(telemetry.packets, 3);
+    BOOST_CHECK_EQUAL(telemetry.samples, 3 * num_samps);
+    BOOST_CHECK_EQUAL(telemetry.sequence_errors, 1);
+    BOOST_CHECK_EQUAL(telemetry.overflows, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_cycle_accounting)
+{
+    const std::string format("fc32");
+    const size_t num_packets = 5;
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    mock_header_t header;
+    for (size_t i = 0; i < num_packets; i++) {
+        push_back_recv_packet(recv_links[0], header, num_samps);
+    }
+    for (size_t i = 0; i < num_packets; i++) {
+        BOOST_CHECK_EQUAL(
+            streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    }
+
+    const auto telemetry = streamer->get_telemetry();
+#ifdef UHD_ENABLE_CYCLE_ACCOUNTING
+    BOOST_CHECK_EQUAL(telemetry.num_calls, num_packets);
+    BOOST_CHECK_GT(telemetry.cycles_convert, 0);
+    BOOST_CHECK_GT(telemetry.cycles_per_second, 0);
+    BOOST_CHECK_EQUAL(telemetry.cycles_total,
+        telemetry.cycles_buff_wait + telemetry.cycles_header
+            + telemetry.cycles_flow_ctrl + telemetry.cycles_convert
+            + telemetry.cycles_metadata + telemetry.cycles_send
+            + telemetry.cycles_other);
+    // The mock transport has no headers to decode or packets to send
+    BOOST_CHECK_EQUAL(telemetry.cycles_send, 0);
+#else
+    BOOST_CHECK_EQUAL(telemetry.num_calls, 0);
+    BOOST_CHECK_EQUAL(telemetry.cycles_total, 0);
+    BOOST_CHECK_EQUAL(telemetry.cycles_per_second, 0);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_no_allocations)
+{
+    const size_t num_chans = 2;
+    const std::string format("fc32");
+
+    for (const std::string args : {"", "convert_threads=1"}) {
+        // Links which return the same packet over and over again, so that they
+        // don't allocate anything themselves
+        const mock_recv_link::link_params params = {FRAME_SIZE, 1};
+        std::vector<mock_recv_link::sptr> recv_links;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            recv_links.push_back(std::make_shared<mock_recv_link>(params, true));
+        }
+        auto streamer =
+            make_rx_streamer(recv_links, format, "sc16", uhd::device_addr_t(args));
+
+        const size_t spp = streamer->get_max_num_samps();
+        mock_header_t header;
+        header.eov     = true;
+        header.has_tsf = true;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            push_back_recv_packet(recv_links[ch], header, spp);
+        }
+
+        // Read two and a half packets at a time, so that packets are split up
+        // between calls to recv()
+        const size_t num_samps = spp * 5 / 2;
+        std::vector<std::vector<std::complex<float>>> buffer(num_chans);
+        std::vector<void*> buffers;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            buffer[ch].resize(num_samps);
+            buffers.push_back(buffer[ch].data());
+        }
+        std::vector<size_t> eov_positions(4);
+        uhd::rx_metadata_t metadata;
+        auto recv = [&]() {
+            metadata.eov_positions      = eov_positions.data();
+            metadata.eov_positions_size = eov_positions.size();
+            return streamer->recv(buffers, num_samps, metadata, 1.0, false);
+        };
+
+        // Let the streamer allocate whatever it allocates lazily
+        BOOST_CHECK_EQUAL(recv(), num_samps);
+
+        uhd::test::alloc_counter counter;
+        size_t total_samps = 0;
+        for (size_t i = 0; i < 100; i++) {
+            total_samps += recv();
+        }
+        const size_t num_allocs = counter.get();
+
+        BOOST_CHECK_EQUAL(total_samps, 100 * num_samps);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK_EQUAL(num_allocs, 0);
+    }
+}
@@ -0,0 +1,86 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/sample_player.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+struct temp_file
+{
+    temp_file() : path(fs::temp_directory_path() / fs::unique_path("uhd-play-%%%%-%%%%"))
+    {
+    }
+
+    ~temp_file()
+    {
+        fs::remove(path);
+    }
+
+    const fs::path path;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_play)
+{
+    constexpr size_t NUM_SAMPS = 1000;
+
+    temp_file tmp;
+    {
+        std::ofstream file(tmp.path.string(), std::ios::binary);
+        for (uint32_t i = 0; i < NUM_SAMPS; i++) {
+            file.write(reinterpret_cast<const char*>(&i), sizeof(i));
+        }
+        // Not a whole sample
+        file.write("xy", 2);
+    }
+
+    BOOST_CHECK_THROW(uhd::sample_player::make(tmp.path.string(), 0), uhd::value_error);
+    BOOST_CHECK_THROW(
+        uhd::sample_player::make(tmp.path.string() + ".missing", 4), uhd::io_error);
+
+    auto player = uhd::sample_player::make(tmp.path.string(), sizeof(uint32_t));
+    BOOST_CHECK_EQUAL(player->get_num_samps(), NUM_SAMPS);
+    BOOST_CHECK_THROW(player->seek(NUM_SAMPS + 1), uhd::value_error);
+
+    // Read the file twice, the second time by looping
+    std::vector<uint32_t> samps;
+    const void* buff;
+    size_t num_samps;
+    for (const bool loop : {false, true}) {
+        player->set_loop(loop);
+        while (samps.size() < (loop ? 3 : 1) * NUM_SAMPS
+               && (num_samps = player->get_read_buff(buff, 300)) != 0) {
+            BOOST_REQUIRE_LE(num_samps, 300);
+            const size_t offset = samps.size();
+            samps.resize(offset + num_samps);
+            std::memcpy(&samps[offset], buff, num_samps * sizeof(uint32_t));
+            player->consume(num_samps);
+        }
+        if (!loop) {
+            BOOST_CHECK_EQUAL(player->get_samps_left(), 0);
+            BOOST_CHECK_EQUAL(player->get_read_buff(buff, 300), 0);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(samps.size(), 3 * NUM_SAMPS);
+    for (size_t i = 0; i < samps.size(); i++) {
+        BOOST_CHECK_EQUAL(samps[i], i % NUM_SAMPS);
+    }
+
+    player->seek(NUM_SAMPS - 10);
+    BOOST_CHECK_EQUAL(player->get_position(), NUM_SAMPS - 10);
+    BOOST_CHECK_EQUAL(player->get_read_buff(buff, 300), 10);
+    BOOST_CHECK_EQUAL(*static_cast<const uint32_t*>(buff), NUM_SAMPS - 10);
+}
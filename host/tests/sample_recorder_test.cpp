@@ -0,0 +1,210 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/iq_codec.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+struct temp_dir
+{
+    temp_dir() : dir(fs::temp_directory_path() / fs::unique_path("uhd-rec-%%%%-%%%%"))
+    {
+        fs::create_directories(dir);
+    }
+
+    ~temp_dir()
+    {
+        fs::remove_all(dir);
+    }
+
+    const fs::path dir;
+};
+
+std::vector<char> read_file(const std::string& name)
+{
+    std::ifstream file(name, std::ios::binary);
+    BOOST_REQUIRE(file.good());
+    return std::vector<char>(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_file_names)
+{
+    using uhd::sample_recorder;
+    BOOST_CHECK_EQUAL(
+        sample_recorder::get_file_name("samples.dat", 0, 1, false, 0), "samples.dat");
+    BOOST_CHECK_EQUAL(sample_recorder::get_file_name("samples.dat", 1, 2, true, 2),
+        "samples.ch1.0002.dat");
+    BOOST_CHECK_EQUAL(
+        sample_recorder::get_file_name("/tmp/a.b/samples", 0, 1, true, 10),
+        "/tmp/a.b/samples.0010");
+}
+
+BOOST_AUTO_TEST_CASE(test_record)
+{
+    constexpr size_t NUM_CHANS = 2;
+    constexpr size_t NUM_BYTES = 30000;
+
+    for (const bool direct_io : {false, true}) {
+        temp_dir tmp;
+        const std::string path = (tmp.dir / "samples.dat").string();
+
+        uhd::sample_recorder::config_t config;
+        config.buffer_size   = 4000;
+        config.num_buffers   = 2;
+        config.max_file_size = 10000;
+        config.direct_io     = direct_io;
+        auto recorder = uhd::sample_recorder::make(path, NUM_CHANS, config);
+        BOOST_CHECK_EQUAL(recorder->get_num_channels(), NUM_CHANS);
+
+        std::vector<std::vector<char>> data(NUM_CHANS, std::vector<char>(NUM_BYTES));
+        for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+            for (size_t i = 0; i < NUM_BYTES; i++) {
+                data[chan][i] = char(i * (chan + 1));
+            }
+        }
+
+        // Write the first half in place, and copy the rest
+        size_t offset = 0;
+        std::vector<void*> buffs;
+        while (offset < NUM_BYTES / 2) {
+            const size_t space = recorder->get_write_buffs(buffs, 1.0);
+            BOOST_REQUIRE_NE(space, 0);
+            BOOST_REQUIRE_EQUAL(buffs.size(), NUM_CHANS);
+            const size_t n = std::min({space, size_t(1000), NUM_BYTES / 2 - offset});
+            for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+                std::copy_n(&data[chan][offset], n, static_cast<char*>(buffs[chan]));
+            }
+            recorder->commit(n);
+            offset += n;
+        }
+        BOOST_CHECK_THROW(recorder->commit(5000), uhd::value_error);
+        BOOST_CHECK_EQUAL(recorder->write({&data[0][offset], &data[1][offset]},
+                              NUM_BYTES - offset,
+                              1.0),
+            NUM_BYTES - offset);
+        recorder->close();
+        BOOST_CHECK_EQUAL(recorder->get_bytes_written(), NUM_BYTES);
+
+        // The files are split every 3 buffers (12288 bytes)
+        for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+            std::vector<char> recorded;
+            for (size_t index = 0; index < 3; index++) {
+                const auto part = read_file(uhd::sample_recorder::get_file_name(
+                    path, chan, NUM_CHANS, true, index));
+                BOOST_CHECK_EQUAL(part.size(), index < 2 ? 12288 : NUM_BYTES - 2 * 12288);
+                recorded.insert(recorded.end(), part.begin(), part.end());
+            }
+            BOOST_CHECK(recorded == data[chan]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_record_compressed)
+{
+    constexpr size_t NUM_BYTES = 200000;
+
+    for (const bool direct_io : {false, true}) {
+        temp_dir tmp;
+        const std::string path = (tmp.dir / "samples.dat").string();
+
+        // With O_DIRECT, every frame is padded to 4096 bytes
+        uhd::sample_recorder::config_t config;
+        config.buffer_size = 65536;
+        config.num_buffers = 2;
+        config.direct_io   = direct_io;
+        config.compress    = true;
+        auto recorder      = uhd::sample_recorder::make(path, 1, config);
+
+        // A slow ramp of sc16 samples
+        std::vector<int16_t> data(NUM_BYTES / sizeof(int16_t));
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = int16_t(i / 2 * (i % 2 ? -3 : 5));
+        }
+        BOOST_CHECK_EQUAL(recorder->write({data.data()}, NUM_BYTES, 1.0), NUM_BYTES);
+        recorder->close();
+        BOOST_CHECK_EQUAL(recorder->get_bytes_written(), NUM_BYTES);
+
+        const std::string restored_path = (tmp.dir / "restored.dat").string();
+        BOOST_CHECK_LT(read_file(path).size(), NUM_BYTES / 2);
+        BOOST_CHECK_EQUAL(uhd::iq_codec::decompress_file(path, restored_path), NUM_BYTES);
+        const auto restored = read_file(restored_path);
+        BOOST_REQUIRE_EQUAL(restored.size(), NUM_BYTES);
+        BOOST_CHECK(std::memcmp(restored.data(), data.data(), NUM_BYTES) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_record_striped)
+{
+    constexpr size_t NUM_CHANS   = 2;
+    constexpr size_t NUM_STRIPES = 3;
+    constexpr size_t NUM_BYTES   = 30000;
+
+    for (const bool direct_io : {false, true}) {
+        temp_dir tmp;
+        const std::string path = (tmp.dir / "samples.dat").string();
+
+        uhd::sample_recorder::config_t config;
+        config.buffer_size = 4000;
+        config.num_buffers = 4;
+        config.direct_io   = direct_io;
+        for (size_t stripe = 0; stripe < NUM_STRIPES; stripe++) {
+            const fs::path dir = tmp.dir / ("drive" + std::to_string(stripe));
+            fs::create_directories(dir);
+            config.stripe_dirs.push_back(dir.string());
+        }
+        auto recorder = uhd::sample_recorder::make(path, NUM_CHANS, config);
+
+        std::vector<std::vector<char>> data(NUM_CHANS, std::vector<char>(NUM_BYTES));
+        for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+            for (size_t i = 0; i < NUM_BYTES; i++) {
+                data[chan][i] = char(i * (chan + 1));
+            }
+        }
+        BOOST_CHECK_EQUAL(
+            recorder->write({data[0].data(), data[1].data()}, NUM_BYTES, 1.0),
+            NUM_BYTES);
+        recorder->close();
+        BOOST_CHECK_EQUAL(recorder->get_bytes_written(), NUM_BYTES);
+
+        // The 8 chunks of 4096 bytes of channel 1 start on the second drive
+        const auto stripe = read_file(
+            uhd::sample_recorder::get_file_name(config.stripe_dirs[1] + "/samples.dat",
+                1,
+                NUM_CHANS,
+                true,
+                1));
+        BOOST_CHECK_EQUAL(stripe.size(), 3 * 4096);
+        BOOST_CHECK(std::equal(stripe.begin(), stripe.begin() + 4096, data[1].begin()));
+
+        const std::string joined_path = (tmp.dir / "joined.dat").string();
+        uhd::sample_recorder::join_stripes(path + ".index", joined_path);
+        for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+            BOOST_CHECK(read_file(uhd::sample_recorder::get_file_name(
+                            joined_path, chan, NUM_CHANS, false, 0))
+                        == data[chan]);
+        }
+    }
+
+    uhd::sample_recorder::config_t config;
+    config.stripe_dirs   = {"a", "b"};
+    config.max_file_size = 1000000;
+    BOOST_CHECK_THROW(uhd::sample_recorder::make("samples.dat", 1, config),
+        uhd::value_error);
+}
@@ -0,0 +1,150 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/shm_iq_bus.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace uhd;
+
+namespace {
+
+constexpr size_t NUM_CHANS = 2;
+constexpr size_t SPP       = 64;
+constexpr size_t NUM_SLOTS = 4;
+
+//! Return a name which no other test binary running in parallel uses
+std::string shm_name(const std::string& test)
+{
+    return "/uhd_shm_iq_bus_test_" + test + "_"
+           + std::to_string(
+               std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+//! Publish a packet whose samples in channel c are all packet_num + c
+void publish_packet(shm_iq_publisher& publisher, const uint32_t packet_num)
+{
+    std::vector<std::vector<uint32_t>> samps;
+    std::vector<const void*> buffs;
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        samps.emplace_back(SPP, packet_num + chan);
+    }
+    for (const auto& chan_samps : samps) {
+        buffs.push_back(chan_samps.data());
+    }
+    rx_metadata_t md;
+    md.has_time_spec  = true;
+    md.time_spec      = time_spec_t::from_ticks(packet_num * SPP, 1e6);
+    md.start_of_burst = packet_num == 0;
+    publisher.publish(buffs, SPP, md);
+}
+
+void check_packet(const shm_iq_subscriber::packet_t& packet, const uint32_t packet_num)
+{
+    BOOST_REQUIRE_EQUAL(packet.nsamps, SPP);
+    BOOST_REQUIRE_EQUAL(packet.buffs.size(), NUM_CHANS);
+    BOOST_CHECK(packet.metadata.has_time_spec);
+    BOOST_CHECK_EQUAL(packet.metadata.time_spec.to_ticks(1e6), packet_num * SPP);
+    BOOST_CHECK_EQUAL(packet.metadata.start_of_burst, packet_num == 0);
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        const uint32_t* samps = static_cast<const uint32_t*>(packet.buffs[chan]);
+        BOOST_CHECK_EQUAL(samps[0], packet_num + chan);
+        BOOST_CHECK_EQUAL(samps[SPP - 1], packet_num + chan);
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_shm_iq_bus_publish)
+{
+    const std::string name = shm_name("publish");
+    shm_iq_publisher::sptr publisher;
+    try {
+        publisher = shm_iq_publisher::make(name, NUM_CHANS, 4, SPP, NUM_SLOTS);
+    } catch (const uhd::not_implemented_error&) {
+        BOOST_TEST_MESSAGE("Shared memory not supported, skipping test");
+        return;
+    }
+    // Packets published before subscribing are not received
+    publish_packet(*publisher, 0);
+    auto subscriber0 = shm_iq_subscriber::make(name);
+    auto subscriber1 = shm_iq_subscriber::make(name);
+    BOOST_CHECK_EQUAL(subscriber0->get_num_channels(), NUM_CHANS);
+    BOOST_CHECK_EQUAL(subscriber0->get_bytes_per_sample(), 4);
+
+    shm_iq_subscriber::packet_t packet;
+    BOOST_CHECK(!subscriber0->acquire(packet, 0.0));
+    for (uint32_t packet_num = 1; packet_num < 3; packet_num++) {
+        publish_packet(*publisher, packet_num);
+    }
+    for (auto& subscriber : {subscriber0, subscriber1}) {
+        for (uint32_t packet_num = 1; packet_num < 3; packet_num++) {
+            BOOST_REQUIRE(subscriber->acquire(packet, 0.0));
+            BOOST_CHECK_EQUAL(
+                packet.metadata.error_code, rx_metadata_t::ERROR_CODE_NONE);
+            check_packet(packet, packet_num);
+            BOOST_CHECK(subscriber->release());
+        }
+        BOOST_CHECK(!subscriber->acquire(packet, 0.0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_shm_iq_bus_overflow)
+{
+    const std::string name = shm_name("overflow");
+    shm_iq_publisher::sptr publisher;
+    try {
+        publisher = shm_iq_publisher::make(name, NUM_CHANS, 4, SPP, NUM_SLOTS);
+    } catch (const uhd::not_implemented_error&) {
+        BOOST_TEST_MESSAGE("Shared memory not supported, skipping test");
+        return;
+    }
+    auto subscriber = shm_iq_subscriber::make(name);
+    shm_iq_subscriber::packet_t packet;
+
+    // A held packet which is overwritten is reported by release()
+    publish_packet(*publisher, 0);
+    BOOST_REQUIRE(subscriber->acquire(packet, 0.0));
+    for (uint32_t packet_num = 1; packet_num < 10; packet_num++) {
+        publish_packet(*publisher, packet_num);
+    }
+    BOOST_CHECK(!subscriber->release());
+
+    // The subscriber fell behind, and continues with the oldest packet left
+    BOOST_REQUIRE(subscriber->acquire(packet, 0.0));
+    BOOST_CHECK_EQUAL(packet.metadata.error_code, rx_metadata_t::ERROR_CODE_OVERFLOW);
+    check_packet(packet, 10 - NUM_SLOTS);
+    BOOST_CHECK(subscriber->release());
+    BOOST_REQUIRE(subscriber->acquire(packet, 0.0));
+    BOOST_CHECK_EQUAL(packet.metadata.error_code, rx_metadata_t::ERROR_CODE_NONE);
+    check_packet(packet, 11 - NUM_SLOTS);
+}
+
+BOOST_AUTO_TEST_CASE(test_shm_iq_bus_invalid_args)
+{
+    const std::string name = shm_name("invalid");
+    shm_iq_publisher::sptr publisher;
+    try {
+        publisher = shm_iq_publisher::make(name, NUM_CHANS, 4, SPP, NUM_SLOTS);
+    } catch (const uhd::not_implemented_error&) {
+        BOOST_TEST_MESSAGE("Shared memory not supported, skipping test");
+        return;
+    }
+    BOOST_CHECK_THROW(
+        shm_iq_publisher::make("no_slash", 1, 4, SPP, NUM_SLOTS), uhd::value_error);
+    BOOST_CHECK_THROW(shm_iq_publisher::make(name, 1, 4, SPP, 0), uhd::value_error);
+    BOOST_CHECK_THROW(shm_iq_subscriber::make(name + "_missing"), uhd::os_error);
+
+    std::vector<uint32_t> samps(SPP + 1);
+    rx_metadata_t md;
+    BOOST_CHECK_THROW(publisher->publish({samps.data()}, SPP, md), uhd::value_error);
+    BOOST_CHECK_THROW(
+        publisher->publish({samps.data(), samps.data()}, SPP + 1, md), uhd::value_error);
+}
@@ -0,0 +1,150 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/sigmf_recorder.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <complex>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace {
+
+struct temp_dir
+{
+    temp_dir() : dir(fs::temp_directory_path() / fs::unique_path("uhd-sigmf-%%%%-%%%%"))
+    {
+        fs::create_directories(dir);
+    }
+
+    ~temp_dir()
+    {
+        fs::remove_all(dir);
+    }
+
+    const fs::path dir;
+};
+
+std::string read_file(const std::string& name)
+{
+    std::ifstream file(name, std::ios::binary);
+    BOOST_REQUIRE(file.good());
+    return std::string(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_invalid_format)
+{
+    temp_dir tmp;
+    uhd::sigmf_info_t info;
+    info.cpu_format = "item32";
+    BOOST_CHECK_THROW(
+        uhd::sigmf_recorder::make((tmp.dir / "capture").string(), 1, info),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_record)
+{
+    constexpr size_t NUM_CHANS = 2;
+    constexpr size_t SPP       = 100;
+    constexpr double RATE      = 1e6;
+
+    temp_dir tmp;
+    const std::string base = (tmp.dir / "capture").string();
+
+    uhd::sigmf_info_t info;
+    info.cpu_format  = "sc16";
+    info.sample_rate = RATE;
+    info.frequencies = {1e9, 2.4e9};
+    info.gains       = {10.0};
+    info.description = "A \"test\" recording";
+    auto recorder    = uhd::sigmf_recorder::make(base, NUM_CHANS, info);
+
+    // Receive 3 packets, lose 50 samples, then receive 2 packets, tune, and
+    // receive another packet
+    std::vector<void*> buffs;
+    uhd::rx_metadata_t md;
+    md.has_time_spec = true;
+    md.time_spec     = uhd::time_spec_t(1.0);
+    int16_t value    = 0;
+    auto recv        = [&](const size_t num_samps) {
+        BOOST_REQUIRE_GE(recorder->get_write_buffs(buffs, 1.0), num_samps);
+        BOOST_REQUIRE_EQUAL(buffs.size(), NUM_CHANS);
+        for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+            auto* samps = static_cast<std::complex<int16_t>*>(buffs[chan]);
+            for (size_t i = 0; i < num_samps; i++) {
+                samps[i] = std::complex<int16_t>(value + i, int16_t(chan));
+            }
+        }
+        value += int16_t(num_samps);
+        recorder->commit(num_samps, md);
+        md.time_spec += uhd::time_spec_t::from_ticks(num_samps, RATE);
+    };
+    for (size_t i = 0; i < 3; i++) {
+        recv(SPP);
+    }
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_OVERFLOW;
+    recorder->commit(0, md);
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_NONE;
+    md.time_spec += uhd::time_spec_t::from_ticks(50, RATE);
+    recv(SPP);
+    recv(SPP);
+    recorder->set_frequency(1, 2.5e9);
+    recorder->set_gain(1, 20.5);
+    recv(SPP);
+    md.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+    recorder->commit(0, md);
+    BOOST_CHECK_THROW(recorder->set_frequency(NUM_CHANS, 1e9), uhd::index_error);
+    recorder->close();
+
+    const auto captures = recorder->get_captures();
+    BOOST_REQUIRE_EQUAL(captures.size(), 3);
+    BOOST_CHECK_EQUAL(captures[0].sample_start, 0);
+    BOOST_CHECK(captures[0].time_spec == uhd::time_spec_t(1.0));
+    BOOST_CHECK_EQUAL(captures[1].sample_start, 3 * SPP);
+    BOOST_CHECK_EQUAL(captures[1].dropped_samps, 50);
+    BOOST_CHECK_EQUAL(captures[2].sample_start, 5 * SPP);
+    BOOST_CHECK_EQUAL(captures[2].dropped_samps, 0);
+    BOOST_CHECK(recorder->get_overflows() == std::vector<size_t>{3 * SPP});
+
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        const std::string data = read_file(uhd::sample_recorder::get_file_name(
+            base + ".sigmf-data", chan, NUM_CHANS, false, 0));
+        BOOST_REQUIRE_EQUAL(data.size(), 6 * SPP * sizeof(std::complex<int16_t>));
+        const auto* samps = reinterpret_cast<const std::complex<int16_t>*>(data.data());
+        for (size_t i = 0; i < 6 * SPP; i++) {
+            BOOST_CHECK(samps[i] == std::complex<int16_t>(int16_t(i), int16_t(chan)));
+        }
+
+        const std::string meta = read_file(uhd::sample_recorder::get_file_name(
+            base + ".sigmf-meta", chan, NUM_CHANS, false, 0));
+        BOOST_CHECK_NE(meta.find("\"core:datatype\": \"ci16_"), std::string::npos);
+        BOOST_CHECK_NE(meta.find("\"core:sample_rate\": 1000000,"), std::string::npos);
+        BOOST_CHECK_NE(meta.find("\"core:description\": \"A \\\"test\\\" recording\""),
+            std::string::npos);
+        BOOST_CHECK_NE(meta.find("{\"core:sample_start\": 300, \"core:frequency\": "
+                                 + std::string(chan ? "2400000000" : "1000000000, "
+                                                                     "\"uhd:gain\": 10")
+                                 + ", \"uhd:time_spec\": 1.00035, "
+                                   "\"uhd:dropped_samps\": 50}"),
+            std::string::npos);
+        BOOST_CHECK_NE(meta.find("{\"core:sample_start\": 500, \"core:frequency\": "
+                                 + std::string(chan ? "2500000000, \"uhd:gain\": 20.5"
+                                                    : "1000000000, \"uhd:gain\": 10")),
+            std::string::npos);
+        BOOST_CHECK_NE(
+            meta.find("{\"core:sample_start\": 300, \"core:label\": \"overflow\""),
+            std::string::npos);
+        BOOST_CHECK_EQUAL(meta.find("timeout"), std::string::npos);
+    }
+}
@@ -0,0 +1,33 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/rfnoc/spectrum_monitor.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace uhd::rfnoc;
+
+BOOST_AUTO_TEST_CASE(test_convert_to_db)
+{
+    // Full scale, half scale (-6 dB), and zero, which is clamped
+    const std::vector<std::complex<int16_t>> bins{
+        {32767, 32767}, {16384, -16384}, {0, 0}};
+    std::vector<float> power_db(bins.size());
+    spectrum_monitor::convert_to_db(bins.data(), bins.size(), false, power_db.data());
+    BOOST_CHECK_SMALL(power_db[0], 0.01f);
+    BOOST_CHECK_CLOSE(power_db[1], -6.02f, 0.1);
+    BOOST_CHECK_CLOSE(power_db[2], -93.3f, 0.1);
+
+    // The Log Power block outputs 1024 * log2(i^2 + q^2) in the real part
+    const std::vector<std::complex<int16_t>> log_bins{
+        {31 * 1024, 0}, {29 * 1024, 0}, {0, 0}};
+    spectrum_monitor::convert_to_db(
+        log_bins.data(), log_bins.size(), true, power_db.data());
+    BOOST_CHECK_SMALL(power_db[0], 0.01f);
+    BOOST_CHECK_CLOSE(power_db[1], -6.02f, 0.1);
+    BOOST_CHECK_CLOSE(power_db[2], -93.3f, 0.1);
+}
@@ -113,6 +113,84 @@ BOOST_AUTO_TEST_CASE(test_sph_recv_one_channel_normal)
         handler.recv(&buff.front(), buff.size(), metadata, 1.0, true), uhd::io_error);
 }
 
+////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_sph_recv_one_channel_chdr_xport)
+{
+    ////////////////////////////////////////////////////////////////////////
+    uhd::convert::id_type id;
+    id.input_format  = "sc16_item32_be";
+    id.num_inputs    = 1;
+    id.output_format = "fc32";
+    id.num_outputs   = 1;
+
+    auto xport = std::make_shared<mock_zero_copy>(vrt::if_packet_info_t::LINK_TYPE_CHDR);
+
+    vrt::if_packet_info_t ifpi;
+    ifpi.link_type           = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+    ifpi.packet_type         = vrt::if_packet_info_t::PACKET_TYPE_DATA;
+    ifpi.num_payload_words32 = 0;
+    ifpi.packet_count        = 0;
+    ifpi.sob                 = false;
+    ifpi.eob                 = false;
+    ifpi.has_sid             = true;
+    ifpi.sid                 = 0x00a0;
+    ifpi.has_cid             = false;
+    ifpi.has_tsi             = false;
+    ifpi.has_tsf             = true;
+    ifpi.tsf                 = 0;
+    ifpi.has_tlr             = false;
+
+    static const double TICK_RATE        = 100e6;
+    static const double SAMP_RATE        = 10e6;
+    static const size_t NUM_PKTS_TO_TEST = 30;
+
+    // create the super receive packet handler, getting buffers straight from
+    // the transport and using the dedicated CHDR unpacker
+    uhd::transport::sph::recv_packet_handler handler(1);
+    handler.set_vrt_unpacker(&uhd::transport::vrt::if_hdr_unpack_chdr_be);
+    handler.set_tick_rate(TICK_RATE);
+    handler.set_samp_rate(SAMP_RATE);
+    handler.set_converter(id);
+
+    // a stale packet gets flushed
+    std::vector<uint32_t> stale(4, 0);
+    ifpi.num_payload_words32 = stale.size();
+    xport->push_back_recv_packet(ifpi, stale);
+    handler.set_xport_chan_get_buff(0, xport, true /*flush*/);
+
+    // generate a bunch of packets
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        ifpi.num_payload_words32 = 10 + i % 10;
+        std::vector<uint32_t> data(ifpi.num_payload_words32, 0);
+        ifpi.eob = (i == NUM_PKTS_TO_TEST - 1);
+        xport->push_back_recv_packet(ifpi, data);
+        ifpi.packet_count++;
+        ifpi.tsf += ifpi.num_payload_words32 * size_t(TICK_RATE / SAMP_RATE);
+    }
+
+    // check the received packets
+    size_t num_accum_samps = 0;
+    std::vector<std::complex<float>> buff(20);
+    uhd::rx_metadata_t metadata;
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        std::cout << "data check " << i << std::endl;
+        size_t num_samps_ret =
+            handler.recv(&buff.front(), buff.size(), metadata, 1.0, true);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK(not metadata.more_fragments);
+        BOOST_CHECK(metadata.has_time_spec);
+        BOOST_CHECK_TS_CLOSE(
+            metadata.time_spec, uhd::time_spec_t::from_ticks(num_accum_samps, SAMP_RATE));
+        BOOST_CHECK_EQUAL(metadata.end_of_burst, i == NUM_PKTS_TO_TEST - 1);
+        BOOST_CHECK_EQUAL(num_samps_ret, 10 + i % 10);
+        num_accum_samps += num_samps_ret;
+    }
+
+    // subsequent receives should be a timeout
+    handler.recv(&buff.front(), buff.size(), metadata, 1.0, true);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+}
+
 ////////////////////////////////////////////////////////////////////////
 BOOST_AUTO_TEST_CASE(test_sph_recv_one_channel_sequence_error)
 {
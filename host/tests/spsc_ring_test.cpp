@@ -0,0 +1,93 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/spsc_ring.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace uhd;
+
+BOOST_AUTO_TEST_CASE(test_spsc_ring_push_pop)
+{
+    // Capacity is rounded up to a power of two
+    spsc_ring<int> ring(3);
+    BOOST_CHECK_EQUAL(ring.capacity(), 4);
+
+    int val = -1;
+    BOOST_CHECK(!ring.pop(val));
+    BOOST_CHECK(!ring.peek(val));
+
+    // Go around the ring a few times
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++) {
+            BOOST_CHECK(ring.push(round * 4 + i));
+        }
+        BOOST_CHECK(!ring.push(100));
+        BOOST_CHECK_EQUAL(ring.read_available(), 4);
+
+        for (int i = 0; i < 4; i++) {
+            BOOST_CHECK(ring.peek(val));
+            BOOST_CHECK_EQUAL(val, round * 4 + i);
+            BOOST_CHECK(ring.pop(val));
+            BOOST_CHECK_EQUAL(val, round * 4 + i);
+        }
+        BOOST_CHECK(!ring.pop(val));
+        BOOST_CHECK_EQUAL(ring.read_available(), 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_spsc_ring_threaded)
+{
+    for (const bool blocking : {false, true}) {
+        constexpr size_t num_items = 100000;
+        spsc_ring<size_t> ring(16, blocking);
+
+        std::thread producer([&ring]() {
+            for (size_t i = 0; i < num_items; i++) {
+                while (!ring.push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        size_t val;
+        for (size_t i = 0; i < num_items; i++) {
+            if (blocking) {
+                BOOST_REQUIRE(ring.pop(val, -1));
+            } else {
+                while (!ring.pop(val)) {
+                    std::this_thread::yield();
+                }
+            }
+            if (val != i) {
+                BOOST_REQUIRE_EQUAL(val, i);
+            }
+        }
+        producer.join();
+        BOOST_CHECK(!ring.pop(val));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_spsc_ring_blocking_pop)
+{
+    spsc_ring<int> ring(4, true);
+    int val;
+
+    // Times out when nothing arrives
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(!ring.pop(val, 20));
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+    // Wakes up when an item is pushed
+    std::thread producer([&ring]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ring.push(42);
+    });
+    BOOST_CHECK(ring.pop(val, 5000));
+    BOOST_CHECK_EQUAL(val, 42);
+    producer.join();
+}
@@ -4,7 +4,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "../common/loopback_link.hpp"
 #include "../common/mock_link.hpp"
+#include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <uhdlib/rfnoc/chdr_rx_data_xport.hpp>
@@ -12,10 +14,16 @@
 #include <uhdlib/transport/inline_io_service.hpp>
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <uhdlib/transport/tx_streamer_impl.hpp>
+#include <boost/format.hpp>
 #include <boost/program_options.hpp>
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <regex>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace po = boost::program_options;
@@ -52,11 +60,15 @@ public:
         const void* payload  = nullptr;
     };
 
-    mock_rx_data_xport(const size_t buff_size) : _buff_size(buff_size)
+    mock_rx_data_xport(
+        const size_t buff_size, const bool eob = false, const bool eov = false)
+        : _buff_size(buff_size)
     {
         _buff = std::make_unique<buff_t>();
         _buff->data.resize(buff_size);
 
+        _packet_info.eob           = eob;
+        _packet_info.eov           = eov;
         _packet_info.has_tsf       = true;
         _packet_info.tsf           = 1000;
         _packet_info.payload_bytes = buff_size;
@@ -142,6 +154,11 @@ public:
         return std::make_pair(data + sizeof(info), sizeof(info) + info.payload_bytes);
     }
 
+    void* get_payload_ptr(buff_t::uptr& buff, const bool /*has_tsf*/) const
+    {
+        return buff->data.data() + sizeof(packet_info_t);
+    }
+
     void release_send_buff(buff_t::uptr buff)
     {
         _buff = std::move(buff);
@@ -237,55 +254,300 @@ using tx_streamer_mock_xport = mock_tx_streamer<mock_tx_data_xport>;
 using rx_streamer_mock_link  = mock_rx_streamer<chdr_rx_data_xport>;
 using tx_streamer_mock_link  = mock_tx_streamer<chdr_tx_data_xport>;
 
+/*!
+ * Stream endpoint of a device on the far side of loopback links, which runs on
+ * a thread of its own. As the source of an rx stream, it sends data packets as
+ * fast as the flow control of the host allows. As the sink of a tx stream, it
+ * discards the data packets, and returns their flow control credit. The device
+ * does nothing else, so the loopback benchmarks measure the upper limit of the
+ * host side: the streamer, the CHDR data transport, the flow control and the
+ * I/O service.
+ */
+class loopback_sep
+{
+public:
+    using uptr = std::unique_ptr<loopback_sep>;
+
+    //! The number of frames in every direction, which is also the buffer
+    // capacity of the host (rx) or the device (tx) in packets
+    static constexpr size_t NUM_FRAMES = 32;
+
+    /*!
+     * \param pkt_factory The packet factory of the host
+     * \param epids The endpoint IDs of the xport of the host
+     * \param frame_size The size of the data packets
+     * \param spp The number of samples per data packet
+     * \param is_source True for an rx stream
+     */
+    loopback_sep(const chdr::chdr_packet_factory& pkt_factory,
+        const sep_id_pair_t& epids,
+        const size_t frame_size,
+        const size_t spp,
+        const bool is_source)
+        : _pkt_factory(pkt_factory)
+        , _epids(epids)
+        , _frame_size(frame_size)
+        , _spp(spp)
+        , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
+    {
+        _to_host   = std::make_shared<loopback_channel>(NUM_FRAMES, frame_size);
+        _from_host = std::make_shared<loopback_channel>(NUM_FRAMES, frame_size);
+        _send_link = std::make_shared<loopback_send_link>(_to_host);
+        _recv_link = std::make_shared<loopback_recv_link>(_from_host);
+        _thread    = std::thread([this, is_source]() {
+            if (is_source) {
+                _source_worker();
+            } else {
+                _sink_worker();
+            }
+        });
+    }
+
+    ~loopback_sep()
+    {
+        _stop = true;
+        _thread.join();
+    }
+
+    //! The link from which the host receives
+    recv_link_if::sptr make_host_recv_link() const
+    {
+        return std::make_shared<loopback_recv_link>(_to_host);
+    }
+
+    //! The link through which the host sends
+    send_link_if::sptr make_host_send_link() const
+    {
+        return std::make_shared<loopback_send_link>(_from_host);
+    }
+
+    //! The buffer capacity of the receiver of the data packets
+    stream_buff_params_t get_capacity() const
+    {
+        return {NUM_FRAMES * _round(_frame_size), uint32_t(NUM_FRAMES)};
+    }
+
+    //! The flow control frequency of the receiver of the data packets
+    stream_buff_params_t get_fc_freq() const
+    {
+        return {get_capacity().bytes / 8, uint32_t(NUM_FRAMES / 8)};
+    }
+
+private:
+    static constexpr int32_t POLL_TIMEOUT_MS = 10;
+
+    uint64_t _round(const size_t packet_size) const
+    {
+        return (packet_size + _chdr_w_bytes - 1) & ~(_chdr_w_bytes - 1);
+    }
+
+    void _source_worker()
+    {
+        auto data_pkt = _pkt_factory.make_generic();
+        auto strs_pkt = _pkt_factory.make_strs();
+        chdr::chdr_header header;
+        header.set_pkt_type(chdr::PKT_TYPE_DATA_WITH_TS);
+        header.set_length(_frame_size);
+        header.set_dst_epid(_epids.second);
+        const stream_buff_params_t capacity = get_capacity();
+
+        stream_buff_params_t sent{0, 0}, acked{0, 0};
+        uint64_t tsf     = 1000;
+        uint16_t seq_num = 0;
+        // The host returns credit with strs packets (and nothing else)
+        auto recv_strs = [&](const int32_t timeout_ms) {
+            auto buff = _recv_link->get_recv_buff(timeout_ms);
+            if (!buff) {
+                return false;
+            }
+            strs_pkt->refresh(buff->data());
+            const auto strs = strs_pkt->get_payload();
+            acked           = {strs.xfer_count_bytes, uint32_t(strs.xfer_count_pkts)};
+            _recv_link->release_recv_buff(std::move(buff));
+            return true;
+        };
+
+        while (!_stop) {
+            while (recv_strs(0)) {
+            }
+            if (sent.packets - acked.packets >= capacity.packets
+                || sent.bytes - acked.bytes + _round(_frame_size) > capacity.bytes) {
+                recv_strs(POLL_TIMEOUT_MS);
+                continue;
+            }
+            auto buff = _send_link->get_send_buff(POLL_TIMEOUT_MS);
+            if (!buff) {
+                continue;
+            }
+            header.set_seq_num(seq_num++);
+            data_pkt->refresh(buff->data(), header, tsf);
+            tsf += _spp;
+            buff->set_packet_size(_frame_size);
+            _send_link->release_send_buff(std::move(buff));
+            sent.bytes += _round(_frame_size);
+            sent.packets++;
+        }
+    }
+
+    void _sink_worker()
+    {
+        auto header_pkt = _pkt_factory.make_generic();
+        auto strc_pkt   = _pkt_factory.make_strc();
+        auto strs_pkt   = _pkt_factory.make_strs();
+
+        const stream_buff_params_t fc_freq = get_fc_freq();
+
+        chdr::chdr_header strs_header;
+        strs_header.set_pkt_type(chdr::PKT_TYPE_STRS);
+        strs_header.set_dst_epid(_epids.first);
+        chdr::strs_payload strs;
+        strs.src_epid       = _epids.second;
+        strs.status         = chdr::STRS_OKAY;
+        strs.capacity_bytes = get_capacity().bytes;
+        strs.capacity_pkts  = get_capacity().packets;
+
+        stream_buff_params_t received{0, 0}, reported{0, 0};
+        bool strs_pending = false;
+        while (!_stop) {
+            // Keep polling while a strs packet is pending, because it might
+            // be all the host is waiting for
+            auto buff = _recv_link->get_recv_buff(strs_pending ? 0 : POLL_TIMEOUT_MS);
+            if (buff) {
+                const auto header = header_pkt->read_chdr_header(buff->data());
+                if (header.get_pkt_type() == chdr::PKT_TYPE_STRC) {
+                    strc_pkt->refresh(buff->data());
+                    const auto strc = strc_pkt->get_payload();
+                    received        = {strc.num_bytes, uint32_t(strc.num_pkts)};
+                    strs_pending    = true;
+                } else {
+                    received.bytes += _round(buff->packet_size());
+                    received.packets++;
+                }
+                _recv_link->release_recv_buff(std::move(buff));
+            }
+            strs_pending = strs_pending
+                           || received.bytes - reported.bytes >= fc_freq.bytes
+                           || received.packets - reported.packets >= fc_freq.packets;
+            if (!strs_pending) {
+                continue;
+            }
+            // The counts are cumulative, so if the host has no free frame,
+            // the next strs packet makes up for this one
+            auto strs_buff = _send_link->get_send_buff(0);
+            if (!strs_buff) {
+                continue;
+            }
+            strs.xfer_count_bytes = received.bytes;
+            strs.xfer_count_pkts  = received.packets;
+            strs_pkt->refresh(strs_buff->data(), strs_header, strs);
+            strs_buff->set_packet_size(strs_pkt->get_chdr_header().get_length());
+            _send_link->release_send_buff(std::move(strs_buff));
+            reported     = received;
+            strs_pending = false;
+        }
+    }
+
+    const chdr::chdr_packet_factory _pkt_factory;
+    const sep_id_pair_t _epids;
+    const size_t _frame_size;
+    const size_t _spp;
+    const size_t _chdr_w_bytes;
+    loopback_channel::sptr _to_host;
+    loopback_channel::sptr _from_host;
+    loopback_send_link::sptr _send_link;
+    loopback_recv_link::sptr _recv_link;
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+};
+
+/*!
+ * Metadata patterns of the benchmarks
+ */
+enum class pattern_t {
+    //! Continuous streaming without metadata
+    NONE,
+    //! A time spec on every send() (TX only)
+    TIMESPEC,
+    //! An end of burst on every packet (RX) or send() (TX)
+    EOB,
+    //! An end of vector on every packet (RX), or four per send() (TX)
+    EOV
+};
+
+static std::string pattern_to_string(const pattern_t pattern)
+{
+    switch (pattern) {
+        case pattern_t::TIMESPEC:
+            return "timespec";
+        case pattern_t::EOB:
+            return "eob";
+        case pattern_t::EOV:
+            return "eov";
+        default:
+            return "none";
+    }
+}
+
 /*!
  * Helper functions
  */
 static std::shared_ptr<rx_streamer_mock_xport> make_rx_streamer_mock_xport(
-    const size_t spp, const std::string& format)
+    const size_t num_chans,
+    const size_t spp,
+    const std::string& otw_format,
+    const std::string& cpu_format,
+    const pattern_t pattern)
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
-    auto streamer = std::make_shared<rx_streamer_mock_xport>(1, stream_args);
+    const uhd::stream_args_t stream_args(cpu_format, otw_format);
+    auto streamer = std::make_shared<rx_streamer_mock_xport>(num_chans, stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
-    streamer->set_scale_factor(0, SCALE_FACTOR);
 
-    const size_t bpi        = convert::get_bytes_per_item(format);
+    const size_t bpi        = convert::get_bytes_per_item(otw_format);
     const size_t frame_size = bpi * spp;
 
-    auto xport = std::make_unique<mock_rx_data_xport>(frame_size);
-
-    streamer->connect_channel(0, std::move(xport));
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        streamer->connect_channel(chan,
+            std::make_unique<mock_rx_data_xport>(
+                frame_size, pattern == pattern_t::EOB, pattern == pattern_t::EOV));
+    }
 
     return streamer;
 }
 
 static std::shared_ptr<tx_streamer_mock_xport> make_tx_streamer_mock_xport(
-    const size_t spp, const std::string& format)
+    const size_t num_chans,
+    const size_t spp,
+    const std::string& otw_format,
+    const std::string& cpu_format)
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
-    auto streamer = std::make_shared<tx_streamer_mock_xport>(1, stream_args);
+    const uhd::stream_args_t stream_args(cpu_format, otw_format);
+    auto streamer = std::make_shared<tx_streamer_mock_xport>(num_chans, stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
-    streamer->set_scale_factor(0, SCALE_FACTOR);
 
-    const size_t bpi        = convert::get_bytes_per_item(format);
+    const size_t bpi        = convert::get_bytes_per_item(otw_format);
     const size_t frame_size = bpi * spp + sizeof(mock_tx_data_xport::packet_info_t);
 
-    auto xport = std::make_unique<mock_tx_data_xport>(frame_size);
-
-    streamer->connect_channel(0, std::move(xport));
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        streamer->connect_channel(chan, std::make_unique<mock_tx_data_xport>(frame_size));
+    }
 
     return streamer;
 }
 
 static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_mock_link(
-    const size_t spp, const std::string& format)
+    const size_t num_chans,
+    const size_t spp,
+    const std::string& otw_format,
+    const std::string& cpu_format)
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
-    auto streamer = std::make_shared<rx_streamer_mock_link>(1, stream_args);
+    const uhd::stream_args_t stream_args(cpu_format, otw_format);
+    auto streamer = std::make_shared<rx_streamer_mock_link>(num_chans, stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
-    streamer->set_scale_factor(0, SCALE_FACTOR);
 
     const chdr::chdr_packet_factory pkt_factory(CHDR_W_64, ENDIANNESS_BIG);
     const sep_id_pair_t epids                = {0, 1};
@@ -293,158 +555,533 @@ static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_mock_link(
     const stream_buff_params_t fc_freq       = {UINT64_MAX, UINT32_MAX};
     const chdr_rx_data_xport::fc_params_t fc_params{buff_capacity, fc_freq};
 
-    const size_t bpi        = convert::get_bytes_per_item(format);
+    const size_t bpi        = convert::get_bytes_per_item(otw_format);
     const size_t frame_size = bpi * spp + 16;
 
     const mock_recv_link::link_params recv_params = {frame_size, 1};
     const mock_send_link::link_params send_params = {frame_size, 1};
 
-    auto recv_link = std::make_shared<mock_recv_link>(recv_params, true);
-    auto send_link = std::make_shared<mock_send_link>(send_params, true);
-
-    boost::shared_array<uint8_t> recv_frame(new uint8_t[frame_size]);
-    auto pkt = pkt_factory.make_generic();
-    chdr::chdr_header header;
-    header.set_pkt_type(chdr::PKT_TYPE_DATA_WITH_TS);
-    header.set_length(frame_size);
-    header.set_dst_epid(epids.second);
-    pkt->refresh(recv_frame.get(), header, 1000 /*tsf*/);
-
-    recv_link->push_back_recv_packet(recv_frame, frame_size);
-
-    auto io_srv = inline_io_service::make();
-    io_srv->attach_recv_link(recv_link);
-    io_srv->attach_send_link(send_link);
-
-    auto xport = std::make_unique<chdr_rx_data_xport>(io_srv,
-        recv_link,
-        send_link,
-        pkt_factory,
-        epids,
-        send_link->get_num_send_frames(),
-        fc_params,
-        [io_srv = io_srv, recv_link, send_link]() {
-            io_srv->detach_recv_link(recv_link);
-            io_srv->detach_send_link(send_link);
-        });
-
-    streamer->connect_channel(0, std::move(xport));
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        auto recv_link = std::make_shared<mock_recv_link>(recv_params, true);
+        auto send_link = std::make_shared<mock_send_link>(send_params, true);
+
+        boost::shared_array<uint8_t> recv_frame(new uint8_t[frame_size]);
+        auto pkt = pkt_factory.make_generic();
+        chdr::chdr_header header;
+        header.set_pkt_type(chdr::PKT_TYPE_DATA_WITH_TS);
+        header.set_length(frame_size);
+        header.set_dst_epid(epids.second);
+        pkt->refresh(recv_frame.get(), header, 1000 /*tsf*/);
+
+        recv_link->push_back_recv_packet(recv_frame, frame_size);
+
+        auto io_srv = inline_io_service::make();
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+
+        auto xport = std::make_unique<chdr_rx_data_xport>(io_srv,
+            recv_link,
+            send_link,
+            pkt_factory,
+            epids,
+            send_link->get_num_send_frames(),
+            fc_params,
+            [io_srv = io_srv, recv_link, send_link]() {
+                io_srv->detach_recv_link(recv_link);
+                io_srv->detach_send_link(send_link);
+            });
+
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        streamer->connect_channel(chan, std::move(xport));
+    }
     return streamer;
 }
 
 static std::shared_ptr<tx_streamer_mock_link> make_tx_streamer_mock_link(
-    const size_t spp, const std::string& format)
+    const size_t num_chans,
+    const size_t spp,
+    const std::string& otw_format,
+    const std::string& cpu_format)
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
-    auto streamer = std::make_shared<tx_streamer_mock_link>(1, stream_args);
+    const uhd::stream_args_t stream_args(cpu_format, otw_format);
+    auto streamer = std::make_shared<tx_streamer_mock_link>(num_chans, stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
-    streamer->set_scale_factor(0, SCALE_FACTOR);
 
     const chdr::chdr_packet_factory pkt_factory(CHDR_W_64, ENDIANNESS_BIG);
     const sep_id_pair_t epids                = {0, 1};
     const stream_buff_params_t buff_capacity = {UINT64_MAX, UINT32_MAX};
     const chdr_tx_data_xport::fc_params_t fc_params{buff_capacity};
 
-    const size_t bpi        = convert::get_bytes_per_item(format);
+    const size_t bpi        = convert::get_bytes_per_item(otw_format);
     const size_t frame_size = bpi * spp + 16;
 
     const mock_recv_link::link_params recv_params = {frame_size, 1};
     const mock_send_link::link_params send_params = {frame_size, 1};
 
-    auto recv_link = std::make_shared<mock_recv_link>(recv_params, true);
-    auto send_link = std::make_shared<mock_send_link>(send_params, true);
-
-    auto io_srv = inline_io_service::make();
-    io_srv->attach_recv_link(recv_link);
-    io_srv->attach_send_link(send_link);
-
-    auto xport = std::make_unique<chdr_tx_data_xport>(io_srv,
-        recv_link,
-        send_link,
-        pkt_factory,
-        epids,
-        send_link->get_num_send_frames(),
-        fc_params,
-        [io_srv = io_srv, recv_link, send_link]() {
-            io_srv->detach_recv_link(recv_link);
-            io_srv->detach_send_link(send_link);
-        });
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        auto recv_link = std::make_shared<mock_recv_link>(recv_params, true);
+        auto send_link = std::make_shared<mock_send_link>(send_params, true);
+
+        auto io_srv = inline_io_service::make();
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+
+        auto xport = std::make_unique<chdr_tx_data_xport>(io_srv,
+            recv_link,
+            send_link,
+            pkt_factory,
+            epids,
+            send_link->get_num_send_frames(),
+            fc_params,
+            [io_srv = io_srv, recv_link, send_link]() {
+                io_srv->detach_recv_link(recv_link);
+                io_srv->detach_send_link(send_link);
+            });
+
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        streamer->connect_channel(chan, std::move(xport));
+    }
+    return streamer;
+}
 
-    streamer->connect_channel(0, std::move(xport));
+/*!
+ * Make a streamer with a loopback device on every channel. The devices are
+ * appended to \p seps, which must outlive the streamer.
+ */
+static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_loopback(
+    const size_t num_chans,
+    const size_t spp,
+    const std::string& otw_format,
+    const std::string& cpu_format,
+    std::vector<loopback_sep::uptr>& seps)
+{
+    const uhd::stream_args_t stream_args(cpu_format, otw_format);
+    auto streamer = std::make_shared<rx_streamer_mock_link>(num_chans, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+
+    const chdr::chdr_packet_factory pkt_factory(CHDR_W_64, ENDIANNESS_BIG);
+    const sep_id_pair_t epids = {0, 1};
+
+    const size_t bpi        = convert::get_bytes_per_item(otw_format);
+    const size_t frame_size = bpi * spp + 16;
+
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        seps.push_back(std::make_unique<loopback_sep>(
+            pkt_factory, epids, frame_size, spp, true /* is_source */));
+        const chdr_rx_data_xport::fc_params_t fc_params{
+            seps.back()->get_capacity(), seps.back()->get_fc_freq()};
+        auto recv_link = seps.back()->make_host_recv_link();
+        auto send_link = seps.back()->make_host_send_link();
+
+        auto io_srv = inline_io_service::make();
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+
+        auto xport = std::make_unique<chdr_rx_data_xport>(io_srv,
+            recv_link,
+            send_link,
+            pkt_factory,
+            epids,
+            recv_link->get_num_recv_frames(),
+            fc_params,
+            [io_srv = io_srv, recv_link, send_link]() {
+                io_srv->detach_recv_link(recv_link);
+                io_srv->detach_send_link(send_link);
+            });
+
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        streamer->connect_channel(chan, std::move(xport));
+    }
+    return streamer;
+}
+
+static std::shared_ptr<tx_streamer_mock_link> make_tx_streamer_loopback(
+    const size_t num_chans,
+    const size_t spp,
+    const std::string& otw_format,
+    const std::string& cpu_format,
+    std::vector<loopback_sep::uptr>& seps)
+{
+    const uhd::stream_args_t stream_args(cpu_format, otw_format);
+    auto streamer = std::make_shared<tx_streamer_mock_link>(num_chans, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+
+    const chdr::chdr_packet_factory pkt_factory(CHDR_W_64, ENDIANNESS_BIG);
+    const sep_id_pair_t epids = {0, 1};
+
+    const size_t bpi        = convert::get_bytes_per_item(otw_format);
+    const size_t frame_size = bpi * spp + 16;
+
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        seps.push_back(std::make_unique<loopback_sep>(
+            pkt_factory, epids, frame_size, spp, false /* is_source */));
+        const chdr_tx_data_xport::fc_params_t fc_params{seps.back()->get_capacity()};
+        auto recv_link = seps.back()->make_host_recv_link();
+        auto send_link = seps.back()->make_host_send_link();
+
+        auto io_srv = inline_io_service::make();
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+
+        auto xport = std::make_unique<chdr_tx_data_xport>(io_srv,
+            recv_link,
+            send_link,
+            pkt_factory,
+            epids,
+            send_link->get_num_send_frames(),
+            fc_params,
+            [io_srv = io_srv, recv_link, send_link]() {
+                io_srv->detach_recv_link(recv_link);
+                io_srv->detach_send_link(send_link);
+            });
+
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        streamer->connect_channel(chan, std::move(xport));
+    }
     return streamer;
 }
 
 /*!
- * Benchmark of rx streamer
+ * Benchmark harness, modeled after Google Benchmark: Every benchmark is a
+ * function which sets up its fixture, and then runs the code under test once
+ * for every iteration of the state. Only the loop over the state is timed.
  */
-void benchmark_rx_streamer(
-    rx_streamer::sptr streamer, const size_t spp, const std::string& format)
+class benchmark_state
 {
-    // Allocate buffer
-    const size_t bpi = convert::get_bytes_per_item(format);
-    std::vector<uint8_t> buffer(spp * bpi);
-    std::vector<void*> buffers;
-    buffers.push_back(buffer.data());
+public:
+    class iterator
+    {
+    public:
+        iterator(benchmark_state* state, const size_t remaining)
+            : _state(state), _remaining(remaining)
+        {
+        }
 
-    // Run benchmark
-    uhd::rx_metadata_t md;
+        bool operator!=(const iterator&)
+        {
+            if (_remaining > 0) {
+                return true;
+            }
+            _state->_stop_time = std::chrono::steady_clock::now();
+            return false;
+        }
+
+        iterator& operator++()
+        {
+            _remaining--;
+            return *this;
+        }
+
+        //! Returns the index of the iteration
+        size_t operator*() const
+        {
+            return _state->_iterations - _remaining;
+        }
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    private:
+        benchmark_state* _state;
+        size_t _remaining;
+    };
+
+    benchmark_state(const size_t iterations) : _iterations(iterations) {}
 
-    for (size_t i = 0; i < iterations; i++) {
-        streamer->recv(buffers, spp, md, 1.0, true);
+    iterator begin()
+    {
+        _start_time = std::chrono::steady_clock::now();
+        return iterator(this, _iterations);
     }
 
-    const auto end_time = std::chrono::steady_clock::now();
-    const std::chrono::duration<double> elapsed_time(end_time - start_time);
-    const double time_per_packet = elapsed_time.count() / iterations;
+    iterator end()
+    {
+        return iterator(this, 0);
+    }
+
+    size_t get_iterations() const
+    {
+        return _iterations;
+    }
+
+    double get_elapsed_time() const
+    {
+        return std::chrono::duration<double>(_stop_time - _start_time).count();
+    }
+
+    //! Set the number of samples (of all channels) every iteration processes
+    void set_samps_per_iteration(const size_t samps)
+    {
+        _samps_per_iteration = samps;
+    }
 
-    std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
-              << time_per_packet * 1e9 << " ns/packet\n";
+    size_t get_samps_per_iteration() const
+    {
+        return _samps_per_iteration;
+    }
+
+private:
+    const size_t _iterations;
+    size_t _samps_per_iteration = 0;
+    std::chrono::steady_clock::time_point _start_time;
+    std::chrono::steady_clock::time_point _stop_time;
+};
+
+struct benchmark_t
+{
+    std::string name;
+    std::function<void(benchmark_state&)> run;
+};
+
+struct benchmark_result_t
+{
+    std::string name;
+    size_t iterations;
+    double elapsed_time;
+    size_t samps_per_iteration;
+
+    double get_ns_per_iteration() const
+    {
+        return elapsed_time / iterations * 1e9;
+    }
+
+    double get_ns_per_samp() const
+    {
+        return get_ns_per_iteration() / samps_per_iteration;
+    }
+};
+
+/*!
+ * Run a benchmark for at least min_time seconds. The number of iterations is
+ * doubled until a run takes a tenth of that, and then scaled to min_time.
+ */
+static benchmark_result_t run_benchmark(
+    const benchmark_t& benchmark, const double min_time)
+{
+    size_t iterations = 1;
+    while (true) {
+        benchmark_state state(iterations);
+        benchmark.run(state);
+        const double elapsed_time = state.get_elapsed_time();
+        if (elapsed_time >= min_time) {
+            return {benchmark.name,
+                iterations,
+                elapsed_time,
+                state.get_samps_per_iteration()};
+        }
+        if (elapsed_time < min_time / 10) {
+            iterations *= 2;
+        } else {
+            iterations =
+                std::max(iterations + 1, size_t(iterations * min_time / elapsed_time));
+        }
+    }
+}
+
+/*!
+ * Benchmark of rx streamer
+ */
+static void benchmark_rx_streamer(benchmark_state& state,
+    rx_streamer::sptr streamer,
+    const size_t spp,
+    const std::string& cpu_format,
+    const pattern_t pattern)
+{
+    // Allocate buffers
+    const size_t bpi       = convert::get_bytes_per_item(cpu_format);
+    const size_t num_chans = streamer->get_num_channels();
+    std::vector<std::vector<uint8_t>> buffers(num_chans, std::vector<uint8_t>(spp * bpi));
+    std::vector<void*> buffer_ptrs;
+    for (auto& buffer : buffers) {
+        buffer_ptrs.push_back(buffer.data());
+    }
+
+    uhd::rx_metadata_t md;
+    std::vector<size_t> eov_positions(spp);
+    if (pattern == pattern_t::EOV) {
+        md.eov_positions      = eov_positions.data();
+        md.eov_positions_size = eov_positions.size();
+    }
+
+    for (const size_t i : state) {
+        (void)i;
+        streamer->recv(buffer_ptrs, spp, md, 1.0, true);
+    }
+    state.set_samps_per_iteration(spp * num_chans);
 }
 
 /*!
  * Benchmark of tx streamer
  */
-void benchmark_tx_streamer(tx_streamer::sptr streamer,
+static void benchmark_tx_streamer(benchmark_state& state,
+    tx_streamer::sptr streamer,
     const size_t spp,
-    const std::string& format,
-    bool use_time_spec)
+    const std::string& cpu_format,
+    const pattern_t pattern)
 {
-    // Allocate buffer
-    const size_t bpi = convert::get_bytes_per_item(format);
-    std::vector<uint8_t> buffer(spp * bpi);
-    std::vector<void*> buffers;
-    buffers.push_back(buffer.data());
+    // Allocate buffers
+    const size_t bpi       = convert::get_bytes_per_item(cpu_format);
+    const size_t num_chans = streamer->get_num_channels();
+    std::vector<std::vector<uint8_t>> buffers(num_chans, std::vector<uint8_t>(spp * bpi));
+    std::vector<const void*> buffer_ptrs;
+    for (auto& buffer : buffers) {
+        buffer_ptrs.push_back(buffer.data());
+    }
 
-    // Run benchmark
     uhd::tx_metadata_t md;
-    md.has_time_spec = use_time_spec;
-
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    md.has_time_spec  = pattern == pattern_t::TIMESPEC;
+    md.start_of_burst = pattern == pattern_t::EOB;
+    md.end_of_burst   = pattern == pattern_t::EOB;
+    std::vector<size_t> eov_positions{spp / 4, spp / 2, 3 * spp / 4, spp};
+    if (pattern == pattern_t::EOV) {
+        md.eov_positions      = eov_positions.data();
+        md.eov_positions_size = eov_positions.size();
+    }
 
-    for (size_t i = 0; i < iterations; i++) {
-        if (use_time_spec) {
-            md.time_spec = uhd::time_spec_t(i, 0.0);
+    for (const size_t i : state) {
+        if (md.has_time_spec) {
+            md.time_spec = uhd::time_spec_t(double(i), 0.0);
         }
-        streamer->send(buffers, spp, md, 1.0);
+        streamer->send(buffer_ptrs, spp, md, 1.0);
     }
+    state.set_samps_per_iteration(spp * num_chans);
+}
+
+/*!
+ * Register the benchmarks of all combinations of the parameters
+ */
+static std::vector<benchmark_t> make_benchmarks()
+{
+    const std::vector<size_t> num_chans_list    = {1, 2, 4, 8, 16};
+    const std::vector<size_t> spp_list          = {100, 2000};
+    const std::vector<std::pair<std::string, std::string>> formats = {
+        {"sc16", "sc16"}, {"sc16", "fc32"}, {"sc16", "fc64"}, {"sc8", "sc8"}};
+    const std::vector<pattern_t> rx_patterns = {
+        pattern_t::NONE, pattern_t::EOB, pattern_t::EOV};
+    const std::vector<pattern_t> tx_patterns = {
+        pattern_t::NONE, pattern_t::TIMESPEC, pattern_t::EOB, pattern_t::EOV};
+
+    auto make_name = [](const std::string& prefix,
+                         const size_t num_chans,
+                         const size_t spp,
+                         const std::string& otw_format,
+                         const std::string& cpu_format,
+                         const pattern_t pattern) {
+        return str(boost::format("%s/%s:%s/%uch/spp%u/%s") % prefix % otw_format
+                   % cpu_format % num_chans % spp % pattern_to_string(pattern));
+    };
 
-    const auto end_time = std::chrono::steady_clock::now();
-    const std::chrono::duration<double> elapsed_time(end_time - start_time);
-    const double time_per_packet = elapsed_time.count() / iterations;
+    std::vector<benchmark_t> benchmarks;
+    for (const auto& format : formats) {
+        const std::string otw = format.first;
+        const std::string cpu = format.second;
+        for (const size_t num_chans : num_chans_list) {
+            for (const size_t spp : spp_list) {
+                for (const pattern_t pattern : rx_patterns) {
+                    benchmarks.push_back(
+                        {make_name("rx_xport", num_chans, spp, otw, cpu, pattern),
+                            [=](benchmark_state& state) {
+                                benchmark_rx_streamer(state,
+                                    make_rx_streamer_mock_xport(
+                                        num_chans, spp, otw, cpu, pattern),
+                                    spp,
+                                    cpu,
+                                    pattern);
+                            }});
+                }
+                for (const pattern_t pattern : tx_patterns) {
+                    benchmarks.push_back(
+                        {make_name("tx_xport", num_chans, spp, cpu, otw, pattern),
+                            [=](benchmark_state& state) {
+                                benchmark_tx_streamer(state,
+                                    make_tx_streamer_mock_xport(num_chans, spp, otw, cpu),
+                                    spp,
+                                    cpu,
+                                    pattern);
+                            }});
+                }
+                benchmarks.push_back(
+                    {make_name("rx_link", num_chans, spp, otw, cpu, pattern_t::NONE),
+                        [=](benchmark_state& state) {
+                            benchmark_rx_streamer(state,
+                                make_rx_streamer_mock_link(num_chans, spp, otw, cpu),
+                                spp,
+                                cpu,
+                                pattern_t::NONE);
+                        }});
+                for (const pattern_t pattern : tx_patterns) {
+                    benchmarks.push_back(
+                        {make_name("tx_link", num_chans, spp, cpu, otw, pattern),
+                            [=](benchmark_state& state) {
+                                benchmark_tx_streamer(state,
+                                    make_tx_streamer_mock_link(num_chans, spp, otw, cpu),
+                                    spp,
+                                    cpu,
+                                    pattern);
+                            }});
+                }
+                benchmarks.push_back(
+                    {make_name("rx_loopback", num_chans, spp, otw, cpu, pattern_t::NONE),
+                        [=](benchmark_state& state) {
+                            std::vector<loopback_sep::uptr> seps;
+                            benchmark_rx_streamer(state,
+                                make_rx_streamer_loopback(num_chans, spp, otw, cpu, seps),
+                                spp,
+                                cpu,
+                                pattern_t::NONE);
+                        }});
+                benchmarks.push_back(
+                    {make_name("tx_loopback", num_chans, spp, cpu, otw, pattern_t::NONE),
+                        [=](benchmark_state& state) {
+                            std::vector<loopback_sep::uptr> seps;
+                            benchmark_tx_streamer(state,
+                                make_tx_streamer_loopback(num_chans, spp, otw, cpu, seps),
+                                spp,
+                                cpu,
+                                pattern_t::NONE);
+                        }});
+            }
+        }
+    }
+    return benchmarks;
+}
 
-    std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
-              << time_per_packet * 1e9 << " ns/packet\n";
+static void print_result(const benchmark_result_t& result, const std::string& format)
+{
+    if (format == "csv") {
+        std::cout << boost::format("%s,%u,%.1f,%.3f,%.2f\n") % result.name
+                         % result.iterations % result.get_ns_per_iteration()
+                         % result.get_ns_per_samp() % (1e3 / result.get_ns_per_samp());
+    } else if (format == "json") {
+        std::cout << boost::format("    {\"name\": \"%s\", \"iterations\": %u, "
+                                   "\"ns_per_iteration\": %.1f, \"ns_per_samp\": %.3f, "
+                                   "\"msps\": %.2f}")
+                         % result.name % result.iterations
+                         % result.get_ns_per_iteration() % result.get_ns_per_samp()
+                         % (1e3 / result.get_ns_per_samp());
+    } else {
+        std::cout << boost::format("%-44s %12.1f ns %9.3f ns %10.2f %12u\n")
+                         % result.name % result.get_ns_per_iteration()
+                         % result.get_ns_per_samp() % (1e3 / result.get_ns_per_samp())
+                         % result.iterations;
+    }
 }
 
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
+    std::string filter, format;
+    double min_time;
+
     po::options_description desc("Allowed options");
-    desc.add_options()("help", "help message");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("list", "list the benchmarks and exit")
+        ("filter", po::value<std::string>(&filter)->default_value(".*"), "only run the benchmarks whose names match this regular expression")
+        ("min_time", po::value<double>(&min_time)->default_value(0.1), "minimum run time of every benchmark in seconds (0 to run every benchmark once)")
+        ("format", po::value<std::string>(&format)->default_value("console"), "output format: console, csv, or json")
+    ;
+    // clang-format on
 
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -456,81 +1093,63 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         std::cout << "    Benchmark of send and receive streamer functions\n"
                      "    All benchmarks use mock transport objects. No\n"
                      "    parameters are needed to run this benchmark.\n"
+                     "    The benchmarks are named\n"
+                     "      <rx|tx>_<family>/<in>:<out>/<N>ch/spp<N>/<pattern>\n"
+                     "    The family is xport, link, or loopback. The xport benchmarks\n"
+                     "    measure the time spent in the streamer only, the link\n"
+                     "    benchmarks also the time spent in the I/O service and the\n"
+                     "    CHDR data transport. The loopback benchmarks stream to or\n"
+                     "    from a device thread per channel, with flow control, at the\n"
+                     "    highest rate the host side can sustain. The pattern is the\n"
+                     "    metadata of every call (none, timespec, eob, or eov).\n"
                   << std::endl;
         return EXIT_FAILURE;
     }
-
-    const char* formats[] = {"sc16", "fc32", "fc64"};
-    constexpr size_t spp  = 1000;
-    std::cout << "spp: " << spp << "\n";
-
-    std::cout << "----------------------------------------------------------\n";
-    std::cout << "Benchmark of recv with mock transport                     \n";
-    std::cout << "                                                          \n";
-    std::cout << "   Measures time spent in the rx streamer only.           \n";
-    std::cout << "----------------------------------------------------------\n";
-
-    std::cout << "*** with timespec ***\n";
-    for (size_t i = 0; i < std::extent<decltype(formats)>::value; i++) {
-        auto streamer = make_rx_streamer_mock_xport(spp, formats[i]);
-        benchmark_rx_streamer(streamer, spp, formats[i]);
+    if (format != "console" and format != "csv" and format != "json") {
+        std::cout << "Invalid output format: " << format << std::endl;
+        return EXIT_FAILURE;
     }
 
-    std::cout << "\n";
-    std::cout << "----------------------------------------------------------\n";
-    std::cout << "Benchmark of send with mock transport                     \n";
-    std::cout << "                                                          \n";
-    std::cout << "   Measures time time spent in the tx streamer only.      \n";
-    std::cout << "----------------------------------------------------------\n";
-
-    std::cout << "*** without timespec ***\n";
-    for (size_t i = 0; i < std::extent<decltype(formats)>::value; i++) {
-        auto streamer = make_tx_streamer_mock_xport(spp, formats[i]);
-        benchmark_tx_streamer(streamer, spp, formats[i], false);
+    const std::regex filter_regex(filter);
+    std::vector<benchmark_t> benchmarks;
+    for (const auto& benchmark : make_benchmarks()) {
+        if (std::regex_search(benchmark.name, filter_regex)) {
+            benchmarks.push_back(benchmark);
+        }
     }
-    std::cout << "\n";
-
-    std::cout << "*** with timespec ***\n";
-    for (size_t i = 0; i < std::extent<decltype(formats)>::value; i++) {
-        auto streamer = make_tx_streamer_mock_xport(spp, formats[i]);
-        benchmark_tx_streamer(streamer, spp, formats[i], true);
+    if (vm.count("list")) {
+        for (const auto& benchmark : benchmarks) {
+            std::cout << benchmark.name << std::endl;
+        }
+        return EXIT_SUCCESS;
     }
-    std::cout << "\n";
-
-    std::cout << "----------------------------------------------------------\n";
-    std::cout << "Benchmark of recv with mock link                          \n";
-    std::cout << "                                                          \n";
-    std::cout << "   Measures time time spent in the rx streamer, I/O       \n";
-    std::cout << "   service, and chdr data xport.                          \n";
-    std::cout << "----------------------------------------------------------\n";
 
-    std::cout << "*** with timespec ***\n";
-    for (size_t i = 0; i < std::extent<decltype(formats)>::value; i++) {
-        auto streamer = make_rx_streamer_mock_link(spp, formats[i]);
-        benchmark_rx_streamer(streamer, spp, formats[i]);
+    if (format == "csv") {
+        std::cout << "name,iterations,ns_per_iteration,ns_per_samp,msps\n";
+    } else if (format == "json") {
+        std::cout << "{\n  \"benchmarks\": [\n";
+    } else {
+        std::cout << boost::format("%-44s %15s %12s %10s %12s\n") % "Benchmark"
+                         % "Time/call" % "Time/samp" % "Msps" % "Iterations"
+                  << std::string(97, '-') << std::endl;
     }
-    std::cout << "\n";
-
-    std::cout << "----------------------------------------------------------\n";
-    std::cout << "Benchmark of send with mock link                          \n";
-    std::cout << "                                                          \n";
-    std::cout << "   Measures time time spent in the tx streamer, I/O       \n";
-    std::cout << "   service, and chdr data xport.                          \n";
-    std::cout << "----------------------------------------------------------\n";
-
-    std::cout << "*** without timespec ***\n";
-    for (size_t i = 0; i < std::extent<decltype(formats)>::value; i++) {
-        auto streamer = make_tx_streamer_mock_link(spp, formats[i]);
-        benchmark_tx_streamer(streamer, spp, formats[i], false);
+    bool first = true;
+    for (const auto& benchmark : benchmarks) {
+        if (format == "json" and not first) {
+            std::cout << ",\n";
+        }
+        try {
+            print_result(run_benchmark(benchmark, min_time), format);
+        } catch (const uhd::key_error&) {
+            // There is no converter for this combination of formats
+            std::cerr << "Skipping " << benchmark.name << ": No converter" << std::endl;
+            continue;
+        }
+        first = false;
     }
-    std::cout << "\n";
-
-    std::cout << "*** with timespec ***\n";
-    for (size_t i = 0; i < std::extent<decltype(formats)>::value; i++) {
-        auto streamer = make_tx_streamer_mock_link(spp, formats[i]);
-        benchmark_tx_streamer(streamer, spp, formats[i], true);
+    if (format == "json") {
+        std::cout << "\n  ]\n}\n";
     }
-    std::cout << "\n";
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/usrp/streamer_pool.hpp>
+#include <boost/test/unit_test.hpp>
+#include <memory>
+
+using namespace uhd::usrp;
+
+namespace {
+
+struct mock_streamer
+{
+    mock_streamer(size_t& num_destroyed) : num_destroyed(num_destroyed) {}
+
+    ~mock_streamer()
+    {
+        num_destroyed++;
+    }
+
+    void reset_stream_state()
+    {
+        num_resets++;
+    }
+
+    size_t& num_destroyed;
+    size_t num_resets = 0;
+};
+
+using pool_t = streamer_pool<mock_streamer>;
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_streamer_pool_reuse)
+{
+    size_t num_destroyed = 0;
+    auto pool            = pool_t::make(2);
+    BOOST_CHECK(!pool->acquire("a"));
+
+    auto streamer = pool->lend("a", {0}, std::make_shared<mock_streamer>(num_destroyed));
+    auto ptr      = streamer.get();
+    streamer.reset();
+    BOOST_CHECK_EQUAL(num_destroyed, 0);
+    BOOST_CHECK_EQUAL(pool->size(), 1);
+
+    // Only the same key hands out the streamer again, after a reset
+    BOOST_CHECK(!pool->acquire("b"));
+    streamer = pool->acquire("a");
+    BOOST_REQUIRE(streamer);
+    BOOST_CHECK_EQUAL(streamer.get(), ptr);
+    BOOST_CHECK_EQUAL(streamer->num_resets, 1);
+    BOOST_CHECK_EQUAL(pool->size(), 0);
+
+    // A weak reference must not keep the streamer out of the pool
+    std::weak_ptr<mock_streamer> weak = streamer;
+    streamer.reset();
+    BOOST_CHECK_EQUAL(pool->size(), 1);
+    BOOST_CHECK(weak.expired());
+
+    // Destroying the pool destroys the idle streamers
+    pool.reset();
+    BOOST_CHECK_EQUAL(num_destroyed, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_streamer_pool_capacity)
+{
+    size_t num_destroyed = 0;
+    auto pool            = pool_t::make(1);
+
+    auto s0 = pool->lend("a", {0}, std::make_shared<mock_streamer>(num_destroyed));
+    auto s1 = pool->lend("b", {1}, std::make_shared<mock_streamer>(num_destroyed));
+    s0.reset();
+    s1.reset();
+    BOOST_CHECK_EQUAL(pool->size(), 1);
+    BOOST_CHECK_EQUAL(num_destroyed, 1);
+    BOOST_CHECK(pool->acquire("a"));
+
+    // Without the pool, released streamers are destroyed
+    size_t num_orphans_destroyed = 0;
+    auto orphan =
+        pool->lend("c", {2}, std::make_shared<mock_streamer>(num_orphans_destroyed));
+    pool.reset();
+    orphan.reset();
+    BOOST_CHECK_EQUAL(num_orphans_destroyed, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_streamer_pool_evict)
+{
+    size_t num_destroyed = 0;
+    auto pool            = pool_t::make(4);
+    pool->lend("a", {0, 1}, std::make_shared<mock_streamer>(num_destroyed));
+    pool->lend("b", {2}, std::make_shared<mock_streamer>(num_destroyed));
+    pool->lend("c", {3}, std::make_shared<mock_streamer>(num_destroyed));
+    BOOST_CHECK_EQUAL(pool->size(), 3);
+
+    pool->evict({1, 2});
+    BOOST_CHECK_EQUAL(num_destroyed, 2);
+    BOOST_CHECK(!pool->acquire("a"));
+    BOOST_CHECK(!pool->acquire("b"));
+
+    pool->clear();
+    BOOST_CHECK_EQUAL(pool->size(), 0);
+    BOOST_CHECK_EQUAL(num_destroyed, 3);
+}
@@ -9,10 +9,16 @@ aggregates results.
 
 Example usage:
 batch_run_benchmark_rate.py --path <benchmark_rate_dir>/benchmark_rate --iterations 1 --args "addr=192.168.30.2" --rx_rate 1e6
+
+With --time_series, the results are read from the JSON output of benchmark
+rate, and the intervals in which the throughput changed, or errors occurred,
+are listed for every iteration.
 """
 import argparse
 import collections
+import os
 import re
+import tempfile
 import parse_benchmark_rate
 import run_benchmark_rate
 
@@ -40,19 +46,40 @@ def calculate_stats(results):
         max_vals      = result_max,
         non_zero_vals = result_nz)
 
-def run(path, iterations, benchmark_rate_params, stop_on_error=True):
+def run(path, iterations, benchmark_rate_params, stop_on_error=True,
+        throughput_changes=None, tolerance=0.01):
     """
     Runs benchmark rate multiple times and returns a list of parsed results.
+
+    If throughput_changes is a list, the results are read from the JSON output
+    of benchmark rate, and the intervals in which the throughput deviated from
+    the rate by more than the tolerance (or errors occurred) are appended to it,
+    as one list per iteration.
     """
     print("Running benchmark rate {} times with the following arguments: ".format(iterations))
     for key, val in benchmark_rate_params.items():
         print("{:14} {}".format(key, val))
 
+    json_dir = None
+    if throughput_changes is not None:
+        json_dir = tempfile.TemporaryDirectory()
+        benchmark_rate_params = dict(benchmark_rate_params)
+        benchmark_rate_params["json"] = os.path.join(json_dir.name, "results.json")
+
     parsed_results = []
     iteration = 0
     while iteration < iterations:
         proc = run_benchmark_rate.run(path, benchmark_rate_params)
-        result = parse_benchmark_rate.parse(proc.stdout.decode('ASCII'))
+        result = None
+        if json_dir is None:
+            result = parse_benchmark_rate.parse(proc.stdout.decode('ASCII'))
+        elif os.path.exists(benchmark_rate_params["json"]):
+            with open(benchmark_rate_params["json"]) as json_file:
+                json_str = json_file.read()
+            os.remove(benchmark_rate_params["json"])
+            result = parse_benchmark_rate.parse_json(json_str)
+            throughput_changes.append(
+                parse_benchmark_rate.find_throughput_changes(json_str, tolerance))
         if result != None:
             parsed_results.append(result)
             iteration += 1
@@ -179,6 +206,32 @@ def get_summary_string(stats, iterations, params):
 
     return s
 
+def get_throughput_changes_string(throughput_changes):
+    """
+    Returns the intervals with throughput changes or errors of every iteration.
+    """
+    def fraction_str(fraction):
+        return "-" if fraction is None else "{:.1f}%".format(fraction * 100)
+
+    s = ""
+    for iteration, changes in enumerate(throughput_changes):
+        if not changes:
+            continue
+        s += "Iteration {}:\n".format(iteration)
+        for change in changes:
+            s += "  {:8.2f}s: rx {:>7} tx {:>7}".format(
+                change['time'],
+                fraction_str(change['rx_fraction']),
+                fraction_str(change['tx_fraction']))
+            for key in ('dropped_samps', 'overruns', 'rx_seq_errs', 'tx_seq_errs',
+                        'underruns', 'late_cmds', 'rx_timeouts', 'tx_timeouts'):
+                if change[key]:
+                    s += ", {} {}".format(key, change[key])
+            s += "\n"
+    if not s:
+        s = "No throughput changes or errors during any iteration.\n"
+    return s
+
 def parse_args():
     """
     Parse the command line arguments for batch run benchmark rate.
@@ -187,11 +240,20 @@ def parse_args():
     parser = argparse.ArgumentParser()
     parser.add_argument("--path", type=str, required=True, help="path to benchmark rate example")
     parser.add_argument("--iterations", type=int, default=100, help="number of iterations to run")
+    parser.add_argument("--time_series", action="store_true",
+                        help="list the intervals in which the throughput changed")
+    parser.add_argument("--tolerance", type=float, default=0.01,
+                        help="largest deviation of the throughput from the rate "
+                             "(as a fraction) which is not listed as a change")
     params = parser.parse_args(rest)
-    return params.path, params.iterations, benchmark_rate_params
+    return params, benchmark_rate_params
 
 if __name__ == "__main__":
-    path, iterations, params = parse_args();
-    results = run(path, iterations, params)
+    args, params = parse_args();
+    throughput_changes = [] if args.time_series else None
+    results = run(args.path, args.iterations, params,
+                  throughput_changes=throughput_changes, tolerance=args.tolerance)
     stats = calculate_stats(results)
-    print(get_summary_string(stats, iterations, params))
+    print(get_summary_string(stats, args.iterations, params))
+    if throughput_changes is not None:
+        print(get_throughput_changes_string(throughput_changes))
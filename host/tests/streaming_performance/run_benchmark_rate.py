@@ -42,6 +42,8 @@ def create_parser():
     parser.add_argument("--tx_channels", type=str, help="which TX channel(s) to use")
     parser.add_argument("--priority", type=str, help="thread priority (normal, high)")
     parser.add_argument("--multi_streamer", action="count", help="create a separate streamer per channel")
+    parser.add_argument("--json", type=str, help="write the results, including a time series, to this JSON file")
+    parser.add_argument("--stats_interval", type=str, help="length of the intervals of the time series in seconds")
     return parser
 
 def parse_args():
@@ -0,0 +1,104 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/utils/thread_placement.hpp>
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using namespace uhd;
+
+namespace {
+
+/* Two sockets with one NUMA node and four cores each. CPUs 0-7 are the first
+ * SMT threads of the cores, CPUs 8-15 their siblings. Core 2 is isolated.
+ */
+std::vector<numa::cpu_info_t> make_topology()
+{
+    std::vector<numa::cpu_info_t> topology;
+    for (size_t cpu = 0; cpu < 16; cpu++) {
+        numa::cpu_info_t info;
+        info.cpu      = cpu;
+        info.core     = cpu % 8;
+        info.package  = int(info.core / 4);
+        info.node     = info.package;
+        info.isolated = info.core == 2;
+        topology.push_back(info);
+    }
+    return topology;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_placement_on_node)
+{
+    const auto topology = make_topology();
+
+    // The isolated core first, and the core of CPU 0 last
+    auto placement = numa::plan_thread_placement(topology, 2, 1, 1, 0);
+    BOOST_CHECK_EQUAL(placement.numa_node, 0);
+    BOOST_CHECK(placement.io_cpus == std::vector<size_t>({2, 1}));
+    BOOST_CHECK(placement.convert_cpus == std::vector<size_t>({3}));
+    BOOST_CHECK(placement.app_cpus == std::vector<size_t>({0}));
+    BOOST_CHECK(!placement.shares_cores);
+
+    placement = numa::plan_thread_placement(topology, 2, 1, 1, 1);
+    BOOST_CHECK_EQUAL(placement.numa_node, 1);
+    BOOST_CHECK(placement.io_cpus == std::vector<size_t>({4, 5}));
+    BOOST_CHECK(placement.convert_cpus == std::vector<size_t>({6}));
+    BOOST_CHECK(placement.app_cpus == std::vector<size_t>({7}));
+    BOOST_CHECK_EQUAL(placement.to_pp_string(),
+        "I/O threads on CPUs 4,5; converter threads on CPUs 6; application threads "
+        "on CPUs 7 (NUMA node 1)");
+}
+
+BOOST_AUTO_TEST_CASE(test_placement_shares_cores)
+{
+    // The other node is used before any SMT siblings
+    const auto placement = numa::plan_thread_placement(make_topology(), 10, 0, 0, 0);
+    BOOST_CHECK(placement.io_cpus
+                == std::vector<size_t>({2, 1, 3, 0, 4, 5, 6, 7, 10, 9}));
+    BOOST_CHECK(placement.shares_cores);
+
+    // With more threads than CPUs, they wrap around
+    const auto crowded = numa::plan_thread_placement(make_topology(), 17, 0, 0, 0);
+    BOOST_CHECK_EQUAL(crowded.io_cpus.back(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_placement_unknown_node)
+{
+    const auto topology = make_topology();
+    for (const int node : {-1, 3}) {
+        const auto placement = numa::plan_thread_placement(topology, 1, 2, 0, node);
+        BOOST_CHECK_EQUAL(placement.numa_node, -1);
+        BOOST_CHECK(placement.io_cpus == std::vector<size_t>({2}));
+        BOOST_CHECK(placement.convert_cpus == std::vector<size_t>({1, 3}));
+        BOOST_CHECK(placement.app_cpus.empty());
+    }
+
+    const auto placement = numa::plan_thread_placement({}, 1, 1, 1, 0);
+    BOOST_CHECK(placement.io_cpus.empty());
+    BOOST_CHECK_EQUAL(placement.to_pp_string(), "no threads placed");
+}
+
+BOOST_AUTO_TEST_CASE(test_placement_this_machine)
+{
+    const auto topology = numa::get_cpu_topology();
+    BOOST_REQUIRE(!topology.empty());
+
+    const auto placement = get_thread_placement(1, 2, 1);
+    BOOST_CHECK_EQUAL(placement.io_cpus.size(), 1);
+    BOOST_CHECK_EQUAL(placement.convert_cpus.size(), 2);
+    BOOST_CHECK_EQUAL(placement.app_cpus.size(), 1);
+
+    BOOST_CHECK(numa::get_convert_cpus(device_addr_t("convert_cpus=1:2"), 2)
+                == std::vector<size_t>({1, 2}));
+    BOOST_CHECK(numa::get_convert_cpus(device_addr_t(""), 2).empty());
+    BOOST_CHECK(numa::get_convert_cpus(device_addr_t("convert_cpus=auto"), 2)
+                == placement.convert_cpus);
+    BOOST_CHECK_THROW(numa::get_convert_cpus(device_addr_t("convert_cpus=a"), 2),
+        uhd::value_error);
+}
@@ -0,0 +1,136 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/time_estimator.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace uhd;
+
+namespace {
+
+//! A device time which runs at 1 GHz, in sync with the host clock
+uint64_t get_device_ticks()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+constexpr double TICK_RATE = 1e9;
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_time_estimator_resync)
+{
+    size_t num_reads = 0;
+    time_estimator estimator([&num_reads]() {
+        num_reads++;
+        return get_device_ticks();
+    });
+
+    uint64_t last_ticks = estimator.get_ticks(TICK_RATE);
+    BOOST_CHECK_EQUAL(num_reads, 1);
+    for (size_t i = 0; i < 1000; i++) {
+        const uint64_t ticks = estimator.get_ticks(TICK_RATE);
+        BOOST_CHECK_GE(ticks, last_ticks);
+        last_ticks = ticks;
+    }
+    BOOST_CHECK_EQUAL(num_reads, 1);
+
+    // The device time jumps, which the estimate follows once it's invalidated
+    estimator.invalidate();
+    BOOST_CHECK_GE(estimator.get_ticks(TICK_RATE), last_ticks);
+    BOOST_CHECK_EQUAL(num_reads, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_time_estimator_accuracy)
+{
+    time_estimator estimator(&get_device_ticks, 0.2);
+    for (size_t i = 0; i < 10; i++) {
+        const uint64_t before = get_device_ticks();
+        const uint64_t ticks  = estimator.get_ticks(TICK_RATE);
+        const uint64_t after  = get_device_ticks();
+        // Generous bounds, as the host clock is the device clock here
+        BOOST_CHECK_GE(ticks + 1000000, before);
+        BOOST_CHECK_LE(ticks, after + 1000000);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_time_estimator_holdoff)
+{
+    size_t num_reads = 0;
+    time_estimator estimator([&num_reads]() {
+        num_reads++;
+        return get_device_ticks();
+    });
+
+    estimator.invalidate(0.1);
+    for (size_t i = 0; i < 5; i++) {
+        estimator.get_ticks(TICK_RATE);
+    }
+    BOOST_CHECK_EQUAL(num_reads, 5);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    for (size_t i = 0; i < 5; i++) {
+        estimator.get_ticks(TICK_RATE);
+    }
+    BOOST_CHECK_EQUAL(num_reads, 6);
+}
+
+BOOST_AUTO_TEST_CASE(test_time_estimator_strict)
+{
+    // Without a resync period, every estimate is a readback
+    size_t num_reads = 0;
+    time_estimator estimator(
+        [&num_reads]() {
+            num_reads++;
+            return get_device_ticks();
+        },
+        0.0);
+    for (size_t i = 0; i < 5; i++) {
+        estimator.get_ticks(TICK_RATE);
+    }
+    BOOST_CHECK_EQUAL(num_reads, 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_time_estimator_threads)
+{
+    std::atomic<size_t> num_reads{0};
+    time_estimator estimator(
+        [&num_reads]() {
+            num_reads++;
+            return get_device_ticks();
+        },
+        0.01);
+
+    // Boost.Test isn't thread safe, so the threads only count errors
+    std::atomic<size_t> num_errors{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; t++) {
+        threads.emplace_back([&estimator, &num_errors]() {
+            const auto end =
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+            while (std::chrono::steady_clock::now() < end) {
+                const uint64_t before = get_device_ticks();
+                const uint64_t ticks  = estimator.get_ticks(TICK_RATE);
+                if (ticks + 10000000 < before) {
+                    num_errors++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(num_errors.load(), 0);
+    // One readback per resync period, give or take a few
+    BOOST_CHECK_LE(num_reads.load(), 20);
+}
@@ -0,0 +1,70 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/traffic_monitor.hpp>
+#include <boost/test/unit_test.hpp>
+#include <limits>
+
+using namespace uhd::rfnoc;
+
+namespace {
+
+graph_edge_t make_edge(const std::string& src, const std::string& dst)
+{
+    graph_edge_t edge(0, 0, graph_edge_t::DYNAMIC, true);
+    edge.src_blockid = src;
+    edge.dst_blockid = dst;
+    return edge;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_compute_edge_stats)
+{
+    // The DDC has counters, the FFT and the streamer don't
+    traffic_counter_values_t prev;
+    prev.bus_clock_ticks        = 1000;
+    prev.shell_to_ce_xfer_count = 100;
+    prev.shell_to_ce_pkt_count  = 10;
+    prev.ce_to_shell_xfer_count = std::numeric_limits<uint64_t>::max() - 49;
+    prev.ce_to_shell_pkt_count  = 5;
+    traffic_counter_values_t cur = prev;
+    cur.bus_clock_ticks += 1000;
+    cur.shell_to_ce_xfer_count += 800;
+    cur.shell_to_ce_pkt_count += 8;
+    cur.ce_to_shell_xfer_count += 200;
+    cur.ce_to_shell_pkt_count += 2;
+
+    const std::vector<graph_edge_t> edges{make_edge("0/Radio#0", "0/DDC#0"),
+        make_edge("0/DDC#0", "0/FFT#0"),
+        make_edge("0/FFT#0", "RxStreamer#0")};
+    const auto stats = traffic_monitor::compute_edge_stats(
+        edges, {{"0/DDC#0", prev}}, {{"0/DDC#0", cur}}, 0.5);
+    BOOST_REQUIRE_EQUAL(stats.size(), 2);
+
+    // Into the DDC, counted by the destination block
+    BOOST_CHECK(stats[0].edge == edges[0]);
+    BOOST_CHECK_EQUAL(stats[0].counter_block, "0/DDC#0");
+    BOOST_CHECK_EQUAL(stats[0].xfers_per_sec, 1600.0);
+    BOOST_CHECK_EQUAL(stats[0].pkts_per_sec, 16.0);
+    BOOST_CHECK_EQUAL(stats[0].utilization, 0.8);
+
+    // Out of the DDC, across a wrap of the counter
+    BOOST_CHECK(stats[1].edge == edges[1]);
+    BOOST_CHECK_EQUAL(stats[1].xfers_per_sec, 400.0);
+    BOOST_CHECK_EQUAL(stats[1].pkts_per_sec, 4.0);
+    BOOST_CHECK_EQUAL(stats[1].utilization, 0.2);
+
+    // A block needs two readings
+    BOOST_CHECK(
+        traffic_monitor::compute_edge_stats(edges, {}, {{"0/DDC#0", cur}}, 0.5).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_interval)
+{
+    BOOST_CHECK_THROW(traffic_monitor::make(nullptr, 0.0), uhd::value_error);
+}
@@ -166,6 +166,57 @@ BOOST_AUTO_TEST_CASE(test_muxed_io)
     UHD_ASSERT_THROW(msg == 0xa5d3b33f);
 }
 
+BOOST_AUTO_TEST_CASE(test_muxed_io_many_receivers)
+{
+    const size_t num_xports = 4;
+    auto io_srv             = inline_io_service::make();
+    auto mux_send_link      = make_send_link(80);
+    io_srv->attach_send_link(mux_send_link);
+    auto mux_recv_link = make_recv_link(80);
+    io_srv->attach_recv_link(mux_recv_link);
+
+    std::vector<mock_send_transport::sptr> send_xports;
+    std::vector<mock_recv_transport::sptr> recv_xports;
+    std::vector<mock_send_link::sptr> send_links;
+    for (size_t i = 0; i < num_xports; i++) {
+        const uint16_t dst_addr = 2 * i + 1;
+        const uint16_t src_addr = 2 * i + 2;
+        send_links.push_back(make_send_link(40));
+        io_srv->attach_send_link(send_links.back());
+        auto recv_link = make_recv_link(40);
+        io_srv->attach_recv_link(recv_link);
+        send_xports.push_back(make_send_xport(
+            io_srv, send_links.back(), recv_link, dst_addr, src_addr, 32));
+        recv_xports.push_back(make_recv_xport(
+            io_srv, mux_recv_link, mux_send_link, dst_addr, src_addr, 32));
+    }
+
+    /* Interleave two packets per receiver on the shared link */
+    for (size_t pkt = 0; pkt < 2; pkt++) {
+        for (size_t i = 0; i < num_xports; i++) {
+            auto send_buff = send_xports[i]->get_data_buff(0);
+            UHD_ASSERT_THROW(send_buff);
+            auto buff_data = send_xports[i]->buff_to_data(send_buff.get());
+            buff_data.first[0] = static_cast<uint32_t>(pkt * num_xports + i);
+            send_xports[i]->release_data_buff(send_buff, 1);
+            auto packet = send_links[i]->pop_send_packet();
+            mux_recv_link->push_back_recv_packet(packet.first, packet.second);
+        }
+    }
+
+    /* Receive in reverse order, so most packets are queued for later */
+    for (size_t i = num_xports; i-- > 0;) {
+        for (size_t pkt = 0; pkt < 2; pkt++) {
+            auto recv_buff = recv_xports[i]->get_data_buff(0);
+            UHD_ASSERT_THROW(recv_buff);
+            auto recv_data = recv_xports[i]->buff_to_data(recv_buff.get());
+            BOOST_CHECK_EQUAL(recv_data.second, 1);
+            BOOST_CHECK_EQUAL(recv_data.first[0], pkt * num_xports + i);
+            recv_xports[i]->release_data_buff(std::move(recv_buff));
+        }
+    }
+}
+
 /*
 BOOST_AUTO_TEST_CASE(test_oversubscribed)
 {
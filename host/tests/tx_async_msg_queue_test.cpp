@@ -0,0 +1,86 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+#ifdef __linux__
+#    include <poll.h>
+#endif
+
+using namespace uhd;
+using namespace uhd::rfnoc;
+
+namespace {
+
+async_metadata_t make_msg(const size_t channel)
+{
+    async_metadata_t md;
+    md.channel    = channel;
+    md.event_code = async_metadata_t::EVENT_CODE_BURST_ACK;
+    return md;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_overflow)
+{
+    tx_async_msg_queue queue(4);
+    for (size_t i = 0; i < 6; i++) {
+        queue.enqueue(make_msg(i));
+    }
+    BOOST_CHECK_EQUAL(queue.get_num_dropped(), 2);
+
+    // The oldest messages are kept
+    async_metadata_t md;
+    for (size_t i = 0; i < 4; i++) {
+        BOOST_REQUIRE(queue.recv_async_msg(md, 0));
+        BOOST_CHECK_EQUAL(md.channel, i);
+    }
+    BOOST_CHECK(!queue.recv_async_msg(md, 0));
+}
+
+BOOST_AUTO_TEST_CASE(test_blocking_recv)
+{
+    tx_async_msg_queue queue(4);
+    async_metadata_t md;
+
+    // Times out when nothing arrives
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(!queue.recv_async_msg(md, 20));
+    BOOST_CHECK(
+        std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+    // Wakes up when a message is pushed
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.enqueue(make_msg(3));
+    });
+    BOOST_CHECK(queue.recv_async_msg(md, 5000));
+    BOOST_CHECK_EQUAL(md.channel, 3);
+    producer.join();
+}
+
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(test_fd)
+{
+    tx_async_msg_queue queue(4);
+    pollfd pfd{queue.get_fd(), POLLIN, 0};
+    BOOST_CHECK_EQUAL(::poll(&pfd, 1, 0), 0);
+
+    queue.enqueue(make_msg(0));
+    queue.enqueue(make_msg(1));
+    BOOST_CHECK_EQUAL(::poll(&pfd, 1, 0), 1);
+
+    // Reading until the queue is empty clears the descriptor
+    async_metadata_t md;
+    BOOST_CHECK(queue.recv_async_msg(md, 0));
+    BOOST_CHECK(queue.recv_async_msg(md, 0));
+    BOOST_CHECK(!queue.recv_async_msg(md, 0));
+    BOOST_CHECK_EQUAL(::poll(&pfd, 1, 0), 0);
+}
+#endif
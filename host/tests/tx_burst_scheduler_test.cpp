@@ -0,0 +1,200 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/tx_burst_scheduler.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+//! A device time which starts at zero with the test, in sync with the host clock
+class mock_clock
+{
+public:
+    uhd::time_spec_t get_time() const
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - _start;
+        return uhd::time_spec_t(std::chrono::duration<double>(elapsed).count());
+    }
+
+private:
+    const std::chrono::steady_clock::time_point _start =
+        std::chrono::steady_clock::now();
+};
+
+//! Records the packets sent, and when they were sent
+class mock_tx_streamer : public uhd::tx_streamer
+{
+public:
+    struct packet_t
+    {
+        uhd::tx_metadata_t metadata;
+        std::vector<uint32_t> samps;
+        uhd::time_spec_t send_time;
+    };
+
+    mock_tx_streamer(const mock_clock& clock) : _clock(clock) {}
+
+    size_t get_num_channels(void) const override
+    {
+        return 1;
+    }
+
+    size_t get_max_num_samps(void) const override
+    {
+        return max_num_samps;
+    }
+
+    size_t send(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const uhd::tx_metadata_t& metadata,
+        const double) override
+    {
+        if (fail) {
+            throw uhd::runtime_error("mock send failed");
+        }
+        // Sends at most one packet per call, like a streamer which runs out of
+        // flow control credits
+        const size_t num_samps = std::min(nsamps_per_buff, max_num_samps);
+        const uint32_t* samps  = static_cast<const uint32_t*>(buffs[0]);
+        std::lock_guard<std::mutex> lock(_mutex);
+        const std::vector<uint32_t> packet_samps(samps, samps + num_samps);
+        _packets.push_back({metadata, packet_samps, _clock.get_time()});
+        return num_samps;
+    }
+
+    bool recv_async_msg(uhd::async_metadata_t&, double) override
+    {
+        return false;
+    }
+
+    std::vector<packet_t> get_packets()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _packets;
+    }
+
+    size_t max_num_samps = 1000;
+    std::atomic<bool> fail{false};
+
+private:
+    const mock_clock& _clock;
+    std::mutex _mutex;
+    std::vector<packet_t> _packets;
+};
+
+constexpr double LEAD_TIME = 0.05;
+
+uhd::tx_burst_scheduler::sptr make_scheduler(uhd::tx_streamer::sptr streamer,
+    const mock_clock& clock,
+    const double lead_time = LEAD_TIME)
+{
+    return uhd::tx_burst_scheduler::make(
+        streamer, "sc16", [&clock]() { return clock.get_time(); }, lead_time);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_tx_burst_scheduler_order)
+{
+    mock_clock clock;
+    auto streamer  = std::make_shared<mock_tx_streamer>(clock);
+    auto scheduler = make_scheduler(streamer, clock);
+
+    // Out of order, the scheduler sends them by their time
+    const std::vector<double> times = {0.3, 0.1, 0.2};
+    for (const double time : times) {
+        std::vector<uint32_t> samps(10, uint32_t(time * 10));
+        scheduler->submit({samps.data()}, samps.size(), uhd::time_spec_t(time));
+    }
+    BOOST_CHECK_EQUAL(scheduler->get_num_queued(), 3);
+    BOOST_REQUIRE(scheduler->wait_until_empty(1.0));
+    BOOST_CHECK_EQUAL(scheduler->get_num_queued(), 0);
+    BOOST_CHECK_EQUAL(scheduler->get_num_late(), 0);
+
+    const auto packets = streamer->get_packets();
+    BOOST_REQUIRE_EQUAL(packets.size(), 3);
+    for (size_t i = 0; i < packets.size(); i++) {
+        const double time = 0.1 * (i + 1);
+        const auto& md    = packets[i].metadata;
+        BOOST_CHECK(md.has_time_spec);
+        BOOST_CHECK_CLOSE(md.time_spec.get_real_secs(), time, 1e-6);
+        BOOST_CHECK(md.start_of_burst);
+        BOOST_CHECK(md.end_of_burst);
+        BOOST_CHECK_EQUAL(packets[i].samps.size(), 10);
+        BOOST_CHECK_EQUAL(packets[i].samps[0], uint32_t(time * 10));
+        // Sent within the lead time, and not before
+        BOOST_CHECK_GE(packets[i].send_time.get_real_secs(), time - LEAD_TIME - 1e-3);
+        BOOST_CHECK_LT(packets[i].send_time.get_real_secs(), time);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_tx_burst_scheduler_bursts)
+{
+    mock_clock clock;
+    auto streamer           = std::make_shared<mock_tx_streamer>(clock);
+    streamer->max_num_samps = 4;
+    auto scheduler          = make_scheduler(streamer, clock);
+
+    // A burst in two parts, the first of which takes several sends
+    std::vector<uint32_t> samps(10);
+    for (size_t i = 0; i < samps.size(); i++) {
+        samps[i] = uint32_t(i);
+    }
+    scheduler->submit({samps.data()}, 10, uhd::time_spec_t(0.1), false);
+    scheduler->submit({samps.data()}, 2, uhd::time_spec_t(0.2), true);
+    BOOST_REQUIRE(scheduler->wait_until_empty(1.0));
+
+    const auto packets = streamer->get_packets();
+    BOOST_REQUIRE_EQUAL(packets.size(), 4);
+    BOOST_CHECK(packets[0].metadata.start_of_burst);
+    BOOST_CHECK(packets[0].metadata.has_time_spec);
+    BOOST_CHECK_EQUAL(packets[1].samps[0], 4);
+    BOOST_CHECK(!packets[1].metadata.start_of_burst);
+    BOOST_CHECK(!packets[1].metadata.has_time_spec);
+    BOOST_CHECK_EQUAL(packets[2].samps.size(), 2);
+    BOOST_CHECK(!packets[3].metadata.start_of_burst);
+    BOOST_CHECK(packets[3].metadata.end_of_burst);
+    BOOST_CHECK_CLOSE(packets[3].metadata.time_spec.get_real_secs(), 0.2, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(test_tx_burst_scheduler_late)
+{
+    mock_clock clock;
+    auto streamer  = std::make_shared<mock_tx_streamer>(clock);
+    auto scheduler = make_scheduler(streamer, clock);
+
+    std::vector<uint32_t> samps(10);
+    scheduler->submit({samps.data()}, samps.size(), uhd::time_spec_t(-1.0));
+    BOOST_REQUIRE(scheduler->wait_until_empty(1.0));
+    BOOST_CHECK_EQUAL(scheduler->get_num_late(), 1);
+    BOOST_CHECK_EQUAL(streamer->get_packets().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_tx_burst_scheduler_errors)
+{
+    mock_clock clock;
+    auto streamer = std::make_shared<mock_tx_streamer>(clock);
+    BOOST_CHECK_THROW(make_scheduler(streamer, clock, -1.0), uhd::value_error);
+
+    auto scheduler = make_scheduler(streamer, clock);
+    std::vector<uint32_t> samps(10);
+    BOOST_CHECK_THROW(
+        scheduler->submit({}, samps.size(), uhd::time_spec_t(0.0)), uhd::value_error);
+
+    // Errors of send() are rethrown once
+    streamer->fail = true;
+    scheduler->submit({samps.data()}, samps.size(), uhd::time_spec_t(0.0));
+    BOOST_CHECK_THROW(scheduler->wait_until_empty(1.0), uhd::runtime_error);
+    BOOST_CHECK(scheduler->wait_until_empty(1.0));
+}
@@ -4,15 +4,23 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "../common/alloc_counter.hpp"
 #include "../common/mock_link.hpp"
+#include <uhd/rfnoc/host_resampler.hpp>
 #include <uhdlib/transport/tx_streamer_impl.hpp>
 #include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
 #include <complex>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 namespace uhd { namespace transport {
 
+//! Bytes which the mock device has buffered, for the padding test
+static std::atomic<uint64_t> mock_fc_bytes_outstanding{0};
+
 /*!
  * Mock tx data xport which doesn't use I/O service, and just interacts with
  * the link directly. Transport copies packet info directly into the frame
@@ -48,11 +56,30 @@ public:
         return std::make_pair(data + sizeof(info), sizeof(info) + info.payload_bytes);
     }
 
+    void* get_payload_ptr(buff_t::uptr& buff, const bool /*has_tsf*/) const
+    {
+        return static_cast<uint8_t*>(buff->data()) + sizeof(packet_info_t);
+    }
+
     void release_send_buff(buff_t::uptr buff)
     {
+        mock_fc_bytes_outstanding += buff->packet_size();
         _send_link->release_send_buff(std::move(buff));
     }
 
+    struct fc_counts_t
+    {
+        uint64_t bytes   = 0;
+        uint32_t packets = 0;
+    };
+
+    fc_counts_t get_fc_outstanding() const
+    {
+        fc_counts_t counts;
+        counts.bytes = mock_fc_bytes_outstanding;
+        return counts;
+    }
+
     size_t get_mtu() const
     {
         return _send_link->get_send_frame_size();
@@ -98,6 +125,16 @@ public:
         tx_streamer_impl::set_scale_factor(chan, scale_factor);
     }
 
+    void start_padding(padding_handler_t handler)
+    {
+        tx_streamer_impl::start_padding(std::move(handler));
+    }
+
+    void stop_padding()
+    {
+        tx_streamer_impl::stop_padding();
+    }
+
     bool recv_async_msg(
         uhd::async_metadata_t& /*async_metadata*/, double /*timeout = 0.1*/) override
     {
@@ -133,9 +170,12 @@ static std::vector<mock_send_link::sptr> make_links(const size_t num)
 }
 
 static std::shared_ptr<mock_tx_streamer> make_tx_streamer(
-    std::vector<mock_send_link::sptr> send_links, const std::string& format)
+    std::vector<mock_send_link::sptr> send_links,
+    const std::string& format,
+    const uhd::device_addr_t& args = uhd::device_addr_t())
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args = args;
     auto streamer = std::make_shared<mock_tx_streamer>(send_links.size(), stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
@@ -566,6 +606,41 @@ BOOST_AUTO_TEST_CASE(test_send_one_channel_multi_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_multi_packet_fractional_ticks)
+{
+    auto send_links = make_links(1);
+    auto streamer   = make_tx_streamer(send_links, "fc32");
+    // Not an integer number of ticks per sample
+    const double samp_rate = TICK_RATE / 3.5;
+    streamer->set_samp_rate(samp_rate);
+
+    uhd::tx_metadata_t metadata;
+    metadata.has_time_spec = true;
+    metadata.time_spec     = uhd::time_spec_t(1.25);
+    metadata.end_of_burst  = true;
+
+    const size_t spp       = streamer->get_max_num_samps();
+    const size_t num_samps = spp * 3 + 1;
+    std::vector<std::complex<float>> buff(num_samps);
+    BOOST_CHECK_EQUAL(streamer->send(&buff.front(), num_samps, metadata, 1.0), num_samps);
+
+    size_t samps_checked = 0;
+    while (samps_checked < num_samps) {
+        mock_tx_data_xport::packet_info_t info;
+        std::complex<uint16_t>* data;
+        size_t packet_samps;
+        boost::shared_array<uint8_t> frame_buff;
+        std::tie(info, data, packet_samps, frame_buff) = pop_send_packet(send_links[0]);
+
+        const uhd::time_spec_t time =
+            metadata.time_spec + uhd::time_spec_t::from_ticks(samps_checked, samp_rate);
+        BOOST_CHECK(info.has_tsf);
+        BOOST_CHECK_EQUAL(info.tsf, time.to_ticks(TICK_RATE));
+        samps_checked += packet_samps;
+    }
+    BOOST_CHECK_EQUAL(samps_checked, num_samps);
+}
+
 BOOST_AUTO_TEST_CASE(test_send_two_channel_one_packet)
 {
     const size_t NUM_PKTS_TO_TEST = 30;
@@ -628,6 +703,51 @@ BOOST_AUTO_TEST_CASE(test_send_two_channel_one_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_multi_channel_convert_threads)
+{
+    const size_t NUM_PKTS_TO_TEST = 30;
+    const size_t num_chans        = 4;
+    const std::string format("sc16");
+
+    auto send_links = make_links(num_chans);
+    auto streamer   = make_tx_streamer(
+        send_links, format, uhd::device_addr_t("convert_threads=3"));
+
+    uhd::tx_metadata_t metadata;
+
+    // Use different data for each channel to catch mixed up channels
+    std::vector<std::vector<std::complex<uint16_t>>> buff(num_chans);
+    std::vector<void*> buffs;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        for (size_t i = 0; i < 20; i++) {
+            buff[ch].push_back(std::complex<uint16_t>(ch * 100 + i, i));
+        }
+        buffs.push_back(buff[ch].data());
+    }
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        const size_t num_samps = 10 + i % 10;
+        metadata.end_of_burst  = (i == NUM_PKTS_TO_TEST - 1);
+        const size_t num_sent  = streamer->send(buffs, num_samps, metadata, 1.0);
+        BOOST_CHECK_EQUAL(num_sent, num_samps);
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            mock_tx_data_xport::packet_info_t info;
+            std::complex<uint16_t>* data;
+            size_t packet_samps;
+            boost::shared_array<uint8_t> frame_buff;
+
+            std::tie(info, data, packet_samps, frame_buff) =
+                pop_send_packet(send_links[ch]);
+            BOOST_CHECK_EQUAL(num_samps, packet_samps);
+            for (size_t j = 0; j < num_samps; j++) {
+                BOOST_CHECK_EQUAL(buff[ch][j], data[j]);
+            }
+            BOOST_CHECK_EQUAL(info.eob, i == NUM_PKTS_TO_TEST - 1);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_meta_data_cache)
 {
     auto send_links = make_links(1);
@@ -660,6 +780,375 @@ BOOST_AUTO_TEST_CASE(test_meta_data_cache)
     BOOST_CHECK(info.eob);
 }
 
+BOOST_AUTO_TEST_CASE(test_send_many)
+{
+    const size_t NUM_BURSTS = 5;
+    auto send_links         = make_links(1);
+    auto streamer           = make_tx_streamer(send_links, "fc32");
+
+    std::vector<std::complex<float>> buff(20);
+    for (size_t i = 0; i < buff.size(); i++) {
+        buff[i] = std::complex<float>(i * 2, i * 2 + 1);
+    }
+
+    // Timed bursts of varying lengths, 1 ms apart
+    std::vector<uhd::tx_streamer::send_burst_t> bursts(NUM_BURSTS);
+    for (size_t i = 0; i < NUM_BURSTS; i++) {
+        bursts[i].buffs                   = {buff.data()};
+        bursts[i].nsamps_per_buff         = 10 + i;
+        bursts[i].metadata.start_of_burst = true;
+        bursts[i].metadata.end_of_burst   = true;
+        bursts[i].metadata.has_time_spec  = true;
+        bursts[i].metadata.time_spec      = uhd::time_spec_t(i * 1e-3);
+    }
+    BOOST_CHECK_EQUAL(streamer->send_many(bursts, 1.0), NUM_BURSTS);
+
+    for (size_t i = 0; i < NUM_BURSTS; i++) {
+        mock_tx_data_xport::packet_info_t info;
+        std::complex<uint16_t>* data;
+        size_t packet_samps;
+        boost::shared_array<uint8_t> frame_buff;
+
+        std::tie(info, data, packet_samps, frame_buff) = pop_send_packet(send_links[0]);
+        BOOST_CHECK_EQUAL(packet_samps, 10 + i);
+        BOOST_CHECK(info.has_tsf);
+        BOOST_CHECK_EQUAL(info.tsf, i * 1e-3 * TICK_RATE);
+        BOOST_CHECK(info.eob);
+        BOOST_CHECK_EQUAL(data[1],
+            std::complex<uint16_t>(2 * SCALE_FACTOR, 3 * SCALE_FACTOR));
+    }
+    BOOST_CHECK_EQUAL(send_links[0]->get_num_packets(), 0);
+
+    // Every burst needs one buffer per channel
+    bursts[0].buffs.clear();
+    BOOST_CHECK_THROW(streamer->send_many(bursts, 1.0), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_waveform)
+{
+    auto send_links = make_links(2);
+    auto streamer   = make_tx_streamer(send_links, "fc32");
+
+    // A waveform which takes three packets, the last one shorter
+    const size_t spp       = streamer->get_max_num_samps();
+    const size_t num_samps = 3 * spp - 10;
+    std::vector<std::complex<float>> buff0(num_samps), buff1(num_samps);
+    for (size_t i = 0; i < num_samps; i++) {
+        buff0[i] = std::complex<float>(i % 100, 1);
+        buff1[i] = std::complex<float>(2, i % 100);
+    }
+    const std::vector<const void*> buffs = {buff0.data(), buff1.data()};
+    const size_t waveform_id = streamer->register_waveform(buffs, num_samps);
+
+    uhd::tx_metadata_t metadata;
+    metadata.start_of_burst = true;
+    metadata.end_of_burst   = true;
+    metadata.has_time_spec  = true;
+    metadata.time_spec      = uhd::time_spec_t(0.0);
+    for (size_t repetition = 0; repetition < 2; repetition++) {
+        BOOST_CHECK_EQUAL(streamer->send_waveform(waveform_id, metadata, 1.0), num_samps);
+        size_t num_samps_recvd = 0;
+        for (size_t packet = 0; packet < 3; packet++) {
+            for (size_t chan = 0; chan < 2; chan++) {
+                mock_tx_data_xport::packet_info_t info;
+                std::complex<uint16_t>* data;
+                size_t packet_samps;
+                boost::shared_array<uint8_t> frame_buff;
+
+                std::tie(info, data, packet_samps, frame_buff) =
+                    pop_send_packet(send_links[chan]);
+                BOOST_CHECK_EQUAL(packet_samps, packet < 2 ? spp : spp - 10);
+                BOOST_CHECK(info.has_tsf);
+                BOOST_CHECK_EQUAL(info.tsf, num_samps_recvd * TICK_RATE / SAMP_RATE);
+                BOOST_CHECK_EQUAL(info.eob, packet == 2);
+                const auto& buff = chan == 0 ? buff0 : buff1;
+                for (size_t j = 0; j < packet_samps; j++) {
+                    const std::complex<float> samp = buff[num_samps_recvd + j];
+                    const std::complex<uint16_t> value(
+                        samp.real() * SCALE_FACTOR, samp.imag() * SCALE_FACTOR);
+                    BOOST_CHECK_EQUAL(value, data[j]);
+                }
+            }
+            num_samps_recvd += packet < 2 ? spp : spp - 10;
+        }
+    }
+
+    streamer->unregister_waveform(waveform_id);
+    BOOST_CHECK_THROW(
+        streamer->send_waveform(waveform_id, metadata, 1.0), uhd::value_error);
+    BOOST_CHECK_THROW(streamer->unregister_waveform(waveform_id), uhd::value_error);
+    // One buffer per channel is required
+    BOOST_CHECK_THROW(
+        streamer->register_waveform(buff0.data(), num_samps), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_host_resampler)
+{
+    // Resampling by 3 / 2 gives the same samples as the host_resampler class,
+    // with the times of the device rate
+    auto send_links = make_links(2);
+    auto streamer   = make_tx_streamer(send_links,
+        "fc32",
+        uhd::device_addr_t("host_resample_interp=3,host_resample_decim=2,"
+                           "convert_threads=1"));
+
+    const size_t num_samps = 3000;
+    std::vector<std::complex<float>> buff0(num_samps), buff1(num_samps);
+    for (size_t i = 0; i < num_samps; i++) {
+        buff0[i] = std::complex<float>(std::polar(1000.0, 0.01 * i));
+        buff1[i] = std::complex<float>(std::polar(500.0, -0.02 * i));
+    }
+    std::vector<std::vector<std::complex<float>>> expected;
+    for (const auto* buff : {&buff0, &buff1}) {
+        auto resampler = uhd::rfnoc::host_resampler::make(3, 2);
+        std::vector<std::complex<float>> output(
+            resampler->get_max_num_outputs(num_samps));
+        size_t num_out = resampler->process(buff->data(), num_samps, output.data());
+        num_out += resampler->flush(output.data() + num_out);
+        output.resize(num_out);
+        expected.push_back(output);
+    }
+    BOOST_REQUIRE_EQUAL(expected[0].size(), 4500);
+
+    // Two sends, of which only the first one has a time
+    uhd::tx_metadata_t metadata;
+    metadata.start_of_burst = true;
+    metadata.has_time_spec  = true;
+    metadata.time_spec      = uhd::time_spec_t(0.5);
+    const size_t num_first  = 2500;
+    BOOST_CHECK_EQUAL(streamer->send(std::vector<const void*>{buff0.data(), buff1.data()},
+                          num_first,
+                          metadata,
+                          1.0),
+        num_first);
+    metadata.start_of_burst = false;
+    metadata.has_time_spec  = false;
+    metadata.end_of_burst   = true;
+    BOOST_CHECK_EQUAL(
+        streamer->send(std::vector<const void*>{
+                           buff0.data() + num_first, buff1.data() + num_first},
+            num_samps - num_first,
+            metadata,
+            1.0),
+        num_samps - num_first);
+
+    for (size_t chan = 0; chan < 2; chan++) {
+        size_t num_samps_recvd = 0;
+        bool eob               = false;
+        while (!eob) {
+            mock_tx_data_xport::packet_info_t info;
+            std::complex<uint16_t>* data;
+            size_t packet_samps;
+            boost::shared_array<uint8_t> frame_buff;
+            std::tie(info, data, packet_samps, frame_buff) =
+                pop_send_packet(send_links[chan]);
+            BOOST_CHECK(info.has_tsf);
+            BOOST_CHECK_EQUAL(info.tsf,
+                (uhd::time_spec_t(0.5)
+                    + uhd::time_spec_t::from_ticks(num_samps_recvd, SAMP_RATE))
+                    .to_ticks(TICK_RATE));
+            BOOST_REQUIRE_LE(num_samps_recvd + packet_samps, expected[chan].size());
+            for (size_t j = 0; j < packet_samps; j++) {
+                const auto samp =
+                    expected[chan][num_samps_recvd + j] * float(SCALE_FACTOR);
+                BOOST_CHECK_SMALL(int16_t(data[j].real()) - samp.real(), 1.0f);
+                BOOST_CHECK_SMALL(int16_t(data[j].imag()) - samp.imag(), 1.0f);
+            }
+            num_samps_recvd += packet_samps;
+            eob = info.eob;
+        }
+        BOOST_CHECK_EQUAL(num_samps_recvd, expected[chan].size());
+        BOOST_CHECK_EQUAL(send_links[chan]->get_num_packets(), 0);
+    }
+
+    // Waveforms and other CPU formats are not supported
+    BOOST_CHECK_THROW(
+        streamer->register_waveform(
+            std::vector<const void*>{buff0.data(), buff1.data()}, num_samps),
+        uhd::runtime_error);
+    BOOST_CHECK_THROW(make_tx_streamer(send_links,
+                          "sc16",
+                          uhd::device_addr_t("host_resample_decim=2")),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_auto_padding)
+{
+    const double padding_time = 0.001;
+    auto send_links           = make_links(1);
+    auto streamer             = make_tx_streamer(send_links,
+        "fc32",
+        uhd::device_addr_t("auto_padding=" + std::to_string(padding_time)));
+    // The padding task calls this on a thread of its own
+    std::atomic<size_t> num_padded{0};
+    streamer->start_padding([&num_padded](const size_t n) { num_padded += n; });
+
+    // Nothing is padded outside of bursts
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    BOOST_CHECK_EQUAL(num_padded.load(), 0);
+
+    // The device has less than the padding time buffered after this
+    mock_fc_bytes_outstanding = 0;
+    std::vector<std::complex<float>> buff(100, std::complex<float>(1, 1));
+    uhd::tx_metadata_t metadata;
+    metadata.start_of_burst = true;
+    BOOST_CHECK_EQUAL(streamer->send(buff.data(), buff.size(), metadata, 1.0), 100);
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (num_padded == 0 && std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    streamer->stop_padding();
+    const size_t min_bytes = padding_time * SAMP_RATE * sizeof(std::complex<uint16_t>);
+    BOOST_CHECK_GE(mock_fc_bytes_outstanding.load(), min_bytes);
+
+    mock_tx_data_xport::packet_info_t info;
+    std::complex<uint16_t>* data;
+    size_t packet_samps;
+    boost::shared_array<uint8_t> frame_buff;
+    std::tie(info, data, packet_samps, frame_buff) = pop_send_packet(send_links[0]);
+    BOOST_CHECK_EQUAL(packet_samps, 100);
+
+    // Zeros, continuing the burst
+    size_t num_zeros = 0;
+    while (send_links[0]->get_num_packets() != 0) {
+        std::tie(info, data, packet_samps, frame_buff) = pop_send_packet(send_links[0]);
+        BOOST_CHECK(!info.has_tsf);
+        BOOST_CHECK(!info.eob);
+        for (size_t i = 0; i < packet_samps; i++) {
+            BOOST_CHECK_EQUAL(data[i], std::complex<uint16_t>(0, 0));
+        }
+        num_zeros += packet_samps;
+    }
+    BOOST_CHECK_GT(num_zeros, 0);
+    BOOST_CHECK_EQUAL(num_zeros, num_padded.load());
+
+    BOOST_CHECK_THROW(
+        make_tx_streamer(send_links, "fc32", uhd::device_addr_t("auto_padding=-1")),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_zero_copy)
+{
+    auto send_links = make_links(2);
+    auto streamer   = make_tx_streamer(send_links, "sc16");
+
+    uhd::tx_metadata_t metadata;
+    metadata.has_time_spec = true;
+    metadata.time_spec     = uhd::time_spec_t(0.0);
+    metadata.end_of_burst  = true;
+
+    const size_t num_samps = 20;
+    uhd::tx_streamer::send_buffs_type buffs;
+    BOOST_CHECK_EQUAL(streamer->get_send_buffs(buffs, true, 1.0),
+        streamer->get_max_num_samps());
+    BOOST_REQUIRE_EQUAL(buffs.size(), 2);
+    for (size_t chan = 0; chan < buffs.size(); chan++) {
+        auto samps = static_cast<std::complex<uint16_t>*>(buffs[chan]);
+        for (size_t i = 0; i < num_samps; i++) {
+            samps[i] = std::complex<uint16_t>(chan, i);
+        }
+    }
+
+    // The packets must be committed before sending again
+    BOOST_CHECK_THROW(streamer->get_send_buffs(buffs, true, 1.0), uhd::runtime_error);
+    std::vector<std::complex<float>> buff(num_samps);
+    BOOST_CHECK_THROW(
+        streamer->send(buff.data(), num_samps, metadata, 1.0), uhd::runtime_error);
+
+    uhd::tx_metadata_t no_time_spec;
+    BOOST_CHECK_THROW(
+        streamer->commit_send_buffs(num_samps, no_time_spec), uhd::value_error);
+    BOOST_CHECK_EQUAL(streamer->commit_send_buffs(num_samps, metadata), num_samps);
+    BOOST_CHECK_THROW(
+        streamer->commit_send_buffs(num_samps, metadata), uhd::runtime_error);
+
+    for (size_t chan = 0; chan < send_links.size(); chan++) {
+        mock_tx_data_xport::packet_info_t info;
+        std::complex<uint16_t>* data;
+        size_t packet_samps;
+        boost::shared_array<uint8_t> frame_buff;
+
+        std::tie(info, data, packet_samps, frame_buff) =
+            pop_send_packet(send_links[chan]);
+        BOOST_CHECK_EQUAL(packet_samps, num_samps);
+        BOOST_CHECK(info.has_tsf);
+        BOOST_CHECK(info.eob);
+        for (size_t i = 0; i < num_samps; i++) {
+            BOOST_CHECK_EQUAL(data[i], std::complex<uint16_t>(chan, i));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_send_zero_copy_needs_matching_format)
+{
+    auto send_links = make_links(1);
+    auto streamer   = make_tx_streamer(send_links, "fc32");
+
+    uhd::tx_streamer::send_buffs_type buffs;
+    BOOST_CHECK_THROW(streamer->get_send_buffs(buffs, false, 1.0), uhd::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_telemetry)
+{
+    const std::string format("fc32");
+
+    auto send_links = make_links(1);
+    auto streamer   = make_tx_streamer(send_links, format);
+
+    uhd::tx_metadata_t metadata;
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+
+    // Send two packets, then a buffer which does not fit into one packet
+    for (size_t i = 0; i < 2; i++) {
+        BOOST_CHECK_EQUAL(
+            streamer->send(buff.data(), num_samps, metadata, 1.0), num_samps);
+        pop_send_packet(send_links[0]);
+    }
+    std::vector<std::complex<float>> big_buff(streamer->get_max_num_samps() + 1);
+    BOOST_CHECK_EQUAL(streamer->send(big_buff.data(), big_buff.size(), metadata, 1.0),
+        big_buff.size());
+
+    const auto telemetry = streamer->get_telemetry();
+    BOOST_CHECK_EQUAL(telemetry.packets, 4);
+    BOOST_CHECK_EQUAL(telemetry.samples, 2 * num_samps + big_buff.size());
+    BOOST_CHECK_EQUAL(telemetry.underflows, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_cycle_accounting)
+{
+    const std::string format("fc32");
+    const size_t num_sends = 5;
+
+    auto send_links = make_links(1);
+    auto streamer   = make_tx_streamer(send_links, format);
+
+    uhd::tx_metadata_t metadata;
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+
+    for (size_t i = 0; i < num_sends; i++) {
+        BOOST_CHECK_EQUAL(
+            streamer->send(buff.data(), num_samps, metadata, 1.0), num_samps);
+        pop_send_packet(send_links[0]);
+    }
+
+    const auto telemetry = streamer->get_telemetry();
+#ifdef UHD_ENABLE_CYCLE_ACCOUNTING
+    BOOST_CHECK_EQUAL(telemetry.num_calls, num_sends);
+    BOOST_CHECK_GT(telemetry.cycles_convert, 0);
+    BOOST_CHECK_GT(telemetry.cycles_metadata, 0);
+    BOOST_CHECK_EQUAL(telemetry.cycles_total,
+        telemetry.cycles_buff_wait + telemetry.cycles_header
+            + telemetry.cycles_flow_ctrl + telemetry.cycles_convert
+            + telemetry.cycles_metadata + telemetry.cycles_send
+            + telemetry.cycles_other);
+#else
+    BOOST_CHECK_EQUAL(telemetry.num_calls, 0);
+    BOOST_CHECK_EQUAL(telemetry.cycles_total, 0);
+#endif
+}
+
 BOOST_AUTO_TEST_CASE(test_spp)
 {
     // Test the spp calculation when it is limited by the stream args
@@ -690,3 +1179,49 @@ BOOST_AUTO_TEST_CASE(test_spp)
             streamer->get_max_num_samps(), max_pyld / sizeof(std::complex<uint16_t>));
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_send_no_allocations)
+{
+    const size_t num_chans = 2;
+    const std::string format("fc32");
+
+    for (const std::string args : {"", "convert_threads=1"}) {
+        // Links which write every packet into the same memory, so that they
+        // don't allocate anything themselves
+        const mock_send_link::link_params params = {FRAME_SIZE, 1};
+        std::vector<mock_send_link::sptr> send_links;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            send_links.push_back(std::make_shared<mock_send_link>(params, true));
+        }
+        auto streamer = make_tx_streamer(send_links, format, uhd::device_addr_t(args));
+
+        // Send two and a half packets at a time, with an EOV in between
+        const size_t spp       = streamer->get_max_num_samps();
+        const size_t num_samps = spp * 5 / 2;
+        std::vector<std::vector<std::complex<float>>> buffer(num_chans);
+        std::vector<const void*> buffers;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            buffer[ch].resize(num_samps);
+            buffers.push_back(buffer[ch].data());
+        }
+        std::vector<size_t> eov_positions = {spp / 2, spp * 2};
+        uhd::tx_metadata_t metadata;
+        metadata.has_time_spec      = true;
+        metadata.eov_positions      = eov_positions.data();
+        metadata.eov_positions_size = eov_positions.size();
+
+        // Let the streamer allocate whatever it allocates lazily
+        BOOST_CHECK_EQUAL(streamer->send(buffers, num_samps, metadata, 1.0), num_samps);
+
+        uhd::test::alloc_counter counter;
+        size_t total_samps = 0;
+        for (size_t i = 0; i < 100; i++) {
+            metadata.time_spec += uhd::time_spec_t(0, num_samps, SAMP_RATE);
+            total_samps += streamer->send(buffers, num_samps, metadata, 1.0);
+        }
+        const size_t num_allocs = counter.get();
+
+        BOOST_CHECK_EQUAL(total_samps, 100 * num_samps);
+        BOOST_CHECK_EQUAL(num_allocs, 0);
+    }
+}
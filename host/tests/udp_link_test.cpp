@@ -0,0 +1,171 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <boost/asio.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace uhd::transport;
+namespace asio = boost::asio;
+
+namespace {
+
+constexpr size_t FRAME_SIZE = 1000;
+
+//! Local UDP socket which takes the place of the device
+struct loopback_peer
+{
+    loopback_peer()
+        : sock(io_service, asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 0))
+    {
+    }
+
+    std::string port() const
+    {
+        return std::to_string(sock.local_endpoint().port());
+    }
+
+    //! Send \p num_pkts packets of increasing size and contents to \p link
+    void send_to(udp_boost_asio_link::sptr link, const size_t num_pkts)
+    {
+        const asio::ip::udp::endpoint link_ep(
+            asio::ip::address_v4::loopback(), link->get_local_port());
+        for (size_t i = 0; i < num_pkts; i++) {
+            std::vector<uint8_t> pkt(i + 1, uint8_t(i));
+            sock.send_to(asio::buffer(pkt), link_ep);
+        }
+    }
+
+    asio::io_service io_service;
+    asio::ip::udp::socket sock;
+};
+
+udp_boost_asio_link::sptr make_link(loopback_peer& peer,
+    const size_t num_recv_frames,
+    const size_t recv_batch_size,
+    const bool use_io_uring = false)
+{
+    link_params_t params;
+    params.num_recv_frames = num_recv_frames;
+    params.num_send_frames = 1;
+    params.recv_frame_size = FRAME_SIZE;
+    params.send_frame_size = FRAME_SIZE;
+    params.recv_buff_size  = 1000000;
+    params.send_buff_size  = 1000000;
+    params.recv_batch_size = recv_batch_size;
+    params.use_io_uring    = use_io_uring;
+    size_t recv_socket_buff_size, send_socket_buff_size;
+    return udp_boost_asio_link::make(
+        "127.0.0.1", peer.port(), params, recv_socket_buff_size, send_socket_buff_size);
+}
+
+void check_packet(const frame_buff::uptr& buff, const size_t i)
+{
+    BOOST_REQUIRE(buff);
+    BOOST_CHECK_EQUAL(buff->packet_size(), i + 1);
+    const uint8_t* data = static_cast<const uint8_t*>(buff->data());
+    for (size_t j = 0; j < buff->packet_size(); j++) {
+        BOOST_CHECK_EQUAL(data[j], uint8_t(i));
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_recv_unbatched_and_batched)
+{
+    for (const size_t batch_size : {1, 4, 16}) {
+        loopback_peer peer;
+        auto link = make_link(peer, 8, batch_size);
+
+        // Nothing was sent, so this must time out
+        BOOST_CHECK(!link->get_recv_buff(1));
+
+        // Send more packets than there are frames and batch slots, and release
+        // them in order
+        const size_t num_pkts = 50;
+        peer.send_to(link, num_pkts);
+        for (size_t i = 0; i < num_pkts; i++) {
+            auto buff = link->get_recv_buff(100);
+            check_packet(buff, i);
+            link->release_recv_buff(std::move(buff));
+        }
+        BOOST_CHECK(!link->get_recv_buff(1));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_batched_hold_buffs)
+{
+    // Frames handed out from the same batch must not overwrite each other,
+    // even if they are held by the caller while the next batch arrives
+    const size_t num_frames = 6;
+    loopback_peer peer;
+    auto link = make_link(peer, num_frames, 4);
+
+    peer.send_to(link, 3 * num_frames);
+    size_t pkt_idx = 0;
+    for (size_t round = 0; round < 3; round++) {
+        std::vector<frame_buff::uptr> buffs;
+        for (size_t i = 0; i < num_frames; i++) {
+            buffs.push_back(link->get_recv_buff(100));
+        }
+        // Release out of order to shuffle frame memory around
+        for (size_t i = 0; i < num_frames; i++) {
+            check_packet(buffs[i], pkt_idx + i);
+        }
+        link->release_recv_buff(std::move(buffs[3]));
+        link->release_recv_buff(std::move(buffs[0]));
+        link->release_recv_buff(std::move(buffs[5]));
+        link->release_recv_buff(std::move(buffs[1]));
+        link->release_recv_buff(std::move(buffs[4]));
+        link->release_recv_buff(std::move(buffs[2]));
+        pkt_idx += num_frames;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_io_uring)
+{
+    // If io_uring is not available, the link falls back to recv(), and this
+    // test still has to pass
+    loopback_peer peer;
+    auto link = make_link(peer, 8, 1, true);
+    BOOST_CHECK(!link->get_recv_buff(1));
+
+    // Send more packets than the io_uring has frames, so the kernel runs out
+    // of them and the receive request needs to be re-armed. Hold on to some
+    // frames to shuffle frame memory between the link and the io_uring.
+    const size_t num_pkts = 200;
+    peer.send_to(link, num_pkts);
+    std::vector<frame_buff::uptr> held_buffs;
+    for (size_t i = 0; i < num_pkts; i++) {
+        auto buff = link->get_recv_buff(100);
+        check_packet(buff, i);
+        held_buffs.push_back(std::move(buff));
+        if (held_buffs.size() == 5) {
+            for (auto& held_buff : held_buffs) {
+                link->release_recv_buff(std::move(held_buff));
+            }
+            held_buffs.clear();
+        }
+    }
+    for (auto& held_buff : held_buffs) {
+        link->release_recv_buff(std::move(held_buff));
+    }
+    BOOST_CHECK(!link->get_recv_buff(1));
+
+    // Packets arriving while we wait must wake us up
+    std::thread sender([&peer, link]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        peer.send_to(link, 1);
+    });
+    auto buff = link->get_recv_buff(1000);
+    sender.join();
+    check_packet(buff, 0);
+    link->release_recv_buff(std::move(buff));
+}
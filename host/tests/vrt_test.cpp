@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/transport/vrt_if_packet.hpp>
 #include <uhd/utils/byteswap.hpp>
 #include <boost/format.hpp>
@@ -177,3 +178,52 @@ BOOST_AUTO_TEST_CASE(test_with_chdr)
     if_packet_info.num_payload_words32 = 24;
     pack_and_unpack(if_packet_info);
 }
+
+BOOST_AUTO_TEST_CASE(test_unpack_chdr)
+{
+    for (const bool has_tsf : {false, true}) {
+        vrt::if_packet_info_t if_packet_info_in;
+        if_packet_info_in.link_type           = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+        if_packet_info_in.packet_count        = 0x123;
+        if_packet_info_in.eob                 = has_tsf;
+        if_packet_info_in.has_sid             = true;
+        if_packet_info_in.sid                 = 0xdeadbeef;
+        if_packet_info_in.has_tsf             = has_tsf;
+        if_packet_info_in.tsf                 = 0x0123456789abcdefull;
+        if_packet_info_in.num_payload_words32 = 10;
+        if_packet_info_in.num_payload_bytes   = 37;
+        uint32_t packet_buff[64];
+        vrt::if_hdr_pack_le(packet_buff, if_packet_info_in);
+
+        // the dedicated CHDR unpacker must match the generic one
+        vrt::if_packet_info_t if_packet_info_out, if_packet_info_chdr;
+        if_packet_info_out.link_type           = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+        if_packet_info_out.num_packet_words32  = if_packet_info_in.num_packet_words32;
+        if_packet_info_chdr.num_packet_words32 = if_packet_info_in.num_packet_words32;
+        vrt::if_hdr_unpack_le(packet_buff, if_packet_info_out);
+        vrt::if_hdr_unpack_chdr_le(packet_buff, if_packet_info_chdr);
+
+        for (const auto& info : {if_packet_info_out, if_packet_info_chdr}) {
+            BOOST_CHECK(info.link_type == vrt::if_packet_info_t::LINK_TYPE_CHDR);
+            BOOST_CHECK(info.packet_type == vrt::if_packet_info_t::PACKET_TYPE_DATA);
+            BOOST_CHECK_EQUAL(info.packet_count, if_packet_info_in.packet_count);
+            BOOST_CHECK_EQUAL(info.eob, if_packet_info_in.eob);
+            BOOST_CHECK(info.has_sid);
+            BOOST_CHECK_EQUAL(info.sid, if_packet_info_in.sid);
+            BOOST_CHECK_EQUAL(info.has_tsf, has_tsf);
+            if (has_tsf) {
+                BOOST_CHECK_EQUAL(info.tsf, if_packet_info_in.tsf);
+            }
+            BOOST_CHECK(not info.has_tlr);
+            BOOST_CHECK_EQUAL(
+                info.num_header_words32, if_packet_info_in.num_header_words32);
+            BOOST_CHECK_EQUAL(info.num_payload_words32, 10);
+            BOOST_CHECK_EQUAL(info.num_payload_bytes, 37);
+        }
+
+        // a truncated packet must be rejected
+        if_packet_info_chdr.num_packet_words32 = if_packet_info_in.num_packet_words32 - 1;
+        BOOST_CHECK_THROW(vrt::if_hdr_unpack_chdr_le(packet_buff, if_packet_info_chdr),
+            uhd::value_error);
+    }
+}
@@ -153,3 +153,39 @@ BOOST_FIXTURE_TEST_CASE(zbx_set_from_table_test, zbx_cpld_fixture)
     cpld.set_tx_gain_switches(chan, idx, 23);
     BOOST_REQUIRE_EQUAL(tx_table_select, 23);
 }
+
+BOOST_FIXTURE_TEST_CASE(zbx_write_dsa_table_test, zbx_cpld_fixture)
+{
+    const zbx_cpld_ctrl::tx_dsa_type tx_steps{0x1B, 0x0C, 1};
+    const zbx_cpld_ctrl::rx_dsa_type rx_steps{0x1, 0x2, 0x3, 0x4};
+    const uint32_t tx_reg_value = zbx_cpld_ctrl::get_tx_dsa_reg_value(tx_steps);
+    const uint32_t rx_reg_value = zbx_cpld_ctrl::get_rx_dsa_reg_value(rx_steps);
+    BOOST_CHECK_EQUAL(tx_reg_value, 0x0C1B);
+    BOOST_CHECK_EQUAL(rx_reg_value, 0x4321);
+
+    // The tables of the channels are written separately
+    constexpr uint32_t tx0_table_addr = 0x5000;
+    constexpr uint32_t tx1_table_addr = 0x5400;
+    constexpr uint32_t rx0_table_addr = 0x5800;
+    constexpr uint32_t rx1_table_addr = 0x5C00;
+    mock_reg_iface.memory[tx0_table_addr] = 0xDEAD;
+    mock_reg_iface.memory[rx1_table_addr] = 0xDEAD;
+    const std::vector<uint32_t> tx_table{tx_reg_value, 0x0102, 0x1F1F};
+    cpld.write_tx_dsa_table(1, tx_table);
+    for (size_t i = 0; i < tx_table.size(); i++) {
+        BOOST_CHECK_EQUAL(mock_reg_iface.memory.at(tx1_table_addr + 4 * i), tx_table[i]);
+    }
+    BOOST_CHECK_EQUAL(mock_reg_iface.memory.at(tx0_table_addr), 0xDEAD);
+
+    const std::vector<uint32_t> rx_table(61, rx_reg_value);
+    cpld.write_rx_dsa_table(0, rx_table);
+    BOOST_CHECK_EQUAL(mock_reg_iface.memory.at(rx0_table_addr + 4 * 60), rx_reg_value);
+    BOOST_CHECK_EQUAL(mock_reg_iface.memory.at(rx1_table_addr), 0xDEAD);
+    // Unchanged values are not written again
+    mock_reg_iface.memory.clear();
+    cpld.write_rx_dsa_table(0, rx_table);
+    BOOST_CHECK(mock_reg_iface.memory.empty());
+
+    BOOST_CHECK_THROW(
+        cpld.write_rx_dsa_table(0, std::vector<uint32_t>(65)), uhd::assertion_error);
+}
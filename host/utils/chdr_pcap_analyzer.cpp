@@ -0,0 +1,736 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Offline analyzer for CHDR traffic captured with tcpdump, Wireshark, or
+// similar tools. It reads pcap and pcapng files, decodes the CHDR packets in
+// the UDP payloads and reports, per stream:
+// - Data throughput and sequence number gaps
+// - Stream status (flow control) packet timing and errors
+// - Control transaction latencies, from request to response
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhd/utils/chdr/chdr_packet.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd::rfnoc::chdr;
+
+namespace {
+
+constexpr uint32_t PCAP_MAGIC_US      = 0xa1b2c3d4;
+constexpr uint32_t PCAP_MAGIC_NS      = 0xa1b23c4d;
+constexpr uint32_t PCAPNG_SHB_TYPE    = 0x0a0d0d0a;
+constexpr uint32_t PCAPNG_BOM         = 0x1a2b3c4d;
+constexpr uint32_t PCAPNG_IDB_TYPE    = 0x00000001;
+constexpr uint32_t PCAPNG_SPB_TYPE    = 0x00000003;
+constexpr uint32_t PCAPNG_EPB_TYPE    = 0x00000006;
+constexpr uint16_t PCAPNG_TSRESOL_OPT = 9;
+
+constexpr uint32_t LINKTYPE_NULL      = 0;
+constexpr uint32_t LINKTYPE_ETHERNET  = 1;
+constexpr uint32_t LINKTYPE_RAW       = 101;
+constexpr uint32_t LINKTYPE_LINUX_SLL = 113;
+constexpr uint32_t LINKTYPE_IPV4      = 228;
+
+constexpr uint16_t ETHERTYPE_IPV4 = 0x0800;
+constexpr uint16_t ETHERTYPE_VLAN = 0x8100;
+constexpr uint16_t ETHERTYPE_QINQ = 0x88a8;
+constexpr uint8_t IPPROTO_UDP_NUM = 17;
+
+//! Size of the stdio buffer. Large reads keep up with the disk.
+constexpr size_t FILE_BUFFER_SIZE = 16 * 1024 * 1024;
+
+//! One captured frame. The data is valid until the next frame is read.
+struct frame_t
+{
+    uint64_t time_ns;
+    uint32_t linktype;
+    const uint8_t* data;
+    size_t len;
+};
+
+/*! Reads frames from a pcap or pcapng file
+ *
+ * Only the blocks needed for the frames are interpreted, others are skipped.
+ */
+class capture_reader
+{
+public:
+    capture_reader(const std::string& path) : _file(std::fopen(path.c_str(), "rb"))
+    {
+        if (!_file) {
+            throw uhd::io_error("Could not open capture file " + path);
+        }
+        _file_buffer.resize(FILE_BUFFER_SIZE);
+        std::setvbuf(_file, _file_buffer.data(), _IOFBF, _file_buffer.size());
+
+        uint32_t magic;
+        _read(&magic, sizeof(magic));
+        if (magic == PCAPNG_SHB_TYPE) {
+            _pcapng = true;
+            _read_shb();
+            return;
+        }
+        if (magic == PCAP_MAGIC_US || magic == PCAP_MAGIC_NS) {
+            _swap = false;
+        } else if (uhd::byteswap(magic) == PCAP_MAGIC_US
+                   || uhd::byteswap(magic) == PCAP_MAGIC_NS) {
+            _swap = true;
+            magic = uhd::byteswap(magic);
+        } else {
+            throw uhd::value_error("Not a pcap or pcapng file: " + path);
+        }
+        _pcap_ns = (magic == PCAP_MAGIC_NS);
+        // Version (2 x 16 bits), timezone, sigfigs, snaplen
+        uint8_t rest[16];
+        _read(rest, sizeof(rest));
+        _pcap_linktype = _u32(_read_u32());
+    }
+
+    ~capture_reader()
+    {
+        std::fclose(_file);
+    }
+
+    //! Read the next frame. Returns false at the end of the file.
+    bool next(frame_t& frame)
+    {
+        return _pcapng ? _next_pcapng(frame) : _next_pcap(frame);
+    }
+
+private:
+    struct interface_t
+    {
+        uint32_t linktype;
+        // Timestamps are in units of 10^-tsresol s, or 2^-tsresol s if
+        // tsresol_binary is set
+        uint8_t tsresol;
+        bool tsresol_binary;
+    };
+
+    bool _read(void* buf, size_t len)
+    {
+        return std::fread(buf, 1, len, _file) == len;
+    }
+
+    uint32_t _read_u32()
+    {
+        uint32_t value = 0;
+        if (!_read(&value, sizeof(value))) {
+            throw uhd::io_error("Unexpected end of capture file");
+        }
+        return value;
+    }
+
+    uint32_t _u32(uint32_t value) const
+    {
+        return _swap ? uhd::byteswap(value) : value;
+    }
+
+    uint16_t _u16(const uint8_t* p) const
+    {
+        uint16_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return _swap ? uhd::byteswap(value) : value;
+    }
+
+    uint32_t _u32(const uint8_t* p) const
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return _u32(value);
+    }
+
+    bool _next_pcap(frame_t& frame)
+    {
+        uint32_t hdr[4];
+        if (!_read(hdr, sizeof(hdr))) {
+            return false;
+        }
+        const uint64_t secs = _u32(hdr[0]);
+        const uint64_t frac = _u32(hdr[1]);
+        const size_t len    = _u32(hdr[2]);
+        _data.resize(len);
+        if (!_read(_data.data(), len)) {
+            return false;
+        }
+        frame.time_ns  = secs * 1000000000ULL + (_pcap_ns ? frac : frac * 1000);
+        frame.linktype = _pcap_linktype;
+        frame.data     = _data.data();
+        frame.len      = len;
+        return true;
+    }
+
+    //! Read the section header block, after its block type was read
+    void _read_shb()
+    {
+        const uint32_t len = _read_u32();
+        const uint32_t bom = _read_u32();
+        if (bom == PCAPNG_BOM) {
+            _swap = false;
+        } else if (uhd::byteswap(bom) == PCAPNG_BOM) {
+            _swap = true;
+        } else {
+            throw uhd::value_error("Invalid pcapng byte order magic");
+        }
+        // Every section has its own interfaces
+        _interfaces.clear();
+        _data.resize(_u32(len) - 12);
+        if (!_read(_data.data(), _data.size())) {
+            throw uhd::io_error("Unexpected end of capture file");
+        }
+    }
+
+    bool _next_pcapng(frame_t& frame)
+    {
+        while (true) {
+            uint32_t hdr[2];
+            if (!_read(hdr, sizeof(hdr))) {
+                return false;
+            }
+            if (hdr[0] == PCAPNG_SHB_TYPE) {
+                // The byte order of the file may change with every section, but
+                // the SHB type reads the same in both
+                std::fseek(_file, -4, SEEK_CUR);
+                _read_shb();
+                continue;
+            }
+            const uint32_t type = _u32(hdr[0]);
+            const uint32_t len  = _u32(hdr[1]);
+            if (len < 12) {
+                throw uhd::value_error("Invalid pcapng block length");
+            }
+            // The body, including the trailing length
+            _data.resize(len - 8);
+            if (!_read(_data.data(), _data.size())) {
+                return false;
+            }
+            const uint8_t* body   = _data.data();
+            const size_t body_len = _data.size() - 4;
+
+            if (type == PCAPNG_IDB_TYPE && body_len >= 8) {
+                _add_interface(body, body_len);
+            } else if (type == PCAPNG_EPB_TYPE && body_len >= 20) {
+                const uint32_t iface = _u32(body);
+                if (iface >= _interfaces.size()) {
+                    throw uhd::value_error("pcapng packet for unknown interface");
+                }
+                const uint64_t ts =
+                    (uint64_t(_u32(body + 4)) << 32) | uint64_t(_u32(body + 8));
+                frame.time_ns  = _to_ns(ts, _interfaces[iface]);
+                frame.linktype = _interfaces[iface].linktype;
+                frame.data     = body + 20;
+                frame.len      = std::min<size_t>(_u32(body + 12), body_len - 20);
+                return true;
+            } else if (type == PCAPNG_SPB_TYPE && body_len >= 4 && !_interfaces.empty()) {
+                // Simple packets have no timestamp, so they keep the last one
+                frame.linktype = _interfaces[0].linktype;
+                frame.data     = body + 4;
+                frame.len      = std::min<size_t>(_u32(body), body_len - 4);
+                return true;
+            }
+        }
+    }
+
+    void _add_interface(const uint8_t* body, const size_t body_len)
+    {
+        interface_t iface{_u16(body), 6, false};
+        // Options follow the link type, reserved field and snap length
+        for (size_t pos = 8; pos + 4 <= body_len;) {
+            const uint16_t code = _u16(body + pos);
+            const uint16_t len  = _u16(body + pos + 2);
+            if (code == 0) {
+                break;
+            }
+            if (code == PCAPNG_TSRESOL_OPT && len >= 1 && pos + 5 <= body_len) {
+                iface.tsresol_binary = (body[pos + 4] & 0x80) != 0;
+                iface.tsresol        = body[pos + 4] & 0x7f;
+            }
+            pos += 4 + ((len + 3) & ~3);
+        }
+        _interfaces.push_back(iface);
+    }
+
+    static uint64_t _to_ns(const uint64_t ts, const interface_t& iface)
+    {
+        if (iface.tsresol_binary) {
+            return uint64_t(double(ts) * 1e9 / double(uint64_t(1) << iface.tsresol));
+        }
+        uint64_t value = ts;
+        for (int exp = iface.tsresol; exp < 9; exp++) {
+            value *= 10;
+        }
+        for (int exp = iface.tsresol; exp > 9; exp--) {
+            value /= 10;
+        }
+        return value;
+    }
+
+    std::FILE* _file;
+    std::vector<char> _file_buffer;
+    std::vector<uint8_t> _data;
+    bool _swap              = false;
+    bool _pcapng            = false;
+    bool _pcap_ns           = false;
+    uint32_t _pcap_linktype = LINKTYPE_ETHERNET;
+    std::vector<interface_t> _interfaces;
+};
+
+//! An IPv4 address and UDP port
+struct udp_addr_t
+{
+    uint32_t ip;
+    uint16_t port;
+
+    bool operator<(const udp_addr_t& rhs) const
+    {
+        return std::tie(ip, port) < std::tie(rhs.ip, rhs.port);
+    }
+
+    std::string to_string() const
+    {
+        return str(boost::format("%d.%d.%d.%d:%d") % (ip >> 24) % ((ip >> 16) & 0xff)
+                   % ((ip >> 8) & 0xff) % (ip & 0xff) % port);
+    }
+};
+
+//! A direction of CHDR traffic between two UDP ports, to one endpoint
+struct flow_t
+{
+    udp_addr_t src;
+    udp_addr_t dst;
+    uint16_t dst_epid;
+
+    bool operator<(const flow_t& rhs) const
+    {
+        return std::tie(src, dst, dst_epid) < std::tie(rhs.src, rhs.dst, rhs.dst_epid);
+    }
+
+    bool operator==(const flow_t& rhs) const
+    {
+        return !(*this < rhs) && !(rhs < *this);
+    }
+
+    std::string to_string() const
+    {
+        return src.to_string() + " -> " + dst.to_string() + " EPID "
+               + std::to_string(dst_epid);
+    }
+};
+
+//! Minimum, maximum and mean of a series of durations
+struct duration_stats_t
+{
+    uint64_t count  = 0;
+    uint64_t min_ns = std::numeric_limits<uint64_t>::max();
+    uint64_t max_ns = 0;
+    double sum_ns   = 0.0;
+
+    void add(const uint64_t ns)
+    {
+        count++;
+        min_ns = std::min(min_ns, ns);
+        max_ns = std::max(max_ns, ns);
+        sum_ns += double(ns);
+    }
+
+    std::string to_string() const
+    {
+        if (count == 0) {
+            return "n/a";
+        }
+        return str(boost::format("min %.1f us, mean %.1f us, max %.1f us")
+                   % (min_ns / 1e3) % (sum_ns / count / 1e3) % (max_ns / 1e3));
+    }
+};
+
+struct data_stats_t
+{
+    uint64_t num_pkts     = 0;
+    uint64_t num_bytes    = 0;
+    uint64_t num_eobs     = 0;
+    uint64_t num_gaps     = 0;
+    uint64_t num_lost     = 0;
+    uint64_t first_ns     = 0;
+    uint64_t last_ns      = 0;
+    uint16_t last_seq_num = 0;
+};
+
+struct strs_stats_t
+{
+    uint64_t num_pkts       = 0;
+    uint64_t num_errors     = 0;
+    uint64_t last_ns        = 0;
+    uint64_t capacity_pkts  = 0;
+    uint64_t capacity_bytes = 0;
+    duration_stats_t interval;
+};
+
+struct ctrl_stats_t
+{
+    uint64_t num_requests = 0;
+    uint64_t num_errors   = 0;
+    duration_stats_t latency;
+};
+
+class chdr_analyzer
+{
+public:
+    chdr_analyzer(uhd::rfnoc::chdr_w_t chdr_w, uint16_t port)
+        : _chdr_w(chdr_w)
+        , _chdr_w_bytes(uhd::rfnoc::chdr_w_to_bits(chdr_w) / 8)
+        , _port(port)
+    {
+    }
+
+    void add_frame(const frame_t& frame)
+    {
+        _num_frames++;
+        udp_addr_t src, dst;
+        const uint8_t* payload;
+        size_t len;
+        if (!_decode_udp(frame, src, dst, payload, len)) {
+            _num_skipped++;
+            return;
+        }
+        // A UDP datagram holds one CHDR packet
+        if (len < 8) {
+            _num_malformed++;
+            return;
+        }
+        uint64_t hdr_word;
+        std::memcpy(&hdr_word, payload, sizeof(hdr_word));
+        const chdr_header header(uhd::wtohx(hdr_word));
+        const auto type = header.get_pkt_type();
+        const bool is_data =
+            (type == PKT_TYPE_DATA_NO_TS || type == PKT_TYPE_DATA_WITH_TS);
+        // Data packets only need the header, so captures may truncate them
+        if (header.get_length() < _chdr_w_bytes
+            || (!is_data && header.get_length() > len)) {
+            _num_malformed++;
+            return;
+        }
+        const flow_t flow{src, dst, header.get_dst_epid()};
+
+        switch (type) {
+            case PKT_TYPE_DATA_NO_TS:
+            case PKT_TYPE_DATA_WITH_TS:
+                _add_data(flow, header, frame.time_ns);
+                break;
+            case PKT_TYPE_STRS:
+                _add_strs(flow, payload, header.get_length(), frame.time_ns);
+                break;
+            case PKT_TYPE_CTRL:
+                _add_ctrl(flow, payload, header.get_length(), frame.time_ns);
+                break;
+            default:
+                _num_other++;
+                break;
+        }
+    }
+
+    void print_report() const
+    {
+        std::cout << boost::format("Frames: %d, not CHDR: %d, malformed: %d, "
+                                   "management/stream commands: %d")
+                         % _num_frames % _num_skipped % _num_malformed % _num_other
+                  << std::endl;
+
+        std::cout << std::endl << "Data streams:" << std::endl;
+        for (const auto& entry : _data) {
+            const auto& stats = entry.second;
+            const double secs = (stats.last_ns - stats.first_ns) / 1e9;
+            std::cout << "  " << entry.first.to_string() << std::endl
+                      << boost::format("    %d packets, %d bytes, %d EOBs over %.6f s")
+                             % stats.num_pkts % stats.num_bytes % stats.num_eobs % secs
+                      << std::endl;
+            if (secs > 0) {
+                std::cout << boost::format("    %.3f MB/s, %.1f packets/s")
+                                 % (stats.num_bytes / secs / 1e6)
+                                 % (stats.num_pkts / secs)
+                          << std::endl;
+            }
+            std::cout << boost::format("    Sequence gaps: %d, lost packets: %d")
+                             % stats.num_gaps % stats.num_lost
+                      << std::endl;
+        }
+
+        std::cout << std::endl << "Stream status (flow control):" << std::endl;
+        for (const auto& entry : _strs) {
+            const auto& stats = entry.second;
+            std::cout << "  " << entry.first.to_string() << std::endl
+                      << boost::format("    %d status packets, %d with errors, "
+                                       "capacity %d packets/%d bytes")
+                             % stats.num_pkts % stats.num_errors % stats.capacity_pkts
+                             % stats.capacity_bytes
+                      << std::endl
+                      << "    Interval: " << stats.interval.to_string() << std::endl;
+        }
+
+        std::cout << std::endl << "Control transactions:" << std::endl;
+        for (const auto& entry : _ctrl) {
+            const auto& stats = entry.second;
+            uint64_t num_pending = 0;
+            for (const auto& request : _ctrl_requests) {
+                num_pending += (std::get<0>(request.first) == entry.first) ? 1 : 0;
+            }
+            std::cout << "  " << entry.first.to_string() << std::endl
+                      << boost::format("    %d requests, %d without response, %d "
+                                       "responses with errors")
+                             % stats.num_requests % num_pending % stats.num_errors
+                      << std::endl
+                      << "    Latency: " << stats.latency.to_string() << std::endl;
+        }
+    }
+
+private:
+    //! Find the UDP payload in an IPv4 frame. Returns false for other frames,
+    // and for frames which don't match the port filter.
+    bool _decode_udp(const frame_t& frame,
+        udp_addr_t& src,
+        udp_addr_t& dst,
+        const uint8_t*& payload,
+        size_t& len) const
+    {
+        const uint8_t* p = frame.data;
+        size_t remaining = frame.len;
+        auto get_u16     = [](const uint8_t* data) {
+            return uint16_t((data[0] << 8) | data[1]);
+        };
+
+        uint16_t ethertype = ETHERTYPE_IPV4;
+        switch (frame.linktype) {
+            case LINKTYPE_ETHERNET:
+                if (remaining < 14) {
+                    return false;
+                }
+                ethertype = get_u16(p + 12);
+                p += 14;
+                remaining -= 14;
+                while ((ethertype == ETHERTYPE_VLAN || ethertype == ETHERTYPE_QINQ)
+                       && remaining >= 4) {
+                    ethertype = get_u16(p + 2);
+                    p += 4;
+                    remaining -= 4;
+                }
+                break;
+            case LINKTYPE_LINUX_SLL:
+                if (remaining < 16) {
+                    return false;
+                }
+                ethertype = get_u16(p + 14);
+                p += 16;
+                remaining -= 16;
+                break;
+            case LINKTYPE_NULL:
+                if (remaining < 4) {
+                    return false;
+                }
+                p += 4;
+                remaining -= 4;
+                break;
+            case LINKTYPE_RAW:
+            case LINKTYPE_IPV4:
+                break;
+            default:
+                return false;
+        }
+
+        // IPv4 header
+        if (ethertype != ETHERTYPE_IPV4 || remaining < 20 || (p[0] >> 4) != 4) {
+            return false;
+        }
+        const size_t ihl = size_t(p[0] & 0x0f) * 4;
+        // Non-first fragments don't have a UDP header
+        const uint16_t frag_offset = get_u16(p + 6) & 0x1fff;
+        if (ihl < 20 || remaining < ihl + 8 || p[9] != IPPROTO_UDP_NUM
+            || frag_offset != 0) {
+            return false;
+        }
+        src.ip = (uint32_t(get_u16(p + 12)) << 16) | get_u16(p + 14);
+        dst.ip = (uint32_t(get_u16(p + 16)) << 16) | get_u16(p + 18);
+        p += ihl;
+        remaining -= ihl;
+
+        // UDP header
+        src.port = get_u16(p);
+        dst.port = get_u16(p + 2);
+        if (_port != 0 && src.port != _port && dst.port != _port) {
+            return false;
+        }
+        const size_t udp_len = get_u16(p + 4);
+        if (udp_len < 8) {
+            return false;
+        }
+        payload = p + 8;
+        len     = std::min(remaining, udp_len) - 8;
+        return true;
+    }
+
+    void _add_data(const flow_t& flow, const chdr_header& header, const uint64_t time_ns)
+    {
+        auto& stats = _data[flow];
+        if (stats.num_pkts == 0) {
+            stats.first_ns = time_ns;
+        } else {
+            const uint16_t expected = stats.last_seq_num + 1;
+            if (header.get_seq_num() != expected) {
+                stats.num_gaps++;
+                stats.num_lost += uint16_t(header.get_seq_num() - expected);
+            }
+        }
+        stats.num_pkts++;
+        stats.num_bytes += header.get_length();
+        stats.num_eobs += header.get_eob() ? 1 : 0;
+        stats.last_ns      = time_ns;
+        stats.last_seq_num = header.get_seq_num();
+    }
+
+    //! Parse a packet with the CHDR packet parser. It requires 64-bit alignment.
+    uhd::utils::chdr::chdr_packet _parse(const uint8_t* payload, const size_t len)
+    {
+        _aligned.resize((len + 7) / 8 + 1);
+        std::memcpy(_aligned.data(), payload, len);
+        return uhd::utils::chdr::chdr_packet::deserialize(_chdr_w,
+            _aligned.data(),
+            _aligned.data() + _aligned.size(),
+            uhd::ENDIANNESS_LITTLE);
+    }
+
+    void _add_strs(const flow_t& flow,
+        const uint8_t* payload,
+        const size_t len,
+        const uint64_t time_ns)
+    {
+        strs_payload strs;
+        try {
+            strs = _parse(payload, len).get_payload<strs_payload>();
+        } catch (const uhd::exception&) {
+            _num_malformed++;
+            return;
+        }
+        auto& stats = _strs[flow];
+        if (stats.num_pkts > 0) {
+            stats.interval.add(time_ns - stats.last_ns);
+        }
+        stats.num_pkts++;
+        stats.num_errors += (strs.status != STRS_OKAY) ? 1 : 0;
+        stats.last_ns        = time_ns;
+        stats.capacity_pkts  = strs.capacity_pkts;
+        stats.capacity_bytes = strs.capacity_bytes;
+    }
+
+    void _add_ctrl(const flow_t& flow,
+        const uint8_t* payload,
+        const size_t len,
+        const uint64_t time_ns)
+    {
+        ctrl_payload ctrl;
+        try {
+            ctrl = _parse(payload, len).get_payload<ctrl_payload>();
+        } catch (const uhd::exception&) {
+            _num_malformed++;
+            return;
+        }
+        // Requests and responses travel between the same ports, in opposite
+        // directions, and share the sequence number
+        if (!ctrl.is_ack) {
+            _ctrl[flow].num_requests++;
+            _ctrl_requests[std::make_tuple(flow, ctrl.seq_num)] = time_ns;
+            return;
+        }
+        for (auto it = _ctrl_requests.begin(); it != _ctrl_requests.end(); ++it) {
+            const flow_t& request_flow = std::get<0>(it->first);
+            if (request_flow.src.ip == flow.dst.ip
+                && request_flow.src.port == flow.dst.port
+                && request_flow.dst.ip == flow.src.ip
+                && request_flow.dst.port == flow.src.port
+                && std::get<1>(it->first) == ctrl.seq_num) {
+                auto& stats = _ctrl[request_flow];
+                stats.latency.add(time_ns - it->second);
+                stats.num_errors += (ctrl.status != CMD_OKAY) ? 1 : 0;
+                _ctrl_requests.erase(it);
+                return;
+            }
+        }
+    }
+
+    const uhd::rfnoc::chdr_w_t _chdr_w;
+    const size_t _chdr_w_bytes;
+    const uint16_t _port;
+
+    uint64_t _num_frames    = 0;
+    uint64_t _num_skipped   = 0;
+    uint64_t _num_malformed = 0;
+    uint64_t _num_other     = 0;
+    std::map<flow_t, data_stats_t> _data;
+    std::map<flow_t, strs_stats_t> _strs;
+    std::map<flow_t, ctrl_stats_t> _ctrl;
+    //! Times of the requests which are waiting for a response
+    std::map<std::tuple<flow_t, uint8_t>, uint64_t> _ctrl_requests;
+    std::vector<uint64_t> _aligned;
+};
+
+} // namespace
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string file;
+    uint16_t port;
+    size_t chdr_w_bits;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("file", po::value<std::string>(&file), "pcap or pcapng file to analyze")
+        ("port", po::value<uint16_t>(&port)->default_value(49153), "UDP port of the CHDR traffic (source or destination). 0 analyzes all UDP traffic.")
+        ("chdr-w", po::value<size_t>(&chdr_w_bits)->default_value(64), "CHDR width in bits")
+    ;
+    // clang-format on
+    po::positional_options_description pos_desc;
+    pos_desc.add("file", 1);
+    po::variables_map vm;
+    po::store(
+        po::command_line_parser(argc, argv).options(desc).positional(pos_desc).run(), vm);
+    po::notify(vm);
+
+    if (vm.count("help") || !vm.count("file")) {
+        std::cout << "CHDR pcap analyzer" << std::endl
+                  << std::endl
+                  << "Reports throughput, sequence gaps, flow control and control "
+                     "transaction timing of the CHDR traffic in a capture file."
+                  << std::endl
+                  << std::endl
+                  << desc << std::endl;
+        return vm.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    chdr_analyzer analyzer(uhd::rfnoc::bits_to_chdr_w(chdr_w_bits), port);
+    capture_reader reader(file);
+    frame_t frame{0, 0, nullptr, 0};
+    while (reader.next(frame)) {
+        analyzer.add_frame(frame);
+    }
+    analyzer.print_report();
+
+    return EXIT_SUCCESS;
+}
@@ -14,8 +14,11 @@
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <complex>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <map>
@@ -261,11 +264,240 @@ std::string item_to_string(
     }
 }
 
+/***********************************************************************
+ * Suite mode: Benchmark every registered converter
+ **********************************************************************/
+// Parse a comma-separated list of sizes, e.g. "16k,256k,4M"
+std::vector<size_t> parse_sizes(const std::string& list)
+{
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","), boost::token_compress_on);
+    std::vector<size_t> sizes;
+    for (std::string token : tokens) {
+        boost::trim(token);
+        if (token.empty()) {
+            continue;
+        }
+        size_t multiplier = 1;
+        switch (token.back()) {
+            case 'k':
+            case 'K':
+                multiplier = 1024;
+                break;
+            case 'm':
+            case 'M':
+                multiplier = 1024 * 1024;
+                break;
+            case 'g':
+            case 'G':
+                multiplier = 1024 * 1024 * 1024;
+                break;
+        }
+        if (multiplier != 1) {
+            token.pop_back();
+        }
+        sizes.push_back(boost::lexical_cast<size_t>(token) * multiplier);
+    }
+    return sizes;
+}
+
+// Set a scalar which maps the full range of the integer type to [-1, 1)
+void set_default_scalar(
+    converter::sptr conv, const std::string& in_type, const std::string& out_type)
+{
+    auto is_float = [](const std::string& type) {
+        return type == "fc64" or type == "fc32" or type == "f64" or type == "f32";
+    };
+    auto full_scale = [](const std::string& type) {
+        return (type == "sc8" or type == "s8") ? 127. : 32767.;
+    };
+    if (is_float(in_type) and not is_float(out_type)) {
+        conv->set_scalar(full_scale(out_type));
+    } else if (not is_float(in_type) and is_float(out_type)) {
+        conv->set_scalar(1. / full_scale(in_type));
+    } else {
+        conv->set_scalar(1.);
+    }
+}
+
+// A buffer whose data starts at a given offset from a cache line boundary
+struct offset_buffer
+{
+    static constexpr size_t ALIGNMENT = 64;
+
+    offset_buffer(const size_t size, const size_t offset)
+        : storage(size + offset + ALIGNMENT)
+    {
+        const auto base = reinterpret_cast<uintptr_t>(storage.data());
+        const size_t padding = (ALIGNMENT - base % ALIGNMENT) % ALIGNMENT;
+        data = storage.data() + padding + offset;
+    }
+
+    std::vector<char> storage;
+    char* data;
+};
+
+struct suite_result_t
+{
+    id_type id;
+    priority_type prio;
+    size_t working_set;
+    size_t offset;
+    size_t n_samples;
+    size_t iterations;
+    double duration;
+};
+
+// Run a converter for at least min_time seconds, after warming up the caches
+// and estimating the number of iterations this takes
+double run_timed_benchmark(converter::sptr conv,
+    const std::vector<const void*>& input_buf_refs,
+    const std::vector<void*>& output_buf_refs,
+    const size_t n_samples,
+    const double min_time,
+    size_t& iterations)
+{
+    iterations      = 1;
+    double duration = 0.0;
+    while ((duration = run_benchmark(
+                conv, input_buf_refs, output_buf_refs, n_samples, iterations))
+           < min_time / 8) {
+        iterations *= 2;
+    }
+    iterations = std::max(
+        size_t(1), size_t(std::ceil(double(iterations) * min_time / duration)));
+    return run_benchmark(conv, input_buf_refs, output_buf_refs, n_samples, iterations);
+}
+
+void print_suite_result(const suite_result_t& result, const bool json, const bool first)
+{
+    const double ns_per_samp =
+        result.duration * 1e9 / double(result.iterations * result.n_samples);
+    if (json) {
+        std::cout << (first ? "[\n" : ",\n")
+                  << boost::format("  {\"in\": \"%s\", \"n_inputs\": %d, "
+                                   "\"out\": \"%s\", \"n_outputs\": %d, "
+                                   "\"prio\": %d, \"working_set\": %d, "
+                                   "\"offset\": %d, \"n_samples\": %d, "
+                                   "\"iterations\": %d, \"ns_per_samp\": %.4f, "
+                                   "\"msps\": %.2f}")
+                         % result.id.input_format % result.id.num_inputs
+                         % result.id.output_format % result.id.num_outputs
+                         % result.prio % result.working_set % result.offset
+                         % result.n_samples % result.iterations % ns_per_samp
+                         % (1e3 / ns_per_samp);
+    } else {
+        std::cout << boost::format("%s,%d,%s,%d,%d,%d,%d,%d,%d,%.4f,%.2f\n")
+                         % result.id.input_format % result.id.num_inputs
+                         % result.id.output_format % result.id.num_outputs
+                         % result.prio % result.working_set % result.offset
+                         % result.n_samples % result.iterations % ns_per_samp
+                         % (1e3 / ns_per_samp);
+    }
+}
+
+// Benchmark every registered converter (optionally only those with the given
+// input or output format) at every priority, working set size and offset
+int run_suite(const std::string& in_format,
+    const std::string& out_format,
+    const std::vector<size_t>& working_sets,
+    const std::vector<size_t>& offsets,
+    const double min_time,
+    const bool json)
+{
+    std::vector<id_type> ids;
+    for (const id_type& id : get_converter_ids()) {
+        if ((in_format.empty() or id.input_format == in_format)
+            and (out_format.empty() or id.output_format == out_format)) {
+            ids.push_back(id);
+        }
+    }
+    std::sort(ids.begin(), ids.end(), [](const id_type& lhs, const id_type& rhs) {
+        return lhs.to_string() < rhs.to_string();
+    });
+    std::cout << "Found " << ids.size() << " conversion(s)." << std::endl;
+
+    std::cout << "{{{" << std::endl;
+    if (not json) {
+        std::cout << "in,n_inputs,out,n_outputs,prio,working_set,offset,n_samples,"
+                     "iterations,ns_per_samp,msps"
+                  << std::endl;
+    }
+    bool first = true;
+    for (const id_type& id : ids) {
+        const std::string in_type  = format_to_type(id.input_format);
+        const std::string out_type = format_to_type(id.output_format);
+        size_t in_size, out_size;
+        try {
+            in_size  = get_bytes_per_item(id.input_format);
+            out_size = get_bytes_per_item(id.output_format);
+        } catch (const uhd::key_error&) {
+            std::cerr << "Skipping " << id.to_string() << ": Unknown item size"
+                      << std::endl;
+            continue;
+        }
+        const size_t bytes_per_samp = in_size * id.num_inputs + out_size * id.num_outputs;
+
+        for (const size_t working_set : working_sets) {
+            // Packed formats convert groups of samples, so use a multiple of 16
+            const size_t n_samples =
+                std::max(working_set / bytes_per_samp / 16, size_t(1)) * 16;
+            for (const size_t offset : offsets) {
+                std::vector<offset_buffer> inputs, outputs;
+                std::vector<const void*> input_buf_refs;
+                std::vector<void*> output_buf_refs;
+                for (size_t i = 0; i < id.num_inputs; i++) {
+                    inputs.emplace_back(in_size * n_samples, offset);
+                    input_buf_refs.push_back(inputs.back().data);
+                }
+                for (size_t i = 0; i < id.num_outputs; i++) {
+                    outputs.emplace_back(out_size * n_samples, offset);
+                    output_buf_refs.push_back(outputs.back().data);
+                }
+                // Fill the inputs with random data, where the type is known
+                // (and leave them zeroed otherwise)
+                for (size_t i = 0; i < id.num_inputs; i++) {
+                    std::vector<std::vector<char>> buf(
+                        1, std::vector<char>(in_size * n_samples));
+                    try {
+                        init_buffers(buf, in_type, in_size, RANDOM);
+                    } catch (const uhd::runtime_error&) {
+                    }
+                    std::copy(buf[0].begin(), buf[0].end(), inputs[i].data);
+                }
+
+                for (const priority_type prio : get_converter_priorities(id)) {
+                    converter::sptr conv = get_converter(id, prio)();
+                    set_default_scalar(conv, in_type, out_type);
+                    suite_result_t result{
+                        id, prio, working_set, offset, n_samples, 0, 0.0};
+                    result.duration = run_timed_benchmark(conv,
+                        input_buf_refs,
+                        output_buf_refs,
+                        n_samples,
+                        min_time,
+                        result.iterations);
+                    print_suite_result(result, json, first);
+                    first = false;
+                }
+            }
+        }
+    }
+    if (json) {
+        std::cout << (first ? "[]\n" : "\n]\n");
+    }
+    std::cout << "}}}" << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     std::string in_format, out_format;
     std::string priorities;
     std::string seed_mode;
+    std::string sizes, offsets, output_format;
+    double min_time;
     priority_type prio = -1, max_prio;
     size_t iterations, n_samples;
     size_t n_inputs, n_outputs;
@@ -281,12 +513,17 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("samples",  po::value<size_t>(&n_samples)->default_value(1000000), "Number of samples per iteration")
         ("iterations",  po::value<size_t>(&iterations)->default_value(10000), "Number of iterations per benchmark")
         ("priorities", po::value<std::string>(&priorities)->default_value("default"), "Converter priorities. Can be 'default', 'all', or a comma-separated list of priorities.")
-        ("max-prio", po::value<priority_type>(&max_prio)->default_value(4), "Largest available priority (advanced feature)")
+        ("max-prio", po::value<priority_type>(&max_prio)->default_value(16), "Only use priorities below this one (advanced feature)")
         ("n-inputs",   po::value<size_t>(&n_inputs)->default_value(1),  "Number of input vectors")
         ("n-outputs",  po::value<size_t>(&n_outputs)->default_value(1), "Number of output vectors")
         ("debug-converter", "Skip benchmark and print conversion results. Implies iterations==1 and will only run on a single converter.")
         ("seed-mode", po::value<std::string>(&seed_mode)->default_value("random"), "How to initialize the data: random, incremental")
         ("hex", "When using debug mode, dump memory in hex")
+        ("suite", "Benchmark all registered converters at all priorities. --in and --out, if given, select the converters by format.")
+        ("sizes", po::value<std::string>(&sizes)->default_value("16k,256k,4M,64M"), "In suite mode: Comma-separated working set sizes in bytes (input plus output), e.g. to be resident in L1, L2, L3, and DRAM")
+        ("offsets", po::value<std::string>(&offsets)->default_value("0,4"), "In suite mode: Comma-separated offsets of the buffers from a cache line boundary in bytes")
+        ("min-time", po::value<double>(&min_time)->default_value(0.1), "In suite mode: Minimum duration of each benchmark in seconds")
+        ("format", po::value<std::string>(&output_format)->default_value("csv"), "In suite mode: Output format, csv or json")
     ;
     // clang-format on
     po::variables_map vm;
@@ -305,6 +542,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                "MILLISECONDS>\n"
                "  When using for converter debugging, every line is formatted as\n"
                "  <INPUT_VALUE>,<OUTPUT_VALUE>\n"
+               "  In suite mode, every line (or JSON object) holds the conversion, the\n"
+               "  priority, the working set size and buffer offset in bytes, and the\n"
+               "  throughput in nanoseconds per sample and Msps.\n"
             << std::endl;
         return EXIT_FAILURE;
     }
@@ -325,6 +565,20 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         iterations = 1;
     }
 
+    if (vm.count("suite")) {
+        if (output_format != "csv" and output_format != "json") {
+            std::cout << "Invalid argument: --format must be either 'csv' or 'json'."
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+        return run_suite(in_format,
+            out_format,
+            parse_sizes(sizes),
+            parse_sizes(offsets),
+            min_time,
+            output_format == "json");
+    }
+
     /// Create the converter(s) //////////////////////////////////////////////
     id_type converter_id;
     converter_id.input_format  = in_format;
@@ -342,15 +596,17 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
             return EXIT_FAILURE;
         }
     } else if (priorities == "all") {
-        for (priority_type i = 0; i < max_prio; i++) {
-            try {
+        try {
+            for (priority_type i : get_converter_priorities(converter_id)) {
+                if (i >= max_prio) {
+                    continue;
+                }
                 // get_converter() returns a factory function, execute that immediately:
-                converter::sptr conv_for_prio =
-                    get_converter(converter_id, i)(); // Can throw a uhd::key_error
-                conv_list[i] = conv_for_prio;
-            } catch (...) {
-                continue;
+                conv_list[i] = get_converter(converter_id, i)();
             }
+        } catch (const uhd::key_error&) {
+            std::cout << "No converters found." << std::endl;
+            return EXIT_FAILURE;
         }
     } else { // Assume that priorities contains a list of prios (e.g. 0,2,3)
         std::vector<std::string> prios_in_list;
@@ -42,7 +42,7 @@ def run_benchmark(args):
         k = k.replace('_', '-')
         if v is None:
             continue
-        if k in ('debug-converter', 'hex'):
+        if k in ('debug-converter', 'hex', 'suite'):
             if v:
                 call_args.append('--{0}'.format(k))
             continue
@@ -94,6 +94,38 @@ def print_stats_table(_, csv_output):
                 print("|", end='')
         print("")
 
+def print_suite_table(_, csv_output):
+    """
+    Print the results of suite mode, with the speedup of every priority over the
+    lowest one of the same conversion, working set and offset.
+    """
+    rows = list(csv.DictReader(csv_output.strip().split('\n'), delimiter=','))
+    baselines = {}
+    for row in rows:
+        key = (row['in'], row['out'], row['working_set'], row['offset'])
+        if key not in baselines or int(row['prio']) < baselines[key][0]:
+            baselines[key] = (int(row['prio']), float(row['msps']))
+    titles = ('Conversion', 'Prio', 'Working Set', 'Offset', 'Msps', 'Speedup')
+    table = []
+    for row in rows:
+        key = (row['in'], row['out'], row['working_set'], row['offset'])
+        table.append((
+            "{} -> {}".format(row['in'], row['out']),
+            row['prio'],
+            "{} KiB".format(int(row['working_set']) // 1024),
+            row['offset'],
+            row['msps'],
+            "{:.2f}x".format(float(row['msps']) / baselines[key][1]),
+        ))
+    widths = [max([len(title)] + [len(line[idx]) for line in table])
+              for idx, title in enumerate(titles)]
+    print("|".join(" {0:<{1}} ".format(title, width)
+                   for title, width in zip(titles, widths)))
+    print("+".join("-" * (width + 2) for width in widths))
+    for line in table:
+        print("|".join(" {0:>{1}} ".format(item, width)
+                       for item, width in zip(line, widths)))
+
 def print_debug_table(args, csv_output):
     """
     Print debug output.
@@ -121,12 +153,12 @@ def setup_argparse():
         description="UHD Converter Benchmark + Debugging Utility.",
     )
     parser.add_argument(
-        "-i", "--in", required=True,
-        help="Input format  (e.g. 'sc16')"
+        "-i", "--in",
+        help="Input format  (e.g. 'sc16'). Required unless --suite is given."
     )
     parser.add_argument(
-        "-o", "--out", required=True,
-        help="Output format  (e.g. 'sc16')"
+        "-o", "--out",
+        help="Output format  (e.g. 'sc16'). Required unless --suite is given."
     )
     parser.add_argument(
         "-s", "--samples", type=int,
@@ -165,15 +197,45 @@ def setup_argparse():
         "--hex", action='store_true',
         help="In debug mode, display data as hex values.",
     )
+    parser.add_argument(
+        "--suite", action='store_true',
+        help="Benchmark all registered converters at all priorities. --in and "
+             "--out, if given, select the converters by format.",
+    )
+    parser.add_argument(
+        "--sizes",
+        help="In suite mode: Comma-separated working set sizes in bytes "
+             "(e.g. '16k,256k,4M,64M')",
+    )
+    parser.add_argument(
+        "--offsets",
+        help="In suite mode: Comma-separated offsets of the buffers from a cache "
+             "line boundary in bytes",
+    )
+    parser.add_argument(
+        "--min-time", type=float,
+        help="In suite mode: Minimum duration of each benchmark in seconds",
+    )
+    parser.add_argument(
+        "--format", choices=('csv', 'json'),
+        help="In suite mode: Print the raw results in this format instead of a table",
+    )
     return parser
 
 def main():
     """ Go, go, go! """
-    args = setup_argparse().parse_args()
+    parser = setup_argparse()
+    args = parser.parse_args()
+    if not args.suite and (getattr(args, 'in') is None or args.out is None):
+        parser.error("--in and --out are required unless --suite is given")
     print("Running converter benchmark...")
     header_out, csv_output = run_benchmark(args)
     print(header_out)
-    if args.debug_converter:
+    if args.suite and args.format:
+        print(csv_output.strip())
+    elif args.suite:
+        print_suite_table(args, csv_output)
+    elif args.debug_converter:
         print_debug_table(args, csv_output)
     else:
         print_stats_table(args, csv_output)
@@ -0,0 +1,45 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/iq_codec.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <iostream>
+
+namespace po = boost::program_options;
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string in_file, out_file;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("in", po::value<std::string>(&in_file), "compressed recording, e.g., from rx_samples_to_file --compress")
+        ("out", po::value<std::string>(&out_file), "file to write the samples to")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // print the help message
+    if (vm.count("help") or not vm.count("in") or not vm.count("out")) {
+        std::cout << boost::format("UHD IQ Decompress %s") % desc << std::endl;
+        std::cout << "Restores the samples of a recording which was compressed by a "
+                     "sample recorder."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const uint64_t num_bytes = uhd::iq_codec::decompress_file(in_file, out_file);
+    std::cout << boost::format("Wrote %u bytes to %s") % num_bytes % out_file
+              << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,44 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <iostream>
+
+namespace po = boost::program_options;
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string index_file, out_file;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("index", po::value<std::string>(&index_file), "index of a striped recording, i.e., its file name plus \".index\"")
+        ("out", po::value<std::string>(&out_file), "file to write the samples to, with \".ch<N>\" inserted for multiple channels")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // print the help message
+    if (vm.count("help") or not vm.count("index") or not vm.count("out")) {
+        std::cout << boost::format("UHD Join Stripes %s") % desc << std::endl;
+        std::cout << "Reassembles a recording which a sample recorder striped across "
+                     "several directories."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    uhd::sample_recorder::join_stripes(index_file, out_file);
+    std::cout << "Wrote " << out_file << std::endl;
+    return EXIT_SUCCESS;
+}
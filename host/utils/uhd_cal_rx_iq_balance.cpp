@@ -25,19 +25,21 @@ namespace po = boost::program_options;
 /***********************************************************************
  * Tune RX and TX routine
  **********************************************************************/
-static double tune_rx_and_tx(
-    uhd::usrp::multi_usrp::sptr usrp, const double rx_lo_freq, const double tx_offset)
+static double tune_rx_and_tx(uhd::usrp::multi_usrp::sptr usrp,
+    const double rx_lo_freq,
+    const double tx_offset,
+    const size_t chan)
 {
     // tune the receiver with no cordic
     uhd::tune_request_t rx_tune_req(rx_lo_freq);
     rx_tune_req.dsp_freq_policy = uhd::tune_request_t::POLICY_MANUAL;
     rx_tune_req.dsp_freq        = 0;
-    usrp->set_rx_freq(rx_tune_req);
+    usrp->set_rx_freq(rx_tune_req, chan);
 
     // tune the transmitter
-    double tx_freq        = usrp->get_rx_freq() + tx_offset;
-    double min_fe_tx_freq = usrp->get_fe_tx_freq_range().start();
-    double max_fe_tx_freq = usrp->get_fe_tx_freq_range().stop();
+    double tx_freq        = usrp->get_rx_freq(chan) + tx_offset;
+    double min_fe_tx_freq = usrp->get_fe_tx_freq_range(chan).start();
+    double max_fe_tx_freq = usrp->get_fe_tx_freq_range(chan).stop();
     uhd::tune_request_t tx_tune_req(tx_freq);
     tx_tune_req.dsp_freq_policy = uhd::tune_request_t::POLICY_MANUAL;
     tx_tune_req.dsp_freq        = 0;
@@ -45,11 +47,9 @@ static double tune_rx_and_tx(
         tx_tune_req.dsp_freq = tx_freq - min_fe_tx_freq;
     else if (tx_freq > max_fe_tx_freq)
         tx_tune_req.dsp_freq = tx_freq - max_fe_tx_freq;
-    usrp->set_tx_freq(tx_tune_req);
+    usrp->set_tx_freq(tx_tune_req, chan);
 
-    wait_for_lo_lock(usrp);
-
-    return usrp->get_rx_freq();
+    return usrp->get_rx_freq(chan);
 }
 
 /***********************************************************************
@@ -57,7 +57,7 @@ static double tune_rx_and_tx(
  **********************************************************************/
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
-    std::string args, subdev, serial;
+    std::string args, subdev, channel_list;
     double tx_wave_ampl, tx_offset;
     double freq_start, freq_stop, freq_step;
     size_t nsamps;
@@ -70,6 +70,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("verbose", "enable some verbose")
         ("args", po::value<std::string>(&args)->default_value(""), "Device address args [default = \"\"]")
         ("subdev", po::value<std::string>(&subdev), "Subdevice specification (default: first subdevice, often 'A')")
+        ("channels", po::value<std::string>(&channel_list)->default_value("0"), "Which channel(s) to calibrate, e.g. \"0,1\". All channels are calibrated at once.")
         ("tx_wave_ampl", po::value<double>(&tx_wave_ampl)->default_value(0.7), "Transmit wave amplitude")
         ("tx_offset", po::value<double>(&tx_offset)->default_value(.9344e6), "TX LO offset from the RX LO in Hz")
         ("freq_start", po::value<double>(&freq_start), "Frequency start in Hz (do not specify for default)")
@@ -98,13 +99,17 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     }
 
     // Create a USRP device
-    uhd::usrp::multi_usrp::sptr usrp = setup_usrp_for_cal(args, subdev, serial);
+    std::vector<size_t> channels;
+    std::vector<std::string> serials;
+    uhd::usrp::multi_usrp::sptr usrp =
+        setup_usrp_for_cal(args, subdev, channel_list, channels, serials);
 
     if (not vm.count("nsamps"))
         nsamps = size_t(usrp->get_rx_rate() / default_fft_bin_size);
 
-    // create a receive streamer
+    // create a receive streamer of all channels
     uhd::stream_args_t stream_args("fc32"); // complex floats
+    stream_args.channels             = channels;
     uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
 
     // create a transmit streamer
@@ -113,14 +118,14 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     // create a transmitter thread
     std::atomic_flag transmit = ATOMIC_FLAG_INIT;
     transmit.test_and_set();
-    auto transmitter =
-        std::thread(std::bind(&tx_thread, &transmit, usrp, tx_stream, 0.0, tx_wave_ampl));
+    auto transmitter = std::thread(
+        std::bind(&tx_thread, &transmit, usrp, tx_stream, channels, 0.0, tx_wave_ampl));
 
-    // re-usable buffer for samples
-    std::vector<samp_type> buff;
+    // re-usable buffers for samples, one per channel
+    std::vector<std::vector<samp_type>> buffs;
 
-    // store the results here
-    std::vector<result_t> results;
+    // store the results of every channel here
+    std::vector<std::vector<result_t>> results(channels.size());
 
     if (not vm.count("freq_start"))
         freq_start = usrp->get_fe_rx_freq_range().start();
@@ -154,111 +159,76 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
                      % (freq_start / 1e6) % (freq_stop / 1e6)
               << std::endl;
 
-    size_t tx_error_count = 0;
     for (double rx_lo_i = freq_start; rx_lo_i <= freq_stop; rx_lo_i += freq_step) {
-        const double rx_lo = tune_rx_and_tx(usrp, rx_lo_i, tx_offset);
+        std::vector<double> rx_los;
+        for (const size_t chan : channels) {
+            rx_los.push_back(tune_rx_and_tx(usrp, rx_lo_i, tx_offset, chan));
+        }
+        wait_for_lo_lock(usrp, channels);
 
         // frequency constants for this tune event
-        const double actual_rx_rate = usrp->get_rx_rate();
-        const double actual_tx_freq = usrp->get_tx_freq();
-        const double actual_rx_freq = usrp->get_rx_freq();
-        const double bb_tone_freq   = actual_tx_freq - actual_rx_freq;
-        const double bb_imag_freq   = -bb_tone_freq;
-
-        // reset RX IQ balance
-        usrp->set_rx_iq_balance(0.0);
+        std::vector<tone_detector> tone_detectors;
+        std::vector<tone_detector> imag_detectors;
+        for (const size_t chan : channels) {
+            const double actual_rx_rate = usrp->get_rx_rate(chan);
+            const double actual_tx_freq = usrp->get_tx_freq(chan);
+            const double actual_rx_freq = usrp->get_rx_freq(chan);
+            const double bb_tone_freq   = actual_tx_freq - actual_rx_freq;
+            const double bb_imag_freq   = -bb_tone_freq;
+            tone_detectors.emplace_back(bb_tone_freq / actual_rx_rate, nsamps);
+            imag_detectors.emplace_back(bb_imag_freq / actual_rx_rate, nsamps);
+
+            // reset RX IQ balance
+            usrp->set_rx_iq_balance(0.0, chan);
+        }
+        auto get_suppression = [&](const size_t i, const std::vector<samp_type>& buff) {
+            return tone_detectors[i].dbrms(buff) - imag_detectors[i].dbrms(buff);
+        };
 
         // set optimal RX gain setting for this frequency
-        set_optimal_rx_gain(usrp, rx_stream);
+        set_optimal_rx_gain(usrp, rx_stream, channels);
 
         // capture initial uncorrected value
-        capture_samples(usrp, rx_stream, buff, nsamps);
-        const double initial_suppression =
-            compute_tone_dbrms(buff, bb_tone_freq / actual_rx_rate)
-            - compute_tone_dbrms(buff, bb_imag_freq / actual_rx_rate);
-
-        // bounds and results from searching
-        double phase_corr_start = -1.0;
-        double phase_corr_stop  = 1.0;
-        double phase_corr_step =
-            (phase_corr_stop - phase_corr_start) / (num_search_steps + 1);
-        double ampl_corr_start = -1.0;
-        double ampl_corr_stop  = 1.0;
-        double ampl_corr_step =
-            (ampl_corr_stop - ampl_corr_start) / (num_search_steps + 1);
-        double best_suppression = 0;
-        double best_phase_corr  = 0;
-        double best_ampl_corr   = 0;
-        while (phase_corr_step >= precision or ampl_corr_step >= precision) {
-            for (double phase_corr = phase_corr_start + phase_corr_step;
-                 phase_corr <= phase_corr_stop - phase_corr_step;
-                 phase_corr += phase_corr_step) {
-                for (double ampl_corr = ampl_corr_start + ampl_corr_step;
-                     ampl_corr <= ampl_corr_stop - ampl_corr_step;
-                     ampl_corr += ampl_corr_step) {
-                    const std::complex<double> correction(ampl_corr, phase_corr);
-                    usrp->set_rx_iq_balance(correction);
-
-                    // receive some samples
-                    capture_samples(usrp, rx_stream, buff, nsamps);
-                    // check for TX errors in the current captured iteration
-                    if (has_tx_error(tx_stream)) {
-                        if (vm.count("verbose")) {
-                            std::cout << "[WARNING] TX error detected! "
-                                      << "Repeating current iteration" << std::endl;
-                        }
-                        // Undo the correction step:
-                        ampl_corr -= ampl_corr_step;
-                        tx_error_count++;
-                        if (tx_error_count >= MAX_NUM_TX_ERRORS) {
-                            throw uhd::runtime_error(
-                                "Too many TX errors. Aborting calibration.");
-                        }
-                        continue;
-                    }
-                    const double tone_dbrms =
-                        compute_tone_dbrms(buff, bb_tone_freq / actual_rx_rate);
-                    const double imag_dbrms =
-                        compute_tone_dbrms(buff, bb_imag_freq / actual_rx_rate);
-                    const double suppression = tone_dbrms - imag_dbrms;
-
-                    if (suppression > best_suppression) {
-                        best_suppression = suppression;
-                        best_phase_corr  = phase_corr;
-                        best_ampl_corr   = ampl_corr;
-                    }
-                }
-            }
-
-            phase_corr_start = best_phase_corr - phase_corr_step;
-            phase_corr_stop  = best_phase_corr + phase_corr_step;
-            phase_corr_step =
-                (phase_corr_stop - phase_corr_start) / (num_search_steps + 1);
-            ampl_corr_start = best_ampl_corr - ampl_corr_step;
-            ampl_corr_stop  = best_ampl_corr + ampl_corr_step;
-            ampl_corr_step  = (ampl_corr_stop - ampl_corr_start) / (num_search_steps + 1);
+        capture_samples(usrp, rx_stream, buffs, nsamps);
+        std::vector<double> initial_suppression;
+        for (size_t i = 0; i < channels.size(); i++) {
+            initial_suppression.push_back(get_suppression(i, buffs[i]));
         }
 
-        if (best_suppression > initial_suppression) // keep result
-        {
-            result_t result;
-            result.freq      = rx_lo;
-            result.real_corr = best_ampl_corr;
-            result.imag_corr = best_phase_corr;
-            result.best      = best_suppression;
-            result.delta     = best_suppression - initial_suppression;
-            results.push_back(result);
-            if (vm.count("verbose"))
-                std::cout << boost::format(
-                                 "RX IQ: %f MHz: best suppression %f dB, corrected %f dB")
-                                 % (rx_lo / 1e6) % result.best % result.delta
-                          << std::endl;
-            else
-                std::cout << "." << std::flush;
+        // search the corrections of all channels at once
+        const auto best = search_corrections(usrp,
+            rx_stream,
+            tx_stream,
+            nsamps,
+            precision,
+            vm.count("verbose") > 0,
+            [&](const size_t i, const std::complex<double>& correction) {
+                usrp->set_rx_iq_balance(correction, channels[i]);
+            },
+            get_suppression,
+            std::vector<correction_t>(channels.size(), correction_t{0.0, 0.0}));
+
+        for (size_t i = 0; i < channels.size(); i++) {
+            const double best_suppression = best[i].metric;
+            if (best_suppression > initial_suppression[i]) // keep result
+            {
+                result_t result;
+                result.freq      = rx_los[i];
+                result.real_corr = best[i].value.real();
+                result.imag_corr = best[i].value.imag();
+                result.best      = best_suppression;
+                result.delta     = best_suppression - initial_suppression[i];
+                results[i].push_back(result);
+                if (vm.count("verbose"))
+                    std::cout << boost::format("RX IQ: channel %d: %f MHz: best "
+                                               "suppression %f dB, corrected %f dB")
+                                     % channels[i] % (rx_los[i] / 1e6) % result.best
+                                     % result.delta
+                              << std::endl;
+                else
+                    std::cout << "." << std::flush;
+            }
         }
-
-        // Reset underrun counts, start a new counter for the next frequency
-        tx_error_count = 0;
     } // end for each frequency loop
     std::cout << std::endl;
 
@@ -266,7 +236,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     transmit.clear();
     transmitter.join();
 
-    store_results(results, "RX", "rx", "iq", serial);
+    for (size_t i = 0; i < channels.size(); i++) {
+        store_results(results[i], "RX", "rx", "iq", serials[i]);
+    }
 
     return EXIT_SUCCESS;
 }
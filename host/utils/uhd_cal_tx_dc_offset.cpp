@@ -23,19 +23,21 @@ namespace po = boost::program_options;
 /***********************************************************************
  * Tune RX and TX routine
  **********************************************************************/
-static double tune_rx_and_tx(
-    uhd::usrp::multi_usrp::sptr usrp, const double tx_lo_freq, const double rx_offset)
+static double tune_rx_and_tx(uhd::usrp::multi_usrp::sptr usrp,
+    const double tx_lo_freq,
+    const double rx_offset,
+    const size_t chan)
 {
     // tune the transmitter with no cordic
     uhd::tune_request_t tx_tune_req(tx_lo_freq);
     tx_tune_req.dsp_freq_policy = uhd::tune_request_t::POLICY_MANUAL;
     tx_tune_req.dsp_freq        = 0;
-    usrp->set_tx_freq(tx_tune_req);
+    usrp->set_tx_freq(tx_tune_req, chan);
 
     // tune the receiver
-    double rx_freq        = usrp->get_tx_freq() - rx_offset;
-    double min_fe_rx_freq = usrp->get_fe_rx_freq_range().start();
-    double max_fe_rx_freq = usrp->get_fe_rx_freq_range().stop();
+    double rx_freq        = usrp->get_tx_freq(chan) - rx_offset;
+    double min_fe_rx_freq = usrp->get_fe_rx_freq_range(chan).start();
+    double max_fe_rx_freq = usrp->get_fe_rx_freq_range(chan).stop();
     uhd::tune_request_t rx_tune_req(rx_freq);
     rx_tune_req.dsp_freq_policy = uhd::tune_request_t::POLICY_MANUAL;
     rx_tune_req.dsp_freq        = 0;
@@ -43,11 +45,9 @@ static double tune_rx_and_tx(
         rx_tune_req.dsp_freq = rx_freq - min_fe_rx_freq;
     else if (rx_freq > max_fe_rx_freq)
         rx_tune_req.dsp_freq = rx_freq - max_fe_rx_freq;
-    usrp->set_rx_freq(rx_tune_req);
+    usrp->set_rx_freq(rx_tune_req, chan);
 
-    wait_for_lo_lock(usrp);
-
-    return usrp->get_tx_freq();
+    return usrp->get_tx_freq(chan);
 }
 
 /***********************************************************************
@@ -55,7 +55,7 @@ static double tune_rx_and_tx(
  **********************************************************************/
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
-    std::string args, subdev, serial;
+    std::string args, subdev, channel_list;
     double tx_wave_freq, tx_wave_ampl, rx_offset;
     double freq_start, freq_stop, freq_step;
     size_t nsamps;
@@ -68,6 +68,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("verbose", "enable some verbose")
         ("args", po::value<std::string>(&args)->default_value(""), "device address args [default = \"\"]")
         ("subdev", po::value<std::string>(&subdev), "Subdevice specification (default: first subdevice, often 'A')")
+        ("channels", po::value<std::string>(&channel_list)->default_value("0"), "Which channel(s) to calibrate, e.g. \"0,1\". All channels are calibrated at once.")
         ("tx_wave_freq", po::value<double>(&tx_wave_freq)->default_value(507.123e3), "Transmit wave frequency in Hz")
         ("tx_wave_ampl", po::value<double>(&tx_wave_ampl)->default_value(0.7), "Transmit wave amplitude")
         ("rx_offset", po::value<double>(&rx_offset)->default_value(.9344e6), "RX LO offset from the TX LO in Hz")
@@ -97,29 +98,33 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     }
 
     // Create a USRP device
-    uhd::usrp::multi_usrp::sptr usrp = setup_usrp_for_cal(args, subdev, serial);
+    std::vector<size_t> channels;
+    std::vector<std::string> serials;
+    uhd::usrp::multi_usrp::sptr usrp =
+        setup_usrp_for_cal(args, subdev, channel_list, channels, serials);
 
     if (not vm.count("nsamps"))
         nsamps = size_t(usrp->get_rx_rate() / default_fft_bin_size);
 
-    // create a receive streamer
+    // create a receive streamer of all channels
     uhd::stream_args_t stream_args("fc32"); // complex floats
+    stream_args.channels             = channels;
     uhd::rx_streamer::sptr rx_stream = usrp->get_rx_stream(stream_args);
 
-    // create a transmit streamer
+    // create a transmit streamer of all channels
     uhd::tx_streamer::sptr tx_stream = usrp->get_tx_stream(stream_args);
 
     // create a transmitter thread
     std::atomic_flag transmit = ATOMIC_FLAG_INIT;
     transmit.test_and_set();
-    auto transmitter = std::thread(
-        std::bind(&tx_thread, &transmit, usrp, tx_stream, tx_wave_freq, tx_wave_ampl));
+    auto transmitter = std::thread(std::bind(
+        &tx_thread, &transmit, usrp, tx_stream, channels, tx_wave_freq, tx_wave_ampl));
 
-    // re-usable buffer for samples
-    std::vector<samp_type> buff;
+    // re-usable buffers for samples, one per channel
+    std::vector<std::vector<samp_type>> buffs;
 
-    // store the results here
-    std::vector<result_t> results;
+    // store the results of every channel here
+    std::vector<std::vector<result_t>> results(channels.size());
 
     if (not vm.count("freq_start"))
         freq_start = usrp->get_fe_tx_freq_range().start();
@@ -154,100 +159,75 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
               << std::endl;
 
     // set RX gain
-    usrp->set_rx_gain(0);
+    for (const size_t chan : channels) {
+        usrp->set_rx_gain(0, chan);
+    }
 
-    size_t tx_error_count = 0;
     for (double tx_lo_i = freq_start; tx_lo_i <= freq_stop; tx_lo_i += freq_step) {
-        const double tx_lo = tune_rx_and_tx(usrp, tx_lo_i, rx_offset);
+        std::vector<double> tx_los;
+        for (const size_t chan : channels) {
+            tx_los.push_back(tune_rx_and_tx(usrp, tx_lo_i, rx_offset, chan));
+        }
+        wait_for_lo_lock(usrp, channels);
 
         // frequency constants for this tune event
-        const double actual_rx_rate = usrp->get_rx_rate();
-        const double actual_tx_freq = usrp->get_tx_freq();
-        const double actual_rx_freq = usrp->get_rx_freq();
-        const double bb_dc_freq     = actual_tx_freq - actual_rx_freq;
-
-        // reset TX DC offset
-        usrp->set_tx_dc_offset(std::complex<double>(0, 0));
+        std::vector<tone_detector> dc_detectors;
+        for (const size_t chan : channels) {
+            const double actual_rx_rate = usrp->get_rx_rate(chan);
+            const double actual_tx_freq = usrp->get_tx_freq(chan);
+            const double actual_rx_freq = usrp->get_rx_freq(chan);
+            const double bb_dc_freq     = actual_tx_freq - actual_rx_freq;
+            dc_detectors.emplace_back(bb_dc_freq / actual_rx_rate, nsamps);
+
+            // reset TX DC offset
+            usrp->set_tx_dc_offset(std::complex<double>(0, 0), chan);
+        }
 
         // capture initial uncorrected value
-        capture_samples(usrp, rx_stream, buff, nsamps);
-        const double initial_dc_dbrms =
-            compute_tone_dbrms(buff, bb_dc_freq / actual_rx_rate);
-
-        // bounds and results from searching
-        double i_corr_start  = -1.0;
-        double i_corr_stop   = 1.0;
-        double i_corr_step   = (i_corr_stop - i_corr_start) / (num_search_steps + 1);
-        double q_corr_start  = -1.0;
-        double q_corr_stop   = 1.0;
-        double q_corr_step   = (q_corr_stop - q_corr_start) / (num_search_steps + 1);
-        double best_dc_dbrms = initial_dc_dbrms;
-        double best_i_corr   = 0;
-        double best_q_corr   = 0;
-        while (i_corr_step >= precision or q_corr_step >= precision) {
-            for (double i_corr = i_corr_start + i_corr_step;
-                 i_corr <= i_corr_stop - i_corr_step;
-                 i_corr += i_corr_step) {
-                for (double q_corr = q_corr_start + q_corr_step;
-                     q_corr <= q_corr_stop - q_corr_step;
-                     q_corr += q_corr_step) {
-                    const std::complex<double> correction(i_corr, q_corr);
-                    usrp->set_tx_dc_offset(correction);
-
-                    // receive some samples
-                    capture_samples(usrp, rx_stream, buff, nsamps);
-                    // check for TX errors in the current captured iteration
-                    if (has_tx_error(tx_stream)) {
-                        std::cout << "[WARNING] TX error detected! "
-                                  << "Repeating current iteration" << std::endl;
-                        // Undo the Q correction step
-                        q_corr -= q_corr_step;
-                        tx_error_count++;
-                        if (tx_error_count >= MAX_NUM_TX_ERRORS) {
-                            throw uhd::runtime_error(
-                                "Too many TX errors. Aborting calibration.");
-                        }
-                        continue;
-                    }
-                    const double dc_dbrms =
-                        compute_tone_dbrms(buff, bb_dc_freq / actual_rx_rate);
-
-                    if (dc_dbrms < best_dc_dbrms) {
-                        best_dc_dbrms = dc_dbrms;
-                        best_i_corr   = i_corr;
-                        best_q_corr   = q_corr;
-                    }
-                }
-            }
-
-            i_corr_start = best_i_corr - i_corr_step;
-            i_corr_stop  = best_i_corr + i_corr_step;
-            i_corr_step  = (i_corr_stop - i_corr_start) / (num_search_steps + 1);
-            q_corr_start = best_q_corr - q_corr_step;
-            q_corr_stop  = best_q_corr + q_corr_step;
-            q_corr_step  = (q_corr_stop - q_corr_start) / (num_search_steps + 1);
+        capture_samples(usrp, rx_stream, buffs, nsamps);
+        std::vector<correction_t> initial;
+        for (size_t i = 0; i < channels.size(); i++) {
+            // The search maximizes its metric, so search the lowest negated offset
+            initial.push_back({0.0, -dc_detectors[i].dbrms(buffs[i])});
         }
 
-        if (best_dc_dbrms < initial_dc_dbrms) // keep result
-        {
-            result_t result;
-            result.freq      = tx_lo;
-            result.real_corr = best_i_corr;
-            result.imag_corr = best_q_corr;
-            result.best      = best_dc_dbrms;
-            result.delta     = initial_dc_dbrms - best_dc_dbrms;
-            results.push_back(result);
-            if (vm.count("verbose"))
-                std::cout << boost::format(
-                                 "TX DC: %f MHz: lowest offset %f dB, corrected %f dB")
-                                 % (tx_lo / 1e6) % result.best % result.delta
-                          << std::endl;
-            else
-                std::cout << "." << std::flush;
+        // search the corrections of all channels at once
+        const auto best = search_corrections(usrp,
+            rx_stream,
+            tx_stream,
+            nsamps,
+            precision,
+            true,
+            [&](const size_t i, const std::complex<double>& correction) {
+                usrp->set_tx_dc_offset(correction, channels[i]);
+            },
+            [&](const size_t i, const std::vector<samp_type>& buff) {
+                return -dc_detectors[i].dbrms(buff);
+            },
+            initial);
+
+        for (size_t i = 0; i < channels.size(); i++) {
+            const double initial_dc_dbrms = -initial[i].metric;
+            const double best_dc_dbrms    = -best[i].metric;
+            if (best_dc_dbrms < initial_dc_dbrms) // keep result
+            {
+                result_t result;
+                result.freq      = tx_los[i];
+                result.real_corr = best[i].value.real();
+                result.imag_corr = best[i].value.imag();
+                result.best      = best_dc_dbrms;
+                result.delta     = initial_dc_dbrms - best_dc_dbrms;
+                results[i].push_back(result);
+                if (vm.count("verbose"))
+                    std::cout << boost::format("TX DC: channel %d: %f MHz: lowest "
+                                               "offset %f dB, corrected %f dB")
+                                     % channels[i] % (tx_los[i] / 1e6) % result.best
+                                     % result.delta
+                              << std::endl;
+                else
+                    std::cout << "." << std::flush;
+            }
         }
-
-        // Reset underrun counts, start a new counter for the next frequency
-        tx_error_count = 0;
     } // end for each frequency loop
 
     std::cout << std::endl;
@@ -256,7 +236,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     transmit.clear();
     transmitter.join();
 
-    store_results(results, "TX", "tx", "dc", serial);
+    for (size_t i = 0; i < channels.size(); i++) {
+        store_results(results[i], "TX", "tx", "dc", serials[i]);
+    }
 
     return EXIT_SUCCESS;
 }
@@ -6,6 +6,7 @@
 //
 
 #include <uhd/config.hpp>
+#include <uhd/device.hpp>
 #include <uhd/image_loader.hpp>
 #include <uhd/types/device_addr.hpp>
 #include <uhd/utils/safe_main.hpp>
@@ -15,7 +16,9 @@
 #include <boost/program_options.hpp>
 #include <csignal>
 #include <cstdlib>
+#include <future>
 #include <iostream>
+#include <vector>
 
 namespace fs = boost::filesystem;
 namespace po = boost::program_options;
@@ -46,6 +49,46 @@ void sigint_handler(int)
     }
 }
 
+/*
+ * Load all devices which match the given args, in parallel. Every device is
+ * identified by its serial number, or its address if it has none.
+ */
+int load_all_devices(const uhd::image_loader::image_loader_args_t& image_loader_args)
+{
+    const auto dev_addrs = uhd::device::find(image_loader_args.args, uhd::device::USRP);
+    if (dev_addrs.empty()) {
+        std::cerr << "No applicable UHD devices found" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> names;
+    std::vector<std::future<bool>> results;
+    for (const auto& dev_addr : dev_addrs) {
+        const std::string key = dev_addr.has_key("serial") ? "serial" : "addr";
+        auto dev_args           = image_loader_args;
+        dev_args.args[key]      = dev_addr.get(key, "");
+        names.push_back(key + "=" + dev_args.args[key]);
+        results.push_back(std::async(std::launch::async,
+            [dev_args]() { return uhd::image_loader::load(dev_args); }));
+    }
+
+    int result = EXIT_SUCCESS;
+    std::cout << std::endl << "Results:" << std::endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        try {
+            if (results[i].get()) {
+                std::cout << "  " << names[i] << ": Done" << std::endl;
+                continue;
+            }
+            std::cout << "  " << names[i] << ": Device not found" << std::endl;
+        } catch (const std::exception& ex) {
+            std::cout << "  " << names[i] << ": Failed: " << ex.what() << std::endl;
+        }
+        result = EXIT_FAILURE;
+    }
+    return result;
+}
+
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
     po::options_description desc("Allowed options");
@@ -59,6 +102,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("no-fw", "Don't burn firmware")
         ("no-fpga", "Don't Burn FPGA")
         ("download", "Download an image to a bit/bin file")
+        ("all", "Load all devices matching --args in parallel")
+        ("skip-loaded", "Skip devices which report that the image is loaded already (MPM devices only)")
     ;
     // clang-format on
 
@@ -81,13 +126,14 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
 
     // Convert user options
     uhd::image_loader::image_loader_args_t image_loader_args;
-    image_loader_args.args          = vm["args"].as<std::string>();
-    image_loader_args.load_firmware = (vm.count("no-fw") == 0);
-    image_loader_args.load_fpga     = (vm.count("no-fpga") == 0);
-    image_loader_args.download      = (vm.count("download") != 0);
-    image_loader_args.firmware_path = vm["fw-path"].as<std::string>();
-    image_loader_args.fpga_path     = vm["fpga-path"].as<std::string>();
-    image_loader_args.out_path      = vm["out-path"].as<std::string>();
+    image_loader_args.args           = vm["args"].as<std::string>();
+    image_loader_args.load_firmware  = (vm.count("no-fw") == 0);
+    image_loader_args.load_fpga      = (vm.count("no-fpga") == 0);
+    image_loader_args.download       = (vm.count("download") != 0);
+    image_loader_args.firmware_path  = vm["fw-path"].as<std::string>();
+    image_loader_args.fpga_path      = vm["fpga-path"].as<std::string>();
+    image_loader_args.out_path       = vm["out-path"].as<std::string>();
+    image_loader_args.skip_if_loaded = (vm.count("skip-loaded") != 0);
 
     // Force user to specify a device
     if (not image_loader_args.args.has_key("type")) {
@@ -125,6 +171,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     device_type = image_loader_args.args.get("type", "");
 
     std::signal(SIGINT, &sigint_handler);
+    if (vm.count("all")) {
+        return load_all_devices(image_loader_args);
+    }
     if (not uhd::image_loader::load(image_loader_args)) {
         std::cerr << "No applicable UHD devices found" << std::endl;
         return EXIT_FAILURE;
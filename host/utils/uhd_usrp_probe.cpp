@@ -502,9 +502,12 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     if (vm.count("tree") != 0) {
         print_tree("/", tree);
     } else if (not vm.count("init-only")) {
-        std::string device_pp_string = get_device_pp_string(tree);
+        // Reading all values at once is much faster than reading them one by
+        // one, in particular for devices which need an RPC call per value
+        property_tree::sptr snapshot = tree->snapshot();
+        std::string device_pp_string = get_device_pp_string(snapshot);
         if (graph) {
-            device_pp_string += get_rfnoc_pp_string(graph, tree);
+            device_pp_string += get_rfnoc_pp_string(graph, snapshot);
         }
         std::cout << make_border(device_pp_string) << std::endl;
     }
@@ -14,13 +14,17 @@
 #include <uhd/utils/math.hpp>
 #include <uhd/utils/paths.hpp>
 #include <uhd/utils/thread.hpp>
+#include <boost/algorithm/string.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <complex>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 struct result_t
@@ -39,38 +43,43 @@ static const double default_precision     = 0.0001;
 static const double default_freq_step     = 7.3e6;
 static const size_t default_fft_bin_size  = 1000;
 static constexpr size_t MAX_NUM_TX_ERRORS = 10;
+// Time from requesting a capture of several channels to its start. Covers the
+// transient after a correction change, and the latency of the stream command.
+static const double capture_lead_time = 0.002;
+static constexpr size_t MAX_NUM_LATE_CAPTURES = 4;
 
 /***********************************************************************
- * Set standard defaults for devices
+ * Parse the list of channels to calibrate
  **********************************************************************/
-static inline void set_optimum_defaults(uhd::usrp::multi_usrp::sptr usrp)
+static std::vector<size_t> parse_channels(
+    uhd::usrp::multi_usrp::sptr usrp, const std::string& channel_list)
 {
-    constexpr size_t chan = 0;
-    const auto rx_info    = usrp->get_usrp_rx_info(chan);
-    const auto tx_info    = usrp->get_usrp_tx_info(chan);
-
-    const std::string mb_name = rx_info["mboard_id"];
-    if (mb_name.find("USRP2") != std::string::npos
-        or mb_name.find("N200") != std::string::npos
-        or mb_name.find("N210") != std::string::npos
-        or mb_name.find("X300") != std::string::npos
-        or mb_name.find("X310") != std::string::npos
-        or mb_name.find("NI-2974") != std::string::npos
-        or mb_name.find("n3xx") != std::string::npos) {
-        usrp->set_tx_rate(12.5e6);
-        usrp->set_rx_rate(12.5e6);
-    } else if (mb_name.find("n320") != std::string::npos) {
-        usrp->set_tx_rate(12.288e6);
-        usrp->set_rx_rate(12.288e6);
-    } else if (mb_name.find("B100") != std::string::npos) {
-        usrp->set_tx_rate(4e6);
-        usrp->set_rx_rate(4e6);
-    } else {
-        throw std::runtime_error(
-            std::string("self-calibration is not supported for this device: ") + mb_name);
+    std::vector<std::string> channel_strings;
+    std::vector<size_t> channels;
+    boost::split(channel_strings, channel_list, boost::is_any_of("\"',"));
+    for (const auto& channel_string : channel_strings) {
+        if (channel_string.empty()) {
+            continue;
+        }
+        const size_t chan = std::stoi(channel_string);
+        if (chan >= usrp->get_rx_num_channels() or chan >= usrp->get_tx_num_channels()) {
+            throw std::runtime_error("Invalid channel(s) specified.");
+        }
+        channels.push_back(chan);
     }
+    if (channels.empty()) {
+        throw std::runtime_error("No channels specified.");
+    }
+    return channels;
+}
 
-    const std::string tx_name = tx_info["tx_subdev_name"];
+/***********************************************************************
+ * Set standard defaults for devices
+ **********************************************************************/
+static inline void set_optimum_dboard_defaults(
+    uhd::usrp::multi_usrp::sptr usrp, const size_t chan)
+{
+    const std::string tx_name = usrp->get_usrp_tx_info(chan)["tx_subdev_name"];
     if (tx_name.find("WBX") == std::string::npos
         and tx_name.find("SBX") == std::string::npos
         and tx_name.find("CBX") == std::string::npos
@@ -81,9 +90,9 @@ static inline void set_optimum_defaults(uhd::usrp::multi_usrp::sptr usrp)
             std::string("self-calibration is not supported for this TX dboard :")
             + tx_name);
     }
-    usrp->set_tx_gain(0);
+    usrp->set_tx_gain(0, chan);
 
-    const std::string rx_name = rx_info["rx_subdev_name"];
+    const std::string rx_name = usrp->get_usrp_rx_info(chan)["rx_subdev_name"];
     if (rx_name.find("WBX") == std::string::npos
         and rx_name.find("SBX") == std::string::npos
         and rx_name.find("CBX") == std::string::npos
@@ -94,16 +103,45 @@ static inline void set_optimum_defaults(uhd::usrp::multi_usrp::sptr usrp)
             std::string("self-calibration is not supported for this RX dboard :")
             + rx_name);
     }
-    usrp->set_rx_gain(0);
+    usrp->set_rx_gain(0, chan);
+}
+
+static inline void set_optimum_defaults(
+    uhd::usrp::multi_usrp::sptr usrp, const std::vector<size_t>& channels)
+{
+    const std::string mb_name = usrp->get_usrp_rx_info(channels.front())["mboard_id"];
+    if (mb_name.find("USRP2") != std::string::npos
+        or mb_name.find("N200") != std::string::npos
+        or mb_name.find("N210") != std::string::npos
+        or mb_name.find("X300") != std::string::npos
+        or mb_name.find("X310") != std::string::npos
+        or mb_name.find("NI-2974") != std::string::npos
+        or mb_name.find("n3xx") != std::string::npos) {
+        usrp->set_tx_rate(12.5e6);
+        usrp->set_rx_rate(12.5e6);
+    } else if (mb_name.find("n320") != std::string::npos) {
+        usrp->set_tx_rate(12.288e6);
+        usrp->set_rx_rate(12.288e6);
+    } else if (mb_name.find("B100") != std::string::npos) {
+        usrp->set_tx_rate(4e6);
+        usrp->set_rx_rate(4e6);
+    } else {
+        throw std::runtime_error(
+            std::string("self-calibration is not supported for this device: ") + mb_name);
+    }
+
+    for (const size_t chan : channels) {
+        set_optimum_dboard_defaults(usrp, chan);
+    }
 }
 
 /***********************************************************************
  * Retrieve d'board serial
  **********************************************************************/
-static std::string get_serial(uhd::usrp::multi_usrp::sptr usrp, const std::string& tx_rx)
+static std::string get_serial(
+    uhd::usrp::multi_usrp::sptr usrp, const std::string& tx_rx, const size_t chan = 0)
 {
-    const size_t chan = 0;
-    auto usrp_info    = (tx_rx == "tx") ? usrp->get_usrp_tx_info(chan)
+    auto usrp_info = (tx_rx == "tx") ? usrp->get_usrp_tx_info(chan)
                                      : usrp->get_usrp_rx_info(chan);
     const std::string serial_key = tx_rx + "_serial";
     if (!usrp_info.has_key(serial_key)) {
@@ -116,9 +154,9 @@ static std::string get_serial(uhd::usrp::multi_usrp::sptr usrp, const std::strin
 /***********************************************************************
  * Check for empty serial
  **********************************************************************/
-void check_for_empty_serial(uhd::usrp::multi_usrp::sptr usrp)
+void check_for_empty_serial(uhd::usrp::multi_usrp::sptr usrp, const size_t chan = 0)
 {
-    if (get_serial(usrp, "rx").empty()) {
+    if (get_serial(usrp, "rx", chan).empty()) {
         std::string error_string =
             "This dboard has no serial!\n\nPlease see the Calibration "
             "documentation for details on how to fix this.";
@@ -129,16 +167,75 @@ void check_for_empty_serial(uhd::usrp::multi_usrp::sptr usrp)
 /***********************************************************************
  * Compute power of a tone
  **********************************************************************/
+/*! Measures the power of a tone at a fixed frequency
+ *
+ * Like compute_tone_dbrms(), this shifts the tone down to DC and averages the
+ * samples, but the complex exponential is computed once instead of for every
+ * measurement. The sums are split into independent lanes, so the compiler can
+ * vectorize the loop.
+ */
+class tone_detector
+{
+public:
+    //! \p freq is fractional, i.e., relative to the sample rate
+    tone_detector(const double freq = 0.0, const size_t nsamps = 0) : _freq(freq)
+    {
+        _extend(nsamps);
+    }
+
+    //! Return the power of the tone in dBrms
+    double dbrms(const std::vector<samp_type>& samples)
+    {
+        _extend(samples.size());
+        constexpr size_t num_lanes = 8;
+        const float* samps         = reinterpret_cast<const float*>(samples.data());
+        std::complex<double> sum   = 0;
+        size_t i                   = 0;
+        // Single precision sums over blocks only, so no precision is lost on
+        // long captures
+        while (i + num_lanes <= samples.size()) {
+            float re[num_lanes] = {};
+            float im[num_lanes] = {};
+            const size_t block_end =
+                std::min(samples.size() - samples.size() % num_lanes, i + 4096);
+            for (; i < block_end; i += num_lanes) {
+                for (size_t lane = 0; lane < num_lanes; lane++) {
+                    const float samp_re = samps[2 * (i + lane)];
+                    const float samp_im = samps[2 * (i + lane) + 1];
+                    re[lane] += samp_re * _cos[i + lane] - samp_im * _sin[i + lane];
+                    im[lane] += samp_re * _sin[i + lane] + samp_im * _cos[i + lane];
+                }
+            }
+            for (size_t lane = 0; lane < num_lanes; lane++) {
+                sum += std::complex<double>(re[lane], im[lane]);
+            }
+        }
+        for (; i < samples.size(); i++) {
+            sum += std::complex<double>(samples[i] * samp_type(_cos[i], _sin[i]));
+        }
+
+        return 20 * std::log10(std::abs(sum / double(samples.size())));
+    }
+
+private:
+    void _extend(const size_t nsamps)
+    {
+        for (size_t i = _cos.size(); i < nsamps; i++) {
+            const samp_type phasor(std::polar(1.0, -_freq * tau * i));
+            _cos.push_back(phasor.real());
+            _sin.push_back(phasor.imag());
+        }
+    }
+
+    double _freq;
+    std::vector<float> _cos;
+    std::vector<float> _sin;
+};
+
 static inline double compute_tone_dbrms(const std::vector<samp_type>& samples,
     const double freq) // freq is fractional
 {
-    // shift the samples so the tone at freq is down at DC
-    // and average the samples to measure the DC component
-    samp_type average = 0;
-    for (size_t i = 0; i < samples.size(); i++)
-        average += samp_type(std::polar(1.0, -freq * tau * i)) * samples[i];
-
-    return 20 * std::log10(std::abs(average / float(samples.size())));
+    return tone_detector(freq, samples.size()).dbrms(samples);
 }
 
 /***********************************************************************
@@ -220,11 +317,77 @@ static void capture_samples(uhd::usrp::multi_usrp::sptr usrp,
         throw std::runtime_error("did not get all the samples requested");
 }
 
+/*! Capture samples of all channels of \p rx_stream at once
+ *
+ * With one channel, this is the same as the single-buffer version. Several
+ * channels are captured with a timed stream command, so their samples are
+ * aligned. The transient after a correction change is over by the time the
+ * capture starts, so no samples need to be discarded.
+ */
+static void capture_samples(uhd::usrp::multi_usrp::sptr usrp,
+    uhd::rx_streamer::sptr rx_stream,
+    std::vector<std::vector<samp_type>>& buffs,
+    const size_t nsamps_requested)
+{
+    buffs.resize(rx_stream->get_num_channels());
+    if (buffs.size() == 1) {
+        capture_samples(usrp, rx_stream, buffs.front(), nsamps_requested);
+        return;
+    }
+
+    for (auto& buff : buffs) {
+        buff.resize(nsamps_requested);
+    }
+    std::vector<samp_type*> buff_ptrs(buffs.size());
+    uhd::rx_metadata_t md;
+    uhd::stream_cmd_t stream_cmd(uhd::stream_cmd_t::STREAM_MODE_NUM_SAMPS_AND_DONE);
+    stream_cmd.num_samps  = nsamps_requested;
+    stream_cmd.stream_now = false;
+
+    // If the stream command arrives late, try again with more time to spare
+    double lead_time = capture_lead_time;
+    for (size_t num_late = 0;; num_late++) {
+        stream_cmd.time_spec = usrp->get_time_now() + lead_time;
+        rx_stream->issue_stream_cmd(stream_cmd);
+        size_t num_rx_samps = 0;
+        while (num_rx_samps < nsamps_requested) {
+            for (size_t i = 0; i < buffs.size(); i++) {
+                buff_ptrs[i] = buffs[i].data() + num_rx_samps;
+            }
+            num_rx_samps += rx_stream->recv(
+                buff_ptrs, nsamps_requested - num_rx_samps, md, 1.0 + lead_time);
+            if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE
+                or md.end_of_burst) {
+                break;
+            }
+        }
+        if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_LATE_COMMAND
+            and num_late + 1 < MAX_NUM_LATE_CAPTURES) {
+            lead_time *= 2;
+            continue;
+        }
+        if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+            throw std::runtime_error(std::string("Receiver error: ") + md.strerror());
+        }
+        // we can live if all the data didnt come in
+        if (num_rx_samps <= nsamps_requested / 2) {
+            throw std::runtime_error("did not get all the samples requested");
+        }
+        for (auto& buff : buffs) {
+            buff.resize(num_rx_samps);
+        }
+        return;
+    }
+}
+
 /***********************************************************************
  * Setup function
  **********************************************************************/
-static uhd::usrp::multi_usrp::sptr setup_usrp_for_cal(
-    std::string& args, std::string& subdev, std::string& serial)
+static uhd::usrp::multi_usrp::sptr setup_usrp_for_cal(std::string& args,
+    std::string& subdev,
+    const std::string& channel_list,
+    std::vector<size_t>& channels,
+    std::vector<std::string>& serials)
 {
     const std::string args_with_ignore = args + ",ignore_cal_file=1,ignore-cal-file=1";
     std::cout << std::endl;
@@ -237,23 +400,28 @@ static uhd::usrp::multi_usrp::sptr setup_usrp_for_cal(
         usrp->set_tx_subdev_spec(subdev);
         usrp->set_rx_subdev_spec(subdev);
     }
-    std::cout << "Running calibration for " << usrp->get_tx_subdev_name(0) << std::endl;
-    serial = get_serial(usrp, "tx");
-    std::cout << "Daughterboard serial: " << serial << std::endl;
-
-    // set the antennas to cal
-    if (not uhd::has(usrp->get_rx_antennas(), "CAL")
-        or not uhd::has(usrp->get_tx_antennas(), "CAL"))
-        throw std::runtime_error(
-            "This board does not have the CAL antenna option, cannot self-calibrate.");
-    usrp->set_rx_antenna("CAL");
-    usrp->set_tx_antenna("CAL");
-
-    // fail if daughterboard has no serial
-    check_for_empty_serial(usrp);
+    channels = parse_channels(usrp, channel_list);
+    serials.clear();
+    for (const size_t chan : channels) {
+        std::cout << "Running calibration for " << usrp->get_tx_subdev_name(chan)
+                  << " (channel " << chan << ")" << std::endl;
+        serials.push_back(get_serial(usrp, "tx", chan));
+        std::cout << "Daughterboard serial: " << serials.back() << std::endl;
+
+        // set the antennas to cal
+        if (not uhd::has(usrp->get_rx_antennas(chan), "CAL")
+            or not uhd::has(usrp->get_tx_antennas(chan), "CAL"))
+            throw std::runtime_error(
+                "This board does not have the CAL antenna option, cannot self-calibrate.");
+        usrp->set_rx_antenna("CAL", chan);
+        usrp->set_tx_antenna("CAL", chan);
+
+        // fail if daughterboard has no serial
+        check_for_empty_serial(usrp, chan);
+    }
 
     // set optimum defaults
-    set_optimum_defaults(usrp);
+    set_optimum_defaults(usrp, channels);
 
     return usrp;
 }
@@ -263,26 +431,11 @@ static uhd::usrp::multi_usrp::sptr setup_usrp_for_cal(
  **********************************************************************/
 UHD_INLINE void set_optimal_rx_gain(uhd::usrp::multi_usrp::sptr usrp,
     uhd::rx_streamer::sptr rx_stream,
+    const std::vector<size_t>& channels,
     double wave_freq = 0.0,
     double gain_step = 3.0)
 {
     const double gain_step_threshold = gain_step * 0.5;
-    const double actual_rx_rate      = usrp->get_rx_rate();
-    const double actual_tx_freq      = usrp->get_tx_freq();
-    const double actual_rx_freq      = usrp->get_rx_freq();
-    const double bb_tone_freq        = actual_tx_freq - actual_rx_freq + wave_freq;
-    const size_t nsamps              = size_t(actual_rx_rate / default_fft_bin_size);
-
-    std::vector<samp_type> buff(nsamps);
-    uhd::gain_range_t rx_gain_range = usrp->get_rx_gain_range();
-    double rx_gain                  = rx_gain_range.start() + gain_step;
-    double curr_dbrms               = 0.0;
-    double prev_dbrms               = 0.0;
-    double delta                    = 0.0;
-
-    // No sense in setting the gain where this is no gain range
-    if (rx_gain_range.stop() - rx_gain_range.start() < gain_step)
-        return;
 
     // The algorithm below cycles through the RX gain range
     // looking for the point where the signal begins to get
@@ -294,57 +447,110 @@ UHD_INLINE void set_optimal_rx_gain(uhd::usrp::multi_usrp::sptr usrp,
     // rather than the top in order to minimize the chances of
     // exposing frontend components to a dangerous amount of power
     // from the incoming signal.
+    // Every channel is searched on its own, but all channels which are still
+    // searching share a capture.
+    enum class search_state_t { FIND_SIGNAL, FIND_CLIPPING, DONE };
+    struct channel_search_t
+    {
+        uhd::gain_range_t rx_gain_range;
+        tone_detector detector;
+        double rx_gain;
+        double prev_dbrms;
+        search_state_t state;
+    };
+    std::vector<channel_search_t> searches;
+    for (const size_t chan : channels) {
+        const double actual_rx_rate = usrp->get_rx_rate(chan);
+        const double actual_tx_freq = usrp->get_tx_freq(chan);
+        const double actual_rx_freq = usrp->get_rx_freq(chan);
+        const double bb_tone_freq   = actual_tx_freq - actual_rx_freq + wave_freq;
+
+        const uhd::gain_range_t rx_gain_range = usrp->get_rx_gain_range(chan);
+        // No sense in setting the gain where this is no gain range
+        const bool has_gain_range =
+            rx_gain_range.stop() - rx_gain_range.start() >= gain_step;
+        searches.push_back({rx_gain_range,
+            tone_detector(bb_tone_freq / actual_rx_rate),
+            rx_gain_range.start() + gain_step,
+            0.0,
+            has_gain_range ? search_state_t::FIND_SIGNAL : search_state_t::DONE});
+    }
+    const size_t nsamps =
+        size_t(usrp->get_rx_rate(channels.front()) / default_fft_bin_size);
+    std::vector<std::vector<samp_type>> buffs;
 
     // Initialize prev_dbrms value
-    usrp->set_rx_gain(rx_gain);
-    capture_samples(usrp, rx_stream, buff, nsamps);
-    prev_dbrms = compute_tone_dbrms(buff, bb_tone_freq / actual_rx_rate);
-    rx_gain += gain_step;
-
-    // First, get the signal above the noise floor
-    while (rx_gain <= rx_gain_range.stop()) {
-        usrp->set_rx_gain(rx_gain);
-        capture_samples(usrp, rx_stream, buff, nsamps);
-        curr_dbrms = compute_tone_dbrms(buff, bb_tone_freq / actual_rx_rate);
-        delta      = curr_dbrms - prev_dbrms;
-
-        // Check that the signal power is not already high
-        if (curr_dbrms >= 0)
-            break;
-        // Check that the signal power has increased as the gain increases
-        if (delta >= gain_step - gain_step_threshold)
-            break;
-
-        prev_dbrms = curr_dbrms;
-        rx_gain += gain_step;
+    for (size_t i = 0; i < channels.size(); i++) {
+        if (searches[i].state != search_state_t::DONE) {
+            usrp->set_rx_gain(searches[i].rx_gain, channels[i]);
+        }
+    }
+    capture_samples(usrp, rx_stream, buffs, nsamps);
+    for (size_t i = 0; i < channels.size(); i++) {
+        auto& search      = searches[i];
+        search.prev_dbrms = search.detector.dbrms(buffs[i]);
+        search.rx_gain += gain_step;
     }
 
-    // Find RX gain where signal begins to clip
-    while (rx_gain <= rx_gain_range.stop()) {
-        usrp->set_rx_gain(rx_gain);
-        capture_samples(usrp, rx_stream, buff, nsamps);
-        curr_dbrms = compute_tone_dbrms(buff, bb_tone_freq / actual_rx_rate);
-        delta      = curr_dbrms - prev_dbrms;
-
-        // check if the gain is compressed beyone the threshold
-        if (delta < gain_step - gain_step_threshold)
-            break; // if so, we are done
-
-        prev_dbrms = curr_dbrms;
-        rx_gain += gain_step;
+    while (true) {
+        bool searching = false;
+        for (size_t i = 0; i < channels.size(); i++) {
+            auto& search = searches[i];
+            if (search.rx_gain > search.rx_gain_range.stop()) {
+                search.state = search_state_t::DONE;
+            }
+            if (search.state != search_state_t::DONE) {
+                usrp->set_rx_gain(search.rx_gain, channels[i]);
+                searching = true;
+            }
+        }
+        if (not searching) {
+            break;
+        }
+        capture_samples(usrp, rx_stream, buffs, nsamps);
+        for (size_t i = 0; i < channels.size(); i++) {
+            auto& search = searches[i];
+            if (search.state == search_state_t::DONE) {
+                continue;
+            }
+            const double curr_dbrms = search.detector.dbrms(buffs[i]);
+            const double delta      = curr_dbrms - search.prev_dbrms;
+            if (search.state == search_state_t::FIND_SIGNAL) {
+                // First, get the signal above the noise floor. Check that the
+                // signal power is not already high, and that the signal power
+                // has increased as the gain increases.
+                if (curr_dbrms >= 0 or delta >= gain_step - gain_step_threshold) {
+                    search.state = search_state_t::FIND_CLIPPING;
+                    continue;
+                }
+            } else if (delta < gain_step - gain_step_threshold) {
+                // Find RX gain where signal begins to clip: check if the gain
+                // is compressed beyond the threshold
+                search.state = search_state_t::DONE;
+                continue;
+            }
+            search.prev_dbrms = curr_dbrms;
+            search.rx_gain += gain_step;
+        }
     }
 
-    // The rx_gain value at this point is the gain setting where clipping
-    // occurs or the gain setting that is just beyond the gain range.
-    // The gain is reduced by 2 steps to make sure it is within the range and
-    // under the point where it is clipped with enough room to make adjustments.
-    rx_gain -= 2 * gain_step;
+    for (size_t i = 0; i < channels.size(); i++) {
+        auto& search = searches[i];
+        if (search.rx_gain_range.stop() - search.rx_gain_range.start() < gain_step) {
+            continue;
+        }
+        // The rx_gain value at this point is the gain setting where clipping
+        // occurs or the gain setting that is just beyond the gain range.
+        // The gain is reduced by 2 steps to make sure it is within the range and
+        // under the point where it is clipped with enough room to make adjustments.
+        search.rx_gain -= 2 * gain_step;
 
-    // Make sure the gain is within the range.
-    rx_gain = rx_gain_range.clip(rx_gain);
+        // Make sure the gain is within the range.
+        search.rx_gain = search.rx_gain_range.clip(search.rx_gain);
 
-    // Finally, set the gain.
-    usrp->set_rx_gain(rx_gain);
+        // Finally, set the gain.
+        usrp->set_rx_gain(search.rx_gain, channels[i]);
+    }
 }
 
 /***********************************************************************
@@ -353,6 +559,7 @@ UHD_INLINE void set_optimal_rx_gain(uhd::usrp::multi_usrp::sptr usrp,
 static void tx_thread(std::atomic_flag* transmit,
     uhd::usrp::multi_usrp::sptr usrp,
     uhd::tx_streamer::sptr tx_stream,
+    const std::vector<size_t>& channels,
     const double tx_wave_freq,
     const double tx_wave_ampl)
 {
@@ -360,7 +567,9 @@ static void tx_thread(std::atomic_flag* transmit,
     uhd::set_thread_priority_safe();
 
     // set max TX gain
-    usrp->set_tx_gain(usrp->get_tx_gain_range().stop());
+    for (const size_t chan : channels) {
+        usrp->set_tx_gain(usrp->get_tx_gain_range(chan).stop(), chan);
+    }
 
     // setup variables
     uhd::tx_metadata_t md;
@@ -393,11 +602,13 @@ static void tx_thread(std::atomic_flag* transmit,
         }
     }
 
-    // send until stopped
+    // send until stopped, the same wave on all channels
     size_t index = 0;
+    std::vector<const void*> buff_ptrs(tx_stream->get_num_channels());
     while (transmit->test_and_set()) {
         // send calls are aligned to the frame size for optimal performance
-        tx_stream->send(&buff[index], frame_size, md);
+        std::fill(buff_ptrs.begin(), buff_ptrs.end(), &buff[index]);
+        tx_stream->send(buff_ptrs, frame_size, md);
 
         // increment index
         index += frame_size;
@@ -431,15 +642,104 @@ bool has_tx_error(uhd::tx_streamer::sptr tx_stream)
                  | uhd::async_metadata_t::EVENT_CODE_SEQ_ERROR_IN_BURST);
 }
 
-void wait_for_lo_lock(uhd::usrp::multi_usrp::sptr usrp)
+void wait_for_lo_lock(
+    uhd::usrp::multi_usrp::sptr usrp, const std::vector<size_t>& channels = {0})
 {
     std::this_thread::sleep_for(std::chrono::milliseconds(50));
     const auto timeout =
         std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
-    while (not usrp->get_tx_sensor("lo_locked").to_bool()
-           or not usrp->get_rx_sensor("lo_locked").to_bool()) {
-        if (std::chrono::steady_clock::now() > timeout) {
-            throw std::runtime_error("timed out waiting for TX and/or RX LO to lock");
+    for (const size_t chan : channels) {
+        while (not usrp->get_tx_sensor("lo_locked", chan).to_bool()
+               or not usrp->get_rx_sensor("lo_locked", chan).to_bool()) {
+            if (std::chrono::steady_clock::now() > timeout) {
+                throw std::runtime_error("timed out waiting for TX and/or RX LO to lock");
+            }
+        }
+    }
+}
+
+/***********************************************************************
+ * Correction search, for all channels at once
+ **********************************************************************/
+//! A correction value, and the metric of the samples it was measured with
+struct correction_t
+{
+    std::complex<double> value;
+    double metric;
+};
+
+/*! Search the correction of every channel which maximizes a metric
+ *
+ * The real and the imaginary part of the correction are searched on a grid of
+ * num_search_steps x num_search_steps points. The grid starts out on [-1, 1] and
+ * is refined around the best correction until its step size is below
+ * \p precision. Every channel has its own grid, but all grids have the same
+ * step size, so the channels step through their grids together and share one
+ * capture per grid point.
+ *
+ * \param apply Sets the correction of a channel: apply(index, correction). The
+ *              index is an index into \p initial, i.e., a streamer channel.
+ * \param measure Returns the metric of the samples of a channel:
+ *                measure(index, samples). Greater values are better.
+ * \param initial Per channel, the correction to return if no grid point has a
+ *                greater metric.
+ * \returns the best correction of every channel
+ */
+template <typename apply_fn_t, typename measure_fn_t>
+std::vector<correction_t> search_corrections(uhd::usrp::multi_usrp::sptr usrp,
+    uhd::rx_streamer::sptr rx_stream,
+    uhd::tx_streamer::sptr tx_stream,
+    const size_t nsamps,
+    const double precision,
+    const bool warn_on_tx_error,
+    apply_fn_t&& apply,
+    measure_fn_t&& measure,
+    std::vector<correction_t> initial)
+{
+    std::vector<correction_t> best = std::move(initial);
+    std::vector<std::complex<double>> corr_start(best.size(), {-1.0, -1.0});
+    double corr_step      = 2.0 / (num_search_steps + 1);
+    size_t tx_error_count = 0;
+    std::vector<std::vector<samp_type>> buffs;
+    while (corr_step >= precision) {
+        // The imaginary part in the outer loop, the real part in the inner one
+        for (size_t imag_i = 1; imag_i <= num_search_steps; imag_i++) {
+            for (size_t real_i = 1; real_i <= num_search_steps; real_i++) {
+                const std::complex<double> offset(real_i * corr_step, imag_i * corr_step);
+                for (size_t i = 0; i < best.size(); i++) {
+                    apply(i, corr_start[i] + offset);
+                }
+
+                // receive some samples
+                capture_samples(usrp, rx_stream, buffs, nsamps);
+                // check for TX errors in the current captured iteration, and
+                // repeat it if there were any
+                while (has_tx_error(tx_stream)) {
+                    if (warn_on_tx_error) {
+                        std::cout << "[WARNING] TX error detected! "
+                                  << "Repeating current iteration" << std::endl;
+                    }
+                    tx_error_count++;
+                    if (tx_error_count >= MAX_NUM_TX_ERRORS) {
+                        throw uhd::runtime_error(
+                            "Too many TX errors. Aborting calibration.");
+                    }
+                    capture_samples(usrp, rx_stream, buffs, nsamps);
+                }
+
+                for (size_t i = 0; i < best.size(); i++) {
+                    const double metric = measure(i, buffs[i]);
+                    if (metric > best[i].metric) {
+                        best[i] = {corr_start[i] + offset, metric};
+                    }
+                }
+            }
+        }
+
+        for (size_t i = 0; i < best.size(); i++) {
+            corr_start[i] = best[i].value - std::complex<double>(corr_step, corr_step);
         }
+        corr_step = 2 * corr_step / (num_search_steps + 1);
     }
+    return best;
 }
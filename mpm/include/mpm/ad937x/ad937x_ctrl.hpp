@@ -287,8 +287,12 @@ void export_mykonos(py::module& top_module)
     using namespace mpm::chips;
     auto m = top_module.def_submodule("ad937x");
 
+    // The long-running calls release the GIL, so the AD9371s of several
+    // daughterboards can be initialized from concurrent threads
     py::class_<ad937x_ctrl, std::shared_ptr<ad937x_ctrl>>(m, "ad937x_ctrl")
-        .def("set_master_clock_rate", &ad937x_ctrl::set_master_clock_rate)
+        .def("set_master_clock_rate",
+            &ad937x_ctrl::set_master_clock_rate,
+            py::call_guard<py::gil_scoped_release>())
         .def("async__set_master_clock_rate",
             +[](ad937x_ctrl& self, const double rate) {
                 self.handle_set_master_clock_rate = std::async(std::launch::async,
@@ -303,7 +307,9 @@ void export_mykonos(py::module& top_module)
                 }
                 return false;
             })
-        .def("begin_initialization", &ad937x_ctrl::begin_initialization)
+        .def("begin_initialization",
+            &ad937x_ctrl::begin_initialization,
+            py::call_guard<py::gil_scoped_release>())
         .def("async__finish_initialization",
             +[](ad937x_ctrl& self) {
                 self.handle_finish_initialization = std::async(
@@ -341,8 +347,12 @@ void export_mykonos(py::module& top_module)
                 }
                 return false;
             })
-        .def("start_jesd_rx", &ad937x_ctrl::start_jesd_rx)
-        .def("start_jesd_tx", &ad937x_ctrl::start_jesd_tx)
+        .def("start_jesd_rx",
+            &ad937x_ctrl::start_jesd_rx,
+            py::call_guard<py::gil_scoped_release>())
+        .def("start_jesd_tx",
+            &ad937x_ctrl::start_jesd_tx,
+            py::call_guard<py::gil_scoped_release>())
         .def("start_radio", &ad937x_ctrl::start_radio)
         .def("stop_radio", &ad937x_ctrl::stop_radio)
         .def("get_multichip_sync_status", &ad937x_ctrl::get_multichip_sync_status)
@@ -358,13 +368,17 @@ void export_mykonos(py::module& top_module)
         .def("get_device_rev", &ad937x_ctrl::get_device_rev)
         .def("get_api_version", &ad937x_ctrl::get_api_version)
         .def("get_arm_version", &ad937x_ctrl::get_arm_version)
-        .def("set_bw_filter", &ad937x_ctrl::set_bw_filter)
+        .def("set_bw_filter",
+            &ad937x_ctrl::set_bw_filter,
+            py::call_guard<py::gil_scoped_release>())
         .def("set_gain", &ad937x_ctrl::set_gain)
         .def("get_gain", &ad937x_ctrl::get_gain)
         .def("set_agc_mode", &ad937x_ctrl::set_agc_mode)
         .def("set_clock_rate", &ad937x_ctrl::set_clock_rate)
         .def("enable_channel", &ad937x_ctrl::enable_channel)
-        .def("set_freq", &ad937x_ctrl::set_freq)
+        .def("set_freq",
+            &ad937x_ctrl::set_freq,
+            py::call_guard<py::gil_scoped_release>())
         .def("async__set_freq",
             +[](ad937x_ctrl& self,
                  const std::string& which,
@@ -388,7 +402,9 @@ void export_mykonos(py::module& top_module)
             })
         .def("get_freq", &ad937x_ctrl::get_freq)
         .def("get_lo_locked", &ad937x_ctrl::get_lo_locked)
-        .def("set_fir", &ad937x_ctrl::set_fir)
+        .def("set_fir",
+            &ad937x_ctrl::set_fir,
+            py::call_guard<py::gil_scoped_release>())
         .def("get_fir", &ad937x_ctrl::get_fir)
         .def("get_temperature", &ad937x_ctrl::get_temperature)
         .def_readonly_static("TX_BB_FILTER", &ad937x_ctrl::TX_BB_FILTER)
@@ -9,6 +9,7 @@
 #include <boost/noncopyable.hpp>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace mpm { namespace i2c {
@@ -54,6 +55,19 @@ public:
     virtual std::vector<uint8_t> transfer(
         std::vector<uint8_t>& tx, size_t num_rx_bytes, bool do_close = true) = 0;
 
+    /*!
+     * \param xfers The transactions: The data to send, and the number of bytes
+     *              to read afterwards, for every transaction
+     * \param do_close If true, close file descriptor at end of function
+     * \return Buffers of rx data, one per transaction
+     *
+     * This is the same as calling transfer() for every transaction, but with as
+     * few system calls as possible. The transactions are separated by repeated
+     * start conditions instead of stop conditions.
+     */
+    virtual std::vector<std::vector<uint8_t>> transfer_multi(
+        const std::vector<std::pair<std::vector<uint8_t>, size_t>>& xfers,
+        bool do_close = true) = 0;
 };
 
 }}; /* namespace mpm::i2c */
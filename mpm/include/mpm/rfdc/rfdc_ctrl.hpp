@@ -623,6 +623,17 @@ public:
     void set_adc_cal_coefficients(uint32_t tile_id, uint32_t block_id, uint32_t cal_block, std::vector<uint32_t> coefs);
     std::vector<uint32_t> get_adc_cal_coefficients(uint32_t tile_id, uint32_t block_id, uint32_t cal_block);
 
+    /**
+     * Stop overriding the coefficients of an ADC calibration block, i.e.,
+     * undo set_adc_cal_coefficients() and use the calibrated values again.
+     *
+     * @param    tile_id specify ADC target tile
+     * @param    block_id specify ADC block
+     * @param    cal_block the calibration block (0-3)
+     */
+    void disable_adc_cal_coefficients_override(
+        uint32_t tile_id, uint32_t block_id, uint32_t cal_block);
+
     /**
      * Resets an internal mixer with known valid settings.
      */
@@ -693,7 +704,9 @@ void export_rfdc(py::module& top_module)
         .def("set_cal_frozen", &rfdc_ctrl::set_cal_frozen)
         .def("get_cal_frozen", &rfdc_ctrl::get_cal_frozen)
         .def("set_adc_cal_coefficients", &rfdc_ctrl::set_adc_cal_coefficients)
-        .def("get_adc_cal_coefficients", &rfdc_ctrl::get_adc_cal_coefficients);
+        .def("get_adc_cal_coefficients", &rfdc_ctrl::get_adc_cal_coefficients)
+        .def("disable_adc_cal_coefficients_override",
+            &rfdc_ctrl::disable_adc_cal_coefficients_override);
 
     py::enum_<mpm::rfdc::rfdc_ctrl::threshold_id_options>(m, "threshold_id_options")
         .value("THRESHOLD_0", mpm::rfdc::rfdc_ctrl::THRESHOLD_0)
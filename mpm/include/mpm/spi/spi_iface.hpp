@@ -10,6 +10,7 @@
 #include <boost/noncopyable.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace mpm { namespace spi {
 
@@ -44,6 +45,28 @@ public:
      */
     virtual uint64_t transfer64_40(const uint64_t data) = 0;
 
+    /*! Like transfer24_8(), for several xfers at once
+     *
+     * The xfers are done in order, with as few system calls as possible.
+     *
+     * \param data The write data, one element per xfer
+     *
+     * \return 8 bits worth of the return xfer, for every xfer
+     */
+    virtual std::vector<uint32_t> transfer24_8_multi(
+        const std::vector<uint32_t>& data) = 0;
+
+    /*! Like transfer64_40(), for several xfers at once
+     *
+     * The xfers are done in order, with as few system calls as possible.
+     *
+     * \param data The write data, one element per xfer
+     *
+     * \return 40 bits worth of the return xfer, for every xfer
+     */
+    virtual std::vector<uint64_t> transfer64_40_multi(
+        const std::vector<uint64_t>& data) = 0;
+
     /*!
      * \param device The path to the spidev used (e.g. "/dev/spidev0.0")
      * \param speed_hz Transaction speed in Hz
@@ -19,5 +19,7 @@ void export_spi(py::module& top_module)
 
     py::class_<mpm::spi::spi_iface, std::shared_ptr<mpm::spi::spi_iface>>(m, "spi_iface")
         .def("transfer24_8", &mpm::spi::spi_iface::transfer24_8)
-        .def("transfer64_40", &mpm::spi::spi_iface::transfer64_40);
+        .def("transfer64_40", &mpm::spi::spi_iface::transfer64_40)
+        .def("transfer24_8_multi", &mpm::spi::spi_iface::transfer24_8_multi)
+        .def("transfer64_40_multi", &mpm::spi::spi_iface::transfer64_40_multi);
 }
@@ -10,12 +10,49 @@
 #include <boost/noncopyable.hpp>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace mpm { namespace types {
 
 class mmap_regs_iface : public boost::noncopyable
 {
 public:
+    /*! A single step of a register sequence, see run_sequence()
+     *
+     * Use the static functions to create these.
+     */
+    struct reg_op_t
+    {
+        enum op_type_t {
+            //! Write data to addr
+            POKE,
+            //! Read addr, and append the value to the results
+            PEEK,
+            //! Write the bits of data selected by mask to addr
+            MODIFY,
+            //! Sleep for usecs microseconds
+            DELAY,
+            //! Wait up to usecs microseconds until (addr & mask) == data
+            POLL
+        };
+
+        op_type_t op   = POKE;
+        uint32_t addr  = 0;
+        uint32_t data  = 0;
+        uint32_t mask  = 0xFFFFFFFF;
+        uint32_t usecs = 0;
+
+        static reg_op_t poke(const uint32_t addr, const uint32_t data);
+        static reg_op_t peek(const uint32_t addr);
+        static reg_op_t modify(
+            const uint32_t addr, const uint32_t data, const uint32_t mask);
+        static reg_op_t delay(const uint32_t usecs);
+        static reg_op_t poll(const uint32_t addr,
+            const uint32_t data,
+            const uint32_t mask,
+            const uint32_t timeout_usecs);
+    };
+
     mmap_regs_iface(const std::string& path,
         const size_t length,
         const size_t offset,
@@ -37,6 +74,17 @@ public:
     //! Read data from \p addr
     uint32_t peek32(const uint32_t addr);
 
+    /*! Run a sequence of register operations
+     *
+     * This allows running a whole register sequence (e.g., a reset with a
+     * wait for its completion) with a single call from Python.
+     *
+     * \returns the values read by the PEEK operations, in order
+     * \throws mpm::runtime_error if a POLL operation times out. All operations
+     *         before it have been run at that point.
+     */
+    std::vector<uint32_t> run_sequence(const std::vector<reg_op_t>& ops);
+
 private:
     void log(mpm::types::log_level_t level, const std::string path, const char* comment);
 
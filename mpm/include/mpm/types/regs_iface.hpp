@@ -8,6 +8,8 @@
 
 #include <boost/noncopyable.hpp>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace mpm { namespace types {
 
@@ -26,6 +28,32 @@ public:
      */
     virtual void poke8(const uint32_t addr, const uint8_t data) = 0;
 
+    /*! Write 8-bit values to given addresses, in order
+     *
+     * pokes8({{0, 1}, {0, 2}}) is the same as calling poke8(0, 1), poke8(0, 2).
+     * Implementations may batch the writes into fewer bus transactions.
+     */
+    virtual void pokes8(const std::vector<std::pair<uint32_t, uint8_t>>& addr_vals)
+    {
+        for (const auto& addr_val : addr_vals) {
+            poke8(addr_val.first, addr_val.second);
+        }
+    }
+
+    /*! Return 8-bit values from given addresses, in order
+     *
+     * Implementations may batch the reads into fewer bus transactions.
+     */
+    virtual std::vector<uint8_t> peeks8(const std::vector<uint32_t>& addrs)
+    {
+        std::vector<uint8_t> data;
+        data.reserve(addrs.size());
+        for (const uint32_t addr : addrs) {
+            data.push_back(peek8(addr));
+        }
+        return data;
+    }
+
     /*! Return a 16-bit value from a given address
      */
     virtual uint16_t peek16(const uint32_t addr) = 0;
@@ -11,6 +11,7 @@
 #include "log_buf.hpp"
 #include "mmap_regs_iface.hpp"
 #include "regs_iface.hpp"
+#include <pybind11/stl.h>
 
 void export_types(py::module& top_module)
 {
@@ -24,6 +25,8 @@ void export_types(py::module& top_module)
     py::class_<regs_iface, std::shared_ptr<regs_iface>>(m, "regs_iface")
         .def("peek8", &regs_iface::peek8)
         .def("poke8", &regs_iface::poke8)
+        .def("pokes8", &regs_iface::pokes8)
+        .def("peeks8", &regs_iface::peeks8)
         .def("peek16", &regs_iface::peek16)
         .def("poke16", &regs_iface::poke16)
         .def("peek32", &regs_iface::peek32)
@@ -40,10 +43,23 @@ void export_types(py::module& top_module)
                 std::get<2>(log_msg));
         });
 
-    py::class_<mmap_regs_iface, std::shared_ptr<mmap_regs_iface>>(m, "mmap_regs_iface")
-        .def(py::init<std::string, size_t, size_t, bool, bool>())
+    auto mmap_regs = py::class_<mmap_regs_iface, std::shared_ptr<mmap_regs_iface>>(
+        m, "mmap_regs_iface");
+    mmap_regs.def(py::init<std::string, size_t, size_t, bool, bool>())
         .def("open", &mmap_regs_iface::open)
         .def("close", &mmap_regs_iface::close)
         .def("peek32", &mmap_regs_iface::peek32)
-        .def("poke32", &mmap_regs_iface::poke32);
+        .def("poke32", &mmap_regs_iface::poke32)
+        .def("run_sequence", &mmap_regs_iface::run_sequence);
+
+    py::class_<mmap_regs_iface::reg_op_t>(mmap_regs, "reg_op")
+        .def_readonly("addr", &mmap_regs_iface::reg_op_t::addr)
+        .def_readonly("data", &mmap_regs_iface::reg_op_t::data)
+        .def_readonly("mask", &mmap_regs_iface::reg_op_t::mask)
+        .def_readonly("usecs", &mmap_regs_iface::reg_op_t::usecs)
+        .def_static("poke", &mmap_regs_iface::reg_op_t::poke)
+        .def_static("peek", &mmap_regs_iface::reg_op_t::peek)
+        .def_static("modify", &mmap_regs_iface::reg_op_t::modify)
+        .def_static("delay", &mmap_regs_iface::reg_op_t::delay)
+        .def_static("poll", &mmap_regs_iface::reg_op_t::poll);
 }
@@ -58,6 +58,35 @@ public:
         }
     }
 
+    void pokes8(const std::vector<std::pair<uint32_t, uint8_t>>& addr_vals)
+    {
+        std::vector<std::pair<std::vector<uint8_t>, size_t>> xfers;
+        xfers.reserve(addr_vals.size());
+        for (const auto& addr_val : addr_vals) {
+            std::vector<uint8_t> tx = _get_addr_bytes(addr_val.first);
+            tx.push_back(addr_val.second);
+            xfers.emplace_back(std::move(tx), 0);
+        }
+
+        _i2c_iface->transfer_multi(xfers);
+    }
+
+    std::vector<uint8_t> peeks8(const std::vector<uint32_t>& addrs)
+    {
+        std::vector<std::pair<std::vector<uint8_t>, size_t>> xfers;
+        xfers.reserve(addrs.size());
+        for (const uint32_t addr : addrs) {
+            xfers.emplace_back(_get_addr_bytes(addr), 1);
+        }
+
+        std::vector<uint8_t> data;
+        data.reserve(addrs.size());
+        for (const auto& rx : _i2c_iface->transfer_multi(xfers)) {
+            data.push_back(rx[0]);
+        }
+        return data;
+    }
+
     uint16_t peek16(const uint32_t addr)
     {
         uint8_t rx[2];
@@ -106,6 +135,16 @@ public:
     }
 
 private:
+    //! Return the register address as sent over the bus, MSB first
+    std::vector<uint8_t> _get_addr_bytes(const uint32_t addr)
+    {
+        std::vector<uint8_t> tx(_reg_addr_size);
+        for (size_t i = 0; i < _reg_addr_size; i++) {
+            tx[i] = 0xff & (addr >> 8 * (_reg_addr_size - i - 1));
+        }
+        return tx;
+    }
+
     mpm::i2c::i2c_iface::sptr _i2c_iface;
 
     const size_t _reg_addr_size;
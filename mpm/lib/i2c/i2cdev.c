@@ -83,3 +83,63 @@ int i2cdev_transfer(int fd, uint16_t addr, int ten_bit_addr,
     return 0;
 }
 
+int i2cdev_transfer_multi(int fd, uint16_t addr, int ten_bit_addr,
+                          uint8_t **tx, const size_t *tx_len,
+                          uint8_t **rx, const size_t *rx_len,
+                          size_t num_xfers)
+{
+    int err;
+    struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+    int num_msgs = 0;
+    struct i2c_rdwr_ioctl_data i2c_data = {
+        .msgs = msgs,
+    };
+    const uint16_t flags = ten_bit_addr ? I2C_M_TEN : 0;
+
+    for (size_t i = 0; i < num_xfers; i++) {
+        const int has_tx = tx[i] && tx_len[i] > 0;
+        const int has_rx = rx[i] && rx_len[i] > 0;
+        if (!has_tx && !has_rx)
+            return -EINVAL;
+
+        // Keep the write and read of a transaction in the same ioctl
+        if (num_msgs + has_tx + has_rx > I2C_RDWR_IOCTL_MAX_MSGS) {
+            i2c_data.nmsgs = num_msgs;
+            err = ioctl(fd, I2C_RDWR, &i2c_data);
+            if (err < 0) {
+                fprintf(stderr, "%s: Failed I2C_RDWR: %d\n", __func__, err);
+                perror("ioctl: \n");
+                return err;
+            }
+            num_msgs = 0;
+        }
+
+        if (has_tx) {
+            msgs[num_msgs].addr = addr;
+            msgs[num_msgs].buf = tx[i];
+            msgs[num_msgs].len = tx_len[i];
+            msgs[num_msgs].flags = flags;
+            num_msgs++;
+        }
+
+        if (has_rx) {
+            msgs[num_msgs].addr = addr;
+            msgs[num_msgs].buf = rx[i];
+            msgs[num_msgs].len = rx_len[i];
+            msgs[num_msgs].flags = flags | I2C_M_RD;
+            num_msgs++;
+        }
+    }
+
+    if (num_msgs > 0) {
+        i2c_data.nmsgs = num_msgs;
+        err = ioctl(fd, I2C_RDWR, &i2c_data);
+        if (err < 0) {
+            fprintf(stderr, "%s: Failed I2C_RDWR: %d\n", __func__, err);
+            perror("ioctl: \n");
+            return err;
+        }
+    }
+
+    return 0;
+}
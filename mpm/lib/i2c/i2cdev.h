@@ -52,6 +52,29 @@ int i2cdev_open(int *fd, const char *device, const unsigned int timeout_ms);
 int i2cdev_transfer(int fd, uint16_t addr, int ten_bit_addr,
                     uint8_t *tx, size_t tx_len,
                     uint8_t *rx, size_t rx_len);
+
+/*! Do several i2c transactions with the same device over i2cdev
+ *
+ * This is the same as calling i2cdev_transfer() for every one of the
+ * num_xfers transactions, but runs as many transactions per I2C_RDWR ioctl as
+ * the kernel allows. Within one ioctl, the transactions are separated by
+ * repeated start conditions rather than stop conditions.
+ *
+ * \param fd File descriptor for the i2cdev bus segment
+ * \param addr i2c device address
+ * \param ten_bit_addr Nonzero if true (typically 0)
+ * \param tx Buffers of data to be written to device, one per transaction
+ * \param tx_len Number of non-addr bytes to be written, per transaction
+ * \param rx Buffers where read data can be stored, one per transaction
+ * \param rx_len Number of bytes to be read, per transaction
+ * \param num_xfers Number of transactions
+ *
+ * \returns 0 if all is golden
+ */
+int i2cdev_transfer_multi(int fd, uint16_t addr, int ten_bit_addr,
+                          uint8_t **tx, const size_t *tx_len,
+                          uint8_t **rx, const size_t *rx_len,
+                          size_t num_xfers);
 #ifdef __cplusplus
 }
 #endif
@@ -89,6 +89,51 @@ public:
         return rx;
     }
 
+    std::vector<std::vector<uint8_t>> transfer_multi(
+        const std::vector<std::pair<std::vector<uint8_t>, size_t>>& xfers,
+        bool do_close)
+    {
+        std::vector<std::vector<uint8_t>> rx;
+        std::vector<uint8_t*> tx_data, rx_data;
+        std::vector<size_t> tx_len, rx_len;
+        rx.reserve(xfers.size());
+        for (const auto& xfer : xfers) {
+            rx.emplace_back(xfer.second);
+            // i2c-dev does not write to the buffers of write messages
+            tx_data.push_back(const_cast<uint8_t*>(xfer.first.data()));
+            tx_len.push_back(xfer.first.size());
+            rx_data.push_back(rx.back().data());
+            rx_len.push_back(xfer.second);
+        }
+        if (xfers.empty()) {
+            return rx;
+        }
+
+        if (_fd < 0) {
+            _open();
+        }
+
+        int ret = i2cdev_transfer_multi(_fd,
+            _addr,
+            _ten_bit_addr,
+            tx_data.data(),
+            tx_len.data(),
+            rx_data.data(),
+            rx_len.data(),
+            xfers.size());
+
+        if (do_close) {
+            close(_fd);
+            _fd = -ENODEV;
+        }
+
+        if (ret) {
+            throw mpm::runtime_error("I2C Transaction failed!");
+        }
+
+        return rx;
+    }
+
 private:
     const std::string _device;
     int _fd;
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <mutex>
 #include <thread>
 
 using namespace mpm::ad937x::device;
@@ -150,6 +151,15 @@ std::string ad937x_device::_get_arm_binary_path() const
 
 std::vector<uint8_t> ad937x_device::_get_arm_binary()
 {
+    // The binary is the same for all AD9371s, and for every initialization,
+    // so it is only read once per process
+    static std::mutex binary_mutex;
+    static std::vector<uint8_t> binary_cache;
+    std::lock_guard<std::mutex> lock(binary_mutex);
+    if (!binary_cache.empty()) {
+        return binary_cache;
+    }
+
     const auto path = _get_arm_binary_path();
     std::ifstream file(path, std::ios::binary);
     if (!file.is_open()) {
@@ -162,6 +172,7 @@ std::vector<uint8_t> ad937x_device::_get_arm_binary()
     if (file.bad()) {
         throw mpm::runtime_error("Error reading AD9371 ARM binary at path " + path);
     }
+    binary_cache = binary;
     return binary;
 }
 
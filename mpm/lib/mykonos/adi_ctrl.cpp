@@ -104,9 +104,12 @@ commonErr_t CMB_SPIWriteBytes(
 
     ad9371_spiSettings_t* spi = ad9371_spiSettings_t::make(spiSettings);
     try {
+        std::vector<std::pair<uint32_t, uint8_t>> addr_vals;
+        addr_vals.reserve(count);
         for (size_t i = 0; i < count; ++i) {
-            spi->spi_iface->poke8(addr[i], data[i]);
+            addr_vals.emplace_back(addr[i], data[i]);
         }
+        spi->spi_iface->pokes8(addr_vals);
         return COMMONERR_OK;
     } catch (const std::exception& e) {
         // TODO: spit out a reasonable error here (that will survive the C API transition)
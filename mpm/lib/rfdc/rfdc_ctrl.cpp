@@ -742,4 +742,13 @@ std::vector<uint32_t> rfdc_ctrl::get_adc_cal_coefficients(uint32_t tile_id, uint
     return result;
 }
 
+void rfdc_ctrl::disable_adc_cal_coefficients_override(
+    uint32_t tile_id, uint32_t block_id, uint32_t cal_block)
+{
+    if (XRFdc_DisableCoefficientsOverride(&rfdc_inst, tile_id, block_id, cal_block)
+        != XRFDC_SUCCESS) {
+        throw mpm::runtime_error("Error returned from XRFdc_DisableCoefficientsOverride");
+    }
+}
+
 }} // namespace mpm::rfdc
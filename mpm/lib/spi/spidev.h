@@ -6,6 +6,13 @@
 
 #include <stdint.h>
 
+/*! Max. number of transactions per SPI_IOC_MESSAGE ioctl in transfer_multi()
+ *
+ * spidev limits the number of bytes per ioctl to its bufsiz module parameter
+ * (4096 bytes by default), so this is kept well below that.
+ */
+#define SPIDEV_MAX_XFERS 64
+
 /*! Initialize a spidev interface
  *
  * \param fd Return value of the file descriptor
@@ -43,3 +50,22 @@ int transfer(
         uint32_t speed_hz, uint8_t bits_per_word, uint16_t delay_us
 );
 
+/*! Do several SPI transactions of the same length over spidev
+ *
+ * This is the same as calling transfer() num_xfers times, with tx and rx
+ * advancing by len bytes every time, but runs up to SPIDEV_MAX_XFERS
+ * transactions per ioctl. Chip select is deasserted between transactions.
+ *
+ * \param tx Buffer of data to be written, num_xfers * len bytes
+ * \param rx Must match tx buffer length; results will be written here
+ * \param len Number of bytes per transaction
+ * \param num_xfers Number of transactions
+ *
+ * \returns 0 if all is golden
+ */
+int transfer_multi(
+        int fd,
+        uint8_t *tx, uint8_t *rx, uint32_t len, uint32_t num_xfers,
+        uint32_t speed_hz, uint8_t bits_per_word, uint16_t delay_us
+);
+
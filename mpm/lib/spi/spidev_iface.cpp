@@ -14,6 +14,7 @@ extern "C" {
 #include <linux/spi/spidev.h>
 #include <boost/format.hpp>
 #include <iostream>
+#include <vector>
 
 using namespace mpm::spi;
 
@@ -111,7 +112,61 @@ public:
         return result;
     }
 
+    std::vector<uint32_t> transfer24_8_multi(const std::vector<uint32_t>& data)
+    {
+        std::vector<uint8_t> tx(3 * data.size());
+        for (size_t i = 0; i < data.size(); i++) {
+            tx[3 * i]     = (data[i] >> 16) & 0xFF;
+            tx[3 * i + 1] = (data[i] >> 8) & 0xFF;
+            tx[3 * i + 2] = data[i] & 0xFF;
+        }
+        const std::vector<uint8_t> rx = _transfer_multi(tx, 3);
+
+        std::vector<uint32_t> result(data.size());
+        for (size_t i = 0; i < data.size(); i++) {
+            result[i] = uint32_t(rx[3 * i + 2]);
+        }
+        return result;
+    }
+
+    std::vector<uint64_t> transfer64_40_multi(const std::vector<uint64_t>& data)
+    {
+        // See transfer64_40() for the layout of the xfers
+        std::vector<uint8_t> tx(8 * data.size(), 0);
+        for (size_t i = 0; i < data.size(); i++) {
+            for (size_t byte = 0; byte < 6; byte++) {
+                tx[8 * i + byte] = (data[i] >> (8 * (5 - byte))) & 0xFF;
+            }
+        }
+        const std::vector<uint8_t> rx = _transfer_multi(tx, 8);
+
+        std::vector<uint64_t> result(data.size());
+        for (size_t i = 0; i < data.size(); i++) {
+            uint64_t value = 0;
+            for (size_t byte = 3; byte < 8; byte++) {
+                value = (value << 8) | rx[8 * i + byte];
+            }
+            result[i] = value;
+        }
+        return result;
+    }
+
 private:
+    //! Do one xfer of len bytes per len bytes of tx, return the received bytes
+    std::vector<uint8_t> _transfer_multi(std::vector<uint8_t>& tx, const uint32_t len)
+    {
+        std::vector<uint8_t> rx(tx.size());
+        if (tx.empty()) {
+            return rx;
+        }
+        if (transfer_multi(
+                _fd, tx.data(), rx.data(), len, tx.size() / len, _speed, _bits, _delay)
+            != 0) {
+            throw mpm::runtime_error(str(boost::format("SPI Transaction failed!")));
+        }
+        return rx;
+    }
+
     int _fd;
     const uint32_t _mode;
     uint32_t _speed = 2000000;
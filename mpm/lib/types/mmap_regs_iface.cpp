@@ -12,11 +12,68 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <boost/format.hpp>
+#include <chrono>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 using namespace mpm::types;
 
+namespace {
+//! Time between two reads of a register in a POLL operation
+constexpr auto POLL_INTERVAL = std::chrono::microseconds(10);
+} // namespace
+
+mmap_regs_iface::reg_op_t mmap_regs_iface::reg_op_t::poke(
+    const uint32_t addr, const uint32_t data)
+{
+    reg_op_t op;
+    op.op   = POKE;
+    op.addr = addr;
+    op.data = data;
+    return op;
+}
+
+mmap_regs_iface::reg_op_t mmap_regs_iface::reg_op_t::peek(const uint32_t addr)
+{
+    reg_op_t op;
+    op.op   = PEEK;
+    op.addr = addr;
+    return op;
+}
+
+mmap_regs_iface::reg_op_t mmap_regs_iface::reg_op_t::modify(
+    const uint32_t addr, const uint32_t data, const uint32_t mask)
+{
+    reg_op_t op;
+    op.op   = MODIFY;
+    op.addr = addr;
+    op.data = data;
+    op.mask = mask;
+    return op;
+}
+
+mmap_regs_iface::reg_op_t mmap_regs_iface::reg_op_t::delay(const uint32_t usecs)
+{
+    reg_op_t op;
+    op.op    = DELAY;
+    op.usecs = usecs;
+    return op;
+}
+
+mmap_regs_iface::reg_op_t mmap_regs_iface::reg_op_t::poll(const uint32_t addr,
+    const uint32_t data,
+    const uint32_t mask,
+    const uint32_t timeout_usecs)
+{
+    reg_op_t op;
+    op.op    = POLL;
+    op.addr  = addr;
+    op.data  = data;
+    op.mask  = mask;
+    op.usecs = timeout_usecs;
+    return op;
+}
 
 mmap_regs_iface::mmap_regs_iface(const std::string& path,
     const size_t length,
@@ -91,6 +148,44 @@ uint32_t mmap_regs_iface::peek32(const uint32_t addr)
     return _mmap[addr / sizeof(uint32_t)];
 }
 
+std::vector<uint32_t> mmap_regs_iface::run_sequence(const std::vector<reg_op_t>& ops)
+{
+    MPM_ASSERT_THROW(_mmap);
+    std::vector<uint32_t> results;
+    for (const auto& op : ops) {
+        volatile uint32_t* reg = _mmap + op.addr / sizeof(uint32_t);
+        switch (op.op) {
+            case reg_op_t::POKE:
+                *reg = op.data;
+                break;
+            case reg_op_t::PEEK:
+                results.push_back(static_cast<uint32_t>(*reg));
+                break;
+            case reg_op_t::MODIFY:
+                *reg = (*reg & ~op.mask) | (op.data & op.mask);
+                break;
+            case reg_op_t::DELAY:
+                std::this_thread::sleep_for(std::chrono::microseconds(op.usecs));
+                break;
+            case reg_op_t::POLL: {
+                const auto timeout = std::chrono::steady_clock::now()
+                                     + std::chrono::microseconds(op.usecs);
+                while ((*reg & op.mask) != op.data) {
+                    if (std::chrono::steady_clock::now() > timeout) {
+                        throw mpm::runtime_error(
+                            str(boost::format("Timeout while polling register 0x%X "
+                                              "(mask 0x%X, expected 0x%X)")
+                                % op.addr % op.mask % op.data));
+                    }
+                    std::this_thread::sleep_for(POLL_INTERVAL);
+                }
+                break;
+            }
+        }
+    }
+    return results;
+}
+
 void mmap_regs_iface::log(
     mpm::types::log_level_t level, const std::string path, const char* comment)
 {
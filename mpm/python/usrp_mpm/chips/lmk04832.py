@@ -33,6 +33,9 @@ class LMK04832:
         Apply a series of pokes.
         pokes8([(0,1),(0,2)]) is the same as calling poke8(0,1), poke8(0,2).
         """
+        if hasattr(self.regs_iface, 'pokes8'):
+            self.regs_iface.pokes8(list(addr_vals))
+            return
         for addr, val in addr_vals:
             self.poke8(addr, val)
 
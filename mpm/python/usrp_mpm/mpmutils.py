@@ -167,9 +167,10 @@ def async_exec(parent, method_name, *args):
     # Spawn async
     getattr(parent, async_name)(*args)
     awaitable_method = getattr(parent, await_name)
-    # await
+    # await. The methods often return within a few milliseconds (e.g., tuning),
+    # so poll often enough not to add to their execution time.
     while not awaitable_method():
-        time.sleep(0.1)
+        time.sleep(0.005)
 
 @contextmanager
 def lock_guard(lockable):
@@ -9,9 +9,10 @@ Mboard implementation base class
 """
 
 import os
+import threading
 from enum import Enum
 from hashlib import md5
-from time import sleep
+from time import monotonic, sleep
 from concurrent import futures
 from six import iteritems, itervalues
 from usrp_mpm.mpmlog import get_logger
@@ -107,6 +108,10 @@ class PeriphManagerBase:
     # A list of available sensors on the motherboard. This dictionary is a map
     # of the form sensor_name -> method name
     mboard_sensor_callback_map = {}
+    # Maximum age (in seconds) of the sensor values returned by
+    # get_all_mb_sensors(). Within this time, repeated calls return the cached
+    # values instead of reading out the sensors again.
+    mboard_sensor_cache_max_age = 1.0
     # This is a sanity check value to see if the correct number of
     # daughterboards are detected. If somewhere along the line more than
     # max_num_dboards dboards are found, an error or warning is raised,
@@ -250,6 +255,10 @@ class PeriphManagerBase:
         # classes.
         self._xport_mgrs = {}
         self._xport_adapter_mgrs = {}
+        # Snapshot of all motherboard sensors, see get_all_mb_sensors()
+        self._mb_sensor_cache = {}
+        self._mb_sensor_cache_time = None
+        self._mb_sensor_cache_lock = threading.Lock()
         # Set up logging
         self.log = get_logger('PeriphManager')
         self.claimed = False
@@ -992,6 +1001,14 @@ class PeriphManagerBase:
                 getattr(self, self.updateable_components[id_str]['callback'])
             self.log.info("Installing component `%s'", id_str)
             update_func(filepath, metadata)
+            # Remember the hash of the loaded image, so clients can skip
+            # loading it again. A delayed reload leaves it unknown which image
+            # will be loaded.
+            component_info = self.updateable_components[id_str]
+            if 'md5' in metadata and metadata.get('reset', "").lower() != "false":
+                component_info['md5'] = metadata['md5']
+            else:
+                component_info.pop('md5', None)
         return True
 
     @no_claim
@@ -1050,6 +1067,34 @@ class PeriphManagerBase:
             self, self.mboard_sensor_callback_map.get(sensor_name)
         )()
 
+    def get_all_mb_sensors(self):
+        """
+        Return a dictionary sensor_name -> sensor value, which contains all
+        motherboard sensors. The sensor values are the same dictionaries that
+        get_mb_sensor() returns.
+
+        This lets monitoring code read out all sensors with a single RPC call.
+        The values are cached for up to mboard_sensor_cache_max_age seconds, so
+        many clients polling this do not cause more sensor readouts (and
+        contention with other calls, such as tuning) than a single one does.
+        Sensors which fail to read out are omitted from the snapshot.
+        """
+        with self._mb_sensor_cache_lock:
+            cache_time = self._mb_sensor_cache_time
+            if cache_time is not None and \
+                    monotonic() - cache_time < self.mboard_sensor_cache_max_age:
+                return self._mb_sensor_cache
+            snapshot = {}
+            for sensor_name in self.get_mb_sensors():
+                try:
+                    snapshot[sensor_name] = self.get_mb_sensor(sensor_name)
+                except Exception as ex:
+                    self.log.warning("Failed to read sensor `{}': {}"
+                                     .format(sensor_name, str(ex)))
+            self._mb_sensor_cache = snapshot
+            self._mb_sensor_cache_time = monotonic()
+            return snapshot
+
     ##########################################################################
     # EEPROMS
     ##########################################################################
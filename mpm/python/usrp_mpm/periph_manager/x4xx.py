@@ -901,9 +901,12 @@ class x4xx(ZynqComponents, PeriphManagerBase):
                 self.log.error(msg)
                 raise RuntimeError(msg)
         self.log.trace(f"Set master clock rate (SPLL) to: {master_clock_rate}")
-        self._clk_mgr.set_spll_rate(sample_clock_freq, is_legacy_mode)
+        spll_changed = self._clk_mgr.set_spll_rate(sample_clock_freq, is_legacy_mode)
         self._master_clock_rate = master_clock_rate
-        self.rfdc.sync()
+        # The converters only need to be synchronized again if their clocks
+        # were reset
+        if spll_changed:
+            self.rfdc.sync()
         self._clk_mgr.config_pps_to_timekeeper(master_clock_rate)
 
     def set_trigger_io(self, direction):
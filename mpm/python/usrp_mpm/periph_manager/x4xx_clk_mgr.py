@@ -162,6 +162,9 @@ class X4xxClockMgr:
         self._set_reset_rfdc = lambda **kwargs: None
         self._set_reset_db_clocks = lambda *args: None
         self._rpll_reference_sources = {}
+        # The (sample clock freq, reference clock freq, legacy mode) the SPLL
+        # was last configured with, or None if it may have changed since
+        self._spll_config = None
         # Init peripherals
         self._init_available_srcs()
         self._init_clk_peripherals()
@@ -356,11 +359,25 @@ class X4xxClockMgr:
         """
         Safely set the output rate of the sample PLL.
 
-        This will do the required resets.
+        This will do the required resets. If the SPLL is locked, and was
+        already configured for this rate (with the current reference clock),
+        then this skips the reconfiguration, and the downstream clocks keep
+        running.
+
+        Returns True if the SPLL was reconfigured.
         """
+        if self._spll_config == \
+                (sample_clock_freq, self.get_ref_clock_freq(), is_legacy_mode):
+            spll_status = self._sample_pll.get_status()
+            if spll_status['PLL1 lock'] and spll_status['PLL2 lock']:
+                self.log.trace("SPLL is already configured for a sample clock "
+                               "of {:.2f} MHz, skipping reconfiguration."
+                               .format(sample_clock_freq / 1e6))
+                return False
         self._reset_clocks(value=True, reset_list=('rfdc', 'cpld', 'db_clock'))
         self._config_spll(sample_clock_freq, is_legacy_mode)
         self._reset_clocks(value=False, reset_list=('rfdc', 'cpld', 'db_clock'))
+        return True
 
     @no_rpc
     def set_sync_source(self, clock_source, time_source):
@@ -582,6 +599,8 @@ class X4xxClockMgr:
         """
         if value:
             self.log.trace("Reset clocks: {}".format(reset_list))
+            if 'spll' in reset_list or 'rpll' in reset_list:
+                self._spll_config = None
             if 'db_clock' in reset_list:
                 self._set_reset_db_clocks(value)
             if 'cpld' in reset_list:
@@ -623,6 +642,8 @@ class X4xxClockMgr:
             raise RuntimeError('Invalid internal BRC source of {} was selected.'
                                .format(internal_brc_source))
         ref_select = self._rpll_reference_sources[internal_brc_source][0]
+        # The SPLL reference will change, so it needs to be configured again
+        self._spll_config = None
 
         # If the desired rate matches the rate of the primary reference source,
         # directly passthrough that reference source
@@ -641,9 +662,12 @@ class X4xxClockMgr:
         """
         Configures the SPLL for the specified master clock rate.
         """
+        self._spll_config = None
         self._sample_pll.init()
         self._sample_pll.config(sample_clock_freq, self.get_ref_clock_freq(),
                                 is_legacy_mode)
+        self._spll_config = \
+            (sample_clock_freq, self.get_ref_clock_freq(), is_legacy_mode)
 
     def _set_brc_source(self, clock_source):
         """
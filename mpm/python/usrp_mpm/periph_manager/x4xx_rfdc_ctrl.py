@@ -350,6 +350,18 @@ class X4xxRfdcCtrl:
             result.append(self._rfdc_ctrl.get_adc_cal_coefficients(tile_id, block_id, cal_block))
         return result
 
+    def reset_cal_coefs(self, channel, slot_id, cal_block):
+        """
+        Undo set_cal_coefs(), i.e., let the calibration block use the
+        coefficients found by the ADC calibration again.
+        """
+        self.log.trace(
+            "Resetting ADC cal coefficients for channel={} slot_id={} cal_block={}".format(
+                channel, slot_id, cal_block))
+        for tile_id, block_id, _ in self._find_converters(slot_id, "rx", channel):
+            self._rfdc_ctrl.disable_adc_cal_coefficients_override(
+                tile_id, block_id, cal_block)
+
     ### DAC mux
     def set_dac_mux_data(self, i_val, q_val):
         """
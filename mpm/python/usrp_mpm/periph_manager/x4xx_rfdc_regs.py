@@ -7,8 +7,7 @@
 X4xx RFDC register control
 """
 
-import time
-from usrp_mpm.sys_utils.uio import UIO
+from usrp_mpm.sys_utils.uio import UIO, RegOp
 
 class RfdcRegsControl:
     """
@@ -75,17 +74,16 @@ class RfdcRegsControl:
             3: 5,
         }
         en_mask = 1 << bit_offsets[channel]
-        en = en & ~en_mask
-        self.poke(self.CAL_ENABLE_OFFSET, en | (en_mask if enable else 0))
+        self.run_sequence([RegOp.modify(
+            self.CAL_ENABLE_OFFSET, en_mask if enable else 0, en_mask)])
 
     def enable_iq_swap(self, enable, db_id, block_id, is_dac):
         iq_swap_bit = (int(is_dac) * 8) + (db_id * 4) + block_id
 
         # Write IQ swap bit with a mask
-        reg_val = self.peek(self.IQ_SWAP_OFFSET)
-        reg_val = (reg_val & ~(1 << iq_swap_bit)) \
-                    | (enable << iq_swap_bit)
-        self.poke(self.IQ_SWAP_OFFSET, reg_val)
+        iq_swap_mask = 1 << iq_swap_bit
+        self.run_sequence([RegOp.modify(
+            self.IQ_SWAP_OFFSET, int(enable) << iq_swap_bit, iq_swap_mask)])
 
     def set_reset_mmcm(self, reset=True):
         if reset:
@@ -101,16 +99,21 @@ class RfdcRegsControl:
         The datasheet specifies a 100us max lock time
         """
         DATA_CLK_PLL_LOCKED = 1 << 20
+        # Time before the first lock check (microseconds)
+        LOCK_DELAY = 200
 
-        POLL_SLEEP = 0.0002
-        for _ in range(int(timeout / POLL_SLEEP)):
-            time.sleep(POLL_SLEEP)
-            status = self.peek(self.RF_PLL_STATUS_OFFSET)
-            if status & DATA_CLK_PLL_LOCKED:
-                self.log.trace("RF MMCM lock detected.")
-                return
-        self.log.error("MMCM failed to lock in the expected time.")
-        raise RuntimeError("MMCM failed to lock within the expected time.")
+        try:
+            self.run_sequence([
+                RegOp.delay(LOCK_DELAY),
+                RegOp.poll(self.RF_PLL_STATUS_OFFSET,
+                           DATA_CLK_PLL_LOCKED,
+                           DATA_CLK_PLL_LOCKED,
+                           max(int(timeout * 1e6) - LOCK_DELAY, 0)),
+            ])
+        except RuntimeError:
+            self.log.error("MMCM failed to lock in the expected time.")
+            raise RuntimeError("MMCM failed to lock within the expected time.")
+        self.log.trace("RF MMCM lock detected.")
 
     def set_gated_clock_enables(self, value=True):
         """
@@ -185,44 +188,37 @@ class RfdcRegsControl:
     def set_reset_adc_dac_chains(self, reset=True):
         """ Resets or enables the ADC and DAC chain for the given dboard """
 
-        def _wait_for_done(done_bit, timeout=5):
-            """
-            Wait for the specified sequence done bit when resetting or
-            enabling an ADC or DAC chain. Throws an error on timeout.
-            """
-            status = self.peek(self.RF_RESET_STATUS_OFFSET)
-            if (status & done_bit):
-                return
-            for _ in range(0, timeout):
-                time.sleep(0.001) # 1 ms
-                status = self.peek(self.RF_RESET_STATUS_OFFSET)
-                if (status & done_bit):
-                    return
-            self.log.error("Timeout while resetting or enabling ADC/DAC chains.")
-            raise RuntimeError("Timeout while resetting or enabling ADC/DAC chains.")
-
         # CONTROL OFFSET
         ADC_RESET   = 1 << 4
         DAC_RESET   = 1 << 8
         # STATUS OFFSET
         ADC_SEQ_DONE    = 1 << 7
         DAC_SEQ_DONE    = 1 << 11
+        # Time to wait for a sequence done bit (microseconds)
+        SEQ_DONE_TIMEOUT = 5000
 
         if reset:
             if self._converter_chains_in_reset:
                 self.log.debug('Converters are already in reset. '
                                'The reset bit will NOT be toggled.')
                 return
-            # Reset the ADC and DAC chains
-            self.log.trace('Resetting ADC chain')
-            self.poke(self.RF_RESET_CONTROL_OFFSET, ADC_RESET)
-            _wait_for_done(ADC_SEQ_DONE)
-            self.poke(self.RF_RESET_CONTROL_OFFSET, 0x0)
-
-            self.log.trace('Resetting DAC chain')
-            self.poke(self.RF_RESET_CONTROL_OFFSET, DAC_RESET)
-            _wait_for_done(DAC_SEQ_DONE)
-            self.poke(self.RF_RESET_CONTROL_OFFSET, 0x0)
+            # Reset the ADC and DAC chains, one after the other
+            self.log.trace('Resetting ADC and DAC chains')
+            try:
+                self.run_sequence([
+                    RegOp.poke(self.RF_RESET_CONTROL_OFFSET, ADC_RESET),
+                    RegOp.poll(self.RF_RESET_STATUS_OFFSET,
+                               ADC_SEQ_DONE, ADC_SEQ_DONE, SEQ_DONE_TIMEOUT),
+                    RegOp.poke(self.RF_RESET_CONTROL_OFFSET, 0x0),
+                    RegOp.poke(self.RF_RESET_CONTROL_OFFSET, DAC_RESET),
+                    RegOp.poll(self.RF_RESET_STATUS_OFFSET,
+                               DAC_SEQ_DONE, DAC_SEQ_DONE, SEQ_DONE_TIMEOUT),
+                    RegOp.poke(self.RF_RESET_CONTROL_OFFSET, 0x0),
+                ])
+            except RuntimeError:
+                error_msg = "Timeout while resetting or enabling ADC/DAC chains."
+                self.log.error(error_msg)
+                raise RuntimeError(error_msg)
 
             self._converter_chains_in_reset = True
         else: # enable
@@ -261,3 +257,11 @@ class RfdcRegsControl:
         with self.regs:
             result = self.regs.peek32(addr)
             return result
+
+    def run_sequence(self, ops):
+        """
+        Run a list of register operations (see UIO.run_sequence()) with a
+        single call into C++.
+        """
+        with self.regs:
+            return self.regs.run_sequence(ops)
@@ -32,7 +32,7 @@ from usrp_mpm.sys_utils import net
 TIMEOUT_INTERVAL = 5.0 # Seconds before claim expires (default value)
 TOKEN_LEN = 16 # Length of the token string
 # Compatibility number for MPM
-MPM_COMPAT_NUM = (4, 3)
+MPM_COMPAT_NUM = (4, 6)
 
 def no_claim(func):
     " Decorator for functions that require no token check "
@@ -249,6 +249,32 @@ class MPMServer(RPCServer):
         self.log.debug("I was pinged from: %s:%s", self.client_host, self.client_port)
         return data
 
+    def batch(self, token, calls):
+        """
+        Run a list of RPC calls, and return the list of their return values.
+
+        Every entry of calls is a pair of a method name and the list of its
+        arguments. Methods which require a claim are also passed the token.
+        The calls are run in order, and the first one that fails aborts the
+        batch. This saves a network round trip per call, e.g., when UHD
+        initializes a session.
+        """
+        results = []
+        for command, args in calls:
+            method = None
+            if not command.startswith('_') and command != 'batch':
+                method = getattr(self, command, None)
+            if not callable(method):
+                self._last_error = \
+                    "Invalid method `{}' in RPC batch call.".format(command)
+                self.log.error(self._last_error)
+                raise RuntimeError(self._last_error)
+            if command in self.claimed_methods:
+                results.append(method(token, *args))
+            else:
+                results.append(method(*args))
+        return results
+
     ###########################################################################
     # Claiming logic
     ###########################################################################
@@ -12,7 +12,7 @@ from threading import Thread
 import socket
 import queue
 import select
-from uhd.chdr import ChdrPacket, ChdrWidth
+from uhd.chdr import ChdrPacket, ChdrWidth, ChdrStreamEngine
 from .rfnoc_graph import XbarNode, XportNode, StreamEndpointNode, RFNoCGraph, NodeType
 from .chdr_stream import ChdrOutputStream, ChdrInputStream
 
@@ -69,6 +69,11 @@ class ChdrEndpoint:
     traffic.
 
     The config parameter is a Config object (see simulator/config.py)
+
+    With the native stream engine, a ChdrStreamEngine receives all
+    packets from the socket and handles the streams. The packets it
+    doesn't handle are dispatched by the control_worker thread, and
+    queued packets are sent by the send_worker thread.
     """
     def __init__(self, log, config):
         self.log = log.getChild("ChdrEndpoint")
@@ -80,10 +85,24 @@ class ChdrEndpoint:
         self.send_queue = SelectableQueue()
         self.send_wrapper = SendWrapper(self.send_queue)
 
+        self.main_sock = socket.socket(socket.AF_INET,
+                                       socket.SOCK_DGRAM)
+        self.main_sock.bind(("0.0.0.0", 49153))
+        self.stream_engine = None
+        if config.stream.engine == "native":
+            self.log.info("Using the native stream engine")
+            self.stream_engine = ChdrStreamEngine(self.main_sock.fileno(), CHDR_W)
+
         self.graph = RFNoCGraph(self.get_default_nodes(), self.log, 0, self.send_wrapper,
-                                CHDR_W, config.hardware.rfnoc_device_type)
-        self.thread = Thread(target=self.socket_worker, daemon=True)
-        self.thread.start()
+                                CHDR_W, config.hardware.rfnoc_device_type,
+                                self.stream_engine, config.stream)
+        if self.stream_engine is None:
+            self.threads = [Thread(target=self.socket_worker, daemon=True)]
+        else:
+            self.threads = [Thread(target=self.control_worker, daemon=True),
+                            Thread(target=self.send_worker, daemon=True)]
+        for thread in self.threads:
+            thread.start()
 
     def set_device_id(self, device_id):
         """Set the device_id for this endpoint"""
@@ -126,9 +145,7 @@ class ChdrEndpoint:
         in.
         """
         self.log.info("Starting ChdrEndpoint Thread")
-        main_sock = socket.socket(socket.AF_INET,
-                                  socket.SOCK_DGRAM)
-        main_sock.bind(("0.0.0.0", 49153))
+        main_sock = self.main_sock
 
         while True:
             # This allows us to block on multiple sockets at the same time
@@ -138,26 +155,56 @@ class ChdrEndpoint:
                 if sock is main_sock:
                     # Received Data over socket
                     n_bytes, sender = main_sock.recvfrom_into(buffer)
-                    self.log.trace("Received {} bytes of data from {}"
-                                   .format(n_bytes, sender))
-                    try:
-                        packet = ChdrPacket.deserialize(CHDR_W, buffer[:n_bytes])
-                        self.log.trace("Decoded Packet: {}"
-                                       .format(packet.to_string_with_payload()))
-                        entry_xport = (NodeType.XPORT, 0)
-                        response = self.graph.handle_packet(packet, entry_xport, sender,
-                                                            sender, n_bytes)
-
-                        if response is not None:
-                            data = response.serialize()
-                            self.log.trace("Returning Packet: {}"
-                                           .format(packet.to_string_with_payload()))
-                            main_sock.sendto(bytes(data), sender)
-                    except BaseException as ex:
-                        self.log.warning("Unable to decode packet: {}"
-                                         .format(ex))
-                        raise ex
+                    self._handle_data(buffer[:n_bytes], sender)
                 else:
-                    data, addr = self.send_queue.get()
-                    sent_len = main_sock.sendto(data, addr)
-                    assert len(data) == sent_len, "Didn't send whole packet."
+                    self._send_queued()
+
+    def control_worker(self):
+        """This is the method that runs in a background thread with the
+        native stream engine. It processes the packets which the engine
+        doesn't handle.
+        """
+        self.log.info("Starting ChdrEndpoint Control Thread")
+        while True:
+            received = self.stream_engine.recv_control(1.0)
+            if received is not None:
+                data, sender = received
+                self._handle_data(data, sender)
+
+    def send_worker(self):
+        """This is the method that runs in a background thread with the
+        native stream engine. It sends the packets of the send_queue.
+        """
+        while True:
+            self._send_queued()
+
+    def _handle_data(self, data, sender):
+        """Decode a received packet and send it through the graph"""
+        n_bytes = len(data)
+        self.log.trace("Received {} bytes of data from {}"
+                       .format(n_bytes, sender))
+        try:
+            packet = ChdrPacket.deserialize(CHDR_W, data)
+            self.log.trace("Decoded Packet: {}"
+                           .format(packet.to_string_with_payload()))
+            entry_xport = (NodeType.XPORT, 0)
+            response = self.graph.handle_packet(packet, entry_xport, sender,
+                                                sender, n_bytes)
+
+            if response is not None:
+                data = response.serialize()
+                self.log.trace("Returning Packet: {}"
+                               .format(packet.to_string_with_payload()))
+                self.main_sock.sendto(bytes(data), sender)
+        except BaseException as ex:
+            self.log.warning("Unable to decode packet: {}"
+                             .format(ex))
+            raise ex
+
+    def _send_queued(self):
+        """Send the next packet of the send_queue, blocking until there
+        is one
+        """
+        data, addr = self.send_queue.get()
+        sent_len = self.main_sock.sendto(data, addr)
+        assert len(data) == sent_len, "Didn't send whole packet."
@@ -13,6 +13,7 @@ from threading import Thread
 import queue
 import socket
 from uhd.chdr import PacketType, StrcOpCode, StrcPayload, StrsPayload, StrsStatus, ChdrHeader, ChdrPacket
+from uhd.chdr import ChdrStreamEngineOutputArgs
 
 class XferCount:
     """This class keeps track of flow control transfer status which are
@@ -255,3 +256,66 @@ class ChdrOutputStream:
             "Flow Control Error: STRS Status is {}".format(strs_payload.status)
         self.recv.num_packets = strs_payload.xfer_count_pkts
         self.recv.num_bytes = strs_payload.xfer_count_bytes
+
+class NativeInputStream:
+    """This class hands an Rx stream to a ChdrStreamEngine, which counts
+    the data packets and responds to the STRC packets in C++. It has the
+    interface of a ChdrInputStream, but the engine never passes it any
+    packets.
+    """
+    def __init__(self, log, stream_engine, our_epid, capacity_bytes):
+        self.log = log
+        self.stream_engine = stream_engine
+        self.our_epid = our_epid
+        self.log.info("Native Stream RX Starting with {} bytes capacity"
+                      .format(capacity_bytes))
+        self.stream_engine.begin_input(our_epid, capacity_bytes)
+
+    def finish(self):
+        """Stops handling the stream in the engine"""
+        self.stream_engine.end_input(self.our_epid)
+        stats = self.stream_engine.get_input_stats(self.our_epid)
+        self.log.info("Native Stream RX Done: {} packets, {} bytes, {} sequence errors"
+                      .format(stats.num_packets, stats.num_bytes, stats.num_seq_errors))
+
+    def queue_packet(self, packet, recv_len, addr):
+        """The engine handles all packets of the stream"""
+        raise RuntimeError("Native RX Stream received a packet: {}".format(packet))
+
+class NativeOutputStream:
+    """This class hands a Tx stream to a ChdrStreamEngine, which generates
+    the packets of the stream_spec and handles their flow control in C++.
+    It has the interface of a ChdrOutputStream.
+
+    If paced is False, the packets are sent as fast as flow control
+    allows, instead of at the sample rate of the stream_spec.
+    """
+    def __init__(self, log, stream_engine, src_epid, stream_spec, paced):
+        self.log = log
+        self.stream_engine = stream_engine
+        self.src_epid = src_epid
+        args = ChdrStreamEngineOutputArgs()
+        args.src_epid = src_epid
+        args.dst_epid = stream_spec.dst_epid
+        args.addr, args.port = stream_spec.addr
+        args.packet_samples = stream_spec.packet_samples
+        args.sample_rate = stream_spec.sample_rate if paced else 0.0
+        args.num_samples = 0 if stream_spec.is_continuous else stream_spec.total_samples
+        args.has_timestamp = stream_spec.is_timed
+        args.timestamp = stream_spec.init_timestamp
+        args.capacity_packets = stream_spec.capacity_packets
+        args.capacity_bytes = stream_spec.capacity_bytes
+        self.log.info("Native Stream TX Starting with {} packets/sec"
+                      .format(1/stream_spec.seconds_per_packet() if paced else "unpaced"))
+        self.stream_engine.begin_output(args)
+
+    def finish(self):
+        """Stops the stream in the engine"""
+        self.stream_engine.end_output(self.src_epid)
+        stats = self.stream_engine.get_output_stats(self.src_epid)
+        self.log.info("Native Stream TX Done: {} packets, {} bytes, {} flow control stalls"
+                      .format(stats.num_packets, stats.num_bytes, stats.num_fc_stalls))
+
+    def queue_packet(self, packet):
+        """The engine handles the STRS packets of the stream"""
+        raise RuntimeError("Native TX Stream received a packet: {}".format(packet))
@@ -54,6 +54,37 @@ class HardwareDescriptor:
             dict['dboard_class'],
             dict['rfnoc_device_type'])
 
+class StreamConfig:
+    """This class contains the configuration of the streaming backend.
+    It is read from the optional [stream] section of a config file.
+
+    engine -> "python" streams in Python threads (see chdr_stream.py),
+        which take their samples from the sample source and sink.
+        "native" hands the streams to the ChdrStreamEngine of UHD, which
+        streams in C++ at multi-Gb/s, for load testing the host. Its
+        output samples are all zeros, and input samples are discarded.
+    input_capacity -> The buffer size in bytes which native input streams
+        report to the host for flow control
+    paced -> If false, native output streams are sent as fast as the
+        host returns flow control credit, instead of at the sample rate
+    """
+    ENGINES = ("python", "native")
+
+    def __init__(self, engine="python", input_capacity=1024 * 1024, paced=True):
+        if engine not in StreamConfig.ENGINES:
+            raise ValueError("Unknown stream engine {}, expected one of {}"
+                             .format(engine, StreamConfig.ENGINES))
+        self.engine = engine
+        self.input_capacity = input_capacity
+        self.paced = paced
+
+    @classmethod
+    def from_section(cls, section):
+        """Construct a StreamConfig from a configparser section"""
+        return cls(section.get('engine', 'python'),
+                   section.getint('input_capacity', 1024 * 1024),
+                   section.getboolean('paced', True))
+
 class Config:
     """This class represents a configuration file for the usrp simulator.
     This file should conform to the .ini format defined by the
@@ -64,11 +95,15 @@ class Config:
     Source/Sink class to instanitate (see the decorators in
     sample_source.py). The other key value pairs in the section are
     passed to the source/sink constructor as strings through **kwargs
+
+    It may have a [stream] section, which configures the streaming
+    backend (see StreamConfig).
     """
-    def __init__(self, source_gen, sink_gen, hardware):
+    def __init__(self, source_gen, sink_gen, hardware, stream=None):
         self.source_gen = source_gen
         self.sink_gen = sink_gen
         self.hardware = hardware
+        self.stream = stream if stream is not None else StreamConfig()
 
     @classmethod
     def from_path(cls, log, path):
@@ -86,6 +121,10 @@ class Config:
         if 'sample.sink' in parser:
             sink_gen = Config._read_sample_section(parser['sample.sink'], sinks)
             parser.pop('sample.sink')
+        stream = StreamConfig()
+        if 'stream' in parser:
+            stream = StreamConfig.from_section(parser['stream'])
+            parser.pop('stream')
         hardware_section = dict(parser['hardware'])
         preset_name = hardware_section.get('preset', None)
         hardware_preset = presets[preset_name].copy() if preset_name is not None else {}
@@ -99,7 +138,7 @@ class Config:
             # This helps stop you from shooting yourself in the foot when you add
             # the [sampel.sink] section
             log.warning("Unrecognized section in config file: {}".format(unused_section))
-        return cls(source_gen, sink_gen, hardware)
+        return cls(source_gen, sink_gen, hardware, stream)
 
     @staticmethod
     def _read_sample_section(section, lookup):
@@ -148,7 +148,8 @@ class RFNoCGraph:
     It serves as an interface between the ChdrEndpoint and the
     individual blocks/nodes.
     """
-    def __init__(self, graph_list, log, device_id, send_wrapper, chdr_w, rfnoc_device_id):
+    def __init__(self, graph_list, log, device_id, send_wrapper, chdr_w, rfnoc_device_id,
+                 stream_engine=None, stream_config=None):
         self.log = log.getChild("Graph")
         self.device_id = device_id
         self.stream_spec = StreamSpec()
@@ -157,7 +158,8 @@ class RFNoCGraph:
             if node.__class__ is StreamEndpointNode:
                 self.stream_ep.append(node)
             node.graph_init(self.log, self.get_device_id, send_wrapper=send_wrapper,
-                            chdr_w=chdr_w, dst_to_addr=self.dst_to_addr)
+                            chdr_w=chdr_w, dst_to_addr=self.dst_to_addr,
+                            stream_engine=stream_engine, stream_config=stream_config)
         # These must be done sequentially so that get_device_id is initialized on all nodes
         # before from_index is called on any node
         for node in graph_list:
@@ -11,7 +11,8 @@ from uhd.chdr import MgmtOpCode, MgmtOpCfg, MgmtOp, PacketType, CtrlStatus, Ctrl
     ChdrHeader, StrcOpCode, StrcPayload, ChdrPacket, StrsStatus
 from .rfnoc_common import Node, NodeType, to_iter, swap_src_dst, RETURN_TO_SENDER
 from .stream_ep_regs import StreamEpRegs, STRM_STATUS_FC_ENABLED
-from .chdr_stream import ChdrOutputStream, ChdrInputStream
+from .chdr_stream import ChdrOutputStream, ChdrInputStream, NativeOutputStream, \
+    NativeInputStream
 
 class StreamEndpointNode(Node):
     """Represents a Stream endpoint node
@@ -37,6 +38,8 @@ class StreamEndpointNode(Node):
         self.chdr_w = None
         self.send_wrapper = None
         self.dst_to_addr = None
+        self.stream_engine = None
+        self.stream_config = None
         self.source_gen = source_gen
         self.sink_gen = sink_gen
         self.downstream_capacity = None
@@ -70,12 +73,16 @@ class StreamEndpointNode(Node):
         self.begin_input()
         return STRM_STATUS_FC_ENABLED
 
-    def graph_init(self, log, set_device_id, send_wrapper, chdr_w, dst_to_addr, **kwargs):
+    def graph_init(self, log, set_device_id, send_wrapper, chdr_w, dst_to_addr,
+                   stream_engine=None, stream_config=None, **kwargs):
         super().graph_init(log, set_device_id)
         self.ep_regs.log = log
         self.chdr_w = chdr_w
         self.send_wrapper = send_wrapper
         self.dst_to_addr = dst_to_addr
+        # If a ChdrStreamEngine is given, streams are handed to it
+        self.stream_engine = stream_engine
+        self.stream_config = stream_config
 
     def get_type(self):
         return NodeType.STRM_EP
@@ -192,6 +199,10 @@ class StreamEndpointNode(Node):
         stream_spec.capacity_packets = self.downstream_capacity[0]
         stream_spec.capacity_bytes = self.downstream_capacity[1]
         self.downstream_capacity = None
+        if self.stream_engine is not None:
+            self.output_stream = NativeOutputStream(self.log, self.stream_engine, self.epid,
+                                                    stream_spec, self.stream_config.paced)
+            return
         self.output_stream = ChdrOutputStream(self.log, self.chdr_w, self.source_gen(),
                                               stream_spec, self.send_wrapper)
 
@@ -219,5 +230,9 @@ class StreamEndpointNode(Node):
         # a new one on the same epid, just quietly close the old one.
         if self.input_stream is not None:
             self.input_stream.finish()
+        if self.stream_engine is not None:
+            self.input_stream = NativeInputStream(self.log, self.stream_engine, self.epid,
+                                                  self.stream_config.input_capacity)
+            return
         self.input_stream = ChdrInputStream(self.log, self.chdr_w,
                                             self.sink_gen(), self.send_wrapper, self.epid)
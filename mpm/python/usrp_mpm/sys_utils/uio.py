@@ -14,6 +14,12 @@ import pyudev
 import usrp_mpm.libpyusrp_periphs as lib
 from usrp_mpm.mpmlog import get_logger
 
+# A single step of a register sequence, see UIO.run_sequence(). Use the static
+# methods (RegOp.poke(addr, data), RegOp.peek(addr), RegOp.modify(addr, data,
+# mask), RegOp.delay(usecs), RegOp.poll(addr, data, mask, timeout_usecs)) to
+# create them.
+RegOp = lib.types.mmap_regs_iface.reg_op
+
 UIO_SYSFS_BASE_DIR = '/sys/class/uio'
 UIO_DEV_BASE_DIR = '/dev'
 
@@ -204,3 +210,14 @@ class UIO(object):
         """
         assert not self._read_only
         return self._uio.poke32(addr, val)
+
+    def run_sequence(self, ops):
+        """
+        Run a list of RegOp register operations, and return the list of values
+        read by the peek operations.
+
+        The whole sequence runs in C++, which is a lot faster than the
+        equivalent peek32() and poke32() calls from Python. Will throw a
+        RuntimeError if a poll operation times out.
+        """
+        return self._uio.run_sequence(ops)